@@ -21,4 +21,5 @@ src/iso1 \
 src/din \
 src/codec \
 src/appHandshake \
+src/benchmark \
 
@@ -8,30 +8,45 @@ C_SRCS += \
 ../src/codec/BitOutputStream.c \
 ../src/codec/ByteStream.c \
 ../src/codec/DecoderChannel.c \
+../src/codec/DynamicMemory.c \
 ../src/codec/EXIHeaderDecoder.c \
 ../src/codec/EXIHeaderEncoder.c \
 ../src/codec/EncoderChannel.c \
-../src/codec/MethodsBag.c 
+../src/codec/GrammarDecoder.c \
+../src/codec/MemoryArena.c \
+../src/codec/MethodsBag.c \
+../src/codec/Sha256.c \
+../src/codec/StringTable.c 
 
 OBJS += \
 ./src/codec/BitInputStream.o \
 ./src/codec/BitOutputStream.o \
 ./src/codec/ByteStream.o \
 ./src/codec/DecoderChannel.o \
+./src/codec/DynamicMemory.o \
 ./src/codec/EXIHeaderDecoder.o \
 ./src/codec/EXIHeaderEncoder.o \
 ./src/codec/EncoderChannel.o \
-./src/codec/MethodsBag.o 
+./src/codec/GrammarDecoder.o \
+./src/codec/MemoryArena.o \
+./src/codec/MethodsBag.o \
+./src/codec/Sha256.o \
+./src/codec/StringTable.o 
 
 C_DEPS += \
 ./src/codec/BitInputStream.d \
 ./src/codec/BitOutputStream.d \
 ./src/codec/ByteStream.d \
 ./src/codec/DecoderChannel.d \
+./src/codec/DynamicMemory.d \
 ./src/codec/EXIHeaderDecoder.d \
 ./src/codec/EXIHeaderEncoder.d \
 ./src/codec/EncoderChannel.d \
-./src/codec/MethodsBag.d 
+./src/codec/GrammarDecoder.d \
+./src/codec/MemoryArena.d \
+./src/codec/MethodsBag.d \
+./src/codec/Sha256.d \
+./src/codec/StringTable.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -7,19 +7,32 @@ C_SRCS += \
 ../src/test/main.c \
 ../src/test/main_databinder.c \
 ../src/test/main_commandlineinterface.c \
-../src/test/main_example.c 
+../src/test/main_example.c \
+../src/test/main_server.c \
+../src/test/main_batch.c \
+../src/test/main_pcap.c 
 
 OBJS += \
 ./src/test/main.o \
 ./src/test/main_databinder.o \
 ./src/test/main_commandlineinterface.o \
-./src/test/main_example.o 
+./src/test/main_example.o \
+./src/test/main_server.o \
+./src/test/main_batch.o \
+./src/test/main_pcap.o 
 
 C_DEPS += \
 ./src/test/main.d \
 ./src/test/main_databinder.d \
 ./src/test/main_commandlineinterface.d \
-./src/test/main_example.d 
+./src/test/main_example.d \
+./src/test/main_server.d \
+./src/test/main_batch.d \
+./src/test/main_pcap.d \
+./src/test/main_sample.d 
+
+SAMPLE_OBJS += \
+./src/test/main_sample.o 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -30,4 +43,12 @@ src/test/%.o: ../src/test/%.c
 	@echo 'Finished building: $<'
 	@echo ' '
 
+# main.c once more for the sample program (main_example.c), see CODE_VERSION in main.h
+src/test/main_sample.o: ../src/test/main.c
+	@echo 'Building file: $<'
+	@echo 'Invoking: GCC C Compiler'
+	gcc -I"../src/codec" -I"../src/din" -I"../src/iso1" -I"../src/iso2" -I"../src/xmldsig" -I"../src/appHandshake" -I"../src/transport" -I"../src/test" -Os -Wall -DCODE_VERSION=CODE_VERSION_SAMPLE -c -fmessage-length=0 -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@:%.o=%.d)" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
 
@@ -34,6 +34,7 @@
 
 #include "DecoderChannel.h"
 #include "EXIHeaderDecoder.h"
+#include "GrammarDecoder.h"
 
 #include "appHandEXIDatatypes.h"
 #include "ErrorCodes.h"
@@ -41,10 +42,7 @@
 #ifndef EXI_appHand_DATATYPES_DECODER_C
 #define EXI_appHand_DATATYPES_DECODER_C
 
-/** event-code */
-static uint32_t eventCode;
-static int errn;
-static uint32_t uint32;
+/* Note: eventCode, errn and uint32 are locals of each decode function (reentrant decoding) */
 
 
 /* Forward Declarations */
@@ -52,11 +50,43 @@ static int decode_appHandAppProtocolType(bitstream_t* stream, struct appHandAppP
 static int decode_appHandAnonType_supportedAppProtocolReq(bitstream_t* stream, struct appHandAnonType_supportedAppProtocolReq* appHandAnonType_supportedAppProtocolReq);
 static int decode_appHandAnonType_supportedAppProtocolRes(bitstream_t* stream, struct appHandAnonType_supportedAppProtocolRes* appHandAnonType_supportedAppProtocolRes);
 
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+/* type independent signatures for the grammar tables */
+static int decode_appHandAppProtocolTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_appHandAppProtocolType(stream, (struct appHandAppProtocolType*)value);
+}
+#endif /* GRAMMAR_DECODER_TABLE */
+
 /* Deviant data decoding (skip functions) */
 
 
 /* Complex type name='urn:iso:15118:2:2010:AppProtocol,AppProtocolType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(ProtocolNamespace,VersionNumberMajor,VersionNumberMinor,SchemaID,Priority)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t appHandAppProtocolTypeProductions[6] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct appHandAppProtocolType, ProtocolNamespace.characters), offsetof(struct appHandAppProtocolType, ProtocolNamespace.charactersLen), appHandAppProtocolType_ProtocolNamespace_CHARACTERS_SIZE, 0 /* ProtocolNamespace */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct appHandAppProtocolType, VersionNumberMajor), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct appHandAppProtocolType, VersionNumberMinor), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(uint8_t), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct appHandAppProtocolType, SchemaID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(uint8_t), 1, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct appHandAppProtocolType, Priority), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t appHandAppProtocolTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 0, 5 }
+};
+static const exi_grammar_state_t appHandAppProtocolTypeStates[6] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }
+};
+static const exi_grammar_t appHandAppProtocolTypeGrammar = { appHandAppProtocolTypeStates, appHandAppProtocolTypeTransitions, appHandAppProtocolTypeProductions, NULL };
+
+static int decode_appHandAppProtocolType(bitstream_t* stream, struct appHandAppProtocolType* appHandAppProtocolType) {
+	init_appHandAppProtocolType(appHandAppProtocolType);
+	return decodeGrammar(stream, &appHandAppProtocolTypeGrammar, appHandAppProtocolType);
+}
+#else
 static int decode_appHandAppProtocolType(bitstream_t* stream, struct appHandAppProtocolType* appHandAppProtocolType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 0;
 	int done = 0;
 	
@@ -79,9 +109,12 @@ static int decode_appHandAppProtocolType(bitstream_t* stream, struct appHandAppP
 								if (appHandAppProtocolType->ProtocolNamespace.charactersLen >= 2) {
 									appHandAppProtocolType->ProtocolNamespace.charactersLen = (uint16_t)(appHandAppProtocolType->ProtocolNamespace.charactersLen - 2); /* string table miss */
 									errn = decodeCharacters(stream, appHandAppProtocolType->ProtocolNamespace.charactersLen, appHandAppProtocolType->ProtocolNamespace.characters, appHandAppProtocolType_ProtocolNamespace_CHARACTERS_SIZE);
+									if (errn == 0) {
+										errn = addStringValue(stream, 0 /* ProtocolNamespace */, appHandAppProtocolType->ProtocolNamespace.characters, appHandAppProtocolType->ProtocolNamespace.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+									errn = decodeStringValueHit(stream, 0 /* ProtocolNamespace */, &appHandAppProtocolType->ProtocolNamespace.charactersLen, appHandAppProtocolType->ProtocolNamespace.characters, appHandAppProtocolType_ProtocolNamespace_CHARACTERS_SIZE);
 								}
 							}
 						} else {
@@ -260,9 +293,36 @@ static int decode_appHandAppProtocolType(bitstream_t* stream, struct appHandAppP
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:AppProtocol,#AnonType_supportedAppProtocolReq',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(AppProtocol{1-20})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t appHandAnonType_supportedAppProtocolReqProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, appHandAnonType_supportedAppProtocolReq_AppProtocol_ARRAY_SIZE, offsetof(struct appHandAnonType_supportedAppProtocolReq, AppProtocol.array), offsetof(struct appHandAnonType_supportedAppProtocolReq, AppProtocol.arrayLen), sizeof(((struct appHandAnonType_supportedAppProtocolReq*)0)->AppProtocol.array[0]), 0, 0, 0, 0, decode_appHandAppProtocolTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t appHandAnonType_supportedAppProtocolReqTransitions[40] = {
+	{ 1, 0 }, { 2, 0 }, { 0, 1 }, { 3, 0 }, { 0, 1 }, { 4, 0 }, { 0, 1 }, { 5, 0 },
+	{ 0, 1 }, { 6, 0 }, { 0, 1 }, { 7, 0 }, { 0, 1 }, { 8, 0 }, { 0, 1 }, { 9, 0 },
+	{ 0, 1 }, { 10, 0 }, { 0, 1 }, { 11, 0 }, { 0, 1 }, { 12, 0 }, { 0, 1 }, { 13, 0 },
+	{ 0, 1 }, { 14, 0 }, { 0, 1 }, { 15, 0 }, { 0, 1 }, { 16, 0 }, { 0, 1 }, { 17, 0 },
+	{ 0, 1 }, { 18, 0 }, { 0, 1 }, { 19, 0 }, { 0, 1 }, { 20, 0 }, { 0, 1 }, { 0, 1 }
+};
+static const exi_grammar_state_t appHandAnonType_supportedAppProtocolReqStates[21] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 2, 2 }, { 5, 2, 2 }, { 7, 2, 2 }, { 9, 2, 2 }, { 11, 2, 2 }, { 13, 2, 2 },
+	{ 15, 2, 2 }, { 17, 2, 2 }, { 19, 2, 2 }, { 21, 2, 2 }, { 23, 2, 2 }, { 25, 2, 2 }, { 27, 2, 2 }, { 29, 2, 2 },
+	{ 31, 2, 2 }, { 33, 2, 2 }, { 35, 2, 2 }, { 37, 2, 2 }, { 39, 1, 1 }
+};
+static const exi_grammar_t appHandAnonType_supportedAppProtocolReqGrammar = { appHandAnonType_supportedAppProtocolReqStates, appHandAnonType_supportedAppProtocolReqTransitions, appHandAnonType_supportedAppProtocolReqProductions, NULL };
+
+static int decode_appHandAnonType_supportedAppProtocolReq(bitstream_t* stream, struct appHandAnonType_supportedAppProtocolReq* appHandAnonType_supportedAppProtocolReq) {
+	init_appHandAnonType_supportedAppProtocolReq(appHandAnonType_supportedAppProtocolReq);
+	return decodeGrammar(stream, &appHandAnonType_supportedAppProtocolReqGrammar, appHandAnonType_supportedAppProtocolReq);
+}
+#else
 static int decode_appHandAnonType_supportedAppProtocolReq(bitstream_t* stream, struct appHandAnonType_supportedAppProtocolReq* appHandAnonType_supportedAppProtocolReq) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 7;
 	int done = 0;
 	
@@ -751,9 +811,40 @@ static int decode_appHandAnonType_supportedAppProtocolReq(bitstream_t* stream, s
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:AppProtocol,#AnonType_supportedAppProtocolRes',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(ResponseCode,SchemaID{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t appHandAnonType_supportedAppProtocolResProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(appHandresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct appHandAnonType_supportedAppProtocolRes, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(uint8_t), 0, 0, 0, 0, 0, 0, 0, offsetof(struct appHandAnonType_supportedAppProtocolRes, SchemaID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t appHandAnonType_supportedAppProtocolResTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t appHandAnonType_supportedAppProtocolResStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }
+};
+static void appHandAnonType_supportedAppProtocolResUsed(void* value, uint8_t flag) {
+	struct appHandAnonType_supportedAppProtocolRes* appHandAnonType_supportedAppProtocolRes = (struct appHandAnonType_supportedAppProtocolRes*)value;
+	switch(flag) {
+	case 0:
+		appHandAnonType_supportedAppProtocolRes->SchemaID_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t appHandAnonType_supportedAppProtocolResGrammar = { appHandAnonType_supportedAppProtocolResStates, appHandAnonType_supportedAppProtocolResTransitions, appHandAnonType_supportedAppProtocolResProductions, appHandAnonType_supportedAppProtocolResUsed };
+
+static int decode_appHandAnonType_supportedAppProtocolRes(bitstream_t* stream, struct appHandAnonType_supportedAppProtocolRes* appHandAnonType_supportedAppProtocolRes) {
+	init_appHandAnonType_supportedAppProtocolRes(appHandAnonType_supportedAppProtocolRes);
+	return decodeGrammar(stream, &appHandAnonType_supportedAppProtocolResGrammar, appHandAnonType_supportedAppProtocolRes);
+}
+#else
 static int decode_appHandAnonType_supportedAppProtocolRes(bitstream_t* stream, struct appHandAnonType_supportedAppProtocolRes* appHandAnonType_supportedAppProtocolRes) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 27;
 	int done = 0;
 	
@@ -857,11 +948,14 @@ static int decode_appHandAnonType_supportedAppProtocolRes(bitstream_t* stream, s
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 
 
 
 int decode_appHandExiDocument(bitstream_t* stream, struct appHandEXIDocument* exiDoc) {
+	uint32_t eventCode;
+	int errn = 0;
 	errn = readEXIHeader(stream);
 
 	if(errn == 0) {
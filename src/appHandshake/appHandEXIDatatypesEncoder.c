@@ -41,8 +41,7 @@
 #ifndef EXI_appHand_DATATYPES_ENCODER_C
 #define EXI_appHand_DATATYPES_ENCODER_C
 
-static int errn;
-
+/* Note: errn is a local of each encode function (reentrant encoding) */
 /* Forward Declarations */
 static int encode_appHandAppProtocolType(bitstream_t* stream, struct appHandAppProtocolType* appHandAppProtocolType);
 static int encode_appHandAnonType_supportedAppProtocolReq(bitstream_t* stream, struct appHandAnonType_supportedAppProtocolReq* appHandAnonType_supportedAppProtocolReq);
@@ -51,6 +50,7 @@ static int encode_appHandAnonType_supportedAppProtocolRes(bitstream_t* stream, s
 
 /* Complex type name='urn:iso:15118:2:2010:AppProtocol,AppProtocolType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(ProtocolNamespace,VersionNumberMajor,VersionNumberMinor,SchemaID,Priority)',  derivedBy='RESTRICTION'.  */
 static int encode_appHandAppProtocolType(bitstream_t* stream, struct appHandAppProtocolType* appHandAppProtocolType) {
+	int errn = 0;
 	int grammarID = 0;
 	int done = 0;
 	
@@ -65,11 +65,8 @@ static int encode_appHandAppProtocolType(bitstream_t* stream, struct appHandAppP
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(appHandAppProtocolType->ProtocolNamespace.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, appHandAppProtocolType->ProtocolNamespace.characters, appHandAppProtocolType->ProtocolNamespace.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 0 /* ProtocolNamespace */, appHandAppProtocolType->ProtocolNamespace.characters, appHandAppProtocolType->ProtocolNamespace.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -176,6 +173,7 @@ static int encode_appHandAppProtocolType(bitstream_t* stream, struct appHandAppP
 
 /* Complex type name='urn:iso:15118:2:2010:AppProtocol,#AnonType_supportedAppProtocolReq',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(AppProtocol{1-20})',  derivedBy='RESTRICTION'.  */
 static int encode_appHandAnonType_supportedAppProtocolReq(bitstream_t* stream, struct appHandAnonType_supportedAppProtocolReq* appHandAnonType_supportedAppProtocolReq) {
+	int errn = 0;
 	int grammarID = 7;
 	int done = 0;
 	
@@ -562,6 +560,7 @@ static int encode_appHandAnonType_supportedAppProtocolReq(bitstream_t* stream, s
 
 /* Complex type name='urn:iso:15118:2:2010:AppProtocol,#AnonType_supportedAppProtocolRes',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(ResponseCode,SchemaID{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_appHandAnonType_supportedAppProtocolRes(bitstream_t* stream, struct appHandAnonType_supportedAppProtocolRes* appHandAnonType_supportedAppProtocolRes) {
+	int errn = 0;
 	int grammarID = 27;
 	int done = 0;
 	
@@ -636,6 +635,7 @@ static int encode_appHandAnonType_supportedAppProtocolRes(bitstream_t* stream, s
 
 
 int encode_appHandExiDocument(bitstream_t* stream, struct appHandEXIDocument* exiDoc) {
+	int errn = 0;
 	errn = writeEXIHeader(stream);
 
 	if(errn == 0) {
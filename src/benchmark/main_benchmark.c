@@ -0,0 +1,528 @@
+/*******************************************************************
+ * Micro benchmark for the OpenV2G codecs: times the document decoder and
+ * encoder of every schema with canned messages and reports ns/op, bytes/op
+ * and allocations/op.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+/* Usage:
+     OpenV2G_benchmark.exe [<filter> [<milliseconds>]]
+   <filter> selects the messages whose schema (H, D, 1, 2) or name contains it, "*" selects all.
+   <milliseconds> is the measuring time per message and operation, default 50.
+   e.g. "OpenV2G_benchmark.exe CurrentDemand 200"
+
+   The messages are the ones produced by charging1(), charging2() and din_test() in main_example.c and by
+   the encoder of the command line interface. The charging loop messages which neither of them produces
+   (e.g. the ISO1 requests and the ISO2 CurrentDemand and WeldingDetection) were encoded from documents
+   filled with typical values, so that each schema has its complete DC charging loop. So were the DIN and ISO1
+   ServiceDetail, PaymentDetails, ChargingStatus and MeteringReceipt messages which are missing there (PaymentDetailsReq
+   with a short dummy certificate). Not covered are the CertificateInstallation and CertificateUpdate messages of
+   all three schemas, which carry certificate chains and signatures, and the ISO2 messages which DIN and ISO1 do not
+   have (SystemStatus, DC_BidirectionalControl, AC_BidirectionalControl, VehicleCheckIn, VehicleCheckOut, PowerDemand,
+   Pairing, AlignmentCheck, FinePositioning, FinePositioningSetup, ConnectChargingDevice, DisconnectChargingDevice).
+   The encoder is timed with the document that the decoder produced from the canned message, bytes/op is the size of
+   the encoded message.
+   Allocations are counted by wrapping malloc, calloc and realloc at link time (-Wl,--wrap=...),
+   so only the calls of the codec itself are counted. Built with DATABINDING_SLIM, the decoders take the large values
+   from a static arena, which each decode starts over.
+
+   Each message is also checked, and the exit code is nonzero if one of the checks fails ("make check"):
+   - the encoder gives the canned message again,
+   - decoded into a document which holds another message, the document encodes to the canned message again,
+   - DIN CurrentDemandRes: encode_dinCurrentDemandResTemplate gives the same bytes and error codes as
+     encode_dinExiDocument for a series of pseudo random values, patched into the template or encoded in full.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "EXITypes.h"
+#include "MemoryArena.h"
+#include "ByteStream.h"
+#include "StringTable.h"
+
+#include "appHandEXIDatatypes.h"
+#include "appHandEXIDatatypesEncoder.h"
+#include "appHandEXIDatatypesDecoder.h"
+
+#include "dinEXIDatatypes.h"
+#include "dinEXIDatatypesEncoder.h"
+#include "dinEXIDatatypesDecoder.h"
+
+#include "iso1EXIDatatypes.h"
+#include "iso1EXIDatatypesEncoder.h"
+#include "iso1EXIDatatypesDecoder.h"
+
+#include "iso2EXIDatatypes.h"
+#include "iso2EXIDatatypesEncoder.h"
+#include "iso2EXIDatatypesDecoder.h"
+
+#define BENCHMARK_BUFFER_SIZE 4096
+#define BENCHMARK_DEFAULT_MILLISECONDS 50
+#define BENCHMARK_BATCH 64 /* operations between two clock readings */
+#define BENCHMARK_ARENA_SIZE 65536
+#define BENCHMARK_TEMPLATE_MESSAGES 4000 /* CurrentDemandRes messages of the template check */
+
+struct benchmarkPayload {
+    char schema; /* H=applicationHandshake, D=DIN, 1=ISO1, 2=ISO2 */
+    const char* name;
+    const char* hex;
+};
+
+static const struct benchmarkPayload payloads[] = {
+    { 'H', "supportedAppProtocolReq", "8000dbab9371d3234b71d1b981899189d191818991d26b9b3a232b30020000000040" },
+    { 'H', "supportedAppProtocolRes", "80400040" },
+    { 'D', "SessionSetupReq", "809a02000000000000000011d01b7ab6fbbf7ab400" },
+    { 'D', "ServiceDiscoveryReq", "809a02004080c1014181c21198" },
+    { 'D', "ServicePaymentSelectionReq", "809a02004080c1014181c211b2001280" },
+    { 'D', "ChargeParameterDiscoveryReq", "809a02004080c1014181c2107190401f00c0c190080e19098060a11c0601848706d008061214138020c81400" },
+    { 'D', "CableCheckReq", "809a02004080c1014181c21011401f00" },
+    { 'D', "PreChargeReq", "809a02004080c1014181c21151401f00c140500c0c0040" },
+    { 'D', "PowerDeliveryReq", "809a02004080c1014181c211302200001f000000" },
+    { 'D', "CurrentDemandReq", "809a02004080c1014181c210d1401f00c0c0506001810580480c08360100c1400400" },
+    { 'D', "WeldingDetectionReq", "809a02004080c1014181c21211401f00" },
+    { 'D', "SessionStopReq", "809a02004080c1014181c211f0" },
+    { 'D', "ContractAuthenticationReq", "809a02004080c1014181c210b8" },
+    { 'D', "SessionSetupRes", "809a02004080c1014181c211e0201d6968c0c0c0c0c080" },
+    { 'D', "ServiceDiscoveryRes", "809a02004080c1014181c211a00120024100c4" },
+    { 'D', "ServicePaymentSelectionRes", "809a02004080c1014181c211c000" },
+    { 'D', "ChargeParameterDiscoveryRes", "809a02004080c1014181c2108000000000000010642a800400000c0c320040c0e014060a184060606002060a1900203030050303005100" },
+    { 'D', "CableCheckRes", "809a02004080c1014181c21020000200000400" },
+    { 'D', "PreChargeRes", "809a02004080c1014181c211600040800001966dbc00" },
+    { 'D', "PowerDeliveryRes", "809a02004080c1014181c211400420400000" },
+    { 'D', "CurrentDemandRes", "809a02004080c1014181c210e00042000001828cdb7818187e010400c0" },
+    { 'D', "WeldingDetectionRes", "809a02004080c1014181c212200200000030519b6f00" },
+    { 'D', "SessionStopRes", "809a02004080c1014181c2120000" },
+    { 'D', "ContractAuthenticationRes", "809a02004080c1014181c210c00000" },
+    { 'D', "ServiceDetailReq", "809a02004080c1014181c211700800" },
+    { 'D', "ServiceDetailRes", "809a02004080c1014181c21180000800080a50726f746f636f6c36008a00" },
+    { 'D', "PaymentDetailsReq", "809a02004080c1014181c21110411114e10504c4c8ccd0d4d8dce0e4040c2080428c206c6800c080408080404c08" },
+    { 'D', "PaymentDetailsRes", "809a02004080c1014181c2112080491da0c9b1c51de8ddc1ccdd0d5130cd1c2038b3ea8180" },
+    { 'D', "ChargingStatusReq", "809a02004080c1014181c21090" },
+    { 'D', "ChargingStatusRes", "809a02004080c1014181c210a0800400005010000000" },
+    { 'D', "MeteringReceiptReq", "809a02004080c1014181c210f410020406080a0c0e100010074d30303031018485cb00880e2cfaa06000" },
+    { 'D', "MeteringReceiptRes", "809a02004080c1014181c211000100000000" },
+    { '1', "SessionSetupReq", "809802000000000000000011d0042800" },
+    { '1', "SessionSetupRes", "809802004080c1014181c211e00010005012b35de740" },
+    { '1', "ServiceDetailReq", "809802004080c1014181c211905800" },
+    { '1', "ServiceDetailRes", "809802004080c1014181c211a003482400080a50726f746f636f6c647bb00193985b59681558c91c40040250da185b9b995b21000020a0" },
+    { '1', "AuthorizationReq", "809802004080c1014181c21000152590c80000" },
+    { '1', "AuthorizationRes", "809802004080c1014181c210100000" },
+    { '1', "CableCheckReq", "809802004080c1014181c21030001900" },
+    { '1', "CableCheckRes", "809802004080c1014181c2104001a41222f000" },
+    { '1', "PreChargeReq", "809802004080c1014181c21170040102040c808387500800" },
+    { '1', "PreChargeRes", "809802004080c1014181c2118001a412124061c3200c00" },
+    { '1', "PowerDeliveryReq", "809802004080c1014181c21150002600" },
+    { '1', "PowerDeliveryRes", "809802004080c1014181c21160080c0800" },
+    { '1', "ChargingStatusReq", "809802004080c1014181c210b0" },
+    { '1', "ChargingStatusRes", "809802004080c1014181c210c0000d047f9200000000" },
+    { '1', "SessionStopReq", "809802004080c1014181c211f200" },
+    { '1', "SessionStopRes", "809802004080c1014181c2120000" },
+    { '1', "ServiceDiscoveryReq", "809802004080c1014181c211b8" },
+    { '1', "ServiceDiscoveryRes", "809802004080c1014181c211c0012000820324" },
+    { '1', "PaymentServiceSelectionReq", "809802004080c1014181c21132001280" },
+    { '1', "PaymentServiceSelectionRes", "809802004080c1014181c2114000" },
+    { '1', "ChargeParameterDiscoveryReq", "809802004080c1014181c21094ca4003c06186400818503203102400c261805019028000" },
+    { '1', "ChargeParameterDiscoveryRes", "809802004080c1014181c210a00001fe00008c2819055000000040c30c80106140280c40c203030c0040c40c801018600a06180288" },
+    { '1', "CurrentDemandReq", "809802004080c1014181c210d1001b81860f001881200601861900206140c8000308220380610580481881f80400" },
+    { '1', "CurrentDemandRes", "809802004080c1014181c210e00000002100c419b6f030c3f0082006021fe8" },
+    { '1', "WeldingDetectionReq", "809802004080c1014181c21211002800" },
+    { '1', "WeldingDetectionRes", "809802004080c1014181c212200000020031066dbc00" },
+    { '1', "PaymentDetailsReq", "809802004080c1014181c21110411114e10504c4c8ccd0d4d8dce0e442061040214610363400604020404020260400" },
+    { '1', "PaymentDetailsRes", "809802004080c1014181c211208040004488cd115599de2266aaef3377bbfc2038b3ea8180" },
+    { '1', "MeteringReceiptReq", "809802004080c1014181c210f410020406080a0c0e1000000e9a606060620b96022038b3ea8180" },
+    { '1', "MeteringReceiptRes", "809802004080c1014181c2110080000000" },
+    { '2', "SessionSetupReq", "80d00200000000000000000af0042800" },
+    { '2', "SessionSetupRes", "80d002004080c1014181c20b00040800280959aef3a0" },
+    { '2', "ServiceDiscoveryReq", "80d002004080c1014181c20ad00120" },
+    { '2', "ServiceDiscoveryRes", "80d002004080c1014181c20ae00480001114" },
+    { '2', "ServiceDetailReq", "80d002004080c1014181c20ab05800" },
+    { '2', "ServiceDetailRes", "80d002004080c1014181c20ac005a41200080a50726f746f636f6c647bb00193985b59681558c91c400804a1b430b73732b642001050" },
+    { '2', "PaymentServiceSelectionReq", "80d002004080c1014181c20a3200201040" },
+    { '2', "PaymentServiceSelectionRes", "80d002004080c1014181c20a4004" },
+    { '2', "PaymentDetailsReq", "80d002004080c1014181c20a101005ec011900002436500129ba801a9ba99100" },
+    { '2', "PaymentDetailsRes", "80d002004080c1014181c20a20040202181880e0" },
+    { '2', "AuthorizationReq", "80d002004080c1014181c20840152590c8008080" },
+    { '2', "AuthorizationRes", "80d002004080c1014181c208500400" },
+    { '2', "ChargeParameterDiscoveryReq", "80d002004080c1014181c208d03180b960060c8061200606190023184801818640081848018186400840" },
+    { '2', "ChargeParameterDiscoveryRes", "80d002004080c1014181c208e064a800" },
+    { '2', "CableCheckReq", "80d002004080c1014181c20870" },
+    { '2', "CableCheckRes", "80d002004080c1014181c208800400" },
+    { '2', "PreChargeReq", "80d002004080c1014181c20a910190103a8040" },
+    { '2', "PreChargeRes", "80d002004080c1014181c20aa004c1900600" },
+    { '2', "PowerDeliveryReq", "80d002004080c1014181c20a50127900" },
+    { '2', "PowerDeliveryRes", "80d002004080c1014181c20a60000c0080" },
+    { '2', "ChargingStatusReq", "80d002004080c1014181c208f14190c0" },
+    { '2', "ChargingStatusRes", "80d002004080c1014181c209000406824900" },
+    { '2', "CurrentDemandReq", "80d002004080c1014181c2093180500602803002809b81912183c0187e010061900206032018480180" },
+    { '2', "CurrentDemandRes", "80d002004080c1014181c209400460ec061f6040000303200c32004061e806022888a54a09c86548a626466686a546200040" },
+    { '2', "WeldingDetectionReq", "80d002004080c1014181c20bb0" },
+    { '2', "WeldingDetectionRes", "80d002004080c1014181c20bc004600400" },
+    { '2', "MeteringReceiptReq", "80d002004080c1014181c209d02a4b2198022c4054d6964500" },
+    { '2', "MeteringReceiptRes", "80d002004080c1014181c209e164" },
+    { '2', "SessionStopReq", "80d002004080c1014181c20b1200" },
+    { '2', "SessionStopRes", "80d002004080c1014181c20b2004" },
+};
+
+static struct appHandEXIDocument aphsDoc;
+static struct dinEXIDocument dinDoc;
+static struct iso1EXIDocument iso1Doc;
+static struct iso2EXIDocument iso2Doc;
+
+static uint8_t payloadBuffer[BENCHMARK_BUFFER_SIZE];
+static size_t payloadLen;
+static uint8_t otherBuffer[BENCHMARK_BUFFER_SIZE];
+static uint8_t outBuffer[BENCHMARK_BUFFER_SIZE];
+static bitstream_t stream;
+static size_t streamPos;
+#if DATABINDING == DATABINDING_SLIM
+/* the large values of the decoded documents, each decode starts the arena over */
+static uint8_t arenaBuffer[BENCHMARK_ARENA_SIZE];
+static exi_arena_t arena;
+#endif
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+/* the string values of the message, the header functions empty it */
+static exi_value_table_t valueTable;
+#endif
+
+static unsigned long allocations;
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t nmemb, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    allocations++;
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t nmemb, size_t size) {
+    allocations++;
+    return __real_calloc(nmemb, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    allocations++;
+    return __real_realloc(ptr, size);
+}
+
+/* The DIN decoder reports some decoded values to the command line interface. Not part of the measurement. */
+void debugAddStringAndInt(char *s, int i) {
+    (void)s;
+    (void)i;
+}
+
+typedef int (*benchmarkOperation)(char schema);
+
+static void initStream(uint8_t* data, size_t size) {
+    init_bitstream(&stream, data, size, &streamPos);
+    streamPos = 0;
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+    stream.valueTable = &valueTable;
+#endif
+}
+
+static void useArena(void) {
+#if DATABINDING == DATABINDING_SLIM
+    exiArenaInit(&arena, arenaBuffer, BENCHMARK_ARENA_SIZE);
+    stream.arena = &arena;
+#endif
+}
+
+/* decode the canned message */
+static int decodePayload(char schema) {
+    initStream(payloadBuffer, payloadLen);
+    useArena();
+    switch (schema) {
+        case 'H': return decode_appHandExiDocument(&stream, &aphsDoc);
+        case 'D': return decode_dinExiDocument(&stream, &dinDoc);
+        case '1': return decode_iso1ExiDocument(&stream, &iso1Doc);
+        default: return decode_iso2ExiDocument(&stream, &iso2Doc);
+    }
+}
+
+/* encode the document of the last decodePayload() */
+static int encodeDocument(char schema) {
+    initStream(outBuffer, BENCHMARK_BUFFER_SIZE);
+    switch (schema) {
+        case 'H': return encode_appHandExiDocument(&stream, &aphsDoc);
+        case 'D': return encode_dinExiDocument(&stream, &dinDoc);
+        case '1': return encode_iso1ExiDocument(&stream, &iso1Doc);
+        default: return encode_iso2ExiDocument(&stream, &iso2Doc);
+    }
+}
+
+/* Same job as the converter of the command line interface, which is static there and comes with the JSON output
+   and globals of the interface. The benchmark does not link the test programs and converts each payload once,
+   outside the measurement, so the short sscanf version is enough. */
+static int hexToBytes(const char* hex, uint8_t* bytes, size_t* length) {
+    size_t i;
+    unsigned int v;
+    *length = strlen(hex) / 2;
+    if (*length > BENCHMARK_BUFFER_SIZE) {
+        return -1;
+    }
+    for (i = 0; i < *length; i++) {
+        if (sscanf(&hex[2 * i], "%2x", &v) != 1) {
+            return -1;
+        }
+        bytes[i] = (uint8_t)v;
+    }
+    return 0;
+}
+
+static int hexToPayload(const char* hex) {
+    return hexToBytes(hex, payloadBuffer, &payloadLen);
+}
+
+static const char* schemaName(char schema) {
+    switch (schema) {
+        case 'H': return "appHand";
+        case 'D': return "DIN";
+        case '1': return "ISO1";
+        default: return "ISO2";
+    }
+}
+
+/* decode length bytes into the given DIN, ISO1 or ISO2 document */
+static int decodeBytes(char schema, uint8_t* bytes, size_t length, void* doc) {
+    initStream(bytes, length);
+    useArena();
+    switch (schema) {
+        case 'D': return decode_dinExiDocument(&stream, doc);
+        case '1': return decode_iso1ExiDocument(&stream, doc);
+        default: return decode_iso2ExiDocument(&stream, doc);
+    }
+}
+
+/* encode a document with SessionStopReq as root element instead of V2G_Message into otherBuffer */
+static int encodeOtherRoot(char schema, size_t* length) {
+    int errn;
+    initStream(otherBuffer, BENCHMARK_BUFFER_SIZE);
+    switch (schema) {
+        case 'D':
+            init_dinEXIDocument(&dinDoc);
+            dinDoc.SessionStopReq_isUsed = 1u;
+            errn = encode_dinExiDocument(&stream, &dinDoc);
+            break;
+        case '1':
+            init_iso1EXIDocument(&iso1Doc);
+            iso1Doc.SessionStopReq_isUsed = 1u;
+            iso1Doc.SessionStopReq.ChargingSession = iso1chargingSessionType_Terminate;
+            errn = encode_iso1ExiDocument(&stream, &iso1Doc);
+            break;
+        default:
+            init_iso2EXIDocument(&iso2Doc);
+            iso2Doc.SessionStopReq_isUsed = 1u;
+            iso2Doc.SessionStopReq.ChargingSession = iso2chargingSessionType_Terminate;
+            errn = encode_iso2ExiDocument(&stream, &iso2Doc);
+            break;
+    }
+    *length = streamPos;
+    return errn;
+}
+
+/* Decodes each other canned message of the schema into the document, and a message with another root element, each
+   followed by this one. The encoder has to give the canned message again, so that no _isUsed flag of the previous
+   message is left. Returns 1 for a difference. */
+static int checkDocumentReuse(const struct benchmarkPayload* p) {
+    void* doc = (p->schema == 'D') ? (void*)&dinDoc : (p->schema == '1') ? (void*)&iso1Doc : (void*)&iso2Doc;
+    size_t n = sizeof(payloads) / sizeof(payloads[0]);
+    size_t i, length;
+    const char* previous;
+    int errn;
+
+    for (i = 0; i <= n; i++) {
+        if (i == n) {
+            previous = "SessionStopReq root element";
+            if (encodeOtherRoot(p->schema, &length) != 0) {
+                continue;
+            }
+        } else if (payloads[i].schema != p->schema || &payloads[i] == p || hexToBytes(payloads[i].hex, otherBuffer, &length) != 0) {
+            continue;
+        } else {
+            previous = payloads[i].name;
+        }
+        decodeBytes(p->schema, otherBuffer, length, doc);
+        errn = decodePayload(p->schema);
+        if (errn == 0) {
+            errn = encodeDocument(p->schema);
+        }
+        if (errn != 0 || streamPos != payloadLen || memcmp(outBuffer, payloadBuffer, payloadLen) != 0) {
+            printf("%-8s%-32sdecoded after %s, the encoded message differs (error %d)\n", schemaName(p->schema), p->name,
+                previous, errn);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
+static uint32_t randomState = 1;
+
+/* pseudo random number 0..n-1, the same series on every run */
+static uint32_t nextRandom(uint32_t n) {
+    randomState = randomState * 1664525u + 1013904223u;
+    return (randomState >> 8) % n;
+}
+
+/* mostly a value of the same width, sometimes any value or another unit */
+static void randomPhysicalValue(struct dinPhysicalValueType* pv) {
+    pv->Multiplier = (int8_t)((int)nextRandom(7) - 3);
+    if (nextRandom(16) == 0) {
+        pv->Unit_isUsed = !pv->Unit_isUsed;
+    }
+    pv->Unit = (dinunitSymbolType)nextRandom(10);
+    if (nextRandom(8) == 0) {
+        pv->Value = (int16_t)((int)nextRandom(65536) - 32768);
+    } else {
+        pv->Value = (int16_t)nextRandom(64);
+    }
+}
+
+/* Encodes the canned DIN CurrentDemandRes with changing values by encode_dinCurrentDemandResTemplate and by
+   encode_dinExiDocument. Some messages change a width, an optional element or the SessionID, some have a too short
+   output buffer. Returns 1 for a difference. */
+static int checkCurrentDemandResTemplate(const struct benchmarkPayload* p) {
+    struct dinCurrentDemandResTemplate tmpl;
+    struct dinCurrentDemandResType* res = &dinDoc.V2G_Message.Body.CurrentDemandRes;
+    size_t size, length;
+    int i, errn, templateErrn;
+
+    if (decodePayload('D') != 0 || dinDoc.V2G_Message.Body.CurrentDemandRes_isUsed == 0u) {
+        printf("%-8s%-32sno CurrentDemandRes for the template check\n", schemaName(p->schema), p->name);
+        return 1;
+    }
+    init_dinCurrentDemandResTemplate(&tmpl);
+    for (i = 0; i < BENCHMARK_TEMPLATE_MESSAGES; i++) {
+        res->ResponseCode = (dinresponseCodeType)nextRandom(23);
+        if (nextRandom(16) == 0) {
+            res->DC_EVSEStatus.EVSEIsolationStatus_isUsed = !res->DC_EVSEStatus.EVSEIsolationStatus_isUsed;
+        }
+        res->DC_EVSEStatus.EVSEIsolationStatus = (dinisolationLevelType)nextRandom(4);
+        res->DC_EVSEStatus.EVSEStatusCode = (dinDC_EVSEStatusCodeType)nextRandom(12);
+        res->DC_EVSEStatus.NotificationMaxDelay = (nextRandom(8) == 0) ? nextRandom(0x1000000) : nextRandom(128);
+        res->DC_EVSEStatus.EVSENotification = (dinEVSENotificationType)nextRandom(3);
+        randomPhysicalValue(&res->EVSEPresentVoltage);
+        randomPhysicalValue(&res->EVSEPresentCurrent);
+        res->EVSECurrentLimitAchieved = (int)nextRandom(2);
+        res->EVSEVoltageLimitAchieved = (int)nextRandom(2);
+        res->EVSEPowerLimitAchieved = (int)nextRandom(2);
+        if (nextRandom(16) == 0) {
+            res->EVSEMaximumVoltageLimit_isUsed = !res->EVSEMaximumVoltageLimit_isUsed;
+        }
+        if (nextRandom(16) == 0) {
+            res->EVSEMaximumCurrentLimit_isUsed = !res->EVSEMaximumCurrentLimit_isUsed;
+        }
+        if (nextRandom(16) == 0) {
+            res->EVSEMaximumPowerLimit_isUsed = !res->EVSEMaximumPowerLimit_isUsed;
+        }
+        randomPhysicalValue(&res->EVSEMaximumVoltageLimit);
+        randomPhysicalValue(&res->EVSEMaximumCurrentLimit);
+        randomPhysicalValue(&res->EVSEMaximumPowerLimit);
+        if (nextRandom(32) == 0) {
+            dinDoc.V2G_Message.Header.SessionID.bytesLen = (uint16_t)(1 + nextRandom(dinMessageHeaderType_SessionID_BYTES_SIZE));
+            dinDoc.V2G_Message.Header.SessionID.bytes[nextRandom(dinDoc.V2G_Message.Header.SessionID.bytesLen)] = (uint8_t)nextRandom(256);
+        }
+        size = (nextRandom(16) == 0) ? nextRandom(24) : BENCHMARK_BUFFER_SIZE;
+
+        initStream(otherBuffer, size);
+        templateErrn = encode_dinCurrentDemandResTemplate(&stream, &tmpl, &dinDoc.V2G_Message.Header, res);
+        length = streamPos;
+        initStream(outBuffer, size);
+        errn = encode_dinExiDocument(&stream, &dinDoc);
+        if (templateErrn != errn || (errn == 0 && (length != streamPos || memcmp(otherBuffer, outBuffer, length) != 0))) {
+            printf("%-8s%-32stemplate message %d differs from encode_dinExiDocument (error %d, %d)\n",
+                schemaName(p->schema), p->name, i, templateErrn, errn);
+            return 1;
+        }
+    }
+    return 0;
+}
+#endif /* DIN_DEPLOY_CurrentDemandRes */
+
+/* runs the operation for at least the given time, returns 0 and prints one result line on success */
+static int measure(const struct benchmarkPayload* p, const char* opName, benchmarkOperation op, long milliseconds) {
+    clock_t start, now;
+    clock_t duration = (clock_t)((double)milliseconds * CLOCKS_PER_SEC / 1000);
+    unsigned long ops = 0;
+    unsigned long allocationsAtStart;
+    size_t bytes;
+    int errn;
+    int i;
+
+    /* warm up, and the result must be valid */
+    errn = op(p->schema);
+    if (errn != 0) {
+        printf("%-8s%-32s%-12serror %d\n", schemaName(p->schema), p->name, opName, errn);
+        return errn;
+    }
+    bytes = streamPos;
+    allocationsAtStart = allocations;
+    start = clock();
+    do {
+        for (i = 0; i < BENCHMARK_BATCH; i++) {
+            op(p->schema);
+        }
+        ops += BENCHMARK_BATCH;
+        now = clock();
+    } while (now - start < duration);
+    printf("%-8s%-32s%-12s%10.1f%10lu%12.2f\n", schemaName(p->schema), p->name, opName,
+        (double)(now - start) * 1e9 / CLOCKS_PER_SEC / ops, (unsigned long)bytes,
+        (double)(allocations - allocationsAtStart) / ops);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    const char* filter = "*";
+    long milliseconds = BENCHMARK_DEFAULT_MILLISECONDS;
+    size_t i;
+    int failures = 0;
+    char schemaFilter[2] = { 0, 0 };
+
+    if (argc > 1) {
+        filter = argv[1];
+    }
+    if (argc > 2) {
+        milliseconds = atol(argv[2]);
+        if (milliseconds <= 0) {
+            milliseconds = BENCHMARK_DEFAULT_MILLISECONDS;
+        }
+    }
+
+    printf("%-8s%-32s%-12s%10s%10s%12s\n", "schema", "message", "operation", "ns/op", "bytes/op", "allocs/op");
+    for (i = 0; i < sizeof(payloads) / sizeof(payloads[0]); i++) {
+        const struct benchmarkPayload* p = &payloads[i];
+        schemaFilter[0] = p->schema;
+        if (strcmp(filter, "*") != 0 && strcmp(filter, schemaFilter) != 0 && strstr(p->name, filter) == NULL) {
+            continue;
+        }
+        if (hexToPayload(p->hex) != 0) {
+            printf("%-8s%-32sinvalid canned message\n", schemaName(p->schema), p->name);
+            failures++;
+            continue;
+        }
+        if (measure(p, "decode", decodePayload, milliseconds) != 0) {
+            failures++;
+            continue;
+        }
+        if (measure(p, "encode", encodeDocument, milliseconds) != 0) {
+            failures++;
+        } else if (streamPos != payloadLen || memcmp(outBuffer, payloadBuffer, payloadLen) != 0) {
+            printf("%-8s%-32sencoded message differs from the canned message\n", schemaName(p->schema), p->name);
+            failures++;
+        }
+        if (p->schema != 'H') {
+            failures += checkDocumentReuse(p);
+        }
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
+        if (p->schema == 'D' && strcmp(p->name, "CurrentDemandRes") == 0) {
+            failures += checkCurrentDemandResTemplate(p);
+        }
+#endif /* DIN_DEPLOY_CurrentDemandRes */
+    }
+    return failures != 0;
+}
@@ -29,6 +29,8 @@
 
 
 
+#include <string.h>
+
 #include "BitInputStream.h"
 #include "EXIConfig.h"
 #include "EXITypes.h"
@@ -37,6 +39,31 @@
 #ifndef BIT_INPUT_STREAM_C
 #define BIT_INPUT_STREAM_C
 
+#if EXI_STREAM == FILE_STREAM
+/* internal method to read the next byte of the file, a block at a time with a staging buffer */
+static int readFileByte(bitstream_t* stream, uint8_t* b)
+{
+	int character;
+	if (stream->fileBuffer == NULL) {
+		character = getc(stream->file);
+		if (character == EOF) {
+			return EXI_ERROR_INPUT_STREAM_EOF;
+		}
+		*b = (uint8_t)character;
+		return 0;
+	}
+	if (stream->fileBufferPos >= stream->fileBufferLength) {
+		stream->fileBufferLength = fread(stream->fileBuffer, 1, stream->fileBufferSize, stream->file);
+		stream->fileBufferPos = 0;
+		if (stream->fileBufferLength == 0) {
+			return EXI_ERROR_INPUT_STREAM_EOF;
+		}
+	}
+	*b = stream->fileBuffer[stream->fileBufferPos++];
+	return 0;
+}
+#endif /* EXI_STREAM == FILE_STREAM */
+
 /* internal method to (re)fill buffer */
 static int readBuffer(bitstream_t* stream)
 {
@@ -52,11 +79,8 @@ static int readBuffer(bitstream_t* stream)
 		}
 #endif
 #if EXI_STREAM == FILE_STREAM
-		stream->buffer = (uint8_t)(getc(stream->file));
-		/* EOF cannot be used, 0xFF valid value */
-		if ( feof(stream->file) || ferror(stream->file) ) {
-			errn = EXI_ERROR_INPUT_STREAM_EOF;
-		} else {
+		errn = readFileByte(stream, &stream->buffer);
+		if (errn == 0) {
 			stream->capacity = BITS_IN_BYTE;
 		}
 #endif
@@ -64,9 +88,64 @@ static int readBuffer(bitstream_t* stream)
 	return errn;
 }
 
+#if EXI_STREAM == BYTE_ARRAY
+/* internal method to load the next 8 bytes as big-endian cache word,
+ * with one unaligned load where the byte order is known */
+static uint64_t loadCacheWord(const uint8_t* p)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	uint64_t word;
+	memcpy(&word, p, sizeof(word));
+	return __builtin_bswap64(word);
+#elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	uint64_t word;
+	memcpy(&word, p, sizeof(word));
+	return word;
+#else
+	return ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48) |
+			((uint64_t)p[2] << 40) | ((uint64_t)p[3] << 32) |
+			((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16) |
+			((uint64_t)p[6] << 8) | (uint64_t)p[7];
+#endif
+}
+#endif /* EXI_STREAM == BYTE_ARRAY */
+
+#if EXI_STREAM == BYTE_ARRAY && BIT_READER == BIT_READER_WORD
+/* internal method to read up to 32 bits which go beyond the current byte
+ * buffer out of a 64 bit cache word, requires at least 8 more bytes in the array */
+static void readBitsWord(bitstream_t* stream, size_t num_bits, uint32_t* b)
+{
+	/* remaining bits of the byte buffer followed by k bits of the cache word */
+	size_t k = num_bits - stream->capacity;
+	uint64_t word = loadCacheWord(&stream->data[(*stream->pos)]);
+
+	*b = (uint32_t)(((uint64_t)(stream->buffer & (0xff >> (BITS_IN_BYTE - stream->capacity))) << k) |
+			(word >> (64 - k)));
+
+	/* skip whole bytes and keep the partially read byte in the buffer */
+	(*stream->pos) += (k / BITS_IN_BYTE);
+	k = k % BITS_IN_BYTE;
+	if(k > 0) {
+		stream->buffer = stream->data[(*stream->pos)++];
+		stream->capacity = (uint8_t)(BITS_IN_BYTE - k);
+	} else {
+		stream->capacity = 0;
+	}
+}
+#endif /* BIT_READER_WORD */
+
 int readBits(bitstream_t* stream, size_t num_bits, uint32_t* b)
 {
-	int errn = readBuffer(stream);
+	int errn;
+#if EXI_STREAM == BYTE_ARRAY && BIT_READER == BIT_READER_WORD
+	/* bits within the byte buffer are cheaper to read byte-wise */
+	if(num_bits > stream->capacity && num_bits <= 32 && ((*stream->pos) + 8) <= stream->size) {
+		readBitsWord(stream, num_bits, b);
+		return 0;
+	}
+#endif /* BIT_READER_WORD */
+
+	errn = readBuffer(stream);
 	if (errn == 0) {
 		/* read the bits in one step */
 		if(num_bits <= stream->capacity) {
@@ -102,4 +181,30 @@ int readBits(bitstream_t* stream, size_t num_bits, uint32_t* b)
 	return errn;
 }
 
+#if EXI_STREAM == BYTE_ARRAY
+int peekOctets(bitstream_t* stream, uint64_t* octets)
+{
+	if(((*stream->pos) + 8) > stream->size) {
+		return EXI_ERROR_INPUT_STREAM_EOF;
+	}
+	if(stream->capacity == 0) {
+		*octets = loadCacheWord(&stream->data[(*stream->pos)]);
+	} else {
+		/* remaining bits of the current byte buffer followed by the next 64 - capacity bits */
+		*octets = ((uint64_t)(stream->buffer & (0xff >> (BITS_IN_BYTE - stream->capacity))) << (64 - stream->capacity)) |
+				(loadCacheWord(&stream->data[(*stream->pos)]) >> stream->capacity);
+	}
+	return 0;
+}
+
+void skipOctets(bitstream_t* stream, size_t num_octets)
+{
+	/* the bit offset within the byte stays the same */
+	(*stream->pos) += num_octets;
+	if(num_octets > 0 && stream->capacity > 0) {
+		stream->buffer = stream->data[(*stream->pos) - 1];
+	}
+}
+#endif /* EXI_STREAM == BYTE_ARRAY */
+
 #endif
@@ -60,6 +60,34 @@ extern "C" {
 int readBits(bitstream_t* stream, size_t num_bits, uint32_t* b);
 
 
+#if EXI_STREAM == BYTE_ARRAY
+/**
+ * \brief 		Peek octets
+ *
+ * 				Returns the next 8 octets at the current bit position without
+ * 				reading them, the first octet in the most significant byte.
+ *
+ * \param       stream   		Input Stream
+ * \param       octets   		64 bit word (out)
+ * \return                  	Error-Code <> 0, EOF if less than 8 more bytes are in the array
+ *
+ */
+int peekOctets(bitstream_t* stream, uint64_t* octets);
+
+
+/**
+ * \brief 		Skip octets
+ *
+ * 				Skips num_octets octets returned by the preceding peekOctets.
+ *
+ * \param       stream   		Input Stream
+ * \param       num_octets		Number of octets (at most 8)
+ *
+ */
+void skipOctets(bitstream_t* stream, size_t num_octets);
+#endif /* EXI_STREAM == BYTE_ARRAY */
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,10 +33,174 @@
 #include "EXIConfig.h"
 #include "EXITypes.h"
 #include "ErrorCodes.h"
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+#include "Sha256.h"
+#endif /* ENCODER_DIGEST_SHA256 */
 
 #ifndef BIT_OUTPUT_STREAM_C
 #define BIT_OUTPUT_STREAM_C
 
+#if EXI_STREAM == BYTE_ARRAY && BIT_WRITER == BIT_WRITER_WORD
+
+/* internal method to write the full staging word (big-endian) */
+static int writeWord(bitstream_t* stream) {
+	uint8_t* p;
+	size_t i;
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+	uint8_t digestOnly[8];
+
+	if (stream->data == NULL) {
+		/* no data-array, the bytes are only hashed and counted */
+		p = digestOnly;
+	} else
+#endif /* ENCODER_DIGEST_SHA256 */
+	/* one capacity check per word */
+	if (((*stream->pos) + 8) > stream->size) {
+		/* write what fits, as the bytewise writer does, so that the stream stays full and every
+		 * later write fails as well (the generated code may overwrite a single error) */
+		for (i = 0; (*stream->pos) < stream->size; i++) {
+			stream->data[(*stream->pos)++] = (uint8_t)(stream->word >> (56 - i * BITS_IN_BYTE));
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+			if (stream->digest != NULL) {
+				exiSha256Update(stream->digest, &stream->data[(*stream->pos) - 1], 1);
+			}
+#endif /* ENCODER_DIGEST_SHA256 */
+		}
+		return EXI_ERROR_OUTPUT_STREAM_EOF;
+	} else {
+		p = &stream->data[(*stream->pos)];
+	}
+	p[0] = (uint8_t)(stream->word >> 56);
+	p[1] = (uint8_t)(stream->word >> 48);
+	p[2] = (uint8_t)(stream->word >> 40);
+	p[3] = (uint8_t)(stream->word >> 32);
+	p[4] = (uint8_t)(stream->word >> 24);
+	p[5] = (uint8_t)(stream->word >> 16);
+	p[6] = (uint8_t)(stream->word >> 8);
+	p[7] = (uint8_t)(stream->word);
+	(*stream->pos) += 8;
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+	if (stream->digest != NULL) {
+		exiSha256Update(stream->digest, p, 8);
+	}
+#endif /* ENCODER_DIGEST_SHA256 */
+	return 0;
+}
+
+int writeBits(bitstream_t* stream, size_t nbits, uint32_t val) {
+	int errn = 0;
+	size_t rest;
+	uint64_t v = (uint64_t)val & (((uint64_t)1 << nbits) - 1);
+
+	if (nbits < stream->capacity) {
+		/* all bits fit into the staging word */
+		stream->word = (stream->word << nbits) | v;
+		stream->capacity = (uint8_t)(stream->capacity - nbits);
+	} else {
+		/* fill up the staging word and write it */
+		rest = nbits - stream->capacity;
+		stream->word = (stream->word << stream->capacity) | (v >> rest);
+		errn = writeWord(stream);
+		/* spared bits are kept in the word
+		 * Note: the high bits will be shifted out during further filling */
+		stream->word = v;
+		stream->capacity = (uint8_t)(64 - rest);
+	}
+
+	return errn;
+}
+
+/**
+ * Flush output, writes the staged bits padded to full bytes
+ */
+int flush(bitstream_t* stream) {
+	int errn = 0;
+	size_t nbytes = (size_t)(64 - stream->capacity + 7) / BITS_IN_BYTE;
+	size_t i;
+	uint64_t w;
+	uint8_t bytes[8];
+
+	if (nbytes == 0) {
+		/* nothing to do, no bits staged */
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+	} else if (stream->data != NULL && ((*stream->pos) + nbytes) > stream->size) {
+#else
+	} else if (((*stream->pos) + nbytes) > stream->size) {
+#endif /* ENCODER_DIGEST_SHA256 */
+		errn = EXI_ERROR_OUTPUT_STREAM_EOF;
+	} else {
+		/* left-align the staged bits, pad with zeros */
+		w = stream->word << stream->capacity;
+		for (i = 0; i < nbytes; i++) {
+			bytes[i] = (uint8_t)(w >> (56 - i * BITS_IN_BYTE));
+		}
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+		if (stream->digest != NULL) {
+			exiSha256Update(stream->digest, bytes, nbytes);
+		}
+		if (stream->data == NULL) {
+			(*stream->pos) += nbytes;
+		} else
+#endif /* ENCODER_DIGEST_SHA256 */
+		for (i = 0; i < nbytes; i++) {
+			stream->data[(*stream->pos)++] = bytes[i];
+		}
+		stream->word = 0;
+		stream->capacity = 64;
+	}
+	return errn;
+}
+
+#else
+
+#if EXI_STREAM == BYTE_ARRAY
+/* internal method to write one byte to the data-array */
+static int writeByte(bitstream_t* stream, uint8_t b) {
+	int errn = 0;
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+	if (stream->data == NULL) {
+		/* no data-array, the bytes are only hashed and counted */
+		(*stream->pos)++;
+	} else
+#endif /* ENCODER_DIGEST_SHA256 */
+	if ((*stream->pos) >= stream->size) {
+		errn = EXI_ERROR_OUTPUT_STREAM_EOF;
+	} else {
+		stream->data[(*stream->pos)++] = b;
+	}
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+	if (errn == 0 && stream->digest != NULL) {
+		exiSha256Update(stream->digest, &b, 1);
+	}
+#endif /* ENCODER_DIGEST_SHA256 */
+	return errn;
+}
+#endif /* EXI_STREAM == BYTE_ARRAY */
+
+#if EXI_STREAM == FILE_STREAM
+/* internal method to write the staged bytes of the file */
+static int writeFileBuffer(bitstream_t* stream) {
+	size_t n = stream->fileBufferPos;
+	stream->fileBufferPos = 0;
+	if (n > 0 && fwrite(stream->fileBuffer, 1, n, stream->file) != n) {
+		return EXI_ERROR_OUTPUT_STREAM_EOF;
+	}
+	return 0;
+}
+
+/* internal method to write one byte to the file, a block at a time with a staging buffer */
+static int writeByte(bitstream_t* stream, uint8_t b) {
+	if (stream->fileBuffer == NULL) {
+		return (putc(b, stream->file) == EOF) ? EXI_ERROR_OUTPUT_STREAM_EOF : 0;
+	}
+	stream->fileBuffer[stream->fileBufferPos++] = b;
+	if (stream->fileBufferPos == stream->fileBufferSize) {
+		return writeFileBuffer(stream);
+	}
+	return 0;
+}
+#endif /* EXI_STREAM == FILE_STREAM */
+
 int writeBits(bitstream_t* stream, size_t nbits, uint32_t val) {
 	int errn = 0;
 	/*  is there enough space in the buffer */
@@ -46,18 +210,7 @@ int writeBits(bitstream_t* stream, size_t nbits, uint32_t val) {
 		stream->capacity = (uint8_t)(stream->capacity - nbits);
 		/* if the buffer is full write byte */
 		if (stream->capacity == 0) {
-#if EXI_STREAM == BYTE_ARRAY
-			if ((*stream->pos) >= stream->size) {
-				errn = EXI_ERROR_OUTPUT_STREAM_EOF;
-			} else {
-				stream->data[(*stream->pos)++] = stream->buffer;
-			}
-#endif
-#if EXI_STREAM == FILE_STREAM
-			if ( putc(stream->buffer, stream->file) == EOF ) {
-				errn = EXI_ERROR_OUTPUT_STREAM_EOF;
-			}
-#endif
+			errn = writeByte(stream, stream->buffer);
 			stream->capacity = BITS_IN_BYTE;
 			stream->buffer = 0;
 		}
@@ -68,35 +221,13 @@ int writeBits(bitstream_t* stream, size_t nbits, uint32_t val) {
 				( (uint8_t)(val >> (nbits - stream->capacity)) & (uint8_t)(0xff >> (BITS_IN_BYTE - stream->capacity)) );
 
 		nbits = (nbits - stream->capacity);
-#if EXI_STREAM == BYTE_ARRAY
-		if ((*stream->pos) >= stream->size) {
-			errn = EXI_ERROR_OUTPUT_STREAM_EOF;
-		} else {
-			stream->data[(*stream->pos)++] = stream->buffer;
-		}
-#endif
-#if EXI_STREAM == FILE_STREAM
-		if ( putc(stream->buffer, stream->file) == EOF ) {
-			errn = EXI_ERROR_OUTPUT_STREAM_EOF;
-		}
-#endif
+		errn = writeByte(stream, stream->buffer);
 		stream->buffer = 0;
 
 		/* write whole bytes */
 		while (errn == 0 && nbits >= BITS_IN_BYTE) {
 			nbits = (nbits - BITS_IN_BYTE);
-#if EXI_STREAM == BYTE_ARRAY
-			if ((*stream->pos) >= stream->size) {
-				errn = EXI_ERROR_OUTPUT_STREAM_EOF;
-			} else {
-				stream->data[(*stream->pos)++] = (uint8_t)(val >> (nbits));
-			}
-#endif
-#if EXI_STREAM == FILE_STREAM
-			if ( putc((int)(val >> (nbits)), stream->file) == EOF ) {
-				errn = EXI_ERROR_OUTPUT_STREAM_EOF;
-			}
-#endif
+			errn = writeByte(stream, (uint8_t)(val >> (nbits)));
 		}
 
 		/* spared bits are kept in the buffer */
@@ -108,7 +239,7 @@ int writeBits(bitstream_t* stream, size_t nbits, uint32_t val) {
 }
 
 /**
- * Flush output
+ * Flush output, a file stream also writes its staging buffer
  */
 int flush(bitstream_t* stream) {
 	int errn = 0;
@@ -117,8 +248,15 @@ int flush(bitstream_t* stream) {
 	} else {
 		errn = writeBits(stream, stream->capacity, 0);
 	}
+#if EXI_STREAM == FILE_STREAM
+	if (errn == 0 && stream->fileBuffer != NULL) {
+		errn = writeFileBuffer(stream);
+	}
+#endif /* EXI_STREAM == FILE_STREAM */
 	return errn;
 }
 
+#endif /* BIT_WRITER_WORD */
+
 #endif
 
@@ -68,7 +68,8 @@ int writeBits(bitstream_t* stream, size_t nbits, uint32_t bits);
  *
  * 				If there are some unwritten bits, pad them if necessary and
  * 				write them out. Note that this method does flush the
- * 				underlying stream.
+ * 				underlying stream: a FILE_STREAM with a staging buffer
+ * 				writes the staged bytes to the file.
  *
  * \param       stream   		Output Stream
  * \return                  	Error-Code <> 0
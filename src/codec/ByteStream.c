@@ -34,16 +34,30 @@
 #define _CRT_SECURE_NO_DEPRECATE
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "EXITypes.h"
 #include "ErrorCodes.h"
+#include "ByteStream.h"
+
+/* memory mapped files on POSIX systems, a plain read elsewhere */
+#if defined(__unix__) || defined(__APPLE__)
+#define BYTE_STREAM_MMAP
+#endif
+
+#if defined(BYTE_STREAM_MMAP)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 #ifndef BYTE_STREAM_C
 #define BYTE_STREAM_C
 
 int readBytesFromFile(const char * filename, uint8_t* data, size_t size, size_t* pos) {
 	FILE* f;
-	int character;
 	int errn = 0;
 
 	f = fopen(filename, "rb");
@@ -51,13 +65,14 @@ int readBytesFromFile(const char * filename, uint8_t* data, size_t size, size_t*
 	if (f == NULL) {
 		errn = EXI_ERROR_INPUT_FILE_HANDLE;
 	} else {
-		/* read bytes */
-		while (errn == 0 && (character = getc(f)) != EOF) {
-			if (*pos >= size) {
-				errn = EXI_ERROR_OUT_OF_BYTE_BUFFER;
-			} else {
-				data[(*pos)++] = (uint8_t) character;
-			}
+		/* read bytes, one block up to the end of the array */
+		if (*pos < size) {
+			(*pos) += fread(&data[*pos], 1, size - *pos, f);
+		}
+		if (ferror(f)) {
+			errn = EXI_ERROR_INPUT_FILE_HANDLE;
+		} else if (*pos >= size && getc(f) != EOF) {
+			errn = EXI_ERROR_OUT_OF_BYTE_BUFFER;
 		}
 		fclose(f);
 	}
@@ -65,6 +80,78 @@ int readBytesFromFile(const char * filename, uint8_t* data, size_t size, size_t*
 	return errn;
 }
 
+int mapBytesFromFile(const char * filename, uint8_t** data, size_t* size) {
+#if defined(BYTE_STREAM_MMAP)
+	struct stat st;
+	void* p;
+	int fd = open(filename, O_RDONLY);
+
+	*data = NULL;
+	*size = 0;
+	if (fd < 0) {
+		return EXI_ERROR_INPUT_FILE_HANDLE;
+	}
+	if (fstat(fd, &st) != 0) {
+		close(fd);
+		return EXI_ERROR_INPUT_FILE_HANDLE;
+	}
+	if (st.st_size > 0) {
+		p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (p == MAP_FAILED) {
+			close(fd);
+			return EXI_ERROR_INPUT_FILE_HANDLE;
+		}
+#if defined(MADV_SEQUENTIAL)
+		/* the decoder reads front to back, let the kernel read ahead */
+		madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+		*data = (uint8_t*)p;
+		*size = (size_t)st.st_size;
+	}
+	/* the mapping stays valid without the descriptor */
+	close(fd);
+	return 0;
+#else
+	/* no mmap, the file is read into memory in one block */
+	FILE* f = fopen(filename, "rb");
+	long n;
+	int errn = 0;
+
+	*data = NULL;
+	*size = 0;
+	if (f == NULL) {
+		return EXI_ERROR_INPUT_FILE_HANDLE;
+	}
+	if (fseek(f, 0, SEEK_END) != 0 || (n = ftell(f)) < 0 || fseek(f, 0, SEEK_SET) != 0) {
+		errn = EXI_ERROR_INPUT_FILE_HANDLE;
+	} else if (n > 0) {
+		*data = (uint8_t*)malloc((size_t)n);
+		if (*data == NULL) {
+			errn = EXI_ERROR_OUT_OF_BYTE_BUFFER;
+		} else if (fread(*data, 1, (size_t)n, f) != (size_t)n) {
+			free(*data);
+			*data = NULL;
+			errn = EXI_ERROR_INPUT_FILE_HANDLE;
+		} else {
+			*size = (size_t)n;
+		}
+	}
+	fclose(f);
+	return errn;
+#endif
+}
+
+void unmapBytesFromFile(uint8_t* data, size_t size) {
+	if (data != NULL) {
+#if defined(BYTE_STREAM_MMAP)
+		munmap(data, size);
+#else
+		(void)size;
+		free(data);
+#endif
+	}
+}
+
 int writeBytesToFile(uint8_t* data, size_t len, const char * filename) {
 	size_t rlen;
 	FILE* f = fopen(filename, "wb+");
@@ -84,5 +171,35 @@ int writeBytesToFile(uint8_t* data, size_t len, const char * filename) {
 }
 
 
+static void clearStream(bitstream_t* stream) {
+	memset(stream, 0, sizeof(*stream));
+#if EXI_OPTION_ALIGNMENT == ALIGNMENT_PER_STREAM
+	stream->alignment = BIT_PACKED;
+#endif
+}
+
+
+#if EXI_STREAM == BYTE_ARRAY
+void init_bitstream(bitstream_t* stream, uint8_t* data, size_t size, size_t* pos) {
+	clearStream(stream);
+	stream->data = data;
+	stream->size = size;
+	stream->pos = pos;
+}
+#endif /* EXI_STREAM == BYTE_ARRAY */
+
+
+#if EXI_STREAM == FILE_STREAM
+void initFileStream(bitstream_t* stream, FILE* file, uint8_t* buffer, size_t size) {
+	clearStream(stream);
+	stream->file = file;
+	stream->fileBuffer = (size > 0) ? buffer : NULL;
+	stream->fileBufferSize = size;
+	stream->fileBufferPos = 0;
+	stream->fileBufferLength = 0;
+}
+#endif /* EXI_STREAM == FILE_STREAM */
+
+
 #endif /* BYTE_STREAM_C */
 
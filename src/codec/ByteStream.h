@@ -68,6 +68,73 @@ int writeBytesToFile(uint8_t* data, size_t len, const char * filename);
  */
 int readBytesFromFile(const char * filename, uint8_t* data, size_t size, size_t* pos);
 
+
+/**
+ * \brief 		Map a file into memory, as input of a BYTE_ARRAY stream
+ *
+ * 				The pages are read on demand by the kernel (mmap), without
+ * 				copying the file. Without mmap (not a POSIX system) the file
+ * 				is read into allocated memory. An empty file gives data NULL and size 0.
+ *
+ * \param       filename   		File name
+ * \param       data			file bytes (out), release with unmapBytesFromFile
+ * \param       size		   	number of bytes (out)
+ * \return                  	Error-Code <> 0
+ *
+ */
+int mapBytesFromFile(const char * filename, uint8_t** data, size_t* size);
+
+
+/**
+ * \brief 		Release the bytes of mapBytesFromFile
+ *
+ * \param       data			file bytes
+ * \param       size		   	number of bytes
+ *
+ */
+void unmapBytesFromFile(uint8_t* data, size_t size);
+
+
+#if EXI_STREAM == BYTE_ARRAY
+/**
+ * \brief 		Set up a byte array stream
+ *
+ * 				Everything else of the stream is cleared, a bitstream_t
+ * 				variable may hold garbage before: no digest, arena or value
+ * 				table (set them afterwards), bit-packed alignment with
+ * 				ALIGNMENT_PER_STREAM. The position itself is left as it is.
+ *
+ * \param       stream   		Stream
+ * \param       data			byte array
+ * \param       size		   	byte array size
+ * \param       pos			   	byte array position
+ *
+ */
+void init_bitstream(bitstream_t* stream, uint8_t* data, size_t size, size_t* pos);
+#endif /* EXI_STREAM == BYTE_ARRAY */
+
+
+#if EXI_STREAM == FILE_STREAM
+/**
+ * \brief 		Set up a file stream with a staging buffer
+ *
+ * 				The bytes are read and written a block of size bytes at a
+ * 				time (EXI_FILE_BUFFER_SIZE is a good size) instead of a getc
+ * 				or putc per byte. An input stream reads ahead of the decoder.
+ * 				An output stream has to be flushed (encodeFinish does it)
+ * 				before the file is closed. A buffer of size 0 keeps the
+ * 				byte-wise getc and putc. Everything else of the stream is
+ * 				cleared as with init_bitstream.
+ *
+ * \param       stream   		Stream
+ * \param       file			opened file
+ * \param       buffer		   	staging buffer
+ * \param       size		   	staging buffer size
+ *
+ */
+void initFileStream(bitstream_t* stream, FILE* file, uint8_t* buffer, size_t size);
+#endif /* EXI_STREAM == FILE_STREAM */
+
 #ifdef __cplusplus
 }
 #endif
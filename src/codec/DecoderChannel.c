@@ -42,6 +42,10 @@
 #if MEMORY_ALLOCATION == DYNAMIC_ALLOCATION
 #include "DynamicMemory.h"
 #endif /* DYNAMIC_ALLOCATION */
+#if DATABINDING == DATABINDING_SLIM
+#include "MemoryArena.h"
+#endif /* DATABINDING_SLIM */
+#include "StringTable.h"
 
 #ifndef DECODER_CHANNEL_C
 #define DECODER_CHANNEL_C
@@ -51,8 +55,6 @@
 /* unsigned int == 32 bits, 5 * 7bits = 35 bits */
 #define MAX_OCTETS_FOR_UNSIGNED_INTEGER_32 5
 
-/* buffer for reading (arbitrary) large integer values */
-static uint8_t maskedOctets[MAX_OCTETS_FOR_UNSIGNED_INTEGER_64];
 
 
 static int _decodeUnsignedInteger(bitstream_t* stream, exi_integer_t* iv, int negative) {
@@ -60,6 +62,8 @@ static int _decodeUnsignedInteger(bitstream_t* stream, exi_integer_t* iv, int ne
 	int i = 0;
 	uint8_t b;
 	int k;
+	/* buffer for reading (arbitrary) large integer values */
+	uint8_t maskedOctets[MAX_OCTETS_FOR_UNSIGNED_INTEGER_64];
 
 	do {
 		/* Read the next octet */
@@ -731,22 +735,28 @@ int decodeDecimal(bitstream_t* stream, exi_decimal_t* d) {
 int decodeStringOnly(bitstream_t* stream, size_t len, exi_string_t* s) {
 	int errn = 0;
 	unsigned int extraChar = 0;
-#if STRING_REPRESENTATION == STRING_REPRESENTATION_ASCII
+	size_t units;
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_ASCII || STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
 	extraChar = 1; /* null terminator */
-#endif /* STRING_REPRESENTATION_ASCII */
+#endif /* STRING_REPRESENTATION_ASCII || STRING_REPRESENTATION_UTF8 */
+	units = len + extraChar;
+#if MEMORY_ALLOCATION == DYNAMIC_ALLOCATION
+	/* room for the longest encoding */
+	units = CHARACTER_UNITS(len);
+#endif /* DYNAMIC_ALLOCATION */
 
-	if ( (len + extraChar) > s->size) {
+	if ( units > s->size) {
 #if MEMORY_ALLOCATION == STATIC_ALLOCATION
 		errn = EXI_ERROR_OUT_OF_STRING_BUFFER;
 #endif /* STATIC_ALLOCATION */
 #if MEMORY_ALLOCATION == DYNAMIC_ALLOCATION
 		if(s->size > 0) {
-			errn = exiFreeDynamicStringMemory(s);
+			errn = exiFreeDynamicStringMemory(stream->arena, s);
 			if(errn) {
 				return errn;
 			}
 		}
-		errn = exiAllocateDynamicStringMemory(s, (len + extraChar)); /*s->len*/
+		errn = exiAllocateDynamicStringMemory(stream->arena, s, units); /*s->len*/
 #endif /* DYNAMIC_ALLOCATION */
 	}
 	if(errn == 0) {
@@ -768,6 +778,63 @@ int decodeString(bitstream_t* stream, exi_string_t* s) {
 	return errn;
 }
 
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+/* internal method to append code point cp as UTF-8 at chars[*j],
+ * keeps room for the null terminator */
+static int putCharacterUTF8(exi_string_character_t* chars, size_t charsSize, size_t* j, uint32_t cp) {
+	size_t n = cp < 0x80 ? 1 : (cp < 0x800 ? 2 : (cp < 0x10000 ? 3 : 4));
+
+	if (cp > 0x10FFFF) {
+		return EXI_ERROR_STRINGVALUES_CHARACTER;
+	}
+	if ( ((*j) + n + EXTRA_CHAR) > charsSize) {
+		return EXI_ERROR_OUT_OF_STRING_BUFFER;
+	}
+
+	switch(n) {
+	case 1:
+		chars[(*j)++] = (exi_string_character_t)cp;
+		break;
+	case 2:
+		chars[(*j)++] = (exi_string_character_t)(0xC0 | (cp >> 6));
+		chars[(*j)++] = (exi_string_character_t)(0x80 | (cp & 0x3F));
+		break;
+	case 3:
+		chars[(*j)++] = (exi_string_character_t)(0xE0 | (cp >> 12));
+		chars[(*j)++] = (exi_string_character_t)(0x80 | ((cp >> 6) & 0x3F));
+		chars[(*j)++] = (exi_string_character_t)(0x80 | (cp & 0x3F));
+		break;
+	default:
+		chars[(*j)++] = (exi_string_character_t)(0xF0 | (cp >> 18));
+		chars[(*j)++] = (exi_string_character_t)(0x80 | ((cp >> 12) & 0x3F));
+		chars[(*j)++] = (exi_string_character_t)(0x80 | ((cp >> 6) & 0x3F));
+		chars[(*j)++] = (exi_string_character_t)(0x80 | (cp & 0x3F));
+		break;
+	}
+	return 0;
+}
+#endif /* STRING_REPRESENTATION_UTF8 */
+
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS || STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+/* internal method to decode one character (Unsigned Integer code point) to chars[*j] */
+static int decodeCharacter(bitstream_t* stream, exi_string_character_t* chars, size_t charsSize, size_t* j) {
+	int errn;
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS
+	(void)charsSize;
+	errn = decodeUnsignedInteger32(stream, &chars[*j]);
+	(*j)++;
+#endif /* STRING_REPRESENTATION_UCS */
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+	uint32_t cp;
+	errn = decodeUnsignedInteger32(stream, &cp);
+	if (errn == 0) {
+		errn = putCharacterUTF8(chars, charsSize, j, cp);
+	}
+#endif /* STRING_REPRESENTATION_UTF8 */
+	return errn;
+}
+#endif /* STRING_REPRESENTATION_UCS || STRING_REPRESENTATION_UTF8 */
+
 /**
  * Decode a sequence of characters according to a given length.
  * Each character is represented by its UCS [ISO/IEC 10646]
@@ -776,11 +843,18 @@ int decodeString(bitstream_t* stream, exi_string_t* s) {
 int decodeCharacters(bitstream_t* stream, size_t len, exi_string_character_t* chars, size_t charsSize) {
 	unsigned int i;
 	int errn = 0;
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS || STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+	size_t j; /* next unit of chars */
+#if EXI_STREAM == BYTE_ARRAY
+	uint64_t octets;
+	size_t n;
+#endif /* EXI_STREAM == BYTE_ARRAY */
+#endif /* STRING_REPRESENTATION_UCS || STRING_REPRESENTATION_UTF8 */
 
 	unsigned int extraChar = 0;
-#if STRING_REPRESENTATION == STRING_REPRESENTATION_ASCII
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_ASCII || STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
 	extraChar = 1; /* null terminator */
-#endif /* STRING_REPRESENTATION_ASCII */
+#endif /* STRING_REPRESENTATION_ASCII || STRING_REPRESENTATION_UTF8 */
 
 	if ( (len + extraChar) > charsSize) {
 		errn = EXI_ERROR_OUT_OF_STRING_BUFFER;
@@ -801,11 +875,49 @@ int decodeCharacters(bitstream_t* stream, size_t len, exi_string_character_t* ch
 	chars[i] = '\0';
 
 #endif /* STRING_REPRESENTATION_ASCII */
-#if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS
-	for (i = 0; i < len && errn == 0; i++) {
-		errn = decodeUnsignedInteger32(stream, &chars[i]);
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS || STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+	i = 0;
+	j = 0;
+#if EXI_STREAM == BYTE_ARRAY
+	/* code points < 128 are single octets with the high bit clear,
+	 * take them eight at a time and fall back to the varint for the others
+	 * (as long as the rest fits as single units), the octets of byte-aligned
+	 * streams are read the same way */
+	while (i < len && errn == 0 && (j + (len - i) + extraChar) <= charsSize && peekOctets(stream, &octets) == 0) {
+		if ( (i + 8) <= len && (octets & 0x8080808080808080ULL) == 0 ) {
+			chars[j] = (exi_string_character_t)(octets >> 56);
+			chars[j + 1] = (exi_string_character_t)((octets >> 48) & 0x7F);
+			chars[j + 2] = (exi_string_character_t)((octets >> 40) & 0x7F);
+			chars[j + 3] = (exi_string_character_t)((octets >> 32) & 0x7F);
+			chars[j + 4] = (exi_string_character_t)((octets >> 24) & 0x7F);
+			chars[j + 5] = (exi_string_character_t)((octets >> 16) & 0x7F);
+			chars[j + 6] = (exi_string_character_t)((octets >> 8) & 0x7F);
+			chars[j + 7] = (exi_string_character_t)(octets & 0x7F);
+			n = 8;
+		} else {
+			for (n = 0; (i + n) < len && n < 8 && (octets & 0x8000000000000000ULL) == 0; n++) {
+				chars[j + n] = (exi_string_character_t)(octets >> 56);
+				octets = octets << 8;
+			}
+		}
+		skipOctets(stream, n);
+		i += (unsigned int)n;
+		j += n;
+		if (n < 8 && i < len) {
+			/* multi-octet code point */
+			errn = decodeCharacter(stream, chars, charsSize, &j);
+			i++;
+		}
 	}
-#endif /* STRING_REPRESENTATION_UCS */
+#endif /* EXI_STREAM == BYTE_ARRAY */
+	for (; i < len && errn == 0; i++) {
+		errn = decodeCharacter(stream, chars, charsSize, &j);
+	}
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+	/* null terminator \0 */
+	chars[j] = '\0';
+#endif /* STRING_REPRESENTATION_UTF8 */
+#endif /* STRING_REPRESENTATION_UCS || STRING_REPRESENTATION_UTF8 */
 
 
 
@@ -822,6 +934,12 @@ int decodeRCSCharacters(bitstream_t* stream, size_t len, exi_string_character_t*
 	uint8_t b;
 	extraChar = 1; /* null terminator */
 #endif /* STRING_REPRESENTATION_ASCII */
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS || STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+	size_t j = 0; /* next unit of chars */
+#endif /* STRING_REPRESENTATION_UCS || STRING_REPRESENTATION_UTF8 */
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+	extraChar = 1; /* null terminator */
+#endif /* STRING_REPRESENTATION_UTF8 */
 
 	if ( (len + extraChar) > charsSize) {
 		errn = EXI_ERROR_OUT_OF_STRING_BUFFER;
@@ -842,9 +960,9 @@ int decodeRCSCharacters(bitstream_t* stream, size_t len, exi_string_character_t*
 					errn = EXI_ERROR_STRINGVALUES_CHARACTER;
 				}
 #endif /* STRING_REPRESENTATION_ASCII */
-#if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS
-				errn = decodeUnsignedInteger32(stream, &chars[i]);
-#endif /* STRING_REPRESENTATION_UCS */
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS || STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+				errn = decodeCharacter(stream, chars, charsSize, &j);
+#endif /* STRING_REPRESENTATION_UCS || STRING_REPRESENTATION_UTF8 */
 
 			} else {
 				/* RCS match */
@@ -852,15 +970,111 @@ int decodeRCSCharacters(bitstream_t* stream, size_t len, exi_string_character_t*
 				chars[i] = rcsSet[uint32];
 #endif /* STRING_REPRESENTATION_ASCII */
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS
-				chars[i] = rcsSet[uint32];
+				chars[j++] = rcsSet[uint32];
 #endif /* STRING_REPRESENTATION_UCS */
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+				errn = putCharacterUTF8(chars, charsSize, &j, rcsSet[uint32]);
+#endif /* STRING_REPRESENTATION_UTF8 */
 			}
 		}
 	}
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+	/* null terminator \0 */
+	chars[j] = '\0';
+#endif /* STRING_REPRESENTATION_UTF8 */
+
+	return errn;
+}
+
+
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+/* internal method, decodes the compact identifier of a hit and looks up the value */
+static int decodeStringValueEntry(bitstream_t* stream, uint16_t qnameID, uint16_t len, const exi_value_table_entry_t** entry) {
+	int errn;
+	size_t n, codingLength;
+	uint32_t id = 0;
+
+	if (stream->valueTable == NULL) {
+		return EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+	}
+	if (len == 0) {
+		/* local value partition hit */
+		if (qnameID >= EXI_VALUE_TABLE_QNAMES) {
+			return EXI_ERROR_STRINGVALUES_OUT_OF_ENTRIES;
+		}
+		n = stream->valueTable->numberOfLocalValues[qnameID];
+	} else {
+		/* global value partition hit */
+		n = stream->valueTable->numberOfValues;
+	}
+
+	errn = exiGetCodingLength(n, &codingLength);
+	if (errn == 0) {
+		errn = decodeNBitUnsignedInteger(stream, codingLength, &id);
+	}
+	if (errn == 0) {
+		if (len == 0) {
+			errn = exiValueTableGetLocal(stream->valueTable, qnameID, id, entry);
+		} else {
+			errn = exiValueTableGetGlobal(stream->valueTable, id, entry);
+		}
+	}
 
 	return errn;
 }
 
+/* internal method, copies a value of the table including the null terminator */
+static void copyStringValue(const exi_value_table_entry_t* entry, uint16_t* len, exi_string_character_t* chars) {
+	size_t i;
+
+	for (i = 0; i < entry->units; i++) {
+		chars[i] = entry->characters[i];
+	}
+#if EXTRA_CHAR
+	chars[entry->units] = '\0';
+#endif /* EXTRA_CHAR */
+	*len = entry->len;
+}
+
+int decodeStringValueHit(bitstream_t* stream, uint16_t qnameID, uint16_t* len, exi_string_character_t* chars, size_t charsSize) {
+	const exi_value_table_entry_t* entry = NULL;
+	int errn = decodeStringValueEntry(stream, qnameID, *len, &entry);
+
+	if (errn == 0) {
+		if ((size_t)entry->units + EXTRA_CHAR > charsSize) {
+			errn = EXI_ERROR_OUT_OF_STRING_BUFFER;
+		} else {
+			copyStringValue(entry, len, chars);
+		}
+	}
+
+	return errn;
+}
+
+#if DATABINDING == DATABINDING_SLIM
+int decodeStringValueHitArena(bitstream_t* stream, uint16_t qnameID, uint16_t* len, exi_string_character_t** chars) {
+	const exi_value_table_entry_t* entry = NULL;
+	int errn = decodeStringValueEntry(stream, qnameID, *len, &entry);
+
+	if (errn == 0) {
+		errn = EXI_ARENA_ALLOCATE(stream, *chars, CHARACTER_UNITS(entry->len));
+	}
+	if (errn == 0) {
+		copyStringValue(entry, len, *chars);
+	}
+
+	return errn;
+}
+#endif /* DATABINDING_SLIM */
+
+int addStringValue(bitstream_t* stream, uint16_t qnameID, const exi_string_character_t* chars, size_t len) {
+	if (stream->valueTable == NULL) {
+		return 0;
+	}
+	return exiValueTableAdd(stream->valueTable, qnameID, chars, len);
+}
+#endif /* EXI_OPTION_VALUE_PARTITION_CAPACITY != 0 */
+
 
 /**
  * Decode a binary value as a length-prefixed sequence of octets.
@@ -873,14 +1087,16 @@ int decodeBinary(bitstream_t* stream, exi_bytes_t* bytes) {
 			errn = EXI_ERROR_OUT_OF_BYTE_BUFFER;
 #endif /* STATIC_ALLOCATION */
 #if MEMORY_ALLOCATION == DYNAMIC_ALLOCATION
-			errn = exiFreeDynamicBinaryMemory(bytes);
+			errn = exiFreeDynamicBinaryMemory(stream->arena, bytes);
 			if(errn == 0) {
-				errn = exiAllocateDynamicBinaryMemory(bytes, bytes->len);
+				errn = exiAllocateDynamicBinaryMemory(stream->arena, bytes, bytes->len);
 			}
 #endif /* DYNAMIC_ALLOCATION */
 		}
 
-		errn = decodeBytes(stream, bytes->len, bytes->data);
+		if (errn == 0) {
+			errn = decodeBytes(stream, bytes->len, bytes->data);
+		}
 	}
 
 	return errn;
@@ -982,54 +1198,50 @@ int decodeDateTime(bitstream_t* stream, exi_datetime_type_t type, exi_datetime_t
 
 
 int decode(bitstream_t* stream, uint8_t* b) {
-#if EXI_OPTION_ALIGNMENT == BIT_PACKED
 	uint32_t bb;
-	int errn =  readBits(stream, 8, &bb);
-	if (errn == 0) {
-		if (bb > 256) {
-			errn = EXI_ERROR_UNEXPECTED_BYTE_VALUE;
-		} else {
-			*b = (uint8_t)bb;
-		}
-	}
-
-	return errn;
-#endif /* EXI_OPTION_ALIGNMENT == BIT_PACKED */
-#if EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT
 	int errn = 0;
+	if (EXI_STREAM_ALIGNMENT(stream) == BYTE_ALIGNMENT) {
+		/* byte-aligned streams start after the header at a byte boundary */
 #if EXI_STREAM == BYTE_ARRAY
-	if ( (*stream->pos) < stream->size ) {
-		*b = stream->data[(*stream->pos)++];
-	} else {
-		errn = EXI_ERROR_INPUT_STREAM_EOF;
-	}
+		if ( (*stream->pos) < stream->size ) {
+			*b = stream->data[(*stream->pos)++];
+		} else {
+			errn = EXI_ERROR_INPUT_STREAM_EOF;
+		}
 #endif /* EXI_STREAM == BYTE_ARRAY */
 #if EXI_STREAM == FILE_STREAM
-	*b = (uint8_t)(getc(stream->file));
-	/* EOF cannot be used, 0xFF valid value */
-	if ( feof(stream->file) || ferror(stream->file) ) {
-		errn = EXI_ERROR_INPUT_STREAM_EOF;
-	}
+		/* the bit reader is at a byte boundary, it reads through the staging buffer of the file */
+		errn = readBits(stream, 8, &bb);
+		if (errn == 0) {
+			*b = (uint8_t)bb;
+		}
 #endif /* EXI_STREAM == FILE_STREAM */
+	} else {
+		errn = readBits(stream, 8, &bb);
+		if (errn == 0) {
+			if (bb > 256) {
+				errn = EXI_ERROR_UNEXPECTED_BYTE_VALUE;
+			} else {
+				*b = (uint8_t)bb;
+			}
+		}
+	}
 
 	return errn;
-#endif /* EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT */
 }
 
 int decodeBoolean(bitstream_t* stream, int* b) {
-#if EXI_OPTION_ALIGNMENT == BIT_PACKED
 	uint32_t ub;
-	int errn = readBits(stream, 1, &ub);
-	*b = (ub == 0) ? 0 : 1;
-	return errn;
-#endif /* EXI_OPTION_ALIGNMENT == BIT_PACKED */
-#if EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT
 	uint8_t bb;
-	int errn = decode(stream, &bb);
-	*b = (bb == 0) ? 0 : 1;
+	int errn;
+	if (EXI_STREAM_ALIGNMENT(stream) == BYTE_ALIGNMENT) {
+		errn = decode(stream, &bb);
+		ub = bb;
+	} else {
+		errn = readBits(stream, 1, &ub);
+	}
+	*b = (ub == 0) ? 0 : 1;
 	return errn;
-#endif /* EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT */
-
 }
 
 /**
@@ -1037,29 +1249,23 @@ int decodeBoolean(bitstream_t* stream, int* b) {
  * bytes required for n bits.
  */
 int decodeNBitUnsignedInteger(bitstream_t* stream, size_t nbits, uint32_t* uint32) {
-#if EXI_OPTION_ALIGNMENT == BIT_PACKED
+	size_t bitsRead = 0;
+	uint8_t b;
 	int errn = 0;
 	if (nbits == 0) {
 		*uint32 = 0;
+	} else if (EXI_STREAM_ALIGNMENT(stream) == BYTE_ALIGNMENT) {
+		/* least significant byte first */
+		*uint32 = 0;
+		while (errn == 0 && bitsRead < nbits) {
+			errn = decode(stream, &b);
+			*uint32 = *uint32 + ((uint32_t)b << bitsRead);
+			bitsRead = (bitsRead + 8);
+		}
 	} else {
-		errn= readBits(stream, nbits, uint32);
+		errn = readBits(stream, nbits, uint32);
 	}
 	return errn;
-#endif /* EXI_OPTION_ALIGNMENT == BIT_PACKED */
-#if EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT
-	size_t bitsRead = 0;
-	uint8_t b;
-	int errn = 0;
-	*uint32 = 0;
-
-	while (errn == 0 && bitsRead < nbits) {
-		errn = decode(stream, &b);
-		*uint32 = *uint32 + (uint32_t)(b << bitsRead);
-		bitsRead = (bitsRead + 8);
-	}
-
-	return errn;
-#endif /* EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT */
 }
 
 
@@ -393,6 +393,65 @@ int decodeCharacters(bitstream_t* stream, size_t len, exi_string_character_t* ch
 int decodeRCSCharacters(bitstream_t* stream, size_t len, exi_string_character_t* chars, size_t charsSize, size_t rcsCodeLength, size_t rcsSize, const exi_string_character_t rcsSet[]);
 
 
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+/**
+ * \brief 		Decode string table hit
+ *
+ * 				Decodes the compact identifier of a local (len == 0) or
+ * 				global (len == 1) value partition hit and copies the value of
+ * 				stream->valueTable (see StringTable.h).
+ *
+ * \param       stream   		Input Stream
+ * \param       qnameID   		Local partition, numbered by the codec
+ * \param       len		   		Decoded length 0 or 1 (in), number of code-points (out)
+ * \param       chars   		Characters (out)
+ * \param       charsSize		Size of possible characters
+ * \return                  	Error-Code <> 0
+ *
+ */
+int decodeStringValueHit(bitstream_t* stream, uint16_t qnameID, uint16_t* len, exi_string_character_t* chars, size_t charsSize);
+
+
+#if DATABINDING == DATABINDING_SLIM
+/**
+ * \brief 		Decode string table hit into the arena of the stream
+ *
+ * 				As decodeStringValueHit(), the characters are allocated
+ * 				from stream->arena.
+ *
+ * \param       stream   		Input Stream
+ * \param       qnameID   		Local partition, numbered by the codec
+ * \param       len		   		Decoded length 0 or 1 (in), number of code-points (out)
+ * \param       chars   		Characters (out)
+ * \return                  	Error-Code <> 0
+ *
+ */
+int decodeStringValueHitArena(bitstream_t* stream, uint16_t qnameID, uint16_t* len, exi_string_character_t** chars);
+#endif /* DATABINDING_SLIM */
+
+
+/**
+ * \brief 		Add string table miss
+ *
+ * 				Adds the characters of a decoded string table miss to the
+ * 				value partitions of stream->valueTable.
+ *
+ * \param       stream   		Input Stream
+ * \param       qnameID   		Local partition, numbered by the codec
+ * \param       chars   		Characters
+ * \param       len		   		Number of code-points
+ * \return                  	Error-Code <> 0
+ *
+ */
+int addStringValue(bitstream_t* stream, uint16_t qnameID, const exi_string_character_t* chars, size_t len);
+#else
+/* without value partitions a hit is an error and misses are not kept */
+#define decodeStringValueHit(stream, qnameID, len, chars, charsSize) EXI_ERROR_STRINGVALUES_NOT_SUPPORTED
+#define decodeStringValueHitArena(stream, qnameID, len, chars) EXI_ERROR_STRINGVALUES_NOT_SUPPORTED
+#define addStringValue(stream, qnameID, chars, len) 0
+#endif /* EXI_OPTION_VALUE_PARTITION_CAPACITY */
+
+
 
 /**
  * \brief 		Decode Binary
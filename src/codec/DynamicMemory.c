@@ -0,0 +1,51 @@
+/*******************************************************************
+ * String and binary containers of MEMORY_ALLOCATION == DYNAMIC_ALLOCATION.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+#include "DynamicMemory.h"
+#include "ErrorCodes.h"
+
+#ifndef DYNAMIC_MEMORY_C
+#define DYNAMIC_MEMORY_C
+
+#if MEMORY_ALLOCATION == DYNAMIC_ALLOCATION
+
+int exiAllocateDynamicStringMemory(exi_arena_t* arena, exi_string_t* s, size_t size) {
+	s->characters = (exi_string_character_t*)exiArenaAllocate(arena, size * sizeof(exi_string_character_t));
+	if (s->characters == NULL) {
+		s->size = 0;
+		return EXI_ERROR_OUT_OF_ARENA_MEMORY;
+	}
+	s->size = size;
+	return 0;
+}
+
+int exiAllocateDynamicBinaryMemory(exi_arena_t* arena, exi_bytes_t* bytes, size_t size) {
+	bytes->data = (uint8_t*)exiArenaAllocate(arena, size);
+	if (bytes->data == NULL) {
+		bytes->size = 0;
+		return EXI_ERROR_OUT_OF_ARENA_MEMORY;
+	}
+	bytes->size = size;
+	return 0;
+}
+
+int exiFreeDynamicStringMemory(exi_arena_t* arena, exi_string_t* s) {
+	exiArenaFree(arena, s->characters, s->size * sizeof(exi_string_character_t));
+	s->size = 0;
+	return 0;
+}
+
+int exiFreeDynamicBinaryMemory(exi_arena_t* arena, exi_bytes_t* bytes) {
+	exiArenaFree(arena, bytes->data, bytes->size);
+	bytes->size = 0;
+	return 0;
+}
+
+#endif /* DYNAMIC_ALLOCATION */
+
+#endif /* DYNAMIC_MEMORY_C */
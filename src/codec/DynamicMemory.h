@@ -0,0 +1,84 @@
+/*******************************************************************
+ * String and binary containers of MEMORY_ALLOCATION == DYNAMIC_ALLOCATION.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+/**
+* \file 	DynamicMemory.h
+* \brief 	exi_string_t and exi_bytes_t storage taken from a MemoryArena
+*
+* 			The containers of one decoded message live in the arena of the
+* 			decoding stream (bitstream_t.arena) and are released together
+* 			with exiArenaReset() once the message is processed.
+*
+*/
+
+#ifndef DYNAMIC_MEMORY_H
+#define DYNAMIC_MEMORY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "EXITypes.h"
+#include "MemoryArena.h"
+
+
+/**
+ * \brief 	Allocates the character container of a string
+ *
+ * \param       arena		arena
+ * \param       s			string, size and characters are set
+ * \param       size		number of characters
+ * \return                  Error-Code <> 0 (EXI_ERROR_OUT_OF_ARENA_MEMORY)
+ *
+ */
+int exiAllocateDynamicStringMemory(exi_arena_t* arena, exi_string_t* s, size_t size);
+
+
+/**
+ * \brief 	Allocates the data container of a binary value
+ *
+ * \param       arena		arena
+ * \param       bytes		binary value, size and data are set
+ * \param       size		number of bytes
+ * \return                  Error-Code <> 0 (EXI_ERROR_OUT_OF_ARENA_MEMORY)
+ *
+ */
+int exiAllocateDynamicBinaryMemory(exi_arena_t* arena, exi_bytes_t* bytes, size_t size);
+
+
+/**
+ * \brief 	Releases the character container of a string
+ *
+ * 			The memory returns to the arena if it was the last allocation.
+ *
+ * \param       arena		arena
+ * \param       s			string, size is 0 afterwards
+ * \return                  Error-Code <> 0
+ *
+ */
+int exiFreeDynamicStringMemory(exi_arena_t* arena, exi_string_t* s);
+
+
+/**
+ * \brief 	Releases the data container of a binary value
+ *
+ * 			The memory returns to the arena if it was the last allocation.
+ *
+ * \param       arena		arena
+ * \param       bytes		binary value, size is 0 afterwards
+ * \return                  Error-Code <> 0
+ *
+ */
+int exiFreeDynamicBinaryMemory(exi_arena_t* arena, exi_bytes_t* bytes);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DYNAMIC_MEMORY_H */
@@ -53,6 +53,85 @@ extern "C" {
  * */
 #define EXI_STREAM BYTE_ARRAY
 
+/** Staging buffer size for a FILE_STREAM with block reads and writes (see initFileStream) */
+#define EXI_FILE_BUFFER_SIZE 65536
+
+
+/** Bit reader - Option byte-wise buffer refill */
+#define BIT_READER_BYTEWISE 1
+/** Bit reader - Option 64 bit cache word refill */
+#define BIT_READER_WORD 2
+/** \brief 	Bit reader mode
+ *
+ * 			Byte-wise refill or 64 bit cache word (byte array streams only).
+ * 			The cache word only pays off for fields of several bytes, for the
+ * 			short fields of the V2G messages the byte-wise refill is faster.
+ * 			The eight octets at a time of decodeCharacters (peekOctets) work
+ * 			with both. "make check" also runs the benchmark with the cache word.
+ * */
+#ifndef BIT_READER
+#define BIT_READER BIT_READER_BYTEWISE
+#endif
+
+
+/** Bit writer - Option byte-wise buffer */
+#define BIT_WRITER_BYTEWISE 1
+/** Bit writer - Option 64 bit staging word, written on flush */
+#define BIT_WRITER_WORD 2
+/** \brief 	Bit writer mode
+ *
+ * 			Byte-wise buffer or 64 bit staging word (byte array streams only)
+ * */
+#define BIT_WRITER BIT_WRITER_WORD
+
+
+/** Encoder digest - Option no digest support */
+#define ENCODER_DIGEST_NONE 1
+/** Encoder digest - Option SHA-256 over the written bytes */
+#define ENCODER_DIGEST_SHA256 2
+/** \brief 	Encoder digest mode (byte array streams only)
+ *
+ * 			With SHA-256 a stream can carry a digest context (see Sha256.h),
+ * 			which is updated with every byte the bit writer produces. The
+ * 			encode_*ExiFragmentDigest functions use it to hash signed fragments
+ * 			while encoding them, with or without keeping the bytes.
+ * */
+#define ENCODER_DIGEST ENCODER_DIGEST_SHA256
+
+
+
+/** Grammar decoder - generated switch statements */
+#define GRAMMAR_DECODER_SWITCH 1
+/** Grammar decoder - generated state tables and one interpreter loop (see GrammarDecoder.h) */
+#define GRAMMAR_DECODER_TABLE 2
+/** \brief 	Grammar decoder mode
+ *
+ * 			The switch statements decode fastest. The tables are generated
+ * 			next to them (tools/grammar_tables.py) and share the productions
+ * 			of repeated events, the ISO2 decoder shrinks to about a third.
+ * */
+#define GRAMMAR_DECODER GRAMMAR_DECODER_SWITCH
+
+
+
+/** Databinding - every value inline in the document structs */
+#define DATABINDING_INLINE 1
+/** Databinding - large values out-of-line in the arena of the decoding stream (see MemoryArena.h) */
+#define DATABINDING_SLIM 2
+/** \brief 	Databinding mode
+ *
+ * 			With DATABINDING_SLIM the large byte and character values,
+ * 			large arrays and large optional elements (signatures, certificates,
+ * 			SalesTariff) of the DIN, ISO1 and ISO2 structs are pointers
+ * 			(tools/slim_databinding.py). The decoders allocate them from
+ * 			bitstream_t.arena, values keep their decoded length. Encoders read
+ * 			them through the pointers set by the application. The document
+ * 			structs shrink to some hundred bytes. "make check" also runs the
+ * 			example and the benchmark with DATABINDING_SLIM.
+ * */
+#ifndef DATABINDING
+#define DATABINDING DATABINDING_INLINE
+#endif
 
 
 
@@ -65,6 +144,12 @@ extern "C" {
 /** \brief 	Memory allocation mode
  *
  * 			static or dynamic memory allocation
+ *
+ * 			Dynamic allocation sizes the exi_string_t and exi_bytes_t
+ * 			containers of decodeString() and decodeBinary() to the decoded
+ * 			length, taken from bitstream_t.arena (DynamicMemory.h). Resetting
+ * 			the arena after each message releases them in O(1). The values of
+ * 			the generated DIN/ISO structs follow DATABINDING instead.
  * */
 #define MEMORY_ALLOCATION STATIC_ALLOCATION
 
@@ -74,10 +159,19 @@ extern "C" {
 #define STRING_REPRESENTATION_ASCII 1
 /** String representation Universal Character Set (UCS) */
 #define STRING_REPRESENTATION_UCS 2
+/** String representation UTF-8 */
+#define STRING_REPRESENTATION_UTF8 3
 /** */
 /** \brief 	String representation mode
  *
- * 			ASCII or UCS
+ * 			ASCII, UCS or UTF8
+ *
+ * 			UCS stores one 32 bit code point per character. UTF8 stores the
+ * 			UTF-8 bytes (null terminated), a quarter of the memory for the
+ * 			mostly ASCII values of V2G. The lengths (charactersLen,
+ * 			exi_string_t.len) keep counting code points, a non-ASCII value
+ * 			that needs more bytes than its buffer holds is rejected with
+ * 			EXI_ERROR_OUT_OF_STRING_BUFFER.
  * */
 #define STRING_REPRESENTATION STRING_REPRESENTATION_UCS
 
@@ -89,6 +183,16 @@ extern "C" {
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS
 #define EXTRA_CHAR 0
 #endif /* STRING_REPRESENTATION_UCS */
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+#define EXTRA_CHAR 1
+#endif /* STRING_REPRESENTATION_UTF8 */
+
+/* characters to allocate for a value of len code points (at most 4 UTF-8 bytes each) */
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+#define CHARACTER_UNITS(len) ((len) * 4 + EXTRA_CHAR)
+#else
+#define CHARACTER_UNITS(len) ((len) + EXTRA_CHAR)
+#endif /* STRING_REPRESENTATION_UTF8 */
 
 
 
@@ -98,6 +202,17 @@ extern "C" {
 #define EXI_ELEMENT_STACK_SIZE 24
 
 
+/** \brief 	Value string table (EXI_OPTION_VALUE_PARTITION_CAPACITY != 0, see StringTable.h)
+ *
+ * 			Values kept by unbounded partitions (bounded ones keep their
+ * 			capacity), code-points kept per value and qnames with a local
+ * 			partition. About 17 kByte with UCS, 5 kByte with ASCII.
+ * */
+#define EXI_VALUE_TABLE_ENTRIES 64
+#define EXI_VALUE_TABLE_STRING_LENGTH 64
+#define EXI_VALUE_TABLE_QNAMES 64
+
+
 #ifdef __cplusplus
 }
 #endif
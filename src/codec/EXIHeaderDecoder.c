@@ -32,32 +32,236 @@
 #include "EXIHeaderDecoder.h"
 #include "BitInputStream.h"
 #include "DecoderChannel.h"
+#include "StringTable.h"
 #include "ErrorCodes.h"
+#include "MethodsBag.h"
 
 #ifndef EXI_HEADER_DECODER_C
 #define EXI_HEADER_DECODER_C
 
+/* options of a stream, the defaults unless the header has options */
+typedef struct {
+	uint8_t alignment;
+	int strict;
+	int32_t valueMaxLength;
+	int32_t valuePartitionCapacity;
+} exi_header_options_t;
+
+/* reader of an element of the options document, NULL for unsupported options */
+typedef int (*exi_header_element_t)(bitstream_t* stream, exi_header_options_t* options);
+
+/* The EXI options document (EXI 1.0, 5.4 and Appendix C) is an EXI body of the
+ * options schema with strict grammars and bit-packed. Most elements are a
+ * sequence of optional elements, so an event code selects the next element of
+ * the sequence or END_ELEMENT. */
+
+/* internal method to read the event code of a grammar state with n events */
+static int readEventCode(bitstream_t* stream, size_t n, uint32_t* eventCode) {
+	size_t nbits;
+	int errn = exiGetCodingLength(n, &nbits);
+	*eventCode = 0;
+	if (errn == 0 && nbits > 0) {
+		errn = readBits(stream, nbits, eventCode);
+		if (errn == 0 && *eventCode >= n) {
+			errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+		}
+	}
+	return errn;
+}
+
+/* internal method to read the content of a sequence of n optional elements up to
+ * END_ELEMENT, wildcard is a SE(*) of the first state after the elements */
+static int readSequence(bitstream_t* stream, exi_header_options_t* options,
+		const exi_header_element_t* elements, size_t n, int wildcard) {
+	uint32_t eventCode;
+	size_t child = 0;
+	size_t events;
+	int errn = 0;
+
+	while (errn == 0) {
+		events = n - child + 1 + ((wildcard && child == 0) ? 1 : 0);
+		errn = readEventCode(stream, events, &eventCode);
+		if (errn == 0) {
+			if (eventCode == events - 1) {
+				/* END_ELEMENT */
+				break;
+			}
+			child += eventCode;
+			if (child >= n || elements[child] == NULL) {
+				/* we do not support this option (or other elements of the wildcard) */
+				errn = EXI_UNSUPPORTED_HEADER_OPTIONS;
+			} else {
+				errn = elements[child](stream, options);
+				child++;
+			}
+		}
+	}
+	return errn;
+}
+
+/* internal method to read an unsignedInt value */
+static int readUnsignedInt(bitstream_t* stream, int32_t* value) {
+	uint32_t b = 128;
+	uint32_t v = 0;
+	size_t shift = 0;
+	int errn = 0;
+
+	while (errn == 0 && (b & 128) != 0) {
+		errn = readBits(stream, 8, &b);
+		if (errn == 0) {
+			if (shift > 28 || (shift == 28 && (b & 127) > 15)) {
+				errn = EXI_UNSUPPORTED_INTEGER_VALUE;
+			} else {
+				v = v | ((b & 127) << shift);
+				shift += 7;
+			}
+		}
+	}
+	/* values beyond any string length or table size act as unbounded */
+	*value = (v > INT32_MAX) ? -1 : (int32_t)v;
+	return errn;
+}
+
+/* internal method to read the xsd:unsignedInt content of valueMaxLength and valuePartitionCapacity,
+ * the type has named sub-types and so AT(xsi:type) before CHARACTERS */
+static int readUnsignedIntElement(bitstream_t* stream, int32_t* value) {
+	uint32_t eventCode;
+	int errn = readEventCode(stream, 2, &eventCode);
+	if (errn == 0) {
+		if (eventCode == 1) {
+			errn = readUnsignedInt(stream, value);
+		} else {
+			/* we do not support xsi:type */
+			errn = EXI_UNSUPPORTED_HEADER_OPTIONS;
+		}
+	}
+	return errn;
+}
+
+/* alignment: byte | pre-compress, both of empty content */
+static int readAlignment(bitstream_t* stream, exi_header_options_t* options) {
+	uint32_t eventCode;
+	int errn = readEventCode(stream, 2, &eventCode);
+	if (errn == 0) {
+		if (eventCode == 0) {
+			options->alignment = BYTE_ALIGNMENT;
+		} else {
+			/* we do not support "pre-compress" */
+			errn = EXI_UNSUPPORTED_HEADER_OPTIONS;
+		}
+	}
+	return errn;
+}
+
+static int readValueMaxLength(bitstream_t* stream, exi_header_options_t* options) {
+	return readUnsignedIntElement(stream, &options->valueMaxLength);
+}
+
+static int readValuePartitionCapacity(bitstream_t* stream, exi_header_options_t* options) {
+	return readUnsignedIntElement(stream, &options->valuePartitionCapacity);
+}
+
+/* uncommon: (##other)*, alignment, selfContained, valueMaxLength, valuePartitionCapacity, datatypeRepresentationMap* */
+static int readUncommon(bitstream_t* stream, exi_header_options_t* options) {
+	static const exi_header_element_t elements[5] = { readAlignment, NULL, readValueMaxLength, readValuePartitionCapacity, NULL };
+	return readSequence(stream, options, elements, 5, 1);
+}
+
+/* preserve: dtd, prefixes, lexicalValues, comments, pis, the codecs preserve nothing */
+static int readPreserve(bitstream_t* stream, exi_header_options_t* options) {
+	static const exi_header_element_t elements[5] = { NULL, NULL, NULL, NULL, NULL };
+	return readSequence(stream, options, elements, 5, 0);
+}
+
+/* blockSize: unsignedInt, only used with compression */
+static int readBlockSize(bitstream_t* stream, exi_header_options_t* options) {
+	int32_t blockSize;
+	(void)options;
+	return readUnsignedInt(stream, &blockSize);
+}
+
+/* lesscommon: uncommon, preserve, blockSize */
+static int readLessCommon(bitstream_t* stream, exi_header_options_t* options) {
+	static const exi_header_element_t elements[3] = { readUncommon, readPreserve, readBlockSize };
+	return readSequence(stream, options, elements, 3, 0);
+}
+
+/* common: compression, fragment, schemaId */
+static int readCommon(bitstream_t* stream, exi_header_options_t* options) {
+	static const exi_header_element_t elements[3] = { NULL, NULL, NULL };
+	return readSequence(stream, options, elements, 3, 0);
+}
+
+/* strict: empty content */
+static int readStrict(bitstream_t* stream, exi_header_options_t* options) {
+	(void)stream;
+	options->strict = 1;
+	return 0;
+}
+
+/* header: lesscommon, common, strict (the document has no further event codes) */
+static int readOptions(bitstream_t* stream, exi_header_options_t* options) {
+	static const exi_header_element_t elements[3] = { readLessCommon, readCommon, readStrict };
+	return readSequence(stream, options, elements, 3, 0);
+}
+
 int readEXIHeader(bitstream_t* stream) {
 	int errn;
 	uint32_t header = 0;
+	exi_header_options_t options;
+
+	/* EXI defaults */
+	options.alignment = BIT_PACKED;
+	options.strict = 0;
+	options.valueMaxLength = -1;
+	options.valuePartitionCapacity = -1;
 
 	/* init stream */
 	stream->buffer = 0;
 	stream->capacity = 0;
 
 	errn = readBits(stream, 8, &header);
-	if (errn == 0) {
-		if(header == '$') {
-			/*	we do not support "EXI Cookie" */
+	if (errn == 0 && header == '$') {
+		/* EXI Cookie "$EXI" */
+		errn = readBits(stream, 24, &header);
+		if (errn == 0 && header != 0x455849) {
 			errn = EXI_UNSUPPORTED_HEADER_COOKIE;
-		} else if ( header & 0x20 ) {
-			/* we do not support "Presence Bit for EXI Options" */
-			errn = EXI_UNSUPPORTED_HEADER_OPTIONS;
+		}
+		if (errn == 0) {
+			errn = readBits(stream, 8, &header);
+		}
+	}
+	if (errn == 0) {
+		if ( header & 0x20 ) {
+			/* Presence Bit for EXI Options */
+			errn = readOptions(stream, &options);
+			if (errn == 0 && options.alignment == BYTE_ALIGNMENT) {
+				/* skip the padding bits of the header */
+				stream->capacity = 0;
+			}
+#if EXI_OPTION_ALIGNMENT != ALIGNMENT_PER_STREAM
+			if (errn == 0 && options.alignment != EXI_OPTION_ALIGNMENT) {
+				/* the alignment is fixed at compile time */
+				errn = EXI_UNSUPPORTED_HEADER_OPTIONS;
+			}
+#endif /* ALIGNMENT_PER_STREAM */
+			if (errn == 0 && options.strict != EXI_OPTION_STRICT) {
+				/* the grammars of the codecs are either strict or not */
+				errn = EXI_UNSUPPORTED_HEADER_OPTIONS;
+			}
 		} else {
 			/* Yes, a *simple* header */
 			errn = 0;
 		}
 	}
+#if EXI_OPTION_ALIGNMENT == ALIGNMENT_PER_STREAM
+	stream->alignment = options.alignment;
+#endif /* ALIGNMENT_PER_STREAM */
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+	if (stream->valueTable != NULL) {
+		exiValueTableReset(stream->valueTable, options.valuePartitionCapacity, options.valueMaxLength);
+	}
+#endif /* EXI_OPTION_VALUE_PARTITION_CAPACITY */
 
 	return errn;
 }
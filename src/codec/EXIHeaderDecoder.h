@@ -47,6 +47,12 @@ extern "C" {
 /**
  * \brief 		Reads EXI header
  *
+ *				Accepts an EXI cookie and the options alignment (byte-aligned
+ *				with ALIGNMENT_PER_STREAM or BYTE_ALIGNMENT), strict (as
+ *				EXI_OPTION_STRICT), valueMaxLength, valuePartitionCapacity, blockSize
+ *				and empty preserve or common elements. Other options are
+ *				EXI_UNSUPPORTED_HEADER_OPTIONS.
+ *
  * \param       stream   		Input Stream
  * \return                  	Error-Code <> 0
  *
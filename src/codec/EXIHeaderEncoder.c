@@ -32,17 +32,161 @@
 #include "EXIHeaderEncoder.h"
 #include "BitOutputStream.h"
 #include "EncoderChannel.h"
+#include "StringTable.h"
+#include "MethodsBag.h"
 
 #ifndef EXI_HEADER_ENCODER_C
 #define EXI_HEADER_ENCODER_C
 
-int writeEXIHeader(bitstream_t* stream) {
-	/* init stream */
+/* internal method to reset the bit writer */
+static void initStream(bitstream_t* stream) {
+#if EXI_STREAM == BYTE_ARRAY && BIT_WRITER == BIT_WRITER_WORD
+	stream->word = 0;
+	stream->capacity = 64;
+#else
 	stream->buffer = 0;
 	stream->capacity = 8;
+#endif
+#if EXI_STREAM == BYTE_ARRAY && ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+	stream->digest = NULL;
+#endif
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+	if (stream->valueTable != NULL) {
+		exiValueTableReset(stream->valueTable, EXI_OPTION_VALUE_PARTITION_CAPACITY, EXI_OPTION_VALUE_MAX_LENGTH);
+	}
+#endif /* EXI_OPTION_VALUE_PARTITION_CAPACITY */
+}
+
+/* The EXI options document (EXI 1.0, 5.4 and Appendix C) is an EXI body of the
+ * options schema with strict grammars and bit-packed, see EXIHeaderDecoder.c.
+ * A value partition capacity of 0 only keeps the encoders from string table
+ * hits and is not written. */
+#define HEADER_VALUE_MAX_LENGTH (EXI_OPTION_VALUE_PARTITION_CAPACITY != 0 && EXI_OPTION_VALUE_MAX_LENGTH >= 0)
+#define HEADER_VALUE_PARTITION_CAPACITY (EXI_OPTION_VALUE_PARTITION_CAPACITY > 0)
+
+/* internal method to write the event code of a grammar state with n events */
+static int writeEventCode(bitstream_t* stream, size_t n, uint32_t eventCode) {
+	size_t nbits;
+	int errn = exiGetCodingLength(n, &nbits);
+	if (errn == 0 && nbits > 0) {
+		errn = writeBits(stream, nbits, eventCode);
+	}
+	return errn;
+}
+
+/* internal method to write the event code of element (n for END_ELEMENT) of a sequence of n
+ * optional elements, child is the first possible element and becomes the one after element,
+ * wildcard is a SE(*) of the first state after the elements */
+static int writeSequence(bitstream_t* stream, size_t n, int wildcard, size_t* child, size_t element) {
+	size_t events = n - (*child) + 1 + ((wildcard && (*child) == 0) ? 1 : 0);
+	uint32_t eventCode = (uint32_t)((element == n) ? events - 1 : element - (*child));
+	*child = element + 1;
+	return writeEventCode(stream, events, eventCode);
+}
+
+/* internal method to write the xsd:unsignedInt content of valueMaxLength and valuePartitionCapacity,
+ * CHARACTERS after AT(xsi:type) */
+static int writeUnsignedIntElement(bitstream_t* stream, uint32_t value) {
+	int errn = writeEventCode(stream, 2, 1);
+	while (errn == 0 && value >= 128) {
+		errn = writeBits(stream, 8, (value & 127) | 128);
+		value = value >> 7;
+	}
+	if (errn == 0) {
+		errn = writeBits(stream, 8, value);
+	}
+	return errn;
+}
+
+/* internal method, 1 if the stream has options in uncommon */
+static int hasUncommonOptions(bitstream_t* stream) {
+	return EXI_STREAM_ALIGNMENT(stream) == BYTE_ALIGNMENT || HEADER_VALUE_MAX_LENGTH || HEADER_VALUE_PARTITION_CAPACITY;
+}
+
+/* internal method to write the EXI options document and for byte-aligned streams the padding bits */
+static int writeOptions(bitstream_t* stream) {
+	size_t header = 0, lesscommon = 0, uncommon = 0;
+	int errn = 0;
+
+	if (hasUncommonOptions(stream)) {
+		/* header: SE(lesscommon), lesscommon: SE(uncommon) */
+		errn = writeSequence(stream, 3, 0, &header, 0);
+		if (errn == 0) {
+			errn = writeSequence(stream, 3, 0, &lesscommon, 0);
+		}
+		/* uncommon: (##other)*, alignment, selfContained, valueMaxLength, valuePartitionCapacity, datatypeRepresentationMap* */
+		if (errn == 0 && EXI_STREAM_ALIGNMENT(stream) == BYTE_ALIGNMENT) {
+			/* alignment: SE(byte), byte and alignment end without event codes */
+			errn = writeSequence(stream, 5, 1, &uncommon, 0);
+			if (errn == 0) {
+				errn = writeEventCode(stream, 2, 0);
+			}
+		}
+		if (errn == 0 && HEADER_VALUE_MAX_LENGTH) {
+			errn = writeSequence(stream, 5, 1, &uncommon, 2);
+			if (errn == 0) {
+				errn = writeUnsignedIntElement(stream, (uint32_t)EXI_OPTION_VALUE_MAX_LENGTH);
+			}
+		}
+		if (errn == 0 && HEADER_VALUE_PARTITION_CAPACITY) {
+			errn = writeSequence(stream, 5, 1, &uncommon, 3);
+			if (errn == 0) {
+				errn = writeUnsignedIntElement(stream, (uint32_t)EXI_OPTION_VALUE_PARTITION_CAPACITY);
+			}
+		}
+		/* END_ELEMENT of uncommon and lesscommon */
+		if (errn == 0) {
+			errn = writeSequence(stream, 5, 1, &uncommon, 5);
+		}
+		if (errn == 0) {
+			errn = writeSequence(stream, 3, 0, &lesscommon, 3);
+		}
+	}
+	if (errn == 0 && EXI_OPTION_STRICT) {
+		/* header: SE(strict), empty content */
+		errn = writeSequence(stream, 3, 0, &header, 2);
+	}
+	if (errn == 0) {
+		/* END_ELEMENT of header */
+		errn = writeSequence(stream, 3, 0, &header, 3);
+	}
+	if (errn == 0 && EXI_STREAM_ALIGNMENT(stream) == BYTE_ALIGNMENT) {
+		errn = flush(stream);
+	}
+	return errn;
+}
+
+/* internal method to write the header with the options of the stream */
+static int writeHeader(bitstream_t* stream) {
+	int errn;
+	if (hasUncommonOptions(stream) || EXI_OPTION_STRICT) {
+		/* Distinguishing Bits 10, Presence Bit for EXI Options and version 1 */
+		errn = writeBits(stream, 8, 160);
+		if (errn == 0) {
+			errn = writeOptions(stream);
+		}
+	} else {
+		errn = writeBits(stream, 8, 128);
+	}
+	return errn;
+}
+
+int writeEXIHeader(bitstream_t* stream) {
+	/* init stream */
+	initStream(stream);
+
+	return writeHeader(stream);
+}
+
+#if EXI_STREAM == BYTE_ARRAY && ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+int writeEXIHeaderDigest(bitstream_t* stream, struct exi_sha256* digest) {
+	/* init stream, the header is part of the digest */
+	initStream(stream);
+	stream->digest = digest;
 
-	return writeBits(stream, 8, 128);
+	return writeHeader(stream);
 }
+#endif /* ENCODER_DIGEST_SHA256 */
 
 
 #endif
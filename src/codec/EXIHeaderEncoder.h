@@ -48,12 +48,29 @@ extern "C" {
 /**
  * \brief 		Writes EXI header
  *
+ *				With the options of the stream alignment, EXI_OPTION_STRICT and
+ *				for a value string table valueMaxLength and a bounded
+ *				valuePartitionCapacity, no options with the defaults.
+ *
  * \param       stream   		Output Stream
  * \return                  	Error-Code <> 0
  *
  */
 int writeEXIHeader(bitstream_t* stream);
 
+
+#if EXI_STREAM == BYTE_ARRAY && ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+/**
+ * \brief 		Writes EXI header and hashes the header and all further bytes
+ *
+ * \param       stream   		Output Stream, .data may be NULL to only hash the bytes
+ * \param       digest   		Started SHA-256 context (see Sha256.h)
+ * \return                  	Error-Code <> 0
+ *
+ */
+int writeEXIHeaderDigest(bitstream_t* stream, struct exi_sha256* digest);
+#endif /* ENCODER_DIGEST_SHA256 */
+
 #ifdef __cplusplus
 }
 #endif
@@ -47,12 +47,20 @@ extern "C" {
 #define BIT_PACKED 1
 /** EXI alignment - Option byte-packed */
 #define BYTE_ALIGNMENT  2
+/** EXI alignment - Option of each stream, bitstream_t.alignment is BIT_PACKED or BYTE_ALIGNMENT */
+#define ALIGNMENT_PER_STREAM 3
 /** EXI alignment */
 /**
  * \brief 		EXI Option 'alignment'
  *
  *				The alignment option is used to control the alignment of event codes and content items.
  *				Default Value: bit-packed
+ *
+ *				Byte-aligned streams carry the alignment in the options of their
+ *				EXI header. With ALIGNMENT_PER_STREAM readEXIHeader() sets
+ *				bitstream_t.alignment from the header and writeEXIHeader() writes
+ *				the options of a stream with .alignment BYTE_ALIGNMENT, one build
+ *				can then use both. A fixed alignment costs no runtime checks.
  */
 #define EXI_OPTION_ALIGNMENT BIT_PACKED
 
@@ -63,6 +71,10 @@ extern "C" {
  *
  *				Strict interpretation of schemas is used to achieve better compactness.
  *				Default Value: false
+ *
+ *				The generated grammars are not strict, readEXIHeader() rejects
+ *				streams with other strict options and writeEXIHeader() writes it
+ *				if it is set.
  */
 #define EXI_OPTION_STRICT 0
 
@@ -73,6 +85,9 @@ extern "C" {
  *				Specifies the maximum string length of value content items to be
  *				considered for addition to the string table.
  *				Default Value: unbounded (-1)
+ *
+ *				Decoders take it from the stream header, encoders with a value
+ *				string table write it to the header.
  */
 #define EXI_OPTION_VALUE_MAX_LENGTH -1
 
@@ -82,8 +97,16 @@ extern "C" {
  *
  *				Specifies the total capacity of value partitions in a string table.
  *				Default Value: unbounded (-1)
+ *
+ *				0 rejects string table hits and adds no values. Otherwise the
+ *				codecs decode and encode hits with the exi_value_table_t of
+ *				bitstream_t.valueTable (StringTable.h), a stream without table
+ *				behaves as with 0. The decoders use the capacity of the stream
+ *				header, the encoders write a bounded capacity to the header.
  */
+#ifndef EXI_OPTION_VALUE_PARTITION_CAPACITY
 #define EXI_OPTION_VALUE_PARTITION_CAPACITY 0
+#endif
 
 
 #ifdef __cplusplus
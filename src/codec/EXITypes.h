@@ -45,6 +45,7 @@ extern "C" {
 #include <stdint.h>
 #include <stdio.h>
 #include "EXIConfig.h"
+#include "EXIOptions.h"
 #if EXI_STREAM == FILE_STREAM
 #include <stdio.h>
 #endif
@@ -129,6 +130,9 @@ typedef enum {
  *
  *	Structure for byteArray/file stream.
  *
+ *	init_bitstream() and initFileStream() (ByteStream.h) set up a stream and clear
+ *	the members below which are not given, a local variable holds garbage in them.
+ *
  *	# General
  *	.size defines the maximum size of the byte array (see .data)
  *
@@ -154,7 +158,35 @@ typedef enum {
  *	 and has to be set to 8, which means there are still 8 bits left to fill up
  *	 the current byte buffer before writing the final byte to the output stream/data-array.
  *
+ *	 With BIT_WRITER_WORD the bits are staged in .word instead and .capacity counts
+ *	 the free bits of this 64 bit word (.word = 0 and .capacity = 64 initially).
+ *	 Staged bits reach the output data-array only when the word is full or on flush.
+ *	 writeEXIHeader() takes care of this initialization.
+ *
+ *	 With ENCODER_DIGEST_SHA256 every byte written also updates .digest unless it is NULL.
+ *	 A digest stream may have .data = NULL to only count the bytes in .pos.
+ *
+ *	 With DATABINDING_SLIM the decoders allocate the out-of-line values from .arena,
+ *	 with DYNAMIC_ALLOCATION decodeString()/decodeBinary() their containers.
+ *
+ *	 With EXI_OPTION_VALUE_PARTITION_CAPACITY != 0 the generated codecs keep string values
+ *	 in .valueTable (StringTable.h) or reject string table hits if it is NULL.
+ *	 readEXIHeader() and writeEXIHeader() empty the table and set the options of the header.
+ *
+ *	 With EXI_OPTION_ALIGNMENT ALIGNMENT_PER_STREAM .alignment is BIT_PACKED or BYTE_ALIGNMENT,
+ *	 readEXIHeader() sets it from the header options. Encoder streams have to set it
+ *	 before writeEXIHeader().
+ *
  */
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+struct exi_sha256;
+#endif
+#if DATABINDING == DATABINDING_SLIM || MEMORY_ALLOCATION == DYNAMIC_ALLOCATION
+struct exi_arena;
+#endif
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+struct exi_value_table;
+#endif
 typedef struct {
 #if EXI_STREAM == BYTE_ARRAY
 	/**	byte array size */
@@ -163,17 +195,52 @@ typedef struct {
 	uint8_t* data;
 	/**	byte array next position in array */
 	size_t* pos;
+#if BIT_WRITER == BIT_WRITER_WORD
+	/** Staged output bits (right-aligned) */
+	uint64_t word;
+#endif
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+	/** Digest updated with the written bytes, NULL for none (reset by writeEXIHeader) */
+	struct exi_sha256* digest;
+#endif
 #endif
 #if EXI_STREAM == FILE_STREAM
 	/** file pointer */
 	FILE *file;
+	/** Staging buffer of the file, NULL for a getc/putc per byte (see initFileStream) */
+	uint8_t* fileBuffer;
+	/** staging buffer size */
+	size_t fileBufferSize;
+	/** next byte of the staging buffer to read or write */
+	size_t fileBufferPos;
+	/** number of bytes read into the staging buffer (input only) */
+	size_t fileBufferLength;
 #endif
 	/** Current byte buffer*/
 	uint8_t buffer;
 	/** Remaining bit capacity in current byte buffer*/
 	uint8_t capacity;
+#if DATABINDING == DATABINDING_SLIM || MEMORY_ALLOCATION == DYNAMIC_ALLOCATION
+	/** Memory for the out-of-line values of decoded documents */
+	struct exi_arena* arena;
+#endif
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+	/** Value partitions of the string table, NULL for none */
+	struct exi_value_table* valueTable;
+#endif
+#if EXI_OPTION_ALIGNMENT == ALIGNMENT_PER_STREAM
+	/** EXI alignment of the stream (BIT_PACKED, BYTE_ALIGNMENT) */
+	uint8_t alignment;
+#endif
 } bitstream_t;
 
+/** Alignment of event codes and content items of a stream */
+#if EXI_OPTION_ALIGNMENT == ALIGNMENT_PER_STREAM
+#define EXI_STREAM_ALIGNMENT(stream) ((stream)->alignment)
+#else
+#define EXI_STREAM_ALIGNMENT(stream) EXI_OPTION_ALIGNMENT
+#endif /* ALIGNMENT_PER_STREAM */
+
 
 /** \brief EXI Value Datatypes */
 typedef enum {
@@ -263,13 +330,16 @@ typedef enum {
 } exi_string_value_type_t;
 
 /** \brief EXI string character */
-/* Note: define whether you wan't to support ASCII only or UCS */
+/* Note: define whether you wan't to support ASCII only, UCS or UTF-8 */
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_ASCII
 typedef char exi_string_character_t;
 #endif /* STRING_REPRESENTATION_ASCII */
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS
 typedef uint32_t exi_string_character_t;
 #endif /* STRING_REPRESENTATION_UCS */
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+typedef uint8_t exi_string_character_t;
+#endif /* STRING_REPRESENTATION_UTF8 */
 
 
 
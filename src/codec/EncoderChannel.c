@@ -35,6 +35,7 @@
 #include "EXITypes.h"
 #include "ErrorCodes.h"
 #include "MethodsBag.h"
+#include "StringTable.h"
 /*#include "v2gEXICoder.h"*/
 
 #ifndef ENCODER_CHANNEL_C
@@ -447,21 +448,78 @@ int encodeString(bitstream_t* stream, exi_string_t* string) {
 	return errn;
 }
 
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+/* internal method to read the UTF-8 code point at chars[*j] */
+static int getCharacterUTF8(const exi_string_character_t* chars, size_t* j, uint32_t* cp) {
+	uint32_t c = chars[(*j)++];
+	size_t n;
+
+	if (c < 0x80) {
+		n = 0;
+	} else if ((c & 0xE0) == 0xC0) {
+		c = c & 0x1F;
+		n = 1;
+	} else if ((c & 0xF0) == 0xE0) {
+		c = c & 0x0F;
+		n = 2;
+	} else if ((c & 0xF8) == 0xF0) {
+		c = c & 0x07;
+		n = 3;
+	} else {
+		return EXI_ERROR_STRINGVALUES_CHARACTER;
+	}
+	for (; n > 0; n--) {
+		/* continuation bytes 10xxxxxx, stops at the null terminator */
+		if ((chars[(*j)] & 0xC0) != 0x80) {
+			return EXI_ERROR_STRINGVALUES_CHARACTER;
+		}
+		c = (c << 6) | (chars[(*j)++] & 0x3F);
+	}
+	if (c > 0x10FFFF) {
+		return EXI_ERROR_STRINGVALUES_CHARACTER;
+	}
+	*cp = c;
+	return 0;
+}
+#endif /* STRING_REPRESENTATION_UTF8 */
+
 /**
  * Encode a sequence of characters according to a given length.
  * Each character is represented by its UCS [ISO/IEC 10646]
  * code point encoded as an Unsigned Integer
  */
 int encodeCharacters(bitstream_t* stream, exi_string_character_t* chars, size_t len) {
-	unsigned int i;
+	unsigned int i = 0;
 	int errn = 0;
-	for (i = 0; i < len && errn == 0; i++) {
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS || STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+	size_t j = 0; /* unit of character i */
+#endif /* STRING_REPRESENTATION_UCS || STRING_REPRESENTATION_UTF8 */
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+	uint32_t cp;
+#endif /* STRING_REPRESENTATION_UTF8 */
+	while (i < len && errn == 0) {
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS || STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+		if ( (i + 4) <= len && (chars[j] | chars[j + 1] | chars[j + 2] | chars[j + 3]) < 128 ) {
+			/* code points < 128 are single octets, write four at a time */
+			errn = writeBits(stream, 32, ((uint32_t)chars[j] << 24) | ((uint32_t)chars[j + 1] << 16) | ((uint32_t)chars[j + 2] << 8) | chars[j + 3]);
+			i += 4;
+			j += 4;
+			continue;
+		}
+#endif /* STRING_REPRESENTATION_UCS || STRING_REPRESENTATION_UTF8 */
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_ASCII
 		errn = encode(stream, (uint8_t)chars[i]);
 #endif /* STRING_REPRESENTATION_ASCII */
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS
-		errn = encodeUnsignedInteger32(stream, chars[i]);
+		errn = encodeUnsignedInteger32(stream, chars[j++]);
 #endif /* STRING_REPRESENTATION_UCS */
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+		errn = getCharacterUTF8(chars, &j, &cp);
+		if (errn == 0) {
+			errn = encodeUnsignedInteger32(stream, cp);
+		}
+#endif /* STRING_REPRESENTATION_UTF8 */
+		i++;
 	}
 	return errn;
 }
@@ -472,12 +530,26 @@ int encodeRCSCharacters(bitstream_t* stream, exi_string_character_t* chars, size
 	unsigned int k;
 	int errn = 0;
 	size_t rcsCode = SIZE_MAX;
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+	size_t j = 0; /* unit of character i */
+	uint32_t cp = 0;
+#endif /* STRING_REPRESENTATION_UTF8 */
 
 	for (i = 0; i < len && errn == 0; i++) {
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+		errn = getCharacterUTF8(chars, &j, &cp);
+		if (errn != 0) {
+			break;
+		}
+#endif /* STRING_REPRESENTATION_UTF8 */
 		/* try to find short code */
 		rcsCode = SIZE_MAX;
 		for(k=0; k<rcsSize && rcsCode == SIZE_MAX; k++) {
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+			if(rcsSet[k] == cp) {
+#else
 			if(rcsSet[k] == chars[i]) {
+#endif /* STRING_REPRESENTATION_UTF8 */
 				rcsCode = k;
 			}
 		}
@@ -491,6 +563,9 @@ int encodeRCSCharacters(bitstream_t* stream, exi_string_character_t* chars, size
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS
 			errn = encodeUnsignedInteger32(stream, chars[i]);
 #endif /* STRING_REPRESENTATION_UCS */
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+			errn = encodeUnsignedInteger32(stream, cp);
+#endif /* STRING_REPRESENTATION_UTF8 */
 
 		} else {
 			/* RCS match */
@@ -500,6 +575,50 @@ int encodeRCSCharacters(bitstream_t* stream, exi_string_character_t* chars, size
 	return errn;
 }
 
+
+int encodeStringValueCharacters(bitstream_t* stream, uint16_t qnameID, exi_string_character_t* chars, size_t len) {
+	int errn;
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+	exi_string_value_type_t type = EXI_STRING_VALUE_MISS;
+	size_t id = 0;
+	size_t n, codingLength;
+
+	if (stream->valueTable != NULL) {
+		exiValueTableFind(stream->valueTable, qnameID, chars, len, &type, &id);
+	}
+	if (type != EXI_STRING_VALUE_MISS) {
+		if (type == EXI_STRING_VALUE_LOCAL_HIT) {
+			/* local value partition hit, length 0 */
+			errn = encodeUnsignedInteger16(stream, 0);
+			n = stream->valueTable->numberOfLocalValues[qnameID];
+		} else {
+			/* global value partition hit, length 1 */
+			errn = encodeUnsignedInteger16(stream, 1);
+			n = stream->valueTable->numberOfValues;
+		}
+		if (errn == 0) {
+			errn = exiGetCodingLength(n, &codingLength);
+		}
+		if (errn == 0) {
+			errn = encodeNBitUnsignedInteger(stream, codingLength, (uint32_t)id);
+		}
+		return errn;
+	}
+#endif /* EXI_OPTION_VALUE_PARTITION_CAPACITY != 0 */
+
+	/* encode string as string table miss (+2 len) */
+	errn = encodeUnsignedInteger16(stream, (uint16_t)(len + 2));
+	if (errn == 0) {
+		errn = encodeCharacters(stream, chars, len);
+	}
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+	if (errn == 0 && stream->valueTable != NULL) {
+		errn = exiValueTableAdd(stream->valueTable, qnameID, chars, len);
+	}
+#endif /* EXI_OPTION_VALUE_PARTITION_CAPACITY != 0 */
+	return errn;
+}
+
 /**
  * Encode a binary value as a length-prefixed sequence of octets.
  */
@@ -595,25 +714,9 @@ int encodeDateTime(bitstream_t* stream, exi_datetime_t* datetime) {
 
 
 int encode(bitstream_t* stream, uint8_t b) {
-#if EXI_OPTION_ALIGNMENT == BIT_PACKED
+	/* byte-aligned streams start after the header at a byte boundary,
+	 * the octet goes out in one piece with both alignments */
 	return writeBits(stream, 8, b);
-#endif /* EXI_OPTION_ALIGNMENT == BIT_PACKED */
-#if EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT
-	int errn = 0;
-#if EXI_STREAM == BYTE_ARRAY
-	if ( (*stream->pos) < stream->size ) {
-		stream->data[(*stream->pos)++] = b;
-	} else {
-		errn = EXI_ERROR_OUTPUT_STREAM_EOF;
-	}
-#endif /* EXI_STREAM == BYTE_ARRAY */
-#if EXI_STREAM == FILE_STREAM
-	if ( putc(b, stream->file) == EOF ) {
-		errn = EXI_ERROR_OUTPUT_STREAM_EOF;
-	}
-#endif /* EXI_STREAM == FILE_STREAM */
-	return errn;
-#endif /* EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT */
 }
 
 /**
@@ -621,14 +724,11 @@ int encode(bitstream_t* stream, uint8_t b) {
  * value is encode as bit 1.
  */
 int encodeBoolean(bitstream_t* stream, int b) {
-#if EXI_OPTION_ALIGNMENT == BIT_PACKED
 	uint8_t val = b ? 1 : 0;
+	if (EXI_STREAM_ALIGNMENT(stream) == BYTE_ALIGNMENT) {
+		return encode(stream, val);
+	}
 	return writeBits(stream, 1, val);
-#endif /* EXI_OPTION_ALIGNMENT == BIT_PACKED */
-#if EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT
-	uint8_t val = b ? 1 : 0;
-	return encode(stream, val);
-#endif /* EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT */
 }
 
 
@@ -637,66 +737,32 @@ int encodeBoolean(bitstream_t* stream, int b) {
  * b starting with the most significant, i.e. from left to right.
  */
 int encodeNBitUnsignedInteger(bitstream_t* stream, size_t nbits, uint32_t val)  {
-#if EXI_OPTION_ALIGNMENT == BIT_PACKED
-	int errn = 0;
-	if (nbits > 0) {
-		errn = writeBits(stream, nbits, val);
-	}
-	return errn;
-#endif /* EXI_OPTION_ALIGNMENT == BIT_PACKED */
-#if EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT
 	int errn = 0;
-	if (nbits > 0) {
-		if (nbits < 9) {
-			/* 1 byte */
-			errn = encode(stream, val & 0xff);
-		} else if (nbits < 17) {
-			/* 2 bytes */
-			errn = encode(stream, val & 0x00ff);
-			if(errn == 0) {
-				errn = encode(stream, (uint8_t)((val & 0xff00) >> 8));
-			}
-		} else if (nbits < 25) {
-			/* 3 bytes */
-			errn = encode(stream, val & 0x0000ff);
-			if(errn == 0) {
-				errn = encode(stream, (uint8_t)((val & 0x00ff00) >> 8));
-				if(errn == 0) {
-					errn = encode(stream, (uint8_t)((val & 0xff0000) >> 16));
-				}
-			}
-		} else if (nbits < 33) {
-			/* 4 bytes */
-			errn = encode(stream, val & 0x000000ff);
-			if(errn == 0) {
-				errn = encode(stream, (uint8_t)((val & 0x0000ff00) >> 8));
-				if(errn == 0) {
-					errn = encode(stream, (uint8_t)((val & 0x00ff0000) >> 16));
-					if(errn == 0) {
-						errn = encode(stream, (uint8_t)((val & 0xff000000) >> 24));
-					}
-				}
-			}
-		} else {
+	size_t bitsWritten = 0;
+	if (nbits == 0) {
+		/* nothing to write */
+	} else if (EXI_STREAM_ALIGNMENT(stream) == BYTE_ALIGNMENT) {
+		if (nbits > 32) {
 			/* TODO Currently not more than 4 Bytes allowed for NBitUnsignedInteger */
 			errn = EXI_UNSUPPORTED_NBIT_INTEGER_LENGTH;
 		}
+		/* minimum number of bytes, least significant byte first */
+		while (errn == 0 && bitsWritten < nbits) {
+			errn = encode(stream, (uint8_t)(val >> bitsWritten));
+			bitsWritten = (bitsWritten + 8);
+		}
+	} else {
+		errn = writeBits(stream, nbits, val);
 	}
 	return errn;
-#endif /* EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT */
 }
 
 /**
  * Flush underlying output stream.
  */
 int encodeFinish(bitstream_t* stream) {
-#if EXI_OPTION_ALIGNMENT == BIT_PACKED
-#endif /* EXI_OPTION_ALIGNMENT == BIT_PACKED */
+	/* pending bits, with BIT_WRITER_WORD also the staged bytes of byte-aligned streams */
 	return flush(stream);
-#if EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT
-	/* no pending bits in byte-aligned mode */
-	return 0;
-#endif /* EXI_OPTION_ALIGNMENT == BYTE_ALIGNMENT */
 }
 
 
@@ -366,6 +366,24 @@ int encodeCharacters(bitstream_t* stream, exi_string_character_t* chars, size_t
 int encodeRCSCharacters(bitstream_t* stream, exi_string_character_t* chars, size_t len, size_t rcsCodeLength, size_t rcsSize, const exi_string_character_t rcsSet[]);
 
 
+/**
+ * \brief 		Encode characters in the sense of string tables
+ *
+ * 				Encodes a local or global value partition hit of
+ * 				stream->valueTable (see StringTable.h), otherwise the length
+ * 				incremented by two and the characters, and adds them to the
+ * 				table. Without value partitions it is always a miss.
+ *
+ * \param       stream   		Output Stream
+ * \param       qnameID   		Local partition, numbered by the codec
+ * \param       chars   		Characters
+ * \param       len		   		Number of code-points
+ * \return                  	Error-Code <> 0
+ *
+ */
+int encodeStringValueCharacters(bitstream_t* stream, uint16_t qnameID, exi_string_character_t* chars, size_t len);
+
+
 
 /**
  * \brief 		Encode binary
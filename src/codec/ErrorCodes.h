@@ -54,6 +54,7 @@ extern "C" {
 #define EXI_ERROR_OUT_OF_GRAMMAR_STACK -104
 #define EXI_ERROR_OUT_OF_RUNTIME_GRAMMAR_STACK -105
 #define EXI_ERROR_OUT_OF_QNAMES -106
+#define EXI_ERROR_OUT_OF_ARENA_MEMORY -107
 
 #define EXI_ERROR_UNKOWN_GRAMMAR_ID -108
 #define EXI_ERROR_UNKOWN_EVENT -109
@@ -0,0 +1,186 @@
+/*******************************************************************
+ * Table driven grammar decoder: one interpreter loop for the state
+ * tables of the generated decode_*Type functions.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+#include "GrammarDecoder.h"
+#include "DecoderChannel.h"
+#include "EXIConfig.h"
+#include "ErrorCodes.h"
+
+#ifndef GRAMMAR_DECODER_C
+#define GRAMMAR_DECODER_C
+
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+
+/* internal method to decode the value of an attribute or simple element */
+static int decodeValue(bitstream_t* stream, const exi_grammar_production_t* p, uint8_t* element) {
+	int errn;
+	uint32_t uint32;
+	uint8_t* field = element + p->offset;
+	uint16_t* len;
+
+	switch(p->valueType) {
+	case EXI_GRAMMAR_VALUE_NBIT:
+		errn = decodeNBitUnsignedInteger(stream, p->codingLength, &uint32);
+		if (errn == 0) {
+			uint32 = (uint32_t)((int32_t)uint32 + p->valueOffset);
+			if (p->valueSize == 1) {
+				*field = (uint8_t)uint32;
+			} else if (p->valueSize == 2) {
+				*(uint16_t*)field = (uint16_t)uint32;
+			} else {
+				*(uint32_t*)field = uint32;
+			}
+		}
+		break;
+	case EXI_GRAMMAR_VALUE_BOOLEAN:
+		errn = decodeBoolean(stream, (int*)field);
+		break;
+	case EXI_GRAMMAR_VALUE_INTEGER16:
+		errn = decodeInteger16(stream, (int16_t*)field);
+		break;
+	case EXI_GRAMMAR_VALUE_INTEGER32:
+		errn = decodeInteger32(stream, (int32_t*)field);
+		break;
+	case EXI_GRAMMAR_VALUE_INTEGER64:
+		errn = decodeInteger64(stream, (int64_t*)field);
+		break;
+	case EXI_GRAMMAR_VALUE_UNSIGNED16:
+		errn = decodeUnsignedInteger16(stream, (uint16_t*)field);
+		break;
+	case EXI_GRAMMAR_VALUE_UNSIGNED32:
+		errn = decodeUnsignedInteger32(stream, (uint32_t*)field);
+		break;
+	case EXI_GRAMMAR_VALUE_UNSIGNED64:
+		errn = decodeUnsignedInteger64(stream, (uint64_t*)field);
+		break;
+	case EXI_GRAMMAR_VALUE_STRING:
+		len = (uint16_t*)(element + p->lengthOffset);
+		errn = decodeUnsignedInteger16(stream, len);
+		if (errn == 0) {
+			if (*len >= 2) {
+				*len = (uint16_t)(*len - 2); /* string table miss */
+				errn = decodeCharacters(stream, *len, (exi_string_character_t*)field, p->size);
+				if (errn == 0) {
+					errn = addStringValue(stream, p->qnameID, (exi_string_character_t*)field, *len);
+				}
+			} else {
+				/* string table hit */
+				errn = decodeStringValueHit(stream, p->qnameID, len, (exi_string_character_t*)field, p->size);
+			}
+		}
+		break;
+	case EXI_GRAMMAR_VALUE_BYTES:
+		len = (uint16_t*)(element + p->lengthOffset);
+		errn = decodeUnsignedInteger16(stream, len);
+		if (errn == 0) {
+			errn = (*len) <= p->size ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
+		}
+		if (errn == 0) {
+			errn = decodeBytes(stream, *len, field);
+		}
+		break;
+	default:
+		errn = EXI_ERROR_UNKOWN_EVENT;
+		break;
+	}
+
+	return errn;
+}
+
+/* internal method to decode one production, the same steps as the generated switch code */
+static int decodeProduction(bitstream_t* stream, const exi_grammar_t* grammar, const exi_grammar_production_t* p, uint8_t* value, int* done) {
+	int errn = 0;
+	uint32_t eventCode;
+	uint16_t* arrayLen = NULL;
+	uint8_t* element = value;
+
+	if (p->kind == EXI_GRAMMAR_END_ELEMENT) {
+		*done = 1;
+		return 0;
+	}
+	if (p->kind == EXI_GRAMMAR_ERROR) {
+		return p->error;
+	}
+
+	if (p->arraySize > 0) {
+		arrayLen = (uint16_t*)(value + p->arrayLenOffset);
+		if (*arrayLen >= p->arraySize) {
+			return EXI_ERROR_OUT_OF_BOUNDS;
+		}
+		element = value + p->arrayOffset + (*arrayLen) * p->elementSize;
+	}
+
+	if (p->kind == EXI_GRAMMAR_COMPLEX) {
+		if (arrayLen != NULL) {
+			(*arrayLen)++;
+		}
+		errn = p->decode(stream, element + p->offset);
+		if (p->flag != EXI_GRAMMAR_NO_FLAG) {
+			grammar->used(value, p->flag);
+		}
+		return errn;
+	}
+
+	if (p->kind == EXI_GRAMMAR_ELEMENT) {
+		/* FirstStartTag[CHARACTERS[...]] */
+		errn = decodeNBitUnsignedInteger(stream, 1, &eventCode);
+		if (errn == 0 && eventCode != 0) {
+			/* Second level event (e.g., xsi:type, xsi:nil, ...) */
+			errn = EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS;
+		}
+	}
+	if (errn == 0) {
+		errn = decodeValue(stream, p, element);
+		if (arrayLen != NULL) {
+			(*arrayLen)++;
+		}
+		if (p->flag != EXI_GRAMMAR_NO_FLAG) {
+			grammar->used(value, p->flag);
+		}
+	}
+	if (errn == 0 && p->kind == EXI_GRAMMAR_ELEMENT) {
+		/* valid EE for simple element */
+		errn = decodeNBitUnsignedInteger(stream, 1, &eventCode);
+		if (errn == 0 && eventCode != 0) {
+			errn = EXI_DEVIANT_SUPPORT_NOT_DEPLOYED; /* or also typecast and nillable */
+		}
+	}
+
+	return errn;
+}
+
+int decodeGrammar(bitstream_t* stream, const exi_grammar_t* grammar, void* value) {
+	const exi_grammar_state_t* state = grammar->states;
+	const exi_grammar_transition_t* transition;
+	uint32_t eventCode;
+	int errn = 0;
+	int done = 0;
+
+	while(!done) {
+		errn = decodeNBitUnsignedInteger(stream, state->codingLength, &eventCode);
+		if (errn == 0) {
+			if (eventCode < state->eventCount) {
+				transition = &grammar->transitions[state->firstTransition + eventCode];
+				errn = decodeProduction(stream, grammar, &grammar->productions[transition->production], (uint8_t*)value, &done);
+				state = &grammar->states[transition->next];
+			} else {
+				errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+			}
+		}
+		if(errn) {
+			done = 1;
+		}
+	}
+
+	return errn;
+}
+
+#endif /* GRAMMAR_DECODER_TABLE */
+
+#endif
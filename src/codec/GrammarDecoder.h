@@ -0,0 +1,128 @@
+/*******************************************************************
+ * Table driven grammar decoder: one interpreter loop for the state
+ * tables of the generated decode_*Type functions.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+/**
+* \file 	GrammarDecoder.h
+* \brief 	Interpreter for the grammar tables of the schema decoders (GRAMMAR_DECODER_TABLE)
+*
+*/
+
+#ifndef GRAMMAR_DECODER_H
+#define GRAMMAR_DECODER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include "EXITypes.h"
+
+/** Production: END_ELEMENT of the type, decoding is done */
+#define EXI_GRAMMAR_END_ELEMENT 0
+/** Production: attribute value (no END_ELEMENT) */
+#define EXI_GRAMMAR_ATTRIBUTE 1
+/** Production: element with simple content (characters event, value and END_ELEMENT) */
+#define EXI_GRAMMAR_ELEMENT 2
+/** Production: element with complex content, decoded by .decode */
+#define EXI_GRAMMAR_COMPLEX 3
+/** Production: event which is not supported, .error is returned */
+#define EXI_GRAMMAR_ERROR 4
+
+/** Value: n-bit unsigned integer plus .valueOffset, stored with .valueSize bytes (enumerations, restricted ranges) */
+#define EXI_GRAMMAR_VALUE_NBIT 0
+#define EXI_GRAMMAR_VALUE_BOOLEAN 1
+#define EXI_GRAMMAR_VALUE_INTEGER16 2
+#define EXI_GRAMMAR_VALUE_INTEGER32 3
+#define EXI_GRAMMAR_VALUE_INTEGER64 4
+#define EXI_GRAMMAR_VALUE_UNSIGNED16 5
+#define EXI_GRAMMAR_VALUE_UNSIGNED32 6
+#define EXI_GRAMMAR_VALUE_UNSIGNED64 7
+/** Value: string (table miss), .lengthOffset is the charactersLen */
+#define EXI_GRAMMAR_VALUE_STRING 8
+/** Value: binary, .lengthOffset is the bytesLen */
+#define EXI_GRAMMAR_VALUE_BYTES 9
+
+/** No _isUsed flag for the production */
+#define EXI_GRAMMAR_NO_FLAG 0xFF
+
+/** Decoder of a complex type */
+typedef int (*exi_grammar_decoder_t)(bitstream_t* stream, void* value);
+
+/** Sets the _isUsed flag with the given number (bit fields have no offset) */
+typedef void (*exi_grammar_used_t)(void* value, uint8_t flag);
+
+/** \brief What an event decodes, shared by all states with the same event */
+typedef struct {
+	uint8_t kind;
+	uint8_t valueType;
+	/** n-bit values: number of bits and size of the field */
+	uint8_t codingLength;
+	uint8_t valueSize;
+	/** n-bit values: added to the decoded value */
+	int32_t valueOffset;
+	/** number of the _isUsed flag, or EXI_GRAMMAR_NO_FLAG */
+	uint8_t flag;
+	/** error code of EXI_GRAMMAR_ERROR */
+	int error;
+	/** arrays: capacity (0 = no array), offsets of .array and .arrayLen and size of an array element */
+	size_t arraySize;
+	size_t arrayOffset;
+	size_t arrayLenOffset;
+	size_t elementSize;
+	/** offset of the value, relative to the array element for arrays */
+	size_t offset;
+	/** strings and binaries: offset of the length and capacity */
+	size_t lengthOffset;
+	size_t size;
+	/** strings: local value partition (tools/string_table.py) */
+	uint16_t qnameID;
+	/** complex content */
+	exi_grammar_decoder_t decode;
+} exi_grammar_production_t;
+
+/** \brief Event code of a state: production and next state */
+typedef struct {
+	uint16_t next;
+	uint16_t production;
+} exi_grammar_transition_t;
+
+/** \brief Grammar state, the event codes are .firstTransition to .firstTransition + .eventCount - 1 */
+typedef struct {
+	uint16_t firstTransition;
+	uint8_t codingLength;
+	uint8_t eventCount;
+} exi_grammar_state_t;
+
+/** \brief Grammar of one complex type, decoding starts with state 0 */
+typedef struct {
+	const exi_grammar_state_t* states;
+	const exi_grammar_transition_t* transitions;
+	const exi_grammar_production_t* productions;
+	exi_grammar_used_t used;
+} exi_grammar_t;
+
+
+/**
+ * \brief 		Decodes the content of a complex type with its grammar tables
+ *
+ * \param       stream   		Input Stream
+ * \param       grammar   		Grammar tables of the type
+ * \param       value   		Initialized struct of the type
+ * \return                  	Error-Code <> 0
+ *
+ */
+int decodeGrammar(bitstream_t* stream, const exi_grammar_t* grammar, void* value);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GRAMMAR_DECODER_H */
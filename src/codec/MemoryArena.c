@@ -0,0 +1,60 @@
+/*******************************************************************
+ * Bump allocator for the out-of-line values of decoded documents.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+#include <string.h>
+
+#include "MemoryArena.h"
+
+#ifndef MEMORY_ARENA_C
+#define MEMORY_ARENA_C
+
+void exiArenaInit(exi_arena_t* arena, uint8_t* data, size_t size) {
+	arena->data = data;
+	arena->size = size;
+	arena->pos = 0;
+}
+
+void exiArenaReset(exi_arena_t* arena) {
+	arena->pos = 0;
+}
+
+void* exiArenaAllocate(exi_arena_t* arena, size_t size) {
+	size_t pos;
+	void* p;
+
+	if (arena == NULL) {
+		return NULL;
+	}
+
+	/* align the address, the caller's buffer may start anywhere */
+	pos = arena->pos + ((EXI_ARENA_ALIGNMENT - ((uintptr_t)(arena->data + arena->pos) % EXI_ARENA_ALIGNMENT)) % EXI_ARENA_ALIGNMENT);
+	if (pos > arena->size || size > arena->size - pos) {
+		return NULL;
+	}
+
+	p = arena->data + pos;
+	arena->pos = pos + size;
+	return p;
+}
+
+void* exiArenaAllocateCleared(exi_arena_t* arena, size_t size) {
+	void* p = exiArenaAllocate(arena, size);
+
+	if (p != NULL) {
+		memset(p, 0, size);
+	}
+	return p;
+}
+
+void exiArenaFree(exi_arena_t* arena, void* p, size_t size) {
+	if (arena != NULL && p != NULL && (uint8_t*)p + size == arena->data + arena->pos) {
+		arena->pos = (size_t)((uint8_t*)p - arena->data);
+	}
+}
+
+#endif /* MEMORY_ARENA_C */
@@ -0,0 +1,115 @@
+/*******************************************************************
+ * Bump allocator for the out-of-line values of decoded documents.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+/**
+* \file 	MemoryArena.h
+* \brief 	Caller provided memory for the decoders (DATABINDING_SLIM, DYNAMIC_ALLOCATION)
+*
+*/
+
+#ifndef MEMORY_ARENA_H
+#define MEMORY_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "ErrorCodes.h"
+
+/** Alignment of every allocation in bytes */
+#define EXI_ARENA_ALIGNMENT 8
+
+/** \brief Arena, a caller provided buffer handed out front to back */
+typedef struct exi_arena {
+	/** buffer */
+	uint8_t* data;
+	/** buffer size */
+	size_t size;
+	/** first unused byte of the buffer */
+	size_t pos;
+} exi_arena_t;
+
+
+/**
+ * \brief 	Hands a buffer to the arena
+ *
+ * \param       arena		arena
+ * \param       data		buffer, owned by the caller
+ * \param       size		buffer size in bytes
+ *
+ */
+void exiArenaInit(exi_arena_t* arena, uint8_t* data, size_t size);
+
+
+/**
+ * \brief 	Releases all allocations at once
+ *
+ * 			Values of a document decoded into the arena are invalid afterwards.
+ *
+ * \param       arena		arena
+ *
+ */
+void exiArenaReset(exi_arena_t* arena);
+
+
+/**
+ * \brief 	Allocates aligned memory
+ *
+ * \param       arena		arena, may be NULL
+ * \param       size		bytes
+ * \return                  memory, NULL if the arena is exhausted (or NULL)
+ *
+ */
+void* exiArenaAllocate(exi_arena_t* arena, size_t size);
+
+
+/**
+ * \brief 	Allocates aligned memory filled with zeros
+ *
+ * 			For the values which an application sets before encoding
+ * 			(DATABINDING_SLIM), the init functions do not clear them.
+ *
+ * \param       arena		arena, may be NULL
+ * \param       size		bytes
+ * \return                  memory, NULL if the arena is exhausted (or NULL)
+ *
+ */
+void* exiArenaAllocateCleared(exi_arena_t* arena, size_t size);
+
+
+/**
+ * \brief 	Returns memory to the arena
+ *
+ * 			Only the last allocation can be returned, other memory stays
+ * 			allocated until exiArenaReset().
+ *
+ * \param       arena		arena, may be NULL
+ * \param       p			memory from exiArenaAllocate, may be NULL
+ * \param       size		bytes allocated at p
+ *
+ */
+void exiArenaFree(exi_arena_t* arena, void* p, size_t size);
+
+
+/**
+ * \brief 	Points ptr to count new elements of the arena of the stream
+ *
+ * 			Evaluates to 0 or EXI_ERROR_OUT_OF_ARENA_MEMORY.
+ */
+#define EXI_ARENA_ALLOCATE(stream, ptr, count) \
+	(((ptr) = exiArenaAllocate((stream)->arena, (size_t)(count) * sizeof(*(ptr)))) == NULL ? EXI_ERROR_OUT_OF_ARENA_MEMORY : 0)
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEMORY_ARENA_H */
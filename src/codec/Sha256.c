@@ -0,0 +1,138 @@
+/*******************************************************************
+ * SHA-256 (FIPS 180-4) for the digests of signed EXI fragments.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+#include "Sha256.h"
+
+#ifndef SHA256_C
+#define SHA256_C
+
+static const uint32_t sha256K[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define SHA256_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+/* internal method to hash one 64 byte block */
+static void sha256Block(exi_sha256_t* ctx, const uint8_t* p) {
+	uint32_t w[64];
+	uint32_t a, b, c, d, e, f, g, h, t1, t2;
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		w[i] = ((uint32_t)p[4 * i] << 24) | ((uint32_t)p[4 * i + 1] << 16)
+				| ((uint32_t)p[4 * i + 2] << 8) | (uint32_t)p[4 * i + 3];
+	}
+	for (i = 16; i < 64; i++) {
+		t1 = SHA256_ROTR(w[i - 2], 17) ^ SHA256_ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+		t2 = SHA256_ROTR(w[i - 15], 7) ^ SHA256_ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+		w[i] = t1 + w[i - 7] + t2 + w[i - 16];
+	}
+
+	a = ctx->state[0];
+	b = ctx->state[1];
+	c = ctx->state[2];
+	d = ctx->state[3];
+	e = ctx->state[4];
+	f = ctx->state[5];
+	g = ctx->state[6];
+	h = ctx->state[7];
+	for (i = 0; i < 64; i++) {
+		t1 = h + (SHA256_ROTR(e, 6) ^ SHA256_ROTR(e, 11) ^ SHA256_ROTR(e, 25))
+				+ ((e & f) ^ (~e & g)) + sha256K[i] + w[i];
+		t2 = (SHA256_ROTR(a, 2) ^ SHA256_ROTR(a, 13) ^ SHA256_ROTR(a, 22))
+				+ ((a & b) ^ (a & c) ^ (b & c));
+		h = g;
+		g = f;
+		f = e;
+		e = d + t1;
+		d = c;
+		c = b;
+		b = a;
+		a = t1 + t2;
+	}
+	ctx->state[0] += a;
+	ctx->state[1] += b;
+	ctx->state[2] += c;
+	ctx->state[3] += d;
+	ctx->state[4] += e;
+	ctx->state[5] += f;
+	ctx->state[6] += g;
+	ctx->state[7] += h;
+}
+
+void exiSha256Init(exi_sha256_t* ctx) {
+	ctx->state[0] = 0x6a09e667;
+	ctx->state[1] = 0xbb67ae85;
+	ctx->state[2] = 0x3c6ef372;
+	ctx->state[3] = 0xa54ff53a;
+	ctx->state[4] = 0x510e527f;
+	ctx->state[5] = 0x9b05688c;
+	ctx->state[6] = 0x1f83d9ab;
+	ctx->state[7] = 0x5be0cd19;
+	ctx->length = 0;
+	ctx->blockLen = 0;
+}
+
+void exiSha256Update(exi_sha256_t* ctx, const uint8_t* data, size_t len) {
+	size_t i = 0;
+
+	ctx->length += len;
+	/* complete a pending block */
+	while (ctx->blockLen > 0 && i < len) {
+		ctx->block[ctx->blockLen++] = data[i++];
+		if (ctx->blockLen == 64) {
+			sha256Block(ctx, ctx->block);
+			ctx->blockLen = 0;
+		}
+	}
+	/* whole blocks straight from the data */
+	while (len - i >= 64) {
+		sha256Block(ctx, &data[i]);
+		i += 64;
+	}
+	while (i < len) {
+		ctx->block[ctx->blockLen++] = data[i++];
+	}
+}
+
+void exiSha256Final(exi_sha256_t* ctx, uint8_t* digest) {
+	uint64_t bits = ctx->length * 8;
+	int i;
+
+	ctx->block[ctx->blockLen++] = 0x80;
+	if (ctx->blockLen > 56) {
+		while (ctx->blockLen < 64) {
+			ctx->block[ctx->blockLen++] = 0;
+		}
+		sha256Block(ctx, ctx->block);
+		ctx->blockLen = 0;
+	}
+	while (ctx->blockLen < 56) {
+		ctx->block[ctx->blockLen++] = 0;
+	}
+	for (i = 0; i < 8; i++) {
+		ctx->block[56 + i] = (uint8_t)(bits >> (56 - 8 * i));
+	}
+	sha256Block(ctx, ctx->block);
+
+	for (i = 0; i < 8; i++) {
+		digest[4 * i] = (uint8_t)(ctx->state[i] >> 24);
+		digest[4 * i + 1] = (uint8_t)(ctx->state[i] >> 16);
+		digest[4 * i + 2] = (uint8_t)(ctx->state[i] >> 8);
+		digest[4 * i + 3] = (uint8_t)(ctx->state[i]);
+	}
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*******************************************************************
+ * SHA-256 (FIPS 180-4) for the digests of signed EXI fragments.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+/**
+* \file 	Sha256.h
+* \brief 	Incremental SHA-256, fed by the bit writer while encoding
+*
+*/
+
+#ifndef SHA256_H
+#define SHA256_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** Size of a SHA-256 digest in bytes */
+#define EXI_SHA256_DIGEST_SIZE 32
+
+/** \brief SHA-256 context */
+typedef struct exi_sha256 {
+	/** intermediate hash value */
+	uint32_t state[8];
+	/** number of bytes hashed so far */
+	uint64_t length;
+	/** pending bytes of the current 64 byte block */
+	uint8_t block[64];
+	/** number of pending bytes */
+	size_t blockLen;
+} exi_sha256_t;
+
+
+/**
+ * \brief 	Starts a new digest
+ *
+ * \param       ctx		SHA-256 context
+ *
+ */
+void exiSha256Init(exi_sha256_t* ctx);
+
+
+/**
+ * \brief 	Adds bytes to the digest
+ *
+ * \param       ctx		SHA-256 context
+ * \param       data	bytes
+ * \param       len		number of bytes
+ *
+ */
+void exiSha256Update(exi_sha256_t* ctx, const uint8_t* data, size_t len);
+
+
+/**
+ * \brief 	Finishes the digest
+ *
+ * \param       ctx		SHA-256 context, needs exiSha256Init before the next use
+ * \param       digest	EXI_SHA256_DIGEST_SIZE bytes
+ *
+ */
+void exiSha256Final(exi_sha256_t* ctx, uint8_t* digest);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHA256_H */
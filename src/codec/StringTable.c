@@ -0,0 +1,170 @@
+/*******************************************************************
+ * Value partitions of the EXI string table for the generated codecs.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+#include "StringTable.h"
+
+#ifndef STRING_TABLE_C
+#define STRING_TABLE_C
+
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+
+/* internal method, characters (UTF8: bytes) of len code-points */
+static size_t characterUnits(const exi_string_character_t* characters, size_t len) {
+#if STRING_REPRESENTATION == STRING_REPRESENTATION_UTF8
+	size_t j = 0;
+	uint8_t c;
+	while (len > 0) {
+		c = (uint8_t)characters[j];
+		j += c < 0xE0 ? (c < 0x80 ? 1 : 2) : (c < 0xF0 ? 3 : 4);
+		len--;
+	}
+	return j;
+#else
+	(void)characters;
+	return len;
+#endif
+}
+
+/* internal method, number of entries that keep a value */
+static size_t usedSlots(exi_value_table_t* table) {
+	return table->numberOfValues < EXI_VALUE_TABLE_SLOTS ? table->numberOfValues : EXI_VALUE_TABLE_SLOTS;
+}
+
+void exiValueTableReset(exi_value_table_t* table, int32_t capacity, int32_t valueMaxLength) {
+	size_t i;
+
+	table->capacity = capacity;
+	table->valueMaxLength = valueMaxLength;
+	table->numberOfValues = 0;
+	table->nextGlobalValueID = 0;
+	for (i = 0; i < EXI_VALUE_TABLE_QNAMES; i++) {
+		table->numberOfLocalValues[i] = 0;
+	}
+}
+
+int exiValueTableAdd(exi_value_table_t* table, uint16_t qnameID, const exi_string_character_t* characters, size_t len) {
+	exi_value_table_entry_t* entry;
+	size_t globalValueID, units, i;
+
+	if (len == 0 || table->capacity == 0) {
+		return 0;
+	}
+	if (table->valueMaxLength >= 0 && len > (size_t)table->valueMaxLength) {
+		return 0;
+	}
+	if (qnameID >= EXI_VALUE_TABLE_QNAMES || table->numberOfLocalValues[qnameID] == UINT16_MAX) {
+		return EXI_ERROR_STRINGVALUES_OUT_OF_ENTRIES;
+	}
+
+	globalValueID = table->nextGlobalValueID;
+	if (globalValueID == EXI_VALUE_TABLE_MAX_VALUES) {
+		return EXI_ERROR_STRINGVALUES_OUT_OF_ENTRIES;
+	}
+	if (table->capacity > 0) {
+		/* the oldest value makes room, it also leaves its local partition */
+		table->nextGlobalValueID = (globalValueID + 1) % (size_t)table->capacity;
+		if (table->numberOfValues < (size_t)table->capacity) {
+			table->numberOfValues++;
+		}
+	} else {
+		table->nextGlobalValueID++;
+		table->numberOfValues++;
+	}
+
+	if (globalValueID < EXI_VALUE_TABLE_SLOTS) {
+		entry = &table->entries[globalValueID];
+		entry->qnameID = qnameID;
+		entry->localValueID = table->numberOfLocalValues[qnameID];
+		entry->stored = 0;
+		units = characterUnits(characters, len);
+		if (len <= EXI_VALUE_TABLE_STRING_LENGTH && units <= CHARACTER_UNITS(EXI_VALUE_TABLE_STRING_LENGTH) - EXTRA_CHAR) {
+			for (i = 0; i < units; i++) {
+				entry->characters[i] = characters[i];
+			}
+#if EXTRA_CHAR
+			entry->characters[units] = '\0';
+#endif /* EXTRA_CHAR */
+			entry->len = (uint16_t)len;
+			entry->units = (uint16_t)units;
+			entry->stored = 1;
+		}
+	}
+	table->numberOfLocalValues[qnameID]++;
+
+	return 0;
+}
+
+int exiValueTableGetLocal(exi_value_table_t* table, uint16_t qnameID, size_t localValueID, const exi_value_table_entry_t** entry) {
+	size_t i, n;
+
+	if (qnameID >= EXI_VALUE_TABLE_QNAMES) {
+		return EXI_ERROR_STRINGVALUES_OUT_OF_ENTRIES;
+	}
+	if (localValueID >= table->numberOfLocalValues[qnameID]) {
+		return EXI_ERROR_STRINGVALUES_OUT_OF_BOUND;
+	}
+	n = usedSlots(table);
+	for (i = 0; i < n; i++) {
+		if (table->entries[i].qnameID == qnameID && table->entries[i].localValueID == localValueID) {
+			*entry = &table->entries[i];
+			return table->entries[i].stored ? 0 : EXI_ERROR_STRINGVALUES_OUT_OF_MEMORY;
+		}
+	}
+
+	if (table->capacity > 0 && table->capacity <= EXI_VALUE_TABLE_SLOTS) {
+		/* replaced by a newer value */
+		return EXI_ERROR_STRINGVALUES_OUT_OF_BOUND;
+	}
+	return EXI_ERROR_STRINGVALUES_OUT_OF_MEMORY;
+}
+
+int exiValueTableGetGlobal(exi_value_table_t* table, size_t globalValueID, const exi_value_table_entry_t** entry) {
+	if (globalValueID >= table->numberOfValues) {
+		return EXI_ERROR_STRINGVALUES_OUT_OF_BOUND;
+	}
+	if (globalValueID >= EXI_VALUE_TABLE_SLOTS || !table->entries[globalValueID].stored) {
+		return EXI_ERROR_STRINGVALUES_OUT_OF_MEMORY;
+	}
+	*entry = &table->entries[globalValueID];
+	return 0;
+}
+
+void exiValueTableFind(exi_value_table_t* table, uint16_t qnameID, const exi_string_character_t* characters, size_t len,
+		exi_string_value_type_t* type, size_t* id) {
+	exi_value_table_entry_t* entry;
+	size_t i, k, n, units;
+
+	*type = EXI_STRING_VALUE_MISS;
+	if (len == 0 || len > EXI_VALUE_TABLE_STRING_LENGTH) {
+		return;
+	}
+	units = characterUnits(characters, len);
+	n = usedSlots(table);
+	for (i = 0; i < n; i++) {
+		entry = &table->entries[i];
+		if (entry->stored && entry->len == len && entry->units == units) {
+			for (k = 0; k < units && entry->characters[k] == characters[k]; k++) {
+			}
+			if (k == units) {
+				if (entry->qnameID == qnameID) {
+					*type = EXI_STRING_VALUE_LOCAL_HIT;
+					*id = entry->localValueID;
+					return;
+				}
+				if (*type == EXI_STRING_VALUE_MISS) {
+					*type = EXI_STRING_VALUE_GLOBAL_HIT;
+					*id = i;
+				}
+			}
+		}
+	}
+}
+
+#endif /* EXI_OPTION_VALUE_PARTITION_CAPACITY != 0 */
+
+#endif /* STRING_TABLE_C */
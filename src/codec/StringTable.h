@@ -0,0 +1,161 @@
+/*******************************************************************
+ * Value partitions of the EXI string table for the generated codecs.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+/**
+* \file 	StringTable.h
+* \brief 	Preallocated local and global value partitions (EXI_OPTION_VALUE_PARTITION_CAPACITY != 0)
+*
+* 			Every string value of an attribute or simple element that is
+* 			decoded or encoded as a string table miss is added to the global
+* 			partition and to the local partition of its qname (EXI 1.0,
+* 			7.3.3). The generated codecs number their qnames themselves
+* 			(tools/string_table.py), the numbers never appear in a stream.
+*
+* 			The capacity and valueMaxLength are those of the stream header,
+* 			of EXIOptions.h for the encoders. With a bounded capacity the
+* 			global compact identifiers wrap and replace the oldest values.
+* 			Only the first EXI_VALUE_TABLE_SLOTS values are kept, later values
+* 			and values longer than EXI_VALUE_TABLE_STRING_LENGTH are only
+* 			counted, a hit on them is EXI_ERROR_STRINGVALUES_OUT_OF_MEMORY.
+*
+*/
+
+#ifndef STRING_TABLE_H
+#define STRING_TABLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "EXITypes.h"
+#include "EXIOptions.h"
+#include "ErrorCodes.h"
+
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY > 0
+/** Values kept, the bounded capacity of the encoders */
+#define EXI_VALUE_TABLE_SLOTS EXI_OPTION_VALUE_PARTITION_CAPACITY
+#else
+/** Values kept */
+#define EXI_VALUE_TABLE_SLOTS EXI_VALUE_TABLE_ENTRIES
+#endif
+
+/** Maximum number of values (compact identifiers of at most 16 bits) */
+#define EXI_VALUE_TABLE_MAX_VALUES 65536
+
+/** \brief Global value partition entry */
+typedef struct {
+	/** local partition (qname) */
+	uint16_t qnameID;
+	/** local compact identifier */
+	uint16_t localValueID;
+	/** 1 if the characters are kept */
+	uint8_t stored;
+	/** number of code-points */
+	uint16_t len;
+	/** number of characters (UTF8: bytes) without the null terminator */
+	uint16_t units;
+	/** characters (ASCII, UTF8: null terminated) */
+	exi_string_character_t characters[CHARACTER_UNITS(EXI_VALUE_TABLE_STRING_LENGTH)];
+} exi_value_table_entry_t;
+
+/** \brief Value partitions, attached to bitstream_t.valueTable */
+typedef struct exi_value_table {
+	/** valuePartitionCapacity, -1 for unbounded */
+	int32_t capacity;
+	/** valueMaxLength, -1 for unbounded */
+	int32_t valueMaxLength;
+	/** number of entries of the global partition */
+	size_t numberOfValues;
+	/** global compact identifier of the next value */
+	size_t nextGlobalValueID;
+	/** size of each local partition */
+	uint16_t numberOfLocalValues[EXI_VALUE_TABLE_QNAMES];
+	/** global partition, index == global compact identifier */
+	exi_value_table_entry_t entries[EXI_VALUE_TABLE_SLOTS];
+} exi_value_table_t;
+
+
+/**
+ * \brief 	Empties all partitions
+ *
+ * 			readEXIHeader() and writeEXIHeader() do this for the table of the
+ * 			stream with the options of the header.
+ *
+ * \param       table		value partitions
+ * \param       capacity	valuePartitionCapacity, -1 for unbounded
+ * \param       valueMaxLength	valueMaxLength, -1 for unbounded
+ *
+ */
+void exiValueTableReset(exi_value_table_t* table, int32_t capacity, int32_t valueMaxLength);
+
+
+/**
+ * \brief 	Adds a string table miss
+ *
+ * 			Empty values, values longer than valueMaxLength and all values
+ * 			of a capacity of 0 are not added.
+ *
+ * \param       table		value partitions
+ * \param       qnameID		local partition
+ * \param       characters	characters of the value
+ * \param       len			number of code-points
+ * \return                  Error-Code <> 0
+ *
+ */
+int exiValueTableAdd(exi_value_table_t* table, uint16_t qnameID, const exi_string_character_t* characters, size_t len);
+
+
+/**
+ * \brief 	Looks up a local hit
+ *
+ * \param       table		value partitions
+ * \param       qnameID		local partition
+ * \param       localValueID	local compact identifier
+ * \param       entry		value (out)
+ * \return                  Error-Code <> 0
+ *
+ */
+int exiValueTableGetLocal(exi_value_table_t* table, uint16_t qnameID, size_t localValueID, const exi_value_table_entry_t** entry);
+
+
+/**
+ * \brief 	Looks up a global hit
+ *
+ * \param       table		value partitions
+ * \param       globalValueID	global compact identifier
+ * \param       entry		value (out)
+ * \return                  Error-Code <> 0
+ *
+ */
+int exiValueTableGetGlobal(exi_value_table_t* table, size_t globalValueID, const exi_value_table_entry_t** entry);
+
+
+/**
+ * \brief 	Searches a value, the local partition of qnameID first
+ *
+ * \param       table		value partitions
+ * \param       qnameID		local partition
+ * \param       characters	characters of the value
+ * \param       len			number of code-points
+ * \param       type		EXI_STRING_VALUE_MISS, _LOCAL_HIT or _GLOBAL_HIT (out)
+ * \param       id			compact identifier of a hit (out)
+ *
+ */
+void exiValueTableFind(exi_value_table_t* table, uint16_t qnameID, const exi_string_character_t* characters, size_t len,
+		exi_string_value_type_t* type, size_t* id);
+
+#endif /* EXI_OPTION_VALUE_PARTITION_CAPACITY != 0 */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRING_TABLE_H */
@@ -433,10 +433,12 @@ void init_dinEXIFragment(struct dinEXIFragment* exiFrag) {
 }
 #endif /* DEPLOY_DIN_CODEC_FRAGMENT */
 
+#if DIN_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 void init_dinMeteringReceiptReqType(struct dinMeteringReceiptReqType* dinMeteringReceiptReqType) {
 	dinMeteringReceiptReqType->Id_isUsed = 0u;
 	dinMeteringReceiptReqType->SAScheduleTupleID_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_MeteringReceiptReq */
 
 void init_dinBodyType(struct dinBodyType* dinBodyType) {
 	dinBodyType->BodyElement_isUsed = 0u;
@@ -476,27 +478,37 @@ void init_dinBodyType(struct dinBodyType* dinBodyType) {
 	dinBodyType->WeldingDetectionRes_isUsed = 0u;
 }
 
+#if DIN_DEPLOY_SessionSetupReq == SUPPORT_YES
 void init_dinSessionSetupReqType(struct dinSessionSetupReqType* dinSessionSetupReqType) {
 	(void)dinSessionSetupReqType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_SessionSetupReq */
 
+#if DIN_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 void init_dinPowerDeliveryResType(struct dinPowerDeliveryResType* dinPowerDeliveryResType) {
 	dinPowerDeliveryResType->EVSEStatus_isUsed = 0u;
 	dinPowerDeliveryResType->AC_EVSEStatus_isUsed = 0u;
 	dinPowerDeliveryResType->DC_EVSEStatus_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_PowerDeliveryRes */
 
+#if DIN_DEPLOY_ServiceDetailRes == SUPPORT_YES
 void init_dinServiceDetailResType(struct dinServiceDetailResType* dinServiceDetailResType) {
 	dinServiceDetailResType->ServiceParameterList_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_ServiceDetailRes */
 
+#if DIN_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 void init_dinWeldingDetectionResType(struct dinWeldingDetectionResType* dinWeldingDetectionResType) {
 	(void)dinWeldingDetectionResType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_WeldingDetectionRes */
 
+#if DIN_DEPLOY_ContractAuthenticationRes == SUPPORT_YES
 void init_dinContractAuthenticationResType(struct dinContractAuthenticationResType* dinContractAuthenticationResType) {
 	(void)dinContractAuthenticationResType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_ContractAuthenticationRes */
 
 void init_dinCanonicalizationMethodType(struct dinCanonicalizationMethodType* dinCanonicalizationMethodType) {
 	dinCanonicalizationMethodType->ANY_isUsed = 0u;
@@ -515,11 +527,13 @@ void init_dinSelectedServiceListType(struct dinSelectedServiceListType* dinSelec
 	dinSelectedServiceListType->SelectedService.arrayLen = 0u;
 }
 
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
 void init_dinCurrentDemandResType(struct dinCurrentDemandResType* dinCurrentDemandResType) {
 	dinCurrentDemandResType->EVSEMaximumVoltageLimit_isUsed = 0u;
 	dinCurrentDemandResType->EVSEMaximumCurrentLimit_isUsed = 0u;
 	dinCurrentDemandResType->EVSEMaximumPowerLimit_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_CurrentDemandRes */
 
 void init_dinTransformType(struct dinTransformType* dinTransformType) {
 	dinTransformType->ANY_isUsed = 0u;
@@ -539,24 +553,32 @@ void init_dinX509DataType(struct dinX509DataType* dinX509DataType) {
 	dinX509DataType->ANY_isUsed = 0u;
 }
 
+#if DIN_DEPLOY_ChargingStatusRes == SUPPORT_YES
 void init_dinChargingStatusResType(struct dinChargingStatusResType* dinChargingStatusResType) {
 	dinChargingStatusResType->EVSEMaxCurrent_isUsed = 0u;
 	dinChargingStatusResType->MeterInfo_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_ChargingStatusRes */
 
+#if DIN_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 void init_dinWeldingDetectionReqType(struct dinWeldingDetectionReqType* dinWeldingDetectionReqType) {
 	(void)dinWeldingDetectionReqType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_WeldingDetectionReq */
 
+#if DIN_DEPLOY_SignatureProperties == SUPPORT_YES
 void init_dinSignaturePropertiesType(struct dinSignaturePropertiesType* dinSignaturePropertiesType) {
 	dinSignaturePropertiesType->Id_isUsed = 0u;
 	dinSignaturePropertiesType->SignatureProperty.arrayLen = 0u;
 }
+#endif /* DIN_DEPLOY_SignatureProperties */
 
+#if DIN_DEPLOY_ContractAuthenticationReq == SUPPORT_YES
 void init_dinContractAuthenticationReqType(struct dinContractAuthenticationReqType* dinContractAuthenticationReqType) {
 	dinContractAuthenticationReqType->Id_isUsed = 0u;
 	dinContractAuthenticationReqType->GenChallenge_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_ContractAuthenticationReq */
 
 void init_dinDC_EVPowerDeliveryParameterType(struct dinDC_EVPowerDeliveryParameterType* dinDC_EVPowerDeliveryParameterType) {
 	dinDC_EVPowerDeliveryParameterType->BulkChargingComplete_isUsed = 0u;
@@ -566,9 +588,11 @@ void init_dinEVSEChargeParameterType(struct dinEVSEChargeParameterType* dinEVSEC
 	(void)dinEVSEChargeParameterType; /* avoid unused warning */
 }
 
+#if DIN_DEPLOY_CableCheckReq == SUPPORT_YES
 void init_dinCableCheckReqType(struct dinCableCheckReqType* dinCableCheckReqType) {
 	(void)dinCableCheckReqType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_CableCheckReq */
 
 void init_dinDC_EVChargeParameterType(struct dinDC_EVChargeParameterType* dinDC_EVChargeParameterType) {
 	dinDC_EVChargeParameterType->EVMaximumPowerLimit_isUsed = 0u;
@@ -586,21 +610,27 @@ void init_dinPMaxScheduleType(struct dinPMaxScheduleType* dinPMaxScheduleType) {
 	dinPMaxScheduleType->PMaxScheduleEntry.arrayLen = 0u;
 }
 
+#if DIN_DEPLOY_ServicePaymentSelectionReq == SUPPORT_YES
 void init_dinServicePaymentSelectionReqType(struct dinServicePaymentSelectionReqType* dinServicePaymentSelectionReqType) {
 	(void)dinServicePaymentSelectionReqType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_ServicePaymentSelectionReq */
 
 void init_dinRelativeTimeIntervalType(struct dinRelativeTimeIntervalType* dinRelativeTimeIntervalType) {
 	dinRelativeTimeIntervalType->duration_isUsed = 0u;
 }
 
+#if DIN_DEPLOY_EVStatus == SUPPORT_YES
 void init_dinEVStatusType(struct dinEVStatusType* dinEVStatusType) {
 	(void)dinEVStatusType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_EVStatus */
 
+#if DIN_DEPLOY_PreChargeRes == SUPPORT_YES
 void init_dinPreChargeResType(struct dinPreChargeResType* dinPreChargeResType) {
 	(void)dinPreChargeResType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_PreChargeRes */
 
 void init_dinDC_EVSEChargeParameterType(struct dinDC_EVSEChargeParameterType* dinDC_EVSEChargeParameterType) {
 	dinDC_EVSEChargeParameterType->EVSEMaximumPowerLimit_isUsed = 0u;
@@ -608,9 +638,11 @@ void init_dinDC_EVSEChargeParameterType(struct dinDC_EVSEChargeParameterType* di
 	dinDC_EVSEChargeParameterType->EVSEEnergyToBeDelivered_isUsed = 0u;
 }
 
+#if DIN_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 void init_dinPaymentDetailsResType(struct dinPaymentDetailsResType* dinPaymentDetailsResType) {
 	(void)dinPaymentDetailsResType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_PaymentDetailsRes */
 
 void init_dinDSAKeyValueType(struct dinDSAKeyValueType* dinDSAKeyValueType) {
 	dinDSAKeyValueType->P_isUsed = 0u;
@@ -625,9 +657,11 @@ void init_dinSASchedulesType(struct dinSASchedulesType* dinSASchedulesType) {
 	(void)dinSASchedulesType; /* avoid unused warning */
 }
 
+#if DIN_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 void init_dinCertificateUpdateResType(struct dinCertificateUpdateResType* dinCertificateUpdateResType) {
 	(void)dinCertificateUpdateResType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_CertificateUpdateRes */
 
 void init_dinEVChargeParameterType(struct dinEVChargeParameterType* dinEVChargeParameterType) {
 	(void)dinEVChargeParameterType; /* avoid unused warning */
@@ -638,9 +672,11 @@ void init_dinMessageHeaderType(struct dinMessageHeaderType* dinMessageHeaderType
 	dinMessageHeaderType->Signature_isUsed = 0u;
 }
 
+#if DIN_DEPLOY_BodyElement == SUPPORT_YES
 void init_dinBodyBaseType(struct dinBodyBaseType* dinBodyBaseType) {
 	(void)dinBodyBaseType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_BodyElement */
 
 void init_dinKeyValueType(struct dinKeyValueType* dinKeyValueType) {
 	dinKeyValueType->DSAKeyValue_isUsed = 0u;
@@ -652,6 +688,7 @@ void init_dinIntervalType(struct dinIntervalType* dinIntervalType) {
 	(void)dinIntervalType; /* avoid unused warning */
 }
 
+#if DIN_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 void init_dinChargeParameterDiscoveryResType(struct dinChargeParameterDiscoveryResType* dinChargeParameterDiscoveryResType) {
 	dinChargeParameterDiscoveryResType->SASchedules_isUsed = 0u;
 	dinChargeParameterDiscoveryResType->SAScheduleList_isUsed = 0u;
@@ -659,12 +696,15 @@ void init_dinChargeParameterDiscoveryResType(struct dinChargeParameterDiscoveryR
 	dinChargeParameterDiscoveryResType->AC_EVSEChargeParameter_isUsed = 0u;
 	dinChargeParameterDiscoveryResType->DC_EVSEChargeParameter_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryRes */
 
+#if DIN_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 void init_dinPowerDeliveryReqType(struct dinPowerDeliveryReqType* dinPowerDeliveryReqType) {
 	dinPowerDeliveryReqType->ChargingProfile_isUsed = 0u;
 	dinPowerDeliveryReqType->EVPowerDeliveryParameter_isUsed = 0u;
 	dinPowerDeliveryReqType->DC_EVPowerDeliveryParameter_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_PowerDeliveryReq */
 
 void init_dinCertificateChainType(struct dinCertificateChainType* dinCertificateChainType) {
 	dinCertificateChainType->SubCertificates_isUsed = 0u;
@@ -674,18 +714,24 @@ void init_dinTransformsType(struct dinTransformsType* dinTransformsType) {
 	dinTransformsType->Transform.arrayLen = 0u;
 }
 
+#if DIN_DEPLOY_Entry == SUPPORT_YES
 void init_dinEntryType(struct dinEntryType* dinEntryType) {
 	dinEntryType->TimeInterval_isUsed = 0u;
 	dinEntryType->RelativeTimeInterval_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_Entry */
 
+#if DIN_DEPLOY_SessionStopReq == SUPPORT_YES
 void init_dinSessionStopType(struct dinSessionStopType* dinSessionStopType) {
 	(void)dinSessionStopType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_SessionStopReq */
 
+#if DIN_DEPLOY_ServiceDetailReq == SUPPORT_YES
 void init_dinServiceDetailReqType(struct dinServiceDetailReqType* dinServiceDetailReqType) {
 	(void)dinServiceDetailReqType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_ServiceDetailReq */
 
 void init_dinDigestMethodType(struct dinDigestMethodType* dinDigestMethodType) {
 	dinDigestMethodType->ANY_isUsed = 0u;
@@ -700,18 +746,22 @@ void init_dinParameterType(struct dinParameterType* dinParameterType) {
 	dinParameterType->stringValue_isUsed = 0u;
 }
 
+#if DIN_DEPLOY_ChargingStatusReq == SUPPORT_YES
 void init_dinChargingStatusReqType(struct dinChargingStatusReqType* dinChargingStatusReqType) {
 	(void)dinChargingStatusReqType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_ChargingStatusReq */
 
 void init_dinSignatureMethodType(struct dinSignatureMethodType* dinSignatureMethodType) {
 	dinSignatureMethodType->HMACOutputLength_isUsed = 0u;
 	dinSignatureMethodType->ANY_isUsed = 0u;
 }
 
+#if DIN_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 void init_dinCertificateInstallationReqType(struct dinCertificateInstallationReqType* dinCertificateInstallationReqType) {
 	dinCertificateInstallationReqType->Id_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_CertificateInstallationReq */
 
 void init_dinSalesTariffEntryType(struct dinSalesTariffEntryType* dinSalesTariffEntryType) {
 	dinSalesTariffEntryType->TimeInterval_isUsed = 0u;
@@ -719,14 +769,17 @@ void init_dinSalesTariffEntryType(struct dinSalesTariffEntryType* dinSalesTariff
 	dinSalesTariffEntryType->ConsumptionCost.arrayLen = 0u;
 }
 
+#if DIN_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 void init_dinServiceDiscoveryResType(struct dinServiceDiscoveryResType* dinServiceDiscoveryResType) {
 	dinServiceDiscoveryResType->ServiceList_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_ServiceDiscoveryRes */
 
 void init_dinParameterSetType(struct dinParameterSetType* dinParameterSetType) {
 	dinParameterSetType->Parameter.arrayLen = 0u;
 }
 
+#if DIN_DEPLOY_CurrentDemandReq == SUPPORT_YES
 void init_dinCurrentDemandReqType(struct dinCurrentDemandReqType* dinCurrentDemandReqType) {
 	dinCurrentDemandReqType->EVMaximumVoltageLimit_isUsed = 0u;
 	dinCurrentDemandReqType->EVMaximumCurrentLimit_isUsed = 0u;
@@ -735,10 +788,13 @@ void init_dinCurrentDemandReqType(struct dinCurrentDemandReqType* dinCurrentDema
 	dinCurrentDemandReqType->RemainingTimeToFullSoC_isUsed = 0u;
 	dinCurrentDemandReqType->RemainingTimeToBulkSoC_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_CurrentDemandReq */
 
+#if DIN_DEPLOY_PreChargeReq == SUPPORT_YES
 void init_dinPreChargeReqType(struct dinPreChargeReqType* dinPreChargeReqType) {
 	(void)dinPreChargeReqType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_PreChargeReq */
 
 void init_dinSignatureType(struct dinSignatureType* dinSignatureType) {
 	dinSignatureType->Id_isUsed = 0u;
@@ -761,11 +817,13 @@ void init_dinAnonType_V2G_Message(struct dinAnonType_V2G_Message* dinAnonType_V2
 	(void)dinAnonType_V2G_Message; /* avoid unused warning */
 }
 
+#if DIN_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 void init_dinChargeParameterDiscoveryReqType(struct dinChargeParameterDiscoveryReqType* dinChargeParameterDiscoveryReqType) {
 	dinChargeParameterDiscoveryReqType->EVChargeParameter_isUsed = 0u;
 	dinChargeParameterDiscoveryReqType->AC_EVChargeParameter_isUsed = 0u;
 	dinChargeParameterDiscoveryReqType->DC_EVChargeParameter_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryReq */
 
 void init_dinConsumptionCostType(struct dinConsumptionCostType* dinConsumptionCostType) {
 	dinConsumptionCostType->Cost.arrayLen = 0u;
@@ -787,9 +845,11 @@ void init_dinEVSEStatusType(struct dinEVSEStatusType* dinEVSEStatusType) {
 	(void)dinEVSEStatusType; /* avoid unused warning */
 }
 
+#if DIN_DEPLOY_SessionSetupRes == SUPPORT_YES
 void init_dinSessionSetupResType(struct dinSessionSetupResType* dinSessionSetupResType) {
 	dinSessionSetupResType->DateTimeNow_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_SessionSetupRes */
 
 void init_dinEVPowerDeliveryParameterType(struct dinEVPowerDeliveryParameterType* dinEVPowerDeliveryParameterType) {
 	(void)dinEVPowerDeliveryParameterType; /* avoid unused warning */
@@ -803,9 +863,11 @@ void init_dinSelectedServiceType(struct dinSelectedServiceType* dinSelectedServi
 	dinSelectedServiceType->ParameterSetID_isUsed = 0u;
 }
 
+#if DIN_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 void init_dinMeteringReceiptResType(struct dinMeteringReceiptResType* dinMeteringReceiptResType) {
 	(void)dinMeteringReceiptResType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_MeteringReceiptRes */
 
 void init_dinDC_EVStatusType(struct dinDC_EVStatusType* dinDC_EVStatusType) {
 	dinDC_EVStatusType->EVCabinConditioning_isUsed = 0u;
@@ -816,10 +878,12 @@ void init_dinPhysicalValueType(struct dinPhysicalValueType* dinPhysicalValueType
 	dinPhysicalValueType->Unit_isUsed = 0u;
 }
 
+#if DIN_DEPLOY_Manifest == SUPPORT_YES
 void init_dinManifestType(struct dinManifestType* dinManifestType) {
 	dinManifestType->Id_isUsed = 0u;
 	dinManifestType->Reference.arrayLen = 0u;
 }
+#endif /* DIN_DEPLOY_Manifest */
 
 void init_dinPMaxScheduleEntryType(struct dinPMaxScheduleEntryType* dinPMaxScheduleEntryType) {
 	dinPMaxScheduleEntryType->TimeInterval_isUsed = 0u;
@@ -847,13 +911,17 @@ void init_dinAC_EVSEStatusType(struct dinAC_EVSEStatusType* dinAC_EVSEStatusType
 	(void)dinAC_EVSEStatusType; /* avoid unused warning */
 }
 
+#if DIN_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 void init_dinCertificateUpdateReqType(struct dinCertificateUpdateReqType* dinCertificateUpdateReqType) {
 	dinCertificateUpdateReqType->Id_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_CertificateUpdateReq */
 
+#if DIN_DEPLOY_ServicePaymentSelectionRes == SUPPORT_YES
 void init_dinServicePaymentSelectionResType(struct dinServicePaymentSelectionResType* dinServicePaymentSelectionResType) {
 	(void)dinServicePaymentSelectionResType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_ServicePaymentSelectionRes */
 
 void init_dinSAScheduleTupleType(struct dinSAScheduleTupleType* dinSAScheduleTupleType) {
 	dinSAScheduleTupleType->SalesTariff_isUsed = 0u;
@@ -863,10 +931,12 @@ void init_dinChargingProfileType(struct dinChargingProfileType* dinChargingProfi
 	dinChargingProfileType->ProfileEntry.arrayLen = 0u;
 }
 
+#if DIN_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 void init_dinServiceDiscoveryReqType(struct dinServiceDiscoveryReqType* dinServiceDiscoveryReqType) {
 	dinServiceDiscoveryReqType->ServiceScope_isUsed = 0u;
 	dinServiceDiscoveryReqType->ServiceCategory_isUsed = 0u;
 }
+#endif /* DIN_DEPLOY_ServiceDiscoveryReq */
 
 void init_dinAC_EVSEChargeParameterType(struct dinAC_EVSEChargeParameterType* dinAC_EVSEChargeParameterType) {
 	(void)dinAC_EVSEChargeParameterType; /* avoid unused warning */
@@ -884,13 +954,17 @@ void init_dinKeyInfoType(struct dinKeyInfoType* dinKeyInfoType) {
 	dinKeyInfoType->ANY_isUsed = 0u;
 }
 
+#if DIN_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 void init_dinPaymentDetailsReqType(struct dinPaymentDetailsReqType* dinPaymentDetailsReqType) {
 	(void)dinPaymentDetailsReqType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_PaymentDetailsReq */
 
+#if DIN_DEPLOY_CableCheckRes == SUPPORT_YES
 void init_dinCableCheckResType(struct dinCableCheckResType* dinCableCheckResType) {
 	(void)dinCableCheckResType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_CableCheckRes */
 
 void init_dinObjectType(struct dinObjectType* dinObjectType) {
 	dinObjectType->Id_isUsed = 0u;
@@ -899,9 +973,11 @@ void init_dinObjectType(struct dinObjectType* dinObjectType) {
 	dinObjectType->ANY_isUsed = 0u;
 }
 
+#if DIN_DEPLOY_SessionStopRes == SUPPORT_YES
 void init_dinSessionStopResType(struct dinSessionStopResType* dinSessionStopResType) {
 	(void)dinSessionStopResType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_SessionStopRes */
 
 void init_dinSignedInfoType(struct dinSignedInfoType* dinSignedInfoType) {
 	dinSignedInfoType->Id_isUsed = 0u;
@@ -941,9 +1017,11 @@ void init_dinPGPDataType(struct dinPGPDataType* dinPGPDataType) {
 	dinPGPDataType->ANY_isUsed = 0u;
 }
 
+#if DIN_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 void init_dinCertificateInstallationResType(struct dinCertificateInstallationResType* dinCertificateInstallationResType) {
 	(void)dinCertificateInstallationResType; /* avoid unused warning */
 }
+#endif /* DIN_DEPLOY_CertificateInstallationRes */
 
 void init_dinSignaturePropertyType(struct dinSignaturePropertyType* dinSignaturePropertyType) {
 	dinSignaturePropertyType->Id_isUsed = 0u;
@@ -53,6 +53,8 @@ extern "C" {
 
 #include "EXITypes.h"
 
+#include "dinEXIDeploy.h"
+
 
 /* Datatype definitions and structs for given XML Schema definitions */
 
@@ -131,12 +133,20 @@ typedef enum {
 struct dinCanonicalizationMethodType {
 	/* attribute: Algorithm {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinCanonicalizationMethodType_Algorithm_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Algorithm ;
 	/* element: WC[##any] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinCanonicalizationMethodType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -150,14 +160,22 @@ struct dinSPKIDataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":SPKISexp, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[dinSPKIDataType_SPKISexp_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[dinSPKIDataType_SPKISexp_ARRAY_SIZE];
 		uint16_t arrayLen;
 	} SPKISexp;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinSPKIDataType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -170,7 +188,11 @@ struct dinListOfRootCertificateIDsType {
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":RootCertificateID, urn:iso:15118:2:2010:MsgDataTypes,rootCertificateIDType */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[dinListOfRootCertificateIDsType_RootCertificateID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[dinListOfRootCertificateIDsType_RootCertificateID_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -185,19 +207,31 @@ struct dinListOfRootCertificateIDsType {
 struct dinTransformType {
 	/* attribute: Algorithm {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinTransformType_Algorithm_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Algorithm ;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinTransformType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":XPath, http://www.w3.org/2001/XMLSchema,string */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[dinTransformType_XPath_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[dinTransformType_XPath_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -225,13 +259,21 @@ typedef enum {
 struct dinContractAuthenticationReqType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,IDREF} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinContractAuthenticationReqType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: "urn:iso:15118:2:2010:MsgBody":GenChallenge, urn:iso:15118:2:2010:MsgDataTypes,genChallengeType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinContractAuthenticationReqType_GenChallenge_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  GenChallenge ;
 	unsigned int GenChallenge_isUsed:1;
@@ -267,42 +309,70 @@ struct dinEVStatusType {
 struct dinDSAKeyValueType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":P, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinDSAKeyValueType_P_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  P ;
 	unsigned int P_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Q, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinDSAKeyValueType_Q_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Q ;
 	unsigned int Q_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":G, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinDSAKeyValueType_G_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  G ;
 	unsigned int G_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Y, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinDSAKeyValueType_Y_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Y ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":J, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinDSAKeyValueType_J_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  J ;
 	unsigned int J_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Seed, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinDSAKeyValueType_Seed_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Seed ;
 	unsigned int Seed_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":PgenCounter, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinDSAKeyValueType_PgenCounter_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PgenCounter ;
 	unsigned int PgenCounter_isUsed:1;
@@ -385,12 +455,20 @@ struct dinServiceDetailReqType {
 struct dinDigestMethodType {
 	/* attribute: Algorithm {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinDigestMethodType_Algorithm_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Algorithm ;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinDigestMethodType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -416,7 +494,11 @@ struct dinChargingStatusReqType {
 struct dinSignatureMethodType {
 	/* attribute: Algorithm {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinSignatureMethodType_Algorithm_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Algorithm ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":HMACOutputLength, http://www.w3.org/2000/09/xmldsig#,HMACOutputLengthType */
@@ -424,7 +506,11 @@ struct dinSignatureMethodType {
 	unsigned int HMACOutputLength_isUsed:1;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinSignatureMethodType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -437,20 +523,32 @@ struct dinSignatureMethodType {
 struct dinCertificateInstallationReqType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,IDREF} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinCertificateInstallationReqType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: "urn:iso:15118:2:2010:MsgBody":OEMProvisioningCert, urn:iso:15118:2:2010:MsgDataTypes,certificateType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinCertificateInstallationReqType_OEMProvisioningCert_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  OEMProvisioningCert ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":ListOfRootCertificateIDs, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ListOfRootCertificateIDsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":RootCertificateID{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 	struct dinListOfRootCertificateIDsType ListOfRootCertificateIDs ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":DHParams, urn:iso:15118:2:2010:MsgDataTypes,dHParamsType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinCertificateInstallationReqType_DHParams_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DHParams ;
 };
@@ -490,19 +588,31 @@ typedef enum {
 struct dinReferenceType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinReferenceType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* attribute: URI {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinReferenceType_URI_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  URI ;
 	unsigned int URI_isUsed:1;
 	/* attribute: Type {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinReferenceType_Type_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Type ;
 	unsigned int Type_isUsed:1;
@@ -513,7 +623,11 @@ struct dinReferenceType {
 	struct dinDigestMethodType DigestMethod ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":DigestValue, http://www.w3.org/2000/09/xmldsig#,DigestValueType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinReferenceType_DigestValue_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DigestValue ;
 };
@@ -532,12 +646,20 @@ struct dinProfileEntryType {
 struct dinRSAKeyValueType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Modulus, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinRSAKeyValueType_Modulus_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Modulus ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Exponent, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinRSAKeyValueType_Exponent_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Exponent ;
 };
@@ -576,7 +698,11 @@ struct dinEVPowerDeliveryParameterType {
 struct dinX509IssuerSerialType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509IssuerName, http://www.w3.org/2001/XMLSchema,string */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinX509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  X509IssuerName ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509SerialNumber, http://www.w3.org/2001/XMLSchema,integer */
@@ -625,13 +751,21 @@ struct dinPhysicalValueType {
 struct dinManifestType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinManifestType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Reference, Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct dinReferenceType* array;
+#else
 		struct dinReferenceType array[dinManifestType_Reference_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} Reference;
 };
@@ -667,13 +801,21 @@ typedef enum {
 struct dinSignatureValueType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinSignatureValueType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* simple content: http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinSignatureValueType_CONTENT_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  CONTENT ;
 };
@@ -696,7 +838,11 @@ struct dinServiceTagType {
 	uint16_t ServiceID ;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":ServiceName, urn:iso:15118:2:2010:MsgDataTypes,serviceNameType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinServiceTagType_ServiceName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ServiceName ;
 	unsigned int ServiceName_isUsed:1;
@@ -704,7 +850,11 @@ struct dinServiceTagType {
 	dinserviceCategoryType ServiceCategory ;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":ServiceScope, urn:iso:15118:2:2010:MsgDataTypes,serviceScopeType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinServiceTagType_ServiceScope_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ServiceScope ;
 	unsigned int ServiceScope_isUsed:1;
@@ -729,7 +879,11 @@ struct dinChargingProfileType {
 	int16_t SAScheduleTupleID ;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":ProfileEntry, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ProfileEntryType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ChargingProfileEntryStart,"urn:iso:15118:2:2010:MsgDataTypes":ChargingProfileEntryMaxPower)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct dinProfileEntryType* array;
+#else
 		struct dinProfileEntryType array[dinChargingProfileType_ProfileEntry_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} ProfileEntry;
 };
@@ -739,7 +893,11 @@ struct dinChargingProfileType {
 struct dinServiceDiscoveryReqType {
 	/* element: "urn:iso:15118:2:2010:MsgBody":ServiceScope, urn:iso:15118:2:2010:MsgDataTypes,serviceScopeType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinServiceDiscoveryReqType_ServiceScope_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ServiceScope ;
 	unsigned int ServiceScope_isUsed:1;
@@ -794,25 +952,41 @@ struct dinAC_EVSEChargeParameterType {
 struct dinObjectType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinObjectType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* attribute: MimeType {http://www.w3.org/2001/XMLSchema,string} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinObjectType_MimeType_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MimeType ;
 	unsigned int MimeType_isUsed:1;
 	/* attribute: Encoding {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinObjectType_Encoding_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Encoding ;
 	unsigned int Encoding_isUsed:1;
 	/* element: WC[##any] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinObjectType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -830,7 +1004,11 @@ struct dinSessionStopResType {
 struct dinSignedInfoType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinSignedInfoType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -840,7 +1018,11 @@ struct dinSignedInfoType {
 	struct dinSignatureMethodType SignatureMethod ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Reference, Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct dinReferenceType* array;
+#else
 		struct dinReferenceType array[dinSignedInfoType_Reference_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} Reference;
 };
@@ -885,13 +1067,21 @@ struct dinDC_EVSEStatusType {
 struct dinRetrievalMethodType {
 	/* attribute: URI {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinRetrievalMethodType_URI_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  URI ;
 	unsigned int URI_isUsed:1;
 	/* attribute: Type {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinRetrievalMethodType_Type_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Type ;
 	unsigned int Type_isUsed:1;
@@ -907,7 +1097,11 @@ struct dinNotificationType {
 	dinfaultCodeType FaultCode ;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":FaultMsg, urn:iso:15118:2:2010:MsgDataTypes,faultMsgType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinNotificationType_FaultMsg_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  FaultMsg ;
 	unsigned int FaultMsg_isUsed:1;
@@ -920,19 +1114,31 @@ struct dinNotificationType {
 struct dinPGPDataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":PGPKeyID, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinPGPDataType_PGPKeyID_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PGPKeyID ;
 	unsigned int PGPKeyID_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinPGPDataType_PGPKeyPacket_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PGPKeyPacket ;
 	unsigned int PGPKeyPacket_isUsed:1;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinPGPDataType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -945,18 +1151,30 @@ struct dinPGPDataType {
 struct dinSignaturePropertyType {
 	/* attribute: Target {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinSignaturePropertyType_Target_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Target ;
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinSignaturePropertyType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinSignaturePropertyType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -968,7 +1186,11 @@ struct dinSignaturePropertyType {
 struct dinMeterInfoType {
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":MeterID, urn:iso:15118:2:2010:MsgDataTypes,meterIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinMeterInfoType_MeterID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MeterID ;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":MeterReading, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,PhysicalValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":Multiplier,"urn:iso:15118:2:2010:MsgDataTypes":Unit{0-1},"urn:iso:15118:2:2010:MsgDataTypes":Value)',  derivedBy='RESTRICTION'.  */
@@ -995,7 +1217,11 @@ struct dinSubCertificatesType {
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":Certificate, urn:iso:15118:2:2010:MsgDataTypes,certificateType */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[dinSubCertificatesType_Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[dinSubCertificatesType_Certificate_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -1008,7 +1234,11 @@ struct dinSubCertificatesType {
 struct dinMeteringReceiptReqType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,IDREF} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinMeteringReceiptReqType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -1062,7 +1292,11 @@ struct dinContractAuthenticationResType {
 struct dinSelectedServiceListType {
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":SelectedService, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SelectedServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ServiceID,"urn:iso:15118:2:2010:MsgDataTypes":ParameterSetID{0-1})',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct dinSelectedServiceType* array;
+#else
 		struct dinSelectedServiceType array[dinSelectedServiceListType_SelectedService_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} SelectedService;
 };
@@ -1128,7 +1362,11 @@ struct dinX509DataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509SKI, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[dinX509DataType_X509SKI_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[dinX509DataType_X509SKI_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -1136,7 +1374,11 @@ struct dinX509DataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509SubjectName, http://www.w3.org/2001/XMLSchema,string */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[dinX509DataType_X509SubjectName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[dinX509DataType_X509SubjectName_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -1144,7 +1386,11 @@ struct dinX509DataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509Certificate, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[dinX509DataType_X509Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[dinX509DataType_X509Certificate_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -1152,14 +1398,22 @@ struct dinX509DataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509CRL, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[dinX509DataType_X509CRL_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[dinX509DataType_X509CRL_ARRAY_SIZE];
 		uint16_t arrayLen;
 	} X509CRL;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinX509DataType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -1201,7 +1455,11 @@ struct dinWeldingDetectionReqType {
 struct dinSignaturePropertiesType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinSignaturePropertiesType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -1261,7 +1519,11 @@ struct dinPMaxScheduleType {
 	int16_t PMaxScheduleID ;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":PMaxScheduleEntry, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,PMaxScheduleEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2010:MsgDataTypes":TimeInterval),("urn:iso:15118:2:2010:MsgDataTypes":PMax))',  derivedBy='EXTENSION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct dinPMaxScheduleEntryType* array;
+#else
 		struct dinPMaxScheduleEntryType array[dinPMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} PMaxScheduleEntry;
 };
@@ -1316,7 +1578,11 @@ struct dinPaymentDetailsResType {
 	dinresponseCodeType ResponseCode ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":GenChallenge, urn:iso:15118:2:2010:MsgDataTypes,genChallengeType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinPaymentDetailsResType_GenChallenge_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  GenChallenge ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":DateTimeNow, http://www.w3.org/2001/XMLSchema,long */
@@ -1327,14 +1593,22 @@ struct dinPaymentDetailsResType {
 #define dinKeyValueType_ANY_CHARACTERS_SIZE 50 + EXTRA_CHAR 
 struct dinKeyValueType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":DSAKeyValue, Complex type name='http://www.w3.org/2000/09/xmldsig#,DSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":P,"http://www.w3.org/2000/09/xmldsig#":Q){0-1},"http://www.w3.org/2000/09/xmldsig#":G{0-1},"http://www.w3.org/2000/09/xmldsig#":Y,"http://www.w3.org/2000/09/xmldsig#":J{0-1},("http://www.w3.org/2000/09/xmldsig#":Seed,"http://www.w3.org/2000/09/xmldsig#":PgenCounter){0-1})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct dinDSAKeyValueType* DSAKeyValue ;
+#else
 	struct dinDSAKeyValueType DSAKeyValue ;
+#endif /* DATABINDING_SLIM */
 	unsigned int DSAKeyValue_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":RSAKeyValue, Complex type name='http://www.w3.org/2000/09/xmldsig#,RSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Modulus,"http://www.w3.org/2000/09/xmldsig#":Exponent)',  derivedBy='RESTRICTION'.  */
 	struct dinRSAKeyValueType RSAKeyValue ;
 	unsigned int RSAKeyValue_isUsed:1;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinKeyValueType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -1360,7 +1634,11 @@ struct dinPowerDeliveryReqType {
 struct dinCertificateChainType {
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":Certificate, urn:iso:15118:2:2010:MsgDataTypes,certificateType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinCertificateChainType_Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Certificate ;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":SubCertificates, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SubCertificatesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":Certificate{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
@@ -1374,7 +1652,11 @@ struct dinCertificateChainType {
 struct dinParameterType {
 	/* attribute: Name {http://www.w3.org/2001/XMLSchema,string} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinParameterType_Name_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Name ;
 	/* attribute: ValueType {urn:iso:15118:2:2010:MsgDataTypes,valueType} */
@@ -1396,7 +1678,11 @@ struct dinParameterType {
 	unsigned int physicalValue_isUsed:1;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":stringValue, http://www.w3.org/2001/XMLSchema,string */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinParameterType_stringValue_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  stringValue ;
 	unsigned int stringValue_isUsed:1;
@@ -1409,7 +1695,11 @@ struct dinParameterSetType {
 	int16_t ParameterSetID ;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":Parameter, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ParameterType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":boolValue|"urn:iso:15118:2:2010:MsgDataTypes":byteValue|"urn:iso:15118:2:2010:MsgDataTypes":shortValue|"urn:iso:15118:2:2010:MsgDataTypes":intValue|"urn:iso:15118:2:2010:MsgDataTypes":physicalValue|"urn:iso:15118:2:2010:MsgDataTypes":stringValue)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct dinParameterType* array;
+#else
 		struct dinParameterType array[dinParameterSetType_Parameter_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} Parameter;
 };
@@ -1494,7 +1784,11 @@ struct dinServiceType {
 struct dinServiceTagListType {
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":Service, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ServiceTag,"urn:iso:15118:2:2010:MsgDataTypes":FreeService)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct dinServiceType* array;
+#else
 		struct dinServiceType array[dinServiceTagListType_Service_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} Service;
 };
@@ -1539,7 +1833,11 @@ struct dinServiceParameterListType {
 struct dinCertificateUpdateReqType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,IDREF} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinCertificateUpdateReqType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -1547,14 +1845,22 @@ struct dinCertificateUpdateReqType {
 	struct dinCertificateChainType ContractSignatureCertChain ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":ContractID, urn:iso:15118:2:2010:MsgDataTypes,contractIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinCertificateUpdateReqType_ContractID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ContractID ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":ListOfRootCertificateIDs, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ListOfRootCertificateIDsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":RootCertificateID{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 	struct dinListOfRootCertificateIDsType ListOfRootCertificateIDs ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":DHParams, urn:iso:15118:2:2010:MsgDataTypes,dHParamsType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinCertificateUpdateReqType_DHParams_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DHParams ;
 };
@@ -1580,14 +1886,22 @@ struct dinServicePaymentSelectionResType {
 struct dinKeyInfoType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinKeyInfoType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":KeyName, http://www.w3.org/2001/XMLSchema,string */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[dinKeyInfoType_KeyName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[dinKeyInfoType_KeyName_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -1604,7 +1918,11 @@ struct dinKeyInfoType {
 	} RetrievalMethod;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509Data, Complex type name='http://www.w3.org/2000/09/xmldsig#,X509DataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":X509IssuerSerial|"http://www.w3.org/2000/09/xmldsig#":X509SKI|"http://www.w3.org/2000/09/xmldsig#":X509SubjectName|"http://www.w3.org/2000/09/xmldsig#":X509Certificate|"http://www.w3.org/2000/09/xmldsig#":X509CRL|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct dinX509DataType* array;
+#else
 		struct dinX509DataType array[dinKeyInfoType_X509Data_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} X509Data;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":PGPData, Complex type name='http://www.w3.org/2000/09/xmldsig#,PGPDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":PGPKeyID,"http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})|("http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED}))',  derivedBy='RESTRICTION'.  */
@@ -1620,14 +1938,22 @@ struct dinKeyInfoType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":MgmtData, http://www.w3.org/2001/XMLSchema,string */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[dinKeyInfoType_MgmtData_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[dinKeyInfoType_MgmtData_ARRAY_SIZE];
 		uint16_t arrayLen;
 	} MgmtData;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinKeyInfoType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -1638,7 +1964,11 @@ struct dinKeyInfoType {
 struct dinPaymentDetailsReqType {
 	/* element: "urn:iso:15118:2:2010:MsgBody":ContractID, urn:iso:15118:2:2010:MsgDataTypes,contractIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinPaymentDetailsReqType_ContractID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ContractID ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":ContractSignatureCertChain, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,CertificateChainType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":Certificate,"urn:iso:15118:2:2010:MsgDataTypes":SubCertificates{0-1})',  derivedBy='RESTRICTION'.  */
@@ -1663,7 +1993,11 @@ struct dinCableCheckResType {
 struct dinCertificateInstallationResType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,IDREF} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinCertificateInstallationResType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":ResponseCode, urn:iso:15118:2:2010:MsgDataTypes,responseCodeType */
@@ -1672,17 +2006,29 @@ struct dinCertificateInstallationResType {
 	struct dinCertificateChainType ContractSignatureCertChain ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":ContractSignatureEncryptedPrivateKey, urn:iso:15118:2:2010:MsgDataTypes,privateKeyType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinCertificateInstallationResType_ContractSignatureEncryptedPrivateKey_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  ContractSignatureEncryptedPrivateKey ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":DHParams, urn:iso:15118:2:2010:MsgDataTypes,dHParamsType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinCertificateInstallationResType_DHParams_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DHParams ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":ContractID, urn:iso:15118:2:2010:MsgDataTypes,contractIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinCertificateInstallationResType_ContractID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ContractID ;
 };
@@ -1706,7 +2052,11 @@ struct dinServiceDetailResType {
 struct dinCertificateUpdateResType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,IDREF} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinCertificateUpdateResType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":ResponseCode, urn:iso:15118:2:2010:MsgDataTypes,responseCodeType */
@@ -1715,17 +2065,29 @@ struct dinCertificateUpdateResType {
 	struct dinCertificateChainType ContractSignatureCertChain ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":ContractSignatureEncryptedPrivateKey, urn:iso:15118:2:2010:MsgDataTypes,privateKeyType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinCertificateUpdateResType_ContractSignatureEncryptedPrivateKey_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  ContractSignatureEncryptedPrivateKey ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":DHParams, urn:iso:15118:2:2010:MsgDataTypes,dHParamsType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinCertificateUpdateResType_DHParams_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DHParams ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":ContractID, urn:iso:15118:2:2010:MsgDataTypes,contractIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinCertificateUpdateResType_ContractID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ContractID ;
 	/* element: "urn:iso:15118:2:2010:MsgBody":RetryCounter, http://www.w3.org/2001/XMLSchema,short */
@@ -1745,7 +2107,11 @@ struct dinSalesTariffEntryType {
 	uint8_t EPriceLevel ;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":ConsumptionCost, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ConsumptionCostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":startValue,"urn:iso:15118:2:2010:MsgDataTypes":Cost{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct dinConsumptionCostType* array;
+#else
 		struct dinConsumptionCostType array[dinSalesTariffEntryType_ConsumptionCost_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} ConsumptionCost;
 };
@@ -1769,7 +2135,11 @@ struct dinServiceDiscoveryResType {
 struct dinSignatureType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinSignatureType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -1778,7 +2148,11 @@ struct dinSignatureType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":SignatureValue, Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureValueType',  base type name='base64Binary',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 	struct dinSignatureValueType SignatureValue ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":KeyInfo, Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyInfoType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":KeyName|"http://www.w3.org/2000/09/xmldsig#":KeyValue|"http://www.w3.org/2000/09/xmldsig#":RetrievalMethod|"http://www.w3.org/2000/09/xmldsig#":X509Data|"http://www.w3.org/2000/09/xmldsig#":PGPData|"http://www.w3.org/2000/09/xmldsig#":SPKIData|"http://www.w3.org/2000/09/xmldsig#":MgmtData|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct dinKeyInfoType* KeyInfo ;
+#else
 	struct dinKeyInfoType KeyInfo ;
+#endif /* DATABINDING_SLIM */
 	unsigned int KeyInfo_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Object, Complex type name='http://www.w3.org/2000/09/xmldsig#,ObjectType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any])){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 	struct {
@@ -1794,14 +2168,22 @@ struct dinSignatureType {
 struct dinSalesTariffType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,IDREF} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinSalesTariffType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":SalesTariffID, urn:iso:15118:2:2010:MsgDataTypes,SAIDType */
 	int16_t SalesTariffID ;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":SalesTariffDescription, urn:iso:15118:2:2010:MsgDataTypes,tariffDescriptionType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinSalesTariffType_SalesTariffDescription_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  SalesTariffDescription ;
 	unsigned int SalesTariffDescription_isUsed:1;
@@ -1809,7 +2191,11 @@ struct dinSalesTariffType {
 	uint8_t NumEPriceLevels ;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":SalesTariffEntry, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SalesTariffEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2010:MsgDataTypes":TimeInterval),("urn:iso:15118:2:2010:MsgDataTypes":EPriceLevel,"urn:iso:15118:2:2010:MsgDataTypes":ConsumptionCost{0-UNBOUNDED}))',  derivedBy='EXTENSION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct dinSalesTariffEntryType* array;
+#else
 		struct dinSalesTariffEntryType array[dinSalesTariffType_SalesTariffEntry_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} SalesTariffEntry;
 };
@@ -1826,7 +2212,11 @@ struct dinMessageHeaderType {
 	struct dinNotificationType Notification ;
 	unsigned int Notification_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Signature, Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignedInfo,"http://www.w3.org/2000/09/xmldsig#":SignatureValue,"http://www.w3.org/2000/09/xmldsig#":KeyInfo{0-1},"http://www.w3.org/2000/09/xmldsig#":Object{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct dinSignatureType* Signature ;
+#else
 	struct dinSignatureType Signature ;
+#endif /* DATABINDING_SLIM */
 	unsigned int Signature_isUsed:1;
 };
 
@@ -1846,7 +2236,11 @@ struct dinSAScheduleTupleType {
 struct dinSAScheduleListType {
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":SAScheduleTuple, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SAScheduleTupleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":SAScheduleTupleID,"urn:iso:15118:2:2010:MsgDataTypes":PMaxSchedule,"urn:iso:15118:2:2010:MsgDataTypes":SalesTariff{0-1})',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct dinSAScheduleTupleType* array;
+#else
 		struct dinSAScheduleTupleType array[dinSAScheduleListType_SAScheduleTuple_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} SAScheduleTuple;
 };
@@ -1870,7 +2264,11 @@ struct dinChargeParameterDiscoveryResType {
 	struct dinAC_EVSEChargeParameterType AC_EVSEChargeParameter ;
 	unsigned int AC_EVSEChargeParameter_isUsed:1;
 	/* element: "urn:iso:15118:2:2010:MsgDataTypes":DC_EVSEChargeParameter, Complex type name='urn:iso:15118:2:2010:MsgDataTypes,DC_EVSEChargeParameterType',  base type name='EVSEChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":DC_EVSEStatus,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaximumCurrentLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaximumPowerLimit{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaximumVoltageLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMinimumCurrentLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMinimumVoltageLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVSECurrentRegulationTolerance{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVSEPeakCurrentRipple,"urn:iso:15118:2:2010:MsgDataTypes":EVSEEnergyToBeDelivered{0-1})',  derivedBy='EXTENSION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct dinDC_EVSEChargeParameterType* DC_EVSEChargeParameter ;
+#else
 	struct dinDC_EVSEChargeParameterType DC_EVSEChargeParameter ;
+#endif /* DATABINDING_SLIM */
 	unsigned int DC_EVSEChargeParameter_isUsed:1;
 };
 
@@ -2065,7 +2463,11 @@ struct dinEXIDocument {
 	struct dinTransformType Transform ;
 	struct dinPGPDataType PGPData ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIDocument_MgmtData_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MgmtData ;
 	struct dinSignatureMethodType SignatureMethod ;
@@ -2074,11 +2476,19 @@ struct dinEXIDocument {
 	struct dinX509DataType X509Data ;
 	struct dinSignatureValueType SignatureValue ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIDocument_KeyName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  KeyName ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIDocument_DigestValue_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DigestValue ;
 	struct dinSignedInfoType SignedInfo ;
@@ -2249,7 +2659,11 @@ struct dinEXIFragment {
 	struct dinPhysicalValueType EVSEMaximumVoltageLimit ;
 	struct dinSelectedServiceType SelectedService ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Certificate ;
 	struct dinPhysicalValueType EVSEMaximumPowerLimit ;
@@ -2263,7 +2677,11 @@ struct dinEXIFragment {
 	int8_t Multiplier ;
 	uint8_t EPriceLevel ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_stringValue_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  stringValue ;
 	struct dinServiceDiscoveryReqType ServiceDiscoveryReq ;
@@ -2271,7 +2689,11 @@ struct dinEXIFragment {
 	struct dinMeteringReceiptResType MeteringReceiptRes ;
 	struct dinPreChargeReqType PreChargeReq ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_OEMProvisioningCert_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  OEMProvisioningCert ;
 	struct dinServiceDiscoveryResType ServiceDiscoveryRes ;
@@ -2282,7 +2704,11 @@ struct dinEXIFragment {
 	int64_t HMACOutputLength ;
 	int BulkChargingComplete ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_Exponent_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Exponent ;
 	struct dinDC_EVStatusType DC_EVStatus ;
@@ -2301,7 +2727,11 @@ struct dinEXIFragment {
 	struct dinPMaxScheduleType PMaxSchedule ;
 	struct dinServiceChargeType ServiceCharge ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_PgenCounter_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PgenCounter ;
 	struct dinChargingStatusReqType ChargingStatusReq ;
@@ -2321,7 +2751,11 @@ struct dinEXIFragment {
 	}  EVCCID ;
 	struct dinPGPDataType PGPData ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_RootCertificateID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  RootCertificateID ;
 	dinfaultCodeType FaultCode ;
@@ -2334,11 +2768,19 @@ struct dinEXIFragment {
 	struct dinSignaturePropertyType SignatureProperty ;
 	struct dinPhysicalValueType EVMaxCurrent ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_PGPKeyPacket_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PGPKeyPacket ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_Seed_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Seed ;
 	struct dinRSAKeyValueType RSAKeyValue ;
@@ -2351,14 +2793,22 @@ struct dinEXIFragment {
 	struct dinPowerDeliveryReqType PowerDeliveryReq ;
 	struct dinSessionStopType SessionStopReq ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_XPath_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  XPath ;
 	int8_t BulkSOC ;
 	int16_t PMax ;
 	int16_t ParameterSetID ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_ContractID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ContractID ;
 	struct dinSignatureType Signature ;
@@ -2373,7 +2823,11 @@ struct dinEXIFragment {
 	struct dinPaymentDetailsResType PaymentDetailsRes ;
 	struct dinPaymentDetailsReqType PaymentDetailsReq ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_MgmtData_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MgmtData ;
 	int16_t Value ;
@@ -2388,24 +2842,44 @@ struct dinEXIFragment {
 	int PowerSwitchClosed ;
 	struct dinManifestType Manifest ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_P_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  P ;
 	struct dinSAScheduleListType SAScheduleList ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_Q_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Q ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_X509SubjectName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  X509SubjectName ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_G_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  G ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_J_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  J ;
 	struct dinCertificateInstallationResType CertificateInstallationRes ;
@@ -2414,25 +2888,45 @@ struct dinEXIFragment {
 	struct dinMessageHeaderType Header ;
 	struct dinPhysicalValueType EVSEMinimumCurrentLimit ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_X509CRL_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  X509CRL ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_Y_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Y ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_DigestValue_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DigestValue ;
 	struct dinDC_EVChargeParameterType DC_EVChargeParameter ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_ContractSignatureEncryptedPrivateKey_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  ContractSignatureEncryptedPrivateKey ;
 	struct dinDigestMethodType DigestMethod ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_SPKISexp_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  SPKISexp ;
 	struct dinServiceChargeType ChargeService ;
@@ -2442,11 +2936,19 @@ struct dinEXIFragment {
 	struct dinEVSEStatusType EVSEStatus ;
 	struct dinServiceType Service ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_DHParams_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DHParams ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_PGPKeyID_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PGPKeyID ;
 	struct dinDSAKeyValueType DSAKeyValue ;
@@ -2458,7 +2960,11 @@ struct dinEXIFragment {
 	struct dinPhysicalValueType EVTargetVoltage ;
 	struct dinCanonicalizationMethodType CanonicalizationMethod ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_X509Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  X509Certificate ;
 	struct dinCertificateUpdateResType CertificateUpdateRes ;
@@ -2487,7 +2993,11 @@ struct dinEXIFragment {
 	int32_t intValue ;
 	dinpaymentOptionType SelectedPaymentOption ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_ServiceName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ServiceName ;
 	int EVCabinConditioning ;
@@ -2496,29 +3006,49 @@ struct dinEXIFragment {
 		uint16_t bytesLen;
 	}  EVSEID ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_ServiceScope_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ServiceScope ;
 	int16_t MeterStatus ;
 	dinEVRequestedEnergyTransferType EVRequestedEnergyTransferType ;
 	dinserviceCategoryType ServiceCategory ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_GenChallenge_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  GenChallenge ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_SalesTariffDescription_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  SalesTariffDescription ;
 	uint32_t NotificationMaxDelay ;
 	int boolValue ;
 	dinDC_EVSEStatusCodeType EVSEStatusCode ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_FaultMsg_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  FaultMsg ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_KeyName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  KeyName ;
 	struct dinParameterSetType ParameterSet ;
@@ -2536,7 +3066,11 @@ struct dinEXIFragment {
 	struct dinSubCertificatesType SubCertificates ;
 	dinpaymentOptionType PaymentOption ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_X509SKI_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  X509SKI ;
 	struct dinServiceTagListType ServiceList ;
@@ -2549,7 +3083,11 @@ struct dinEXIFragment {
 	struct dinEVChargeParameterType EVChargeParameter ;
 	uint32_t start ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_X509IssuerName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  X509IssuerName ;
 	struct dinReferenceType Reference ;
@@ -2561,7 +3099,11 @@ struct dinEXIFragment {
 	struct dinEntryType Entry ;
 	int16_t SalesTariffID ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[dinEXIFragment_MeterID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MeterID ;
 	struct dinChargeParameterDiscoveryReqType ChargeParameterDiscoveryReq ;
@@ -2573,7 +3115,11 @@ struct dinEXIFragment {
 	struct dinNotificationType Notification ;
 	uint32_t startValue ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[dinEXIFragment_Modulus_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Modulus ;
 #if SAVE_MEMORY_WITH_UNNAMED_UNION == UNION_YES
@@ -2820,97 +3366,173 @@ void init_dinEXIDocument(struct dinEXIDocument* exiDoc);
 #if DEPLOY_DIN_CODEC_FRAGMENT == SUPPORT_YES
 void init_dinEXIFragment(struct dinEXIFragment* exiFrag);
 #endif /* DEPLOY_DIN_CODEC_FRAGMENT */
+#if DIN_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 void init_dinMeteringReceiptReqType(struct dinMeteringReceiptReqType* dinMeteringReceiptReqType);
+#endif /* DIN_DEPLOY_MeteringReceiptReq */
 void init_dinBodyType(struct dinBodyType* dinBodyType);
+#if DIN_DEPLOY_SessionSetupReq == SUPPORT_YES
 void init_dinSessionSetupReqType(struct dinSessionSetupReqType* dinSessionSetupReqType);
+#endif /* DIN_DEPLOY_SessionSetupReq */
+#if DIN_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 void init_dinPowerDeliveryResType(struct dinPowerDeliveryResType* dinPowerDeliveryResType);
+#endif /* DIN_DEPLOY_PowerDeliveryRes */
+#if DIN_DEPLOY_ServiceDetailRes == SUPPORT_YES
 void init_dinServiceDetailResType(struct dinServiceDetailResType* dinServiceDetailResType);
+#endif /* DIN_DEPLOY_ServiceDetailRes */
+#if DIN_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 void init_dinWeldingDetectionResType(struct dinWeldingDetectionResType* dinWeldingDetectionResType);
+#endif /* DIN_DEPLOY_WeldingDetectionRes */
+#if DIN_DEPLOY_ContractAuthenticationRes == SUPPORT_YES
 void init_dinContractAuthenticationResType(struct dinContractAuthenticationResType* dinContractAuthenticationResType);
+#endif /* DIN_DEPLOY_ContractAuthenticationRes */
 void init_dinCanonicalizationMethodType(struct dinCanonicalizationMethodType* dinCanonicalizationMethodType);
 void init_dinSPKIDataType(struct dinSPKIDataType* dinSPKIDataType);
 void init_dinListOfRootCertificateIDsType(struct dinListOfRootCertificateIDsType* dinListOfRootCertificateIDsType);
 void init_dinSelectedServiceListType(struct dinSelectedServiceListType* dinSelectedServiceListType);
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
 void init_dinCurrentDemandResType(struct dinCurrentDemandResType* dinCurrentDemandResType);
+#endif /* DIN_DEPLOY_CurrentDemandRes */
 void init_dinTransformType(struct dinTransformType* dinTransformType);
 void init_dinAC_EVChargeParameterType(struct dinAC_EVChargeParameterType* dinAC_EVChargeParameterType);
 void init_dinX509DataType(struct dinX509DataType* dinX509DataType);
+#if DIN_DEPLOY_ChargingStatusRes == SUPPORT_YES
 void init_dinChargingStatusResType(struct dinChargingStatusResType* dinChargingStatusResType);
+#endif /* DIN_DEPLOY_ChargingStatusRes */
+#if DIN_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 void init_dinWeldingDetectionReqType(struct dinWeldingDetectionReqType* dinWeldingDetectionReqType);
+#endif /* DIN_DEPLOY_WeldingDetectionReq */
+#if DIN_DEPLOY_SignatureProperties == SUPPORT_YES
 void init_dinSignaturePropertiesType(struct dinSignaturePropertiesType* dinSignaturePropertiesType);
+#endif /* DIN_DEPLOY_SignatureProperties */
+#if DIN_DEPLOY_ContractAuthenticationReq == SUPPORT_YES
 void init_dinContractAuthenticationReqType(struct dinContractAuthenticationReqType* dinContractAuthenticationReqType);
+#endif /* DIN_DEPLOY_ContractAuthenticationReq */
 void init_dinDC_EVPowerDeliveryParameterType(struct dinDC_EVPowerDeliveryParameterType* dinDC_EVPowerDeliveryParameterType);
 void init_dinEVSEChargeParameterType(struct dinEVSEChargeParameterType* dinEVSEChargeParameterType);
+#if DIN_DEPLOY_CableCheckReq == SUPPORT_YES
 void init_dinCableCheckReqType(struct dinCableCheckReqType* dinCableCheckReqType);
+#endif /* DIN_DEPLOY_CableCheckReq */
 void init_dinDC_EVChargeParameterType(struct dinDC_EVChargeParameterType* dinDC_EVChargeParameterType);
 void init_dinSAScheduleListType(struct dinSAScheduleListType* dinSAScheduleListType);
 void init_dinPMaxScheduleType(struct dinPMaxScheduleType* dinPMaxScheduleType);
+#if DIN_DEPLOY_ServicePaymentSelectionReq == SUPPORT_YES
 void init_dinServicePaymentSelectionReqType(struct dinServicePaymentSelectionReqType* dinServicePaymentSelectionReqType);
+#endif /* DIN_DEPLOY_ServicePaymentSelectionReq */
 void init_dinRelativeTimeIntervalType(struct dinRelativeTimeIntervalType* dinRelativeTimeIntervalType);
+#if DIN_DEPLOY_EVStatus == SUPPORT_YES
 void init_dinEVStatusType(struct dinEVStatusType* dinEVStatusType);
+#endif /* DIN_DEPLOY_EVStatus */
+#if DIN_DEPLOY_PreChargeRes == SUPPORT_YES
 void init_dinPreChargeResType(struct dinPreChargeResType* dinPreChargeResType);
+#endif /* DIN_DEPLOY_PreChargeRes */
 void init_dinDC_EVSEChargeParameterType(struct dinDC_EVSEChargeParameterType* dinDC_EVSEChargeParameterType);
+#if DIN_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 void init_dinPaymentDetailsResType(struct dinPaymentDetailsResType* dinPaymentDetailsResType);
+#endif /* DIN_DEPLOY_PaymentDetailsRes */
 void init_dinDSAKeyValueType(struct dinDSAKeyValueType* dinDSAKeyValueType);
 void init_dinSASchedulesType(struct dinSASchedulesType* dinSASchedulesType);
+#if DIN_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 void init_dinCertificateUpdateResType(struct dinCertificateUpdateResType* dinCertificateUpdateResType);
+#endif /* DIN_DEPLOY_CertificateUpdateRes */
 void init_dinEVChargeParameterType(struct dinEVChargeParameterType* dinEVChargeParameterType);
 void init_dinMessageHeaderType(struct dinMessageHeaderType* dinMessageHeaderType);
+#if DIN_DEPLOY_BodyElement == SUPPORT_YES
 void init_dinBodyBaseType(struct dinBodyBaseType* dinBodyBaseType);
+#endif /* DIN_DEPLOY_BodyElement */
 void init_dinKeyValueType(struct dinKeyValueType* dinKeyValueType);
 void init_dinIntervalType(struct dinIntervalType* dinIntervalType);
+#if DIN_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 void init_dinChargeParameterDiscoveryResType(struct dinChargeParameterDiscoveryResType* dinChargeParameterDiscoveryResType);
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryRes */
+#if DIN_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 void init_dinPowerDeliveryReqType(struct dinPowerDeliveryReqType* dinPowerDeliveryReqType);
+#endif /* DIN_DEPLOY_PowerDeliveryReq */
 void init_dinCertificateChainType(struct dinCertificateChainType* dinCertificateChainType);
 void init_dinTransformsType(struct dinTransformsType* dinTransformsType);
+#if DIN_DEPLOY_Entry == SUPPORT_YES
 void init_dinEntryType(struct dinEntryType* dinEntryType);
+#endif /* DIN_DEPLOY_Entry */
+#if DIN_DEPLOY_SessionStopReq == SUPPORT_YES
 void init_dinSessionStopType(struct dinSessionStopType* dinSessionStopType);
+#endif /* DIN_DEPLOY_SessionStopReq */
+#if DIN_DEPLOY_ServiceDetailReq == SUPPORT_YES
 void init_dinServiceDetailReqType(struct dinServiceDetailReqType* dinServiceDetailReqType);
+#endif /* DIN_DEPLOY_ServiceDetailReq */
 void init_dinDigestMethodType(struct dinDigestMethodType* dinDigestMethodType);
 void init_dinParameterType(struct dinParameterType* dinParameterType);
+#if DIN_DEPLOY_ChargingStatusReq == SUPPORT_YES
 void init_dinChargingStatusReqType(struct dinChargingStatusReqType* dinChargingStatusReqType);
+#endif /* DIN_DEPLOY_ChargingStatusReq */
 void init_dinSignatureMethodType(struct dinSignatureMethodType* dinSignatureMethodType);
+#if DIN_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 void init_dinCertificateInstallationReqType(struct dinCertificateInstallationReqType* dinCertificateInstallationReqType);
+#endif /* DIN_DEPLOY_CertificateInstallationReq */
 void init_dinSalesTariffEntryType(struct dinSalesTariffEntryType* dinSalesTariffEntryType);
+#if DIN_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 void init_dinServiceDiscoveryResType(struct dinServiceDiscoveryResType* dinServiceDiscoveryResType);
+#endif /* DIN_DEPLOY_ServiceDiscoveryRes */
 void init_dinParameterSetType(struct dinParameterSetType* dinParameterSetType);
+#if DIN_DEPLOY_CurrentDemandReq == SUPPORT_YES
 void init_dinCurrentDemandReqType(struct dinCurrentDemandReqType* dinCurrentDemandReqType);
+#endif /* DIN_DEPLOY_CurrentDemandReq */
+#if DIN_DEPLOY_PreChargeReq == SUPPORT_YES
 void init_dinPreChargeReqType(struct dinPreChargeReqType* dinPreChargeReqType);
+#endif /* DIN_DEPLOY_PreChargeReq */
 void init_dinSignatureType(struct dinSignatureType* dinSignatureType);
 void init_dinReferenceType(struct dinReferenceType* dinReferenceType);
 void init_dinProfileEntryType(struct dinProfileEntryType* dinProfileEntryType);
 void init_dinAnonType_V2G_Message(struct dinAnonType_V2G_Message* dinAnonType_V2G_Message);
+#if DIN_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 void init_dinChargeParameterDiscoveryReqType(struct dinChargeParameterDiscoveryReqType* dinChargeParameterDiscoveryReqType);
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryReq */
 void init_dinConsumptionCostType(struct dinConsumptionCostType* dinConsumptionCostType);
 void init_dinRSAKeyValueType(struct dinRSAKeyValueType* dinRSAKeyValueType);
 void init_dinServiceType(struct dinServiceType* dinServiceType);
 void init_dinServiceTagListType(struct dinServiceTagListType* dinServiceTagListType);
 void init_dinEVSEStatusType(struct dinEVSEStatusType* dinEVSEStatusType);
+#if DIN_DEPLOY_SessionSetupRes == SUPPORT_YES
 void init_dinSessionSetupResType(struct dinSessionSetupResType* dinSessionSetupResType);
+#endif /* DIN_DEPLOY_SessionSetupRes */
 void init_dinEVPowerDeliveryParameterType(struct dinEVPowerDeliveryParameterType* dinEVPowerDeliveryParameterType);
 void init_dinX509IssuerSerialType(struct dinX509IssuerSerialType* dinX509IssuerSerialType);
 void init_dinSelectedServiceType(struct dinSelectedServiceType* dinSelectedServiceType);
+#if DIN_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 void init_dinMeteringReceiptResType(struct dinMeteringReceiptResType* dinMeteringReceiptResType);
+#endif /* DIN_DEPLOY_MeteringReceiptRes */
 void init_dinDC_EVStatusType(struct dinDC_EVStatusType* dinDC_EVStatusType);
 void init_dinPhysicalValueType(struct dinPhysicalValueType* dinPhysicalValueType);
+#if DIN_DEPLOY_Manifest == SUPPORT_YES
 void init_dinManifestType(struct dinManifestType* dinManifestType);
+#endif /* DIN_DEPLOY_Manifest */
 void init_dinPMaxScheduleEntryType(struct dinPMaxScheduleEntryType* dinPMaxScheduleEntryType);
 void init_dinServiceParameterListType(struct dinServiceParameterListType* dinServiceParameterListType);
 void init_dinSignatureValueType(struct dinSignatureValueType* dinSignatureValueType);
 void init_dinPaymentOptionsType(struct dinPaymentOptionsType* dinPaymentOptionsType);
 void init_dinServiceTagType(struct dinServiceTagType* dinServiceTagType);
 void init_dinAC_EVSEStatusType(struct dinAC_EVSEStatusType* dinAC_EVSEStatusType);
+#if DIN_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 void init_dinCertificateUpdateReqType(struct dinCertificateUpdateReqType* dinCertificateUpdateReqType);
+#endif /* DIN_DEPLOY_CertificateUpdateReq */
+#if DIN_DEPLOY_ServicePaymentSelectionRes == SUPPORT_YES
 void init_dinServicePaymentSelectionResType(struct dinServicePaymentSelectionResType* dinServicePaymentSelectionResType);
+#endif /* DIN_DEPLOY_ServicePaymentSelectionRes */
 void init_dinSAScheduleTupleType(struct dinSAScheduleTupleType* dinSAScheduleTupleType);
 void init_dinChargingProfileType(struct dinChargingProfileType* dinChargingProfileType);
+#if DIN_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 void init_dinServiceDiscoveryReqType(struct dinServiceDiscoveryReqType* dinServiceDiscoveryReqType);
+#endif /* DIN_DEPLOY_ServiceDiscoveryReq */
 void init_dinAC_EVSEChargeParameterType(struct dinAC_EVSEChargeParameterType* dinAC_EVSEChargeParameterType);
 void init_dinKeyInfoType(struct dinKeyInfoType* dinKeyInfoType);
+#if DIN_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 void init_dinPaymentDetailsReqType(struct dinPaymentDetailsReqType* dinPaymentDetailsReqType);
+#endif /* DIN_DEPLOY_PaymentDetailsReq */
+#if DIN_DEPLOY_CableCheckRes == SUPPORT_YES
 void init_dinCableCheckResType(struct dinCableCheckResType* dinCableCheckResType);
+#endif /* DIN_DEPLOY_CableCheckRes */
 void init_dinObjectType(struct dinObjectType* dinObjectType);
+#if DIN_DEPLOY_SessionStopRes == SUPPORT_YES
 void init_dinSessionStopResType(struct dinSessionStopResType* dinSessionStopResType);
+#endif /* DIN_DEPLOY_SessionStopRes */
 void init_dinSignedInfoType(struct dinSignedInfoType* dinSignedInfoType);
 void init_dinSalesTariffType(struct dinSalesTariffType* dinSalesTariffType);
 void init_dinCostType(struct dinCostType* dinCostType);
@@ -2919,7 +3541,9 @@ void init_dinDC_EVSEStatusType(struct dinDC_EVSEStatusType* dinDC_EVSEStatusType
 void init_dinRetrievalMethodType(struct dinRetrievalMethodType* dinRetrievalMethodType);
 void init_dinNotificationType(struct dinNotificationType* dinNotificationType);
 void init_dinPGPDataType(struct dinPGPDataType* dinPGPDataType);
+#if DIN_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 void init_dinCertificateInstallationResType(struct dinCertificateInstallationResType* dinCertificateInstallationResType);
+#endif /* DIN_DEPLOY_CertificateInstallationRes */
 void init_dinSignaturePropertyType(struct dinSignaturePropertyType* dinSignaturePropertyType);
 void init_dinMeterInfoType(struct dinMeterInfoType* dinMeterInfoType);
 void init_dinSubCertificatesType(struct dinSubCertificatesType* dinSubCertificatesType);
@@ -34,6 +34,8 @@
 
 #include "DecoderChannel.h"
 #include "EXIHeaderDecoder.h"
+#include "GrammarDecoder.h"
+#include "MemoryArena.h"
 
 #include "dinEXIDatatypes.h"
 #include "ErrorCodes.h"
@@ -46,103 +48,176 @@ extern void debugAddStringAndInt(char *s, int i);
 
 #if DEPLOY_DIN_CODEC == SUPPORT_YES
 
-/** event-code */
-static uint32_t eventCode;
-static int errn;
-static uint32_t uint32;
+/* Note: eventCode, errn and uint32 are locals of each decode function (reentrant decoding) */
 
 /* Forward Declarations */
+#if DIN_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 static int decode_dinMeteringReceiptReqType(bitstream_t* stream, struct dinMeteringReceiptReqType* dinMeteringReceiptReqType);
+#endif /* DIN_DEPLOY_MeteringReceiptReq */
 static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyType);
+#if DIN_DEPLOY_SessionSetupReq == SUPPORT_YES
 static int decode_dinSessionSetupReqType(bitstream_t* stream, struct dinSessionSetupReqType* dinSessionSetupReqType);
+#endif /* DIN_DEPLOY_SessionSetupReq */
+#if DIN_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 static int decode_dinPowerDeliveryResType(bitstream_t* stream, struct dinPowerDeliveryResType* dinPowerDeliveryResType);
+#endif /* DIN_DEPLOY_PowerDeliveryRes */
+#if DIN_DEPLOY_ServiceDetailRes == SUPPORT_YES
 static int decode_dinServiceDetailResType(bitstream_t* stream, struct dinServiceDetailResType* dinServiceDetailResType);
+#endif /* DIN_DEPLOY_ServiceDetailRes */
+#if DIN_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 static int decode_dinWeldingDetectionResType(bitstream_t* stream, struct dinWeldingDetectionResType* dinWeldingDetectionResType);
+#endif /* DIN_DEPLOY_WeldingDetectionRes */
+#if DIN_DEPLOY_ContractAuthenticationRes == SUPPORT_YES
 static int decode_dinContractAuthenticationResType(bitstream_t* stream, struct dinContractAuthenticationResType* dinContractAuthenticationResType);
+#endif /* DIN_DEPLOY_ContractAuthenticationRes */
 static int decode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinCanonicalizationMethodType* dinCanonicalizationMethodType);
 static int decode_dinSPKIDataType(bitstream_t* stream, struct dinSPKIDataType* dinSPKIDataType);
 static int decode_dinListOfRootCertificateIDsType(bitstream_t* stream, struct dinListOfRootCertificateIDsType* dinListOfRootCertificateIDsType);
 static int decode_dinSelectedServiceListType(bitstream_t* stream, struct dinSelectedServiceListType* dinSelectedServiceListType);
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
 static int decode_dinCurrentDemandResType(bitstream_t* stream, struct dinCurrentDemandResType* dinCurrentDemandResType);
+#endif /* DIN_DEPLOY_CurrentDemandRes */
 static int decode_dinTransformType(bitstream_t* stream, struct dinTransformType* dinTransformType);
 static int decode_dinAC_EVChargeParameterType(bitstream_t* stream, struct dinAC_EVChargeParameterType* dinAC_EVChargeParameterType);
 static int decode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* dinX509DataType);
+#if DIN_DEPLOY_ChargingStatusRes == SUPPORT_YES
 static int decode_dinChargingStatusResType(bitstream_t* stream, struct dinChargingStatusResType* dinChargingStatusResType);
+#endif /* DIN_DEPLOY_ChargingStatusRes */
+#if DIN_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 static int decode_dinWeldingDetectionReqType(bitstream_t* stream, struct dinWeldingDetectionReqType* dinWeldingDetectionReqType);
+#endif /* DIN_DEPLOY_WeldingDetectionReq */
+#if DIN_DEPLOY_SignatureProperties == SUPPORT_YES
 static int decode_dinSignaturePropertiesType(bitstream_t* stream, struct dinSignaturePropertiesType* dinSignaturePropertiesType);
+#endif /* DIN_DEPLOY_SignatureProperties */
+#if DIN_DEPLOY_ContractAuthenticationReq == SUPPORT_YES
 static int decode_dinContractAuthenticationReqType(bitstream_t* stream, struct dinContractAuthenticationReqType* dinContractAuthenticationReqType);
+#endif /* DIN_DEPLOY_ContractAuthenticationReq */
 static int decode_dinDC_EVPowerDeliveryParameterType(bitstream_t* stream, struct dinDC_EVPowerDeliveryParameterType* dinDC_EVPowerDeliveryParameterType);
 static int decode_dinEVSEChargeParameterType(bitstream_t* stream, struct dinEVSEChargeParameterType* dinEVSEChargeParameterType);
+#if DIN_DEPLOY_CableCheckReq == SUPPORT_YES
 static int decode_dinCableCheckReqType(bitstream_t* stream, struct dinCableCheckReqType* dinCableCheckReqType);
+#endif /* DIN_DEPLOY_CableCheckReq */
 static int decode_dinDC_EVChargeParameterType(bitstream_t* stream, struct dinDC_EVChargeParameterType* dinDC_EVChargeParameterType);
 static int decode_dinSAScheduleListType(bitstream_t* stream, struct dinSAScheduleListType* dinSAScheduleListType);
 static int decode_dinPMaxScheduleType(bitstream_t* stream, struct dinPMaxScheduleType* dinPMaxScheduleType);
+#if DIN_DEPLOY_ServicePaymentSelectionReq == SUPPORT_YES
 static int decode_dinServicePaymentSelectionReqType(bitstream_t* stream, struct dinServicePaymentSelectionReqType* dinServicePaymentSelectionReqType);
+#endif /* DIN_DEPLOY_ServicePaymentSelectionReq */
 static int decode_dinRelativeTimeIntervalType(bitstream_t* stream, struct dinRelativeTimeIntervalType* dinRelativeTimeIntervalType);
+#if DIN_DEPLOY_EVStatus == SUPPORT_YES
 static int decode_dinEVStatusType(bitstream_t* stream, struct dinEVStatusType* dinEVStatusType);
+#endif /* DIN_DEPLOY_EVStatus */
+#if DIN_DEPLOY_PreChargeRes == SUPPORT_YES
 static int decode_dinPreChargeResType(bitstream_t* stream, struct dinPreChargeResType* dinPreChargeResType);
+#endif /* DIN_DEPLOY_PreChargeRes */
 static int decode_dinDC_EVSEChargeParameterType(bitstream_t* stream, struct dinDC_EVSEChargeParameterType* dinDC_EVSEChargeParameterType);
+#if DIN_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 static int decode_dinPaymentDetailsResType(bitstream_t* stream, struct dinPaymentDetailsResType* dinPaymentDetailsResType);
+#endif /* DIN_DEPLOY_PaymentDetailsRes */
 static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueType* dinDSAKeyValueType);
 static int decode_dinSASchedulesType(bitstream_t* stream, struct dinSASchedulesType* dinSASchedulesType);
+#if DIN_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 static int decode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCertificateUpdateResType* dinCertificateUpdateResType);
+#endif /* DIN_DEPLOY_CertificateUpdateRes */
 static int decode_dinEVChargeParameterType(bitstream_t* stream, struct dinEVChargeParameterType* dinEVChargeParameterType);
 static int decode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHeaderType* dinMessageHeaderType);
+#if DIN_DEPLOY_BodyElement == SUPPORT_YES
 static int decode_dinBodyBaseType(bitstream_t* stream, struct dinBodyBaseType* dinBodyBaseType);
+#endif /* DIN_DEPLOY_BodyElement */
 static int decode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* dinKeyValueType);
 static int decode_dinIntervalType(bitstream_t* stream, struct dinIntervalType* dinIntervalType);
+#if DIN_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 static int decode_dinChargeParameterDiscoveryResType(bitstream_t* stream, struct dinChargeParameterDiscoveryResType* dinChargeParameterDiscoveryResType);
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryRes */
+#if DIN_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 static int decode_dinPowerDeliveryReqType(bitstream_t* stream, struct dinPowerDeliveryReqType* dinPowerDeliveryReqType);
+#endif /* DIN_DEPLOY_PowerDeliveryReq */
 static int decode_dinCertificateChainType(bitstream_t* stream, struct dinCertificateChainType* dinCertificateChainType);
 static int decode_dinTransformsType(bitstream_t* stream, struct dinTransformsType* dinTransformsType);
+#if DIN_DEPLOY_Entry == SUPPORT_YES
 static int decode_dinEntryType(bitstream_t* stream, struct dinEntryType* dinEntryType);
+#endif /* DIN_DEPLOY_Entry */
+#if DIN_DEPLOY_SessionStopReq == SUPPORT_YES
 static int decode_dinSessionStopType(bitstream_t* stream, struct dinSessionStopType* dinSessionStopType);
+#endif /* DIN_DEPLOY_SessionStopReq */
+#if DIN_DEPLOY_ServiceDetailReq == SUPPORT_YES
 static int decode_dinServiceDetailReqType(bitstream_t* stream, struct dinServiceDetailReqType* dinServiceDetailReqType);
+#endif /* DIN_DEPLOY_ServiceDetailReq */
 static int decode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMethodType* dinDigestMethodType);
 static int decode_dinParameterType(bitstream_t* stream, struct dinParameterType* dinParameterType);
+#if DIN_DEPLOY_ChargingStatusReq == SUPPORT_YES
 static int decode_dinChargingStatusReqType(bitstream_t* stream, struct dinChargingStatusReqType* dinChargingStatusReqType);
+#endif /* DIN_DEPLOY_ChargingStatusReq */
 static int decode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatureMethodType* dinSignatureMethodType);
+#if DIN_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 static int decode_dinCertificateInstallationReqType(bitstream_t* stream, struct dinCertificateInstallationReqType* dinCertificateInstallationReqType);
+#endif /* DIN_DEPLOY_CertificateInstallationReq */
 static int decode_dinSalesTariffEntryType(bitstream_t* stream, struct dinSalesTariffEntryType* dinSalesTariffEntryType);
+#if DIN_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 static int decode_dinServiceDiscoveryResType(bitstream_t* stream, struct dinServiceDiscoveryResType* dinServiceDiscoveryResType);
+#endif /* DIN_DEPLOY_ServiceDiscoveryRes */
 static int decode_dinParameterSetType(bitstream_t* stream, struct dinParameterSetType* dinParameterSetType);
+#if DIN_DEPLOY_CurrentDemandReq == SUPPORT_YES
 static int decode_dinCurrentDemandReqType(bitstream_t* stream, struct dinCurrentDemandReqType* dinCurrentDemandReqType);
+#endif /* DIN_DEPLOY_CurrentDemandReq */
+#if DIN_DEPLOY_PreChargeReq == SUPPORT_YES
 static int decode_dinPreChargeReqType(bitstream_t* stream, struct dinPreChargeReqType* dinPreChargeReqType);
+#endif /* DIN_DEPLOY_PreChargeReq */
 static int decode_dinSignatureType(bitstream_t* stream, struct dinSignatureType* dinSignatureType);
 static int decode_dinReferenceType(bitstream_t* stream, struct dinReferenceType* dinReferenceType);
 static int decode_dinProfileEntryType(bitstream_t* stream, struct dinProfileEntryType* dinProfileEntryType);
 static int decode_dinAnonType_V2G_Message(bitstream_t* stream, struct dinAnonType_V2G_Message* dinAnonType_V2G_Message);
+#if DIN_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 static int decode_dinChargeParameterDiscoveryReqType(bitstream_t* stream, struct dinChargeParameterDiscoveryReqType* dinChargeParameterDiscoveryReqType);
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryReq */
 static int decode_dinConsumptionCostType(bitstream_t* stream, struct dinConsumptionCostType* dinConsumptionCostType);
 static int decode_dinRSAKeyValueType(bitstream_t* stream, struct dinRSAKeyValueType* dinRSAKeyValueType);
 static int decode_dinServiceType(bitstream_t* stream, struct dinServiceType* dinServiceType);
 static int decode_dinServiceTagListType(bitstream_t* stream, struct dinServiceTagListType* dinServiceTagListType);
 static int decode_dinEVSEStatusType(bitstream_t* stream, struct dinEVSEStatusType* dinEVSEStatusType);
+#if DIN_DEPLOY_SessionSetupRes == SUPPORT_YES
 static int decode_dinSessionSetupResType(bitstream_t* stream, struct dinSessionSetupResType* dinSessionSetupResType);
+#endif /* DIN_DEPLOY_SessionSetupRes */
 static int decode_dinEVPowerDeliveryParameterType(bitstream_t* stream, struct dinEVPowerDeliveryParameterType* dinEVPowerDeliveryParameterType);
 static int decode_dinX509IssuerSerialType(bitstream_t* stream, struct dinX509IssuerSerialType* dinX509IssuerSerialType);
 static int decode_dinSelectedServiceType(bitstream_t* stream, struct dinSelectedServiceType* dinSelectedServiceType);
+#if DIN_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 static int decode_dinMeteringReceiptResType(bitstream_t* stream, struct dinMeteringReceiptResType* dinMeteringReceiptResType);
+#endif /* DIN_DEPLOY_MeteringReceiptRes */
 static int decode_dinDC_EVStatusType(bitstream_t* stream, struct dinDC_EVStatusType* dinDC_EVStatusType);
 static int decode_dinPhysicalValueType(bitstream_t* stream, struct dinPhysicalValueType* dinPhysicalValueType);
+#if DIN_DEPLOY_Manifest == SUPPORT_YES
 static int decode_dinManifestType(bitstream_t* stream, struct dinManifestType* dinManifestType);
+#endif /* DIN_DEPLOY_Manifest */
 static int decode_dinPMaxScheduleEntryType(bitstream_t* stream, struct dinPMaxScheduleEntryType* dinPMaxScheduleEntryType);
 static int decode_dinServiceParameterListType(bitstream_t* stream, struct dinServiceParameterListType* dinServiceParameterListType);
 static int decode_dinSignatureValueType(bitstream_t* stream, struct dinSignatureValueType* dinSignatureValueType);
 static int decode_dinPaymentOptionsType(bitstream_t* stream, struct dinPaymentOptionsType* dinPaymentOptionsType);
 static int decode_dinServiceTagType(bitstream_t* stream, struct dinServiceTagType* dinServiceTagType);
 static int decode_dinAC_EVSEStatusType(bitstream_t* stream, struct dinAC_EVSEStatusType* dinAC_EVSEStatusType);
+#if DIN_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 static int decode_dinCertificateUpdateReqType(bitstream_t* stream, struct dinCertificateUpdateReqType* dinCertificateUpdateReqType);
+#endif /* DIN_DEPLOY_CertificateUpdateReq */
+#if DIN_DEPLOY_ServicePaymentSelectionRes == SUPPORT_YES
 static int decode_dinServicePaymentSelectionResType(bitstream_t* stream, struct dinServicePaymentSelectionResType* dinServicePaymentSelectionResType);
+#endif /* DIN_DEPLOY_ServicePaymentSelectionRes */
 static int decode_dinSAScheduleTupleType(bitstream_t* stream, struct dinSAScheduleTupleType* dinSAScheduleTupleType);
 static int decode_dinChargingProfileType(bitstream_t* stream, struct dinChargingProfileType* dinChargingProfileType);
+#if DIN_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 static int decode_dinServiceDiscoveryReqType(bitstream_t* stream, struct dinServiceDiscoveryReqType* dinServiceDiscoveryReqType);
+#endif /* DIN_DEPLOY_ServiceDiscoveryReq */
 static int decode_dinAC_EVSEChargeParameterType(bitstream_t* stream, struct dinAC_EVSEChargeParameterType* dinAC_EVSEChargeParameterType);
 static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* dinKeyInfoType);
+#if DIN_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 static int decode_dinPaymentDetailsReqType(bitstream_t* stream, struct dinPaymentDetailsReqType* dinPaymentDetailsReqType);
+#endif /* DIN_DEPLOY_PaymentDetailsReq */
+#if DIN_DEPLOY_CableCheckRes == SUPPORT_YES
 static int decode_dinCableCheckResType(bitstream_t* stream, struct dinCableCheckResType* dinCableCheckResType);
+#endif /* DIN_DEPLOY_CableCheckRes */
 static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinObjectType);
+#if DIN_DEPLOY_SessionStopRes == SUPPORT_YES
 static int decode_dinSessionStopResType(bitstream_t* stream, struct dinSessionStopResType* dinSessionStopResType);
+#endif /* DIN_DEPLOY_SessionStopRes */
 static int decode_dinSignedInfoType(bitstream_t* stream, struct dinSignedInfoType* dinSignedInfoType);
 static int decode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffType* dinSalesTariffType);
 static int decode_dinCostType(bitstream_t* stream, struct dinCostType* dinCostType);
@@ -151,16 +226,237 @@ static int decode_dinDC_EVSEStatusType(bitstream_t* stream, struct dinDC_EVSESta
 static int decode_dinRetrievalMethodType(bitstream_t* stream, struct dinRetrievalMethodType* dinRetrievalMethodType);
 static int decode_dinNotificationType(bitstream_t* stream, struct dinNotificationType* dinNotificationType);
 static int decode_dinPGPDataType(bitstream_t* stream, struct dinPGPDataType* dinPGPDataType);
+#if DIN_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 static int decode_dinCertificateInstallationResType(bitstream_t* stream, struct dinCertificateInstallationResType* dinCertificateInstallationResType);
+#endif /* DIN_DEPLOY_CertificateInstallationRes */
 static int decode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignaturePropertyType* dinSignaturePropertyType);
 static int decode_dinMeterInfoType(bitstream_t* stream, struct dinMeterInfoType* dinMeterInfoType);
 static int decode_dinSubCertificatesType(bitstream_t* stream, struct dinSubCertificatesType* dinSubCertificatesType);
 
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+/* type independent signatures for the grammar tables */
+static int decode_dinAC_EVChargeParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinAC_EVChargeParameterType(stream, (struct dinAC_EVChargeParameterType*)value);
+}
+static int decode_dinAC_EVSEChargeParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinAC_EVSEChargeParameterType(stream, (struct dinAC_EVSEChargeParameterType*)value);
+}
+static int decode_dinAC_EVSEStatusTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinAC_EVSEStatusType(stream, (struct dinAC_EVSEStatusType*)value);
+}
+static int decode_dinBodyTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinBodyType(stream, (struct dinBodyType*)value);
+}
+static int decode_dinCanonicalizationMethodTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinCanonicalizationMethodType(stream, (struct dinCanonicalizationMethodType*)value);
+}
+static int decode_dinCertificateChainTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinCertificateChainType(stream, (struct dinCertificateChainType*)value);
+}
+static int decode_dinConsumptionCostTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinConsumptionCostType(stream, (struct dinConsumptionCostType*)value);
+}
+static int decode_dinCostTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinCostType(stream, (struct dinCostType*)value);
+}
+static int decode_dinDC_EVChargeParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinDC_EVChargeParameterType(stream, (struct dinDC_EVChargeParameterType*)value);
+}
+static int decode_dinDC_EVSEChargeParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinDC_EVSEChargeParameterType(stream, (struct dinDC_EVSEChargeParameterType*)value);
+}
+static int decode_dinDC_EVSEStatusTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinDC_EVSEStatusType(stream, (struct dinDC_EVSEStatusType*)value);
+}
+static int decode_dinDC_EVStatusTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinDC_EVStatusType(stream, (struct dinDC_EVStatusType*)value);
+}
+static int decode_dinDSAKeyValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinDSAKeyValueType(stream, (struct dinDSAKeyValueType*)value);
+}
+static int decode_dinDigestMethodTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinDigestMethodType(stream, (struct dinDigestMethodType*)value);
+}
+static int decode_dinEVChargeParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinEVChargeParameterType(stream, (struct dinEVChargeParameterType*)value);
+}
+static int decode_dinEVSEChargeParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinEVSEChargeParameterType(stream, (struct dinEVSEChargeParameterType*)value);
+}
+static int decode_dinEVSEStatusTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinEVSEStatusType(stream, (struct dinEVSEStatusType*)value);
+}
+static int decode_dinIntervalTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinIntervalType(stream, (struct dinIntervalType*)value);
+}
+static int decode_dinKeyInfoTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinKeyInfoType(stream, (struct dinKeyInfoType*)value);
+}
+static int decode_dinKeyValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinKeyValueType(stream, (struct dinKeyValueType*)value);
+}
+static int decode_dinListOfRootCertificateIDsTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinListOfRootCertificateIDsType(stream, (struct dinListOfRootCertificateIDsType*)value);
+}
+static int decode_dinMessageHeaderTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinMessageHeaderType(stream, (struct dinMessageHeaderType*)value);
+}
+static int decode_dinMeterInfoTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinMeterInfoType(stream, (struct dinMeterInfoType*)value);
+}
+static int decode_dinNotificationTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinNotificationType(stream, (struct dinNotificationType*)value);
+}
+static int decode_dinObjectTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinObjectType(stream, (struct dinObjectType*)value);
+}
+static int decode_dinPGPDataTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinPGPDataType(stream, (struct dinPGPDataType*)value);
+}
+static int decode_dinPMaxScheduleEntryTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinPMaxScheduleEntryType(stream, (struct dinPMaxScheduleEntryType*)value);
+}
+static int decode_dinPMaxScheduleTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinPMaxScheduleType(stream, (struct dinPMaxScheduleType*)value);
+}
+static int decode_dinParameterSetTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinParameterSetType(stream, (struct dinParameterSetType*)value);
+}
+static int decode_dinParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinParameterType(stream, (struct dinParameterType*)value);
+}
+static int decode_dinPaymentOptionsTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinPaymentOptionsType(stream, (struct dinPaymentOptionsType*)value);
+}
+static int decode_dinPhysicalValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinPhysicalValueType(stream, (struct dinPhysicalValueType*)value);
+}
+static int decode_dinProfileEntryTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinProfileEntryType(stream, (struct dinProfileEntryType*)value);
+}
+static int decode_dinRSAKeyValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinRSAKeyValueType(stream, (struct dinRSAKeyValueType*)value);
+}
+static int decode_dinReferenceTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinReferenceType(stream, (struct dinReferenceType*)value);
+}
+static int decode_dinRelativeTimeIntervalTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinRelativeTimeIntervalType(stream, (struct dinRelativeTimeIntervalType*)value);
+}
+static int decode_dinRetrievalMethodTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinRetrievalMethodType(stream, (struct dinRetrievalMethodType*)value);
+}
+static int decode_dinSAScheduleListTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSAScheduleListType(stream, (struct dinSAScheduleListType*)value);
+}
+static int decode_dinSAScheduleTupleTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSAScheduleTupleType(stream, (struct dinSAScheduleTupleType*)value);
+}
+static int decode_dinSASchedulesTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSASchedulesType(stream, (struct dinSASchedulesType*)value);
+}
+static int decode_dinSPKIDataTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSPKIDataType(stream, (struct dinSPKIDataType*)value);
+}
+static int decode_dinSalesTariffEntryTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSalesTariffEntryType(stream, (struct dinSalesTariffEntryType*)value);
+}
+static int decode_dinSalesTariffTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSalesTariffType(stream, (struct dinSalesTariffType*)value);
+}
+static int decode_dinSelectedServiceListTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSelectedServiceListType(stream, (struct dinSelectedServiceListType*)value);
+}
+static int decode_dinSelectedServiceTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSelectedServiceType(stream, (struct dinSelectedServiceType*)value);
+}
+static int decode_dinServiceChargeTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinServiceChargeType(stream, (struct dinServiceChargeType*)value);
+}
+static int decode_dinServiceParameterListTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinServiceParameterListType(stream, (struct dinServiceParameterListType*)value);
+}
+static int decode_dinServiceTagListTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinServiceTagListType(stream, (struct dinServiceTagListType*)value);
+}
+static int decode_dinServiceTagTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinServiceTagType(stream, (struct dinServiceTagType*)value);
+}
+static int decode_dinServiceTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinServiceType(stream, (struct dinServiceType*)value);
+}
+static int decode_dinSignatureMethodTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSignatureMethodType(stream, (struct dinSignatureMethodType*)value);
+}
+static int decode_dinSignaturePropertyTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSignaturePropertyType(stream, (struct dinSignaturePropertyType*)value);
+}
+static int decode_dinSignatureTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSignatureType(stream, (struct dinSignatureType*)value);
+}
+static int decode_dinSignatureValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSignatureValueType(stream, (struct dinSignatureValueType*)value);
+}
+static int decode_dinSignedInfoTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSignedInfoType(stream, (struct dinSignedInfoType*)value);
+}
+static int decode_dinSubCertificatesTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinSubCertificatesType(stream, (struct dinSubCertificatesType*)value);
+}
+static int decode_dinTransformTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinTransformType(stream, (struct dinTransformType*)value);
+}
+static int decode_dinTransformsTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinTransformsType(stream, (struct dinTransformsType*)value);
+}
+static int decode_dinX509DataTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinX509DataType(stream, (struct dinX509DataType*)value);
+}
+static int decode_dinX509IssuerSerialTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_dinX509IssuerSerialType(stream, (struct dinX509IssuerSerialType*)value);
+}
+#endif /* GRAMMAR_DECODER_TABLE */
+
 /* Deviant data decoding (skip functions) */
 
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,MeteringReceiptReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":SessionID,"urn:iso:15118:2:2010:MsgBody":SAScheduleTupleID{0-1},"urn:iso:15118:2:2010:MsgBody":MeterInfo)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_MeteringReceiptReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinMeteringReceiptReqTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinMeteringReceiptReqType, Id.characters), offsetof(struct dinMeteringReceiptReqType, Id.charactersLen), dinMeteringReceiptReqType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinMeteringReceiptReqType, SessionID.bytes), offsetof(struct dinMeteringReceiptReqType, SessionID.bytesLen), dinMeteringReceiptReqType_SessionID_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinMeteringReceiptReqType, SAScheduleTupleID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinMeteringReceiptReqType, MeterInfo), 0, 0, 0, decode_dinMeterInfoTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinMeteringReceiptReqTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t dinMeteringReceiptReqTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }, { 5, 1, 1 }, { 6, 1, 1 }
+};
+static void dinMeteringReceiptReqTypeUsed(void* value, uint8_t flag) {
+	struct dinMeteringReceiptReqType* dinMeteringReceiptReqType = (struct dinMeteringReceiptReqType*)value;
+	switch(flag) {
+	case 0:
+		dinMeteringReceiptReqType->Id_isUsed = 1u;
+		break;
+	case 1:
+		dinMeteringReceiptReqType->SAScheduleTupleID_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinMeteringReceiptReqTypeGrammar = { dinMeteringReceiptReqTypeStates, dinMeteringReceiptReqTypeTransitions, dinMeteringReceiptReqTypeProductions, dinMeteringReceiptReqTypeUsed };
+
 static int decode_dinMeteringReceiptReqType(bitstream_t* stream, struct dinMeteringReceiptReqType* dinMeteringReceiptReqType) {
+	init_dinMeteringReceiptReqType(dinMeteringReceiptReqType);
+	return decodeGrammar(stream, &dinMeteringReceiptReqTypeGrammar, dinMeteringReceiptReqType);
+}
+#else
+static int decode_dinMeteringReceiptReqType(bitstream_t* stream, struct dinMeteringReceiptReqType* dinMeteringReceiptReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 0;
 	int done = 0;
 	
@@ -178,10 +474,24 @@ static int decode_dinMeteringReceiptReqType(bitstream_t* stream, struct dinMeter
 					if (errn == 0) {
 						if (dinMeteringReceiptReqType->Id.charactersLen >= 2) {
 							dinMeteringReceiptReqType->Id.charactersLen = (uint16_t)(dinMeteringReceiptReqType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinMeteringReceiptReqType->Id.characters, CHARACTER_UNITS(dinMeteringReceiptReqType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinMeteringReceiptReqType->Id.charactersLen, dinMeteringReceiptReqType->Id.characters, dinMeteringReceiptReqType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinMeteringReceiptReqType->Id.charactersLen, dinMeteringReceiptReqType->Id.characters, dinMeteringReceiptReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinMeteringReceiptReqType->Id.characters, dinMeteringReceiptReqType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinMeteringReceiptReqType->Id.charactersLen, &dinMeteringReceiptReqType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinMeteringReceiptReqType->Id.charactersLen, dinMeteringReceiptReqType->Id.characters, dinMeteringReceiptReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinMeteringReceiptReqType->Id_isUsed = 1u;
@@ -335,9 +645,13 @@ static int decode_dinMeteringReceiptReqType(bitstream_t* stream, struct dinMeter
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_MeteringReceiptReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDef,BodyType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDef":BodyElement{0-1})',  derivedBy='RESTRICTION'.  */
 static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 6;
 	int done = 0;
 	
@@ -350,216 +664,286 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 			errn = decodeNBitUnsignedInteger(stream, 6, &eventCode);
 			if (errn == 0) {
 				switch(eventCode) {
+#if DIN_DEPLOY_BodyElement == SUPPORT_YES
 				case 0:
 					errn = decode_dinBodyBaseType(stream, &dinBodyType->BodyElement);
 					dinBodyType->BodyElement_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_BodyElement */
+#if DIN_DEPLOY_CableCheckReq == SUPPORT_YES
 				case 1:
 					errn = decode_dinCableCheckReqType(stream, &dinBodyType->CableCheckReq);
 					dinBodyType->CableCheckReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_CableCheckReq */
+#if DIN_DEPLOY_CableCheckRes == SUPPORT_YES
 				case 2:
 					errn = decode_dinCableCheckResType(stream, &dinBodyType->CableCheckRes);
 					dinBodyType->CableCheckRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_CableCheckRes */
+#if DIN_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 				case 3:
 					errn = decode_dinCertificateInstallationReqType(stream, &dinBodyType->CertificateInstallationReq);
 					dinBodyType->CertificateInstallationReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_CertificateInstallationReq */
+#if DIN_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 				case 4:
 					errn = decode_dinCertificateInstallationResType(stream, &dinBodyType->CertificateInstallationRes);
 					dinBodyType->CertificateInstallationRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_CertificateInstallationRes */
+#if DIN_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 				case 5:
 					errn = decode_dinCertificateUpdateReqType(stream, &dinBodyType->CertificateUpdateReq);
 					dinBodyType->CertificateUpdateReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_CertificateUpdateReq */
+#if DIN_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 				case 6:
 					errn = decode_dinCertificateUpdateResType(stream, &dinBodyType->CertificateUpdateRes);
 					dinBodyType->CertificateUpdateRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_CertificateUpdateRes */
+#if DIN_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 				case 7:
 					errn = decode_dinChargeParameterDiscoveryReqType(stream, &dinBodyType->ChargeParameterDiscoveryReq);
 					dinBodyType->ChargeParameterDiscoveryReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryReq */
+#if DIN_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 				case 8:
 					errn = decode_dinChargeParameterDiscoveryResType(stream, &dinBodyType->ChargeParameterDiscoveryRes);
 					dinBodyType->ChargeParameterDiscoveryRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryRes */
+#if DIN_DEPLOY_ChargingStatusReq == SUPPORT_YES
 				case 9:
 					errn = decode_dinChargingStatusReqType(stream, &dinBodyType->ChargingStatusReq);
 					dinBodyType->ChargingStatusReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_ChargingStatusReq */
+#if DIN_DEPLOY_ChargingStatusRes == SUPPORT_YES
 				case 10:
 					errn = decode_dinChargingStatusResType(stream, &dinBodyType->ChargingStatusRes);
 					dinBodyType->ChargingStatusRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_ChargingStatusRes */
+#if DIN_DEPLOY_ContractAuthenticationReq == SUPPORT_YES
 				case 11:
 					errn = decode_dinContractAuthenticationReqType(stream, &dinBodyType->ContractAuthenticationReq);
 					dinBodyType->ContractAuthenticationReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_ContractAuthenticationReq */
+#if DIN_DEPLOY_ContractAuthenticationRes == SUPPORT_YES
 				case 12:
 					errn = decode_dinContractAuthenticationResType(stream, &dinBodyType->ContractAuthenticationRes);
 					dinBodyType->ContractAuthenticationRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_ContractAuthenticationRes */
+#if DIN_DEPLOY_CurrentDemandReq == SUPPORT_YES
 				case 13:
 					errn = decode_dinCurrentDemandReqType(stream, &dinBodyType->CurrentDemandReq);
 					dinBodyType->CurrentDemandReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_CurrentDemandReq */
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
 				case 14:
 					errn = decode_dinCurrentDemandResType(stream, &dinBodyType->CurrentDemandRes);
 					dinBodyType->CurrentDemandRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_CurrentDemandRes */
+#if DIN_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 				case 15:
 					errn = decode_dinMeteringReceiptReqType(stream, &dinBodyType->MeteringReceiptReq);
 					dinBodyType->MeteringReceiptReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_MeteringReceiptReq */
+#if DIN_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 				case 16:
 					errn = decode_dinMeteringReceiptResType(stream, &dinBodyType->MeteringReceiptRes);
 					dinBodyType->MeteringReceiptRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_MeteringReceiptRes */
+#if DIN_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 				case 17:
 					errn = decode_dinPaymentDetailsReqType(stream, &dinBodyType->PaymentDetailsReq);
 					dinBodyType->PaymentDetailsReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_PaymentDetailsReq */
+#if DIN_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 				case 18:
 					errn = decode_dinPaymentDetailsResType(stream, &dinBodyType->PaymentDetailsRes);
 					dinBodyType->PaymentDetailsRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_PaymentDetailsRes */
+#if DIN_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 				case 19:
 					errn = decode_dinPowerDeliveryReqType(stream, &dinBodyType->PowerDeliveryReq);
 					dinBodyType->PowerDeliveryReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_PowerDeliveryReq */
+#if DIN_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 				case 20:
 					errn = decode_dinPowerDeliveryResType(stream, &dinBodyType->PowerDeliveryRes);
 					dinBodyType->PowerDeliveryRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_PowerDeliveryRes */
+#if DIN_DEPLOY_PreChargeReq == SUPPORT_YES
 				case 21:
 					errn = decode_dinPreChargeReqType(stream, &dinBodyType->PreChargeReq);
 					dinBodyType->PreChargeReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_PreChargeReq */
+#if DIN_DEPLOY_PreChargeRes == SUPPORT_YES
 				case 22:
 					errn = decode_dinPreChargeResType(stream, &dinBodyType->PreChargeRes);
 					dinBodyType->PreChargeRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_PreChargeRes */
+#if DIN_DEPLOY_ServiceDetailReq == SUPPORT_YES
 				case 23:
 					errn = decode_dinServiceDetailReqType(stream, &dinBodyType->ServiceDetailReq);
 					dinBodyType->ServiceDetailReq_isUsed = 1u;
 					debugAddStringAndInt("Line", __LINE__);
 					grammarID = 4;
 					break;
+#endif /* DIN_DEPLOY_ServiceDetailReq */
+#if DIN_DEPLOY_ServiceDetailRes == SUPPORT_YES
 				case 24:
 					errn = decode_dinServiceDetailResType(stream, &dinBodyType->ServiceDetailRes);
 					dinBodyType->ServiceDetailRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_ServiceDetailRes */
+#if DIN_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 				case 25:
 					errn = decode_dinServiceDiscoveryReqType(stream, &dinBodyType->ServiceDiscoveryReq);
 					dinBodyType->ServiceDiscoveryReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_ServiceDiscoveryReq */
+#if DIN_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 				case 26:
 					errn = decode_dinServiceDiscoveryResType(stream, &dinBodyType->ServiceDiscoveryRes);
 					dinBodyType->ServiceDiscoveryRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_ServiceDiscoveryRes */
+#if DIN_DEPLOY_ServicePaymentSelectionReq == SUPPORT_YES
 				case 27:
 					errn = decode_dinServicePaymentSelectionReqType(stream, &dinBodyType->ServicePaymentSelectionReq);
 					dinBodyType->ServicePaymentSelectionReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_ServicePaymentSelectionReq */
+#if DIN_DEPLOY_ServicePaymentSelectionRes == SUPPORT_YES
 				case 28:
 					errn = decode_dinServicePaymentSelectionResType(stream, &dinBodyType->ServicePaymentSelectionRes);
 					dinBodyType->ServicePaymentSelectionRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_ServicePaymentSelectionRes */
+#if DIN_DEPLOY_SessionSetupReq == SUPPORT_YES
 				case 29:
 					errn = decode_dinSessionSetupReqType(stream, &dinBodyType->SessionSetupReq);
 					dinBodyType->SessionSetupReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_SessionSetupReq */
+#if DIN_DEPLOY_SessionSetupRes == SUPPORT_YES
 				case 30:
 					errn = decode_dinSessionSetupResType(stream, &dinBodyType->SessionSetupRes);
 					dinBodyType->SessionSetupRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_SessionSetupRes */
+#if DIN_DEPLOY_SessionStopReq == SUPPORT_YES
 				case 31:
 					errn = decode_dinSessionStopType(stream, &dinBodyType->SessionStopReq);
 					dinBodyType->SessionStopReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_SessionStopReq */
+#if DIN_DEPLOY_SessionStopRes == SUPPORT_YES
 				case 32:
 					errn = decode_dinSessionStopResType(stream, &dinBodyType->SessionStopRes);
 					dinBodyType->SessionStopRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_SessionStopRes */
+#if DIN_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 				case 33:
 					errn = decode_dinWeldingDetectionReqType(stream, &dinBodyType->WeldingDetectionReq);
 					dinBodyType->WeldingDetectionReq_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_WeldingDetectionReq */
+#if DIN_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 				case 34:
 					errn = decode_dinWeldingDetectionResType(stream, &dinBodyType->WeldingDetectionRes);
 					dinBodyType->WeldingDetectionRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
 					break;
+#endif /* DIN_DEPLOY_WeldingDetectionRes */
 				case 35:
 					done = 1;
 					grammarID = 5;
@@ -599,7 +983,28 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,SessionSetupReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":EVCCID)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_SessionSetupReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinSessionSetupReqTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSessionSetupReqType, EVCCID.bytes), offsetof(struct dinSessionSetupReqType, EVCCID.bytesLen), dinSessionSetupReqType_EVCCID_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSessionSetupReqTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinSessionSetupReqTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t dinSessionSetupReqTypeGrammar = { dinSessionSetupReqTypeStates, dinSessionSetupReqTypeTransitions, dinSessionSetupReqTypeProductions, NULL };
+
 static int decode_dinSessionSetupReqType(bitstream_t* stream, struct dinSessionSetupReqType* dinSessionSetupReqType) {
+	init_dinSessionSetupReqType(dinSessionSetupReqType);
+	return decodeGrammar(stream, &dinSessionSetupReqTypeGrammar, dinSessionSetupReqType);
+}
+#else
+static int decode_dinSessionSetupReqType(bitstream_t* stream, struct dinSessionSetupReqType* dinSessionSetupReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 7;
 	int done = 0;
 	
@@ -670,9 +1075,50 @@ static int decode_dinSessionSetupReqType(bitstream_t* stream, struct dinSessionS
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_SessionSetupReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,PowerDeliveryResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgDataTypes":EVSEStatus)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_PowerDeliveryRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinPowerDeliveryResTypeProductions[5] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPowerDeliveryResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinPowerDeliveryResType, AC_EVSEStatus), 0, 0, 0, decode_dinAC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinPowerDeliveryResType, DC_EVSEStatus), 0, 0, 0, decode_dinDC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinPowerDeliveryResType, EVSEStatus), 0, 0, 0, decode_dinEVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinPowerDeliveryResTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t dinPowerDeliveryResTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 1, 1 }
+};
+static void dinPowerDeliveryResTypeUsed(void* value, uint8_t flag) {
+	struct dinPowerDeliveryResType* dinPowerDeliveryResType = (struct dinPowerDeliveryResType*)value;
+	switch(flag) {
+	case 0:
+		dinPowerDeliveryResType->AC_EVSEStatus_isUsed = 1u;
+		break;
+	case 1:
+		dinPowerDeliveryResType->DC_EVSEStatus_isUsed = 1u;
+		break;
+	case 2:
+		dinPowerDeliveryResType->EVSEStatus_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinPowerDeliveryResTypeGrammar = { dinPowerDeliveryResTypeStates, dinPowerDeliveryResTypeTransitions, dinPowerDeliveryResTypeProductions, dinPowerDeliveryResTypeUsed };
+
+static int decode_dinPowerDeliveryResType(bitstream_t* stream, struct dinPowerDeliveryResType* dinPowerDeliveryResType) {
+	init_dinPowerDeliveryResType(dinPowerDeliveryResType);
+	return decodeGrammar(stream, &dinPowerDeliveryResTypeGrammar, dinPowerDeliveryResType);
+}
+#else
 static int decode_dinPowerDeliveryResType(bitstream_t* stream, struct dinPowerDeliveryResType* dinPowerDeliveryResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 8;
 	int done = 0;
 	
@@ -764,9 +1210,43 @@ static int decode_dinPowerDeliveryResType(bitstream_t* stream, struct dinPowerDe
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_PowerDeliveryRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ServiceDetailResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":ServiceID,"urn:iso:15118:2:2010:MsgBody":ServiceParameterList{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ServiceDetailRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinServiceDetailResTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceDetailResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceDetailResType, ServiceID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinServiceDetailResType, ServiceParameterList), 0, 0, 0, decode_dinServiceParameterListTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinServiceDetailResTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinServiceDetailResTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }
+};
+static void dinServiceDetailResTypeUsed(void* value, uint8_t flag) {
+	struct dinServiceDetailResType* dinServiceDetailResType = (struct dinServiceDetailResType*)value;
+	switch(flag) {
+	case 0:
+		dinServiceDetailResType->ServiceParameterList_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinServiceDetailResTypeGrammar = { dinServiceDetailResTypeStates, dinServiceDetailResTypeTransitions, dinServiceDetailResTypeProductions, dinServiceDetailResTypeUsed };
+
 static int decode_dinServiceDetailResType(bitstream_t* stream, struct dinServiceDetailResType* dinServiceDetailResType) {
+	init_dinServiceDetailResType(dinServiceDetailResType);
+	return decodeGrammar(stream, &dinServiceDetailResTypeGrammar, dinServiceDetailResType);
+}
+#else
+static int decode_dinServiceDetailResType(bitstream_t* stream, struct dinServiceDetailResType* dinServiceDetailResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 10;
 	int done = 0;
 	
@@ -884,9 +1364,35 @@ static int decode_dinServiceDetailResType(bitstream_t* stream, struct dinService
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_ServiceDetailRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,WeldingDetectionResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2010:MsgBody":EVSEPresentVoltage)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_WeldingDetectionRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinWeldingDetectionResTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinWeldingDetectionResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinWeldingDetectionResType, DC_EVSEStatus), 0, 0, 0, decode_dinDC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinWeldingDetectionResType, EVSEPresentVoltage), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinWeldingDetectionResTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinWeldingDetectionResTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t dinWeldingDetectionResTypeGrammar = { dinWeldingDetectionResTypeStates, dinWeldingDetectionResTypeTransitions, dinWeldingDetectionResTypeProductions, NULL };
+
 static int decode_dinWeldingDetectionResType(bitstream_t* stream, struct dinWeldingDetectionResType* dinWeldingDetectionResType) {
+	init_dinWeldingDetectionResType(dinWeldingDetectionResType);
+	return decodeGrammar(stream, &dinWeldingDetectionResTypeGrammar, dinWeldingDetectionResType);
+}
+#else
+static int decode_dinWeldingDetectionResType(bitstream_t* stream, struct dinWeldingDetectionResType* dinWeldingDetectionResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 13;
 	int done = 0;
 	
@@ -982,9 +1488,34 @@ static int decode_dinWeldingDetectionResType(bitstream_t* stream, struct dinWeld
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_WeldingDetectionRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ContractAuthenticationResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":EVSEProcessing)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ContractAuthenticationRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinContractAuthenticationResTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinContractAuthenticationResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 1, sizeof(dinEVSEProcessingType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinContractAuthenticationResType, EVSEProcessing), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinContractAuthenticationResTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinContractAuthenticationResTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t dinContractAuthenticationResTypeGrammar = { dinContractAuthenticationResTypeStates, dinContractAuthenticationResTypeTransitions, dinContractAuthenticationResTypeProductions, NULL };
+
 static int decode_dinContractAuthenticationResType(bitstream_t* stream, struct dinContractAuthenticationResType* dinContractAuthenticationResType) {
+	init_dinContractAuthenticationResType(dinContractAuthenticationResType);
+	return decodeGrammar(stream, &dinContractAuthenticationResTypeGrammar, dinContractAuthenticationResType);
+}
+#else
+static int decode_dinContractAuthenticationResType(bitstream_t* stream, struct dinContractAuthenticationResType* dinContractAuthenticationResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 16;
 	int done = 0;
 	
@@ -1083,9 +1614,41 @@ static int decode_dinContractAuthenticationResType(bitstream_t* stream, struct d
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_ContractAuthenticationRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,CanonicalizationMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinCanonicalizationMethodTypeProductions[4] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCanonicalizationMethodType, Algorithm.characters), offsetof(struct dinCanonicalizationMethodType, Algorithm.charactersLen), dinCanonicalizationMethodType_Algorithm_CHARACTERS_SIZE, 23 /* {}Algorithm */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinCanonicalizationMethodType, ANY.characters), offsetof(struct dinCanonicalizationMethodType, ANY.charactersLen), dinCanonicalizationMethodType_ANY_CHARACTERS_SIZE, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, NULL }
+};
+static const exi_grammar_transition_t dinCanonicalizationMethodTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 2, 3 }, { 2, 1 }, { 0, 2 }, { 2, 3 }
+};
+static const exi_grammar_state_t dinCanonicalizationMethodTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 2, 3 }
+};
+static void dinCanonicalizationMethodTypeUsed(void* value, uint8_t flag) {
+	struct dinCanonicalizationMethodType* dinCanonicalizationMethodType = (struct dinCanonicalizationMethodType*)value;
+	switch(flag) {
+	case 0:
+		dinCanonicalizationMethodType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinCanonicalizationMethodTypeGrammar = { dinCanonicalizationMethodTypeStates, dinCanonicalizationMethodTypeTransitions, dinCanonicalizationMethodTypeProductions, dinCanonicalizationMethodTypeUsed };
+
+static int decode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinCanonicalizationMethodType* dinCanonicalizationMethodType) {
+	init_dinCanonicalizationMethodType(dinCanonicalizationMethodType);
+	return decodeGrammar(stream, &dinCanonicalizationMethodTypeGrammar, dinCanonicalizationMethodType);
+}
+#else
 static int decode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinCanonicalizationMethodType* dinCanonicalizationMethodType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 18;
 	int done = 0;
 	
@@ -1103,10 +1666,24 @@ static int decode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinC
 					if (errn == 0) {
 						if (dinCanonicalizationMethodType->Algorithm.charactersLen >= 2) {
 							dinCanonicalizationMethodType->Algorithm.charactersLen = (uint16_t)(dinCanonicalizationMethodType->Algorithm.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinCanonicalizationMethodType->Algorithm.characters, CHARACTER_UNITS(dinCanonicalizationMethodType->Algorithm.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinCanonicalizationMethodType->Algorithm.charactersLen, dinCanonicalizationMethodType->Algorithm.characters, dinCanonicalizationMethodType_Algorithm_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinCanonicalizationMethodType->Algorithm.charactersLen, dinCanonicalizationMethodType->Algorithm.characters, dinCanonicalizationMethodType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 23 /* {}Algorithm */, dinCanonicalizationMethodType->Algorithm.characters, dinCanonicalizationMethodType->Algorithm.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 23 /* {}Algorithm */, &dinCanonicalizationMethodType->Algorithm.charactersLen, &dinCanonicalizationMethodType->Algorithm.characters);
+#else
+							errn = decodeStringValueHit(stream, 23 /* {}Algorithm */, &dinCanonicalizationMethodType->Algorithm.charactersLen, dinCanonicalizationMethodType->Algorithm.characters, dinCanonicalizationMethodType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 19;
@@ -1136,10 +1713,24 @@ static int decode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinC
 					if (errn == 0) {
 						if (dinCanonicalizationMethodType->ANY.charactersLen >= 2) {
 							dinCanonicalizationMethodType->ANY.charactersLen = (uint16_t)(dinCanonicalizationMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinCanonicalizationMethodType->ANY.characters, CHARACTER_UNITS(dinCanonicalizationMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinCanonicalizationMethodType->ANY.charactersLen, dinCanonicalizationMethodType->ANY.characters, dinCanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinCanonicalizationMethodType->ANY.charactersLen, dinCanonicalizationMethodType->ANY.characters, dinCanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, dinCanonicalizationMethodType->ANY.characters, dinCanonicalizationMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, &dinCanonicalizationMethodType->ANY.charactersLen, &dinCanonicalizationMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, &dinCanonicalizationMethodType->ANY.charactersLen, dinCanonicalizationMethodType->ANY.characters, dinCanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinCanonicalizationMethodType->ANY_isUsed = 1u;
@@ -1170,10 +1761,24 @@ static int decode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinC
 					if (errn == 0) {
 						if (dinCanonicalizationMethodType->ANY.charactersLen >= 2) {
 							dinCanonicalizationMethodType->ANY.charactersLen = (uint16_t)(dinCanonicalizationMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinCanonicalizationMethodType->ANY.characters, CHARACTER_UNITS(dinCanonicalizationMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinCanonicalizationMethodType->ANY.charactersLen, dinCanonicalizationMethodType->ANY.characters, dinCanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinCanonicalizationMethodType->ANY.charactersLen, dinCanonicalizationMethodType->ANY.characters, dinCanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, dinCanonicalizationMethodType->ANY.characters, dinCanonicalizationMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, &dinCanonicalizationMethodType->ANY.charactersLen, &dinCanonicalizationMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, &dinCanonicalizationMethodType->ANY.charactersLen, dinCanonicalizationMethodType->ANY.characters, dinCanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinCanonicalizationMethodType->ANY_isUsed = 1u;
@@ -1195,9 +1800,31 @@ static int decode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinC
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SPKIDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SPKISexp,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-1}){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinSPKIDataTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinSPKIDataType_SPKISexp_ARRAY_SIZE, offsetof(struct dinSPKIDataType, SPKISexp.array), offsetof(struct dinSPKIDataType, SPKISexp.arrayLen), sizeof(((struct dinSPKIDataType*)0)->SPKISexp.array[0]), (offsetof(struct dinSPKIDataType, SPKISexp.array[0].bytes) - offsetof(struct dinSPKIDataType, SPKISexp.array)), (offsetof(struct dinSPKIDataType, SPKISexp.array[0].bytesLen) - offsetof(struct dinSPKIDataType, SPKISexp.array)), dinSPKIDataType_SPKISexp_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSPKIDataTypeTransitions[6] = {
+	{ 1, 0 }, { 1, 0 }, { 2, 1 }, { 0, 2 }, { 1, 0 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinSPKIDataTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 2, 2 }
+};
+static const exi_grammar_t dinSPKIDataTypeGrammar = { dinSPKIDataTypeStates, dinSPKIDataTypeTransitions, dinSPKIDataTypeProductions, NULL };
+
+static int decode_dinSPKIDataType(bitstream_t* stream, struct dinSPKIDataType* dinSPKIDataType) {
+	init_dinSPKIDataType(dinSPKIDataType);
+	return decodeGrammar(stream, &dinSPKIDataTypeGrammar, dinSPKIDataType);
+}
+#else
 static int decode_dinSPKIDataType(bitstream_t* stream, struct dinSPKIDataType* dinSPKIDataType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 21;
 	int done = 0;
 	
@@ -1221,7 +1848,14 @@ static int decode_dinSPKIDataType(bitstream_t* stream, struct dinSPKIDataType* d
 									errn =  (dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytesLen) <= dinSPKIDataType_SPKISexp_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytes, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytesLen, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytesLen, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								dinSPKIDataType->SPKISexp.arrayLen++;
 							} else {
@@ -1264,7 +1898,14 @@ static int decode_dinSPKIDataType(bitstream_t* stream, struct dinSPKIDataType* d
 									errn =  (dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytesLen) <= dinSPKIDataType_SPKISexp_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytes, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytesLen, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytesLen, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								dinSPKIDataType->SPKISexp.arrayLen++;
 							} else {
@@ -1316,7 +1957,14 @@ static int decode_dinSPKIDataType(bitstream_t* stream, struct dinSPKIDataType* d
 									errn =  (dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytesLen) <= dinSPKIDataType_SPKISexp_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytes, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytesLen, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytesLen, dinSPKIDataType->SPKISexp.array[dinSPKIDataType->SPKISexp.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								dinSPKIDataType->SPKISexp.arrayLen++;
 							} else {
@@ -1357,9 +2005,30 @@ static int decode_dinSPKIDataType(bitstream_t* stream, struct dinSPKIDataType* d
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ListOfRootCertificateIDsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":RootCertificateID{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinListOfRootCertificateIDsTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinListOfRootCertificateIDsType_RootCertificateID_ARRAY_SIZE, offsetof(struct dinListOfRootCertificateIDsType, RootCertificateID.array), offsetof(struct dinListOfRootCertificateIDsType, RootCertificateID.arrayLen), sizeof(((struct dinListOfRootCertificateIDsType*)0)->RootCertificateID.array[0]), (offsetof(struct dinListOfRootCertificateIDsType, RootCertificateID.array[0].characters) - offsetof(struct dinListOfRootCertificateIDsType, RootCertificateID.array)), (offsetof(struct dinListOfRootCertificateIDsType, RootCertificateID.array[0].charactersLen) - offsetof(struct dinListOfRootCertificateIDsType, RootCertificateID.array)), dinListOfRootCertificateIDsType_RootCertificateID_CHARACTERS_SIZE, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinListOfRootCertificateIDsTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinListOfRootCertificateIDsTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t dinListOfRootCertificateIDsTypeGrammar = { dinListOfRootCertificateIDsTypeStates, dinListOfRootCertificateIDsTypeTransitions, dinListOfRootCertificateIDsTypeProductions, NULL };
+
+static int decode_dinListOfRootCertificateIDsType(bitstream_t* stream, struct dinListOfRootCertificateIDsType* dinListOfRootCertificateIDsType) {
+	init_dinListOfRootCertificateIDsType(dinListOfRootCertificateIDsType);
+	return decodeGrammar(stream, &dinListOfRootCertificateIDsTypeGrammar, dinListOfRootCertificateIDsType);
+}
+#else
 static int decode_dinListOfRootCertificateIDsType(bitstream_t* stream, struct dinListOfRootCertificateIDsType* dinListOfRootCertificateIDsType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 24;
 	int done = 0;
 	
@@ -1382,10 +2051,24 @@ static int decode_dinListOfRootCertificateIDsType(bitstream_t* stream, struct di
 								if (errn == 0) {
 									if (dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen >= 2) {
 										dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen = (uint16_t)(dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].characters, CHARACTER_UNITS(dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].characters, dinListOfRootCertificateIDsType_RootCertificateID_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].characters, dinListOfRootCertificateIDsType_RootCertificateID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].characters, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, &dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen, &dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, &dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].characters, dinListOfRootCertificateIDsType_RootCertificateID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinListOfRootCertificateIDsType->RootCertificateID.arrayLen++;
@@ -1428,10 +2111,24 @@ static int decode_dinListOfRootCertificateIDsType(bitstream_t* stream, struct di
 								if (errn == 0) {
 									if (dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen >= 2) {
 										dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen = (uint16_t)(dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].characters, CHARACTER_UNITS(dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].characters, dinListOfRootCertificateIDsType_RootCertificateID_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].characters, dinListOfRootCertificateIDsType_RootCertificateID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].characters, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, &dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen, &dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, &dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].charactersLen, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType->RootCertificateID.arrayLen].characters, dinListOfRootCertificateIDsType_RootCertificateID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinListOfRootCertificateIDsType->RootCertificateID.arrayLen++;
@@ -1473,9 +2170,30 @@ static int decode_dinListOfRootCertificateIDsType(bitstream_t* stream, struct di
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SelectedServiceListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":SelectedService{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinSelectedServiceListTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinSelectedServiceListType_SelectedService_ARRAY_SIZE, offsetof(struct dinSelectedServiceListType, SelectedService.array), offsetof(struct dinSelectedServiceListType, SelectedService.arrayLen), sizeof(((struct dinSelectedServiceListType*)0)->SelectedService.array[0]), 0, 0, 0, 0, decode_dinSelectedServiceTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSelectedServiceListTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinSelectedServiceListTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t dinSelectedServiceListTypeGrammar = { dinSelectedServiceListTypeStates, dinSelectedServiceListTypeTransitions, dinSelectedServiceListTypeProductions, NULL };
+
+static int decode_dinSelectedServiceListType(bitstream_t* stream, struct dinSelectedServiceListType* dinSelectedServiceListType) {
+	init_dinSelectedServiceListType(dinSelectedServiceListType);
+	return decodeGrammar(stream, &dinSelectedServiceListTypeGrammar, dinSelectedServiceListType);
+}
+#else
 static int decode_dinSelectedServiceListType(bitstream_t* stream, struct dinSelectedServiceListType* dinSelectedServiceListType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 26;
 	int done = 0;
 	
@@ -1489,7 +2207,16 @@ static int decode_dinSelectedServiceListType(bitstream_t* stream, struct dinSele
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinSelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinSelectedServiceListType->SelectedService.array, dinSelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinSelectedServiceListType->SelectedService.arrayLen < dinSelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (dinSelectedServiceListType->SelectedService.arrayLen < dinSelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinSelectedServiceType(stream, &dinSelectedServiceListType->SelectedService.array[dinSelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -1508,7 +2235,16 @@ static int decode_dinSelectedServiceListType(bitstream_t* stream, struct dinSele
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinSelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinSelectedServiceListType->SelectedService.array, dinSelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinSelectedServiceListType->SelectedService.arrayLen < dinSelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (dinSelectedServiceListType->SelectedService.arrayLen < dinSelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinSelectedServiceType(stream, &dinSelectedServiceListType->SelectedService.array[dinSelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -1535,9 +2271,58 @@ static int decode_dinSelectedServiceListType(bitstream_t* stream, struct dinSele
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CurrentDemandResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2010:MsgBody":EVSEPresentVoltage,"urn:iso:15118:2:2010:MsgBody":EVSEPresentCurrent,"urn:iso:15118:2:2010:MsgBody":EVSECurrentLimitAchieved,"urn:iso:15118:2:2010:MsgBody":EVSEVoltageLimitAchieved,"urn:iso:15118:2:2010:MsgBody":EVSEPowerLimitAchieved,"urn:iso:15118:2:2010:MsgBody":EVSEMaximumVoltageLimit{0-1},"urn:iso:15118:2:2010:MsgBody":EVSEMaximumCurrentLimit{0-1},"urn:iso:15118:2:2010:MsgBody":EVSEMaximumPowerLimit{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinCurrentDemandResTypeProductions[11] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandResType, DC_EVSEStatus), 0, 0, 0, decode_dinDC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandResType, EVSEPresentVoltage), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandResType, EVSEPresentCurrent), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandResType, EVSECurrentLimitAchieved), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandResType, EVSEVoltageLimitAchieved), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandResType, EVSEPowerLimitAchieved), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandResType, EVSEMaximumVoltageLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandResType, EVSEMaximumCurrentLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandResType, EVSEMaximumPowerLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinCurrentDemandResTypeTransitions[17] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 7, 6 }, { 8, 7 },
+	{ 9, 8 }, { 10, 9 }, { 0, 10 }, { 9, 8 }, { 10, 9 }, { 0, 10 }, { 10, 9 }, { 0, 10 },
+	{ 0, 10 }
+};
+static const exi_grammar_state_t dinCurrentDemandResTypeStates[11] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }, { 6, 1, 1 }, { 7, 3, 4 },
+	{ 11, 2, 3 }, { 14, 2, 2 }, { 16, 1, 1 }
+};
+static void dinCurrentDemandResTypeUsed(void* value, uint8_t flag) {
+	struct dinCurrentDemandResType* dinCurrentDemandResType = (struct dinCurrentDemandResType*)value;
+	switch(flag) {
+	case 0:
+		dinCurrentDemandResType->EVSEMaximumVoltageLimit_isUsed = 1u;
+		break;
+	case 1:
+		dinCurrentDemandResType->EVSEMaximumCurrentLimit_isUsed = 1u;
+		break;
+	case 2:
+		dinCurrentDemandResType->EVSEMaximumPowerLimit_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinCurrentDemandResTypeGrammar = { dinCurrentDemandResTypeStates, dinCurrentDemandResTypeTransitions, dinCurrentDemandResTypeProductions, dinCurrentDemandResTypeUsed };
+
+static int decode_dinCurrentDemandResType(bitstream_t* stream, struct dinCurrentDemandResType* dinCurrentDemandResType) {
+	init_dinCurrentDemandResType(dinCurrentDemandResType);
+	return decodeGrammar(stream, &dinCurrentDemandResTypeGrammar, dinCurrentDemandResType);
+}
+#else
 static int decode_dinCurrentDemandResType(bitstream_t* stream, struct dinCurrentDemandResType* dinCurrentDemandResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 28;
 	int done = 0;
 	
@@ -1819,9 +2604,43 @@ static int decode_dinCurrentDemandResType(bitstream_t* stream, struct dinCurrent
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_CurrentDemandRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])|"http://www.w3.org/2000/09/xmldsig#":XPath){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinTransformTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinTransformType, Algorithm.characters), offsetof(struct dinTransformType, Algorithm.charactersLen), dinTransformType_Algorithm_CHARACTERS_SIZE, 23 /* {}Algorithm */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinTransformType_XPath_ARRAY_SIZE, offsetof(struct dinTransformType, XPath.array), offsetof(struct dinTransformType, XPath.arrayLen), sizeof(((struct dinTransformType*)0)->XPath.array[0]), (offsetof(struct dinTransformType, XPath.array[0].characters) - offsetof(struct dinTransformType, XPath.array)), (offsetof(struct dinTransformType, XPath.array[0].charactersLen) - offsetof(struct dinTransformType, XPath.array)), dinTransformType_XPath_CHARACTERS_SIZE, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinTransformType, ANY.characters), offsetof(struct dinTransformType, ANY.charactersLen), dinTransformType_ANY_CHARACTERS_SIZE, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, NULL }
+};
+static const exi_grammar_transition_t dinTransformTypeTransitions[9] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 0, 3 }, { 2, 4 }, { 2, 1 }, { 2, 2 }, { 0, 3 },
+	{ 2, 4 }
+};
+static const exi_grammar_state_t dinTransformTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 3, 4 }, { 5, 3, 4 }
+};
+static void dinTransformTypeUsed(void* value, uint8_t flag) {
+	struct dinTransformType* dinTransformType = (struct dinTransformType*)value;
+	switch(flag) {
+	case 0:
+		dinTransformType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinTransformTypeGrammar = { dinTransformTypeStates, dinTransformTypeTransitions, dinTransformTypeProductions, dinTransformTypeUsed };
+
+static int decode_dinTransformType(bitstream_t* stream, struct dinTransformType* dinTransformType) {
+	init_dinTransformType(dinTransformType);
+	return decodeGrammar(stream, &dinTransformTypeGrammar, dinTransformType);
+}
+#else
 static int decode_dinTransformType(bitstream_t* stream, struct dinTransformType* dinTransformType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 38;
 	int done = 0;
 	
@@ -1839,10 +2658,24 @@ static int decode_dinTransformType(bitstream_t* stream, struct dinTransformType*
 					if (errn == 0) {
 						if (dinTransformType->Algorithm.charactersLen >= 2) {
 							dinTransformType->Algorithm.charactersLen = (uint16_t)(dinTransformType->Algorithm.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinTransformType->Algorithm.characters, CHARACTER_UNITS(dinTransformType->Algorithm.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinTransformType->Algorithm.charactersLen, dinTransformType->Algorithm.characters, dinTransformType_Algorithm_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinTransformType->Algorithm.charactersLen, dinTransformType->Algorithm.characters, dinTransformType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 23 /* {}Algorithm */, dinTransformType->Algorithm.characters, dinTransformType->Algorithm.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 23 /* {}Algorithm */, &dinTransformType->Algorithm.charactersLen, &dinTransformType->Algorithm.characters);
+#else
+							errn = decodeStringValueHit(stream, 23 /* {}Algorithm */, &dinTransformType->Algorithm.charactersLen, dinTransformType->Algorithm.characters, dinTransformType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 39;
@@ -1868,10 +2701,24 @@ static int decode_dinTransformType(bitstream_t* stream, struct dinTransformType*
 								if (errn == 0) {
 									if (dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen >= 2) {
 										dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen = (uint16_t)(dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].characters, CHARACTER_UNITS(dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].characters, dinTransformType_XPath_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].characters, dinTransformType_XPath_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].characters, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen, &dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].characters, dinTransformType_XPath_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinTransformType->XPath.arrayLen++;
@@ -1907,10 +2754,24 @@ static int decode_dinTransformType(bitstream_t* stream, struct dinTransformType*
 					if (errn == 0) {
 						if (dinTransformType->ANY.charactersLen >= 2) {
 							dinTransformType->ANY.charactersLen = (uint16_t)(dinTransformType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinTransformType->ANY.characters, CHARACTER_UNITS(dinTransformType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinTransformType->ANY.charactersLen, dinTransformType->ANY.characters, dinTransformType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinTransformType->ANY.charactersLen, dinTransformType->ANY.characters, dinTransformType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, dinTransformType->ANY.characters, dinTransformType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, &dinTransformType->ANY.charactersLen, &dinTransformType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, &dinTransformType->ANY.charactersLen, dinTransformType->ANY.characters, dinTransformType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinTransformType->ANY_isUsed = 1u;
@@ -1937,10 +2798,24 @@ static int decode_dinTransformType(bitstream_t* stream, struct dinTransformType*
 								if (errn == 0) {
 									if (dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen >= 2) {
 										dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen = (uint16_t)(dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].characters, CHARACTER_UNITS(dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].characters, dinTransformType_XPath_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].characters, dinTransformType_XPath_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].characters, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen, &dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].charactersLen, dinTransformType->XPath.array[dinTransformType->XPath.arrayLen].characters, dinTransformType_XPath_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinTransformType->XPath.arrayLen++;
@@ -1976,10 +2851,24 @@ static int decode_dinTransformType(bitstream_t* stream, struct dinTransformType*
 					if (errn == 0) {
 						if (dinTransformType->ANY.charactersLen >= 2) {
 							dinTransformType->ANY.charactersLen = (uint16_t)(dinTransformType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinTransformType->ANY.characters, CHARACTER_UNITS(dinTransformType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinTransformType->ANY.charactersLen, dinTransformType->ANY.characters, dinTransformType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinTransformType->ANY.charactersLen, dinTransformType->ANY.characters, dinTransformType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, dinTransformType->ANY.characters, dinTransformType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, &dinTransformType->ANY.charactersLen, &dinTransformType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, &dinTransformType->ANY.charactersLen, dinTransformType->ANY.characters, dinTransformType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinTransformType->ANY_isUsed = 1u;
@@ -2001,9 +2890,34 @@ static int decode_dinTransformType(bitstream_t* stream, struct dinTransformType*
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,AC_EVChargeParameterType',  base type name='EVChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":DepartureTime,"urn:iso:15118:2:2010:MsgDataTypes":EAmount,"urn:iso:15118:2:2010:MsgDataTypes":EVMaxVoltage,"urn:iso:15118:2:2010:MsgDataTypes":EVMaxCurrent,"urn:iso:15118:2:2010:MsgDataTypes":EVMinCurrent)',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinAC_EVChargeParameterTypeProductions[6] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVChargeParameterType, DepartureTime), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVChargeParameterType, EAmount), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVChargeParameterType, EVMaxVoltage), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVChargeParameterType, EVMaxCurrent), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVChargeParameterType, EVMinCurrent), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinAC_EVChargeParameterTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 0, 5 }
+};
+static const exi_grammar_state_t dinAC_EVChargeParameterTypeStates[6] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }
+};
+static const exi_grammar_t dinAC_EVChargeParameterTypeGrammar = { dinAC_EVChargeParameterTypeStates, dinAC_EVChargeParameterTypeTransitions, dinAC_EVChargeParameterTypeProductions, NULL };
+
+static int decode_dinAC_EVChargeParameterType(bitstream_t* stream, struct dinAC_EVChargeParameterType* dinAC_EVChargeParameterType) {
+	init_dinAC_EVChargeParameterType(dinAC_EVChargeParameterType);
+	return decodeGrammar(stream, &dinAC_EVChargeParameterTypeGrammar, dinAC_EVChargeParameterType);
+}
+#else
 static int decode_dinAC_EVChargeParameterType(bitstream_t* stream, struct dinAC_EVChargeParameterType* dinAC_EVChargeParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 41;
 	int done = 0;
 	
@@ -2128,9 +3042,36 @@ static int decode_dinAC_EVChargeParameterType(bitstream_t* stream, struct dinAC_
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509DataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":X509IssuerSerial|"http://www.w3.org/2000/09/xmldsig#":X509SKI|"http://www.w3.org/2000/09/xmldsig#":X509SubjectName|"http://www.w3.org/2000/09/xmldsig#":X509Certificate|"http://www.w3.org/2000/09/xmldsig#":X509CRL|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinX509DataTypeProductions[7] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinX509DataType_X509IssuerSerial_ARRAY_SIZE, offsetof(struct dinX509DataType, X509IssuerSerial.array), offsetof(struct dinX509DataType, X509IssuerSerial.arrayLen), sizeof(((struct dinX509DataType*)0)->X509IssuerSerial.array[0]), 0, 0, 0, 0, decode_dinX509IssuerSerialTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinX509DataType_X509SKI_ARRAY_SIZE, offsetof(struct dinX509DataType, X509SKI.array), offsetof(struct dinX509DataType, X509SKI.arrayLen), sizeof(((struct dinX509DataType*)0)->X509SKI.array[0]), (offsetof(struct dinX509DataType, X509SKI.array[0].bytes) - offsetof(struct dinX509DataType, X509SKI.array)), (offsetof(struct dinX509DataType, X509SKI.array[0].bytesLen) - offsetof(struct dinX509DataType, X509SKI.array)), dinX509DataType_X509SKI_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinX509DataType_X509SubjectName_ARRAY_SIZE, offsetof(struct dinX509DataType, X509SubjectName.array), offsetof(struct dinX509DataType, X509SubjectName.arrayLen), sizeof(((struct dinX509DataType*)0)->X509SubjectName.array[0]), (offsetof(struct dinX509DataType, X509SubjectName.array[0].characters) - offsetof(struct dinX509DataType, X509SubjectName.array)), (offsetof(struct dinX509DataType, X509SubjectName.array[0].charactersLen) - offsetof(struct dinX509DataType, X509SubjectName.array)), dinX509DataType_X509SubjectName_CHARACTERS_SIZE, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinX509DataType_X509Certificate_ARRAY_SIZE, offsetof(struct dinX509DataType, X509Certificate.array), offsetof(struct dinX509DataType, X509Certificate.arrayLen), sizeof(((struct dinX509DataType*)0)->X509Certificate.array[0]), (offsetof(struct dinX509DataType, X509Certificate.array[0].bytes) - offsetof(struct dinX509DataType, X509Certificate.array)), (offsetof(struct dinX509DataType, X509Certificate.array[0].bytesLen) - offsetof(struct dinX509DataType, X509Certificate.array)), dinX509DataType_X509Certificate_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinX509DataType_X509CRL_ARRAY_SIZE, offsetof(struct dinX509DataType, X509CRL.array), offsetof(struct dinX509DataType, X509CRL.arrayLen), sizeof(((struct dinX509DataType*)0)->X509CRL.array[0]), (offsetof(struct dinX509DataType, X509CRL.array[0].bytes) - offsetof(struct dinX509DataType, X509CRL.array)), (offsetof(struct dinX509DataType, X509CRL.array[0].bytesLen) - offsetof(struct dinX509DataType, X509CRL.array)), dinX509DataType_X509CRL_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinX509DataTypeTransitions[13] = {
+	{ 1, 0 }, { 1, 1 }, { 1, 2 }, { 1, 3 }, { 1, 4 }, { 1, 5 }, { 1, 0 }, { 1, 1 },
+	{ 1, 2 }, { 1, 3 }, { 1, 4 }, { 1, 5 }, { 0, 6 }
+};
+static const exi_grammar_state_t dinX509DataTypeStates[2] = {
+	{ 0, 3, 6 }, { 6, 3, 7 }
+};
+static const exi_grammar_t dinX509DataTypeGrammar = { dinX509DataTypeStates, dinX509DataTypeTransitions, dinX509DataTypeProductions, NULL };
+
+static int decode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* dinX509DataType) {
+	init_dinX509DataType(dinX509DataType);
+	return decodeGrammar(stream, &dinX509DataTypeGrammar, dinX509DataType);
+}
+#else
 static int decode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* dinX509DataType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 46;
 	int done = 0;
 	
@@ -2162,7 +3103,14 @@ static int decode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* d
 									errn =  (dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytesLen) <= dinX509DataType_X509SKI_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytes, dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytesLen, dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytesLen, dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								dinX509DataType->X509SKI.arrayLen++;
 							} else {
@@ -2193,10 +3141,24 @@ static int decode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* d
 								if (errn == 0) {
 									if (dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen >= 2) {
 										dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen = (uint16_t)(dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].characters, CHARACTER_UNITS(dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].characters, dinX509DataType_X509SubjectName_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].characters, dinX509DataType_X509SubjectName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].characters, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen, &dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].characters, dinX509DataType_X509SubjectName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinX509DataType->X509SubjectName.arrayLen++;
@@ -2229,7 +3191,14 @@ static int decode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* d
 									errn =  (dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytesLen) <= dinX509DataType_X509Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytes, dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytesLen, dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytesLen, dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								dinX509DataType->X509Certificate.arrayLen++;
 							} else {
@@ -2261,7 +3230,14 @@ static int decode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* d
 									errn =  (dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytesLen) <= dinX509DataType_X509CRL_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytes, dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytesLen, dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytesLen, dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								dinX509DataType->X509CRL.arrayLen++;
 							} else {
@@ -2317,7 +3293,14 @@ static int decode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* d
 									errn =  (dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytesLen) <= dinX509DataType_X509SKI_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytes, dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytesLen, dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytesLen, dinX509DataType->X509SKI.array[dinX509DataType->X509SKI.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								dinX509DataType->X509SKI.arrayLen++;
 							} else {
@@ -2348,10 +3331,24 @@ static int decode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* d
 								if (errn == 0) {
 									if (dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen >= 2) {
 										dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen = (uint16_t)(dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].characters, CHARACTER_UNITS(dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].characters, dinX509DataType_X509SubjectName_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].characters, dinX509DataType_X509SubjectName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].characters, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen, &dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].charactersLen, dinX509DataType->X509SubjectName.array[dinX509DataType->X509SubjectName.arrayLen].characters, dinX509DataType_X509SubjectName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinX509DataType->X509SubjectName.arrayLen++;
@@ -2384,7 +3381,14 @@ static int decode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* d
 									errn =  (dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytesLen) <= dinX509DataType_X509Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytes, dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytesLen, dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytesLen, dinX509DataType->X509Certificate.array[dinX509DataType->X509Certificate.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								dinX509DataType->X509Certificate.arrayLen++;
 							} else {
@@ -2416,7 +3420,14 @@ static int decode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* d
 									errn =  (dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytesLen) <= dinX509DataType_X509CRL_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytes, dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytesLen, dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytesLen, dinX509DataType->X509CRL.array[dinX509DataType->X509CRL.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								dinX509DataType->X509CRL.arrayLen++;
 							} else {
@@ -2462,9 +3473,50 @@ static int decode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* d
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ChargingStatusResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":EVSEID,"urn:iso:15118:2:2010:MsgBody":SAScheduleTupleID,"urn:iso:15118:2:2010:MsgBody":EVSEMaxCurrent{0-1},"urn:iso:15118:2:2010:MsgBody":MeterInfo{0-1},"urn:iso:15118:2:2010:MsgBody":ReceiptRequired,"urn:iso:15118:2:2010:MsgBody":AC_EVSEStatus)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ChargingStatusRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinChargingStatusResTypeProductions[8] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinChargingStatusResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinChargingStatusResType, EVSEID.bytes), offsetof(struct dinChargingStatusResType, EVSEID.bytesLen), dinChargingStatusResType_EVSEID_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinChargingStatusResType, SAScheduleTupleID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinChargingStatusResType, EVSEMaxCurrent), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinChargingStatusResType, MeterInfo), 0, 0, 0, decode_dinMeterInfoTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinChargingStatusResType, ReceiptRequired), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinChargingStatusResType, AC_EVSEStatus), 0, 0, 0, decode_dinAC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinChargingStatusResTypeTransitions[11] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 5, 4 }, { 6, 5 },
+	{ 6, 5 }, { 7, 6 }, { 0, 7 }
+};
+static const exi_grammar_state_t dinChargingStatusResTypeStates[8] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 2, 3 }, { 6, 2, 2 }, { 8, 1, 1 }, { 9, 1, 1 }, { 10, 1, 1 }
+};
+static void dinChargingStatusResTypeUsed(void* value, uint8_t flag) {
+	struct dinChargingStatusResType* dinChargingStatusResType = (struct dinChargingStatusResType*)value;
+	switch(flag) {
+	case 0:
+		dinChargingStatusResType->EVSEMaxCurrent_isUsed = 1u;
+		break;
+	case 1:
+		dinChargingStatusResType->MeterInfo_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinChargingStatusResTypeGrammar = { dinChargingStatusResTypeStates, dinChargingStatusResTypeTransitions, dinChargingStatusResTypeProductions, dinChargingStatusResTypeUsed };
+
+static int decode_dinChargingStatusResType(bitstream_t* stream, struct dinChargingStatusResType* dinChargingStatusResType) {
+	init_dinChargingStatusResType(dinChargingStatusResType);
+	return decodeGrammar(stream, &dinChargingStatusResTypeGrammar, dinChargingStatusResType);
+}
+#else
 static int decode_dinChargingStatusResType(bitstream_t* stream, struct dinChargingStatusResType* dinChargingStatusResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 48;
 	int done = 0;
 	
@@ -2726,9 +3778,32 @@ static int decode_dinChargingStatusResType(bitstream_t* stream, struct dinChargi
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_ChargingStatusRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,WeldingDetectionReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":DC_EVStatus)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_WeldingDetectionReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinWeldingDetectionReqTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinWeldingDetectionReqType, DC_EVStatus), 0, 0, 0, decode_dinDC_EVStatusTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinWeldingDetectionReqTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinWeldingDetectionReqTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t dinWeldingDetectionReqTypeGrammar = { dinWeldingDetectionReqTypeStates, dinWeldingDetectionReqTypeTransitions, dinWeldingDetectionReqTypeProductions, NULL };
+
+static int decode_dinWeldingDetectionReqType(bitstream_t* stream, struct dinWeldingDetectionReqType* dinWeldingDetectionReqType) {
+	init_dinWeldingDetectionReqType(dinWeldingDetectionReqType);
+	return decodeGrammar(stream, &dinWeldingDetectionReqTypeGrammar, dinWeldingDetectionReqType);
+}
+#else
 static int decode_dinWeldingDetectionReqType(bitstream_t* stream, struct dinWeldingDetectionReqType* dinWeldingDetectionReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 55;
 	int done = 0;
 	
@@ -2776,9 +3851,41 @@ static int decode_dinWeldingDetectionReqType(bitstream_t* stream, struct dinWeld
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_WeldingDetectionReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertiesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignatureProperty{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if DIN_DEPLOY_SignatureProperties == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinSignaturePropertiesTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinSignaturePropertiesType, Id.characters), offsetof(struct dinSignaturePropertiesType, Id.charactersLen), dinSignaturePropertiesType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinSignaturePropertiesType_SignatureProperty_ARRAY_SIZE, offsetof(struct dinSignaturePropertiesType, SignatureProperty.array), offsetof(struct dinSignaturePropertiesType, SignatureProperty.arrayLen), sizeof(((struct dinSignaturePropertiesType*)0)->SignatureProperty.array[0]), 0, 0, 0, 0, decode_dinSignaturePropertyTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSignaturePropertiesTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinSignaturePropertiesTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }
+};
+static void dinSignaturePropertiesTypeUsed(void* value, uint8_t flag) {
+	struct dinSignaturePropertiesType* dinSignaturePropertiesType = (struct dinSignaturePropertiesType*)value;
+	switch(flag) {
+	case 0:
+		dinSignaturePropertiesType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinSignaturePropertiesTypeGrammar = { dinSignaturePropertiesTypeStates, dinSignaturePropertiesTypeTransitions, dinSignaturePropertiesTypeProductions, dinSignaturePropertiesTypeUsed };
+
+static int decode_dinSignaturePropertiesType(bitstream_t* stream, struct dinSignaturePropertiesType* dinSignaturePropertiesType) {
+	init_dinSignaturePropertiesType(dinSignaturePropertiesType);
+	return decodeGrammar(stream, &dinSignaturePropertiesTypeGrammar, dinSignaturePropertiesType);
+}
+#else
 static int decode_dinSignaturePropertiesType(bitstream_t* stream, struct dinSignaturePropertiesType* dinSignaturePropertiesType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 56;
 	int done = 0;
 	
@@ -2796,10 +3903,24 @@ static int decode_dinSignaturePropertiesType(bitstream_t* stream, struct dinSign
 					if (errn == 0) {
 						if (dinSignaturePropertiesType->Id.charactersLen >= 2) {
 							dinSignaturePropertiesType->Id.charactersLen = (uint16_t)(dinSignaturePropertiesType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignaturePropertiesType->Id.characters, CHARACTER_UNITS(dinSignaturePropertiesType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignaturePropertiesType->Id.charactersLen, dinSignaturePropertiesType->Id.characters, dinSignaturePropertiesType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignaturePropertiesType->Id.charactersLen, dinSignaturePropertiesType->Id.characters, dinSignaturePropertiesType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinSignaturePropertiesType->Id.characters, dinSignaturePropertiesType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinSignaturePropertiesType->Id.charactersLen, &dinSignaturePropertiesType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinSignaturePropertiesType->Id.charactersLen, dinSignaturePropertiesType->Id.characters, dinSignaturePropertiesType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinSignaturePropertiesType->Id_isUsed = 1u;
@@ -2871,9 +3992,44 @@ static int decode_dinSignaturePropertiesType(bitstream_t* stream, struct dinSign
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_SignatureProperties */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ContractAuthenticationReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":GenChallenge{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ContractAuthenticationReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinContractAuthenticationReqTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinContractAuthenticationReqType, Id.characters), offsetof(struct dinContractAuthenticationReqType, Id.charactersLen), dinContractAuthenticationReqType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinContractAuthenticationReqType, GenChallenge.characters), offsetof(struct dinContractAuthenticationReqType, GenChallenge.charactersLen), dinContractAuthenticationReqType_GenChallenge_CHARACTERS_SIZE, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinContractAuthenticationReqTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 2, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinContractAuthenticationReqTypeStates[3] = {
+	{ 0, 2, 3 }, { 3, 2, 2 }, { 5, 1, 1 }
+};
+static void dinContractAuthenticationReqTypeUsed(void* value, uint8_t flag) {
+	struct dinContractAuthenticationReqType* dinContractAuthenticationReqType = (struct dinContractAuthenticationReqType*)value;
+	switch(flag) {
+	case 0:
+		dinContractAuthenticationReqType->Id_isUsed = 1u;
+		break;
+	case 1:
+		dinContractAuthenticationReqType->GenChallenge_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinContractAuthenticationReqTypeGrammar = { dinContractAuthenticationReqTypeStates, dinContractAuthenticationReqTypeTransitions, dinContractAuthenticationReqTypeProductions, dinContractAuthenticationReqTypeUsed };
+
+static int decode_dinContractAuthenticationReqType(bitstream_t* stream, struct dinContractAuthenticationReqType* dinContractAuthenticationReqType) {
+	init_dinContractAuthenticationReqType(dinContractAuthenticationReqType);
+	return decodeGrammar(stream, &dinContractAuthenticationReqTypeGrammar, dinContractAuthenticationReqType);
+}
+#else
 static int decode_dinContractAuthenticationReqType(bitstream_t* stream, struct dinContractAuthenticationReqType* dinContractAuthenticationReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 59;
 	int done = 0;
 	
@@ -2891,10 +4047,24 @@ static int decode_dinContractAuthenticationReqType(bitstream_t* stream, struct d
 					if (errn == 0) {
 						if (dinContractAuthenticationReqType->Id.charactersLen >= 2) {
 							dinContractAuthenticationReqType->Id.charactersLen = (uint16_t)(dinContractAuthenticationReqType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinContractAuthenticationReqType->Id.characters, CHARACTER_UNITS(dinContractAuthenticationReqType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinContractAuthenticationReqType->Id.charactersLen, dinContractAuthenticationReqType->Id.characters, dinContractAuthenticationReqType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinContractAuthenticationReqType->Id.charactersLen, dinContractAuthenticationReqType->Id.characters, dinContractAuthenticationReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinContractAuthenticationReqType->Id.characters, dinContractAuthenticationReqType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinContractAuthenticationReqType->Id.charactersLen, &dinContractAuthenticationReqType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinContractAuthenticationReqType->Id.charactersLen, dinContractAuthenticationReqType->Id.characters, dinContractAuthenticationReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinContractAuthenticationReqType->Id_isUsed = 1u;
@@ -2909,10 +4079,24 @@ static int decode_dinContractAuthenticationReqType(bitstream_t* stream, struct d
 							if (errn == 0) {
 								if (dinContractAuthenticationReqType->GenChallenge.charactersLen >= 2) {
 									dinContractAuthenticationReqType->GenChallenge.charactersLen = (uint16_t)(dinContractAuthenticationReqType->GenChallenge.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinContractAuthenticationReqType->GenChallenge.characters, CHARACTER_UNITS(dinContractAuthenticationReqType->GenChallenge.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinContractAuthenticationReqType->GenChallenge.charactersLen, dinContractAuthenticationReqType->GenChallenge.characters, dinContractAuthenticationReqType_GenChallenge_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinContractAuthenticationReqType->GenChallenge.charactersLen, dinContractAuthenticationReqType->GenChallenge.characters, dinContractAuthenticationReqType_GenChallenge_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, dinContractAuthenticationReqType->GenChallenge.characters, dinContractAuthenticationReqType->GenChallenge.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, &dinContractAuthenticationReqType->GenChallenge.charactersLen, &dinContractAuthenticationReqType->GenChallenge.characters);
+#else
+									errn = decodeStringValueHit(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, &dinContractAuthenticationReqType->GenChallenge.charactersLen, dinContractAuthenticationReqType->GenChallenge.characters, dinContractAuthenticationReqType_GenChallenge_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							dinContractAuthenticationReqType->GenChallenge_isUsed = 1u;
@@ -2955,10 +4139,24 @@ static int decode_dinContractAuthenticationReqType(bitstream_t* stream, struct d
 							if (errn == 0) {
 								if (dinContractAuthenticationReqType->GenChallenge.charactersLen >= 2) {
 									dinContractAuthenticationReqType->GenChallenge.charactersLen = (uint16_t)(dinContractAuthenticationReqType->GenChallenge.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinContractAuthenticationReqType->GenChallenge.characters, CHARACTER_UNITS(dinContractAuthenticationReqType->GenChallenge.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinContractAuthenticationReqType->GenChallenge.charactersLen, dinContractAuthenticationReqType->GenChallenge.characters, dinContractAuthenticationReqType_GenChallenge_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinContractAuthenticationReqType->GenChallenge.charactersLen, dinContractAuthenticationReqType->GenChallenge.characters, dinContractAuthenticationReqType_GenChallenge_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, dinContractAuthenticationReqType->GenChallenge.characters, dinContractAuthenticationReqType->GenChallenge.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, &dinContractAuthenticationReqType->GenChallenge.charactersLen, &dinContractAuthenticationReqType->GenChallenge.characters);
+#else
+									errn = decodeStringValueHit(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, &dinContractAuthenticationReqType->GenChallenge.charactersLen, dinContractAuthenticationReqType->GenChallenge.characters, dinContractAuthenticationReqType_GenChallenge_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							dinContractAuthenticationReqType->GenChallenge_isUsed = 1u;
@@ -3012,9 +4210,13 @@ static int decode_dinContractAuthenticationReqType(bitstream_t* stream, struct d
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_ContractAuthenticationReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,DC_EVPowerDeliveryParameterType',  base type name='EVPowerDeliveryParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":DC_EVStatus,"urn:iso:15118:2:2010:MsgDataTypes":BulkChargingComplete{0-1},"urn:iso:15118:2:2010:MsgDataTypes":ChargingComplete)',  derivedBy='EXTENSION'.  */
 static int decode_dinDC_EVPowerDeliveryParameterType(bitstream_t* stream, struct dinDC_EVPowerDeliveryParameterType* dinDC_EVPowerDeliveryParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 61;
 	int done = 0;
 	
@@ -3153,7 +4355,26 @@ static int decode_dinDC_EVPowerDeliveryParameterType(bitstream_t* stream, struct
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,EVSEChargeParameterType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinEVSEChargeParameterTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinEVSEChargeParameterTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t dinEVSEChargeParameterTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t dinEVSEChargeParameterTypeGrammar = { dinEVSEChargeParameterTypeStates, dinEVSEChargeParameterTypeTransitions, dinEVSEChargeParameterTypeProductions, NULL };
+
+static int decode_dinEVSEChargeParameterType(bitstream_t* stream, struct dinEVSEChargeParameterType* dinEVSEChargeParameterType) {
+	init_dinEVSEChargeParameterType(dinEVSEChargeParameterType);
+	return decodeGrammar(stream, &dinEVSEChargeParameterTypeGrammar, dinEVSEChargeParameterType);
+}
+#else
 static int decode_dinEVSEChargeParameterType(bitstream_t* stream, struct dinEVSEChargeParameterType* dinEVSEChargeParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -3186,9 +4407,31 @@ static int decode_dinEVSEChargeParameterType(bitstream_t* stream, struct dinEVSE
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CableCheckReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":DC_EVStatus)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CableCheckReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinCableCheckReqTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCableCheckReqType, DC_EVStatus), 0, 0, 0, decode_dinDC_EVStatusTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinCableCheckReqTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinCableCheckReqTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t dinCableCheckReqTypeGrammar = { dinCableCheckReqTypeStates, dinCableCheckReqTypeTransitions, dinCableCheckReqTypeProductions, NULL };
+
+static int decode_dinCableCheckReqType(bitstream_t* stream, struct dinCableCheckReqType* dinCableCheckReqType) {
+	init_dinCableCheckReqType(dinCableCheckReqType);
+	return decodeGrammar(stream, &dinCableCheckReqTypeGrammar, dinCableCheckReqType);
+}
+#else
 static int decode_dinCableCheckReqType(bitstream_t* stream, struct dinCableCheckReqType* dinCableCheckReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 55;
 	int done = 0;
 	
@@ -3236,9 +4479,62 @@ static int decode_dinCableCheckReqType(bitstream_t* stream, struct dinCableCheck
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_CableCheckReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,DC_EVChargeParameterType',  base type name='EVChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":DC_EVStatus,"urn:iso:15118:2:2010:MsgDataTypes":EVMaximumCurrentLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVMaximumPowerLimit{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVMaximumVoltageLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVEnergyCapacity{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVEnergyRequest{0-1},"urn:iso:15118:2:2010:MsgDataTypes":FullSOC{0-1},"urn:iso:15118:2:2010:MsgDataTypes":BulkSOC{0-1})',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinDC_EVChargeParameterTypeProductions[9] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVChargeParameterType, DC_EVStatus), 0, 0, 0, decode_dinDC_EVStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVChargeParameterType, EVMaximumCurrentLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVChargeParameterType, EVMaximumPowerLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVChargeParameterType, EVMaximumVoltageLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVChargeParameterType, EVEnergyCapacity), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVChargeParameterType, EVEnergyRequest), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 7, sizeof(int8_t), 0, 3, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVChargeParameterType, FullSOC), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 7, sizeof(int8_t), 0, 4, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVChargeParameterType, BulkSOC), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinDC_EVChargeParameterTypeTransitions[20] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 7, 6 },
+	{ 8, 7 }, { 0, 8 }, { 6, 5 }, { 7, 6 }, { 8, 7 }, { 0, 8 }, { 7, 6 }, { 8, 7 },
+	{ 0, 8 }, { 8, 7 }, { 0, 8 }, { 0, 8 }
+};
+static const exi_grammar_state_t dinDC_EVChargeParameterTypeStates[9] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }, { 5, 3, 5 }, { 10, 3, 4 }, { 14, 2, 3 }, { 17, 2, 2 },
+	{ 19, 1, 1 }
+};
+static void dinDC_EVChargeParameterTypeUsed(void* value, uint8_t flag) {
+	struct dinDC_EVChargeParameterType* dinDC_EVChargeParameterType = (struct dinDC_EVChargeParameterType*)value;
+	switch(flag) {
+	case 0:
+		dinDC_EVChargeParameterType->EVMaximumPowerLimit_isUsed = 1u;
+		break;
+	case 1:
+		dinDC_EVChargeParameterType->EVEnergyCapacity_isUsed = 1u;
+		break;
+	case 2:
+		dinDC_EVChargeParameterType->EVEnergyRequest_isUsed = 1u;
+		break;
+	case 3:
+		dinDC_EVChargeParameterType->FullSOC_isUsed = 1u;
+		break;
+	case 4:
+		dinDC_EVChargeParameterType->BulkSOC_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinDC_EVChargeParameterTypeGrammar = { dinDC_EVChargeParameterTypeStates, dinDC_EVChargeParameterTypeTransitions, dinDC_EVChargeParameterTypeProductions, dinDC_EVChargeParameterTypeUsed };
+
+static int decode_dinDC_EVChargeParameterType(bitstream_t* stream, struct dinDC_EVChargeParameterType* dinDC_EVChargeParameterType) {
+	init_dinDC_EVChargeParameterType(dinDC_EVChargeParameterType);
+	return decodeGrammar(stream, &dinDC_EVChargeParameterTypeGrammar, dinDC_EVChargeParameterType);
+}
+#else
 static int decode_dinDC_EVChargeParameterType(bitstream_t* stream, struct dinDC_EVChargeParameterType* dinDC_EVChargeParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 65;
 	int done = 0;
 	
@@ -3572,9 +4868,30 @@ static int decode_dinDC_EVChargeParameterType(bitstream_t* stream, struct dinDC_
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SAScheduleListType',  base type name='SASchedulesType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":SAScheduleTuple{1-UNBOUNDED})',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinSAScheduleListTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinSAScheduleListType_SAScheduleTuple_ARRAY_SIZE, offsetof(struct dinSAScheduleListType, SAScheduleTuple.array), offsetof(struct dinSAScheduleListType, SAScheduleTuple.arrayLen), sizeof(((struct dinSAScheduleListType*)0)->SAScheduleTuple.array[0]), 0, 0, 0, 0, decode_dinSAScheduleTupleTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSAScheduleListTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinSAScheduleListTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t dinSAScheduleListTypeGrammar = { dinSAScheduleListTypeStates, dinSAScheduleListTypeTransitions, dinSAScheduleListTypeProductions, NULL };
+
+static int decode_dinSAScheduleListType(bitstream_t* stream, struct dinSAScheduleListType* dinSAScheduleListType) {
+	init_dinSAScheduleListType(dinSAScheduleListType);
+	return decodeGrammar(stream, &dinSAScheduleListTypeGrammar, dinSAScheduleListType);
+}
+#else
 static int decode_dinSAScheduleListType(bitstream_t* stream, struct dinSAScheduleListType* dinSAScheduleListType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 73;
 	int done = 0;
 	
@@ -3588,7 +4905,16 @@ static int decode_dinSAScheduleListType(bitstream_t* stream, struct dinSASchedul
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinSAScheduleListType->SAScheduleTuple.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinSAScheduleListType->SAScheduleTuple.array, dinSAScheduleListType_SAScheduleTuple_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinSAScheduleListType->SAScheduleTuple.arrayLen < dinSAScheduleListType_SAScheduleTuple_ARRAY_SIZE) {
+#else
 					if (dinSAScheduleListType->SAScheduleTuple.arrayLen < dinSAScheduleListType_SAScheduleTuple_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinSAScheduleTupleType(stream, &dinSAScheduleListType->SAScheduleTuple.array[dinSAScheduleListType->SAScheduleTuple.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -3607,7 +4933,16 @@ static int decode_dinSAScheduleListType(bitstream_t* stream, struct dinSASchedul
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinSAScheduleListType->SAScheduleTuple.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinSAScheduleListType->SAScheduleTuple.array, dinSAScheduleListType_SAScheduleTuple_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinSAScheduleListType->SAScheduleTuple.arrayLen < dinSAScheduleListType_SAScheduleTuple_ARRAY_SIZE) {
+#else
 					if (dinSAScheduleListType->SAScheduleTuple.arrayLen < dinSAScheduleListType_SAScheduleTuple_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinSAScheduleTupleType(stream, &dinSAScheduleListType->SAScheduleTuple.array[dinSAScheduleListType->SAScheduleTuple.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -3634,9 +4969,31 @@ static int decode_dinSAScheduleListType(bitstream_t* stream, struct dinSASchedul
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,PMaxScheduleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":PMaxScheduleID,"urn:iso:15118:2:2010:MsgDataTypes":PMaxScheduleEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinPMaxScheduleTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPMaxScheduleType, PMaxScheduleID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinPMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE, offsetof(struct dinPMaxScheduleType, PMaxScheduleEntry.array), offsetof(struct dinPMaxScheduleType, PMaxScheduleEntry.arrayLen), sizeof(((struct dinPMaxScheduleType*)0)->PMaxScheduleEntry.array[0]), 0, 0, 0, 0, decode_dinPMaxScheduleEntryTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinPMaxScheduleTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinPMaxScheduleTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }
+};
+static const exi_grammar_t dinPMaxScheduleTypeGrammar = { dinPMaxScheduleTypeStates, dinPMaxScheduleTypeTransitions, dinPMaxScheduleTypeProductions, NULL };
+
+static int decode_dinPMaxScheduleType(bitstream_t* stream, struct dinPMaxScheduleType* dinPMaxScheduleType) {
+	init_dinPMaxScheduleType(dinPMaxScheduleType);
+	return decodeGrammar(stream, &dinPMaxScheduleTypeGrammar, dinPMaxScheduleType);
+}
+#else
 static int decode_dinPMaxScheduleType(bitstream_t* stream, struct dinPMaxScheduleType* dinPMaxScheduleType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 75;
 	int done = 0;
 	
@@ -3682,7 +5039,16 @@ static int decode_dinPMaxScheduleType(bitstream_t* stream, struct dinPMaxSchedul
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinPMaxScheduleType->PMaxScheduleEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinPMaxScheduleType->PMaxScheduleEntry.array, dinPMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinPMaxScheduleType->PMaxScheduleEntry.arrayLen < dinPMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE) {
+#else
 					if (dinPMaxScheduleType->PMaxScheduleEntry.arrayLen < dinPMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinPMaxScheduleEntryType(stream, &dinPMaxScheduleType->PMaxScheduleEntry.array[dinPMaxScheduleType->PMaxScheduleEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -3701,7 +5067,16 @@ static int decode_dinPMaxScheduleType(bitstream_t* stream, struct dinPMaxSchedul
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinPMaxScheduleType->PMaxScheduleEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinPMaxScheduleType->PMaxScheduleEntry.array, dinPMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinPMaxScheduleType->PMaxScheduleEntry.arrayLen < dinPMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE) {
+#else
 					if (dinPMaxScheduleType->PMaxScheduleEntry.arrayLen < dinPMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinPMaxScheduleEntryType(stream, &dinPMaxScheduleType->PMaxScheduleEntry.array[dinPMaxScheduleType->PMaxScheduleEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -3728,9 +5103,33 @@ static int decode_dinPMaxScheduleType(bitstream_t* stream, struct dinPMaxSchedul
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ServicePaymentSelectionReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":SelectedPaymentOption,"urn:iso:15118:2:2010:MsgBody":SelectedServiceList)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ServicePaymentSelectionReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinServicePaymentSelectionReqTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 1, sizeof(dinpaymentOptionType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServicePaymentSelectionReqType, SelectedPaymentOption), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServicePaymentSelectionReqType, SelectedServiceList), 0, 0, 0, decode_dinSelectedServiceListTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinServicePaymentSelectionReqTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinServicePaymentSelectionReqTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t dinServicePaymentSelectionReqTypeGrammar = { dinServicePaymentSelectionReqTypeStates, dinServicePaymentSelectionReqTypeTransitions, dinServicePaymentSelectionReqTypeProductions, NULL };
+
+static int decode_dinServicePaymentSelectionReqType(bitstream_t* stream, struct dinServicePaymentSelectionReqType* dinServicePaymentSelectionReqType) {
+	init_dinServicePaymentSelectionReqType(dinServicePaymentSelectionReqType);
+	return decodeGrammar(stream, &dinServicePaymentSelectionReqTypeGrammar, dinServicePaymentSelectionReqType);
+}
+#else
 static int decode_dinServicePaymentSelectionReqType(bitstream_t* stream, struct dinServicePaymentSelectionReqType* dinServicePaymentSelectionReqType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 78;
 	int done = 0;
 	
@@ -3811,9 +5210,40 @@ static int decode_dinServicePaymentSelectionReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_ServicePaymentSelectionReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,RelativeTimeIntervalType',  base type name='IntervalType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":start,"urn:iso:15118:2:2010:MsgDataTypes":duration{0-1})',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinRelativeTimeIntervalTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinRelativeTimeIntervalType, start), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinRelativeTimeIntervalType, duration), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinRelativeTimeIntervalTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinRelativeTimeIntervalTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }
+};
+static void dinRelativeTimeIntervalTypeUsed(void* value, uint8_t flag) {
+	struct dinRelativeTimeIntervalType* dinRelativeTimeIntervalType = (struct dinRelativeTimeIntervalType*)value;
+	switch(flag) {
+	case 0:
+		dinRelativeTimeIntervalType->duration_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinRelativeTimeIntervalTypeGrammar = { dinRelativeTimeIntervalTypeStates, dinRelativeTimeIntervalTypeTransitions, dinRelativeTimeIntervalTypeProductions, dinRelativeTimeIntervalTypeUsed };
+
+static int decode_dinRelativeTimeIntervalType(bitstream_t* stream, struct dinRelativeTimeIntervalType* dinRelativeTimeIntervalType) {
+	init_dinRelativeTimeIntervalType(dinRelativeTimeIntervalType);
+	return decodeGrammar(stream, &dinRelativeTimeIntervalTypeGrammar, dinRelativeTimeIntervalType);
+}
+#else
 static int decode_dinRelativeTimeIntervalType(bitstream_t* stream, struct dinRelativeTimeIntervalType* dinRelativeTimeIntervalType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 80;
 	int done = 0;
 	
@@ -3915,9 +5345,30 @@ static int decode_dinRelativeTimeIntervalType(bitstream_t* stream, struct dinRel
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,EVStatusType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if DIN_DEPLOY_EVStatus == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinEVStatusTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinEVStatusTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t dinEVStatusTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t dinEVStatusTypeGrammar = { dinEVStatusTypeStates, dinEVStatusTypeTransitions, dinEVStatusTypeProductions, NULL };
+
+static int decode_dinEVStatusType(bitstream_t* stream, struct dinEVStatusType* dinEVStatusType) {
+	init_dinEVStatusType(dinEVStatusType);
+	return decodeGrammar(stream, &dinEVStatusTypeGrammar, dinEVStatusType);
+}
+#else
 static int decode_dinEVStatusType(bitstream_t* stream, struct dinEVStatusType* dinEVStatusType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -3950,9 +5401,35 @@ static int decode_dinEVStatusType(bitstream_t* stream, struct dinEVStatusType* d
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_EVStatus */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,PreChargeResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2010:MsgBody":EVSEPresentVoltage)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_PreChargeRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinPreChargeResTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPreChargeResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPreChargeResType, DC_EVSEStatus), 0, 0, 0, decode_dinDC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPreChargeResType, EVSEPresentVoltage), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinPreChargeResTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinPreChargeResTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t dinPreChargeResTypeGrammar = { dinPreChargeResTypeStates, dinPreChargeResTypeTransitions, dinPreChargeResTypeProductions, NULL };
+
+static int decode_dinPreChargeResType(bitstream_t* stream, struct dinPreChargeResType* dinPreChargeResType) {
+	init_dinPreChargeResType(dinPreChargeResType);
+	return decodeGrammar(stream, &dinPreChargeResTypeGrammar, dinPreChargeResType);
+}
+#else
 static int decode_dinPreChargeResType(bitstream_t* stream, struct dinPreChargeResType* dinPreChargeResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 13;
 	int done = 0;
 	
@@ -4048,9 +5525,55 @@ static int decode_dinPreChargeResType(bitstream_t* stream, struct dinPreChargeRe
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_PreChargeRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,DC_EVSEChargeParameterType',  base type name='EVSEChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":DC_EVSEStatus,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaximumCurrentLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaximumPowerLimit{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaximumVoltageLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMinimumCurrentLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMinimumVoltageLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVSECurrentRegulationTolerance{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVSEPeakCurrentRipple,"urn:iso:15118:2:2010:MsgDataTypes":EVSEEnergyToBeDelivered{0-1})',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinDC_EVSEChargeParameterTypeProductions[10] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEChargeParameterType, DC_EVSEStatus), 0, 0, 0, decode_dinDC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEChargeParameterType, EVSEMaximumCurrentLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEChargeParameterType, EVSEMaximumPowerLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEChargeParameterType, EVSEMaximumVoltageLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEChargeParameterType, EVSEMinimumCurrentLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEChargeParameterType, EVSEMinimumVoltageLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEChargeParameterType, EVSECurrentRegulationTolerance), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEChargeParameterType, EVSEPeakCurrentRipple), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEChargeParameterType, EVSEEnergyToBeDelivered), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinDC_EVSEChargeParameterTypeTransitions[13] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 7, 6 },
+	{ 8, 7 }, { 8, 7 }, { 9, 8 }, { 0, 9 }, { 0, 9 }
+};
+static const exi_grammar_state_t dinDC_EVSEChargeParameterTypeStates[10] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }, { 5, 1, 1 }, { 6, 1, 1 }, { 7, 2, 2 }, { 9, 1, 1 },
+	{ 10, 2, 2 }, { 12, 1, 1 }
+};
+static void dinDC_EVSEChargeParameterTypeUsed(void* value, uint8_t flag) {
+	struct dinDC_EVSEChargeParameterType* dinDC_EVSEChargeParameterType = (struct dinDC_EVSEChargeParameterType*)value;
+	switch(flag) {
+	case 0:
+		dinDC_EVSEChargeParameterType->EVSEMaximumPowerLimit_isUsed = 1u;
+		break;
+	case 1:
+		dinDC_EVSEChargeParameterType->EVSECurrentRegulationTolerance_isUsed = 1u;
+		break;
+	case 2:
+		dinDC_EVSEChargeParameterType->EVSEEnergyToBeDelivered_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinDC_EVSEChargeParameterTypeGrammar = { dinDC_EVSEChargeParameterTypeStates, dinDC_EVSEChargeParameterTypeTransitions, dinDC_EVSEChargeParameterTypeProductions, dinDC_EVSEChargeParameterTypeUsed };
+
+static int decode_dinDC_EVSEChargeParameterType(bitstream_t* stream, struct dinDC_EVSEChargeParameterType* dinDC_EVSEChargeParameterType) {
+	init_dinDC_EVSEChargeParameterType(dinDC_EVSEChargeParameterType);
+	return decodeGrammar(stream, &dinDC_EVSEChargeParameterTypeGrammar, dinDC_EVSEChargeParameterType);
+}
+#else
 static int decode_dinDC_EVSEChargeParameterType(bitstream_t* stream, struct dinDC_EVSEChargeParameterType* dinDC_EVSEChargeParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 82;
 	int done = 0;
 	
@@ -4233,9 +5756,34 @@ static int decode_dinDC_EVSEChargeParameterType(bitstream_t* stream, struct dinD
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,PaymentDetailsResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":GenChallenge,"urn:iso:15118:2:2010:MsgBody":DateTimeNow)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_PaymentDetailsRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinPaymentDetailsResTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPaymentDetailsResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPaymentDetailsResType, GenChallenge.characters), offsetof(struct dinPaymentDetailsResType, GenChallenge.charactersLen), dinPaymentDetailsResType_GenChallenge_CHARACTERS_SIZE, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER64, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPaymentDetailsResType, DateTimeNow), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinPaymentDetailsResTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinPaymentDetailsResTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t dinPaymentDetailsResTypeGrammar = { dinPaymentDetailsResTypeStates, dinPaymentDetailsResTypeTransitions, dinPaymentDetailsResTypeProductions, NULL };
+
+static int decode_dinPaymentDetailsResType(bitstream_t* stream, struct dinPaymentDetailsResType* dinPaymentDetailsResType) {
+	init_dinPaymentDetailsResType(dinPaymentDetailsResType);
+	return decodeGrammar(stream, &dinPaymentDetailsResTypeGrammar, dinPaymentDetailsResType);
+}
+#else
 static int decode_dinPaymentDetailsResType(bitstream_t* stream, struct dinPaymentDetailsResType* dinPaymentDetailsResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 91;
 	int done = 0;
 	
@@ -4290,10 +5838,24 @@ static int decode_dinPaymentDetailsResType(bitstream_t* stream, struct dinPaymen
 							if (errn == 0) {
 								if (dinPaymentDetailsResType->GenChallenge.charactersLen >= 2) {
 									dinPaymentDetailsResType->GenChallenge.charactersLen = (uint16_t)(dinPaymentDetailsResType->GenChallenge.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinPaymentDetailsResType->GenChallenge.characters, CHARACTER_UNITS(dinPaymentDetailsResType->GenChallenge.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinPaymentDetailsResType->GenChallenge.charactersLen, dinPaymentDetailsResType->GenChallenge.characters, dinPaymentDetailsResType_GenChallenge_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinPaymentDetailsResType->GenChallenge.charactersLen, dinPaymentDetailsResType->GenChallenge.characters, dinPaymentDetailsResType_GenChallenge_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, dinPaymentDetailsResType->GenChallenge.characters, dinPaymentDetailsResType->GenChallenge.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, &dinPaymentDetailsResType->GenChallenge.charactersLen, &dinPaymentDetailsResType->GenChallenge.characters);
+#else
+									errn = decodeStringValueHit(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, &dinPaymentDetailsResType->GenChallenge.charactersLen, dinPaymentDetailsResType->GenChallenge.characters, dinPaymentDetailsResType_GenChallenge_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -4374,9 +5936,61 @@ static int decode_dinPaymentDetailsResType(bitstream_t* stream, struct dinPaymen
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_PaymentDetailsRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":P,"http://www.w3.org/2000/09/xmldsig#":Q){0-1},"http://www.w3.org/2000/09/xmldsig#":G{0-1},"http://www.w3.org/2000/09/xmldsig#":Y,"http://www.w3.org/2000/09/xmldsig#":J{0-1},("http://www.w3.org/2000/09/xmldsig#":Seed,"http://www.w3.org/2000/09/xmldsig#":PgenCounter){0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinDSAKeyValueTypeProductions[8] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinDSAKeyValueType, P.bytes), offsetof(struct dinDSAKeyValueType, P.bytesLen), dinDSAKeyValueType_P_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinDSAKeyValueType, G.bytes), offsetof(struct dinDSAKeyValueType, G.bytesLen), dinDSAKeyValueType_G_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDSAKeyValueType, Y.bytes), offsetof(struct dinDSAKeyValueType, Y.bytesLen), dinDSAKeyValueType_Y_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinDSAKeyValueType, Q.bytes), offsetof(struct dinDSAKeyValueType, Q.bytesLen), dinDSAKeyValueType_Q_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct dinDSAKeyValueType, J.bytes), offsetof(struct dinDSAKeyValueType, J.bytesLen), dinDSAKeyValueType_J_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 4, 0, 0, 0, 0, 0, offsetof(struct dinDSAKeyValueType, Seed.bytes), offsetof(struct dinDSAKeyValueType, Seed.bytesLen), dinDSAKeyValueType_Seed_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 5, 0, 0, 0, 0, 0, offsetof(struct dinDSAKeyValueType, PgenCounter.bytes), offsetof(struct dinDSAKeyValueType, PgenCounter.bytesLen), dinDSAKeyValueType_PgenCounter_BYTES_SIZE, 0, NULL }
+};
+static const exi_grammar_transition_t dinDSAKeyValueTypeTransitions[14] = {
+	{ 1, 0 }, { 3, 1 }, { 4, 2 }, { 2, 3 }, { 3, 1 }, { 4, 2 }, { 4, 2 }, { 5, 4 },
+	{ 6, 5 }, { 0, 6 }, { 6, 5 }, { 0, 6 }, { 7, 7 }, { 0, 6 }
+};
+static const exi_grammar_state_t dinDSAKeyValueTypeStates[8] = {
+	{ 0, 2, 3 }, { 3, 1, 1 }, { 4, 2, 2 }, { 6, 1, 1 }, { 7, 2, 3 }, { 10, 2, 2 }, { 12, 1, 1 }, { 13, 1, 1 }
+};
+static void dinDSAKeyValueTypeUsed(void* value, uint8_t flag) {
+	struct dinDSAKeyValueType* dinDSAKeyValueType = (struct dinDSAKeyValueType*)value;
+	switch(flag) {
+	case 0:
+		dinDSAKeyValueType->P_isUsed = 1u;
+		break;
+	case 1:
+		dinDSAKeyValueType->G_isUsed = 1u;
+		break;
+	case 2:
+		dinDSAKeyValueType->Q_isUsed = 1u;
+		break;
+	case 3:
+		dinDSAKeyValueType->J_isUsed = 1u;
+		break;
+	case 4:
+		dinDSAKeyValueType->Seed_isUsed = 1u;
+		break;
+	case 5:
+		dinDSAKeyValueType->PgenCounter_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinDSAKeyValueTypeGrammar = { dinDSAKeyValueTypeStates, dinDSAKeyValueTypeTransitions, dinDSAKeyValueTypeProductions, dinDSAKeyValueTypeUsed };
+
 static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueType* dinDSAKeyValueType) {
+	init_dinDSAKeyValueType(dinDSAKeyValueType);
+	return decodeGrammar(stream, &dinDSAKeyValueTypeGrammar, dinDSAKeyValueType);
+}
+#else
+static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueType* dinDSAKeyValueType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 94;
 	int done = 0;
 	
@@ -4399,7 +6013,14 @@ static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 								errn =  (dinDSAKeyValueType->P.bytesLen) <= dinDSAKeyValueType_P_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinDSAKeyValueType->P.bytes, dinDSAKeyValueType->P.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinDSAKeyValueType->P.bytesLen, dinDSAKeyValueType->P.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinDSAKeyValueType->P.bytesLen, dinDSAKeyValueType->P.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							dinDSAKeyValueType->P_isUsed = 1u;
 						} else {
@@ -4427,7 +6048,14 @@ static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 								errn =  (dinDSAKeyValueType->G.bytesLen) <= dinDSAKeyValueType_G_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinDSAKeyValueType->G.bytes, dinDSAKeyValueType->G.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinDSAKeyValueType->G.bytesLen, dinDSAKeyValueType->G.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinDSAKeyValueType->G.bytesLen, dinDSAKeyValueType->G.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							dinDSAKeyValueType->G_isUsed = 1u;
 						} else {
@@ -4455,7 +6083,14 @@ static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 								errn =  (dinDSAKeyValueType->Y.bytesLen) <= dinDSAKeyValueType_Y_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinDSAKeyValueType->Y.bytes, dinDSAKeyValueType->Y.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinDSAKeyValueType->Y.bytesLen, dinDSAKeyValueType->Y.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinDSAKeyValueType->Y.bytesLen, dinDSAKeyValueType->Y.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -4493,7 +6128,14 @@ static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 								errn =  (dinDSAKeyValueType->Q.bytesLen) <= dinDSAKeyValueType_Q_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinDSAKeyValueType->Q.bytes, dinDSAKeyValueType->Q.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinDSAKeyValueType->Q.bytesLen, dinDSAKeyValueType->Q.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinDSAKeyValueType->Q.bytesLen, dinDSAKeyValueType->Q.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							dinDSAKeyValueType->Q_isUsed = 1u;
 						} else {
@@ -4532,7 +6174,14 @@ static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 								errn =  (dinDSAKeyValueType->G.bytesLen) <= dinDSAKeyValueType_G_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinDSAKeyValueType->G.bytes, dinDSAKeyValueType->G.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinDSAKeyValueType->G.bytesLen, dinDSAKeyValueType->G.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinDSAKeyValueType->G.bytesLen, dinDSAKeyValueType->G.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							dinDSAKeyValueType->G_isUsed = 1u;
 						} else {
@@ -4560,7 +6209,14 @@ static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 								errn =  (dinDSAKeyValueType->Y.bytesLen) <= dinDSAKeyValueType_Y_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinDSAKeyValueType->Y.bytes, dinDSAKeyValueType->Y.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinDSAKeyValueType->Y.bytesLen, dinDSAKeyValueType->Y.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinDSAKeyValueType->Y.bytesLen, dinDSAKeyValueType->Y.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -4598,7 +6254,14 @@ static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 								errn =  (dinDSAKeyValueType->Y.bytesLen) <= dinDSAKeyValueType_Y_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinDSAKeyValueType->Y.bytes, dinDSAKeyValueType->Y.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinDSAKeyValueType->Y.bytesLen, dinDSAKeyValueType->Y.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinDSAKeyValueType->Y.bytesLen, dinDSAKeyValueType->Y.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -4636,7 +6299,14 @@ static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 								errn =  (dinDSAKeyValueType->J.bytesLen) <= dinDSAKeyValueType_J_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinDSAKeyValueType->J.bytes, dinDSAKeyValueType->J.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinDSAKeyValueType->J.bytesLen, dinDSAKeyValueType->J.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinDSAKeyValueType->J.bytesLen, dinDSAKeyValueType->J.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							dinDSAKeyValueType->J_isUsed = 1u;
 						} else {
@@ -4664,7 +6334,14 @@ static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 								errn =  (dinDSAKeyValueType->Seed.bytesLen) <= dinDSAKeyValueType_Seed_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinDSAKeyValueType->Seed.bytes, dinDSAKeyValueType->Seed.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinDSAKeyValueType->Seed.bytesLen, dinDSAKeyValueType->Seed.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinDSAKeyValueType->Seed.bytesLen, dinDSAKeyValueType->Seed.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							dinDSAKeyValueType->Seed_isUsed = 1u;
 						} else {
@@ -4707,7 +6384,14 @@ static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 								errn =  (dinDSAKeyValueType->Seed.bytesLen) <= dinDSAKeyValueType_Seed_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinDSAKeyValueType->Seed.bytes, dinDSAKeyValueType->Seed.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinDSAKeyValueType->Seed.bytesLen, dinDSAKeyValueType->Seed.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinDSAKeyValueType->Seed.bytesLen, dinDSAKeyValueType->Seed.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							dinDSAKeyValueType->Seed_isUsed = 1u;
 						} else {
@@ -4750,7 +6434,14 @@ static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 								errn =  (dinDSAKeyValueType->PgenCounter.bytesLen) <= dinDSAKeyValueType_PgenCounter_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinDSAKeyValueType->PgenCounter.bytes, dinDSAKeyValueType->PgenCounter.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinDSAKeyValueType->PgenCounter.bytesLen, dinDSAKeyValueType->PgenCounter.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinDSAKeyValueType->PgenCounter.bytesLen, dinDSAKeyValueType->PgenCounter.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							dinDSAKeyValueType->PgenCounter_isUsed = 1u;
 						} else {
@@ -4799,9 +6490,29 @@ static int decode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SASchedulesType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinSASchedulesTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSASchedulesTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t dinSASchedulesTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t dinSASchedulesTypeGrammar = { dinSASchedulesTypeStates, dinSASchedulesTypeTransitions, dinSASchedulesTypeProductions, NULL };
+
 static int decode_dinSASchedulesType(bitstream_t* stream, struct dinSASchedulesType* dinSASchedulesType) {
+	init_dinSASchedulesType(dinSASchedulesType);
+	return decodeGrammar(stream, &dinSASchedulesTypeGrammar, dinSASchedulesType);
+}
+#else
+static int decode_dinSASchedulesType(bitstream_t* stream, struct dinSASchedulesType* dinSASchedulesType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -4834,9 +6545,38 @@ static int decode_dinSASchedulesType(bitstream_t* stream, struct dinSASchedulesT
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CertificateUpdateResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2010:MsgBody":ContractSignatureEncryptedPrivateKey,"urn:iso:15118:2:2010:MsgBody":DHParams,"urn:iso:15118:2:2010:MsgBody":ContractID,"urn:iso:15118:2:2010:MsgBody":RetryCounter)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CertificateUpdateRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinCertificateUpdateResTypeProductions[8] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateUpdateResType, Id.characters), offsetof(struct dinCertificateUpdateResType, Id.charactersLen), dinCertificateUpdateResType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateUpdateResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateUpdateResType, ContractSignatureCertChain), 0, 0, 0, decode_dinCertificateChainTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateUpdateResType, ContractSignatureEncryptedPrivateKey.bytes), offsetof(struct dinCertificateUpdateResType, ContractSignatureEncryptedPrivateKey.bytesLen), dinCertificateUpdateResType_ContractSignatureEncryptedPrivateKey_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateUpdateResType, DHParams.bytes), offsetof(struct dinCertificateUpdateResType, DHParams.bytesLen), dinCertificateUpdateResType_DHParams_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateUpdateResType, ContractID.characters), offsetof(struct dinCertificateUpdateResType, ContractID.charactersLen), dinCertificateUpdateResType_ContractID_CHARACTERS_SIZE, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateUpdateResType, RetryCounter), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinCertificateUpdateResTypeTransitions[8] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 7, 6 }, { 0, 7 }
+};
+static const exi_grammar_state_t dinCertificateUpdateResTypeStates[8] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }, { 6, 1, 1 }, { 7, 1, 1 }
+};
+static const exi_grammar_t dinCertificateUpdateResTypeGrammar = { dinCertificateUpdateResTypeStates, dinCertificateUpdateResTypeTransitions, dinCertificateUpdateResTypeProductions, NULL };
+
+static int decode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCertificateUpdateResType* dinCertificateUpdateResType) {
+	init_dinCertificateUpdateResType(dinCertificateUpdateResType);
+	return decodeGrammar(stream, &dinCertificateUpdateResTypeGrammar, dinCertificateUpdateResType);
+}
+#else
 static int decode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCertificateUpdateResType* dinCertificateUpdateResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 101;
 	int done = 0;
 	
@@ -4854,10 +6594,24 @@ static int decode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCer
 					if (errn == 0) {
 						if (dinCertificateUpdateResType->Id.charactersLen >= 2) {
 							dinCertificateUpdateResType->Id.charactersLen = (uint16_t)(dinCertificateUpdateResType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinCertificateUpdateResType->Id.characters, CHARACTER_UNITS(dinCertificateUpdateResType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinCertificateUpdateResType->Id.charactersLen, dinCertificateUpdateResType->Id.characters, dinCertificateUpdateResType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinCertificateUpdateResType->Id.charactersLen, dinCertificateUpdateResType->Id.characters, dinCertificateUpdateResType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinCertificateUpdateResType->Id.characters, dinCertificateUpdateResType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinCertificateUpdateResType->Id.charactersLen, &dinCertificateUpdateResType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinCertificateUpdateResType->Id.charactersLen, dinCertificateUpdateResType->Id.characters, dinCertificateUpdateResType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 102;
@@ -4931,7 +6685,14 @@ static int decode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCer
 								errn =  (dinCertificateUpdateResType->ContractSignatureEncryptedPrivateKey.bytesLen) <= dinCertificateUpdateResType_ContractSignatureEncryptedPrivateKey_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinCertificateUpdateResType->ContractSignatureEncryptedPrivateKey.bytes, dinCertificateUpdateResType->ContractSignatureEncryptedPrivateKey.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinCertificateUpdateResType->ContractSignatureEncryptedPrivateKey.bytesLen, dinCertificateUpdateResType->ContractSignatureEncryptedPrivateKey.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinCertificateUpdateResType->ContractSignatureEncryptedPrivateKey.bytesLen, dinCertificateUpdateResType->ContractSignatureEncryptedPrivateKey.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -4969,7 +6730,14 @@ static int decode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCer
 								errn =  (dinCertificateUpdateResType->DHParams.bytesLen) <= dinCertificateUpdateResType_DHParams_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinCertificateUpdateResType->DHParams.bytes, dinCertificateUpdateResType->DHParams.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinCertificateUpdateResType->DHParams.bytesLen, dinCertificateUpdateResType->DHParams.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinCertificateUpdateResType->DHParams.bytesLen, dinCertificateUpdateResType->DHParams.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -5006,10 +6774,24 @@ static int decode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCer
 							if (errn == 0) {
 								if (dinCertificateUpdateResType->ContractID.charactersLen >= 2) {
 									dinCertificateUpdateResType->ContractID.charactersLen = (uint16_t)(dinCertificateUpdateResType->ContractID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinCertificateUpdateResType->ContractID.characters, CHARACTER_UNITS(dinCertificateUpdateResType->ContractID.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinCertificateUpdateResType->ContractID.charactersLen, dinCertificateUpdateResType->ContractID.characters, dinCertificateUpdateResType_ContractID_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinCertificateUpdateResType->ContractID.charactersLen, dinCertificateUpdateResType->ContractID.characters, dinCertificateUpdateResType_ContractID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, dinCertificateUpdateResType->ContractID.characters, dinCertificateUpdateResType->ContractID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, &dinCertificateUpdateResType->ContractID.charactersLen, &dinCertificateUpdateResType->ContractID.characters);
+#else
+									errn = decodeStringValueHit(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, &dinCertificateUpdateResType->ContractID.charactersLen, dinCertificateUpdateResType->ContractID.characters, dinCertificateUpdateResType_ContractID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -5090,9 +6872,30 @@ static int decode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCer
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_CertificateUpdateRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,EVChargeParameterType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinEVChargeParameterTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinEVChargeParameterTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t dinEVChargeParameterTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t dinEVChargeParameterTypeGrammar = { dinEVChargeParameterTypeStates, dinEVChargeParameterTypeTransitions, dinEVChargeParameterTypeProductions, NULL };
+
 static int decode_dinEVChargeParameterType(bitstream_t* stream, struct dinEVChargeParameterType* dinEVChargeParameterType) {
+	init_dinEVChargeParameterType(dinEVChargeParameterType);
+	return decodeGrammar(stream, &dinEVChargeParameterTypeGrammar, dinEVChargeParameterType);
+}
+#else
+static int decode_dinEVChargeParameterType(bitstream_t* stream, struct dinEVChargeParameterType* dinEVChargeParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -5125,9 +6928,43 @@ static int decode_dinEVChargeParameterType(bitstream_t* stream, struct dinEVChar
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgHeader,MessageHeaderType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgHeader":SessionID,"urn:iso:15118:2:2010:MsgHeader":Notification{0-1},"http://www.w3.org/2000/09/xmldsig#":Signature{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinMessageHeaderTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinMessageHeaderType, SessionID.bytes), offsetof(struct dinMessageHeaderType, SessionID.bytesLen), dinMessageHeaderType_SessionID_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinMessageHeaderType, Notification), 0, 0, 0, decode_dinNotificationTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinMessageHeaderType, Signature), 0, 0, 0, decode_dinSignatureTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinMessageHeaderTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 3, 2 }, { 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinMessageHeaderTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 2, 2 }, { 6, 1, 1 }
+};
+static void dinMessageHeaderTypeUsed(void* value, uint8_t flag) {
+	struct dinMessageHeaderType* dinMessageHeaderType = (struct dinMessageHeaderType*)value;
+	switch(flag) {
+	case 0:
+		dinMessageHeaderType->Notification_isUsed = 1u;
+		break;
+	case 1:
+		dinMessageHeaderType->Signature_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinMessageHeaderTypeGrammar = { dinMessageHeaderTypeStates, dinMessageHeaderTypeTransitions, dinMessageHeaderTypeProductions, dinMessageHeaderTypeUsed };
+
+static int decode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHeaderType* dinMessageHeaderType) {
+	init_dinMessageHeaderType(dinMessageHeaderType);
+	return decodeGrammar(stream, &dinMessageHeaderTypeGrammar, dinMessageHeaderType);
+}
+#else
 static int decode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHeaderType* dinMessageHeaderType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 108;
 	int done = 0;
 	
@@ -5184,7 +7021,14 @@ static int decode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHea
 					grammarID = 110;
 					break;
 				case 1:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, dinMessageHeaderType->Signature, 1);
+					if (errn == 0) {
+						errn = decode_dinSignatureType(stream, dinMessageHeaderType->Signature);
+					}
+#else
 					errn = decode_dinSignatureType(stream, &dinMessageHeaderType->Signature);
+#endif /* DATABINDING_SLIM */
 					dinMessageHeaderType->Signature_isUsed = 1u;
 					grammarID = 4;
 					break;
@@ -5204,7 +7048,14 @@ static int decode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHea
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, dinMessageHeaderType->Signature, 1);
+					if (errn == 0) {
+						errn = decode_dinSignatureType(stream, dinMessageHeaderType->Signature);
+					}
+#else
 					errn = decode_dinSignatureType(stream, &dinMessageHeaderType->Signature);
+#endif /* DATABINDING_SLIM */
 					dinMessageHeaderType->Signature_isUsed = 1u;
 					grammarID = 4;
 					break;
@@ -5243,9 +7094,30 @@ static int decode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHea
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDef,BodyBaseType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if DIN_DEPLOY_BodyElement == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinBodyBaseTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinBodyBaseTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t dinBodyBaseTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t dinBodyBaseTypeGrammar = { dinBodyBaseTypeStates, dinBodyBaseTypeTransitions, dinBodyBaseTypeProductions, NULL };
+
+static int decode_dinBodyBaseType(bitstream_t* stream, struct dinBodyBaseType* dinBodyBaseType) {
+	init_dinBodyBaseType(dinBodyBaseType);
+	return decodeGrammar(stream, &dinBodyBaseTypeGrammar, dinBodyBaseType);
+}
+#else
 static int decode_dinBodyBaseType(bitstream_t* stream, struct dinBodyBaseType* dinBodyBaseType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -5278,9 +7150,49 @@ static int decode_dinBodyBaseType(bitstream_t* stream, struct dinBodyBaseType* d
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_BodyElement */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyValueType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":DSAKeyValue|"http://www.w3.org/2000/09/xmldsig#":RSAKeyValue|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinKeyValueTypeProductions[5] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinKeyValueType, DSAKeyValue), 0, 0, 0, decode_dinDSAKeyValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinKeyValueType, RSAKeyValue), 0, 0, 0, decode_dinRSAKeyValueTypeGeneric },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinKeyValueType, ANY.characters), offsetof(struct dinKeyValueType, ANY.charactersLen), dinKeyValueType_ANY_CHARACTERS_SIZE, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinKeyValueTypeTransitions[10] = {
+	{ 1, 0 }, { 1, 1 }, { 1, 2 }, { 2, 3 }, { 0, 4 }, { 1, 3 }, { 1, 0 }, { 1, 1 },
+	{ 1, 2 }, { 2, 3 }
+};
+static const exi_grammar_state_t dinKeyValueTypeStates[3] = {
+	{ 0, 3, 4 }, { 4, 2, 2 }, { 6, 3, 4 }
+};
+static void dinKeyValueTypeUsed(void* value, uint8_t flag) {
+	struct dinKeyValueType* dinKeyValueType = (struct dinKeyValueType*)value;
+	switch(flag) {
+	case 0:
+		dinKeyValueType->DSAKeyValue_isUsed = 1u;
+		break;
+	case 1:
+		dinKeyValueType->RSAKeyValue_isUsed = 1u;
+		break;
+	case 2:
+		dinKeyValueType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinKeyValueTypeGrammar = { dinKeyValueTypeStates, dinKeyValueTypeTransitions, dinKeyValueTypeProductions, dinKeyValueTypeUsed };
+
 static int decode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* dinKeyValueType) {
+	init_dinKeyValueType(dinKeyValueType);
+	return decodeGrammar(stream, &dinKeyValueTypeGrammar, dinKeyValueType);
+}
+#else
+static int decode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* dinKeyValueType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 111;
 	int done = 0;
 	
@@ -5294,7 +7206,14 @@ static int decode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* d
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, dinKeyValueType->DSAKeyValue, 1);
+					if (errn == 0) {
+						errn = decode_dinDSAKeyValueType(stream, dinKeyValueType->DSAKeyValue);
+					}
+#else
 					errn = decode_dinDSAKeyValueType(stream, &dinKeyValueType->DSAKeyValue);
+#endif /* DATABINDING_SLIM */
 					dinKeyValueType->DSAKeyValue_isUsed = 1u;
 					grammarID = 112;
 					break;
@@ -5313,10 +7232,24 @@ static int decode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* d
 					if (errn == 0) {
 						if (dinKeyValueType->ANY.charactersLen >= 2) {
 							dinKeyValueType->ANY.charactersLen = (uint16_t)(dinKeyValueType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinKeyValueType->ANY.characters, CHARACTER_UNITS(dinKeyValueType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinKeyValueType->ANY.charactersLen, dinKeyValueType->ANY.characters, dinKeyValueType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinKeyValueType->ANY.charactersLen, dinKeyValueType->ANY.characters, dinKeyValueType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, dinKeyValueType->ANY.characters, dinKeyValueType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &dinKeyValueType->ANY.charactersLen, &dinKeyValueType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &dinKeyValueType->ANY.charactersLen, dinKeyValueType->ANY.characters, dinKeyValueType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinKeyValueType->ANY_isUsed = 1u;
@@ -5342,10 +7275,24 @@ static int decode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* d
 					if (errn == 0) {
 						if (dinKeyValueType->ANY.charactersLen >= 2) {
 							dinKeyValueType->ANY.charactersLen = (uint16_t)(dinKeyValueType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinKeyValueType->ANY.characters, CHARACTER_UNITS(dinKeyValueType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinKeyValueType->ANY.charactersLen, dinKeyValueType->ANY.characters, dinKeyValueType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinKeyValueType->ANY.charactersLen, dinKeyValueType->ANY.characters, dinKeyValueType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, dinKeyValueType->ANY.characters, dinKeyValueType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &dinKeyValueType->ANY.charactersLen, &dinKeyValueType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &dinKeyValueType->ANY.charactersLen, dinKeyValueType->ANY.characters, dinKeyValueType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinKeyValueType->ANY_isUsed = 1u;
@@ -5363,7 +7310,14 @@ static int decode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* d
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, dinKeyValueType->DSAKeyValue, 1);
+					if (errn == 0) {
+						errn = decode_dinDSAKeyValueType(stream, dinKeyValueType->DSAKeyValue);
+					}
+#else
 					errn = decode_dinDSAKeyValueType(stream, &dinKeyValueType->DSAKeyValue);
+#endif /* DATABINDING_SLIM */
 					dinKeyValueType->DSAKeyValue_isUsed = 1u;
 					grammarID = 112;
 					break;
@@ -5382,10 +7336,24 @@ static int decode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* d
 					if (errn == 0) {
 						if (dinKeyValueType->ANY.charactersLen >= 2) {
 							dinKeyValueType->ANY.charactersLen = (uint16_t)(dinKeyValueType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinKeyValueType->ANY.characters, CHARACTER_UNITS(dinKeyValueType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinKeyValueType->ANY.charactersLen, dinKeyValueType->ANY.characters, dinKeyValueType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinKeyValueType->ANY.charactersLen, dinKeyValueType->ANY.characters, dinKeyValueType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, dinKeyValueType->ANY.characters, dinKeyValueType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &dinKeyValueType->ANY.charactersLen, &dinKeyValueType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &dinKeyValueType->ANY.charactersLen, dinKeyValueType->ANY.characters, dinKeyValueType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinKeyValueType->ANY_isUsed = 1u;
@@ -5407,9 +7375,29 @@ static int decode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* d
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,IntervalType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinIntervalTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinIntervalTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t dinIntervalTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t dinIntervalTypeGrammar = { dinIntervalTypeStates, dinIntervalTypeTransitions, dinIntervalTypeProductions, NULL };
+
+static int decode_dinIntervalType(bitstream_t* stream, struct dinIntervalType* dinIntervalType) {
+	init_dinIntervalType(dinIntervalType);
+	return decodeGrammar(stream, &dinIntervalTypeGrammar, dinIntervalType);
+}
+#else
 static int decode_dinIntervalType(bitstream_t* stream, struct dinIntervalType* dinIntervalType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -5442,9 +7430,58 @@ static int decode_dinIntervalType(bitstream_t* stream, struct dinIntervalType* d
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ChargeParameterDiscoveryResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":EVSEProcessing,"urn:iso:15118:2:2010:MsgDataTypes":SASchedules,"urn:iso:15118:2:2010:MsgDataTypes":EVSEChargeParameter)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinChargeParameterDiscoveryResTypeProductions[8] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinChargeParameterDiscoveryResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 1, sizeof(dinEVSEProcessingType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinChargeParameterDiscoveryResType, EVSEProcessing), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinChargeParameterDiscoveryResType, SAScheduleList), 0, 0, 0, decode_dinSAScheduleListTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinChargeParameterDiscoveryResType, SASchedules), 0, 0, 0, decode_dinSASchedulesTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinChargeParameterDiscoveryResType, AC_EVSEChargeParameter), 0, 0, 0, decode_dinAC_EVSEChargeParameterTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct dinChargeParameterDiscoveryResType, DC_EVSEChargeParameter), 0, 0, 0, decode_dinDC_EVSEChargeParameterTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, offsetof(struct dinChargeParameterDiscoveryResType, EVSEChargeParameter), 0, 0, 0, decode_dinEVSEChargeParameterTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinChargeParameterDiscoveryResTypeTransitions[8] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 3, 3 }, { 4, 4 }, { 4, 5 }, { 4, 6 }, { 0, 7 }
+};
+static const exi_grammar_state_t dinChargeParameterDiscoveryResTypeStates[5] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 2, 3 }, { 7, 1, 1 }
+};
+static void dinChargeParameterDiscoveryResTypeUsed(void* value, uint8_t flag) {
+	struct dinChargeParameterDiscoveryResType* dinChargeParameterDiscoveryResType = (struct dinChargeParameterDiscoveryResType*)value;
+	switch(flag) {
+	case 0:
+		dinChargeParameterDiscoveryResType->SAScheduleList_isUsed = 1u;
+		break;
+	case 1:
+		dinChargeParameterDiscoveryResType->SASchedules_isUsed = 1u;
+		break;
+	case 2:
+		dinChargeParameterDiscoveryResType->AC_EVSEChargeParameter_isUsed = 1u;
+		break;
+	case 3:
+		dinChargeParameterDiscoveryResType->DC_EVSEChargeParameter_isUsed = 1u;
+		break;
+	case 4:
+		dinChargeParameterDiscoveryResType->EVSEChargeParameter_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinChargeParameterDiscoveryResTypeGrammar = { dinChargeParameterDiscoveryResTypeStates, dinChargeParameterDiscoveryResTypeTransitions, dinChargeParameterDiscoveryResTypeProductions, dinChargeParameterDiscoveryResTypeUsed };
+
+static int decode_dinChargeParameterDiscoveryResType(bitstream_t* stream, struct dinChargeParameterDiscoveryResType* dinChargeParameterDiscoveryResType) {
+	init_dinChargeParameterDiscoveryResType(dinChargeParameterDiscoveryResType);
+	return decodeGrammar(stream, &dinChargeParameterDiscoveryResTypeGrammar, dinChargeParameterDiscoveryResType);
+}
+#else
 static int decode_dinChargeParameterDiscoveryResType(bitstream_t* stream, struct dinChargeParameterDiscoveryResType* dinChargeParameterDiscoveryResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 114;
 	int done = 0;
 	
@@ -5550,7 +7587,14 @@ static int decode_dinChargeParameterDiscoveryResType(bitstream_t* stream, struct
 					grammarID = 4;
 					break;
 				case 1:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, dinChargeParameterDiscoveryResType->DC_EVSEChargeParameter, 1);
+					if (errn == 0) {
+						errn = decode_dinDC_EVSEChargeParameterType(stream, dinChargeParameterDiscoveryResType->DC_EVSEChargeParameter);
+					}
+#else
 					errn = decode_dinDC_EVSEChargeParameterType(stream, &dinChargeParameterDiscoveryResType->DC_EVSEChargeParameter);
+#endif /* DATABINDING_SLIM */
 					dinChargeParameterDiscoveryResType->DC_EVSEChargeParameter_isUsed = 1u;
 					grammarID = 4;
 					break;
@@ -5590,9 +7634,14 @@ static int decode_dinChargeParameterDiscoveryResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,PowerDeliveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ReadyToChargeState,"urn:iso:15118:2:2010:MsgBody":ChargingProfile{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVPowerDeliveryParameter{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 static int decode_dinPowerDeliveryReqType(bitstream_t* stream, struct dinPowerDeliveryReqType* dinPowerDeliveryReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 118;
 	int done = 0;
 	
@@ -5724,9 +7773,39 @@ static int decode_dinPowerDeliveryReqType(bitstream_t* stream, struct dinPowerDe
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_PowerDeliveryReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,CertificateChainType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":Certificate,"urn:iso:15118:2:2010:MsgDataTypes":SubCertificates{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinCertificateChainTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateChainType, Certificate.bytes), offsetof(struct dinCertificateChainType, Certificate.bytesLen), dinCertificateChainType_Certificate_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinCertificateChainType, SubCertificates), 0, 0, 0, decode_dinSubCertificatesTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinCertificateChainTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinCertificateChainTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }
+};
+static void dinCertificateChainTypeUsed(void* value, uint8_t flag) {
+	struct dinCertificateChainType* dinCertificateChainType = (struct dinCertificateChainType*)value;
+	switch(flag) {
+	case 0:
+		dinCertificateChainType->SubCertificates_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinCertificateChainTypeGrammar = { dinCertificateChainTypeStates, dinCertificateChainTypeTransitions, dinCertificateChainTypeProductions, dinCertificateChainTypeUsed };
+
+static int decode_dinCertificateChainType(bitstream_t* stream, struct dinCertificateChainType* dinCertificateChainType) {
+	init_dinCertificateChainType(dinCertificateChainType);
+	return decodeGrammar(stream, &dinCertificateChainTypeGrammar, dinCertificateChainType);
+}
+#else
 static int decode_dinCertificateChainType(bitstream_t* stream, struct dinCertificateChainType* dinCertificateChainType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 121;
 	int done = 0;
 	
@@ -5749,7 +7828,14 @@ static int decode_dinCertificateChainType(bitstream_t* stream, struct dinCertifi
 								errn =  (dinCertificateChainType->Certificate.bytesLen) <= dinCertificateChainType_Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinCertificateChainType->Certificate.bytes, dinCertificateChainType->Certificate.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinCertificateChainType->Certificate.bytesLen, dinCertificateChainType->Certificate.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinCertificateChainType->Certificate.bytesLen, dinCertificateChainType->Certificate.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -5817,9 +7903,30 @@ static int decode_dinCertificateChainType(bitstream_t* stream, struct dinCertifi
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transform{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinTransformsTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinTransformsType_Transform_ARRAY_SIZE, offsetof(struct dinTransformsType, Transform.array), offsetof(struct dinTransformsType, Transform.arrayLen), sizeof(((struct dinTransformsType*)0)->Transform.array[0]), 0, 0, 0, 0, decode_dinTransformTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinTransformsTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinTransformsTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t dinTransformsTypeGrammar = { dinTransformsTypeStates, dinTransformsTypeTransitions, dinTransformsTypeProductions, NULL };
+
+static int decode_dinTransformsType(bitstream_t* stream, struct dinTransformsType* dinTransformsType) {
+	init_dinTransformsType(dinTransformsType);
+	return decodeGrammar(stream, &dinTransformsTypeGrammar, dinTransformsType);
+}
+#else
 static int decode_dinTransformsType(bitstream_t* stream, struct dinTransformsType* dinTransformsType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 123;
 	int done = 0;
 	
@@ -5879,9 +7986,43 @@ static int decode_dinTransformsType(bitstream_t* stream, struct dinTransformsTyp
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,EntryType',  base type name='anyType',  content type='ELEMENT',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":TimeInterval)',  derivedBy='RESTRICTION'.  */
+#if DIN_DEPLOY_Entry == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinEntryTypeProductions[3] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinEntryType, RelativeTimeInterval), 0, 0, 0, decode_dinRelativeTimeIntervalTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinEntryType, TimeInterval), 0, 0, 0, decode_dinIntervalTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinEntryTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinEntryTypeStates[2] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }
+};
+static void dinEntryTypeUsed(void* value, uint8_t flag) {
+	struct dinEntryType* dinEntryType = (struct dinEntryType*)value;
+	switch(flag) {
+	case 0:
+		dinEntryType->RelativeTimeInterval_isUsed = 1u;
+		break;
+	case 1:
+		dinEntryType->TimeInterval_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinEntryTypeGrammar = { dinEntryTypeStates, dinEntryTypeTransitions, dinEntryTypeProductions, dinEntryTypeUsed };
+
+static int decode_dinEntryType(bitstream_t* stream, struct dinEntryType* dinEntryType) {
+	init_dinEntryType(dinEntryType);
+	return decodeGrammar(stream, &dinEntryTypeGrammar, dinEntryType);
+}
+#else
 static int decode_dinEntryType(bitstream_t* stream, struct dinEntryType* dinEntryType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 125;
 	int done = 0;
 	
@@ -5935,9 +8076,31 @@ static int decode_dinEntryType(bitstream_t* stream, struct dinEntryType* dinEntr
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_Entry */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,SessionStopType',  base type name='BodyBaseType',  content type='EMPTY',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_SessionStopReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinSessionStopTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSessionStopTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t dinSessionStopTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t dinSessionStopTypeGrammar = { dinSessionStopTypeStates, dinSessionStopTypeTransitions, dinSessionStopTypeProductions, NULL };
+
+static int decode_dinSessionStopType(bitstream_t* stream, struct dinSessionStopType* dinSessionStopType) {
+	init_dinSessionStopType(dinSessionStopType);
+	return decodeGrammar(stream, &dinSessionStopTypeGrammar, dinSessionStopType);
+}
+#else
 static int decode_dinSessionStopType(bitstream_t* stream, struct dinSessionStopType* dinSessionStopType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -5970,9 +8133,32 @@ static int decode_dinSessionStopType(bitstream_t* stream, struct dinSessionStopT
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_SessionStopReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ServiceDetailReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ServiceID)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ServiceDetailReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinServiceDetailReqTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceDetailReqType, ServiceID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinServiceDetailReqTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinServiceDetailReqTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t dinServiceDetailReqTypeGrammar = { dinServiceDetailReqTypeStates, dinServiceDetailReqTypeTransitions, dinServiceDetailReqTypeProductions, NULL };
+
+static int decode_dinServiceDetailReqType(bitstream_t* stream, struct dinServiceDetailReqType* dinServiceDetailReqType) {
+	init_dinServiceDetailReqType(dinServiceDetailReqType);
+	return decodeGrammar(stream, &dinServiceDetailReqTypeGrammar, dinServiceDetailReqType);
+}
+#else
 static int decode_dinServiceDetailReqType(bitstream_t* stream, struct dinServiceDetailReqType* dinServiceDetailReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 126;
 	int done = 0;
 	
@@ -6037,9 +8223,41 @@ static int decode_dinServiceDetailReqType(bitstream_t* stream, struct dinService
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_ServiceDetailReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DigestMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinDigestMethodTypeProductions[4] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDigestMethodType, Algorithm.characters), offsetof(struct dinDigestMethodType, Algorithm.charactersLen), dinDigestMethodType_Algorithm_CHARACTERS_SIZE, 23 /* {}Algorithm */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinDigestMethodType, ANY.characters), offsetof(struct dinDigestMethodType, ANY.charactersLen), dinDigestMethodType_ANY_CHARACTERS_SIZE, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, NULL }
+};
+static const exi_grammar_transition_t dinDigestMethodTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 2, 3 }, { 2, 1 }, { 0, 2 }, { 2, 3 }
+};
+static const exi_grammar_state_t dinDigestMethodTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 2, 3 }
+};
+static void dinDigestMethodTypeUsed(void* value, uint8_t flag) {
+	struct dinDigestMethodType* dinDigestMethodType = (struct dinDigestMethodType*)value;
+	switch(flag) {
+	case 0:
+		dinDigestMethodType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinDigestMethodTypeGrammar = { dinDigestMethodTypeStates, dinDigestMethodTypeTransitions, dinDigestMethodTypeProductions, dinDigestMethodTypeUsed };
+
 static int decode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMethodType* dinDigestMethodType) {
+	init_dinDigestMethodType(dinDigestMethodType);
+	return decodeGrammar(stream, &dinDigestMethodTypeGrammar, dinDigestMethodType);
+}
+#else
+static int decode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMethodType* dinDigestMethodType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 18;
 	int done = 0;
 	
@@ -6057,10 +8275,24 @@ static int decode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMetho
 					if (errn == 0) {
 						if (dinDigestMethodType->Algorithm.charactersLen >= 2) {
 							dinDigestMethodType->Algorithm.charactersLen = (uint16_t)(dinDigestMethodType->Algorithm.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinDigestMethodType->Algorithm.characters, CHARACTER_UNITS(dinDigestMethodType->Algorithm.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinDigestMethodType->Algorithm.charactersLen, dinDigestMethodType->Algorithm.characters, dinDigestMethodType_Algorithm_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinDigestMethodType->Algorithm.charactersLen, dinDigestMethodType->Algorithm.characters, dinDigestMethodType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 23 /* {}Algorithm */, dinDigestMethodType->Algorithm.characters, dinDigestMethodType->Algorithm.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 23 /* {}Algorithm */, &dinDigestMethodType->Algorithm.charactersLen, &dinDigestMethodType->Algorithm.characters);
+#else
+							errn = decodeStringValueHit(stream, 23 /* {}Algorithm */, &dinDigestMethodType->Algorithm.charactersLen, dinDigestMethodType->Algorithm.characters, dinDigestMethodType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 19;
@@ -6090,10 +8322,24 @@ static int decode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMetho
 					if (errn == 0) {
 						if (dinDigestMethodType->ANY.charactersLen >= 2) {
 							dinDigestMethodType->ANY.charactersLen = (uint16_t)(dinDigestMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinDigestMethodType->ANY.characters, CHARACTER_UNITS(dinDigestMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinDigestMethodType->ANY.charactersLen, dinDigestMethodType->ANY.characters, dinDigestMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinDigestMethodType->ANY.charactersLen, dinDigestMethodType->ANY.characters, dinDigestMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, dinDigestMethodType->ANY.characters, dinDigestMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, &dinDigestMethodType->ANY.charactersLen, &dinDigestMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, &dinDigestMethodType->ANY.charactersLen, dinDigestMethodType->ANY.characters, dinDigestMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinDigestMethodType->ANY_isUsed = 1u;
@@ -6124,10 +8370,24 @@ static int decode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMetho
 					if (errn == 0) {
 						if (dinDigestMethodType->ANY.charactersLen >= 2) {
 							dinDigestMethodType->ANY.charactersLen = (uint16_t)(dinDigestMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinDigestMethodType->ANY.characters, CHARACTER_UNITS(dinDigestMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinDigestMethodType->ANY.charactersLen, dinDigestMethodType->ANY.characters, dinDigestMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinDigestMethodType->ANY.charactersLen, dinDigestMethodType->ANY.characters, dinDigestMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, dinDigestMethodType->ANY.characters, dinDigestMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, &dinDigestMethodType->ANY.charactersLen, &dinDigestMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, &dinDigestMethodType->ANY.charactersLen, dinDigestMethodType->ANY.characters, dinDigestMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinDigestMethodType->ANY_isUsed = 1u;
@@ -6149,9 +8409,13 @@ static int decode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMetho
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ParameterType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":boolValue|"urn:iso:15118:2:2010:MsgDataTypes":byteValue|"urn:iso:15118:2:2010:MsgDataTypes":shortValue|"urn:iso:15118:2:2010:MsgDataTypes":intValue|"urn:iso:15118:2:2010:MsgDataTypes":physicalValue|"urn:iso:15118:2:2010:MsgDataTypes":stringValue)',  derivedBy='RESTRICTION'.  */
 static int decode_dinParameterType(bitstream_t* stream, struct dinParameterType* dinParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 127;
 	int done = 0;
 	
@@ -6169,10 +8433,24 @@ static int decode_dinParameterType(bitstream_t* stream, struct dinParameterType*
 					if (errn == 0) {
 						if (dinParameterType->Name.charactersLen >= 2) {
 							dinParameterType->Name.charactersLen = (uint16_t)(dinParameterType->Name.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinParameterType->Name.characters, CHARACTER_UNITS(dinParameterType->Name.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinParameterType->Name.charactersLen, dinParameterType->Name.characters, dinParameterType_Name_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinParameterType->Name.charactersLen, dinParameterType->Name.characters, dinParameterType_Name_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 27 /* {}Name */, dinParameterType->Name.characters, dinParameterType->Name.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 27 /* {}Name */, &dinParameterType->Name.charactersLen, &dinParameterType->Name.characters);
+#else
+							errn = decodeStringValueHit(stream, 27 /* {}Name */, &dinParameterType->Name.charactersLen, dinParameterType->Name.characters, dinParameterType_Name_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 128;
@@ -6307,10 +8585,24 @@ static int decode_dinParameterType(bitstream_t* stream, struct dinParameterType*
 							if (errn == 0) {
 								if (dinParameterType->stringValue.charactersLen >= 2) {
 									dinParameterType->stringValue.charactersLen = (uint16_t)(dinParameterType->stringValue.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinParameterType->stringValue.characters, CHARACTER_UNITS(dinParameterType->stringValue.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinParameterType->stringValue.charactersLen, dinParameterType->stringValue.characters, dinParameterType_stringValue_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinParameterType->stringValue.charactersLen, dinParameterType->stringValue.characters, dinParameterType_stringValue_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 22 /* {urn:iso:15118:2:2010:MsgDataTypes}stringValue */, dinParameterType->stringValue.characters, dinParameterType->stringValue.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 22 /* {urn:iso:15118:2:2010:MsgDataTypes}stringValue */, &dinParameterType->stringValue.charactersLen, &dinParameterType->stringValue.characters);
+#else
+									errn = decodeStringValueHit(stream, 22 /* {urn:iso:15118:2:2010:MsgDataTypes}stringValue */, &dinParameterType->stringValue.charactersLen, dinParameterType->stringValue.characters, dinParameterType_stringValue_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							dinParameterType->stringValue_isUsed = 1u;
@@ -6362,7 +8654,27 @@ static int decode_dinParameterType(bitstream_t* stream, struct dinParameterType*
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ChargingStatusReqType',  base type name='BodyBaseType',  content type='EMPTY',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ChargingStatusReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinChargingStatusReqTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinChargingStatusReqTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t dinChargingStatusReqTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t dinChargingStatusReqTypeGrammar = { dinChargingStatusReqTypeStates, dinChargingStatusReqTypeTransitions, dinChargingStatusReqTypeProductions, NULL };
+
 static int decode_dinChargingStatusReqType(bitstream_t* stream, struct dinChargingStatusReqType* dinChargingStatusReqType) {
+	init_dinChargingStatusReqType(dinChargingStatusReqType);
+	return decodeGrammar(stream, &dinChargingStatusReqTypeGrammar, dinChargingStatusReqType);
+}
+#else
+static int decode_dinChargingStatusReqType(bitstream_t* stream, struct dinChargingStatusReqType* dinChargingStatusReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -6395,9 +8707,46 @@ static int decode_dinChargingStatusReqType(bitstream_t* stream, struct dinChargi
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_ChargingStatusReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":HMACOutputLength{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinSignatureMethodTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSignatureMethodType, Algorithm.characters), offsetof(struct dinSignatureMethodType, Algorithm.charactersLen), dinSignatureMethodType_Algorithm_CHARACTERS_SIZE, 23 /* {}Algorithm */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER64, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinSignatureMethodType, HMACOutputLength), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinSignatureMethodType, ANY.characters), offsetof(struct dinSignatureMethodType, ANY.charactersLen), dinSignatureMethodType_ANY_CHARACTERS_SIZE, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, NULL }
+};
+static const exi_grammar_transition_t dinSignatureMethodTypeTransitions[12] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 0, 3 }, { 3, 4 }, { 2, 2 }, { 0, 3 }, { 2, 4 },
+	{ 2, 1 }, { 2, 2 }, { 0, 3 }, { 3, 4 }
+};
+static const exi_grammar_state_t dinSignatureMethodTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 3, 4 }, { 5, 2, 3 }, { 8, 3, 4 }
+};
+static void dinSignatureMethodTypeUsed(void* value, uint8_t flag) {
+	struct dinSignatureMethodType* dinSignatureMethodType = (struct dinSignatureMethodType*)value;
+	switch(flag) {
+	case 0:
+		dinSignatureMethodType->HMACOutputLength_isUsed = 1u;
+		break;
+	case 1:
+		dinSignatureMethodType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinSignatureMethodTypeGrammar = { dinSignatureMethodTypeStates, dinSignatureMethodTypeTransitions, dinSignatureMethodTypeProductions, dinSignatureMethodTypeUsed };
+
+static int decode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatureMethodType* dinSignatureMethodType) {
+	init_dinSignatureMethodType(dinSignatureMethodType);
+	return decodeGrammar(stream, &dinSignatureMethodTypeGrammar, dinSignatureMethodType);
+}
+#else
 static int decode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatureMethodType* dinSignatureMethodType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 130;
 	int done = 0;
 	
@@ -6415,10 +8764,24 @@ static int decode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatur
 					if (errn == 0) {
 						if (dinSignatureMethodType->Algorithm.charactersLen >= 2) {
 							dinSignatureMethodType->Algorithm.charactersLen = (uint16_t)(dinSignatureMethodType->Algorithm.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignatureMethodType->Algorithm.characters, CHARACTER_UNITS(dinSignatureMethodType->Algorithm.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignatureMethodType->Algorithm.charactersLen, dinSignatureMethodType->Algorithm.characters, dinSignatureMethodType_Algorithm_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignatureMethodType->Algorithm.charactersLen, dinSignatureMethodType->Algorithm.characters, dinSignatureMethodType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 23 /* {}Algorithm */, dinSignatureMethodType->Algorithm.characters, dinSignatureMethodType->Algorithm.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 23 /* {}Algorithm */, &dinSignatureMethodType->Algorithm.charactersLen, &dinSignatureMethodType->Algorithm.characters);
+#else
+							errn = decodeStringValueHit(stream, 23 /* {}Algorithm */, &dinSignatureMethodType->Algorithm.charactersLen, dinSignatureMethodType->Algorithm.characters, dinSignatureMethodType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 131;
@@ -6470,10 +8833,24 @@ static int decode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatur
 					if (errn == 0) {
 						if (dinSignatureMethodType->ANY.charactersLen >= 2) {
 							dinSignatureMethodType->ANY.charactersLen = (uint16_t)(dinSignatureMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignatureMethodType->ANY.characters, CHARACTER_UNITS(dinSignatureMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignatureMethodType->ANY.charactersLen, dinSignatureMethodType->ANY.characters, dinSignatureMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignatureMethodType->ANY.charactersLen, dinSignatureMethodType->ANY.characters, dinSignatureMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, dinSignatureMethodType->ANY.characters, dinSignatureMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &dinSignatureMethodType->ANY.charactersLen, &dinSignatureMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &dinSignatureMethodType->ANY.charactersLen, dinSignatureMethodType->ANY.characters, dinSignatureMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinSignatureMethodType->ANY_isUsed = 1u;
@@ -6504,10 +8881,24 @@ static int decode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatur
 					if (errn == 0) {
 						if (dinSignatureMethodType->ANY.charactersLen >= 2) {
 							dinSignatureMethodType->ANY.charactersLen = (uint16_t)(dinSignatureMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignatureMethodType->ANY.characters, CHARACTER_UNITS(dinSignatureMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignatureMethodType->ANY.charactersLen, dinSignatureMethodType->ANY.characters, dinSignatureMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignatureMethodType->ANY.charactersLen, dinSignatureMethodType->ANY.characters, dinSignatureMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, dinSignatureMethodType->ANY.characters, dinSignatureMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &dinSignatureMethodType->ANY.charactersLen, &dinSignatureMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &dinSignatureMethodType->ANY.charactersLen, dinSignatureMethodType->ANY.characters, dinSignatureMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinSignatureMethodType->ANY_isUsed = 1u;
@@ -6560,10 +8951,24 @@ static int decode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatur
 					if (errn == 0) {
 						if (dinSignatureMethodType->ANY.charactersLen >= 2) {
 							dinSignatureMethodType->ANY.charactersLen = (uint16_t)(dinSignatureMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignatureMethodType->ANY.characters, CHARACTER_UNITS(dinSignatureMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignatureMethodType->ANY.charactersLen, dinSignatureMethodType->ANY.characters, dinSignatureMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignatureMethodType->ANY.charactersLen, dinSignatureMethodType->ANY.characters, dinSignatureMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, dinSignatureMethodType->ANY.characters, dinSignatureMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &dinSignatureMethodType->ANY.charactersLen, &dinSignatureMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &dinSignatureMethodType->ANY.charactersLen, dinSignatureMethodType->ANY.characters, dinSignatureMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinSignatureMethodType->ANY_isUsed = 1u;
@@ -6585,9 +8990,42 @@ static int decode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatur
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CertificateInstallationReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":OEMProvisioningCert,"urn:iso:15118:2:2010:MsgBody":ListOfRootCertificateIDs,"urn:iso:15118:2:2010:MsgBody":DHParams)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CertificateInstallationReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinCertificateInstallationReqTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinCertificateInstallationReqType, Id.characters), offsetof(struct dinCertificateInstallationReqType, Id.charactersLen), dinCertificateInstallationReqType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateInstallationReqType, OEMProvisioningCert.bytes), offsetof(struct dinCertificateInstallationReqType, OEMProvisioningCert.bytesLen), dinCertificateInstallationReqType_OEMProvisioningCert_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateInstallationReqType, ListOfRootCertificateIDs), 0, 0, 0, decode_dinListOfRootCertificateIDsTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateInstallationReqType, DHParams.bytes), offsetof(struct dinCertificateInstallationReqType, DHParams.bytesLen), dinCertificateInstallationReqType_DHParams_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinCertificateInstallationReqTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t dinCertificateInstallationReqTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }
+};
+static void dinCertificateInstallationReqTypeUsed(void* value, uint8_t flag) {
+	struct dinCertificateInstallationReqType* dinCertificateInstallationReqType = (struct dinCertificateInstallationReqType*)value;
+	switch(flag) {
+	case 0:
+		dinCertificateInstallationReqType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinCertificateInstallationReqTypeGrammar = { dinCertificateInstallationReqTypeStates, dinCertificateInstallationReqTypeTransitions, dinCertificateInstallationReqTypeProductions, dinCertificateInstallationReqTypeUsed };
+
 static int decode_dinCertificateInstallationReqType(bitstream_t* stream, struct dinCertificateInstallationReqType* dinCertificateInstallationReqType) {
+	init_dinCertificateInstallationReqType(dinCertificateInstallationReqType);
+	return decodeGrammar(stream, &dinCertificateInstallationReqTypeGrammar, dinCertificateInstallationReqType);
+}
+#else
+static int decode_dinCertificateInstallationReqType(bitstream_t* stream, struct dinCertificateInstallationReqType* dinCertificateInstallationReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 133;
 	int done = 0;
 	
@@ -6605,10 +9043,24 @@ static int decode_dinCertificateInstallationReqType(bitstream_t* stream, struct
 					if (errn == 0) {
 						if (dinCertificateInstallationReqType->Id.charactersLen >= 2) {
 							dinCertificateInstallationReqType->Id.charactersLen = (uint16_t)(dinCertificateInstallationReqType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinCertificateInstallationReqType->Id.characters, CHARACTER_UNITS(dinCertificateInstallationReqType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinCertificateInstallationReqType->Id.charactersLen, dinCertificateInstallationReqType->Id.characters, dinCertificateInstallationReqType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinCertificateInstallationReqType->Id.charactersLen, dinCertificateInstallationReqType->Id.characters, dinCertificateInstallationReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinCertificateInstallationReqType->Id.characters, dinCertificateInstallationReqType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinCertificateInstallationReqType->Id.charactersLen, &dinCertificateInstallationReqType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinCertificateInstallationReqType->Id.charactersLen, dinCertificateInstallationReqType->Id.characters, dinCertificateInstallationReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinCertificateInstallationReqType->Id_isUsed = 1u;
@@ -6624,7 +9076,14 @@ static int decode_dinCertificateInstallationReqType(bitstream_t* stream, struct
 								errn =  (dinCertificateInstallationReqType->OEMProvisioningCert.bytesLen) <= dinCertificateInstallationReqType_OEMProvisioningCert_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinCertificateInstallationReqType->OEMProvisioningCert.bytes, dinCertificateInstallationReqType->OEMProvisioningCert.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinCertificateInstallationReqType->OEMProvisioningCert.bytesLen, dinCertificateInstallationReqType->OEMProvisioningCert.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinCertificateInstallationReqType->OEMProvisioningCert.bytesLen, dinCertificateInstallationReqType->OEMProvisioningCert.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -6662,7 +9121,14 @@ static int decode_dinCertificateInstallationReqType(bitstream_t* stream, struct
 								errn =  (dinCertificateInstallationReqType->OEMProvisioningCert.bytesLen) <= dinCertificateInstallationReqType_OEMProvisioningCert_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinCertificateInstallationReqType->OEMProvisioningCert.bytes, dinCertificateInstallationReqType->OEMProvisioningCert.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinCertificateInstallationReqType->OEMProvisioningCert.bytesLen, dinCertificateInstallationReqType->OEMProvisioningCert.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinCertificateInstallationReqType->OEMProvisioningCert.bytesLen, dinCertificateInstallationReqType->OEMProvisioningCert.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -6715,7 +9181,14 @@ static int decode_dinCertificateInstallationReqType(bitstream_t* stream, struct
 								errn =  (dinCertificateInstallationReqType->DHParams.bytesLen) <= dinCertificateInstallationReqType_DHParams_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinCertificateInstallationReqType->DHParams.bytes, dinCertificateInstallationReqType->DHParams.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinCertificateInstallationReqType->DHParams.bytesLen, dinCertificateInstallationReqType->DHParams.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinCertificateInstallationReqType->DHParams.bytesLen, dinCertificateInstallationReqType->DHParams.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -6763,9 +9236,46 @@ static int decode_dinCertificateInstallationReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_CertificateInstallationReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SalesTariffEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2010:MsgDataTypes":TimeInterval),("urn:iso:15118:2:2010:MsgDataTypes":EPriceLevel,"urn:iso:15118:2:2010:MsgDataTypes":ConsumptionCost{0-UNBOUNDED}))',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinSalesTariffEntryTypeProductions[5] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinSalesTariffEntryType, RelativeTimeInterval), 0, 0, 0, decode_dinRelativeTimeIntervalTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinSalesTariffEntryType, TimeInterval), 0, 0, 0, decode_dinIntervalTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(uint8_t), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSalesTariffEntryType, EPriceLevel), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinSalesTariffEntryType_ConsumptionCost_ARRAY_SIZE, offsetof(struct dinSalesTariffEntryType, ConsumptionCost.array), offsetof(struct dinSalesTariffEntryType, ConsumptionCost.arrayLen), sizeof(((struct dinSalesTariffEntryType*)0)->ConsumptionCost.array[0]), 0, 0, 0, 0, decode_dinConsumptionCostTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSalesTariffEntryTypeTransitions[5] = {
+	{ 1, 0 }, { 1, 1 }, { 2, 2 }, { 2, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t dinSalesTariffEntryTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }
+};
+static void dinSalesTariffEntryTypeUsed(void* value, uint8_t flag) {
+	struct dinSalesTariffEntryType* dinSalesTariffEntryType = (struct dinSalesTariffEntryType*)value;
+	switch(flag) {
+	case 0:
+		dinSalesTariffEntryType->RelativeTimeInterval_isUsed = 1u;
+		break;
+	case 1:
+		dinSalesTariffEntryType->TimeInterval_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinSalesTariffEntryTypeGrammar = { dinSalesTariffEntryTypeStates, dinSalesTariffEntryTypeTransitions, dinSalesTariffEntryTypeProductions, dinSalesTariffEntryTypeUsed };
+
 static int decode_dinSalesTariffEntryType(bitstream_t* stream, struct dinSalesTariffEntryType* dinSalesTariffEntryType) {
+	init_dinSalesTariffEntryType(dinSalesTariffEntryType);
+	return decodeGrammar(stream, &dinSalesTariffEntryTypeGrammar, dinSalesTariffEntryType);
+}
+#else
+static int decode_dinSalesTariffEntryType(bitstream_t* stream, struct dinSalesTariffEntryType* dinSalesTariffEntryType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 137;
 	int done = 0;
 	
@@ -6833,7 +9343,16 @@ static int decode_dinSalesTariffEntryType(bitstream_t* stream, struct dinSalesTa
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinSalesTariffEntryType->ConsumptionCost.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinSalesTariffEntryType->ConsumptionCost.array, dinSalesTariffEntryType_ConsumptionCost_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinSalesTariffEntryType->ConsumptionCost.arrayLen < dinSalesTariffEntryType_ConsumptionCost_ARRAY_SIZE) {
+#else
 					if (dinSalesTariffEntryType->ConsumptionCost.arrayLen < dinSalesTariffEntryType_ConsumptionCost_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinConsumptionCostType(stream, &dinSalesTariffEntryType->ConsumptionCost.array[dinSalesTariffEntryType->ConsumptionCost.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -6860,9 +9379,43 @@ static int decode_dinSalesTariffEntryType(bitstream_t* stream, struct dinSalesTa
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ServiceDiscoveryResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":PaymentOptions,"urn:iso:15118:2:2010:MsgBody":ChargeService,"urn:iso:15118:2:2010:MsgBody":ServiceList{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinServiceDiscoveryResTypeProductions[5] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceDiscoveryResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceDiscoveryResType, PaymentOptions), 0, 0, 0, decode_dinPaymentOptionsTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceDiscoveryResType, ChargeService), 0, 0, 0, decode_dinServiceChargeTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinServiceDiscoveryResType, ServiceList), 0, 0, 0, decode_dinServiceTagListTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinServiceDiscoveryResTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 0, 4 }, { 0, 4 }
+};
+static const exi_grammar_state_t dinServiceDiscoveryResTypeStates[5] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 2, 2 }, { 5, 1, 1 }
+};
+static void dinServiceDiscoveryResTypeUsed(void* value, uint8_t flag) {
+	struct dinServiceDiscoveryResType* dinServiceDiscoveryResType = (struct dinServiceDiscoveryResType*)value;
+	switch(flag) {
+	case 0:
+		dinServiceDiscoveryResType->ServiceList_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinServiceDiscoveryResTypeGrammar = { dinServiceDiscoveryResTypeStates, dinServiceDiscoveryResTypeTransitions, dinServiceDiscoveryResTypeProductions, dinServiceDiscoveryResTypeUsed };
+
+static int decode_dinServiceDiscoveryResType(bitstream_t* stream, struct dinServiceDiscoveryResType* dinServiceDiscoveryResType) {
+	init_dinServiceDiscoveryResType(dinServiceDiscoveryResType);
+	return decodeGrammar(stream, &dinServiceDiscoveryResTypeGrammar, dinServiceDiscoveryResType);
+}
+#else
 static int decode_dinServiceDiscoveryResType(bitstream_t* stream, struct dinServiceDiscoveryResType* dinServiceDiscoveryResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 140;
 	int done = 0;
 	
@@ -6978,9 +9531,32 @@ static int decode_dinServiceDiscoveryResType(bitstream_t* stream, struct dinServ
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_ServiceDiscoveryRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ParameterSetType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ParameterSetID,"urn:iso:15118:2:2010:MsgDataTypes":Parameter{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinParameterSetTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinParameterSetType, ParameterSetID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinParameterSetType_Parameter_ARRAY_SIZE, offsetof(struct dinParameterSetType, Parameter.array), offsetof(struct dinParameterSetType, Parameter.arrayLen), sizeof(((struct dinParameterSetType*)0)->Parameter.array[0]), 0, 0, 0, 0, decode_dinParameterTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinParameterSetTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinParameterSetTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }
+};
+static const exi_grammar_t dinParameterSetTypeGrammar = { dinParameterSetTypeStates, dinParameterSetTypeTransitions, dinParameterSetTypeProductions, NULL };
+
+static int decode_dinParameterSetType(bitstream_t* stream, struct dinParameterSetType* dinParameterSetType) {
+	init_dinParameterSetType(dinParameterSetType);
+	return decodeGrammar(stream, &dinParameterSetTypeGrammar, dinParameterSetType);
+}
+#else
 static int decode_dinParameterSetType(bitstream_t* stream, struct dinParameterSetType* dinParameterSetType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 144;
 	int done = 0;
 	
@@ -7026,7 +9602,16 @@ static int decode_dinParameterSetType(bitstream_t* stream, struct dinParameterSe
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinParameterSetType->Parameter.array, dinParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinParameterSetType->Parameter.arrayLen < dinParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (dinParameterSetType->Parameter.arrayLen < dinParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinParameterType(stream, &dinParameterSetType->Parameter.array[dinParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7045,7 +9630,16 @@ static int decode_dinParameterSetType(bitstream_t* stream, struct dinParameterSe
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinParameterSetType->Parameter.array, dinParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinParameterSetType->Parameter.arrayLen < dinParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (dinParameterSetType->Parameter.arrayLen < dinParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinParameterType(stream, &dinParameterSetType->Parameter.array[dinParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7072,9 +9666,66 @@ static int decode_dinParameterSetType(bitstream_t* stream, struct dinParameterSe
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CurrentDemandReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":DC_EVStatus,"urn:iso:15118:2:2010:MsgBody":EVTargetCurrent,"urn:iso:15118:2:2010:MsgBody":EVMaximumVoltageLimit{0-1},"urn:iso:15118:2:2010:MsgBody":EVMaximumCurrentLimit{0-1},"urn:iso:15118:2:2010:MsgBody":EVMaximumPowerLimit{0-1},"urn:iso:15118:2:2010:MsgBody":BulkChargingComplete{0-1},"urn:iso:15118:2:2010:MsgBody":ChargingComplete,"urn:iso:15118:2:2010:MsgBody":RemainingTimeToFullSoC{0-1},"urn:iso:15118:2:2010:MsgBody":RemainingTimeToBulkSoC{0-1},"urn:iso:15118:2:2010:MsgBody":EVTargetVoltage)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CurrentDemandReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinCurrentDemandReqTypeProductions[11] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandReqType, DC_EVStatus), 0, 0, 0, decode_dinDC_EVStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandReqType, EVTargetCurrent), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandReqType, EVMaximumVoltageLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandReqType, EVMaximumCurrentLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandReqType, EVMaximumPowerLimit), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandReqType, BulkChargingComplete), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandReqType, ChargingComplete), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandReqType, RemainingTimeToFullSoC), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandReqType, RemainingTimeToBulkSoC), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCurrentDemandReqType, EVTargetVoltage), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinCurrentDemandReqTypeTransitions[24] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 7, 6 }, { 4, 3 },
+	{ 5, 4 }, { 6, 5 }, { 7, 6 }, { 5, 4 }, { 6, 5 }, { 7, 6 }, { 6, 5 }, { 7, 6 },
+	{ 7, 6 }, { 8, 7 }, { 9, 8 }, { 10, 9 }, { 9, 8 }, { 10, 9 }, { 10, 9 }, { 0, 10 }
+};
+static const exi_grammar_state_t dinCurrentDemandReqTypeStates[11] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 3, 5 }, { 7, 3, 4 }, { 11, 2, 3 }, { 14, 2, 2 }, { 16, 1, 1 }, { 17, 2, 3 },
+	{ 20, 2, 2 }, { 22, 1, 1 }, { 23, 1, 1 }
+};
+static void dinCurrentDemandReqTypeUsed(void* value, uint8_t flag) {
+	struct dinCurrentDemandReqType* dinCurrentDemandReqType = (struct dinCurrentDemandReqType*)value;
+	switch(flag) {
+	case 0:
+		dinCurrentDemandReqType->EVMaximumVoltageLimit_isUsed = 1u;
+		break;
+	case 1:
+		dinCurrentDemandReqType->EVMaximumCurrentLimit_isUsed = 1u;
+		break;
+	case 2:
+		dinCurrentDemandReqType->EVMaximumPowerLimit_isUsed = 1u;
+		break;
+	case 3:
+		dinCurrentDemandReqType->BulkChargingComplete_isUsed = 1u;
+		break;
+	case 4:
+		dinCurrentDemandReqType->RemainingTimeToFullSoC_isUsed = 1u;
+		break;
+	case 5:
+		dinCurrentDemandReqType->RemainingTimeToBulkSoC_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinCurrentDemandReqTypeGrammar = { dinCurrentDemandReqTypeStates, dinCurrentDemandReqTypeTransitions, dinCurrentDemandReqTypeProductions, dinCurrentDemandReqTypeUsed };
+
+static int decode_dinCurrentDemandReqType(bitstream_t* stream, struct dinCurrentDemandReqType* dinCurrentDemandReqType) {
+	init_dinCurrentDemandReqType(dinCurrentDemandReqType);
+	return decodeGrammar(stream, &dinCurrentDemandReqTypeGrammar, dinCurrentDemandReqType);
+}
+#else
 static int decode_dinCurrentDemandReqType(bitstream_t* stream, struct dinCurrentDemandReqType* dinCurrentDemandReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 147;
 	int done = 0;
 	
@@ -7475,9 +10126,34 @@ static int decode_dinCurrentDemandReqType(bitstream_t* stream, struct dinCurrent
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_CurrentDemandReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,PreChargeReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":DC_EVStatus,"urn:iso:15118:2:2010:MsgBody":EVTargetVoltage,"urn:iso:15118:2:2010:MsgBody":EVTargetCurrent)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_PreChargeReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinPreChargeReqTypeProductions[4] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPreChargeReqType, DC_EVStatus), 0, 0, 0, decode_dinDC_EVStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPreChargeReqType, EVTargetVoltage), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPreChargeReqType, EVTargetCurrent), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinPreChargeReqTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinPreChargeReqTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t dinPreChargeReqTypeGrammar = { dinPreChargeReqTypeStates, dinPreChargeReqTypeTransitions, dinPreChargeReqTypeProductions, NULL };
+
+static int decode_dinPreChargeReqType(bitstream_t* stream, struct dinPreChargeReqType* dinPreChargeReqType) {
+	init_dinPreChargeReqType(dinPreChargeReqType);
+	return decodeGrammar(stream, &dinPreChargeReqTypeGrammar, dinPreChargeReqType);
+}
+#else
 static int decode_dinPreChargeReqType(bitstream_t* stream, struct dinPreChargeReqType* dinPreChargeReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 157;
 	int done = 0;
 	
@@ -7555,9 +10231,47 @@ static int decode_dinPreChargeReqType(bitstream_t* stream, struct dinPreChargeRe
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_PreChargeReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignedInfo,"http://www.w3.org/2000/09/xmldsig#":SignatureValue,"http://www.w3.org/2000/09/xmldsig#":KeyInfo{0-1},"http://www.w3.org/2000/09/xmldsig#":Object{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinSignatureTypeProductions[6] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinSignatureType, Id.characters), offsetof(struct dinSignatureType, Id.charactersLen), dinSignatureType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSignatureType, SignedInfo), 0, 0, 0, decode_dinSignedInfoTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSignatureType, SignatureValue), 0, 0, 0, decode_dinSignatureValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinSignatureType, KeyInfo), 0, 0, 0, decode_dinKeyInfoTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinSignatureType_Object_ARRAY_SIZE, offsetof(struct dinSignatureType, Object.array), offsetof(struct dinSignatureType, Object.arrayLen), sizeof(((struct dinSignatureType*)0)->Object.array[0]), 0, 0, 0, 0, decode_dinObjectTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSignatureTypeTransitions[9] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 4 }, { 0, 5 }, { 4, 4 },
+	{ 0, 5 }
+};
+static const exi_grammar_state_t dinSignatureTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 2, 3 }, { 7, 2, 2 }
+};
+static void dinSignatureTypeUsed(void* value, uint8_t flag) {
+	struct dinSignatureType* dinSignatureType = (struct dinSignatureType*)value;
+	switch(flag) {
+	case 0:
+		dinSignatureType->Id_isUsed = 1u;
+		break;
+	case 1:
+		dinSignatureType->KeyInfo_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinSignatureTypeGrammar = { dinSignatureTypeStates, dinSignatureTypeTransitions, dinSignatureTypeProductions, dinSignatureTypeUsed };
+
+static int decode_dinSignatureType(bitstream_t* stream, struct dinSignatureType* dinSignatureType) {
+	init_dinSignatureType(dinSignatureType);
+	return decodeGrammar(stream, &dinSignatureTypeGrammar, dinSignatureType);
+}
+#else
 static int decode_dinSignatureType(bitstream_t* stream, struct dinSignatureType* dinSignatureType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 160;
 	int done = 0;
 	
@@ -7575,10 +10289,24 @@ static int decode_dinSignatureType(bitstream_t* stream, struct dinSignatureType*
 					if (errn == 0) {
 						if (dinSignatureType->Id.charactersLen >= 2) {
 							dinSignatureType->Id.charactersLen = (uint16_t)(dinSignatureType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignatureType->Id.characters, CHARACTER_UNITS(dinSignatureType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignatureType->Id.charactersLen, dinSignatureType->Id.characters, dinSignatureType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignatureType->Id.charactersLen, dinSignatureType->Id.characters, dinSignatureType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinSignatureType->Id.characters, dinSignatureType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinSignatureType->Id.charactersLen, &dinSignatureType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinSignatureType->Id.charactersLen, dinSignatureType->Id.characters, dinSignatureType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinSignatureType->Id_isUsed = 1u;
@@ -7630,7 +10358,14 @@ static int decode_dinSignatureType(bitstream_t* stream, struct dinSignatureType*
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, dinSignatureType->KeyInfo, 1);
+					if (errn == 0) {
+						errn = decode_dinKeyInfoType(stream, dinSignatureType->KeyInfo);
+					}
+#else
 					errn = decode_dinKeyInfoType(stream, &dinSignatureType->KeyInfo);
+#endif /* DATABINDING_SLIM */
 					dinSignatureType->KeyInfo_isUsed = 1u;
 					grammarID = 164;
 					break;
@@ -7685,9 +10420,54 @@ static int decode_dinSignatureType(bitstream_t* stream, struct dinSignatureType*
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinReferenceTypeProductions[7] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinReferenceType, Id.characters), offsetof(struct dinReferenceType, Id.charactersLen), dinReferenceType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinReferenceType, Type.characters), offsetof(struct dinReferenceType, Type.charactersLen), dinReferenceType_Type_CHARACTERS_SIZE, 29 /* {}Type */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinReferenceType, URI.characters), offsetof(struct dinReferenceType, URI.charactersLen), dinReferenceType_URI_CHARACTERS_SIZE, 30 /* {}URI */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct dinReferenceType, Transforms), 0, 0, 0, decode_dinTransformsTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinReferenceType, DigestMethod), 0, 0, 0, decode_dinDigestMethodTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinReferenceType, DigestValue.bytes), offsetof(struct dinReferenceType, DigestValue.bytesLen), dinReferenceType_DigestValue_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinReferenceTypeTransitions[17] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 2, 1 }, { 3, 2 }, { 4, 3 },
+	{ 5, 4 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 4, 3 }, { 5, 4 }, { 5, 4 }, { 6, 5 },
+	{ 0, 6 }
+};
+static const exi_grammar_state_t dinReferenceTypeStates[7] = {
+	{ 0, 3, 5 }, { 5, 3, 4 }, { 9, 2, 3 }, { 12, 2, 2 }, { 14, 1, 1 }, { 15, 1, 1 }, { 16, 1, 1 }
+};
+static void dinReferenceTypeUsed(void* value, uint8_t flag) {
+	struct dinReferenceType* dinReferenceType = (struct dinReferenceType*)value;
+	switch(flag) {
+	case 0:
+		dinReferenceType->Id_isUsed = 1u;
+		break;
+	case 1:
+		dinReferenceType->Type_isUsed = 1u;
+		break;
+	case 2:
+		dinReferenceType->URI_isUsed = 1u;
+		break;
+	case 3:
+		dinReferenceType->Transforms_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinReferenceTypeGrammar = { dinReferenceTypeStates, dinReferenceTypeTransitions, dinReferenceTypeProductions, dinReferenceTypeUsed };
+
+static int decode_dinReferenceType(bitstream_t* stream, struct dinReferenceType* dinReferenceType) {
+	init_dinReferenceType(dinReferenceType);
+	return decodeGrammar(stream, &dinReferenceTypeGrammar, dinReferenceType);
+}
+#else
 static int decode_dinReferenceType(bitstream_t* stream, struct dinReferenceType* dinReferenceType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 165;
 	int done = 0;
 	
@@ -7705,10 +10485,24 @@ static int decode_dinReferenceType(bitstream_t* stream, struct dinReferenceType*
 					if (errn == 0) {
 						if (dinReferenceType->Id.charactersLen >= 2) {
 							dinReferenceType->Id.charactersLen = (uint16_t)(dinReferenceType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinReferenceType->Id.characters, CHARACTER_UNITS(dinReferenceType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinReferenceType->Id.charactersLen, dinReferenceType->Id.characters, dinReferenceType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinReferenceType->Id.charactersLen, dinReferenceType->Id.characters, dinReferenceType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinReferenceType->Id.characters, dinReferenceType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinReferenceType->Id.charactersLen, &dinReferenceType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinReferenceType->Id.charactersLen, dinReferenceType->Id.characters, dinReferenceType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinReferenceType->Id_isUsed = 1u;
@@ -7719,10 +10513,24 @@ static int decode_dinReferenceType(bitstream_t* stream, struct dinReferenceType*
 					if (errn == 0) {
 						if (dinReferenceType->Type.charactersLen >= 2) {
 							dinReferenceType->Type.charactersLen = (uint16_t)(dinReferenceType->Type.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinReferenceType->Type.characters, CHARACTER_UNITS(dinReferenceType->Type.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinReferenceType->Type.charactersLen, dinReferenceType->Type.characters, dinReferenceType_Type_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinReferenceType->Type.charactersLen, dinReferenceType->Type.characters, dinReferenceType_Type_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 29 /* {}Type */, dinReferenceType->Type.characters, dinReferenceType->Type.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 29 /* {}Type */, &dinReferenceType->Type.charactersLen, &dinReferenceType->Type.characters);
+#else
+							errn = decodeStringValueHit(stream, 29 /* {}Type */, &dinReferenceType->Type.charactersLen, dinReferenceType->Type.characters, dinReferenceType_Type_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinReferenceType->Type_isUsed = 1u;
@@ -7733,10 +10541,24 @@ static int decode_dinReferenceType(bitstream_t* stream, struct dinReferenceType*
 					if (errn == 0) {
 						if (dinReferenceType->URI.charactersLen >= 2) {
 							dinReferenceType->URI.charactersLen = (uint16_t)(dinReferenceType->URI.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinReferenceType->URI.characters, CHARACTER_UNITS(dinReferenceType->URI.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinReferenceType->URI.charactersLen, dinReferenceType->URI.characters, dinReferenceType_URI_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinReferenceType->URI.charactersLen, dinReferenceType->URI.characters, dinReferenceType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 30 /* {}URI */, dinReferenceType->URI.characters, dinReferenceType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 30 /* {}URI */, &dinReferenceType->URI.charactersLen, &dinReferenceType->URI.characters);
+#else
+							errn = decodeStringValueHit(stream, 30 /* {}URI */, &dinReferenceType->URI.charactersLen, dinReferenceType->URI.characters, dinReferenceType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinReferenceType->URI_isUsed = 1u;
@@ -7767,10 +10589,24 @@ static int decode_dinReferenceType(bitstream_t* stream, struct dinReferenceType*
 					if (errn == 0) {
 						if (dinReferenceType->Type.charactersLen >= 2) {
 							dinReferenceType->Type.charactersLen = (uint16_t)(dinReferenceType->Type.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinReferenceType->Type.characters, CHARACTER_UNITS(dinReferenceType->Type.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinReferenceType->Type.charactersLen, dinReferenceType->Type.characters, dinReferenceType_Type_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinReferenceType->Type.charactersLen, dinReferenceType->Type.characters, dinReferenceType_Type_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 29 /* {}Type */, dinReferenceType->Type.characters, dinReferenceType->Type.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 29 /* {}Type */, &dinReferenceType->Type.charactersLen, &dinReferenceType->Type.characters);
+#else
+							errn = decodeStringValueHit(stream, 29 /* {}Type */, &dinReferenceType->Type.charactersLen, dinReferenceType->Type.characters, dinReferenceType_Type_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinReferenceType->Type_isUsed = 1u;
@@ -7781,10 +10617,24 @@ static int decode_dinReferenceType(bitstream_t* stream, struct dinReferenceType*
 					if (errn == 0) {
 						if (dinReferenceType->URI.charactersLen >= 2) {
 							dinReferenceType->URI.charactersLen = (uint16_t)(dinReferenceType->URI.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinReferenceType->URI.characters, CHARACTER_UNITS(dinReferenceType->URI.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinReferenceType->URI.charactersLen, dinReferenceType->URI.characters, dinReferenceType_URI_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinReferenceType->URI.charactersLen, dinReferenceType->URI.characters, dinReferenceType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 30 /* {}URI */, dinReferenceType->URI.characters, dinReferenceType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 30 /* {}URI */, &dinReferenceType->URI.charactersLen, &dinReferenceType->URI.characters);
+#else
+							errn = decodeStringValueHit(stream, 30 /* {}URI */, &dinReferenceType->URI.charactersLen, dinReferenceType->URI.characters, dinReferenceType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinReferenceType->URI_isUsed = 1u;
@@ -7815,10 +10665,24 @@ static int decode_dinReferenceType(bitstream_t* stream, struct dinReferenceType*
 					if (errn == 0) {
 						if (dinReferenceType->URI.charactersLen >= 2) {
 							dinReferenceType->URI.charactersLen = (uint16_t)(dinReferenceType->URI.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinReferenceType->URI.characters, CHARACTER_UNITS(dinReferenceType->URI.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinReferenceType->URI.charactersLen, dinReferenceType->URI.characters, dinReferenceType_URI_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinReferenceType->URI.charactersLen, dinReferenceType->URI.characters, dinReferenceType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 30 /* {}URI */, dinReferenceType->URI.characters, dinReferenceType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 30 /* {}URI */, &dinReferenceType->URI.charactersLen, &dinReferenceType->URI.characters);
+#else
+							errn = decodeStringValueHit(stream, 30 /* {}URI */, &dinReferenceType->URI.charactersLen, dinReferenceType->URI.characters, dinReferenceType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinReferenceType->URI_isUsed = 1u;
@@ -7889,7 +10753,14 @@ static int decode_dinReferenceType(bitstream_t* stream, struct dinReferenceType*
 								errn =  (dinReferenceType->DigestValue.bytesLen) <= dinReferenceType_DigestValue_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinReferenceType->DigestValue.bytes, dinReferenceType->DigestValue.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinReferenceType->DigestValue.bytesLen, dinReferenceType->DigestValue.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinReferenceType->DigestValue.bytesLen, dinReferenceType->DigestValue.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -7937,9 +10808,31 @@ static int decode_dinReferenceType(bitstream_t* stream, struct dinReferenceType*
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ProfileEntryType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ChargingProfileEntryStart,"urn:iso:15118:2:2010:MsgDataTypes":ChargingProfileEntryMaxPower)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinProfileEntryTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinProfileEntryType, ChargingProfileEntryStart), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinProfileEntryType, ChargingProfileEntryMaxPower), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinProfileEntryTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinProfileEntryTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t dinProfileEntryTypeGrammar = { dinProfileEntryTypeStates, dinProfileEntryTypeTransitions, dinProfileEntryTypeProductions, NULL };
+
+static int decode_dinProfileEntryType(bitstream_t* stream, struct dinProfileEntryType* dinProfileEntryType) {
+	init_dinProfileEntryType(dinProfileEntryType);
+	return decodeGrammar(stream, &dinProfileEntryTypeGrammar, dinProfileEntryType);
+}
+#else
 static int decode_dinProfileEntryType(bitstream_t* stream, struct dinProfileEntryType* dinProfileEntryType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 171;
 	int done = 0;
 	
@@ -8036,9 +10929,31 @@ static int decode_dinProfileEntryType(bitstream_t* stream, struct dinProfileEntr
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDef,#AnonType_V2G_Message',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDef":Header,"urn:iso:15118:2:2010:MsgDef":Body)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinAnonType_V2G_MessageProductions[3] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAnonType_V2G_Message, Header), 0, 0, 0, decode_dinMessageHeaderTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAnonType_V2G_Message, Body), 0, 0, 0, decode_dinBodyTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinAnonType_V2G_MessageTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinAnonType_V2G_MessageStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t dinAnonType_V2G_MessageGrammar = { dinAnonType_V2G_MessageStates, dinAnonType_V2G_MessageTransitions, dinAnonType_V2G_MessageProductions, NULL };
+
+static int decode_dinAnonType_V2G_Message(bitstream_t* stream, struct dinAnonType_V2G_Message* dinAnonType_V2G_Message) {
+	init_dinAnonType_V2G_Message(dinAnonType_V2G_Message);
+	return decodeGrammar(stream, &dinAnonType_V2G_MessageGrammar, dinAnonType_V2G_Message);
+}
+#else
 static int decode_dinAnonType_V2G_Message(bitstream_t* stream, struct dinAnonType_V2G_Message* dinAnonType_V2G_Message) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 173;
 	int done = 0;
 	
@@ -8101,9 +11016,49 @@ static int decode_dinAnonType_V2G_Message(bitstream_t* stream, struct dinAnonTyp
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ChargeParameterDiscoveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":EVRequestedEnergyTransferType,"urn:iso:15118:2:2010:MsgDataTypes":EVChargeParameter)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinChargeParameterDiscoveryReqTypeProductions[5] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 3, sizeof(dinEVRequestedEnergyTransferType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinChargeParameterDiscoveryReqType, EVRequestedEnergyTransferType), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinChargeParameterDiscoveryReqType, AC_EVChargeParameter), 0, 0, 0, decode_dinAC_EVChargeParameterTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinChargeParameterDiscoveryReqType, DC_EVChargeParameter), 0, 0, 0, decode_dinDC_EVChargeParameterTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinChargeParameterDiscoveryReqType, EVChargeParameter), 0, 0, 0, decode_dinEVChargeParameterTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinChargeParameterDiscoveryReqTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t dinChargeParameterDiscoveryReqTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 1, 1 }
+};
+static void dinChargeParameterDiscoveryReqTypeUsed(void* value, uint8_t flag) {
+	struct dinChargeParameterDiscoveryReqType* dinChargeParameterDiscoveryReqType = (struct dinChargeParameterDiscoveryReqType*)value;
+	switch(flag) {
+	case 0:
+		dinChargeParameterDiscoveryReqType->AC_EVChargeParameter_isUsed = 1u;
+		break;
+	case 1:
+		dinChargeParameterDiscoveryReqType->DC_EVChargeParameter_isUsed = 1u;
+		break;
+	case 2:
+		dinChargeParameterDiscoveryReqType->EVChargeParameter_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinChargeParameterDiscoveryReqTypeGrammar = { dinChargeParameterDiscoveryReqTypeStates, dinChargeParameterDiscoveryReqTypeTransitions, dinChargeParameterDiscoveryReqTypeProductions, dinChargeParameterDiscoveryReqTypeUsed };
+
+static int decode_dinChargeParameterDiscoveryReqType(bitstream_t* stream, struct dinChargeParameterDiscoveryReqType* dinChargeParameterDiscoveryReqType) {
+	init_dinChargeParameterDiscoveryReqType(dinChargeParameterDiscoveryReqType);
+	return decodeGrammar(stream, &dinChargeParameterDiscoveryReqTypeGrammar, dinChargeParameterDiscoveryReqType);
+}
+#else
 static int decode_dinChargeParameterDiscoveryReqType(bitstream_t* stream, struct dinChargeParameterDiscoveryReqType* dinChargeParameterDiscoveryReqType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 175;
 	int done = 0;
 	
@@ -8195,9 +11150,32 @@ static int decode_dinChargeParameterDiscoveryReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ConsumptionCostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":startValue,"urn:iso:15118:2:2010:MsgDataTypes":Cost{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinConsumptionCostTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinConsumptionCostType, startValue), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinConsumptionCostType_Cost_ARRAY_SIZE, offsetof(struct dinConsumptionCostType, Cost.array), offsetof(struct dinConsumptionCostType, Cost.arrayLen), sizeof(((struct dinConsumptionCostType*)0)->Cost.array[0]), 0, 0, 0, 0, decode_dinCostTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinConsumptionCostTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinConsumptionCostTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t dinConsumptionCostTypeGrammar = { dinConsumptionCostTypeStates, dinConsumptionCostTypeTransitions, dinConsumptionCostTypeProductions, NULL };
+
+static int decode_dinConsumptionCostType(bitstream_t* stream, struct dinConsumptionCostType* dinConsumptionCostType) {
+	init_dinConsumptionCostType(dinConsumptionCostType);
+	return decodeGrammar(stream, &dinConsumptionCostTypeGrammar, dinConsumptionCostType);
+}
+#else
 static int decode_dinConsumptionCostType(bitstream_t* stream, struct dinConsumptionCostType* dinConsumptionCostType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 177;
 	int done = 0;
 	
@@ -8270,9 +11248,31 @@ static int decode_dinConsumptionCostType(bitstream_t* stream, struct dinConsumpt
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Modulus,"http://www.w3.org/2000/09/xmldsig#":Exponent)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinRSAKeyValueTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinRSAKeyValueType, Modulus.bytes), offsetof(struct dinRSAKeyValueType, Modulus.bytesLen), dinRSAKeyValueType_Modulus_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinRSAKeyValueType, Exponent.bytes), offsetof(struct dinRSAKeyValueType, Exponent.bytesLen), dinRSAKeyValueType_Exponent_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinRSAKeyValueTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinRSAKeyValueTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t dinRSAKeyValueTypeGrammar = { dinRSAKeyValueTypeStates, dinRSAKeyValueTypeTransitions, dinRSAKeyValueTypeProductions, NULL };
+
+static int decode_dinRSAKeyValueType(bitstream_t* stream, struct dinRSAKeyValueType* dinRSAKeyValueType) {
+	init_dinRSAKeyValueType(dinRSAKeyValueType);
+	return decodeGrammar(stream, &dinRSAKeyValueTypeGrammar, dinRSAKeyValueType);
+}
+#else
 static int decode_dinRSAKeyValueType(bitstream_t* stream, struct dinRSAKeyValueType* dinRSAKeyValueType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 179;
 	int done = 0;
 	
@@ -8295,7 +11295,14 @@ static int decode_dinRSAKeyValueType(bitstream_t* stream, struct dinRSAKeyValueT
 								errn =  (dinRSAKeyValueType->Modulus.bytesLen) <= dinRSAKeyValueType_Modulus_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinRSAKeyValueType->Modulus.bytes, dinRSAKeyValueType->Modulus.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinRSAKeyValueType->Modulus.bytesLen, dinRSAKeyValueType->Modulus.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinRSAKeyValueType->Modulus.bytesLen, dinRSAKeyValueType->Modulus.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -8333,7 +11340,14 @@ static int decode_dinRSAKeyValueType(bitstream_t* stream, struct dinRSAKeyValueT
 								errn =  (dinRSAKeyValueType->Exponent.bytesLen) <= dinRSAKeyValueType_Exponent_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinRSAKeyValueType->Exponent.bytes, dinRSAKeyValueType->Exponent.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinRSAKeyValueType->Exponent.bytesLen, dinRSAKeyValueType->Exponent.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinRSAKeyValueType->Exponent.bytesLen, dinRSAKeyValueType->Exponent.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -8381,9 +11395,31 @@ static int decode_dinRSAKeyValueType(bitstream_t* stream, struct dinRSAKeyValueT
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ServiceTag,"urn:iso:15118:2:2010:MsgDataTypes":FreeService)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinServiceTypeProductions[3] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceType, ServiceTag), 0, 0, 0, decode_dinServiceTagTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceType, FreeService), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinServiceTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinServiceTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t dinServiceTypeGrammar = { dinServiceTypeStates, dinServiceTypeTransitions, dinServiceTypeProductions, NULL };
+
+static int decode_dinServiceType(bitstream_t* stream, struct dinServiceType* dinServiceType) {
+	init_dinServiceType(dinServiceType);
+	return decodeGrammar(stream, &dinServiceTypeGrammar, dinServiceType);
+}
+#else
 static int decode_dinServiceType(bitstream_t* stream, struct dinServiceType* dinServiceType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 181;
 	int done = 0;
 	
@@ -8463,9 +11499,30 @@ static int decode_dinServiceType(bitstream_t* stream, struct dinServiceType* din
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ServiceTagListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":Service{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinServiceTagListTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinServiceTagListType_Service_ARRAY_SIZE, offsetof(struct dinServiceTagListType, Service.array), offsetof(struct dinServiceTagListType, Service.arrayLen), sizeof(((struct dinServiceTagListType*)0)->Service.array[0]), 0, 0, 0, 0, decode_dinServiceTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinServiceTagListTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinServiceTagListTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t dinServiceTagListTypeGrammar = { dinServiceTagListTypeStates, dinServiceTagListTypeTransitions, dinServiceTagListTypeProductions, NULL };
+
+static int decode_dinServiceTagListType(bitstream_t* stream, struct dinServiceTagListType* dinServiceTagListType) {
+	init_dinServiceTagListType(dinServiceTagListType);
+	return decodeGrammar(stream, &dinServiceTagListTypeGrammar, dinServiceTagListType);
+}
+#else
 static int decode_dinServiceTagListType(bitstream_t* stream, struct dinServiceTagListType* dinServiceTagListType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 183;
 	int done = 0;
 	
@@ -8479,7 +11536,16 @@ static int decode_dinServiceTagListType(bitstream_t* stream, struct dinServiceTa
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinServiceTagListType->Service.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinServiceTagListType->Service.array, dinServiceTagListType_Service_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinServiceTagListType->Service.arrayLen < dinServiceTagListType_Service_ARRAY_SIZE) {
+#else
 					if (dinServiceTagListType->Service.arrayLen < dinServiceTagListType_Service_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinServiceType(stream, &dinServiceTagListType->Service.array[dinServiceTagListType->Service.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -8498,7 +11564,16 @@ static int decode_dinServiceTagListType(bitstream_t* stream, struct dinServiceTa
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinServiceTagListType->Service.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinServiceTagListType->Service.array, dinServiceTagListType_Service_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinServiceTagListType->Service.arrayLen < dinServiceTagListType_Service_ARRAY_SIZE) {
+#else
 					if (dinServiceTagListType->Service.arrayLen < dinServiceTagListType_Service_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinServiceType(stream, &dinServiceTagListType->Service.array[dinServiceTagListType->Service.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -8525,9 +11600,29 @@ static int decode_dinServiceTagListType(bitstream_t* stream, struct dinServiceTa
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,EVSEStatusType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinEVSEStatusTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinEVSEStatusTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t dinEVSEStatusTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t dinEVSEStatusTypeGrammar = { dinEVSEStatusTypeStates, dinEVSEStatusTypeTransitions, dinEVSEStatusTypeProductions, NULL };
+
+static int decode_dinEVSEStatusType(bitstream_t* stream, struct dinEVSEStatusType* dinEVSEStatusType) {
+	init_dinEVSEStatusType(dinEVSEStatusType);
+	return decodeGrammar(stream, &dinEVSEStatusTypeGrammar, dinEVSEStatusType);
+}
+#else
 static int decode_dinEVSEStatusType(bitstream_t* stream, struct dinEVSEStatusType* dinEVSEStatusType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -8560,9 +11655,42 @@ static int decode_dinEVSEStatusType(bitstream_t* stream, struct dinEVSEStatusTyp
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,SessionSetupResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":EVSEID,"urn:iso:15118:2:2010:MsgBody":DateTimeNow{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_SessionSetupRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinSessionSetupResTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSessionSetupResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSessionSetupResType, EVSEID.bytes), offsetof(struct dinSessionSetupResType, EVSEID.bytesLen), dinSessionSetupResType_EVSEID_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER64, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinSessionSetupResType, DateTimeNow), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSessionSetupResTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinSessionSetupResTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }
+};
+static void dinSessionSetupResTypeUsed(void* value, uint8_t flag) {
+	struct dinSessionSetupResType* dinSessionSetupResType = (struct dinSessionSetupResType*)value;
+	switch(flag) {
+	case 0:
+		dinSessionSetupResType->DateTimeNow_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinSessionSetupResTypeGrammar = { dinSessionSetupResTypeStates, dinSessionSetupResTypeTransitions, dinSessionSetupResTypeProductions, dinSessionSetupResTypeUsed };
+
+static int decode_dinSessionSetupResType(bitstream_t* stream, struct dinSessionSetupResType* dinSessionSetupResType) {
+	init_dinSessionSetupResType(dinSessionSetupResType);
+	return decodeGrammar(stream, &dinSessionSetupResTypeGrammar, dinSessionSetupResType);
+}
+#else
 static int decode_dinSessionSetupResType(bitstream_t* stream, struct dinSessionSetupResType* dinSessionSetupResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 185;
 	int done = 0;
 	
@@ -8703,9 +11831,30 @@ static int decode_dinSessionSetupResType(bitstream_t* stream, struct dinSessionS
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_SessionSetupRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,EVPowerDeliveryParameterType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinEVPowerDeliveryParameterTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinEVPowerDeliveryParameterTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t dinEVPowerDeliveryParameterTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t dinEVPowerDeliveryParameterTypeGrammar = { dinEVPowerDeliveryParameterTypeStates, dinEVPowerDeliveryParameterTypeTransitions, dinEVPowerDeliveryParameterTypeProductions, NULL };
+
+static int decode_dinEVPowerDeliveryParameterType(bitstream_t* stream, struct dinEVPowerDeliveryParameterType* dinEVPowerDeliveryParameterType) {
+	init_dinEVPowerDeliveryParameterType(dinEVPowerDeliveryParameterType);
+	return decodeGrammar(stream, &dinEVPowerDeliveryParameterTypeGrammar, dinEVPowerDeliveryParameterType);
+}
+#else
 static int decode_dinEVPowerDeliveryParameterType(bitstream_t* stream, struct dinEVPowerDeliveryParameterType* dinEVPowerDeliveryParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -8738,9 +11887,31 @@ static int decode_dinEVPowerDeliveryParameterType(bitstream_t* stream, struct di
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509IssuerSerialType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":X509IssuerName,"http://www.w3.org/2000/09/xmldsig#":X509SerialNumber)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinX509IssuerSerialTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinX509IssuerSerialType, X509IssuerName.characters), offsetof(struct dinX509IssuerSerialType, X509IssuerName.charactersLen), dinX509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER64, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinX509IssuerSerialType, X509SerialNumber), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinX509IssuerSerialTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinX509IssuerSerialTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t dinX509IssuerSerialTypeGrammar = { dinX509IssuerSerialTypeStates, dinX509IssuerSerialTypeTransitions, dinX509IssuerSerialTypeProductions, NULL };
+
+static int decode_dinX509IssuerSerialType(bitstream_t* stream, struct dinX509IssuerSerialType* dinX509IssuerSerialType) {
+	init_dinX509IssuerSerialType(dinX509IssuerSerialType);
+	return decodeGrammar(stream, &dinX509IssuerSerialTypeGrammar, dinX509IssuerSerialType);
+}
+#else
 static int decode_dinX509IssuerSerialType(bitstream_t* stream, struct dinX509IssuerSerialType* dinX509IssuerSerialType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 188;
 	int done = 0;
 	
@@ -8762,10 +11933,24 @@ static int decode_dinX509IssuerSerialType(bitstream_t* stream, struct dinX509Iss
 							if (errn == 0) {
 								if (dinX509IssuerSerialType->X509IssuerName.charactersLen >= 2) {
 									dinX509IssuerSerialType->X509IssuerName.charactersLen = (uint16_t)(dinX509IssuerSerialType->X509IssuerName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinX509IssuerSerialType->X509IssuerName.characters, CHARACTER_UNITS(dinX509IssuerSerialType->X509IssuerName.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinX509IssuerSerialType->X509IssuerName.charactersLen, dinX509IssuerSerialType->X509IssuerName.characters, dinX509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinX509IssuerSerialType->X509IssuerName.charactersLen, dinX509IssuerSerialType->X509IssuerName.characters, dinX509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, dinX509IssuerSerialType->X509IssuerName.characters, dinX509IssuerSerialType->X509IssuerName.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, &dinX509IssuerSerialType->X509IssuerName.charactersLen, &dinX509IssuerSerialType->X509IssuerName.characters);
+#else
+									errn = decodeStringValueHit(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, &dinX509IssuerSerialType->X509IssuerName.charactersLen, dinX509IssuerSerialType->X509IssuerName.characters, dinX509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -8846,9 +12031,39 @@ static int decode_dinX509IssuerSerialType(bitstream_t* stream, struct dinX509Iss
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SelectedServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ServiceID,"urn:iso:15118:2:2010:MsgDataTypes":ParameterSetID{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinSelectedServiceTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSelectedServiceType, ServiceID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinSelectedServiceType, ParameterSetID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSelectedServiceTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinSelectedServiceTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }
+};
+static void dinSelectedServiceTypeUsed(void* value, uint8_t flag) {
+	struct dinSelectedServiceType* dinSelectedServiceType = (struct dinSelectedServiceType*)value;
+	switch(flag) {
+	case 0:
+		dinSelectedServiceType->ParameterSetID_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinSelectedServiceTypeGrammar = { dinSelectedServiceTypeStates, dinSelectedServiceTypeTransitions, dinSelectedServiceTypeProductions, dinSelectedServiceTypeUsed };
+
+static int decode_dinSelectedServiceType(bitstream_t* stream, struct dinSelectedServiceType* dinSelectedServiceType) {
+	init_dinSelectedServiceType(dinSelectedServiceType);
+	return decodeGrammar(stream, &dinSelectedServiceTypeGrammar, dinSelectedServiceType);
+}
+#else
 static int decode_dinSelectedServiceType(bitstream_t* stream, struct dinSelectedServiceType* dinSelectedServiceType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 190;
 	int done = 0;
 	
@@ -8950,9 +12165,33 @@ static int decode_dinSelectedServiceType(bitstream_t* stream, struct dinSelected
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,MeteringReceiptResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":AC_EVSEStatus)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_MeteringReceiptRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinMeteringReceiptResTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinMeteringReceiptResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinMeteringReceiptResType, AC_EVSEStatus), 0, 0, 0, decode_dinAC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinMeteringReceiptResTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinMeteringReceiptResTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t dinMeteringReceiptResTypeGrammar = { dinMeteringReceiptResTypeStates, dinMeteringReceiptResTypeTransitions, dinMeteringReceiptResTypeProductions, NULL };
+
+static int decode_dinMeteringReceiptResType(bitstream_t* stream, struct dinMeteringReceiptResType* dinMeteringReceiptResType) {
+	init_dinMeteringReceiptResType(dinMeteringReceiptResType);
+	return decodeGrammar(stream, &dinMeteringReceiptResTypeGrammar, dinMeteringReceiptResType);
+}
+#else
 static int decode_dinMeteringReceiptResType(bitstream_t* stream, struct dinMeteringReceiptResType* dinMeteringReceiptResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 192;
 	int done = 0;
 	
@@ -9033,9 +12272,14 @@ static int decode_dinMeteringReceiptResType(bitstream_t* stream, struct dinMeter
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_MeteringReceiptRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,DC_EVStatusType',  base type name='EVStatusType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":EVReady,"urn:iso:15118:2:2010:MsgDataTypes":EVCabinConditioning{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVRESSConditioning{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVErrorCode,"urn:iso:15118:2:2010:MsgDataTypes":EVRESSSOC)',  derivedBy='EXTENSION'.  */
 static int decode_dinDC_EVStatusType(bitstream_t* stream, struct dinDC_EVStatusType* dinDC_EVStatusType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 193;
 	int done = 0;
 	
@@ -9307,7 +12551,38 @@ static int decode_dinDC_EVStatusType(bitstream_t* stream, struct dinDC_EVStatusT
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,PhysicalValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":Multiplier,"urn:iso:15118:2:2010:MsgDataTypes":Unit{0-1},"urn:iso:15118:2:2010:MsgDataTypes":Value)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinPhysicalValueTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 3, sizeof(int8_t), -3, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPhysicalValueType, Multiplier), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 4, sizeof(dinunitSymbolType), 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinPhysicalValueType, Unit), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPhysicalValueType, Value), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinPhysicalValueTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinPhysicalValueTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }, { 4, 1, 1 }
+};
+static void dinPhysicalValueTypeUsed(void* value, uint8_t flag) {
+	struct dinPhysicalValueType* dinPhysicalValueType = (struct dinPhysicalValueType*)value;
+	switch(flag) {
+	case 0:
+		dinPhysicalValueType->Unit_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinPhysicalValueTypeGrammar = { dinPhysicalValueTypeStates, dinPhysicalValueTypeTransitions, dinPhysicalValueTypeProductions, dinPhysicalValueTypeUsed };
+
+static int decode_dinPhysicalValueType(bitstream_t* stream, struct dinPhysicalValueType* dinPhysicalValueType) {
+	init_dinPhysicalValueType(dinPhysicalValueType);
+	return decodeGrammar(stream, &dinPhysicalValueTypeGrammar, dinPhysicalValueType);
+}
+#else
 static int decode_dinPhysicalValueType(bitstream_t* stream, struct dinPhysicalValueType* dinPhysicalValueType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 198;
 	int done = 0;
 	
@@ -9460,9 +12735,40 @@ static int decode_dinPhysicalValueType(bitstream_t* stream, struct dinPhysicalVa
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ManifestType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if DIN_DEPLOY_Manifest == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinManifestTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinManifestType, Id.characters), offsetof(struct dinManifestType, Id.charactersLen), dinManifestType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinManifestType_Reference_ARRAY_SIZE, offsetof(struct dinManifestType, Reference.array), offsetof(struct dinManifestType, Reference.arrayLen), sizeof(((struct dinManifestType*)0)->Reference.array[0]), 0, 0, 0, 0, decode_dinReferenceTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinManifestTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinManifestTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }
+};
+static void dinManifestTypeUsed(void* value, uint8_t flag) {
+	struct dinManifestType* dinManifestType = (struct dinManifestType*)value;
+	switch(flag) {
+	case 0:
+		dinManifestType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinManifestTypeGrammar = { dinManifestTypeStates, dinManifestTypeTransitions, dinManifestTypeProductions, dinManifestTypeUsed };
+
+static int decode_dinManifestType(bitstream_t* stream, struct dinManifestType* dinManifestType) {
+	init_dinManifestType(dinManifestType);
+	return decodeGrammar(stream, &dinManifestTypeGrammar, dinManifestType);
+}
+#else
 static int decode_dinManifestType(bitstream_t* stream, struct dinManifestType* dinManifestType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 201;
 	int done = 0;
 	
@@ -9480,17 +12786,40 @@ static int decode_dinManifestType(bitstream_t* stream, struct dinManifestType* d
 					if (errn == 0) {
 						if (dinManifestType->Id.charactersLen >= 2) {
 							dinManifestType->Id.charactersLen = (uint16_t)(dinManifestType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinManifestType->Id.characters, CHARACTER_UNITS(dinManifestType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinManifestType->Id.charactersLen, dinManifestType->Id.characters, dinManifestType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinManifestType->Id.charactersLen, dinManifestType->Id.characters, dinManifestType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinManifestType->Id.characters, dinManifestType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinManifestType->Id.charactersLen, &dinManifestType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinManifestType->Id.charactersLen, dinManifestType->Id.characters, dinManifestType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinManifestType->Id_isUsed = 1u;
 					grammarID = 202;
 					break;
 				case 1:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinManifestType->Reference.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinManifestType->Reference.array, dinManifestType_Reference_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinManifestType->Reference.arrayLen < dinManifestType_Reference_ARRAY_SIZE) {
+#else
 					if (dinManifestType->Reference.arrayLen < dinManifestType_Reference_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinReferenceType(stream, &dinManifestType->Reference.array[dinManifestType->Reference.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -9509,7 +12838,16 @@ static int decode_dinManifestType(bitstream_t* stream, struct dinManifestType* d
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinManifestType->Reference.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinManifestType->Reference.array, dinManifestType_Reference_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinManifestType->Reference.arrayLen < dinManifestType_Reference_ARRAY_SIZE) {
+#else
 					if (dinManifestType->Reference.arrayLen < dinManifestType_Reference_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinReferenceType(stream, &dinManifestType->Reference.array[dinManifestType->Reference.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -9528,7 +12866,16 @@ static int decode_dinManifestType(bitstream_t* stream, struct dinManifestType* d
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinManifestType->Reference.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinManifestType->Reference.array, dinManifestType_Reference_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinManifestType->Reference.arrayLen < dinManifestType_Reference_ARRAY_SIZE) {
+#else
 					if (dinManifestType->Reference.arrayLen < dinManifestType_Reference_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinReferenceType(stream, &dinManifestType->Reference.array[dinManifestType->Reference.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -9555,9 +12902,44 @@ static int decode_dinManifestType(bitstream_t* stream, struct dinManifestType* d
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_Manifest */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,PMaxScheduleEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2010:MsgDataTypes":TimeInterval),("urn:iso:15118:2:2010:MsgDataTypes":PMax))',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinPMaxScheduleEntryTypeProductions[4] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinPMaxScheduleEntryType, RelativeTimeInterval), 0, 0, 0, decode_dinRelativeTimeIntervalTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinPMaxScheduleEntryType, TimeInterval), 0, 0, 0, decode_dinIntervalTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPMaxScheduleEntryType, PMax), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinPMaxScheduleEntryTypeTransitions[4] = {
+	{ 1, 0 }, { 1, 1 }, { 2, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinPMaxScheduleEntryTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static void dinPMaxScheduleEntryTypeUsed(void* value, uint8_t flag) {
+	struct dinPMaxScheduleEntryType* dinPMaxScheduleEntryType = (struct dinPMaxScheduleEntryType*)value;
+	switch(flag) {
+	case 0:
+		dinPMaxScheduleEntryType->RelativeTimeInterval_isUsed = 1u;
+		break;
+	case 1:
+		dinPMaxScheduleEntryType->TimeInterval_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinPMaxScheduleEntryTypeGrammar = { dinPMaxScheduleEntryTypeStates, dinPMaxScheduleEntryTypeTransitions, dinPMaxScheduleEntryTypeProductions, dinPMaxScheduleEntryTypeUsed };
+
+static int decode_dinPMaxScheduleEntryType(bitstream_t* stream, struct dinPMaxScheduleEntryType* dinPMaxScheduleEntryType) {
+	init_dinPMaxScheduleEntryType(dinPMaxScheduleEntryType);
+	return decodeGrammar(stream, &dinPMaxScheduleEntryTypeGrammar, dinPMaxScheduleEntryType);
+}
+#else
 static int decode_dinPMaxScheduleEntryType(bitstream_t* stream, struct dinPMaxScheduleEntryType* dinPMaxScheduleEntryType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 204;
 	int done = 0;
 	
@@ -9643,9 +13025,30 @@ static int decode_dinPMaxScheduleEntryType(bitstream_t* stream, struct dinPMaxSc
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ServiceParameterListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ParameterSet{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinServiceParameterListTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinServiceParameterListType_ParameterSet_ARRAY_SIZE, offsetof(struct dinServiceParameterListType, ParameterSet.array), offsetof(struct dinServiceParameterListType, ParameterSet.arrayLen), sizeof(((struct dinServiceParameterListType*)0)->ParameterSet.array[0]), 0, 0, 0, 0, decode_dinParameterSetTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinServiceParameterListTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinServiceParameterListTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t dinServiceParameterListTypeGrammar = { dinServiceParameterListTypeStates, dinServiceParameterListTypeTransitions, dinServiceParameterListTypeProductions, NULL };
+
+static int decode_dinServiceParameterListType(bitstream_t* stream, struct dinServiceParameterListType* dinServiceParameterListType) {
+	init_dinServiceParameterListType(dinServiceParameterListType);
+	return decodeGrammar(stream, &dinServiceParameterListTypeGrammar, dinServiceParameterListType);
+}
+#else
 static int decode_dinServiceParameterListType(bitstream_t* stream, struct dinServiceParameterListType* dinServiceParameterListType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 206;
 	int done = 0;
 	
@@ -9705,9 +13108,39 @@ static int decode_dinServiceParameterListType(bitstream_t* stream, struct dinSer
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureValueType',  base type name='base64Binary',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinSignatureValueTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinSignatureValueType, Id.characters), offsetof(struct dinSignatureValueType, Id.charactersLen), dinSignatureValueType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSignatureValueType, CONTENT.bytes), offsetof(struct dinSignatureValueType, CONTENT.bytesLen), dinSignatureValueType_CONTENT_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSignatureValueTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinSignatureValueTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static void dinSignatureValueTypeUsed(void* value, uint8_t flag) {
+	struct dinSignatureValueType* dinSignatureValueType = (struct dinSignatureValueType*)value;
+	switch(flag) {
+	case 0:
+		dinSignatureValueType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinSignatureValueTypeGrammar = { dinSignatureValueTypeStates, dinSignatureValueTypeTransitions, dinSignatureValueTypeProductions, dinSignatureValueTypeUsed };
+
+static int decode_dinSignatureValueType(bitstream_t* stream, struct dinSignatureValueType* dinSignatureValueType) {
+	init_dinSignatureValueType(dinSignatureValueType);
+	return decodeGrammar(stream, &dinSignatureValueTypeGrammar, dinSignatureValueType);
+}
+#else
 static int decode_dinSignatureValueType(bitstream_t* stream, struct dinSignatureValueType* dinSignatureValueType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 208;
 	int done = 0;
 	
@@ -9725,10 +13158,24 @@ static int decode_dinSignatureValueType(bitstream_t* stream, struct dinSignature
 					if (errn == 0) {
 						if (dinSignatureValueType->Id.charactersLen >= 2) {
 							dinSignatureValueType->Id.charactersLen = (uint16_t)(dinSignatureValueType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignatureValueType->Id.characters, CHARACTER_UNITS(dinSignatureValueType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignatureValueType->Id.charactersLen, dinSignatureValueType->Id.characters, dinSignatureValueType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignatureValueType->Id.charactersLen, dinSignatureValueType->Id.characters, dinSignatureValueType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinSignatureValueType->Id.characters, dinSignatureValueType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinSignatureValueType->Id.charactersLen, &dinSignatureValueType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinSignatureValueType->Id.charactersLen, dinSignatureValueType->Id.characters, dinSignatureValueType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinSignatureValueType->Id_isUsed = 1u;
@@ -9740,7 +13187,14 @@ static int decode_dinSignatureValueType(bitstream_t* stream, struct dinSignature
 						errn =  (dinSignatureValueType->CONTENT.bytesLen) <= dinSignatureValueType_CONTENT_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 					}
 					if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+						errn = EXI_ARENA_ALLOCATE(stream, dinSignatureValueType->CONTENT.bytes, dinSignatureValueType->CONTENT.bytesLen);
+						if (errn == 0) {
+							errn = decodeBytes(stream, dinSignatureValueType->CONTENT.bytesLen, dinSignatureValueType->CONTENT.bytes);
+						}
+#else
 						errn = decodeBytes(stream, dinSignatureValueType->CONTENT.bytesLen, dinSignatureValueType->CONTENT.bytes);
+#endif /* DATABINDING_SLIM */
 					}
 					grammarID = 4;
 					break;
@@ -9761,7 +13215,14 @@ static int decode_dinSignatureValueType(bitstream_t* stream, struct dinSignature
 						errn =  (dinSignatureValueType->CONTENT.bytesLen) <= dinSignatureValueType_CONTENT_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 					}
 					if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+						errn = EXI_ARENA_ALLOCATE(stream, dinSignatureValueType->CONTENT.bytes, dinSignatureValueType->CONTENT.bytesLen);
+						if (errn == 0) {
+							errn = decodeBytes(stream, dinSignatureValueType->CONTENT.bytesLen, dinSignatureValueType->CONTENT.bytes);
+						}
+#else
 						errn = decodeBytes(stream, dinSignatureValueType->CONTENT.bytesLen, dinSignatureValueType->CONTENT.bytes);
+#endif /* DATABINDING_SLIM */
 					}
 					grammarID = 4;
 					break;
@@ -9796,9 +13257,31 @@ static int decode_dinSignatureValueType(bitstream_t* stream, struct dinSignature
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,PaymentOptionsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":PaymentOption{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinPaymentOptionsTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 1, sizeof(dinpaymentOptionType), 0, EXI_GRAMMAR_NO_FLAG, 0, dinPaymentOptionsType_PaymentOption_ARRAY_SIZE, offsetof(struct dinPaymentOptionsType, PaymentOption.array), offsetof(struct dinPaymentOptionsType, PaymentOption.arrayLen), sizeof(((struct dinPaymentOptionsType*)0)->PaymentOption.array[0]), 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinPaymentOptionsTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinPaymentOptionsTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t dinPaymentOptionsTypeGrammar = { dinPaymentOptionsTypeStates, dinPaymentOptionsTypeTransitions, dinPaymentOptionsTypeProductions, NULL };
+
+static int decode_dinPaymentOptionsType(bitstream_t* stream, struct dinPaymentOptionsType* dinPaymentOptionsType) {
+	init_dinPaymentOptionsType(dinPaymentOptionsType);
+	return decodeGrammar(stream, &dinPaymentOptionsTypeGrammar, dinPaymentOptionsType);
+}
+#else
 static int decode_dinPaymentOptionsType(bitstream_t* stream, struct dinPaymentOptionsType* dinPaymentOptionsType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 210;
 	int done = 0;
 	
@@ -9896,9 +13379,45 @@ static int decode_dinPaymentOptionsType(bitstream_t* stream, struct dinPaymentOp
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ServiceTagType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ServiceID,"urn:iso:15118:2:2010:MsgDataTypes":ServiceName{0-1},"urn:iso:15118:2:2010:MsgDataTypes":ServiceCategory,"urn:iso:15118:2:2010:MsgDataTypes":ServiceScope{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinServiceTagTypeProductions[5] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceTagType, ServiceID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinServiceTagType, ServiceName.characters), offsetof(struct dinServiceTagType, ServiceName.charactersLen), dinServiceTagType_ServiceName_CHARACTERS_SIZE, 20 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceName */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(dinserviceCategoryType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceTagType, ServiceCategory), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinServiceTagType, ServiceScope.characters), offsetof(struct dinServiceTagType, ServiceScope.charactersLen), dinServiceTagType_ServiceScope_CHARACTERS_SIZE, 21 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceScope */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinServiceTagTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 3, 2 }, { 4, 3 }, { 0, 4 }, { 0, 4 }
+};
+static const exi_grammar_state_t dinServiceTagTypeStates[5] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }, { 4, 2, 2 }, { 6, 1, 1 }
+};
+static void dinServiceTagTypeUsed(void* value, uint8_t flag) {
+	struct dinServiceTagType* dinServiceTagType = (struct dinServiceTagType*)value;
+	switch(flag) {
+	case 0:
+		dinServiceTagType->ServiceName_isUsed = 1u;
+		break;
+	case 1:
+		dinServiceTagType->ServiceScope_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinServiceTagTypeGrammar = { dinServiceTagTypeStates, dinServiceTagTypeTransitions, dinServiceTagTypeProductions, dinServiceTagTypeUsed };
+
+static int decode_dinServiceTagType(bitstream_t* stream, struct dinServiceTagType* dinServiceTagType) {
+	init_dinServiceTagType(dinServiceTagType);
+	return decodeGrammar(stream, &dinServiceTagTypeGrammar, dinServiceTagType);
+}
+#else
 static int decode_dinServiceTagType(bitstream_t* stream, struct dinServiceTagType* dinServiceTagType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 212;
 	int done = 0;
 	
@@ -9952,10 +13471,24 @@ static int decode_dinServiceTagType(bitstream_t* stream, struct dinServiceTagTyp
 							if (errn == 0) {
 								if (dinServiceTagType->ServiceName.charactersLen >= 2) {
 									dinServiceTagType->ServiceName.charactersLen = (uint16_t)(dinServiceTagType->ServiceName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinServiceTagType->ServiceName.characters, CHARACTER_UNITS(dinServiceTagType->ServiceName.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinServiceTagType->ServiceName.charactersLen, dinServiceTagType->ServiceName.characters, dinServiceTagType_ServiceName_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinServiceTagType->ServiceName.charactersLen, dinServiceTagType->ServiceName.characters, dinServiceTagType_ServiceName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 20 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceName */, dinServiceTagType->ServiceName.characters, dinServiceTagType->ServiceName.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 20 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceName */, &dinServiceTagType->ServiceName.charactersLen, &dinServiceTagType->ServiceName.characters);
+#else
+									errn = decodeStringValueHit(stream, 20 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceName */, &dinServiceTagType->ServiceName.charactersLen, dinServiceTagType->ServiceName.characters, dinServiceTagType_ServiceName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							dinServiceTagType->ServiceName_isUsed = 1u;
@@ -10049,10 +13582,24 @@ static int decode_dinServiceTagType(bitstream_t* stream, struct dinServiceTagTyp
 							if (errn == 0) {
 								if (dinServiceTagType->ServiceScope.charactersLen >= 2) {
 									dinServiceTagType->ServiceScope.charactersLen = (uint16_t)(dinServiceTagType->ServiceScope.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinServiceTagType->ServiceScope.characters, CHARACTER_UNITS(dinServiceTagType->ServiceScope.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinServiceTagType->ServiceScope.charactersLen, dinServiceTagType->ServiceScope.characters, dinServiceTagType_ServiceScope_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinServiceTagType->ServiceScope.charactersLen, dinServiceTagType->ServiceScope.characters, dinServiceTagType_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 21 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceScope */, dinServiceTagType->ServiceScope.characters, dinServiceTagType->ServiceScope.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 21 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceScope */, &dinServiceTagType->ServiceScope.charactersLen, &dinServiceTagType->ServiceScope.characters);
+#else
+									errn = decodeStringValueHit(stream, 21 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceScope */, &dinServiceTagType->ServiceScope.charactersLen, dinServiceTagType->ServiceScope.characters, dinServiceTagType_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							dinServiceTagType->ServiceScope_isUsed = 1u;
@@ -10106,9 +13653,34 @@ static int decode_dinServiceTagType(bitstream_t* stream, struct dinServiceTagTyp
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,AC_EVSEStatusType',  base type name='EVSEStatusType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":PowerSwitchClosed,"urn:iso:15118:2:2010:MsgDataTypes":RCD,"urn:iso:15118:2:2010:MsgDataTypes":NotificationMaxDelay,"urn:iso:15118:2:2010:MsgDataTypes":EVSENotification)',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinAC_EVSEStatusTypeProductions[5] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVSEStatusType, PowerSwitchClosed), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVSEStatusType, RCD), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVSEStatusType, NotificationMaxDelay), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(dinEVSENotificationType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVSEStatusType, EVSENotification), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinAC_EVSEStatusTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t dinAC_EVSEStatusTypeStates[5] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }
+};
+static const exi_grammar_t dinAC_EVSEStatusTypeGrammar = { dinAC_EVSEStatusTypeStates, dinAC_EVSEStatusTypeTransitions, dinAC_EVSEStatusTypeProductions, NULL };
+
+static int decode_dinAC_EVSEStatusType(bitstream_t* stream, struct dinAC_EVSEStatusType* dinAC_EVSEStatusType) {
+	init_dinAC_EVSEStatusType(dinAC_EVSEStatusType);
+	return decodeGrammar(stream, &dinAC_EVSEStatusTypeGrammar, dinAC_EVSEStatusType);
+}
+#else
 static int decode_dinAC_EVSEStatusType(bitstream_t* stream, struct dinAC_EVSEStatusType* dinAC_EVSEStatusType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 216;
 	int done = 0;
 	
@@ -10270,9 +13842,43 @@ static int decode_dinAC_EVSEStatusType(bitstream_t* stream, struct dinAC_EVSESta
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CertificateUpdateReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2010:MsgBody":ContractID,"urn:iso:15118:2:2010:MsgBody":ListOfRootCertificateIDs,"urn:iso:15118:2:2010:MsgBody":DHParams)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CertificateUpdateReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinCertificateUpdateReqTypeProductions[6] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinCertificateUpdateReqType, Id.characters), offsetof(struct dinCertificateUpdateReqType, Id.charactersLen), dinCertificateUpdateReqType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateUpdateReqType, ContractSignatureCertChain), 0, 0, 0, decode_dinCertificateChainTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateUpdateReqType, ContractID.characters), offsetof(struct dinCertificateUpdateReqType, ContractID.charactersLen), dinCertificateUpdateReqType_ContractID_CHARACTERS_SIZE, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateUpdateReqType, ListOfRootCertificateIDs), 0, 0, 0, decode_dinListOfRootCertificateIDsTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateUpdateReqType, DHParams.bytes), offsetof(struct dinCertificateUpdateReqType, DHParams.bytesLen), dinCertificateUpdateReqType_DHParams_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinCertificateUpdateReqTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 0, 5 }
+};
+static const exi_grammar_state_t dinCertificateUpdateReqTypeStates[6] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }, { 6, 1, 1 }
+};
+static void dinCertificateUpdateReqTypeUsed(void* value, uint8_t flag) {
+	struct dinCertificateUpdateReqType* dinCertificateUpdateReqType = (struct dinCertificateUpdateReqType*)value;
+	switch(flag) {
+	case 0:
+		dinCertificateUpdateReqType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinCertificateUpdateReqTypeGrammar = { dinCertificateUpdateReqTypeStates, dinCertificateUpdateReqTypeTransitions, dinCertificateUpdateReqTypeProductions, dinCertificateUpdateReqTypeUsed };
+
+static int decode_dinCertificateUpdateReqType(bitstream_t* stream, struct dinCertificateUpdateReqType* dinCertificateUpdateReqType) {
+	init_dinCertificateUpdateReqType(dinCertificateUpdateReqType);
+	return decodeGrammar(stream, &dinCertificateUpdateReqTypeGrammar, dinCertificateUpdateReqType);
+}
+#else
 static int decode_dinCertificateUpdateReqType(bitstream_t* stream, struct dinCertificateUpdateReqType* dinCertificateUpdateReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 220;
 	int done = 0;
 	
@@ -10290,10 +13896,24 @@ static int decode_dinCertificateUpdateReqType(bitstream_t* stream, struct dinCer
 					if (errn == 0) {
 						if (dinCertificateUpdateReqType->Id.charactersLen >= 2) {
 							dinCertificateUpdateReqType->Id.charactersLen = (uint16_t)(dinCertificateUpdateReqType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinCertificateUpdateReqType->Id.characters, CHARACTER_UNITS(dinCertificateUpdateReqType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinCertificateUpdateReqType->Id.charactersLen, dinCertificateUpdateReqType->Id.characters, dinCertificateUpdateReqType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinCertificateUpdateReqType->Id.charactersLen, dinCertificateUpdateReqType->Id.characters, dinCertificateUpdateReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinCertificateUpdateReqType->Id.characters, dinCertificateUpdateReqType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinCertificateUpdateReqType->Id.charactersLen, &dinCertificateUpdateReqType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinCertificateUpdateReqType->Id.charactersLen, dinCertificateUpdateReqType->Id.characters, dinCertificateUpdateReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinCertificateUpdateReqType->Id_isUsed = 1u;
@@ -10338,10 +13958,24 @@ static int decode_dinCertificateUpdateReqType(bitstream_t* stream, struct dinCer
 							if (errn == 0) {
 								if (dinCertificateUpdateReqType->ContractID.charactersLen >= 2) {
 									dinCertificateUpdateReqType->ContractID.charactersLen = (uint16_t)(dinCertificateUpdateReqType->ContractID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinCertificateUpdateReqType->ContractID.characters, CHARACTER_UNITS(dinCertificateUpdateReqType->ContractID.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinCertificateUpdateReqType->ContractID.charactersLen, dinCertificateUpdateReqType->ContractID.characters, dinCertificateUpdateReqType_ContractID_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinCertificateUpdateReqType->ContractID.charactersLen, dinCertificateUpdateReqType->ContractID.characters, dinCertificateUpdateReqType_ContractID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, dinCertificateUpdateReqType->ContractID.characters, dinCertificateUpdateReqType->ContractID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, &dinCertificateUpdateReqType->ContractID.charactersLen, &dinCertificateUpdateReqType->ContractID.characters);
+#else
+									errn = decodeStringValueHit(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, &dinCertificateUpdateReqType->ContractID.charactersLen, dinCertificateUpdateReqType->ContractID.characters, dinCertificateUpdateReqType_ContractID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -10395,7 +14029,14 @@ static int decode_dinCertificateUpdateReqType(bitstream_t* stream, struct dinCer
 								errn =  (dinCertificateUpdateReqType->DHParams.bytesLen) <= dinCertificateUpdateReqType_DHParams_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinCertificateUpdateReqType->DHParams.bytes, dinCertificateUpdateReqType->DHParams.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinCertificateUpdateReqType->DHParams.bytesLen, dinCertificateUpdateReqType->DHParams.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinCertificateUpdateReqType->DHParams.bytesLen, dinCertificateUpdateReqType->DHParams.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -10443,9 +14084,33 @@ static int decode_dinCertificateUpdateReqType(bitstream_t* stream, struct dinCer
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_CertificateUpdateReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ServicePaymentSelectionResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ServicePaymentSelectionRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinServicePaymentSelectionResTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServicePaymentSelectionResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinServicePaymentSelectionResTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinServicePaymentSelectionResTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t dinServicePaymentSelectionResTypeGrammar = { dinServicePaymentSelectionResTypeStates, dinServicePaymentSelectionResTypeTransitions, dinServicePaymentSelectionResTypeProductions, NULL };
+
+static int decode_dinServicePaymentSelectionResType(bitstream_t* stream, struct dinServicePaymentSelectionResType* dinServicePaymentSelectionResType) {
+	init_dinServicePaymentSelectionResType(dinServicePaymentSelectionResType);
+	return decodeGrammar(stream, &dinServicePaymentSelectionResTypeGrammar, dinServicePaymentSelectionResType);
+}
+#else
 static int decode_dinServicePaymentSelectionResType(bitstream_t* stream, struct dinServicePaymentSelectionResType* dinServicePaymentSelectionResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 223;
 	int done = 0;
 	
@@ -10511,9 +14176,41 @@ static int decode_dinServicePaymentSelectionResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_ServicePaymentSelectionRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SAScheduleTupleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":SAScheduleTupleID,"urn:iso:15118:2:2010:MsgDataTypes":PMaxSchedule,"urn:iso:15118:2:2010:MsgDataTypes":SalesTariff{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinSAScheduleTupleTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSAScheduleTupleType, SAScheduleTupleID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSAScheduleTupleType, PMaxSchedule), 0, 0, 0, decode_dinPMaxScheduleTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinSAScheduleTupleType, SalesTariff), 0, 0, 0, decode_dinSalesTariffTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSAScheduleTupleTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinSAScheduleTupleTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }
+};
+static void dinSAScheduleTupleTypeUsed(void* value, uint8_t flag) {
+	struct dinSAScheduleTupleType* dinSAScheduleTupleType = (struct dinSAScheduleTupleType*)value;
+	switch(flag) {
+	case 0:
+		dinSAScheduleTupleType->SalesTariff_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinSAScheduleTupleTypeGrammar = { dinSAScheduleTupleTypeStates, dinSAScheduleTupleTypeTransitions, dinSAScheduleTupleTypeProductions, dinSAScheduleTupleTypeUsed };
+
+static int decode_dinSAScheduleTupleType(bitstream_t* stream, struct dinSAScheduleTupleType* dinSAScheduleTupleType) {
+	init_dinSAScheduleTupleType(dinSAScheduleTupleType);
+	return decodeGrammar(stream, &dinSAScheduleTupleTypeGrammar, dinSAScheduleTupleType);
+}
+#else
 static int decode_dinSAScheduleTupleType(bitstream_t* stream, struct dinSAScheduleTupleType* dinSAScheduleTupleType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 224;
 	int done = 0;
 	
@@ -10613,9 +14310,31 @@ static int decode_dinSAScheduleTupleType(bitstream_t* stream, struct dinSASchedu
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ChargingProfileType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":SAScheduleTupleID,"urn:iso:15118:2:2010:MsgDataTypes":ProfileEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinChargingProfileTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinChargingProfileType, SAScheduleTupleID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinChargingProfileType_ProfileEntry_ARRAY_SIZE, offsetof(struct dinChargingProfileType, ProfileEntry.array), offsetof(struct dinChargingProfileType, ProfileEntry.arrayLen), sizeof(((struct dinChargingProfileType*)0)->ProfileEntry.array[0]), 0, 0, 0, 0, decode_dinProfileEntryTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinChargingProfileTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinChargingProfileTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }
+};
+static const exi_grammar_t dinChargingProfileTypeGrammar = { dinChargingProfileTypeStates, dinChargingProfileTypeTransitions, dinChargingProfileTypeProductions, NULL };
+
+static int decode_dinChargingProfileType(bitstream_t* stream, struct dinChargingProfileType* dinChargingProfileType) {
+	init_dinChargingProfileType(dinChargingProfileType);
+	return decodeGrammar(stream, &dinChargingProfileTypeGrammar, dinChargingProfileType);
+}
+#else
 static int decode_dinChargingProfileType(bitstream_t* stream, struct dinChargingProfileType* dinChargingProfileType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 227;
 	int done = 0;
 	
@@ -10661,7 +14380,16 @@ static int decode_dinChargingProfileType(bitstream_t* stream, struct dinCharging
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinChargingProfileType->ProfileEntry.array, dinChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinChargingProfileType->ProfileEntry.arrayLen < dinChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (dinChargingProfileType->ProfileEntry.arrayLen < dinChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinProfileEntryType(stream, &dinChargingProfileType->ProfileEntry.array[dinChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10680,7 +14408,16 @@ static int decode_dinChargingProfileType(bitstream_t* stream, struct dinCharging
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinChargingProfileType->ProfileEntry.array, dinChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinChargingProfileType->ProfileEntry.arrayLen < dinChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (dinChargingProfileType->ProfileEntry.arrayLen < dinChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinProfileEntryType(stream, &dinChargingProfileType->ProfileEntry.array[dinChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10707,9 +14444,44 @@ static int decode_dinChargingProfileType(bitstream_t* stream, struct dinCharging
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ServiceDiscoveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ServiceScope{0-1},"urn:iso:15118:2:2010:MsgBody":ServiceCategory{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinServiceDiscoveryReqTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinServiceDiscoveryReqType, ServiceScope.characters), offsetof(struct dinServiceDiscoveryReqType, ServiceScope.charactersLen), dinServiceDiscoveryReqType_ServiceScope_CHARACTERS_SIZE, 15 /* {urn:iso:15118:2:2010:MsgBody}ServiceScope */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(dinserviceCategoryType), 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinServiceDiscoveryReqType, ServiceCategory), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinServiceDiscoveryReqTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 2, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinServiceDiscoveryReqTypeStates[3] = {
+	{ 0, 2, 3 }, { 3, 2, 2 }, { 5, 1, 1 }
+};
+static void dinServiceDiscoveryReqTypeUsed(void* value, uint8_t flag) {
+	struct dinServiceDiscoveryReqType* dinServiceDiscoveryReqType = (struct dinServiceDiscoveryReqType*)value;
+	switch(flag) {
+	case 0:
+		dinServiceDiscoveryReqType->ServiceScope_isUsed = 1u;
+		break;
+	case 1:
+		dinServiceDiscoveryReqType->ServiceCategory_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinServiceDiscoveryReqTypeGrammar = { dinServiceDiscoveryReqTypeStates, dinServiceDiscoveryReqTypeTransitions, dinServiceDiscoveryReqTypeProductions, dinServiceDiscoveryReqTypeUsed };
+
+static int decode_dinServiceDiscoveryReqType(bitstream_t* stream, struct dinServiceDiscoveryReqType* dinServiceDiscoveryReqType) {
+	init_dinServiceDiscoveryReqType(dinServiceDiscoveryReqType);
+	return decodeGrammar(stream, &dinServiceDiscoveryReqTypeGrammar, dinServiceDiscoveryReqType);
+}
+#else
 static int decode_dinServiceDiscoveryReqType(bitstream_t* stream, struct dinServiceDiscoveryReqType* dinServiceDiscoveryReqType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 230;
 	int done = 0;
 	
@@ -10731,10 +14503,24 @@ static int decode_dinServiceDiscoveryReqType(bitstream_t* stream, struct dinServ
 							if (errn == 0) {
 								if (dinServiceDiscoveryReqType->ServiceScope.charactersLen >= 2) {
 									dinServiceDiscoveryReqType->ServiceScope.charactersLen = (uint16_t)(dinServiceDiscoveryReqType->ServiceScope.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinServiceDiscoveryReqType->ServiceScope.characters, CHARACTER_UNITS(dinServiceDiscoveryReqType->ServiceScope.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinServiceDiscoveryReqType->ServiceScope.charactersLen, dinServiceDiscoveryReqType->ServiceScope.characters, dinServiceDiscoveryReqType_ServiceScope_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinServiceDiscoveryReqType->ServiceScope.charactersLen, dinServiceDiscoveryReqType->ServiceScope.characters, dinServiceDiscoveryReqType_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 15 /* {urn:iso:15118:2:2010:MsgBody}ServiceScope */, dinServiceDiscoveryReqType->ServiceScope.characters, dinServiceDiscoveryReqType->ServiceScope.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 15 /* {urn:iso:15118:2:2010:MsgBody}ServiceScope */, &dinServiceDiscoveryReqType->ServiceScope.charactersLen, &dinServiceDiscoveryReqType->ServiceScope.characters);
+#else
+									errn = decodeStringValueHit(stream, 15 /* {urn:iso:15118:2:2010:MsgBody}ServiceScope */, &dinServiceDiscoveryReqType->ServiceScope.charactersLen, dinServiceDiscoveryReqType->ServiceScope.characters, dinServiceDiscoveryReqType_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							dinServiceDiscoveryReqType->ServiceScope_isUsed = 1u;
@@ -10849,9 +14635,34 @@ static int decode_dinServiceDiscoveryReqType(bitstream_t* stream, struct dinServ
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_ServiceDiscoveryReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,AC_EVSEChargeParameterType',  base type name='EVSEChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":AC_EVSEStatus,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaxVoltage,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaxCurrent,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMinCurrent)',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinAC_EVSEChargeParameterTypeProductions[5] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVSEChargeParameterType, AC_EVSEStatus), 0, 0, 0, decode_dinAC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVSEChargeParameterType, EVSEMaxVoltage), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVSEChargeParameterType, EVSEMaxCurrent), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinAC_EVSEChargeParameterType, EVSEMinCurrent), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinAC_EVSEChargeParameterTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t dinAC_EVSEChargeParameterTypeStates[5] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }
+};
+static const exi_grammar_t dinAC_EVSEChargeParameterTypeGrammar = { dinAC_EVSEChargeParameterTypeStates, dinAC_EVSEChargeParameterTypeTransitions, dinAC_EVSEChargeParameterTypeProductions, NULL };
+
+static int decode_dinAC_EVSEChargeParameterType(bitstream_t* stream, struct dinAC_EVSEChargeParameterType* dinAC_EVSEChargeParameterType) {
+	init_dinAC_EVSEChargeParameterType(dinAC_EVSEChargeParameterType);
+	return decodeGrammar(stream, &dinAC_EVSEChargeParameterTypeGrammar, dinAC_EVSEChargeParameterType);
+}
+#else
 static int decode_dinAC_EVSEChargeParameterType(bitstream_t* stream, struct dinAC_EVSEChargeParameterType* dinAC_EVSEChargeParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 232;
 	int done = 0;
 	
@@ -10944,9 +14755,54 @@ static int decode_dinAC_EVSEChargeParameterType(bitstream_t* stream, struct dinA
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyInfoType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":KeyName|"http://www.w3.org/2000/09/xmldsig#":KeyValue|"http://www.w3.org/2000/09/xmldsig#":RetrievalMethod|"http://www.w3.org/2000/09/xmldsig#":X509Data|"http://www.w3.org/2000/09/xmldsig#":PGPData|"http://www.w3.org/2000/09/xmldsig#":SPKIData|"http://www.w3.org/2000/09/xmldsig#":MgmtData|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinKeyInfoTypeProductions[11] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinKeyInfoType, Id.characters), offsetof(struct dinKeyInfoType, Id.charactersLen), dinKeyInfoType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinKeyInfoType_KeyName_ARRAY_SIZE, offsetof(struct dinKeyInfoType, KeyName.array), offsetof(struct dinKeyInfoType, KeyName.arrayLen), sizeof(((struct dinKeyInfoType*)0)->KeyName.array[0]), (offsetof(struct dinKeyInfoType, KeyName.array[0].characters) - offsetof(struct dinKeyInfoType, KeyName.array)), (offsetof(struct dinKeyInfoType, KeyName.array[0].charactersLen) - offsetof(struct dinKeyInfoType, KeyName.array)), dinKeyInfoType_KeyName_CHARACTERS_SIZE, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinKeyInfoType_KeyValue_ARRAY_SIZE, offsetof(struct dinKeyInfoType, KeyValue.array), offsetof(struct dinKeyInfoType, KeyValue.arrayLen), sizeof(((struct dinKeyInfoType*)0)->KeyValue.array[0]), 0, 0, 0, 0, decode_dinKeyValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinKeyInfoType_RetrievalMethod_ARRAY_SIZE, offsetof(struct dinKeyInfoType, RetrievalMethod.array), offsetof(struct dinKeyInfoType, RetrievalMethod.arrayLen), sizeof(((struct dinKeyInfoType*)0)->RetrievalMethod.array[0]), 0, 0, 0, 0, decode_dinRetrievalMethodTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinKeyInfoType_X509Data_ARRAY_SIZE, offsetof(struct dinKeyInfoType, X509Data.array), offsetof(struct dinKeyInfoType, X509Data.arrayLen), sizeof(((struct dinKeyInfoType*)0)->X509Data.array[0]), 0, 0, 0, 0, decode_dinX509DataTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinKeyInfoType_PGPData_ARRAY_SIZE, offsetof(struct dinKeyInfoType, PGPData.array), offsetof(struct dinKeyInfoType, PGPData.arrayLen), sizeof(((struct dinKeyInfoType*)0)->PGPData.array[0]), 0, 0, 0, 0, decode_dinPGPDataTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinKeyInfoType_SPKIData_ARRAY_SIZE, offsetof(struct dinKeyInfoType, SPKIData.array), offsetof(struct dinKeyInfoType, SPKIData.arrayLen), sizeof(((struct dinKeyInfoType*)0)->SPKIData.array[0]), 0, 0, 0, 0, decode_dinSPKIDataTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinKeyInfoType_MgmtData_ARRAY_SIZE, offsetof(struct dinKeyInfoType, MgmtData.array), offsetof(struct dinKeyInfoType, MgmtData.arrayLen), sizeof(((struct dinKeyInfoType*)0)->MgmtData.array[0]), (offsetof(struct dinKeyInfoType, MgmtData.array[0].characters) - offsetof(struct dinKeyInfoType, MgmtData.array)), (offsetof(struct dinKeyInfoType, MgmtData.array[0].charactersLen) - offsetof(struct dinKeyInfoType, MgmtData.array)), dinKeyInfoType_MgmtData_CHARACTERS_SIZE, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinKeyInfoType, ANY.characters), offsetof(struct dinKeyInfoType, ANY.charactersLen), dinKeyInfoType_ANY_CHARACTERS_SIZE, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinKeyInfoTypeTransitions[38] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 2, 4 }, { 2, 5 }, { 2, 6 }, { 2, 7 },
+	{ 2, 8 }, { 3, 9 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 2, 4 }, { 2, 5 }, { 2, 6 },
+	{ 2, 7 }, { 2, 8 }, { 3, 9 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 2, 4 }, { 2, 5 },
+	{ 2, 6 }, { 2, 7 }, { 2, 8 }, { 0, 10 }, { 2, 9 }, { 2, 1 }, { 2, 2 }, { 2, 3 },
+	{ 2, 4 }, { 2, 5 }, { 2, 6 }, { 2, 7 }, { 2, 8 }, { 3, 9 }
+};
+static const exi_grammar_state_t dinKeyInfoTypeStates[4] = {
+	{ 0, 4, 10 }, { 10, 4, 9 }, { 19, 4, 10 }, { 29, 4, 9 }
+};
+static void dinKeyInfoTypeUsed(void* value, uint8_t flag) {
+	struct dinKeyInfoType* dinKeyInfoType = (struct dinKeyInfoType*)value;
+	switch(flag) {
+	case 0:
+		dinKeyInfoType->Id_isUsed = 1u;
+		break;
+	case 1:
+		dinKeyInfoType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinKeyInfoTypeGrammar = { dinKeyInfoTypeStates, dinKeyInfoTypeTransitions, dinKeyInfoTypeProductions, dinKeyInfoTypeUsed };
+
+static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* dinKeyInfoType) {
+	init_dinKeyInfoType(dinKeyInfoType);
+	return decodeGrammar(stream, &dinKeyInfoTypeGrammar, dinKeyInfoType);
+}
+#else
 static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* dinKeyInfoType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 236;
 	int done = 0;
 	
@@ -10964,10 +14820,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					if (errn == 0) {
 						if (dinKeyInfoType->Id.charactersLen >= 2) {
 							dinKeyInfoType->Id.charactersLen = (uint16_t)(dinKeyInfoType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->Id.characters, CHARACTER_UNITS(dinKeyInfoType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinKeyInfoType->Id.charactersLen, dinKeyInfoType->Id.characters, dinKeyInfoType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinKeyInfoType->Id.charactersLen, dinKeyInfoType->Id.characters, dinKeyInfoType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinKeyInfoType->Id.characters, dinKeyInfoType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinKeyInfoType->Id.charactersLen, &dinKeyInfoType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinKeyInfoType->Id.charactersLen, dinKeyInfoType->Id.characters, dinKeyInfoType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinKeyInfoType->Id_isUsed = 1u;
@@ -10983,10 +14853,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 								if (errn == 0) {
 									if (dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen >= 2) {
 										dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen = (uint16_t)(dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, CHARACTER_UNITS(dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType_KeyName_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, &dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinKeyInfoType->KeyName.arrayLen++;
@@ -11025,7 +14909,16 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					grammarID = 238;
 					break;
 				case 4:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinKeyInfoType->X509Data.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->X509Data.array, dinKeyInfoType_X509Data_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinKeyInfoType->X509Data.arrayLen < dinKeyInfoType_X509Data_ARRAY_SIZE) {
+#else
 					if (dinKeyInfoType->X509Data.arrayLen < dinKeyInfoType_X509Data_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinX509DataType(stream, &dinKeyInfoType->X509Data.array[dinKeyInfoType->X509Data.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -11058,10 +14951,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 								if (errn == 0) {
 									if (dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen >= 2) {
 										dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen = (uint16_t)(dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, CHARACTER_UNITS(dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType_MgmtData_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, &dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinKeyInfoType->MgmtData.arrayLen++;
@@ -11093,10 +15000,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					if (errn == 0) {
 						if (dinKeyInfoType->ANY.charactersLen >= 2) {
 							dinKeyInfoType->ANY.charactersLen = (uint16_t)(dinKeyInfoType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->ANY.characters, CHARACTER_UNITS(dinKeyInfoType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinKeyInfoType->ANY.charactersLen, dinKeyInfoType->ANY.characters, dinKeyInfoType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinKeyInfoType->ANY.charactersLen, dinKeyInfoType->ANY.characters, dinKeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, dinKeyInfoType->ANY.characters, dinKeyInfoType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &dinKeyInfoType->ANY.charactersLen, &dinKeyInfoType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &dinKeyInfoType->ANY.charactersLen, dinKeyInfoType->ANY.characters, dinKeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinKeyInfoType->ANY_isUsed = 1u;
@@ -11123,10 +15044,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 								if (errn == 0) {
 									if (dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen >= 2) {
 										dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen = (uint16_t)(dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, CHARACTER_UNITS(dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType_KeyName_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, &dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinKeyInfoType->KeyName.arrayLen++;
@@ -11165,7 +15100,16 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					grammarID = 238;
 					break;
 				case 3:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinKeyInfoType->X509Data.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->X509Data.array, dinKeyInfoType_X509Data_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinKeyInfoType->X509Data.arrayLen < dinKeyInfoType_X509Data_ARRAY_SIZE) {
+#else
 					if (dinKeyInfoType->X509Data.arrayLen < dinKeyInfoType_X509Data_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinX509DataType(stream, &dinKeyInfoType->X509Data.array[dinKeyInfoType->X509Data.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -11198,10 +15142,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 								if (errn == 0) {
 									if (dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen >= 2) {
 										dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen = (uint16_t)(dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, CHARACTER_UNITS(dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType_MgmtData_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, &dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinKeyInfoType->MgmtData.arrayLen++;
@@ -11233,10 +15191,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					if (errn == 0) {
 						if (dinKeyInfoType->ANY.charactersLen >= 2) {
 							dinKeyInfoType->ANY.charactersLen = (uint16_t)(dinKeyInfoType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->ANY.characters, CHARACTER_UNITS(dinKeyInfoType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinKeyInfoType->ANY.charactersLen, dinKeyInfoType->ANY.characters, dinKeyInfoType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinKeyInfoType->ANY.charactersLen, dinKeyInfoType->ANY.characters, dinKeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, dinKeyInfoType->ANY.characters, dinKeyInfoType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &dinKeyInfoType->ANY.charactersLen, &dinKeyInfoType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &dinKeyInfoType->ANY.charactersLen, dinKeyInfoType->ANY.characters, dinKeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinKeyInfoType->ANY_isUsed = 1u;
@@ -11263,10 +15235,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 								if (errn == 0) {
 									if (dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen >= 2) {
 										dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen = (uint16_t)(dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, CHARACTER_UNITS(dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType_KeyName_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, &dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinKeyInfoType->KeyName.arrayLen++;
@@ -11305,7 +15291,16 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					grammarID = 238;
 					break;
 				case 3:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinKeyInfoType->X509Data.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->X509Data.array, dinKeyInfoType_X509Data_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinKeyInfoType->X509Data.arrayLen < dinKeyInfoType_X509Data_ARRAY_SIZE) {
+#else
 					if (dinKeyInfoType->X509Data.arrayLen < dinKeyInfoType_X509Data_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinX509DataType(stream, &dinKeyInfoType->X509Data.array[dinKeyInfoType->X509Data.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -11338,10 +15333,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 								if (errn == 0) {
 									if (dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen >= 2) {
 										dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen = (uint16_t)(dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, CHARACTER_UNITS(dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType_MgmtData_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, &dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinKeyInfoType->MgmtData.arrayLen++;
@@ -11377,10 +15386,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					if (errn == 0) {
 						if (dinKeyInfoType->ANY.charactersLen >= 2) {
 							dinKeyInfoType->ANY.charactersLen = (uint16_t)(dinKeyInfoType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->ANY.characters, CHARACTER_UNITS(dinKeyInfoType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinKeyInfoType->ANY.charactersLen, dinKeyInfoType->ANY.characters, dinKeyInfoType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinKeyInfoType->ANY.charactersLen, dinKeyInfoType->ANY.characters, dinKeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, dinKeyInfoType->ANY.characters, dinKeyInfoType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &dinKeyInfoType->ANY.charactersLen, &dinKeyInfoType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &dinKeyInfoType->ANY.charactersLen, dinKeyInfoType->ANY.characters, dinKeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinKeyInfoType->ANY_isUsed = 1u;
@@ -11407,10 +15430,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 								if (errn == 0) {
 									if (dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen >= 2) {
 										dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen = (uint16_t)(dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, CHARACTER_UNITS(dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType_KeyName_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, &dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].charactersLen, dinKeyInfoType->KeyName.array[dinKeyInfoType->KeyName.arrayLen].characters, dinKeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinKeyInfoType->KeyName.arrayLen++;
@@ -11449,7 +15486,16 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					grammarID = 238;
 					break;
 				case 3:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinKeyInfoType->X509Data.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->X509Data.array, dinKeyInfoType_X509Data_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinKeyInfoType->X509Data.arrayLen < dinKeyInfoType_X509Data_ARRAY_SIZE) {
+#else
 					if (dinKeyInfoType->X509Data.arrayLen < dinKeyInfoType_X509Data_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinX509DataType(stream, &dinKeyInfoType->X509Data.array[dinKeyInfoType->X509Data.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -11482,10 +15528,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 								if (errn == 0) {
 									if (dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen >= 2) {
 										dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen = (uint16_t)(dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, CHARACTER_UNITS(dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType_MgmtData_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, &dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].charactersLen, dinKeyInfoType->MgmtData.array[dinKeyInfoType->MgmtData.arrayLen].characters, dinKeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								dinKeyInfoType->MgmtData.arrayLen++;
@@ -11517,10 +15577,24 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					if (errn == 0) {
 						if (dinKeyInfoType->ANY.charactersLen >= 2) {
 							dinKeyInfoType->ANY.charactersLen = (uint16_t)(dinKeyInfoType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinKeyInfoType->ANY.characters, CHARACTER_UNITS(dinKeyInfoType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinKeyInfoType->ANY.charactersLen, dinKeyInfoType->ANY.characters, dinKeyInfoType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinKeyInfoType->ANY.charactersLen, dinKeyInfoType->ANY.characters, dinKeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, dinKeyInfoType->ANY.characters, dinKeyInfoType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &dinKeyInfoType->ANY.charactersLen, &dinKeyInfoType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &dinKeyInfoType->ANY.charactersLen, dinKeyInfoType->ANY.characters, dinKeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinKeyInfoType->ANY_isUsed = 1u;
@@ -11542,9 +15616,32 @@ static int decode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,PaymentDetailsReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ContractID,"urn:iso:15118:2:2010:MsgBody":ContractSignatureCertChain)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_PaymentDetailsReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinPaymentDetailsReqTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPaymentDetailsReqType, ContractID.characters), offsetof(struct dinPaymentDetailsReqType, ContractID.charactersLen), dinPaymentDetailsReqType_ContractID_CHARACTERS_SIZE, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinPaymentDetailsReqType, ContractSignatureCertChain), 0, 0, 0, decode_dinCertificateChainTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinPaymentDetailsReqTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinPaymentDetailsReqTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t dinPaymentDetailsReqTypeGrammar = { dinPaymentDetailsReqTypeStates, dinPaymentDetailsReqTypeTransitions, dinPaymentDetailsReqTypeProductions, NULL };
+
+static int decode_dinPaymentDetailsReqType(bitstream_t* stream, struct dinPaymentDetailsReqType* dinPaymentDetailsReqType) {
+	init_dinPaymentDetailsReqType(dinPaymentDetailsReqType);
+	return decodeGrammar(stream, &dinPaymentDetailsReqTypeGrammar, dinPaymentDetailsReqType);
+}
+#else
 static int decode_dinPaymentDetailsReqType(bitstream_t* stream, struct dinPaymentDetailsReqType* dinPaymentDetailsReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 240;
 	int done = 0;
 	
@@ -11566,10 +15663,24 @@ static int decode_dinPaymentDetailsReqType(bitstream_t* stream, struct dinPaymen
 							if (errn == 0) {
 								if (dinPaymentDetailsReqType->ContractID.charactersLen >= 2) {
 									dinPaymentDetailsReqType->ContractID.charactersLen = (uint16_t)(dinPaymentDetailsReqType->ContractID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinPaymentDetailsReqType->ContractID.characters, CHARACTER_UNITS(dinPaymentDetailsReqType->ContractID.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinPaymentDetailsReqType->ContractID.charactersLen, dinPaymentDetailsReqType->ContractID.characters, dinPaymentDetailsReqType_ContractID_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinPaymentDetailsReqType->ContractID.charactersLen, dinPaymentDetailsReqType->ContractID.characters, dinPaymentDetailsReqType_ContractID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, dinPaymentDetailsReqType->ContractID.characters, dinPaymentDetailsReqType->ContractID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, &dinPaymentDetailsReqType->ContractID.charactersLen, &dinPaymentDetailsReqType->ContractID.characters);
+#else
+									errn = decodeStringValueHit(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, &dinPaymentDetailsReqType->ContractID.charactersLen, dinPaymentDetailsReqType->ContractID.characters, dinPaymentDetailsReqType_ContractID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -11633,9 +15744,35 @@ static int decode_dinPaymentDetailsReqType(bitstream_t* stream, struct dinPaymen
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_PaymentDetailsReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CableCheckResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2010:MsgBody":EVSEProcessing)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CableCheckRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinCableCheckResTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCableCheckResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCableCheckResType, DC_EVSEStatus), 0, 0, 0, decode_dinDC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 1, sizeof(dinEVSEProcessingType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCableCheckResType, EVSEProcessing), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinCableCheckResTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinCableCheckResTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t dinCableCheckResTypeGrammar = { dinCableCheckResTypeStates, dinCableCheckResTypeTransitions, dinCableCheckResTypeProductions, NULL };
+
+static int decode_dinCableCheckResType(bitstream_t* stream, struct dinCableCheckResType* dinCableCheckResType) {
+	init_dinCableCheckResType(dinCableCheckResType);
+	return decodeGrammar(stream, &dinCableCheckResTypeGrammar, dinCableCheckResType);
+}
+#else
 static int decode_dinCableCheckResType(bitstream_t* stream, struct dinCableCheckResType* dinCableCheckResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 242;
 	int done = 0;
 	
@@ -11749,9 +15886,54 @@ static int decode_dinCableCheckResType(bitstream_t* stream, struct dinCableCheck
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_CableCheckRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ObjectType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any])){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinObjectTypeProductions[6] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinObjectType, Encoding.characters), offsetof(struct dinObjectType, Encoding.charactersLen), dinObjectType_Encoding_CHARACTERS_SIZE, 24 /* {}Encoding */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinObjectType, Id.characters), offsetof(struct dinObjectType, Id.charactersLen), dinObjectType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinObjectType, MimeType.characters), offsetof(struct dinObjectType, MimeType.charactersLen), dinObjectType_MimeType_CHARACTERS_SIZE, 26 /* {}MimeType */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct dinObjectType, ANY.characters), offsetof(struct dinObjectType, ANY.charactersLen), dinObjectType_ANY_CHARACTERS_SIZE, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, NULL }
+};
+static const exi_grammar_transition_t dinObjectTypeTransitions[21] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 0, 4 }, { 4, 5 }, { 2, 1 }, { 3, 2 },
+	{ 4, 3 }, { 0, 4 }, { 4, 5 }, { 3, 2 }, { 4, 3 }, { 0, 4 }, { 4, 5 }, { 4, 3 },
+	{ 0, 4 }, { 4, 5 }, { 4, 3 }, { 0, 4 }, { 4, 5 }
+};
+static const exi_grammar_state_t dinObjectTypeStates[5] = {
+	{ 0, 3, 6 }, { 6, 3, 5 }, { 11, 3, 4 }, { 15, 2, 3 }, { 18, 2, 3 }
+};
+static void dinObjectTypeUsed(void* value, uint8_t flag) {
+	struct dinObjectType* dinObjectType = (struct dinObjectType*)value;
+	switch(flag) {
+	case 0:
+		dinObjectType->Encoding_isUsed = 1u;
+		break;
+	case 1:
+		dinObjectType->Id_isUsed = 1u;
+		break;
+	case 2:
+		dinObjectType->MimeType_isUsed = 1u;
+		break;
+	case 3:
+		dinObjectType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinObjectTypeGrammar = { dinObjectTypeStates, dinObjectTypeTransitions, dinObjectTypeProductions, dinObjectTypeUsed };
+
+static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinObjectType) {
+	init_dinObjectType(dinObjectType);
+	return decodeGrammar(stream, &dinObjectTypeGrammar, dinObjectType);
+}
+#else
 static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinObjectType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 244;
 	int done = 0;
 	
@@ -11769,10 +15951,24 @@ static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 					if (errn == 0) {
 						if (dinObjectType->Encoding.charactersLen >= 2) {
 							dinObjectType->Encoding.charactersLen = (uint16_t)(dinObjectType->Encoding.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinObjectType->Encoding.characters, CHARACTER_UNITS(dinObjectType->Encoding.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinObjectType->Encoding.charactersLen, dinObjectType->Encoding.characters, dinObjectType_Encoding_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinObjectType->Encoding.charactersLen, dinObjectType->Encoding.characters, dinObjectType_Encoding_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 24 /* {}Encoding */, dinObjectType->Encoding.characters, dinObjectType->Encoding.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 24 /* {}Encoding */, &dinObjectType->Encoding.charactersLen, &dinObjectType->Encoding.characters);
+#else
+							errn = decodeStringValueHit(stream, 24 /* {}Encoding */, &dinObjectType->Encoding.charactersLen, dinObjectType->Encoding.characters, dinObjectType_Encoding_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinObjectType->Encoding_isUsed = 1u;
@@ -11783,10 +15979,24 @@ static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 					if (errn == 0) {
 						if (dinObjectType->Id.charactersLen >= 2) {
 							dinObjectType->Id.charactersLen = (uint16_t)(dinObjectType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinObjectType->Id.characters, CHARACTER_UNITS(dinObjectType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinObjectType->Id.charactersLen, dinObjectType->Id.characters, dinObjectType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinObjectType->Id.charactersLen, dinObjectType->Id.characters, dinObjectType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinObjectType->Id.characters, dinObjectType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinObjectType->Id.charactersLen, &dinObjectType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinObjectType->Id.charactersLen, dinObjectType->Id.characters, dinObjectType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinObjectType->Id_isUsed = 1u;
@@ -11797,10 +16007,24 @@ static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 					if (errn == 0) {
 						if (dinObjectType->MimeType.charactersLen >= 2) {
 							dinObjectType->MimeType.charactersLen = (uint16_t)(dinObjectType->MimeType.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinObjectType->MimeType.characters, CHARACTER_UNITS(dinObjectType->MimeType.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinObjectType->MimeType.charactersLen, dinObjectType->MimeType.characters, dinObjectType_MimeType_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinObjectType->MimeType.charactersLen, dinObjectType->MimeType.characters, dinObjectType_MimeType_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 26 /* {}MimeType */, dinObjectType->MimeType.characters, dinObjectType->MimeType.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 26 /* {}MimeType */, &dinObjectType->MimeType.charactersLen, &dinObjectType->MimeType.characters);
+#else
+							errn = decodeStringValueHit(stream, 26 /* {}MimeType */, &dinObjectType->MimeType.charactersLen, dinObjectType->MimeType.characters, dinObjectType_MimeType_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinObjectType->MimeType_isUsed = 1u;
@@ -11820,10 +16044,24 @@ static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 					if (errn == 0) {
 						if (dinObjectType->ANY.charactersLen >= 2) {
 							dinObjectType->ANY.charactersLen = (uint16_t)(dinObjectType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinObjectType->ANY.characters, CHARACTER_UNITS(dinObjectType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &dinObjectType->ANY.charactersLen, &dinObjectType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinObjectType->ANY_isUsed = 1u;
@@ -11845,10 +16083,24 @@ static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 					if (errn == 0) {
 						if (dinObjectType->Id.charactersLen >= 2) {
 							dinObjectType->Id.charactersLen = (uint16_t)(dinObjectType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinObjectType->Id.characters, CHARACTER_UNITS(dinObjectType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinObjectType->Id.charactersLen, dinObjectType->Id.characters, dinObjectType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinObjectType->Id.charactersLen, dinObjectType->Id.characters, dinObjectType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinObjectType->Id.characters, dinObjectType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinObjectType->Id.charactersLen, &dinObjectType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinObjectType->Id.charactersLen, dinObjectType->Id.characters, dinObjectType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinObjectType->Id_isUsed = 1u;
@@ -11859,10 +16111,24 @@ static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 					if (errn == 0) {
 						if (dinObjectType->MimeType.charactersLen >= 2) {
 							dinObjectType->MimeType.charactersLen = (uint16_t)(dinObjectType->MimeType.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinObjectType->MimeType.characters, CHARACTER_UNITS(dinObjectType->MimeType.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinObjectType->MimeType.charactersLen, dinObjectType->MimeType.characters, dinObjectType_MimeType_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinObjectType->MimeType.charactersLen, dinObjectType->MimeType.characters, dinObjectType_MimeType_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 26 /* {}MimeType */, dinObjectType->MimeType.characters, dinObjectType->MimeType.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 26 /* {}MimeType */, &dinObjectType->MimeType.charactersLen, &dinObjectType->MimeType.characters);
+#else
+							errn = decodeStringValueHit(stream, 26 /* {}MimeType */, &dinObjectType->MimeType.charactersLen, dinObjectType->MimeType.characters, dinObjectType_MimeType_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinObjectType->MimeType_isUsed = 1u;
@@ -11882,10 +16148,24 @@ static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 					if (errn == 0) {
 						if (dinObjectType->ANY.charactersLen >= 2) {
 							dinObjectType->ANY.charactersLen = (uint16_t)(dinObjectType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinObjectType->ANY.characters, CHARACTER_UNITS(dinObjectType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &dinObjectType->ANY.charactersLen, &dinObjectType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinObjectType->ANY_isUsed = 1u;
@@ -11907,10 +16187,24 @@ static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 					if (errn == 0) {
 						if (dinObjectType->MimeType.charactersLen >= 2) {
 							dinObjectType->MimeType.charactersLen = (uint16_t)(dinObjectType->MimeType.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinObjectType->MimeType.characters, CHARACTER_UNITS(dinObjectType->MimeType.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinObjectType->MimeType.charactersLen, dinObjectType->MimeType.characters, dinObjectType_MimeType_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinObjectType->MimeType.charactersLen, dinObjectType->MimeType.characters, dinObjectType_MimeType_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 26 /* {}MimeType */, dinObjectType->MimeType.characters, dinObjectType->MimeType.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 26 /* {}MimeType */, &dinObjectType->MimeType.charactersLen, &dinObjectType->MimeType.characters);
+#else
+							errn = decodeStringValueHit(stream, 26 /* {}MimeType */, &dinObjectType->MimeType.charactersLen, dinObjectType->MimeType.characters, dinObjectType_MimeType_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinObjectType->MimeType_isUsed = 1u;
@@ -11930,10 +16224,24 @@ static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 					if (errn == 0) {
 						if (dinObjectType->ANY.charactersLen >= 2) {
 							dinObjectType->ANY.charactersLen = (uint16_t)(dinObjectType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinObjectType->ANY.characters, CHARACTER_UNITS(dinObjectType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &dinObjectType->ANY.charactersLen, &dinObjectType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinObjectType->ANY_isUsed = 1u;
@@ -11964,10 +16272,24 @@ static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 					if (errn == 0) {
 						if (dinObjectType->ANY.charactersLen >= 2) {
 							dinObjectType->ANY.charactersLen = (uint16_t)(dinObjectType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinObjectType->ANY.characters, CHARACTER_UNITS(dinObjectType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &dinObjectType->ANY.charactersLen, &dinObjectType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinObjectType->ANY_isUsed = 1u;
@@ -11998,10 +16320,24 @@ static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 					if (errn == 0) {
 						if (dinObjectType->ANY.charactersLen >= 2) {
 							dinObjectType->ANY.charactersLen = (uint16_t)(dinObjectType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinObjectType->ANY.characters, CHARACTER_UNITS(dinObjectType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &dinObjectType->ANY.charactersLen, &dinObjectType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &dinObjectType->ANY.charactersLen, dinObjectType->ANY.characters, dinObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinObjectType->ANY_isUsed = 1u;
@@ -12023,9 +16359,32 @@ static int decode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,SessionStopResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_SessionStopRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinSessionStopResTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSessionStopResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSessionStopResTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinSessionStopResTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t dinSessionStopResTypeGrammar = { dinSessionStopResTypeStates, dinSessionStopResTypeTransitions, dinSessionStopResTypeProductions, NULL };
+
+static int decode_dinSessionStopResType(bitstream_t* stream, struct dinSessionStopResType* dinSessionStopResType) {
+	init_dinSessionStopResType(dinSessionStopResType);
+	return decodeGrammar(stream, &dinSessionStopResTypeGrammar, dinSessionStopResType);
+}
+#else
 static int decode_dinSessionStopResType(bitstream_t* stream, struct dinSessionStopResType* dinSessionStopResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 223;
 	int done = 0;
 	
@@ -12091,9 +16450,42 @@ static int decode_dinSessionStopResType(bitstream_t* stream, struct dinSessionSt
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_SessionStopRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignedInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":CanonicalizationMethod,"http://www.w3.org/2000/09/xmldsig#":SignatureMethod,"http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinSignedInfoTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinSignedInfoType, Id.characters), offsetof(struct dinSignedInfoType, Id.charactersLen), dinSignedInfoType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSignedInfoType, CanonicalizationMethod), 0, 0, 0, decode_dinCanonicalizationMethodTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSignedInfoType, SignatureMethod), 0, 0, 0, decode_dinSignatureMethodTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinSignedInfoType_Reference_ARRAY_SIZE, offsetof(struct dinSignedInfoType, Reference.array), offsetof(struct dinSignedInfoType, Reference.arrayLen), sizeof(((struct dinSignedInfoType*)0)->Reference.array[0]), 0, 0, 0, 0, decode_dinReferenceTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSignedInfoTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t dinSignedInfoTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 2, 2 }
+};
+static void dinSignedInfoTypeUsed(void* value, uint8_t flag) {
+	struct dinSignedInfoType* dinSignedInfoType = (struct dinSignedInfoType*)value;
+	switch(flag) {
+	case 0:
+		dinSignedInfoType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinSignedInfoTypeGrammar = { dinSignedInfoTypeStates, dinSignedInfoTypeTransitions, dinSignedInfoTypeProductions, dinSignedInfoTypeUsed };
+
+static int decode_dinSignedInfoType(bitstream_t* stream, struct dinSignedInfoType* dinSignedInfoType) {
+	init_dinSignedInfoType(dinSignedInfoType);
+	return decodeGrammar(stream, &dinSignedInfoTypeGrammar, dinSignedInfoType);
+}
+#else
 static int decode_dinSignedInfoType(bitstream_t* stream, struct dinSignedInfoType* dinSignedInfoType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 247;
 	int done = 0;
 	
@@ -12111,10 +16503,24 @@ static int decode_dinSignedInfoType(bitstream_t* stream, struct dinSignedInfoTyp
 					if (errn == 0) {
 						if (dinSignedInfoType->Id.charactersLen >= 2) {
 							dinSignedInfoType->Id.charactersLen = (uint16_t)(dinSignedInfoType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignedInfoType->Id.characters, CHARACTER_UNITS(dinSignedInfoType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignedInfoType->Id.charactersLen, dinSignedInfoType->Id.characters, dinSignedInfoType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignedInfoType->Id.charactersLen, dinSignedInfoType->Id.characters, dinSignedInfoType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinSignedInfoType->Id.characters, dinSignedInfoType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinSignedInfoType->Id.charactersLen, &dinSignedInfoType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinSignedInfoType->Id.charactersLen, dinSignedInfoType->Id.characters, dinSignedInfoType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinSignedInfoType->Id_isUsed = 1u;
@@ -12166,7 +16572,16 @@ static int decode_dinSignedInfoType(bitstream_t* stream, struct dinSignedInfoTyp
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinSignedInfoType->Reference.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinSignedInfoType->Reference.array, dinSignedInfoType_Reference_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinSignedInfoType->Reference.arrayLen < dinSignedInfoType_Reference_ARRAY_SIZE) {
+#else
 					if (dinSignedInfoType->Reference.arrayLen < dinSignedInfoType_Reference_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinReferenceType(stream, &dinSignedInfoType->Reference.array[dinSignedInfoType->Reference.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -12185,7 +16600,16 @@ static int decode_dinSignedInfoType(bitstream_t* stream, struct dinSignedInfoTyp
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinSignedInfoType->Reference.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinSignedInfoType->Reference.array, dinSignedInfoType_Reference_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinSignedInfoType->Reference.arrayLen < dinSignedInfoType_Reference_ARRAY_SIZE) {
+#else
 					if (dinSignedInfoType->Reference.arrayLen < dinSignedInfoType_Reference_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinReferenceType(stream, &dinSignedInfoType->Reference.array[dinSignedInfoType->Reference.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -12212,9 +16636,43 @@ static int decode_dinSignedInfoType(bitstream_t* stream, struct dinSignedInfoTyp
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SalesTariffType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":SalesTariffID,"urn:iso:15118:2:2010:MsgDataTypes":SalesTariffDescription{0-1},"urn:iso:15118:2:2010:MsgDataTypes":NumEPriceLevels,"urn:iso:15118:2:2010:MsgDataTypes":SalesTariffEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinSalesTariffTypeProductions[6] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSalesTariffType, Id.characters), offsetof(struct dinSalesTariffType, Id.charactersLen), dinSalesTariffType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSalesTariffType, SalesTariffID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinSalesTariffType, SalesTariffDescription.characters), offsetof(struct dinSalesTariffType, SalesTariffDescription.charactersLen), dinSalesTariffType_SalesTariffDescription_CHARACTERS_SIZE, 19 /* {urn:iso:15118:2:2010:MsgDataTypes}SalesTariffDescription */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(uint8_t), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSalesTariffType, NumEPriceLevels), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinSalesTariffType_SalesTariffEntry_ARRAY_SIZE, offsetof(struct dinSalesTariffType, SalesTariffEntry.array), offsetof(struct dinSalesTariffType, SalesTariffEntry.arrayLen), sizeof(((struct dinSalesTariffType*)0)->SalesTariffEntry.array[0]), 0, 0, 0, 0, decode_dinSalesTariffEntryTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSalesTariffTypeTransitions[8] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 3 }, { 5, 4 }, { 5, 4 }, { 0, 5 }
+};
+static const exi_grammar_state_t dinSalesTariffTypeStates[6] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }, { 5, 1, 1 }, { 6, 2, 2 }
+};
+static void dinSalesTariffTypeUsed(void* value, uint8_t flag) {
+	struct dinSalesTariffType* dinSalesTariffType = (struct dinSalesTariffType*)value;
+	switch(flag) {
+	case 0:
+		dinSalesTariffType->SalesTariffDescription_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinSalesTariffTypeGrammar = { dinSalesTariffTypeStates, dinSalesTariffTypeTransitions, dinSalesTariffTypeProductions, dinSalesTariffTypeUsed };
+
+static int decode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffType* dinSalesTariffType) {
+	init_dinSalesTariffType(dinSalesTariffType);
+	return decodeGrammar(stream, &dinSalesTariffTypeGrammar, dinSalesTariffType);
+}
+#else
 static int decode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffType* dinSalesTariffType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 251;
 	int done = 0;
 	
@@ -12232,10 +16690,24 @@ static int decode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffT
 					if (errn == 0) {
 						if (dinSalesTariffType->Id.charactersLen >= 2) {
 							dinSalesTariffType->Id.charactersLen = (uint16_t)(dinSalesTariffType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSalesTariffType->Id.characters, CHARACTER_UNITS(dinSalesTariffType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSalesTariffType->Id.charactersLen, dinSalesTariffType->Id.characters, dinSalesTariffType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSalesTariffType->Id.charactersLen, dinSalesTariffType->Id.characters, dinSalesTariffType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinSalesTariffType->Id.characters, dinSalesTariffType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinSalesTariffType->Id.charactersLen, &dinSalesTariffType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinSalesTariffType->Id.charactersLen, dinSalesTariffType->Id.characters, dinSalesTariffType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 252;
@@ -12292,10 +16764,24 @@ static int decode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffT
 							if (errn == 0) {
 								if (dinSalesTariffType->SalesTariffDescription.charactersLen >= 2) {
 									dinSalesTariffType->SalesTariffDescription.charactersLen = (uint16_t)(dinSalesTariffType->SalesTariffDescription.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinSalesTariffType->SalesTariffDescription.characters, CHARACTER_UNITS(dinSalesTariffType->SalesTariffDescription.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinSalesTariffType->SalesTariffDescription.charactersLen, dinSalesTariffType->SalesTariffDescription.characters, dinSalesTariffType_SalesTariffDescription_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinSalesTariffType->SalesTariffDescription.charactersLen, dinSalesTariffType->SalesTariffDescription.characters, dinSalesTariffType_SalesTariffDescription_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 19 /* {urn:iso:15118:2:2010:MsgDataTypes}SalesTariffDescription */, dinSalesTariffType->SalesTariffDescription.characters, dinSalesTariffType->SalesTariffDescription.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 19 /* {urn:iso:15118:2:2010:MsgDataTypes}SalesTariffDescription */, &dinSalesTariffType->SalesTariffDescription.charactersLen, &dinSalesTariffType->SalesTariffDescription.characters);
+#else
+									errn = decodeStringValueHit(stream, 19 /* {urn:iso:15118:2:2010:MsgDataTypes}SalesTariffDescription */, &dinSalesTariffType->SalesTariffDescription.charactersLen, dinSalesTariffType->SalesTariffDescription.characters, dinSalesTariffType_SalesTariffDescription_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							dinSalesTariffType->SalesTariffDescription_isUsed = 1u;
@@ -12381,7 +16867,16 @@ static int decode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffT
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinSalesTariffType->SalesTariffEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinSalesTariffType->SalesTariffEntry.array, dinSalesTariffType_SalesTariffEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinSalesTariffType->SalesTariffEntry.arrayLen < dinSalesTariffType_SalesTariffEntry_ARRAY_SIZE) {
+#else
 					if (dinSalesTariffType->SalesTariffEntry.arrayLen < dinSalesTariffType_SalesTariffEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinSalesTariffEntryType(stream, &dinSalesTariffType->SalesTariffEntry.array[dinSalesTariffType->SalesTariffEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -12400,7 +16895,16 @@ static int decode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffT
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (dinSalesTariffType->SalesTariffEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, dinSalesTariffType->SalesTariffEntry.array, dinSalesTariffType_SalesTariffEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (dinSalesTariffType->SalesTariffEntry.arrayLen < dinSalesTariffType_SalesTariffEntry_ARRAY_SIZE) {
+#else
 					if (dinSalesTariffType->SalesTariffEntry.arrayLen < dinSalesTariffType_SalesTariffEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_dinSalesTariffEntryType(stream, &dinSalesTariffType->SalesTariffEntry.array[dinSalesTariffType->SalesTariffEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -12427,9 +16931,41 @@ static int decode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffT
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,CostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":costKind,"urn:iso:15118:2:2010:MsgDataTypes":amount,"urn:iso:15118:2:2010:MsgDataTypes":amountMultiplier{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinCostTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(dincostKindType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCostType, costKind), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCostType, amount), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 3, sizeof(int8_t), -3, 0, 0, 0, 0, 0, 0, offsetof(struct dinCostType, amountMultiplier), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinCostTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinCostTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }
+};
+static void dinCostTypeUsed(void* value, uint8_t flag) {
+	struct dinCostType* dinCostType = (struct dinCostType*)value;
+	switch(flag) {
+	case 0:
+		dinCostType->amountMultiplier_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinCostTypeGrammar = { dinCostTypeStates, dinCostTypeTransitions, dinCostTypeProductions, dinCostTypeUsed };
+
+static int decode_dinCostType(bitstream_t* stream, struct dinCostType* dinCostType) {
+	init_dinCostType(dinCostType);
+	return decodeGrammar(stream, &dinCostTypeGrammar, dinCostType);
+}
+#else
 static int decode_dinCostType(bitstream_t* stream, struct dinCostType* dinCostType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 257;
 	int done = 0;
 	
@@ -12565,9 +17101,33 @@ static int decode_dinCostType(bitstream_t* stream, struct dinCostType* dinCostTy
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ServiceChargeType',  base type name='ServiceType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2010:MsgDataTypes":ServiceTag,"urn:iso:15118:2:2010:MsgDataTypes":FreeService),("urn:iso:15118:2:2010:MsgDataTypes":EnergyTransferType))',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinServiceChargeTypeProductions[4] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceChargeType, ServiceTag), 0, 0, 0, decode_dinServiceTagTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceChargeType, FreeService), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 4, sizeof(dinEVSESupportedEnergyTransferType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinServiceChargeType, EnergyTransferType), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinServiceChargeTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinServiceChargeTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t dinServiceChargeTypeGrammar = { dinServiceChargeTypeStates, dinServiceChargeTypeTransitions, dinServiceChargeTypeProductions, NULL };
+
+static int decode_dinServiceChargeType(bitstream_t* stream, struct dinServiceChargeType* dinServiceChargeType) {
+	init_dinServiceChargeType(dinServiceChargeType);
+	return decodeGrammar(stream, &dinServiceChargeTypeGrammar, dinServiceChargeType);
+}
+#else
 static int decode_dinServiceChargeType(bitstream_t* stream, struct dinServiceChargeType* dinServiceChargeType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 260;
 	int done = 0;
 	
@@ -12680,9 +17240,42 @@ static int decode_dinServiceChargeType(bitstream_t* stream, struct dinServiceCha
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,DC_EVSEStatusType',  base type name='EVSEStatusType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":EVSEIsolationStatus{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVSEStatusCode,"urn:iso:15118:2:2010:MsgDataTypes":NotificationMaxDelay,"urn:iso:15118:2:2010:MsgDataTypes":EVSENotification)',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t dinDC_EVSEStatusTypeProductions[5] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(dinisolationLevelType), 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEStatusType, EVSEIsolationStatus), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 4, sizeof(dinDC_EVSEStatusCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEStatusType, EVSEStatusCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEStatusType, NotificationMaxDelay), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(dinEVSENotificationType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinDC_EVSEStatusType, EVSENotification), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinDC_EVSEStatusTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t dinDC_EVSEStatusTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }
+};
+static void dinDC_EVSEStatusTypeUsed(void* value, uint8_t flag) {
+	struct dinDC_EVSEStatusType* dinDC_EVSEStatusType = (struct dinDC_EVSEStatusType*)value;
+	switch(flag) {
+	case 0:
+		dinDC_EVSEStatusType->EVSEIsolationStatus_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinDC_EVSEStatusTypeGrammar = { dinDC_EVSEStatusTypeStates, dinDC_EVSEStatusTypeTransitions, dinDC_EVSEStatusTypeProductions, dinDC_EVSEStatusTypeUsed };
+
+static int decode_dinDC_EVSEStatusType(bitstream_t* stream, struct dinDC_EVSEStatusType* dinDC_EVSEStatusType) {
+	init_dinDC_EVSEStatusType(dinDC_EVSEStatusType);
+	return decodeGrammar(stream, &dinDC_EVSEStatusTypeGrammar, dinDC_EVSEStatusType);
+}
+#else
 static int decode_dinDC_EVSEStatusType(bitstream_t* stream, struct dinDC_EVSEStatusType* dinDC_EVSEStatusType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 263;
 	int done = 0;
 	
@@ -12869,9 +17462,47 @@ static int decode_dinDC_EVSEStatusType(bitstream_t* stream, struct dinDC_EVSESta
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RetrievalMethodType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinRetrievalMethodTypeProductions[4] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinRetrievalMethodType, Type.characters), offsetof(struct dinRetrievalMethodType, Type.charactersLen), dinRetrievalMethodType_Type_CHARACTERS_SIZE, 29 /* {}Type */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinRetrievalMethodType, URI.characters), offsetof(struct dinRetrievalMethodType, URI.charactersLen), dinRetrievalMethodType_URI_CHARACTERS_SIZE, 30 /* {}URI */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinRetrievalMethodType, Transforms), 0, 0, 0, decode_dinTransformsTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinRetrievalMethodTypeTransitions[10] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 3, 2 },
+	{ 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinRetrievalMethodTypeStates[4] = {
+	{ 0, 3, 4 }, { 4, 2, 3 }, { 7, 2, 2 }, { 9, 1, 1 }
+};
+static void dinRetrievalMethodTypeUsed(void* value, uint8_t flag) {
+	struct dinRetrievalMethodType* dinRetrievalMethodType = (struct dinRetrievalMethodType*)value;
+	switch(flag) {
+	case 0:
+		dinRetrievalMethodType->Type_isUsed = 1u;
+		break;
+	case 1:
+		dinRetrievalMethodType->URI_isUsed = 1u;
+		break;
+	case 2:
+		dinRetrievalMethodType->Transforms_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinRetrievalMethodTypeGrammar = { dinRetrievalMethodTypeStates, dinRetrievalMethodTypeTransitions, dinRetrievalMethodTypeProductions, dinRetrievalMethodTypeUsed };
+
+static int decode_dinRetrievalMethodType(bitstream_t* stream, struct dinRetrievalMethodType* dinRetrievalMethodType) {
+	init_dinRetrievalMethodType(dinRetrievalMethodType);
+	return decodeGrammar(stream, &dinRetrievalMethodTypeGrammar, dinRetrievalMethodType);
+}
+#else
 static int decode_dinRetrievalMethodType(bitstream_t* stream, struct dinRetrievalMethodType* dinRetrievalMethodType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 265;
 	int done = 0;
 	
@@ -12889,10 +17520,24 @@ static int decode_dinRetrievalMethodType(bitstream_t* stream, struct dinRetrieva
 					if (errn == 0) {
 						if (dinRetrievalMethodType->Type.charactersLen >= 2) {
 							dinRetrievalMethodType->Type.charactersLen = (uint16_t)(dinRetrievalMethodType->Type.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinRetrievalMethodType->Type.characters, CHARACTER_UNITS(dinRetrievalMethodType->Type.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinRetrievalMethodType->Type.charactersLen, dinRetrievalMethodType->Type.characters, dinRetrievalMethodType_Type_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinRetrievalMethodType->Type.charactersLen, dinRetrievalMethodType->Type.characters, dinRetrievalMethodType_Type_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 29 /* {}Type */, dinRetrievalMethodType->Type.characters, dinRetrievalMethodType->Type.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 29 /* {}Type */, &dinRetrievalMethodType->Type.charactersLen, &dinRetrievalMethodType->Type.characters);
+#else
+							errn = decodeStringValueHit(stream, 29 /* {}Type */, &dinRetrievalMethodType->Type.charactersLen, dinRetrievalMethodType->Type.characters, dinRetrievalMethodType_Type_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinRetrievalMethodType->Type_isUsed = 1u;
@@ -12903,10 +17548,24 @@ static int decode_dinRetrievalMethodType(bitstream_t* stream, struct dinRetrieva
 					if (errn == 0) {
 						if (dinRetrievalMethodType->URI.charactersLen >= 2) {
 							dinRetrievalMethodType->URI.charactersLen = (uint16_t)(dinRetrievalMethodType->URI.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinRetrievalMethodType->URI.characters, CHARACTER_UNITS(dinRetrievalMethodType->URI.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinRetrievalMethodType->URI.charactersLen, dinRetrievalMethodType->URI.characters, dinRetrievalMethodType_URI_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinRetrievalMethodType->URI.charactersLen, dinRetrievalMethodType->URI.characters, dinRetrievalMethodType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 30 /* {}URI */, dinRetrievalMethodType->URI.characters, dinRetrievalMethodType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 30 /* {}URI */, &dinRetrievalMethodType->URI.charactersLen, &dinRetrievalMethodType->URI.characters);
+#else
+							errn = decodeStringValueHit(stream, 30 /* {}URI */, &dinRetrievalMethodType->URI.charactersLen, dinRetrievalMethodType->URI.characters, dinRetrievalMethodType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinRetrievalMethodType->URI_isUsed = 1u;
@@ -12937,10 +17596,24 @@ static int decode_dinRetrievalMethodType(bitstream_t* stream, struct dinRetrieva
 					if (errn == 0) {
 						if (dinRetrievalMethodType->URI.charactersLen >= 2) {
 							dinRetrievalMethodType->URI.charactersLen = (uint16_t)(dinRetrievalMethodType->URI.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinRetrievalMethodType->URI.characters, CHARACTER_UNITS(dinRetrievalMethodType->URI.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinRetrievalMethodType->URI.charactersLen, dinRetrievalMethodType->URI.characters, dinRetrievalMethodType_URI_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinRetrievalMethodType->URI.charactersLen, dinRetrievalMethodType->URI.characters, dinRetrievalMethodType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 30 /* {}URI */, dinRetrievalMethodType->URI.characters, dinRetrievalMethodType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 30 /* {}URI */, &dinRetrievalMethodType->URI.charactersLen, &dinRetrievalMethodType->URI.characters);
+#else
+							errn = decodeStringValueHit(stream, 30 /* {}URI */, &dinRetrievalMethodType->URI.charactersLen, dinRetrievalMethodType->URI.characters, dinRetrievalMethodType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinRetrievalMethodType->URI_isUsed = 1u;
@@ -13006,9 +17679,40 @@ static int decode_dinRetrievalMethodType(bitstream_t* stream, struct dinRetrieva
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,NotificationType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":FaultCode,"urn:iso:15118:2:2010:MsgDataTypes":FaultMsg{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinNotificationTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(dinfaultCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinNotificationType, FaultCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinNotificationType, FaultMsg.characters), offsetof(struct dinNotificationType, FaultMsg.charactersLen), dinNotificationType_FaultMsg_CHARACTERS_SIZE, 16 /* {urn:iso:15118:2:2010:MsgDataTypes}FaultMsg */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinNotificationTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t dinNotificationTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }
+};
+static void dinNotificationTypeUsed(void* value, uint8_t flag) {
+	struct dinNotificationType* dinNotificationType = (struct dinNotificationType*)value;
+	switch(flag) {
+	case 0:
+		dinNotificationType->FaultMsg_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinNotificationTypeGrammar = { dinNotificationTypeStates, dinNotificationTypeTransitions, dinNotificationTypeProductions, dinNotificationTypeUsed };
+
+static int decode_dinNotificationType(bitstream_t* stream, struct dinNotificationType* dinNotificationType) {
+	init_dinNotificationType(dinNotificationType);
+	return decodeGrammar(stream, &dinNotificationTypeGrammar, dinNotificationType);
+}
+#else
 static int decode_dinNotificationType(bitstream_t* stream, struct dinNotificationType* dinNotificationType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 268;
 	int done = 0;
 	
@@ -13063,10 +17767,24 @@ static int decode_dinNotificationType(bitstream_t* stream, struct dinNotificatio
 							if (errn == 0) {
 								if (dinNotificationType->FaultMsg.charactersLen >= 2) {
 									dinNotificationType->FaultMsg.charactersLen = (uint16_t)(dinNotificationType->FaultMsg.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinNotificationType->FaultMsg.characters, CHARACTER_UNITS(dinNotificationType->FaultMsg.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinNotificationType->FaultMsg.charactersLen, dinNotificationType->FaultMsg.characters, dinNotificationType_FaultMsg_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinNotificationType->FaultMsg.charactersLen, dinNotificationType->FaultMsg.characters, dinNotificationType_FaultMsg_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 16 /* {urn:iso:15118:2:2010:MsgDataTypes}FaultMsg */, dinNotificationType->FaultMsg.characters, dinNotificationType->FaultMsg.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 16 /* {urn:iso:15118:2:2010:MsgDataTypes}FaultMsg */, &dinNotificationType->FaultMsg.charactersLen, &dinNotificationType->FaultMsg.characters);
+#else
+									errn = decodeStringValueHit(stream, 16 /* {urn:iso:15118:2:2010:MsgDataTypes}FaultMsg */, &dinNotificationType->FaultMsg.charactersLen, dinNotificationType->FaultMsg.characters, dinNotificationType_FaultMsg_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							dinNotificationType->FaultMsg_isUsed = 1u;
@@ -13120,9 +17838,43 @@ static int decode_dinNotificationType(bitstream_t* stream, struct dinNotificatio
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,PGPDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":PGPKeyID,"http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})|("http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED}))',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinPGPDataTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinPGPDataType, PGPKeyID.bytes), offsetof(struct dinPGPDataType, PGPKeyID.bytesLen), dinPGPDataType_PGPKeyID_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinPGPDataType, PGPKeyPacket.bytes), offsetof(struct dinPGPDataType, PGPKeyPacket.bytesLen), dinPGPDataType_PGPKeyPacket_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinPGPDataTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 2, 2 }, { 0, 3 }, { 2, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t dinPGPDataTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 2, 3 }, { 5, 2, 2 }
+};
+static void dinPGPDataTypeUsed(void* value, uint8_t flag) {
+	struct dinPGPDataType* dinPGPDataType = (struct dinPGPDataType*)value;
+	switch(flag) {
+	case 0:
+		dinPGPDataType->PGPKeyID_isUsed = 1u;
+		break;
+	case 1:
+		dinPGPDataType->PGPKeyPacket_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinPGPDataTypeGrammar = { dinPGPDataTypeStates, dinPGPDataTypeTransitions, dinPGPDataTypeProductions, dinPGPDataTypeUsed };
+
+static int decode_dinPGPDataType(bitstream_t* stream, struct dinPGPDataType* dinPGPDataType) {
+	init_dinPGPDataType(dinPGPDataType);
+	return decodeGrammar(stream, &dinPGPDataTypeGrammar, dinPGPDataType);
+}
+#else
 static int decode_dinPGPDataType(bitstream_t* stream, struct dinPGPDataType* dinPGPDataType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 270;
 	int done = 0;
 	
@@ -13145,7 +17897,14 @@ static int decode_dinPGPDataType(bitstream_t* stream, struct dinPGPDataType* din
 								errn =  (dinPGPDataType->PGPKeyID.bytesLen) <= dinPGPDataType_PGPKeyID_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinPGPDataType->PGPKeyID.bytes, dinPGPDataType->PGPKeyID.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinPGPDataType->PGPKeyID.bytesLen, dinPGPDataType->PGPKeyID.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinPGPDataType->PGPKeyID.bytesLen, dinPGPDataType->PGPKeyID.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							dinPGPDataType->PGPKeyID_isUsed = 1u;
 						} else {
@@ -13173,7 +17932,14 @@ static int decode_dinPGPDataType(bitstream_t* stream, struct dinPGPDataType* din
 								errn =  (dinPGPDataType->PGPKeyPacket.bytesLen) <= dinPGPDataType_PGPKeyPacket_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinPGPDataType->PGPKeyPacket.bytes, dinPGPDataType->PGPKeyPacket.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinPGPDataType->PGPKeyPacket.bytesLen, dinPGPDataType->PGPKeyPacket.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinPGPDataType->PGPKeyPacket.bytesLen, dinPGPDataType->PGPKeyPacket.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							dinPGPDataType->PGPKeyPacket_isUsed = 1u;
 						} else {
@@ -13212,7 +17978,14 @@ static int decode_dinPGPDataType(bitstream_t* stream, struct dinPGPDataType* din
 								errn =  (dinPGPDataType->PGPKeyPacket.bytesLen) <= dinPGPDataType_PGPKeyPacket_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinPGPDataType->PGPKeyPacket.bytes, dinPGPDataType->PGPKeyPacket.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinPGPDataType->PGPKeyPacket.bytesLen, dinPGPDataType->PGPKeyPacket.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinPGPDataType->PGPKeyPacket.bytesLen, dinPGPDataType->PGPKeyPacket.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							dinPGPDataType->PGPKeyPacket_isUsed = 1u;
 						} else {
@@ -13275,9 +18048,37 @@ static int decode_dinPGPDataType(bitstream_t* stream, struct dinPGPDataType* din
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CertificateInstallationResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2010:MsgBody":ContractSignatureEncryptedPrivateKey,"urn:iso:15118:2:2010:MsgBody":DHParams,"urn:iso:15118:2:2010:MsgBody":ContractID)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CertificateInstallationRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinCertificateInstallationResTypeProductions[7] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateInstallationResType, Id.characters), offsetof(struct dinCertificateInstallationResType, Id.charactersLen), dinCertificateInstallationResType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(dinresponseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateInstallationResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateInstallationResType, ContractSignatureCertChain), 0, 0, 0, decode_dinCertificateChainTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateInstallationResType, ContractSignatureEncryptedPrivateKey.bytes), offsetof(struct dinCertificateInstallationResType, ContractSignatureEncryptedPrivateKey.bytesLen), dinCertificateInstallationResType_ContractSignatureEncryptedPrivateKey_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateInstallationResType, DHParams.bytes), offsetof(struct dinCertificateInstallationResType, DHParams.bytesLen), dinCertificateInstallationResType_DHParams_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinCertificateInstallationResType, ContractID.characters), offsetof(struct dinCertificateInstallationResType, ContractID.charactersLen), dinCertificateInstallationResType_ContractID_CHARACTERS_SIZE, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinCertificateInstallationResTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 0, 6 }
+};
+static const exi_grammar_state_t dinCertificateInstallationResTypeStates[7] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }, { 6, 1, 1 }
+};
+static const exi_grammar_t dinCertificateInstallationResTypeGrammar = { dinCertificateInstallationResTypeStates, dinCertificateInstallationResTypeTransitions, dinCertificateInstallationResTypeProductions, NULL };
+
+static int decode_dinCertificateInstallationResType(bitstream_t* stream, struct dinCertificateInstallationResType* dinCertificateInstallationResType) {
+	init_dinCertificateInstallationResType(dinCertificateInstallationResType);
+	return decodeGrammar(stream, &dinCertificateInstallationResTypeGrammar, dinCertificateInstallationResType);
+}
+#else
 static int decode_dinCertificateInstallationResType(bitstream_t* stream, struct dinCertificateInstallationResType* dinCertificateInstallationResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 273;
 	int done = 0;
 	
@@ -13295,10 +18096,24 @@ static int decode_dinCertificateInstallationResType(bitstream_t* stream, struct
 					if (errn == 0) {
 						if (dinCertificateInstallationResType->Id.charactersLen >= 2) {
 							dinCertificateInstallationResType->Id.charactersLen = (uint16_t)(dinCertificateInstallationResType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinCertificateInstallationResType->Id.characters, CHARACTER_UNITS(dinCertificateInstallationResType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinCertificateInstallationResType->Id.charactersLen, dinCertificateInstallationResType->Id.characters, dinCertificateInstallationResType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinCertificateInstallationResType->Id.charactersLen, dinCertificateInstallationResType->Id.characters, dinCertificateInstallationResType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinCertificateInstallationResType->Id.characters, dinCertificateInstallationResType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinCertificateInstallationResType->Id.charactersLen, &dinCertificateInstallationResType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinCertificateInstallationResType->Id.charactersLen, dinCertificateInstallationResType->Id.characters, dinCertificateInstallationResType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 274;
@@ -13372,7 +18187,14 @@ static int decode_dinCertificateInstallationResType(bitstream_t* stream, struct
 								errn =  (dinCertificateInstallationResType->ContractSignatureEncryptedPrivateKey.bytesLen) <= dinCertificateInstallationResType_ContractSignatureEncryptedPrivateKey_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinCertificateInstallationResType->ContractSignatureEncryptedPrivateKey.bytes, dinCertificateInstallationResType->ContractSignatureEncryptedPrivateKey.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinCertificateInstallationResType->ContractSignatureEncryptedPrivateKey.bytesLen, dinCertificateInstallationResType->ContractSignatureEncryptedPrivateKey.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinCertificateInstallationResType->ContractSignatureEncryptedPrivateKey.bytesLen, dinCertificateInstallationResType->ContractSignatureEncryptedPrivateKey.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -13410,7 +18232,14 @@ static int decode_dinCertificateInstallationResType(bitstream_t* stream, struct
 								errn =  (dinCertificateInstallationResType->DHParams.bytesLen) <= dinCertificateInstallationResType_DHParams_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, dinCertificateInstallationResType->DHParams.bytes, dinCertificateInstallationResType->DHParams.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, dinCertificateInstallationResType->DHParams.bytesLen, dinCertificateInstallationResType->DHParams.bytes);
+								}
+#else
 								errn = decodeBytes(stream, dinCertificateInstallationResType->DHParams.bytesLen, dinCertificateInstallationResType->DHParams.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -13447,10 +18276,24 @@ static int decode_dinCertificateInstallationResType(bitstream_t* stream, struct
 							if (errn == 0) {
 								if (dinCertificateInstallationResType->ContractID.charactersLen >= 2) {
 									dinCertificateInstallationResType->ContractID.charactersLen = (uint16_t)(dinCertificateInstallationResType->ContractID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinCertificateInstallationResType->ContractID.characters, CHARACTER_UNITS(dinCertificateInstallationResType->ContractID.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinCertificateInstallationResType->ContractID.charactersLen, dinCertificateInstallationResType->ContractID.characters, dinCertificateInstallationResType_ContractID_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinCertificateInstallationResType->ContractID.charactersLen, dinCertificateInstallationResType->ContractID.characters, dinCertificateInstallationResType_ContractID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, dinCertificateInstallationResType->ContractID.characters, dinCertificateInstallationResType->ContractID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, &dinCertificateInstallationResType->ContractID.charactersLen, &dinCertificateInstallationResType->ContractID.characters);
+#else
+									errn = decodeStringValueHit(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, &dinCertificateInstallationResType->ContractID.charactersLen, dinCertificateInstallationResType->ContractID.characters, dinCertificateInstallationResType_ContractID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -13499,9 +18342,46 @@ static int decode_dinCertificateInstallationResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* DIN_DEPLOY_CertificateInstallationRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertyType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinSignaturePropertyTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinSignaturePropertyType, Id.characters), offsetof(struct dinSignaturePropertyType, Id.charactersLen), dinSignaturePropertyType_Id_CHARACTERS_SIZE, 25 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinSignaturePropertyType, Target.characters), offsetof(struct dinSignaturePropertyType, Target.charactersLen), dinSignaturePropertyType_Target_CHARACTERS_SIZE, 28 /* {}Target */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinSignaturePropertyType, ANY.characters), offsetof(struct dinSignaturePropertyType, ANY.charactersLen), dinSignaturePropertyType_ANY_CHARACTERS_SIZE, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSignaturePropertyTypeTransitions[10] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 3, 2 }, { 0, 4 }, { 3, 3 },
+	{ 3, 2 }, { 4, 3 }
+};
+static const exi_grammar_state_t dinSignaturePropertyTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }, { 5, 2, 3 }, { 8, 2, 2 }
+};
+static void dinSignaturePropertyTypeUsed(void* value, uint8_t flag) {
+	struct dinSignaturePropertyType* dinSignaturePropertyType = (struct dinSignaturePropertyType*)value;
+	switch(flag) {
+	case 0:
+		dinSignaturePropertyType->Id_isUsed = 1u;
+		break;
+	case 1:
+		dinSignaturePropertyType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinSignaturePropertyTypeGrammar = { dinSignaturePropertyTypeStates, dinSignaturePropertyTypeTransitions, dinSignaturePropertyTypeProductions, dinSignaturePropertyTypeUsed };
+
+static int decode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignaturePropertyType* dinSignaturePropertyType) {
+	init_dinSignaturePropertyType(dinSignaturePropertyType);
+	return decodeGrammar(stream, &dinSignaturePropertyTypeGrammar, dinSignaturePropertyType);
+}
+#else
 static int decode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignaturePropertyType* dinSignaturePropertyType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 279;
 	int done = 0;
 	
@@ -13519,10 +18399,24 @@ static int decode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 					if (errn == 0) {
 						if (dinSignaturePropertyType->Id.charactersLen >= 2) {
 							dinSignaturePropertyType->Id.charactersLen = (uint16_t)(dinSignaturePropertyType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignaturePropertyType->Id.characters, CHARACTER_UNITS(dinSignaturePropertyType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignaturePropertyType->Id.charactersLen, dinSignaturePropertyType->Id.characters, dinSignaturePropertyType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignaturePropertyType->Id.charactersLen, dinSignaturePropertyType->Id.characters, dinSignaturePropertyType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Id */, dinSignaturePropertyType->Id.characters, dinSignaturePropertyType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Id */, &dinSignaturePropertyType->Id.charactersLen, &dinSignaturePropertyType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Id */, &dinSignaturePropertyType->Id.charactersLen, dinSignaturePropertyType->Id.characters, dinSignaturePropertyType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinSignaturePropertyType->Id_isUsed = 1u;
@@ -13533,10 +18427,24 @@ static int decode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 					if (errn == 0) {
 						if (dinSignaturePropertyType->Target.charactersLen >= 2) {
 							dinSignaturePropertyType->Target.charactersLen = (uint16_t)(dinSignaturePropertyType->Target.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignaturePropertyType->Target.characters, CHARACTER_UNITS(dinSignaturePropertyType->Target.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignaturePropertyType->Target.charactersLen, dinSignaturePropertyType->Target.characters, dinSignaturePropertyType_Target_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignaturePropertyType->Target.charactersLen, dinSignaturePropertyType->Target.characters, dinSignaturePropertyType_Target_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 28 /* {}Target */, dinSignaturePropertyType->Target.characters, dinSignaturePropertyType->Target.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 28 /* {}Target */, &dinSignaturePropertyType->Target.charactersLen, &dinSignaturePropertyType->Target.characters);
+#else
+							errn = decodeStringValueHit(stream, 28 /* {}Target */, &dinSignaturePropertyType->Target.charactersLen, dinSignaturePropertyType->Target.characters, dinSignaturePropertyType_Target_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 281;
@@ -13557,10 +18465,24 @@ static int decode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 					if (errn == 0) {
 						if (dinSignaturePropertyType->Target.charactersLen >= 2) {
 							dinSignaturePropertyType->Target.charactersLen = (uint16_t)(dinSignaturePropertyType->Target.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignaturePropertyType->Target.characters, CHARACTER_UNITS(dinSignaturePropertyType->Target.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignaturePropertyType->Target.charactersLen, dinSignaturePropertyType->Target.characters, dinSignaturePropertyType_Target_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignaturePropertyType->Target.charactersLen, dinSignaturePropertyType->Target.characters, dinSignaturePropertyType_Target_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 28 /* {}Target */, dinSignaturePropertyType->Target.characters, dinSignaturePropertyType->Target.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 28 /* {}Target */, &dinSignaturePropertyType->Target.charactersLen, &dinSignaturePropertyType->Target.characters);
+#else
+							errn = decodeStringValueHit(stream, 28 /* {}Target */, &dinSignaturePropertyType->Target.charactersLen, dinSignaturePropertyType->Target.characters, dinSignaturePropertyType_Target_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 281;
@@ -13586,10 +18508,24 @@ static int decode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 					if (errn == 0) {
 						if (dinSignaturePropertyType->ANY.charactersLen >= 2) {
 							dinSignaturePropertyType->ANY.charactersLen = (uint16_t)(dinSignaturePropertyType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignaturePropertyType->ANY.characters, CHARACTER_UNITS(dinSignaturePropertyType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignaturePropertyType->ANY.charactersLen, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignaturePropertyType->ANY.charactersLen, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &dinSignaturePropertyType->ANY.charactersLen, &dinSignaturePropertyType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &dinSignaturePropertyType->ANY.charactersLen, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinSignaturePropertyType->ANY_isUsed = 1u;
@@ -13620,10 +18556,24 @@ static int decode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 					if (errn == 0) {
 						if (dinSignaturePropertyType->ANY.charactersLen >= 2) {
 							dinSignaturePropertyType->ANY.charactersLen = (uint16_t)(dinSignaturePropertyType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignaturePropertyType->ANY.characters, CHARACTER_UNITS(dinSignaturePropertyType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignaturePropertyType->ANY.charactersLen, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignaturePropertyType->ANY.charactersLen, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &dinSignaturePropertyType->ANY.charactersLen, &dinSignaturePropertyType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &dinSignaturePropertyType->ANY.charactersLen, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinSignaturePropertyType->ANY_isUsed = 1u;
@@ -13650,10 +18600,24 @@ static int decode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 					if (errn == 0) {
 						if (dinSignaturePropertyType->ANY.charactersLen >= 2) {
 							dinSignaturePropertyType->ANY.charactersLen = (uint16_t)(dinSignaturePropertyType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, dinSignaturePropertyType->ANY.characters, CHARACTER_UNITS(dinSignaturePropertyType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, dinSignaturePropertyType->ANY.charactersLen, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, dinSignaturePropertyType->ANY.charactersLen, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &dinSignaturePropertyType->ANY.charactersLen, &dinSignaturePropertyType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &dinSignaturePropertyType->ANY.charactersLen, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					dinSignaturePropertyType->ANY_isUsed = 1u;
@@ -13675,9 +18639,52 @@ static int decode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,MeterInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":MeterID,"urn:iso:15118:2:2010:MsgDataTypes":MeterReading{0-1},"urn:iso:15118:2:2010:MsgDataTypes":SigMeterReading{0-1},"urn:iso:15118:2:2010:MsgDataTypes":MeterStatus{0-1},"urn:iso:15118:2:2010:MsgDataTypes":TMeter{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinMeterInfoTypeProductions[6] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct dinMeterInfoType, MeterID.characters), offsetof(struct dinMeterInfoType, MeterID.charactersLen), dinMeterInfoType_MeterID_CHARACTERS_SIZE, 17 /* {urn:iso:15118:2:2010:MsgDataTypes}MeterID */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct dinMeterInfoType, MeterReading), 0, 0, 0, decode_dinPhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct dinMeterInfoType, SigMeterReading.bytes), offsetof(struct dinMeterInfoType, SigMeterReading.bytesLen), dinMeterInfoType_SigMeterReading_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct dinMeterInfoType, MeterStatus), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER64, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct dinMeterInfoType, TMeter), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinMeterInfoTypeTransitions[16] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 0, 5 }, { 3, 2 }, { 4, 3 },
+	{ 5, 4 }, { 0, 5 }, { 4, 3 }, { 5, 4 }, { 0, 5 }, { 5, 4 }, { 0, 5 }, { 0, 5 }
+};
+static const exi_grammar_state_t dinMeterInfoTypeStates[6] = {
+	{ 0, 1, 1 }, { 1, 3, 5 }, { 6, 3, 4 }, { 10, 2, 3 }, { 13, 2, 2 }, { 15, 1, 1 }
+};
+static void dinMeterInfoTypeUsed(void* value, uint8_t flag) {
+	struct dinMeterInfoType* dinMeterInfoType = (struct dinMeterInfoType*)value;
+	switch(flag) {
+	case 0:
+		dinMeterInfoType->MeterReading_isUsed = 1u;
+		break;
+	case 1:
+		dinMeterInfoType->SigMeterReading_isUsed = 1u;
+		break;
+	case 2:
+		dinMeterInfoType->MeterStatus_isUsed = 1u;
+		break;
+	case 3:
+		dinMeterInfoType->TMeter_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t dinMeterInfoTypeGrammar = { dinMeterInfoTypeStates, dinMeterInfoTypeTransitions, dinMeterInfoTypeProductions, dinMeterInfoTypeUsed };
+
+static int decode_dinMeterInfoType(bitstream_t* stream, struct dinMeterInfoType* dinMeterInfoType) {
+	init_dinMeterInfoType(dinMeterInfoType);
+	return decodeGrammar(stream, &dinMeterInfoTypeGrammar, dinMeterInfoType);
+}
+#else
 static int decode_dinMeterInfoType(bitstream_t* stream, struct dinMeterInfoType* dinMeterInfoType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 283;
 	int done = 0;
 	
@@ -13699,10 +18706,24 @@ static int decode_dinMeterInfoType(bitstream_t* stream, struct dinMeterInfoType*
 							if (errn == 0) {
 								if (dinMeterInfoType->MeterID.charactersLen >= 2) {
 									dinMeterInfoType->MeterID.charactersLen = (uint16_t)(dinMeterInfoType->MeterID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinMeterInfoType->MeterID.characters, CHARACTER_UNITS(dinMeterInfoType->MeterID.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, dinMeterInfoType->MeterID.charactersLen, dinMeterInfoType->MeterID.characters, dinMeterInfoType_MeterID_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, dinMeterInfoType->MeterID.charactersLen, dinMeterInfoType->MeterID.characters, dinMeterInfoType_MeterID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 17 /* {urn:iso:15118:2:2010:MsgDataTypes}MeterID */, dinMeterInfoType->MeterID.characters, dinMeterInfoType->MeterID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 17 /* {urn:iso:15118:2:2010:MsgDataTypes}MeterID */, &dinMeterInfoType->MeterID.charactersLen, &dinMeterInfoType->MeterID.characters);
+#else
+									errn = decodeStringValueHit(stream, 17 /* {urn:iso:15118:2:2010:MsgDataTypes}MeterID */, &dinMeterInfoType->MeterID.charactersLen, dinMeterInfoType->MeterID.characters, dinMeterInfoType_MeterID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -14026,9 +19047,30 @@ static int decode_dinMeterInfoType(bitstream_t* stream, struct dinMeterInfoType*
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SubCertificatesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":Certificate{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t dinSubCertificatesTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, dinSubCertificatesType_Certificate_ARRAY_SIZE, offsetof(struct dinSubCertificatesType, Certificate.array), offsetof(struct dinSubCertificatesType, Certificate.arrayLen), sizeof(((struct dinSubCertificatesType*)0)->Certificate.array[0]), (offsetof(struct dinSubCertificatesType, Certificate.array[0].bytes) - offsetof(struct dinSubCertificatesType, Certificate.array)), (offsetof(struct dinSubCertificatesType, Certificate.array[0].bytesLen) - offsetof(struct dinSubCertificatesType, Certificate.array)), dinSubCertificatesType_Certificate_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t dinSubCertificatesTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t dinSubCertificatesTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t dinSubCertificatesTypeGrammar = { dinSubCertificatesTypeStates, dinSubCertificatesTypeTransitions, dinSubCertificatesTypeProductions, NULL };
+
+static int decode_dinSubCertificatesType(bitstream_t* stream, struct dinSubCertificatesType* dinSubCertificatesType) {
+	init_dinSubCertificatesType(dinSubCertificatesType);
+	return decodeGrammar(stream, &dinSubCertificatesTypeGrammar, dinSubCertificatesType);
+}
+#else
 static int decode_dinSubCertificatesType(bitstream_t* stream, struct dinSubCertificatesType* dinSubCertificatesType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 288;
 	int done = 0;
 	
@@ -14052,7 +19094,14 @@ static int decode_dinSubCertificatesType(bitstream_t* stream, struct dinSubCerti
 									errn =  (dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytesLen) <= dinSubCertificatesType_Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytes, dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytesLen, dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytesLen, dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								dinSubCertificatesType->Certificate.arrayLen++;
 							} else {
@@ -14095,7 +19144,14 @@ static int decode_dinSubCertificatesType(bitstream_t* stream, struct dinSubCerti
 									errn =  (dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytesLen) <= dinSubCertificatesType_Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytes, dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytesLen, dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytesLen, dinSubCertificatesType->Certificate.array[dinSubCertificatesType->Certificate.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								dinSubCertificatesType->Certificate.arrayLen++;
 							} else {
@@ -14136,11 +19192,15 @@ static int decode_dinSubCertificatesType(bitstream_t* stream, struct dinSubCerti
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 
 
 
 int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	errn = readEXIHeader(stream);
 
 	if(errn == 0) {
@@ -14149,136 +19209,188 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 		errn = decodeNBitUnsignedInteger(stream, 7, &eventCode);
 		if(errn == 0) {
 			switch(eventCode) {
+#if DIN_DEPLOY_AC_EVChargeParameter == SUPPORT_YES
 			case 0:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVChargeParameter) */
 				errn = decode_dinAC_EVChargeParameterType(stream, &exiDoc->AC_EVChargeParameter);
 				exiDoc->AC_EVChargeParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_AC_EVChargeParameter */
+#if DIN_DEPLOY_AC_EVSEChargeParameter == SUPPORT_YES
 			case 1:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEChargeParameter) */
 				errn = decode_dinAC_EVSEChargeParameterType(stream, &exiDoc->AC_EVSEChargeParameter);
 				exiDoc->AC_EVSEChargeParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_AC_EVSEChargeParameter */
+#if DIN_DEPLOY_AC_EVSEStatus == SUPPORT_YES
 			case 2:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEStatus) */
 				errn = decode_dinAC_EVSEStatusType(stream, &exiDoc->AC_EVSEStatus);
 				exiDoc->AC_EVSEStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_AC_EVSEStatus */
+#if DIN_DEPLOY_BodyElement == SUPPORT_YES
 			case 3:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}BodyElement) */
 				errn = decode_dinBodyBaseType(stream, &exiDoc->BodyElement);
 				exiDoc->BodyElement_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_BodyElement */
+#if DIN_DEPLOY_CableCheckReq == SUPPORT_YES
 			case 4:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckReq) */
 				errn = decode_dinCableCheckReqType(stream, &exiDoc->CableCheckReq);
 				exiDoc->CableCheckReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CableCheckReq */
+#if DIN_DEPLOY_CableCheckRes == SUPPORT_YES
 			case 5:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckRes) */
 				errn = decode_dinCableCheckResType(stream, &exiDoc->CableCheckRes);
 				exiDoc->CableCheckRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CableCheckRes */
+#if DIN_DEPLOY_CanonicalizationMethod == SUPPORT_YES
 			case 6:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod) */
 				errn = decode_dinCanonicalizationMethodType(stream, &exiDoc->CanonicalizationMethod);
 				exiDoc->CanonicalizationMethod_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CanonicalizationMethod */
+#if DIN_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 			case 7:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationReq) */
 				errn = decode_dinCertificateInstallationReqType(stream, &exiDoc->CertificateInstallationReq);
 				exiDoc->CertificateInstallationReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CertificateInstallationReq */
+#if DIN_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 			case 8:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationRes) */
 				errn = decode_dinCertificateInstallationResType(stream, &exiDoc->CertificateInstallationRes);
 				exiDoc->CertificateInstallationRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CertificateInstallationRes */
+#if DIN_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 			case 9:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateReq) */
 				errn = decode_dinCertificateUpdateReqType(stream, &exiDoc->CertificateUpdateReq);
 				exiDoc->CertificateUpdateReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CertificateUpdateReq */
+#if DIN_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 			case 10:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateRes) */
 				errn = decode_dinCertificateUpdateResType(stream, &exiDoc->CertificateUpdateRes);
 				exiDoc->CertificateUpdateRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CertificateUpdateRes */
+#if DIN_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 			case 11:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryReq) */
 				errn = decode_dinChargeParameterDiscoveryReqType(stream, &exiDoc->ChargeParameterDiscoveryReq);
 				exiDoc->ChargeParameterDiscoveryReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryReq */
+#if DIN_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 			case 12:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryRes) */
 				errn = decode_dinChargeParameterDiscoveryResType(stream, &exiDoc->ChargeParameterDiscoveryRes);
 				exiDoc->ChargeParameterDiscoveryRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryRes */
+#if DIN_DEPLOY_ChargingStatusReq == SUPPORT_YES
 			case 13:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusReq) */
 				errn = decode_dinChargingStatusReqType(stream, &exiDoc->ChargingStatusReq);
 				exiDoc->ChargingStatusReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ChargingStatusReq */
+#if DIN_DEPLOY_ChargingStatusRes == SUPPORT_YES
 			case 14:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusRes) */
 				errn = decode_dinChargingStatusResType(stream, &exiDoc->ChargingStatusRes);
 				exiDoc->ChargingStatusRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ChargingStatusRes */
+#if DIN_DEPLOY_ContractAuthenticationReq == SUPPORT_YES
 			case 15:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationReq) */
 				errn = decode_dinContractAuthenticationReqType(stream, &exiDoc->ContractAuthenticationReq);
 				exiDoc->ContractAuthenticationReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ContractAuthenticationReq */
+#if DIN_DEPLOY_ContractAuthenticationRes == SUPPORT_YES
 			case 16:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationRes) */
 				errn = decode_dinContractAuthenticationResType(stream, &exiDoc->ContractAuthenticationRes);
 				exiDoc->ContractAuthenticationRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ContractAuthenticationRes */
+#if DIN_DEPLOY_CurrentDemandReq == SUPPORT_YES
 			case 17:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandReq) */
 				errn = decode_dinCurrentDemandReqType(stream, &exiDoc->CurrentDemandReq);
 				exiDoc->CurrentDemandReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CurrentDemandReq */
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
 			case 18:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandRes) */
 				errn = decode_dinCurrentDemandResType(stream, &exiDoc->CurrentDemandRes);
 				exiDoc->CurrentDemandRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CurrentDemandRes */
+#if DIN_DEPLOY_DC_EVChargeParameter == SUPPORT_YES
 			case 19:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVChargeParameter) */
 				errn = decode_dinDC_EVChargeParameterType(stream, &exiDoc->DC_EVChargeParameter);
 				exiDoc->DC_EVChargeParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DC_EVChargeParameter */
+#if DIN_DEPLOY_DC_EVPowerDeliveryParameter == SUPPORT_YES
 			case 20:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVPowerDeliveryParameter) */
 				errn = decode_dinDC_EVPowerDeliveryParameterType(stream, &exiDoc->DC_EVPowerDeliveryParameter);
 				exiDoc->DC_EVPowerDeliveryParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DC_EVPowerDeliveryParameter */
+#if DIN_DEPLOY_DC_EVSEChargeParameter == SUPPORT_YES
 			case 21:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEChargeParameter) */
 				errn = decode_dinDC_EVSEChargeParameterType(stream, &exiDoc->DC_EVSEChargeParameter);
 				exiDoc->DC_EVSEChargeParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DC_EVSEChargeParameter */
+#if DIN_DEPLOY_DC_EVSEStatus == SUPPORT_YES
 			case 22:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEStatus) */
 				errn = decode_dinDC_EVSEStatusType(stream, &exiDoc->DC_EVSEStatus);
 				exiDoc->DC_EVSEStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DC_EVSEStatus */
+#if DIN_DEPLOY_DC_EVStatus == SUPPORT_YES
 			case 23:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVStatus) */
 				errn = decode_dinDC_EVStatusType(stream, &exiDoc->DC_EVStatus);
 				exiDoc->DC_EVStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DC_EVStatus */
+#if DIN_DEPLOY_DSAKeyValue == SUPPORT_YES
 			case 24:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue) */
 				errn = decode_dinDSAKeyValueType(stream, &exiDoc->DSAKeyValue);
 				exiDoc->DSAKeyValue_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DSAKeyValue */
+#if DIN_DEPLOY_DigestMethod == SUPPORT_YES
 			case 25:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod) */
 				errn = decode_dinDigestMethodType(stream, &exiDoc->DigestMethod);
 				exiDoc->DigestMethod_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DigestMethod */
 			case 26:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -14290,7 +19402,14 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 							errn =  (exiDoc->DigestValue.bytesLen) <= dinEXIDocument_DigestValue_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiDoc->DigestValue.bytes, exiDoc->DigestValue.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiDoc->DigestValue.bytesLen, exiDoc->DigestValue.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiDoc->DigestValue.bytesLen, exiDoc->DigestValue.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiDoc->DigestValue_isUsed = 1u;
 					} else {
@@ -14299,41 +19418,55 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_EVChargeParameter == SUPPORT_YES
 			case 27:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVChargeParameter) */
 				errn = decode_dinEVChargeParameterType(stream, &exiDoc->EVChargeParameter);
 				exiDoc->EVChargeParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_EVChargeParameter */
+#if DIN_DEPLOY_EVPowerDeliveryParameter == SUPPORT_YES
 			case 28:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVPowerDeliveryParameter) */
 				errn = decode_dinEVPowerDeliveryParameterType(stream, &exiDoc->EVPowerDeliveryParameter);
 				exiDoc->EVPowerDeliveryParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_EVPowerDeliveryParameter */
+#if DIN_DEPLOY_EVSEChargeParameter == SUPPORT_YES
 			case 29:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEChargeParameter) */
 				errn = decode_dinEVSEChargeParameterType(stream, &exiDoc->EVSEChargeParameter);
 				exiDoc->EVSEChargeParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_EVSEChargeParameter */
+#if DIN_DEPLOY_EVSEStatus == SUPPORT_YES
 			case 30:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEStatus) */
 				errn = decode_dinEVSEStatusType(stream, &exiDoc->EVSEStatus);
 				exiDoc->EVSEStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_EVSEStatus */
+#if DIN_DEPLOY_EVStatus == SUPPORT_YES
 			case 31:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVStatus) */
 				errn = decode_dinEVStatusType(stream, &exiDoc->EVStatus);
 				exiDoc->EVStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_EVStatus */
+#if DIN_DEPLOY_Entry == SUPPORT_YES
 			case 32:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Entry) */
 				errn = decode_dinEntryType(stream, &exiDoc->Entry);
 				exiDoc->Entry_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Entry */
+#if DIN_DEPLOY_KeyInfo == SUPPORT_YES
 			case 33:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo) */
 				errn = decode_dinKeyInfoType(stream, &exiDoc->KeyInfo);
 				exiDoc->KeyInfo_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_KeyInfo */
 			case 34:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName) */
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
@@ -14344,10 +19477,24 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 						if (errn == 0) {
 							if (exiDoc->KeyName.charactersLen >= 2) {
 								exiDoc->KeyName.charactersLen = (uint16_t)(exiDoc->KeyName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiDoc->KeyName.characters, CHARACTER_UNITS(exiDoc->KeyName.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiDoc->KeyName.charactersLen, exiDoc->KeyName.characters, dinEXIDocument_KeyName_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiDoc->KeyName.charactersLen, exiDoc->KeyName.characters, dinEXIDocument_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiDoc->KeyName.characters, exiDoc->KeyName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &exiDoc->KeyName.charactersLen, &exiDoc->KeyName.characters);
+#else
+								errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &exiDoc->KeyName.charactersLen, exiDoc->KeyName.characters, dinEXIDocument_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiDoc->KeyName_isUsed = 1u;
@@ -14357,26 +19504,34 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_KeyValue == SUPPORT_YES
 			case 35:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue) */
 				errn = decode_dinKeyValueType(stream, &exiDoc->KeyValue);
 				exiDoc->KeyValue_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_KeyValue */
+#if DIN_DEPLOY_Manifest == SUPPORT_YES
 			case 36:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest) */
 				errn = decode_dinManifestType(stream, &exiDoc->Manifest);
 				exiDoc->Manifest_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Manifest */
+#if DIN_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 			case 37:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptReq) */
 				errn = decode_dinMeteringReceiptReqType(stream, &exiDoc->MeteringReceiptReq);
 				exiDoc->MeteringReceiptReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_MeteringReceiptReq */
+#if DIN_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 			case 38:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptRes) */
 				errn = decode_dinMeteringReceiptResType(stream, &exiDoc->MeteringReceiptRes);
 				exiDoc->MeteringReceiptRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_MeteringReceiptRes */
 			case 39:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData) */
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
@@ -14387,10 +19542,24 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 						if (errn == 0) {
 							if (exiDoc->MgmtData.charactersLen >= 2) {
 								exiDoc->MgmtData.charactersLen = (uint16_t)(exiDoc->MgmtData.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiDoc->MgmtData.characters, CHARACTER_UNITS(exiDoc->MgmtData.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiDoc->MgmtData.charactersLen, exiDoc->MgmtData.characters, dinEXIDocument_MgmtData_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiDoc->MgmtData.charactersLen, exiDoc->MgmtData.characters, dinEXIDocument_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiDoc->MgmtData.characters, exiDoc->MgmtData.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &exiDoc->MgmtData.charactersLen, &exiDoc->MgmtData.characters);
+#else
+								errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &exiDoc->MgmtData.charactersLen, exiDoc->MgmtData.characters, dinEXIDocument_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiDoc->MgmtData_isUsed = 1u;
@@ -14400,211 +19569,293 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_Object == SUPPORT_YES
 			case 40:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object) */
 				errn = decode_dinObjectType(stream, &exiDoc->Object);
 				exiDoc->Object_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Object */
+#if DIN_DEPLOY_PGPData == SUPPORT_YES
 			case 41:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData) */
 				errn = decode_dinPGPDataType(stream, &exiDoc->PGPData);
 				exiDoc->PGPData_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PGPData */
+#if DIN_DEPLOY_PMaxScheduleEntry == SUPPORT_YES
 			case 42:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PMaxScheduleEntry) */
 				errn = decode_dinPMaxScheduleEntryType(stream, &exiDoc->PMaxScheduleEntry);
 				exiDoc->PMaxScheduleEntry_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PMaxScheduleEntry */
+#if DIN_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 			case 43:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsReq) */
 				errn = decode_dinPaymentDetailsReqType(stream, &exiDoc->PaymentDetailsReq);
 				exiDoc->PaymentDetailsReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PaymentDetailsReq */
+#if DIN_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 			case 44:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsRes) */
 				errn = decode_dinPaymentDetailsResType(stream, &exiDoc->PaymentDetailsRes);
 				exiDoc->PaymentDetailsRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PaymentDetailsRes */
+#if DIN_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 			case 45:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryReq) */
 				errn = decode_dinPowerDeliveryReqType(stream, &exiDoc->PowerDeliveryReq);
 				exiDoc->PowerDeliveryReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PowerDeliveryReq */
+#if DIN_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 			case 46:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryRes) */
 				errn = decode_dinPowerDeliveryResType(stream, &exiDoc->PowerDeliveryRes);
 				exiDoc->PowerDeliveryRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PowerDeliveryRes */
+#if DIN_DEPLOY_PreChargeReq == SUPPORT_YES
 			case 47:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeReq) */
 				errn = decode_dinPreChargeReqType(stream, &exiDoc->PreChargeReq);
 				exiDoc->PreChargeReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PreChargeReq */
+#if DIN_DEPLOY_PreChargeRes == SUPPORT_YES
 			case 48:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeRes) */
 				errn = decode_dinPreChargeResType(stream, &exiDoc->PreChargeRes);
 				exiDoc->PreChargeRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PreChargeRes */
+#if DIN_DEPLOY_RSAKeyValue == SUPPORT_YES
 			case 49:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue) */
 				errn = decode_dinRSAKeyValueType(stream, &exiDoc->RSAKeyValue);
 				exiDoc->RSAKeyValue_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_RSAKeyValue */
+#if DIN_DEPLOY_Reference == SUPPORT_YES
 			case 50:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference) */
 				errn = decode_dinReferenceType(stream, &exiDoc->Reference);
 				exiDoc->Reference_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Reference */
+#if DIN_DEPLOY_RelativeTimeInterval == SUPPORT_YES
 			case 51:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}RelativeTimeInterval) */
 				errn = decode_dinRelativeTimeIntervalType(stream, &exiDoc->RelativeTimeInterval);
 				exiDoc->RelativeTimeInterval_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_RelativeTimeInterval */
+#if DIN_DEPLOY_RetrievalMethod == SUPPORT_YES
 			case 52:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod) */
 				errn = decode_dinRetrievalMethodType(stream, &exiDoc->RetrievalMethod);
 				exiDoc->RetrievalMethod_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_RetrievalMethod */
+#if DIN_DEPLOY_SAScheduleList == SUPPORT_YES
 			case 53:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SAScheduleList) */
 				errn = decode_dinSAScheduleListType(stream, &exiDoc->SAScheduleList);
 				exiDoc->SAScheduleList_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SAScheduleList */
+#if DIN_DEPLOY_SASchedules == SUPPORT_YES
 			case 54:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SASchedules) */
 				errn = decode_dinSASchedulesType(stream, &exiDoc->SASchedules);
 				exiDoc->SASchedules_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SASchedules */
+#if DIN_DEPLOY_SPKIData == SUPPORT_YES
 			case 55:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData) */
 				errn = decode_dinSPKIDataType(stream, &exiDoc->SPKIData);
 				exiDoc->SPKIData_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SPKIData */
+#if DIN_DEPLOY_SalesTariffEntry == SUPPORT_YES
 			case 56:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SalesTariffEntry) */
 				errn = decode_dinSalesTariffEntryType(stream, &exiDoc->SalesTariffEntry);
 				exiDoc->SalesTariffEntry_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SalesTariffEntry */
+#if DIN_DEPLOY_ServiceCharge == SUPPORT_YES
 			case 57:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ServiceCharge) */
 				errn = decode_dinServiceChargeType(stream, &exiDoc->ServiceCharge);
 				exiDoc->ServiceCharge_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServiceCharge */
+#if DIN_DEPLOY_ServiceDetailReq == SUPPORT_YES
 			case 58:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailReq) */
 				errn = decode_dinServiceDetailReqType(stream, &exiDoc->ServiceDetailReq);
 				exiDoc->ServiceDetailReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServiceDetailReq */
+#if DIN_DEPLOY_ServiceDetailRes == SUPPORT_YES
 			case 59:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailRes) */
 				errn = decode_dinServiceDetailResType(stream, &exiDoc->ServiceDetailRes);
 				exiDoc->ServiceDetailRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServiceDetailRes */
+#if DIN_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 			case 60:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryReq) */
 				errn = decode_dinServiceDiscoveryReqType(stream, &exiDoc->ServiceDiscoveryReq);
 				exiDoc->ServiceDiscoveryReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServiceDiscoveryReq */
+#if DIN_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 			case 61:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryRes) */
 				errn = decode_dinServiceDiscoveryResType(stream, &exiDoc->ServiceDiscoveryRes);
 				exiDoc->ServiceDiscoveryRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServiceDiscoveryRes */
+#if DIN_DEPLOY_ServicePaymentSelectionReq == SUPPORT_YES
 			case 62:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionReq) */
 				errn = decode_dinServicePaymentSelectionReqType(stream, &exiDoc->ServicePaymentSelectionReq);
 				exiDoc->ServicePaymentSelectionReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServicePaymentSelectionReq */
+#if DIN_DEPLOY_ServicePaymentSelectionRes == SUPPORT_YES
 			case 63:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionRes) */
 				errn = decode_dinServicePaymentSelectionResType(stream, &exiDoc->ServicePaymentSelectionRes);
 				exiDoc->ServicePaymentSelectionRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServicePaymentSelectionRes */
+#if DIN_DEPLOY_SessionSetupReq == SUPPORT_YES
 			case 64:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupReq) */
 				errn = decode_dinSessionSetupReqType(stream, &exiDoc->SessionSetupReq);
 				exiDoc->SessionSetupReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SessionSetupReq */
+#if DIN_DEPLOY_SessionSetupRes == SUPPORT_YES
 			case 65:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupRes) */
 				errn = decode_dinSessionSetupResType(stream, &exiDoc->SessionSetupRes);
 				exiDoc->SessionSetupRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SessionSetupRes */
+#if DIN_DEPLOY_SessionStopReq == SUPPORT_YES
 			case 66:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopReq) */
 				errn = decode_dinSessionStopType(stream, &exiDoc->SessionStopReq);
 				exiDoc->SessionStopReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SessionStopReq */
+#if DIN_DEPLOY_SessionStopRes == SUPPORT_YES
 			case 67:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopRes) */
 				errn = decode_dinSessionStopResType(stream, &exiDoc->SessionStopRes);
 				exiDoc->SessionStopRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SessionStopRes */
+#if DIN_DEPLOY_Signature == SUPPORT_YES
 			case 68:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature) */
 				errn = decode_dinSignatureType(stream, &exiDoc->Signature);
 				exiDoc->Signature_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Signature */
+#if DIN_DEPLOY_SignatureMethod == SUPPORT_YES
 			case 69:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod) */
 				errn = decode_dinSignatureMethodType(stream, &exiDoc->SignatureMethod);
 				exiDoc->SignatureMethod_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SignatureMethod */
+#if DIN_DEPLOY_SignatureProperties == SUPPORT_YES
 			case 70:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties) */
 				errn = decode_dinSignaturePropertiesType(stream, &exiDoc->SignatureProperties);
 				exiDoc->SignatureProperties_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SignatureProperties */
+#if DIN_DEPLOY_SignatureProperty == SUPPORT_YES
 			case 71:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty) */
 				errn = decode_dinSignaturePropertyType(stream, &exiDoc->SignatureProperty);
 				exiDoc->SignatureProperty_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SignatureProperty */
+#if DIN_DEPLOY_SignatureValue == SUPPORT_YES
 			case 72:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue) */
 				errn = decode_dinSignatureValueType(stream, &exiDoc->SignatureValue);
 				exiDoc->SignatureValue_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SignatureValue */
+#if DIN_DEPLOY_SignedInfo == SUPPORT_YES
 			case 73:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo) */
 				errn = decode_dinSignedInfoType(stream, &exiDoc->SignedInfo);
 				exiDoc->SignedInfo_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SignedInfo */
+#if DIN_DEPLOY_TimeInterval == SUPPORT_YES
 			case 74:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}TimeInterval) */
 				errn = decode_dinIntervalType(stream, &exiDoc->TimeInterval);
 				exiDoc->TimeInterval_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_TimeInterval */
+#if DIN_DEPLOY_Transform == SUPPORT_YES
 			case 75:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform) */
 				errn = decode_dinTransformType(stream, &exiDoc->Transform);
 				exiDoc->Transform_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Transform */
+#if DIN_DEPLOY_Transforms == SUPPORT_YES
 			case 76:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms) */
 				errn = decode_dinTransformsType(stream, &exiDoc->Transforms);
 				exiDoc->Transforms_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Transforms */
+#if DIN_DEPLOY_V2G_Message == SUPPORT_YES
 			case 77:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}V2G_Message) */
 				errn = decode_dinAnonType_V2G_Message(stream, &exiDoc->V2G_Message);
 				exiDoc->V2G_Message_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_V2G_Message */
+#if DIN_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 			case 78:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionReq) */
 				errn = decode_dinWeldingDetectionReqType(stream, &exiDoc->WeldingDetectionReq);
 				exiDoc->WeldingDetectionReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_WeldingDetectionReq */
+#if DIN_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 			case 79:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionRes) */
 				errn = decode_dinWeldingDetectionResType(stream, &exiDoc->WeldingDetectionRes);
 				exiDoc->WeldingDetectionRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_WeldingDetectionRes */
+#if DIN_DEPLOY_X509Data == SUPPORT_YES
 			case 80:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data) */
 				errn = decode_dinX509DataType(stream, &exiDoc->X509Data);
 				exiDoc->X509Data_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_X509Data */
 			default:
 				errn = EXI_ERROR_UNEXPECTED_EVENT_LEVEL1;
 				break;
@@ -14622,6 +19873,9 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 
 #if DEPLOY_DIN_CODEC_FRAGMENT == SUPPORT_YES
 int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	errn = readEXIHeader(stream);
 
 	if(errn == 0) {
@@ -14630,36 +19884,46 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 		errn = decodeNBitUnsignedInteger(stream, 8, &eventCode);
 		if(errn == 0) {
 			switch(eventCode) {
+#if DIN_DEPLOY_AC_EVChargeParameter == SUPPORT_YES
 			case 0:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVChargeParameter) */
 				errn = decode_dinAC_EVChargeParameterType(stream, &exiFrag->AC_EVChargeParameter);
 				exiFrag->AC_EVChargeParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_AC_EVChargeParameter */
+#if DIN_DEPLOY_AC_EVSEChargeParameter == SUPPORT_YES
 			case 1:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEChargeParameter) */
 				errn = decode_dinAC_EVSEChargeParameterType(stream, &exiFrag->AC_EVSEChargeParameter);
 				exiFrag->AC_EVSEChargeParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_AC_EVSEChargeParameter */
+#if DIN_DEPLOY_AC_EVSEStatus == SUPPORT_YES
 			case 2:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}AC_EVSEStatus) */
 				errn = decode_dinAC_EVSEStatusType(stream, &exiFrag->AC_EVSEStatus);
 				exiFrag->AC_EVSEStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_AC_EVSEStatus */
+#if DIN_DEPLOY_AC_EVSEStatus == SUPPORT_YES
 			case 3:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEStatus) */
 				errn = decode_dinAC_EVSEStatusType(stream, &exiFrag->AC_EVSEStatus);
 				exiFrag->AC_EVSEStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_AC_EVSEStatus */
 			case 4:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}Body) */
 				errn = decode_dinBodyType(stream, &exiFrag->Body);
 				exiFrag->Body_isUsed = 1u;
 				break;
+#if DIN_DEPLOY_BodyElement == SUPPORT_YES
 			case 5:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}BodyElement) */
 				errn = decode_dinBodyBaseType(stream, &exiFrag->BodyElement);
 				exiFrag->BodyElement_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_BodyElement */
 			case 6:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}BulkChargingComplete) */
 				/* FirstStartTag[CHARACTERS[BOOLEAN]] */
@@ -14703,21 +19967,27 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_CableCheckReq == SUPPORT_YES
 			case 9:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckReq) */
 				errn = decode_dinCableCheckReqType(stream, &exiFrag->CableCheckReq);
 				exiFrag->CableCheckReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CableCheckReq */
+#if DIN_DEPLOY_CableCheckRes == SUPPORT_YES
 			case 10:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckRes) */
 				errn = decode_dinCableCheckResType(stream, &exiFrag->CableCheckRes);
 				exiFrag->CableCheckRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CableCheckRes */
+#if DIN_DEPLOY_CanonicalizationMethod == SUPPORT_YES
 			case 11:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod) */
 				errn = decode_dinCanonicalizationMethodType(stream, &exiFrag->CanonicalizationMethod);
 				exiFrag->CanonicalizationMethod_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CanonicalizationMethod */
 			case 12:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Certificate) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -14729,7 +19999,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->Certificate.bytesLen) <= dinEXIFragment_Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->Certificate.bytes, exiFrag->Certificate.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->Certificate.bytesLen, exiFrag->Certificate.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->Certificate.bytesLen, exiFrag->Certificate.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->Certificate_isUsed = 1u;
 					} else {
@@ -14738,36 +20015,48 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 			case 13:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationReq) */
 				errn = decode_dinCertificateInstallationReqType(stream, &exiFrag->CertificateInstallationReq);
 				exiFrag->CertificateInstallationReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CertificateInstallationReq */
+#if DIN_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 			case 14:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationRes) */
 				errn = decode_dinCertificateInstallationResType(stream, &exiFrag->CertificateInstallationRes);
 				exiFrag->CertificateInstallationRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CertificateInstallationRes */
+#if DIN_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 			case 15:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateReq) */
 				errn = decode_dinCertificateUpdateReqType(stream, &exiFrag->CertificateUpdateReq);
 				exiFrag->CertificateUpdateReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CertificateUpdateReq */
+#if DIN_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 			case 16:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateRes) */
 				errn = decode_dinCertificateUpdateResType(stream, &exiFrag->CertificateUpdateRes);
 				exiFrag->CertificateUpdateRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CertificateUpdateRes */
+#if DIN_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 			case 17:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryReq) */
 				errn = decode_dinChargeParameterDiscoveryReqType(stream, &exiFrag->ChargeParameterDiscoveryReq);
 				exiFrag->ChargeParameterDiscoveryReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryReq */
+#if DIN_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 			case 18:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryRes) */
 				errn = decode_dinChargeParameterDiscoveryResType(stream, &exiFrag->ChargeParameterDiscoveryRes);
 				exiFrag->ChargeParameterDiscoveryRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryRes */
 			case 19:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeService) */
 				errn = decode_dinServiceChargeType(stream, &exiFrag->ChargeService);
@@ -14834,31 +20123,39 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_ChargingStatusReq == SUPPORT_YES
 			case 25:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusReq) */
 				errn = decode_dinChargingStatusReqType(stream, &exiFrag->ChargingStatusReq);
 				exiFrag->ChargingStatusReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ChargingStatusReq */
+#if DIN_DEPLOY_ChargingStatusRes == SUPPORT_YES
 			case 26:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusRes) */
 				errn = decode_dinChargingStatusResType(stream, &exiFrag->ChargingStatusRes);
 				exiFrag->ChargingStatusRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ChargingStatusRes */
 			case 27:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ConsumptionCost) */
 				errn = decode_dinConsumptionCostType(stream, &exiFrag->ConsumptionCost);
 				exiFrag->ConsumptionCost_isUsed = 1u;
 				break;
+#if DIN_DEPLOY_ContractAuthenticationReq == SUPPORT_YES
 			case 28:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationReq) */
 				errn = decode_dinContractAuthenticationReqType(stream, &exiFrag->ContractAuthenticationReq);
 				exiFrag->ContractAuthenticationReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ContractAuthenticationReq */
+#if DIN_DEPLOY_ContractAuthenticationRes == SUPPORT_YES
 			case 29:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationRes) */
 				errn = decode_dinContractAuthenticationResType(stream, &exiFrag->ContractAuthenticationRes);
 				exiFrag->ContractAuthenticationRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ContractAuthenticationRes */
 			case 30:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractID) */
 				/* FirstStartTag[CHARACTERS[STRING]] */
@@ -14869,10 +20166,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->ContractID.charactersLen >= 2) {
 								exiFrag->ContractID.charactersLen = (uint16_t)(exiFrag->ContractID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->ContractID.characters, CHARACTER_UNITS(exiFrag->ContractID.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->ContractID.charactersLen, exiFrag->ContractID.characters, dinEXIFragment_ContractID_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->ContractID.charactersLen, exiFrag->ContractID.characters, dinEXIFragment_ContractID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, exiFrag->ContractID.characters, exiFrag->ContractID.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, &exiFrag->ContractID.charactersLen, &exiFrag->ContractID.characters);
+#else
+								errn = decodeStringValueHit(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, &exiFrag->ContractID.charactersLen, exiFrag->ContractID.characters, dinEXIFragment_ContractID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->ContractID_isUsed = 1u;
@@ -14898,7 +20209,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->ContractSignatureEncryptedPrivateKey.bytesLen) <= dinEXIFragment_ContractSignatureEncryptedPrivateKey_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->ContractSignatureEncryptedPrivateKey.bytes, exiFrag->ContractSignatureEncryptedPrivateKey.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->ContractSignatureEncryptedPrivateKey.bytesLen, exiFrag->ContractSignatureEncryptedPrivateKey.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->ContractSignatureEncryptedPrivateKey.bytesLen, exiFrag->ContractSignatureEncryptedPrivateKey.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->ContractSignatureEncryptedPrivateKey_isUsed = 1u;
 					} else {
@@ -14912,51 +20230,69 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				errn = decode_dinCostType(stream, &exiFrag->Cost);
 				exiFrag->Cost_isUsed = 1u;
 				break;
+#if DIN_DEPLOY_CurrentDemandReq == SUPPORT_YES
 			case 34:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandReq) */
 				errn = decode_dinCurrentDemandReqType(stream, &exiFrag->CurrentDemandReq);
 				exiFrag->CurrentDemandReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CurrentDemandReq */
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
 			case 35:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandRes) */
 				errn = decode_dinCurrentDemandResType(stream, &exiFrag->CurrentDemandRes);
 				exiFrag->CurrentDemandRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_CurrentDemandRes */
+#if DIN_DEPLOY_DC_EVChargeParameter == SUPPORT_YES
 			case 36:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVChargeParameter) */
 				errn = decode_dinDC_EVChargeParameterType(stream, &exiFrag->DC_EVChargeParameter);
 				exiFrag->DC_EVChargeParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DC_EVChargeParameter */
+#if DIN_DEPLOY_DC_EVPowerDeliveryParameter == SUPPORT_YES
 			case 37:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVPowerDeliveryParameter) */
 				errn = decode_dinDC_EVPowerDeliveryParameterType(stream, &exiFrag->DC_EVPowerDeliveryParameter);
 				exiFrag->DC_EVPowerDeliveryParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DC_EVPowerDeliveryParameter */
+#if DIN_DEPLOY_DC_EVSEChargeParameter == SUPPORT_YES
 			case 38:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEChargeParameter) */
 				errn = decode_dinDC_EVSEChargeParameterType(stream, &exiFrag->DC_EVSEChargeParameter);
 				exiFrag->DC_EVSEChargeParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DC_EVSEChargeParameter */
+#if DIN_DEPLOY_DC_EVSEStatus == SUPPORT_YES
 			case 39:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}DC_EVSEStatus) */
 				errn = decode_dinDC_EVSEStatusType(stream, &exiFrag->DC_EVSEStatus);
 				exiFrag->DC_EVSEStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DC_EVSEStatus */
+#if DIN_DEPLOY_DC_EVSEStatus == SUPPORT_YES
 			case 40:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEStatus) */
 				errn = decode_dinDC_EVSEStatusType(stream, &exiFrag->DC_EVSEStatus);
 				exiFrag->DC_EVSEStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DC_EVSEStatus */
+#if DIN_DEPLOY_DC_EVStatus == SUPPORT_YES
 			case 41:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}DC_EVStatus) */
 				errn = decode_dinDC_EVStatusType(stream, &exiFrag->DC_EVStatus);
 				exiFrag->DC_EVStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DC_EVStatus */
+#if DIN_DEPLOY_DC_EVStatus == SUPPORT_YES
 			case 42:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVStatus) */
 				errn = decode_dinDC_EVStatusType(stream, &exiFrag->DC_EVStatus);
 				exiFrag->DC_EVStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DC_EVStatus */
 			case 43:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}DHParams) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -14968,7 +20304,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->DHParams.bytesLen) <= dinEXIFragment_DHParams_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->DHParams.bytes, exiFrag->DHParams.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->DHParams.bytesLen, exiFrag->DHParams.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->DHParams.bytesLen, exiFrag->DHParams.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->DHParams_isUsed = 1u;
 					} else {
@@ -14977,11 +20320,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_DSAKeyValue == SUPPORT_YES
 			case 44:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue) */
 				errn = decode_dinDSAKeyValueType(stream, &exiFrag->DSAKeyValue);
 				exiFrag->DSAKeyValue_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DSAKeyValue */
 			case 45:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}DateTimeNow) */
 				/* First(xsi:type)StartTag[CHARACTERS[INTEGER]] */
@@ -15010,11 +20355,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_DigestMethod == SUPPORT_YES
 			case 47:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod) */
 				errn = decode_dinDigestMethodType(stream, &exiFrag->DigestMethod);
 				exiFrag->DigestMethod_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_DigestMethod */
 			case 48:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -15026,7 +20373,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->DigestValue.bytesLen) <= dinEXIFragment_DigestValue_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->DigestValue.bytes, exiFrag->DigestValue.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->DigestValue.bytesLen, exiFrag->DigestValue.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->DigestValue.bytesLen, exiFrag->DigestValue.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->DigestValue_isUsed = 1u;
 					} else {
@@ -15089,11 +20443,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_EVChargeParameter == SUPPORT_YES
 			case 53:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVChargeParameter) */
 				errn = decode_dinEVChargeParameterType(stream, &exiFrag->EVChargeParameter);
 				exiFrag->EVChargeParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_EVChargeParameter */
 			case 54:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVEnergyCapacity) */
 				errn = decode_dinPhysicalValueType(stream, &exiFrag->EVEnergyCapacity);
@@ -15164,11 +20520,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				errn = decode_dinPhysicalValueType(stream, &exiFrag->EVMinCurrent);
 				exiFrag->EVMinCurrent_isUsed = 1u;
 				break;
+#if DIN_DEPLOY_EVPowerDeliveryParameter == SUPPORT_YES
 			case 66:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVPowerDeliveryParameter) */
 				errn = decode_dinEVPowerDeliveryParameterType(stream, &exiFrag->EVPowerDeliveryParameter);
 				exiFrag->EVPowerDeliveryParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_EVPowerDeliveryParameter */
 			case 67:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVRESSConditioning) */
 				/* FirstStartTag[CHARACTERS[BOOLEAN]] */
@@ -15227,11 +20585,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_EVSEChargeParameter == SUPPORT_YES
 			case 71:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEChargeParameter) */
 				errn = decode_dinEVSEChargeParameterType(stream, &exiFrag->EVSEChargeParameter);
 				exiFrag->EVSEChargeParameter_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_EVSEChargeParameter */
 			case 72:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSECurrentLimitAchieved) */
 				/* FirstStartTag[CHARACTERS[BOOLEAN]] */
@@ -15410,11 +20770,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_EVSEStatus == SUPPORT_YES
 			case 95:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEStatus) */
 				errn = decode_dinEVSEStatusType(stream, &exiFrag->EVSEStatus);
 				exiFrag->EVSEStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_EVSEStatus */
 			case 96:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEStatusCode) */
 				/* FirstStartTag[CHARACTERS[ENUMERATION]] */
@@ -15444,11 +20806,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_EVStatus == SUPPORT_YES
 			case 98:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVStatus) */
 				errn = decode_dinEVStatusType(stream, &exiFrag->EVStatus);
 				exiFrag->EVStatus_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_EVStatus */
 			case 99:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVTargetCurrent) */
 				errn = decode_dinPhysicalValueType(stream, &exiFrag->EVTargetCurrent);
@@ -15474,11 +20838,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_Entry == SUPPORT_YES
 			case 102:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Entry) */
 				errn = decode_dinEntryType(stream, &exiFrag->Entry);
 				exiFrag->Entry_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Entry */
 			case 103:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Exponent) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -15490,7 +20856,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->Exponent.bytesLen) <= dinEXIFragment_Exponent_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->Exponent.bytes, exiFrag->Exponent.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->Exponent.bytesLen, exiFrag->Exponent.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->Exponent.bytesLen, exiFrag->Exponent.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->Exponent_isUsed = 1u;
 					} else {
@@ -15524,10 +20897,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->FaultMsg.charactersLen >= 2) {
 								exiFrag->FaultMsg.charactersLen = (uint16_t)(exiFrag->FaultMsg.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->FaultMsg.characters, CHARACTER_UNITS(exiFrag->FaultMsg.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->FaultMsg.charactersLen, exiFrag->FaultMsg.characters, dinEXIFragment_FaultMsg_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->FaultMsg.charactersLen, exiFrag->FaultMsg.characters, dinEXIFragment_FaultMsg_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 16 /* {urn:iso:15118:2:2010:MsgDataTypes}FaultMsg */, exiFrag->FaultMsg.characters, exiFrag->FaultMsg.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 16 /* {urn:iso:15118:2:2010:MsgDataTypes}FaultMsg */, &exiFrag->FaultMsg.charactersLen, &exiFrag->FaultMsg.characters);
+#else
+								errn = decodeStringValueHit(stream, 16 /* {urn:iso:15118:2:2010:MsgDataTypes}FaultMsg */, &exiFrag->FaultMsg.charactersLen, exiFrag->FaultMsg.characters, dinEXIFragment_FaultMsg_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->FaultMsg_isUsed = 1u;
@@ -15577,7 +20964,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->G.bytesLen) <= dinEXIFragment_G_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->G.bytes, exiFrag->G.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->G.bytesLen, exiFrag->G.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->G.bytesLen, exiFrag->G.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->G_isUsed = 1u;
 					} else {
@@ -15596,10 +20990,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->GenChallenge.charactersLen >= 2) {
 								exiFrag->GenChallenge.charactersLen = (uint16_t)(exiFrag->GenChallenge.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->GenChallenge.characters, CHARACTER_UNITS(exiFrag->GenChallenge.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->GenChallenge.charactersLen, exiFrag->GenChallenge.characters, dinEXIFragment_GenChallenge_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->GenChallenge.charactersLen, exiFrag->GenChallenge.characters, dinEXIFragment_GenChallenge_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, exiFrag->GenChallenge.characters, exiFrag->GenChallenge.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, &exiFrag->GenChallenge.charactersLen, &exiFrag->GenChallenge.characters);
+#else
+								errn = decodeStringValueHit(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, &exiFrag->GenChallenge.charactersLen, exiFrag->GenChallenge.characters, dinEXIFragment_GenChallenge_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->GenChallenge_isUsed = 1u;
@@ -15639,7 +21047,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->J.bytesLen) <= dinEXIFragment_J_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->J.bytes, exiFrag->J.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->J.bytesLen, exiFrag->J.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->J.bytesLen, exiFrag->J.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->J_isUsed = 1u;
 					} else {
@@ -15648,11 +21063,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_KeyInfo == SUPPORT_YES
 			case 113:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo) */
 				errn = decode_dinKeyInfoType(stream, &exiFrag->KeyInfo);
 				exiFrag->KeyInfo_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_KeyInfo */
 			case 114:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName) */
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
@@ -15663,10 +21080,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->KeyName.charactersLen >= 2) {
 								exiFrag->KeyName.charactersLen = (uint16_t)(exiFrag->KeyName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->KeyName.characters, CHARACTER_UNITS(exiFrag->KeyName.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->KeyName.charactersLen, exiFrag->KeyName.characters, dinEXIFragment_KeyName_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->KeyName.charactersLen, exiFrag->KeyName.characters, dinEXIFragment_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiFrag->KeyName.characters, exiFrag->KeyName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &exiFrag->KeyName.charactersLen, &exiFrag->KeyName.characters);
+#else
+								errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &exiFrag->KeyName.charactersLen, exiFrag->KeyName.characters, dinEXIFragment_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->KeyName_isUsed = 1u;
@@ -15676,21 +21107,25 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_KeyValue == SUPPORT_YES
 			case 115:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue) */
 				errn = decode_dinKeyValueType(stream, &exiFrag->KeyValue);
 				exiFrag->KeyValue_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_KeyValue */
 			case 116:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ListOfRootCertificateIDs) */
 				errn = decode_dinListOfRootCertificateIDsType(stream, &exiFrag->ListOfRootCertificateIDs);
 				exiFrag->ListOfRootCertificateIDs_isUsed = 1u;
 				break;
+#if DIN_DEPLOY_Manifest == SUPPORT_YES
 			case 117:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest) */
 				errn = decode_dinManifestType(stream, &exiFrag->Manifest);
 				exiFrag->Manifest_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Manifest */
 			case 118:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}MeterID) */
 				/* FirstStartTag[CHARACTERS[STRING]] */
@@ -15701,10 +21136,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->MeterID.charactersLen >= 2) {
 								exiFrag->MeterID.charactersLen = (uint16_t)(exiFrag->MeterID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->MeterID.characters, CHARACTER_UNITS(exiFrag->MeterID.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->MeterID.charactersLen, exiFrag->MeterID.characters, dinEXIFragment_MeterID_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->MeterID.charactersLen, exiFrag->MeterID.characters, dinEXIFragment_MeterID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 17 /* {urn:iso:15118:2:2010:MsgDataTypes}MeterID */, exiFrag->MeterID.characters, exiFrag->MeterID.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 17 /* {urn:iso:15118:2:2010:MsgDataTypes}MeterID */, &exiFrag->MeterID.charactersLen, &exiFrag->MeterID.characters);
+#else
+								errn = decodeStringValueHit(stream, 17 /* {urn:iso:15118:2:2010:MsgDataTypes}MeterID */, &exiFrag->MeterID.charactersLen, exiFrag->MeterID.characters, dinEXIFragment_MeterID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->MeterID_isUsed = 1u;
@@ -15738,16 +21187,20 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 			case 122:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptReq) */
 				errn = decode_dinMeteringReceiptReqType(stream, &exiFrag->MeteringReceiptReq);
 				exiFrag->MeteringReceiptReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_MeteringReceiptReq */
+#if DIN_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 			case 123:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptRes) */
 				errn = decode_dinMeteringReceiptResType(stream, &exiFrag->MeteringReceiptRes);
 				exiFrag->MeteringReceiptRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_MeteringReceiptRes */
 			case 124:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData) */
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
@@ -15758,10 +21211,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->MgmtData.charactersLen >= 2) {
 								exiFrag->MgmtData.charactersLen = (uint16_t)(exiFrag->MgmtData.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->MgmtData.characters, CHARACTER_UNITS(exiFrag->MgmtData.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->MgmtData.charactersLen, exiFrag->MgmtData.characters, dinEXIFragment_MgmtData_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->MgmtData.charactersLen, exiFrag->MgmtData.characters, dinEXIFragment_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiFrag->MgmtData.characters, exiFrag->MgmtData.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &exiFrag->MgmtData.charactersLen, &exiFrag->MgmtData.characters);
+#else
+								errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &exiFrag->MgmtData.charactersLen, exiFrag->MgmtData.characters, dinEXIFragment_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->MgmtData_isUsed = 1u;
@@ -15782,7 +21249,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->Modulus.bytesLen) <= dinEXIFragment_Modulus_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->Modulus.bytes, exiFrag->Modulus.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->Modulus.bytesLen, exiFrag->Modulus.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->Modulus.bytesLen, exiFrag->Modulus.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->Modulus_isUsed = 1u;
 					} else {
@@ -15851,7 +21325,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->OEMProvisioningCert.bytesLen) <= dinEXIFragment_OEMProvisioningCert_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->OEMProvisioningCert.bytes, exiFrag->OEMProvisioningCert.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->OEMProvisioningCert.bytesLen, exiFrag->OEMProvisioningCert.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->OEMProvisioningCert.bytesLen, exiFrag->OEMProvisioningCert.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->OEMProvisioningCert_isUsed = 1u;
 					} else {
@@ -15860,11 +21341,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_Object == SUPPORT_YES
 			case 131:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object) */
 				errn = decode_dinObjectType(stream, &exiFrag->Object);
 				exiFrag->Object_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Object */
 			case 132:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}P) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -15876,7 +21359,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->P.bytesLen) <= dinEXIFragment_P_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->P.bytes, exiFrag->P.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->P.bytesLen, exiFrag->P.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->P.bytesLen, exiFrag->P.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->P_isUsed = 1u;
 					} else {
@@ -15885,11 +21375,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_PGPData == SUPPORT_YES
 			case 133:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData) */
 				errn = decode_dinPGPDataType(stream, &exiFrag->PGPData);
 				exiFrag->PGPData_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PGPData */
 			case 134:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyID) */
 				/* First(xsi:type)StartTag[CHARACTERS[BINARY_BASE64]] */
@@ -15901,7 +21393,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->PGPKeyID.bytesLen) <= dinEXIFragment_PGPKeyID_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->PGPKeyID.bytes, exiFrag->PGPKeyID.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->PGPKeyID.bytesLen, exiFrag->PGPKeyID.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->PGPKeyID.bytesLen, exiFrag->PGPKeyID.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->PGPKeyID_isUsed = 1u;
 					} else {
@@ -15921,7 +21420,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->PGPKeyPacket.bytesLen) <= dinEXIFragment_PGPKeyPacket_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->PGPKeyPacket.bytes, exiFrag->PGPKeyPacket.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->PGPKeyPacket.bytesLen, exiFrag->PGPKeyPacket.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->PGPKeyPacket.bytesLen, exiFrag->PGPKeyPacket.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->PGPKeyPacket_isUsed = 1u;
 					} else {
@@ -15949,11 +21455,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				errn = decode_dinPMaxScheduleType(stream, &exiFrag->PMaxSchedule);
 				exiFrag->PMaxSchedule_isUsed = 1u;
 				break;
+#if DIN_DEPLOY_PMaxScheduleEntry == SUPPORT_YES
 			case 138:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PMaxScheduleEntry) */
 				errn = decode_dinPMaxScheduleEntryType(stream, &exiFrag->PMaxScheduleEntry);
 				exiFrag->PMaxScheduleEntry_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PMaxScheduleEntry */
 			case 139:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PMaxScheduleID) */
 				/* FirstStartTag[CHARACTERS[INTEGER]] */
@@ -15992,16 +21500,20 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 			case 143:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsReq) */
 				errn = decode_dinPaymentDetailsReqType(stream, &exiFrag->PaymentDetailsReq);
 				exiFrag->PaymentDetailsReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PaymentDetailsReq */
+#if DIN_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 			case 144:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsRes) */
 				errn = decode_dinPaymentDetailsResType(stream, &exiFrag->PaymentDetailsRes);
 				exiFrag->PaymentDetailsRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PaymentDetailsRes */
 			case 145:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PaymentOption) */
 				/* FirstStartTag[CHARACTERS[ENUMERATION]] */
@@ -16033,7 +21545,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->PgenCounter.bytesLen) <= dinEXIFragment_PgenCounter_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->PgenCounter.bytes, exiFrag->PgenCounter.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->PgenCounter.bytesLen, exiFrag->PgenCounter.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->PgenCounter.bytesLen, exiFrag->PgenCounter.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->PgenCounter_isUsed = 1u;
 					} else {
@@ -16042,16 +21561,20 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 			case 148:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryReq) */
 				errn = decode_dinPowerDeliveryReqType(stream, &exiFrag->PowerDeliveryReq);
 				exiFrag->PowerDeliveryReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PowerDeliveryReq */
+#if DIN_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 			case 149:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryRes) */
 				errn = decode_dinPowerDeliveryResType(stream, &exiFrag->PowerDeliveryRes);
 				exiFrag->PowerDeliveryRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PowerDeliveryRes */
 			case 150:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PowerSwitchClosed) */
 				/* FirstStartTag[CHARACTERS[BOOLEAN]] */
@@ -16066,16 +21589,20 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_PreChargeReq == SUPPORT_YES
 			case 151:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeReq) */
 				errn = decode_dinPreChargeReqType(stream, &exiFrag->PreChargeReq);
 				exiFrag->PreChargeReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PreChargeReq */
+#if DIN_DEPLOY_PreChargeRes == SUPPORT_YES
 			case 152:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeRes) */
 				errn = decode_dinPreChargeResType(stream, &exiFrag->PreChargeRes);
 				exiFrag->PreChargeRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_PreChargeRes */
 			case 153:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ProfileEntry) */
 				errn = decode_dinProfileEntryType(stream, &exiFrag->ProfileEntry);
@@ -16092,7 +21619,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->Q.bytesLen) <= dinEXIFragment_Q_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->Q.bytes, exiFrag->Q.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->Q.bytesLen, exiFrag->Q.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->Q.bytesLen, exiFrag->Q.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->Q_isUsed = 1u;
 					} else {
@@ -16115,11 +21649,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_RSAKeyValue == SUPPORT_YES
 			case 156:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue) */
 				errn = decode_dinRSAKeyValueType(stream, &exiFrag->RSAKeyValue);
 				exiFrag->RSAKeyValue_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_RSAKeyValue */
 			case 157:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ReadyToChargeState) */
 				/* FirstStartTag[CHARACTERS[BOOLEAN]] */
@@ -16148,16 +21684,20 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_Reference == SUPPORT_YES
 			case 159:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference) */
 				errn = decode_dinReferenceType(stream, &exiFrag->Reference);
 				exiFrag->Reference_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Reference */
+#if DIN_DEPLOY_RelativeTimeInterval == SUPPORT_YES
 			case 160:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}RelativeTimeInterval) */
 				errn = decode_dinRelativeTimeIntervalType(stream, &exiFrag->RelativeTimeInterval);
 				exiFrag->RelativeTimeInterval_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_RelativeTimeInterval */
 			case 161:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}RemainingTimeToBulkSoC) */
 				errn = decode_dinPhysicalValueType(stream, &exiFrag->RemainingTimeToBulkSoC);
@@ -16183,11 +21723,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_RetrievalMethod == SUPPORT_YES
 			case 164:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod) */
 				errn = decode_dinRetrievalMethodType(stream, &exiFrag->RetrievalMethod);
 				exiFrag->RetrievalMethod_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_RetrievalMethod */
 			case 165:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}RetryCounter) */
 				/* First(xsi:type)StartTag[CHARACTERS[INTEGER]] */
@@ -16212,10 +21754,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->RootCertificateID.charactersLen >= 2) {
 								exiFrag->RootCertificateID.charactersLen = (uint16_t)(exiFrag->RootCertificateID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->RootCertificateID.characters, CHARACTER_UNITS(exiFrag->RootCertificateID.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->RootCertificateID.charactersLen, exiFrag->RootCertificateID.characters, dinEXIFragment_RootCertificateID_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->RootCertificateID.charactersLen, exiFrag->RootCertificateID.characters, dinEXIFragment_RootCertificateID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, exiFrag->RootCertificateID.characters, exiFrag->RootCertificateID.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, &exiFrag->RootCertificateID.charactersLen, &exiFrag->RootCertificateID.characters);
+#else
+								errn = decodeStringValueHit(stream, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, &exiFrag->RootCertificateID.charactersLen, exiFrag->RootCertificateID.characters, dinEXIFragment_RootCertificateID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->RootCertificateID_isUsed = 1u;
@@ -16225,11 +21781,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_SAScheduleList == SUPPORT_YES
 			case 167:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SAScheduleList) */
 				errn = decode_dinSAScheduleListType(stream, &exiFrag->SAScheduleList);
 				exiFrag->SAScheduleList_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SAScheduleList */
 			case 168:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SAScheduleTuple) */
 				errn = decode_dinSAScheduleTupleType(stream, &exiFrag->SAScheduleTuple);
@@ -16263,16 +21821,20 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_SASchedules == SUPPORT_YES
 			case 171:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SASchedules) */
 				errn = decode_dinSASchedulesType(stream, &exiFrag->SASchedules);
 				exiFrag->SASchedules_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SASchedules */
+#if DIN_DEPLOY_SPKIData == SUPPORT_YES
 			case 172:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData) */
 				errn = decode_dinSPKIDataType(stream, &exiFrag->SPKIData);
 				exiFrag->SPKIData_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SPKIData */
 			case 173:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKISexp) */
 				/* First(xsi:type)StartTag[CHARACTERS[BINARY_BASE64]] */
@@ -16284,7 +21846,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->SPKISexp.bytesLen) <= dinEXIFragment_SPKISexp_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->SPKISexp.bytes, exiFrag->SPKISexp.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->SPKISexp.bytesLen, exiFrag->SPKISexp.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->SPKISexp.bytesLen, exiFrag->SPKISexp.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->SPKISexp_isUsed = 1u;
 					} else {
@@ -16308,10 +21877,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->SalesTariffDescription.charactersLen >= 2) {
 								exiFrag->SalesTariffDescription.charactersLen = (uint16_t)(exiFrag->SalesTariffDescription.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->SalesTariffDescription.characters, CHARACTER_UNITS(exiFrag->SalesTariffDescription.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->SalesTariffDescription.charactersLen, exiFrag->SalesTariffDescription.characters, dinEXIFragment_SalesTariffDescription_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->SalesTariffDescription.charactersLen, exiFrag->SalesTariffDescription.characters, dinEXIFragment_SalesTariffDescription_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 19 /* {urn:iso:15118:2:2010:MsgDataTypes}SalesTariffDescription */, exiFrag->SalesTariffDescription.characters, exiFrag->SalesTariffDescription.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 19 /* {urn:iso:15118:2:2010:MsgDataTypes}SalesTariffDescription */, &exiFrag->SalesTariffDescription.charactersLen, &exiFrag->SalesTariffDescription.characters);
+#else
+								errn = decodeStringValueHit(stream, 19 /* {urn:iso:15118:2:2010:MsgDataTypes}SalesTariffDescription */, &exiFrag->SalesTariffDescription.charactersLen, exiFrag->SalesTariffDescription.characters, dinEXIFragment_SalesTariffDescription_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->SalesTariffDescription_isUsed = 1u;
@@ -16321,11 +21904,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_SalesTariffEntry == SUPPORT_YES
 			case 176:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SalesTariffEntry) */
 				errn = decode_dinSalesTariffEntryType(stream, &exiFrag->SalesTariffEntry);
 				exiFrag->SalesTariffEntry_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SalesTariffEntry */
 			case 177:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SalesTariffID) */
 				/* FirstStartTag[CHARACTERS[INTEGER]] */
@@ -16351,7 +21936,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->Seed.bytesLen) <= dinEXIFragment_Seed_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->Seed.bytes, exiFrag->Seed.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->Seed.bytesLen, exiFrag->Seed.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->Seed.bytesLen, exiFrag->Seed.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->Seed_isUsed = 1u;
 					} else {
@@ -16420,31 +22012,41 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_ServiceCharge == SUPPORT_YES
 			case 185:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ServiceCharge) */
 				errn = decode_dinServiceChargeType(stream, &exiFrag->ServiceCharge);
 				exiFrag->ServiceCharge_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServiceCharge */
+#if DIN_DEPLOY_ServiceDetailReq == SUPPORT_YES
 			case 186:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailReq) */
 				errn = decode_dinServiceDetailReqType(stream, &exiFrag->ServiceDetailReq);
 				exiFrag->ServiceDetailReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServiceDetailReq */
+#if DIN_DEPLOY_ServiceDetailRes == SUPPORT_YES
 			case 187:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailRes) */
 				errn = decode_dinServiceDetailResType(stream, &exiFrag->ServiceDetailRes);
 				exiFrag->ServiceDetailRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServiceDetailRes */
+#if DIN_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 			case 188:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryReq) */
 				errn = decode_dinServiceDiscoveryReqType(stream, &exiFrag->ServiceDiscoveryReq);
 				exiFrag->ServiceDiscoveryReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServiceDiscoveryReq */
+#if DIN_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 			case 189:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryRes) */
 				errn = decode_dinServiceDiscoveryResType(stream, &exiFrag->ServiceDiscoveryRes);
 				exiFrag->ServiceDiscoveryRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServiceDiscoveryRes */
 			case 190:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceID) */
 				/* FirstStartTag[CHARACTERS[UNSIGNED_INTEGER]] */
@@ -16488,10 +22090,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->ServiceName.charactersLen >= 2) {
 								exiFrag->ServiceName.charactersLen = (uint16_t)(exiFrag->ServiceName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->ServiceName.characters, CHARACTER_UNITS(exiFrag->ServiceName.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->ServiceName.charactersLen, exiFrag->ServiceName.characters, dinEXIFragment_ServiceName_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->ServiceName.charactersLen, exiFrag->ServiceName.characters, dinEXIFragment_ServiceName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 20 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceName */, exiFrag->ServiceName.characters, exiFrag->ServiceName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 20 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceName */, &exiFrag->ServiceName.charactersLen, &exiFrag->ServiceName.characters);
+#else
+								errn = decodeStringValueHit(stream, 20 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceName */, &exiFrag->ServiceName.charactersLen, exiFrag->ServiceName.characters, dinEXIFragment_ServiceName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->ServiceName_isUsed = 1u;
@@ -16506,16 +22122,20 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				errn = decode_dinServiceParameterListType(stream, &exiFrag->ServiceParameterList);
 				exiFrag->ServiceParameterList_isUsed = 1u;
 				break;
+#if DIN_DEPLOY_ServicePaymentSelectionReq == SUPPORT_YES
 			case 195:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionReq) */
 				errn = decode_dinServicePaymentSelectionReqType(stream, &exiFrag->ServicePaymentSelectionReq);
 				exiFrag->ServicePaymentSelectionReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServicePaymentSelectionReq */
+#if DIN_DEPLOY_ServicePaymentSelectionRes == SUPPORT_YES
 			case 196:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionRes) */
 				errn = decode_dinServicePaymentSelectionResType(stream, &exiFrag->ServicePaymentSelectionRes);
 				exiFrag->ServicePaymentSelectionRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_ServicePaymentSelectionRes */
 			case 197:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceScope) */
 				/* FirstStartTag[CHARACTERS[STRING]] */
@@ -16526,10 +22146,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->ServiceScope.charactersLen >= 2) {
 								exiFrag->ServiceScope.charactersLen = (uint16_t)(exiFrag->ServiceScope.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->ServiceScope.characters, CHARACTER_UNITS(exiFrag->ServiceScope.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->ServiceScope.charactersLen, exiFrag->ServiceScope.characters, dinEXIFragment_ServiceScope_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->ServiceScope.charactersLen, exiFrag->ServiceScope.characters, dinEXIFragment_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 15 /* {urn:iso:15118:2:2010:MsgBody}ServiceScope */, exiFrag->ServiceScope.characters, exiFrag->ServiceScope.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 15 /* {urn:iso:15118:2:2010:MsgBody}ServiceScope */, &exiFrag->ServiceScope.charactersLen, &exiFrag->ServiceScope.characters);
+#else
+								errn = decodeStringValueHit(stream, 15 /* {urn:iso:15118:2:2010:MsgBody}ServiceScope */, &exiFrag->ServiceScope.charactersLen, exiFrag->ServiceScope.characters, dinEXIFragment_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->ServiceScope_isUsed = 1u;
@@ -16549,10 +22183,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->ServiceScope.charactersLen >= 2) {
 								exiFrag->ServiceScope.charactersLen = (uint16_t)(exiFrag->ServiceScope.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->ServiceScope.characters, CHARACTER_UNITS(exiFrag->ServiceScope.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->ServiceScope.charactersLen, exiFrag->ServiceScope.characters, dinEXIFragment_ServiceScope_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->ServiceScope.charactersLen, exiFrag->ServiceScope.characters, dinEXIFragment_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 21 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceScope */, exiFrag->ServiceScope.characters, exiFrag->ServiceScope.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 21 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceScope */, &exiFrag->ServiceScope.charactersLen, &exiFrag->ServiceScope.characters);
+#else
+								errn = decodeStringValueHit(stream, 21 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceScope */, &exiFrag->ServiceScope.charactersLen, exiFrag->ServiceScope.characters, dinEXIFragment_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->ServiceScope_isUsed = 1u;
@@ -16607,26 +22255,34 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_SessionSetupReq == SUPPORT_YES
 			case 202:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupReq) */
 				errn = decode_dinSessionSetupReqType(stream, &exiFrag->SessionSetupReq);
 				exiFrag->SessionSetupReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SessionSetupReq */
+#if DIN_DEPLOY_SessionSetupRes == SUPPORT_YES
 			case 203:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupRes) */
 				errn = decode_dinSessionSetupResType(stream, &exiFrag->SessionSetupRes);
 				exiFrag->SessionSetupRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SessionSetupRes */
+#if DIN_DEPLOY_SessionStopReq == SUPPORT_YES
 			case 204:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopReq) */
 				errn = decode_dinSessionStopType(stream, &exiFrag->SessionStopReq);
 				exiFrag->SessionStopReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SessionStopReq */
+#if DIN_DEPLOY_SessionStopRes == SUPPORT_YES
 			case 205:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopRes) */
 				errn = decode_dinSessionStopResType(stream, &exiFrag->SessionStopRes);
 				exiFrag->SessionStopRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SessionStopRes */
 			case 206:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SigMeterReading) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -16647,36 +22303,48 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_Signature == SUPPORT_YES
 			case 207:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature) */
 				errn = decode_dinSignatureType(stream, &exiFrag->Signature);
 				exiFrag->Signature_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Signature */
+#if DIN_DEPLOY_SignatureMethod == SUPPORT_YES
 			case 208:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod) */
 				errn = decode_dinSignatureMethodType(stream, &exiFrag->SignatureMethod);
 				exiFrag->SignatureMethod_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SignatureMethod */
+#if DIN_DEPLOY_SignatureProperties == SUPPORT_YES
 			case 209:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties) */
 				errn = decode_dinSignaturePropertiesType(stream, &exiFrag->SignatureProperties);
 				exiFrag->SignatureProperties_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SignatureProperties */
+#if DIN_DEPLOY_SignatureProperty == SUPPORT_YES
 			case 210:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty) */
 				errn = decode_dinSignaturePropertyType(stream, &exiFrag->SignatureProperty);
 				exiFrag->SignatureProperty_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SignatureProperty */
+#if DIN_DEPLOY_SignatureValue == SUPPORT_YES
 			case 211:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue) */
 				errn = decode_dinSignatureValueType(stream, &exiFrag->SignatureValue);
 				exiFrag->SignatureValue_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SignatureValue */
+#if DIN_DEPLOY_SignedInfo == SUPPORT_YES
 			case 212:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo) */
 				errn = decode_dinSignedInfoType(stream, &exiFrag->SignedInfo);
 				exiFrag->SignedInfo_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_SignedInfo */
 			case 213:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SubCertificates) */
 				errn = decode_dinSubCertificatesType(stream, &exiFrag->SubCertificates);
@@ -16696,21 +22364,27 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_TimeInterval == SUPPORT_YES
 			case 215:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}TimeInterval) */
 				errn = decode_dinIntervalType(stream, &exiFrag->TimeInterval);
 				exiFrag->TimeInterval_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_TimeInterval */
+#if DIN_DEPLOY_Transform == SUPPORT_YES
 			case 216:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform) */
 				errn = decode_dinTransformType(stream, &exiFrag->Transform);
 				exiFrag->Transform_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Transform */
+#if DIN_DEPLOY_Transforms == SUPPORT_YES
 			case 217:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms) */
 				errn = decode_dinTransformsType(stream, &exiFrag->Transforms);
 				exiFrag->Transforms_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_Transforms */
 			case 218:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Unit) */
 				/* FirstStartTag[CHARACTERS[ENUMERATION]] */
@@ -16726,11 +22400,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_V2G_Message == SUPPORT_YES
 			case 219:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}V2G_Message) */
 				errn = decode_dinAnonType_V2G_Message(stream, &exiFrag->V2G_Message);
 				exiFrag->V2G_Message_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_V2G_Message */
 			case 220:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Value) */
 				/* First(xsi:type)StartTag[CHARACTERS[INTEGER]] */
@@ -16745,16 +22421,20 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 			case 221:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionReq) */
 				errn = decode_dinWeldingDetectionReqType(stream, &exiFrag->WeldingDetectionReq);
 				exiFrag->WeldingDetectionReq_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_WeldingDetectionReq */
+#if DIN_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 			case 222:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionRes) */
 				errn = decode_dinWeldingDetectionResType(stream, &exiFrag->WeldingDetectionRes);
 				exiFrag->WeldingDetectionRes_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_WeldingDetectionRes */
 			case 223:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509CRL) */
 				/* First(xsi:type)StartTag[CHARACTERS[BINARY_BASE64]] */
@@ -16766,7 +22446,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->X509CRL.bytesLen) <= dinEXIFragment_X509CRL_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->X509CRL.bytes, exiFrag->X509CRL.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->X509CRL.bytesLen, exiFrag->X509CRL.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->X509CRL.bytesLen, exiFrag->X509CRL.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->X509CRL_isUsed = 1u;
 					} else {
@@ -16786,7 +22473,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->X509Certificate.bytesLen) <= dinEXIFragment_X509Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->X509Certificate.bytes, exiFrag->X509Certificate.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->X509Certificate.bytesLen, exiFrag->X509Certificate.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->X509Certificate.bytesLen, exiFrag->X509Certificate.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->X509Certificate_isUsed = 1u;
 					} else {
@@ -16795,11 +22489,13 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 					}
 				}
 				break;
+#if DIN_DEPLOY_X509Data == SUPPORT_YES
 			case 225:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data) */
 				errn = decode_dinX509DataType(stream, &exiFrag->X509Data);
 				exiFrag->X509Data_isUsed = 1u;
 				break;
+#endif /* DIN_DEPLOY_X509Data */
 			case 226:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerName) */
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
@@ -16810,10 +22506,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->X509IssuerName.charactersLen >= 2) {
 								exiFrag->X509IssuerName.charactersLen = (uint16_t)(exiFrag->X509IssuerName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->X509IssuerName.characters, CHARACTER_UNITS(exiFrag->X509IssuerName.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->X509IssuerName.charactersLen, exiFrag->X509IssuerName.characters, dinEXIFragment_X509IssuerName_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->X509IssuerName.charactersLen, exiFrag->X509IssuerName.characters, dinEXIFragment_X509IssuerName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, exiFrag->X509IssuerName.characters, exiFrag->X509IssuerName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, &exiFrag->X509IssuerName.charactersLen, &exiFrag->X509IssuerName.characters);
+#else
+								errn = decodeStringValueHit(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, &exiFrag->X509IssuerName.charactersLen, exiFrag->X509IssuerName.characters, dinEXIFragment_X509IssuerName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->X509IssuerName_isUsed = 1u;
@@ -16839,7 +22549,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->X509SKI.bytesLen) <= dinEXIFragment_X509SKI_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->X509SKI.bytes, exiFrag->X509SKI.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->X509SKI.bytesLen, exiFrag->X509SKI.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->X509SKI.bytesLen, exiFrag->X509SKI.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->X509SKI_isUsed = 1u;
 					} else {
@@ -16872,10 +22589,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->X509SubjectName.charactersLen >= 2) {
 								exiFrag->X509SubjectName.charactersLen = (uint16_t)(exiFrag->X509SubjectName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->X509SubjectName.characters, CHARACTER_UNITS(exiFrag->X509SubjectName.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->X509SubjectName.charactersLen, exiFrag->X509SubjectName.characters, dinEXIFragment_X509SubjectName_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->X509SubjectName.charactersLen, exiFrag->X509SubjectName.characters, dinEXIFragment_X509SubjectName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, exiFrag->X509SubjectName.characters, exiFrag->X509SubjectName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &exiFrag->X509SubjectName.charactersLen, &exiFrag->X509SubjectName.characters);
+#else
+								errn = decodeStringValueHit(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &exiFrag->X509SubjectName.charactersLen, exiFrag->X509SubjectName.characters, dinEXIFragment_X509SubjectName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->X509SubjectName_isUsed = 1u;
@@ -16895,10 +22626,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->XPath.charactersLen >= 2) {
 								exiFrag->XPath.charactersLen = (uint16_t)(exiFrag->XPath.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->XPath.characters, CHARACTER_UNITS(exiFrag->XPath.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->XPath.charactersLen, exiFrag->XPath.characters, dinEXIFragment_XPath_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->XPath.charactersLen, exiFrag->XPath.characters, dinEXIFragment_XPath_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, exiFrag->XPath.characters, exiFrag->XPath.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &exiFrag->XPath.charactersLen, &exiFrag->XPath.characters);
+#else
+								errn = decodeStringValueHit(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &exiFrag->XPath.charactersLen, exiFrag->XPath.characters, dinEXIFragment_XPath_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->XPath_isUsed = 1u;
@@ -16919,7 +22664,14 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 							errn =  (exiFrag->Y.bytesLen) <= dinEXIFragment_Y_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->Y.bytes, exiFrag->Y.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->Y.bytesLen, exiFrag->Y.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->Y.bytesLen, exiFrag->Y.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->Y_isUsed = 1u;
 					} else {
@@ -17086,10 +22838,24 @@ int decode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 						if (errn == 0) {
 							if (exiFrag->stringValue.charactersLen >= 2) {
 								exiFrag->stringValue.charactersLen = (uint16_t)(exiFrag->stringValue.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->stringValue.characters, CHARACTER_UNITS(exiFrag->stringValue.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->stringValue.charactersLen, exiFrag->stringValue.characters, dinEXIFragment_stringValue_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->stringValue.charactersLen, exiFrag->stringValue.characters, dinEXIFragment_stringValue_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 22 /* {urn:iso:15118:2:2010:MsgDataTypes}stringValue */, exiFrag->stringValue.characters, exiFrag->stringValue.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 22 /* {urn:iso:15118:2:2010:MsgDataTypes}stringValue */, &exiFrag->stringValue.charactersLen, &exiFrag->stringValue.characters);
+#else
+								errn = decodeStringValueHit(stream, 22 /* {urn:iso:15118:2:2010:MsgDataTypes}stringValue */, &exiFrag->stringValue.charactersLen, exiFrag->stringValue.characters, dinEXIFragment_stringValue_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->stringValue_isUsed = 1u;
@@ -43,100 +43,175 @@
 
 #if DEPLOY_DIN_CODEC == SUPPORT_YES
 
-static int errn;
-
+/* Note: errn is a local of each encode function (reentrant encoding) */
 /* Forward Declarations */
+#if DIN_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 static int encode_dinMeteringReceiptReqType(bitstream_t* stream, struct dinMeteringReceiptReqType* dinMeteringReceiptReqType);
+#endif /* DIN_DEPLOY_MeteringReceiptReq */
 static int encode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyType);
+#if DIN_DEPLOY_SessionSetupReq == SUPPORT_YES
 static int encode_dinSessionSetupReqType(bitstream_t* stream, struct dinSessionSetupReqType* dinSessionSetupReqType);
+#endif /* DIN_DEPLOY_SessionSetupReq */
+#if DIN_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 static int encode_dinPowerDeliveryResType(bitstream_t* stream, struct dinPowerDeliveryResType* dinPowerDeliveryResType);
+#endif /* DIN_DEPLOY_PowerDeliveryRes */
+#if DIN_DEPLOY_ServiceDetailRes == SUPPORT_YES
 static int encode_dinServiceDetailResType(bitstream_t* stream, struct dinServiceDetailResType* dinServiceDetailResType);
+#endif /* DIN_DEPLOY_ServiceDetailRes */
+#if DIN_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 static int encode_dinWeldingDetectionResType(bitstream_t* stream, struct dinWeldingDetectionResType* dinWeldingDetectionResType);
+#endif /* DIN_DEPLOY_WeldingDetectionRes */
+#if DIN_DEPLOY_ContractAuthenticationRes == SUPPORT_YES
 static int encode_dinContractAuthenticationResType(bitstream_t* stream, struct dinContractAuthenticationResType* dinContractAuthenticationResType);
+#endif /* DIN_DEPLOY_ContractAuthenticationRes */
 static int encode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinCanonicalizationMethodType* dinCanonicalizationMethodType);
 static int encode_dinSPKIDataType(bitstream_t* stream, struct dinSPKIDataType* dinSPKIDataType);
 static int encode_dinListOfRootCertificateIDsType(bitstream_t* stream, struct dinListOfRootCertificateIDsType* dinListOfRootCertificateIDsType);
 static int encode_dinSelectedServiceListType(bitstream_t* stream, struct dinSelectedServiceListType* dinSelectedServiceListType);
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
 static int encode_dinCurrentDemandResType(bitstream_t* stream, struct dinCurrentDemandResType* dinCurrentDemandResType);
+#endif /* DIN_DEPLOY_CurrentDemandRes */
 static int encode_dinTransformType(bitstream_t* stream, struct dinTransformType* dinTransformType);
 static int encode_dinAC_EVChargeParameterType(bitstream_t* stream, struct dinAC_EVChargeParameterType* dinAC_EVChargeParameterType);
 static int encode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* dinX509DataType);
+#if DIN_DEPLOY_ChargingStatusRes == SUPPORT_YES
 static int encode_dinChargingStatusResType(bitstream_t* stream, struct dinChargingStatusResType* dinChargingStatusResType);
+#endif /* DIN_DEPLOY_ChargingStatusRes */
+#if DIN_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 static int encode_dinWeldingDetectionReqType(bitstream_t* stream, struct dinWeldingDetectionReqType* dinWeldingDetectionReqType);
+#endif /* DIN_DEPLOY_WeldingDetectionReq */
+#if DIN_DEPLOY_SignatureProperties == SUPPORT_YES
 static int encode_dinSignaturePropertiesType(bitstream_t* stream, struct dinSignaturePropertiesType* dinSignaturePropertiesType);
+#endif /* DIN_DEPLOY_SignatureProperties */
+#if DIN_DEPLOY_ContractAuthenticationReq == SUPPORT_YES
 static int encode_dinContractAuthenticationReqType(bitstream_t* stream, struct dinContractAuthenticationReqType* dinContractAuthenticationReqType);
+#endif /* DIN_DEPLOY_ContractAuthenticationReq */
 static int encode_dinDC_EVPowerDeliveryParameterType(bitstream_t* stream, struct dinDC_EVPowerDeliveryParameterType* dinDC_EVPowerDeliveryParameterType);
 static int encode_dinEVSEChargeParameterType(bitstream_t* stream, struct dinEVSEChargeParameterType* dinEVSEChargeParameterType);
+#if DIN_DEPLOY_CableCheckReq == SUPPORT_YES
 static int encode_dinCableCheckReqType(bitstream_t* stream, struct dinCableCheckReqType* dinCableCheckReqType);
+#endif /* DIN_DEPLOY_CableCheckReq */
 static int encode_dinDC_EVChargeParameterType(bitstream_t* stream, struct dinDC_EVChargeParameterType* dinDC_EVChargeParameterType);
 static int encode_dinSAScheduleListType(bitstream_t* stream, struct dinSAScheduleListType* dinSAScheduleListType);
 static int encode_dinPMaxScheduleType(bitstream_t* stream, struct dinPMaxScheduleType* dinPMaxScheduleType);
+#if DIN_DEPLOY_ServicePaymentSelectionReq == SUPPORT_YES
 static int encode_dinServicePaymentSelectionReqType(bitstream_t* stream, struct dinServicePaymentSelectionReqType* dinServicePaymentSelectionReqType);
+#endif /* DIN_DEPLOY_ServicePaymentSelectionReq */
 static int encode_dinRelativeTimeIntervalType(bitstream_t* stream, struct dinRelativeTimeIntervalType* dinRelativeTimeIntervalType);
+#if DIN_DEPLOY_EVStatus == SUPPORT_YES
 static int encode_dinEVStatusType(bitstream_t* stream, struct dinEVStatusType* dinEVStatusType);
+#endif /* DIN_DEPLOY_EVStatus */
+#if DIN_DEPLOY_PreChargeRes == SUPPORT_YES
 static int encode_dinPreChargeResType(bitstream_t* stream, struct dinPreChargeResType* dinPreChargeResType);
+#endif /* DIN_DEPLOY_PreChargeRes */
 static int encode_dinDC_EVSEChargeParameterType(bitstream_t* stream, struct dinDC_EVSEChargeParameterType* dinDC_EVSEChargeParameterType);
+#if DIN_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 static int encode_dinPaymentDetailsResType(bitstream_t* stream, struct dinPaymentDetailsResType* dinPaymentDetailsResType);
+#endif /* DIN_DEPLOY_PaymentDetailsRes */
 static int encode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueType* dinDSAKeyValueType);
 static int encode_dinSASchedulesType(bitstream_t* stream, struct dinSASchedulesType* dinSASchedulesType);
+#if DIN_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 static int encode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCertificateUpdateResType* dinCertificateUpdateResType);
+#endif /* DIN_DEPLOY_CertificateUpdateRes */
 static int encode_dinEVChargeParameterType(bitstream_t* stream, struct dinEVChargeParameterType* dinEVChargeParameterType);
 static int encode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHeaderType* dinMessageHeaderType);
+#if DIN_DEPLOY_BodyElement == SUPPORT_YES
 static int encode_dinBodyBaseType(bitstream_t* stream, struct dinBodyBaseType* dinBodyBaseType);
+#endif /* DIN_DEPLOY_BodyElement */
 static int encode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* dinKeyValueType);
 static int encode_dinIntervalType(bitstream_t* stream, struct dinIntervalType* dinIntervalType);
+#if DIN_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 static int encode_dinChargeParameterDiscoveryResType(bitstream_t* stream, struct dinChargeParameterDiscoveryResType* dinChargeParameterDiscoveryResType);
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryRes */
+#if DIN_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 static int encode_dinPowerDeliveryReqType(bitstream_t* stream, struct dinPowerDeliveryReqType* dinPowerDeliveryReqType);
+#endif /* DIN_DEPLOY_PowerDeliveryReq */
 static int encode_dinCertificateChainType(bitstream_t* stream, struct dinCertificateChainType* dinCertificateChainType);
 static int encode_dinTransformsType(bitstream_t* stream, struct dinTransformsType* dinTransformsType);
+#if DIN_DEPLOY_Entry == SUPPORT_YES
 static int encode_dinEntryType(bitstream_t* stream, struct dinEntryType* dinEntryType);
+#endif /* DIN_DEPLOY_Entry */
+#if DIN_DEPLOY_SessionStopReq == SUPPORT_YES
 static int encode_dinSessionStopType(bitstream_t* stream, struct dinSessionStopType* dinSessionStopType);
+#endif /* DIN_DEPLOY_SessionStopReq */
+#if DIN_DEPLOY_ServiceDetailReq == SUPPORT_YES
 static int encode_dinServiceDetailReqType(bitstream_t* stream, struct dinServiceDetailReqType* dinServiceDetailReqType);
+#endif /* DIN_DEPLOY_ServiceDetailReq */
 static int encode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMethodType* dinDigestMethodType);
 static int encode_dinParameterType(bitstream_t* stream, struct dinParameterType* dinParameterType);
+#if DIN_DEPLOY_ChargingStatusReq == SUPPORT_YES
 static int encode_dinChargingStatusReqType(bitstream_t* stream, struct dinChargingStatusReqType* dinChargingStatusReqType);
+#endif /* DIN_DEPLOY_ChargingStatusReq */
 static int encode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatureMethodType* dinSignatureMethodType);
+#if DIN_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 static int encode_dinCertificateInstallationReqType(bitstream_t* stream, struct dinCertificateInstallationReqType* dinCertificateInstallationReqType);
+#endif /* DIN_DEPLOY_CertificateInstallationReq */
 static int encode_dinSalesTariffEntryType(bitstream_t* stream, struct dinSalesTariffEntryType* dinSalesTariffEntryType);
+#if DIN_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 static int encode_dinServiceDiscoveryResType(bitstream_t* stream, struct dinServiceDiscoveryResType* dinServiceDiscoveryResType);
+#endif /* DIN_DEPLOY_ServiceDiscoveryRes */
 static int encode_dinParameterSetType(bitstream_t* stream, struct dinParameterSetType* dinParameterSetType);
+#if DIN_DEPLOY_CurrentDemandReq == SUPPORT_YES
 static int encode_dinCurrentDemandReqType(bitstream_t* stream, struct dinCurrentDemandReqType* dinCurrentDemandReqType);
+#endif /* DIN_DEPLOY_CurrentDemandReq */
+#if DIN_DEPLOY_PreChargeReq == SUPPORT_YES
 static int encode_dinPreChargeReqType(bitstream_t* stream, struct dinPreChargeReqType* dinPreChargeReqType);
+#endif /* DIN_DEPLOY_PreChargeReq */
 static int encode_dinSignatureType(bitstream_t* stream, struct dinSignatureType* dinSignatureType);
 static int encode_dinReferenceType(bitstream_t* stream, struct dinReferenceType* dinReferenceType);
 static int encode_dinProfileEntryType(bitstream_t* stream, struct dinProfileEntryType* dinProfileEntryType);
 static int encode_dinAnonType_V2G_Message(bitstream_t* stream, struct dinAnonType_V2G_Message* dinAnonType_V2G_Message);
+#if DIN_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 static int encode_dinChargeParameterDiscoveryReqType(bitstream_t* stream, struct dinChargeParameterDiscoveryReqType* dinChargeParameterDiscoveryReqType);
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryReq */
 static int encode_dinConsumptionCostType(bitstream_t* stream, struct dinConsumptionCostType* dinConsumptionCostType);
 static int encode_dinRSAKeyValueType(bitstream_t* stream, struct dinRSAKeyValueType* dinRSAKeyValueType);
 static int encode_dinServiceType(bitstream_t* stream, struct dinServiceType* dinServiceType);
 static int encode_dinServiceTagListType(bitstream_t* stream, struct dinServiceTagListType* dinServiceTagListType);
 static int encode_dinEVSEStatusType(bitstream_t* stream, struct dinEVSEStatusType* dinEVSEStatusType);
+#if DIN_DEPLOY_SessionSetupRes == SUPPORT_YES
 static int encode_dinSessionSetupResType(bitstream_t* stream, struct dinSessionSetupResType* dinSessionSetupResType);
+#endif /* DIN_DEPLOY_SessionSetupRes */
 static int encode_dinEVPowerDeliveryParameterType(bitstream_t* stream, struct dinEVPowerDeliveryParameterType* dinEVPowerDeliveryParameterType);
 static int encode_dinX509IssuerSerialType(bitstream_t* stream, struct dinX509IssuerSerialType* dinX509IssuerSerialType);
 static int encode_dinSelectedServiceType(bitstream_t* stream, struct dinSelectedServiceType* dinSelectedServiceType);
+#if DIN_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 static int encode_dinMeteringReceiptResType(bitstream_t* stream, struct dinMeteringReceiptResType* dinMeteringReceiptResType);
+#endif /* DIN_DEPLOY_MeteringReceiptRes */
 static int encode_dinDC_EVStatusType(bitstream_t* stream, struct dinDC_EVStatusType* dinDC_EVStatusType);
 static int encode_dinPhysicalValueType(bitstream_t* stream, struct dinPhysicalValueType* dinPhysicalValueType);
+#if DIN_DEPLOY_Manifest == SUPPORT_YES
 static int encode_dinManifestType(bitstream_t* stream, struct dinManifestType* dinManifestType);
+#endif /* DIN_DEPLOY_Manifest */
 static int encode_dinPMaxScheduleEntryType(bitstream_t* stream, struct dinPMaxScheduleEntryType* dinPMaxScheduleEntryType);
 static int encode_dinServiceParameterListType(bitstream_t* stream, struct dinServiceParameterListType* dinServiceParameterListType);
 static int encode_dinSignatureValueType(bitstream_t* stream, struct dinSignatureValueType* dinSignatureValueType);
 static int encode_dinPaymentOptionsType(bitstream_t* stream, struct dinPaymentOptionsType* dinPaymentOptionsType);
 static int encode_dinServiceTagType(bitstream_t* stream, struct dinServiceTagType* dinServiceTagType);
 static int encode_dinAC_EVSEStatusType(bitstream_t* stream, struct dinAC_EVSEStatusType* dinAC_EVSEStatusType);
+#if DIN_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 static int encode_dinCertificateUpdateReqType(bitstream_t* stream, struct dinCertificateUpdateReqType* dinCertificateUpdateReqType);
+#endif /* DIN_DEPLOY_CertificateUpdateReq */
+#if DIN_DEPLOY_ServicePaymentSelectionRes == SUPPORT_YES
 static int encode_dinServicePaymentSelectionResType(bitstream_t* stream, struct dinServicePaymentSelectionResType* dinServicePaymentSelectionResType);
+#endif /* DIN_DEPLOY_ServicePaymentSelectionRes */
 static int encode_dinSAScheduleTupleType(bitstream_t* stream, struct dinSAScheduleTupleType* dinSAScheduleTupleType);
 static int encode_dinChargingProfileType(bitstream_t* stream, struct dinChargingProfileType* dinChargingProfileType);
+#if DIN_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 static int encode_dinServiceDiscoveryReqType(bitstream_t* stream, struct dinServiceDiscoveryReqType* dinServiceDiscoveryReqType);
+#endif /* DIN_DEPLOY_ServiceDiscoveryReq */
 static int encode_dinAC_EVSEChargeParameterType(bitstream_t* stream, struct dinAC_EVSEChargeParameterType* dinAC_EVSEChargeParameterType);
 static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* dinKeyInfoType);
+#if DIN_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 static int encode_dinPaymentDetailsReqType(bitstream_t* stream, struct dinPaymentDetailsReqType* dinPaymentDetailsReqType);
+#endif /* DIN_DEPLOY_PaymentDetailsReq */
+#if DIN_DEPLOY_CableCheckRes == SUPPORT_YES
 static int encode_dinCableCheckResType(bitstream_t* stream, struct dinCableCheckResType* dinCableCheckResType);
+#endif /* DIN_DEPLOY_CableCheckRes */
 static int encode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinObjectType);
+#if DIN_DEPLOY_SessionStopRes == SUPPORT_YES
 static int encode_dinSessionStopResType(bitstream_t* stream, struct dinSessionStopResType* dinSessionStopResType);
+#endif /* DIN_DEPLOY_SessionStopRes */
 static int encode_dinSignedInfoType(bitstream_t* stream, struct dinSignedInfoType* dinSignedInfoType);
 static int encode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffType* dinSalesTariffType);
 static int encode_dinCostType(bitstream_t* stream, struct dinCostType* dinCostType);
@@ -145,14 +220,18 @@ static int encode_dinDC_EVSEStatusType(bitstream_t* stream, struct dinDC_EVSESta
 static int encode_dinRetrievalMethodType(bitstream_t* stream, struct dinRetrievalMethodType* dinRetrievalMethodType);
 static int encode_dinNotificationType(bitstream_t* stream, struct dinNotificationType* dinNotificationType);
 static int encode_dinPGPDataType(bitstream_t* stream, struct dinPGPDataType* dinPGPDataType);
+#if DIN_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 static int encode_dinCertificateInstallationResType(bitstream_t* stream, struct dinCertificateInstallationResType* dinCertificateInstallationResType);
+#endif /* DIN_DEPLOY_CertificateInstallationRes */
 static int encode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignaturePropertyType* dinSignaturePropertyType);
 static int encode_dinMeterInfoType(bitstream_t* stream, struct dinMeterInfoType* dinMeterInfoType);
 static int encode_dinSubCertificatesType(bitstream_t* stream, struct dinSubCertificatesType* dinSubCertificatesType);
 
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,MeteringReceiptReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":SessionID,"urn:iso:15118:2:2010:MsgBody":SAScheduleTupleID{0-1},"urn:iso:15118:2:2010:MsgBody":MeterInfo)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 static int encode_dinMeteringReceiptReqType(bitstream_t* stream, struct dinMeteringReceiptReqType* dinMeteringReceiptReqType) {
+	int errn = 0;
 	int grammarID = 0;
 	int done = 0;
 	
@@ -164,11 +243,8 @@ static int encode_dinMeteringReceiptReqType(bitstream_t* stream, struct dinMeter
 			if ( dinMeteringReceiptReqType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinMeteringReceiptReqType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinMeteringReceiptReqType->Id.characters, dinMeteringReceiptReqType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinMeteringReceiptReqType->Id.characters, dinMeteringReceiptReqType->Id.charactersLen);
 				}
 				grammarID = 1;
 			} else 			if ( 1 == 1 ) {
@@ -269,9 +345,11 @@ static int encode_dinMeteringReceiptReqType(bitstream_t* stream, struct dinMeter
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_MeteringReceiptReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDef,BodyType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDef":BodyElement{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyType) {
+	int errn = 0;
 	int grammarID = 6;
 	int done = 0;
 	
@@ -281,215 +359,355 @@ static int encode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 		case 6:
 			/* FirstStartTag[START_ELEMENT({urn:iso:15118:2:2010:MsgDef}BodyElement), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionRes), END_ELEMENT] */
 			if ( dinBodyType->BodyElement_isUsed == 1u ) {
+#if DIN_DEPLOY_BodyElement == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 0);
 				if(errn == 0) {
 					errn = encode_dinBodyBaseType(stream, &dinBodyType->BodyElement );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_BodyElement */
 			} else 			if ( dinBodyType->CableCheckReq_isUsed == 1u ) {
+#if DIN_DEPLOY_CableCheckReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 1);
 				if(errn == 0) {
 					errn = encode_dinCableCheckReqType(stream, &dinBodyType->CableCheckReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CableCheckReq */
 			} else 			if ( dinBodyType->CableCheckRes_isUsed == 1u ) {
+#if DIN_DEPLOY_CableCheckRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 2);
 				if(errn == 0) {
 					errn = encode_dinCableCheckResType(stream, &dinBodyType->CableCheckRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CableCheckRes */
 			} else 			if ( dinBodyType->CertificateInstallationReq_isUsed == 1u ) {
+#if DIN_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 3);
 				if(errn == 0) {
 					errn = encode_dinCertificateInstallationReqType(stream, &dinBodyType->CertificateInstallationReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CertificateInstallationReq */
 			} else 			if ( dinBodyType->CertificateInstallationRes_isUsed == 1u ) {
+#if DIN_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 4);
 				if(errn == 0) {
 					errn = encode_dinCertificateInstallationResType(stream, &dinBodyType->CertificateInstallationRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CertificateInstallationRes */
 			} else 			if ( dinBodyType->CertificateUpdateReq_isUsed == 1u ) {
+#if DIN_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 5);
 				if(errn == 0) {
 					errn = encode_dinCertificateUpdateReqType(stream, &dinBodyType->CertificateUpdateReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CertificateUpdateReq */
 			} else 			if ( dinBodyType->CertificateUpdateRes_isUsed == 1u ) {
+#if DIN_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 6);
 				if(errn == 0) {
 					errn = encode_dinCertificateUpdateResType(stream, &dinBodyType->CertificateUpdateRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CertificateUpdateRes */
 			} else 			if ( dinBodyType->ChargeParameterDiscoveryReq_isUsed == 1u ) {
+#if DIN_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 7);
 				if(errn == 0) {
 					errn = encode_dinChargeParameterDiscoveryReqType(stream, &dinBodyType->ChargeParameterDiscoveryReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryReq */
 			} else 			if ( dinBodyType->ChargeParameterDiscoveryRes_isUsed == 1u ) {
+#if DIN_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 8);
 				if(errn == 0) {
 					errn = encode_dinChargeParameterDiscoveryResType(stream, &dinBodyType->ChargeParameterDiscoveryRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryRes */
 			} else 			if ( dinBodyType->ChargingStatusReq_isUsed == 1u ) {
+#if DIN_DEPLOY_ChargingStatusReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 9);
 				if(errn == 0) {
 					errn = encode_dinChargingStatusReqType(stream, &dinBodyType->ChargingStatusReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ChargingStatusReq */
 			} else 			if ( dinBodyType->ChargingStatusRes_isUsed == 1u ) {
+#if DIN_DEPLOY_ChargingStatusRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 10);
 				if(errn == 0) {
 					errn = encode_dinChargingStatusResType(stream, &dinBodyType->ChargingStatusRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ChargingStatusRes */
 			} else 			if ( dinBodyType->ContractAuthenticationReq_isUsed == 1u ) {
+#if DIN_DEPLOY_ContractAuthenticationReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 11);
 				if(errn == 0) {
 					errn = encode_dinContractAuthenticationReqType(stream, &dinBodyType->ContractAuthenticationReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ContractAuthenticationReq */
 			} else 			if ( dinBodyType->ContractAuthenticationRes_isUsed == 1u ) {
+#if DIN_DEPLOY_ContractAuthenticationRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 12);
 				if(errn == 0) {
 					errn = encode_dinContractAuthenticationResType(stream, &dinBodyType->ContractAuthenticationRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ContractAuthenticationRes */
 			} else 			if ( dinBodyType->CurrentDemandReq_isUsed == 1u ) {
+#if DIN_DEPLOY_CurrentDemandReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 13);
 				if(errn == 0) {
 					errn = encode_dinCurrentDemandReqType(stream, &dinBodyType->CurrentDemandReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CurrentDemandReq */
 			} else 			if ( dinBodyType->CurrentDemandRes_isUsed == 1u ) {
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 14);
 				if(errn == 0) {
 					errn = encode_dinCurrentDemandResType(stream, &dinBodyType->CurrentDemandRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CurrentDemandRes */
 			} else 			if ( dinBodyType->MeteringReceiptReq_isUsed == 1u ) {
+#if DIN_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 15);
 				if(errn == 0) {
 					errn = encode_dinMeteringReceiptReqType(stream, &dinBodyType->MeteringReceiptReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_MeteringReceiptReq */
 			} else 			if ( dinBodyType->MeteringReceiptRes_isUsed == 1u ) {
+#if DIN_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 16);
 				if(errn == 0) {
 					errn = encode_dinMeteringReceiptResType(stream, &dinBodyType->MeteringReceiptRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_MeteringReceiptRes */
 			} else 			if ( dinBodyType->PaymentDetailsReq_isUsed == 1u ) {
+#if DIN_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 17);
 				if(errn == 0) {
 					errn = encode_dinPaymentDetailsReqType(stream, &dinBodyType->PaymentDetailsReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PaymentDetailsReq */
 			} else 			if ( dinBodyType->PaymentDetailsRes_isUsed == 1u ) {
+#if DIN_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 18);
 				if(errn == 0) {
 					errn = encode_dinPaymentDetailsResType(stream, &dinBodyType->PaymentDetailsRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PaymentDetailsRes */
 			} else 			if ( dinBodyType->PowerDeliveryReq_isUsed == 1u ) {
+#if DIN_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 19);
 				if(errn == 0) {
 					errn = encode_dinPowerDeliveryReqType(stream, &dinBodyType->PowerDeliveryReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PowerDeliveryReq */
 			} else 			if ( dinBodyType->PowerDeliveryRes_isUsed == 1u ) {
+#if DIN_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 20);
 				if(errn == 0) {
 					errn = encode_dinPowerDeliveryResType(stream, &dinBodyType->PowerDeliveryRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PowerDeliveryRes */
 			} else 			if ( dinBodyType->PreChargeReq_isUsed == 1u ) {
+#if DIN_DEPLOY_PreChargeReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 21);
 				if(errn == 0) {
 					errn = encode_dinPreChargeReqType(stream, &dinBodyType->PreChargeReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PreChargeReq */
 			} else 			if ( dinBodyType->PreChargeRes_isUsed == 1u ) {
+#if DIN_DEPLOY_PreChargeRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 22);
 				if(errn == 0) {
 					errn = encode_dinPreChargeResType(stream, &dinBodyType->PreChargeRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PreChargeRes */
 			} else 			if ( dinBodyType->ServiceDetailReq_isUsed == 1u ) {
+#if DIN_DEPLOY_ServiceDetailReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 23);
 				if(errn == 0) {
 					errn = encode_dinServiceDetailReqType(stream, &dinBodyType->ServiceDetailReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceDetailReq */
 			} else 			if ( dinBodyType->ServiceDetailRes_isUsed == 1u ) {
+#if DIN_DEPLOY_ServiceDetailRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 24);
 				if(errn == 0) {
 					errn = encode_dinServiceDetailResType(stream, &dinBodyType->ServiceDetailRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceDetailRes */
 			} else 			if ( dinBodyType->ServiceDiscoveryReq_isUsed == 1u ) {
+#if DIN_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 25);
 				if(errn == 0) {
 					errn = encode_dinServiceDiscoveryReqType(stream, &dinBodyType->ServiceDiscoveryReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceDiscoveryReq */
 			} else 			if ( dinBodyType->ServiceDiscoveryRes_isUsed == 1u ) {
+#if DIN_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 26);
 				if(errn == 0) {
 					errn = encode_dinServiceDiscoveryResType(stream, &dinBodyType->ServiceDiscoveryRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceDiscoveryRes */
 			} else 			if ( dinBodyType->ServicePaymentSelectionReq_isUsed == 1u ) {
+#if DIN_DEPLOY_ServicePaymentSelectionReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 27);
 				if(errn == 0) {
 					errn = encode_dinServicePaymentSelectionReqType(stream, &dinBodyType->ServicePaymentSelectionReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServicePaymentSelectionReq */
 			} else 			if ( dinBodyType->ServicePaymentSelectionRes_isUsed == 1u ) {
+#if DIN_DEPLOY_ServicePaymentSelectionRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 28);
 				if(errn == 0) {
 					errn = encode_dinServicePaymentSelectionResType(stream, &dinBodyType->ServicePaymentSelectionRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServicePaymentSelectionRes */
 			} else 			if ( dinBodyType->SessionSetupReq_isUsed == 1u ) {
+#if DIN_DEPLOY_SessionSetupReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 29);
 				if(errn == 0) {
 					errn = encode_dinSessionSetupReqType(stream, &dinBodyType->SessionSetupReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SessionSetupReq */
 			} else 			if ( dinBodyType->SessionSetupRes_isUsed == 1u ) {
+#if DIN_DEPLOY_SessionSetupRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 30);
 				if(errn == 0) {
 					errn = encode_dinSessionSetupResType(stream, &dinBodyType->SessionSetupRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SessionSetupRes */
 			} else 			if ( dinBodyType->SessionStopReq_isUsed == 1u ) {
+#if DIN_DEPLOY_SessionStopReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 31);
 				if(errn == 0) {
 					errn = encode_dinSessionStopType(stream, &dinBodyType->SessionStopReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SessionStopReq */
 			} else 			if ( dinBodyType->SessionStopRes_isUsed == 1u ) {
+#if DIN_DEPLOY_SessionStopRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 32);
 				if(errn == 0) {
 					errn = encode_dinSessionStopResType(stream, &dinBodyType->SessionStopRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SessionStopRes */
 			} else 			if ( dinBodyType->WeldingDetectionReq_isUsed == 1u ) {
+#if DIN_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 33);
 				if(errn == 0) {
 					errn = encode_dinWeldingDetectionReqType(stream, &dinBodyType->WeldingDetectionReq );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_WeldingDetectionReq */
 			} else 			if ( dinBodyType->WeldingDetectionRes_isUsed == 1u ) {
+#if DIN_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 34);
 				if(errn == 0) {
 					errn = encode_dinWeldingDetectionResType(stream, &dinBodyType->WeldingDetectionRes );
 				}
 				grammarID = 4;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_WeldingDetectionRes */
 			} else 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 6, 35);
 				if(errn == 0) {
@@ -524,7 +742,9 @@ static int encode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,SessionSetupReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":EVCCID)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_SessionSetupReq == SUPPORT_YES
 static int encode_dinSessionSetupReqType(bitstream_t* stream, struct dinSessionSetupReqType* dinSessionSetupReqType) {
+	int errn = 0;
 	int grammarID = 7;
 	int done = 0;
 	
@@ -574,9 +794,12 @@ static int encode_dinSessionSetupReqType(bitstream_t* stream, struct dinSessionS
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_SessionSetupReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,PowerDeliveryResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgDataTypes":EVSEStatus)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 static int encode_dinPowerDeliveryResType(bitstream_t* stream, struct dinPowerDeliveryResType* dinPowerDeliveryResType) {
+	int errn = 0;
 	int grammarID = 8;
 	int done = 0;
 	
@@ -647,9 +870,12 @@ static int encode_dinPowerDeliveryResType(bitstream_t* stream, struct dinPowerDe
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_PowerDeliveryRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ServiceDetailResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":ServiceID,"urn:iso:15118:2:2010:MsgBody":ServiceParameterList{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ServiceDetailRes == SUPPORT_YES
 static int encode_dinServiceDetailResType(bitstream_t* stream, struct dinServiceDetailResType* dinServiceDetailResType) {
+	int errn = 0;
 	int grammarID = 10;
 	int done = 0;
 	
@@ -732,9 +958,12 @@ static int encode_dinServiceDetailResType(bitstream_t* stream, struct dinService
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_ServiceDetailRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,WeldingDetectionResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2010:MsgBody":EVSEPresentVoltage)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 static int encode_dinWeldingDetectionResType(bitstream_t* stream, struct dinWeldingDetectionResType* dinWeldingDetectionResType) {
+	int errn = 0;
 	int grammarID = 13;
 	int done = 0;
 	
@@ -805,9 +1034,12 @@ static int encode_dinWeldingDetectionResType(bitstream_t* stream, struct dinWeld
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_WeldingDetectionRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ContractAuthenticationResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":EVSEProcessing)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ContractAuthenticationRes == SUPPORT_YES
 static int encode_dinContractAuthenticationResType(bitstream_t* stream, struct dinContractAuthenticationResType* dinContractAuthenticationResType) {
+	int errn = 0;
 	int grammarID = 16;
 	int done = 0;
 	
@@ -872,9 +1104,11 @@ static int encode_dinContractAuthenticationResType(bitstream_t* stream, struct d
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_ContractAuthenticationRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,CanonicalizationMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinCanonicalizationMethodType* dinCanonicalizationMethodType) {
+	int errn = 0;
 	int grammarID = 18;
 	int done = 0;
 	int wcDone = 0;
@@ -887,11 +1121,8 @@ static int encode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinC
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinCanonicalizationMethodType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinCanonicalizationMethodType->Algorithm.characters, dinCanonicalizationMethodType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 23 /* {}Algorithm */, dinCanonicalizationMethodType->Algorithm.characters, dinCanonicalizationMethodType->Algorithm.charactersLen);
 				}
 				grammarID = 19;
 			} else {
@@ -912,11 +1143,8 @@ static int encode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinC
 			} else 			if ( dinCanonicalizationMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinCanonicalizationMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinCanonicalizationMethodType->ANY.characters, dinCanonicalizationMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, dinCanonicalizationMethodType->ANY.characters, dinCanonicalizationMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 20;
@@ -938,11 +1166,8 @@ static int encode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinC
 			} else 			if ( dinCanonicalizationMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinCanonicalizationMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinCanonicalizationMethodType->ANY.characters, dinCanonicalizationMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, dinCanonicalizationMethodType->ANY.characters, dinCanonicalizationMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 20;
@@ -963,6 +1188,7 @@ static int encode_dinCanonicalizationMethodType(bitstream_t* stream, struct dinC
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SPKIDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SPKISexp,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-1}){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_dinSPKIDataType(bitstream_t* stream, struct dinSPKIDataType* dinSPKIDataType) {
+	int errn = 0;
 	int grammarID = 21;
 	int done = 0;
 	int wcDone = 0;
@@ -1065,6 +1291,7 @@ static int encode_dinSPKIDataType(bitstream_t* stream, struct dinSPKIDataType* d
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ListOfRootCertificateIDsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":RootCertificateID{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinListOfRootCertificateIDsType(bitstream_t* stream, struct dinListOfRootCertificateIDsType* dinListOfRootCertificateIDsType) {
+	int errn = 0;
 	int grammarID = 24;
 	int done = 0;
 	
@@ -1080,10 +1307,9 @@ static int encode_dinListOfRootCertificateIDsType(bitstream_t* stream, struct di
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType_RootCertificateID_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType_RootCertificateID_currArrayIndex].characters, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType_RootCertificateID_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType_RootCertificateID_currArrayIndex].characters, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType_RootCertificateID_currArrayIndex].charactersLen);
 							dinListOfRootCertificateIDsType_RootCertificateID_currArrayIndex++;
 						}
 						/* valid EE */
@@ -1103,10 +1329,9 @@ static int encode_dinListOfRootCertificateIDsType(bitstream_t* stream, struct di
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType_RootCertificateID_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType_RootCertificateID_currArrayIndex].characters, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType_RootCertificateID_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType_RootCertificateID_currArrayIndex].characters, dinListOfRootCertificateIDsType->RootCertificateID.array[dinListOfRootCertificateIDsType_RootCertificateID_currArrayIndex].charactersLen);
 							dinListOfRootCertificateIDsType_RootCertificateID_currArrayIndex++;
 						}
 						/* valid EE */
@@ -1137,6 +1362,7 @@ static int encode_dinListOfRootCertificateIDsType(bitstream_t* stream, struct di
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SelectedServiceListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":SelectedService{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinSelectedServiceListType(bitstream_t* stream, struct dinSelectedServiceListType* dinSelectedServiceListType) {
+	int errn = 0;
 	int grammarID = 26;
 	int done = 0;
 	
@@ -1186,7 +1412,9 @@ static int encode_dinSelectedServiceListType(bitstream_t* stream, struct dinSele
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CurrentDemandResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2010:MsgBody":EVSEPresentVoltage,"urn:iso:15118:2:2010:MsgBody":EVSEPresentCurrent,"urn:iso:15118:2:2010:MsgBody":EVSECurrentLimitAchieved,"urn:iso:15118:2:2010:MsgBody":EVSEVoltageLimitAchieved,"urn:iso:15118:2:2010:MsgBody":EVSEPowerLimitAchieved,"urn:iso:15118:2:2010:MsgBody":EVSEMaximumVoltageLimit{0-1},"urn:iso:15118:2:2010:MsgBody":EVSEMaximumCurrentLimit{0-1},"urn:iso:15118:2:2010:MsgBody":EVSEMaximumPowerLimit{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
 static int encode_dinCurrentDemandResType(bitstream_t* stream, struct dinCurrentDemandResType* dinCurrentDemandResType) {
+	int errn = 0;
 	int grammarID = 28;
 	int done = 0;
 	
@@ -1395,9 +1623,11 @@ static int encode_dinCurrentDemandResType(bitstream_t* stream, struct dinCurrent
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_CurrentDemandRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])|"http://www.w3.org/2000/09/xmldsig#":XPath){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_dinTransformType(bitstream_t* stream, struct dinTransformType* dinTransformType) {
+	int errn = 0;
 	int grammarID = 38;
 	int done = 0;
 	int wcDone = 0;
@@ -1411,11 +1641,8 @@ static int encode_dinTransformType(bitstream_t* stream, struct dinTransformType*
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinTransformType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinTransformType->Algorithm.characters, dinTransformType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 23 /* {}Algorithm */, dinTransformType->Algorithm.characters, dinTransformType->Algorithm.charactersLen);
 				}
 				grammarID = 39;
 			} else {
@@ -1430,10 +1657,9 @@ static int encode_dinTransformType(bitstream_t* stream, struct dinTransformType*
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinTransformType->XPath.array[dinTransformType_XPath_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, dinTransformType->XPath.array[dinTransformType_XPath_currArrayIndex].characters, dinTransformType->XPath.array[dinTransformType_XPath_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinTransformType->XPath.array[dinTransformType_XPath_currArrayIndex].characters, dinTransformType->XPath.array[dinTransformType_XPath_currArrayIndex].charactersLen);
 							dinTransformType_XPath_currArrayIndex++;
 						}
 						/* valid EE */
@@ -1453,11 +1679,8 @@ static int encode_dinTransformType(bitstream_t* stream, struct dinTransformType*
 			} else 			if ( dinTransformType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinTransformType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinTransformType->ANY.characters, dinTransformType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, dinTransformType->ANY.characters, dinTransformType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 40;
@@ -1473,10 +1696,9 @@ static int encode_dinTransformType(bitstream_t* stream, struct dinTransformType*
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinTransformType->XPath.array[dinTransformType_XPath_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, dinTransformType->XPath.array[dinTransformType_XPath_currArrayIndex].characters, dinTransformType->XPath.array[dinTransformType_XPath_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinTransformType->XPath.array[dinTransformType_XPath_currArrayIndex].characters, dinTransformType->XPath.array[dinTransformType_XPath_currArrayIndex].charactersLen);
 							dinTransformType_XPath_currArrayIndex++;
 						}
 						/* valid EE */
@@ -1496,11 +1718,8 @@ static int encode_dinTransformType(bitstream_t* stream, struct dinTransformType*
 			} else 			if ( dinTransformType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinTransformType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinTransformType->ANY.characters, dinTransformType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, dinTransformType->ANY.characters, dinTransformType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 40;
@@ -1521,6 +1740,7 @@ static int encode_dinTransformType(bitstream_t* stream, struct dinTransformType*
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,AC_EVChargeParameterType',  base type name='EVChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":DepartureTime,"urn:iso:15118:2:2010:MsgDataTypes":EAmount,"urn:iso:15118:2:2010:MsgDataTypes":EVMaxVoltage,"urn:iso:15118:2:2010:MsgDataTypes":EVMaxCurrent,"urn:iso:15118:2:2010:MsgDataTypes":EVMinCurrent)',  derivedBy='EXTENSION'.  */
 static int encode_dinAC_EVChargeParameterType(bitstream_t* stream, struct dinAC_EVChargeParameterType* dinAC_EVChargeParameterType) {
+	int errn = 0;
 	int grammarID = 41;
 	int done = 0;
 	
@@ -1618,6 +1838,7 @@ static int encode_dinAC_EVChargeParameterType(bitstream_t* stream, struct dinAC_
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509DataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":X509IssuerSerial|"http://www.w3.org/2000/09/xmldsig#":X509SKI|"http://www.w3.org/2000/09/xmldsig#":X509SubjectName|"http://www.w3.org/2000/09/xmldsig#":X509Certificate|"http://www.w3.org/2000/09/xmldsig#":X509CRL|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* dinX509DataType) {
+	int errn = 0;
 	int grammarID = 46;
 	int done = 0;
 	int wcDone = 0;
@@ -1660,10 +1881,9 @@ static int encode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* d
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinX509DataType->X509SubjectName.array[dinX509DataType_X509SubjectName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, dinX509DataType->X509SubjectName.array[dinX509DataType_X509SubjectName_currArrayIndex].characters, dinX509DataType->X509SubjectName.array[dinX509DataType_X509SubjectName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinX509DataType->X509SubjectName.array[dinX509DataType_X509SubjectName_currArrayIndex].characters, dinX509DataType->X509SubjectName.array[dinX509DataType_X509SubjectName_currArrayIndex].charactersLen);
 							dinX509DataType_X509SubjectName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -1740,10 +1960,9 @@ static int encode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* d
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinX509DataType->X509SubjectName.array[dinX509DataType_X509SubjectName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, dinX509DataType->X509SubjectName.array[dinX509DataType_X509SubjectName_currArrayIndex].characters, dinX509DataType->X509SubjectName.array[dinX509DataType_X509SubjectName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinX509DataType->X509SubjectName.array[dinX509DataType_X509SubjectName_currArrayIndex].characters, dinX509DataType->X509SubjectName.array[dinX509DataType_X509SubjectName_currArrayIndex].charactersLen);
 							dinX509DataType_X509SubjectName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -1808,7 +2027,9 @@ static int encode_dinX509DataType(bitstream_t* stream, struct dinX509DataType* d
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ChargingStatusResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":EVSEID,"urn:iso:15118:2:2010:MsgBody":SAScheduleTupleID,"urn:iso:15118:2:2010:MsgBody":EVSEMaxCurrent{0-1},"urn:iso:15118:2:2010:MsgBody":MeterInfo{0-1},"urn:iso:15118:2:2010:MsgBody":ReceiptRequired,"urn:iso:15118:2:2010:MsgBody":AC_EVSEStatus)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ChargingStatusRes == SUPPORT_YES
 static int encode_dinChargingStatusResType(bitstream_t* stream, struct dinChargingStatusResType* dinChargingStatusResType) {
+	int errn = 0;
 	int grammarID = 48;
 	int done = 0;
 	
@@ -1978,9 +2199,12 @@ static int encode_dinChargingStatusResType(bitstream_t* stream, struct dinChargi
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_ChargingStatusRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,WeldingDetectionReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":DC_EVStatus)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 static int encode_dinWeldingDetectionReqType(bitstream_t* stream, struct dinWeldingDetectionReqType* dinWeldingDetectionReqType) {
+	int errn = 0;
 	int grammarID = 55;
 	int done = 0;
 	
@@ -2021,9 +2245,12 @@ static int encode_dinWeldingDetectionReqType(bitstream_t* stream, struct dinWeld
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_WeldingDetectionReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertiesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignatureProperty{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if DIN_DEPLOY_SignatureProperties == SUPPORT_YES
 static int encode_dinSignaturePropertiesType(bitstream_t* stream, struct dinSignaturePropertiesType* dinSignaturePropertiesType) {
+	int errn = 0;
 	int grammarID = 56;
 	int done = 0;
 	
@@ -2036,11 +2263,8 @@ static int encode_dinSignaturePropertiesType(bitstream_t* stream, struct dinSign
 			if ( dinSignaturePropertiesType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignaturePropertiesType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignaturePropertiesType->Id.characters, dinSignaturePropertiesType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinSignaturePropertiesType->Id.characters, dinSignaturePropertiesType->Id.charactersLen);
 				}
 				grammarID = 57;
 			} else 			if (dinSignaturePropertiesType_SignatureProperty_currArrayIndex < dinSignaturePropertiesType->SignatureProperty.arrayLen ) {
@@ -2093,9 +2317,12 @@ static int encode_dinSignaturePropertiesType(bitstream_t* stream, struct dinSign
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_SignatureProperties */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ContractAuthenticationReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":GenChallenge{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ContractAuthenticationReq == SUPPORT_YES
 static int encode_dinContractAuthenticationReqType(bitstream_t* stream, struct dinContractAuthenticationReqType* dinContractAuthenticationReqType) {
+	int errn = 0;
 	int grammarID = 59;
 	int done = 0;
 	
@@ -2107,11 +2334,8 @@ static int encode_dinContractAuthenticationReqType(bitstream_t* stream, struct d
 			if ( dinContractAuthenticationReqType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinContractAuthenticationReqType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinContractAuthenticationReqType->Id.characters, dinContractAuthenticationReqType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinContractAuthenticationReqType->Id.characters, dinContractAuthenticationReqType->Id.charactersLen);
 				}
 				grammarID = 60;
 			} else 			if ( dinContractAuthenticationReqType->GenChallenge_isUsed == 1u ) {
@@ -2120,11 +2344,8 @@ static int encode_dinContractAuthenticationReqType(bitstream_t* stream, struct d
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinContractAuthenticationReqType->GenChallenge.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinContractAuthenticationReqType->GenChallenge.characters, dinContractAuthenticationReqType->GenChallenge.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, dinContractAuthenticationReqType->GenChallenge.characters, dinContractAuthenticationReqType->GenChallenge.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -2148,11 +2369,8 @@ static int encode_dinContractAuthenticationReqType(bitstream_t* stream, struct d
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinContractAuthenticationReqType->GenChallenge.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinContractAuthenticationReqType->GenChallenge.characters, dinContractAuthenticationReqType->GenChallenge.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, dinContractAuthenticationReqType->GenChallenge.characters, dinContractAuthenticationReqType->GenChallenge.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -2190,9 +2408,11 @@ static int encode_dinContractAuthenticationReqType(bitstream_t* stream, struct d
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_ContractAuthenticationReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,DC_EVPowerDeliveryParameterType',  base type name='EVPowerDeliveryParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":DC_EVStatus,"urn:iso:15118:2:2010:MsgDataTypes":BulkChargingComplete{0-1},"urn:iso:15118:2:2010:MsgDataTypes":ChargingComplete)',  derivedBy='EXTENSION'.  */
 static int encode_dinDC_EVPowerDeliveryParameterType(bitstream_t* stream, struct dinDC_EVPowerDeliveryParameterType* dinDC_EVPowerDeliveryParameterType) {
+	int errn = 0;
 	int grammarID = 61;
 	int done = 0;
 	
@@ -2284,6 +2504,7 @@ static int encode_dinDC_EVPowerDeliveryParameterType(bitstream_t* stream, struct
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,EVSEChargeParameterType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_dinEVSEChargeParameterType(bitstream_t* stream, struct dinEVSEChargeParameterType* dinEVSEChargeParameterType) {
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -2314,7 +2535,9 @@ static int encode_dinEVSEChargeParameterType(bitstream_t* stream, struct dinEVSE
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CableCheckReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":DC_EVStatus)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CableCheckReq == SUPPORT_YES
 static int encode_dinCableCheckReqType(bitstream_t* stream, struct dinCableCheckReqType* dinCableCheckReqType) {
+	int errn = 0;
 	int grammarID = 55;
 	int done = 0;
 	
@@ -2355,9 +2578,11 @@ static int encode_dinCableCheckReqType(bitstream_t* stream, struct dinCableCheck
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_CableCheckReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,DC_EVChargeParameterType',  base type name='EVChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":DC_EVStatus,"urn:iso:15118:2:2010:MsgDataTypes":EVMaximumCurrentLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVMaximumPowerLimit{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVMaximumVoltageLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVEnergyCapacity{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVEnergyRequest{0-1},"urn:iso:15118:2:2010:MsgDataTypes":FullSOC{0-1},"urn:iso:15118:2:2010:MsgDataTypes":BulkSOC{0-1})',  derivedBy='EXTENSION'.  */
 static int encode_dinDC_EVChargeParameterType(bitstream_t* stream, struct dinDC_EVChargeParameterType* dinDC_EVChargeParameterType) {
+	int errn = 0;
 	int grammarID = 65;
 	int done = 0;
 	
@@ -2593,6 +2818,7 @@ static int encode_dinDC_EVChargeParameterType(bitstream_t* stream, struct dinDC_
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SAScheduleListType',  base type name='SASchedulesType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":SAScheduleTuple{1-UNBOUNDED})',  derivedBy='EXTENSION'.  */
 static int encode_dinSAScheduleListType(bitstream_t* stream, struct dinSAScheduleListType* dinSAScheduleListType) {
+	int errn = 0;
 	int grammarID = 73;
 	int done = 0;
 	
@@ -2643,6 +2869,7 @@ static int encode_dinSAScheduleListType(bitstream_t* stream, struct dinSASchedul
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,PMaxScheduleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":PMaxScheduleID,"urn:iso:15118:2:2010:MsgDataTypes":PMaxScheduleEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinPMaxScheduleType(bitstream_t* stream, struct dinPMaxScheduleType* dinPMaxScheduleType) {
+	int errn = 0;
 	int grammarID = 75;
 	int done = 0;
 	
@@ -2710,7 +2937,9 @@ static int encode_dinPMaxScheduleType(bitstream_t* stream, struct dinPMaxSchedul
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ServicePaymentSelectionReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":SelectedPaymentOption,"urn:iso:15118:2:2010:MsgBody":SelectedServiceList)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ServicePaymentSelectionReq == SUPPORT_YES
 static int encode_dinServicePaymentSelectionReqType(bitstream_t* stream, struct dinServicePaymentSelectionReqType* dinServicePaymentSelectionReqType) {
+	int errn = 0;
 	int grammarID = 78;
 	int done = 0;
 	
@@ -2769,9 +2998,11 @@ static int encode_dinServicePaymentSelectionReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_ServicePaymentSelectionReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,RelativeTimeIntervalType',  base type name='IntervalType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":start,"urn:iso:15118:2:2010:MsgDataTypes":duration{0-1})',  derivedBy='EXTENSION'.  */
 static int encode_dinRelativeTimeIntervalType(bitstream_t* stream, struct dinRelativeTimeIntervalType* dinRelativeTimeIntervalType) {
+	int errn = 0;
 	int grammarID = 80;
 	int done = 0;
 	
@@ -2844,7 +3075,9 @@ static int encode_dinRelativeTimeIntervalType(bitstream_t* stream, struct dinRel
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,EVStatusType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if DIN_DEPLOY_EVStatus == SUPPORT_YES
 static int encode_dinEVStatusType(bitstream_t* stream, struct dinEVStatusType* dinEVStatusType) {
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -2873,9 +3106,12 @@ static int encode_dinEVStatusType(bitstream_t* stream, struct dinEVStatusType* d
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_EVStatus */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,PreChargeResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2010:MsgBody":EVSEPresentVoltage)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_PreChargeRes == SUPPORT_YES
 static int encode_dinPreChargeResType(bitstream_t* stream, struct dinPreChargeResType* dinPreChargeResType) {
+	int errn = 0;
 	int grammarID = 13;
 	int done = 0;
 	
@@ -2946,9 +3182,11 @@ static int encode_dinPreChargeResType(bitstream_t* stream, struct dinPreChargeRe
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_PreChargeRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,DC_EVSEChargeParameterType',  base type name='EVSEChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":DC_EVSEStatus,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaximumCurrentLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaximumPowerLimit{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaximumVoltageLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMinimumCurrentLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMinimumVoltageLimit,"urn:iso:15118:2:2010:MsgDataTypes":EVSECurrentRegulationTolerance{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVSEPeakCurrentRipple,"urn:iso:15118:2:2010:MsgDataTypes":EVSEEnergyToBeDelivered{0-1})',  derivedBy='EXTENSION'.  */
 static int encode_dinDC_EVSEChargeParameterType(bitstream_t* stream, struct dinDC_EVSEChargeParameterType* dinDC_EVSEChargeParameterType) {
+	int errn = 0;
 	int grammarID = 82;
 	int done = 0;
 	
@@ -3105,7 +3343,9 @@ static int encode_dinDC_EVSEChargeParameterType(bitstream_t* stream, struct dinD
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,PaymentDetailsResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":GenChallenge,"urn:iso:15118:2:2010:MsgBody":DateTimeNow)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 static int encode_dinPaymentDetailsResType(bitstream_t* stream, struct dinPaymentDetailsResType* dinPaymentDetailsResType) {
+	int errn = 0;
 	int grammarID = 91;
 	int done = 0;
 	
@@ -3138,11 +3378,8 @@ static int encode_dinPaymentDetailsResType(bitstream_t* stream, struct dinPaymen
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinPaymentDetailsResType->GenChallenge.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinPaymentDetailsResType->GenChallenge.characters, dinPaymentDetailsResType->GenChallenge.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, dinPaymentDetailsResType->GenChallenge.characters, dinPaymentDetailsResType->GenChallenge.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -3192,9 +3429,11 @@ static int encode_dinPaymentDetailsResType(bitstream_t* stream, struct dinPaymen
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_PaymentDetailsRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":P,"http://www.w3.org/2000/09/xmldsig#":Q){0-1},"http://www.w3.org/2000/09/xmldsig#":G{0-1},"http://www.w3.org/2000/09/xmldsig#":Y,"http://www.w3.org/2000/09/xmldsig#":J{0-1},("http://www.w3.org/2000/09/xmldsig#":Seed,"http://www.w3.org/2000/09/xmldsig#":PgenCounter){0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueType* dinDSAKeyValueType) {
+	int errn = 0;
 	int grammarID = 94;
 	int done = 0;
 	
@@ -3445,6 +3684,7 @@ static int encode_dinDSAKeyValueType(bitstream_t* stream, struct dinDSAKeyValueT
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SASchedulesType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_dinSASchedulesType(bitstream_t* stream, struct dinSASchedulesType* dinSASchedulesType) {
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -3475,7 +3715,9 @@ static int encode_dinSASchedulesType(bitstream_t* stream, struct dinSASchedulesT
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CertificateUpdateResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2010:MsgBody":ContractSignatureEncryptedPrivateKey,"urn:iso:15118:2:2010:MsgBody":DHParams,"urn:iso:15118:2:2010:MsgBody":ContractID,"urn:iso:15118:2:2010:MsgBody":RetryCounter)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 static int encode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCertificateUpdateResType* dinCertificateUpdateResType) {
+	int errn = 0;
 	int grammarID = 101;
 	int done = 0;
 	
@@ -3487,11 +3729,8 @@ static int encode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCer
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinCertificateUpdateResType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinCertificateUpdateResType->Id.characters, dinCertificateUpdateResType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinCertificateUpdateResType->Id.characters, dinCertificateUpdateResType->Id.charactersLen);
 				}
 				grammarID = 102;
 			} else {
@@ -3578,11 +3817,8 @@ static int encode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCer
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinCertificateUpdateResType->ContractID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinCertificateUpdateResType->ContractID.characters, dinCertificateUpdateResType->ContractID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, dinCertificateUpdateResType->ContractID.characters, dinCertificateUpdateResType->ContractID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -3632,9 +3868,11 @@ static int encode_dinCertificateUpdateResType(bitstream_t* stream, struct dinCer
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_CertificateUpdateRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,EVChargeParameterType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_dinEVChargeParameterType(bitstream_t* stream, struct dinEVChargeParameterType* dinEVChargeParameterType) {
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -3666,6 +3904,7 @@ static int encode_dinEVChargeParameterType(bitstream_t* stream, struct dinEVChar
 
 /* Complex type name='urn:iso:15118:2:2010:MsgHeader,MessageHeaderType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgHeader":SessionID,"urn:iso:15118:2:2010:MsgHeader":Notification{0-1},"http://www.w3.org/2000/09/xmldsig#":Signature{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHeaderType* dinMessageHeaderType) {
+	int errn = 0;
 	int grammarID = 108;
 	int done = 0;
 	
@@ -3704,7 +3943,11 @@ static int encode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHea
 			} else 			if ( dinMessageHeaderType->Signature_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_dinSignatureType(stream, dinMessageHeaderType->Signature );
+#else
 					errn = encode_dinSignatureType(stream, &dinMessageHeaderType->Signature );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 4;
 			} else 			if (1==1) {
@@ -3722,7 +3965,11 @@ static int encode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHea
 			if ( dinMessageHeaderType->Signature_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_dinSignatureType(stream, dinMessageHeaderType->Signature );
+#else
 					errn = encode_dinSignatureType(stream, &dinMessageHeaderType->Signature );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 4;
 			} else 			if (1==1) {
@@ -3759,7 +4006,9 @@ static int encode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHea
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDef,BodyBaseType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if DIN_DEPLOY_BodyElement == SUPPORT_YES
 static int encode_dinBodyBaseType(bitstream_t* stream, struct dinBodyBaseType* dinBodyBaseType) {
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -3788,9 +4037,11 @@ static int encode_dinBodyBaseType(bitstream_t* stream, struct dinBodyBaseType* d
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_BodyElement */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyValueType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":DSAKeyValue|"http://www.w3.org/2000/09/xmldsig#":RSAKeyValue|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))',  derivedBy='RESTRICTION'.  */
 static int encode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* dinKeyValueType) {
+	int errn = 0;
 	int grammarID = 111;
 	int done = 0;
 	int wcDone = 0;
@@ -3803,7 +4054,11 @@ static int encode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* d
 			if ( dinKeyValueType->DSAKeyValue_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_dinDSAKeyValueType(stream, dinKeyValueType->DSAKeyValue );
+#else
 					errn = encode_dinDSAKeyValueType(stream, &dinKeyValueType->DSAKeyValue );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 112;
 			} else 			if ( dinKeyValueType->RSAKeyValue_isUsed == 1u ) {
@@ -3818,11 +4073,8 @@ static int encode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* d
 			} else 			if ( dinKeyValueType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyValueType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinKeyValueType->ANY.characters, dinKeyValueType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, dinKeyValueType->ANY.characters, dinKeyValueType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 113;
@@ -3841,11 +4093,8 @@ static int encode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* d
 			} else 			if ( dinKeyValueType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyValueType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinKeyValueType->ANY.characters, dinKeyValueType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, dinKeyValueType->ANY.characters, dinKeyValueType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 112;
@@ -3858,7 +4107,11 @@ static int encode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* d
 			if ( dinKeyValueType->DSAKeyValue_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_dinDSAKeyValueType(stream, dinKeyValueType->DSAKeyValue );
+#else
 					errn = encode_dinDSAKeyValueType(stream, &dinKeyValueType->DSAKeyValue );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 112;
 			} else 			if ( dinKeyValueType->RSAKeyValue_isUsed == 1u ) {
@@ -3873,11 +4126,8 @@ static int encode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* d
 			} else 			if ( dinKeyValueType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyValueType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinKeyValueType->ANY.characters, dinKeyValueType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, dinKeyValueType->ANY.characters, dinKeyValueType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 113;
@@ -3898,6 +4148,7 @@ static int encode_dinKeyValueType(bitstream_t* stream, struct dinKeyValueType* d
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,IntervalType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_dinIntervalType(bitstream_t* stream, struct dinIntervalType* dinIntervalType) {
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -3928,7 +4179,9 @@ static int encode_dinIntervalType(bitstream_t* stream, struct dinIntervalType* d
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ChargeParameterDiscoveryResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":EVSEProcessing,"urn:iso:15118:2:2010:MsgDataTypes":SASchedules,"urn:iso:15118:2:2010:MsgDataTypes":EVSEChargeParameter)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 static int encode_dinChargeParameterDiscoveryResType(bitstream_t* stream, struct dinChargeParameterDiscoveryResType* dinChargeParameterDiscoveryResType) {
+	int errn = 0;
 	int grammarID = 114;
 	int done = 0;
 	
@@ -4000,7 +4253,11 @@ static int encode_dinChargeParameterDiscoveryResType(bitstream_t* stream, struct
 			} else 			if ( dinChargeParameterDiscoveryResType->DC_EVSEChargeParameter_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_dinDC_EVSEChargeParameterType(stream, dinChargeParameterDiscoveryResType->DC_EVSEChargeParameter );
+#else
 					errn = encode_dinDC_EVSEChargeParameterType(stream, &dinChargeParameterDiscoveryResType->DC_EVSEChargeParameter );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 4;
 			} else 			if ( dinChargeParameterDiscoveryResType->EVSEChargeParameter_isUsed == 1u ) {
@@ -4035,9 +4292,12 @@ static int encode_dinChargeParameterDiscoveryResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,PowerDeliveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ReadyToChargeState,"urn:iso:15118:2:2010:MsgBody":ChargingProfile{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVPowerDeliveryParameter{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 static int encode_dinPowerDeliveryReqType(bitstream_t* stream, struct dinPowerDeliveryReqType* dinPowerDeliveryReqType) {
+	int errn = 0;
 	int grammarID = 118;
 	int done = 0;
 	
@@ -4138,9 +4398,11 @@ static int encode_dinPowerDeliveryReqType(bitstream_t* stream, struct dinPowerDe
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_PowerDeliveryReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,CertificateChainType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":Certificate,"urn:iso:15118:2:2010:MsgDataTypes":SubCertificates{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_dinCertificateChainType(bitstream_t* stream, struct dinCertificateChainType* dinCertificateChainType) {
+	int errn = 0;
 	int grammarID = 121;
 	int done = 0;
 	
@@ -4211,6 +4473,7 @@ static int encode_dinCertificateChainType(bitstream_t* stream, struct dinCertifi
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transform{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinTransformsType(bitstream_t* stream, struct dinTransformsType* dinTransformsType) {
+	int errn = 0;
 	int grammarID = 123;
 	int done = 0;
 	
@@ -4260,7 +4523,9 @@ static int encode_dinTransformsType(bitstream_t* stream, struct dinTransformsTyp
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,EntryType',  base type name='anyType',  content type='ELEMENT',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":TimeInterval)',  derivedBy='RESTRICTION'.  */
+#if DIN_DEPLOY_Entry == SUPPORT_YES
 static int encode_dinEntryType(bitstream_t* stream, struct dinEntryType* dinEntryType) {
+	int errn = 0;
 	int grammarID = 125;
 	int done = 0;
 	
@@ -4307,9 +4572,12 @@ static int encode_dinEntryType(bitstream_t* stream, struct dinEntryType* dinEntr
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_Entry */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,SessionStopType',  base type name='BodyBaseType',  content type='EMPTY',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_SessionStopReq == SUPPORT_YES
 static int encode_dinSessionStopType(bitstream_t* stream, struct dinSessionStopType* dinSessionStopType) {
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -4338,9 +4606,12 @@ static int encode_dinSessionStopType(bitstream_t* stream, struct dinSessionStopT
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_SessionStopReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ServiceDetailReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ServiceID)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ServiceDetailReq == SUPPORT_YES
 static int encode_dinServiceDetailReqType(bitstream_t* stream, struct dinServiceDetailReqType* dinServiceDetailReqType) {
+	int errn = 0;
 	int grammarID = 126;
 	int done = 0;
 	
@@ -4387,9 +4658,11 @@ static int encode_dinServiceDetailReqType(bitstream_t* stream, struct dinService
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_ServiceDetailReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DigestMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMethodType* dinDigestMethodType) {
+	int errn = 0;
 	int grammarID = 18;
 	int done = 0;
 	int wcDone = 0;
@@ -4402,11 +4675,8 @@ static int encode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMetho
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinDigestMethodType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinDigestMethodType->Algorithm.characters, dinDigestMethodType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 23 /* {}Algorithm */, dinDigestMethodType->Algorithm.characters, dinDigestMethodType->Algorithm.charactersLen);
 				}
 				grammarID = 19;
 			} else {
@@ -4427,11 +4697,8 @@ static int encode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMetho
 			} else 			if ( dinDigestMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinDigestMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinDigestMethodType->ANY.characters, dinDigestMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, dinDigestMethodType->ANY.characters, dinDigestMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 20;
@@ -4453,11 +4720,8 @@ static int encode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMetho
 			} else 			if ( dinDigestMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinDigestMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinDigestMethodType->ANY.characters, dinDigestMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, dinDigestMethodType->ANY.characters, dinDigestMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 20;
@@ -4478,6 +4742,7 @@ static int encode_dinDigestMethodType(bitstream_t* stream, struct dinDigestMetho
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ParameterType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":boolValue|"urn:iso:15118:2:2010:MsgDataTypes":byteValue|"urn:iso:15118:2:2010:MsgDataTypes":shortValue|"urn:iso:15118:2:2010:MsgDataTypes":intValue|"urn:iso:15118:2:2010:MsgDataTypes":physicalValue|"urn:iso:15118:2:2010:MsgDataTypes":stringValue)',  derivedBy='RESTRICTION'.  */
 static int encode_dinParameterType(bitstream_t* stream, struct dinParameterType* dinParameterType) {
+	int errn = 0;
 	int grammarID = 127;
 	int done = 0;
 	
@@ -4489,11 +4754,8 @@ static int encode_dinParameterType(bitstream_t* stream, struct dinParameterType*
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinParameterType->Name.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinParameterType->Name.characters, dinParameterType->Name.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Name */, dinParameterType->Name.characters, dinParameterType->Name.charactersLen);
 				}
 				grammarID = 128;
 			} else {
@@ -4574,11 +4836,8 @@ static int encode_dinParameterType(bitstream_t* stream, struct dinParameterType*
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinParameterType->stringValue.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinParameterType->stringValue.characters, dinParameterType->stringValue.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 22 /* {urn:iso:15118:2:2010:MsgDataTypes}stringValue */, dinParameterType->stringValue.characters, dinParameterType->stringValue.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -4612,7 +4871,9 @@ static int encode_dinParameterType(bitstream_t* stream, struct dinParameterType*
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ChargingStatusReqType',  base type name='BodyBaseType',  content type='EMPTY',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ChargingStatusReq == SUPPORT_YES
 static int encode_dinChargingStatusReqType(bitstream_t* stream, struct dinChargingStatusReqType* dinChargingStatusReqType) {
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -4641,9 +4902,11 @@ static int encode_dinChargingStatusReqType(bitstream_t* stream, struct dinChargi
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_ChargingStatusReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":HMACOutputLength{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatureMethodType* dinSignatureMethodType) {
+	int errn = 0;
 	int grammarID = 130;
 	int done = 0;
 	int wcDone = 0;
@@ -4656,11 +4919,8 @@ static int encode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatur
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignatureMethodType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignatureMethodType->Algorithm.characters, dinSignatureMethodType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 23 /* {}Algorithm */, dinSignatureMethodType->Algorithm.characters, dinSignatureMethodType->Algorithm.charactersLen);
 				}
 				grammarID = 131;
 			} else {
@@ -4693,11 +4953,8 @@ static int encode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatur
 			} else 			if ( dinSignatureMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignatureMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignatureMethodType->ANY.characters, dinSignatureMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, dinSignatureMethodType->ANY.characters, dinSignatureMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 132;
@@ -4719,11 +4976,8 @@ static int encode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatur
 			} else 			if ( dinSignatureMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignatureMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignatureMethodType->ANY.characters, dinSignatureMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, dinSignatureMethodType->ANY.characters, dinSignatureMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 20;
@@ -4757,11 +5011,8 @@ static int encode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatur
 			} else 			if ( dinSignatureMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignatureMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignatureMethodType->ANY.characters, dinSignatureMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, dinSignatureMethodType->ANY.characters, dinSignatureMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 132;
@@ -4781,7 +5032,9 @@ static int encode_dinSignatureMethodType(bitstream_t* stream, struct dinSignatur
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CertificateInstallationReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":OEMProvisioningCert,"urn:iso:15118:2:2010:MsgBody":ListOfRootCertificateIDs,"urn:iso:15118:2:2010:MsgBody":DHParams)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 static int encode_dinCertificateInstallationReqType(bitstream_t* stream, struct dinCertificateInstallationReqType* dinCertificateInstallationReqType) {
+	int errn = 0;
 	int grammarID = 133;
 	int done = 0;
 	
@@ -4793,11 +5046,8 @@ static int encode_dinCertificateInstallationReqType(bitstream_t* stream, struct
 			if ( dinCertificateInstallationReqType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinCertificateInstallationReqType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinCertificateInstallationReqType->Id.characters, dinCertificateInstallationReqType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinCertificateInstallationReqType->Id.characters, dinCertificateInstallationReqType->Id.charactersLen);
 				}
 				grammarID = 134;
 			} else 			if ( 1 == 1 ) {
@@ -4895,9 +5145,11 @@ static int encode_dinCertificateInstallationReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_CertificateInstallationReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SalesTariffEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2010:MsgDataTypes":TimeInterval),("urn:iso:15118:2:2010:MsgDataTypes":EPriceLevel,"urn:iso:15118:2:2010:MsgDataTypes":ConsumptionCost{0-UNBOUNDED}))',  derivedBy='EXTENSION'.  */
 static int encode_dinSalesTariffEntryType(bitstream_t* stream, struct dinSalesTariffEntryType* dinSalesTariffEntryType) {
+	int errn = 0;
 	int grammarID = 137;
 	int done = 0;
 	
@@ -4971,7 +5223,9 @@ static int encode_dinSalesTariffEntryType(bitstream_t* stream, struct dinSalesTa
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ServiceDiscoveryResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":PaymentOptions,"urn:iso:15118:2:2010:MsgBody":ChargeService,"urn:iso:15118:2:2010:MsgBody":ServiceList{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 static int encode_dinServiceDiscoveryResType(bitstream_t* stream, struct dinServiceDiscoveryResType* dinServiceDiscoveryResType) {
+	int errn = 0;
 	int grammarID = 140;
 	int done = 0;
 	
@@ -5060,9 +5314,11 @@ static int encode_dinServiceDiscoveryResType(bitstream_t* stream, struct dinServ
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_ServiceDiscoveryRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ParameterSetType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ParameterSetID,"urn:iso:15118:2:2010:MsgDataTypes":Parameter{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinParameterSetType(bitstream_t* stream, struct dinParameterSetType* dinParameterSetType) {
+	int errn = 0;
 	int grammarID = 144;
 	int done = 0;
 	
@@ -5130,7 +5386,9 @@ static int encode_dinParameterSetType(bitstream_t* stream, struct dinParameterSe
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CurrentDemandReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":DC_EVStatus,"urn:iso:15118:2:2010:MsgBody":EVTargetCurrent,"urn:iso:15118:2:2010:MsgBody":EVMaximumVoltageLimit{0-1},"urn:iso:15118:2:2010:MsgBody":EVMaximumCurrentLimit{0-1},"urn:iso:15118:2:2010:MsgBody":EVMaximumPowerLimit{0-1},"urn:iso:15118:2:2010:MsgBody":BulkChargingComplete{0-1},"urn:iso:15118:2:2010:MsgBody":ChargingComplete,"urn:iso:15118:2:2010:MsgBody":RemainingTimeToFullSoC{0-1},"urn:iso:15118:2:2010:MsgBody":RemainingTimeToBulkSoC{0-1},"urn:iso:15118:2:2010:MsgBody":EVTargetVoltage)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CurrentDemandReq == SUPPORT_YES
 static int encode_dinCurrentDemandReqType(bitstream_t* stream, struct dinCurrentDemandReqType* dinCurrentDemandReqType) {
+	int errn = 0;
 	int grammarID = 147;
 	int done = 0;
 	
@@ -5411,9 +5669,12 @@ static int encode_dinCurrentDemandReqType(bitstream_t* stream, struct dinCurrent
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_CurrentDemandReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,PreChargeReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":DC_EVStatus,"urn:iso:15118:2:2010:MsgBody":EVTargetVoltage,"urn:iso:15118:2:2010:MsgBody":EVTargetCurrent)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_PreChargeReq == SUPPORT_YES
 static int encode_dinPreChargeReqType(bitstream_t* stream, struct dinPreChargeReqType* dinPreChargeReqType) {
+	int errn = 0;
 	int grammarID = 157;
 	int done = 0;
 	
@@ -5478,9 +5739,11 @@ static int encode_dinPreChargeReqType(bitstream_t* stream, struct dinPreChargeRe
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_PreChargeReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignedInfo,"http://www.w3.org/2000/09/xmldsig#":SignatureValue,"http://www.w3.org/2000/09/xmldsig#":KeyInfo{0-1},"http://www.w3.org/2000/09/xmldsig#":Object{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinSignatureType(bitstream_t* stream, struct dinSignatureType* dinSignatureType) {
+	int errn = 0;
 	int grammarID = 160;
 	int done = 0;
 	
@@ -5493,11 +5756,8 @@ static int encode_dinSignatureType(bitstream_t* stream, struct dinSignatureType*
 			if ( dinSignatureType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignatureType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignatureType->Id.characters, dinSignatureType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinSignatureType->Id.characters, dinSignatureType->Id.charactersLen);
 				}
 				grammarID = 161;
 			} else 			if ( 1 == 1 ) {
@@ -5539,7 +5799,11 @@ static int encode_dinSignatureType(bitstream_t* stream, struct dinSignatureType*
 			if ( dinSignatureType->KeyInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_dinKeyInfoType(stream, dinSignatureType->KeyInfo );
+#else
 					errn = encode_dinKeyInfoType(stream, &dinSignatureType->KeyInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 164;
 			} else 			if (dinSignatureType_Object_currArrayIndex < dinSignatureType->Object.arrayLen ) {
@@ -5589,6 +5853,7 @@ static int encode_dinSignatureType(bitstream_t* stream, struct dinSignatureType*
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
 static int encode_dinReferenceType(bitstream_t* stream, struct dinReferenceType* dinReferenceType) {
+	int errn = 0;
 	int grammarID = 165;
 	int done = 0;
 	
@@ -5600,31 +5865,22 @@ static int encode_dinReferenceType(bitstream_t* stream, struct dinReferenceType*
 			if ( dinReferenceType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinReferenceType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinReferenceType->Id.characters, dinReferenceType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinReferenceType->Id.characters, dinReferenceType->Id.charactersLen);
 				}
 				grammarID = 166;
 			} else 			if ( dinReferenceType->Type_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinReferenceType->Type.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinReferenceType->Type.characters, dinReferenceType->Type.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 29 /* {}Type */, dinReferenceType->Type.characters, dinReferenceType->Type.charactersLen);
 				}
 				grammarID = 167;
 			} else 			if ( dinReferenceType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinReferenceType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinReferenceType->URI.characters, dinReferenceType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 30 /* {}URI */, dinReferenceType->URI.characters, dinReferenceType->URI.charactersLen);
 				}
 				grammarID = 168;
 			} else 			if ( dinReferenceType->Transforms_isUsed == 1u ) {
@@ -5648,21 +5904,15 @@ static int encode_dinReferenceType(bitstream_t* stream, struct dinReferenceType*
 			if ( dinReferenceType->Type_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinReferenceType->Type.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinReferenceType->Type.characters, dinReferenceType->Type.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 29 /* {}Type */, dinReferenceType->Type.characters, dinReferenceType->Type.charactersLen);
 				}
 				grammarID = 167;
 			} else 			if ( dinReferenceType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinReferenceType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinReferenceType->URI.characters, dinReferenceType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 30 /* {}URI */, dinReferenceType->URI.characters, dinReferenceType->URI.charactersLen);
 				}
 				grammarID = 168;
 			} else 			if ( dinReferenceType->Transforms_isUsed == 1u ) {
@@ -5686,11 +5936,8 @@ static int encode_dinReferenceType(bitstream_t* stream, struct dinReferenceType*
 			if ( dinReferenceType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinReferenceType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinReferenceType->URI.characters, dinReferenceType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 30 /* {}URI */, dinReferenceType->URI.characters, dinReferenceType->URI.charactersLen);
 				}
 				grammarID = 168;
 			} else 			if ( dinReferenceType->Transforms_isUsed == 1u ) {
@@ -5785,6 +6032,7 @@ static int encode_dinReferenceType(bitstream_t* stream, struct dinReferenceType*
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ProfileEntryType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ChargingProfileEntryStart,"urn:iso:15118:2:2010:MsgDataTypes":ChargingProfileEntryMaxPower)',  derivedBy='RESTRICTION'.  */
 static int encode_dinProfileEntryType(bitstream_t* stream, struct dinProfileEntryType* dinProfileEntryType) {
+	int errn = 0;
 	int grammarID = 171;
 	int done = 0;
 	
@@ -5852,6 +6100,7 @@ static int encode_dinProfileEntryType(bitstream_t* stream, struct dinProfileEntr
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDef,#AnonType_V2G_Message',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDef":Header,"urn:iso:15118:2:2010:MsgDef":Body)',  derivedBy='RESTRICTION'.  */
 static int encode_dinAnonType_V2G_Message(bitstream_t* stream, struct dinAnonType_V2G_Message* dinAnonType_V2G_Message) {
+	int errn = 0;
 	int grammarID = 173;
 	int done = 0;
 	
@@ -5906,7 +6155,9 @@ static int encode_dinAnonType_V2G_Message(bitstream_t* stream, struct dinAnonTyp
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ChargeParameterDiscoveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":EVRequestedEnergyTransferType,"urn:iso:15118:2:2010:MsgDataTypes":EVChargeParameter)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 static int encode_dinChargeParameterDiscoveryReqType(bitstream_t* stream, struct dinChargeParameterDiscoveryReqType* dinChargeParameterDiscoveryReqType) {
+	int errn = 0;
 	int grammarID = 175;
 	int done = 0;
 	
@@ -5977,9 +6228,11 @@ static int encode_dinChargeParameterDiscoveryReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ConsumptionCostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":startValue,"urn:iso:15118:2:2010:MsgDataTypes":Cost{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinConsumptionCostType(bitstream_t* stream, struct dinConsumptionCostType* dinConsumptionCostType) {
+	int errn = 0;
 	int grammarID = 177;
 	int done = 0;
 	
@@ -6036,6 +6289,7 @@ static int encode_dinConsumptionCostType(bitstream_t* stream, struct dinConsumpt
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Modulus,"http://www.w3.org/2000/09/xmldsig#":Exponent)',  derivedBy='RESTRICTION'.  */
 static int encode_dinRSAKeyValueType(bitstream_t* stream, struct dinRSAKeyValueType* dinRSAKeyValueType) {
+	int errn = 0;
 	int grammarID = 179;
 	int done = 0;
 	
@@ -6109,6 +6363,7 @@ static int encode_dinRSAKeyValueType(bitstream_t* stream, struct dinRSAKeyValueT
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ServiceTag,"urn:iso:15118:2:2010:MsgDataTypes":FreeService)',  derivedBy='RESTRICTION'.  */
 static int encode_dinServiceType(bitstream_t* stream, struct dinServiceType* dinServiceType) {
+	int errn = 0;
 	int grammarID = 181;
 	int done = 0;
 	
@@ -6170,6 +6425,7 @@ static int encode_dinServiceType(bitstream_t* stream, struct dinServiceType* din
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ServiceTagListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":Service{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinServiceTagListType(bitstream_t* stream, struct dinServiceTagListType* dinServiceTagListType) {
+	int errn = 0;
 	int grammarID = 183;
 	int done = 0;
 	
@@ -6220,6 +6476,7 @@ static int encode_dinServiceTagListType(bitstream_t* stream, struct dinServiceTa
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,EVSEStatusType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_dinEVSEStatusType(bitstream_t* stream, struct dinEVSEStatusType* dinEVSEStatusType) {
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -6250,7 +6507,9 @@ static int encode_dinEVSEStatusType(bitstream_t* stream, struct dinEVSEStatusTyp
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,SessionSetupResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":EVSEID,"urn:iso:15118:2:2010:MsgBody":DateTimeNow{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_SessionSetupRes == SUPPORT_YES
 static int encode_dinSessionSetupResType(bitstream_t* stream, struct dinSessionSetupResType* dinSessionSetupResType) {
+	int errn = 0;
 	int grammarID = 185;
 	int done = 0;
 	
@@ -6342,9 +6601,11 @@ static int encode_dinSessionSetupResType(bitstream_t* stream, struct dinSessionS
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_SessionSetupRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,EVPowerDeliveryParameterType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_dinEVPowerDeliveryParameterType(bitstream_t* stream, struct dinEVPowerDeliveryParameterType* dinEVPowerDeliveryParameterType) {
+	int errn = 0;
 	int grammarID = 64;
 	int done = 0;
 	
@@ -6376,6 +6637,7 @@ static int encode_dinEVPowerDeliveryParameterType(bitstream_t* stream, struct di
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509IssuerSerialType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":X509IssuerName,"http://www.w3.org/2000/09/xmldsig#":X509SerialNumber)',  derivedBy='RESTRICTION'.  */
 static int encode_dinX509IssuerSerialType(bitstream_t* stream, struct dinX509IssuerSerialType* dinX509IssuerSerialType) {
+	int errn = 0;
 	int grammarID = 188;
 	int done = 0;
 	
@@ -6390,11 +6652,8 @@ static int encode_dinX509IssuerSerialType(bitstream_t* stream, struct dinX509Iss
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinX509IssuerSerialType->X509IssuerName.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinX509IssuerSerialType->X509IssuerName.characters, dinX509IssuerSerialType->X509IssuerName.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, dinX509IssuerSerialType->X509IssuerName.characters, dinX509IssuerSerialType->X509IssuerName.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -6447,6 +6706,7 @@ static int encode_dinX509IssuerSerialType(bitstream_t* stream, struct dinX509Iss
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SelectedServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ServiceID,"urn:iso:15118:2:2010:MsgDataTypes":ParameterSetID{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_dinSelectedServiceType(bitstream_t* stream, struct dinSelectedServiceType* dinSelectedServiceType) {
+	int errn = 0;
 	int grammarID = 190;
 	int done = 0;
 	
@@ -6519,7 +6779,9 @@ static int encode_dinSelectedServiceType(bitstream_t* stream, struct dinSelected
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,MeteringReceiptResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":AC_EVSEStatus)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 static int encode_dinMeteringReceiptResType(bitstream_t* stream, struct dinMeteringReceiptResType* dinMeteringReceiptResType) {
+	int errn = 0;
 	int grammarID = 192;
 	int done = 0;
 	
@@ -6578,9 +6840,11 @@ static int encode_dinMeteringReceiptResType(bitstream_t* stream, struct dinMeter
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_MeteringReceiptRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,DC_EVStatusType',  base type name='EVStatusType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":EVReady,"urn:iso:15118:2:2010:MsgDataTypes":EVCabinConditioning{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVRESSConditioning{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVErrorCode,"urn:iso:15118:2:2010:MsgDataTypes":EVRESSSOC)',  derivedBy='EXTENSION'.  */
 static int encode_dinDC_EVStatusType(bitstream_t* stream, struct dinDC_EVStatusType* dinDC_EVStatusType) {
+	int errn = 0;
 	int grammarID = 193;
 	int done = 0;
 	
@@ -6738,6 +7002,7 @@ static int encode_dinDC_EVStatusType(bitstream_t* stream, struct dinDC_EVStatusT
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,PhysicalValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":Multiplier,"urn:iso:15118:2:2010:MsgDataTypes":Unit{0-1},"urn:iso:15118:2:2010:MsgDataTypes":Value)',  derivedBy='RESTRICTION'.  */
 static int encode_dinPhysicalValueType(bitstream_t* stream, struct dinPhysicalValueType* dinPhysicalValueType) {
+	int errn = 0;
 	int grammarID = 198;
 	int done = 0;
 	
@@ -6834,7 +7099,9 @@ static int encode_dinPhysicalValueType(bitstream_t* stream, struct dinPhysicalVa
 }
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ManifestType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if DIN_DEPLOY_Manifest == SUPPORT_YES
 static int encode_dinManifestType(bitstream_t* stream, struct dinManifestType* dinManifestType) {
+	int errn = 0;
 	int grammarID = 201;
 	int done = 0;
 	
@@ -6847,11 +7114,8 @@ static int encode_dinManifestType(bitstream_t* stream, struct dinManifestType* d
 			if ( dinManifestType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinManifestType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinManifestType->Id.characters, dinManifestType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinManifestType->Id.characters, dinManifestType->Id.charactersLen);
 				}
 				grammarID = 202;
 			} else 			if (dinManifestType_Reference_currArrayIndex < dinManifestType->Reference.arrayLen ) {
@@ -6904,9 +7168,11 @@ static int encode_dinManifestType(bitstream_t* stream, struct dinManifestType* d
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_Manifest */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,PMaxScheduleEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2010:MsgDataTypes":TimeInterval),("urn:iso:15118:2:2010:MsgDataTypes":PMax))',  derivedBy='EXTENSION'.  */
 static int encode_dinPMaxScheduleEntryType(bitstream_t* stream, struct dinPMaxScheduleEntryType* dinPMaxScheduleEntryType) {
+	int errn = 0;
 	int grammarID = 204;
 	int done = 0;
 	
@@ -6974,6 +7240,7 @@ static int encode_dinPMaxScheduleEntryType(bitstream_t* stream, struct dinPMaxSc
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ServiceParameterListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ParameterSet{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinServiceParameterListType(bitstream_t* stream, struct dinServiceParameterListType* dinServiceParameterListType) {
+	int errn = 0;
 	int grammarID = 206;
 	int done = 0;
 	
@@ -7024,6 +7291,7 @@ static int encode_dinServiceParameterListType(bitstream_t* stream, struct dinSer
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureValueType',  base type name='base64Binary',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 static int encode_dinSignatureValueType(bitstream_t* stream, struct dinSignatureValueType* dinSignatureValueType) {
+	int errn = 0;
 	int grammarID = 208;
 	int done = 0;
 	
@@ -7035,11 +7303,8 @@ static int encode_dinSignatureValueType(bitstream_t* stream, struct dinSignature
 			if ( dinSignatureValueType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignatureValueType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignatureValueType->Id.characters, dinSignatureValueType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinSignatureValueType->Id.characters, dinSignatureValueType->Id.charactersLen);
 				}
 				grammarID = 209;
 			} else 			if (1==1) {
@@ -7095,6 +7360,7 @@ static int encode_dinSignatureValueType(bitstream_t* stream, struct dinSignature
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,PaymentOptionsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":PaymentOption{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinPaymentOptionsType(bitstream_t* stream, struct dinPaymentOptionsType* dinPaymentOptionsType) {
+	int errn = 0;
 	int grammarID = 210;
 	int done = 0;
 	
@@ -7157,6 +7423,7 @@ static int encode_dinPaymentOptionsType(bitstream_t* stream, struct dinPaymentOp
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ServiceTagType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":ServiceID,"urn:iso:15118:2:2010:MsgDataTypes":ServiceName{0-1},"urn:iso:15118:2:2010:MsgDataTypes":ServiceCategory,"urn:iso:15118:2:2010:MsgDataTypes":ServiceScope{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_dinServiceTagType(bitstream_t* stream, struct dinServiceTagType* dinServiceTagType) {
+	int errn = 0;
 	int grammarID = 212;
 	int done = 0;
 	
@@ -7189,11 +7456,8 @@ static int encode_dinServiceTagType(bitstream_t* stream, struct dinServiceTagTyp
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinServiceTagType->ServiceName.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinServiceTagType->ServiceName.characters, dinServiceTagType->ServiceName.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 20 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceName */, dinServiceTagType->ServiceName.characters, dinServiceTagType->ServiceName.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -7241,11 +7505,8 @@ static int encode_dinServiceTagType(bitstream_t* stream, struct dinServiceTagTyp
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinServiceTagType->ServiceScope.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinServiceTagType->ServiceScope.characters, dinServiceTagType->ServiceScope.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 21 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceScope */, dinServiceTagType->ServiceScope.characters, dinServiceTagType->ServiceScope.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -7286,6 +7547,7 @@ static int encode_dinServiceTagType(bitstream_t* stream, struct dinServiceTagTyp
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,AC_EVSEStatusType',  base type name='EVSEStatusType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":PowerSwitchClosed,"urn:iso:15118:2:2010:MsgDataTypes":RCD,"urn:iso:15118:2:2010:MsgDataTypes":NotificationMaxDelay,"urn:iso:15118:2:2010:MsgDataTypes":EVSENotification)',  derivedBy='EXTENSION'.  */
 static int encode_dinAC_EVSEStatusType(bitstream_t* stream, struct dinAC_EVSEStatusType* dinAC_EVSEStatusType) {
+	int errn = 0;
 	int grammarID = 216;
 	int done = 0;
 	
@@ -7388,7 +7650,9 @@ static int encode_dinAC_EVSEStatusType(bitstream_t* stream, struct dinAC_EVSESta
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CertificateUpdateReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2010:MsgBody":ContractID,"urn:iso:15118:2:2010:MsgBody":ListOfRootCertificateIDs,"urn:iso:15118:2:2010:MsgBody":DHParams)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 static int encode_dinCertificateUpdateReqType(bitstream_t* stream, struct dinCertificateUpdateReqType* dinCertificateUpdateReqType) {
+	int errn = 0;
 	int grammarID = 220;
 	int done = 0;
 	
@@ -7400,11 +7664,8 @@ static int encode_dinCertificateUpdateReqType(bitstream_t* stream, struct dinCer
 			if ( dinCertificateUpdateReqType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinCertificateUpdateReqType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinCertificateUpdateReqType->Id.characters, dinCertificateUpdateReqType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinCertificateUpdateReqType->Id.characters, dinCertificateUpdateReqType->Id.charactersLen);
 				}
 				grammarID = 221;
 			} else 			if ( 1 == 1 ) {
@@ -7437,11 +7698,8 @@ static int encode_dinCertificateUpdateReqType(bitstream_t* stream, struct dinCer
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinCertificateUpdateReqType->ContractID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinCertificateUpdateReqType->ContractID.characters, dinCertificateUpdateReqType->ContractID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, dinCertificateUpdateReqType->ContractID.characters, dinCertificateUpdateReqType->ContractID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -7506,9 +7764,12 @@ static int encode_dinCertificateUpdateReqType(bitstream_t* stream, struct dinCer
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_CertificateUpdateReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ServicePaymentSelectionResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ServicePaymentSelectionRes == SUPPORT_YES
 static int encode_dinServicePaymentSelectionResType(bitstream_t* stream, struct dinServicePaymentSelectionResType* dinServicePaymentSelectionResType) {
+	int errn = 0;
 	int grammarID = 223;
 	int done = 0;
 	
@@ -7555,9 +7816,11 @@ static int encode_dinServicePaymentSelectionResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_ServicePaymentSelectionRes */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SAScheduleTupleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":SAScheduleTupleID,"urn:iso:15118:2:2010:MsgDataTypes":PMaxSchedule,"urn:iso:15118:2:2010:MsgDataTypes":SalesTariff{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_dinSAScheduleTupleType(bitstream_t* stream, struct dinSAScheduleTupleType* dinSAScheduleTupleType) {
+	int errn = 0;
 	int grammarID = 224;
 	int done = 0;
 	
@@ -7637,6 +7900,7 @@ static int encode_dinSAScheduleTupleType(bitstream_t* stream, struct dinSASchedu
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ChargingProfileType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":SAScheduleTupleID,"urn:iso:15118:2:2010:MsgDataTypes":ProfileEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinChargingProfileType(bitstream_t* stream, struct dinChargingProfileType* dinChargingProfileType) {
+	int errn = 0;
 	int grammarID = 227;
 	int done = 0;
 	
@@ -7704,7 +7968,9 @@ static int encode_dinChargingProfileType(bitstream_t* stream, struct dinCharging
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,ServiceDiscoveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ServiceScope{0-1},"urn:iso:15118:2:2010:MsgBody":ServiceCategory{0-1})',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 static int encode_dinServiceDiscoveryReqType(bitstream_t* stream, struct dinServiceDiscoveryReqType* dinServiceDiscoveryReqType) {
+	int errn = 0;
 	int grammarID = 230;
 	int done = 0;
 	
@@ -7719,11 +7985,8 @@ static int encode_dinServiceDiscoveryReqType(bitstream_t* stream, struct dinServ
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinServiceDiscoveryReqType->ServiceScope.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinServiceDiscoveryReqType->ServiceScope.characters, dinServiceDiscoveryReqType->ServiceScope.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 15 /* {urn:iso:15118:2:2010:MsgBody}ServiceScope */, dinServiceDiscoveryReqType->ServiceScope.characters, dinServiceDiscoveryReqType->ServiceScope.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -7797,9 +8060,11 @@ static int encode_dinServiceDiscoveryReqType(bitstream_t* stream, struct dinServ
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_ServiceDiscoveryReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,AC_EVSEChargeParameterType',  base type name='EVSEChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":AC_EVSEStatus,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaxVoltage,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMaxCurrent,"urn:iso:15118:2:2010:MsgDataTypes":EVSEMinCurrent)',  derivedBy='EXTENSION'.  */
 static int encode_dinAC_EVSEChargeParameterType(bitstream_t* stream, struct dinAC_EVSEChargeParameterType* dinAC_EVSEChargeParameterType) {
+	int errn = 0;
 	int grammarID = 232;
 	int done = 0;
 	
@@ -7879,6 +8144,7 @@ static int encode_dinAC_EVSEChargeParameterType(bitstream_t* stream, struct dinA
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyInfoType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":KeyName|"http://www.w3.org/2000/09/xmldsig#":KeyValue|"http://www.w3.org/2000/09/xmldsig#":RetrievalMethod|"http://www.w3.org/2000/09/xmldsig#":X509Data|"http://www.w3.org/2000/09/xmldsig#":PGPData|"http://www.w3.org/2000/09/xmldsig#":SPKIData|"http://www.w3.org/2000/09/xmldsig#":MgmtData|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* dinKeyInfoType) {
+	int errn = 0;
 	int grammarID = 236;
 	int done = 0;
 	int wcDone = 0;
@@ -7898,11 +8164,8 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 			if ( dinKeyInfoType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinKeyInfoType->Id.characters, dinKeyInfoType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinKeyInfoType->Id.characters, dinKeyInfoType->Id.charactersLen);
 				}
 				grammarID = 237;
 			} else 			if (dinKeyInfoType_KeyName_currArrayIndex < dinKeyInfoType->KeyName.arrayLen ) {
@@ -7911,10 +8174,9 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].characters, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].characters, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].charactersLen);
 							dinKeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -7958,10 +8220,9 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].characters, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].characters, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							dinKeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -7975,11 +8236,8 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 			} else 			if ( dinKeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 9);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinKeyInfoType->ANY.characters, dinKeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, dinKeyInfoType->ANY.characters, dinKeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 239;
@@ -7995,10 +8253,9 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].characters, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].characters, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].charactersLen);
 							dinKeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -8042,10 +8299,9 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].characters, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].characters, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							dinKeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -8059,11 +8315,8 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 			} else 			if ( dinKeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 8);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinKeyInfoType->ANY.characters, dinKeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, dinKeyInfoType->ANY.characters, dinKeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 239;
@@ -8079,10 +8332,9 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].characters, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].characters, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].charactersLen);
 							dinKeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -8126,10 +8378,9 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].characters, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].characters, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							dinKeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -8149,11 +8400,8 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 			} else 			if ( dinKeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 9);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinKeyInfoType->ANY.characters, dinKeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, dinKeyInfoType->ANY.characters, dinKeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 238;
@@ -8169,10 +8417,9 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].characters, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].characters, dinKeyInfoType->KeyName.array[dinKeyInfoType_KeyName_currArrayIndex].charactersLen);
 							dinKeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -8216,10 +8463,9 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].characters, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].characters, dinKeyInfoType->MgmtData.array[dinKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							dinKeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -8233,11 +8479,8 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 			} else 			if ( dinKeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 8);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinKeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinKeyInfoType->ANY.characters, dinKeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, dinKeyInfoType->ANY.characters, dinKeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 239;
@@ -8257,7 +8500,9 @@ static int encode_dinKeyInfoType(bitstream_t* stream, struct dinKeyInfoType* din
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,PaymentDetailsReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ContractID,"urn:iso:15118:2:2010:MsgBody":ContractSignatureCertChain)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 static int encode_dinPaymentDetailsReqType(bitstream_t* stream, struct dinPaymentDetailsReqType* dinPaymentDetailsReqType) {
+	int errn = 0;
 	int grammarID = 240;
 	int done = 0;
 	
@@ -8272,11 +8517,8 @@ static int encode_dinPaymentDetailsReqType(bitstream_t* stream, struct dinPaymen
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinPaymentDetailsReqType->ContractID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinPaymentDetailsReqType->ContractID.characters, dinPaymentDetailsReqType->ContractID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, dinPaymentDetailsReqType->ContractID.characters, dinPaymentDetailsReqType->ContractID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -8320,9 +8562,12 @@ static int encode_dinPaymentDetailsReqType(bitstream_t* stream, struct dinPaymen
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_PaymentDetailsReq */
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CableCheckResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2010:MsgBody":EVSEProcessing)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CableCheckRes == SUPPORT_YES
 static int encode_dinCableCheckResType(bitstream_t* stream, struct dinCableCheckResType* dinCableCheckResType) {
+	int errn = 0;
 	int grammarID = 242;
 	int done = 0;
 	
@@ -8399,9 +8644,11 @@ static int encode_dinCableCheckResType(bitstream_t* stream, struct dinCableCheck
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_CableCheckRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ObjectType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any])){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinObjectType) {
+	int errn = 0;
 	int grammarID = 244;
 	int done = 0;
 	int wcDone = 0;
@@ -8414,31 +8661,22 @@ static int encode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 			if ( dinObjectType->Encoding_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinObjectType->Encoding.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinObjectType->Encoding.characters, dinObjectType->Encoding.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 24 /* {}Encoding */, dinObjectType->Encoding.characters, dinObjectType->Encoding.charactersLen);
 				}
 				grammarID = 245;
 			} else 			if ( dinObjectType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinObjectType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinObjectType->Id.characters, dinObjectType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinObjectType->Id.characters, dinObjectType->Id.charactersLen);
 				}
 				grammarID = 246;
 			} else 			if ( dinObjectType->MimeType_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinObjectType->MimeType.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinObjectType->MimeType.characters, dinObjectType->MimeType.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 26 /* {}MimeType */, dinObjectType->MimeType.characters, dinObjectType->MimeType.charactersLen);
 				}
 				grammarID = 19;
 			} else 			if (1==0) {
@@ -8453,11 +8691,8 @@ static int encode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 			} else 			if ( dinObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 5);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 20;
@@ -8470,21 +8705,15 @@ static int encode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 			if ( dinObjectType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinObjectType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinObjectType->Id.characters, dinObjectType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinObjectType->Id.characters, dinObjectType->Id.charactersLen);
 				}
 				grammarID = 246;
 			} else 			if ( dinObjectType->MimeType_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinObjectType->MimeType.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinObjectType->MimeType.characters, dinObjectType->MimeType.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 26 /* {}MimeType */, dinObjectType->MimeType.characters, dinObjectType->MimeType.charactersLen);
 				}
 				grammarID = 19;
 			} else 			if (1==0) {
@@ -8499,11 +8728,8 @@ static int encode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 			} else 			if ( dinObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 4);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 20;
@@ -8516,11 +8742,8 @@ static int encode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 			if ( dinObjectType->MimeType_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinObjectType->MimeType.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinObjectType->MimeType.characters, dinObjectType->MimeType.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 26 /* {}MimeType */, dinObjectType->MimeType.characters, dinObjectType->MimeType.charactersLen);
 				}
 				grammarID = 19;
 			} else 			if (1==0) {
@@ -8535,11 +8758,8 @@ static int encode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 			} else 			if ( dinObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 20;
@@ -8561,11 +8781,8 @@ static int encode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 			} else 			if ( dinObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 20;
@@ -8587,11 +8804,8 @@ static int encode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 			} else 			if ( dinObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, dinObjectType->ANY.characters, dinObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 20;
@@ -8611,7 +8825,9 @@ static int encode_dinObjectType(bitstream_t* stream, struct dinObjectType* dinOb
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,SessionStopResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_SessionStopRes == SUPPORT_YES
 static int encode_dinSessionStopResType(bitstream_t* stream, struct dinSessionStopResType* dinSessionStopResType) {
+	int errn = 0;
 	int grammarID = 223;
 	int done = 0;
 	
@@ -8658,9 +8874,11 @@ static int encode_dinSessionStopResType(bitstream_t* stream, struct dinSessionSt
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_SessionStopRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignedInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":CanonicalizationMethod,"http://www.w3.org/2000/09/xmldsig#":SignatureMethod,"http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinSignedInfoType(bitstream_t* stream, struct dinSignedInfoType* dinSignedInfoType) {
+	int errn = 0;
 	int grammarID = 247;
 	int done = 0;
 	
@@ -8673,11 +8891,8 @@ static int encode_dinSignedInfoType(bitstream_t* stream, struct dinSignedInfoTyp
 			if ( dinSignedInfoType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignedInfoType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignedInfoType->Id.characters, dinSignedInfoType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinSignedInfoType->Id.characters, dinSignedInfoType->Id.charactersLen);
 				}
 				grammarID = 248;
 			} else 			if ( 1 == 1 ) {
@@ -8757,6 +8972,7 @@ static int encode_dinSignedInfoType(bitstream_t* stream, struct dinSignedInfoTyp
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SalesTariffType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":SalesTariffID,"urn:iso:15118:2:2010:MsgDataTypes":SalesTariffDescription{0-1},"urn:iso:15118:2:2010:MsgDataTypes":NumEPriceLevels,"urn:iso:15118:2:2010:MsgDataTypes":SalesTariffEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffType* dinSalesTariffType) {
+	int errn = 0;
 	int grammarID = 251;
 	int done = 0;
 	
@@ -8769,11 +8985,8 @@ static int encode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffT
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSalesTariffType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSalesTariffType->Id.characters, dinSalesTariffType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinSalesTariffType->Id.characters, dinSalesTariffType->Id.charactersLen);
 				}
 				grammarID = 252;
 			} else {
@@ -8806,11 +9019,8 @@ static int encode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffT
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSalesTariffType->SalesTariffDescription.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinSalesTariffType->SalesTariffDescription.characters, dinSalesTariffType->SalesTariffDescription.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 19 /* {urn:iso:15118:2:2010:MsgDataTypes}SalesTariffDescription */, dinSalesTariffType->SalesTariffDescription.characters, dinSalesTariffType->SalesTariffDescription.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -8893,6 +9103,7 @@ static int encode_dinSalesTariffType(bitstream_t* stream, struct dinSalesTariffT
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,CostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":costKind,"urn:iso:15118:2:2010:MsgDataTypes":amount,"urn:iso:15118:2:2010:MsgDataTypes":amountMultiplier{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_dinCostType(bitstream_t* stream, struct dinCostType* dinCostType) {
+	int errn = 0;
 	int grammarID = 257;
 	int done = 0;
 	
@@ -8984,6 +9195,7 @@ static int encode_dinCostType(bitstream_t* stream, struct dinCostType* dinCostTy
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,ServiceChargeType',  base type name='ServiceType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2010:MsgDataTypes":ServiceTag,"urn:iso:15118:2:2010:MsgDataTypes":FreeService),("urn:iso:15118:2:2010:MsgDataTypes":EnergyTransferType))',  derivedBy='EXTENSION'.  */
 static int encode_dinServiceChargeType(bitstream_t* stream, struct dinServiceChargeType* dinServiceChargeType) {
+	int errn = 0;
 	int grammarID = 260;
 	int done = 0;
 	
@@ -9063,6 +9275,7 @@ static int encode_dinServiceChargeType(bitstream_t* stream, struct dinServiceCha
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,DC_EVSEStatusType',  base type name='EVSEStatusType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":EVSEIsolationStatus{0-1},"urn:iso:15118:2:2010:MsgDataTypes":EVSEStatusCode,"urn:iso:15118:2:2010:MsgDataTypes":NotificationMaxDelay,"urn:iso:15118:2:2010:MsgDataTypes":EVSENotification)',  derivedBy='EXTENSION'.  */
 static int encode_dinDC_EVSEStatusType(bitstream_t* stream, struct dinDC_EVSEStatusType* dinDC_EVSEStatusType) {
+	int errn = 0;
 	int grammarID = 263;
 	int done = 0;
 	
@@ -9178,6 +9391,7 @@ static int encode_dinDC_EVSEStatusType(bitstream_t* stream, struct dinDC_EVSESta
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RetrievalMethodType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_dinRetrievalMethodType(bitstream_t* stream, struct dinRetrievalMethodType* dinRetrievalMethodType) {
+	int errn = 0;
 	int grammarID = 265;
 	int done = 0;
 	
@@ -9189,21 +9403,15 @@ static int encode_dinRetrievalMethodType(bitstream_t* stream, struct dinRetrieva
 			if ( dinRetrievalMethodType->Type_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinRetrievalMethodType->Type.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinRetrievalMethodType->Type.characters, dinRetrievalMethodType->Type.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 29 /* {}Type */, dinRetrievalMethodType->Type.characters, dinRetrievalMethodType->Type.charactersLen);
 				}
 				grammarID = 266;
 			} else 			if ( dinRetrievalMethodType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinRetrievalMethodType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinRetrievalMethodType->URI.characters, dinRetrievalMethodType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 30 /* {}URI */, dinRetrievalMethodType->URI.characters, dinRetrievalMethodType->URI.charactersLen);
 				}
 				grammarID = 267;
 			} else 			if ( dinRetrievalMethodType->Transforms_isUsed == 1u ) {
@@ -9227,11 +9435,8 @@ static int encode_dinRetrievalMethodType(bitstream_t* stream, struct dinRetrieva
 			if ( dinRetrievalMethodType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinRetrievalMethodType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinRetrievalMethodType->URI.characters, dinRetrievalMethodType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 30 /* {}URI */, dinRetrievalMethodType->URI.characters, dinRetrievalMethodType->URI.charactersLen);
 				}
 				grammarID = 267;
 			} else 			if ( dinRetrievalMethodType->Transforms_isUsed == 1u ) {
@@ -9293,6 +9498,7 @@ static int encode_dinRetrievalMethodType(bitstream_t* stream, struct dinRetrieva
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,NotificationType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":FaultCode,"urn:iso:15118:2:2010:MsgDataTypes":FaultMsg{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_dinNotificationType(bitstream_t* stream, struct dinNotificationType* dinNotificationType) {
+	int errn = 0;
 	int grammarID = 268;
 	int done = 0;
 	
@@ -9325,11 +9531,8 @@ static int encode_dinNotificationType(bitstream_t* stream, struct dinNotificatio
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinNotificationType->FaultMsg.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinNotificationType->FaultMsg.characters, dinNotificationType->FaultMsg.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 16 /* {urn:iso:15118:2:2010:MsgDataTypes}FaultMsg */, dinNotificationType->FaultMsg.characters, dinNotificationType->FaultMsg.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -9370,6 +9573,7 @@ static int encode_dinNotificationType(bitstream_t* stream, struct dinNotificatio
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,PGPDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":PGPKeyID,"http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})|("http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED}))',  derivedBy='RESTRICTION'.  */
 static int encode_dinPGPDataType(bitstream_t* stream, struct dinPGPDataType* dinPGPDataType) {
+	int errn = 0;
 	int grammarID = 270;
 	int done = 0;
 	int wcDone = 0;
@@ -9470,7 +9674,9 @@ static int encode_dinPGPDataType(bitstream_t* stream, struct dinPGPDataType* din
 }
 
 /* Complex type name='urn:iso:15118:2:2010:MsgBody,CertificateInstallationResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgBody":ResponseCode,"urn:iso:15118:2:2010:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2010:MsgBody":ContractSignatureEncryptedPrivateKey,"urn:iso:15118:2:2010:MsgBody":DHParams,"urn:iso:15118:2:2010:MsgBody":ContractID)',  derivedBy='EXTENSION'.  */
+#if DIN_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 static int encode_dinCertificateInstallationResType(bitstream_t* stream, struct dinCertificateInstallationResType* dinCertificateInstallationResType) {
+	int errn = 0;
 	int grammarID = 273;
 	int done = 0;
 	
@@ -9482,11 +9688,8 @@ static int encode_dinCertificateInstallationResType(bitstream_t* stream, struct
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinCertificateInstallationResType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinCertificateInstallationResType->Id.characters, dinCertificateInstallationResType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinCertificateInstallationResType->Id.characters, dinCertificateInstallationResType->Id.charactersLen);
 				}
 				grammarID = 274;
 			} else {
@@ -9573,11 +9776,8 @@ static int encode_dinCertificateInstallationResType(bitstream_t* stream, struct
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinCertificateInstallationResType->ContractID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinCertificateInstallationResType->ContractID.characters, dinCertificateInstallationResType->ContractID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, dinCertificateInstallationResType->ContractID.characters, dinCertificateInstallationResType->ContractID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -9609,9 +9809,11 @@ static int encode_dinCertificateInstallationResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* DIN_DEPLOY_CertificateInstallationRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertyType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignaturePropertyType* dinSignaturePropertyType) {
+	int errn = 0;
 	int grammarID = 279;
 	int done = 0;
 	int wcDone = 0;
@@ -9624,21 +9826,15 @@ static int encode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 			if ( dinSignaturePropertyType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignaturePropertyType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignaturePropertyType->Id.characters, dinSignaturePropertyType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Id */, dinSignaturePropertyType->Id.characters, dinSignaturePropertyType->Id.charactersLen);
 				}
 				grammarID = 280;
 			} else 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignaturePropertyType->Target.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignaturePropertyType->Target.characters, dinSignaturePropertyType->Target.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 28 /* {}Target */, dinSignaturePropertyType->Target.characters, dinSignaturePropertyType->Target.charactersLen);
 				}
 				grammarID = 281;
 			} else {
@@ -9650,11 +9846,8 @@ static int encode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignaturePropertyType->Target.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignaturePropertyType->Target.characters, dinSignaturePropertyType->Target.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 28 /* {}Target */, dinSignaturePropertyType->Target.characters, dinSignaturePropertyType->Target.charactersLen);
 				}
 				grammarID = 281;
 			} else {
@@ -9669,11 +9862,8 @@ static int encode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 			} else 			if ( dinSignaturePropertyType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignaturePropertyType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 282;
@@ -9695,11 +9885,8 @@ static int encode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 			} else 			if ( dinSignaturePropertyType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignaturePropertyType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 20;
@@ -9715,11 +9902,8 @@ static int encode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 			} else 			if ( dinSignaturePropertyType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(dinSignaturePropertyType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, dinSignaturePropertyType->ANY.characters, dinSignaturePropertyType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 282;
@@ -9740,6 +9924,7 @@ static int encode_dinSignaturePropertyType(bitstream_t* stream, struct dinSignat
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,MeterInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":MeterID,"urn:iso:15118:2:2010:MsgDataTypes":MeterReading{0-1},"urn:iso:15118:2:2010:MsgDataTypes":SigMeterReading{0-1},"urn:iso:15118:2:2010:MsgDataTypes":MeterStatus{0-1},"urn:iso:15118:2:2010:MsgDataTypes":TMeter{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_dinMeterInfoType(bitstream_t* stream, struct dinMeterInfoType* dinMeterInfoType) {
+	int errn = 0;
 	int grammarID = 283;
 	int done = 0;
 	
@@ -9754,11 +9939,8 @@ static int encode_dinMeterInfoType(bitstream_t* stream, struct dinMeterInfoType*
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(dinMeterInfoType->MeterID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, dinMeterInfoType->MeterID.characters, dinMeterInfoType->MeterID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 17 /* {urn:iso:15118:2:2010:MsgDataTypes}MeterID */, dinMeterInfoType->MeterID.characters, dinMeterInfoType->MeterID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -9961,6 +10143,7 @@ static int encode_dinMeterInfoType(bitstream_t* stream, struct dinMeterInfoType*
 
 /* Complex type name='urn:iso:15118:2:2010:MsgDataTypes,SubCertificatesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2010:MsgDataTypes":Certificate{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_dinSubCertificatesType(bitstream_t* stream, struct dinSubCertificatesType* dinSubCertificatesType) {
+	int errn = 0;
 	int grammarID = 288;
 	int done = 0;
 	
@@ -10032,166 +10215,271 @@ static int encode_dinSubCertificatesType(bitstream_t* stream, struct dinSubCerti
 
 
 int encode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
+	int errn = 0;
 	errn = writeEXIHeader(stream);
 
 	if(errn == 0) {
 		/* DocContent[START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgDef}BodyElement), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandRes), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVPowerDeliveryParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVStatus), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVPowerDeliveryParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Entry), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PMaxScheduleEntry), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}RelativeTimeInterval), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SAScheduleList), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SASchedules), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SalesTariffEntry), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ServiceCharge), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}TimeInterval), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms), START_ELEMENT({urn:iso:15118:2:2010:MsgDef}V2G_Message), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data), START_ELEMENT_GENERIC] */
 		if ( exiDoc->AC_EVChargeParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_AC_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 0);
 			if(errn == 0) {
 				errn = encode_dinAC_EVChargeParameterType(stream, &exiDoc->AC_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_AC_EVChargeParameter */
 		} else if ( exiDoc->AC_EVSEChargeParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_AC_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 1);
 			if(errn == 0) {
 				errn = encode_dinAC_EVSEChargeParameterType(stream, &exiDoc->AC_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_AC_EVSEChargeParameter */
 		} else if ( exiDoc->AC_EVSEStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_AC_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 2);
 			if(errn == 0) {
 				errn = encode_dinAC_EVSEStatusType(stream, &exiDoc->AC_EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_AC_EVSEStatus */
 		} else if ( exiDoc->BodyElement_isUsed == 1u ) { 
+#if DIN_DEPLOY_BodyElement == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}BodyElement) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 3);
 			if(errn == 0) {
 				errn = encode_dinBodyBaseType(stream, &exiDoc->BodyElement );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_BodyElement */
 		} else if ( exiDoc->CableCheckReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_CableCheckReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 4);
 			if(errn == 0) {
 				errn = encode_dinCableCheckReqType(stream, &exiDoc->CableCheckReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CableCheckReq */
 		} else if ( exiDoc->CableCheckRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_CableCheckRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 5);
 			if(errn == 0) {
 				errn = encode_dinCableCheckResType(stream, &exiDoc->CableCheckRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CableCheckRes */
 		} else if ( exiDoc->CanonicalizationMethod_isUsed == 1u ) { 
+#if DIN_DEPLOY_CanonicalizationMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 6);
 			if(errn == 0) {
 				errn = encode_dinCanonicalizationMethodType(stream, &exiDoc->CanonicalizationMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CanonicalizationMethod */
 		} else if ( exiDoc->CertificateInstallationReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 7);
 			if(errn == 0) {
 				errn = encode_dinCertificateInstallationReqType(stream, &exiDoc->CertificateInstallationReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CertificateInstallationReq */
 		} else if ( exiDoc->CertificateInstallationRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 8);
 			if(errn == 0) {
 				errn = encode_dinCertificateInstallationResType(stream, &exiDoc->CertificateInstallationRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CertificateInstallationRes */
 		} else if ( exiDoc->CertificateUpdateReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 9);
 			if(errn == 0) {
 				errn = encode_dinCertificateUpdateReqType(stream, &exiDoc->CertificateUpdateReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CertificateUpdateReq */
 		} else if ( exiDoc->CertificateUpdateRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 10);
 			if(errn == 0) {
 				errn = encode_dinCertificateUpdateResType(stream, &exiDoc->CertificateUpdateRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CertificateUpdateRes */
 		} else if ( exiDoc->ChargeParameterDiscoveryReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 11);
 			if(errn == 0) {
 				errn = encode_dinChargeParameterDiscoveryReqType(stream, &exiDoc->ChargeParameterDiscoveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryReq */
 		} else if ( exiDoc->ChargeParameterDiscoveryRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 12);
 			if(errn == 0) {
 				errn = encode_dinChargeParameterDiscoveryResType(stream, &exiDoc->ChargeParameterDiscoveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryRes */
 		} else if ( exiDoc->ChargingStatusReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_ChargingStatusReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 13);
 			if(errn == 0) {
 				errn = encode_dinChargingStatusReqType(stream, &exiDoc->ChargingStatusReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ChargingStatusReq */
 		} else if ( exiDoc->ChargingStatusRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_ChargingStatusRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 14);
 			if(errn == 0) {
 				errn = encode_dinChargingStatusResType(stream, &exiDoc->ChargingStatusRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ChargingStatusRes */
 		} else if ( exiDoc->ContractAuthenticationReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_ContractAuthenticationReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 15);
 			if(errn == 0) {
 				errn = encode_dinContractAuthenticationReqType(stream, &exiDoc->ContractAuthenticationReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ContractAuthenticationReq */
 		} else if ( exiDoc->ContractAuthenticationRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_ContractAuthenticationRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 16);
 			if(errn == 0) {
 				errn = encode_dinContractAuthenticationResType(stream, &exiDoc->ContractAuthenticationRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ContractAuthenticationRes */
 		} else if ( exiDoc->CurrentDemandReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_CurrentDemandReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 17);
 			if(errn == 0) {
 				errn = encode_dinCurrentDemandReqType(stream, &exiDoc->CurrentDemandReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CurrentDemandReq */
 		} else if ( exiDoc->CurrentDemandRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 18);
 			if(errn == 0) {
 				errn = encode_dinCurrentDemandResType(stream, &exiDoc->CurrentDemandRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CurrentDemandRes */
 		} else if ( exiDoc->DC_EVChargeParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_DC_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 19);
 			if(errn == 0) {
 				errn = encode_dinDC_EVChargeParameterType(stream, &exiDoc->DC_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DC_EVChargeParameter */
 		} else if ( exiDoc->DC_EVPowerDeliveryParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_DC_EVPowerDeliveryParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVPowerDeliveryParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 20);
 			if(errn == 0) {
 				errn = encode_dinDC_EVPowerDeliveryParameterType(stream, &exiDoc->DC_EVPowerDeliveryParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DC_EVPowerDeliveryParameter */
 		} else if ( exiDoc->DC_EVSEChargeParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_DC_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 21);
 			if(errn == 0) {
 				errn = encode_dinDC_EVSEChargeParameterType(stream, &exiDoc->DC_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DC_EVSEChargeParameter */
 		} else if ( exiDoc->DC_EVSEStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_DC_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 22);
 			if(errn == 0) {
 				errn = encode_dinDC_EVSEStatusType(stream, &exiDoc->DC_EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DC_EVSEStatus */
 		} else if ( exiDoc->DC_EVStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_DC_EVStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 23);
 			if(errn == 0) {
 				errn = encode_dinDC_EVStatusType(stream, &exiDoc->DC_EVStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DC_EVStatus */
 		} else if ( exiDoc->DSAKeyValue_isUsed == 1u ) { 
+#if DIN_DEPLOY_DSAKeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 24);
 			if(errn == 0) {
 				errn = encode_dinDSAKeyValueType(stream, &exiDoc->DSAKeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DSAKeyValue */
 		} else if ( exiDoc->DigestMethod_isUsed == 1u ) { 
+#if DIN_DEPLOY_DigestMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 25);
 			if(errn == 0) {
 				errn = encode_dinDigestMethodType(stream, &exiDoc->DigestMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DigestMethod */
 		} else if ( exiDoc->DigestValue_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 26);
@@ -10208,47 +10496,75 @@ int encode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 				}
 			}
 		} else if ( exiDoc->EVChargeParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 27);
 			if(errn == 0) {
 				errn = encode_dinEVChargeParameterType(stream, &exiDoc->EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_EVChargeParameter */
 		} else if ( exiDoc->EVPowerDeliveryParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_EVPowerDeliveryParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVPowerDeliveryParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 28);
 			if(errn == 0) {
 				errn = encode_dinEVPowerDeliveryParameterType(stream, &exiDoc->EVPowerDeliveryParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_EVPowerDeliveryParameter */
 		} else if ( exiDoc->EVSEChargeParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 29);
 			if(errn == 0) {
 				errn = encode_dinEVSEChargeParameterType(stream, &exiDoc->EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_EVSEChargeParameter */
 		} else if ( exiDoc->EVSEStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 30);
 			if(errn == 0) {
 				errn = encode_dinEVSEStatusType(stream, &exiDoc->EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_EVSEStatus */
 		} else if ( exiDoc->EVStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_EVStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 31);
 			if(errn == 0) {
 				errn = encode_dinEVStatusType(stream, &exiDoc->EVStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_EVStatus */
 		} else if ( exiDoc->Entry_isUsed == 1u ) { 
+#if DIN_DEPLOY_Entry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Entry) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 32);
 			if(errn == 0) {
 				errn = encode_dinEntryType(stream, &exiDoc->Entry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Entry */
 		} else if ( exiDoc->KeyInfo_isUsed == 1u ) { 
+#if DIN_DEPLOY_KeyInfo == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 33);
 			if(errn == 0) {
 				errn = encode_dinKeyInfoType(stream, &exiDoc->KeyInfo );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_KeyInfo */
 		} else if ( exiDoc->KeyName_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 34);
@@ -10256,39 +10572,52 @@ int encode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiDoc->KeyName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiDoc->KeyName.characters, exiDoc->KeyName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiDoc->KeyName.characters, exiDoc->KeyName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiDoc->KeyValue_isUsed == 1u ) { 
+#if DIN_DEPLOY_KeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 35);
 			if(errn == 0) {
 				errn = encode_dinKeyValueType(stream, &exiDoc->KeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_KeyValue */
 		} else if ( exiDoc->Manifest_isUsed == 1u ) { 
+#if DIN_DEPLOY_Manifest == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 36);
 			if(errn == 0) {
 				errn = encode_dinManifestType(stream, &exiDoc->Manifest );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Manifest */
 		} else if ( exiDoc->MeteringReceiptReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 37);
 			if(errn == 0) {
 				errn = encode_dinMeteringReceiptReqType(stream, &exiDoc->MeteringReceiptReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_MeteringReceiptReq */
 		} else if ( exiDoc->MeteringReceiptRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 38);
 			if(errn == 0) {
 				errn = encode_dinMeteringReceiptResType(stream, &exiDoc->MeteringReceiptRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_MeteringReceiptRes */
 		} else if ( exiDoc->MgmtData_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 39);
@@ -10296,261 +10625,422 @@ int encode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiDoc->MgmtData.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiDoc->MgmtData.characters, exiDoc->MgmtData.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiDoc->MgmtData.characters, exiDoc->MgmtData.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiDoc->Object_isUsed == 1u ) { 
+#if DIN_DEPLOY_Object == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 40);
 			if(errn == 0) {
 				errn = encode_dinObjectType(stream, &exiDoc->Object );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Object */
 		} else if ( exiDoc->PGPData_isUsed == 1u ) { 
+#if DIN_DEPLOY_PGPData == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 41);
 			if(errn == 0) {
 				errn = encode_dinPGPDataType(stream, &exiDoc->PGPData );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PGPData */
 		} else if ( exiDoc->PMaxScheduleEntry_isUsed == 1u ) { 
+#if DIN_DEPLOY_PMaxScheduleEntry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PMaxScheduleEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 42);
 			if(errn == 0) {
 				errn = encode_dinPMaxScheduleEntryType(stream, &exiDoc->PMaxScheduleEntry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PMaxScheduleEntry */
 		} else if ( exiDoc->PaymentDetailsReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 43);
 			if(errn == 0) {
 				errn = encode_dinPaymentDetailsReqType(stream, &exiDoc->PaymentDetailsReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PaymentDetailsReq */
 		} else if ( exiDoc->PaymentDetailsRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 44);
 			if(errn == 0) {
 				errn = encode_dinPaymentDetailsResType(stream, &exiDoc->PaymentDetailsRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PaymentDetailsRes */
 		} else if ( exiDoc->PowerDeliveryReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 45);
 			if(errn == 0) {
 				errn = encode_dinPowerDeliveryReqType(stream, &exiDoc->PowerDeliveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PowerDeliveryReq */
 		} else if ( exiDoc->PowerDeliveryRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 46);
 			if(errn == 0) {
 				errn = encode_dinPowerDeliveryResType(stream, &exiDoc->PowerDeliveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PowerDeliveryRes */
 		} else if ( exiDoc->PreChargeReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_PreChargeReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 47);
 			if(errn == 0) {
 				errn = encode_dinPreChargeReqType(stream, &exiDoc->PreChargeReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PreChargeReq */
 		} else if ( exiDoc->PreChargeRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_PreChargeRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 48);
 			if(errn == 0) {
 				errn = encode_dinPreChargeResType(stream, &exiDoc->PreChargeRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PreChargeRes */
 		} else if ( exiDoc->RSAKeyValue_isUsed == 1u ) { 
+#if DIN_DEPLOY_RSAKeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 49);
 			if(errn == 0) {
 				errn = encode_dinRSAKeyValueType(stream, &exiDoc->RSAKeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_RSAKeyValue */
 		} else if ( exiDoc->Reference_isUsed == 1u ) { 
+#if DIN_DEPLOY_Reference == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 50);
 			if(errn == 0) {
 				errn = encode_dinReferenceType(stream, &exiDoc->Reference );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Reference */
 		} else if ( exiDoc->RelativeTimeInterval_isUsed == 1u ) { 
+#if DIN_DEPLOY_RelativeTimeInterval == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}RelativeTimeInterval) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 51);
 			if(errn == 0) {
 				errn = encode_dinRelativeTimeIntervalType(stream, &exiDoc->RelativeTimeInterval );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_RelativeTimeInterval */
 		} else if ( exiDoc->RetrievalMethod_isUsed == 1u ) { 
+#if DIN_DEPLOY_RetrievalMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 52);
 			if(errn == 0) {
 				errn = encode_dinRetrievalMethodType(stream, &exiDoc->RetrievalMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_RetrievalMethod */
 		} else if ( exiDoc->SAScheduleList_isUsed == 1u ) { 
+#if DIN_DEPLOY_SAScheduleList == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SAScheduleList) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 53);
 			if(errn == 0) {
 				errn = encode_dinSAScheduleListType(stream, &exiDoc->SAScheduleList );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SAScheduleList */
 		} else if ( exiDoc->SASchedules_isUsed == 1u ) { 
+#if DIN_DEPLOY_SASchedules == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SASchedules) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 54);
 			if(errn == 0) {
 				errn = encode_dinSASchedulesType(stream, &exiDoc->SASchedules );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SASchedules */
 		} else if ( exiDoc->SPKIData_isUsed == 1u ) { 
+#if DIN_DEPLOY_SPKIData == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 55);
 			if(errn == 0) {
 				errn = encode_dinSPKIDataType(stream, &exiDoc->SPKIData );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SPKIData */
 		} else if ( exiDoc->SalesTariffEntry_isUsed == 1u ) { 
+#if DIN_DEPLOY_SalesTariffEntry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SalesTariffEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 56);
 			if(errn == 0) {
 				errn = encode_dinSalesTariffEntryType(stream, &exiDoc->SalesTariffEntry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SalesTariffEntry */
 		} else if ( exiDoc->ServiceCharge_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServiceCharge == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ServiceCharge) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 57);
 			if(errn == 0) {
 				errn = encode_dinServiceChargeType(stream, &exiDoc->ServiceCharge );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceCharge */
 		} else if ( exiDoc->ServiceDetailReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServiceDetailReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 58);
 			if(errn == 0) {
 				errn = encode_dinServiceDetailReqType(stream, &exiDoc->ServiceDetailReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceDetailReq */
 		} else if ( exiDoc->ServiceDetailRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServiceDetailRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 59);
 			if(errn == 0) {
 				errn = encode_dinServiceDetailResType(stream, &exiDoc->ServiceDetailRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceDetailRes */
 		} else if ( exiDoc->ServiceDiscoveryReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 60);
 			if(errn == 0) {
 				errn = encode_dinServiceDiscoveryReqType(stream, &exiDoc->ServiceDiscoveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceDiscoveryReq */
 		} else if ( exiDoc->ServiceDiscoveryRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 61);
 			if(errn == 0) {
 				errn = encode_dinServiceDiscoveryResType(stream, &exiDoc->ServiceDiscoveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceDiscoveryRes */
 		} else if ( exiDoc->ServicePaymentSelectionReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServicePaymentSelectionReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 62);
 			if(errn == 0) {
 				errn = encode_dinServicePaymentSelectionReqType(stream, &exiDoc->ServicePaymentSelectionReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServicePaymentSelectionReq */
 		} else if ( exiDoc->ServicePaymentSelectionRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServicePaymentSelectionRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 63);
 			if(errn == 0) {
 				errn = encode_dinServicePaymentSelectionResType(stream, &exiDoc->ServicePaymentSelectionRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServicePaymentSelectionRes */
 		} else if ( exiDoc->SessionSetupReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_SessionSetupReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 64);
 			if(errn == 0) {
 				errn = encode_dinSessionSetupReqType(stream, &exiDoc->SessionSetupReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SessionSetupReq */
 		} else if ( exiDoc->SessionSetupRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_SessionSetupRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 65);
 			if(errn == 0) {
 				errn = encode_dinSessionSetupResType(stream, &exiDoc->SessionSetupRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SessionSetupRes */
 		} else if ( exiDoc->SessionStopReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_SessionStopReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 66);
 			if(errn == 0) {
 				errn = encode_dinSessionStopType(stream, &exiDoc->SessionStopReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SessionStopReq */
 		} else if ( exiDoc->SessionStopRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_SessionStopRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 67);
 			if(errn == 0) {
 				errn = encode_dinSessionStopResType(stream, &exiDoc->SessionStopRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SessionStopRes */
 		} else if ( exiDoc->Signature_isUsed == 1u ) { 
+#if DIN_DEPLOY_Signature == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 68);
 			if(errn == 0) {
 				errn = encode_dinSignatureType(stream, &exiDoc->Signature );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Signature */
 		} else if ( exiDoc->SignatureMethod_isUsed == 1u ) { 
+#if DIN_DEPLOY_SignatureMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 69);
 			if(errn == 0) {
 				errn = encode_dinSignatureMethodType(stream, &exiDoc->SignatureMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SignatureMethod */
 		} else if ( exiDoc->SignatureProperties_isUsed == 1u ) { 
+#if DIN_DEPLOY_SignatureProperties == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 70);
 			if(errn == 0) {
 				errn = encode_dinSignaturePropertiesType(stream, &exiDoc->SignatureProperties );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SignatureProperties */
 		} else if ( exiDoc->SignatureProperty_isUsed == 1u ) { 
+#if DIN_DEPLOY_SignatureProperty == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 71);
 			if(errn == 0) {
 				errn = encode_dinSignaturePropertyType(stream, &exiDoc->SignatureProperty );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SignatureProperty */
 		} else if ( exiDoc->SignatureValue_isUsed == 1u ) { 
+#if DIN_DEPLOY_SignatureValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 72);
 			if(errn == 0) {
 				errn = encode_dinSignatureValueType(stream, &exiDoc->SignatureValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SignatureValue */
 		} else if ( exiDoc->SignedInfo_isUsed == 1u ) { 
+#if DIN_DEPLOY_SignedInfo == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 73);
 			if(errn == 0) {
 				errn = encode_dinSignedInfoType(stream, &exiDoc->SignedInfo );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SignedInfo */
 		} else if ( exiDoc->TimeInterval_isUsed == 1u ) { 
+#if DIN_DEPLOY_TimeInterval == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}TimeInterval) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 74);
 			if(errn == 0) {
 				errn = encode_dinIntervalType(stream, &exiDoc->TimeInterval );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_TimeInterval */
 		} else if ( exiDoc->Transform_isUsed == 1u ) { 
+#if DIN_DEPLOY_Transform == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 75);
 			if(errn == 0) {
 				errn = encode_dinTransformType(stream, &exiDoc->Transform );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Transform */
 		} else if ( exiDoc->Transforms_isUsed == 1u ) { 
+#if DIN_DEPLOY_Transforms == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 76);
 			if(errn == 0) {
 				errn = encode_dinTransformsType(stream, &exiDoc->Transforms );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Transforms */
 		} else if ( exiDoc->V2G_Message_isUsed == 1u ) { 
+#if DIN_DEPLOY_V2G_Message == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}V2G_Message) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 77);
 			if(errn == 0) {
 				errn = encode_dinAnonType_V2G_Message(stream, &exiDoc->V2G_Message );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_V2G_Message */
 		} else if ( exiDoc->WeldingDetectionReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 78);
 			if(errn == 0) {
 				errn = encode_dinWeldingDetectionReqType(stream, &exiDoc->WeldingDetectionReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_WeldingDetectionReq */
 		} else if ( exiDoc->WeldingDetectionRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 79);
 			if(errn == 0) {
 				errn = encode_dinWeldingDetectionResType(stream, &exiDoc->WeldingDetectionRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_WeldingDetectionRes */
 		} else if ( exiDoc->X509Data_isUsed == 1u ) { 
+#if DIN_DEPLOY_X509Data == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 80);
 			if(errn == 0) {
 				errn = encode_dinX509DataType(stream, &exiDoc->X509Data );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_X509Data */
 		} else {
 			errn = EXI_ERROR_UNKOWN_EVENT;
 		}
@@ -10565,36 +11055,348 @@ int encode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 	return errn;
 }
 
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
+#if EXI_STREAM == BYTE_ARRAY && EXI_OPTION_ALIGNMENT != BYTE_ALIGNMENT
+/* Bit pattern of an EXI unsigned integer: 7 bit groups, least significant group first */
+static uint8_t dinTemplateUnsignedInteger(uint32_t n, uint64_t* bits) {
+	uint8_t len = 0;
+	uint8_t b;
+	*bits = 0;
+	do {
+		b = (uint8_t)(n & 0x7F);
+		n = n >> 7;
+		if(n != 0) {
+			b |= 0x80;
+		}
+		*bits = (*bits << 8) | b;
+		len += 8;
+	} while(n != 0);
+	return len;
+}
+
+static void dinTemplateAddField(struct dinCurrentDemandResTemplate* tmpl, size_t* pos, uint8_t len, uint64_t bits) {
+	if(tmpl->fieldsLen < dinCurrentDemandResTemplate_FIELDS_SIZE) {
+		tmpl->fields[tmpl->fieldsLen].pos = (uint16_t)(*pos);
+		tmpl->fields[tmpl->fieldsLen].len = len;
+		tmpl->fields[tmpl->fieldsLen].bits = bits;
+	}
+	tmpl->fieldsLen++;
+	*pos += len;
+}
+
+static void dinTemplateAddPhysicalValue(struct dinCurrentDemandResTemplate* tmpl, size_t* pos, struct dinPhysicalValueType* pv, uint32_t unitShape) {
+	uint64_t bits;
+	uint8_t len;
+	/* Multiplier SE, CH, value, EE */
+	*pos += 2;
+	dinTemplateAddField(tmpl, pos, 3, (uint32_t)(pv->Multiplier + 3) & 0x07);
+	*pos += 1;
+	if(pv->Unit_isUsed == 1u) {
+		tmpl->shape |= unitShape;
+		/* Unit SE, CH, value, EE, Value SE */
+		*pos += 3;
+		dinTemplateAddField(tmpl, pos, 4, (uint32_t)pv->Unit & 0x0F);
+		*pos += 2;
+	} else {
+		/* Value SE */
+		*pos += 2;
+	}
+	/* Value CH, sign and magnitude, EE */
+	*pos += 1;
+	if(pv->Value < 0) {
+		len = dinTemplateUnsignedInteger((uint32_t)(-(int32_t)pv->Value - 1), &bits);
+		bits |= (uint64_t)1 << len;
+	} else {
+		len = dinTemplateUnsignedInteger((uint32_t)pv->Value, &bits);
+	}
+	dinTemplateAddField(tmpl, pos, (uint8_t)(len + 1), bits);
+	*pos += 1;
+	/* PhysicalValue EE */
+	*pos += 1;
+}
+
+/* Records the bit position and width of every value field of the message. The event codes in
+ * between are counted according to the grammars of encode_dinCurrentDemandResType and the types
+ * it uses. Returns the length of the message in bits. */
+static size_t dinCurrentDemandResTemplateLayout(struct dinCurrentDemandResTemplate* tmpl, struct dinMessageHeaderType* header, struct dinCurrentDemandResType* res) {
+	uint64_t bits;
+	uint8_t len;
+	size_t pos;
+	int grammarID = 35;
+
+	tmpl->fieldsLen = 0;
+	tmpl->shape = 0;
+
+	/* EXI header, V2G_Message SE, Header SE, SessionID SE and CH, SessionID length */
+	pos = 8 + 7 + 1 + 2;
+	pos += dinTemplateUnsignedInteger(header->SessionID.bytesLen, &bits);
+	/* SessionID bytes and EE, Header EE, Body SE, CurrentDemandRes SE */
+	pos += 8u * header->SessionID.bytesLen + 1 + 2 + 1 + 6;
+
+	/* ResponseCode */
+	pos += 2;
+	dinTemplateAddField(tmpl, &pos, 5, (uint32_t)res->ResponseCode & 0x1F);
+	pos += 1;
+
+	/* DC_EVSEStatus */
+	pos += 1;
+	if(res->DC_EVSEStatus.EVSEIsolationStatus_isUsed == 1u) {
+		tmpl->shape |= 0x01;
+		pos += 3;
+		dinTemplateAddField(tmpl, &pos, 2, (uint32_t)res->DC_EVSEStatus.EVSEIsolationStatus & 0x03);
+		/* EE, EVSEStatusCode SE */
+		pos += 2;
+	} else {
+		pos += 2;
+	}
+	pos += 1;
+	dinTemplateAddField(tmpl, &pos, 4, (uint32_t)res->DC_EVSEStatus.EVSEStatusCode & 0x0F);
+	pos += 1;
+	pos += 2;
+	len = dinTemplateUnsignedInteger(res->DC_EVSEStatus.NotificationMaxDelay, &bits);
+	dinTemplateAddField(tmpl, &pos, len, bits);
+	pos += 1;
+	pos += 2;
+	dinTemplateAddField(tmpl, &pos, 2, (uint32_t)res->DC_EVSEStatus.EVSENotification & 0x03);
+	pos += 1;
+	pos += 1;
+
+	pos += 1;
+	dinTemplateAddPhysicalValue(tmpl, &pos, &res->EVSEPresentVoltage, 0x02);
+	pos += 1;
+	dinTemplateAddPhysicalValue(tmpl, &pos, &res->EVSEPresentCurrent, 0x04);
+
+	/* EVSECurrentLimitAchieved, EVSEVoltageLimitAchieved and EVSEPowerLimitAchieved: SE, CH, value, EE */
+	pos += 2;
+	dinTemplateAddField(tmpl, &pos, 1, res->EVSECurrentLimitAchieved ? 1 : 0);
+	pos += 1;
+	pos += 2;
+	dinTemplateAddField(tmpl, &pos, 1, res->EVSEVoltageLimitAchieved ? 1 : 0);
+	pos += 1;
+	pos += 2;
+	dinTemplateAddField(tmpl, &pos, 1, res->EVSEPowerLimitAchieved ? 1 : 0);
+	pos += 1;
+
+	/* optional limits, the event code width depends on the grammar state */
+	if(res->EVSEMaximumVoltageLimit_isUsed == 1u) {
+		tmpl->shape |= 0x08;
+		pos += 3;
+		dinTemplateAddPhysicalValue(tmpl, &pos, &res->EVSEMaximumVoltageLimit, 0x40);
+		grammarID = 36;
+	}
+	if(res->EVSEMaximumCurrentLimit_isUsed == 1u) {
+		tmpl->shape |= 0x10;
+		pos += (grammarID == 35) ? 3 : 2;
+		dinTemplateAddPhysicalValue(tmpl, &pos, &res->EVSEMaximumCurrentLimit, 0x80);
+		grammarID = 37;
+	}
+	if(res->EVSEMaximumPowerLimit_isUsed == 1u) {
+		tmpl->shape |= 0x20;
+		pos += (grammarID == 35) ? 3 : 2;
+		dinTemplateAddPhysicalValue(tmpl, &pos, &res->EVSEMaximumPowerLimit, 0x100);
+		grammarID = 4;
+	}
+	/* CurrentDemandRes EE */
+	pos += (grammarID == 35) ? 3 : ((grammarID == 4) ? 1 : 2);
+
+	/* Body EE, V2G_Message EE */
+	pos += 2;
+	return pos;
+}
+
+/* The cached message can be patched if all optional elements, the SessionID and the width of every
+ * variable length integer are unchanged */
+static int dinCurrentDemandResTemplateMatches(struct dinCurrentDemandResTemplate* tmpl, struct dinCurrentDemandResTemplate* layout, struct dinMessageHeaderType* header) {
+	size_t i;
+	if(tmpl->bytesLen == 0 || tmpl->shape != layout->shape || tmpl->fieldsLen != layout->fieldsLen
+			|| tmpl->sessionIDLen != header->SessionID.bytesLen) {
+		return 0;
+	}
+	for(i = 0; i < tmpl->sessionIDLen; i++) {
+		if(tmpl->sessionID[i] != header->SessionID.bytes[i]) {
+			return 0;
+		}
+	}
+	for(i = 0; i < tmpl->fieldsLen; i++) {
+		if(tmpl->fields[i].pos != layout->fields[i].pos || tmpl->fields[i].len != layout->fields[i].len) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static void dinCurrentDemandResTemplatePatch(uint8_t* bytes, size_t pos, uint8_t len, uint64_t bits) {
+	uint8_t mask;
+	while(len > 0) {
+		len--;
+		mask = (uint8_t)(0x80 >> (pos & 7));
+		if((bits >> len) & 1) {
+			bytes[pos >> 3] |= mask;
+		} else {
+			bytes[pos >> 3] &= (uint8_t)~mask;
+		}
+		pos++;
+	}
+}
+#endif /* EXI_STREAM == BYTE_ARRAY && EXI_OPTION_ALIGNMENT != BYTE_ALIGNMENT */
+
+void init_dinCurrentDemandResTemplate(struct dinCurrentDemandResTemplate* tmpl) {
+	tmpl->bytesLen = 0;
+	tmpl->fieldsLen = 0;
+}
+
+int encode_dinCurrentDemandResTemplate(bitstream_t* stream, struct dinCurrentDemandResTemplate* tmpl, struct dinMessageHeaderType* header, struct dinCurrentDemandResType* res) {
+	int errn;
+#if EXI_STREAM == BYTE_ARRAY && EXI_OPTION_ALIGNMENT != BYTE_ALIGNMENT
+	struct dinCurrentDemandResTemplate layout;
+	size_t bitsLen;
+	size_t start = *stream->pos;
+	size_t i;
+	/* the recorded bit positions are those of a bit-packed stream, which has a data-array and no
+	 * value table to empty (see writeEXIHeader) */
+	int cacheable = EXI_STREAM_ALIGNMENT(stream) == BIT_PACKED && header->Notification_isUsed == 0u && header->Signature_isUsed == 0u;
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+	cacheable = cacheable && stream->data != NULL;
+#endif /* ENCODER_DIGEST_SHA256 */
+#if EXI_OPTION_VALUE_PARTITION_CAPACITY != 0
+	cacheable = cacheable && stream->valueTable == NULL;
+#endif /* EXI_OPTION_VALUE_PARTITION_CAPACITY */
+
+	bitsLen = dinCurrentDemandResTemplateLayout(&layout, header, res);
+	if(cacheable && dinCurrentDemandResTemplateMatches(tmpl, &layout, header)) {
+		if(start + tmpl->bytesLen > stream->size) {
+			return EXI_ERROR_OUTPUT_STREAM_EOF;
+		}
+		for(i = 0; i < tmpl->fieldsLen; i++) {
+			if(tmpl->fields[i].bits != layout.fields[i].bits) {
+				dinCurrentDemandResTemplatePatch(tmpl->bytes, tmpl->fields[i].pos, tmpl->fields[i].len, layout.fields[i].bits);
+				tmpl->fields[i].bits = layout.fields[i].bits;
+			}
+		}
+		for(i = 0; i < tmpl->bytesLen; i++) {
+			stream->data[start + i] = tmpl->bytes[i];
+		}
+		*stream->pos = start + tmpl->bytesLen;
+		/* the bit writer as writeEXIHeader and encodeFinish leave it */
+#if BIT_WRITER == BIT_WRITER_WORD
+		stream->word = 0;
+		stream->capacity = 64;
+#else
+		stream->buffer = 0;
+		stream->capacity = 8;
+#endif /* BIT_WRITER_WORD */
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+		stream->digest = NULL;
+#endif /* ENCODER_DIGEST_SHA256 */
+		return 0;
+	}
+#endif /* EXI_STREAM == BYTE_ARRAY && EXI_OPTION_ALIGNMENT != BYTE_ALIGNMENT */
+
+	/* encode the whole message, same event codes as encode_dinExiDocument */
+	errn = writeEXIHeader(stream);
+	if(errn == 0) {
+		/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}V2G_Message) */
+		errn = encodeNBitUnsignedInteger(stream, 7, 77);
+	}
+	if(errn == 0) {
+		/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}Header) */
+		errn = encodeNBitUnsignedInteger(stream, 1, 0);
+	}
+	if(errn == 0) {
+		errn = encode_dinMessageHeaderType(stream, header);
+	}
+	if(errn == 0) {
+		/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}Body) */
+		errn = encodeNBitUnsignedInteger(stream, 1, 0);
+	}
+	if(errn == 0) {
+		/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandRes) */
+		errn = encodeNBitUnsignedInteger(stream, 6, 14);
+	}
+	if(errn == 0) {
+		errn = encode_dinCurrentDemandResType(stream, res);
+	}
+	if(errn == 0) {
+		/* Body and V2G_Message END_ELEMENT */
+		errn = encodeNBitUnsignedInteger(stream, 2, 0);
+	}
+	if(errn == 0) {
+		/* flush any pending bits */
+		errn = encodeFinish(stream);
+	}
+
+	tmpl->bytesLen = 0;
+#if EXI_STREAM == BYTE_ARRAY && EXI_OPTION_ALIGNMENT != BYTE_ALIGNMENT
+	if(errn == 0 && cacheable && *stream->pos - start == (bitsLen + 7) / 8
+			&& *stream->pos - start <= dinCurrentDemandResTemplate_BYTES_SIZE
+			&& layout.fieldsLen <= dinCurrentDemandResTemplate_FIELDS_SIZE) {
+		for(i = 0; i < *stream->pos - start; i++) {
+			tmpl->bytes[i] = stream->data[start + i];
+		}
+		for(i = 0; i < layout.fieldsLen; i++) {
+			tmpl->fields[i] = layout.fields[i];
+		}
+		for(i = 0; i < header->SessionID.bytesLen; i++) {
+			tmpl->sessionID[i] = header->SessionID.bytes[i];
+		}
+		tmpl->sessionIDLen = header->SessionID.bytesLen;
+		tmpl->shape = layout.shape;
+		tmpl->fieldsLen = layout.fieldsLen;
+		tmpl->bytesLen = *stream->pos - start;
+	}
+#endif /* EXI_STREAM == BYTE_ARRAY && EXI_OPTION_ALIGNMENT != BYTE_ALIGNMENT */
+
+	return errn;
+}
+#endif /* DIN_DEPLOY_CurrentDemandRes */
+
 #if DEPLOY_DIN_CODEC_FRAGMENT == SUPPORT_YES
 int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
+	int errn = 0;
 	errn = writeEXIHeader(stream);
 
 	if(errn == 0) {
 		/* FragmentContent[START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}AC_EVSEStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgDef}Body), START_ELEMENT({urn:iso:15118:2:2010:MsgDef}BodyElement), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}BulkChargingComplete), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}BulkChargingComplete), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}BulkSOC), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Certificate), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeService), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingComplete), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ChargingComplete), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingProfile), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ChargingProfileEntryMaxPower), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ChargingProfileEntryStart), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusRes), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ConsumptionCost), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractID), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractSignatureCertChain), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractSignatureEncryptedPrivateKey), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Cost), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandRes), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVPowerDeliveryParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}DC_EVSEStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}DC_EVStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}DHParams), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}DateTimeNow), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DepartureTime), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EAmount), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EPriceLevel), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVCCID), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVCabinConditioning), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVEnergyCapacity), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVEnergyRequest), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVErrorCode), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVMaxCurrent), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVMaxVoltage), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVMaximumCurrentLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVMaximumCurrentLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVMaximumPowerLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVMaximumPowerLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVMaximumVoltageLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVMaximumVoltageLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVMinCurrent), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVPowerDeliveryParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVRESSConditioning), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVRESSSOC), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVReady), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVRequestedEnergyTransferType), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSECurrentLimitAchieved), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSECurrentRegulationTolerance), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEEnergyToBeDelivered), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSEID), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEIsolationStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSEMaxCurrent), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEMaxCurrent), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEMaxVoltage), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSEMaximumCurrentLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEMaximumCurrentLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSEMaximumPowerLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEMaximumPowerLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSEMaximumVoltageLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEMaximumVoltageLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEMinCurrent), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEMinimumCurrentLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEMinimumVoltageLimit), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSENotification), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEPeakCurrentRipple), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSEPowerLimitAchieved), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSEPresentCurrent), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSEPresentVoltage), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSEProcessing), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEStatusCode), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSEVoltageLimitAchieved), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVTargetCurrent), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVTargetVoltage), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EnergyTransferType), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Entry), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Exponent), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}FaultCode), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}FaultMsg), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}FreeService), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}FullSOC), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}G), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}GenChallenge), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}HMACOutputLength), START_ELEMENT({urn:iso:15118:2:2010:MsgDef}Header), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}J), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ListOfRootCertificateIDs), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}MeterID), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeterInfo), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}MeterReading), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}MeterStatus), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Modulus), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Multiplier), START_ELEMENT({urn:iso:15118:2:2010:MsgHeader}Notification), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}NotificationMaxDelay), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}NumEPriceLevels), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}OEMProvisioningCert), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}P), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyID), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyPacket), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PMax), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PMaxSchedule), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PMaxScheduleEntry), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PMaxScheduleID), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Parameter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ParameterSet), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ParameterSetID), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsRes), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PaymentOption), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentOptions), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PgenCounter), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryRes), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PowerSwitchClosed), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeRes), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ProfileEntry), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Q), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}RCD), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ReadyToChargeState), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ReceiptRequired), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}RelativeTimeInterval), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}RemainingTimeToBulkSoC), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}RemainingTimeToFullSoC), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ResponseCode), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}RetryCounter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SAScheduleList), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SAScheduleTuple), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SAScheduleTupleID), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SAScheduleTupleID), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SASchedules), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKISexp), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SalesTariff), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SalesTariffDescription), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SalesTariffEntry), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SalesTariffID), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Seed), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SelectedPaymentOption), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SelectedService), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SelectedServiceList), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Service), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceCategory), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ServiceCategory), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ServiceCharge), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceID), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ServiceID), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceList), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ServiceName), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceParameterList), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceScope), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ServiceScope), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ServiceTag), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionID), START_ELEMENT({urn:iso:15118:2:2010:MsgHeader}SessionID), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupRes), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopRes), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SigMeterReading), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SubCertificates), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}TMeter), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}TimeInterval), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Unit), START_ELEMENT({urn:iso:15118:2:2010:MsgDef}V2G_Message), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Value), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionReq), START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509CRL), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Certificate), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerSerial), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509SKI), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509SerialNumber), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509SubjectName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}XPath), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Y), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}amount), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}amountMultiplier), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}boolValue), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}byteValue), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}costKind), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}duration), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}intValue), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}physicalValue), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}shortValue), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}start), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}startValue), START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}stringValue), START_ELEMENT_GENERIC, END_DOCUMENT] */
 		if ( exiFrag->AC_EVChargeParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_AC_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 0);
 			if(errn == 0) {
 				errn = encode_dinAC_EVChargeParameterType(stream, &exiFrag->AC_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_AC_EVChargeParameter */
 		} else if ( exiFrag->AC_EVSEChargeParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_AC_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 1);
 			if(errn == 0) {
 				errn = encode_dinAC_EVSEChargeParameterType(stream, &exiFrag->AC_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_AC_EVSEChargeParameter */
 		} else if ( exiFrag->AC_EVSEStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_AC_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}AC_EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 2);
 			if(errn == 0) {
 				errn = encode_dinAC_EVSEStatusType(stream, &exiFrag->AC_EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_AC_EVSEStatus */
 		} else if ( exiFrag->AC_EVSEStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_AC_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 3);
 			if(errn == 0) {
 				errn = encode_dinAC_EVSEStatusType(stream, &exiFrag->AC_EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_AC_EVSEStatus */
 		} else if ( exiFrag->Body_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}Body) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 4);
@@ -10602,11 +11404,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				errn = encode_dinBodyType(stream, &exiFrag->Body );
 			}
 		} else if ( exiFrag->BodyElement_isUsed == 1u ) { 
+#if DIN_DEPLOY_BodyElement == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}BodyElement) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 5);
 			if(errn == 0) {
 				errn = encode_dinBodyBaseType(stream, &exiFrag->BodyElement );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_BodyElement */
 		} else if ( exiFrag->BulkChargingComplete_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}BulkChargingComplete) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 6);
@@ -10644,23 +11450,35 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->CableCheckReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_CableCheckReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 9);
 			if(errn == 0) {
 				errn = encode_dinCableCheckReqType(stream, &exiFrag->CableCheckReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CableCheckReq */
 		} else if ( exiFrag->CableCheckRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_CableCheckRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 10);
 			if(errn == 0) {
 				errn = encode_dinCableCheckResType(stream, &exiFrag->CableCheckRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CableCheckRes */
 		} else if ( exiFrag->CanonicalizationMethod_isUsed == 1u ) { 
+#if DIN_DEPLOY_CanonicalizationMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 11);
 			if(errn == 0) {
 				errn = encode_dinCanonicalizationMethodType(stream, &exiFrag->CanonicalizationMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CanonicalizationMethod */
 		} else if ( exiFrag->Certificate_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Certificate) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 12);
@@ -10677,41 +11495,65 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->CertificateInstallationReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 13);
 			if(errn == 0) {
 				errn = encode_dinCertificateInstallationReqType(stream, &exiFrag->CertificateInstallationReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CertificateInstallationReq */
 		} else if ( exiFrag->CertificateInstallationRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 14);
 			if(errn == 0) {
 				errn = encode_dinCertificateInstallationResType(stream, &exiFrag->CertificateInstallationRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CertificateInstallationRes */
 		} else if ( exiFrag->CertificateUpdateReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 15);
 			if(errn == 0) {
 				errn = encode_dinCertificateUpdateReqType(stream, &exiFrag->CertificateUpdateReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CertificateUpdateReq */
 		} else if ( exiFrag->CertificateUpdateRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 16);
 			if(errn == 0) {
 				errn = encode_dinCertificateUpdateResType(stream, &exiFrag->CertificateUpdateRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CertificateUpdateRes */
 		} else if ( exiFrag->ChargeParameterDiscoveryReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 17);
 			if(errn == 0) {
 				errn = encode_dinChargeParameterDiscoveryReqType(stream, &exiFrag->ChargeParameterDiscoveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryReq */
 		} else if ( exiFrag->ChargeParameterDiscoveryRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 18);
 			if(errn == 0) {
 				errn = encode_dinChargeParameterDiscoveryResType(stream, &exiFrag->ChargeParameterDiscoveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ChargeParameterDiscoveryRes */
 		} else if ( exiFrag->ChargeService_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeService) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 19);
@@ -10773,17 +11615,25 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->ChargingStatusReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_ChargingStatusReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 25);
 			if(errn == 0) {
 				errn = encode_dinChargingStatusReqType(stream, &exiFrag->ChargingStatusReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ChargingStatusReq */
 		} else if ( exiFrag->ChargingStatusRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_ChargingStatusRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 26);
 			if(errn == 0) {
 				errn = encode_dinChargingStatusResType(stream, &exiFrag->ChargingStatusRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ChargingStatusRes */
 		} else if ( exiFrag->ConsumptionCost_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ConsumptionCost) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 27);
@@ -10791,17 +11641,25 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				errn = encode_dinConsumptionCostType(stream, &exiFrag->ConsumptionCost );
 			}
 		} else if ( exiFrag->ContractAuthenticationReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_ContractAuthenticationReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 28);
 			if(errn == 0) {
 				errn = encode_dinContractAuthenticationReqType(stream, &exiFrag->ContractAuthenticationReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ContractAuthenticationReq */
 		} else if ( exiFrag->ContractAuthenticationRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_ContractAuthenticationRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 29);
 			if(errn == 0) {
 				errn = encode_dinContractAuthenticationResType(stream, &exiFrag->ContractAuthenticationRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ContractAuthenticationRes */
 		} else if ( exiFrag->ContractID_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractID) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 30);
@@ -10809,11 +11667,8 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->ContractID.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->ContractID.characters, exiFrag->ContractID.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2010:MsgBody}ContractID */, exiFrag->ContractID.characters, exiFrag->ContractID.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -10846,59 +11701,95 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				errn = encode_dinCostType(stream, &exiFrag->Cost );
 			}
 		} else if ( exiFrag->CurrentDemandReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_CurrentDemandReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 34);
 			if(errn == 0) {
 				errn = encode_dinCurrentDemandReqType(stream, &exiFrag->CurrentDemandReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CurrentDemandReq */
 		} else if ( exiFrag->CurrentDemandRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 35);
 			if(errn == 0) {
 				errn = encode_dinCurrentDemandResType(stream, &exiFrag->CurrentDemandRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_CurrentDemandRes */
 		} else if ( exiFrag->DC_EVChargeParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_DC_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 36);
 			if(errn == 0) {
 				errn = encode_dinDC_EVChargeParameterType(stream, &exiFrag->DC_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DC_EVChargeParameter */
 		} else if ( exiFrag->DC_EVPowerDeliveryParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_DC_EVPowerDeliveryParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVPowerDeliveryParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 37);
 			if(errn == 0) {
 				errn = encode_dinDC_EVPowerDeliveryParameterType(stream, &exiFrag->DC_EVPowerDeliveryParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DC_EVPowerDeliveryParameter */
 		} else if ( exiFrag->DC_EVSEChargeParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_DC_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 38);
 			if(errn == 0) {
 				errn = encode_dinDC_EVSEChargeParameterType(stream, &exiFrag->DC_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DC_EVSEChargeParameter */
 		} else if ( exiFrag->DC_EVSEStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_DC_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}DC_EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 39);
 			if(errn == 0) {
 				errn = encode_dinDC_EVSEStatusType(stream, &exiFrag->DC_EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DC_EVSEStatus */
 		} else if ( exiFrag->DC_EVSEStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_DC_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 40);
 			if(errn == 0) {
 				errn = encode_dinDC_EVSEStatusType(stream, &exiFrag->DC_EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DC_EVSEStatus */
 		} else if ( exiFrag->DC_EVStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_DC_EVStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}DC_EVStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 41);
 			if(errn == 0) {
 				errn = encode_dinDC_EVStatusType(stream, &exiFrag->DC_EVStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DC_EVStatus */
 		} else if ( exiFrag->DC_EVStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_DC_EVStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 42);
 			if(errn == 0) {
 				errn = encode_dinDC_EVStatusType(stream, &exiFrag->DC_EVStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DC_EVStatus */
 		} else if ( exiFrag->DHParams_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}DHParams) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 43);
@@ -10915,11 +11806,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->DSAKeyValue_isUsed == 1u ) { 
+#if DIN_DEPLOY_DSAKeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 44);
 			if(errn == 0) {
 				errn = encode_dinDSAKeyValueType(stream, &exiFrag->DSAKeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DSAKeyValue */
 		} else if ( exiFrag->DateTimeNow_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}DateTimeNow) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 45);
@@ -10945,11 +11840,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->DigestMethod_isUsed == 1u ) { 
+#if DIN_DEPLOY_DigestMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 47);
 			if(errn == 0) {
 				errn = encode_dinDigestMethodType(stream, &exiFrag->DigestMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_DigestMethod */
 		} else if ( exiFrag->DigestValue_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 48);
@@ -11011,11 +11910,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->EVChargeParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 53);
 			if(errn == 0) {
 				errn = encode_dinEVChargeParameterType(stream, &exiFrag->EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_EVChargeParameter */
 		} else if ( exiFrag->EVEnergyCapacity_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVEnergyCapacity) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 54);
@@ -11095,11 +11998,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				errn = encode_dinPhysicalValueType(stream, &exiFrag->EVMinCurrent );
 			}
 		} else if ( exiFrag->EVPowerDeliveryParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_EVPowerDeliveryParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVPowerDeliveryParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 66);
 			if(errn == 0) {
 				errn = encode_dinEVPowerDeliveryParameterType(stream, &exiFrag->EVPowerDeliveryParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_EVPowerDeliveryParameter */
 		} else if ( exiFrag->EVRESSConditioning_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVRESSConditioning) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 67);
@@ -11149,11 +12056,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->EVSEChargeParameter_isUsed == 1u ) { 
+#if DIN_DEPLOY_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 71);
 			if(errn == 0) {
 				errn = encode_dinEVSEChargeParameterType(stream, &exiFrag->EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_EVSEChargeParameter */
 		} else if ( exiFrag->EVSECurrentLimitAchieved_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVSECurrentLimitAchieved) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 72);
@@ -11332,11 +12243,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->EVSEStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 95);
 			if(errn == 0) {
 				errn = encode_dinEVSEStatusType(stream, &exiFrag->EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_EVSEStatus */
 		} else if ( exiFrag->EVSEStatusCode_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEStatusCode) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 96);
@@ -11362,11 +12277,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->EVStatus_isUsed == 1u ) { 
+#if DIN_DEPLOY_EVStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 98);
 			if(errn == 0) {
 				errn = encode_dinEVStatusType(stream, &exiFrag->EVStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_EVStatus */
 		} else if ( exiFrag->EVTargetCurrent_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}EVTargetCurrent) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 99);
@@ -11392,11 +12311,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->Entry_isUsed == 1u ) { 
+#if DIN_DEPLOY_Entry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Entry) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 102);
 			if(errn == 0) {
 				errn = encode_dinEntryType(stream, &exiFrag->Entry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Entry */
 		} else if ( exiFrag->Exponent_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Exponent) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 103);
@@ -11431,11 +12354,8 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->FaultMsg.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->FaultMsg.characters, exiFrag->FaultMsg.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 16 /* {urn:iso:15118:2:2010:MsgDataTypes}FaultMsg */, exiFrag->FaultMsg.characters, exiFrag->FaultMsg.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -11486,11 +12406,8 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->GenChallenge.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->GenChallenge.characters, exiFrag->GenChallenge.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 14 /* {urn:iso:15118:2:2010:MsgBody}GenChallenge */, exiFrag->GenChallenge.characters, exiFrag->GenChallenge.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -11529,11 +12446,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->KeyInfo_isUsed == 1u ) { 
+#if DIN_DEPLOY_KeyInfo == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 113);
 			if(errn == 0) {
 				errn = encode_dinKeyInfoType(stream, &exiFrag->KeyInfo );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_KeyInfo */
 		} else if ( exiFrag->KeyName_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 114);
@@ -11541,21 +12462,22 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->KeyName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->KeyName.characters, exiFrag->KeyName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiFrag->KeyName.characters, exiFrag->KeyName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiFrag->KeyValue_isUsed == 1u ) { 
+#if DIN_DEPLOY_KeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 115);
 			if(errn == 0) {
 				errn = encode_dinKeyValueType(stream, &exiFrag->KeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_KeyValue */
 		} else if ( exiFrag->ListOfRootCertificateIDs_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ListOfRootCertificateIDs) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 116);
@@ -11563,11 +12485,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				errn = encode_dinListOfRootCertificateIDsType(stream, &exiFrag->ListOfRootCertificateIDs );
 			}
 		} else if ( exiFrag->Manifest_isUsed == 1u ) { 
+#if DIN_DEPLOY_Manifest == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 117);
 			if(errn == 0) {
 				errn = encode_dinManifestType(stream, &exiFrag->Manifest );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Manifest */
 		} else if ( exiFrag->MeterID_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}MeterID) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 118);
@@ -11575,11 +12501,8 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->MeterID.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->MeterID.characters, exiFrag->MeterID.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 17 /* {urn:iso:15118:2:2010:MsgDataTypes}MeterID */, exiFrag->MeterID.characters, exiFrag->MeterID.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -11609,17 +12532,25 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->MeteringReceiptReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 122);
 			if(errn == 0) {
 				errn = encode_dinMeteringReceiptReqType(stream, &exiFrag->MeteringReceiptReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_MeteringReceiptReq */
 		} else if ( exiFrag->MeteringReceiptRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 123);
 			if(errn == 0) {
 				errn = encode_dinMeteringReceiptResType(stream, &exiFrag->MeteringReceiptRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_MeteringReceiptRes */
 		} else if ( exiFrag->MgmtData_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 124);
@@ -11627,11 +12558,8 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->MgmtData.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->MgmtData.characters, exiFrag->MgmtData.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiFrag->MgmtData.characters, exiFrag->MgmtData.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -11709,11 +12637,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->Object_isUsed == 1u ) { 
+#if DIN_DEPLOY_Object == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 131);
 			if(errn == 0) {
 				errn = encode_dinObjectType(stream, &exiFrag->Object );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Object */
 		} else if ( exiFrag->P_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}P) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 132);
@@ -11730,11 +12662,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->PGPData_isUsed == 1u ) { 
+#if DIN_DEPLOY_PGPData == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 133);
 			if(errn == 0) {
 				errn = encode_dinPGPDataType(stream, &exiFrag->PGPData );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PGPData */
 		} else if ( exiFrag->PGPKeyID_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyID) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 134);
@@ -11784,11 +12720,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				errn = encode_dinPMaxScheduleType(stream, &exiFrag->PMaxSchedule );
 			}
 		} else if ( exiFrag->PMaxScheduleEntry_isUsed == 1u ) { 
+#if DIN_DEPLOY_PMaxScheduleEntry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PMaxScheduleEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 138);
 			if(errn == 0) {
 				errn = encode_dinPMaxScheduleEntryType(stream, &exiFrag->PMaxScheduleEntry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PMaxScheduleEntry */
 		} else if ( exiFrag->PMaxScheduleID_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PMaxScheduleID) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 139);
@@ -11826,17 +12766,25 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->PaymentDetailsReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 143);
 			if(errn == 0) {
 				errn = encode_dinPaymentDetailsReqType(stream, &exiFrag->PaymentDetailsReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PaymentDetailsReq */
 		} else if ( exiFrag->PaymentDetailsRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 144);
 			if(errn == 0) {
 				errn = encode_dinPaymentDetailsResType(stream, &exiFrag->PaymentDetailsRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PaymentDetailsRes */
 		} else if ( exiFrag->PaymentOption_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PaymentOption) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 145);
@@ -11871,17 +12819,25 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->PowerDeliveryReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 148);
 			if(errn == 0) {
 				errn = encode_dinPowerDeliveryReqType(stream, &exiFrag->PowerDeliveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PowerDeliveryReq */
 		} else if ( exiFrag->PowerDeliveryRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 149);
 			if(errn == 0) {
 				errn = encode_dinPowerDeliveryResType(stream, &exiFrag->PowerDeliveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PowerDeliveryRes */
 		} else if ( exiFrag->PowerSwitchClosed_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PowerSwitchClosed) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 150);
@@ -11895,17 +12851,25 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->PreChargeReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_PreChargeReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 151);
 			if(errn == 0) {
 				errn = encode_dinPreChargeReqType(stream, &exiFrag->PreChargeReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PreChargeReq */
 		} else if ( exiFrag->PreChargeRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_PreChargeRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 152);
 			if(errn == 0) {
 				errn = encode_dinPreChargeResType(stream, &exiFrag->PreChargeRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_PreChargeRes */
 		} else if ( exiFrag->ProfileEntry_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ProfileEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 153);
@@ -11940,11 +12904,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->RSAKeyValue_isUsed == 1u ) { 
+#if DIN_DEPLOY_RSAKeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 156);
 			if(errn == 0) {
 				errn = encode_dinRSAKeyValueType(stream, &exiFrag->RSAKeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_RSAKeyValue */
 		} else if ( exiFrag->ReadyToChargeState_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ReadyToChargeState) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 157);
@@ -11970,17 +12938,25 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->Reference_isUsed == 1u ) { 
+#if DIN_DEPLOY_Reference == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 159);
 			if(errn == 0) {
 				errn = encode_dinReferenceType(stream, &exiFrag->Reference );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Reference */
 		} else if ( exiFrag->RelativeTimeInterval_isUsed == 1u ) { 
+#if DIN_DEPLOY_RelativeTimeInterval == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}RelativeTimeInterval) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 160);
 			if(errn == 0) {
 				errn = encode_dinRelativeTimeIntervalType(stream, &exiFrag->RelativeTimeInterval );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_RelativeTimeInterval */
 		} else if ( exiFrag->RemainingTimeToBulkSoC_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}RemainingTimeToBulkSoC) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 161);
@@ -12006,11 +12982,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->RetrievalMethod_isUsed == 1u ) { 
+#if DIN_DEPLOY_RetrievalMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 164);
 			if(errn == 0) {
 				errn = encode_dinRetrievalMethodType(stream, &exiFrag->RetrievalMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_RetrievalMethod */
 		} else if ( exiFrag->RetryCounter_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}RetryCounter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 165);
@@ -12030,21 +13010,22 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->RootCertificateID.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->RootCertificateID.characters, exiFrag->RootCertificateID.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 18 /* {urn:iso:15118:2:2010:MsgDataTypes}RootCertificateID */, exiFrag->RootCertificateID.characters, exiFrag->RootCertificateID.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiFrag->SAScheduleList_isUsed == 1u ) { 
+#if DIN_DEPLOY_SAScheduleList == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SAScheduleList) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 167);
 			if(errn == 0) {
 				errn = encode_dinSAScheduleListType(stream, &exiFrag->SAScheduleList );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SAScheduleList */
 		} else if ( exiFrag->SAScheduleTuple_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SAScheduleTuple) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 168);
@@ -12076,17 +13057,25 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->SASchedules_isUsed == 1u ) { 
+#if DIN_DEPLOY_SASchedules == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SASchedules) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 171);
 			if(errn == 0) {
 				errn = encode_dinSASchedulesType(stream, &exiFrag->SASchedules );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SASchedules */
 		} else if ( exiFrag->SPKIData_isUsed == 1u ) { 
+#if DIN_DEPLOY_SPKIData == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 172);
 			if(errn == 0) {
 				errn = encode_dinSPKIDataType(stream, &exiFrag->SPKIData );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SPKIData */
 		} else if ( exiFrag->SPKISexp_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKISexp) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 173);
@@ -12115,21 +13104,22 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->SalesTariffDescription.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->SalesTariffDescription.characters, exiFrag->SalesTariffDescription.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 19 /* {urn:iso:15118:2:2010:MsgDataTypes}SalesTariffDescription */, exiFrag->SalesTariffDescription.characters, exiFrag->SalesTariffDescription.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiFrag->SalesTariffEntry_isUsed == 1u ) { 
+#if DIN_DEPLOY_SalesTariffEntry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SalesTariffEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 176);
 			if(errn == 0) {
 				errn = encode_dinSalesTariffEntryType(stream, &exiFrag->SalesTariffEntry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SalesTariffEntry */
 		} else if ( exiFrag->SalesTariffID_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SalesTariffID) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 177);
@@ -12212,35 +13202,55 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->ServiceCharge_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServiceCharge == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ServiceCharge) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 185);
 			if(errn == 0) {
 				errn = encode_dinServiceChargeType(stream, &exiFrag->ServiceCharge );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceCharge */
 		} else if ( exiFrag->ServiceDetailReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServiceDetailReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 186);
 			if(errn == 0) {
 				errn = encode_dinServiceDetailReqType(stream, &exiFrag->ServiceDetailReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceDetailReq */
 		} else if ( exiFrag->ServiceDetailRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServiceDetailRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 187);
 			if(errn == 0) {
 				errn = encode_dinServiceDetailResType(stream, &exiFrag->ServiceDetailRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceDetailRes */
 		} else if ( exiFrag->ServiceDiscoveryReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 188);
 			if(errn == 0) {
 				errn = encode_dinServiceDiscoveryReqType(stream, &exiFrag->ServiceDiscoveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceDiscoveryReq */
 		} else if ( exiFrag->ServiceDiscoveryRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 189);
 			if(errn == 0) {
 				errn = encode_dinServiceDiscoveryResType(stream, &exiFrag->ServiceDiscoveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServiceDiscoveryRes */
 		} else if ( exiFrag->ServiceID_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceID) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 190);
@@ -12278,11 +13288,8 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->ServiceName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->ServiceName.characters, exiFrag->ServiceName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 20 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceName */, exiFrag->ServiceName.characters, exiFrag->ServiceName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -12294,17 +13301,25 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				errn = encode_dinServiceParameterListType(stream, &exiFrag->ServiceParameterList );
 			}
 		} else if ( exiFrag->ServicePaymentSelectionReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServicePaymentSelectionReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 195);
 			if(errn == 0) {
 				errn = encode_dinServicePaymentSelectionReqType(stream, &exiFrag->ServicePaymentSelectionReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServicePaymentSelectionReq */
 		} else if ( exiFrag->ServicePaymentSelectionRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_ServicePaymentSelectionRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 196);
 			if(errn == 0) {
 				errn = encode_dinServicePaymentSelectionResType(stream, &exiFrag->ServicePaymentSelectionRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_ServicePaymentSelectionRes */
 		} else if ( exiFrag->ServiceScope_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceScope) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 197);
@@ -12312,11 +13327,8 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->ServiceScope.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->ServiceScope.characters, exiFrag->ServiceScope.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {urn:iso:15118:2:2010:MsgBody}ServiceScope */, exiFrag->ServiceScope.characters, exiFrag->ServiceScope.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -12328,11 +13340,8 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->ServiceScope.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->ServiceScope.characters, exiFrag->ServiceScope.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 21 /* {urn:iso:15118:2:2010:MsgDataTypes}ServiceScope */, exiFrag->ServiceScope.characters, exiFrag->ServiceScope.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -12374,29 +13383,45 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->SessionSetupReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_SessionSetupReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 202);
 			if(errn == 0) {
 				errn = encode_dinSessionSetupReqType(stream, &exiFrag->SessionSetupReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SessionSetupReq */
 		} else if ( exiFrag->SessionSetupRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_SessionSetupRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 203);
 			if(errn == 0) {
 				errn = encode_dinSessionSetupResType(stream, &exiFrag->SessionSetupRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SessionSetupRes */
 		} else if ( exiFrag->SessionStopReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_SessionStopReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 204);
 			if(errn == 0) {
 				errn = encode_dinSessionStopType(stream, &exiFrag->SessionStopReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SessionStopReq */
 		} else if ( exiFrag->SessionStopRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_SessionStopRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 205);
 			if(errn == 0) {
 				errn = encode_dinSessionStopResType(stream, &exiFrag->SessionStopRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SessionStopRes */
 		} else if ( exiFrag->SigMeterReading_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SigMeterReading) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 206);
@@ -12413,41 +13438,65 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->Signature_isUsed == 1u ) { 
+#if DIN_DEPLOY_Signature == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 207);
 			if(errn == 0) {
 				errn = encode_dinSignatureType(stream, &exiFrag->Signature );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Signature */
 		} else if ( exiFrag->SignatureMethod_isUsed == 1u ) { 
+#if DIN_DEPLOY_SignatureMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 208);
 			if(errn == 0) {
 				errn = encode_dinSignatureMethodType(stream, &exiFrag->SignatureMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SignatureMethod */
 		} else if ( exiFrag->SignatureProperties_isUsed == 1u ) { 
+#if DIN_DEPLOY_SignatureProperties == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 209);
 			if(errn == 0) {
 				errn = encode_dinSignaturePropertiesType(stream, &exiFrag->SignatureProperties );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SignatureProperties */
 		} else if ( exiFrag->SignatureProperty_isUsed == 1u ) { 
+#if DIN_DEPLOY_SignatureProperty == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 210);
 			if(errn == 0) {
 				errn = encode_dinSignaturePropertyType(stream, &exiFrag->SignatureProperty );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SignatureProperty */
 		} else if ( exiFrag->SignatureValue_isUsed == 1u ) { 
+#if DIN_DEPLOY_SignatureValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 211);
 			if(errn == 0) {
 				errn = encode_dinSignatureValueType(stream, &exiFrag->SignatureValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SignatureValue */
 		} else if ( exiFrag->SignedInfo_isUsed == 1u ) { 
+#if DIN_DEPLOY_SignedInfo == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 212);
 			if(errn == 0) {
 				errn = encode_dinSignedInfoType(stream, &exiFrag->SignedInfo );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_SignedInfo */
 		} else if ( exiFrag->SubCertificates_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SubCertificates) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 213);
@@ -12467,23 +13516,35 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->TimeInterval_isUsed == 1u ) { 
+#if DIN_DEPLOY_TimeInterval == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}TimeInterval) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 215);
 			if(errn == 0) {
 				errn = encode_dinIntervalType(stream, &exiFrag->TimeInterval );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_TimeInterval */
 		} else if ( exiFrag->Transform_isUsed == 1u ) { 
+#if DIN_DEPLOY_Transform == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 216);
 			if(errn == 0) {
 				errn = encode_dinTransformType(stream, &exiFrag->Transform );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Transform */
 		} else if ( exiFrag->Transforms_isUsed == 1u ) { 
+#if DIN_DEPLOY_Transforms == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 217);
 			if(errn == 0) {
 				errn = encode_dinTransformsType(stream, &exiFrag->Transforms );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_Transforms */
 		} else if ( exiFrag->Unit_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Unit) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 218);
@@ -12497,11 +13558,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->V2G_Message_isUsed == 1u ) { 
+#if DIN_DEPLOY_V2G_Message == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}V2G_Message) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 219);
 			if(errn == 0) {
 				errn = encode_dinAnonType_V2G_Message(stream, &exiFrag->V2G_Message );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_V2G_Message */
 		} else if ( exiFrag->Value_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Value) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 220);
@@ -12515,17 +13580,25 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->WeldingDetectionReq_isUsed == 1u ) { 
+#if DIN_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 221);
 			if(errn == 0) {
 				errn = encode_dinWeldingDetectionReqType(stream, &exiFrag->WeldingDetectionReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_WeldingDetectionReq */
 		} else if ( exiFrag->WeldingDetectionRes_isUsed == 1u ) { 
+#if DIN_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 222);
 			if(errn == 0) {
 				errn = encode_dinWeldingDetectionResType(stream, &exiFrag->WeldingDetectionRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_WeldingDetectionRes */
 		} else if ( exiFrag->X509CRL_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509CRL) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 223);
@@ -12557,11 +13630,15 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				}
 			}
 		} else if ( exiFrag->X509Data_isUsed == 1u ) { 
+#if DIN_DEPLOY_X509Data == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 225);
 			if(errn == 0) {
 				errn = encode_dinX509DataType(stream, &exiFrag->X509Data );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* DIN_DEPLOY_X509Data */
 		} else if ( exiFrag->X509IssuerName_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerName) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 226);
@@ -12569,11 +13646,8 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->X509IssuerName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->X509IssuerName.characters, exiFrag->X509IssuerName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, exiFrag->X509IssuerName.characters, exiFrag->X509IssuerName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -12618,11 +13692,8 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->X509SubjectName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->X509SubjectName.characters, exiFrag->X509SubjectName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, exiFrag->X509SubjectName.characters, exiFrag->X509SubjectName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -12634,11 +13705,8 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->XPath.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->XPath.characters, exiFrag->XPath.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, exiFrag->XPath.characters, exiFrag->XPath.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -12791,11 +13859,8 @@ int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag) {
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->stringValue.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->stringValue.characters, exiFrag->stringValue.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 22 /* {urn:iso:15118:2:2010:MsgDataTypes}stringValue */, exiFrag->stringValue.characters, exiFrag->stringValue.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
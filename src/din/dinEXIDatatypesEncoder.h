@@ -54,6 +54,37 @@ extern "C" {
 
 int encode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc);
 
+#if DIN_DEPLOY_CurrentDemandRes == SUPPORT_YES
+/* Pre-encoded V2G_Message with a CurrentDemandRes body. The bit position and width of every value field
+ * is recorded, so a later message of the same shape is produced by patching the fields that changed. */
+#define dinCurrentDemandResTemplate_BYTES_SIZE 64
+#define dinCurrentDemandResTemplate_FIELDS_SIZE 24
+struct dinCurrentDemandResTemplate {
+	uint8_t bytes[dinCurrentDemandResTemplate_BYTES_SIZE];
+	/* 0 while nothing is cached */
+	size_t bytesLen;
+	/* optional elements used by the cached message */
+	uint32_t shape;
+	uint8_t sessionID[dinMessageHeaderType_SessionID_BYTES_SIZE];
+	uint16_t sessionIDLen;
+	struct {
+		uint16_t pos;
+		uint8_t len;
+		uint64_t bits;
+	} fields[dinCurrentDemandResTemplate_FIELDS_SIZE];
+	size_t fieldsLen;
+};
+
+void init_dinCurrentDemandResTemplate(struct dinCurrentDemandResTemplate* tmpl);
+
+/* Same result as encode_dinExiDocument for a V2G_Message with this header and a CurrentDemandRes body,
+ * also the error codes and the stream afterwards (no digest, as after writeEXIHeader). Variable length
+ * integers that change their width, a new SessionID or other optional elements lead to a full encode,
+ * which then replaces the cached message. Only a stream too short for the message differs: a cached
+ * message returns EXI_ERROR_OUTPUT_STREAM_EOF without writing any byte. */
+int encode_dinCurrentDemandResTemplate(bitstream_t* stream, struct dinCurrentDemandResTemplate* tmpl, struct dinMessageHeaderType* header, struct dinCurrentDemandResType* res);
+#endif /* DIN_DEPLOY_CurrentDemandRes */
+
 #if DEPLOY_DIN_CODEC_FRAGMENT == SUPPORT_YES
 int encode_dinExiFragment(bitstream_t* stream, struct dinEXIFragment* exiFrag);
 #endif /* DEPLOY_DIN_CODEC_FRAGMENT */
@@ -0,0 +1,267 @@
+/*******************************************************************
+ * Per message deployment of the din codec, generated by tools/deploy_messages.py
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+/**
+ * \file 	dinEXIDeploy.h
+ * \brief 	Switches for the root elements (messages) of the din codec
+ *
+ * 			A disabled element is not decoded or encoded (unknown event code) and
+ * 			its type functions are not compiled. A build for a charge controller
+ * 			with few messages sets DIN_DEPLOY_DEFAULT to SUPPORT_NO and
+ * 			enables V2G_Message and the messages it needs, e.g. with
+ * 			-DDIN_DEPLOY_DEFAULT=SUPPORT_NO -DDIN_DEPLOY_V2G_Message=SUPPORT_YES ...
+ *
+ */
+
+#ifndef EXI_din_DEPLOY_H
+#define EXI_din_DEPLOY_H
+
+/** Default of all switches below */
+#ifndef DIN_DEPLOY_DEFAULT
+#define DIN_DEPLOY_DEFAULT SUPPORT_YES
+#endif
+
+/* Messages (V2G_Message Body) */
+#ifndef DIN_DEPLOY_BodyElement
+#define DIN_DEPLOY_BodyElement DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_CableCheckReq
+#define DIN_DEPLOY_CableCheckReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_CableCheckRes
+#define DIN_DEPLOY_CableCheckRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_CertificateInstallationReq
+#define DIN_DEPLOY_CertificateInstallationReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_CertificateInstallationRes
+#define DIN_DEPLOY_CertificateInstallationRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_CertificateUpdateReq
+#define DIN_DEPLOY_CertificateUpdateReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_CertificateUpdateRes
+#define DIN_DEPLOY_CertificateUpdateRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ChargeParameterDiscoveryReq
+#define DIN_DEPLOY_ChargeParameterDiscoveryReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ChargeParameterDiscoveryRes
+#define DIN_DEPLOY_ChargeParameterDiscoveryRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ChargingStatusReq
+#define DIN_DEPLOY_ChargingStatusReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ChargingStatusRes
+#define DIN_DEPLOY_ChargingStatusRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ContractAuthenticationReq
+#define DIN_DEPLOY_ContractAuthenticationReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ContractAuthenticationRes
+#define DIN_DEPLOY_ContractAuthenticationRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_CurrentDemandReq
+#define DIN_DEPLOY_CurrentDemandReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_CurrentDemandRes
+#define DIN_DEPLOY_CurrentDemandRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_MeteringReceiptReq
+#define DIN_DEPLOY_MeteringReceiptReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_MeteringReceiptRes
+#define DIN_DEPLOY_MeteringReceiptRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_PaymentDetailsReq
+#define DIN_DEPLOY_PaymentDetailsReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_PaymentDetailsRes
+#define DIN_DEPLOY_PaymentDetailsRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_PowerDeliveryReq
+#define DIN_DEPLOY_PowerDeliveryReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_PowerDeliveryRes
+#define DIN_DEPLOY_PowerDeliveryRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_PreChargeReq
+#define DIN_DEPLOY_PreChargeReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_PreChargeRes
+#define DIN_DEPLOY_PreChargeRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ServiceDetailReq
+#define DIN_DEPLOY_ServiceDetailReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ServiceDetailRes
+#define DIN_DEPLOY_ServiceDetailRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ServiceDiscoveryReq
+#define DIN_DEPLOY_ServiceDiscoveryReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ServiceDiscoveryRes
+#define DIN_DEPLOY_ServiceDiscoveryRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ServicePaymentSelectionReq
+#define DIN_DEPLOY_ServicePaymentSelectionReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ServicePaymentSelectionRes
+#define DIN_DEPLOY_ServicePaymentSelectionRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SessionSetupReq
+#define DIN_DEPLOY_SessionSetupReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SessionSetupRes
+#define DIN_DEPLOY_SessionSetupRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SessionStopReq
+#define DIN_DEPLOY_SessionStopReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SessionStopRes
+#define DIN_DEPLOY_SessionStopRes DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_WeldingDetectionReq
+#define DIN_DEPLOY_WeldingDetectionReq DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_WeldingDetectionRes
+#define DIN_DEPLOY_WeldingDetectionRes DIN_DEPLOY_DEFAULT
+#endif
+
+/* Other root elements (V2G_Message, fragments and signatures) */
+#ifndef DIN_DEPLOY_AC_EVChargeParameter
+#define DIN_DEPLOY_AC_EVChargeParameter DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_AC_EVSEChargeParameter
+#define DIN_DEPLOY_AC_EVSEChargeParameter DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_AC_EVSEStatus
+#define DIN_DEPLOY_AC_EVSEStatus DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_CanonicalizationMethod
+#define DIN_DEPLOY_CanonicalizationMethod DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_DC_EVChargeParameter
+#define DIN_DEPLOY_DC_EVChargeParameter DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_DC_EVPowerDeliveryParameter
+#define DIN_DEPLOY_DC_EVPowerDeliveryParameter DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_DC_EVSEChargeParameter
+#define DIN_DEPLOY_DC_EVSEChargeParameter DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_DC_EVSEStatus
+#define DIN_DEPLOY_DC_EVSEStatus DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_DC_EVStatus
+#define DIN_DEPLOY_DC_EVStatus DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_DSAKeyValue
+#define DIN_DEPLOY_DSAKeyValue DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_DigestMethod
+#define DIN_DEPLOY_DigestMethod DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_EVChargeParameter
+#define DIN_DEPLOY_EVChargeParameter DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_EVPowerDeliveryParameter
+#define DIN_DEPLOY_EVPowerDeliveryParameter DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_EVSEChargeParameter
+#define DIN_DEPLOY_EVSEChargeParameter DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_EVSEStatus
+#define DIN_DEPLOY_EVSEStatus DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_EVStatus
+#define DIN_DEPLOY_EVStatus DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_Entry
+#define DIN_DEPLOY_Entry DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_KeyInfo
+#define DIN_DEPLOY_KeyInfo DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_KeyValue
+#define DIN_DEPLOY_KeyValue DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_Manifest
+#define DIN_DEPLOY_Manifest DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_Object
+#define DIN_DEPLOY_Object DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_PGPData
+#define DIN_DEPLOY_PGPData DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_PMaxScheduleEntry
+#define DIN_DEPLOY_PMaxScheduleEntry DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_RSAKeyValue
+#define DIN_DEPLOY_RSAKeyValue DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_Reference
+#define DIN_DEPLOY_Reference DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_RelativeTimeInterval
+#define DIN_DEPLOY_RelativeTimeInterval DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_RetrievalMethod
+#define DIN_DEPLOY_RetrievalMethod DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SAScheduleList
+#define DIN_DEPLOY_SAScheduleList DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SASchedules
+#define DIN_DEPLOY_SASchedules DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SPKIData
+#define DIN_DEPLOY_SPKIData DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SalesTariffEntry
+#define DIN_DEPLOY_SalesTariffEntry DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_ServiceCharge
+#define DIN_DEPLOY_ServiceCharge DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_Signature
+#define DIN_DEPLOY_Signature DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SignatureMethod
+#define DIN_DEPLOY_SignatureMethod DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SignatureProperties
+#define DIN_DEPLOY_SignatureProperties DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SignatureProperty
+#define DIN_DEPLOY_SignatureProperty DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SignatureValue
+#define DIN_DEPLOY_SignatureValue DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_SignedInfo
+#define DIN_DEPLOY_SignedInfo DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_TimeInterval
+#define DIN_DEPLOY_TimeInterval DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_Transform
+#define DIN_DEPLOY_Transform DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_Transforms
+#define DIN_DEPLOY_Transforms DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_V2G_Message
+#define DIN_DEPLOY_V2G_Message DIN_DEPLOY_DEFAULT
+#endif
+#ifndef DIN_DEPLOY_X509Data
+#define DIN_DEPLOY_X509Data DIN_DEPLOY_DEFAULT
+#endif
+
+#endif /* EXI_din_DEPLOY_H */
@@ -445,11 +445,13 @@ void init_iso1SignatureType(struct iso1SignatureType* iso1SignatureType) {
 	iso1SignatureType->Object.arrayLen = 0u;
 }
 
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 void init_iso1PowerDeliveryReqType(struct iso1PowerDeliveryReqType* iso1PowerDeliveryReqType) {
 	iso1PowerDeliveryReqType->ChargingProfile_isUsed = 0u;
 	iso1PowerDeliveryReqType->EVPowerDeliveryParameter_isUsed = 0u;
 	iso1PowerDeliveryReqType->DC_EVPowerDeliveryParameter_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
 
 void init_iso1ParameterType(struct iso1ParameterType* iso1ParameterType) {
 	iso1ParameterType->boolValue_isUsed = 0u;
@@ -460,13 +462,17 @@ void init_iso1ParameterType(struct iso1ParameterType* iso1ParameterType) {
 	iso1ParameterType->stringValue_isUsed = 0u;
 }
 
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 void init_iso1CertificateInstallationReqType(struct iso1CertificateInstallationReqType* iso1CertificateInstallationReqType) {
 	(void)iso1CertificateInstallationReqType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
 
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
 void init_iso1SessionSetupResType(struct iso1SessionSetupResType* iso1SessionSetupResType) {
 	iso1SessionSetupResType->EVSETimeStamp_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_SessionSetupRes */
 
 void init_iso1EVChargeParameterType(struct iso1EVChargeParameterType* iso1EVChargeParameterType) {
 	iso1EVChargeParameterType->DepartureTime_isUsed = 0u;
@@ -476,9 +482,11 @@ void init_iso1DiffieHellmanPublickeyType(struct iso1DiffieHellmanPublickeyType*
 	(void)iso1DiffieHellmanPublickeyType; /* avoid unused warning */
 }
 
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 void init_iso1ServiceDiscoveryResType(struct iso1ServiceDiscoveryResType* iso1ServiceDiscoveryResType) {
 	iso1ServiceDiscoveryResType->ServiceList_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
 
 void init_iso1ServiceParameterListType(struct iso1ServiceParameterListType* iso1ServiceParameterListType) {
 	iso1ServiceParameterListType->ParameterSet.arrayLen = 0u;
@@ -497,17 +505,21 @@ void init_iso1DC_EVSEStatusType(struct iso1DC_EVSEStatusType* iso1DC_EVSEStatusT
 	iso1DC_EVSEStatusType->EVSEIsolationStatus_isUsed = 0u;
 }
 
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
 void init_iso1PreChargeResType(struct iso1PreChargeResType* iso1PreChargeResType) {
 	(void)iso1PreChargeResType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_PreChargeRes */
 
 void init_iso1ParameterSetType(struct iso1ParameterSetType* iso1ParameterSetType) {
 	iso1ParameterSetType->Parameter.arrayLen = 0u;
 }
 
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
 void init_iso1ServiceDetailReqType(struct iso1ServiceDetailReqType* iso1ServiceDetailReqType) {
 	(void)iso1ServiceDetailReqType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
 
 void init_iso1RelativeTimeIntervalType(struct iso1RelativeTimeIntervalType* iso1RelativeTimeIntervalType) {
 	iso1RelativeTimeIntervalType->duration_isUsed = 0u;
@@ -522,9 +534,11 @@ void init_iso1EMAIDType(struct iso1EMAIDType* iso1EMAIDType) {
 	(void)iso1EMAIDType; /* avoid unused warning */
 }
 
+#if ISO1_DEPLOY_EVStatus == SUPPORT_YES
 void init_iso1EVStatusType(struct iso1EVStatusType* iso1EVStatusType) {
 	(void)iso1EVStatusType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_EVStatus */
 
 void init_iso1ServiceListType(struct iso1ServiceListType* iso1ServiceListType) {
 	iso1ServiceListType->Service.arrayLen = 0u;
@@ -542,10 +556,12 @@ void init_iso1ProfileEntryType(struct iso1ProfileEntryType* iso1ProfileEntryType
 	iso1ProfileEntryType->ChargingProfileEntryMaxNumberOfPhasesInUse_isUsed = 0u;
 }
 
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
 void init_iso1AuthorizationReqType(struct iso1AuthorizationReqType* iso1AuthorizationReqType) {
 	iso1AuthorizationReqType->Id_isUsed = 0u;
 	iso1AuthorizationReqType->GenChallenge_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_AuthorizationReq */
 
 void init_iso1MeterInfoType(struct iso1MeterInfoType* iso1MeterInfoType) {
 	iso1MeterInfoType->MeterReading_isUsed = 0u;
@@ -554,11 +570,14 @@ void init_iso1MeterInfoType(struct iso1MeterInfoType* iso1MeterInfoType) {
 	iso1MeterInfoType->TMeter_isUsed = 0u;
 }
 
+#if ISO1_DEPLOY_Manifest == SUPPORT_YES
 void init_iso1ManifestType(struct iso1ManifestType* iso1ManifestType) {
 	iso1ManifestType->Id_isUsed = 0u;
 	iso1ManifestType->Reference.arrayLen = 0u;
 }
+#endif /* ISO1_DEPLOY_Manifest */
 
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 void init_iso1ChargeParameterDiscoveryResType(struct iso1ChargeParameterDiscoveryResType* iso1ChargeParameterDiscoveryResType) {
 	iso1ChargeParameterDiscoveryResType->SASchedules_isUsed = 0u;
 	iso1ChargeParameterDiscoveryResType->SAScheduleList_isUsed = 0u;
@@ -566,12 +585,15 @@ void init_iso1ChargeParameterDiscoveryResType(struct iso1ChargeParameterDiscover
 	iso1ChargeParameterDiscoveryResType->AC_EVSEChargeParameter_isUsed = 0u;
 	iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
 
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 void init_iso1PowerDeliveryResType(struct iso1PowerDeliveryResType* iso1PowerDeliveryResType) {
 	iso1PowerDeliveryResType->EVSEStatus_isUsed = 0u;
 	iso1PowerDeliveryResType->AC_EVSEStatus_isUsed = 0u;
 	iso1PowerDeliveryResType->DC_EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
 
 void init_iso1DC_EVChargeParameterType(struct iso1DC_EVChargeParameterType* iso1DC_EVChargeParameterType) {
 	iso1DC_EVChargeParameterType->DepartureTime_isUsed = 0u;
@@ -609,25 +631,33 @@ void init_iso1RSAKeyValueType(struct iso1RSAKeyValueType* iso1RSAKeyValueType) {
 	(void)iso1RSAKeyValueType; /* avoid unused warning */
 }
 
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
 void init_iso1SessionStopResType(struct iso1SessionStopResType* iso1SessionStopResType) {
 	(void)iso1SessionStopResType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_SessionStopRes */
 
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 void init_iso1CertificateUpdateReqType(struct iso1CertificateUpdateReqType* iso1CertificateUpdateReqType) {
 	(void)iso1CertificateUpdateReqType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
 
 void init_iso1SignatureValueType(struct iso1SignatureValueType* iso1SignatureValueType) {
 	iso1SignatureValueType->Id_isUsed = 0u;
 }
 
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 void init_iso1PaymentDetailsReqType(struct iso1PaymentDetailsReqType* iso1PaymentDetailsReqType) {
 	(void)iso1PaymentDetailsReqType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
 
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
 void init_iso1AuthorizationResType(struct iso1AuthorizationResType* iso1AuthorizationResType) {
 	(void)iso1AuthorizationResType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_AuthorizationRes */
 
 void init_iso1DC_EVSEChargeParameterType(struct iso1DC_EVSEChargeParameterType* iso1DC_EVSEChargeParameterType) {
 	iso1DC_EVSEChargeParameterType->EVSECurrentRegulationTolerance_isUsed = 0u;
@@ -638,11 +668,13 @@ void init_iso1SubCertificatesType(struct iso1SubCertificatesType* iso1SubCertifi
 	iso1SubCertificatesType->Certificate.arrayLen = 0u;
 }
 
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
 void init_iso1ChargingStatusResType(struct iso1ChargingStatusResType* iso1ChargingStatusResType) {
 	iso1ChargingStatusResType->EVSEMaxCurrent_isUsed = 0u;
 	iso1ChargingStatusResType->MeterInfo_isUsed = 0u;
 	iso1ChargingStatusResType->ReceiptRequired_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
 
 void init_iso1DSAKeyValueType(struct iso1DSAKeyValueType* iso1DSAKeyValueType) {
 	iso1DSAKeyValueType->P_isUsed = 0u;
@@ -666,14 +698,18 @@ void init_iso1IntervalType(struct iso1IntervalType* iso1IntervalType) {
 	(void)iso1IntervalType; /* avoid unused warning */
 }
 
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 void init_iso1MeteringReceiptReqType(struct iso1MeteringReceiptReqType* iso1MeteringReceiptReqType) {
 	iso1MeteringReceiptReqType->Id_isUsed = 0u;
 	iso1MeteringReceiptReqType->SAScheduleTupleID_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
 
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
 void init_iso1ServiceDetailResType(struct iso1ServiceDetailResType* iso1ServiceDetailResType) {
 	iso1ServiceDetailResType->ServiceParameterList_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
 
 void init_iso1KeyValueType(struct iso1KeyValueType* iso1KeyValueType) {
 	iso1KeyValueType->DSAKeyValue_isUsed = 0u;
@@ -685,9 +721,11 @@ void init_iso1SelectedServiceListType(struct iso1SelectedServiceListType* iso1Se
 	iso1SelectedServiceListType->SelectedService.arrayLen = 0u;
 }
 
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
 void init_iso1CableCheckResType(struct iso1CableCheckResType* iso1CableCheckResType) {
 	(void)iso1CableCheckResType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_CableCheckRes */
 
 void init_iso1X509IssuerSerialType(struct iso1X509IssuerSerialType* iso1X509IssuerSerialType) {
 	(void)iso1X509IssuerSerialType; /* avoid unused warning */
@@ -709,16 +747,20 @@ void init_iso1TransformsType(struct iso1TransformsType* iso1TransformsType) {
 	iso1TransformsType->Transform.arrayLen = 0u;
 }
 
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 void init_iso1ChargeParameterDiscoveryReqType(struct iso1ChargeParameterDiscoveryReqType* iso1ChargeParameterDiscoveryReqType) {
 	iso1ChargeParameterDiscoveryReqType->MaxEntriesSAScheduleTuple_isUsed = 0u;
 	iso1ChargeParameterDiscoveryReqType->EVChargeParameter_isUsed = 0u;
 	iso1ChargeParameterDiscoveryReqType->AC_EVChargeParameter_isUsed = 0u;
 	iso1ChargeParameterDiscoveryReqType->DC_EVChargeParameter_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
 
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
 void init_iso1PreChargeReqType(struct iso1PreChargeReqType* iso1PreChargeReqType) {
 	(void)iso1PreChargeReqType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_PreChargeReq */
 
 void init_iso1EVSEStatusType(struct iso1EVSEStatusType* iso1EVSEStatusType) {
 	(void)iso1EVSEStatusType; /* avoid unused warning */
@@ -805,9 +847,11 @@ void init_iso1AnonType_V2G_Message(struct iso1AnonType_V2G_Message* iso1AnonType
 	(void)iso1AnonType_V2G_Message; /* avoid unused warning */
 }
 
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 void init_iso1PaymentDetailsResType(struct iso1PaymentDetailsResType* iso1PaymentDetailsResType) {
 	(void)iso1PaymentDetailsResType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
 
 void init_iso1ContractSignatureEncryptedPrivateKeyType(struct iso1ContractSignatureEncryptedPrivateKeyType* iso1ContractSignatureEncryptedPrivateKeyType) {
 	(void)iso1ContractSignatureEncryptedPrivateKeyType; /* avoid unused warning */
@@ -823,19 +867,25 @@ void init_iso1SPKIDataType(struct iso1SPKIDataType* iso1SPKIDataType) {
 	iso1SPKIDataType->ANY_isUsed = 0u;
 }
 
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 void init_iso1MeteringReceiptResType(struct iso1MeteringReceiptResType* iso1MeteringReceiptResType) {
 	iso1MeteringReceiptResType->EVSEStatus_isUsed = 0u;
 	iso1MeteringReceiptResType->AC_EVSEStatus_isUsed = 0u;
 	iso1MeteringReceiptResType->DC_EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
 
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
 void init_iso1SessionStopReqType(struct iso1SessionStopReqType* iso1SessionStopReqType) {
 	(void)iso1SessionStopReqType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_SessionStopReq */
 
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 void init_iso1WeldingDetectionResType(struct iso1WeldingDetectionResType* iso1WeldingDetectionResType) {
 	(void)iso1WeldingDetectionResType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
 
 void init_iso1ReferenceType(struct iso1ReferenceType* iso1ReferenceType) {
 	iso1ReferenceType->Id_isUsed = 0u;
@@ -844,6 +894,7 @@ void init_iso1ReferenceType(struct iso1ReferenceType* iso1ReferenceType) {
 	iso1ReferenceType->Transforms_isUsed = 0u;
 }
 
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
 void init_iso1CurrentDemandReqType(struct iso1CurrentDemandReqType* iso1CurrentDemandReqType) {
 	iso1CurrentDemandReqType->EVMaximumVoltageLimit_isUsed = 0u;
 	iso1CurrentDemandReqType->EVMaximumCurrentLimit_isUsed = 0u;
@@ -852,6 +903,7 @@ void init_iso1CurrentDemandReqType(struct iso1CurrentDemandReqType* iso1CurrentD
 	iso1CurrentDemandReqType->RemainingTimeToFullSoC_isUsed = 0u;
 	iso1CurrentDemandReqType->RemainingTimeToBulkSoC_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
 
 void init_iso1SalesTariffEntryType(struct iso1SalesTariffEntryType* iso1SalesTariffEntryType) {
 	iso1SalesTariffEntryType->TimeInterval_isUsed = 0u;
@@ -860,14 +912,18 @@ void init_iso1SalesTariffEntryType(struct iso1SalesTariffEntryType* iso1SalesTar
 	iso1SalesTariffEntryType->ConsumptionCost.arrayLen = 0u;
 }
 
+#if ISO1_DEPLOY_Entry == SUPPORT_YES
 void init_iso1EntryType(struct iso1EntryType* iso1EntryType) {
 	iso1EntryType->TimeInterval_isUsed = 0u;
 	iso1EntryType->RelativeTimeInterval_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_Entry */
 
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
 void init_iso1SessionSetupReqType(struct iso1SessionSetupReqType* iso1SessionSetupReqType) {
 	(void)iso1SessionSetupReqType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_SessionSetupReq */
 
 void init_iso1CostType(struct iso1CostType* iso1CostType) {
 	iso1CostType->amountMultiplier_isUsed = 0u;
@@ -883,26 +939,33 @@ void init_iso1RetrievalMethodType(struct iso1RetrievalMethodType* iso1RetrievalM
 	iso1RetrievalMethodType->Transforms_isUsed = 0u;
 }
 
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 void init_iso1CertificateUpdateResType(struct iso1CertificateUpdateResType* iso1CertificateUpdateResType) {
 	iso1CertificateUpdateResType->RetryCounter_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
 
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 void init_iso1CertificateInstallationResType(struct iso1CertificateInstallationResType* iso1CertificateInstallationResType) {
 	(void)iso1CertificateInstallationResType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
 
 void init_iso1CanonicalizationMethodType(struct iso1CanonicalizationMethodType* iso1CanonicalizationMethodType) {
 	iso1CanonicalizationMethodType->ANY_isUsed = 0u;
 }
 
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 void init_iso1WeldingDetectionReqType(struct iso1WeldingDetectionReqType* iso1WeldingDetectionReqType) {
 	(void)iso1WeldingDetectionReqType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
 
 void init_iso1DC_EVStatusType(struct iso1DC_EVStatusType* iso1DC_EVStatusType) {
 	(void)iso1DC_EVStatusType; /* avoid unused warning */
 }
 
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
 void init_iso1CurrentDemandResType(struct iso1CurrentDemandResType* iso1CurrentDemandResType) {
 	iso1CurrentDemandResType->EVSEMaximumVoltageLimit_isUsed = 0u;
 	iso1CurrentDemandResType->EVSEMaximumCurrentLimit_isUsed = 0u;
@@ -910,24 +973,29 @@ void init_iso1CurrentDemandResType(struct iso1CurrentDemandResType* iso1CurrentD
 	iso1CurrentDemandResType->MeterInfo_isUsed = 0u;
 	iso1CurrentDemandResType->ReceiptRequired_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
 
 void init_iso1ServiceType(struct iso1ServiceType* iso1ServiceType) {
 	iso1ServiceType->ServiceName_isUsed = 0u;
 	iso1ServiceType->ServiceScope_isUsed = 0u;
 }
 
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 void init_iso1ServiceDiscoveryReqType(struct iso1ServiceDiscoveryReqType* iso1ServiceDiscoveryReqType) {
 	iso1ServiceDiscoveryReqType->ServiceScope_isUsed = 0u;
 	iso1ServiceDiscoveryReqType->ServiceCategory_isUsed = 0u;
 }
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
 
 void init_iso1AC_EVSEChargeParameterType(struct iso1AC_EVSEChargeParameterType* iso1AC_EVSEChargeParameterType) {
 	(void)iso1AC_EVSEChargeParameterType; /* avoid unused warning */
 }
 
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
 void init_iso1CableCheckReqType(struct iso1CableCheckReqType* iso1CableCheckReqType) {
 	(void)iso1CableCheckReqType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_CableCheckReq */
 
 void init_iso1SelectedServiceType(struct iso1SelectedServiceType* iso1SelectedServiceType) {
 	iso1SelectedServiceType->ParameterSetID_isUsed = 0u;
@@ -944,30 +1012,40 @@ void init_iso1SalesTariffType(struct iso1SalesTariffType* iso1SalesTariffType) {
 	iso1SalesTariffType->SalesTariffEntry.arrayLen = 0u;
 }
 
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 void init_iso1PaymentServiceSelectionReqType(struct iso1PaymentServiceSelectionReqType* iso1PaymentServiceSelectionReqType) {
 	(void)iso1PaymentServiceSelectionReqType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
 
+#if ISO1_DEPLOY_SignatureProperties == SUPPORT_YES
 void init_iso1SignaturePropertiesType(struct iso1SignaturePropertiesType* iso1SignaturePropertiesType) {
 	iso1SignaturePropertiesType->Id_isUsed = 0u;
 	iso1SignaturePropertiesType->SignatureProperty.arrayLen = 0u;
 }
+#endif /* ISO1_DEPLOY_SignatureProperties */
 
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
 void init_iso1BodyBaseType(struct iso1BodyBaseType* iso1BodyBaseType) {
 	(void)iso1BodyBaseType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_BodyElement */
 
 void init_iso1SupportedEnergyTransferModeType(struct iso1SupportedEnergyTransferModeType* iso1SupportedEnergyTransferModeType) {
 	iso1SupportedEnergyTransferModeType->EnergyTransferMode.arrayLen = 0u;
 }
 
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
 void init_iso1ChargingStatusReqType(struct iso1ChargingStatusReqType* iso1ChargingStatusReqType) {
 	(void)iso1ChargingStatusReqType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
 
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 void init_iso1PaymentServiceSelectionResType(struct iso1PaymentServiceSelectionResType* iso1PaymentServiceSelectionResType) {
 	(void)iso1PaymentServiceSelectionResType; /* avoid unused warning */
 }
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
 
 void init_iso1DigestMethodType(struct iso1DigestMethodType* iso1DigestMethodType) {
 	iso1DigestMethodType->ANY_isUsed = 0u;
@@ -53,6 +53,8 @@ extern "C" {
 
 #include "EXITypes.h"
 
+#include "iso1EXIDeploy.h"
+
 
 /* Datatype definitions and structs for given XML Schema definitions */
 
@@ -99,12 +101,20 @@ struct iso1EVChargeParameterType {
 struct iso1DiffieHellmanPublickeyType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1DiffieHellmanPublickeyType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* simple content: urn:iso:15118:2:2013:MsgDataTypes,dHpublickeyType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1DiffieHellmanPublickeyType_CONTENT_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  CONTENT ;
 };
@@ -185,12 +195,20 @@ struct iso1RelativeTimeIntervalType {
 struct iso1EMAIDType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EMAIDType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* simple content: urn:iso:15118:2:2013:MsgDataTypes,eMAIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EMAIDType_CONTENT_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  CONTENT ;
 };
@@ -216,7 +234,11 @@ struct iso1EVPowerDeliveryParameterType {
 struct iso1AuthorizationReqType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1AuthorizationReqType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -234,7 +256,11 @@ struct iso1AuthorizationReqType {
 struct iso1MeterInfoType {
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":MeterID, urn:iso:15118:2:2013:MsgDataTypes,meterIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1MeterInfoType_MeterID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MeterID ;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":MeterReading, http://www.w3.org/2001/XMLSchema,unsignedLong */
@@ -262,25 +288,41 @@ struct iso1MeterInfoType {
 struct iso1ObjectType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ObjectType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* attribute: MimeType {http://www.w3.org/2001/XMLSchema,string} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ObjectType_MimeType_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MimeType ;
 	unsigned int MimeType_isUsed:1;
 	/* attribute: Encoding {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ObjectType_Encoding_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Encoding ;
 	unsigned int Encoding_isUsed:1;
 	/* element: WC[##any] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ObjectType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -292,12 +334,20 @@ struct iso1ObjectType {
 struct iso1RSAKeyValueType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Modulus, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1RSAKeyValueType_Modulus_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Modulus ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Exponent, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1RSAKeyValueType_Exponent_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Exponent ;
 };
@@ -314,13 +364,21 @@ struct iso1SessionStopResType {
 struct iso1SignatureValueType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SignatureValueType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* simple content: http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1SignatureValueType_CONTENT_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  CONTENT ;
 };
@@ -332,7 +390,11 @@ struct iso1SubCertificatesType {
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":Certificate, urn:iso:15118:2:2013:MsgDataTypes,certificateType */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1SubCertificatesType_Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  array[iso1SubCertificatesType_Certificate_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -371,42 +433,70 @@ typedef enum {
 struct iso1DSAKeyValueType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":P, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1DSAKeyValueType_P_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  P ;
 	unsigned int P_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Q, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1DSAKeyValueType_Q_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Q ;
 	unsigned int Q_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":G, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1DSAKeyValueType_G_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  G ;
 	unsigned int G_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Y, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1DSAKeyValueType_Y_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Y ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":J, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1DSAKeyValueType_J_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  J ;
 	unsigned int J_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Seed, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1DSAKeyValueType_Seed_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Seed ;
 	unsigned int Seed_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":PgenCounter, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1DSAKeyValueType_PgenCounter_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PgenCounter ;
 	unsigned int PgenCounter_isUsed:1;
@@ -429,7 +519,11 @@ struct iso1IntervalType {
 struct iso1MeteringReceiptReqType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1MeteringReceiptReqType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -449,14 +543,22 @@ struct iso1MeteringReceiptReqType {
 #define iso1KeyValueType_ANY_CHARACTERS_SIZE 50 + EXTRA_CHAR 
 struct iso1KeyValueType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":DSAKeyValue, Complex type name='http://www.w3.org/2000/09/xmldsig#,DSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":P,"http://www.w3.org/2000/09/xmldsig#":Q){0-1},"http://www.w3.org/2000/09/xmldsig#":G{0-1},"http://www.w3.org/2000/09/xmldsig#":Y,"http://www.w3.org/2000/09/xmldsig#":J{0-1},("http://www.w3.org/2000/09/xmldsig#":Seed,"http://www.w3.org/2000/09/xmldsig#":PgenCounter){0-1})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso1DSAKeyValueType* DSAKeyValue ;
+#else
 	struct iso1DSAKeyValueType DSAKeyValue ;
+#endif /* DATABINDING_SLIM */
 	unsigned int DSAKeyValue_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":RSAKeyValue, Complex type name='http://www.w3.org/2000/09/xmldsig#,RSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Modulus,"http://www.w3.org/2000/09/xmldsig#":Exponent)',  derivedBy='RESTRICTION'.  */
 	struct iso1RSAKeyValueType RSAKeyValue ;
 	unsigned int RSAKeyValue_isUsed:1;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1KeyValueType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -468,7 +570,11 @@ struct iso1KeyValueType {
 struct iso1X509IssuerSerialType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509IssuerName, http://www.w3.org/2001/XMLSchema,string */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1X509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  X509IssuerName ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509SerialNumber, http://www.w3.org/2001/XMLSchema,integer */
@@ -506,7 +612,11 @@ struct iso1EVSEStatusType {
 struct iso1SignatureMethodType {
 	/* attribute: Algorithm {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SignatureMethodType_Algorithm_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Algorithm ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":HMACOutputLength, http://www.w3.org/2000/09/xmldsig#,HMACOutputLengthType */
@@ -514,7 +624,11 @@ struct iso1SignatureMethodType {
 	unsigned int HMACOutputLength_isUsed:1;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SignatureMethodType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -540,7 +654,11 @@ struct iso1X509DataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509SKI, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[iso1X509DataType_X509SKI_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[iso1X509DataType_X509SKI_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -548,7 +666,11 @@ struct iso1X509DataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509SubjectName, http://www.w3.org/2001/XMLSchema,string */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[iso1X509DataType_X509SubjectName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[iso1X509DataType_X509SubjectName_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -556,7 +678,11 @@ struct iso1X509DataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509Certificate, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[iso1X509DataType_X509Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[iso1X509DataType_X509Certificate_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -564,14 +690,22 @@ struct iso1X509DataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509CRL, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[iso1X509DataType_X509CRL_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[iso1X509DataType_X509CRL_ARRAY_SIZE];
 		uint16_t arrayLen;
 	} X509CRL;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1X509DataType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -605,7 +739,11 @@ struct iso1NotificationType {
 	iso1faultCodeType FaultCode ;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":FaultMsg, urn:iso:15118:2:2013:MsgDataTypes,faultMsgType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1NotificationType_FaultMsg_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  FaultMsg ;
 	unsigned int FaultMsg_isUsed:1;
@@ -619,19 +757,31 @@ struct iso1NotificationType {
 struct iso1TransformType {
 	/* attribute: Algorithm {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1TransformType_Algorithm_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Algorithm ;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1TransformType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":XPath, http://www.w3.org/2001/XMLSchema,string */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[iso1TransformType_XPath_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[iso1TransformType_XPath_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -658,12 +808,20 @@ struct iso1PaymentDetailsResType {
 struct iso1ContractSignatureEncryptedPrivateKeyType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ContractSignatureEncryptedPrivateKeyType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* simple content: urn:iso:15118:2:2013:MsgDataTypes,privateKeyType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1ContractSignatureEncryptedPrivateKeyType_CONTENT_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  CONTENT ;
 };
@@ -676,14 +834,22 @@ struct iso1SPKIDataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":SPKISexp, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[iso1SPKIDataType_SPKISexp_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[iso1SPKIDataType_SPKISexp_ARRAY_SIZE];
 		uint16_t arrayLen;
 	} SPKISexp;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SPKIDataType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -736,12 +902,20 @@ typedef enum {
 struct iso1CanonicalizationMethodType {
 	/* attribute: Algorithm {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1CanonicalizationMethodType_Algorithm_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Algorithm ;
 	/* element: WC[##any] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1CanonicalizationMethodType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -771,7 +945,11 @@ struct iso1ServiceType {
 	uint16_t ServiceID ;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":ServiceName, urn:iso:15118:2:2013:MsgDataTypes,serviceNameType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ServiceType_ServiceName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ServiceName ;
 	unsigned int ServiceName_isUsed:1;
@@ -779,7 +957,11 @@ struct iso1ServiceType {
 	iso1serviceCategoryType ServiceCategory ;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":ServiceScope, urn:iso:15118:2:2013:MsgDataTypes,serviceScopeType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ServiceType_ServiceScope_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ServiceScope ;
 	unsigned int ServiceScope_isUsed:1;
@@ -792,7 +974,11 @@ struct iso1ServiceType {
 struct iso1ServiceDiscoveryReqType {
 	/* element: "urn:iso:15118:2:2013:MsgBody":ServiceScope, urn:iso:15118:2:2013:MsgDataTypes,serviceScopeType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ServiceDiscoveryReqType_ServiceScope_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ServiceScope ;
 	unsigned int ServiceScope_isUsed:1;
@@ -873,12 +1059,20 @@ struct iso1PaymentServiceSelectionResType {
 struct iso1DigestMethodType {
 	/* attribute: Algorithm {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1DigestMethodType_Algorithm_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Algorithm ;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1DigestMethodType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -891,18 +1085,30 @@ struct iso1DigestMethodType {
 struct iso1SignaturePropertyType {
 	/* attribute: Target {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SignaturePropertyType_Target_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Target ;
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SignaturePropertyType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SignaturePropertyType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -925,19 +1131,31 @@ typedef enum {
 struct iso1PGPDataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":PGPKeyID, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1PGPDataType_PGPKeyID_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PGPKeyID ;
 	unsigned int PGPKeyID_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1PGPDataType_PGPKeyPacket_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PGPKeyPacket ;
 	unsigned int PGPKeyPacket_isUsed:1;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1PGPDataType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -950,7 +1168,11 @@ struct iso1SessionSetupResType {
 	iso1responseCodeType ResponseCode ;
 	/* element: "urn:iso:15118:2:2013:MsgBody":EVSEID, urn:iso:15118:2:2013:MsgDataTypes,evseIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SessionSetupResType_EVSEID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  EVSEID ;
 	/* element: "urn:iso:15118:2:2013:MsgBody":EVSETimeStamp, http://www.w3.org/2001/XMLSchema,long */
@@ -964,13 +1186,21 @@ struct iso1SessionSetupResType {
 struct iso1CertificateChainType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1CertificateChainType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":Certificate, urn:iso:15118:2:2013:MsgDataTypes,certificateType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1CertificateChainType_Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Certificate ;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":SubCertificates, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SubCertificatesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":Certificate{1-4})',  derivedBy='RESTRICTION'.  */
@@ -996,7 +1226,11 @@ struct iso1DC_EVSEStatusType {
 struct iso1ServiceListType {
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":Service, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ServiceID,"urn:iso:15118:2:2013:MsgDataTypes":ServiceName{0-1},"urn:iso:15118:2:2013:MsgDataTypes":ServiceCategory,"urn:iso:15118:2:2013:MsgDataTypes":ServiceScope{0-1},"urn:iso:15118:2:2013:MsgDataTypes":FreeService)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso1ServiceType* array;
+#else
 		struct iso1ServiceType array[iso1ServiceListType_Service_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} Service;
 };
@@ -1087,7 +1321,11 @@ struct iso1ChargingStatusResType {
 	iso1responseCodeType ResponseCode ;
 	/* element: "urn:iso:15118:2:2013:MsgBody":EVSEID, urn:iso:15118:2:2013:MsgDataTypes,evseIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ChargingStatusResType_EVSEID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  EVSEID ;
 	/* element: "urn:iso:15118:2:2013:MsgBody":SAScheduleTupleID, urn:iso:15118:2:2013:MsgDataTypes,SAIDType */
@@ -1096,7 +1334,11 @@ struct iso1ChargingStatusResType {
 	struct iso1PhysicalValueType EVSEMaxCurrent ;
 	unsigned int EVSEMaxCurrent_isUsed:1;
 	/* element: "urn:iso:15118:2:2013:MsgBody":MeterInfo, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,MeterInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":MeterID,"urn:iso:15118:2:2013:MsgDataTypes":MeterReading{0-1},"urn:iso:15118:2:2013:MsgDataTypes":SigMeterReading{0-1},"urn:iso:15118:2:2013:MsgDataTypes":MeterStatus{0-1},"urn:iso:15118:2:2013:MsgDataTypes":TMeter{0-1})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso1MeterInfoType* MeterInfo ;
+#else
 	struct iso1MeterInfoType MeterInfo ;
+#endif /* DATABINDING_SLIM */
 	unsigned int MeterInfo_isUsed:1;
 	/* element: "urn:iso:15118:2:2013:MsgBody":ReceiptRequired, http://www.w3.org/2001/XMLSchema,boolean */
 	int ReceiptRequired ;
@@ -1110,7 +1352,11 @@ struct iso1ChargingStatusResType {
 struct iso1ListOfRootCertificateIDsType {
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":RootCertificateID, Complex type name='http://www.w3.org/2000/09/xmldsig#,X509IssuerSerialType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":X509IssuerName,"http://www.w3.org/2000/09/xmldsig#":X509SerialNumber)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso1X509IssuerSerialType* array;
+#else
 		struct iso1X509IssuerSerialType array[iso1ListOfRootCertificateIDsType_RootCertificateID_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} RootCertificateID;
 };
@@ -1123,7 +1369,11 @@ struct iso1ChargeServiceType {
 	uint16_t ServiceID ;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":ServiceName, urn:iso:15118:2:2013:MsgDataTypes,serviceNameType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ChargeServiceType_ServiceName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ServiceName ;
 	unsigned int ServiceName_isUsed:1;
@@ -1131,7 +1381,11 @@ struct iso1ChargeServiceType {
 	iso1serviceCategoryType ServiceCategory ;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":ServiceScope, urn:iso:15118:2:2013:MsgDataTypes,serviceScopeType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ChargeServiceType_ServiceScope_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ServiceScope ;
 	unsigned int ServiceScope_isUsed:1;
@@ -1146,7 +1400,11 @@ struct iso1ChargeServiceType {
 struct iso1SelectedServiceListType {
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":SelectedService, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SelectedServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ServiceID,"urn:iso:15118:2:2013:MsgDataTypes":ParameterSetID{0-1})',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso1SelectedServiceType* array;
+#else
 		struct iso1SelectedServiceType array[iso1SelectedServiceListType_SelectedService_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} SelectedService;
 };
@@ -1241,19 +1499,31 @@ struct iso1WeldingDetectionResType {
 struct iso1ReferenceType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ReferenceType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* attribute: URI {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ReferenceType_URI_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  URI ;
 	unsigned int URI_isUsed:1;
 	/* attribute: Type {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ReferenceType_Type_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Type ;
 	unsigned int Type_isUsed:1;
@@ -1264,7 +1534,11 @@ struct iso1ReferenceType {
 	struct iso1DigestMethodType DigestMethod ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":DigestValue, http://www.w3.org/2000/09/xmldsig#,DigestValueType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1ReferenceType_DigestValue_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DigestValue ;
 };
@@ -1327,13 +1601,21 @@ struct iso1DC_EVPowerDeliveryParameterType {
 struct iso1RetrievalMethodType {
 	/* attribute: URI {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1RetrievalMethodType_URI_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  URI ;
 	unsigned int URI_isUsed:1;
 	/* attribute: Type {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1RetrievalMethodType_Type_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Type ;
 	unsigned int Type_isUsed:1;
@@ -1411,13 +1693,21 @@ struct iso1CurrentDemandResType {
 	unsigned int EVSEMaximumPowerLimit_isUsed:1;
 	/* element: "urn:iso:15118:2:2013:MsgBody":EVSEID, urn:iso:15118:2:2013:MsgDataTypes,evseIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  EVSEID ;
 	/* element: "urn:iso:15118:2:2013:MsgBody":SAScheduleTupleID, urn:iso:15118:2:2013:MsgDataTypes,SAIDType */
 	uint8_t SAScheduleTupleID ;
 	/* element: "urn:iso:15118:2:2013:MsgBody":MeterInfo, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,MeterInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":MeterID,"urn:iso:15118:2:2013:MsgDataTypes":MeterReading{0-1},"urn:iso:15118:2:2013:MsgDataTypes":SigMeterReading{0-1},"urn:iso:15118:2:2013:MsgDataTypes":MeterStatus{0-1},"urn:iso:15118:2:2013:MsgDataTypes":TMeter{0-1})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso1MeterInfoType* MeterInfo ;
+#else
 	struct iso1MeterInfoType MeterInfo ;
+#endif /* DATABINDING_SLIM */
 	unsigned int MeterInfo_isUsed:1;
 	/* element: "urn:iso:15118:2:2013:MsgBody":ReceiptRequired, http://www.w3.org/2001/XMLSchema,boolean */
 	int ReceiptRequired ;
@@ -1448,7 +1738,11 @@ struct iso1PaymentServiceSelectionReqType {
 struct iso1SignaturePropertiesType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SignaturePropertiesType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -1465,7 +1759,11 @@ struct iso1SignaturePropertiesType {
 struct iso1ParameterType {
 	/* attribute: Name {http://www.w3.org/2001/XMLSchema,string} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ParameterType_Name_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Name ;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":boolValue, http://www.w3.org/2001/XMLSchema,boolean */
@@ -1485,7 +1783,11 @@ struct iso1ParameterType {
 	unsigned int physicalValue_isUsed:1;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":stringValue, http://www.w3.org/2001/XMLSchema,string */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ParameterType_stringValue_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  stringValue ;
 	unsigned int stringValue_isUsed:1;
@@ -1497,12 +1799,20 @@ struct iso1ParameterType {
 struct iso1CertificateInstallationReqType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1CertificateInstallationReqType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* element: "urn:iso:15118:2:2013:MsgBody":OEMProvisioningCert, urn:iso:15118:2:2013:MsgDataTypes,certificateType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1CertificateInstallationReqType_OEMProvisioningCert_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  OEMProvisioningCert ;
 	/* element: "urn:iso:15118:2:2013:MsgBody":ListOfRootCertificateIDs, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ListOfRootCertificateIDsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":RootCertificateID{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
@@ -1539,7 +1849,11 @@ struct iso1ParameterSetType {
 	int16_t ParameterSetID ;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":Parameter, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ParameterType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":boolValue|"urn:iso:15118:2:2013:MsgDataTypes":byteValue|"urn:iso:15118:2:2013:MsgDataTypes":shortValue|"urn:iso:15118:2:2013:MsgDataTypes":intValue|"urn:iso:15118:2:2013:MsgDataTypes":physicalValue|"urn:iso:15118:2:2013:MsgDataTypes":stringValue)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso1ParameterType* array;
+#else
 		struct iso1ParameterType array[iso1ParameterSetType_Parameter_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} Parameter;
 };
@@ -1550,7 +1864,11 @@ struct iso1ParameterSetType {
 struct iso1SignedInfoType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SignedInfoType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -1560,7 +1878,11 @@ struct iso1SignedInfoType {
 	struct iso1SignatureMethodType SignatureMethod ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Reference, Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso1ReferenceType* array;
+#else
 		struct iso1ReferenceType array[iso1SignedInfoType_Reference_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} Reference;
 };
@@ -1582,13 +1904,21 @@ struct iso1ProfileEntryType {
 struct iso1ManifestType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1ManifestType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Reference, Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso1ReferenceType* array;
+#else
 		struct iso1ReferenceType array[iso1ManifestType_Reference_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} Reference;
 };
@@ -1638,7 +1968,11 @@ struct iso1ConsumptionCostType {
 struct iso1PMaxScheduleType {
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":PMaxScheduleEntry, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,PMaxScheduleEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":TimeInterval),("urn:iso:15118:2:2013:MsgDataTypes":PMax))',  derivedBy='EXTENSION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso1PMaxScheduleEntryType* array;
+#else
 		struct iso1PMaxScheduleEntryType array[iso1PMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} PMaxScheduleEntry;
 };
@@ -1649,7 +1983,11 @@ struct iso1PMaxScheduleType {
 struct iso1CertificateUpdateReqType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1CertificateUpdateReqType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* element: "urn:iso:15118:2:2013:MsgBody":ContractSignatureCertChain, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,CertificateChainType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":Certificate,"urn:iso:15118:2:2013:MsgDataTypes":SubCertificates{0-1})',  derivedBy='RESTRICTION'.  */
@@ -1678,14 +2016,22 @@ struct iso1CertificateUpdateReqType {
 struct iso1KeyInfoType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1KeyInfoType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":KeyName, http://www.w3.org/2001/XMLSchema,string */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[iso1KeyInfoType_KeyName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[iso1KeyInfoType_KeyName_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -1702,7 +2048,11 @@ struct iso1KeyInfoType {
 	} RetrievalMethod;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509Data, Complex type name='http://www.w3.org/2000/09/xmldsig#,X509DataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":X509IssuerSerial|"http://www.w3.org/2000/09/xmldsig#":X509SKI|"http://www.w3.org/2000/09/xmldsig#":X509SubjectName|"http://www.w3.org/2000/09/xmldsig#":X509Certificate|"http://www.w3.org/2000/09/xmldsig#":X509CRL|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso1X509DataType* array;
+#else
 		struct iso1X509DataType array[iso1KeyInfoType_X509Data_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} X509Data;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":PGPData, Complex type name='http://www.w3.org/2000/09/xmldsig#,PGPDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":PGPKeyID,"http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})|("http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED}))',  derivedBy='RESTRICTION'.  */
@@ -1718,14 +2068,22 @@ struct iso1KeyInfoType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":MgmtData, http://www.w3.org/2001/XMLSchema,string */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[iso1KeyInfoType_MgmtData_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[iso1KeyInfoType_MgmtData_ARRAY_SIZE];
 		uint16_t arrayLen;
 	} MgmtData;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1KeyInfoType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -1754,7 +2112,11 @@ struct iso1ChargeParameterDiscoveryReqType {
 struct iso1ChargingProfileType {
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":ProfileEntry, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ProfileEntryType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ChargingProfileEntryStart,"urn:iso:15118:2:2013:MsgDataTypes":ChargingProfileEntryMaxPower,"urn:iso:15118:2:2013:MsgDataTypes":ChargingProfileEntryMaxNumberOfPhasesInUse{0-1})',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso1ProfileEntryType* array;
+#else
 		struct iso1ProfileEntryType array[iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} ProfileEntry;
 };
@@ -1773,7 +2135,11 @@ struct iso1SalesTariffEntryType {
 	unsigned int EPriceLevel_isUsed:1;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":ConsumptionCost, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ConsumptionCostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":startValue,"urn:iso:15118:2:2013:MsgDataTypes":Cost{1-3})',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso1ConsumptionCostType* array;
+#else
 		struct iso1ConsumptionCostType array[iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} ConsumptionCost;
 };
@@ -1785,7 +2151,11 @@ struct iso1SalesTariffEntryType {
 struct iso1SalesTariffType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SalesTariffType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -1793,7 +2163,11 @@ struct iso1SalesTariffType {
 	uint8_t SalesTariffID ;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":SalesTariffDescription, urn:iso:15118:2:2013:MsgDataTypes,tariffDescriptionType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SalesTariffType_SalesTariffDescription_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  SalesTariffDescription ;
 	unsigned int SalesTariffDescription_isUsed:1;
@@ -1802,7 +2176,11 @@ struct iso1SalesTariffType {
 	unsigned int NumEPriceLevels_isUsed:1;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":SalesTariffEntry, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SalesTariffEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":TimeInterval),("urn:iso:15118:2:2013:MsgDataTypes":EPriceLevel{0-1},"urn:iso:15118:2:2013:MsgDataTypes":ConsumptionCost{0-3}))',  derivedBy='EXTENSION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso1SalesTariffEntryType* array;
+#else
 		struct iso1SalesTariffEntryType array[iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} SalesTariffEntry;
 };
@@ -1813,7 +2191,11 @@ struct iso1SalesTariffType {
 struct iso1SignatureType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1SignatureType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -1822,7 +2204,11 @@ struct iso1SignatureType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":SignatureValue, Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureValueType',  base type name='base64Binary',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 	struct iso1SignatureValueType SignatureValue ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":KeyInfo, Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyInfoType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":KeyName|"http://www.w3.org/2000/09/xmldsig#":KeyValue|"http://www.w3.org/2000/09/xmldsig#":RetrievalMethod|"http://www.w3.org/2000/09/xmldsig#":X509Data|"http://www.w3.org/2000/09/xmldsig#":PGPData|"http://www.w3.org/2000/09/xmldsig#":SPKIData|"http://www.w3.org/2000/09/xmldsig#":MgmtData|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso1KeyInfoType* KeyInfo ;
+#else
 	struct iso1KeyInfoType KeyInfo ;
+#endif /* DATABINDING_SLIM */
 	unsigned int KeyInfo_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Object, Complex type name='http://www.w3.org/2000/09/xmldsig#,ObjectType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any])){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 	struct {
@@ -1892,7 +2278,11 @@ struct iso1MessageHeaderType {
 	struct iso1NotificationType Notification ;
 	unsigned int Notification_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Signature, Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignedInfo,"http://www.w3.org/2000/09/xmldsig#":SignatureValue,"http://www.w3.org/2000/09/xmldsig#":KeyInfo{0-1},"http://www.w3.org/2000/09/xmldsig#":Object{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso1SignatureType* Signature ;
+#else
 	struct iso1SignatureType Signature ;
+#endif /* DATABINDING_SLIM */
 	unsigned int Signature_isUsed:1;
 };
 
@@ -1901,7 +2291,11 @@ struct iso1MessageHeaderType {
 struct iso1SAScheduleListType {
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":SAScheduleTuple, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SAScheduleTupleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":SAScheduleTupleID,"urn:iso:15118:2:2013:MsgDataTypes":PMaxSchedule,"urn:iso:15118:2:2013:MsgDataTypes":SalesTariff{0-1})',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso1SAScheduleTupleType* array;
+#else
 		struct iso1SAScheduleTupleType array[iso1SAScheduleListType_SAScheduleTuple_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} SAScheduleTuple;
 };
@@ -1925,7 +2319,11 @@ struct iso1ChargeParameterDiscoveryResType {
 	struct iso1AC_EVSEChargeParameterType AC_EVSEChargeParameter ;
 	unsigned int AC_EVSEChargeParameter_isUsed:1;
 	/* element: "urn:iso:15118:2:2013:MsgDataTypes":DC_EVSEChargeParameter, Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DC_EVSEChargeParameterType',  base type name='EVSEChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":DC_EVSEStatus,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMaximumCurrentLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMaximumPowerLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMaximumVoltageLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMinimumCurrentLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMinimumVoltageLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSECurrentRegulationTolerance{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVSEPeakCurrentRipple,"urn:iso:15118:2:2013:MsgDataTypes":EVSEEnergyToBeDelivered{0-1})',  derivedBy='EXTENSION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso1DC_EVSEChargeParameterType* DC_EVSEChargeParameter ;
+#else
 	struct iso1DC_EVSEChargeParameterType DC_EVSEChargeParameter ;
+#endif /* DATABINDING_SLIM */
 	unsigned int DC_EVSEChargeParameter_isUsed:1;
 };
 
@@ -2172,7 +2570,11 @@ struct iso1EXIDocument {
 	struct iso1TransformType Transform ;
 	struct iso1PGPDataType PGPData ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIDocument_MgmtData_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MgmtData ;
 	struct iso1SignatureMethodType SignatureMethod ;
@@ -2181,11 +2583,19 @@ struct iso1EXIDocument {
 	struct iso1X509DataType X509Data ;
 	struct iso1SignatureValueType SignatureValue ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIDocument_KeyName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  KeyName ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIDocument_DigestValue_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DigestValue ;
 	struct iso1SignedInfoType SignedInfo ;
@@ -2285,13 +2695,21 @@ struct iso1EXISchemaInformedElementFragmentGrammar {
 	/* 4 ATTRIBUTE[STRING]({urn:iso:15118:2:2013:MsgDataTypes}Id) */
 	unsigned int Id_isUsed:1;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1exiElementFrag_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	} Id ;
 	/* 247 START_ELEMENT({urn:iso:15118:2:2013:MsgBody}eMAID) */
 	unsigned int CHARACTERS_GENERIC_isUsed:1;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1exiElementFrag_CHARACTERS_GENERIC_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	} CHARACTERS_GENERIC ;
 
@@ -2335,7 +2753,11 @@ struct iso1EXIFragment {
 	struct iso1X509IssuerSerialType RootCertificateID ;
 	int64_t HMACOutputLength ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_Exponent_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Exponent ;
 	struct iso1X509IssuerSerialType X509IssuerSerial ;
@@ -2348,7 +2770,11 @@ struct iso1EXIFragment {
 	struct iso1PhysicalValueType EVSEMaximumCurrentLimit ;
 	struct iso1SalesTariffType SalesTariff ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_PgenCounter_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PgenCounter ;
 	struct iso1X509DataType X509Data ;
@@ -2381,19 +2807,31 @@ struct iso1EXIFragment {
 		uint16_t bytesLen;
 	}  SessionID ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_PGPKeyPacket_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PGPKeyPacket ;
 	struct iso1MessageHeaderType Header ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_Seed_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Seed ;
 	struct iso1RSAKeyValueType RSAKeyValue ;
 	int FreeService ;
 	struct iso1PhysicalValueType EVSENominalVoltage ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIFragment_XPath_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  XPath ;
 	struct iso1MeteringReceiptResType MeteringReceiptRes ;
@@ -2401,7 +2839,11 @@ struct iso1EXIFragment {
 	struct iso1MeteringReceiptReqType MeteringReceiptReq ;
 	struct iso1PreChargeResType PreChargeRes ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_OEMProvisioningCert_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  OEMProvisioningCert ;
 	struct iso1PhysicalValueType EVEnergyCapacity ;
@@ -2412,7 +2854,11 @@ struct iso1EXIFragment {
 	uint16_t NotificationMaxDelay ;
 	struct iso1CableCheckReqType CableCheckReq ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIFragment_SalesTariffDescription_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  SalesTariffDescription ;
 	int EVSEVoltageLimitAchieved ;
@@ -2425,7 +2871,11 @@ struct iso1EXIFragment {
 	struct iso1ChargingStatusReqType ChargingStatusReq ;
 	struct iso1CableCheckResType CableCheckRes ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIFragment_MgmtData_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MgmtData ;
 	struct iso1MeterInfoType MeterInfo ;
@@ -2435,34 +2885,62 @@ struct iso1EXIFragment {
 	struct iso1ManifestType Manifest ;
 	struct iso1PhysicalValueType EVMaximumVoltageLimit ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_P_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  P ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_Q_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Q ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIFragment_X509SubjectName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  X509SubjectName ;
 	int32_t intValue ;
 	struct iso1ChargingProfileType ChargingProfile ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_G_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  G ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_J_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  J ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIFragment_ServiceScope_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ServiceScope ;
 	int ReceiptRequired ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIFragment_ServiceName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ServiceName ;
 	int16_t MeterStatus ;
@@ -2471,16 +2949,28 @@ struct iso1EXIFragment {
 	iso1serviceCategoryType ServiceCategory ;
 	struct iso1NotificationType Notification ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_X509CRL_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  X509CRL ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_Y_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Y ;
 	struct iso1PhysicalValueType EVSEPresentVoltage ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_DigestValue_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DigestValue ;
 	struct iso1PhysicalValueType EVSEMaximumPowerLimit ;
@@ -2490,7 +2980,11 @@ struct iso1EXIFragment {
 	struct iso1ConsumptionCostType ConsumptionCost ;
 	struct iso1DigestMethodType DigestMethod ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_SPKISexp_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  SPKISexp ;
 	struct iso1SessionSetupResType SessionSetupRes ;
@@ -2503,14 +2997,22 @@ struct iso1EXIFragment {
 	struct iso1PhysicalValueType EVTargetCurrent ;
 	struct iso1PhysicalValueType RemainingTimeToBulkSoC ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIFragment_stringValue_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  stringValue ;
 	struct iso1SessionSetupReqType SessionSetupReq ;
 	int8_t Multiplier ;
 	struct iso1CertificateUpdateResType CertificateUpdateRes ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_PGPKeyID_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PGPKeyID ;
 	struct iso1PhysicalValueType EVTargetVoltage ;
@@ -2519,7 +3021,11 @@ struct iso1EXIFragment {
 	struct iso1PhysicalValueType EVMaximumCurrentLimit ;
 	struct iso1CanonicalizationMethodType CanonicalizationMethod ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_X509Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  X509Certificate ;
 	struct iso1CertificateInstallationReqType CertificateInstallationReq ;
@@ -2542,14 +3048,22 @@ struct iso1EXIFragment {
 	struct iso1ContractSignatureEncryptedPrivateKeyType ContractSignatureEncryptedPrivateKey ;
 	struct iso1WeldingDetectionReqType WeldingDetectionReq ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIFragment_FaultMsg_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  FaultMsg ;
 	struct iso1WeldingDetectionResType WeldingDetectionRes ;
 	iso1chargeProgressType ChargeProgress ;
 	iso1paymentOptionType SelectedPaymentOption ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIFragment_EVSEID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  EVSEID ;
 	struct iso1ParameterSetType ParameterSet ;
@@ -2565,7 +3079,11 @@ struct iso1EXIFragment {
 	struct iso1ServiceParameterListType ServiceParameterList ;
 	struct iso1ListOfRootCertificateIDsType ListOfRootCertificateIDs ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIFragment_MeterID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MeterID ;
 	struct iso1ChargeServiceType ChargeService ;
@@ -2574,7 +3092,11 @@ struct iso1EXIFragment {
 	struct iso1PhysicalValueType startValue ;
 	struct iso1CurrentDemandReqType CurrentDemandReq ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIFragment_KeyName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  KeyName ;
 	struct iso1DC_EVPowerDeliveryParameterType DC_EVPowerDeliveryParameter ;
@@ -2590,14 +3112,22 @@ struct iso1EXIFragment {
 	struct iso1PMaxScheduleEntryType PMaxScheduleEntry ;
 	struct iso1ParameterType Parameter ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_X509SKI_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  X509SKI ;
 	struct iso1SelectedServiceType SelectedService ;
 	struct iso1PaymentServiceSelectionReqType PaymentServiceSelectionReq ;
 	struct iso1PaymentServiceSelectionResType PaymentServiceSelectionRes ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Certificate ;
 	struct iso1CurrentDemandResType CurrentDemandRes ;
@@ -2606,7 +3136,11 @@ struct iso1EXIFragment {
 	struct iso1PMaxScheduleType PMaxSchedule ;
 	iso1unitSymbolType Unit ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso1EXIFragment_X509IssuerName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  X509IssuerName ;
 	struct iso1ReferenceType Reference ;
@@ -2627,7 +3161,11 @@ struct iso1EXIFragment {
 	struct iso1ObjectType Object ;
 	struct iso1PhysicalValueType EVEnergyRequest ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso1EXIFragment_Modulus_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Modulus ;
 	iso1chargingSessionType ChargingSession ;
@@ -2877,33 +3415,55 @@ void init_iso1EXISchemaInformedElementFragmentGrammar(struct iso1EXISchemaInform
 #endif /* DEPLOY_ISO1_CODEC_FRAGMENT */
 void init_iso1MessageHeaderType(struct iso1MessageHeaderType* iso1MessageHeaderType);
 void init_iso1SignatureType(struct iso1SignatureType* iso1SignatureType);
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 void init_iso1PowerDeliveryReqType(struct iso1PowerDeliveryReqType* iso1PowerDeliveryReqType);
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
 void init_iso1ParameterType(struct iso1ParameterType* iso1ParameterType);
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 void init_iso1CertificateInstallationReqType(struct iso1CertificateInstallationReqType* iso1CertificateInstallationReqType);
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
 void init_iso1SessionSetupResType(struct iso1SessionSetupResType* iso1SessionSetupResType);
+#endif /* ISO1_DEPLOY_SessionSetupRes */
 void init_iso1EVChargeParameterType(struct iso1EVChargeParameterType* iso1EVChargeParameterType);
 void init_iso1DiffieHellmanPublickeyType(struct iso1DiffieHellmanPublickeyType* iso1DiffieHellmanPublickeyType);
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 void init_iso1ServiceDiscoveryResType(struct iso1ServiceDiscoveryResType* iso1ServiceDiscoveryResType);
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
 void init_iso1ServiceParameterListType(struct iso1ServiceParameterListType* iso1ServiceParameterListType);
 void init_iso1CertificateChainType(struct iso1CertificateChainType* iso1CertificateChainType);
 void init_iso1SASchedulesType(struct iso1SASchedulesType* iso1SASchedulesType);
 void init_iso1DC_EVSEStatusType(struct iso1DC_EVSEStatusType* iso1DC_EVSEStatusType);
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
 void init_iso1PreChargeResType(struct iso1PreChargeResType* iso1PreChargeResType);
+#endif /* ISO1_DEPLOY_PreChargeRes */
 void init_iso1ParameterSetType(struct iso1ParameterSetType* iso1ParameterSetType);
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
 void init_iso1ServiceDetailReqType(struct iso1ServiceDetailReqType* iso1ServiceDetailReqType);
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
 void init_iso1RelativeTimeIntervalType(struct iso1RelativeTimeIntervalType* iso1RelativeTimeIntervalType);
 void init_iso1SignedInfoType(struct iso1SignedInfoType* iso1SignedInfoType);
 void init_iso1EMAIDType(struct iso1EMAIDType* iso1EMAIDType);
+#if ISO1_DEPLOY_EVStatus == SUPPORT_YES
 void init_iso1EVStatusType(struct iso1EVStatusType* iso1EVStatusType);
+#endif /* ISO1_DEPLOY_EVStatus */
 void init_iso1ServiceListType(struct iso1ServiceListType* iso1ServiceListType);
 void init_iso1EVSEChargeParameterType(struct iso1EVSEChargeParameterType* iso1EVSEChargeParameterType);
 void init_iso1EVPowerDeliveryParameterType(struct iso1EVPowerDeliveryParameterType* iso1EVPowerDeliveryParameterType);
 void init_iso1ProfileEntryType(struct iso1ProfileEntryType* iso1ProfileEntryType);
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
 void init_iso1AuthorizationReqType(struct iso1AuthorizationReqType* iso1AuthorizationReqType);
+#endif /* ISO1_DEPLOY_AuthorizationReq */
 void init_iso1MeterInfoType(struct iso1MeterInfoType* iso1MeterInfoType);
+#if ISO1_DEPLOY_Manifest == SUPPORT_YES
 void init_iso1ManifestType(struct iso1ManifestType* iso1ManifestType);
+#endif /* ISO1_DEPLOY_Manifest */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 void init_iso1ChargeParameterDiscoveryResType(struct iso1ChargeParameterDiscoveryResType* iso1ChargeParameterDiscoveryResType);
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 void init_iso1PowerDeliveryResType(struct iso1PowerDeliveryResType* iso1PowerDeliveryResType);
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
 void init_iso1DC_EVChargeParameterType(struct iso1DC_EVChargeParameterType* iso1DC_EVChargeParameterType);
 void init_iso1ConsumptionCostType(struct iso1ConsumptionCostType* iso1ConsumptionCostType);
 void init_iso1PMaxScheduleType(struct iso1PMaxScheduleType* iso1PMaxScheduleType);
@@ -2911,28 +3471,48 @@ void init_iso1PaymentOptionListType(struct iso1PaymentOptionListType* iso1Paymen
 void init_iso1ObjectType(struct iso1ObjectType* iso1ObjectType);
 void init_iso1PhysicalValueType(struct iso1PhysicalValueType* iso1PhysicalValueType);
 void init_iso1RSAKeyValueType(struct iso1RSAKeyValueType* iso1RSAKeyValueType);
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
 void init_iso1SessionStopResType(struct iso1SessionStopResType* iso1SessionStopResType);
+#endif /* ISO1_DEPLOY_SessionStopRes */
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 void init_iso1CertificateUpdateReqType(struct iso1CertificateUpdateReqType* iso1CertificateUpdateReqType);
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
 void init_iso1SignatureValueType(struct iso1SignatureValueType* iso1SignatureValueType);
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 void init_iso1PaymentDetailsReqType(struct iso1PaymentDetailsReqType* iso1PaymentDetailsReqType);
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
 void init_iso1AuthorizationResType(struct iso1AuthorizationResType* iso1AuthorizationResType);
+#endif /* ISO1_DEPLOY_AuthorizationRes */
 void init_iso1DC_EVSEChargeParameterType(struct iso1DC_EVSEChargeParameterType* iso1DC_EVSEChargeParameterType);
 void init_iso1SubCertificatesType(struct iso1SubCertificatesType* iso1SubCertificatesType);
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
 void init_iso1ChargingStatusResType(struct iso1ChargingStatusResType* iso1ChargingStatusResType);
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
 void init_iso1DSAKeyValueType(struct iso1DSAKeyValueType* iso1DSAKeyValueType);
 void init_iso1ListOfRootCertificateIDsType(struct iso1ListOfRootCertificateIDsType* iso1ListOfRootCertificateIDsType);
 void init_iso1ChargeServiceType(struct iso1ChargeServiceType* iso1ChargeServiceType);
 void init_iso1IntervalType(struct iso1IntervalType* iso1IntervalType);
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 void init_iso1MeteringReceiptReqType(struct iso1MeteringReceiptReqType* iso1MeteringReceiptReqType);
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
 void init_iso1ServiceDetailResType(struct iso1ServiceDetailResType* iso1ServiceDetailResType);
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
 void init_iso1KeyValueType(struct iso1KeyValueType* iso1KeyValueType);
 void init_iso1SelectedServiceListType(struct iso1SelectedServiceListType* iso1SelectedServiceListType);
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
 void init_iso1CableCheckResType(struct iso1CableCheckResType* iso1CableCheckResType);
+#endif /* ISO1_DEPLOY_CableCheckRes */
 void init_iso1X509IssuerSerialType(struct iso1X509IssuerSerialType* iso1X509IssuerSerialType);
 void init_iso1KeyInfoType(struct iso1KeyInfoType* iso1KeyInfoType);
 void init_iso1TransformsType(struct iso1TransformsType* iso1TransformsType);
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 void init_iso1ChargeParameterDiscoveryReqType(struct iso1ChargeParameterDiscoveryReqType* iso1ChargeParameterDiscoveryReqType);
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
 void init_iso1PreChargeReqType(struct iso1PreChargeReqType* iso1PreChargeReqType);
+#endif /* ISO1_DEPLOY_PreChargeReq */
 void init_iso1EVSEStatusType(struct iso1EVSEStatusType* iso1EVSEStatusType);
 void init_iso1SignatureMethodType(struct iso1SignatureMethodType* iso1SignatureMethodType);
 void init_iso1X509DataType(struct iso1X509DataType* iso1X509DataType);
@@ -2944,40 +3524,76 @@ void init_iso1TransformType(struct iso1TransformType* iso1TransformType);
 void init_iso1SAScheduleTupleType(struct iso1SAScheduleTupleType* iso1SAScheduleTupleType);
 void init_iso1AC_EVChargeParameterType(struct iso1AC_EVChargeParameterType* iso1AC_EVChargeParameterType);
 void init_iso1AnonType_V2G_Message(struct iso1AnonType_V2G_Message* iso1AnonType_V2G_Message);
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 void init_iso1PaymentDetailsResType(struct iso1PaymentDetailsResType* iso1PaymentDetailsResType);
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
 void init_iso1ContractSignatureEncryptedPrivateKeyType(struct iso1ContractSignatureEncryptedPrivateKeyType* iso1ContractSignatureEncryptedPrivateKeyType);
 void init_iso1PMaxScheduleEntryType(struct iso1PMaxScheduleEntryType* iso1PMaxScheduleEntryType);
 void init_iso1SPKIDataType(struct iso1SPKIDataType* iso1SPKIDataType);
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 void init_iso1MeteringReceiptResType(struct iso1MeteringReceiptResType* iso1MeteringReceiptResType);
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
 void init_iso1SessionStopReqType(struct iso1SessionStopReqType* iso1SessionStopReqType);
+#endif /* ISO1_DEPLOY_SessionStopReq */
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 void init_iso1WeldingDetectionResType(struct iso1WeldingDetectionResType* iso1WeldingDetectionResType);
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
 void init_iso1ReferenceType(struct iso1ReferenceType* iso1ReferenceType);
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
 void init_iso1CurrentDemandReqType(struct iso1CurrentDemandReqType* iso1CurrentDemandReqType);
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
 void init_iso1SalesTariffEntryType(struct iso1SalesTariffEntryType* iso1SalesTariffEntryType);
+#if ISO1_DEPLOY_Entry == SUPPORT_YES
 void init_iso1EntryType(struct iso1EntryType* iso1EntryType);
+#endif /* ISO1_DEPLOY_Entry */
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
 void init_iso1SessionSetupReqType(struct iso1SessionSetupReqType* iso1SessionSetupReqType);
+#endif /* ISO1_DEPLOY_SessionSetupReq */
 void init_iso1CostType(struct iso1CostType* iso1CostType);
 void init_iso1DC_EVPowerDeliveryParameterType(struct iso1DC_EVPowerDeliveryParameterType* iso1DC_EVPowerDeliveryParameterType);
 void init_iso1RetrievalMethodType(struct iso1RetrievalMethodType* iso1RetrievalMethodType);
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 void init_iso1CertificateUpdateResType(struct iso1CertificateUpdateResType* iso1CertificateUpdateResType);
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 void init_iso1CertificateInstallationResType(struct iso1CertificateInstallationResType* iso1CertificateInstallationResType);
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
 void init_iso1CanonicalizationMethodType(struct iso1CanonicalizationMethodType* iso1CanonicalizationMethodType);
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 void init_iso1WeldingDetectionReqType(struct iso1WeldingDetectionReqType* iso1WeldingDetectionReqType);
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
 void init_iso1DC_EVStatusType(struct iso1DC_EVStatusType* iso1DC_EVStatusType);
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
 void init_iso1CurrentDemandResType(struct iso1CurrentDemandResType* iso1CurrentDemandResType);
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
 void init_iso1ServiceType(struct iso1ServiceType* iso1ServiceType);
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 void init_iso1ServiceDiscoveryReqType(struct iso1ServiceDiscoveryReqType* iso1ServiceDiscoveryReqType);
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
 void init_iso1AC_EVSEChargeParameterType(struct iso1AC_EVSEChargeParameterType* iso1AC_EVSEChargeParameterType);
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
 void init_iso1CableCheckReqType(struct iso1CableCheckReqType* iso1CableCheckReqType);
+#endif /* ISO1_DEPLOY_CableCheckReq */
 void init_iso1SelectedServiceType(struct iso1SelectedServiceType* iso1SelectedServiceType);
 void init_iso1AC_EVSEStatusType(struct iso1AC_EVSEStatusType* iso1AC_EVSEStatusType);
 void init_iso1SalesTariffType(struct iso1SalesTariffType* iso1SalesTariffType);
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 void init_iso1PaymentServiceSelectionReqType(struct iso1PaymentServiceSelectionReqType* iso1PaymentServiceSelectionReqType);
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
+#if ISO1_DEPLOY_SignatureProperties == SUPPORT_YES
 void init_iso1SignaturePropertiesType(struct iso1SignaturePropertiesType* iso1SignaturePropertiesType);
+#endif /* ISO1_DEPLOY_SignatureProperties */
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
 void init_iso1BodyBaseType(struct iso1BodyBaseType* iso1BodyBaseType);
+#endif /* ISO1_DEPLOY_BodyElement */
 void init_iso1SupportedEnergyTransferModeType(struct iso1SupportedEnergyTransferModeType* iso1SupportedEnergyTransferModeType);
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
 void init_iso1ChargingStatusReqType(struct iso1ChargingStatusReqType* iso1ChargingStatusReqType);
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 void init_iso1PaymentServiceSelectionResType(struct iso1PaymentServiceSelectionResType* iso1PaymentServiceSelectionResType);
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
 void init_iso1DigestMethodType(struct iso1DigestMethodType* iso1DigestMethodType);
 void init_iso1SignaturePropertyType(struct iso1SignaturePropertyType* iso1SignaturePropertyType);
 void init_iso1PGPDataType(struct iso1PGPDataType* iso1PGPDataType);
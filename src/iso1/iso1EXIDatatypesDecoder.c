@@ -34,6 +34,8 @@
 
 #include "DecoderChannel.h"
 #include "EXIHeaderDecoder.h"
+#include "GrammarDecoder.h"
+#include "MemoryArena.h"
 
 #include "iso1EXIDatatypes.h"
 #include "ErrorCodes.h"
@@ -43,41 +45,60 @@
 
 #if DEPLOY_ISO1_CODEC == SUPPORT_YES
 
-/** event-code */
-static uint32_t eventCode;
-static int errn;
-static uint32_t uint32;
+/* Note: eventCode, errn and uint32 are locals of each decode function (reentrant decoding) */
 
 /* Forward Declarations */
 static int decode_iso1MessageHeaderType(bitstream_t* stream, struct iso1MessageHeaderType* iso1MessageHeaderType);
 static int decode_iso1SignatureType(bitstream_t* stream, struct iso1SignatureType* iso1SignatureType);
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 static int decode_iso1PowerDeliveryReqType(bitstream_t* stream, struct iso1PowerDeliveryReqType* iso1PowerDeliveryReqType);
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
 static int decode_iso1ParameterType(bitstream_t* stream, struct iso1ParameterType* iso1ParameterType);
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 static int decode_iso1CertificateInstallationReqType(bitstream_t* stream, struct iso1CertificateInstallationReqType* iso1CertificateInstallationReqType);
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
 static int decode_iso1SessionSetupResType(bitstream_t* stream, struct iso1SessionSetupResType* iso1SessionSetupResType);
+#endif /* ISO1_DEPLOY_SessionSetupRes */
 static int decode_iso1EVChargeParameterType(bitstream_t* stream, struct iso1EVChargeParameterType* iso1EVChargeParameterType);
 static int decode_iso1DiffieHellmanPublickeyType(bitstream_t* stream, struct iso1DiffieHellmanPublickeyType* iso1DiffieHellmanPublickeyType);
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 static int decode_iso1ServiceDiscoveryResType(bitstream_t* stream, struct iso1ServiceDiscoveryResType* iso1ServiceDiscoveryResType);
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
 static int decode_iso1ServiceParameterListType(bitstream_t* stream, struct iso1ServiceParameterListType* iso1ServiceParameterListType);
 static int decode_iso1CertificateChainType(bitstream_t* stream, struct iso1CertificateChainType* iso1CertificateChainType);
 static int decode_iso1SASchedulesType(bitstream_t* stream, struct iso1SASchedulesType* iso1SASchedulesType);
 static int decode_iso1DC_EVSEStatusType(bitstream_t* stream, struct iso1DC_EVSEStatusType* iso1DC_EVSEStatusType);
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
 static int decode_iso1PreChargeResType(bitstream_t* stream, struct iso1PreChargeResType* iso1PreChargeResType);
+#endif /* ISO1_DEPLOY_PreChargeRes */
 static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1ParameterSetType* iso1ParameterSetType);
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
 static int decode_iso1ServiceDetailReqType(bitstream_t* stream, struct iso1ServiceDetailReqType* iso1ServiceDetailReqType);
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
 static int decode_iso1RelativeTimeIntervalType(bitstream_t* stream, struct iso1RelativeTimeIntervalType* iso1RelativeTimeIntervalType);
 static int decode_iso1SignedInfoType(bitstream_t* stream, struct iso1SignedInfoType* iso1SignedInfoType);
 static int decode_iso1EMAIDType(bitstream_t* stream, struct iso1EMAIDType* iso1EMAIDType);
+#if ISO1_DEPLOY_EVStatus == SUPPORT_YES
 static int decode_iso1EVStatusType(bitstream_t* stream, struct iso1EVStatusType* iso1EVStatusType);
+#endif /* ISO1_DEPLOY_EVStatus */
 static int decode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceListType* iso1ServiceListType);
 static int decode_iso1EVSEChargeParameterType(bitstream_t* stream, struct iso1EVSEChargeParameterType* iso1EVSEChargeParameterType);
 static int decode_iso1EVPowerDeliveryParameterType(bitstream_t* stream, struct iso1EVPowerDeliveryParameterType* iso1EVPowerDeliveryParameterType);
 static int decode_iso1ProfileEntryType(bitstream_t* stream, struct iso1ProfileEntryType* iso1ProfileEntryType);
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
 static int decode_iso1AuthorizationReqType(bitstream_t* stream, struct iso1AuthorizationReqType* iso1AuthorizationReqType);
+#endif /* ISO1_DEPLOY_AuthorizationReq */
 static int decode_iso1MeterInfoType(bitstream_t* stream, struct iso1MeterInfoType* iso1MeterInfoType);
+#if ISO1_DEPLOY_Manifest == SUPPORT_YES
 static int decode_iso1ManifestType(bitstream_t* stream, struct iso1ManifestType* iso1ManifestType);
+#endif /* ISO1_DEPLOY_Manifest */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 static int decode_iso1ChargeParameterDiscoveryResType(bitstream_t* stream, struct iso1ChargeParameterDiscoveryResType* iso1ChargeParameterDiscoveryResType);
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 static int decode_iso1PowerDeliveryResType(bitstream_t* stream, struct iso1PowerDeliveryResType* iso1PowerDeliveryResType);
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
 static int decode_iso1DC_EVChargeParameterType(bitstream_t* stream, struct iso1DC_EVChargeParameterType* iso1DC_EVChargeParameterType);
 static int decode_iso1ConsumptionCostType(bitstream_t* stream, struct iso1ConsumptionCostType* iso1ConsumptionCostType);
 static int decode_iso1PMaxScheduleType(bitstream_t* stream, struct iso1PMaxScheduleType* iso1PMaxScheduleType);
@@ -85,28 +106,48 @@ static int decode_iso1PaymentOptionListType(bitstream_t* stream, struct iso1Paym
 static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso1ObjectType);
 static int decode_iso1PhysicalValueType(bitstream_t* stream, struct iso1PhysicalValueType* iso1PhysicalValueType);
 static int decode_iso1RSAKeyValueType(bitstream_t* stream, struct iso1RSAKeyValueType* iso1RSAKeyValueType);
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
 static int decode_iso1SessionStopResType(bitstream_t* stream, struct iso1SessionStopResType* iso1SessionStopResType);
+#endif /* ISO1_DEPLOY_SessionStopRes */
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 static int decode_iso1CertificateUpdateReqType(bitstream_t* stream, struct iso1CertificateUpdateReqType* iso1CertificateUpdateReqType);
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
 static int decode_iso1SignatureValueType(bitstream_t* stream, struct iso1SignatureValueType* iso1SignatureValueType);
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 static int decode_iso1PaymentDetailsReqType(bitstream_t* stream, struct iso1PaymentDetailsReqType* iso1PaymentDetailsReqType);
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
 static int decode_iso1AuthorizationResType(bitstream_t* stream, struct iso1AuthorizationResType* iso1AuthorizationResType);
+#endif /* ISO1_DEPLOY_AuthorizationRes */
 static int decode_iso1DC_EVSEChargeParameterType(bitstream_t* stream, struct iso1DC_EVSEChargeParameterType* iso1DC_EVSEChargeParameterType);
 static int decode_iso1SubCertificatesType(bitstream_t* stream, struct iso1SubCertificatesType* iso1SubCertificatesType);
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
 static int decode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1ChargingStatusResType* iso1ChargingStatusResType);
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
 static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValueType* iso1DSAKeyValueType);
 static int decode_iso1ListOfRootCertificateIDsType(bitstream_t* stream, struct iso1ListOfRootCertificateIDsType* iso1ListOfRootCertificateIDsType);
 static int decode_iso1ChargeServiceType(bitstream_t* stream, struct iso1ChargeServiceType* iso1ChargeServiceType);
 static int decode_iso1IntervalType(bitstream_t* stream, struct iso1IntervalType* iso1IntervalType);
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 static int decode_iso1MeteringReceiptReqType(bitstream_t* stream, struct iso1MeteringReceiptReqType* iso1MeteringReceiptReqType);
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
 static int decode_iso1ServiceDetailResType(bitstream_t* stream, struct iso1ServiceDetailResType* iso1ServiceDetailResType);
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
 static int decode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType* iso1KeyValueType);
 static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1SelectedServiceListType* iso1SelectedServiceListType);
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
 static int decode_iso1CableCheckResType(bitstream_t* stream, struct iso1CableCheckResType* iso1CableCheckResType);
+#endif /* ISO1_DEPLOY_CableCheckRes */
 static int decode_iso1X509IssuerSerialType(bitstream_t* stream, struct iso1X509IssuerSerialType* iso1X509IssuerSerialType);
 static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* iso1KeyInfoType);
 static int decode_iso1TransformsType(bitstream_t* stream, struct iso1TransformsType* iso1TransformsType);
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 static int decode_iso1ChargeParameterDiscoveryReqType(bitstream_t* stream, struct iso1ChargeParameterDiscoveryReqType* iso1ChargeParameterDiscoveryReqType);
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
 static int decode_iso1PreChargeReqType(bitstream_t* stream, struct iso1PreChargeReqType* iso1PreChargeReqType);
+#endif /* ISO1_DEPLOY_PreChargeReq */
 static int decode_iso1EVSEStatusType(bitstream_t* stream, struct iso1EVSEStatusType* iso1EVSEStatusType);
 static int decode_iso1SignatureMethodType(bitstream_t* stream, struct iso1SignatureMethodType* iso1SignatureMethodType);
 static int decode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType* iso1X509DataType);
@@ -118,49 +159,495 @@ static int decode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 static int decode_iso1SAScheduleTupleType(bitstream_t* stream, struct iso1SAScheduleTupleType* iso1SAScheduleTupleType);
 static int decode_iso1AC_EVChargeParameterType(bitstream_t* stream, struct iso1AC_EVChargeParameterType* iso1AC_EVChargeParameterType);
 static int decode_iso1AnonType_V2G_Message(bitstream_t* stream, struct iso1AnonType_V2G_Message* iso1AnonType_V2G_Message);
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 static int decode_iso1PaymentDetailsResType(bitstream_t* stream, struct iso1PaymentDetailsResType* iso1PaymentDetailsResType);
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
 static int decode_iso1ContractSignatureEncryptedPrivateKeyType(bitstream_t* stream, struct iso1ContractSignatureEncryptedPrivateKeyType* iso1ContractSignatureEncryptedPrivateKeyType);
 static int decode_iso1PMaxScheduleEntryType(bitstream_t* stream, struct iso1PMaxScheduleEntryType* iso1PMaxScheduleEntryType);
 static int decode_iso1SPKIDataType(bitstream_t* stream, struct iso1SPKIDataType* iso1SPKIDataType);
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 static int decode_iso1MeteringReceiptResType(bitstream_t* stream, struct iso1MeteringReceiptResType* iso1MeteringReceiptResType);
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
 static int decode_iso1SessionStopReqType(bitstream_t* stream, struct iso1SessionStopReqType* iso1SessionStopReqType);
+#endif /* ISO1_DEPLOY_SessionStopReq */
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 static int decode_iso1WeldingDetectionResType(bitstream_t* stream, struct iso1WeldingDetectionResType* iso1WeldingDetectionResType);
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
 static int decode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceType* iso1ReferenceType);
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
 static int decode_iso1CurrentDemandReqType(bitstream_t* stream, struct iso1CurrentDemandReqType* iso1CurrentDemandReqType);
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
 static int decode_iso1SalesTariffEntryType(bitstream_t* stream, struct iso1SalesTariffEntryType* iso1SalesTariffEntryType);
+#if ISO1_DEPLOY_Entry == SUPPORT_YES
 static int decode_iso1EntryType(bitstream_t* stream, struct iso1EntryType* iso1EntryType);
+#endif /* ISO1_DEPLOY_Entry */
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
 static int decode_iso1SessionSetupReqType(bitstream_t* stream, struct iso1SessionSetupReqType* iso1SessionSetupReqType);
+#endif /* ISO1_DEPLOY_SessionSetupReq */
 static int decode_iso1CostType(bitstream_t* stream, struct iso1CostType* iso1CostType);
 static int decode_iso1DC_EVPowerDeliveryParameterType(bitstream_t* stream, struct iso1DC_EVPowerDeliveryParameterType* iso1DC_EVPowerDeliveryParameterType);
 static int decode_iso1RetrievalMethodType(bitstream_t* stream, struct iso1RetrievalMethodType* iso1RetrievalMethodType);
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 static int decode_iso1CertificateUpdateResType(bitstream_t* stream, struct iso1CertificateUpdateResType* iso1CertificateUpdateResType);
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 static int decode_iso1CertificateInstallationResType(bitstream_t* stream, struct iso1CertificateInstallationResType* iso1CertificateInstallationResType);
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
 static int decode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso1CanonicalizationMethodType* iso1CanonicalizationMethodType);
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 static int decode_iso1WeldingDetectionReqType(bitstream_t* stream, struct iso1WeldingDetectionReqType* iso1WeldingDetectionReqType);
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
 static int decode_iso1DC_EVStatusType(bitstream_t* stream, struct iso1DC_EVStatusType* iso1DC_EVStatusType);
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
 static int decode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1CurrentDemandResType* iso1CurrentDemandResType);
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
 static int decode_iso1ServiceType(bitstream_t* stream, struct iso1ServiceType* iso1ServiceType);
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 static int decode_iso1ServiceDiscoveryReqType(bitstream_t* stream, struct iso1ServiceDiscoveryReqType* iso1ServiceDiscoveryReqType);
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
 static int decode_iso1AC_EVSEChargeParameterType(bitstream_t* stream, struct iso1AC_EVSEChargeParameterType* iso1AC_EVSEChargeParameterType);
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
 static int decode_iso1CableCheckReqType(bitstream_t* stream, struct iso1CableCheckReqType* iso1CableCheckReqType);
+#endif /* ISO1_DEPLOY_CableCheckReq */
 static int decode_iso1SelectedServiceType(bitstream_t* stream, struct iso1SelectedServiceType* iso1SelectedServiceType);
 static int decode_iso1AC_EVSEStatusType(bitstream_t* stream, struct iso1AC_EVSEStatusType* iso1AC_EVSEStatusType);
 static int decode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTariffType* iso1SalesTariffType);
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 static int decode_iso1PaymentServiceSelectionReqType(bitstream_t* stream, struct iso1PaymentServiceSelectionReqType* iso1PaymentServiceSelectionReqType);
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
+#if ISO1_DEPLOY_SignatureProperties == SUPPORT_YES
 static int decode_iso1SignaturePropertiesType(bitstream_t* stream, struct iso1SignaturePropertiesType* iso1SignaturePropertiesType);
+#endif /* ISO1_DEPLOY_SignatureProperties */
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
 static int decode_iso1BodyBaseType(bitstream_t* stream, struct iso1BodyBaseType* iso1BodyBaseType);
+#endif /* ISO1_DEPLOY_BodyElement */
 static int decode_iso1SupportedEnergyTransferModeType(bitstream_t* stream, struct iso1SupportedEnergyTransferModeType* iso1SupportedEnergyTransferModeType);
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
 static int decode_iso1ChargingStatusReqType(bitstream_t* stream, struct iso1ChargingStatusReqType* iso1ChargingStatusReqType);
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 static int decode_iso1PaymentServiceSelectionResType(bitstream_t* stream, struct iso1PaymentServiceSelectionResType* iso1PaymentServiceSelectionResType);
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
 static int decode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMethodType* iso1DigestMethodType);
 static int decode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1SignaturePropertyType* iso1SignaturePropertyType);
 static int decode_iso1PGPDataType(bitstream_t* stream, struct iso1PGPDataType* iso1PGPDataType);
 
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+/* type independent signatures for the grammar tables */
+static int decode_iso1AC_EVChargeParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1AC_EVChargeParameterType(stream, (struct iso1AC_EVChargeParameterType*)value);
+}
+static int decode_iso1AC_EVSEChargeParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1AC_EVSEChargeParameterType(stream, (struct iso1AC_EVSEChargeParameterType*)value);
+}
+static int decode_iso1AC_EVSEStatusTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1AC_EVSEStatusType(stream, (struct iso1AC_EVSEStatusType*)value);
+}
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
+static int decode_iso1AuthorizationReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1AuthorizationReqType(stream, (struct iso1AuthorizationReqType*)value);
+}
+#endif /* ISO1_DEPLOY_AuthorizationReq */
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
+static int decode_iso1AuthorizationResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1AuthorizationResType(stream, (struct iso1AuthorizationResType*)value);
+}
+#endif /* ISO1_DEPLOY_AuthorizationRes */
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
+static int decode_iso1BodyBaseTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1BodyBaseType(stream, (struct iso1BodyBaseType*)value);
+}
+#endif /* ISO1_DEPLOY_BodyElement */
+static int decode_iso1BodyTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1BodyType(stream, (struct iso1BodyType*)value);
+}
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
+static int decode_iso1CableCheckReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1CableCheckReqType(stream, (struct iso1CableCheckReqType*)value);
+}
+#endif /* ISO1_DEPLOY_CableCheckReq */
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
+static int decode_iso1CableCheckResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1CableCheckResType(stream, (struct iso1CableCheckResType*)value);
+}
+#endif /* ISO1_DEPLOY_CableCheckRes */
+static int decode_iso1CanonicalizationMethodTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1CanonicalizationMethodType(stream, (struct iso1CanonicalizationMethodType*)value);
+}
+static int decode_iso1CertificateChainTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1CertificateChainType(stream, (struct iso1CertificateChainType*)value);
+}
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
+static int decode_iso1CertificateInstallationReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1CertificateInstallationReqType(stream, (struct iso1CertificateInstallationReqType*)value);
+}
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
+static int decode_iso1CertificateInstallationResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1CertificateInstallationResType(stream, (struct iso1CertificateInstallationResType*)value);
+}
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
+static int decode_iso1CertificateUpdateReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1CertificateUpdateReqType(stream, (struct iso1CertificateUpdateReqType*)value);
+}
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
+static int decode_iso1CertificateUpdateResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1CertificateUpdateResType(stream, (struct iso1CertificateUpdateResType*)value);
+}
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
+static int decode_iso1ChargeParameterDiscoveryReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ChargeParameterDiscoveryReqType(stream, (struct iso1ChargeParameterDiscoveryReqType*)value);
+}
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
+static int decode_iso1ChargeParameterDiscoveryResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ChargeParameterDiscoveryResType(stream, (struct iso1ChargeParameterDiscoveryResType*)value);
+}
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
+static int decode_iso1ChargeServiceTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ChargeServiceType(stream, (struct iso1ChargeServiceType*)value);
+}
+static int decode_iso1ChargingProfileTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ChargingProfileType(stream, (struct iso1ChargingProfileType*)value);
+}
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
+static int decode_iso1ChargingStatusReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ChargingStatusReqType(stream, (struct iso1ChargingStatusReqType*)value);
+}
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
+static int decode_iso1ChargingStatusResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ChargingStatusResType(stream, (struct iso1ChargingStatusResType*)value);
+}
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
+static int decode_iso1ConsumptionCostTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ConsumptionCostType(stream, (struct iso1ConsumptionCostType*)value);
+}
+static int decode_iso1ContractSignatureEncryptedPrivateKeyTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ContractSignatureEncryptedPrivateKeyType(stream, (struct iso1ContractSignatureEncryptedPrivateKeyType*)value);
+}
+static int decode_iso1CostTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1CostType(stream, (struct iso1CostType*)value);
+}
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
+static int decode_iso1CurrentDemandReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1CurrentDemandReqType(stream, (struct iso1CurrentDemandReqType*)value);
+}
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
+static int decode_iso1CurrentDemandResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1CurrentDemandResType(stream, (struct iso1CurrentDemandResType*)value);
+}
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
+static int decode_iso1DC_EVChargeParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1DC_EVChargeParameterType(stream, (struct iso1DC_EVChargeParameterType*)value);
+}
+static int decode_iso1DC_EVPowerDeliveryParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1DC_EVPowerDeliveryParameterType(stream, (struct iso1DC_EVPowerDeliveryParameterType*)value);
+}
+static int decode_iso1DC_EVSEChargeParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1DC_EVSEChargeParameterType(stream, (struct iso1DC_EVSEChargeParameterType*)value);
+}
+static int decode_iso1DC_EVSEStatusTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1DC_EVSEStatusType(stream, (struct iso1DC_EVSEStatusType*)value);
+}
+static int decode_iso1DC_EVStatusTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1DC_EVStatusType(stream, (struct iso1DC_EVStatusType*)value);
+}
+static int decode_iso1DSAKeyValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1DSAKeyValueType(stream, (struct iso1DSAKeyValueType*)value);
+}
+static int decode_iso1DiffieHellmanPublickeyTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1DiffieHellmanPublickeyType(stream, (struct iso1DiffieHellmanPublickeyType*)value);
+}
+static int decode_iso1DigestMethodTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1DigestMethodType(stream, (struct iso1DigestMethodType*)value);
+}
+static int decode_iso1EMAIDTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1EMAIDType(stream, (struct iso1EMAIDType*)value);
+}
+static int decode_iso1EVChargeParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1EVChargeParameterType(stream, (struct iso1EVChargeParameterType*)value);
+}
+static int decode_iso1EVPowerDeliveryParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1EVPowerDeliveryParameterType(stream, (struct iso1EVPowerDeliveryParameterType*)value);
+}
+static int decode_iso1EVSEChargeParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1EVSEChargeParameterType(stream, (struct iso1EVSEChargeParameterType*)value);
+}
+static int decode_iso1EVSEStatusTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1EVSEStatusType(stream, (struct iso1EVSEStatusType*)value);
+}
+static int decode_iso1IntervalTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1IntervalType(stream, (struct iso1IntervalType*)value);
+}
+static int decode_iso1KeyInfoTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1KeyInfoType(stream, (struct iso1KeyInfoType*)value);
+}
+static int decode_iso1KeyValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1KeyValueType(stream, (struct iso1KeyValueType*)value);
+}
+static int decode_iso1ListOfRootCertificateIDsTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ListOfRootCertificateIDsType(stream, (struct iso1ListOfRootCertificateIDsType*)value);
+}
+static int decode_iso1MessageHeaderTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1MessageHeaderType(stream, (struct iso1MessageHeaderType*)value);
+}
+static int decode_iso1MeterInfoTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1MeterInfoType(stream, (struct iso1MeterInfoType*)value);
+}
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
+static int decode_iso1MeteringReceiptReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1MeteringReceiptReqType(stream, (struct iso1MeteringReceiptReqType*)value);
+}
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
+static int decode_iso1MeteringReceiptResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1MeteringReceiptResType(stream, (struct iso1MeteringReceiptResType*)value);
+}
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
+static int decode_iso1NotificationTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1NotificationType(stream, (struct iso1NotificationType*)value);
+}
+static int decode_iso1ObjectTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ObjectType(stream, (struct iso1ObjectType*)value);
+}
+static int decode_iso1PGPDataTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PGPDataType(stream, (struct iso1PGPDataType*)value);
+}
+static int decode_iso1PMaxScheduleEntryTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PMaxScheduleEntryType(stream, (struct iso1PMaxScheduleEntryType*)value);
+}
+static int decode_iso1PMaxScheduleTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PMaxScheduleType(stream, (struct iso1PMaxScheduleType*)value);
+}
+static int decode_iso1ParameterSetTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ParameterSetType(stream, (struct iso1ParameterSetType*)value);
+}
+static int decode_iso1ParameterTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ParameterType(stream, (struct iso1ParameterType*)value);
+}
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
+static int decode_iso1PaymentDetailsReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PaymentDetailsReqType(stream, (struct iso1PaymentDetailsReqType*)value);
+}
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
+static int decode_iso1PaymentDetailsResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PaymentDetailsResType(stream, (struct iso1PaymentDetailsResType*)value);
+}
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
+static int decode_iso1PaymentOptionListTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PaymentOptionListType(stream, (struct iso1PaymentOptionListType*)value);
+}
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
+static int decode_iso1PaymentServiceSelectionReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PaymentServiceSelectionReqType(stream, (struct iso1PaymentServiceSelectionReqType*)value);
+}
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
+static int decode_iso1PaymentServiceSelectionResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PaymentServiceSelectionResType(stream, (struct iso1PaymentServiceSelectionResType*)value);
+}
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
+static int decode_iso1PhysicalValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PhysicalValueType(stream, (struct iso1PhysicalValueType*)value);
+}
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
+static int decode_iso1PowerDeliveryReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PowerDeliveryReqType(stream, (struct iso1PowerDeliveryReqType*)value);
+}
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
+static int decode_iso1PowerDeliveryResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PowerDeliveryResType(stream, (struct iso1PowerDeliveryResType*)value);
+}
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
+static int decode_iso1PreChargeReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PreChargeReqType(stream, (struct iso1PreChargeReqType*)value);
+}
+#endif /* ISO1_DEPLOY_PreChargeReq */
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
+static int decode_iso1PreChargeResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1PreChargeResType(stream, (struct iso1PreChargeResType*)value);
+}
+#endif /* ISO1_DEPLOY_PreChargeRes */
+static int decode_iso1ProfileEntryTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ProfileEntryType(stream, (struct iso1ProfileEntryType*)value);
+}
+static int decode_iso1RSAKeyValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1RSAKeyValueType(stream, (struct iso1RSAKeyValueType*)value);
+}
+static int decode_iso1ReferenceTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ReferenceType(stream, (struct iso1ReferenceType*)value);
+}
+static int decode_iso1RelativeTimeIntervalTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1RelativeTimeIntervalType(stream, (struct iso1RelativeTimeIntervalType*)value);
+}
+static int decode_iso1RetrievalMethodTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1RetrievalMethodType(stream, (struct iso1RetrievalMethodType*)value);
+}
+static int decode_iso1SAScheduleListTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SAScheduleListType(stream, (struct iso1SAScheduleListType*)value);
+}
+static int decode_iso1SAScheduleTupleTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SAScheduleTupleType(stream, (struct iso1SAScheduleTupleType*)value);
+}
+static int decode_iso1SASchedulesTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SASchedulesType(stream, (struct iso1SASchedulesType*)value);
+}
+static int decode_iso1SPKIDataTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SPKIDataType(stream, (struct iso1SPKIDataType*)value);
+}
+static int decode_iso1SalesTariffEntryTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SalesTariffEntryType(stream, (struct iso1SalesTariffEntryType*)value);
+}
+static int decode_iso1SalesTariffTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SalesTariffType(stream, (struct iso1SalesTariffType*)value);
+}
+static int decode_iso1SelectedServiceListTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SelectedServiceListType(stream, (struct iso1SelectedServiceListType*)value);
+}
+static int decode_iso1SelectedServiceTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SelectedServiceType(stream, (struct iso1SelectedServiceType*)value);
+}
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
+static int decode_iso1ServiceDetailReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ServiceDetailReqType(stream, (struct iso1ServiceDetailReqType*)value);
+}
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
+static int decode_iso1ServiceDetailResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ServiceDetailResType(stream, (struct iso1ServiceDetailResType*)value);
+}
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
+static int decode_iso1ServiceDiscoveryReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ServiceDiscoveryReqType(stream, (struct iso1ServiceDiscoveryReqType*)value);
+}
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
+static int decode_iso1ServiceDiscoveryResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ServiceDiscoveryResType(stream, (struct iso1ServiceDiscoveryResType*)value);
+}
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
+static int decode_iso1ServiceListTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ServiceListType(stream, (struct iso1ServiceListType*)value);
+}
+static int decode_iso1ServiceParameterListTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ServiceParameterListType(stream, (struct iso1ServiceParameterListType*)value);
+}
+static int decode_iso1ServiceTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1ServiceType(stream, (struct iso1ServiceType*)value);
+}
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
+static int decode_iso1SessionSetupReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SessionSetupReqType(stream, (struct iso1SessionSetupReqType*)value);
+}
+#endif /* ISO1_DEPLOY_SessionSetupReq */
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
+static int decode_iso1SessionSetupResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SessionSetupResType(stream, (struct iso1SessionSetupResType*)value);
+}
+#endif /* ISO1_DEPLOY_SessionSetupRes */
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
+static int decode_iso1SessionStopReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SessionStopReqType(stream, (struct iso1SessionStopReqType*)value);
+}
+#endif /* ISO1_DEPLOY_SessionStopReq */
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
+static int decode_iso1SessionStopResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SessionStopResType(stream, (struct iso1SessionStopResType*)value);
+}
+#endif /* ISO1_DEPLOY_SessionStopRes */
+static int decode_iso1SignatureMethodTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SignatureMethodType(stream, (struct iso1SignatureMethodType*)value);
+}
+static int decode_iso1SignaturePropertyTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SignaturePropertyType(stream, (struct iso1SignaturePropertyType*)value);
+}
+static int decode_iso1SignatureTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SignatureType(stream, (struct iso1SignatureType*)value);
+}
+static int decode_iso1SignatureValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SignatureValueType(stream, (struct iso1SignatureValueType*)value);
+}
+static int decode_iso1SignedInfoTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SignedInfoType(stream, (struct iso1SignedInfoType*)value);
+}
+static int decode_iso1SubCertificatesTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SubCertificatesType(stream, (struct iso1SubCertificatesType*)value);
+}
+static int decode_iso1SupportedEnergyTransferModeTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1SupportedEnergyTransferModeType(stream, (struct iso1SupportedEnergyTransferModeType*)value);
+}
+static int decode_iso1TransformTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1TransformType(stream, (struct iso1TransformType*)value);
+}
+static int decode_iso1TransformsTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1TransformsType(stream, (struct iso1TransformsType*)value);
+}
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
+static int decode_iso1WeldingDetectionReqTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1WeldingDetectionReqType(stream, (struct iso1WeldingDetectionReqType*)value);
+}
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
+static int decode_iso1WeldingDetectionResTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1WeldingDetectionResType(stream, (struct iso1WeldingDetectionResType*)value);
+}
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
+static int decode_iso1X509DataTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1X509DataType(stream, (struct iso1X509DataType*)value);
+}
+static int decode_iso1X509IssuerSerialTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_iso1X509IssuerSerialType(stream, (struct iso1X509IssuerSerialType*)value);
+}
+#endif /* GRAMMAR_DECODER_TABLE */
+
 /* Deviant data decoding (skip functions) */
 
 
 /* Complex type name='urn:iso:15118:2:2013:MsgHeader,MessageHeaderType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgHeader":SessionID,"urn:iso:15118:2:2013:MsgHeader":Notification{0-1},"http://www.w3.org/2000/09/xmldsig#":Signature{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1MessageHeaderTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1MessageHeaderType, SessionID.bytes), offsetof(struct iso1MessageHeaderType, SessionID.bytesLen), iso1MessageHeaderType_SessionID_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1MessageHeaderType, Notification), 0, 0, 0, decode_iso1NotificationTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1MessageHeaderType, Signature), 0, 0, 0, decode_iso1SignatureTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1MessageHeaderTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 3, 2 }, { 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1MessageHeaderTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 2, 2 }, { 6, 1, 1 }
+};
+static void iso1MessageHeaderTypeUsed(void* value, uint8_t flag) {
+	struct iso1MessageHeaderType* iso1MessageHeaderType = (struct iso1MessageHeaderType*)value;
+	switch(flag) {
+	case 0:
+		iso1MessageHeaderType->Notification_isUsed = 1u;
+		break;
+	case 1:
+		iso1MessageHeaderType->Signature_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1MessageHeaderTypeGrammar = { iso1MessageHeaderTypeStates, iso1MessageHeaderTypeTransitions, iso1MessageHeaderTypeProductions, iso1MessageHeaderTypeUsed };
+
+static int decode_iso1MessageHeaderType(bitstream_t* stream, struct iso1MessageHeaderType* iso1MessageHeaderType) {
+	init_iso1MessageHeaderType(iso1MessageHeaderType);
+	return decodeGrammar(stream, &iso1MessageHeaderTypeGrammar, iso1MessageHeaderType);
+}
+#else
 static int decode_iso1MessageHeaderType(bitstream_t* stream, struct iso1MessageHeaderType* iso1MessageHeaderType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 0;
 	int done = 0;
 	
@@ -217,7 +704,14 @@ static int decode_iso1MessageHeaderType(bitstream_t* stream, struct iso1MessageH
 					grammarID = 2;
 					break;
 				case 1:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, iso1MessageHeaderType->Signature, 1);
+					if (errn == 0) {
+						errn = decode_iso1SignatureType(stream, iso1MessageHeaderType->Signature);
+					}
+#else
 					errn = decode_iso1SignatureType(stream, &iso1MessageHeaderType->Signature);
+#endif /* DATABINDING_SLIM */
 					iso1MessageHeaderType->Signature_isUsed = 1u;
 					grammarID = 3;
 					break;
@@ -237,7 +731,14 @@ static int decode_iso1MessageHeaderType(bitstream_t* stream, struct iso1MessageH
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, iso1MessageHeaderType->Signature, 1);
+					if (errn == 0) {
+						errn = decode_iso1SignatureType(stream, iso1MessageHeaderType->Signature);
+					}
+#else
 					errn = decode_iso1SignatureType(stream, &iso1MessageHeaderType->Signature);
+#endif /* DATABINDING_SLIM */
 					iso1MessageHeaderType->Signature_isUsed = 1u;
 					grammarID = 3;
 					break;
@@ -276,9 +777,46 @@ static int decode_iso1MessageHeaderType(bitstream_t* stream, struct iso1MessageH
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignedInfo,"http://www.w3.org/2000/09/xmldsig#":SignatureValue,"http://www.w3.org/2000/09/xmldsig#":KeyInfo{0-1},"http://www.w3.org/2000/09/xmldsig#":Object{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SignatureTypeProductions[6] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1SignatureType, Id.characters), offsetof(struct iso1SignatureType, Id.charactersLen), iso1SignatureType_Id_CHARACTERS_SIZE, 27 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SignatureType, SignedInfo), 0, 0, 0, decode_iso1SignedInfoTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SignatureType, SignatureValue), 0, 0, 0, decode_iso1SignatureValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1SignatureType, KeyInfo), 0, 0, 0, decode_iso1KeyInfoTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1SignatureType_Object_ARRAY_SIZE, offsetof(struct iso1SignatureType, Object.array), offsetof(struct iso1SignatureType, Object.arrayLen), sizeof(((struct iso1SignatureType*)0)->Object.array[0]), 0, 0, 0, 0, decode_iso1ObjectTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SignatureTypeTransitions[9] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 4 }, { 0, 5 }, { 4, 4 },
+	{ 0, 5 }
+};
+static const exi_grammar_state_t iso1SignatureTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 2, 3 }, { 7, 2, 2 }
+};
+static void iso1SignatureTypeUsed(void* value, uint8_t flag) {
+	struct iso1SignatureType* iso1SignatureType = (struct iso1SignatureType*)value;
+	switch(flag) {
+	case 0:
+		iso1SignatureType->Id_isUsed = 1u;
+		break;
+	case 1:
+		iso1SignatureType->KeyInfo_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1SignatureTypeGrammar = { iso1SignatureTypeStates, iso1SignatureTypeTransitions, iso1SignatureTypeProductions, iso1SignatureTypeUsed };
+
 static int decode_iso1SignatureType(bitstream_t* stream, struct iso1SignatureType* iso1SignatureType) {
+	init_iso1SignatureType(iso1SignatureType);
+	return decodeGrammar(stream, &iso1SignatureTypeGrammar, iso1SignatureType);
+}
+#else
+static int decode_iso1SignatureType(bitstream_t* stream, struct iso1SignatureType* iso1SignatureType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 5;
 	int done = 0;
 	
@@ -296,10 +834,24 @@ static int decode_iso1SignatureType(bitstream_t* stream, struct iso1SignatureTyp
 					if (errn == 0) {
 						if (iso1SignatureType->Id.charactersLen >= 2) {
 							iso1SignatureType->Id.charactersLen = (uint16_t)(iso1SignatureType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignatureType->Id.characters, CHARACTER_UNITS(iso1SignatureType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignatureType->Id.charactersLen, iso1SignatureType->Id.characters, iso1SignatureType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignatureType->Id.charactersLen, iso1SignatureType->Id.characters, iso1SignatureType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 27 /* {}Id */, iso1SignatureType->Id.characters, iso1SignatureType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 27 /* {}Id */, &iso1SignatureType->Id.charactersLen, &iso1SignatureType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 27 /* {}Id */, &iso1SignatureType->Id.charactersLen, iso1SignatureType->Id.characters, iso1SignatureType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1SignatureType->Id_isUsed = 1u;
@@ -351,7 +903,14 @@ static int decode_iso1SignatureType(bitstream_t* stream, struct iso1SignatureTyp
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, iso1SignatureType->KeyInfo, 1);
+					if (errn == 0) {
+						errn = decode_iso1KeyInfoType(stream, iso1SignatureType->KeyInfo);
+					}
+#else
 					errn = decode_iso1KeyInfoType(stream, &iso1SignatureType->KeyInfo);
+#endif /* DATABINDING_SLIM */
 					iso1SignatureType->KeyInfo_isUsed = 1u;
 					grammarID = 9;
 					break;
@@ -406,9 +965,51 @@ static int decode_iso1SignatureType(bitstream_t* stream, struct iso1SignatureTyp
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PowerDeliveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ChargeProgress,"urn:iso:15118:2:2013:MsgBody":SAScheduleTupleID,"urn:iso:15118:2:2013:MsgBody":ChargingProfile{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVPowerDeliveryParameter{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1PowerDeliveryReqTypeProductions[6] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(iso1chargeProgressType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PowerDeliveryReqType, ChargeProgress), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(uint8_t), 1, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PowerDeliveryReqType, SAScheduleTupleID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1PowerDeliveryReqType, ChargingProfile), 0, 0, 0, decode_iso1ChargingProfileTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1PowerDeliveryReqType, DC_EVPowerDeliveryParameter), 0, 0, 0, decode_iso1DC_EVPowerDeliveryParameterTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1PowerDeliveryReqType, EVPowerDeliveryParameter), 0, 0, 0, decode_iso1EVPowerDeliveryParameterTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PowerDeliveryReqTypeTransitions[10] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 4 }, { 0, 5 }, { 4, 3 }, { 4, 4 },
+	{ 0, 5 }, { 0, 5 }
+};
+static const exi_grammar_state_t iso1PowerDeliveryReqTypeStates[5] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 3, 4 }, { 6, 2, 3 }, { 9, 1, 1 }
+};
+static void iso1PowerDeliveryReqTypeUsed(void* value, uint8_t flag) {
+	struct iso1PowerDeliveryReqType* iso1PowerDeliveryReqType = (struct iso1PowerDeliveryReqType*)value;
+	switch(flag) {
+	case 0:
+		iso1PowerDeliveryReqType->ChargingProfile_isUsed = 1u;
+		break;
+	case 1:
+		iso1PowerDeliveryReqType->DC_EVPowerDeliveryParameter_isUsed = 1u;
+		break;
+	case 2:
+		iso1PowerDeliveryReqType->EVPowerDeliveryParameter_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1PowerDeliveryReqTypeGrammar = { iso1PowerDeliveryReqTypeStates, iso1PowerDeliveryReqTypeTransitions, iso1PowerDeliveryReqTypeProductions, iso1PowerDeliveryReqTypeUsed };
+
 static int decode_iso1PowerDeliveryReqType(bitstream_t* stream, struct iso1PowerDeliveryReqType* iso1PowerDeliveryReqType) {
+	init_iso1PowerDeliveryReqType(iso1PowerDeliveryReqType);
+	return decodeGrammar(stream, &iso1PowerDeliveryReqTypeGrammar, iso1PowerDeliveryReqType);
+}
+#else
+static int decode_iso1PowerDeliveryReqType(bitstream_t* stream, struct iso1PowerDeliveryReqType* iso1PowerDeliveryReqType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 10;
 	int done = 0;
 	
@@ -562,9 +1163,61 @@ static int decode_iso1PowerDeliveryReqType(bitstream_t* stream, struct iso1Power
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ParameterType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":boolValue|"urn:iso:15118:2:2013:MsgDataTypes":byteValue|"urn:iso:15118:2:2013:MsgDataTypes":shortValue|"urn:iso:15118:2:2013:MsgDataTypes":intValue|"urn:iso:15118:2:2013:MsgDataTypes":physicalValue|"urn:iso:15118:2:2013:MsgDataTypes":stringValue)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ParameterTypeProductions[8] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ParameterType, Name.characters), offsetof(struct iso1ParameterType, Name.charactersLen), iso1ParameterType_Name_CHARACTERS_SIZE, 20 /* {urn:iso:15118:2:2013:MsgDataTypes}Name */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ParameterType, boolValue), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(int8_t), -128, 1, 0, 0, 0, 0, 0, offsetof(struct iso1ParameterType, byteValue), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1ParameterType, shortValue), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER32, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct iso1ParameterType, intValue), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, offsetof(struct iso1ParameterType, physicalValue), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 5, 0, 0, 0, 0, 0, offsetof(struct iso1ParameterType, stringValue.characters), offsetof(struct iso1ParameterType, stringValue.charactersLen), iso1ParameterType_stringValue_CHARACTERS_SIZE, 24 /* {urn:iso:15118:2:2013:MsgDataTypes}stringValue */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ParameterTypeTransitions[8] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 2, 4 }, { 2, 5 }, { 2, 6 }, { 0, 7 }
+};
+static const exi_grammar_state_t iso1ParameterTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 3, 6 }, { 7, 1, 1 }
+};
+static void iso1ParameterTypeUsed(void* value, uint8_t flag) {
+	struct iso1ParameterType* iso1ParameterType = (struct iso1ParameterType*)value;
+	switch(flag) {
+	case 0:
+		iso1ParameterType->boolValue_isUsed = 1u;
+		break;
+	case 1:
+		iso1ParameterType->byteValue_isUsed = 1u;
+		break;
+	case 2:
+		iso1ParameterType->shortValue_isUsed = 1u;
+		break;
+	case 3:
+		iso1ParameterType->intValue_isUsed = 1u;
+		break;
+	case 4:
+		iso1ParameterType->physicalValue_isUsed = 1u;
+		break;
+	case 5:
+		iso1ParameterType->stringValue_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ParameterTypeGrammar = { iso1ParameterTypeStates, iso1ParameterTypeTransitions, iso1ParameterTypeProductions, iso1ParameterTypeUsed };
+
 static int decode_iso1ParameterType(bitstream_t* stream, struct iso1ParameterType* iso1ParameterType) {
+	init_iso1ParameterType(iso1ParameterType);
+	return decodeGrammar(stream, &iso1ParameterTypeGrammar, iso1ParameterType);
+}
+#else
+static int decode_iso1ParameterType(bitstream_t* stream, struct iso1ParameterType* iso1ParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 14;
 	int done = 0;
 	
@@ -582,10 +1235,24 @@ static int decode_iso1ParameterType(bitstream_t* stream, struct iso1ParameterTyp
 					if (errn == 0) {
 						if (iso1ParameterType->Name.charactersLen >= 2) {
 							iso1ParameterType->Name.charactersLen = (uint16_t)(iso1ParameterType->Name.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterType->Name.characters, CHARACTER_UNITS(iso1ParameterType->Name.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ParameterType->Name.charactersLen, iso1ParameterType->Name.characters, iso1ParameterType_Name_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ParameterType->Name.charactersLen, iso1ParameterType->Name.characters, iso1ParameterType_Name_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 20 /* {urn:iso:15118:2:2013:MsgDataTypes}Name */, iso1ParameterType->Name.characters, iso1ParameterType->Name.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 20 /* {urn:iso:15118:2:2013:MsgDataTypes}Name */, &iso1ParameterType->Name.charactersLen, &iso1ParameterType->Name.characters);
+#else
+							errn = decodeStringValueHit(stream, 20 /* {urn:iso:15118:2:2013:MsgDataTypes}Name */, &iso1ParameterType->Name.charactersLen, iso1ParameterType->Name.characters, iso1ParameterType_Name_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 15;
@@ -704,10 +1371,24 @@ static int decode_iso1ParameterType(bitstream_t* stream, struct iso1ParameterTyp
 							if (errn == 0) {
 								if (iso1ParameterType->stringValue.charactersLen >= 2) {
 									iso1ParameterType->stringValue.charactersLen = (uint16_t)(iso1ParameterType->stringValue.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterType->stringValue.characters, CHARACTER_UNITS(iso1ParameterType->stringValue.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1ParameterType->stringValue.charactersLen, iso1ParameterType->stringValue.characters, iso1ParameterType_stringValue_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1ParameterType->stringValue.charactersLen, iso1ParameterType->stringValue.characters, iso1ParameterType_stringValue_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 24 /* {urn:iso:15118:2:2013:MsgDataTypes}stringValue */, iso1ParameterType->stringValue.characters, iso1ParameterType->stringValue.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 24 /* {urn:iso:15118:2:2013:MsgDataTypes}stringValue */, &iso1ParameterType->stringValue.charactersLen, &iso1ParameterType->stringValue.characters);
+#else
+									errn = decodeStringValueHit(stream, 24 /* {urn:iso:15118:2:2013:MsgDataTypes}stringValue */, &iso1ParameterType->stringValue.charactersLen, iso1ParameterType->stringValue.characters, iso1ParameterType_stringValue_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							iso1ParameterType->stringValue_isUsed = 1u;
@@ -757,9 +1438,33 @@ static int decode_iso1ParameterType(bitstream_t* stream, struct iso1ParameterTyp
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CertificateInstallationReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":OEMProvisioningCert,"urn:iso:15118:2:2013:MsgBody":ListOfRootCertificateIDs)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1CertificateInstallationReqTypeProductions[4] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateInstallationReqType, Id.characters), offsetof(struct iso1CertificateInstallationReqType, Id.charactersLen), iso1CertificateInstallationReqType_Id_CHARACTERS_SIZE, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateInstallationReqType, OEMProvisioningCert.bytes), offsetof(struct iso1CertificateInstallationReqType, OEMProvisioningCert.bytesLen), iso1CertificateInstallationReqType_OEMProvisioningCert_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateInstallationReqType, ListOfRootCertificateIDs), 0, 0, 0, decode_iso1ListOfRootCertificateIDsTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1CertificateInstallationReqTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1CertificateInstallationReqTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t iso1CertificateInstallationReqTypeGrammar = { iso1CertificateInstallationReqTypeStates, iso1CertificateInstallationReqTypeTransitions, iso1CertificateInstallationReqTypeProductions, NULL };
+
+static int decode_iso1CertificateInstallationReqType(bitstream_t* stream, struct iso1CertificateInstallationReqType* iso1CertificateInstallationReqType) {
+	init_iso1CertificateInstallationReqType(iso1CertificateInstallationReqType);
+	return decodeGrammar(stream, &iso1CertificateInstallationReqTypeGrammar, iso1CertificateInstallationReqType);
+}
+#else
 static int decode_iso1CertificateInstallationReqType(bitstream_t* stream, struct iso1CertificateInstallationReqType* iso1CertificateInstallationReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 16;
 	int done = 0;
 	
@@ -777,10 +1482,24 @@ static int decode_iso1CertificateInstallationReqType(bitstream_t* stream, struct
 					if (errn == 0) {
 						if (iso1CertificateInstallationReqType->Id.charactersLen >= 2) {
 							iso1CertificateInstallationReqType->Id.charactersLen = (uint16_t)(iso1CertificateInstallationReqType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1CertificateInstallationReqType->Id.characters, CHARACTER_UNITS(iso1CertificateInstallationReqType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1CertificateInstallationReqType->Id.charactersLen, iso1CertificateInstallationReqType->Id.characters, iso1CertificateInstallationReqType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1CertificateInstallationReqType->Id.charactersLen, iso1CertificateInstallationReqType->Id.characters, iso1CertificateInstallationReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, iso1CertificateInstallationReqType->Id.characters, iso1CertificateInstallationReqType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, &iso1CertificateInstallationReqType->Id.charactersLen, &iso1CertificateInstallationReqType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, &iso1CertificateInstallationReqType->Id.charactersLen, iso1CertificateInstallationReqType->Id.characters, iso1CertificateInstallationReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 17;
@@ -806,7 +1525,14 @@ static int decode_iso1CertificateInstallationReqType(bitstream_t* stream, struct
 								errn =  (iso1CertificateInstallationReqType->OEMProvisioningCert.bytesLen) <= iso1CertificateInstallationReqType_OEMProvisioningCert_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1CertificateInstallationReqType->OEMProvisioningCert.bytes, iso1CertificateInstallationReqType->OEMProvisioningCert.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1CertificateInstallationReqType->OEMProvisioningCert.bytesLen, iso1CertificateInstallationReqType->OEMProvisioningCert.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1CertificateInstallationReqType->OEMProvisioningCert.bytesLen, iso1CertificateInstallationReqType->OEMProvisioningCert.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -869,9 +1595,43 @@ static int decode_iso1CertificateInstallationReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,SessionSetupResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":EVSEID,"urn:iso:15118:2:2013:MsgBody":EVSETimeStamp{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SessionSetupResTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SessionSetupResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SessionSetupResType, EVSEID.characters), offsetof(struct iso1SessionSetupResType, EVSEID.charactersLen), iso1SessionSetupResType_EVSEID_CHARACTERS_SIZE, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER64, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1SessionSetupResType, EVSETimeStamp), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SessionSetupResTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1SessionSetupResTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }
+};
+static void iso1SessionSetupResTypeUsed(void* value, uint8_t flag) {
+	struct iso1SessionSetupResType* iso1SessionSetupResType = (struct iso1SessionSetupResType*)value;
+	switch(flag) {
+	case 0:
+		iso1SessionSetupResType->EVSETimeStamp_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1SessionSetupResTypeGrammar = { iso1SessionSetupResTypeStates, iso1SessionSetupResTypeTransitions, iso1SessionSetupResTypeProductions, iso1SessionSetupResTypeUsed };
+
+static int decode_iso1SessionSetupResType(bitstream_t* stream, struct iso1SessionSetupResType* iso1SessionSetupResType) {
+	init_iso1SessionSetupResType(iso1SessionSetupResType);
+	return decodeGrammar(stream, &iso1SessionSetupResTypeGrammar, iso1SessionSetupResType);
+}
+#else
 static int decode_iso1SessionSetupResType(bitstream_t* stream, struct iso1SessionSetupResType* iso1SessionSetupResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 19;
 	int done = 0;
 	
@@ -926,10 +1686,24 @@ static int decode_iso1SessionSetupResType(bitstream_t* stream, struct iso1Sessio
 							if (errn == 0) {
 								if (iso1SessionSetupResType->EVSEID.charactersLen >= 2) {
 									iso1SessionSetupResType->EVSEID.charactersLen = (uint16_t)(iso1SessionSetupResType->EVSEID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1SessionSetupResType->EVSEID.characters, CHARACTER_UNITS(iso1SessionSetupResType->EVSEID.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1SessionSetupResType->EVSEID.charactersLen, iso1SessionSetupResType->EVSEID.characters, iso1SessionSetupResType_EVSEID_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1SessionSetupResType->EVSEID.charactersLen, iso1SessionSetupResType->EVSEID.characters, iso1SessionSetupResType_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, iso1SessionSetupResType->EVSEID.characters, iso1SessionSetupResType->EVSEID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &iso1SessionSetupResType->EVSEID.charactersLen, &iso1SessionSetupResType->EVSEID.characters);
+#else
+									errn = decodeStringValueHit(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &iso1SessionSetupResType->EVSEID.charactersLen, iso1SessionSetupResType->EVSEID.characters, iso1SessionSetupResType_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -1015,9 +1789,39 @@ static int decode_iso1SessionSetupResType(bitstream_t* stream, struct iso1Sessio
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_SessionSetupRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EVChargeParameterType',  base type name='anyType',  content type='ELEMENT',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":DepartureTime{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1EVChargeParameterTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1EVChargeParameterType, DepartureTime), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1EVChargeParameterTypeTransitions[3] = {
+	{ 1, 0 }, { 0, 1 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1EVChargeParameterTypeStates[2] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }
+};
+static void iso1EVChargeParameterTypeUsed(void* value, uint8_t flag) {
+	struct iso1EVChargeParameterType* iso1EVChargeParameterType = (struct iso1EVChargeParameterType*)value;
+	switch(flag) {
+	case 0:
+		iso1EVChargeParameterType->DepartureTime_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1EVChargeParameterTypeGrammar = { iso1EVChargeParameterTypeStates, iso1EVChargeParameterTypeTransitions, iso1EVChargeParameterTypeProductions, iso1EVChargeParameterTypeUsed };
+
+static int decode_iso1EVChargeParameterType(bitstream_t* stream, struct iso1EVChargeParameterType* iso1EVChargeParameterType) {
+	init_iso1EVChargeParameterType(iso1EVChargeParameterType);
+	return decodeGrammar(stream, &iso1EVChargeParameterTypeGrammar, iso1EVChargeParameterType);
+}
+#else
 static int decode_iso1EVChargeParameterType(bitstream_t* stream, struct iso1EVChargeParameterType* iso1EVChargeParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 22;
 	int done = 0;
 	
@@ -1087,9 +1891,31 @@ static int decode_iso1EVChargeParameterType(bitstream_t* stream, struct iso1EVCh
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DiffieHellmanPublickeyType',  base type name='dHpublickeyType',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1DiffieHellmanPublickeyTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DiffieHellmanPublickeyType, Id.characters), offsetof(struct iso1DiffieHellmanPublickeyType, Id.charactersLen), iso1DiffieHellmanPublickeyType_Id_CHARACTERS_SIZE, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DiffieHellmanPublickeyType, CONTENT.bytes), offsetof(struct iso1DiffieHellmanPublickeyType, CONTENT.bytesLen), iso1DiffieHellmanPublickeyType_CONTENT_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1DiffieHellmanPublickeyTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1DiffieHellmanPublickeyTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t iso1DiffieHellmanPublickeyTypeGrammar = { iso1DiffieHellmanPublickeyTypeStates, iso1DiffieHellmanPublickeyTypeTransitions, iso1DiffieHellmanPublickeyTypeProductions, NULL };
+
+static int decode_iso1DiffieHellmanPublickeyType(bitstream_t* stream, struct iso1DiffieHellmanPublickeyType* iso1DiffieHellmanPublickeyType) {
+	init_iso1DiffieHellmanPublickeyType(iso1DiffieHellmanPublickeyType);
+	return decodeGrammar(stream, &iso1DiffieHellmanPublickeyTypeGrammar, iso1DiffieHellmanPublickeyType);
+}
+#else
 static int decode_iso1DiffieHellmanPublickeyType(bitstream_t* stream, struct iso1DiffieHellmanPublickeyType* iso1DiffieHellmanPublickeyType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 23;
 	int done = 0;
 	
@@ -1107,10 +1933,24 @@ static int decode_iso1DiffieHellmanPublickeyType(bitstream_t* stream, struct iso
 					if (errn == 0) {
 						if (iso1DiffieHellmanPublickeyType->Id.charactersLen >= 2) {
 							iso1DiffieHellmanPublickeyType->Id.charactersLen = (uint16_t)(iso1DiffieHellmanPublickeyType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1DiffieHellmanPublickeyType->Id.characters, CHARACTER_UNITS(iso1DiffieHellmanPublickeyType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1DiffieHellmanPublickeyType->Id.charactersLen, iso1DiffieHellmanPublickeyType->Id.characters, iso1DiffieHellmanPublickeyType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1DiffieHellmanPublickeyType->Id.charactersLen, iso1DiffieHellmanPublickeyType->Id.characters, iso1DiffieHellmanPublickeyType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, iso1DiffieHellmanPublickeyType->Id.characters, iso1DiffieHellmanPublickeyType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, &iso1DiffieHellmanPublickeyType->Id.charactersLen, &iso1DiffieHellmanPublickeyType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, &iso1DiffieHellmanPublickeyType->Id.charactersLen, iso1DiffieHellmanPublickeyType->Id.characters, iso1DiffieHellmanPublickeyType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 24;
@@ -1132,7 +1972,14 @@ static int decode_iso1DiffieHellmanPublickeyType(bitstream_t* stream, struct iso
 						errn =  (iso1DiffieHellmanPublickeyType->CONTENT.bytesLen) <= iso1DiffieHellmanPublickeyType_CONTENT_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 					}
 					if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+						errn = EXI_ARENA_ALLOCATE(stream, iso1DiffieHellmanPublickeyType->CONTENT.bytes, iso1DiffieHellmanPublickeyType->CONTENT.bytesLen);
+						if (errn == 0) {
+							errn = decodeBytes(stream, iso1DiffieHellmanPublickeyType->CONTENT.bytesLen, iso1DiffieHellmanPublickeyType->CONTENT.bytes);
+						}
+#else
 						errn = decodeBytes(stream, iso1DiffieHellmanPublickeyType->CONTENT.bytesLen, iso1DiffieHellmanPublickeyType->CONTENT.bytes);
+#endif /* DATABINDING_SLIM */
 					}
 					grammarID = 3;
 					break;
@@ -1167,9 +2014,43 @@ static int decode_iso1DiffieHellmanPublickeyType(bitstream_t* stream, struct iso
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ServiceDiscoveryResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":PaymentOptionList,"urn:iso:15118:2:2013:MsgBody":ChargeService,"urn:iso:15118:2:2013:MsgBody":ServiceList{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1ServiceDiscoveryResTypeProductions[5] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceDiscoveryResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceDiscoveryResType, PaymentOptionList), 0, 0, 0, decode_iso1PaymentOptionListTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceDiscoveryResType, ChargeService), 0, 0, 0, decode_iso1ChargeServiceTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceDiscoveryResType, ServiceList), 0, 0, 0, decode_iso1ServiceListTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ServiceDiscoveryResTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 0, 4 }, { 0, 4 }
+};
+static const exi_grammar_state_t iso1ServiceDiscoveryResTypeStates[5] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 2, 2 }, { 5, 1, 1 }
+};
+static void iso1ServiceDiscoveryResTypeUsed(void* value, uint8_t flag) {
+	struct iso1ServiceDiscoveryResType* iso1ServiceDiscoveryResType = (struct iso1ServiceDiscoveryResType*)value;
+	switch(flag) {
+	case 0:
+		iso1ServiceDiscoveryResType->ServiceList_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ServiceDiscoveryResTypeGrammar = { iso1ServiceDiscoveryResTypeStates, iso1ServiceDiscoveryResTypeTransitions, iso1ServiceDiscoveryResTypeProductions, iso1ServiceDiscoveryResTypeUsed };
+
 static int decode_iso1ServiceDiscoveryResType(bitstream_t* stream, struct iso1ServiceDiscoveryResType* iso1ServiceDiscoveryResType) {
+	init_iso1ServiceDiscoveryResType(iso1ServiceDiscoveryResType);
+	return decodeGrammar(stream, &iso1ServiceDiscoveryResTypeGrammar, iso1ServiceDiscoveryResType);
+}
+#else
+static int decode_iso1ServiceDiscoveryResType(bitstream_t* stream, struct iso1ServiceDiscoveryResType* iso1ServiceDiscoveryResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 25;
 	int done = 0;
 	
@@ -1285,9 +2166,31 @@ static int decode_iso1ServiceDiscoveryResType(bitstream_t* stream, struct iso1Se
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ServiceParameterListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ParameterSet{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1ServiceParameterListTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1ServiceParameterListType_ParameterSet_ARRAY_SIZE, offsetof(struct iso1ServiceParameterListType, ParameterSet.array), offsetof(struct iso1ServiceParameterListType, ParameterSet.arrayLen), sizeof(((struct iso1ServiceParameterListType*)0)->ParameterSet.array[0]), 0, 0, 0, 0, decode_iso1ParameterSetTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ServiceParameterListTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1ServiceParameterListTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t iso1ServiceParameterListTypeGrammar = { iso1ServiceParameterListTypeStates, iso1ServiceParameterListTypeTransitions, iso1ServiceParameterListTypeProductions, NULL };
+
+static int decode_iso1ServiceParameterListType(bitstream_t* stream, struct iso1ServiceParameterListType* iso1ServiceParameterListType) {
+	init_iso1ServiceParameterListType(iso1ServiceParameterListType);
+	return decodeGrammar(stream, &iso1ServiceParameterListTypeGrammar, iso1ServiceParameterListType);
+}
+#else
 static int decode_iso1ServiceParameterListType(bitstream_t* stream, struct iso1ServiceParameterListType* iso1ServiceParameterListType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 29;
 	int done = 0;
 	
@@ -1347,9 +2250,43 @@ static int decode_iso1ServiceParameterListType(bitstream_t* stream, struct iso1S
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,CertificateChainType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":Certificate,"urn:iso:15118:2:2013:MsgDataTypes":SubCertificates{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1CertificateChainTypeProductions[4] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateChainType, Id.characters), offsetof(struct iso1CertificateChainType, Id.charactersLen), iso1CertificateChainType_Id_CHARACTERS_SIZE, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateChainType, Certificate.bytes), offsetof(struct iso1CertificateChainType, Certificate.bytesLen), iso1CertificateChainType_Certificate_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateChainType, SubCertificates), 0, 0, 0, decode_iso1SubCertificatesTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1CertificateChainTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1CertificateChainTypeStates[4] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }, { 5, 1, 1 }
+};
+static void iso1CertificateChainTypeUsed(void* value, uint8_t flag) {
+	struct iso1CertificateChainType* iso1CertificateChainType = (struct iso1CertificateChainType*)value;
+	switch(flag) {
+	case 0:
+		iso1CertificateChainType->Id_isUsed = 1u;
+		break;
+	case 1:
+		iso1CertificateChainType->SubCertificates_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1CertificateChainTypeGrammar = { iso1CertificateChainTypeStates, iso1CertificateChainTypeTransitions, iso1CertificateChainTypeProductions, iso1CertificateChainTypeUsed };
+
 static int decode_iso1CertificateChainType(bitstream_t* stream, struct iso1CertificateChainType* iso1CertificateChainType) {
+	init_iso1CertificateChainType(iso1CertificateChainType);
+	return decodeGrammar(stream, &iso1CertificateChainTypeGrammar, iso1CertificateChainType);
+}
+#else
+static int decode_iso1CertificateChainType(bitstream_t* stream, struct iso1CertificateChainType* iso1CertificateChainType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 31;
 	int done = 0;
 	
@@ -1367,10 +2304,24 @@ static int decode_iso1CertificateChainType(bitstream_t* stream, struct iso1Certi
 					if (errn == 0) {
 						if (iso1CertificateChainType->Id.charactersLen >= 2) {
 							iso1CertificateChainType->Id.charactersLen = (uint16_t)(iso1CertificateChainType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1CertificateChainType->Id.characters, CHARACTER_UNITS(iso1CertificateChainType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1CertificateChainType->Id.charactersLen, iso1CertificateChainType->Id.characters, iso1CertificateChainType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1CertificateChainType->Id.charactersLen, iso1CertificateChainType->Id.characters, iso1CertificateChainType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, iso1CertificateChainType->Id.characters, iso1CertificateChainType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, &iso1CertificateChainType->Id.charactersLen, &iso1CertificateChainType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, &iso1CertificateChainType->Id.charactersLen, iso1CertificateChainType->Id.characters, iso1CertificateChainType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1CertificateChainType->Id_isUsed = 1u;
@@ -1386,7 +2337,14 @@ static int decode_iso1CertificateChainType(bitstream_t* stream, struct iso1Certi
 								errn =  (iso1CertificateChainType->Certificate.bytesLen) <= iso1CertificateChainType_Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1CertificateChainType->Certificate.bytes, iso1CertificateChainType->Certificate.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1CertificateChainType->Certificate.bytesLen, iso1CertificateChainType->Certificate.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1CertificateChainType->Certificate.bytesLen, iso1CertificateChainType->Certificate.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -1424,7 +2382,14 @@ static int decode_iso1CertificateChainType(bitstream_t* stream, struct iso1Certi
 								errn =  (iso1CertificateChainType->Certificate.bytesLen) <= iso1CertificateChainType_Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1CertificateChainType->Certificate.bytes, iso1CertificateChainType->Certificate.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1CertificateChainType->Certificate.bytesLen, iso1CertificateChainType->Certificate.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1CertificateChainType->Certificate.bytesLen, iso1CertificateChainType->Certificate.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -1492,9 +2457,29 @@ static int decode_iso1CertificateChainType(bitstream_t* stream, struct iso1Certi
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SASchedulesType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1SASchedulesTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SASchedulesTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t iso1SASchedulesTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t iso1SASchedulesTypeGrammar = { iso1SASchedulesTypeStates, iso1SASchedulesTypeTransitions, iso1SASchedulesTypeProductions, NULL };
+
 static int decode_iso1SASchedulesType(bitstream_t* stream, struct iso1SASchedulesType* iso1SASchedulesType) {
+	init_iso1SASchedulesType(iso1SASchedulesType);
+	return decodeGrammar(stream, &iso1SASchedulesTypeGrammar, iso1SASchedulesType);
+}
+#else
+static int decode_iso1SASchedulesType(bitstream_t* stream, struct iso1SASchedulesType* iso1SASchedulesType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -1527,9 +2512,42 @@ static int decode_iso1SASchedulesType(bitstream_t* stream, struct iso1SASchedule
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DC_EVSEStatusType',  base type name='EVSEStatusType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":NotificationMaxDelay,"urn:iso:15118:2:2013:MsgDataTypes":EVSENotification),("urn:iso:15118:2:2013:MsgDataTypes":EVSEIsolationStatus{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVSEStatusCode))',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1DC_EVSEStatusTypeProductions[5] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEStatusType, NotificationMaxDelay), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(iso1EVSENotificationType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEStatusType, EVSENotification), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 3, sizeof(iso1isolationLevelType), 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEStatusType, EVSEIsolationStatus), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 4, sizeof(iso1DC_EVSEStatusCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEStatusType, EVSEStatusCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1DC_EVSEStatusTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t iso1DC_EVSEStatusTypeStates[5] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }, { 5, 1, 1 }
+};
+static void iso1DC_EVSEStatusTypeUsed(void* value, uint8_t flag) {
+	struct iso1DC_EVSEStatusType* iso1DC_EVSEStatusType = (struct iso1DC_EVSEStatusType*)value;
+	switch(flag) {
+	case 0:
+		iso1DC_EVSEStatusType->EVSEIsolationStatus_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1DC_EVSEStatusTypeGrammar = { iso1DC_EVSEStatusTypeStates, iso1DC_EVSEStatusTypeTransitions, iso1DC_EVSEStatusTypeProductions, iso1DC_EVSEStatusTypeUsed };
+
+static int decode_iso1DC_EVSEStatusType(bitstream_t* stream, struct iso1DC_EVSEStatusType* iso1DC_EVSEStatusType) {
+	init_iso1DC_EVSEStatusType(iso1DC_EVSEStatusType);
+	return decodeGrammar(stream, &iso1DC_EVSEStatusTypeGrammar, iso1DC_EVSEStatusType);
+}
+#else
 static int decode_iso1DC_EVSEStatusType(bitstream_t* stream, struct iso1DC_EVSEStatusType* iso1DC_EVSEStatusType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 35;
 	int done = 0;
 	
@@ -1716,9 +2734,34 @@ static int decode_iso1DC_EVSEStatusType(bitstream_t* stream, struct iso1DC_EVSES
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PreChargeResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2013:MsgBody":EVSEPresentVoltage)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1PreChargeResTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PreChargeResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PreChargeResType, DC_EVSEStatus), 0, 0, 0, decode_iso1DC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PreChargeResType, EVSEPresentVoltage), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PreChargeResTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1PreChargeResTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t iso1PreChargeResTypeGrammar = { iso1PreChargeResTypeStates, iso1PreChargeResTypeTransitions, iso1PreChargeResTypeProductions, NULL };
+
 static int decode_iso1PreChargeResType(bitstream_t* stream, struct iso1PreChargeResType* iso1PreChargeResType) {
+	init_iso1PreChargeResType(iso1PreChargeResType);
+	return decodeGrammar(stream, &iso1PreChargeResTypeGrammar, iso1PreChargeResType);
+}
+#else
+static int decode_iso1PreChargeResType(bitstream_t* stream, struct iso1PreChargeResType* iso1PreChargeResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 39;
 	int done = 0;
 	
@@ -1814,9 +2857,38 @@ static int decode_iso1PreChargeResType(bitstream_t* stream, struct iso1PreCharge
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_PreChargeRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ParameterSetType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ParameterSetID,"urn:iso:15118:2:2013:MsgDataTypes":Parameter{1-16})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ParameterSetTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ParameterSetType, ParameterSetID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1ParameterSetType_Parameter_ARRAY_SIZE, offsetof(struct iso1ParameterSetType, Parameter.array), offsetof(struct iso1ParameterSetType, Parameter.arrayLen), sizeof(((struct iso1ParameterSetType*)0)->Parameter.array[0]), 0, 0, 0, 0, decode_iso1ParameterTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ParameterSetTypeTransitions[33] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 1 }, { 0, 2 }, { 4, 1 }, { 0, 2 }, { 5, 1 }, { 0, 2 },
+	{ 6, 1 }, { 0, 2 }, { 7, 1 }, { 0, 2 }, { 8, 1 }, { 0, 2 }, { 9, 1 }, { 0, 2 },
+	{ 10, 1 }, { 0, 2 }, { 11, 1 }, { 0, 2 }, { 12, 1 }, { 0, 2 }, { 13, 1 }, { 0, 2 },
+	{ 14, 1 }, { 0, 2 }, { 15, 1 }, { 0, 2 }, { 16, 1 }, { 0, 2 }, { 17, 1 }, { 0, 2 },
+	{ 0, 2 }
+};
+static const exi_grammar_state_t iso1ParameterSetTypeStates[18] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 2, 2 }, { 6, 2, 2 }, { 8, 2, 2 }, { 10, 2, 2 }, { 12, 2, 2 },
+	{ 14, 2, 2 }, { 16, 2, 2 }, { 18, 2, 2 }, { 20, 2, 2 }, { 22, 2, 2 }, { 24, 2, 2 }, { 26, 2, 2 }, { 28, 2, 2 },
+	{ 30, 2, 2 }, { 32, 1, 1 }
+};
+static const exi_grammar_t iso1ParameterSetTypeGrammar = { iso1ParameterSetTypeStates, iso1ParameterSetTypeTransitions, iso1ParameterSetTypeProductions, NULL };
+
 static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1ParameterSetType* iso1ParameterSetType) {
+	init_iso1ParameterSetType(iso1ParameterSetType);
+	return decodeGrammar(stream, &iso1ParameterSetTypeGrammar, iso1ParameterSetType);
+}
+#else
+static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1ParameterSetType* iso1ParameterSetType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 42;
 	int done = 0;
 	
@@ -1862,7 +2934,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -1881,7 +2962,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -1904,7 +2994,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -1927,7 +3026,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -1950,7 +3058,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -1973,7 +3090,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -1996,7 +3122,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2019,7 +3154,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2042,7 +3186,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2065,7 +3218,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2088,7 +3250,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2111,7 +3282,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2134,7 +3314,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2157,7 +3346,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2180,7 +3378,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2203,7 +3410,16 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ParameterSetType->Parameter.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ParameterSetType->Parameter.array, iso1ParameterSetType_Parameter_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#else
 					if (iso1ParameterSetType->Parameter.arrayLen < iso1ParameterSetType_Parameter_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ParameterType(stream, &iso1ParameterSetType->Parameter.array[iso1ParameterSetType->Parameter.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2245,9 +3461,31 @@ static int decode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ServiceDetailReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ServiceID)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1ServiceDetailReqTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceDetailReqType, ServiceID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ServiceDetailReqTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1ServiceDetailReqTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t iso1ServiceDetailReqTypeGrammar = { iso1ServiceDetailReqTypeStates, iso1ServiceDetailReqTypeTransitions, iso1ServiceDetailReqTypeProductions, NULL };
+
+static int decode_iso1ServiceDetailReqType(bitstream_t* stream, struct iso1ServiceDetailReqType* iso1ServiceDetailReqType) {
+	init_iso1ServiceDetailReqType(iso1ServiceDetailReqType);
+	return decodeGrammar(stream, &iso1ServiceDetailReqTypeGrammar, iso1ServiceDetailReqType);
+}
+#else
 static int decode_iso1ServiceDetailReqType(bitstream_t* stream, struct iso1ServiceDetailReqType* iso1ServiceDetailReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 59;
 	int done = 0;
 	
@@ -2312,9 +3550,40 @@ static int decode_iso1ServiceDetailReqType(bitstream_t* stream, struct iso1Servi
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,RelativeTimeIntervalType',  base type name='IntervalType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":start,"urn:iso:15118:2:2013:MsgDataTypes":duration{0-1})',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1RelativeTimeIntervalTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1RelativeTimeIntervalType, start), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1RelativeTimeIntervalType, duration), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1RelativeTimeIntervalTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1RelativeTimeIntervalTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }
+};
+static void iso1RelativeTimeIntervalTypeUsed(void* value, uint8_t flag) {
+	struct iso1RelativeTimeIntervalType* iso1RelativeTimeIntervalType = (struct iso1RelativeTimeIntervalType*)value;
+	switch(flag) {
+	case 0:
+		iso1RelativeTimeIntervalType->duration_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1RelativeTimeIntervalTypeGrammar = { iso1RelativeTimeIntervalTypeStates, iso1RelativeTimeIntervalTypeTransitions, iso1RelativeTimeIntervalTypeProductions, iso1RelativeTimeIntervalTypeUsed };
+
 static int decode_iso1RelativeTimeIntervalType(bitstream_t* stream, struct iso1RelativeTimeIntervalType* iso1RelativeTimeIntervalType) {
+	init_iso1RelativeTimeIntervalType(iso1RelativeTimeIntervalType);
+	return decodeGrammar(stream, &iso1RelativeTimeIntervalTypeGrammar, iso1RelativeTimeIntervalType);
+}
+#else
+static int decode_iso1RelativeTimeIntervalType(bitstream_t* stream, struct iso1RelativeTimeIntervalType* iso1RelativeTimeIntervalType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 60;
 	int done = 0;
 	
@@ -2416,9 +3685,41 @@ static int decode_iso1RelativeTimeIntervalType(bitstream_t* stream, struct iso1R
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignedInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":CanonicalizationMethod,"http://www.w3.org/2000/09/xmldsig#":SignatureMethod,"http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SignedInfoTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1SignedInfoType, Id.characters), offsetof(struct iso1SignedInfoType, Id.charactersLen), iso1SignedInfoType_Id_CHARACTERS_SIZE, 27 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SignedInfoType, CanonicalizationMethod), 0, 0, 0, decode_iso1CanonicalizationMethodTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SignedInfoType, SignatureMethod), 0, 0, 0, decode_iso1SignatureMethodTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1SignedInfoType_Reference_ARRAY_SIZE, offsetof(struct iso1SignedInfoType, Reference.array), offsetof(struct iso1SignedInfoType, Reference.arrayLen), sizeof(((struct iso1SignedInfoType*)0)->Reference.array[0]), 0, 0, 0, 0, decode_iso1ReferenceTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SignedInfoTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t iso1SignedInfoTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 2, 2 }
+};
+static void iso1SignedInfoTypeUsed(void* value, uint8_t flag) {
+	struct iso1SignedInfoType* iso1SignedInfoType = (struct iso1SignedInfoType*)value;
+	switch(flag) {
+	case 0:
+		iso1SignedInfoType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1SignedInfoTypeGrammar = { iso1SignedInfoTypeStates, iso1SignedInfoTypeTransitions, iso1SignedInfoTypeProductions, iso1SignedInfoTypeUsed };
+
+static int decode_iso1SignedInfoType(bitstream_t* stream, struct iso1SignedInfoType* iso1SignedInfoType) {
+	init_iso1SignedInfoType(iso1SignedInfoType);
+	return decodeGrammar(stream, &iso1SignedInfoTypeGrammar, iso1SignedInfoType);
+}
+#else
 static int decode_iso1SignedInfoType(bitstream_t* stream, struct iso1SignedInfoType* iso1SignedInfoType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 62;
 	int done = 0;
 	
@@ -2436,10 +3737,24 @@ static int decode_iso1SignedInfoType(bitstream_t* stream, struct iso1SignedInfoT
 					if (errn == 0) {
 						if (iso1SignedInfoType->Id.charactersLen >= 2) {
 							iso1SignedInfoType->Id.charactersLen = (uint16_t)(iso1SignedInfoType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignedInfoType->Id.characters, CHARACTER_UNITS(iso1SignedInfoType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignedInfoType->Id.charactersLen, iso1SignedInfoType->Id.characters, iso1SignedInfoType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignedInfoType->Id.charactersLen, iso1SignedInfoType->Id.characters, iso1SignedInfoType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 27 /* {}Id */, iso1SignedInfoType->Id.characters, iso1SignedInfoType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 27 /* {}Id */, &iso1SignedInfoType->Id.charactersLen, &iso1SignedInfoType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 27 /* {}Id */, &iso1SignedInfoType->Id.charactersLen, iso1SignedInfoType->Id.characters, iso1SignedInfoType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1SignedInfoType->Id_isUsed = 1u;
@@ -2491,7 +3806,16 @@ static int decode_iso1SignedInfoType(bitstream_t* stream, struct iso1SignedInfoT
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SignedInfoType->Reference.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SignedInfoType->Reference.array, iso1SignedInfoType_Reference_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SignedInfoType->Reference.arrayLen < iso1SignedInfoType_Reference_ARRAY_SIZE) {
+#else
 					if (iso1SignedInfoType->Reference.arrayLen < iso1SignedInfoType_Reference_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ReferenceType(stream, &iso1SignedInfoType->Reference.array[iso1SignedInfoType->Reference.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2510,7 +3834,16 @@ static int decode_iso1SignedInfoType(bitstream_t* stream, struct iso1SignedInfoT
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SignedInfoType->Reference.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SignedInfoType->Reference.array, iso1SignedInfoType_Reference_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SignedInfoType->Reference.arrayLen < iso1SignedInfoType_Reference_ARRAY_SIZE) {
+#else
 					if (iso1SignedInfoType->Reference.arrayLen < iso1SignedInfoType_Reference_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ReferenceType(stream, &iso1SignedInfoType->Reference.array[iso1SignedInfoType->Reference.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2537,9 +3870,31 @@ static int decode_iso1SignedInfoType(bitstream_t* stream, struct iso1SignedInfoT
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EMAIDType',  base type name='eMAIDType',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1EMAIDTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1EMAIDType, Id.characters), offsetof(struct iso1EMAIDType, Id.charactersLen), iso1EMAIDType_Id_CHARACTERS_SIZE, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1EMAIDType, CONTENT.characters), offsetof(struct iso1EMAIDType, CONTENT.charactersLen), iso1EMAIDType_CONTENT_CHARACTERS_SIZE, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1EMAIDTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1EMAIDTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t iso1EMAIDTypeGrammar = { iso1EMAIDTypeStates, iso1EMAIDTypeTransitions, iso1EMAIDTypeProductions, NULL };
+
 static int decode_iso1EMAIDType(bitstream_t* stream, struct iso1EMAIDType* iso1EMAIDType) {
+	init_iso1EMAIDType(iso1EMAIDType);
+	return decodeGrammar(stream, &iso1EMAIDTypeGrammar, iso1EMAIDType);
+}
+#else
+static int decode_iso1EMAIDType(bitstream_t* stream, struct iso1EMAIDType* iso1EMAIDType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 67;
 	int done = 0;
 	
@@ -2557,10 +3912,24 @@ static int decode_iso1EMAIDType(bitstream_t* stream, struct iso1EMAIDType* iso1E
 					if (errn == 0) {
 						if (iso1EMAIDType->Id.charactersLen >= 2) {
 							iso1EMAIDType->Id.charactersLen = (uint16_t)(iso1EMAIDType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1EMAIDType->Id.characters, CHARACTER_UNITS(iso1EMAIDType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1EMAIDType->Id.charactersLen, iso1EMAIDType->Id.characters, iso1EMAIDType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1EMAIDType->Id.charactersLen, iso1EMAIDType->Id.characters, iso1EMAIDType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, iso1EMAIDType->Id.characters, iso1EMAIDType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, &iso1EMAIDType->Id.charactersLen, &iso1EMAIDType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, &iso1EMAIDType->Id.charactersLen, iso1EMAIDType->Id.characters, iso1EMAIDType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 68;
@@ -2581,10 +3950,24 @@ static int decode_iso1EMAIDType(bitstream_t* stream, struct iso1EMAIDType* iso1E
 					if (errn == 0) {
 						if (iso1EMAIDType->CONTENT.charactersLen >= 2) {
 							iso1EMAIDType->CONTENT.charactersLen = (uint16_t)(iso1EMAIDType->CONTENT.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1EMAIDType->CONTENT.characters, CHARACTER_UNITS(iso1EMAIDType->CONTENT.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1EMAIDType->CONTENT.charactersLen, iso1EMAIDType->CONTENT.characters, iso1EMAIDType_CONTENT_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1EMAIDType->CONTENT.charactersLen, iso1EMAIDType->CONTENT.characters, iso1EMAIDType_CONTENT_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, iso1EMAIDType->CONTENT.characters, iso1EMAIDType->CONTENT.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, &iso1EMAIDType->CONTENT.charactersLen, &iso1EMAIDType->CONTENT.characters);
+#else
+							errn = decodeStringValueHit(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, &iso1EMAIDType->CONTENT.charactersLen, iso1EMAIDType->CONTENT.characters, iso1EMAIDType_CONTENT_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 3;
@@ -2620,9 +4003,30 @@ static int decode_iso1EMAIDType(bitstream_t* stream, struct iso1EMAIDType* iso1E
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EVStatusType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if ISO1_DEPLOY_EVStatus == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1EVStatusTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1EVStatusTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t iso1EVStatusTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t iso1EVStatusTypeGrammar = { iso1EVStatusTypeStates, iso1EVStatusTypeTransitions, iso1EVStatusTypeProductions, NULL };
+
+static int decode_iso1EVStatusType(bitstream_t* stream, struct iso1EVStatusType* iso1EVStatusType) {
+	init_iso1EVStatusType(iso1EVStatusType);
+	return decodeGrammar(stream, &iso1EVStatusTypeGrammar, iso1EVStatusType);
+}
+#else
 static int decode_iso1EVStatusType(bitstream_t* stream, struct iso1EVStatusType* iso1EVStatusType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -2655,9 +4059,33 @@ static int decode_iso1EVStatusType(bitstream_t* stream, struct iso1EVStatusType*
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_EVStatus */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ServiceListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":Service{1-8})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ServiceListTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1ServiceListType_Service_ARRAY_SIZE, offsetof(struct iso1ServiceListType, Service.array), offsetof(struct iso1ServiceListType, Service.arrayLen), sizeof(((struct iso1ServiceListType*)0)->Service.array[0]), 0, 0, 0, 0, decode_iso1ServiceTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ServiceListTypeTransitions[16] = {
+	{ 1, 0 }, { 2, 0 }, { 0, 1 }, { 3, 0 }, { 0, 1 }, { 4, 0 }, { 0, 1 }, { 5, 0 },
+	{ 0, 1 }, { 6, 0 }, { 0, 1 }, { 7, 0 }, { 0, 1 }, { 8, 0 }, { 0, 1 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1ServiceListTypeStates[9] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 2, 2 }, { 5, 2, 2 }, { 7, 2, 2 }, { 9, 2, 2 }, { 11, 2, 2 }, { 13, 2, 2 },
+	{ 15, 1, 1 }
+};
+static const exi_grammar_t iso1ServiceListTypeGrammar = { iso1ServiceListTypeStates, iso1ServiceListTypeTransitions, iso1ServiceListTypeProductions, NULL };
+
+static int decode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceListType* iso1ServiceListType) {
+	init_iso1ServiceListType(iso1ServiceListType);
+	return decodeGrammar(stream, &iso1ServiceListTypeGrammar, iso1ServiceListType);
+}
+#else
 static int decode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceListType* iso1ServiceListType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 69;
 	int done = 0;
 	
@@ -2671,7 +4099,16 @@ static int decode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceLis
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ServiceListType->Service.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ServiceListType->Service.array, iso1ServiceListType_Service_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#else
 					if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ServiceType(stream, &iso1ServiceListType->Service.array[iso1ServiceListType->Service.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2690,7 +4127,16 @@ static int decode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceLis
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ServiceListType->Service.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ServiceListType->Service.array, iso1ServiceListType_Service_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#else
 					if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ServiceType(stream, &iso1ServiceListType->Service.array[iso1ServiceListType->Service.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2713,7 +4159,16 @@ static int decode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceLis
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ServiceListType->Service.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ServiceListType->Service.array, iso1ServiceListType_Service_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#else
 					if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ServiceType(stream, &iso1ServiceListType->Service.array[iso1ServiceListType->Service.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2736,7 +4191,16 @@ static int decode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceLis
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ServiceListType->Service.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ServiceListType->Service.array, iso1ServiceListType_Service_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#else
 					if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ServiceType(stream, &iso1ServiceListType->Service.array[iso1ServiceListType->Service.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2759,7 +4223,16 @@ static int decode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceLis
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ServiceListType->Service.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ServiceListType->Service.array, iso1ServiceListType_Service_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#else
 					if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ServiceType(stream, &iso1ServiceListType->Service.array[iso1ServiceListType->Service.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2782,7 +4255,16 @@ static int decode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceLis
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ServiceListType->Service.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ServiceListType->Service.array, iso1ServiceListType_Service_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#else
 					if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ServiceType(stream, &iso1ServiceListType->Service.array[iso1ServiceListType->Service.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2805,7 +4287,16 @@ static int decode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceLis
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ServiceListType->Service.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ServiceListType->Service.array, iso1ServiceListType_Service_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#else
 					if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ServiceType(stream, &iso1ServiceListType->Service.array[iso1ServiceListType->Service.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2828,7 +4319,16 @@ static int decode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceLis
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ServiceListType->Service.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ServiceListType->Service.array, iso1ServiceListType_Service_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#else
 					if (iso1ServiceListType->Service.arrayLen < iso1ServiceListType_Service_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ServiceType(stream, &iso1ServiceListType->Service.array[iso1ServiceListType->Service.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -2870,9 +4370,29 @@ static int decode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceLis
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EVSEChargeParameterType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1EVSEChargeParameterTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1EVSEChargeParameterTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t iso1EVSEChargeParameterTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t iso1EVSEChargeParameterTypeGrammar = { iso1EVSEChargeParameterTypeStates, iso1EVSEChargeParameterTypeTransitions, iso1EVSEChargeParameterTypeProductions, NULL };
+
 static int decode_iso1EVSEChargeParameterType(bitstream_t* stream, struct iso1EVSEChargeParameterType* iso1EVSEChargeParameterType) {
+	init_iso1EVSEChargeParameterType(iso1EVSEChargeParameterType);
+	return decodeGrammar(stream, &iso1EVSEChargeParameterTypeGrammar, iso1EVSEChargeParameterType);
+}
+#else
+static int decode_iso1EVSEChargeParameterType(bitstream_t* stream, struct iso1EVSEChargeParameterType* iso1EVSEChargeParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -2905,9 +4425,29 @@ static int decode_iso1EVSEChargeParameterType(bitstream_t* stream, struct iso1EV
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EVPowerDeliveryParameterType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1EVPowerDeliveryParameterTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1EVPowerDeliveryParameterTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t iso1EVPowerDeliveryParameterTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t iso1EVPowerDeliveryParameterTypeGrammar = { iso1EVPowerDeliveryParameterTypeStates, iso1EVPowerDeliveryParameterTypeTransitions, iso1EVPowerDeliveryParameterTypeProductions, NULL };
+
+static int decode_iso1EVPowerDeliveryParameterType(bitstream_t* stream, struct iso1EVPowerDeliveryParameterType* iso1EVPowerDeliveryParameterType) {
+	init_iso1EVPowerDeliveryParameterType(iso1EVPowerDeliveryParameterType);
+	return decodeGrammar(stream, &iso1EVPowerDeliveryParameterTypeGrammar, iso1EVPowerDeliveryParameterType);
+}
+#else
 static int decode_iso1EVPowerDeliveryParameterType(bitstream_t* stream, struct iso1EVPowerDeliveryParameterType* iso1EVPowerDeliveryParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -2940,9 +4480,41 @@ static int decode_iso1EVPowerDeliveryParameterType(bitstream_t* stream, struct i
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ProfileEntryType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ChargingProfileEntryStart,"urn:iso:15118:2:2013:MsgDataTypes":ChargingProfileEntryMaxPower,"urn:iso:15118:2:2013:MsgDataTypes":ChargingProfileEntryMaxNumberOfPhasesInUse{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1ProfileEntryTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ProfileEntryType, ChargingProfileEntryStart), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ProfileEntryType, ChargingProfileEntryMaxPower), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(int8_t), 1, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ProfileEntryType, ChargingProfileEntryMaxNumberOfPhasesInUse), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ProfileEntryTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1ProfileEntryTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }
+};
+static void iso1ProfileEntryTypeUsed(void* value, uint8_t flag) {
+	struct iso1ProfileEntryType* iso1ProfileEntryType = (struct iso1ProfileEntryType*)value;
+	switch(flag) {
+	case 0:
+		iso1ProfileEntryType->ChargingProfileEntryMaxNumberOfPhasesInUse_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ProfileEntryTypeGrammar = { iso1ProfileEntryTypeStates, iso1ProfileEntryTypeTransitions, iso1ProfileEntryTypeProductions, iso1ProfileEntryTypeUsed };
+
 static int decode_iso1ProfileEntryType(bitstream_t* stream, struct iso1ProfileEntryType* iso1ProfileEntryType) {
+	init_iso1ProfileEntryType(iso1ProfileEntryType);
+	return decodeGrammar(stream, &iso1ProfileEntryTypeGrammar, iso1ProfileEntryType);
+}
+#else
+static int decode_iso1ProfileEntryType(bitstream_t* stream, struct iso1ProfileEntryType* iso1ProfileEntryType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 77;
 	int done = 0;
 	
@@ -3060,9 +4632,43 @@ static int decode_iso1ProfileEntryType(bitstream_t* stream, struct iso1ProfileEn
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,AuthorizationReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":GenChallenge{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1AuthorizationReqTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1AuthorizationReqType, Id.characters), offsetof(struct iso1AuthorizationReqType, Id.charactersLen), iso1AuthorizationReqType_Id_CHARACTERS_SIZE, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1AuthorizationReqType, GenChallenge.bytes), offsetof(struct iso1AuthorizationReqType, GenChallenge.bytesLen), iso1AuthorizationReqType_GenChallenge_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1AuthorizationReqTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 2, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1AuthorizationReqTypeStates[3] = {
+	{ 0, 2, 3 }, { 3, 2, 2 }, { 5, 1, 1 }
+};
+static void iso1AuthorizationReqTypeUsed(void* value, uint8_t flag) {
+	struct iso1AuthorizationReqType* iso1AuthorizationReqType = (struct iso1AuthorizationReqType*)value;
+	switch(flag) {
+	case 0:
+		iso1AuthorizationReqType->Id_isUsed = 1u;
+		break;
+	case 1:
+		iso1AuthorizationReqType->GenChallenge_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1AuthorizationReqTypeGrammar = { iso1AuthorizationReqTypeStates, iso1AuthorizationReqTypeTransitions, iso1AuthorizationReqTypeProductions, iso1AuthorizationReqTypeUsed };
+
+static int decode_iso1AuthorizationReqType(bitstream_t* stream, struct iso1AuthorizationReqType* iso1AuthorizationReqType) {
+	init_iso1AuthorizationReqType(iso1AuthorizationReqType);
+	return decodeGrammar(stream, &iso1AuthorizationReqTypeGrammar, iso1AuthorizationReqType);
+}
+#else
 static int decode_iso1AuthorizationReqType(bitstream_t* stream, struct iso1AuthorizationReqType* iso1AuthorizationReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 80;
 	int done = 0;
 	
@@ -3080,10 +4686,24 @@ static int decode_iso1AuthorizationReqType(bitstream_t* stream, struct iso1Autho
 					if (errn == 0) {
 						if (iso1AuthorizationReqType->Id.charactersLen >= 2) {
 							iso1AuthorizationReqType->Id.charactersLen = (uint16_t)(iso1AuthorizationReqType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1AuthorizationReqType->Id.characters, CHARACTER_UNITS(iso1AuthorizationReqType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1AuthorizationReqType->Id.charactersLen, iso1AuthorizationReqType->Id.characters, iso1AuthorizationReqType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1AuthorizationReqType->Id.charactersLen, iso1AuthorizationReqType->Id.characters, iso1AuthorizationReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, iso1AuthorizationReqType->Id.characters, iso1AuthorizationReqType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, &iso1AuthorizationReqType->Id.charactersLen, &iso1AuthorizationReqType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, &iso1AuthorizationReqType->Id.charactersLen, iso1AuthorizationReqType->Id.characters, iso1AuthorizationReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1AuthorizationReqType->Id_isUsed = 1u;
@@ -3195,9 +4815,53 @@ static int decode_iso1AuthorizationReqType(bitstream_t* stream, struct iso1Autho
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_AuthorizationReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,MeterInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":MeterID,"urn:iso:15118:2:2013:MsgDataTypes":MeterReading{0-1},"urn:iso:15118:2:2013:MsgDataTypes":SigMeterReading{0-1},"urn:iso:15118:2:2013:MsgDataTypes":MeterStatus{0-1},"urn:iso:15118:2:2013:MsgDataTypes":TMeter{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1MeterInfoTypeProductions[6] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1MeterInfoType, MeterID.characters), offsetof(struct iso1MeterInfoType, MeterID.charactersLen), iso1MeterInfoType_MeterID_CHARACTERS_SIZE, 19 /* {urn:iso:15118:2:2013:MsgDataTypes}MeterID */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED64, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1MeterInfoType, MeterReading), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1MeterInfoType, SigMeterReading.bytes), offsetof(struct iso1MeterInfoType, SigMeterReading.bytesLen), iso1MeterInfoType_SigMeterReading_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1MeterInfoType, MeterStatus), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER64, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct iso1MeterInfoType, TMeter), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1MeterInfoTypeTransitions[16] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 0, 5 }, { 3, 2 }, { 4, 3 },
+	{ 5, 4 }, { 0, 5 }, { 4, 3 }, { 5, 4 }, { 0, 5 }, { 5, 4 }, { 0, 5 }, { 0, 5 }
+};
+static const exi_grammar_state_t iso1MeterInfoTypeStates[6] = {
+	{ 0, 1, 1 }, { 1, 3, 5 }, { 6, 3, 4 }, { 10, 2, 3 }, { 13, 2, 2 }, { 15, 1, 1 }
+};
+static void iso1MeterInfoTypeUsed(void* value, uint8_t flag) {
+	struct iso1MeterInfoType* iso1MeterInfoType = (struct iso1MeterInfoType*)value;
+	switch(flag) {
+	case 0:
+		iso1MeterInfoType->MeterReading_isUsed = 1u;
+		break;
+	case 1:
+		iso1MeterInfoType->SigMeterReading_isUsed = 1u;
+		break;
+	case 2:
+		iso1MeterInfoType->MeterStatus_isUsed = 1u;
+		break;
+	case 3:
+		iso1MeterInfoType->TMeter_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1MeterInfoTypeGrammar = { iso1MeterInfoTypeStates, iso1MeterInfoTypeTransitions, iso1MeterInfoTypeProductions, iso1MeterInfoTypeUsed };
+
 static int decode_iso1MeterInfoType(bitstream_t* stream, struct iso1MeterInfoType* iso1MeterInfoType) {
+	init_iso1MeterInfoType(iso1MeterInfoType);
+	return decodeGrammar(stream, &iso1MeterInfoTypeGrammar, iso1MeterInfoType);
+}
+#else
+static int decode_iso1MeterInfoType(bitstream_t* stream, struct iso1MeterInfoType* iso1MeterInfoType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 82;
 	int done = 0;
 	
@@ -3219,10 +4883,24 @@ static int decode_iso1MeterInfoType(bitstream_t* stream, struct iso1MeterInfoTyp
 							if (errn == 0) {
 								if (iso1MeterInfoType->MeterID.charactersLen >= 2) {
 									iso1MeterInfoType->MeterID.charactersLen = (uint16_t)(iso1MeterInfoType->MeterID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1MeterInfoType->MeterID.characters, CHARACTER_UNITS(iso1MeterInfoType->MeterID.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1MeterInfoType->MeterID.charactersLen, iso1MeterInfoType->MeterID.characters, iso1MeterInfoType_MeterID_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1MeterInfoType->MeterID.charactersLen, iso1MeterInfoType->MeterID.characters, iso1MeterInfoType_MeterID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 19 /* {urn:iso:15118:2:2013:MsgDataTypes}MeterID */, iso1MeterInfoType->MeterID.characters, iso1MeterInfoType->MeterID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 19 /* {urn:iso:15118:2:2013:MsgDataTypes}MeterID */, &iso1MeterInfoType->MeterID.charactersLen, &iso1MeterInfoType->MeterID.characters);
+#else
+									errn = decodeStringValueHit(stream, 19 /* {urn:iso:15118:2:2013:MsgDataTypes}MeterID */, &iso1MeterInfoType->MeterID.charactersLen, iso1MeterInfoType->MeterID.characters, iso1MeterInfoType_MeterID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -3563,9 +5241,40 @@ static int decode_iso1MeterInfoType(bitstream_t* stream, struct iso1MeterInfoTyp
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ManifestType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if ISO1_DEPLOY_Manifest == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ManifestTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ManifestType, Id.characters), offsetof(struct iso1ManifestType, Id.charactersLen), iso1ManifestType_Id_CHARACTERS_SIZE, 27 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1ManifestType_Reference_ARRAY_SIZE, offsetof(struct iso1ManifestType, Reference.array), offsetof(struct iso1ManifestType, Reference.arrayLen), sizeof(((struct iso1ManifestType*)0)->Reference.array[0]), 0, 0, 0, 0, decode_iso1ReferenceTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ManifestTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1ManifestTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }
+};
+static void iso1ManifestTypeUsed(void* value, uint8_t flag) {
+	struct iso1ManifestType* iso1ManifestType = (struct iso1ManifestType*)value;
+	switch(flag) {
+	case 0:
+		iso1ManifestType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ManifestTypeGrammar = { iso1ManifestTypeStates, iso1ManifestTypeTransitions, iso1ManifestTypeProductions, iso1ManifestTypeUsed };
+
+static int decode_iso1ManifestType(bitstream_t* stream, struct iso1ManifestType* iso1ManifestType) {
+	init_iso1ManifestType(iso1ManifestType);
+	return decodeGrammar(stream, &iso1ManifestTypeGrammar, iso1ManifestType);
+}
+#else
 static int decode_iso1ManifestType(bitstream_t* stream, struct iso1ManifestType* iso1ManifestType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 87;
 	int done = 0;
 	
@@ -3583,17 +5292,40 @@ static int decode_iso1ManifestType(bitstream_t* stream, struct iso1ManifestType*
 					if (errn == 0) {
 						if (iso1ManifestType->Id.charactersLen >= 2) {
 							iso1ManifestType->Id.charactersLen = (uint16_t)(iso1ManifestType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ManifestType->Id.characters, CHARACTER_UNITS(iso1ManifestType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ManifestType->Id.charactersLen, iso1ManifestType->Id.characters, iso1ManifestType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ManifestType->Id.charactersLen, iso1ManifestType->Id.characters, iso1ManifestType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 27 /* {}Id */, iso1ManifestType->Id.characters, iso1ManifestType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 27 /* {}Id */, &iso1ManifestType->Id.charactersLen, &iso1ManifestType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 27 /* {}Id */, &iso1ManifestType->Id.charactersLen, iso1ManifestType->Id.characters, iso1ManifestType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ManifestType->Id_isUsed = 1u;
 					grammarID = 88;
 					break;
 				case 1:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ManifestType->Reference.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ManifestType->Reference.array, iso1ManifestType_Reference_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ManifestType->Reference.arrayLen < iso1ManifestType_Reference_ARRAY_SIZE) {
+#else
 					if (iso1ManifestType->Reference.arrayLen < iso1ManifestType_Reference_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ReferenceType(stream, &iso1ManifestType->Reference.array[iso1ManifestType->Reference.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -3612,7 +5344,16 @@ static int decode_iso1ManifestType(bitstream_t* stream, struct iso1ManifestType*
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ManifestType->Reference.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ManifestType->Reference.array, iso1ManifestType_Reference_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ManifestType->Reference.arrayLen < iso1ManifestType_Reference_ARRAY_SIZE) {
+#else
 					if (iso1ManifestType->Reference.arrayLen < iso1ManifestType_Reference_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ReferenceType(stream, &iso1ManifestType->Reference.array[iso1ManifestType->Reference.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -3631,7 +5372,16 @@ static int decode_iso1ManifestType(bitstream_t* stream, struct iso1ManifestType*
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ManifestType->Reference.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ManifestType->Reference.array, iso1ManifestType_Reference_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ManifestType->Reference.arrayLen < iso1ManifestType_Reference_ARRAY_SIZE) {
+#else
 					if (iso1ManifestType->Reference.arrayLen < iso1ManifestType_Reference_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ReferenceType(stream, &iso1ManifestType->Reference.array[iso1ManifestType->Reference.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -3658,9 +5408,60 @@ static int decode_iso1ManifestType(bitstream_t* stream, struct iso1ManifestType*
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_Manifest */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ChargeParameterDiscoveryResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":EVSEProcessing,"urn:iso:15118:2:2013:MsgDataTypes":SASchedules{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVSEChargeParameter)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ChargeParameterDiscoveryResTypeProductions[8] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeParameterDiscoveryResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(iso1EVSEProcessingType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeParameterDiscoveryResType, EVSEProcessing), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeParameterDiscoveryResType, SAScheduleList), 0, 0, 0, decode_iso1SAScheduleListTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeParameterDiscoveryResType, SASchedules), 0, 0, 0, decode_iso1SASchedulesTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeParameterDiscoveryResType, AC_EVSEChargeParameter), 0, 0, 0, decode_iso1AC_EVSEChargeParameterTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeParameterDiscoveryResType, DC_EVSEChargeParameter), 0, 0, 0, decode_iso1DC_EVSEChargeParameterTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeParameterDiscoveryResType, EVSEChargeParameter), 0, 0, 0, decode_iso1EVSEChargeParameterTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ChargeParameterDiscoveryResTypeTransitions[11] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 3, 3 }, { 4, 4 }, { 4, 5 }, { 4, 6 }, { 4, 4 },
+	{ 4, 5 }, { 4, 6 }, { 0, 7 }
+};
+static const exi_grammar_state_t iso1ChargeParameterDiscoveryResTypeStates[5] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 3, 5 }, { 7, 2, 3 }, { 10, 1, 1 }
+};
+static void iso1ChargeParameterDiscoveryResTypeUsed(void* value, uint8_t flag) {
+	struct iso1ChargeParameterDiscoveryResType* iso1ChargeParameterDiscoveryResType = (struct iso1ChargeParameterDiscoveryResType*)value;
+	switch(flag) {
+	case 0:
+		iso1ChargeParameterDiscoveryResType->SAScheduleList_isUsed = 1u;
+		break;
+	case 1:
+		iso1ChargeParameterDiscoveryResType->SASchedules_isUsed = 1u;
+		break;
+	case 2:
+		iso1ChargeParameterDiscoveryResType->AC_EVSEChargeParameter_isUsed = 1u;
+		break;
+	case 3:
+		iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter_isUsed = 1u;
+		break;
+	case 4:
+		iso1ChargeParameterDiscoveryResType->EVSEChargeParameter_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ChargeParameterDiscoveryResTypeGrammar = { iso1ChargeParameterDiscoveryResTypeStates, iso1ChargeParameterDiscoveryResTypeTransitions, iso1ChargeParameterDiscoveryResTypeProductions, iso1ChargeParameterDiscoveryResTypeUsed };
+
 static int decode_iso1ChargeParameterDiscoveryResType(bitstream_t* stream, struct iso1ChargeParameterDiscoveryResType* iso1ChargeParameterDiscoveryResType) {
+	init_iso1ChargeParameterDiscoveryResType(iso1ChargeParameterDiscoveryResType);
+	return decodeGrammar(stream, &iso1ChargeParameterDiscoveryResTypeGrammar, iso1ChargeParameterDiscoveryResType);
+}
+#else
+static int decode_iso1ChargeParameterDiscoveryResType(bitstream_t* stream, struct iso1ChargeParameterDiscoveryResType* iso1ChargeParameterDiscoveryResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 89;
 	int done = 0;
 	
@@ -3755,7 +5556,14 @@ static int decode_iso1ChargeParameterDiscoveryResType(bitstream_t* stream, struc
 					grammarID = 3;
 					break;
 				case 3:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter, 1);
+					if (errn == 0) {
+						errn = decode_iso1DC_EVSEChargeParameterType(stream, iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter);
+					}
+#else
 					errn = decode_iso1DC_EVSEChargeParameterType(stream, &iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter);
+#endif /* DATABINDING_SLIM */
 					iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter_isUsed = 1u;
 					grammarID = 3;
 					break;
@@ -3781,7 +5589,14 @@ static int decode_iso1ChargeParameterDiscoveryResType(bitstream_t* stream, struc
 					grammarID = 3;
 					break;
 				case 1:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter, 1);
+					if (errn == 0) {
+						errn = decode_iso1DC_EVSEChargeParameterType(stream, iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter);
+					}
+#else
 					errn = decode_iso1DC_EVSEChargeParameterType(stream, &iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter);
+#endif /* DATABINDING_SLIM */
 					iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter_isUsed = 1u;
 					grammarID = 3;
 					break;
@@ -3821,9 +5636,50 @@ static int decode_iso1ChargeParameterDiscoveryResType(bitstream_t* stream, struc
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PowerDeliveryResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgDataTypes":EVSEStatus)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1PowerDeliveryResTypeProductions[5] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PowerDeliveryResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1PowerDeliveryResType, AC_EVSEStatus), 0, 0, 0, decode_iso1AC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1PowerDeliveryResType, DC_EVSEStatus), 0, 0, 0, decode_iso1DC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1PowerDeliveryResType, EVSEStatus), 0, 0, 0, decode_iso1EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PowerDeliveryResTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t iso1PowerDeliveryResTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 1, 1 }
+};
+static void iso1PowerDeliveryResTypeUsed(void* value, uint8_t flag) {
+	struct iso1PowerDeliveryResType* iso1PowerDeliveryResType = (struct iso1PowerDeliveryResType*)value;
+	switch(flag) {
+	case 0:
+		iso1PowerDeliveryResType->AC_EVSEStatus_isUsed = 1u;
+		break;
+	case 1:
+		iso1PowerDeliveryResType->DC_EVSEStatus_isUsed = 1u;
+		break;
+	case 2:
+		iso1PowerDeliveryResType->EVSEStatus_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1PowerDeliveryResTypeGrammar = { iso1PowerDeliveryResTypeStates, iso1PowerDeliveryResTypeTransitions, iso1PowerDeliveryResTypeProductions, iso1PowerDeliveryResTypeUsed };
+
+static int decode_iso1PowerDeliveryResType(bitstream_t* stream, struct iso1PowerDeliveryResType* iso1PowerDeliveryResType) {
+	init_iso1PowerDeliveryResType(iso1PowerDeliveryResType);
+	return decodeGrammar(stream, &iso1PowerDeliveryResTypeGrammar, iso1PowerDeliveryResType);
+}
+#else
 static int decode_iso1PowerDeliveryResType(bitstream_t* stream, struct iso1PowerDeliveryResType* iso1PowerDeliveryResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 93;
 	int done = 0;
 	
@@ -3915,9 +5771,66 @@ static int decode_iso1PowerDeliveryResType(bitstream_t* stream, struct iso1Power
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DC_EVChargeParameterType',  base type name='EVChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":DepartureTime{0-1}),("urn:iso:15118:2:2013:MsgDataTypes":DC_EVStatus,"urn:iso:15118:2:2013:MsgDataTypes":EVMaximumCurrentLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVMaximumPowerLimit{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVMaximumVoltageLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVEnergyCapacity{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVEnergyRequest{0-1},"urn:iso:15118:2:2013:MsgDataTypes":FullSOC{0-1},"urn:iso:15118:2:2013:MsgDataTypes":BulkSOC{0-1}))',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1DC_EVChargeParameterTypeProductions[10] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVChargeParameterType, DepartureTime), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVChargeParameterType, DC_EVStatus), 0, 0, 0, decode_iso1DC_EVStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVChargeParameterType, EVMaximumCurrentLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVChargeParameterType, EVMaximumPowerLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVChargeParameterType, EVMaximumVoltageLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVChargeParameterType, EVEnergyCapacity), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVChargeParameterType, EVEnergyRequest), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 7, sizeof(int8_t), 0, 4, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVChargeParameterType, FullSOC), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 7, sizeof(int8_t), 0, 5, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVChargeParameterType, BulkSOC), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1DC_EVChargeParameterTypeTransitions[22] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 5, 4 }, { 6, 5 },
+	{ 7, 6 }, { 8, 7 }, { 9, 8 }, { 0, 9 }, { 7, 6 }, { 8, 7 }, { 9, 8 }, { 0, 9 },
+	{ 8, 7 }, { 9, 8 }, { 0, 9 }, { 9, 8 }, { 0, 9 }, { 0, 9 }
+};
+static const exi_grammar_state_t iso1DC_EVChargeParameterTypeStates[10] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 2, 2 }, { 6, 1, 1 }, { 7, 3, 5 }, { 12, 3, 4 }, { 16, 2, 3 },
+	{ 19, 2, 2 }, { 21, 1, 1 }
+};
+static void iso1DC_EVChargeParameterTypeUsed(void* value, uint8_t flag) {
+	struct iso1DC_EVChargeParameterType* iso1DC_EVChargeParameterType = (struct iso1DC_EVChargeParameterType*)value;
+	switch(flag) {
+	case 0:
+		iso1DC_EVChargeParameterType->DepartureTime_isUsed = 1u;
+		break;
+	case 1:
+		iso1DC_EVChargeParameterType->EVMaximumPowerLimit_isUsed = 1u;
+		break;
+	case 2:
+		iso1DC_EVChargeParameterType->EVEnergyCapacity_isUsed = 1u;
+		break;
+	case 3:
+		iso1DC_EVChargeParameterType->EVEnergyRequest_isUsed = 1u;
+		break;
+	case 4:
+		iso1DC_EVChargeParameterType->FullSOC_isUsed = 1u;
+		break;
+	case 5:
+		iso1DC_EVChargeParameterType->BulkSOC_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1DC_EVChargeParameterTypeGrammar = { iso1DC_EVChargeParameterTypeStates, iso1DC_EVChargeParameterTypeTransitions, iso1DC_EVChargeParameterTypeProductions, iso1DC_EVChargeParameterTypeUsed };
+
 static int decode_iso1DC_EVChargeParameterType(bitstream_t* stream, struct iso1DC_EVChargeParameterType* iso1DC_EVChargeParameterType) {
+	init_iso1DC_EVChargeParameterType(iso1DC_EVChargeParameterType);
+	return decodeGrammar(stream, &iso1DC_EVChargeParameterTypeGrammar, iso1DC_EVChargeParameterType);
+}
+#else
+static int decode_iso1DC_EVChargeParameterType(bitstream_t* stream, struct iso1DC_EVChargeParameterType* iso1DC_EVChargeParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 95;
 	int done = 0;
 	
@@ -4288,9 +6201,31 @@ static int decode_iso1DC_EVChargeParameterType(bitstream_t* stream, struct iso1D
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ConsumptionCostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":startValue,"urn:iso:15118:2:2013:MsgDataTypes":Cost{1-3})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1ConsumptionCostTypeProductions[3] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ConsumptionCostType, startValue), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1ConsumptionCostType_Cost_ARRAY_SIZE, offsetof(struct iso1ConsumptionCostType, Cost.array), offsetof(struct iso1ConsumptionCostType, Cost.arrayLen), sizeof(((struct iso1ConsumptionCostType*)0)->Cost.array[0]), 0, 0, 0, 0, decode_iso1CostTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ConsumptionCostTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 1 }, { 0, 2 }, { 4, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1ConsumptionCostTypeStates[5] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 2, 2 }, { 6, 1, 1 }
+};
+static const exi_grammar_t iso1ConsumptionCostTypeGrammar = { iso1ConsumptionCostTypeStates, iso1ConsumptionCostTypeTransitions, iso1ConsumptionCostTypeProductions, NULL };
+
 static int decode_iso1ConsumptionCostType(bitstream_t* stream, struct iso1ConsumptionCostType* iso1ConsumptionCostType) {
+	init_iso1ConsumptionCostType(iso1ConsumptionCostType);
+	return decodeGrammar(stream, &iso1ConsumptionCostTypeGrammar, iso1ConsumptionCostType);
+}
+#else
+static int decode_iso1ConsumptionCostType(bitstream_t* stream, struct iso1ConsumptionCostType* iso1ConsumptionCostType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 104;
 	int done = 0;
 	
@@ -4403,9 +6338,30 @@ static int decode_iso1ConsumptionCostType(bitstream_t* stream, struct iso1Consum
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,PMaxScheduleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":PMaxScheduleEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1PMaxScheduleTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1PMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE, offsetof(struct iso1PMaxScheduleType, PMaxScheduleEntry.array), offsetof(struct iso1PMaxScheduleType, PMaxScheduleEntry.arrayLen), sizeof(((struct iso1PMaxScheduleType*)0)->PMaxScheduleEntry.array[0]), 0, 0, 0, 0, decode_iso1PMaxScheduleEntryTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PMaxScheduleTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1PMaxScheduleTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t iso1PMaxScheduleTypeGrammar = { iso1PMaxScheduleTypeStates, iso1PMaxScheduleTypeTransitions, iso1PMaxScheduleTypeProductions, NULL };
+
+static int decode_iso1PMaxScheduleType(bitstream_t* stream, struct iso1PMaxScheduleType* iso1PMaxScheduleType) {
+	init_iso1PMaxScheduleType(iso1PMaxScheduleType);
+	return decodeGrammar(stream, &iso1PMaxScheduleTypeGrammar, iso1PMaxScheduleType);
+}
+#else
 static int decode_iso1PMaxScheduleType(bitstream_t* stream, struct iso1PMaxScheduleType* iso1PMaxScheduleType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 108;
 	int done = 0;
 	
@@ -4419,7 +6375,16 @@ static int decode_iso1PMaxScheduleType(bitstream_t* stream, struct iso1PMaxSched
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1PMaxScheduleType->PMaxScheduleEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1PMaxScheduleType->PMaxScheduleEntry.array, iso1PMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1PMaxScheduleType->PMaxScheduleEntry.arrayLen < iso1PMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE) {
+#else
 					if (iso1PMaxScheduleType->PMaxScheduleEntry.arrayLen < iso1PMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1PMaxScheduleEntryType(stream, &iso1PMaxScheduleType->PMaxScheduleEntry.array[iso1PMaxScheduleType->PMaxScheduleEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -4438,7 +6403,16 @@ static int decode_iso1PMaxScheduleType(bitstream_t* stream, struct iso1PMaxSched
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1PMaxScheduleType->PMaxScheduleEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1PMaxScheduleType->PMaxScheduleEntry.array, iso1PMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1PMaxScheduleType->PMaxScheduleEntry.arrayLen < iso1PMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE) {
+#else
 					if (iso1PMaxScheduleType->PMaxScheduleEntry.arrayLen < iso1PMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1PMaxScheduleEntryType(stream, &iso1PMaxScheduleType->PMaxScheduleEntry.array[iso1PMaxScheduleType->PMaxScheduleEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -4465,9 +6439,31 @@ static int decode_iso1PMaxScheduleType(bitstream_t* stream, struct iso1PMaxSched
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,PaymentOptionListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":PaymentOption{1-2})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1PaymentOptionListTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 1, sizeof(iso1paymentOptionType), 0, EXI_GRAMMAR_NO_FLAG, 0, iso1PaymentOptionListType_PaymentOption_ARRAY_SIZE, offsetof(struct iso1PaymentOptionListType, PaymentOption.array), offsetof(struct iso1PaymentOptionListType, PaymentOption.arrayLen), sizeof(((struct iso1PaymentOptionListType*)0)->PaymentOption.array[0]), 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PaymentOptionListTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 0 }, { 0, 1 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1PaymentOptionListTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }
+};
+static const exi_grammar_t iso1PaymentOptionListTypeGrammar = { iso1PaymentOptionListTypeStates, iso1PaymentOptionListTypeTransitions, iso1PaymentOptionListTypeProductions, NULL };
+
 static int decode_iso1PaymentOptionListType(bitstream_t* stream, struct iso1PaymentOptionListType* iso1PaymentOptionListType) {
+	init_iso1PaymentOptionListType(iso1PaymentOptionListType);
+	return decodeGrammar(stream, &iso1PaymentOptionListTypeGrammar, iso1PaymentOptionListType);
+}
+#else
+static int decode_iso1PaymentOptionListType(bitstream_t* stream, struct iso1PaymentOptionListType* iso1PaymentOptionListType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 110;
 	int done = 0;
 	
@@ -4580,9 +6576,53 @@ static int decode_iso1PaymentOptionListType(bitstream_t* stream, struct iso1Paym
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ObjectType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any])){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ObjectTypeProductions[6] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ObjectType, Encoding.characters), offsetof(struct iso1ObjectType, Encoding.charactersLen), iso1ObjectType_Encoding_CHARACTERS_SIZE, 26 /* {}Encoding */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1ObjectType, Id.characters), offsetof(struct iso1ObjectType, Id.charactersLen), iso1ObjectType_Id_CHARACTERS_SIZE, 27 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1ObjectType, MimeType.characters), offsetof(struct iso1ObjectType, MimeType.charactersLen), iso1ObjectType_MimeType_CHARACTERS_SIZE, 28 /* {}MimeType */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct iso1ObjectType, ANY.characters), offsetof(struct iso1ObjectType, ANY.charactersLen), iso1ObjectType_ANY_CHARACTERS_SIZE, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, NULL }
+};
+static const exi_grammar_transition_t iso1ObjectTypeTransitions[21] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 0, 4 }, { 4, 5 }, { 2, 1 }, { 3, 2 },
+	{ 4, 3 }, { 0, 4 }, { 4, 5 }, { 3, 2 }, { 4, 3 }, { 0, 4 }, { 4, 5 }, { 4, 3 },
+	{ 0, 4 }, { 4, 5 }, { 4, 3 }, { 0, 4 }, { 4, 5 }
+};
+static const exi_grammar_state_t iso1ObjectTypeStates[5] = {
+	{ 0, 3, 6 }, { 6, 3, 5 }, { 11, 3, 4 }, { 15, 2, 3 }, { 18, 2, 3 }
+};
+static void iso1ObjectTypeUsed(void* value, uint8_t flag) {
+	struct iso1ObjectType* iso1ObjectType = (struct iso1ObjectType*)value;
+	switch(flag) {
+	case 0:
+		iso1ObjectType->Encoding_isUsed = 1u;
+		break;
+	case 1:
+		iso1ObjectType->Id_isUsed = 1u;
+		break;
+	case 2:
+		iso1ObjectType->MimeType_isUsed = 1u;
+		break;
+	case 3:
+		iso1ObjectType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ObjectTypeGrammar = { iso1ObjectTypeStates, iso1ObjectTypeTransitions, iso1ObjectTypeProductions, iso1ObjectTypeUsed };
+
+static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso1ObjectType) {
+	init_iso1ObjectType(iso1ObjectType);
+	return decodeGrammar(stream, &iso1ObjectTypeGrammar, iso1ObjectType);
+}
+#else
 static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso1ObjectType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 112;
 	int done = 0;
 	
@@ -4600,10 +6640,24 @@ static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 					if (errn == 0) {
 						if (iso1ObjectType->Encoding.charactersLen >= 2) {
 							iso1ObjectType->Encoding.charactersLen = (uint16_t)(iso1ObjectType->Encoding.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ObjectType->Encoding.characters, CHARACTER_UNITS(iso1ObjectType->Encoding.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ObjectType->Encoding.charactersLen, iso1ObjectType->Encoding.characters, iso1ObjectType_Encoding_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ObjectType->Encoding.charactersLen, iso1ObjectType->Encoding.characters, iso1ObjectType_Encoding_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 26 /* {}Encoding */, iso1ObjectType->Encoding.characters, iso1ObjectType->Encoding.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 26 /* {}Encoding */, &iso1ObjectType->Encoding.charactersLen, &iso1ObjectType->Encoding.characters);
+#else
+							errn = decodeStringValueHit(stream, 26 /* {}Encoding */, &iso1ObjectType->Encoding.charactersLen, iso1ObjectType->Encoding.characters, iso1ObjectType_Encoding_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ObjectType->Encoding_isUsed = 1u;
@@ -4614,10 +6668,24 @@ static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 					if (errn == 0) {
 						if (iso1ObjectType->Id.charactersLen >= 2) {
 							iso1ObjectType->Id.charactersLen = (uint16_t)(iso1ObjectType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ObjectType->Id.characters, CHARACTER_UNITS(iso1ObjectType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ObjectType->Id.charactersLen, iso1ObjectType->Id.characters, iso1ObjectType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ObjectType->Id.charactersLen, iso1ObjectType->Id.characters, iso1ObjectType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 27 /* {}Id */, iso1ObjectType->Id.characters, iso1ObjectType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 27 /* {}Id */, &iso1ObjectType->Id.charactersLen, &iso1ObjectType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 27 /* {}Id */, &iso1ObjectType->Id.charactersLen, iso1ObjectType->Id.characters, iso1ObjectType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ObjectType->Id_isUsed = 1u;
@@ -4628,10 +6696,24 @@ static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 					if (errn == 0) {
 						if (iso1ObjectType->MimeType.charactersLen >= 2) {
 							iso1ObjectType->MimeType.charactersLen = (uint16_t)(iso1ObjectType->MimeType.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ObjectType->MimeType.characters, CHARACTER_UNITS(iso1ObjectType->MimeType.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ObjectType->MimeType.charactersLen, iso1ObjectType->MimeType.characters, iso1ObjectType_MimeType_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ObjectType->MimeType.charactersLen, iso1ObjectType->MimeType.characters, iso1ObjectType_MimeType_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 28 /* {}MimeType */, iso1ObjectType->MimeType.characters, iso1ObjectType->MimeType.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 28 /* {}MimeType */, &iso1ObjectType->MimeType.charactersLen, &iso1ObjectType->MimeType.characters);
+#else
+							errn = decodeStringValueHit(stream, 28 /* {}MimeType */, &iso1ObjectType->MimeType.charactersLen, iso1ObjectType->MimeType.characters, iso1ObjectType_MimeType_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ObjectType->MimeType_isUsed = 1u;
@@ -4651,10 +6733,24 @@ static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 					if (errn == 0) {
 						if (iso1ObjectType->ANY.charactersLen >= 2) {
 							iso1ObjectType->ANY.charactersLen = (uint16_t)(iso1ObjectType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ObjectType->ANY.characters, CHARACTER_UNITS(iso1ObjectType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &iso1ObjectType->ANY.charactersLen, &iso1ObjectType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ObjectType->ANY_isUsed = 1u;
@@ -4676,10 +6772,24 @@ static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 					if (errn == 0) {
 						if (iso1ObjectType->Id.charactersLen >= 2) {
 							iso1ObjectType->Id.charactersLen = (uint16_t)(iso1ObjectType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ObjectType->Id.characters, CHARACTER_UNITS(iso1ObjectType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ObjectType->Id.charactersLen, iso1ObjectType->Id.characters, iso1ObjectType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ObjectType->Id.charactersLen, iso1ObjectType->Id.characters, iso1ObjectType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 27 /* {}Id */, iso1ObjectType->Id.characters, iso1ObjectType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 27 /* {}Id */, &iso1ObjectType->Id.charactersLen, &iso1ObjectType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 27 /* {}Id */, &iso1ObjectType->Id.charactersLen, iso1ObjectType->Id.characters, iso1ObjectType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ObjectType->Id_isUsed = 1u;
@@ -4690,10 +6800,24 @@ static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 					if (errn == 0) {
 						if (iso1ObjectType->MimeType.charactersLen >= 2) {
 							iso1ObjectType->MimeType.charactersLen = (uint16_t)(iso1ObjectType->MimeType.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ObjectType->MimeType.characters, CHARACTER_UNITS(iso1ObjectType->MimeType.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ObjectType->MimeType.charactersLen, iso1ObjectType->MimeType.characters, iso1ObjectType_MimeType_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ObjectType->MimeType.charactersLen, iso1ObjectType->MimeType.characters, iso1ObjectType_MimeType_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 28 /* {}MimeType */, iso1ObjectType->MimeType.characters, iso1ObjectType->MimeType.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 28 /* {}MimeType */, &iso1ObjectType->MimeType.charactersLen, &iso1ObjectType->MimeType.characters);
+#else
+							errn = decodeStringValueHit(stream, 28 /* {}MimeType */, &iso1ObjectType->MimeType.charactersLen, iso1ObjectType->MimeType.characters, iso1ObjectType_MimeType_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ObjectType->MimeType_isUsed = 1u;
@@ -4713,10 +6837,24 @@ static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 					if (errn == 0) {
 						if (iso1ObjectType->ANY.charactersLen >= 2) {
 							iso1ObjectType->ANY.charactersLen = (uint16_t)(iso1ObjectType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ObjectType->ANY.characters, CHARACTER_UNITS(iso1ObjectType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &iso1ObjectType->ANY.charactersLen, &iso1ObjectType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ObjectType->ANY_isUsed = 1u;
@@ -4738,10 +6876,24 @@ static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 					if (errn == 0) {
 						if (iso1ObjectType->MimeType.charactersLen >= 2) {
 							iso1ObjectType->MimeType.charactersLen = (uint16_t)(iso1ObjectType->MimeType.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ObjectType->MimeType.characters, CHARACTER_UNITS(iso1ObjectType->MimeType.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ObjectType->MimeType.charactersLen, iso1ObjectType->MimeType.characters, iso1ObjectType_MimeType_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ObjectType->MimeType.charactersLen, iso1ObjectType->MimeType.characters, iso1ObjectType_MimeType_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 28 /* {}MimeType */, iso1ObjectType->MimeType.characters, iso1ObjectType->MimeType.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 28 /* {}MimeType */, &iso1ObjectType->MimeType.charactersLen, &iso1ObjectType->MimeType.characters);
+#else
+							errn = decodeStringValueHit(stream, 28 /* {}MimeType */, &iso1ObjectType->MimeType.charactersLen, iso1ObjectType->MimeType.characters, iso1ObjectType_MimeType_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ObjectType->MimeType_isUsed = 1u;
@@ -4761,10 +6913,24 @@ static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 					if (errn == 0) {
 						if (iso1ObjectType->ANY.charactersLen >= 2) {
 							iso1ObjectType->ANY.charactersLen = (uint16_t)(iso1ObjectType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ObjectType->ANY.characters, CHARACTER_UNITS(iso1ObjectType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &iso1ObjectType->ANY.charactersLen, &iso1ObjectType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ObjectType->ANY_isUsed = 1u;
@@ -4795,10 +6961,24 @@ static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 					if (errn == 0) {
 						if (iso1ObjectType->ANY.charactersLen >= 2) {
 							iso1ObjectType->ANY.charactersLen = (uint16_t)(iso1ObjectType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ObjectType->ANY.characters, CHARACTER_UNITS(iso1ObjectType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &iso1ObjectType->ANY.charactersLen, &iso1ObjectType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ObjectType->ANY_isUsed = 1u;
@@ -4829,10 +7009,24 @@ static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 					if (errn == 0) {
 						if (iso1ObjectType->ANY.charactersLen >= 2) {
 							iso1ObjectType->ANY.charactersLen = (uint16_t)(iso1ObjectType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ObjectType->ANY.characters, CHARACTER_UNITS(iso1ObjectType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &iso1ObjectType->ANY.charactersLen, &iso1ObjectType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &iso1ObjectType->ANY.charactersLen, iso1ObjectType->ANY.characters, iso1ObjectType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ObjectType->ANY_isUsed = 1u;
@@ -4854,9 +7048,33 @@ static int decode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,PhysicalValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":Multiplier,"urn:iso:15118:2:2013:MsgDataTypes":Unit,"urn:iso:15118:2:2013:MsgDataTypes":Value)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1PhysicalValueTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 3, sizeof(int8_t), -3, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PhysicalValueType, Multiplier), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 3, sizeof(iso1unitSymbolType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PhysicalValueType, Unit), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PhysicalValueType, Value), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PhysicalValueTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1PhysicalValueTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t iso1PhysicalValueTypeGrammar = { iso1PhysicalValueTypeStates, iso1PhysicalValueTypeTransitions, iso1PhysicalValueTypeProductions, NULL };
+
 static int decode_iso1PhysicalValueType(bitstream_t* stream, struct iso1PhysicalValueType* iso1PhysicalValueType) {
+	init_iso1PhysicalValueType(iso1PhysicalValueType);
+	return decodeGrammar(stream, &iso1PhysicalValueTypeGrammar, iso1PhysicalValueType);
+}
+#else
+static int decode_iso1PhysicalValueType(bitstream_t* stream, struct iso1PhysicalValueType* iso1PhysicalValueType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 117;
 	int done = 0;
 	
@@ -4987,9 +7205,31 @@ static int decode_iso1PhysicalValueType(bitstream_t* stream, struct iso1Physical
 	}
 	return errn;
 }
-
-/* Complex type name='http://www.w3.org/2000/09/xmldsig#,RSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Modulus,"http://www.w3.org/2000/09/xmldsig#":Exponent)',  derivedBy='RESTRICTION'.  */
+#endif /* GRAMMAR_DECODER_TABLE */
+
+/* Complex type name='http://www.w3.org/2000/09/xmldsig#,RSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Modulus,"http://www.w3.org/2000/09/xmldsig#":Exponent)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1RSAKeyValueTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1RSAKeyValueType, Modulus.bytes), offsetof(struct iso1RSAKeyValueType, Modulus.bytesLen), iso1RSAKeyValueType_Modulus_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1RSAKeyValueType, Exponent.bytes), offsetof(struct iso1RSAKeyValueType, Exponent.bytesLen), iso1RSAKeyValueType_Exponent_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1RSAKeyValueTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1RSAKeyValueTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t iso1RSAKeyValueTypeGrammar = { iso1RSAKeyValueTypeStates, iso1RSAKeyValueTypeTransitions, iso1RSAKeyValueTypeProductions, NULL };
+
+static int decode_iso1RSAKeyValueType(bitstream_t* stream, struct iso1RSAKeyValueType* iso1RSAKeyValueType) {
+	init_iso1RSAKeyValueType(iso1RSAKeyValueType);
+	return decodeGrammar(stream, &iso1RSAKeyValueTypeGrammar, iso1RSAKeyValueType);
+}
+#else
 static int decode_iso1RSAKeyValueType(bitstream_t* stream, struct iso1RSAKeyValueType* iso1RSAKeyValueType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 120;
 	int done = 0;
 	
@@ -5012,7 +7252,14 @@ static int decode_iso1RSAKeyValueType(bitstream_t* stream, struct iso1RSAKeyValu
 								errn =  (iso1RSAKeyValueType->Modulus.bytesLen) <= iso1RSAKeyValueType_Modulus_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1RSAKeyValueType->Modulus.bytes, iso1RSAKeyValueType->Modulus.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1RSAKeyValueType->Modulus.bytesLen, iso1RSAKeyValueType->Modulus.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1RSAKeyValueType->Modulus.bytesLen, iso1RSAKeyValueType->Modulus.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -5050,7 +7297,14 @@ static int decode_iso1RSAKeyValueType(bitstream_t* stream, struct iso1RSAKeyValu
 								errn =  (iso1RSAKeyValueType->Exponent.bytesLen) <= iso1RSAKeyValueType_Exponent_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1RSAKeyValueType->Exponent.bytes, iso1RSAKeyValueType->Exponent.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1RSAKeyValueType->Exponent.bytesLen, iso1RSAKeyValueType->Exponent.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1RSAKeyValueType->Exponent.bytesLen, iso1RSAKeyValueType->Exponent.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -5098,9 +7352,32 @@ static int decode_iso1RSAKeyValueType(bitstream_t* stream, struct iso1RSAKeyValu
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,SessionStopResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1SessionStopResTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SessionStopResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SessionStopResTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1SessionStopResTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t iso1SessionStopResTypeGrammar = { iso1SessionStopResTypeStates, iso1SessionStopResTypeTransitions, iso1SessionStopResTypeProductions, NULL };
+
 static int decode_iso1SessionStopResType(bitstream_t* stream, struct iso1SessionStopResType* iso1SessionStopResType) {
+	init_iso1SessionStopResType(iso1SessionStopResType);
+	return decodeGrammar(stream, &iso1SessionStopResTypeGrammar, iso1SessionStopResType);
+}
+#else
+static int decode_iso1SessionStopResType(bitstream_t* stream, struct iso1SessionStopResType* iso1SessionStopResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 122;
 	int done = 0;
 	
@@ -5166,9 +7443,35 @@ static int decode_iso1SessionStopResType(bitstream_t* stream, struct iso1Session
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_SessionStopRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CertificateUpdateReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2013:MsgBody":eMAID,"urn:iso:15118:2:2013:MsgBody":ListOfRootCertificateIDs)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1CertificateUpdateReqTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateUpdateReqType, Id.characters), offsetof(struct iso1CertificateUpdateReqType, Id.charactersLen), iso1CertificateUpdateReqType_Id_CHARACTERS_SIZE, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateUpdateReqType, ContractSignatureCertChain), 0, 0, 0, decode_iso1CertificateChainTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateUpdateReqType, eMAID.characters), offsetof(struct iso1CertificateUpdateReqType, eMAID.charactersLen), iso1CertificateUpdateReqType_eMAID_CHARACTERS_SIZE, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateUpdateReqType, ListOfRootCertificateIDs), 0, 0, 0, decode_iso1ListOfRootCertificateIDsTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1CertificateUpdateReqTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t iso1CertificateUpdateReqTypeStates[5] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }
+};
+static const exi_grammar_t iso1CertificateUpdateReqTypeGrammar = { iso1CertificateUpdateReqTypeStates, iso1CertificateUpdateReqTypeTransitions, iso1CertificateUpdateReqTypeProductions, NULL };
+
 static int decode_iso1CertificateUpdateReqType(bitstream_t* stream, struct iso1CertificateUpdateReqType* iso1CertificateUpdateReqType) {
+	init_iso1CertificateUpdateReqType(iso1CertificateUpdateReqType);
+	return decodeGrammar(stream, &iso1CertificateUpdateReqTypeGrammar, iso1CertificateUpdateReqType);
+}
+#else
+static int decode_iso1CertificateUpdateReqType(bitstream_t* stream, struct iso1CertificateUpdateReqType* iso1CertificateUpdateReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 123;
 	int done = 0;
 	
@@ -5186,10 +7489,24 @@ static int decode_iso1CertificateUpdateReqType(bitstream_t* stream, struct iso1C
 					if (errn == 0) {
 						if (iso1CertificateUpdateReqType->Id.charactersLen >= 2) {
 							iso1CertificateUpdateReqType->Id.charactersLen = (uint16_t)(iso1CertificateUpdateReqType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1CertificateUpdateReqType->Id.characters, CHARACTER_UNITS(iso1CertificateUpdateReqType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1CertificateUpdateReqType->Id.charactersLen, iso1CertificateUpdateReqType->Id.characters, iso1CertificateUpdateReqType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1CertificateUpdateReqType->Id.charactersLen, iso1CertificateUpdateReqType->Id.characters, iso1CertificateUpdateReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, iso1CertificateUpdateReqType->Id.characters, iso1CertificateUpdateReqType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, &iso1CertificateUpdateReqType->Id.charactersLen, &iso1CertificateUpdateReqType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, &iso1CertificateUpdateReqType->Id.charactersLen, iso1CertificateUpdateReqType->Id.characters, iso1CertificateUpdateReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 124;
@@ -5230,9 +7547,12 @@ static int decode_iso1CertificateUpdateReqType(bitstream_t* stream, struct iso1C
 								if (iso1CertificateUpdateReqType->eMAID.charactersLen >= 2) {
 									iso1CertificateUpdateReqType->eMAID.charactersLen = (uint16_t)(iso1CertificateUpdateReqType->eMAID.charactersLen - 2); /* string table miss */
 									errn = decodeCharacters(stream, iso1CertificateUpdateReqType->eMAID.charactersLen, iso1CertificateUpdateReqType->eMAID.characters, iso1CertificateUpdateReqType_eMAID_CHARACTERS_SIZE);
+									if (errn == 0) {
+										errn = addStringValue(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, iso1CertificateUpdateReqType->eMAID.characters, iso1CertificateUpdateReqType->eMAID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+									errn = decodeStringValueHit(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, &iso1CertificateUpdateReqType->eMAID.charactersLen, iso1CertificateUpdateReqType->eMAID.characters, iso1CertificateUpdateReqType_eMAID_CHARACTERS_SIZE);
 								}
 							}
 						} else {
@@ -5296,9 +7616,40 @@ static int decode_iso1CertificateUpdateReqType(bitstream_t* stream, struct iso1C
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureValueType',  base type name='base64Binary',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SignatureValueTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1SignatureValueType, Id.characters), offsetof(struct iso1SignatureValueType, Id.charactersLen), iso1SignatureValueType_Id_CHARACTERS_SIZE, 27 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SignatureValueType, CONTENT.bytes), offsetof(struct iso1SignatureValueType, CONTENT.bytesLen), iso1SignatureValueType_CONTENT_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SignatureValueTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1SignatureValueTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static void iso1SignatureValueTypeUsed(void* value, uint8_t flag) {
+	struct iso1SignatureValueType* iso1SignatureValueType = (struct iso1SignatureValueType*)value;
+	switch(flag) {
+	case 0:
+		iso1SignatureValueType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1SignatureValueTypeGrammar = { iso1SignatureValueTypeStates, iso1SignatureValueTypeTransitions, iso1SignatureValueTypeProductions, iso1SignatureValueTypeUsed };
+
+static int decode_iso1SignatureValueType(bitstream_t* stream, struct iso1SignatureValueType* iso1SignatureValueType) {
+	init_iso1SignatureValueType(iso1SignatureValueType);
+	return decodeGrammar(stream, &iso1SignatureValueTypeGrammar, iso1SignatureValueType);
+}
+#else
 static int decode_iso1SignatureValueType(bitstream_t* stream, struct iso1SignatureValueType* iso1SignatureValueType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 126;
 	int done = 0;
 	
@@ -5316,10 +7667,24 @@ static int decode_iso1SignatureValueType(bitstream_t* stream, struct iso1Signatu
 					if (errn == 0) {
 						if (iso1SignatureValueType->Id.charactersLen >= 2) {
 							iso1SignatureValueType->Id.charactersLen = (uint16_t)(iso1SignatureValueType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignatureValueType->Id.characters, CHARACTER_UNITS(iso1SignatureValueType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignatureValueType->Id.charactersLen, iso1SignatureValueType->Id.characters, iso1SignatureValueType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignatureValueType->Id.charactersLen, iso1SignatureValueType->Id.characters, iso1SignatureValueType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 27 /* {}Id */, iso1SignatureValueType->Id.characters, iso1SignatureValueType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 27 /* {}Id */, &iso1SignatureValueType->Id.charactersLen, &iso1SignatureValueType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 27 /* {}Id */, &iso1SignatureValueType->Id.charactersLen, iso1SignatureValueType->Id.characters, iso1SignatureValueType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1SignatureValueType->Id_isUsed = 1u;
@@ -5331,7 +7696,14 @@ static int decode_iso1SignatureValueType(bitstream_t* stream, struct iso1Signatu
 						errn =  (iso1SignatureValueType->CONTENT.bytesLen) <= iso1SignatureValueType_CONTENT_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 					}
 					if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SignatureValueType->CONTENT.bytes, iso1SignatureValueType->CONTENT.bytesLen);
+						if (errn == 0) {
+							errn = decodeBytes(stream, iso1SignatureValueType->CONTENT.bytesLen, iso1SignatureValueType->CONTENT.bytes);
+						}
+#else
 						errn = decodeBytes(stream, iso1SignatureValueType->CONTENT.bytesLen, iso1SignatureValueType->CONTENT.bytes);
+#endif /* DATABINDING_SLIM */
 					}
 					grammarID = 3;
 					break;
@@ -5352,7 +7724,14 @@ static int decode_iso1SignatureValueType(bitstream_t* stream, struct iso1Signatu
 						errn =  (iso1SignatureValueType->CONTENT.bytesLen) <= iso1SignatureValueType_CONTENT_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 					}
 					if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SignatureValueType->CONTENT.bytes, iso1SignatureValueType->CONTENT.bytesLen);
+						if (errn == 0) {
+							errn = decodeBytes(stream, iso1SignatureValueType->CONTENT.bytesLen, iso1SignatureValueType->CONTENT.bytes);
+						}
+#else
 						errn = decodeBytes(stream, iso1SignatureValueType->CONTENT.bytesLen, iso1SignatureValueType->CONTENT.bytes);
+#endif /* DATABINDING_SLIM */
 					}
 					grammarID = 3;
 					break;
@@ -5387,9 +7766,32 @@ static int decode_iso1SignatureValueType(bitstream_t* stream, struct iso1Signatu
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PaymentDetailsReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":eMAID,"urn:iso:15118:2:2013:MsgBody":ContractSignatureCertChain)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1PaymentDetailsReqTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PaymentDetailsReqType, eMAID.characters), offsetof(struct iso1PaymentDetailsReqType, eMAID.charactersLen), iso1PaymentDetailsReqType_eMAID_CHARACTERS_SIZE, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PaymentDetailsReqType, ContractSignatureCertChain), 0, 0, 0, decode_iso1CertificateChainTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PaymentDetailsReqTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1PaymentDetailsReqTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t iso1PaymentDetailsReqTypeGrammar = { iso1PaymentDetailsReqTypeStates, iso1PaymentDetailsReqTypeTransitions, iso1PaymentDetailsReqTypeProductions, NULL };
+
+static int decode_iso1PaymentDetailsReqType(bitstream_t* stream, struct iso1PaymentDetailsReqType* iso1PaymentDetailsReqType) {
+	init_iso1PaymentDetailsReqType(iso1PaymentDetailsReqType);
+	return decodeGrammar(stream, &iso1PaymentDetailsReqTypeGrammar, iso1PaymentDetailsReqType);
+}
+#else
 static int decode_iso1PaymentDetailsReqType(bitstream_t* stream, struct iso1PaymentDetailsReqType* iso1PaymentDetailsReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 127;
 	int done = 0;
 	
@@ -5412,9 +7814,12 @@ static int decode_iso1PaymentDetailsReqType(bitstream_t* stream, struct iso1Paym
 								if (iso1PaymentDetailsReqType->eMAID.charactersLen >= 2) {
 									iso1PaymentDetailsReqType->eMAID.charactersLen = (uint16_t)(iso1PaymentDetailsReqType->eMAID.charactersLen - 2); /* string table miss */
 									errn = decodeCharacters(stream, iso1PaymentDetailsReqType->eMAID.charactersLen, iso1PaymentDetailsReqType->eMAID.characters, iso1PaymentDetailsReqType_eMAID_CHARACTERS_SIZE);
+									if (errn == 0) {
+										errn = addStringValue(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, iso1PaymentDetailsReqType->eMAID.characters, iso1PaymentDetailsReqType->eMAID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+									errn = decodeStringValueHit(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, &iso1PaymentDetailsReqType->eMAID.charactersLen, iso1PaymentDetailsReqType->eMAID.characters, iso1PaymentDetailsReqType_eMAID_CHARACTERS_SIZE);
 								}
 							}
 						} else {
@@ -5478,9 +7883,34 @@ static int decode_iso1PaymentDetailsReqType(bitstream_t* stream, struct iso1Paym
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,AuthorizationResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":EVSEProcessing)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1AuthorizationResTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AuthorizationResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(iso1EVSEProcessingType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AuthorizationResType, EVSEProcessing), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1AuthorizationResTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1AuthorizationResTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t iso1AuthorizationResTypeGrammar = { iso1AuthorizationResTypeStates, iso1AuthorizationResTypeTransitions, iso1AuthorizationResTypeProductions, NULL };
+
 static int decode_iso1AuthorizationResType(bitstream_t* stream, struct iso1AuthorizationResType* iso1AuthorizationResType) {
+	init_iso1AuthorizationResType(iso1AuthorizationResType);
+	return decodeGrammar(stream, &iso1AuthorizationResTypeGrammar, iso1AuthorizationResType);
+}
+#else
+static int decode_iso1AuthorizationResType(bitstream_t* stream, struct iso1AuthorizationResType* iso1AuthorizationResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 129;
 	int done = 0;
 	
@@ -5579,9 +8009,52 @@ static int decode_iso1AuthorizationResType(bitstream_t* stream, struct iso1Autho
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_AuthorizationRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DC_EVSEChargeParameterType',  base type name='EVSEChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":DC_EVSEStatus,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMaximumCurrentLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMaximumPowerLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMaximumVoltageLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMinimumCurrentLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMinimumVoltageLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSECurrentRegulationTolerance{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVSEPeakCurrentRipple,"urn:iso:15118:2:2013:MsgDataTypes":EVSEEnergyToBeDelivered{0-1})',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1DC_EVSEChargeParameterTypeProductions[10] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEChargeParameterType, DC_EVSEStatus), 0, 0, 0, decode_iso1DC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEChargeParameterType, EVSEMaximumCurrentLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEChargeParameterType, EVSEMaximumPowerLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEChargeParameterType, EVSEMaximumVoltageLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEChargeParameterType, EVSEMinimumCurrentLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEChargeParameterType, EVSEMinimumVoltageLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEChargeParameterType, EVSECurrentRegulationTolerance), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEChargeParameterType, EVSEPeakCurrentRipple), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVSEChargeParameterType, EVSEEnergyToBeDelivered), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1DC_EVSEChargeParameterTypeTransitions[12] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 7, 6 }, { 8, 7 },
+	{ 8, 7 }, { 9, 8 }, { 0, 9 }, { 0, 9 }
+};
+static const exi_grammar_state_t iso1DC_EVSEChargeParameterTypeStates[10] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }, { 6, 2, 2 }, { 8, 1, 1 },
+	{ 9, 2, 2 }, { 11, 1, 1 }
+};
+static void iso1DC_EVSEChargeParameterTypeUsed(void* value, uint8_t flag) {
+	struct iso1DC_EVSEChargeParameterType* iso1DC_EVSEChargeParameterType = (struct iso1DC_EVSEChargeParameterType*)value;
+	switch(flag) {
+	case 0:
+		iso1DC_EVSEChargeParameterType->EVSECurrentRegulationTolerance_isUsed = 1u;
+		break;
+	case 1:
+		iso1DC_EVSEChargeParameterType->EVSEEnergyToBeDelivered_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1DC_EVSEChargeParameterTypeGrammar = { iso1DC_EVSEChargeParameterTypeStates, iso1DC_EVSEChargeParameterTypeTransitions, iso1DC_EVSEChargeParameterTypeProductions, iso1DC_EVSEChargeParameterTypeUsed };
+
+static int decode_iso1DC_EVSEChargeParameterType(bitstream_t* stream, struct iso1DC_EVSEChargeParameterType* iso1DC_EVSEChargeParameterType) {
+	init_iso1DC_EVSEChargeParameterType(iso1DC_EVSEChargeParameterType);
+	return decodeGrammar(stream, &iso1DC_EVSEChargeParameterTypeGrammar, iso1DC_EVSEChargeParameterType);
+}
+#else
 static int decode_iso1DC_EVSEChargeParameterType(bitstream_t* stream, struct iso1DC_EVSEChargeParameterType* iso1DC_EVSEChargeParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 131;
 	int done = 0;
 	
@@ -5759,9 +8232,30 @@ static int decode_iso1DC_EVSEChargeParameterType(bitstream_t* stream, struct iso
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SubCertificatesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":Certificate{1-4})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SubCertificatesTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1SubCertificatesType_Certificate_ARRAY_SIZE, offsetof(struct iso1SubCertificatesType, Certificate.array), offsetof(struct iso1SubCertificatesType, Certificate.arrayLen), sizeof(((struct iso1SubCertificatesType*)0)->Certificate.array[0]), (offsetof(struct iso1SubCertificatesType, Certificate.array[0].bytes) - offsetof(struct iso1SubCertificatesType, Certificate.array)), (offsetof(struct iso1SubCertificatesType, Certificate.array[0].bytesLen) - offsetof(struct iso1SubCertificatesType, Certificate.array)), iso1SubCertificatesType_Certificate_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SubCertificatesTypeTransitions[8] = {
+	{ 1, 0 }, { 2, 0 }, { 0, 1 }, { 3, 0 }, { 0, 1 }, { 4, 0 }, { 0, 1 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1SubCertificatesTypeStates[5] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 2, 2 }, { 5, 2, 2 }, { 7, 1, 1 }
+};
+static const exi_grammar_t iso1SubCertificatesTypeGrammar = { iso1SubCertificatesTypeStates, iso1SubCertificatesTypeTransitions, iso1SubCertificatesTypeProductions, NULL };
+
+static int decode_iso1SubCertificatesType(bitstream_t* stream, struct iso1SubCertificatesType* iso1SubCertificatesType) {
+	init_iso1SubCertificatesType(iso1SubCertificatesType);
+	return decodeGrammar(stream, &iso1SubCertificatesTypeGrammar, iso1SubCertificatesType);
+}
+#else
 static int decode_iso1SubCertificatesType(bitstream_t* stream, struct iso1SubCertificatesType* iso1SubCertificatesType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 140;
 	int done = 0;
 	
@@ -5785,7 +8279,14 @@ static int decode_iso1SubCertificatesType(bitstream_t* stream, struct iso1SubCer
 									errn =  (iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen) <= iso1SubCertificatesType_Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytes, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1SubCertificatesType->Certificate.arrayLen++;
 							} else {
@@ -5828,7 +8329,14 @@ static int decode_iso1SubCertificatesType(bitstream_t* stream, struct iso1SubCer
 									errn =  (iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen) <= iso1SubCertificatesType_Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytes, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1SubCertificatesType->Certificate.arrayLen++;
 							} else {
@@ -5875,7 +8383,14 @@ static int decode_iso1SubCertificatesType(bitstream_t* stream, struct iso1SubCer
 									errn =  (iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen) <= iso1SubCertificatesType_Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytes, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1SubCertificatesType->Certificate.arrayLen++;
 							} else {
@@ -5922,7 +8437,14 @@ static int decode_iso1SubCertificatesType(bitstream_t* stream, struct iso1SubCer
 									errn =  (iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen) <= iso1SubCertificatesType_Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytes, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytesLen, iso1SubCertificatesType->Certificate.array[iso1SubCertificatesType->Certificate.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1SubCertificatesType->Certificate.arrayLen++;
 							} else {
@@ -5978,9 +8500,53 @@ static int decode_iso1SubCertificatesType(bitstream_t* stream, struct iso1SubCer
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ChargingStatusResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":EVSEID,"urn:iso:15118:2:2013:MsgBody":SAScheduleTupleID,"urn:iso:15118:2:2013:MsgBody":EVSEMaxCurrent{0-1},"urn:iso:15118:2:2013:MsgBody":MeterInfo{0-1},"urn:iso:15118:2:2013:MsgBody":ReceiptRequired{0-1},"urn:iso:15118:2:2013:MsgBody":AC_EVSEStatus)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ChargingStatusResTypeProductions[8] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ChargingStatusResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ChargingStatusResType, EVSEID.characters), offsetof(struct iso1ChargingStatusResType, EVSEID.charactersLen), iso1ChargingStatusResType_EVSEID_CHARACTERS_SIZE, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(uint8_t), 1, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ChargingStatusResType, SAScheduleTupleID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ChargingStatusResType, EVSEMaxCurrent), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1ChargingStatusResType, MeterInfo), 0, 0, 0, decode_iso1MeterInfoTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1ChargingStatusResType, ReceiptRequired), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ChargingStatusResType, AC_EVSEStatus), 0, 0, 0, decode_iso1AC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ChargingStatusResTypeTransitions[14] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 7, 6 }, { 5, 4 },
+	{ 6, 5 }, { 7, 6 }, { 6, 5 }, { 7, 6 }, { 7, 6 }, { 0, 7 }
+};
+static const exi_grammar_state_t iso1ChargingStatusResTypeStates[8] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 3, 4 }, { 7, 2, 3 }, { 10, 2, 2 }, { 12, 1, 1 }, { 13, 1, 1 }
+};
+static void iso1ChargingStatusResTypeUsed(void* value, uint8_t flag) {
+	struct iso1ChargingStatusResType* iso1ChargingStatusResType = (struct iso1ChargingStatusResType*)value;
+	switch(flag) {
+	case 0:
+		iso1ChargingStatusResType->EVSEMaxCurrent_isUsed = 1u;
+		break;
+	case 1:
+		iso1ChargingStatusResType->MeterInfo_isUsed = 1u;
+		break;
+	case 2:
+		iso1ChargingStatusResType->ReceiptRequired_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ChargingStatusResTypeGrammar = { iso1ChargingStatusResTypeStates, iso1ChargingStatusResTypeTransitions, iso1ChargingStatusResTypeProductions, iso1ChargingStatusResTypeUsed };
+
 static int decode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1ChargingStatusResType* iso1ChargingStatusResType) {
+	init_iso1ChargingStatusResType(iso1ChargingStatusResType);
+	return decodeGrammar(stream, &iso1ChargingStatusResTypeGrammar, iso1ChargingStatusResType);
+}
+#else
+static int decode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1ChargingStatusResType* iso1ChargingStatusResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 144;
 	int done = 0;
 	
@@ -6035,10 +8601,24 @@ static int decode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1Char
 							if (errn == 0) {
 								if (iso1ChargingStatusResType->EVSEID.charactersLen >= 2) {
 									iso1ChargingStatusResType->EVSEID.charactersLen = (uint16_t)(iso1ChargingStatusResType->EVSEID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingStatusResType->EVSEID.characters, CHARACTER_UNITS(iso1ChargingStatusResType->EVSEID.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1ChargingStatusResType->EVSEID.charactersLen, iso1ChargingStatusResType->EVSEID.characters, iso1ChargingStatusResType_EVSEID_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1ChargingStatusResType->EVSEID.charactersLen, iso1ChargingStatusResType->EVSEID.characters, iso1ChargingStatusResType_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, iso1ChargingStatusResType->EVSEID.characters, iso1ChargingStatusResType->EVSEID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &iso1ChargingStatusResType->EVSEID.charactersLen, &iso1ChargingStatusResType->EVSEID.characters);
+#else
+									errn = decodeStringValueHit(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &iso1ChargingStatusResType->EVSEID.charactersLen, iso1ChargingStatusResType->EVSEID.characters, iso1ChargingStatusResType_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -6106,7 +8686,14 @@ static int decode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1Char
 					grammarID = 148;
 					break;
 				case 1:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingStatusResType->MeterInfo, 1);
+					if (errn == 0) {
+						errn = decode_iso1MeterInfoType(stream, iso1ChargingStatusResType->MeterInfo);
+					}
+#else
 					errn = decode_iso1MeterInfoType(stream, &iso1ChargingStatusResType->MeterInfo);
+#endif /* DATABINDING_SLIM */
 					iso1ChargingStatusResType->MeterInfo_isUsed = 1u;
 					grammarID = 149;
 					break;
@@ -6148,7 +8735,14 @@ static int decode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1Char
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingStatusResType->MeterInfo, 1);
+					if (errn == 0) {
+						errn = decode_iso1MeterInfoType(stream, iso1ChargingStatusResType->MeterInfo);
+					}
+#else
 					errn = decode_iso1MeterInfoType(stream, &iso1ChargingStatusResType->MeterInfo);
+#endif /* DATABINDING_SLIM */
 					iso1ChargingStatusResType->MeterInfo_isUsed = 1u;
 					grammarID = 149;
 					break;
@@ -6261,9 +8855,61 @@ static int decode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1Char
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":P,"http://www.w3.org/2000/09/xmldsig#":Q){0-1},"http://www.w3.org/2000/09/xmldsig#":G{0-1},"http://www.w3.org/2000/09/xmldsig#":Y,"http://www.w3.org/2000/09/xmldsig#":J{0-1},("http://www.w3.org/2000/09/xmldsig#":Seed,"http://www.w3.org/2000/09/xmldsig#":PgenCounter){0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1DSAKeyValueTypeProductions[8] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1DSAKeyValueType, P.bytes), offsetof(struct iso1DSAKeyValueType, P.bytesLen), iso1DSAKeyValueType_P_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1DSAKeyValueType, G.bytes), offsetof(struct iso1DSAKeyValueType, G.bytesLen), iso1DSAKeyValueType_G_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DSAKeyValueType, Y.bytes), offsetof(struct iso1DSAKeyValueType, Y.bytesLen), iso1DSAKeyValueType_Y_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1DSAKeyValueType, Q.bytes), offsetof(struct iso1DSAKeyValueType, Q.bytesLen), iso1DSAKeyValueType_Q_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct iso1DSAKeyValueType, J.bytes), offsetof(struct iso1DSAKeyValueType, J.bytesLen), iso1DSAKeyValueType_J_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 4, 0, 0, 0, 0, 0, offsetof(struct iso1DSAKeyValueType, Seed.bytes), offsetof(struct iso1DSAKeyValueType, Seed.bytesLen), iso1DSAKeyValueType_Seed_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 5, 0, 0, 0, 0, 0, offsetof(struct iso1DSAKeyValueType, PgenCounter.bytes), offsetof(struct iso1DSAKeyValueType, PgenCounter.bytesLen), iso1DSAKeyValueType_PgenCounter_BYTES_SIZE, 0, NULL }
+};
+static const exi_grammar_transition_t iso1DSAKeyValueTypeTransitions[14] = {
+	{ 1, 0 }, { 3, 1 }, { 4, 2 }, { 2, 3 }, { 3, 1 }, { 4, 2 }, { 4, 2 }, { 5, 4 },
+	{ 6, 5 }, { 0, 6 }, { 6, 5 }, { 0, 6 }, { 7, 7 }, { 0, 6 }
+};
+static const exi_grammar_state_t iso1DSAKeyValueTypeStates[8] = {
+	{ 0, 2, 3 }, { 3, 1, 1 }, { 4, 2, 2 }, { 6, 1, 1 }, { 7, 2, 3 }, { 10, 2, 2 }, { 12, 1, 1 }, { 13, 1, 1 }
+};
+static void iso1DSAKeyValueTypeUsed(void* value, uint8_t flag) {
+	struct iso1DSAKeyValueType* iso1DSAKeyValueType = (struct iso1DSAKeyValueType*)value;
+	switch(flag) {
+	case 0:
+		iso1DSAKeyValueType->P_isUsed = 1u;
+		break;
+	case 1:
+		iso1DSAKeyValueType->G_isUsed = 1u;
+		break;
+	case 2:
+		iso1DSAKeyValueType->Q_isUsed = 1u;
+		break;
+	case 3:
+		iso1DSAKeyValueType->J_isUsed = 1u;
+		break;
+	case 4:
+		iso1DSAKeyValueType->Seed_isUsed = 1u;
+		break;
+	case 5:
+		iso1DSAKeyValueType->PgenCounter_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1DSAKeyValueTypeGrammar = { iso1DSAKeyValueTypeStates, iso1DSAKeyValueTypeTransitions, iso1DSAKeyValueTypeProductions, iso1DSAKeyValueTypeUsed };
+
 static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValueType* iso1DSAKeyValueType) {
+	init_iso1DSAKeyValueType(iso1DSAKeyValueType);
+	return decodeGrammar(stream, &iso1DSAKeyValueTypeGrammar, iso1DSAKeyValueType);
+}
+#else
+static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValueType* iso1DSAKeyValueType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 151;
 	int done = 0;
 	
@@ -6286,7 +8932,14 @@ static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 								errn =  (iso1DSAKeyValueType->P.bytesLen) <= iso1DSAKeyValueType_P_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1DSAKeyValueType->P.bytes, iso1DSAKeyValueType->P.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1DSAKeyValueType->P.bytesLen, iso1DSAKeyValueType->P.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1DSAKeyValueType->P.bytesLen, iso1DSAKeyValueType->P.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							iso1DSAKeyValueType->P_isUsed = 1u;
 						} else {
@@ -6314,7 +8967,14 @@ static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 								errn =  (iso1DSAKeyValueType->G.bytesLen) <= iso1DSAKeyValueType_G_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1DSAKeyValueType->G.bytes, iso1DSAKeyValueType->G.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1DSAKeyValueType->G.bytesLen, iso1DSAKeyValueType->G.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1DSAKeyValueType->G.bytesLen, iso1DSAKeyValueType->G.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							iso1DSAKeyValueType->G_isUsed = 1u;
 						} else {
@@ -6342,7 +9002,14 @@ static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 								errn =  (iso1DSAKeyValueType->Y.bytesLen) <= iso1DSAKeyValueType_Y_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1DSAKeyValueType->Y.bytes, iso1DSAKeyValueType->Y.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1DSAKeyValueType->Y.bytesLen, iso1DSAKeyValueType->Y.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1DSAKeyValueType->Y.bytesLen, iso1DSAKeyValueType->Y.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -6380,7 +9047,14 @@ static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 								errn =  (iso1DSAKeyValueType->Q.bytesLen) <= iso1DSAKeyValueType_Q_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1DSAKeyValueType->Q.bytes, iso1DSAKeyValueType->Q.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1DSAKeyValueType->Q.bytesLen, iso1DSAKeyValueType->Q.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1DSAKeyValueType->Q.bytesLen, iso1DSAKeyValueType->Q.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							iso1DSAKeyValueType->Q_isUsed = 1u;
 						} else {
@@ -6419,7 +9093,14 @@ static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 								errn =  (iso1DSAKeyValueType->G.bytesLen) <= iso1DSAKeyValueType_G_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1DSAKeyValueType->G.bytes, iso1DSAKeyValueType->G.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1DSAKeyValueType->G.bytesLen, iso1DSAKeyValueType->G.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1DSAKeyValueType->G.bytesLen, iso1DSAKeyValueType->G.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							iso1DSAKeyValueType->G_isUsed = 1u;
 						} else {
@@ -6447,7 +9128,14 @@ static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 								errn =  (iso1DSAKeyValueType->Y.bytesLen) <= iso1DSAKeyValueType_Y_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1DSAKeyValueType->Y.bytes, iso1DSAKeyValueType->Y.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1DSAKeyValueType->Y.bytesLen, iso1DSAKeyValueType->Y.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1DSAKeyValueType->Y.bytesLen, iso1DSAKeyValueType->Y.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -6485,7 +9173,14 @@ static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 								errn =  (iso1DSAKeyValueType->Y.bytesLen) <= iso1DSAKeyValueType_Y_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1DSAKeyValueType->Y.bytes, iso1DSAKeyValueType->Y.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1DSAKeyValueType->Y.bytesLen, iso1DSAKeyValueType->Y.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1DSAKeyValueType->Y.bytesLen, iso1DSAKeyValueType->Y.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -6523,7 +9218,14 @@ static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 								errn =  (iso1DSAKeyValueType->J.bytesLen) <= iso1DSAKeyValueType_J_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1DSAKeyValueType->J.bytes, iso1DSAKeyValueType->J.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1DSAKeyValueType->J.bytesLen, iso1DSAKeyValueType->J.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1DSAKeyValueType->J.bytesLen, iso1DSAKeyValueType->J.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							iso1DSAKeyValueType->J_isUsed = 1u;
 						} else {
@@ -6551,7 +9253,14 @@ static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 								errn =  (iso1DSAKeyValueType->Seed.bytesLen) <= iso1DSAKeyValueType_Seed_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1DSAKeyValueType->Seed.bytes, iso1DSAKeyValueType->Seed.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1DSAKeyValueType->Seed.bytesLen, iso1DSAKeyValueType->Seed.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1DSAKeyValueType->Seed.bytesLen, iso1DSAKeyValueType->Seed.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							iso1DSAKeyValueType->Seed_isUsed = 1u;
 						} else {
@@ -6594,7 +9303,14 @@ static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 								errn =  (iso1DSAKeyValueType->Seed.bytesLen) <= iso1DSAKeyValueType_Seed_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1DSAKeyValueType->Seed.bytes, iso1DSAKeyValueType->Seed.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1DSAKeyValueType->Seed.bytesLen, iso1DSAKeyValueType->Seed.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1DSAKeyValueType->Seed.bytesLen, iso1DSAKeyValueType->Seed.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							iso1DSAKeyValueType->Seed_isUsed = 1u;
 						} else {
@@ -6637,7 +9353,14 @@ static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 								errn =  (iso1DSAKeyValueType->PgenCounter.bytesLen) <= iso1DSAKeyValueType_PgenCounter_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1DSAKeyValueType->PgenCounter.bytes, iso1DSAKeyValueType->PgenCounter.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1DSAKeyValueType->PgenCounter.bytesLen, iso1DSAKeyValueType->PgenCounter.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1DSAKeyValueType->PgenCounter.bytesLen, iso1DSAKeyValueType->PgenCounter.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							iso1DSAKeyValueType->PgenCounter_isUsed = 1u;
 						} else {
@@ -6686,9 +9409,30 @@ static int decode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ListOfRootCertificateIDsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":RootCertificateID{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ListOfRootCertificateIDsTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1ListOfRootCertificateIDsType_RootCertificateID_ARRAY_SIZE, offsetof(struct iso1ListOfRootCertificateIDsType, RootCertificateID.array), offsetof(struct iso1ListOfRootCertificateIDsType, RootCertificateID.arrayLen), sizeof(((struct iso1ListOfRootCertificateIDsType*)0)->RootCertificateID.array[0]), 0, 0, 0, 0, decode_iso1X509IssuerSerialTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ListOfRootCertificateIDsTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1ListOfRootCertificateIDsTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t iso1ListOfRootCertificateIDsTypeGrammar = { iso1ListOfRootCertificateIDsTypeStates, iso1ListOfRootCertificateIDsTypeTransitions, iso1ListOfRootCertificateIDsTypeProductions, NULL };
+
+static int decode_iso1ListOfRootCertificateIDsType(bitstream_t* stream, struct iso1ListOfRootCertificateIDsType* iso1ListOfRootCertificateIDsType) {
+	init_iso1ListOfRootCertificateIDsType(iso1ListOfRootCertificateIDsType);
+	return decodeGrammar(stream, &iso1ListOfRootCertificateIDsTypeGrammar, iso1ListOfRootCertificateIDsType);
+}
+#else
 static int decode_iso1ListOfRootCertificateIDsType(bitstream_t* stream, struct iso1ListOfRootCertificateIDsType* iso1ListOfRootCertificateIDsType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 158;
 	int done = 0;
 	
@@ -6702,7 +9446,16 @@ static int decode_iso1ListOfRootCertificateIDsType(bitstream_t* stream, struct i
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ListOfRootCertificateIDsType->RootCertificateID.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ListOfRootCertificateIDsType->RootCertificateID.array, iso1ListOfRootCertificateIDsType_RootCertificateID_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ListOfRootCertificateIDsType->RootCertificateID.arrayLen < iso1ListOfRootCertificateIDsType_RootCertificateID_ARRAY_SIZE) {
+#else
 					if (iso1ListOfRootCertificateIDsType->RootCertificateID.arrayLen < iso1ListOfRootCertificateIDsType_RootCertificateID_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1X509IssuerSerialType(stream, &iso1ListOfRootCertificateIDsType->RootCertificateID.array[iso1ListOfRootCertificateIDsType->RootCertificateID.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -6721,7 +9474,16 @@ static int decode_iso1ListOfRootCertificateIDsType(bitstream_t* stream, struct i
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ListOfRootCertificateIDsType->RootCertificateID.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ListOfRootCertificateIDsType->RootCertificateID.array, iso1ListOfRootCertificateIDsType_RootCertificateID_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ListOfRootCertificateIDsType->RootCertificateID.arrayLen < iso1ListOfRootCertificateIDsType_RootCertificateID_ARRAY_SIZE) {
+#else
 					if (iso1ListOfRootCertificateIDsType->RootCertificateID.arrayLen < iso1ListOfRootCertificateIDsType_RootCertificateID_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1X509IssuerSerialType(stream, &iso1ListOfRootCertificateIDsType->RootCertificateID.array[iso1ListOfRootCertificateIDsType->RootCertificateID.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -6748,9 +9510,48 @@ static int decode_iso1ListOfRootCertificateIDsType(bitstream_t* stream, struct i
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ChargeServiceType',  base type name='ServiceType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":ServiceID,"urn:iso:15118:2:2013:MsgDataTypes":ServiceName{0-1},"urn:iso:15118:2:2013:MsgDataTypes":ServiceCategory,"urn:iso:15118:2:2013:MsgDataTypes":ServiceScope{0-1},"urn:iso:15118:2:2013:MsgDataTypes":FreeService),("urn:iso:15118:2:2013:MsgDataTypes":SupportedEnergyTransferMode))',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ChargeServiceTypeProductions[7] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeServiceType, ServiceID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeServiceType, ServiceName.characters), offsetof(struct iso1ChargeServiceType, ServiceName.charactersLen), iso1ChargeServiceType_ServiceName_CHARACTERS_SIZE, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(iso1serviceCategoryType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeServiceType, ServiceCategory), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeServiceType, ServiceScope.characters), offsetof(struct iso1ChargeServiceType, ServiceScope.charactersLen), iso1ChargeServiceType_ServiceScope_CHARACTERS_SIZE, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeServiceType, FreeService), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeServiceType, SupportedEnergyTransferMode), 0, 0, 0, decode_iso1SupportedEnergyTransferModeTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ChargeServiceTypeTransitions[9] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 5, 4 }, { 6, 5 },
+	{ 0, 6 }
+};
+static const exi_grammar_state_t iso1ChargeServiceTypeStates[7] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }, { 4, 2, 2 }, { 6, 1, 1 }, { 7, 1, 1 }, { 8, 1, 1 }
+};
+static void iso1ChargeServiceTypeUsed(void* value, uint8_t flag) {
+	struct iso1ChargeServiceType* iso1ChargeServiceType = (struct iso1ChargeServiceType*)value;
+	switch(flag) {
+	case 0:
+		iso1ChargeServiceType->ServiceName_isUsed = 1u;
+		break;
+	case 1:
+		iso1ChargeServiceType->ServiceScope_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ChargeServiceTypeGrammar = { iso1ChargeServiceTypeStates, iso1ChargeServiceTypeTransitions, iso1ChargeServiceTypeProductions, iso1ChargeServiceTypeUsed };
+
+static int decode_iso1ChargeServiceType(bitstream_t* stream, struct iso1ChargeServiceType* iso1ChargeServiceType) {
+	init_iso1ChargeServiceType(iso1ChargeServiceType);
+	return decodeGrammar(stream, &iso1ChargeServiceTypeGrammar, iso1ChargeServiceType);
+}
+#else
 static int decode_iso1ChargeServiceType(bitstream_t* stream, struct iso1ChargeServiceType* iso1ChargeServiceType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 160;
 	int done = 0;
 	
@@ -6804,10 +9605,24 @@ static int decode_iso1ChargeServiceType(bitstream_t* stream, struct iso1ChargeSe
 							if (errn == 0) {
 								if (iso1ChargeServiceType->ServiceName.charactersLen >= 2) {
 									iso1ChargeServiceType->ServiceName.charactersLen = (uint16_t)(iso1ChargeServiceType->ServiceName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1ChargeServiceType->ServiceName.characters, CHARACTER_UNITS(iso1ChargeServiceType->ServiceName.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1ChargeServiceType->ServiceName.charactersLen, iso1ChargeServiceType->ServiceName.characters, iso1ChargeServiceType_ServiceName_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1ChargeServiceType->ServiceName.charactersLen, iso1ChargeServiceType->ServiceName.characters, iso1ChargeServiceType_ServiceName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, iso1ChargeServiceType->ServiceName.characters, iso1ChargeServiceType->ServiceName.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, &iso1ChargeServiceType->ServiceName.charactersLen, &iso1ChargeServiceType->ServiceName.characters);
+#else
+									errn = decodeStringValueHit(stream, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, &iso1ChargeServiceType->ServiceName.charactersLen, iso1ChargeServiceType->ServiceName.characters, iso1ChargeServiceType_ServiceName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							iso1ChargeServiceType->ServiceName_isUsed = 1u;
@@ -6901,10 +9716,24 @@ static int decode_iso1ChargeServiceType(bitstream_t* stream, struct iso1ChargeSe
 							if (errn == 0) {
 								if (iso1ChargeServiceType->ServiceScope.charactersLen >= 2) {
 									iso1ChargeServiceType->ServiceScope.charactersLen = (uint16_t)(iso1ChargeServiceType->ServiceScope.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1ChargeServiceType->ServiceScope.characters, CHARACTER_UNITS(iso1ChargeServiceType->ServiceScope.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1ChargeServiceType->ServiceScope.charactersLen, iso1ChargeServiceType->ServiceScope.characters, iso1ChargeServiceType_ServiceScope_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1ChargeServiceType->ServiceScope.charactersLen, iso1ChargeServiceType->ServiceScope.characters, iso1ChargeServiceType_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, iso1ChargeServiceType->ServiceScope.characters, iso1ChargeServiceType->ServiceScope.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, &iso1ChargeServiceType->ServiceScope.charactersLen, &iso1ChargeServiceType->ServiceScope.characters);
+#else
+									errn = decodeStringValueHit(stream, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, &iso1ChargeServiceType->ServiceScope.charactersLen, iso1ChargeServiceType->ServiceScope.characters, iso1ChargeServiceType_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							iso1ChargeServiceType->ServiceScope_isUsed = 1u;
@@ -7022,9 +9851,29 @@ static int decode_iso1ChargeServiceType(bitstream_t* stream, struct iso1ChargeSe
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,IntervalType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1IntervalTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1IntervalTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t iso1IntervalTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t iso1IntervalTypeGrammar = { iso1IntervalTypeStates, iso1IntervalTypeTransitions, iso1IntervalTypeProductions, NULL };
+
+static int decode_iso1IntervalType(bitstream_t* stream, struct iso1IntervalType* iso1IntervalType) {
+	init_iso1IntervalType(iso1IntervalType);
+	return decodeGrammar(stream, &iso1IntervalTypeGrammar, iso1IntervalType);
+}
+#else
 static int decode_iso1IntervalType(bitstream_t* stream, struct iso1IntervalType* iso1IntervalType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -7057,9 +9906,46 @@ static int decode_iso1IntervalType(bitstream_t* stream, struct iso1IntervalType*
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,MeteringReceiptReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":SessionID,"urn:iso:15118:2:2013:MsgBody":SAScheduleTupleID{0-1},"urn:iso:15118:2:2013:MsgBody":MeterInfo)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1MeteringReceiptReqTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1MeteringReceiptReqType, Id.characters), offsetof(struct iso1MeteringReceiptReqType, Id.charactersLen), iso1MeteringReceiptReqType_Id_CHARACTERS_SIZE, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1MeteringReceiptReqType, SessionID.bytes), offsetof(struct iso1MeteringReceiptReqType, SessionID.bytesLen), iso1MeteringReceiptReqType_SessionID_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(uint8_t), 1, 1, 0, 0, 0, 0, 0, offsetof(struct iso1MeteringReceiptReqType, SAScheduleTupleID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1MeteringReceiptReqType, MeterInfo), 0, 0, 0, decode_iso1MeterInfoTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1MeteringReceiptReqTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t iso1MeteringReceiptReqTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }, { 5, 1, 1 }, { 6, 1, 1 }
+};
+static void iso1MeteringReceiptReqTypeUsed(void* value, uint8_t flag) {
+	struct iso1MeteringReceiptReqType* iso1MeteringReceiptReqType = (struct iso1MeteringReceiptReqType*)value;
+	switch(flag) {
+	case 0:
+		iso1MeteringReceiptReqType->Id_isUsed = 1u;
+		break;
+	case 1:
+		iso1MeteringReceiptReqType->SAScheduleTupleID_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1MeteringReceiptReqTypeGrammar = { iso1MeteringReceiptReqTypeStates, iso1MeteringReceiptReqTypeTransitions, iso1MeteringReceiptReqTypeProductions, iso1MeteringReceiptReqTypeUsed };
+
 static int decode_iso1MeteringReceiptReqType(bitstream_t* stream, struct iso1MeteringReceiptReqType* iso1MeteringReceiptReqType) {
+	init_iso1MeteringReceiptReqType(iso1MeteringReceiptReqType);
+	return decodeGrammar(stream, &iso1MeteringReceiptReqTypeGrammar, iso1MeteringReceiptReqType);
+}
+#else
+static int decode_iso1MeteringReceiptReqType(bitstream_t* stream, struct iso1MeteringReceiptReqType* iso1MeteringReceiptReqType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 166;
 	int done = 0;
 	
@@ -7077,10 +9963,24 @@ static int decode_iso1MeteringReceiptReqType(bitstream_t* stream, struct iso1Met
 					if (errn == 0) {
 						if (iso1MeteringReceiptReqType->Id.charactersLen >= 2) {
 							iso1MeteringReceiptReqType->Id.charactersLen = (uint16_t)(iso1MeteringReceiptReqType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1MeteringReceiptReqType->Id.characters, CHARACTER_UNITS(iso1MeteringReceiptReqType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1MeteringReceiptReqType->Id.charactersLen, iso1MeteringReceiptReqType->Id.characters, iso1MeteringReceiptReqType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1MeteringReceiptReqType->Id.charactersLen, iso1MeteringReceiptReqType->Id.characters, iso1MeteringReceiptReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, iso1MeteringReceiptReqType->Id.characters, iso1MeteringReceiptReqType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, &iso1MeteringReceiptReqType->Id.charactersLen, &iso1MeteringReceiptReqType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, &iso1MeteringReceiptReqType->Id.charactersLen, iso1MeteringReceiptReqType->Id.characters, iso1MeteringReceiptReqType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1MeteringReceiptReqType->Id_isUsed = 1u;
@@ -7235,9 +10135,43 @@ static int decode_iso1MeteringReceiptReqType(bitstream_t* stream, struct iso1Met
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ServiceDetailResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":ServiceID,"urn:iso:15118:2:2013:MsgBody":ServiceParameterList{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1ServiceDetailResTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceDetailResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceDetailResType, ServiceID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceDetailResType, ServiceParameterList), 0, 0, 0, decode_iso1ServiceParameterListTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ServiceDetailResTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1ServiceDetailResTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }
+};
+static void iso1ServiceDetailResTypeUsed(void* value, uint8_t flag) {
+	struct iso1ServiceDetailResType* iso1ServiceDetailResType = (struct iso1ServiceDetailResType*)value;
+	switch(flag) {
+	case 0:
+		iso1ServiceDetailResType->ServiceParameterList_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ServiceDetailResTypeGrammar = { iso1ServiceDetailResTypeStates, iso1ServiceDetailResTypeTransitions, iso1ServiceDetailResTypeProductions, iso1ServiceDetailResTypeUsed };
+
+static int decode_iso1ServiceDetailResType(bitstream_t* stream, struct iso1ServiceDetailResType* iso1ServiceDetailResType) {
+	init_iso1ServiceDetailResType(iso1ServiceDetailResType);
+	return decodeGrammar(stream, &iso1ServiceDetailResTypeGrammar, iso1ServiceDetailResType);
+}
+#else
 static int decode_iso1ServiceDetailResType(bitstream_t* stream, struct iso1ServiceDetailResType* iso1ServiceDetailResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 170;
 	int done = 0;
 	
@@ -7355,9 +10289,49 @@ static int decode_iso1ServiceDetailResType(bitstream_t* stream, struct iso1Servi
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyValueType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":DSAKeyValue|"http://www.w3.org/2000/09/xmldsig#":RSAKeyValue|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1KeyValueTypeProductions[5] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1KeyValueType, DSAKeyValue), 0, 0, 0, decode_iso1DSAKeyValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1KeyValueType, RSAKeyValue), 0, 0, 0, decode_iso1RSAKeyValueTypeGeneric },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1KeyValueType, ANY.characters), offsetof(struct iso1KeyValueType, ANY.charactersLen), iso1KeyValueType_ANY_CHARACTERS_SIZE, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1KeyValueTypeTransitions[10] = {
+	{ 1, 0 }, { 1, 1 }, { 1, 2 }, { 2, 3 }, { 0, 4 }, { 1, 3 }, { 1, 0 }, { 1, 1 },
+	{ 1, 2 }, { 2, 3 }
+};
+static const exi_grammar_state_t iso1KeyValueTypeStates[3] = {
+	{ 0, 3, 4 }, { 4, 2, 2 }, { 6, 3, 4 }
+};
+static void iso1KeyValueTypeUsed(void* value, uint8_t flag) {
+	struct iso1KeyValueType* iso1KeyValueType = (struct iso1KeyValueType*)value;
+	switch(flag) {
+	case 0:
+		iso1KeyValueType->DSAKeyValue_isUsed = 1u;
+		break;
+	case 1:
+		iso1KeyValueType->RSAKeyValue_isUsed = 1u;
+		break;
+	case 2:
+		iso1KeyValueType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1KeyValueTypeGrammar = { iso1KeyValueTypeStates, iso1KeyValueTypeTransitions, iso1KeyValueTypeProductions, iso1KeyValueTypeUsed };
+
 static int decode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType* iso1KeyValueType) {
+	init_iso1KeyValueType(iso1KeyValueType);
+	return decodeGrammar(stream, &iso1KeyValueTypeGrammar, iso1KeyValueType);
+}
+#else
+static int decode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType* iso1KeyValueType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 173;
 	int done = 0;
 	
@@ -7371,7 +10345,14 @@ static int decode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType*
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, iso1KeyValueType->DSAKeyValue, 1);
+					if (errn == 0) {
+						errn = decode_iso1DSAKeyValueType(stream, iso1KeyValueType->DSAKeyValue);
+					}
+#else
 					errn = decode_iso1DSAKeyValueType(stream, &iso1KeyValueType->DSAKeyValue);
+#endif /* DATABINDING_SLIM */
 					iso1KeyValueType->DSAKeyValue_isUsed = 1u;
 					grammarID = 174;
 					break;
@@ -7390,10 +10371,24 @@ static int decode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType*
 					if (errn == 0) {
 						if (iso1KeyValueType->ANY.charactersLen >= 2) {
 							iso1KeyValueType->ANY.charactersLen = (uint16_t)(iso1KeyValueType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1KeyValueType->ANY.characters, CHARACTER_UNITS(iso1KeyValueType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1KeyValueType->ANY.charactersLen, iso1KeyValueType->ANY.characters, iso1KeyValueType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1KeyValueType->ANY.charactersLen, iso1KeyValueType->ANY.characters, iso1KeyValueType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, iso1KeyValueType->ANY.characters, iso1KeyValueType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &iso1KeyValueType->ANY.charactersLen, &iso1KeyValueType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &iso1KeyValueType->ANY.charactersLen, iso1KeyValueType->ANY.characters, iso1KeyValueType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1KeyValueType->ANY_isUsed = 1u;
@@ -7419,10 +10414,24 @@ static int decode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType*
 					if (errn == 0) {
 						if (iso1KeyValueType->ANY.charactersLen >= 2) {
 							iso1KeyValueType->ANY.charactersLen = (uint16_t)(iso1KeyValueType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1KeyValueType->ANY.characters, CHARACTER_UNITS(iso1KeyValueType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1KeyValueType->ANY.charactersLen, iso1KeyValueType->ANY.characters, iso1KeyValueType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1KeyValueType->ANY.charactersLen, iso1KeyValueType->ANY.characters, iso1KeyValueType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, iso1KeyValueType->ANY.characters, iso1KeyValueType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &iso1KeyValueType->ANY.charactersLen, &iso1KeyValueType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &iso1KeyValueType->ANY.charactersLen, iso1KeyValueType->ANY.characters, iso1KeyValueType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1KeyValueType->ANY_isUsed = 1u;
@@ -7440,7 +10449,14 @@ static int decode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType*
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, iso1KeyValueType->DSAKeyValue, 1);
+					if (errn == 0) {
+						errn = decode_iso1DSAKeyValueType(stream, iso1KeyValueType->DSAKeyValue);
+					}
+#else
 					errn = decode_iso1DSAKeyValueType(stream, &iso1KeyValueType->DSAKeyValue);
+#endif /* DATABINDING_SLIM */
 					iso1KeyValueType->DSAKeyValue_isUsed = 1u;
 					grammarID = 174;
 					break;
@@ -7459,10 +10475,24 @@ static int decode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType*
 					if (errn == 0) {
 						if (iso1KeyValueType->ANY.charactersLen >= 2) {
 							iso1KeyValueType->ANY.charactersLen = (uint16_t)(iso1KeyValueType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1KeyValueType->ANY.characters, CHARACTER_UNITS(iso1KeyValueType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1KeyValueType->ANY.charactersLen, iso1KeyValueType->ANY.characters, iso1KeyValueType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1KeyValueType->ANY.charactersLen, iso1KeyValueType->ANY.characters, iso1KeyValueType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, iso1KeyValueType->ANY.characters, iso1KeyValueType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &iso1KeyValueType->ANY.charactersLen, &iso1KeyValueType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &iso1KeyValueType->ANY.charactersLen, iso1KeyValueType->ANY.characters, iso1KeyValueType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1KeyValueType->ANY_isUsed = 1u;
@@ -7484,9 +10514,35 @@ static int decode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType*
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SelectedServiceListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":SelectedService{1-16})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SelectedServiceListTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE, offsetof(struct iso1SelectedServiceListType, SelectedService.array), offsetof(struct iso1SelectedServiceListType, SelectedService.arrayLen), sizeof(((struct iso1SelectedServiceListType*)0)->SelectedService.array[0]), 0, 0, 0, 0, decode_iso1SelectedServiceTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SelectedServiceListTypeTransitions[32] = {
+	{ 1, 0 }, { 2, 0 }, { 0, 1 }, { 3, 0 }, { 0, 1 }, { 4, 0 }, { 0, 1 }, { 5, 0 },
+	{ 0, 1 }, { 6, 0 }, { 0, 1 }, { 7, 0 }, { 0, 1 }, { 8, 0 }, { 0, 1 }, { 9, 0 },
+	{ 0, 1 }, { 10, 0 }, { 0, 1 }, { 11, 0 }, { 0, 1 }, { 12, 0 }, { 0, 1 }, { 13, 0 },
+	{ 0, 1 }, { 14, 0 }, { 0, 1 }, { 15, 0 }, { 0, 1 }, { 16, 0 }, { 0, 1 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1SelectedServiceListTypeStates[17] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 2, 2 }, { 5, 2, 2 }, { 7, 2, 2 }, { 9, 2, 2 }, { 11, 2, 2 }, { 13, 2, 2 },
+	{ 15, 2, 2 }, { 17, 2, 2 }, { 19, 2, 2 }, { 21, 2, 2 }, { 23, 2, 2 }, { 25, 2, 2 }, { 27, 2, 2 }, { 29, 2, 2 },
+	{ 31, 1, 1 }
+};
+static const exi_grammar_t iso1SelectedServiceListTypeGrammar = { iso1SelectedServiceListTypeStates, iso1SelectedServiceListTypeTransitions, iso1SelectedServiceListTypeProductions, NULL };
+
 static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1SelectedServiceListType* iso1SelectedServiceListType) {
+	init_iso1SelectedServiceListType(iso1SelectedServiceListType);
+	return decodeGrammar(stream, &iso1SelectedServiceListTypeGrammar, iso1SelectedServiceListType);
+}
+#else
+static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1SelectedServiceListType* iso1SelectedServiceListType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 176;
 	int done = 0;
 	
@@ -7500,7 +10556,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7519,7 +10584,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7542,7 +10616,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7565,7 +10648,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7588,7 +10680,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7611,7 +10712,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7634,7 +10744,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7657,7 +10776,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7680,7 +10808,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7703,7 +10840,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7726,7 +10872,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7749,7 +10904,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7772,7 +10936,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7795,7 +10968,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7818,7 +11000,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7841,7 +11032,16 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SelectedServiceListType->SelectedService.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SelectedServiceListType->SelectedService.array, iso1SelectedServiceListType_SelectedService_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#else
 					if (iso1SelectedServiceListType->SelectedService.arrayLen < iso1SelectedServiceListType_SelectedService_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SelectedServiceType(stream, &iso1SelectedServiceListType->SelectedService.array[iso1SelectedServiceListType->SelectedService.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -7883,9 +11083,34 @@ static int decode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CableCheckResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2013:MsgBody":EVSEProcessing)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1CableCheckResTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CableCheckResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CableCheckResType, DC_EVSEStatus), 0, 0, 0, decode_iso1DC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(iso1EVSEProcessingType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CableCheckResType, EVSEProcessing), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1CableCheckResTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1CableCheckResTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t iso1CableCheckResTypeGrammar = { iso1CableCheckResTypeStates, iso1CableCheckResTypeTransitions, iso1CableCheckResTypeProductions, NULL };
+
 static int decode_iso1CableCheckResType(bitstream_t* stream, struct iso1CableCheckResType* iso1CableCheckResType) {
+	init_iso1CableCheckResType(iso1CableCheckResType);
+	return decodeGrammar(stream, &iso1CableCheckResTypeGrammar, iso1CableCheckResType);
+}
+#else
+static int decode_iso1CableCheckResType(bitstream_t* stream, struct iso1CableCheckResType* iso1CableCheckResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 192;
 	int done = 0;
 	
@@ -7999,9 +11224,13 @@ static int decode_iso1CableCheckResType(bitstream_t* stream, struct iso1CableChe
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_CableCheckRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509IssuerSerialType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":X509IssuerName,"http://www.w3.org/2000/09/xmldsig#":X509SerialNumber)',  derivedBy='RESTRICTION'.  */
 static int decode_iso1X509IssuerSerialType(bitstream_t* stream, struct iso1X509IssuerSerialType* iso1X509IssuerSerialType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 194;
 	int done = 0;
 	
@@ -8023,10 +11252,24 @@ static int decode_iso1X509IssuerSerialType(bitstream_t* stream, struct iso1X509I
 							if (errn == 0) {
 								if (iso1X509IssuerSerialType->X509IssuerName.charactersLen >= 2) {
 									iso1X509IssuerSerialType->X509IssuerName.charactersLen = (uint16_t)(iso1X509IssuerSerialType->X509IssuerName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1X509IssuerSerialType->X509IssuerName.characters, CHARACTER_UNITS(iso1X509IssuerSerialType->X509IssuerName.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1X509IssuerSerialType->X509IssuerName.charactersLen, iso1X509IssuerSerialType->X509IssuerName.characters, iso1X509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1X509IssuerSerialType->X509IssuerName.charactersLen, iso1X509IssuerSerialType->X509IssuerName.characters, iso1X509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, iso1X509IssuerSerialType->X509IssuerName.characters, iso1X509IssuerSerialType->X509IssuerName.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, &iso1X509IssuerSerialType->X509IssuerName.charactersLen, &iso1X509IssuerSerialType->X509IssuerName.characters);
+#else
+									errn = decodeStringValueHit(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, &iso1X509IssuerSerialType->X509IssuerName.charactersLen, iso1X509IssuerSerialType->X509IssuerName.characters, iso1X509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -8109,7 +11352,51 @@ static int decode_iso1X509IssuerSerialType(bitstream_t* stream, struct iso1X509I
 }
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyInfoType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":KeyName|"http://www.w3.org/2000/09/xmldsig#":KeyValue|"http://www.w3.org/2000/09/xmldsig#":RetrievalMethod|"http://www.w3.org/2000/09/xmldsig#":X509Data|"http://www.w3.org/2000/09/xmldsig#":PGPData|"http://www.w3.org/2000/09/xmldsig#":SPKIData|"http://www.w3.org/2000/09/xmldsig#":MgmtData|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1KeyInfoTypeProductions[11] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1KeyInfoType, Id.characters), offsetof(struct iso1KeyInfoType, Id.charactersLen), iso1KeyInfoType_Id_CHARACTERS_SIZE, 27 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1KeyInfoType_KeyName_ARRAY_SIZE, offsetof(struct iso1KeyInfoType, KeyName.array), offsetof(struct iso1KeyInfoType, KeyName.arrayLen), sizeof(((struct iso1KeyInfoType*)0)->KeyName.array[0]), (offsetof(struct iso1KeyInfoType, KeyName.array[0].characters) - offsetof(struct iso1KeyInfoType, KeyName.array)), (offsetof(struct iso1KeyInfoType, KeyName.array[0].charactersLen) - offsetof(struct iso1KeyInfoType, KeyName.array)), iso1KeyInfoType_KeyName_CHARACTERS_SIZE, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1KeyInfoType_KeyValue_ARRAY_SIZE, offsetof(struct iso1KeyInfoType, KeyValue.array), offsetof(struct iso1KeyInfoType, KeyValue.arrayLen), sizeof(((struct iso1KeyInfoType*)0)->KeyValue.array[0]), 0, 0, 0, 0, decode_iso1KeyValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1KeyInfoType_RetrievalMethod_ARRAY_SIZE, offsetof(struct iso1KeyInfoType, RetrievalMethod.array), offsetof(struct iso1KeyInfoType, RetrievalMethod.arrayLen), sizeof(((struct iso1KeyInfoType*)0)->RetrievalMethod.array[0]), 0, 0, 0, 0, decode_iso1RetrievalMethodTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1KeyInfoType_X509Data_ARRAY_SIZE, offsetof(struct iso1KeyInfoType, X509Data.array), offsetof(struct iso1KeyInfoType, X509Data.arrayLen), sizeof(((struct iso1KeyInfoType*)0)->X509Data.array[0]), 0, 0, 0, 0, decode_iso1X509DataTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1KeyInfoType_PGPData_ARRAY_SIZE, offsetof(struct iso1KeyInfoType, PGPData.array), offsetof(struct iso1KeyInfoType, PGPData.arrayLen), sizeof(((struct iso1KeyInfoType*)0)->PGPData.array[0]), 0, 0, 0, 0, decode_iso1PGPDataTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1KeyInfoType_SPKIData_ARRAY_SIZE, offsetof(struct iso1KeyInfoType, SPKIData.array), offsetof(struct iso1KeyInfoType, SPKIData.arrayLen), sizeof(((struct iso1KeyInfoType*)0)->SPKIData.array[0]), 0, 0, 0, 0, decode_iso1SPKIDataTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1KeyInfoType_MgmtData_ARRAY_SIZE, offsetof(struct iso1KeyInfoType, MgmtData.array), offsetof(struct iso1KeyInfoType, MgmtData.arrayLen), sizeof(((struct iso1KeyInfoType*)0)->MgmtData.array[0]), (offsetof(struct iso1KeyInfoType, MgmtData.array[0].characters) - offsetof(struct iso1KeyInfoType, MgmtData.array)), (offsetof(struct iso1KeyInfoType, MgmtData.array[0].charactersLen) - offsetof(struct iso1KeyInfoType, MgmtData.array)), iso1KeyInfoType_MgmtData_CHARACTERS_SIZE, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1KeyInfoType, ANY.characters), offsetof(struct iso1KeyInfoType, ANY.charactersLen), iso1KeyInfoType_ANY_CHARACTERS_SIZE, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1KeyInfoTypeTransitions[38] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 2, 4 }, { 2, 5 }, { 2, 6 }, { 2, 7 },
+	{ 2, 8 }, { 3, 9 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 2, 4 }, { 2, 5 }, { 2, 6 },
+	{ 2, 7 }, { 2, 8 }, { 3, 9 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 2, 4 }, { 2, 5 },
+	{ 2, 6 }, { 2, 7 }, { 2, 8 }, { 0, 10 }, { 2, 9 }, { 2, 1 }, { 2, 2 }, { 2, 3 },
+	{ 2, 4 }, { 2, 5 }, { 2, 6 }, { 2, 7 }, { 2, 8 }, { 3, 9 }
+};
+static const exi_grammar_state_t iso1KeyInfoTypeStates[4] = {
+	{ 0, 4, 10 }, { 10, 4, 9 }, { 19, 4, 10 }, { 29, 4, 9 }
+};
+static void iso1KeyInfoTypeUsed(void* value, uint8_t flag) {
+	struct iso1KeyInfoType* iso1KeyInfoType = (struct iso1KeyInfoType*)value;
+	switch(flag) {
+	case 0:
+		iso1KeyInfoType->Id_isUsed = 1u;
+		break;
+	case 1:
+		iso1KeyInfoType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1KeyInfoTypeGrammar = { iso1KeyInfoTypeStates, iso1KeyInfoTypeTransitions, iso1KeyInfoTypeProductions, iso1KeyInfoTypeUsed };
+
 static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* iso1KeyInfoType) {
+	init_iso1KeyInfoType(iso1KeyInfoType);
+	return decodeGrammar(stream, &iso1KeyInfoTypeGrammar, iso1KeyInfoType);
+}
+#else
+static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* iso1KeyInfoType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 196;
 	int done = 0;
 	
@@ -8127,10 +11414,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					if (errn == 0) {
 						if (iso1KeyInfoType->Id.charactersLen >= 2) {
 							iso1KeyInfoType->Id.charactersLen = (uint16_t)(iso1KeyInfoType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->Id.characters, CHARACTER_UNITS(iso1KeyInfoType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1KeyInfoType->Id.charactersLen, iso1KeyInfoType->Id.characters, iso1KeyInfoType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1KeyInfoType->Id.charactersLen, iso1KeyInfoType->Id.characters, iso1KeyInfoType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 27 /* {}Id */, iso1KeyInfoType->Id.characters, iso1KeyInfoType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 27 /* {}Id */, &iso1KeyInfoType->Id.charactersLen, &iso1KeyInfoType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 27 /* {}Id */, &iso1KeyInfoType->Id.charactersLen, iso1KeyInfoType->Id.characters, iso1KeyInfoType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1KeyInfoType->Id_isUsed = 1u;
@@ -8146,10 +11447,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 								if (errn == 0) {
 									if (iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen >= 2) {
 										iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen = (uint16_t)(iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, CHARACTER_UNITS(iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType_KeyName_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, &iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								iso1KeyInfoType->KeyName.arrayLen++;
@@ -8188,7 +11503,16 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					grammarID = 198;
 					break;
 				case 4:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1KeyInfoType->X509Data.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->X509Data.array, iso1KeyInfoType_X509Data_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1KeyInfoType->X509Data.arrayLen < iso1KeyInfoType_X509Data_ARRAY_SIZE) {
+#else
 					if (iso1KeyInfoType->X509Data.arrayLen < iso1KeyInfoType_X509Data_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1X509DataType(stream, &iso1KeyInfoType->X509Data.array[iso1KeyInfoType->X509Data.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -8221,10 +11545,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 								if (errn == 0) {
 									if (iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen >= 2) {
 										iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen = (uint16_t)(iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, CHARACTER_UNITS(iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType_MgmtData_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, &iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								iso1KeyInfoType->MgmtData.arrayLen++;
@@ -8256,10 +11594,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					if (errn == 0) {
 						if (iso1KeyInfoType->ANY.charactersLen >= 2) {
 							iso1KeyInfoType->ANY.charactersLen = (uint16_t)(iso1KeyInfoType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->ANY.characters, CHARACTER_UNITS(iso1KeyInfoType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1KeyInfoType->ANY.charactersLen, iso1KeyInfoType->ANY.characters, iso1KeyInfoType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1KeyInfoType->ANY.charactersLen, iso1KeyInfoType->ANY.characters, iso1KeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, iso1KeyInfoType->ANY.characters, iso1KeyInfoType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &iso1KeyInfoType->ANY.charactersLen, &iso1KeyInfoType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &iso1KeyInfoType->ANY.charactersLen, iso1KeyInfoType->ANY.characters, iso1KeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1KeyInfoType->ANY_isUsed = 1u;
@@ -8286,10 +11638,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 								if (errn == 0) {
 									if (iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen >= 2) {
 										iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen = (uint16_t)(iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, CHARACTER_UNITS(iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType_KeyName_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, &iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								iso1KeyInfoType->KeyName.arrayLen++;
@@ -8328,7 +11694,16 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					grammarID = 198;
 					break;
 				case 3:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1KeyInfoType->X509Data.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->X509Data.array, iso1KeyInfoType_X509Data_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1KeyInfoType->X509Data.arrayLen < iso1KeyInfoType_X509Data_ARRAY_SIZE) {
+#else
 					if (iso1KeyInfoType->X509Data.arrayLen < iso1KeyInfoType_X509Data_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1X509DataType(stream, &iso1KeyInfoType->X509Data.array[iso1KeyInfoType->X509Data.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -8361,10 +11736,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 								if (errn == 0) {
 									if (iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen >= 2) {
 										iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen = (uint16_t)(iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, CHARACTER_UNITS(iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType_MgmtData_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, &iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								iso1KeyInfoType->MgmtData.arrayLen++;
@@ -8396,10 +11785,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					if (errn == 0) {
 						if (iso1KeyInfoType->ANY.charactersLen >= 2) {
 							iso1KeyInfoType->ANY.charactersLen = (uint16_t)(iso1KeyInfoType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->ANY.characters, CHARACTER_UNITS(iso1KeyInfoType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1KeyInfoType->ANY.charactersLen, iso1KeyInfoType->ANY.characters, iso1KeyInfoType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1KeyInfoType->ANY.charactersLen, iso1KeyInfoType->ANY.characters, iso1KeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, iso1KeyInfoType->ANY.characters, iso1KeyInfoType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &iso1KeyInfoType->ANY.charactersLen, &iso1KeyInfoType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &iso1KeyInfoType->ANY.charactersLen, iso1KeyInfoType->ANY.characters, iso1KeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1KeyInfoType->ANY_isUsed = 1u;
@@ -8426,10 +11829,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 								if (errn == 0) {
 									if (iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen >= 2) {
 										iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen = (uint16_t)(iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, CHARACTER_UNITS(iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType_KeyName_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, &iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								iso1KeyInfoType->KeyName.arrayLen++;
@@ -8468,7 +11885,16 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					grammarID = 198;
 					break;
 				case 3:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1KeyInfoType->X509Data.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->X509Data.array, iso1KeyInfoType_X509Data_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1KeyInfoType->X509Data.arrayLen < iso1KeyInfoType_X509Data_ARRAY_SIZE) {
+#else
 					if (iso1KeyInfoType->X509Data.arrayLen < iso1KeyInfoType_X509Data_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1X509DataType(stream, &iso1KeyInfoType->X509Data.array[iso1KeyInfoType->X509Data.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -8501,10 +11927,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 								if (errn == 0) {
 									if (iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen >= 2) {
 										iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen = (uint16_t)(iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, CHARACTER_UNITS(iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType_MgmtData_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, &iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								iso1KeyInfoType->MgmtData.arrayLen++;
@@ -8540,10 +11980,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					if (errn == 0) {
 						if (iso1KeyInfoType->ANY.charactersLen >= 2) {
 							iso1KeyInfoType->ANY.charactersLen = (uint16_t)(iso1KeyInfoType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->ANY.characters, CHARACTER_UNITS(iso1KeyInfoType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1KeyInfoType->ANY.charactersLen, iso1KeyInfoType->ANY.characters, iso1KeyInfoType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1KeyInfoType->ANY.charactersLen, iso1KeyInfoType->ANY.characters, iso1KeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, iso1KeyInfoType->ANY.characters, iso1KeyInfoType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &iso1KeyInfoType->ANY.charactersLen, &iso1KeyInfoType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &iso1KeyInfoType->ANY.charactersLen, iso1KeyInfoType->ANY.characters, iso1KeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1KeyInfoType->ANY_isUsed = 1u;
@@ -8570,10 +12024,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 								if (errn == 0) {
 									if (iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen >= 2) {
 										iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen = (uint16_t)(iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, CHARACTER_UNITS(iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType_KeyName_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, &iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].charactersLen, iso1KeyInfoType->KeyName.array[iso1KeyInfoType->KeyName.arrayLen].characters, iso1KeyInfoType_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								iso1KeyInfoType->KeyName.arrayLen++;
@@ -8612,7 +12080,16 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					grammarID = 198;
 					break;
 				case 3:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1KeyInfoType->X509Data.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->X509Data.array, iso1KeyInfoType_X509Data_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1KeyInfoType->X509Data.arrayLen < iso1KeyInfoType_X509Data_ARRAY_SIZE) {
+#else
 					if (iso1KeyInfoType->X509Data.arrayLen < iso1KeyInfoType_X509Data_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1X509DataType(stream, &iso1KeyInfoType->X509Data.array[iso1KeyInfoType->X509Data.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -8645,10 +12122,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 								if (errn == 0) {
 									if (iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen >= 2) {
 										iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen = (uint16_t)(iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, CHARACTER_UNITS(iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType_MgmtData_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, &iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].charactersLen, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType->MgmtData.arrayLen].characters, iso1KeyInfoType_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								iso1KeyInfoType->MgmtData.arrayLen++;
@@ -8680,10 +12171,24 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					if (errn == 0) {
 						if (iso1KeyInfoType->ANY.charactersLen >= 2) {
 							iso1KeyInfoType->ANY.charactersLen = (uint16_t)(iso1KeyInfoType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1KeyInfoType->ANY.characters, CHARACTER_UNITS(iso1KeyInfoType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1KeyInfoType->ANY.charactersLen, iso1KeyInfoType->ANY.characters, iso1KeyInfoType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1KeyInfoType->ANY.charactersLen, iso1KeyInfoType->ANY.characters, iso1KeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, iso1KeyInfoType->ANY.characters, iso1KeyInfoType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &iso1KeyInfoType->ANY.charactersLen, &iso1KeyInfoType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &iso1KeyInfoType->ANY.charactersLen, iso1KeyInfoType->ANY.characters, iso1KeyInfoType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1KeyInfoType->ANY_isUsed = 1u;
@@ -8705,9 +12210,30 @@ static int decode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transform{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1TransformsTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1TransformsType_Transform_ARRAY_SIZE, offsetof(struct iso1TransformsType, Transform.array), offsetof(struct iso1TransformsType, Transform.arrayLen), sizeof(((struct iso1TransformsType*)0)->Transform.array[0]), 0, 0, 0, 0, decode_iso1TransformTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1TransformsTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1TransformsTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t iso1TransformsTypeGrammar = { iso1TransformsTypeStates, iso1TransformsTypeTransitions, iso1TransformsTypeProductions, NULL };
+
 static int decode_iso1TransformsType(bitstream_t* stream, struct iso1TransformsType* iso1TransformsType) {
+	init_iso1TransformsType(iso1TransformsType);
+	return decodeGrammar(stream, &iso1TransformsTypeGrammar, iso1TransformsType);
+}
+#else
+static int decode_iso1TransformsType(bitstream_t* stream, struct iso1TransformsType* iso1TransformsType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 200;
 	int done = 0;
 	
@@ -8767,9 +12293,53 @@ static int decode_iso1TransformsType(bitstream_t* stream, struct iso1TransformsT
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ChargeParameterDiscoveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":MaxEntriesSAScheduleTuple{0-1},"urn:iso:15118:2:2013:MsgBody":RequestedEnergyTransferMode,"urn:iso:15118:2:2013:MsgDataTypes":EVChargeParameter)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1ChargeParameterDiscoveryReqTypeProductions[6] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeParameterDiscoveryReqType, MaxEntriesSAScheduleTuple), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 3, sizeof(iso1EnergyTransferModeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeParameterDiscoveryReqType, RequestedEnergyTransferMode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeParameterDiscoveryReqType, AC_EVChargeParameter), 0, 0, 0, decode_iso1AC_EVChargeParameterTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeParameterDiscoveryReqType, DC_EVChargeParameter), 0, 0, 0, decode_iso1DC_EVChargeParameterTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct iso1ChargeParameterDiscoveryReqType, EVChargeParameter), 0, 0, 0, decode_iso1EVChargeParameterTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ChargeParameterDiscoveryReqTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 3, 3 }, { 3, 4 }, { 0, 5 }
+};
+static const exi_grammar_state_t iso1ChargeParameterDiscoveryReqTypeStates[4] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 3 }, { 6, 1, 1 }
+};
+static void iso1ChargeParameterDiscoveryReqTypeUsed(void* value, uint8_t flag) {
+	struct iso1ChargeParameterDiscoveryReqType* iso1ChargeParameterDiscoveryReqType = (struct iso1ChargeParameterDiscoveryReqType*)value;
+	switch(flag) {
+	case 0:
+		iso1ChargeParameterDiscoveryReqType->MaxEntriesSAScheduleTuple_isUsed = 1u;
+		break;
+	case 1:
+		iso1ChargeParameterDiscoveryReqType->AC_EVChargeParameter_isUsed = 1u;
+		break;
+	case 2:
+		iso1ChargeParameterDiscoveryReqType->DC_EVChargeParameter_isUsed = 1u;
+		break;
+	case 3:
+		iso1ChargeParameterDiscoveryReqType->EVChargeParameter_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ChargeParameterDiscoveryReqTypeGrammar = { iso1ChargeParameterDiscoveryReqTypeStates, iso1ChargeParameterDiscoveryReqTypeTransitions, iso1ChargeParameterDiscoveryReqTypeProductions, iso1ChargeParameterDiscoveryReqTypeUsed };
+
+static int decode_iso1ChargeParameterDiscoveryReqType(bitstream_t* stream, struct iso1ChargeParameterDiscoveryReqType* iso1ChargeParameterDiscoveryReqType) {
+	init_iso1ChargeParameterDiscoveryReqType(iso1ChargeParameterDiscoveryReqType);
+	return decodeGrammar(stream, &iso1ChargeParameterDiscoveryReqTypeGrammar, iso1ChargeParameterDiscoveryReqType);
+}
+#else
 static int decode_iso1ChargeParameterDiscoveryReqType(bitstream_t* stream, struct iso1ChargeParameterDiscoveryReqType* iso1ChargeParameterDiscoveryReqType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 202;
 	int done = 0;
 	
@@ -8916,9 +12486,34 @@ static int decode_iso1ChargeParameterDiscoveryReqType(bitstream_t* stream, struc
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PreChargeReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":DC_EVStatus,"urn:iso:15118:2:2013:MsgBody":EVTargetVoltage,"urn:iso:15118:2:2013:MsgBody":EVTargetCurrent)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1PreChargeReqTypeProductions[4] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PreChargeReqType, DC_EVStatus), 0, 0, 0, decode_iso1DC_EVStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PreChargeReqType, EVTargetVoltage), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PreChargeReqType, EVTargetCurrent), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PreChargeReqTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1PreChargeReqTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t iso1PreChargeReqTypeGrammar = { iso1PreChargeReqTypeStates, iso1PreChargeReqTypeTransitions, iso1PreChargeReqTypeProductions, NULL };
+
+static int decode_iso1PreChargeReqType(bitstream_t* stream, struct iso1PreChargeReqType* iso1PreChargeReqType) {
+	init_iso1PreChargeReqType(iso1PreChargeReqType);
+	return decodeGrammar(stream, &iso1PreChargeReqTypeGrammar, iso1PreChargeReqType);
+}
+#else
 static int decode_iso1PreChargeReqType(bitstream_t* stream, struct iso1PreChargeReqType* iso1PreChargeReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 205;
 	int done = 0;
 	
@@ -8996,9 +12591,33 @@ static int decode_iso1PreChargeReqType(bitstream_t* stream, struct iso1PreCharge
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_PreChargeReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EVSEStatusType',  base type name='anyType',  content type='ELEMENT',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":NotificationMaxDelay,"urn:iso:15118:2:2013:MsgDataTypes":EVSENotification)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1EVSEStatusTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1EVSEStatusType, NotificationMaxDelay), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(iso1EVSENotificationType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1EVSEStatusType, EVSENotification), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1EVSEStatusTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1EVSEStatusTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t iso1EVSEStatusTypeGrammar = { iso1EVSEStatusTypeStates, iso1EVSEStatusTypeTransitions, iso1EVSEStatusTypeProductions, NULL };
+
+static int decode_iso1EVSEStatusType(bitstream_t* stream, struct iso1EVSEStatusType* iso1EVSEStatusType) {
+	init_iso1EVSEStatusType(iso1EVSEStatusType);
+	return decodeGrammar(stream, &iso1EVSEStatusTypeGrammar, iso1EVSEStatusType);
+}
+#else
 static int decode_iso1EVSEStatusType(bitstream_t* stream, struct iso1EVSEStatusType* iso1EVSEStatusType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 208;
 	int done = 0;
 	
@@ -9096,9 +12715,45 @@ static int decode_iso1EVSEStatusType(bitstream_t* stream, struct iso1EVSEStatusT
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":HMACOutputLength{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SignatureMethodTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SignatureMethodType, Algorithm.characters), offsetof(struct iso1SignatureMethodType, Algorithm.charactersLen), iso1SignatureMethodType_Algorithm_CHARACTERS_SIZE, 25 /* {}Algorithm */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER64, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1SignatureMethodType, HMACOutputLength), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1SignatureMethodType, ANY.characters), offsetof(struct iso1SignatureMethodType, ANY.charactersLen), iso1SignatureMethodType_ANY_CHARACTERS_SIZE, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, NULL }
+};
+static const exi_grammar_transition_t iso1SignatureMethodTypeTransitions[12] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 0, 3 }, { 3, 4 }, { 2, 2 }, { 0, 3 }, { 2, 4 },
+	{ 2, 1 }, { 2, 2 }, { 0, 3 }, { 3, 4 }
+};
+static const exi_grammar_state_t iso1SignatureMethodTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 3, 4 }, { 5, 2, 3 }, { 8, 3, 4 }
+};
+static void iso1SignatureMethodTypeUsed(void* value, uint8_t flag) {
+	struct iso1SignatureMethodType* iso1SignatureMethodType = (struct iso1SignatureMethodType*)value;
+	switch(flag) {
+	case 0:
+		iso1SignatureMethodType->HMACOutputLength_isUsed = 1u;
+		break;
+	case 1:
+		iso1SignatureMethodType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1SignatureMethodTypeGrammar = { iso1SignatureMethodTypeStates, iso1SignatureMethodTypeTransitions, iso1SignatureMethodTypeProductions, iso1SignatureMethodTypeUsed };
+
 static int decode_iso1SignatureMethodType(bitstream_t* stream, struct iso1SignatureMethodType* iso1SignatureMethodType) {
+	init_iso1SignatureMethodType(iso1SignatureMethodType);
+	return decodeGrammar(stream, &iso1SignatureMethodTypeGrammar, iso1SignatureMethodType);
+}
+#else
+static int decode_iso1SignatureMethodType(bitstream_t* stream, struct iso1SignatureMethodType* iso1SignatureMethodType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 210;
 	int done = 0;
 	
@@ -9116,10 +12771,24 @@ static int decode_iso1SignatureMethodType(bitstream_t* stream, struct iso1Signat
 					if (errn == 0) {
 						if (iso1SignatureMethodType->Algorithm.charactersLen >= 2) {
 							iso1SignatureMethodType->Algorithm.charactersLen = (uint16_t)(iso1SignatureMethodType->Algorithm.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignatureMethodType->Algorithm.characters, CHARACTER_UNITS(iso1SignatureMethodType->Algorithm.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignatureMethodType->Algorithm.charactersLen, iso1SignatureMethodType->Algorithm.characters, iso1SignatureMethodType_Algorithm_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignatureMethodType->Algorithm.charactersLen, iso1SignatureMethodType->Algorithm.characters, iso1SignatureMethodType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Algorithm */, iso1SignatureMethodType->Algorithm.characters, iso1SignatureMethodType->Algorithm.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Algorithm */, &iso1SignatureMethodType->Algorithm.charactersLen, &iso1SignatureMethodType->Algorithm.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Algorithm */, &iso1SignatureMethodType->Algorithm.charactersLen, iso1SignatureMethodType->Algorithm.characters, iso1SignatureMethodType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 211;
@@ -9171,10 +12840,24 @@ static int decode_iso1SignatureMethodType(bitstream_t* stream, struct iso1Signat
 					if (errn == 0) {
 						if (iso1SignatureMethodType->ANY.charactersLen >= 2) {
 							iso1SignatureMethodType->ANY.charactersLen = (uint16_t)(iso1SignatureMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignatureMethodType->ANY.characters, CHARACTER_UNITS(iso1SignatureMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignatureMethodType->ANY.charactersLen, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignatureMethodType->ANY.charactersLen, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &iso1SignatureMethodType->ANY.charactersLen, &iso1SignatureMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &iso1SignatureMethodType->ANY.charactersLen, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1SignatureMethodType->ANY_isUsed = 1u;
@@ -9205,10 +12888,24 @@ static int decode_iso1SignatureMethodType(bitstream_t* stream, struct iso1Signat
 					if (errn == 0) {
 						if (iso1SignatureMethodType->ANY.charactersLen >= 2) {
 							iso1SignatureMethodType->ANY.charactersLen = (uint16_t)(iso1SignatureMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignatureMethodType->ANY.characters, CHARACTER_UNITS(iso1SignatureMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignatureMethodType->ANY.charactersLen, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignatureMethodType->ANY.charactersLen, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &iso1SignatureMethodType->ANY.charactersLen, &iso1SignatureMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &iso1SignatureMethodType->ANY.charactersLen, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1SignatureMethodType->ANY_isUsed = 1u;
@@ -9261,10 +12958,24 @@ static int decode_iso1SignatureMethodType(bitstream_t* stream, struct iso1Signat
 					if (errn == 0) {
 						if (iso1SignatureMethodType->ANY.charactersLen >= 2) {
 							iso1SignatureMethodType->ANY.charactersLen = (uint16_t)(iso1SignatureMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignatureMethodType->ANY.characters, CHARACTER_UNITS(iso1SignatureMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignatureMethodType->ANY.charactersLen, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignatureMethodType->ANY.charactersLen, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &iso1SignatureMethodType->ANY.charactersLen, &iso1SignatureMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &iso1SignatureMethodType->ANY.charactersLen, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1SignatureMethodType->ANY_isUsed = 1u;
@@ -9286,9 +12997,36 @@ static int decode_iso1SignatureMethodType(bitstream_t* stream, struct iso1Signat
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509DataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":X509IssuerSerial|"http://www.w3.org/2000/09/xmldsig#":X509SKI|"http://www.w3.org/2000/09/xmldsig#":X509SubjectName|"http://www.w3.org/2000/09/xmldsig#":X509Certificate|"http://www.w3.org/2000/09/xmldsig#":X509CRL|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1X509DataTypeProductions[7] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1X509DataType_X509IssuerSerial_ARRAY_SIZE, offsetof(struct iso1X509DataType, X509IssuerSerial.array), offsetof(struct iso1X509DataType, X509IssuerSerial.arrayLen), sizeof(((struct iso1X509DataType*)0)->X509IssuerSerial.array[0]), 0, 0, 0, 0, decode_iso1X509IssuerSerialTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1X509DataType_X509SKI_ARRAY_SIZE, offsetof(struct iso1X509DataType, X509SKI.array), offsetof(struct iso1X509DataType, X509SKI.arrayLen), sizeof(((struct iso1X509DataType*)0)->X509SKI.array[0]), (offsetof(struct iso1X509DataType, X509SKI.array[0].bytes) - offsetof(struct iso1X509DataType, X509SKI.array)), (offsetof(struct iso1X509DataType, X509SKI.array[0].bytesLen) - offsetof(struct iso1X509DataType, X509SKI.array)), iso1X509DataType_X509SKI_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1X509DataType_X509SubjectName_ARRAY_SIZE, offsetof(struct iso1X509DataType, X509SubjectName.array), offsetof(struct iso1X509DataType, X509SubjectName.arrayLen), sizeof(((struct iso1X509DataType*)0)->X509SubjectName.array[0]), (offsetof(struct iso1X509DataType, X509SubjectName.array[0].characters) - offsetof(struct iso1X509DataType, X509SubjectName.array)), (offsetof(struct iso1X509DataType, X509SubjectName.array[0].charactersLen) - offsetof(struct iso1X509DataType, X509SubjectName.array)), iso1X509DataType_X509SubjectName_CHARACTERS_SIZE, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1X509DataType_X509Certificate_ARRAY_SIZE, offsetof(struct iso1X509DataType, X509Certificate.array), offsetof(struct iso1X509DataType, X509Certificate.arrayLen), sizeof(((struct iso1X509DataType*)0)->X509Certificate.array[0]), (offsetof(struct iso1X509DataType, X509Certificate.array[0].bytes) - offsetof(struct iso1X509DataType, X509Certificate.array)), (offsetof(struct iso1X509DataType, X509Certificate.array[0].bytesLen) - offsetof(struct iso1X509DataType, X509Certificate.array)), iso1X509DataType_X509Certificate_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1X509DataType_X509CRL_ARRAY_SIZE, offsetof(struct iso1X509DataType, X509CRL.array), offsetof(struct iso1X509DataType, X509CRL.arrayLen), sizeof(((struct iso1X509DataType*)0)->X509CRL.array[0]), (offsetof(struct iso1X509DataType, X509CRL.array[0].bytes) - offsetof(struct iso1X509DataType, X509CRL.array)), (offsetof(struct iso1X509DataType, X509CRL.array[0].bytesLen) - offsetof(struct iso1X509DataType, X509CRL.array)), iso1X509DataType_X509CRL_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1X509DataTypeTransitions[13] = {
+	{ 1, 0 }, { 1, 1 }, { 1, 2 }, { 1, 3 }, { 1, 4 }, { 1, 5 }, { 1, 0 }, { 1, 1 },
+	{ 1, 2 }, { 1, 3 }, { 1, 4 }, { 1, 5 }, { 0, 6 }
+};
+static const exi_grammar_state_t iso1X509DataTypeStates[2] = {
+	{ 0, 3, 6 }, { 6, 3, 7 }
+};
+static const exi_grammar_t iso1X509DataTypeGrammar = { iso1X509DataTypeStates, iso1X509DataTypeTransitions, iso1X509DataTypeProductions, NULL };
+
 static int decode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType* iso1X509DataType) {
+	init_iso1X509DataType(iso1X509DataType);
+	return decodeGrammar(stream, &iso1X509DataTypeGrammar, iso1X509DataType);
+}
+#else
+static int decode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType* iso1X509DataType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 213;
 	int done = 0;
 	
@@ -9320,7 +13058,14 @@ static int decode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType*
 									errn =  (iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytesLen) <= iso1X509DataType_X509SKI_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytes, iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytesLen, iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytesLen, iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1X509DataType->X509SKI.arrayLen++;
 							} else {
@@ -9351,10 +13096,24 @@ static int decode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType*
 								if (errn == 0) {
 									if (iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen >= 2) {
 										iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen = (uint16_t)(iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].characters, CHARACTER_UNITS(iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].characters, iso1X509DataType_X509SubjectName_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].characters, iso1X509DataType_X509SubjectName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].characters, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen, &iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].characters, iso1X509DataType_X509SubjectName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								iso1X509DataType->X509SubjectName.arrayLen++;
@@ -9387,7 +13146,14 @@ static int decode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType*
 									errn =  (iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytesLen) <= iso1X509DataType_X509Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytes, iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytesLen, iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytesLen, iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1X509DataType->X509Certificate.arrayLen++;
 							} else {
@@ -9419,7 +13185,14 @@ static int decode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType*
 									errn =  (iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytesLen) <= iso1X509DataType_X509CRL_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytes, iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytesLen, iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytesLen, iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1X509DataType->X509CRL.arrayLen++;
 							} else {
@@ -9475,7 +13248,14 @@ static int decode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType*
 									errn =  (iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytesLen) <= iso1X509DataType_X509SKI_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytes, iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytesLen, iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytesLen, iso1X509DataType->X509SKI.array[iso1X509DataType->X509SKI.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1X509DataType->X509SKI.arrayLen++;
 							} else {
@@ -9506,10 +13286,24 @@ static int decode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType*
 								if (errn == 0) {
 									if (iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen >= 2) {
 										iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen = (uint16_t)(iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].characters, CHARACTER_UNITS(iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].characters, iso1X509DataType_X509SubjectName_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].characters, iso1X509DataType_X509SubjectName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].characters, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen, &iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].charactersLen, iso1X509DataType->X509SubjectName.array[iso1X509DataType->X509SubjectName.arrayLen].characters, iso1X509DataType_X509SubjectName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								iso1X509DataType->X509SubjectName.arrayLen++;
@@ -9542,7 +13336,14 @@ static int decode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType*
 									errn =  (iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytesLen) <= iso1X509DataType_X509Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytes, iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytesLen, iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytesLen, iso1X509DataType->X509Certificate.array[iso1X509DataType->X509Certificate.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1X509DataType->X509Certificate.arrayLen++;
 							} else {
@@ -9574,7 +13375,14 @@ static int decode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType*
 									errn =  (iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytesLen) <= iso1X509DataType_X509CRL_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytes, iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytesLen, iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytesLen, iso1X509DataType->X509CRL.array[iso1X509DataType->X509CRL.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1X509DataType->X509CRL.arrayLen++;
 							} else {
@@ -9620,9 +13428,40 @@ static int decode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType*
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,NotificationType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":FaultCode,"urn:iso:15118:2:2013:MsgDataTypes":FaultMsg{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1NotificationTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(iso1faultCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1NotificationType, FaultCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1NotificationType, FaultMsg.characters), offsetof(struct iso1NotificationType, FaultMsg.charactersLen), iso1NotificationType_FaultMsg_CHARACTERS_SIZE, 17 /* {urn:iso:15118:2:2013:MsgDataTypes}FaultMsg */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1NotificationTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1NotificationTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }
+};
+static void iso1NotificationTypeUsed(void* value, uint8_t flag) {
+	struct iso1NotificationType* iso1NotificationType = (struct iso1NotificationType*)value;
+	switch(flag) {
+	case 0:
+		iso1NotificationType->FaultMsg_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1NotificationTypeGrammar = { iso1NotificationTypeStates, iso1NotificationTypeTransitions, iso1NotificationTypeProductions, iso1NotificationTypeUsed };
+
 static int decode_iso1NotificationType(bitstream_t* stream, struct iso1NotificationType* iso1NotificationType) {
+	init_iso1NotificationType(iso1NotificationType);
+	return decodeGrammar(stream, &iso1NotificationTypeGrammar, iso1NotificationType);
+}
+#else
+static int decode_iso1NotificationType(bitstream_t* stream, struct iso1NotificationType* iso1NotificationType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 215;
 	int done = 0;
 	
@@ -9677,10 +13516,24 @@ static int decode_iso1NotificationType(bitstream_t* stream, struct iso1Notificat
 							if (errn == 0) {
 								if (iso1NotificationType->FaultMsg.charactersLen >= 2) {
 									iso1NotificationType->FaultMsg.charactersLen = (uint16_t)(iso1NotificationType->FaultMsg.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1NotificationType->FaultMsg.characters, CHARACTER_UNITS(iso1NotificationType->FaultMsg.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1NotificationType->FaultMsg.charactersLen, iso1NotificationType->FaultMsg.characters, iso1NotificationType_FaultMsg_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1NotificationType->FaultMsg.charactersLen, iso1NotificationType->FaultMsg.characters, iso1NotificationType_FaultMsg_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 17 /* {urn:iso:15118:2:2013:MsgDataTypes}FaultMsg */, iso1NotificationType->FaultMsg.characters, iso1NotificationType->FaultMsg.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 17 /* {urn:iso:15118:2:2013:MsgDataTypes}FaultMsg */, &iso1NotificationType->FaultMsg.charactersLen, &iso1NotificationType->FaultMsg.characters);
+#else
+									errn = decodeStringValueHit(stream, 17 /* {urn:iso:15118:2:2013:MsgDataTypes}FaultMsg */, &iso1NotificationType->FaultMsg.charactersLen, iso1NotificationType->FaultMsg.characters, iso1NotificationType_FaultMsg_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							iso1NotificationType->FaultMsg_isUsed = 1u;
@@ -9734,9 +13587,30 @@ static int decode_iso1NotificationType(bitstream_t* stream, struct iso1Notificat
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SAScheduleListType',  base type name='SASchedulesType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":SAScheduleTuple{1-3})',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SAScheduleListTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1SAScheduleListType_SAScheduleTuple_ARRAY_SIZE, offsetof(struct iso1SAScheduleListType, SAScheduleTuple.array), offsetof(struct iso1SAScheduleListType, SAScheduleTuple.arrayLen), sizeof(((struct iso1SAScheduleListType*)0)->SAScheduleTuple.array[0]), 0, 0, 0, 0, decode_iso1SAScheduleTupleTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SAScheduleListTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 0 }, { 0, 1 }, { 3, 0 }, { 0, 1 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1SAScheduleListTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 2, 2 }, { 5, 1, 1 }
+};
+static const exi_grammar_t iso1SAScheduleListTypeGrammar = { iso1SAScheduleListTypeStates, iso1SAScheduleListTypeTransitions, iso1SAScheduleListTypeProductions, NULL };
+
+static int decode_iso1SAScheduleListType(bitstream_t* stream, struct iso1SAScheduleListType* iso1SAScheduleListType) {
+	init_iso1SAScheduleListType(iso1SAScheduleListType);
+	return decodeGrammar(stream, &iso1SAScheduleListTypeGrammar, iso1SAScheduleListType);
+}
+#else
 static int decode_iso1SAScheduleListType(bitstream_t* stream, struct iso1SAScheduleListType* iso1SAScheduleListType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 217;
 	int done = 0;
 	
@@ -9750,7 +13624,16 @@ static int decode_iso1SAScheduleListType(bitstream_t* stream, struct iso1SASched
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SAScheduleListType->SAScheduleTuple.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SAScheduleListType->SAScheduleTuple.array, iso1SAScheduleListType_SAScheduleTuple_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SAScheduleListType->SAScheduleTuple.arrayLen < iso1SAScheduleListType_SAScheduleTuple_ARRAY_SIZE) {
+#else
 					if (iso1SAScheduleListType->SAScheduleTuple.arrayLen < iso1SAScheduleListType_SAScheduleTuple_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SAScheduleTupleType(stream, &iso1SAScheduleListType->SAScheduleTuple.array[iso1SAScheduleListType->SAScheduleTuple.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -9769,7 +13652,16 @@ static int decode_iso1SAScheduleListType(bitstream_t* stream, struct iso1SASched
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SAScheduleListType->SAScheduleTuple.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SAScheduleListType->SAScheduleTuple.array, iso1SAScheduleListType_SAScheduleTuple_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SAScheduleListType->SAScheduleTuple.arrayLen < iso1SAScheduleListType_SAScheduleTuple_ARRAY_SIZE) {
+#else
 					if (iso1SAScheduleListType->SAScheduleTuple.arrayLen < iso1SAScheduleListType_SAScheduleTuple_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SAScheduleTupleType(stream, &iso1SAScheduleListType->SAScheduleTuple.array[iso1SAScheduleListType->SAScheduleTuple.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -9792,7 +13684,16 @@ static int decode_iso1SAScheduleListType(bitstream_t* stream, struct iso1SASched
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SAScheduleListType->SAScheduleTuple.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SAScheduleListType->SAScheduleTuple.array, iso1SAScheduleListType_SAScheduleTuple_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SAScheduleListType->SAScheduleTuple.arrayLen < iso1SAScheduleListType_SAScheduleTuple_ARRAY_SIZE) {
+#else
 					if (iso1SAScheduleListType->SAScheduleTuple.arrayLen < iso1SAScheduleListType_SAScheduleTuple_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SAScheduleTupleType(stream, &iso1SAScheduleListType->SAScheduleTuple.array[iso1SAScheduleListType->SAScheduleTuple.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -9834,9 +13735,318 @@ static int decode_iso1SAScheduleListType(bitstream_t* stream, struct iso1SASched
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,BodyType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":BodyElement{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1BodyTypeProductions[36] = {
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, AuthorizationReq), 0, 0, 0, decode_iso1AuthorizationReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_AuthorizationReq */
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, AuthorizationRes), 0, 0, 0, decode_iso1AuthorizationResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_AuthorizationRes */
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, BodyElement), 0, 0, 0, decode_iso1BodyBaseTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_BodyElement */
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, CableCheckReq), 0, 0, 0, decode_iso1CableCheckReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_CableCheckReq */
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, CableCheckRes), 0, 0, 0, decode_iso1CableCheckResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_CableCheckRes */
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, CertificateInstallationReq), 0, 0, 0, decode_iso1CertificateInstallationReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, CertificateInstallationRes), 0, 0, 0, decode_iso1CertificateInstallationResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, CertificateUpdateReq), 0, 0, 0, decode_iso1CertificateUpdateReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, CertificateUpdateRes), 0, 0, 0, decode_iso1CertificateUpdateResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, ChargeParameterDiscoveryReq), 0, 0, 0, decode_iso1ChargeParameterDiscoveryReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, ChargeParameterDiscoveryRes), 0, 0, 0, decode_iso1ChargeParameterDiscoveryResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, ChargingStatusReq), 0, 0, 0, decode_iso1ChargingStatusReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, ChargingStatusRes), 0, 0, 0, decode_iso1ChargingStatusResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, CurrentDemandReq), 0, 0, 0, decode_iso1CurrentDemandReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, CurrentDemandRes), 0, 0, 0, decode_iso1CurrentDemandResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, MeteringReceiptReq), 0, 0, 0, decode_iso1MeteringReceiptReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, MeteringReceiptRes), 0, 0, 0, decode_iso1MeteringReceiptResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, PaymentDetailsReq), 0, 0, 0, decode_iso1PaymentDetailsReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, PaymentDetailsRes), 0, 0, 0, decode_iso1PaymentDetailsResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, PaymentServiceSelectionReq), 0, 0, 0, decode_iso1PaymentServiceSelectionReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, PaymentServiceSelectionRes), 0, 0, 0, decode_iso1PaymentServiceSelectionResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, PowerDeliveryReq), 0, 0, 0, decode_iso1PowerDeliveryReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, PowerDeliveryRes), 0, 0, 0, decode_iso1PowerDeliveryResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, PreChargeReq), 0, 0, 0, decode_iso1PreChargeReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_PreChargeReq */
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, PreChargeRes), 0, 0, 0, decode_iso1PreChargeResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_PreChargeRes */
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, ServiceDetailReq), 0, 0, 0, decode_iso1ServiceDetailReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, ServiceDetailRes), 0, 0, 0, decode_iso1ServiceDetailResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, ServiceDiscoveryReq), 0, 0, 0, decode_iso1ServiceDiscoveryReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, ServiceDiscoveryRes), 0, 0, 0, decode_iso1ServiceDiscoveryResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, SessionSetupReq), 0, 0, 0, decode_iso1SessionSetupReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_SessionSetupReq */
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, SessionSetupRes), 0, 0, 0, decode_iso1SessionSetupResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_SessionSetupRes */
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, SessionStopReq), 0, 0, 0, decode_iso1SessionStopReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_SessionStopReq */
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, SessionStopRes), 0, 0, 0, decode_iso1SessionStopResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_SessionStopRes */
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, WeldingDetectionReq), 0, 0, 0, decode_iso1WeldingDetectionReqTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, offsetof(struct iso1BodyType, WeldingDetectionRes), 0, 0, 0, decode_iso1WeldingDetectionResTypeGeneric },
+#else
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1BodyTypeTransitions[37] = {
+	{ 1, 0 }, { 1, 1 }, { 1, 2 }, { 1, 3 }, { 1, 4 }, { 1, 5 }, { 1, 6 }, { 1, 7 },
+	{ 1, 8 }, { 1, 9 }, { 1, 10 }, { 1, 11 }, { 1, 12 }, { 1, 13 }, { 1, 14 }, { 1, 15 },
+	{ 1, 16 }, { 1, 17 }, { 1, 18 }, { 1, 19 }, { 1, 20 }, { 1, 21 }, { 1, 22 }, { 1, 23 },
+	{ 1, 24 }, { 1, 25 }, { 1, 26 }, { 1, 27 }, { 1, 28 }, { 1, 29 }, { 1, 30 }, { 1, 31 },
+	{ 1, 32 }, { 1, 33 }, { 1, 34 }, { 0, 35 }, { 0, 35 }
+};
+static const exi_grammar_state_t iso1BodyTypeStates[2] = {
+	{ 0, 6, 36 }, { 36, 1, 1 }
+};
+static void iso1BodyTypeUsed(void* value, uint8_t flag) {
+	struct iso1BodyType* iso1BodyType = (struct iso1BodyType*)value;
+	switch(flag) {
+	case 0:
+		iso1BodyType->AuthorizationReq_isUsed = 1u;
+		break;
+	case 1:
+		iso1BodyType->AuthorizationRes_isUsed = 1u;
+		break;
+	case 2:
+		iso1BodyType->BodyElement_isUsed = 1u;
+		break;
+	case 3:
+		iso1BodyType->CableCheckReq_isUsed = 1u;
+		break;
+	case 4:
+		iso1BodyType->CableCheckRes_isUsed = 1u;
+		break;
+	case 5:
+		iso1BodyType->CertificateInstallationReq_isUsed = 1u;
+		break;
+	case 6:
+		iso1BodyType->CertificateInstallationRes_isUsed = 1u;
+		break;
+	case 7:
+		iso1BodyType->CertificateUpdateReq_isUsed = 1u;
+		break;
+	case 8:
+		iso1BodyType->CertificateUpdateRes_isUsed = 1u;
+		break;
+	case 9:
+		iso1BodyType->ChargeParameterDiscoveryReq_isUsed = 1u;
+		break;
+	case 10:
+		iso1BodyType->ChargeParameterDiscoveryRes_isUsed = 1u;
+		break;
+	case 11:
+		iso1BodyType->ChargingStatusReq_isUsed = 1u;
+		break;
+	case 12:
+		iso1BodyType->ChargingStatusRes_isUsed = 1u;
+		break;
+	case 13:
+		iso1BodyType->CurrentDemandReq_isUsed = 1u;
+		break;
+	case 14:
+		iso1BodyType->CurrentDemandRes_isUsed = 1u;
+		break;
+	case 15:
+		iso1BodyType->MeteringReceiptReq_isUsed = 1u;
+		break;
+	case 16:
+		iso1BodyType->MeteringReceiptRes_isUsed = 1u;
+		break;
+	case 17:
+		iso1BodyType->PaymentDetailsReq_isUsed = 1u;
+		break;
+	case 18:
+		iso1BodyType->PaymentDetailsRes_isUsed = 1u;
+		break;
+	case 19:
+		iso1BodyType->PaymentServiceSelectionReq_isUsed = 1u;
+		break;
+	case 20:
+		iso1BodyType->PaymentServiceSelectionRes_isUsed = 1u;
+		break;
+	case 21:
+		iso1BodyType->PowerDeliveryReq_isUsed = 1u;
+		break;
+	case 22:
+		iso1BodyType->PowerDeliveryRes_isUsed = 1u;
+		break;
+	case 23:
+		iso1BodyType->PreChargeReq_isUsed = 1u;
+		break;
+	case 24:
+		iso1BodyType->PreChargeRes_isUsed = 1u;
+		break;
+	case 25:
+		iso1BodyType->ServiceDetailReq_isUsed = 1u;
+		break;
+	case 26:
+		iso1BodyType->ServiceDetailRes_isUsed = 1u;
+		break;
+	case 27:
+		iso1BodyType->ServiceDiscoveryReq_isUsed = 1u;
+		break;
+	case 28:
+		iso1BodyType->ServiceDiscoveryRes_isUsed = 1u;
+		break;
+	case 29:
+		iso1BodyType->SessionSetupReq_isUsed = 1u;
+		break;
+	case 30:
+		iso1BodyType->SessionSetupRes_isUsed = 1u;
+		break;
+	case 31:
+		iso1BodyType->SessionStopReq_isUsed = 1u;
+		break;
+	case 32:
+		iso1BodyType->SessionStopRes_isUsed = 1u;
+		break;
+	case 33:
+		iso1BodyType->WeldingDetectionReq_isUsed = 1u;
+		break;
+	case 34:
+		iso1BodyType->WeldingDetectionRes_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1BodyTypeGrammar = { iso1BodyTypeStates, iso1BodyTypeTransitions, iso1BodyTypeProductions, iso1BodyTypeUsed };
+
+static int decode_iso1BodyType(bitstream_t* stream, struct iso1BodyType* iso1BodyType) {
+	init_iso1BodyType(iso1BodyType);
+	return decodeGrammar(stream, &iso1BodyTypeGrammar, iso1BodyType);
+}
+#else
 static int decode_iso1BodyType(bitstream_t* stream, struct iso1BodyType* iso1BodyType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 220;
 	int done = 0;
 	
@@ -9849,181 +14059,251 @@ static int decode_iso1BodyType(bitstream_t* stream, struct iso1BodyType* iso1Bod
 			errn = decodeNBitUnsignedInteger(stream, 6, &eventCode);
 			if (errn == 0) {
 				switch(eventCode) {
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
 				case 0:
 					errn = decode_iso1AuthorizationReqType(stream, &iso1BodyType->AuthorizationReq);
 					iso1BodyType->AuthorizationReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_AuthorizationReq */
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
 				case 1:
 					errn = decode_iso1AuthorizationResType(stream, &iso1BodyType->AuthorizationRes);
 					iso1BodyType->AuthorizationRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_AuthorizationRes */
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
 				case 2:
 					errn = decode_iso1BodyBaseType(stream, &iso1BodyType->BodyElement);
 					iso1BodyType->BodyElement_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_BodyElement */
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
 				case 3:
 					errn = decode_iso1CableCheckReqType(stream, &iso1BodyType->CableCheckReq);
 					iso1BodyType->CableCheckReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_CableCheckReq */
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
 				case 4:
 					errn = decode_iso1CableCheckResType(stream, &iso1BodyType->CableCheckRes);
 					iso1BodyType->CableCheckRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_CableCheckRes */
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 				case 5:
 					errn = decode_iso1CertificateInstallationReqType(stream, &iso1BodyType->CertificateInstallationReq);
 					iso1BodyType->CertificateInstallationReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 				case 6:
 					errn = decode_iso1CertificateInstallationResType(stream, &iso1BodyType->CertificateInstallationRes);
 					iso1BodyType->CertificateInstallationRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 				case 7:
 					errn = decode_iso1CertificateUpdateReqType(stream, &iso1BodyType->CertificateUpdateReq);
 					iso1BodyType->CertificateUpdateReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 				case 8:
 					errn = decode_iso1CertificateUpdateResType(stream, &iso1BodyType->CertificateUpdateRes);
 					iso1BodyType->CertificateUpdateRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 				case 9:
 					errn = decode_iso1ChargeParameterDiscoveryReqType(stream, &iso1BodyType->ChargeParameterDiscoveryReq);
 					iso1BodyType->ChargeParameterDiscoveryReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 				case 10:
 					errn = decode_iso1ChargeParameterDiscoveryResType(stream, &iso1BodyType->ChargeParameterDiscoveryRes);
 					iso1BodyType->ChargeParameterDiscoveryRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
 				case 11:
 					errn = decode_iso1ChargingStatusReqType(stream, &iso1BodyType->ChargingStatusReq);
 					iso1BodyType->ChargingStatusReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
 				case 12:
 					errn = decode_iso1ChargingStatusResType(stream, &iso1BodyType->ChargingStatusRes);
 					iso1BodyType->ChargingStatusRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
 				case 13:
 					errn = decode_iso1CurrentDemandReqType(stream, &iso1BodyType->CurrentDemandReq);
 					iso1BodyType->CurrentDemandReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
 				case 14:
 					errn = decode_iso1CurrentDemandResType(stream, &iso1BodyType->CurrentDemandRes);
 					iso1BodyType->CurrentDemandRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 				case 15:
 					errn = decode_iso1MeteringReceiptReqType(stream, &iso1BodyType->MeteringReceiptReq);
 					iso1BodyType->MeteringReceiptReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 				case 16:
 					errn = decode_iso1MeteringReceiptResType(stream, &iso1BodyType->MeteringReceiptRes);
 					iso1BodyType->MeteringReceiptRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 				case 17:
 					errn = decode_iso1PaymentDetailsReqType(stream, &iso1BodyType->PaymentDetailsReq);
 					iso1BodyType->PaymentDetailsReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 				case 18:
 					errn = decode_iso1PaymentDetailsResType(stream, &iso1BodyType->PaymentDetailsRes);
 					iso1BodyType->PaymentDetailsRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 				case 19:
 					errn = decode_iso1PaymentServiceSelectionReqType(stream, &iso1BodyType->PaymentServiceSelectionReq);
 					iso1BodyType->PaymentServiceSelectionReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 				case 20:
 					errn = decode_iso1PaymentServiceSelectionResType(stream, &iso1BodyType->PaymentServiceSelectionRes);
 					iso1BodyType->PaymentServiceSelectionRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 				case 21:
 					errn = decode_iso1PowerDeliveryReqType(stream, &iso1BodyType->PowerDeliveryReq);
 					iso1BodyType->PowerDeliveryReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 				case 22:
 					errn = decode_iso1PowerDeliveryResType(stream, &iso1BodyType->PowerDeliveryRes);
 					iso1BodyType->PowerDeliveryRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
 				case 23:
 					errn = decode_iso1PreChargeReqType(stream, &iso1BodyType->PreChargeReq);
 					iso1BodyType->PreChargeReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_PreChargeReq */
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
 				case 24:
 					errn = decode_iso1PreChargeResType(stream, &iso1BodyType->PreChargeRes);
 					iso1BodyType->PreChargeRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_PreChargeRes */
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
 				case 25:
 					errn = decode_iso1ServiceDetailReqType(stream, &iso1BodyType->ServiceDetailReq);
 					iso1BodyType->ServiceDetailReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
 				case 26:
 					errn = decode_iso1ServiceDetailResType(stream, &iso1BodyType->ServiceDetailRes);
 					iso1BodyType->ServiceDetailRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 				case 27:
 					errn = decode_iso1ServiceDiscoveryReqType(stream, &iso1BodyType->ServiceDiscoveryReq);
 					iso1BodyType->ServiceDiscoveryReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 				case 28:
 					errn = decode_iso1ServiceDiscoveryResType(stream, &iso1BodyType->ServiceDiscoveryRes);
 					iso1BodyType->ServiceDiscoveryRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
 				case 29:
 					errn = decode_iso1SessionSetupReqType(stream, &iso1BodyType->SessionSetupReq);
 					iso1BodyType->SessionSetupReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_SessionSetupReq */
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
 				case 30:
 					errn = decode_iso1SessionSetupResType(stream, &iso1BodyType->SessionSetupRes);
 					iso1BodyType->SessionSetupRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_SessionSetupRes */
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
 				case 31:
 					errn = decode_iso1SessionStopReqType(stream, &iso1BodyType->SessionStopReq);
 					iso1BodyType->SessionStopReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_SessionStopReq */
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
 				case 32:
 					errn = decode_iso1SessionStopResType(stream, &iso1BodyType->SessionStopRes);
 					iso1BodyType->SessionStopRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_SessionStopRes */
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 				case 33:
 					errn = decode_iso1WeldingDetectionReqType(stream, &iso1BodyType->WeldingDetectionReq);
 					iso1BodyType->WeldingDetectionReq_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 				case 34:
 					errn = decode_iso1WeldingDetectionResType(stream, &iso1BodyType->WeldingDetectionRes);
 					iso1BodyType->WeldingDetectionRes_isUsed = 1u;
 					grammarID = 3;
 					break;
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
 				case 35:
 					done = 1;
 					grammarID = 4;
@@ -10059,9 +14339,38 @@ static int decode_iso1BodyType(bitstream_t* stream, struct iso1BodyType* iso1Bod
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ChargingProfileType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ProfileEntry{1-24})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ChargingProfileTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE, offsetof(struct iso1ChargingProfileType, ProfileEntry.array), offsetof(struct iso1ChargingProfileType, ProfileEntry.arrayLen), sizeof(((struct iso1ChargingProfileType*)0)->ProfileEntry.array[0]), 0, 0, 0, 0, decode_iso1ProfileEntryTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ChargingProfileTypeTransitions[48] = {
+	{ 1, 0 }, { 2, 0 }, { 0, 1 }, { 3, 0 }, { 0, 1 }, { 4, 0 }, { 0, 1 }, { 5, 0 },
+	{ 0, 1 }, { 6, 0 }, { 0, 1 }, { 7, 0 }, { 0, 1 }, { 8, 0 }, { 0, 1 }, { 9, 0 },
+	{ 0, 1 }, { 10, 0 }, { 0, 1 }, { 11, 0 }, { 0, 1 }, { 12, 0 }, { 0, 1 }, { 13, 0 },
+	{ 0, 1 }, { 14, 0 }, { 0, 1 }, { 15, 0 }, { 0, 1 }, { 16, 0 }, { 0, 1 }, { 17, 0 },
+	{ 0, 1 }, { 18, 0 }, { 0, 1 }, { 19, 0 }, { 0, 1 }, { 20, 0 }, { 0, 1 }, { 21, 0 },
+	{ 0, 1 }, { 22, 0 }, { 0, 1 }, { 23, 0 }, { 0, 1 }, { 24, 0 }, { 0, 1 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1ChargingProfileTypeStates[25] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 2, 2 }, { 5, 2, 2 }, { 7, 2, 2 }, { 9, 2, 2 }, { 11, 2, 2 }, { 13, 2, 2 },
+	{ 15, 2, 2 }, { 17, 2, 2 }, { 19, 2, 2 }, { 21, 2, 2 }, { 23, 2, 2 }, { 25, 2, 2 }, { 27, 2, 2 }, { 29, 2, 2 },
+	{ 31, 2, 2 }, { 33, 2, 2 }, { 35, 2, 2 }, { 37, 2, 2 }, { 39, 2, 2 }, { 41, 2, 2 }, { 43, 2, 2 }, { 45, 2, 2 },
+	{ 47, 1, 1 }
+};
+static const exi_grammar_t iso1ChargingProfileTypeGrammar = { iso1ChargingProfileTypeStates, iso1ChargingProfileTypeTransitions, iso1ChargingProfileTypeProductions, NULL };
+
+static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1ChargingProfileType* iso1ChargingProfileType) {
+	init_iso1ChargingProfileType(iso1ChargingProfileType);
+	return decodeGrammar(stream, &iso1ChargingProfileTypeGrammar, iso1ChargingProfileType);
+}
+#else
 static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1ChargingProfileType* iso1ChargingProfileType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 221;
 	int done = 0;
 	
@@ -10075,7 +14384,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10094,7 +14412,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10117,7 +14444,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10140,7 +14476,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10163,7 +14508,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10186,7 +14540,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10209,7 +14572,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10232,7 +14604,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10255,7 +14636,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10278,7 +14668,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10301,7 +14700,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10324,7 +14732,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10347,7 +14764,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10370,7 +14796,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10393,7 +14828,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10416,7 +14860,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10439,7 +14892,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10462,7 +14924,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10485,7 +14956,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10508,7 +14988,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10531,7 +15020,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10554,7 +15052,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10577,7 +15084,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10600,7 +15116,16 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1ChargingProfileType->ProfileEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ChargingProfileType->ProfileEntry.array, iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#else
 					if (iso1ChargingProfileType->ProfileEntry.arrayLen < iso1ChargingProfileType_ProfileEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ProfileEntryType(stream, &iso1ChargingProfileType->ProfileEntry.array[iso1ChargingProfileType->ProfileEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -10642,9 +15167,42 @@ static int decode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])|"http://www.w3.org/2000/09/xmldsig#":XPath){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1TransformTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1TransformType, Algorithm.characters), offsetof(struct iso1TransformType, Algorithm.charactersLen), iso1TransformType_Algorithm_CHARACTERS_SIZE, 25 /* {}Algorithm */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1TransformType_XPath_ARRAY_SIZE, offsetof(struct iso1TransformType, XPath.array), offsetof(struct iso1TransformType, XPath.arrayLen), sizeof(((struct iso1TransformType*)0)->XPath.array[0]), (offsetof(struct iso1TransformType, XPath.array[0].characters) - offsetof(struct iso1TransformType, XPath.array)), (offsetof(struct iso1TransformType, XPath.array[0].charactersLen) - offsetof(struct iso1TransformType, XPath.array)), iso1TransformType_XPath_CHARACTERS_SIZE, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1TransformType, ANY.characters), offsetof(struct iso1TransformType, ANY.charactersLen), iso1TransformType_ANY_CHARACTERS_SIZE, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, NULL }
+};
+static const exi_grammar_transition_t iso1TransformTypeTransitions[9] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 0, 3 }, { 2, 4 }, { 2, 1 }, { 2, 2 }, { 0, 3 },
+	{ 2, 4 }
+};
+static const exi_grammar_state_t iso1TransformTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 3, 4 }, { 5, 3, 4 }
+};
+static void iso1TransformTypeUsed(void* value, uint8_t flag) {
+	struct iso1TransformType* iso1TransformType = (struct iso1TransformType*)value;
+	switch(flag) {
+	case 0:
+		iso1TransformType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1TransformTypeGrammar = { iso1TransformTypeStates, iso1TransformTypeTransitions, iso1TransformTypeProductions, iso1TransformTypeUsed };
+
+static int decode_iso1TransformType(bitstream_t* stream, struct iso1TransformType* iso1TransformType) {
+	init_iso1TransformType(iso1TransformType);
+	return decodeGrammar(stream, &iso1TransformTypeGrammar, iso1TransformType);
+}
+#else
 static int decode_iso1TransformType(bitstream_t* stream, struct iso1TransformType* iso1TransformType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 245;
 	int done = 0;
 	
@@ -10662,10 +15220,24 @@ static int decode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 					if (errn == 0) {
 						if (iso1TransformType->Algorithm.charactersLen >= 2) {
 							iso1TransformType->Algorithm.charactersLen = (uint16_t)(iso1TransformType->Algorithm.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1TransformType->Algorithm.characters, CHARACTER_UNITS(iso1TransformType->Algorithm.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1TransformType->Algorithm.charactersLen, iso1TransformType->Algorithm.characters, iso1TransformType_Algorithm_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1TransformType->Algorithm.charactersLen, iso1TransformType->Algorithm.characters, iso1TransformType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Algorithm */, iso1TransformType->Algorithm.characters, iso1TransformType->Algorithm.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Algorithm */, &iso1TransformType->Algorithm.charactersLen, &iso1TransformType->Algorithm.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Algorithm */, &iso1TransformType->Algorithm.charactersLen, iso1TransformType->Algorithm.characters, iso1TransformType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 246;
@@ -10691,10 +15263,24 @@ static int decode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 								if (errn == 0) {
 									if (iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen >= 2) {
 										iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen = (uint16_t)(iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].characters, CHARACTER_UNITS(iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].characters, iso1TransformType_XPath_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].characters, iso1TransformType_XPath_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].characters, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen, &iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].characters, iso1TransformType_XPath_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								iso1TransformType->XPath.arrayLen++;
@@ -10730,10 +15316,24 @@ static int decode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 					if (errn == 0) {
 						if (iso1TransformType->ANY.charactersLen >= 2) {
 							iso1TransformType->ANY.charactersLen = (uint16_t)(iso1TransformType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1TransformType->ANY.characters, CHARACTER_UNITS(iso1TransformType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1TransformType->ANY.charactersLen, iso1TransformType->ANY.characters, iso1TransformType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1TransformType->ANY.charactersLen, iso1TransformType->ANY.characters, iso1TransformType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, iso1TransformType->ANY.characters, iso1TransformType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, &iso1TransformType->ANY.charactersLen, &iso1TransformType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, &iso1TransformType->ANY.charactersLen, iso1TransformType->ANY.characters, iso1TransformType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1TransformType->ANY_isUsed = 1u;
@@ -10760,10 +15360,24 @@ static int decode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 								if (errn == 0) {
 									if (iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen >= 2) {
 										iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen = (uint16_t)(iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+										errn = EXI_ARENA_ALLOCATE(stream, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].characters, CHARACTER_UNITS(iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen));
+										if (errn == 0) {
+											errn = decodeCharacters(stream, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].characters, iso1TransformType_XPath_CHARACTERS_SIZE);
+										}
+#else
 										errn = decodeCharacters(stream, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].characters, iso1TransformType_XPath_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+										if (errn == 0) {
+											errn = addStringValue(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].characters, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+										errn = decodeStringValueHitArena(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen, &iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].characters);
+#else
+										errn = decodeStringValueHit(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].charactersLen, iso1TransformType->XPath.array[iso1TransformType->XPath.arrayLen].characters, iso1TransformType_XPath_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 									}
 								}
 								iso1TransformType->XPath.arrayLen++;
@@ -10799,10 +15413,24 @@ static int decode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 					if (errn == 0) {
 						if (iso1TransformType->ANY.charactersLen >= 2) {
 							iso1TransformType->ANY.charactersLen = (uint16_t)(iso1TransformType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1TransformType->ANY.characters, CHARACTER_UNITS(iso1TransformType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1TransformType->ANY.charactersLen, iso1TransformType->ANY.characters, iso1TransformType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1TransformType->ANY.charactersLen, iso1TransformType->ANY.characters, iso1TransformType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, iso1TransformType->ANY.characters, iso1TransformType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, &iso1TransformType->ANY.charactersLen, &iso1TransformType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, &iso1TransformType->ANY.charactersLen, iso1TransformType->ANY.characters, iso1TransformType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1TransformType->ANY_isUsed = 1u;
@@ -10824,9 +15452,41 @@ static int decode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SAScheduleTupleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":SAScheduleTupleID,"urn:iso:15118:2:2013:MsgDataTypes":PMaxSchedule,"urn:iso:15118:2:2013:MsgDataTypes":SalesTariff{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1SAScheduleTupleTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(uint8_t), 1, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SAScheduleTupleType, SAScheduleTupleID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SAScheduleTupleType, PMaxSchedule), 0, 0, 0, decode_iso1PMaxScheduleTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1SAScheduleTupleType, SalesTariff), 0, 0, 0, decode_iso1SalesTariffTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SAScheduleTupleTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1SAScheduleTupleTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }
+};
+static void iso1SAScheduleTupleTypeUsed(void* value, uint8_t flag) {
+	struct iso1SAScheduleTupleType* iso1SAScheduleTupleType = (struct iso1SAScheduleTupleType*)value;
+	switch(flag) {
+	case 0:
+		iso1SAScheduleTupleType->SalesTariff_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1SAScheduleTupleTypeGrammar = { iso1SAScheduleTupleTypeStates, iso1SAScheduleTupleTypeTransitions, iso1SAScheduleTupleTypeProductions, iso1SAScheduleTupleTypeUsed };
+
+static int decode_iso1SAScheduleTupleType(bitstream_t* stream, struct iso1SAScheduleTupleType* iso1SAScheduleTupleType) {
+	init_iso1SAScheduleTupleType(iso1SAScheduleTupleType);
+	return decodeGrammar(stream, &iso1SAScheduleTupleTypeGrammar, iso1SAScheduleTupleType);
+}
+#else
 static int decode_iso1SAScheduleTupleType(bitstream_t* stream, struct iso1SAScheduleTupleType* iso1SAScheduleTupleType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 248;
 	int done = 0;
 	
@@ -10927,9 +15587,42 @@ static int decode_iso1SAScheduleTupleType(bitstream_t* stream, struct iso1SASche
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,AC_EVChargeParameterType',  base type name='EVChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":DepartureTime{0-1}),("urn:iso:15118:2:2013:MsgDataTypes":EAmount,"urn:iso:15118:2:2013:MsgDataTypes":EVMaxVoltage,"urn:iso:15118:2:2013:MsgDataTypes":EVMaxCurrent,"urn:iso:15118:2:2013:MsgDataTypes":EVMinCurrent))',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1AC_EVChargeParameterTypeProductions[6] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1AC_EVChargeParameterType, DepartureTime), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AC_EVChargeParameterType, EAmount), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AC_EVChargeParameterType, EVMaxVoltage), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AC_EVChargeParameterType, EVMaxCurrent), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AC_EVChargeParameterType, EVMinCurrent), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1AC_EVChargeParameterTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 0, 5 }
+};
+static const exi_grammar_state_t iso1AC_EVChargeParameterTypeStates[6] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }, { 6, 1, 1 }
+};
+static void iso1AC_EVChargeParameterTypeUsed(void* value, uint8_t flag) {
+	struct iso1AC_EVChargeParameterType* iso1AC_EVChargeParameterType = (struct iso1AC_EVChargeParameterType*)value;
+	switch(flag) {
+	case 0:
+		iso1AC_EVChargeParameterType->DepartureTime_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1AC_EVChargeParameterTypeGrammar = { iso1AC_EVChargeParameterTypeStates, iso1AC_EVChargeParameterTypeTransitions, iso1AC_EVChargeParameterTypeProductions, iso1AC_EVChargeParameterTypeUsed };
+
+static int decode_iso1AC_EVChargeParameterType(bitstream_t* stream, struct iso1AC_EVChargeParameterType* iso1AC_EVChargeParameterType) {
+	init_iso1AC_EVChargeParameterType(iso1AC_EVChargeParameterType);
+	return decodeGrammar(stream, &iso1AC_EVChargeParameterTypeGrammar, iso1AC_EVChargeParameterType);
+}
+#else
 static int decode_iso1AC_EVChargeParameterType(bitstream_t* stream, struct iso1AC_EVChargeParameterType* iso1AC_EVChargeParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 251;
 	int done = 0;
 	
@@ -11059,9 +15752,31 @@ static int decode_iso1AC_EVChargeParameterType(bitstream_t* stream, struct iso1A
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDef,#AnonType_V2G_Message',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDef":Header,"urn:iso:15118:2:2013:MsgDef":Body)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1AnonType_V2G_MessageProductions[3] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AnonType_V2G_Message, Header), 0, 0, 0, decode_iso1MessageHeaderTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AnonType_V2G_Message, Body), 0, 0, 0, decode_iso1BodyTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1AnonType_V2G_MessageTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1AnonType_V2G_MessageStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t iso1AnonType_V2G_MessageGrammar = { iso1AnonType_V2G_MessageStates, iso1AnonType_V2G_MessageTransitions, iso1AnonType_V2G_MessageProductions, NULL };
+
+static int decode_iso1AnonType_V2G_Message(bitstream_t* stream, struct iso1AnonType_V2G_Message* iso1AnonType_V2G_Message) {
+	init_iso1AnonType_V2G_Message(iso1AnonType_V2G_Message);
+	return decodeGrammar(stream, &iso1AnonType_V2G_MessageGrammar, iso1AnonType_V2G_Message);
+}
+#else
 static int decode_iso1AnonType_V2G_Message(bitstream_t* stream, struct iso1AnonType_V2G_Message* iso1AnonType_V2G_Message) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 256;
 	int done = 0;
 	
@@ -11124,9 +15839,34 @@ static int decode_iso1AnonType_V2G_Message(bitstream_t* stream, struct iso1AnonT
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PaymentDetailsResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":GenChallenge,"urn:iso:15118:2:2013:MsgBody":EVSETimeStamp)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1PaymentDetailsResTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PaymentDetailsResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PaymentDetailsResType, GenChallenge.bytes), offsetof(struct iso1PaymentDetailsResType, GenChallenge.bytesLen), iso1PaymentDetailsResType_GenChallenge_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER64, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PaymentDetailsResType, EVSETimeStamp), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PaymentDetailsResTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1PaymentDetailsResTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t iso1PaymentDetailsResTypeGrammar = { iso1PaymentDetailsResTypeStates, iso1PaymentDetailsResTypeTransitions, iso1PaymentDetailsResTypeProductions, NULL };
+
+static int decode_iso1PaymentDetailsResType(bitstream_t* stream, struct iso1PaymentDetailsResType* iso1PaymentDetailsResType) {
+	init_iso1PaymentDetailsResType(iso1PaymentDetailsResType);
+	return decodeGrammar(stream, &iso1PaymentDetailsResTypeGrammar, iso1PaymentDetailsResType);
+}
+#else
 static int decode_iso1PaymentDetailsResType(bitstream_t* stream, struct iso1PaymentDetailsResType* iso1PaymentDetailsResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 258;
 	int done = 0;
 	
@@ -11262,9 +16002,32 @@ static int decode_iso1PaymentDetailsResType(bitstream_t* stream, struct iso1Paym
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ContractSignatureEncryptedPrivateKeyType',  base type name='privateKeyType',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ContractSignatureEncryptedPrivateKeyTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ContractSignatureEncryptedPrivateKeyType, Id.characters), offsetof(struct iso1ContractSignatureEncryptedPrivateKeyType, Id.charactersLen), iso1ContractSignatureEncryptedPrivateKeyType_Id_CHARACTERS_SIZE, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ContractSignatureEncryptedPrivateKeyType, CONTENT.bytes), offsetof(struct iso1ContractSignatureEncryptedPrivateKeyType, CONTENT.bytesLen), iso1ContractSignatureEncryptedPrivateKeyType_CONTENT_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ContractSignatureEncryptedPrivateKeyTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1ContractSignatureEncryptedPrivateKeyTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t iso1ContractSignatureEncryptedPrivateKeyTypeGrammar = { iso1ContractSignatureEncryptedPrivateKeyTypeStates, iso1ContractSignatureEncryptedPrivateKeyTypeTransitions, iso1ContractSignatureEncryptedPrivateKeyTypeProductions, NULL };
+
+static int decode_iso1ContractSignatureEncryptedPrivateKeyType(bitstream_t* stream, struct iso1ContractSignatureEncryptedPrivateKeyType* iso1ContractSignatureEncryptedPrivateKeyType) {
+	init_iso1ContractSignatureEncryptedPrivateKeyType(iso1ContractSignatureEncryptedPrivateKeyType);
+	return decodeGrammar(stream, &iso1ContractSignatureEncryptedPrivateKeyTypeGrammar, iso1ContractSignatureEncryptedPrivateKeyType);
+}
+#else
 static int decode_iso1ContractSignatureEncryptedPrivateKeyType(bitstream_t* stream, struct iso1ContractSignatureEncryptedPrivateKeyType* iso1ContractSignatureEncryptedPrivateKeyType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 23;
 	int done = 0;
 	
@@ -11282,10 +16045,24 @@ static int decode_iso1ContractSignatureEncryptedPrivateKeyType(bitstream_t* stre
 					if (errn == 0) {
 						if (iso1ContractSignatureEncryptedPrivateKeyType->Id.charactersLen >= 2) {
 							iso1ContractSignatureEncryptedPrivateKeyType->Id.charactersLen = (uint16_t)(iso1ContractSignatureEncryptedPrivateKeyType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ContractSignatureEncryptedPrivateKeyType->Id.characters, CHARACTER_UNITS(iso1ContractSignatureEncryptedPrivateKeyType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ContractSignatureEncryptedPrivateKeyType->Id.charactersLen, iso1ContractSignatureEncryptedPrivateKeyType->Id.characters, iso1ContractSignatureEncryptedPrivateKeyType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ContractSignatureEncryptedPrivateKeyType->Id.charactersLen, iso1ContractSignatureEncryptedPrivateKeyType->Id.characters, iso1ContractSignatureEncryptedPrivateKeyType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, iso1ContractSignatureEncryptedPrivateKeyType->Id.characters, iso1ContractSignatureEncryptedPrivateKeyType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, &iso1ContractSignatureEncryptedPrivateKeyType->Id.charactersLen, &iso1ContractSignatureEncryptedPrivateKeyType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, &iso1ContractSignatureEncryptedPrivateKeyType->Id.charactersLen, iso1ContractSignatureEncryptedPrivateKeyType->Id.characters, iso1ContractSignatureEncryptedPrivateKeyType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 24;
@@ -11307,7 +16084,14 @@ static int decode_iso1ContractSignatureEncryptedPrivateKeyType(bitstream_t* stre
 						errn =  (iso1ContractSignatureEncryptedPrivateKeyType->CONTENT.bytesLen) <= iso1ContractSignatureEncryptedPrivateKeyType_CONTENT_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 					}
 					if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+						errn = EXI_ARENA_ALLOCATE(stream, iso1ContractSignatureEncryptedPrivateKeyType->CONTENT.bytes, iso1ContractSignatureEncryptedPrivateKeyType->CONTENT.bytesLen);
+						if (errn == 0) {
+							errn = decodeBytes(stream, iso1ContractSignatureEncryptedPrivateKeyType->CONTENT.bytesLen, iso1ContractSignatureEncryptedPrivateKeyType->CONTENT.bytes);
+						}
+#else
 						errn = decodeBytes(stream, iso1ContractSignatureEncryptedPrivateKeyType->CONTENT.bytesLen, iso1ContractSignatureEncryptedPrivateKeyType->CONTENT.bytes);
+#endif /* DATABINDING_SLIM */
 					}
 					grammarID = 3;
 					break;
@@ -11342,9 +16126,43 @@ static int decode_iso1ContractSignatureEncryptedPrivateKeyType(bitstream_t* stre
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,PMaxScheduleEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":TimeInterval),("urn:iso:15118:2:2013:MsgDataTypes":PMax))',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1PMaxScheduleEntryTypeProductions[4] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1PMaxScheduleEntryType, RelativeTimeInterval), 0, 0, 0, decode_iso1RelativeTimeIntervalTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1PMaxScheduleEntryType, TimeInterval), 0, 0, 0, decode_iso1IntervalTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PMaxScheduleEntryType, PMax), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PMaxScheduleEntryTypeTransitions[4] = {
+	{ 1, 0 }, { 1, 1 }, { 2, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1PMaxScheduleEntryTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static void iso1PMaxScheduleEntryTypeUsed(void* value, uint8_t flag) {
+	struct iso1PMaxScheduleEntryType* iso1PMaxScheduleEntryType = (struct iso1PMaxScheduleEntryType*)value;
+	switch(flag) {
+	case 0:
+		iso1PMaxScheduleEntryType->RelativeTimeInterval_isUsed = 1u;
+		break;
+	case 1:
+		iso1PMaxScheduleEntryType->TimeInterval_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1PMaxScheduleEntryTypeGrammar = { iso1PMaxScheduleEntryTypeStates, iso1PMaxScheduleEntryTypeTransitions, iso1PMaxScheduleEntryTypeProductions, iso1PMaxScheduleEntryTypeUsed };
+
+static int decode_iso1PMaxScheduleEntryType(bitstream_t* stream, struct iso1PMaxScheduleEntryType* iso1PMaxScheduleEntryType) {
+	init_iso1PMaxScheduleEntryType(iso1PMaxScheduleEntryType);
+	return decodeGrammar(stream, &iso1PMaxScheduleEntryTypeGrammar, iso1PMaxScheduleEntryType);
+}
+#else
 static int decode_iso1PMaxScheduleEntryType(bitstream_t* stream, struct iso1PMaxScheduleEntryType* iso1PMaxScheduleEntryType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 261;
 	int done = 0;
 	
@@ -11413,9 +16231,31 @@ static int decode_iso1PMaxScheduleEntryType(bitstream_t* stream, struct iso1PMax
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SPKIDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SPKISexp,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-1}){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SPKIDataTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1SPKIDataType_SPKISexp_ARRAY_SIZE, offsetof(struct iso1SPKIDataType, SPKISexp.array), offsetof(struct iso1SPKIDataType, SPKISexp.arrayLen), sizeof(((struct iso1SPKIDataType*)0)->SPKISexp.array[0]), (offsetof(struct iso1SPKIDataType, SPKISexp.array[0].bytes) - offsetof(struct iso1SPKIDataType, SPKISexp.array)), (offsetof(struct iso1SPKIDataType, SPKISexp.array[0].bytesLen) - offsetof(struct iso1SPKIDataType, SPKISexp.array)), iso1SPKIDataType_SPKISexp_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SPKIDataTypeTransitions[6] = {
+	{ 1, 0 }, { 1, 0 }, { 2, 1 }, { 0, 2 }, { 1, 0 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1SPKIDataTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 2, 2 }
+};
+static const exi_grammar_t iso1SPKIDataTypeGrammar = { iso1SPKIDataTypeStates, iso1SPKIDataTypeTransitions, iso1SPKIDataTypeProductions, NULL };
+
+static int decode_iso1SPKIDataType(bitstream_t* stream, struct iso1SPKIDataType* iso1SPKIDataType) {
+	init_iso1SPKIDataType(iso1SPKIDataType);
+	return decodeGrammar(stream, &iso1SPKIDataTypeGrammar, iso1SPKIDataType);
+}
+#else
 static int decode_iso1SPKIDataType(bitstream_t* stream, struct iso1SPKIDataType* iso1SPKIDataType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 263;
 	int done = 0;
 	
@@ -11439,7 +16279,14 @@ static int decode_iso1SPKIDataType(bitstream_t* stream, struct iso1SPKIDataType*
 									errn =  (iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytesLen) <= iso1SPKIDataType_SPKISexp_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytes, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytesLen, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytesLen, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1SPKIDataType->SPKISexp.arrayLen++;
 							} else {
@@ -11482,7 +16329,14 @@ static int decode_iso1SPKIDataType(bitstream_t* stream, struct iso1SPKIDataType*
 									errn =  (iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytesLen) <= iso1SPKIDataType_SPKISexp_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytes, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytesLen, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytesLen, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1SPKIDataType->SPKISexp.arrayLen++;
 							} else {
@@ -11534,7 +16388,14 @@ static int decode_iso1SPKIDataType(bitstream_t* stream, struct iso1SPKIDataType*
 									errn =  (iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytesLen) <= iso1SPKIDataType_SPKISexp_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 								}
 								if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytes, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytesLen);
+									if (errn == 0) {
+										errn = decodeBytes(stream, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytesLen, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytes);
+									}
+#else
 									errn = decodeBytes(stream, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytesLen, iso1SPKIDataType->SPKISexp.array[iso1SPKIDataType->SPKISexp.arrayLen].bytes);
+#endif /* DATABINDING_SLIM */
 								}
 								iso1SPKIDataType->SPKISexp.arrayLen++;
 							} else {
@@ -11575,9 +16436,49 @@ static int decode_iso1SPKIDataType(bitstream_t* stream, struct iso1SPKIDataType*
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,MeteringReceiptResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgDataTypes":EVSEStatus)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1MeteringReceiptResTypeProductions[5] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1MeteringReceiptResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1MeteringReceiptResType, AC_EVSEStatus), 0, 0, 0, decode_iso1AC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1MeteringReceiptResType, DC_EVSEStatus), 0, 0, 0, decode_iso1DC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1MeteringReceiptResType, EVSEStatus), 0, 0, 0, decode_iso1EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1MeteringReceiptResTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t iso1MeteringReceiptResTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 1, 1 }
+};
+static void iso1MeteringReceiptResTypeUsed(void* value, uint8_t flag) {
+	struct iso1MeteringReceiptResType* iso1MeteringReceiptResType = (struct iso1MeteringReceiptResType*)value;
+	switch(flag) {
+	case 0:
+		iso1MeteringReceiptResType->AC_EVSEStatus_isUsed = 1u;
+		break;
+	case 1:
+		iso1MeteringReceiptResType->DC_EVSEStatus_isUsed = 1u;
+		break;
+	case 2:
+		iso1MeteringReceiptResType->EVSEStatus_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1MeteringReceiptResTypeGrammar = { iso1MeteringReceiptResTypeStates, iso1MeteringReceiptResTypeTransitions, iso1MeteringReceiptResTypeProductions, iso1MeteringReceiptResTypeUsed };
+
+static int decode_iso1MeteringReceiptResType(bitstream_t* stream, struct iso1MeteringReceiptResType* iso1MeteringReceiptResType) {
+	init_iso1MeteringReceiptResType(iso1MeteringReceiptResType);
+	return decodeGrammar(stream, &iso1MeteringReceiptResTypeGrammar, iso1MeteringReceiptResType);
+}
+#else
 static int decode_iso1MeteringReceiptResType(bitstream_t* stream, struct iso1MeteringReceiptResType* iso1MeteringReceiptResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 93;
 	int done = 0;
 	
@@ -11669,9 +16570,33 @@ static int decode_iso1MeteringReceiptResType(bitstream_t* stream, struct iso1Met
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,SessionStopReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ChargingSession)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1SessionStopReqTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 1, sizeof(iso1chargingSessionType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SessionStopReqType, ChargingSession), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SessionStopReqTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1SessionStopReqTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t iso1SessionStopReqTypeGrammar = { iso1SessionStopReqTypeStates, iso1SessionStopReqTypeTransitions, iso1SessionStopReqTypeProductions, NULL };
+
+static int decode_iso1SessionStopReqType(bitstream_t* stream, struct iso1SessionStopReqType* iso1SessionStopReqType) {
+	init_iso1SessionStopReqType(iso1SessionStopReqType);
+	return decodeGrammar(stream, &iso1SessionStopReqTypeGrammar, iso1SessionStopReqType);
+}
+#else
 static int decode_iso1SessionStopReqType(bitstream_t* stream, struct iso1SessionStopReqType* iso1SessionStopReqType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 266;
 	int done = 0;
 	
@@ -11737,9 +16662,35 @@ static int decode_iso1SessionStopReqType(bitstream_t* stream, struct iso1Session
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_SessionStopReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,WeldingDetectionResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2013:MsgBody":EVSEPresentVoltage)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1WeldingDetectionResTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1WeldingDetectionResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1WeldingDetectionResType, DC_EVSEStatus), 0, 0, 0, decode_iso1DC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1WeldingDetectionResType, EVSEPresentVoltage), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1WeldingDetectionResTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1WeldingDetectionResTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t iso1WeldingDetectionResTypeGrammar = { iso1WeldingDetectionResTypeStates, iso1WeldingDetectionResTypeTransitions, iso1WeldingDetectionResTypeProductions, NULL };
+
+static int decode_iso1WeldingDetectionResType(bitstream_t* stream, struct iso1WeldingDetectionResType* iso1WeldingDetectionResType) {
+	init_iso1WeldingDetectionResType(iso1WeldingDetectionResType);
+	return decodeGrammar(stream, &iso1WeldingDetectionResTypeGrammar, iso1WeldingDetectionResType);
+}
+#else
 static int decode_iso1WeldingDetectionResType(bitstream_t* stream, struct iso1WeldingDetectionResType* iso1WeldingDetectionResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 39;
 	int done = 0;
 	
@@ -11835,9 +16786,55 @@ static int decode_iso1WeldingDetectionResType(bitstream_t* stream, struct iso1We
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ReferenceTypeProductions[7] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ReferenceType, Id.characters), offsetof(struct iso1ReferenceType, Id.charactersLen), iso1ReferenceType_Id_CHARACTERS_SIZE, 27 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1ReferenceType, Type.characters), offsetof(struct iso1ReferenceType, Type.charactersLen), iso1ReferenceType_Type_CHARACTERS_SIZE, 30 /* {}Type */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1ReferenceType, URI.characters), offsetof(struct iso1ReferenceType, URI.charactersLen), iso1ReferenceType_URI_CHARACTERS_SIZE, 31 /* {}URI */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct iso1ReferenceType, Transforms), 0, 0, 0, decode_iso1TransformsTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ReferenceType, DigestMethod), 0, 0, 0, decode_iso1DigestMethodTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ReferenceType, DigestValue.bytes), offsetof(struct iso1ReferenceType, DigestValue.bytesLen), iso1ReferenceType_DigestValue_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ReferenceTypeTransitions[17] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 2, 1 }, { 3, 2 }, { 4, 3 },
+	{ 5, 4 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 4, 3 }, { 5, 4 }, { 5, 4 }, { 6, 5 },
+	{ 0, 6 }
+};
+static const exi_grammar_state_t iso1ReferenceTypeStates[7] = {
+	{ 0, 3, 5 }, { 5, 3, 4 }, { 9, 2, 3 }, { 12, 2, 2 }, { 14, 1, 1 }, { 15, 1, 1 }, { 16, 1, 1 }
+};
+static void iso1ReferenceTypeUsed(void* value, uint8_t flag) {
+	struct iso1ReferenceType* iso1ReferenceType = (struct iso1ReferenceType*)value;
+	switch(flag) {
+	case 0:
+		iso1ReferenceType->Id_isUsed = 1u;
+		break;
+	case 1:
+		iso1ReferenceType->Type_isUsed = 1u;
+		break;
+	case 2:
+		iso1ReferenceType->URI_isUsed = 1u;
+		break;
+	case 3:
+		iso1ReferenceType->Transforms_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ReferenceTypeGrammar = { iso1ReferenceTypeStates, iso1ReferenceTypeTransitions, iso1ReferenceTypeProductions, iso1ReferenceTypeUsed };
+
 static int decode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceType* iso1ReferenceType) {
+	init_iso1ReferenceType(iso1ReferenceType);
+	return decodeGrammar(stream, &iso1ReferenceTypeGrammar, iso1ReferenceType);
+}
+#else
+static int decode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceType* iso1ReferenceType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 267;
 	int done = 0;
 	
@@ -11855,10 +16852,24 @@ static int decode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceTyp
 					if (errn == 0) {
 						if (iso1ReferenceType->Id.charactersLen >= 2) {
 							iso1ReferenceType->Id.charactersLen = (uint16_t)(iso1ReferenceType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ReferenceType->Id.characters, CHARACTER_UNITS(iso1ReferenceType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ReferenceType->Id.charactersLen, iso1ReferenceType->Id.characters, iso1ReferenceType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ReferenceType->Id.charactersLen, iso1ReferenceType->Id.characters, iso1ReferenceType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 27 /* {}Id */, iso1ReferenceType->Id.characters, iso1ReferenceType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 27 /* {}Id */, &iso1ReferenceType->Id.charactersLen, &iso1ReferenceType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 27 /* {}Id */, &iso1ReferenceType->Id.charactersLen, iso1ReferenceType->Id.characters, iso1ReferenceType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ReferenceType->Id_isUsed = 1u;
@@ -11869,10 +16880,24 @@ static int decode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceTyp
 					if (errn == 0) {
 						if (iso1ReferenceType->Type.charactersLen >= 2) {
 							iso1ReferenceType->Type.charactersLen = (uint16_t)(iso1ReferenceType->Type.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ReferenceType->Type.characters, CHARACTER_UNITS(iso1ReferenceType->Type.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ReferenceType->Type.charactersLen, iso1ReferenceType->Type.characters, iso1ReferenceType_Type_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ReferenceType->Type.charactersLen, iso1ReferenceType->Type.characters, iso1ReferenceType_Type_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 30 /* {}Type */, iso1ReferenceType->Type.characters, iso1ReferenceType->Type.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 30 /* {}Type */, &iso1ReferenceType->Type.charactersLen, &iso1ReferenceType->Type.characters);
+#else
+							errn = decodeStringValueHit(stream, 30 /* {}Type */, &iso1ReferenceType->Type.charactersLen, iso1ReferenceType->Type.characters, iso1ReferenceType_Type_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ReferenceType->Type_isUsed = 1u;
@@ -11883,10 +16908,24 @@ static int decode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceTyp
 					if (errn == 0) {
 						if (iso1ReferenceType->URI.charactersLen >= 2) {
 							iso1ReferenceType->URI.charactersLen = (uint16_t)(iso1ReferenceType->URI.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ReferenceType->URI.characters, CHARACTER_UNITS(iso1ReferenceType->URI.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ReferenceType->URI.charactersLen, iso1ReferenceType->URI.characters, iso1ReferenceType_URI_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ReferenceType->URI.charactersLen, iso1ReferenceType->URI.characters, iso1ReferenceType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 31 /* {}URI */, iso1ReferenceType->URI.characters, iso1ReferenceType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 31 /* {}URI */, &iso1ReferenceType->URI.charactersLen, &iso1ReferenceType->URI.characters);
+#else
+							errn = decodeStringValueHit(stream, 31 /* {}URI */, &iso1ReferenceType->URI.charactersLen, iso1ReferenceType->URI.characters, iso1ReferenceType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ReferenceType->URI_isUsed = 1u;
@@ -11917,10 +16956,24 @@ static int decode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceTyp
 					if (errn == 0) {
 						if (iso1ReferenceType->Type.charactersLen >= 2) {
 							iso1ReferenceType->Type.charactersLen = (uint16_t)(iso1ReferenceType->Type.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ReferenceType->Type.characters, CHARACTER_UNITS(iso1ReferenceType->Type.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ReferenceType->Type.charactersLen, iso1ReferenceType->Type.characters, iso1ReferenceType_Type_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ReferenceType->Type.charactersLen, iso1ReferenceType->Type.characters, iso1ReferenceType_Type_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 30 /* {}Type */, iso1ReferenceType->Type.characters, iso1ReferenceType->Type.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 30 /* {}Type */, &iso1ReferenceType->Type.charactersLen, &iso1ReferenceType->Type.characters);
+#else
+							errn = decodeStringValueHit(stream, 30 /* {}Type */, &iso1ReferenceType->Type.charactersLen, iso1ReferenceType->Type.characters, iso1ReferenceType_Type_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ReferenceType->Type_isUsed = 1u;
@@ -11931,10 +16984,24 @@ static int decode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceTyp
 					if (errn == 0) {
 						if (iso1ReferenceType->URI.charactersLen >= 2) {
 							iso1ReferenceType->URI.charactersLen = (uint16_t)(iso1ReferenceType->URI.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ReferenceType->URI.characters, CHARACTER_UNITS(iso1ReferenceType->URI.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ReferenceType->URI.charactersLen, iso1ReferenceType->URI.characters, iso1ReferenceType_URI_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ReferenceType->URI.charactersLen, iso1ReferenceType->URI.characters, iso1ReferenceType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 31 /* {}URI */, iso1ReferenceType->URI.characters, iso1ReferenceType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 31 /* {}URI */, &iso1ReferenceType->URI.charactersLen, &iso1ReferenceType->URI.characters);
+#else
+							errn = decodeStringValueHit(stream, 31 /* {}URI */, &iso1ReferenceType->URI.charactersLen, iso1ReferenceType->URI.characters, iso1ReferenceType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ReferenceType->URI_isUsed = 1u;
@@ -11965,10 +17032,24 @@ static int decode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceTyp
 					if (errn == 0) {
 						if (iso1ReferenceType->URI.charactersLen >= 2) {
 							iso1ReferenceType->URI.charactersLen = (uint16_t)(iso1ReferenceType->URI.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1ReferenceType->URI.characters, CHARACTER_UNITS(iso1ReferenceType->URI.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1ReferenceType->URI.charactersLen, iso1ReferenceType->URI.characters, iso1ReferenceType_URI_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1ReferenceType->URI.charactersLen, iso1ReferenceType->URI.characters, iso1ReferenceType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 31 /* {}URI */, iso1ReferenceType->URI.characters, iso1ReferenceType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 31 /* {}URI */, &iso1ReferenceType->URI.charactersLen, &iso1ReferenceType->URI.characters);
+#else
+							errn = decodeStringValueHit(stream, 31 /* {}URI */, &iso1ReferenceType->URI.charactersLen, iso1ReferenceType->URI.characters, iso1ReferenceType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1ReferenceType->URI_isUsed = 1u;
@@ -12039,7 +17120,14 @@ static int decode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceTyp
 								errn =  (iso1ReferenceType->DigestValue.bytesLen) <= iso1ReferenceType_DigestValue_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1ReferenceType->DigestValue.bytes, iso1ReferenceType->DigestValue.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1ReferenceType->DigestValue.bytesLen, iso1ReferenceType->DigestValue.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1ReferenceType->DigestValue.bytesLen, iso1ReferenceType->DigestValue.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 						} else {
 							/* Second level event (e.g., xsi:type, xsi:nil, ...) */
@@ -12087,9 +17175,66 @@ static int decode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceTyp
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CurrentDemandReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":DC_EVStatus,"urn:iso:15118:2:2013:MsgBody":EVTargetCurrent,"urn:iso:15118:2:2013:MsgBody":EVMaximumVoltageLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVMaximumCurrentLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVMaximumPowerLimit{0-1},"urn:iso:15118:2:2013:MsgBody":BulkChargingComplete{0-1},"urn:iso:15118:2:2013:MsgBody":ChargingComplete,"urn:iso:15118:2:2013:MsgBody":RemainingTimeToFullSoC{0-1},"urn:iso:15118:2:2013:MsgBody":RemainingTimeToBulkSoC{0-1},"urn:iso:15118:2:2013:MsgBody":EVTargetVoltage)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1CurrentDemandReqTypeProductions[11] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandReqType, DC_EVStatus), 0, 0, 0, decode_iso1DC_EVStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandReqType, EVTargetCurrent), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandReqType, EVMaximumVoltageLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandReqType, EVMaximumCurrentLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandReqType, EVMaximumPowerLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandReqType, BulkChargingComplete), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandReqType, ChargingComplete), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandReqType, RemainingTimeToFullSoC), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandReqType, RemainingTimeToBulkSoC), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandReqType, EVTargetVoltage), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1CurrentDemandReqTypeTransitions[24] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 7, 6 }, { 4, 3 },
+	{ 5, 4 }, { 6, 5 }, { 7, 6 }, { 5, 4 }, { 6, 5 }, { 7, 6 }, { 6, 5 }, { 7, 6 },
+	{ 7, 6 }, { 8, 7 }, { 9, 8 }, { 10, 9 }, { 9, 8 }, { 10, 9 }, { 10, 9 }, { 0, 10 }
+};
+static const exi_grammar_state_t iso1CurrentDemandReqTypeStates[11] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 3, 5 }, { 7, 3, 4 }, { 11, 2, 3 }, { 14, 2, 2 }, { 16, 1, 1 }, { 17, 2, 3 },
+	{ 20, 2, 2 }, { 22, 1, 1 }, { 23, 1, 1 }
+};
+static void iso1CurrentDemandReqTypeUsed(void* value, uint8_t flag) {
+	struct iso1CurrentDemandReqType* iso1CurrentDemandReqType = (struct iso1CurrentDemandReqType*)value;
+	switch(flag) {
+	case 0:
+		iso1CurrentDemandReqType->EVMaximumVoltageLimit_isUsed = 1u;
+		break;
+	case 1:
+		iso1CurrentDemandReqType->EVMaximumCurrentLimit_isUsed = 1u;
+		break;
+	case 2:
+		iso1CurrentDemandReqType->EVMaximumPowerLimit_isUsed = 1u;
+		break;
+	case 3:
+		iso1CurrentDemandReqType->BulkChargingComplete_isUsed = 1u;
+		break;
+	case 4:
+		iso1CurrentDemandReqType->RemainingTimeToFullSoC_isUsed = 1u;
+		break;
+	case 5:
+		iso1CurrentDemandReqType->RemainingTimeToBulkSoC_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1CurrentDemandReqTypeGrammar = { iso1CurrentDemandReqTypeStates, iso1CurrentDemandReqTypeTransitions, iso1CurrentDemandReqTypeProductions, iso1CurrentDemandReqTypeUsed };
+
 static int decode_iso1CurrentDemandReqType(bitstream_t* stream, struct iso1CurrentDemandReqType* iso1CurrentDemandReqType) {
+	init_iso1CurrentDemandReqType(iso1CurrentDemandReqType);
+	return decodeGrammar(stream, &iso1CurrentDemandReqTypeGrammar, iso1CurrentDemandReqType);
+}
+#else
+static int decode_iso1CurrentDemandReqType(bitstream_t* stream, struct iso1CurrentDemandReqType* iso1CurrentDemandReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 273;
 	int done = 0;
 	
@@ -12490,9 +17635,50 @@ static int decode_iso1CurrentDemandReqType(bitstream_t* stream, struct iso1Curre
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SalesTariffEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":TimeInterval),("urn:iso:15118:2:2013:MsgDataTypes":EPriceLevel{0-1},"urn:iso:15118:2:2013:MsgDataTypes":ConsumptionCost{0-3}))',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SalesTariffEntryTypeProductions[5] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1SalesTariffEntryType, RelativeTimeInterval), 0, 0, 0, decode_iso1RelativeTimeIntervalTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1SalesTariffEntryType, TimeInterval), 0, 0, 0, decode_iso1IntervalTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(uint8_t), 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1SalesTariffEntryType, EPriceLevel), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE, offsetof(struct iso1SalesTariffEntryType, ConsumptionCost.array), offsetof(struct iso1SalesTariffEntryType, ConsumptionCost.arrayLen), sizeof(((struct iso1SalesTariffEntryType*)0)->ConsumptionCost.array[0]), 0, 0, 0, 0, decode_iso1ConsumptionCostTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SalesTariffEntryTypeTransitions[12] = {
+	{ 1, 0 }, { 1, 1 }, { 2, 2 }, { 3, 3 }, { 0, 4 }, { 3, 3 }, { 0, 4 }, { 4, 3 },
+	{ 0, 4 }, { 5, 3 }, { 0, 4 }, { 0, 4 }
+};
+static const exi_grammar_state_t iso1SalesTariffEntryTypeStates[6] = {
+	{ 0, 2, 2 }, { 2, 2, 3 }, { 5, 2, 2 }, { 7, 2, 2 }, { 9, 2, 2 }, { 11, 1, 1 }
+};
+static void iso1SalesTariffEntryTypeUsed(void* value, uint8_t flag) {
+	struct iso1SalesTariffEntryType* iso1SalesTariffEntryType = (struct iso1SalesTariffEntryType*)value;
+	switch(flag) {
+	case 0:
+		iso1SalesTariffEntryType->RelativeTimeInterval_isUsed = 1u;
+		break;
+	case 1:
+		iso1SalesTariffEntryType->TimeInterval_isUsed = 1u;
+		break;
+	case 2:
+		iso1SalesTariffEntryType->EPriceLevel_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1SalesTariffEntryTypeGrammar = { iso1SalesTariffEntryTypeStates, iso1SalesTariffEntryTypeTransitions, iso1SalesTariffEntryTypeProductions, iso1SalesTariffEntryTypeUsed };
+
+static int decode_iso1SalesTariffEntryType(bitstream_t* stream, struct iso1SalesTariffEntryType* iso1SalesTariffEntryType) {
+	init_iso1SalesTariffEntryType(iso1SalesTariffEntryType);
+	return decodeGrammar(stream, &iso1SalesTariffEntryTypeGrammar, iso1SalesTariffEntryType);
+}
+#else
 static int decode_iso1SalesTariffEntryType(bitstream_t* stream, struct iso1SalesTariffEntryType* iso1SalesTariffEntryType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 283;
 	int done = 0;
 	
@@ -12550,7 +17736,16 @@ static int decode_iso1SalesTariffEntryType(bitstream_t* stream, struct iso1Sales
 					}
 					break;
 				case 1:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SalesTariffEntryType->ConsumptionCost.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SalesTariffEntryType->ConsumptionCost.array, iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SalesTariffEntryType->ConsumptionCost.arrayLen < iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE) {
+#else
 					if (iso1SalesTariffEntryType->ConsumptionCost.arrayLen < iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ConsumptionCostType(stream, &iso1SalesTariffEntryType->ConsumptionCost.array[iso1SalesTariffEntryType->ConsumptionCost.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -12573,7 +17768,16 @@ static int decode_iso1SalesTariffEntryType(bitstream_t* stream, struct iso1Sales
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SalesTariffEntryType->ConsumptionCost.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SalesTariffEntryType->ConsumptionCost.array, iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SalesTariffEntryType->ConsumptionCost.arrayLen < iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE) {
+#else
 					if (iso1SalesTariffEntryType->ConsumptionCost.arrayLen < iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ConsumptionCostType(stream, &iso1SalesTariffEntryType->ConsumptionCost.array[iso1SalesTariffEntryType->ConsumptionCost.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -12596,7 +17800,16 @@ static int decode_iso1SalesTariffEntryType(bitstream_t* stream, struct iso1Sales
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SalesTariffEntryType->ConsumptionCost.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SalesTariffEntryType->ConsumptionCost.array, iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SalesTariffEntryType->ConsumptionCost.arrayLen < iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE) {
+#else
 					if (iso1SalesTariffEntryType->ConsumptionCost.arrayLen < iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ConsumptionCostType(stream, &iso1SalesTariffEntryType->ConsumptionCost.array[iso1SalesTariffEntryType->ConsumptionCost.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -12619,7 +17832,16 @@ static int decode_iso1SalesTariffEntryType(bitstream_t* stream, struct iso1Sales
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SalesTariffEntryType->ConsumptionCost.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SalesTariffEntryType->ConsumptionCost.array, iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SalesTariffEntryType->ConsumptionCost.arrayLen < iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE) {
+#else
 					if (iso1SalesTariffEntryType->ConsumptionCost.arrayLen < iso1SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1ConsumptionCostType(stream, &iso1SalesTariffEntryType->ConsumptionCost.array[iso1SalesTariffEntryType->ConsumptionCost.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -12661,9 +17883,43 @@ static int decode_iso1SalesTariffEntryType(bitstream_t* stream, struct iso1Sales
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EntryType',  base type name='anyType',  content type='ELEMENT',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":TimeInterval)',  derivedBy='RESTRICTION'.  */
+#if ISO1_DEPLOY_Entry == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1EntryTypeProductions[3] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1EntryType, RelativeTimeInterval), 0, 0, 0, decode_iso1RelativeTimeIntervalTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1EntryType, TimeInterval), 0, 0, 0, decode_iso1IntervalTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1EntryTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1EntryTypeStates[2] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }
+};
+static void iso1EntryTypeUsed(void* value, uint8_t flag) {
+	struct iso1EntryType* iso1EntryType = (struct iso1EntryType*)value;
+	switch(flag) {
+	case 0:
+		iso1EntryType->RelativeTimeInterval_isUsed = 1u;
+		break;
+	case 1:
+		iso1EntryType->TimeInterval_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1EntryTypeGrammar = { iso1EntryTypeStates, iso1EntryTypeTransitions, iso1EntryTypeProductions, iso1EntryTypeUsed };
+
+static int decode_iso1EntryType(bitstream_t* stream, struct iso1EntryType* iso1EntryType) {
+	init_iso1EntryType(iso1EntryType);
+	return decodeGrammar(stream, &iso1EntryTypeGrammar, iso1EntryType);
+}
+#else
 static int decode_iso1EntryType(bitstream_t* stream, struct iso1EntryType* iso1EntryType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 288;
 	int done = 0;
 	
@@ -12717,9 +17973,32 @@ static int decode_iso1EntryType(bitstream_t* stream, struct iso1EntryType* iso1E
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_Entry */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,SessionSetupReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":EVCCID)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1SessionSetupReqTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SessionSetupReqType, EVCCID.bytes), offsetof(struct iso1SessionSetupReqType, EVCCID.bytesLen), iso1SessionSetupReqType_EVCCID_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SessionSetupReqTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1SessionSetupReqTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t iso1SessionSetupReqTypeGrammar = { iso1SessionSetupReqTypeStates, iso1SessionSetupReqTypeTransitions, iso1SessionSetupReqTypeProductions, NULL };
+
+static int decode_iso1SessionSetupReqType(bitstream_t* stream, struct iso1SessionSetupReqType* iso1SessionSetupReqType) {
+	init_iso1SessionSetupReqType(iso1SessionSetupReqType);
+	return decodeGrammar(stream, &iso1SessionSetupReqTypeGrammar, iso1SessionSetupReqType);
+}
+#else
 static int decode_iso1SessionSetupReqType(bitstream_t* stream, struct iso1SessionSetupReqType* iso1SessionSetupReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 289;
 	int done = 0;
 	
@@ -12790,9 +18069,42 @@ static int decode_iso1SessionSetupReqType(bitstream_t* stream, struct iso1Sessio
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_SessionSetupReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,CostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":costKind,"urn:iso:15118:2:2013:MsgDataTypes":amount,"urn:iso:15118:2:2013:MsgDataTypes":amountMultiplier{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1CostTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(iso1costKindType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CostType, costKind), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED32, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CostType, amount), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 3, sizeof(int8_t), -3, 0, 0, 0, 0, 0, 0, offsetof(struct iso1CostType, amountMultiplier), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1CostTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1CostTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 }, { 4, 1, 1 }
+};
+static void iso1CostTypeUsed(void* value, uint8_t flag) {
+	struct iso1CostType* iso1CostType = (struct iso1CostType*)value;
+	switch(flag) {
+	case 0:
+		iso1CostType->amountMultiplier_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1CostTypeGrammar = { iso1CostTypeStates, iso1CostTypeTransitions, iso1CostTypeProductions, iso1CostTypeUsed };
+
+static int decode_iso1CostType(bitstream_t* stream, struct iso1CostType* iso1CostType) {
+	init_iso1CostType(iso1CostType);
+	return decodeGrammar(stream, &iso1CostTypeGrammar, iso1CostType);
+}
+#else
 static int decode_iso1CostType(bitstream_t* stream, struct iso1CostType* iso1CostType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 290;
 	int done = 0;
 	
@@ -12928,9 +18240,40 @@ static int decode_iso1CostType(bitstream_t* stream, struct iso1CostType* iso1Cos
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DC_EVPowerDeliveryParameterType',  base type name='EVPowerDeliveryParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":DC_EVStatus,"urn:iso:15118:2:2013:MsgDataTypes":BulkChargingComplete{0-1},"urn:iso:15118:2:2013:MsgDataTypes":ChargingComplete)',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1DC_EVPowerDeliveryParameterTypeProductions[4] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVPowerDeliveryParameterType, DC_EVStatus), 0, 0, 0, decode_iso1DC_EVStatusTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVPowerDeliveryParameterType, BulkChargingComplete), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVPowerDeliveryParameterType, ChargingComplete), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1DC_EVPowerDeliveryParameterTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1DC_EVPowerDeliveryParameterTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }, { 4, 1, 1 }
+};
+static void iso1DC_EVPowerDeliveryParameterTypeUsed(void* value, uint8_t flag) {
+	struct iso1DC_EVPowerDeliveryParameterType* iso1DC_EVPowerDeliveryParameterType = (struct iso1DC_EVPowerDeliveryParameterType*)value;
+	switch(flag) {
+	case 0:
+		iso1DC_EVPowerDeliveryParameterType->BulkChargingComplete_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1DC_EVPowerDeliveryParameterTypeGrammar = { iso1DC_EVPowerDeliveryParameterTypeStates, iso1DC_EVPowerDeliveryParameterTypeTransitions, iso1DC_EVPowerDeliveryParameterTypeProductions, iso1DC_EVPowerDeliveryParameterTypeUsed };
+
+static int decode_iso1DC_EVPowerDeliveryParameterType(bitstream_t* stream, struct iso1DC_EVPowerDeliveryParameterType* iso1DC_EVPowerDeliveryParameterType) {
+	init_iso1DC_EVPowerDeliveryParameterType(iso1DC_EVPowerDeliveryParameterType);
+	return decodeGrammar(stream, &iso1DC_EVPowerDeliveryParameterTypeGrammar, iso1DC_EVPowerDeliveryParameterType);
+}
+#else
 static int decode_iso1DC_EVPowerDeliveryParameterType(bitstream_t* stream, struct iso1DC_EVPowerDeliveryParameterType* iso1DC_EVPowerDeliveryParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 293;
 	int done = 0;
 	
@@ -13064,9 +18407,47 @@ static int decode_iso1DC_EVPowerDeliveryParameterType(bitstream_t* stream, struc
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RetrievalMethodType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1RetrievalMethodTypeProductions[4] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1RetrievalMethodType, Type.characters), offsetof(struct iso1RetrievalMethodType, Type.charactersLen), iso1RetrievalMethodType_Type_CHARACTERS_SIZE, 30 /* {}Type */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1RetrievalMethodType, URI.characters), offsetof(struct iso1RetrievalMethodType, URI.charactersLen), iso1RetrievalMethodType_URI_CHARACTERS_SIZE, 31 /* {}URI */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1RetrievalMethodType, Transforms), 0, 0, 0, decode_iso1TransformsTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1RetrievalMethodTypeTransitions[10] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 3, 2 },
+	{ 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1RetrievalMethodTypeStates[4] = {
+	{ 0, 3, 4 }, { 4, 2, 3 }, { 7, 2, 2 }, { 9, 1, 1 }
+};
+static void iso1RetrievalMethodTypeUsed(void* value, uint8_t flag) {
+	struct iso1RetrievalMethodType* iso1RetrievalMethodType = (struct iso1RetrievalMethodType*)value;
+	switch(flag) {
+	case 0:
+		iso1RetrievalMethodType->Type_isUsed = 1u;
+		break;
+	case 1:
+		iso1RetrievalMethodType->URI_isUsed = 1u;
+		break;
+	case 2:
+		iso1RetrievalMethodType->Transforms_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1RetrievalMethodTypeGrammar = { iso1RetrievalMethodTypeStates, iso1RetrievalMethodTypeTransitions, iso1RetrievalMethodTypeProductions, iso1RetrievalMethodTypeUsed };
+
+static int decode_iso1RetrievalMethodType(bitstream_t* stream, struct iso1RetrievalMethodType* iso1RetrievalMethodType) {
+	init_iso1RetrievalMethodType(iso1RetrievalMethodType);
+	return decodeGrammar(stream, &iso1RetrievalMethodTypeGrammar, iso1RetrievalMethodType);
+}
+#else
 static int decode_iso1RetrievalMethodType(bitstream_t* stream, struct iso1RetrievalMethodType* iso1RetrievalMethodType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 296;
 	int done = 0;
 	
@@ -13084,10 +18465,24 @@ static int decode_iso1RetrievalMethodType(bitstream_t* stream, struct iso1Retrie
 					if (errn == 0) {
 						if (iso1RetrievalMethodType->Type.charactersLen >= 2) {
 							iso1RetrievalMethodType->Type.charactersLen = (uint16_t)(iso1RetrievalMethodType->Type.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1RetrievalMethodType->Type.characters, CHARACTER_UNITS(iso1RetrievalMethodType->Type.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1RetrievalMethodType->Type.charactersLen, iso1RetrievalMethodType->Type.characters, iso1RetrievalMethodType_Type_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1RetrievalMethodType->Type.charactersLen, iso1RetrievalMethodType->Type.characters, iso1RetrievalMethodType_Type_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 30 /* {}Type */, iso1RetrievalMethodType->Type.characters, iso1RetrievalMethodType->Type.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 30 /* {}Type */, &iso1RetrievalMethodType->Type.charactersLen, &iso1RetrievalMethodType->Type.characters);
+#else
+							errn = decodeStringValueHit(stream, 30 /* {}Type */, &iso1RetrievalMethodType->Type.charactersLen, iso1RetrievalMethodType->Type.characters, iso1RetrievalMethodType_Type_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1RetrievalMethodType->Type_isUsed = 1u;
@@ -13098,10 +18493,24 @@ static int decode_iso1RetrievalMethodType(bitstream_t* stream, struct iso1Retrie
 					if (errn == 0) {
 						if (iso1RetrievalMethodType->URI.charactersLen >= 2) {
 							iso1RetrievalMethodType->URI.charactersLen = (uint16_t)(iso1RetrievalMethodType->URI.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1RetrievalMethodType->URI.characters, CHARACTER_UNITS(iso1RetrievalMethodType->URI.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1RetrievalMethodType->URI.charactersLen, iso1RetrievalMethodType->URI.characters, iso1RetrievalMethodType_URI_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1RetrievalMethodType->URI.charactersLen, iso1RetrievalMethodType->URI.characters, iso1RetrievalMethodType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 31 /* {}URI */, iso1RetrievalMethodType->URI.characters, iso1RetrievalMethodType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 31 /* {}URI */, &iso1RetrievalMethodType->URI.charactersLen, &iso1RetrievalMethodType->URI.characters);
+#else
+							errn = decodeStringValueHit(stream, 31 /* {}URI */, &iso1RetrievalMethodType->URI.charactersLen, iso1RetrievalMethodType->URI.characters, iso1RetrievalMethodType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1RetrievalMethodType->URI_isUsed = 1u;
@@ -13132,10 +18541,24 @@ static int decode_iso1RetrievalMethodType(bitstream_t* stream, struct iso1Retrie
 					if (errn == 0) {
 						if (iso1RetrievalMethodType->URI.charactersLen >= 2) {
 							iso1RetrievalMethodType->URI.charactersLen = (uint16_t)(iso1RetrievalMethodType->URI.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1RetrievalMethodType->URI.characters, CHARACTER_UNITS(iso1RetrievalMethodType->URI.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1RetrievalMethodType->URI.charactersLen, iso1RetrievalMethodType->URI.characters, iso1RetrievalMethodType_URI_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1RetrievalMethodType->URI.charactersLen, iso1RetrievalMethodType->URI.characters, iso1RetrievalMethodType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 31 /* {}URI */, iso1RetrievalMethodType->URI.characters, iso1RetrievalMethodType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 31 /* {}URI */, &iso1RetrievalMethodType->URI.charactersLen, &iso1RetrievalMethodType->URI.characters);
+#else
+							errn = decodeStringValueHit(stream, 31 /* {}URI */, &iso1RetrievalMethodType->URI.charactersLen, iso1RetrievalMethodType->URI.characters, iso1RetrievalMethodType_URI_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1RetrievalMethodType->URI_isUsed = 1u;
@@ -13201,9 +18624,47 @@ static int decode_iso1RetrievalMethodType(bitstream_t* stream, struct iso1Retrie
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CertificateUpdateResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":SAProvisioningCertificateChain,"urn:iso:15118:2:2013:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2013:MsgBody":ContractSignatureEncryptedPrivateKey,"urn:iso:15118:2:2013:MsgBody":DHpublickey,"urn:iso:15118:2:2013:MsgBody":eMAID,"urn:iso:15118:2:2013:MsgBody":RetryCounter{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1CertificateUpdateResTypeProductions[8] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateUpdateResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateUpdateResType, SAProvisioningCertificateChain), 0, 0, 0, decode_iso1CertificateChainTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateUpdateResType, ContractSignatureCertChain), 0, 0, 0, decode_iso1CertificateChainTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateUpdateResType, ContractSignatureEncryptedPrivateKey), 0, 0, 0, decode_iso1ContractSignatureEncryptedPrivateKeyTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateUpdateResType, DHpublickey), 0, 0, 0, decode_iso1DiffieHellmanPublickeyTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateUpdateResType, eMAID), 0, 0, 0, decode_iso1EMAIDTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateUpdateResType, RetryCounter), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1CertificateUpdateResTypeTransitions[9] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 7, 6 }, { 0, 7 },
+	{ 0, 7 }
+};
+static const exi_grammar_state_t iso1CertificateUpdateResTypeStates[8] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }, { 6, 2, 2 }, { 8, 1, 1 }
+};
+static void iso1CertificateUpdateResTypeUsed(void* value, uint8_t flag) {
+	struct iso1CertificateUpdateResType* iso1CertificateUpdateResType = (struct iso1CertificateUpdateResType*)value;
+	switch(flag) {
+	case 0:
+		iso1CertificateUpdateResType->RetryCounter_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1CertificateUpdateResTypeGrammar = { iso1CertificateUpdateResTypeStates, iso1CertificateUpdateResTypeTransitions, iso1CertificateUpdateResTypeProductions, iso1CertificateUpdateResTypeUsed };
+
+static int decode_iso1CertificateUpdateResType(bitstream_t* stream, struct iso1CertificateUpdateResType* iso1CertificateUpdateResType) {
+	init_iso1CertificateUpdateResType(iso1CertificateUpdateResType);
+	return decodeGrammar(stream, &iso1CertificateUpdateResTypeGrammar, iso1CertificateUpdateResType);
+}
+#else
 static int decode_iso1CertificateUpdateResType(bitstream_t* stream, struct iso1CertificateUpdateResType* iso1CertificateUpdateResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 299;
 	int done = 0;
 	
@@ -13381,9 +18842,38 @@ static int decode_iso1CertificateUpdateResType(bitstream_t* stream, struct iso1C
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CertificateInstallationResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":SAProvisioningCertificateChain,"urn:iso:15118:2:2013:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2013:MsgBody":ContractSignatureEncryptedPrivateKey,"urn:iso:15118:2:2013:MsgBody":DHpublickey,"urn:iso:15118:2:2013:MsgBody":eMAID)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1CertificateInstallationResTypeProductions[7] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateInstallationResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateInstallationResType, SAProvisioningCertificateChain), 0, 0, 0, decode_iso1CertificateChainTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateInstallationResType, ContractSignatureCertChain), 0, 0, 0, decode_iso1CertificateChainTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateInstallationResType, ContractSignatureEncryptedPrivateKey), 0, 0, 0, decode_iso1ContractSignatureEncryptedPrivateKeyTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateInstallationResType, DHpublickey), 0, 0, 0, decode_iso1DiffieHellmanPublickeyTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CertificateInstallationResType, eMAID), 0, 0, 0, decode_iso1EMAIDTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1CertificateInstallationResTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 0, 6 }
+};
+static const exi_grammar_state_t iso1CertificateInstallationResTypeStates[7] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }, { 6, 1, 1 }
+};
+static const exi_grammar_t iso1CertificateInstallationResTypeGrammar = { iso1CertificateInstallationResTypeStates, iso1CertificateInstallationResTypeTransitions, iso1CertificateInstallationResTypeProductions, NULL };
+
+static int decode_iso1CertificateInstallationResType(bitstream_t* stream, struct iso1CertificateInstallationResType* iso1CertificateInstallationResType) {
+	init_iso1CertificateInstallationResType(iso1CertificateInstallationResType);
+	return decodeGrammar(stream, &iso1CertificateInstallationResTypeGrammar, iso1CertificateInstallationResType);
+}
+#else
 static int decode_iso1CertificateInstallationResType(bitstream_t* stream, struct iso1CertificateInstallationResType* iso1CertificateInstallationResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 306;
 	int done = 0;
 	
@@ -13524,9 +19014,41 @@ static int decode_iso1CertificateInstallationResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,CanonicalizationMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1CanonicalizationMethodTypeProductions[4] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CanonicalizationMethodType, Algorithm.characters), offsetof(struct iso1CanonicalizationMethodType, Algorithm.charactersLen), iso1CanonicalizationMethodType_Algorithm_CHARACTERS_SIZE, 25 /* {}Algorithm */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1CanonicalizationMethodType, ANY.characters), offsetof(struct iso1CanonicalizationMethodType, ANY.charactersLen), iso1CanonicalizationMethodType_ANY_CHARACTERS_SIZE, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, NULL }
+};
+static const exi_grammar_transition_t iso1CanonicalizationMethodTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 2, 3 }, { 2, 1 }, { 0, 2 }, { 2, 3 }
+};
+static const exi_grammar_state_t iso1CanonicalizationMethodTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 2, 3 }
+};
+static void iso1CanonicalizationMethodTypeUsed(void* value, uint8_t flag) {
+	struct iso1CanonicalizationMethodType* iso1CanonicalizationMethodType = (struct iso1CanonicalizationMethodType*)value;
+	switch(flag) {
+	case 0:
+		iso1CanonicalizationMethodType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1CanonicalizationMethodTypeGrammar = { iso1CanonicalizationMethodTypeStates, iso1CanonicalizationMethodTypeTransitions, iso1CanonicalizationMethodTypeProductions, iso1CanonicalizationMethodTypeUsed };
+
+static int decode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso1CanonicalizationMethodType* iso1CanonicalizationMethodType) {
+	init_iso1CanonicalizationMethodType(iso1CanonicalizationMethodType);
+	return decodeGrammar(stream, &iso1CanonicalizationMethodTypeGrammar, iso1CanonicalizationMethodType);
+}
+#else
 static int decode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso1CanonicalizationMethodType* iso1CanonicalizationMethodType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 312;
 	int done = 0;
 	
@@ -13544,10 +19066,24 @@ static int decode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso
 					if (errn == 0) {
 						if (iso1CanonicalizationMethodType->Algorithm.charactersLen >= 2) {
 							iso1CanonicalizationMethodType->Algorithm.charactersLen = (uint16_t)(iso1CanonicalizationMethodType->Algorithm.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1CanonicalizationMethodType->Algorithm.characters, CHARACTER_UNITS(iso1CanonicalizationMethodType->Algorithm.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1CanonicalizationMethodType->Algorithm.charactersLen, iso1CanonicalizationMethodType->Algorithm.characters, iso1CanonicalizationMethodType_Algorithm_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1CanonicalizationMethodType->Algorithm.charactersLen, iso1CanonicalizationMethodType->Algorithm.characters, iso1CanonicalizationMethodType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Algorithm */, iso1CanonicalizationMethodType->Algorithm.characters, iso1CanonicalizationMethodType->Algorithm.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Algorithm */, &iso1CanonicalizationMethodType->Algorithm.charactersLen, &iso1CanonicalizationMethodType->Algorithm.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Algorithm */, &iso1CanonicalizationMethodType->Algorithm.charactersLen, iso1CanonicalizationMethodType->Algorithm.characters, iso1CanonicalizationMethodType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 115;
@@ -13577,10 +19113,24 @@ static int decode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso
 					if (errn == 0) {
 						if (iso1CanonicalizationMethodType->ANY.charactersLen >= 2) {
 							iso1CanonicalizationMethodType->ANY.charactersLen = (uint16_t)(iso1CanonicalizationMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1CanonicalizationMethodType->ANY.characters, CHARACTER_UNITS(iso1CanonicalizationMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1CanonicalizationMethodType->ANY.charactersLen, iso1CanonicalizationMethodType->ANY.characters, iso1CanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1CanonicalizationMethodType->ANY.charactersLen, iso1CanonicalizationMethodType->ANY.characters, iso1CanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, iso1CanonicalizationMethodType->ANY.characters, iso1CanonicalizationMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, &iso1CanonicalizationMethodType->ANY.charactersLen, &iso1CanonicalizationMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, &iso1CanonicalizationMethodType->ANY.charactersLen, iso1CanonicalizationMethodType->ANY.characters, iso1CanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1CanonicalizationMethodType->ANY_isUsed = 1u;
@@ -13611,10 +19161,24 @@ static int decode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso
 					if (errn == 0) {
 						if (iso1CanonicalizationMethodType->ANY.charactersLen >= 2) {
 							iso1CanonicalizationMethodType->ANY.charactersLen = (uint16_t)(iso1CanonicalizationMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1CanonicalizationMethodType->ANY.characters, CHARACTER_UNITS(iso1CanonicalizationMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1CanonicalizationMethodType->ANY.charactersLen, iso1CanonicalizationMethodType->ANY.characters, iso1CanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1CanonicalizationMethodType->ANY.charactersLen, iso1CanonicalizationMethodType->ANY.characters, iso1CanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, iso1CanonicalizationMethodType->ANY.characters, iso1CanonicalizationMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, &iso1CanonicalizationMethodType->ANY.charactersLen, &iso1CanonicalizationMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, &iso1CanonicalizationMethodType->ANY.charactersLen, iso1CanonicalizationMethodType->ANY.characters, iso1CanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1CanonicalizationMethodType->ANY_isUsed = 1u;
@@ -13636,9 +19200,31 @@ static int decode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,WeldingDetectionReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":DC_EVStatus)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1WeldingDetectionReqTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1WeldingDetectionReqType, DC_EVStatus), 0, 0, 0, decode_iso1DC_EVStatusTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1WeldingDetectionReqTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1WeldingDetectionReqTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t iso1WeldingDetectionReqTypeGrammar = { iso1WeldingDetectionReqTypeStates, iso1WeldingDetectionReqTypeTransitions, iso1WeldingDetectionReqTypeProductions, NULL };
+
+static int decode_iso1WeldingDetectionReqType(bitstream_t* stream, struct iso1WeldingDetectionReqType* iso1WeldingDetectionReqType) {
+	init_iso1WeldingDetectionReqType(iso1WeldingDetectionReqType);
+	return decodeGrammar(stream, &iso1WeldingDetectionReqTypeGrammar, iso1WeldingDetectionReqType);
+}
+#else
 static int decode_iso1WeldingDetectionReqType(bitstream_t* stream, struct iso1WeldingDetectionReqType* iso1WeldingDetectionReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 313;
 	int done = 0;
 	
@@ -13686,9 +19272,34 @@ static int decode_iso1WeldingDetectionReqType(bitstream_t* stream, struct iso1We
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DC_EVStatusType',  base type name='EVStatusType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":EVReady,"urn:iso:15118:2:2013:MsgDataTypes":EVErrorCode,"urn:iso:15118:2:2013:MsgDataTypes":EVRESSSOC)',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1DC_EVStatusTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVStatusType, EVReady), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 4, sizeof(iso1DC_EVErrorCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVStatusType, EVErrorCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 7, sizeof(int8_t), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DC_EVStatusType, EVRESSSOC), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1DC_EVStatusTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1DC_EVStatusTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t iso1DC_EVStatusTypeGrammar = { iso1DC_EVStatusTypeStates, iso1DC_EVStatusTypeTransitions, iso1DC_EVStatusTypeProductions, NULL };
+
+static int decode_iso1DC_EVStatusType(bitstream_t* stream, struct iso1DC_EVStatusType* iso1DC_EVStatusType) {
+	init_iso1DC_EVStatusType(iso1DC_EVStatusType);
+	return decodeGrammar(stream, &iso1DC_EVStatusTypeGrammar, iso1DC_EVStatusType);
+}
+#else
 static int decode_iso1DC_EVStatusType(bitstream_t* stream, struct iso1DC_EVStatusType* iso1DC_EVStatusType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 314;
 	int done = 0;
 	
@@ -13819,9 +19430,68 @@ static int decode_iso1DC_EVStatusType(bitstream_t* stream, struct iso1DC_EVStatu
 	}
 	return errn;
 }
-
-/* Complex type name='urn:iso:15118:2:2013:MsgBody,CurrentDemandResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2013:MsgBody":EVSEPresentVoltage,"urn:iso:15118:2:2013:MsgBody":EVSEPresentCurrent,"urn:iso:15118:2:2013:MsgBody":EVSECurrentLimitAchieved,"urn:iso:15118:2:2013:MsgBody":EVSEVoltageLimitAchieved,"urn:iso:15118:2:2013:MsgBody":EVSEPowerLimitAchieved,"urn:iso:15118:2:2013:MsgBody":EVSEMaximumVoltageLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVSEMaximumCurrentLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVSEMaximumPowerLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVSEID,"urn:iso:15118:2:2013:MsgBody":SAScheduleTupleID,"urn:iso:15118:2:2013:MsgBody":MeterInfo{0-1},"urn:iso:15118:2:2013:MsgBody":ReceiptRequired{0-1})',  derivedBy='EXTENSION'.  */
+#endif /* GRAMMAR_DECODER_TABLE */
+
+/* Complex type name='urn:iso:15118:2:2013:MsgBody,CurrentDemandResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2013:MsgBody":EVSEPresentVoltage,"urn:iso:15118:2:2013:MsgBody":EVSEPresentCurrent,"urn:iso:15118:2:2013:MsgBody":EVSECurrentLimitAchieved,"urn:iso:15118:2:2013:MsgBody":EVSEVoltageLimitAchieved,"urn:iso:15118:2:2013:MsgBody":EVSEPowerLimitAchieved,"urn:iso:15118:2:2013:MsgBody":EVSEMaximumVoltageLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVSEMaximumCurrentLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVSEMaximumPowerLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVSEID,"urn:iso:15118:2:2013:MsgBody":SAScheduleTupleID,"urn:iso:15118:2:2013:MsgBody":MeterInfo{0-1},"urn:iso:15118:2:2013:MsgBody":ReceiptRequired{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1CurrentDemandResTypeProductions[15] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, DC_EVSEStatus), 0, 0, 0, decode_iso1DC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, EVSEPresentVoltage), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, EVSEPresentCurrent), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, EVSECurrentLimitAchieved), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, EVSEVoltageLimitAchieved), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, EVSEPowerLimitAchieved), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, EVSEMaximumVoltageLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, EVSEMaximumCurrentLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, EVSEMaximumPowerLimit), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, EVSEID.characters), offsetof(struct iso1CurrentDemandResType, EVSEID.charactersLen), iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(uint8_t), 1, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, SAScheduleTupleID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, MeterInfo), 0, 0, 0, decode_iso1MeterInfoTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, 4, 0, 0, 0, 0, 0, offsetof(struct iso1CurrentDemandResType, ReceiptRequired), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1CurrentDemandResTypeTransitions[24] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 6, 5 }, { 7, 6 }, { 8, 7 },
+	{ 9, 8 }, { 10, 9 }, { 11, 10 }, { 9, 8 }, { 10, 9 }, { 11, 10 }, { 10, 9 }, { 11, 10 },
+	{ 11, 10 }, { 12, 11 }, { 13, 12 }, { 14, 13 }, { 0, 14 }, { 14, 13 }, { 0, 14 }, { 0, 14 }
+};
+static const exi_grammar_state_t iso1CurrentDemandResTypeStates[15] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 1, 1 }, { 6, 1, 1 }, { 7, 3, 4 },
+	{ 11, 2, 3 }, { 14, 2, 2 }, { 16, 1, 1 }, { 17, 1, 1 }, { 18, 2, 3 }, { 21, 2, 2 }, { 23, 1, 1 }
+};
+static void iso1CurrentDemandResTypeUsed(void* value, uint8_t flag) {
+	struct iso1CurrentDemandResType* iso1CurrentDemandResType = (struct iso1CurrentDemandResType*)value;
+	switch(flag) {
+	case 0:
+		iso1CurrentDemandResType->EVSEMaximumVoltageLimit_isUsed = 1u;
+		break;
+	case 1:
+		iso1CurrentDemandResType->EVSEMaximumCurrentLimit_isUsed = 1u;
+		break;
+	case 2:
+		iso1CurrentDemandResType->EVSEMaximumPowerLimit_isUsed = 1u;
+		break;
+	case 3:
+		iso1CurrentDemandResType->MeterInfo_isUsed = 1u;
+		break;
+	case 4:
+		iso1CurrentDemandResType->ReceiptRequired_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1CurrentDemandResTypeGrammar = { iso1CurrentDemandResTypeStates, iso1CurrentDemandResTypeTransitions, iso1CurrentDemandResTypeProductions, iso1CurrentDemandResTypeUsed };
+
+static int decode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1CurrentDemandResType* iso1CurrentDemandResType) {
+	init_iso1CurrentDemandResType(iso1CurrentDemandResType);
+	return decodeGrammar(stream, &iso1CurrentDemandResTypeGrammar, iso1CurrentDemandResType);
+}
+#else
 static int decode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1CurrentDemandResType* iso1CurrentDemandResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 317;
 	int done = 0;
 	
@@ -14032,10 +19702,24 @@ static int decode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1Curre
 							if (errn == 0) {
 								if (iso1CurrentDemandResType->EVSEID.charactersLen >= 2) {
 									iso1CurrentDemandResType->EVSEID.charactersLen = (uint16_t)(iso1CurrentDemandResType->EVSEID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1CurrentDemandResType->EVSEID.characters, CHARACTER_UNITS(iso1CurrentDemandResType->EVSEID.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1CurrentDemandResType->EVSEID.charactersLen, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1CurrentDemandResType->EVSEID.charactersLen, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType->EVSEID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &iso1CurrentDemandResType->EVSEID.charactersLen, &iso1CurrentDemandResType->EVSEID.characters);
+#else
+									errn = decodeStringValueHit(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &iso1CurrentDemandResType->EVSEID.charactersLen, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -14083,10 +19767,24 @@ static int decode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1Curre
 							if (errn == 0) {
 								if (iso1CurrentDemandResType->EVSEID.charactersLen >= 2) {
 									iso1CurrentDemandResType->EVSEID.charactersLen = (uint16_t)(iso1CurrentDemandResType->EVSEID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1CurrentDemandResType->EVSEID.characters, CHARACTER_UNITS(iso1CurrentDemandResType->EVSEID.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1CurrentDemandResType->EVSEID.charactersLen, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1CurrentDemandResType->EVSEID.charactersLen, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType->EVSEID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &iso1CurrentDemandResType->EVSEID.charactersLen, &iso1CurrentDemandResType->EVSEID.characters);
+#else
+									errn = decodeStringValueHit(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &iso1CurrentDemandResType->EVSEID.charactersLen, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -14129,10 +19827,24 @@ static int decode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1Curre
 							if (errn == 0) {
 								if (iso1CurrentDemandResType->EVSEID.charactersLen >= 2) {
 									iso1CurrentDemandResType->EVSEID.charactersLen = (uint16_t)(iso1CurrentDemandResType->EVSEID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1CurrentDemandResType->EVSEID.characters, CHARACTER_UNITS(iso1CurrentDemandResType->EVSEID.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1CurrentDemandResType->EVSEID.charactersLen, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1CurrentDemandResType->EVSEID.charactersLen, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType->EVSEID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &iso1CurrentDemandResType->EVSEID.charactersLen, &iso1CurrentDemandResType->EVSEID.characters);
+#else
+									errn = decodeStringValueHit(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &iso1CurrentDemandResType->EVSEID.charactersLen, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -14170,10 +19882,24 @@ static int decode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1Curre
 							if (errn == 0) {
 								if (iso1CurrentDemandResType->EVSEID.charactersLen >= 2) {
 									iso1CurrentDemandResType->EVSEID.charactersLen = (uint16_t)(iso1CurrentDemandResType->EVSEID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1CurrentDemandResType->EVSEID.characters, CHARACTER_UNITS(iso1CurrentDemandResType->EVSEID.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1CurrentDemandResType->EVSEID.charactersLen, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1CurrentDemandResType->EVSEID.charactersLen, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType->EVSEID.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &iso1CurrentDemandResType->EVSEID.charactersLen, &iso1CurrentDemandResType->EVSEID.characters);
+#else
+									errn = decodeStringValueHit(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &iso1CurrentDemandResType->EVSEID.charactersLen, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 						} else {
@@ -14236,7 +19962,14 @@ static int decode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1Curre
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					errn = EXI_ARENA_ALLOCATE(stream, iso1CurrentDemandResType->MeterInfo, 1);
+					if (errn == 0) {
+						errn = decode_iso1MeterInfoType(stream, iso1CurrentDemandResType->MeterInfo);
+					}
+#else
 					errn = decode_iso1MeterInfoType(stream, &iso1CurrentDemandResType->MeterInfo);
+#endif /* DATABINDING_SLIM */
 					iso1CurrentDemandResType->MeterInfo_isUsed = 1u;
 					grammarID = 330;
 					break;
@@ -14334,9 +20067,47 @@ static int decode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1Curre
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ServiceID,"urn:iso:15118:2:2013:MsgDataTypes":ServiceName{0-1},"urn:iso:15118:2:2013:MsgDataTypes":ServiceCategory,"urn:iso:15118:2:2013:MsgDataTypes":ServiceScope{0-1},"urn:iso:15118:2:2013:MsgDataTypes":FreeService)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ServiceTypeProductions[6] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceType, ServiceID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceType, ServiceName.characters), offsetof(struct iso1ServiceType, ServiceName.charactersLen), iso1ServiceType_ServiceName_CHARACTERS_SIZE, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(iso1serviceCategoryType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceType, ServiceCategory), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceType, ServiceScope.characters), offsetof(struct iso1ServiceType, ServiceScope.charactersLen), iso1ServiceType_ServiceScope_CHARACTERS_SIZE, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceType, FreeService), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ServiceTypeTransitions[8] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 5, 4 }, { 0, 5 }
+};
+static const exi_grammar_state_t iso1ServiceTypeStates[6] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }, { 4, 2, 2 }, { 6, 1, 1 }, { 7, 1, 1 }
+};
+static void iso1ServiceTypeUsed(void* value, uint8_t flag) {
+	struct iso1ServiceType* iso1ServiceType = (struct iso1ServiceType*)value;
+	switch(flag) {
+	case 0:
+		iso1ServiceType->ServiceName_isUsed = 1u;
+		break;
+	case 1:
+		iso1ServiceType->ServiceScope_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ServiceTypeGrammar = { iso1ServiceTypeStates, iso1ServiceTypeTransitions, iso1ServiceTypeProductions, iso1ServiceTypeUsed };
+
+static int decode_iso1ServiceType(bitstream_t* stream, struct iso1ServiceType* iso1ServiceType) {
+	init_iso1ServiceType(iso1ServiceType);
+	return decodeGrammar(stream, &iso1ServiceTypeGrammar, iso1ServiceType);
+}
+#else
 static int decode_iso1ServiceType(bitstream_t* stream, struct iso1ServiceType* iso1ServiceType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 331;
 	int done = 0;
 	
@@ -14390,10 +20161,24 @@ static int decode_iso1ServiceType(bitstream_t* stream, struct iso1ServiceType* i
 							if (errn == 0) {
 								if (iso1ServiceType->ServiceName.charactersLen >= 2) {
 									iso1ServiceType->ServiceName.charactersLen = (uint16_t)(iso1ServiceType->ServiceName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1ServiceType->ServiceName.characters, CHARACTER_UNITS(iso1ServiceType->ServiceName.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1ServiceType->ServiceName.charactersLen, iso1ServiceType->ServiceName.characters, iso1ServiceType_ServiceName_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1ServiceType->ServiceName.charactersLen, iso1ServiceType->ServiceName.characters, iso1ServiceType_ServiceName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, iso1ServiceType->ServiceName.characters, iso1ServiceType->ServiceName.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, &iso1ServiceType->ServiceName.charactersLen, &iso1ServiceType->ServiceName.characters);
+#else
+									errn = decodeStringValueHit(stream, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, &iso1ServiceType->ServiceName.charactersLen, iso1ServiceType->ServiceName.characters, iso1ServiceType_ServiceName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							iso1ServiceType->ServiceName_isUsed = 1u;
@@ -14487,10 +20272,24 @@ static int decode_iso1ServiceType(bitstream_t* stream, struct iso1ServiceType* i
 							if (errn == 0) {
 								if (iso1ServiceType->ServiceScope.charactersLen >= 2) {
 									iso1ServiceType->ServiceScope.charactersLen = (uint16_t)(iso1ServiceType->ServiceScope.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1ServiceType->ServiceScope.characters, CHARACTER_UNITS(iso1ServiceType->ServiceScope.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1ServiceType->ServiceScope.charactersLen, iso1ServiceType->ServiceScope.characters, iso1ServiceType_ServiceScope_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1ServiceType->ServiceScope.charactersLen, iso1ServiceType->ServiceScope.characters, iso1ServiceType_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, iso1ServiceType->ServiceScope.characters, iso1ServiceType->ServiceScope.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, &iso1ServiceType->ServiceScope.charactersLen, &iso1ServiceType->ServiceScope.characters);
+#else
+									errn = decodeStringValueHit(stream, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, &iso1ServiceType->ServiceScope.charactersLen, iso1ServiceType->ServiceScope.characters, iso1ServiceType_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							iso1ServiceType->ServiceScope_isUsed = 1u;
@@ -14593,9 +20392,44 @@ static int decode_iso1ServiceType(bitstream_t* stream, struct iso1ServiceType* i
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ServiceDiscoveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ServiceScope{0-1},"urn:iso:15118:2:2013:MsgBody":ServiceCategory{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1ServiceDiscoveryReqTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceDiscoveryReqType, ServiceScope.characters), offsetof(struct iso1ServiceDiscoveryReqType, ServiceScope.charactersLen), iso1ServiceDiscoveryReqType_ServiceScope_CHARACTERS_SIZE, 15 /* {urn:iso:15118:2:2013:MsgBody}ServiceScope */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(iso1serviceCategoryType), 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1ServiceDiscoveryReqType, ServiceCategory), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ServiceDiscoveryReqTypeTransitions[6] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 2, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1ServiceDiscoveryReqTypeStates[3] = {
+	{ 0, 2, 3 }, { 3, 2, 2 }, { 5, 1, 1 }
+};
+static void iso1ServiceDiscoveryReqTypeUsed(void* value, uint8_t flag) {
+	struct iso1ServiceDiscoveryReqType* iso1ServiceDiscoveryReqType = (struct iso1ServiceDiscoveryReqType*)value;
+	switch(flag) {
+	case 0:
+		iso1ServiceDiscoveryReqType->ServiceScope_isUsed = 1u;
+		break;
+	case 1:
+		iso1ServiceDiscoveryReqType->ServiceCategory_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1ServiceDiscoveryReqTypeGrammar = { iso1ServiceDiscoveryReqTypeStates, iso1ServiceDiscoveryReqTypeTransitions, iso1ServiceDiscoveryReqTypeProductions, iso1ServiceDiscoveryReqTypeUsed };
+
+static int decode_iso1ServiceDiscoveryReqType(bitstream_t* stream, struct iso1ServiceDiscoveryReqType* iso1ServiceDiscoveryReqType) {
+	init_iso1ServiceDiscoveryReqType(iso1ServiceDiscoveryReqType);
+	return decodeGrammar(stream, &iso1ServiceDiscoveryReqTypeGrammar, iso1ServiceDiscoveryReqType);
+}
+#else
 static int decode_iso1ServiceDiscoveryReqType(bitstream_t* stream, struct iso1ServiceDiscoveryReqType* iso1ServiceDiscoveryReqType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 336;
 	int done = 0;
 	
@@ -14617,10 +20451,24 @@ static int decode_iso1ServiceDiscoveryReqType(bitstream_t* stream, struct iso1Se
 							if (errn == 0) {
 								if (iso1ServiceDiscoveryReqType->ServiceScope.charactersLen >= 2) {
 									iso1ServiceDiscoveryReqType->ServiceScope.charactersLen = (uint16_t)(iso1ServiceDiscoveryReqType->ServiceScope.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1ServiceDiscoveryReqType->ServiceScope.characters, CHARACTER_UNITS(iso1ServiceDiscoveryReqType->ServiceScope.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1ServiceDiscoveryReqType->ServiceScope.charactersLen, iso1ServiceDiscoveryReqType->ServiceScope.characters, iso1ServiceDiscoveryReqType_ServiceScope_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1ServiceDiscoveryReqType->ServiceScope.charactersLen, iso1ServiceDiscoveryReqType->ServiceScope.characters, iso1ServiceDiscoveryReqType_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 15 /* {urn:iso:15118:2:2013:MsgBody}ServiceScope */, iso1ServiceDiscoveryReqType->ServiceScope.characters, iso1ServiceDiscoveryReqType->ServiceScope.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 15 /* {urn:iso:15118:2:2013:MsgBody}ServiceScope */, &iso1ServiceDiscoveryReqType->ServiceScope.charactersLen, &iso1ServiceDiscoveryReqType->ServiceScope.characters);
+#else
+									errn = decodeStringValueHit(stream, 15 /* {urn:iso:15118:2:2013:MsgBody}ServiceScope */, &iso1ServiceDiscoveryReqType->ServiceScope.charactersLen, iso1ServiceDiscoveryReqType->ServiceScope.characters, iso1ServiceDiscoveryReqType_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							iso1ServiceDiscoveryReqType->ServiceScope_isUsed = 1u;
@@ -14735,9 +20583,33 @@ static int decode_iso1ServiceDiscoveryReqType(bitstream_t* stream, struct iso1Se
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,AC_EVSEChargeParameterType',  base type name='EVSEChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":AC_EVSEStatus,"urn:iso:15118:2:2013:MsgDataTypes":EVSENominalVoltage,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMaxCurrent)',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1AC_EVSEChargeParameterTypeProductions[4] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AC_EVSEChargeParameterType, AC_EVSEStatus), 0, 0, 0, decode_iso1AC_EVSEStatusTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AC_EVSEChargeParameterType, EVSENominalVoltage), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AC_EVSEChargeParameterType, EVSEMaxCurrent), 0, 0, 0, decode_iso1PhysicalValueTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1AC_EVSEChargeParameterTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1AC_EVSEChargeParameterTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t iso1AC_EVSEChargeParameterTypeGrammar = { iso1AC_EVSEChargeParameterTypeStates, iso1AC_EVSEChargeParameterTypeTransitions, iso1AC_EVSEChargeParameterTypeProductions, NULL };
+
+static int decode_iso1AC_EVSEChargeParameterType(bitstream_t* stream, struct iso1AC_EVSEChargeParameterType* iso1AC_EVSEChargeParameterType) {
+	init_iso1AC_EVSEChargeParameterType(iso1AC_EVSEChargeParameterType);
+	return decodeGrammar(stream, &iso1AC_EVSEChargeParameterTypeGrammar, iso1AC_EVSEChargeParameterType);
+}
+#else
 static int decode_iso1AC_EVSEChargeParameterType(bitstream_t* stream, struct iso1AC_EVSEChargeParameterType* iso1AC_EVSEChargeParameterType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 338;
 	int done = 0;
 	
@@ -14815,9 +20687,31 @@ static int decode_iso1AC_EVSEChargeParameterType(bitstream_t* stream, struct iso
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CableCheckReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":DC_EVStatus)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1CableCheckReqTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1CableCheckReqType, DC_EVStatus), 0, 0, 0, decode_iso1DC_EVStatusTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1CableCheckReqTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1CableCheckReqTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t iso1CableCheckReqTypeGrammar = { iso1CableCheckReqTypeStates, iso1CableCheckReqTypeTransitions, iso1CableCheckReqTypeProductions, NULL };
+
+static int decode_iso1CableCheckReqType(bitstream_t* stream, struct iso1CableCheckReqType* iso1CableCheckReqType) {
+	init_iso1CableCheckReqType(iso1CableCheckReqType);
+	return decodeGrammar(stream, &iso1CableCheckReqTypeGrammar, iso1CableCheckReqType);
+}
+#else
 static int decode_iso1CableCheckReqType(bitstream_t* stream, struct iso1CableCheckReqType* iso1CableCheckReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 313;
 	int done = 0;
 	
@@ -14865,9 +20759,40 @@ static int decode_iso1CableCheckReqType(bitstream_t* stream, struct iso1CableChe
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_CableCheckReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SelectedServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ServiceID,"urn:iso:15118:2:2013:MsgDataTypes":ParameterSetID{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1SelectedServiceTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SelectedServiceType, ServiceID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER16, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1SelectedServiceType, ParameterSetID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SelectedServiceTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1SelectedServiceTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 1, 1 }
+};
+static void iso1SelectedServiceTypeUsed(void* value, uint8_t flag) {
+	struct iso1SelectedServiceType* iso1SelectedServiceType = (struct iso1SelectedServiceType*)value;
+	switch(flag) {
+	case 0:
+		iso1SelectedServiceType->ParameterSetID_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1SelectedServiceTypeGrammar = { iso1SelectedServiceTypeStates, iso1SelectedServiceTypeTransitions, iso1SelectedServiceTypeProductions, iso1SelectedServiceTypeUsed };
+
+static int decode_iso1SelectedServiceType(bitstream_t* stream, struct iso1SelectedServiceType* iso1SelectedServiceType) {
+	init_iso1SelectedServiceType(iso1SelectedServiceType);
+	return decodeGrammar(stream, &iso1SelectedServiceTypeGrammar, iso1SelectedServiceType);
+}
+#else
 static int decode_iso1SelectedServiceType(bitstream_t* stream, struct iso1SelectedServiceType* iso1SelectedServiceType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 341;
 	int done = 0;
 	
@@ -14969,9 +20894,33 @@ static int decode_iso1SelectedServiceType(bitstream_t* stream, struct iso1Select
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,AC_EVSEStatusType',  base type name='EVSEStatusType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":NotificationMaxDelay,"urn:iso:15118:2:2013:MsgDataTypes":EVSENotification),("urn:iso:15118:2:2013:MsgDataTypes":RCD))',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1AC_EVSEStatusTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_UNSIGNED16, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AC_EVSEStatusType, NotificationMaxDelay), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 2, sizeof(iso1EVSENotificationType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AC_EVSEStatusType, EVSENotification), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BOOLEAN, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1AC_EVSEStatusType, RCD), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1AC_EVSEStatusTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1AC_EVSEStatusTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static const exi_grammar_t iso1AC_EVSEStatusTypeGrammar = { iso1AC_EVSEStatusTypeStates, iso1AC_EVSEStatusTypeTransitions, iso1AC_EVSEStatusTypeProductions, NULL };
+
+static int decode_iso1AC_EVSEStatusType(bitstream_t* stream, struct iso1AC_EVSEStatusType* iso1AC_EVSEStatusType) {
+	init_iso1AC_EVSEStatusType(iso1AC_EVSEStatusType);
+	return decodeGrammar(stream, &iso1AC_EVSEStatusTypeGrammar, iso1AC_EVSEStatusType);
+}
+#else
 static int decode_iso1AC_EVSEStatusType(bitstream_t* stream, struct iso1AC_EVSEStatusType* iso1AC_EVSEStatusType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 343;
 	int done = 0;
 	
@@ -15101,9 +21050,50 @@ static int decode_iso1AC_EVSEStatusType(bitstream_t* stream, struct iso1AC_EVSES
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SalesTariffType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":SalesTariffID,"urn:iso:15118:2:2013:MsgDataTypes":SalesTariffDescription{0-1},"urn:iso:15118:2:2013:MsgDataTypes":NumEPriceLevels{0-1},"urn:iso:15118:2:2013:MsgDataTypes":SalesTariffEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SalesTariffTypeProductions[6] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1SalesTariffType, Id.characters), offsetof(struct iso1SalesTariffType, Id.charactersLen), iso1SalesTariffType_Id_CHARACTERS_SIZE, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(uint8_t), 1, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SalesTariffType, SalesTariffID), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1SalesTariffType, SalesTariffDescription.characters), offsetof(struct iso1SalesTariffType, SalesTariffDescription.charactersLen), iso1SalesTariffType_SalesTariffDescription_CHARACTERS_SIZE, 21 /* {urn:iso:15118:2:2013:MsgDataTypes}SalesTariffDescription */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 8, sizeof(uint8_t), 0, 2, 0, 0, 0, 0, 0, offsetof(struct iso1SalesTariffType, NumEPriceLevels), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE, offsetof(struct iso1SalesTariffType, SalesTariffEntry.array), offsetof(struct iso1SalesTariffType, SalesTariffEntry.arrayLen), sizeof(((struct iso1SalesTariffType*)0)->SalesTariffEntry.array[0]), 0, 0, 0, 0, decode_iso1SalesTariffEntryTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SalesTariffTypeTransitions[11] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 4, 3 }, { 5, 4 },
+	{ 5, 4 }, { 5, 4 }, { 0, 5 }
+};
+static const exi_grammar_state_t iso1SalesTariffTypeStates[6] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 3 }, { 6, 2, 2 }, { 8, 1, 1 }, { 9, 2, 2 }
+};
+static void iso1SalesTariffTypeUsed(void* value, uint8_t flag) {
+	struct iso1SalesTariffType* iso1SalesTariffType = (struct iso1SalesTariffType*)value;
+	switch(flag) {
+	case 0:
+		iso1SalesTariffType->Id_isUsed = 1u;
+		break;
+	case 1:
+		iso1SalesTariffType->SalesTariffDescription_isUsed = 1u;
+		break;
+	case 2:
+		iso1SalesTariffType->NumEPriceLevels_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1SalesTariffTypeGrammar = { iso1SalesTariffTypeStates, iso1SalesTariffTypeTransitions, iso1SalesTariffTypeProductions, iso1SalesTariffTypeUsed };
+
+static int decode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTariffType* iso1SalesTariffType) {
+	init_iso1SalesTariffType(iso1SalesTariffType);
+	return decodeGrammar(stream, &iso1SalesTariffTypeGrammar, iso1SalesTariffType);
+}
+#else
 static int decode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTariffType* iso1SalesTariffType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 346;
 	int done = 0;
 	
@@ -15121,10 +21111,24 @@ static int decode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTarif
 					if (errn == 0) {
 						if (iso1SalesTariffType->Id.charactersLen >= 2) {
 							iso1SalesTariffType->Id.charactersLen = (uint16_t)(iso1SalesTariffType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SalesTariffType->Id.characters, CHARACTER_UNITS(iso1SalesTariffType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SalesTariffType->Id.charactersLen, iso1SalesTariffType->Id.characters, iso1SalesTariffType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SalesTariffType->Id.charactersLen, iso1SalesTariffType->Id.characters, iso1SalesTariffType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, iso1SalesTariffType->Id.characters, iso1SalesTariffType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, &iso1SalesTariffType->Id.charactersLen, &iso1SalesTariffType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, &iso1SalesTariffType->Id.charactersLen, iso1SalesTariffType->Id.characters, iso1SalesTariffType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1SalesTariffType->Id_isUsed = 1u;
@@ -15205,10 +21209,24 @@ static int decode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTarif
 							if (errn == 0) {
 								if (iso1SalesTariffType->SalesTariffDescription.charactersLen >= 2) {
 									iso1SalesTariffType->SalesTariffDescription.charactersLen = (uint16_t)(iso1SalesTariffType->SalesTariffDescription.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+									errn = EXI_ARENA_ALLOCATE(stream, iso1SalesTariffType->SalesTariffDescription.characters, CHARACTER_UNITS(iso1SalesTariffType->SalesTariffDescription.charactersLen));
+									if (errn == 0) {
+										errn = decodeCharacters(stream, iso1SalesTariffType->SalesTariffDescription.charactersLen, iso1SalesTariffType->SalesTariffDescription.characters, iso1SalesTariffType_SalesTariffDescription_CHARACTERS_SIZE);
+									}
+#else
 									errn = decodeCharacters(stream, iso1SalesTariffType->SalesTariffDescription.charactersLen, iso1SalesTariffType->SalesTariffDescription.characters, iso1SalesTariffType_SalesTariffDescription_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+									if (errn == 0) {
+										errn = addStringValue(stream, 21 /* {urn:iso:15118:2:2013:MsgDataTypes}SalesTariffDescription */, iso1SalesTariffType->SalesTariffDescription.characters, iso1SalesTariffType->SalesTariffDescription.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+									errn = decodeStringValueHitArena(stream, 21 /* {urn:iso:15118:2:2013:MsgDataTypes}SalesTariffDescription */, &iso1SalesTariffType->SalesTariffDescription.charactersLen, &iso1SalesTariffType->SalesTariffDescription.characters);
+#else
+									errn = decodeStringValueHit(stream, 21 /* {urn:iso:15118:2:2013:MsgDataTypes}SalesTariffDescription */, &iso1SalesTariffType->SalesTariffDescription.charactersLen, iso1SalesTariffType->SalesTariffDescription.characters, iso1SalesTariffType_SalesTariffDescription_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 								}
 							}
 							iso1SalesTariffType->SalesTariffDescription_isUsed = 1u;
@@ -15251,7 +21269,16 @@ static int decode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTarif
 					}
 					break;
 				case 2:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SalesTariffType->SalesTariffEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SalesTariffType->SalesTariffEntry.array, iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SalesTariffType->SalesTariffEntry.arrayLen < iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE) {
+#else
 					if (iso1SalesTariffType->SalesTariffEntry.arrayLen < iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SalesTariffEntryType(stream, &iso1SalesTariffType->SalesTariffEntry.array[iso1SalesTariffType->SalesTariffEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -15293,7 +21320,16 @@ static int decode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTarif
 					}
 					break;
 				case 1:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SalesTariffType->SalesTariffEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SalesTariffType->SalesTariffEntry.array, iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SalesTariffType->SalesTariffEntry.arrayLen < iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE) {
+#else
 					if (iso1SalesTariffType->SalesTariffEntry.arrayLen < iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SalesTariffEntryType(stream, &iso1SalesTariffType->SalesTariffEntry.array[iso1SalesTariffType->SalesTariffEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -15312,7 +21348,16 @@ static int decode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTarif
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SalesTariffType->SalesTariffEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SalesTariffType->SalesTariffEntry.array, iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SalesTariffType->SalesTariffEntry.arrayLen < iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE) {
+#else
 					if (iso1SalesTariffType->SalesTariffEntry.arrayLen < iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SalesTariffEntryType(stream, &iso1SalesTariffType->SalesTariffEntry.array[iso1SalesTariffType->SalesTariffEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -15331,7 +21376,16 @@ static int decode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTarif
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DATABINDING == DATABINDING_SLIM
+					if (iso1SalesTariffType->SalesTariffEntry.arrayLen == 0u) {
+						errn = EXI_ARENA_ALLOCATE(stream, iso1SalesTariffType->SalesTariffEntry.array, iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE);
+					}
+					if (errn != 0) {
+						/* out of arena memory */
+					} else if (iso1SalesTariffType->SalesTariffEntry.arrayLen < iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE) {
+#else
 					if (iso1SalesTariffType->SalesTariffEntry.arrayLen < iso1SalesTariffType_SalesTariffEntry_ARRAY_SIZE) {
+#endif /* DATABINDING_SLIM */
 						errn = decode_iso1SalesTariffEntryType(stream, &iso1SalesTariffType->SalesTariffEntry.array[iso1SalesTariffType->SalesTariffEntry.arrayLen++]);
 					} else { 
 						errn = EXI_ERROR_OUT_OF_BOUNDS;
@@ -15358,9 +21412,33 @@ static int decode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTarif
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PaymentServiceSelectionReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":SelectedPaymentOption,"urn:iso:15118:2:2013:MsgBody":SelectedServiceList)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1PaymentServiceSelectionReqTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 1, sizeof(iso1paymentOptionType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PaymentServiceSelectionReqType, SelectedPaymentOption), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PaymentServiceSelectionReqType, SelectedServiceList), 0, 0, 0, decode_iso1SelectedServiceListTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PaymentServiceSelectionReqTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1PaymentServiceSelectionReqTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t iso1PaymentServiceSelectionReqTypeGrammar = { iso1PaymentServiceSelectionReqTypeStates, iso1PaymentServiceSelectionReqTypeTransitions, iso1PaymentServiceSelectionReqTypeProductions, NULL };
+
+static int decode_iso1PaymentServiceSelectionReqType(bitstream_t* stream, struct iso1PaymentServiceSelectionReqType* iso1PaymentServiceSelectionReqType) {
+	init_iso1PaymentServiceSelectionReqType(iso1PaymentServiceSelectionReqType);
+	return decodeGrammar(stream, &iso1PaymentServiceSelectionReqTypeGrammar, iso1PaymentServiceSelectionReqType);
+}
+#else
 static int decode_iso1PaymentServiceSelectionReqType(bitstream_t* stream, struct iso1PaymentServiceSelectionReqType* iso1PaymentServiceSelectionReqType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 352;
 	int done = 0;
 	
@@ -15441,9 +21519,41 @@ static int decode_iso1PaymentServiceSelectionReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertiesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignatureProperty{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if ISO1_DEPLOY_SignatureProperties == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SignaturePropertiesTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1SignaturePropertiesType, Id.characters), offsetof(struct iso1SignaturePropertiesType, Id.charactersLen), iso1SignaturePropertiesType_Id_CHARACTERS_SIZE, 27 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, iso1SignaturePropertiesType_SignatureProperty_ARRAY_SIZE, offsetof(struct iso1SignaturePropertiesType, SignatureProperty.array), offsetof(struct iso1SignaturePropertiesType, SignatureProperty.arrayLen), sizeof(((struct iso1SignaturePropertiesType*)0)->SignatureProperty.array[0]), 0, 0, 0, 0, decode_iso1SignaturePropertyTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SignaturePropertiesTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t iso1SignaturePropertiesTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }
+};
+static void iso1SignaturePropertiesTypeUsed(void* value, uint8_t flag) {
+	struct iso1SignaturePropertiesType* iso1SignaturePropertiesType = (struct iso1SignaturePropertiesType*)value;
+	switch(flag) {
+	case 0:
+		iso1SignaturePropertiesType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1SignaturePropertiesTypeGrammar = { iso1SignaturePropertiesTypeStates, iso1SignaturePropertiesTypeTransitions, iso1SignaturePropertiesTypeProductions, iso1SignaturePropertiesTypeUsed };
+
+static int decode_iso1SignaturePropertiesType(bitstream_t* stream, struct iso1SignaturePropertiesType* iso1SignaturePropertiesType) {
+	init_iso1SignaturePropertiesType(iso1SignaturePropertiesType);
+	return decodeGrammar(stream, &iso1SignaturePropertiesTypeGrammar, iso1SignaturePropertiesType);
+}
+#else
 static int decode_iso1SignaturePropertiesType(bitstream_t* stream, struct iso1SignaturePropertiesType* iso1SignaturePropertiesType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 354;
 	int done = 0;
 	
@@ -15461,10 +21571,24 @@ static int decode_iso1SignaturePropertiesType(bitstream_t* stream, struct iso1Si
 					if (errn == 0) {
 						if (iso1SignaturePropertiesType->Id.charactersLen >= 2) {
 							iso1SignaturePropertiesType->Id.charactersLen = (uint16_t)(iso1SignaturePropertiesType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignaturePropertiesType->Id.characters, CHARACTER_UNITS(iso1SignaturePropertiesType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignaturePropertiesType->Id.charactersLen, iso1SignaturePropertiesType->Id.characters, iso1SignaturePropertiesType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignaturePropertiesType->Id.charactersLen, iso1SignaturePropertiesType->Id.characters, iso1SignaturePropertiesType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 27 /* {}Id */, iso1SignaturePropertiesType->Id.characters, iso1SignaturePropertiesType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 27 /* {}Id */, &iso1SignaturePropertiesType->Id.charactersLen, &iso1SignaturePropertiesType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 27 /* {}Id */, &iso1SignaturePropertiesType->Id.charactersLen, iso1SignaturePropertiesType->Id.characters, iso1SignaturePropertiesType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1SignaturePropertiesType->Id_isUsed = 1u;
@@ -15536,9 +21660,31 @@ static int decode_iso1SignaturePropertiesType(bitstream_t* stream, struct iso1Si
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_SignatureProperties */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,BodyBaseType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1BodyBaseTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1BodyBaseTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t iso1BodyBaseTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t iso1BodyBaseTypeGrammar = { iso1BodyBaseTypeStates, iso1BodyBaseTypeTransitions, iso1BodyBaseTypeProductions, NULL };
+
+static int decode_iso1BodyBaseType(bitstream_t* stream, struct iso1BodyBaseType* iso1BodyBaseType) {
+	init_iso1BodyBaseType(iso1BodyBaseType);
+	return decodeGrammar(stream, &iso1BodyBaseTypeGrammar, iso1BodyBaseType);
+}
+#else
 static int decode_iso1BodyBaseType(bitstream_t* stream, struct iso1BodyBaseType* iso1BodyBaseType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -15571,9 +21717,33 @@ static int decode_iso1BodyBaseType(bitstream_t* stream, struct iso1BodyBaseType*
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_BodyElement */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SupportedEnergyTransferModeType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":EnergyTransferMode{1-6})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1SupportedEnergyTransferModeTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 3, sizeof(iso1EnergyTransferModeType), 0, EXI_GRAMMAR_NO_FLAG, 0, iso1SupportedEnergyTransferModeType_EnergyTransferMode_ARRAY_SIZE, offsetof(struct iso1SupportedEnergyTransferModeType, EnergyTransferMode.array), offsetof(struct iso1SupportedEnergyTransferModeType, EnergyTransferMode.arrayLen), sizeof(((struct iso1SupportedEnergyTransferModeType*)0)->EnergyTransferMode.array[0]), 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SupportedEnergyTransferModeTypeTransitions[12] = {
+	{ 1, 0 }, { 2, 0 }, { 0, 1 }, { 3, 0 }, { 0, 1 }, { 4, 0 }, { 0, 1 }, { 5, 0 },
+	{ 0, 1 }, { 6, 0 }, { 0, 1 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1SupportedEnergyTransferModeTypeStates[7] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }, { 3, 2, 2 }, { 5, 2, 2 }, { 7, 2, 2 }, { 9, 2, 2 }, { 11, 1, 1 }
+};
+static const exi_grammar_t iso1SupportedEnergyTransferModeTypeGrammar = { iso1SupportedEnergyTransferModeTypeStates, iso1SupportedEnergyTransferModeTypeTransitions, iso1SupportedEnergyTransferModeTypeProductions, NULL };
+
+static int decode_iso1SupportedEnergyTransferModeType(bitstream_t* stream, struct iso1SupportedEnergyTransferModeType* iso1SupportedEnergyTransferModeType) {
+	init_iso1SupportedEnergyTransferModeType(iso1SupportedEnergyTransferModeType);
+	return decodeGrammar(stream, &iso1SupportedEnergyTransferModeTypeGrammar, iso1SupportedEnergyTransferModeType);
+}
+#else
 static int decode_iso1SupportedEnergyTransferModeType(bitstream_t* stream, struct iso1SupportedEnergyTransferModeType* iso1SupportedEnergyTransferModeType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 357;
 	int done = 0;
 	
@@ -15854,9 +22024,30 @@ static int decode_iso1SupportedEnergyTransferModeType(bitstream_t* stream, struc
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ChargingStatusReqType',  base type name='BodyBaseType',  content type='EMPTY',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1ChargingStatusReqTypeProductions[1] = {
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1ChargingStatusReqTypeTransitions[1] = {
+	{ 0, 0 }
+};
+static const exi_grammar_state_t iso1ChargingStatusReqTypeStates[1] = {
+	{ 0, 1, 1 }
+};
+static const exi_grammar_t iso1ChargingStatusReqTypeGrammar = { iso1ChargingStatusReqTypeStates, iso1ChargingStatusReqTypeTransitions, iso1ChargingStatusReqTypeProductions, NULL };
+
+static int decode_iso1ChargingStatusReqType(bitstream_t* stream, struct iso1ChargingStatusReqType* iso1ChargingStatusReqType) {
+	init_iso1ChargingStatusReqType(iso1ChargingStatusReqType);
+	return decodeGrammar(stream, &iso1ChargingStatusReqTypeGrammar, iso1ChargingStatusReqType);
+}
+#else
 static int decode_iso1ChargingStatusReqType(bitstream_t* stream, struct iso1ChargingStatusReqType* iso1ChargingStatusReqType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -15889,9 +22080,33 @@ static int decode_iso1ChargingStatusReqType(bitstream_t* stream, struct iso1Char
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PaymentServiceSelectionResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t iso1PaymentServiceSelectionResTypeProductions[2] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_NBIT, 5, sizeof(iso1responseCodeType), 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1PaymentServiceSelectionResType, ResponseCode), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PaymentServiceSelectionResTypeTransitions[2] = {
+	{ 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t iso1PaymentServiceSelectionResTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }
+};
+static const exi_grammar_t iso1PaymentServiceSelectionResTypeGrammar = { iso1PaymentServiceSelectionResTypeStates, iso1PaymentServiceSelectionResTypeTransitions, iso1PaymentServiceSelectionResTypeProductions, NULL };
+
+static int decode_iso1PaymentServiceSelectionResType(bitstream_t* stream, struct iso1PaymentServiceSelectionResType* iso1PaymentServiceSelectionResType) {
+	init_iso1PaymentServiceSelectionResType(iso1PaymentServiceSelectionResType);
+	return decodeGrammar(stream, &iso1PaymentServiceSelectionResTypeGrammar, iso1PaymentServiceSelectionResType);
+}
+#else
 static int decode_iso1PaymentServiceSelectionResType(bitstream_t* stream, struct iso1PaymentServiceSelectionResType* iso1PaymentServiceSelectionResType) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	int grammarID = 122;
 	int done = 0;
 	
@@ -15957,9 +22172,41 @@ static int decode_iso1PaymentServiceSelectionResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DigestMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1DigestMethodTypeProductions[4] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1DigestMethodType, Algorithm.characters), offsetof(struct iso1DigestMethodType, Algorithm.charactersLen), iso1DigestMethodType_Algorithm_CHARACTERS_SIZE, 25 /* {}Algorithm */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1DigestMethodType, ANY.characters), offsetof(struct iso1DigestMethodType, ANY.charactersLen), iso1DigestMethodType_ANY_CHARACTERS_SIZE, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, NULL }
+};
+static const exi_grammar_transition_t iso1DigestMethodTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 2, 3 }, { 2, 1 }, { 0, 2 }, { 2, 3 }
+};
+static const exi_grammar_state_t iso1DigestMethodTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 2, 3 }
+};
+static void iso1DigestMethodTypeUsed(void* value, uint8_t flag) {
+	struct iso1DigestMethodType* iso1DigestMethodType = (struct iso1DigestMethodType*)value;
+	switch(flag) {
+	case 0:
+		iso1DigestMethodType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1DigestMethodTypeGrammar = { iso1DigestMethodTypeStates, iso1DigestMethodTypeTransitions, iso1DigestMethodTypeProductions, iso1DigestMethodTypeUsed };
+
+static int decode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMethodType* iso1DigestMethodType) {
+	init_iso1DigestMethodType(iso1DigestMethodType);
+	return decodeGrammar(stream, &iso1DigestMethodTypeGrammar, iso1DigestMethodType);
+}
+#else
 static int decode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMethodType* iso1DigestMethodType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 312;
 	int done = 0;
 	
@@ -15977,10 +22224,24 @@ static int decode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMet
 					if (errn == 0) {
 						if (iso1DigestMethodType->Algorithm.charactersLen >= 2) {
 							iso1DigestMethodType->Algorithm.charactersLen = (uint16_t)(iso1DigestMethodType->Algorithm.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1DigestMethodType->Algorithm.characters, CHARACTER_UNITS(iso1DigestMethodType->Algorithm.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1DigestMethodType->Algorithm.charactersLen, iso1DigestMethodType->Algorithm.characters, iso1DigestMethodType_Algorithm_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1DigestMethodType->Algorithm.charactersLen, iso1DigestMethodType->Algorithm.characters, iso1DigestMethodType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 25 /* {}Algorithm */, iso1DigestMethodType->Algorithm.characters, iso1DigestMethodType->Algorithm.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 25 /* {}Algorithm */, &iso1DigestMethodType->Algorithm.charactersLen, &iso1DigestMethodType->Algorithm.characters);
+#else
+							errn = decodeStringValueHit(stream, 25 /* {}Algorithm */, &iso1DigestMethodType->Algorithm.charactersLen, iso1DigestMethodType->Algorithm.characters, iso1DigestMethodType_Algorithm_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 115;
@@ -16010,10 +22271,24 @@ static int decode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMet
 					if (errn == 0) {
 						if (iso1DigestMethodType->ANY.charactersLen >= 2) {
 							iso1DigestMethodType->ANY.charactersLen = (uint16_t)(iso1DigestMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1DigestMethodType->ANY.characters, CHARACTER_UNITS(iso1DigestMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1DigestMethodType->ANY.charactersLen, iso1DigestMethodType->ANY.characters, iso1DigestMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1DigestMethodType->ANY.charactersLen, iso1DigestMethodType->ANY.characters, iso1DigestMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, iso1DigestMethodType->ANY.characters, iso1DigestMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, &iso1DigestMethodType->ANY.charactersLen, &iso1DigestMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, &iso1DigestMethodType->ANY.charactersLen, iso1DigestMethodType->ANY.characters, iso1DigestMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1DigestMethodType->ANY_isUsed = 1u;
@@ -16044,10 +22319,24 @@ static int decode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMet
 					if (errn == 0) {
 						if (iso1DigestMethodType->ANY.charactersLen >= 2) {
 							iso1DigestMethodType->ANY.charactersLen = (uint16_t)(iso1DigestMethodType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1DigestMethodType->ANY.characters, CHARACTER_UNITS(iso1DigestMethodType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1DigestMethodType->ANY.charactersLen, iso1DigestMethodType->ANY.characters, iso1DigestMethodType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1DigestMethodType->ANY.charactersLen, iso1DigestMethodType->ANY.characters, iso1DigestMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, iso1DigestMethodType->ANY.characters, iso1DigestMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, &iso1DigestMethodType->ANY.charactersLen, &iso1DigestMethodType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, &iso1DigestMethodType->ANY.charactersLen, iso1DigestMethodType->ANY.characters, iso1DigestMethodType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1DigestMethodType->ANY_isUsed = 1u;
@@ -16069,9 +22358,45 @@ static int decode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMet
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertyType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1SignaturePropertyTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1SignaturePropertyType, Id.characters), offsetof(struct iso1SignaturePropertyType, Id.charactersLen), iso1SignaturePropertyType_Id_CHARACTERS_SIZE, 27 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct iso1SignaturePropertyType, Target.characters), offsetof(struct iso1SignaturePropertyType, Target.charactersLen), iso1SignaturePropertyType_Target_CHARACTERS_SIZE, 29 /* {}Target */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1SignaturePropertyType, ANY.characters), offsetof(struct iso1SignaturePropertyType, ANY.charactersLen), iso1SignaturePropertyType_ANY_CHARACTERS_SIZE, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1SignaturePropertyTypeTransitions[10] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 3, 2 }, { 0, 4 }, { 3, 3 },
+	{ 3, 2 }, { 4, 3 }
+};
+static const exi_grammar_state_t iso1SignaturePropertyTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }, { 5, 2, 3 }, { 8, 2, 2 }
+};
+static void iso1SignaturePropertyTypeUsed(void* value, uint8_t flag) {
+	struct iso1SignaturePropertyType* iso1SignaturePropertyType = (struct iso1SignaturePropertyType*)value;
+	switch(flag) {
+	case 0:
+		iso1SignaturePropertyType->Id_isUsed = 1u;
+		break;
+	case 1:
+		iso1SignaturePropertyType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1SignaturePropertyTypeGrammar = { iso1SignaturePropertyTypeStates, iso1SignaturePropertyTypeTransitions, iso1SignaturePropertyTypeProductions, iso1SignaturePropertyTypeUsed };
+
+static int decode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1SignaturePropertyType* iso1SignaturePropertyType) {
+	init_iso1SignaturePropertyType(iso1SignaturePropertyType);
+	return decodeGrammar(stream, &iso1SignaturePropertyTypeGrammar, iso1SignaturePropertyType);
+}
+#else
 static int decode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1SignaturePropertyType* iso1SignaturePropertyType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 363;
 	int done = 0;
 	
@@ -16089,10 +22414,24 @@ static int decode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 					if (errn == 0) {
 						if (iso1SignaturePropertyType->Id.charactersLen >= 2) {
 							iso1SignaturePropertyType->Id.charactersLen = (uint16_t)(iso1SignaturePropertyType->Id.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignaturePropertyType->Id.characters, CHARACTER_UNITS(iso1SignaturePropertyType->Id.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignaturePropertyType->Id.charactersLen, iso1SignaturePropertyType->Id.characters, iso1SignaturePropertyType_Id_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignaturePropertyType->Id.charactersLen, iso1SignaturePropertyType->Id.characters, iso1SignaturePropertyType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 27 /* {}Id */, iso1SignaturePropertyType->Id.characters, iso1SignaturePropertyType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 27 /* {}Id */, &iso1SignaturePropertyType->Id.charactersLen, &iso1SignaturePropertyType->Id.characters);
+#else
+							errn = decodeStringValueHit(stream, 27 /* {}Id */, &iso1SignaturePropertyType->Id.charactersLen, iso1SignaturePropertyType->Id.characters, iso1SignaturePropertyType_Id_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1SignaturePropertyType->Id_isUsed = 1u;
@@ -16103,10 +22442,24 @@ static int decode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 					if (errn == 0) {
 						if (iso1SignaturePropertyType->Target.charactersLen >= 2) {
 							iso1SignaturePropertyType->Target.charactersLen = (uint16_t)(iso1SignaturePropertyType->Target.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignaturePropertyType->Target.characters, CHARACTER_UNITS(iso1SignaturePropertyType->Target.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignaturePropertyType->Target.charactersLen, iso1SignaturePropertyType->Target.characters, iso1SignaturePropertyType_Target_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignaturePropertyType->Target.charactersLen, iso1SignaturePropertyType->Target.characters, iso1SignaturePropertyType_Target_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 29 /* {}Target */, iso1SignaturePropertyType->Target.characters, iso1SignaturePropertyType->Target.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 29 /* {}Target */, &iso1SignaturePropertyType->Target.charactersLen, &iso1SignaturePropertyType->Target.characters);
+#else
+							errn = decodeStringValueHit(stream, 29 /* {}Target */, &iso1SignaturePropertyType->Target.charactersLen, iso1SignaturePropertyType->Target.characters, iso1SignaturePropertyType_Target_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 365;
@@ -16127,10 +22480,24 @@ static int decode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 					if (errn == 0) {
 						if (iso1SignaturePropertyType->Target.charactersLen >= 2) {
 							iso1SignaturePropertyType->Target.charactersLen = (uint16_t)(iso1SignaturePropertyType->Target.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignaturePropertyType->Target.characters, CHARACTER_UNITS(iso1SignaturePropertyType->Target.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignaturePropertyType->Target.charactersLen, iso1SignaturePropertyType->Target.characters, iso1SignaturePropertyType_Target_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignaturePropertyType->Target.charactersLen, iso1SignaturePropertyType->Target.characters, iso1SignaturePropertyType_Target_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 29 /* {}Target */, iso1SignaturePropertyType->Target.characters, iso1SignaturePropertyType->Target.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 29 /* {}Target */, &iso1SignaturePropertyType->Target.charactersLen, &iso1SignaturePropertyType->Target.characters);
+#else
+							errn = decodeStringValueHit(stream, 29 /* {}Target */, &iso1SignaturePropertyType->Target.charactersLen, iso1SignaturePropertyType->Target.characters, iso1SignaturePropertyType_Target_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					grammarID = 365;
@@ -16156,10 +22523,24 @@ static int decode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 					if (errn == 0) {
 						if (iso1SignaturePropertyType->ANY.charactersLen >= 2) {
 							iso1SignaturePropertyType->ANY.charactersLen = (uint16_t)(iso1SignaturePropertyType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignaturePropertyType->ANY.characters, CHARACTER_UNITS(iso1SignaturePropertyType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignaturePropertyType->ANY.charactersLen, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignaturePropertyType->ANY.charactersLen, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &iso1SignaturePropertyType->ANY.charactersLen, &iso1SignaturePropertyType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &iso1SignaturePropertyType->ANY.charactersLen, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1SignaturePropertyType->ANY_isUsed = 1u;
@@ -16190,10 +22571,24 @@ static int decode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 					if (errn == 0) {
 						if (iso1SignaturePropertyType->ANY.charactersLen >= 2) {
 							iso1SignaturePropertyType->ANY.charactersLen = (uint16_t)(iso1SignaturePropertyType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignaturePropertyType->ANY.characters, CHARACTER_UNITS(iso1SignaturePropertyType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignaturePropertyType->ANY.charactersLen, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignaturePropertyType->ANY.charactersLen, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &iso1SignaturePropertyType->ANY.charactersLen, &iso1SignaturePropertyType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &iso1SignaturePropertyType->ANY.charactersLen, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1SignaturePropertyType->ANY_isUsed = 1u;
@@ -16220,10 +22615,24 @@ static int decode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 					if (errn == 0) {
 						if (iso1SignaturePropertyType->ANY.charactersLen >= 2) {
 							iso1SignaturePropertyType->ANY.charactersLen = (uint16_t)(iso1SignaturePropertyType->ANY.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, iso1SignaturePropertyType->ANY.characters, CHARACTER_UNITS(iso1SignaturePropertyType->ANY.charactersLen));
+							if (errn == 0) {
+								errn = decodeCharacters(stream, iso1SignaturePropertyType->ANY.charactersLen, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType_ANY_CHARACTERS_SIZE);
+							}
+#else
 							errn = decodeCharacters(stream, iso1SignaturePropertyType->ANY.charactersLen, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+							if (errn == 0) {
+								errn = addStringValue(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+							errn = decodeStringValueHitArena(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &iso1SignaturePropertyType->ANY.charactersLen, &iso1SignaturePropertyType->ANY.characters);
+#else
+							errn = decodeStringValueHit(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &iso1SignaturePropertyType->ANY.charactersLen, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType_ANY_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 						}
 					}
 					iso1SignaturePropertyType->ANY_isUsed = 1u;
@@ -16245,9 +22654,43 @@ static int decode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,PGPDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":PGPKeyID,"http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})|("http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED}))',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE && DATABINDING != DATABINDING_SLIM
+static const exi_grammar_production_t iso1PGPDataTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct iso1PGPDataType, PGPKeyID.bytes), offsetof(struct iso1PGPDataType, PGPKeyID.bytesLen), iso1PGPDataType_PGPKeyID_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct iso1PGPDataType, PGPKeyPacket.bytes), offsetof(struct iso1PGPDataType, PGPKeyPacket.bytesLen), iso1PGPDataType_PGPKeyPacket_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t iso1PGPDataTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 2, 2 }, { 0, 3 }, { 2, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t iso1PGPDataTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 2, 3 }, { 5, 2, 2 }
+};
+static void iso1PGPDataTypeUsed(void* value, uint8_t flag) {
+	struct iso1PGPDataType* iso1PGPDataType = (struct iso1PGPDataType*)value;
+	switch(flag) {
+	case 0:
+		iso1PGPDataType->PGPKeyID_isUsed = 1u;
+		break;
+	case 1:
+		iso1PGPDataType->PGPKeyPacket_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t iso1PGPDataTypeGrammar = { iso1PGPDataTypeStates, iso1PGPDataTypeTransitions, iso1PGPDataTypeProductions, iso1PGPDataTypeUsed };
+
+static int decode_iso1PGPDataType(bitstream_t* stream, struct iso1PGPDataType* iso1PGPDataType) {
+	init_iso1PGPDataType(iso1PGPDataType);
+	return decodeGrammar(stream, &iso1PGPDataTypeGrammar, iso1PGPDataType);
+}
+#else
 static int decode_iso1PGPDataType(bitstream_t* stream, struct iso1PGPDataType* iso1PGPDataType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 367;
 	int done = 0;
 	
@@ -16270,7 +22713,14 @@ static int decode_iso1PGPDataType(bitstream_t* stream, struct iso1PGPDataType* i
 								errn =  (iso1PGPDataType->PGPKeyID.bytesLen) <= iso1PGPDataType_PGPKeyID_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1PGPDataType->PGPKeyID.bytes, iso1PGPDataType->PGPKeyID.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1PGPDataType->PGPKeyID.bytesLen, iso1PGPDataType->PGPKeyID.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1PGPDataType->PGPKeyID.bytesLen, iso1PGPDataType->PGPKeyID.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							iso1PGPDataType->PGPKeyID_isUsed = 1u;
 						} else {
@@ -16298,7 +22748,14 @@ static int decode_iso1PGPDataType(bitstream_t* stream, struct iso1PGPDataType* i
 								errn =  (iso1PGPDataType->PGPKeyPacket.bytesLen) <= iso1PGPDataType_PGPKeyPacket_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1PGPDataType->PGPKeyPacket.bytes, iso1PGPDataType->PGPKeyPacket.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1PGPDataType->PGPKeyPacket.bytesLen, iso1PGPDataType->PGPKeyPacket.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1PGPDataType->PGPKeyPacket.bytesLen, iso1PGPDataType->PGPKeyPacket.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							iso1PGPDataType->PGPKeyPacket_isUsed = 1u;
 						} else {
@@ -16337,7 +22794,14 @@ static int decode_iso1PGPDataType(bitstream_t* stream, struct iso1PGPDataType* i
 								errn =  (iso1PGPDataType->PGPKeyPacket.bytesLen) <= iso1PGPDataType_PGPKeyPacket_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 							}
 							if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, iso1PGPDataType->PGPKeyPacket.bytes, iso1PGPDataType->PGPKeyPacket.bytesLen);
+								if (errn == 0) {
+									errn = decodeBytes(stream, iso1PGPDataType->PGPKeyPacket.bytesLen, iso1PGPDataType->PGPKeyPacket.bytes);
+								}
+#else
 								errn = decodeBytes(stream, iso1PGPDataType->PGPKeyPacket.bytesLen, iso1PGPDataType->PGPKeyPacket.bytes);
+#endif /* DATABINDING_SLIM */
 							}
 							iso1PGPDataType->PGPKeyPacket_isUsed = 1u;
 						} else {
@@ -16400,8 +22864,11 @@ static int decode_iso1PGPDataType(bitstream_t* stream, struct iso1PGPDataType* i
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 int decode_iso1EXISchemaInformedElementFragmentGrammar(bitstream_t* stream, struct iso1EXISchemaInformedElementFragmentGrammar* exiElementFrag) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 370;
 	int done = 0;
 	
@@ -16419,9 +22886,12 @@ int decode_iso1EXISchemaInformedElementFragmentGrammar(bitstream_t* stream, stru
 						if (exiElementFrag->Id.charactersLen >= 2) {
 							exiElementFrag->Id.charactersLen = (uint16_t)(exiElementFrag->Id.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, exiElementFrag->Id.charactersLen, exiElementFrag->Id.characters, iso1exiElementFrag_Id_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, exiElementFrag->Id.characters, exiElementFrag->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, &exiElementFrag->Id.charactersLen, exiElementFrag->Id.characters, iso1exiElementFrag_Id_CHARACTERS_SIZE);
 						}
 					}
 					exiElementFrag->Id_isUsed = 1u;
@@ -16437,9 +22907,12 @@ int decode_iso1EXISchemaInformedElementFragmentGrammar(bitstream_t* stream, stru
 						if (exiElementFrag->CHARACTERS_GENERIC.charactersLen >= 2) {
 							exiElementFrag->CHARACTERS_GENERIC.charactersLen = (uint16_t)(exiElementFrag->CHARACTERS_GENERIC.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, exiElementFrag->CHARACTERS_GENERIC.charactersLen, exiElementFrag->CHARACTERS_GENERIC.characters, iso1exiElementFrag_CHARACTERS_GENERIC_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, exiElementFrag->CHARACTERS_GENERIC.characters, exiElementFrag->CHARACTERS_GENERIC.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, &exiElementFrag->CHARACTERS_GENERIC.charactersLen, exiElementFrag->CHARACTERS_GENERIC.characters, iso1exiElementFrag_CHARACTERS_GENERIC_CHARACTERS_SIZE);
 						}
 					}
 					exiElementFrag->CHARACTERS_GENERIC_isUsed = 1u;
@@ -16466,9 +22939,12 @@ int decode_iso1EXISchemaInformedElementFragmentGrammar(bitstream_t* stream, stru
 						if (exiElementFrag->CHARACTERS_GENERIC.charactersLen >= 2) {
 							exiElementFrag->CHARACTERS_GENERIC.charactersLen = (uint16_t)(exiElementFrag->CHARACTERS_GENERIC.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, exiElementFrag->CHARACTERS_GENERIC.charactersLen, exiElementFrag->CHARACTERS_GENERIC.characters, iso1exiElementFrag_CHARACTERS_GENERIC_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, exiElementFrag->CHARACTERS_GENERIC.characters, exiElementFrag->CHARACTERS_GENERIC.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, &exiElementFrag->CHARACTERS_GENERIC.charactersLen, exiElementFrag->CHARACTERS_GENERIC.characters, iso1exiElementFrag_CHARACTERS_GENERIC_CHARACTERS_SIZE);
 						}
 					}
 					exiElementFrag->CHARACTERS_GENERIC_isUsed = 1u;
@@ -16495,6 +22971,9 @@ int decode_iso1EXISchemaInformedElementFragmentGrammar(bitstream_t* stream, stru
 
 
 int decode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	errn = readEXIHeader(stream);
 
 	if(errn == 0) {
@@ -16503,136 +22982,188 @@ int decode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc)
 		errn = decodeNBitUnsignedInteger(stream, 7, &eventCode);
 		if(errn == 0) {
 			switch(eventCode) {
+#if ISO1_DEPLOY_AC_EVChargeParameter == SUPPORT_YES
 			case 0:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVChargeParameter) */
 				errn = decode_iso1AC_EVChargeParameterType(stream, &exiDoc->AC_EVChargeParameter);
 				exiDoc->AC_EVChargeParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_AC_EVChargeParameter */
+#if ISO1_DEPLOY_AC_EVSEChargeParameter == SUPPORT_YES
 			case 1:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVSEChargeParameter) */
 				errn = decode_iso1AC_EVSEChargeParameterType(stream, &exiDoc->AC_EVSEChargeParameter);
 				exiDoc->AC_EVSEChargeParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_AC_EVSEChargeParameter */
+#if ISO1_DEPLOY_AC_EVSEStatus == SUPPORT_YES
 			case 2:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVSEStatus) */
 				errn = decode_iso1AC_EVSEStatusType(stream, &exiDoc->AC_EVSEStatus);
 				exiDoc->AC_EVSEStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_AC_EVSEStatus */
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
 			case 3:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationReq) */
 				errn = decode_iso1AuthorizationReqType(stream, &exiDoc->AuthorizationReq);
 				exiDoc->AuthorizationReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_AuthorizationReq */
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
 			case 4:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationRes) */
 				errn = decode_iso1AuthorizationResType(stream, &exiDoc->AuthorizationRes);
 				exiDoc->AuthorizationRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_AuthorizationRes */
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
 			case 5:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}BodyElement) */
 				errn = decode_iso1BodyBaseType(stream, &exiDoc->BodyElement);
 				exiDoc->BodyElement_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_BodyElement */
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
 			case 6:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckReq) */
 				errn = decode_iso1CableCheckReqType(stream, &exiDoc->CableCheckReq);
 				exiDoc->CableCheckReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CableCheckReq */
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
 			case 7:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckRes) */
 				errn = decode_iso1CableCheckResType(stream, &exiDoc->CableCheckRes);
 				exiDoc->CableCheckRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CableCheckRes */
+#if ISO1_DEPLOY_CanonicalizationMethod == SUPPORT_YES
 			case 8:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod) */
 				errn = decode_iso1CanonicalizationMethodType(stream, &exiDoc->CanonicalizationMethod);
 				exiDoc->CanonicalizationMethod_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CanonicalizationMethod */
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 			case 9:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationReq) */
 				errn = decode_iso1CertificateInstallationReqType(stream, &exiDoc->CertificateInstallationReq);
 				exiDoc->CertificateInstallationReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 			case 10:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationRes) */
 				errn = decode_iso1CertificateInstallationResType(stream, &exiDoc->CertificateInstallationRes);
 				exiDoc->CertificateInstallationRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 			case 11:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateReq) */
 				errn = decode_iso1CertificateUpdateReqType(stream, &exiDoc->CertificateUpdateReq);
 				exiDoc->CertificateUpdateReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 			case 12:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateRes) */
 				errn = decode_iso1CertificateUpdateResType(stream, &exiDoc->CertificateUpdateRes);
 				exiDoc->CertificateUpdateRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 			case 13:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryReq) */
 				errn = decode_iso1ChargeParameterDiscoveryReqType(stream, &exiDoc->ChargeParameterDiscoveryReq);
 				exiDoc->ChargeParameterDiscoveryReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 			case 14:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryRes) */
 				errn = decode_iso1ChargeParameterDiscoveryResType(stream, &exiDoc->ChargeParameterDiscoveryRes);
 				exiDoc->ChargeParameterDiscoveryRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
 			case 15:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusReq) */
 				errn = decode_iso1ChargingStatusReqType(stream, &exiDoc->ChargingStatusReq);
 				exiDoc->ChargingStatusReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
 			case 16:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusRes) */
 				errn = decode_iso1ChargingStatusResType(stream, &exiDoc->ChargingStatusRes);
 				exiDoc->ChargingStatusRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
 			case 17:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandReq) */
 				errn = decode_iso1CurrentDemandReqType(stream, &exiDoc->CurrentDemandReq);
 				exiDoc->CurrentDemandReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
 			case 18:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandRes) */
 				errn = decode_iso1CurrentDemandResType(stream, &exiDoc->CurrentDemandRes);
 				exiDoc->CurrentDemandRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
+#if ISO1_DEPLOY_DC_EVChargeParameter == SUPPORT_YES
 			case 19:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVChargeParameter) */
 				errn = decode_iso1DC_EVChargeParameterType(stream, &exiDoc->DC_EVChargeParameter);
 				exiDoc->DC_EVChargeParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DC_EVChargeParameter */
+#if ISO1_DEPLOY_DC_EVPowerDeliveryParameter == SUPPORT_YES
 			case 20:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVPowerDeliveryParameter) */
 				errn = decode_iso1DC_EVPowerDeliveryParameterType(stream, &exiDoc->DC_EVPowerDeliveryParameter);
 				exiDoc->DC_EVPowerDeliveryParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DC_EVPowerDeliveryParameter */
+#if ISO1_DEPLOY_DC_EVSEChargeParameter == SUPPORT_YES
 			case 21:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVSEChargeParameter) */
 				errn = decode_iso1DC_EVSEChargeParameterType(stream, &exiDoc->DC_EVSEChargeParameter);
 				exiDoc->DC_EVSEChargeParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DC_EVSEChargeParameter */
+#if ISO1_DEPLOY_DC_EVSEStatus == SUPPORT_YES
 			case 22:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVSEStatus) */
 				errn = decode_iso1DC_EVSEStatusType(stream, &exiDoc->DC_EVSEStatus);
 				exiDoc->DC_EVSEStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DC_EVSEStatus */
+#if ISO1_DEPLOY_DC_EVStatus == SUPPORT_YES
 			case 23:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVStatus) */
 				errn = decode_iso1DC_EVStatusType(stream, &exiDoc->DC_EVStatus);
 				exiDoc->DC_EVStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DC_EVStatus */
+#if ISO1_DEPLOY_DSAKeyValue == SUPPORT_YES
 			case 24:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue) */
 				errn = decode_iso1DSAKeyValueType(stream, &exiDoc->DSAKeyValue);
 				exiDoc->DSAKeyValue_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DSAKeyValue */
+#if ISO1_DEPLOY_DigestMethod == SUPPORT_YES
 			case 25:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod) */
 				errn = decode_iso1DigestMethodType(stream, &exiDoc->DigestMethod);
 				exiDoc->DigestMethod_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DigestMethod */
 			case 26:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -16644,7 +23175,14 @@ int decode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc)
 							errn =  (exiDoc->DigestValue.bytesLen) <= iso1EXIDocument_DigestValue_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiDoc->DigestValue.bytes, exiDoc->DigestValue.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiDoc->DigestValue.bytesLen, exiDoc->DigestValue.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiDoc->DigestValue.bytesLen, exiDoc->DigestValue.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiDoc->DigestValue_isUsed = 1u;
 					} else {
@@ -16653,41 +23191,55 @@ int decode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_EVChargeParameter == SUPPORT_YES
 			case 27:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVChargeParameter) */
 				errn = decode_iso1EVChargeParameterType(stream, &exiDoc->EVChargeParameter);
 				exiDoc->EVChargeParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_EVChargeParameter */
+#if ISO1_DEPLOY_EVPowerDeliveryParameter == SUPPORT_YES
 			case 28:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVPowerDeliveryParameter) */
 				errn = decode_iso1EVPowerDeliveryParameterType(stream, &exiDoc->EVPowerDeliveryParameter);
 				exiDoc->EVPowerDeliveryParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_EVPowerDeliveryParameter */
+#if ISO1_DEPLOY_EVSEChargeParameter == SUPPORT_YES
 			case 29:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEChargeParameter) */
 				errn = decode_iso1EVSEChargeParameterType(stream, &exiDoc->EVSEChargeParameter);
 				exiDoc->EVSEChargeParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_EVSEChargeParameter */
+#if ISO1_DEPLOY_EVSEStatus == SUPPORT_YES
 			case 30:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEStatus) */
 				errn = decode_iso1EVSEStatusType(stream, &exiDoc->EVSEStatus);
 				exiDoc->EVSEStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_EVSEStatus */
+#if ISO1_DEPLOY_EVStatus == SUPPORT_YES
 			case 31:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVStatus) */
 				errn = decode_iso1EVStatusType(stream, &exiDoc->EVStatus);
 				exiDoc->EVStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_EVStatus */
+#if ISO1_DEPLOY_Entry == SUPPORT_YES
 			case 32:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Entry) */
 				errn = decode_iso1EntryType(stream, &exiDoc->Entry);
 				exiDoc->Entry_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Entry */
+#if ISO1_DEPLOY_KeyInfo == SUPPORT_YES
 			case 33:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo) */
 				errn = decode_iso1KeyInfoType(stream, &exiDoc->KeyInfo);
 				exiDoc->KeyInfo_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_KeyInfo */
 			case 34:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName) */
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
@@ -16698,10 +23250,24 @@ int decode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc)
 						if (errn == 0) {
 							if (exiDoc->KeyName.charactersLen >= 2) {
 								exiDoc->KeyName.charactersLen = (uint16_t)(exiDoc->KeyName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiDoc->KeyName.characters, CHARACTER_UNITS(exiDoc->KeyName.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiDoc->KeyName.charactersLen, exiDoc->KeyName.characters, iso1EXIDocument_KeyName_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiDoc->KeyName.charactersLen, exiDoc->KeyName.characters, iso1EXIDocument_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiDoc->KeyName.characters, exiDoc->KeyName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &exiDoc->KeyName.charactersLen, &exiDoc->KeyName.characters);
+#else
+								errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &exiDoc->KeyName.charactersLen, exiDoc->KeyName.characters, iso1EXIDocument_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiDoc->KeyName_isUsed = 1u;
@@ -16711,26 +23277,34 @@ int decode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_KeyValue == SUPPORT_YES
 			case 35:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue) */
 				errn = decode_iso1KeyValueType(stream, &exiDoc->KeyValue);
 				exiDoc->KeyValue_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_KeyValue */
+#if ISO1_DEPLOY_Manifest == SUPPORT_YES
 			case 36:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest) */
 				errn = decode_iso1ManifestType(stream, &exiDoc->Manifest);
 				exiDoc->Manifest_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Manifest */
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 			case 37:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptReq) */
 				errn = decode_iso1MeteringReceiptReqType(stream, &exiDoc->MeteringReceiptReq);
 				exiDoc->MeteringReceiptReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 			case 38:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptRes) */
 				errn = decode_iso1MeteringReceiptResType(stream, &exiDoc->MeteringReceiptRes);
 				exiDoc->MeteringReceiptRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
 			case 39:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData) */
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
@@ -16741,10 +23315,24 @@ int decode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc)
 						if (errn == 0) {
 							if (exiDoc->MgmtData.charactersLen >= 2) {
 								exiDoc->MgmtData.charactersLen = (uint16_t)(exiDoc->MgmtData.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiDoc->MgmtData.characters, CHARACTER_UNITS(exiDoc->MgmtData.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiDoc->MgmtData.charactersLen, exiDoc->MgmtData.characters, iso1EXIDocument_MgmtData_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiDoc->MgmtData.charactersLen, exiDoc->MgmtData.characters, iso1EXIDocument_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiDoc->MgmtData.characters, exiDoc->MgmtData.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &exiDoc->MgmtData.charactersLen, &exiDoc->MgmtData.characters);
+#else
+								errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &exiDoc->MgmtData.charactersLen, exiDoc->MgmtData.characters, iso1EXIDocument_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiDoc->MgmtData_isUsed = 1u;
@@ -16754,206 +23342,286 @@ int decode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_Object == SUPPORT_YES
 			case 40:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object) */
 				errn = decode_iso1ObjectType(stream, &exiDoc->Object);
 				exiDoc->Object_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Object */
+#if ISO1_DEPLOY_PGPData == SUPPORT_YES
 			case 41:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData) */
 				errn = decode_iso1PGPDataType(stream, &exiDoc->PGPData);
 				exiDoc->PGPData_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PGPData */
+#if ISO1_DEPLOY_PMaxScheduleEntry == SUPPORT_YES
 			case 42:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}PMaxScheduleEntry) */
 				errn = decode_iso1PMaxScheduleEntryType(stream, &exiDoc->PMaxScheduleEntry);
 				exiDoc->PMaxScheduleEntry_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PMaxScheduleEntry */
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 			case 43:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsReq) */
 				errn = decode_iso1PaymentDetailsReqType(stream, &exiDoc->PaymentDetailsReq);
 				exiDoc->PaymentDetailsReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 			case 44:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsRes) */
 				errn = decode_iso1PaymentDetailsResType(stream, &exiDoc->PaymentDetailsRes);
 				exiDoc->PaymentDetailsRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 			case 45:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionReq) */
 				errn = decode_iso1PaymentServiceSelectionReqType(stream, &exiDoc->PaymentServiceSelectionReq);
 				exiDoc->PaymentServiceSelectionReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 			case 46:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionRes) */
 				errn = decode_iso1PaymentServiceSelectionResType(stream, &exiDoc->PaymentServiceSelectionRes);
 				exiDoc->PaymentServiceSelectionRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 			case 47:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryReq) */
 				errn = decode_iso1PowerDeliveryReqType(stream, &exiDoc->PowerDeliveryReq);
 				exiDoc->PowerDeliveryReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 			case 48:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryRes) */
 				errn = decode_iso1PowerDeliveryResType(stream, &exiDoc->PowerDeliveryRes);
 				exiDoc->PowerDeliveryRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
 			case 49:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeReq) */
 				errn = decode_iso1PreChargeReqType(stream, &exiDoc->PreChargeReq);
 				exiDoc->PreChargeReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PreChargeReq */
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
 			case 50:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeRes) */
 				errn = decode_iso1PreChargeResType(stream, &exiDoc->PreChargeRes);
 				exiDoc->PreChargeRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PreChargeRes */
+#if ISO1_DEPLOY_RSAKeyValue == SUPPORT_YES
 			case 51:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue) */
 				errn = decode_iso1RSAKeyValueType(stream, &exiDoc->RSAKeyValue);
 				exiDoc->RSAKeyValue_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_RSAKeyValue */
+#if ISO1_DEPLOY_Reference == SUPPORT_YES
 			case 52:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference) */
 				errn = decode_iso1ReferenceType(stream, &exiDoc->Reference);
 				exiDoc->Reference_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Reference */
+#if ISO1_DEPLOY_RelativeTimeInterval == SUPPORT_YES
 			case 53:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}RelativeTimeInterval) */
 				errn = decode_iso1RelativeTimeIntervalType(stream, &exiDoc->RelativeTimeInterval);
 				exiDoc->RelativeTimeInterval_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_RelativeTimeInterval */
+#if ISO1_DEPLOY_RetrievalMethod == SUPPORT_YES
 			case 54:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod) */
 				errn = decode_iso1RetrievalMethodType(stream, &exiDoc->RetrievalMethod);
 				exiDoc->RetrievalMethod_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_RetrievalMethod */
+#if ISO1_DEPLOY_SAScheduleList == SUPPORT_YES
 			case 55:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SAScheduleList) */
 				errn = decode_iso1SAScheduleListType(stream, &exiDoc->SAScheduleList);
 				exiDoc->SAScheduleList_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SAScheduleList */
+#if ISO1_DEPLOY_SASchedules == SUPPORT_YES
 			case 56:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SASchedules) */
 				errn = decode_iso1SASchedulesType(stream, &exiDoc->SASchedules);
 				exiDoc->SASchedules_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SASchedules */
+#if ISO1_DEPLOY_SPKIData == SUPPORT_YES
 			case 57:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData) */
 				errn = decode_iso1SPKIDataType(stream, &exiDoc->SPKIData);
 				exiDoc->SPKIData_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SPKIData */
+#if ISO1_DEPLOY_SalesTariffEntry == SUPPORT_YES
 			case 58:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SalesTariffEntry) */
 				errn = decode_iso1SalesTariffEntryType(stream, &exiDoc->SalesTariffEntry);
 				exiDoc->SalesTariffEntry_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SalesTariffEntry */
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
 			case 59:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailReq) */
 				errn = decode_iso1ServiceDetailReqType(stream, &exiDoc->ServiceDetailReq);
 				exiDoc->ServiceDetailReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
 			case 60:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailRes) */
 				errn = decode_iso1ServiceDetailResType(stream, &exiDoc->ServiceDetailRes);
 				exiDoc->ServiceDetailRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 			case 61:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryReq) */
 				errn = decode_iso1ServiceDiscoveryReqType(stream, &exiDoc->ServiceDiscoveryReq);
 				exiDoc->ServiceDiscoveryReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 			case 62:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryRes) */
 				errn = decode_iso1ServiceDiscoveryResType(stream, &exiDoc->ServiceDiscoveryRes);
 				exiDoc->ServiceDiscoveryRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
 			case 63:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupReq) */
 				errn = decode_iso1SessionSetupReqType(stream, &exiDoc->SessionSetupReq);
 				exiDoc->SessionSetupReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SessionSetupReq */
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
 			case 64:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupRes) */
 				errn = decode_iso1SessionSetupResType(stream, &exiDoc->SessionSetupRes);
 				exiDoc->SessionSetupRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SessionSetupRes */
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
 			case 65:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopReq) */
 				errn = decode_iso1SessionStopReqType(stream, &exiDoc->SessionStopReq);
 				exiDoc->SessionStopReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SessionStopReq */
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
 			case 66:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopRes) */
 				errn = decode_iso1SessionStopResType(stream, &exiDoc->SessionStopRes);
 				exiDoc->SessionStopRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SessionStopRes */
+#if ISO1_DEPLOY_Signature == SUPPORT_YES
 			case 67:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature) */
 				errn = decode_iso1SignatureType(stream, &exiDoc->Signature);
 				exiDoc->Signature_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Signature */
+#if ISO1_DEPLOY_SignatureMethod == SUPPORT_YES
 			case 68:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod) */
 				errn = decode_iso1SignatureMethodType(stream, &exiDoc->SignatureMethod);
 				exiDoc->SignatureMethod_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SignatureMethod */
+#if ISO1_DEPLOY_SignatureProperties == SUPPORT_YES
 			case 69:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties) */
 				errn = decode_iso1SignaturePropertiesType(stream, &exiDoc->SignatureProperties);
 				exiDoc->SignatureProperties_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SignatureProperties */
+#if ISO1_DEPLOY_SignatureProperty == SUPPORT_YES
 			case 70:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty) */
 				errn = decode_iso1SignaturePropertyType(stream, &exiDoc->SignatureProperty);
 				exiDoc->SignatureProperty_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SignatureProperty */
+#if ISO1_DEPLOY_SignatureValue == SUPPORT_YES
 			case 71:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue) */
 				errn = decode_iso1SignatureValueType(stream, &exiDoc->SignatureValue);
 				exiDoc->SignatureValue_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SignatureValue */
+#if ISO1_DEPLOY_SignedInfo == SUPPORT_YES
 			case 72:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo) */
 				errn = decode_iso1SignedInfoType(stream, &exiDoc->SignedInfo);
 				exiDoc->SignedInfo_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SignedInfo */
+#if ISO1_DEPLOY_TimeInterval == SUPPORT_YES
 			case 73:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}TimeInterval) */
 				errn = decode_iso1IntervalType(stream, &exiDoc->TimeInterval);
 				exiDoc->TimeInterval_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_TimeInterval */
+#if ISO1_DEPLOY_Transform == SUPPORT_YES
 			case 74:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform) */
 				errn = decode_iso1TransformType(stream, &exiDoc->Transform);
 				exiDoc->Transform_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Transform */
+#if ISO1_DEPLOY_Transforms == SUPPORT_YES
 			case 75:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms) */
 				errn = decode_iso1TransformsType(stream, &exiDoc->Transforms);
 				exiDoc->Transforms_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Transforms */
+#if ISO1_DEPLOY_V2G_Message == SUPPORT_YES
 			case 76:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDef}V2G_Message) */
 				errn = decode_iso1AnonType_V2G_Message(stream, &exiDoc->V2G_Message);
 				exiDoc->V2G_Message_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_V2G_Message */
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 			case 77:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionReq) */
 				errn = decode_iso1WeldingDetectionReqType(stream, &exiDoc->WeldingDetectionReq);
 				exiDoc->WeldingDetectionReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 			case 78:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionRes) */
 				errn = decode_iso1WeldingDetectionResType(stream, &exiDoc->WeldingDetectionRes);
 				exiDoc->WeldingDetectionRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
+#if ISO1_DEPLOY_X509Data == SUPPORT_YES
 			case 79:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data) */
 				errn = decode_iso1X509DataType(stream, &exiDoc->X509Data);
 				exiDoc->X509Data_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_X509Data */
 			default:
 				errn = EXI_ERROR_UNEXPECTED_EVENT_LEVEL1;
 				break;
@@ -16971,6 +23639,9 @@ int decode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc)
 
 #if DEPLOY_ISO1_CODEC_FRAGMENT == SUPPORT_YES
 int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	errn = readEXIHeader(stream);
 
 	if(errn == 0) {
@@ -16979,46 +23650,60 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 		errn = decodeNBitUnsignedInteger(stream, 8, &eventCode);
 		if(errn == 0) {
 			switch(eventCode) {
+#if ISO1_DEPLOY_AC_EVChargeParameter == SUPPORT_YES
 			case 0:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVChargeParameter) */
 				errn = decode_iso1AC_EVChargeParameterType(stream, &exiFrag->AC_EVChargeParameter);
 				exiFrag->AC_EVChargeParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_AC_EVChargeParameter */
+#if ISO1_DEPLOY_AC_EVSEChargeParameter == SUPPORT_YES
 			case 1:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVSEChargeParameter) */
 				errn = decode_iso1AC_EVSEChargeParameterType(stream, &exiFrag->AC_EVSEChargeParameter);
 				exiFrag->AC_EVSEChargeParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_AC_EVSEChargeParameter */
+#if ISO1_DEPLOY_AC_EVSEStatus == SUPPORT_YES
 			case 2:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AC_EVSEStatus) */
 				errn = decode_iso1AC_EVSEStatusType(stream, &exiFrag->AC_EVSEStatus);
 				exiFrag->AC_EVSEStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_AC_EVSEStatus */
+#if ISO1_DEPLOY_AC_EVSEStatus == SUPPORT_YES
 			case 3:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVSEStatus) */
 				errn = decode_iso1AC_EVSEStatusType(stream, &exiFrag->AC_EVSEStatus);
 				exiFrag->AC_EVSEStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_AC_EVSEStatus */
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
 			case 4:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationReq) */
 				errn = decode_iso1AuthorizationReqType(stream, &exiFrag->AuthorizationReq);
 				exiFrag->AuthorizationReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_AuthorizationReq */
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
 			case 5:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationRes) */
 				errn = decode_iso1AuthorizationResType(stream, &exiFrag->AuthorizationRes);
 				exiFrag->AuthorizationRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_AuthorizationRes */
 			case 6:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDef}Body) */
 				errn = decode_iso1BodyType(stream, &exiFrag->Body);
 				exiFrag->Body_isUsed = 1u;
 				break;
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
 			case 7:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}BodyElement) */
 				errn = decode_iso1BodyBaseType(stream, &exiFrag->BodyElement);
 				exiFrag->BodyElement_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_BodyElement */
 			case 8:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}BulkChargingComplete) */
 				/* FirstStartTag[CHARACTERS[BOOLEAN]] */
@@ -17062,21 +23747,27 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
 			case 11:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckReq) */
 				errn = decode_iso1CableCheckReqType(stream, &exiFrag->CableCheckReq);
 				exiFrag->CableCheckReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CableCheckReq */
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
 			case 12:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckRes) */
 				errn = decode_iso1CableCheckResType(stream, &exiFrag->CableCheckRes);
 				exiFrag->CableCheckRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CableCheckRes */
+#if ISO1_DEPLOY_CanonicalizationMethod == SUPPORT_YES
 			case 13:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod) */
 				errn = decode_iso1CanonicalizationMethodType(stream, &exiFrag->CanonicalizationMethod);
 				exiFrag->CanonicalizationMethod_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CanonicalizationMethod */
 			case 14:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Certificate) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -17088,7 +23779,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->Certificate.bytesLen) <= iso1EXIFragment_Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->Certificate.bytes, exiFrag->Certificate.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->Certificate.bytesLen, exiFrag->Certificate.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->Certificate.bytesLen, exiFrag->Certificate.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->Certificate_isUsed = 1u;
 					} else {
@@ -17097,36 +23795,48 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 			case 15:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationReq) */
 				errn = decode_iso1CertificateInstallationReqType(stream, &exiFrag->CertificateInstallationReq);
 				exiFrag->CertificateInstallationReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 			case 16:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationRes) */
 				errn = decode_iso1CertificateInstallationResType(stream, &exiFrag->CertificateInstallationRes);
 				exiFrag->CertificateInstallationRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 			case 17:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateReq) */
 				errn = decode_iso1CertificateUpdateReqType(stream, &exiFrag->CertificateUpdateReq);
 				exiFrag->CertificateUpdateReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 			case 18:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateRes) */
 				errn = decode_iso1CertificateUpdateResType(stream, &exiFrag->CertificateUpdateRes);
 				exiFrag->CertificateUpdateRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 			case 19:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryReq) */
 				errn = decode_iso1ChargeParameterDiscoveryReqType(stream, &exiFrag->ChargeParameterDiscoveryReq);
 				exiFrag->ChargeParameterDiscoveryReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 			case 20:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryRes) */
 				errn = decode_iso1ChargeParameterDiscoveryResType(stream, &exiFrag->ChargeParameterDiscoveryRes);
 				exiFrag->ChargeParameterDiscoveryRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
 			case 21:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeProgress) */
 				/* FirstStartTag[CHARACTERS[ENUMERATION]] */
@@ -17229,16 +23939,20 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
 			case 30:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusReq) */
 				errn = decode_iso1ChargingStatusReqType(stream, &exiFrag->ChargingStatusReq);
 				exiFrag->ChargingStatusReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
 			case 31:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusRes) */
 				errn = decode_iso1ChargingStatusResType(stream, &exiFrag->ChargingStatusRes);
 				exiFrag->ChargingStatusRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
 			case 32:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ConsumptionCost) */
 				errn = decode_iso1ConsumptionCostType(stream, &exiFrag->ConsumptionCost);
@@ -17259,61 +23973,81 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = decode_iso1CostType(stream, &exiFrag->Cost);
 				exiFrag->Cost_isUsed = 1u;
 				break;
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
 			case 36:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandReq) */
 				errn = decode_iso1CurrentDemandReqType(stream, &exiFrag->CurrentDemandReq);
 				exiFrag->CurrentDemandReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
 			case 37:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandRes) */
 				errn = decode_iso1CurrentDemandResType(stream, &exiFrag->CurrentDemandRes);
 				exiFrag->CurrentDemandRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
+#if ISO1_DEPLOY_DC_EVChargeParameter == SUPPORT_YES
 			case 38:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVChargeParameter) */
 				errn = decode_iso1DC_EVChargeParameterType(stream, &exiFrag->DC_EVChargeParameter);
 				exiFrag->DC_EVChargeParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DC_EVChargeParameter */
+#if ISO1_DEPLOY_DC_EVPowerDeliveryParameter == SUPPORT_YES
 			case 39:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVPowerDeliveryParameter) */
 				errn = decode_iso1DC_EVPowerDeliveryParameterType(stream, &exiFrag->DC_EVPowerDeliveryParameter);
 				exiFrag->DC_EVPowerDeliveryParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DC_EVPowerDeliveryParameter */
+#if ISO1_DEPLOY_DC_EVSEChargeParameter == SUPPORT_YES
 			case 40:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVSEChargeParameter) */
 				errn = decode_iso1DC_EVSEChargeParameterType(stream, &exiFrag->DC_EVSEChargeParameter);
 				exiFrag->DC_EVSEChargeParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DC_EVSEChargeParameter */
+#if ISO1_DEPLOY_DC_EVSEStatus == SUPPORT_YES
 			case 41:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}DC_EVSEStatus) */
 				errn = decode_iso1DC_EVSEStatusType(stream, &exiFrag->DC_EVSEStatus);
 				exiFrag->DC_EVSEStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DC_EVSEStatus */
+#if ISO1_DEPLOY_DC_EVSEStatus == SUPPORT_YES
 			case 42:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVSEStatus) */
 				errn = decode_iso1DC_EVSEStatusType(stream, &exiFrag->DC_EVSEStatus);
 				exiFrag->DC_EVSEStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DC_EVSEStatus */
+#if ISO1_DEPLOY_DC_EVStatus == SUPPORT_YES
 			case 43:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}DC_EVStatus) */
 				errn = decode_iso1DC_EVStatusType(stream, &exiFrag->DC_EVStatus);
 				exiFrag->DC_EVStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DC_EVStatus */
+#if ISO1_DEPLOY_DC_EVStatus == SUPPORT_YES
 			case 44:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVStatus) */
 				errn = decode_iso1DC_EVStatusType(stream, &exiFrag->DC_EVStatus);
 				exiFrag->DC_EVStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DC_EVStatus */
 			case 45:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}DHpublickey) */
 				errn = decode_iso1DiffieHellmanPublickeyType(stream, &exiFrag->DHpublickey);
 				exiFrag->DHpublickey_isUsed = 1u;
 				break;
+#if ISO1_DEPLOY_DSAKeyValue == SUPPORT_YES
 			case 46:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue) */
 				errn = decode_iso1DSAKeyValueType(stream, &exiFrag->DSAKeyValue);
 				exiFrag->DSAKeyValue_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DSAKeyValue */
 			case 47:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DepartureTime) */
 				/* First(xsi:type)StartTag[CHARACTERS[UNSIGNED_INTEGER]] */
@@ -17328,11 +24062,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_DigestMethod == SUPPORT_YES
 			case 48:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod) */
 				errn = decode_iso1DigestMethodType(stream, &exiFrag->DigestMethod);
 				exiFrag->DigestMethod_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_DigestMethod */
 			case 49:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -17344,7 +24080,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->DigestValue.bytesLen) <= iso1EXIFragment_DigestValue_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->DigestValue.bytes, exiFrag->DigestValue.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->DigestValue.bytesLen, exiFrag->DigestValue.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->DigestValue.bytesLen, exiFrag->DigestValue.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->DigestValue_isUsed = 1u;
 					} else {
@@ -17393,11 +24136,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_EVChargeParameter == SUPPORT_YES
 			case 53:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVChargeParameter) */
 				errn = decode_iso1EVChargeParameterType(stream, &exiFrag->EVChargeParameter);
 				exiFrag->EVChargeParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_EVChargeParameter */
 			case 54:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVEnergyCapacity) */
 				errn = decode_iso1PhysicalValueType(stream, &exiFrag->EVEnergyCapacity);
@@ -17468,11 +24213,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = decode_iso1PhysicalValueType(stream, &exiFrag->EVMinCurrent);
 				exiFrag->EVMinCurrent_isUsed = 1u;
 				break;
+#if ISO1_DEPLOY_EVPowerDeliveryParameter == SUPPORT_YES
 			case 66:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVPowerDeliveryParameter) */
 				errn = decode_iso1EVPowerDeliveryParameterType(stream, &exiFrag->EVPowerDeliveryParameter);
 				exiFrag->EVPowerDeliveryParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_EVPowerDeliveryParameter */
 			case 67:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVRESSSOC) */
 				/* FirstStartTag[CHARACTERS[NBIT_UNSIGNED_INTEGER]] */
@@ -17502,11 +24249,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_EVSEChargeParameter == SUPPORT_YES
 			case 69:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEChargeParameter) */
 				errn = decode_iso1EVSEChargeParameterType(stream, &exiFrag->EVSEChargeParameter);
 				exiFrag->EVSEChargeParameter_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_EVSEChargeParameter */
 			case 70:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSECurrentLimitAchieved) */
 				/* FirstStartTag[CHARACTERS[BOOLEAN]] */
@@ -17541,10 +24290,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->EVSEID.charactersLen >= 2) {
 								exiFrag->EVSEID.charactersLen = (uint16_t)(exiFrag->EVSEID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->EVSEID.characters, CHARACTER_UNITS(exiFrag->EVSEID.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->EVSEID.charactersLen, exiFrag->EVSEID.characters, iso1EXIFragment_EVSEID_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->EVSEID.charactersLen, exiFrag->EVSEID.characters, iso1EXIFragment_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, exiFrag->EVSEID.characters, exiFrag->EVSEID.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &exiFrag->EVSEID.charactersLen, &exiFrag->EVSEID.characters);
+#else
+								errn = decodeStringValueHit(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, &exiFrag->EVSEID.charactersLen, exiFrag->EVSEID.characters, iso1EXIFragment_EVSEID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->EVSEID_isUsed = 1u;
@@ -17683,11 +24446,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_EVSEStatus == SUPPORT_YES
 			case 92:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEStatus) */
 				errn = decode_iso1EVSEStatusType(stream, &exiFrag->EVSEStatus);
 				exiFrag->EVSEStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_EVSEStatus */
 			case 93:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEStatusCode) */
 				/* FirstStartTag[CHARACTERS[ENUMERATION]] */
@@ -17731,11 +24496,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_EVStatus == SUPPORT_YES
 			case 96:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVStatus) */
 				errn = decode_iso1EVStatusType(stream, &exiFrag->EVStatus);
 				exiFrag->EVStatus_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_EVStatus */
 			case 97:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVTargetCurrent) */
 				errn = decode_iso1PhysicalValueType(stream, &exiFrag->EVTargetCurrent);
@@ -17761,11 +24528,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_Entry == SUPPORT_YES
 			case 100:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Entry) */
 				errn = decode_iso1EntryType(stream, &exiFrag->Entry);
 				exiFrag->Entry_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Entry */
 			case 101:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Exponent) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -17777,7 +24546,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->Exponent.bytesLen) <= iso1EXIFragment_Exponent_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->Exponent.bytes, exiFrag->Exponent.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->Exponent.bytesLen, exiFrag->Exponent.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->Exponent.bytesLen, exiFrag->Exponent.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->Exponent_isUsed = 1u;
 					} else {
@@ -17811,10 +24587,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->FaultMsg.charactersLen >= 2) {
 								exiFrag->FaultMsg.charactersLen = (uint16_t)(exiFrag->FaultMsg.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->FaultMsg.characters, CHARACTER_UNITS(exiFrag->FaultMsg.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->FaultMsg.charactersLen, exiFrag->FaultMsg.characters, iso1EXIFragment_FaultMsg_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->FaultMsg.charactersLen, exiFrag->FaultMsg.characters, iso1EXIFragment_FaultMsg_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 17 /* {urn:iso:15118:2:2013:MsgDataTypes}FaultMsg */, exiFrag->FaultMsg.characters, exiFrag->FaultMsg.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 17 /* {urn:iso:15118:2:2013:MsgDataTypes}FaultMsg */, &exiFrag->FaultMsg.charactersLen, &exiFrag->FaultMsg.characters);
+#else
+								errn = decodeStringValueHit(stream, 17 /* {urn:iso:15118:2:2013:MsgDataTypes}FaultMsg */, &exiFrag->FaultMsg.charactersLen, exiFrag->FaultMsg.characters, iso1EXIFragment_FaultMsg_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->FaultMsg_isUsed = 1u;
@@ -17864,7 +24654,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->G.bytesLen) <= iso1EXIFragment_G_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->G.bytes, exiFrag->G.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->G.bytesLen, exiFrag->G.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->G.bytesLen, exiFrag->G.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->G_isUsed = 1u;
 					} else {
@@ -17923,7 +24720,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->J.bytesLen) <= iso1EXIFragment_J_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->J.bytes, exiFrag->J.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->J.bytesLen, exiFrag->J.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->J.bytesLen, exiFrag->J.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->J_isUsed = 1u;
 					} else {
@@ -17932,11 +24736,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_KeyInfo == SUPPORT_YES
 			case 111:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo) */
 				errn = decode_iso1KeyInfoType(stream, &exiFrag->KeyInfo);
 				exiFrag->KeyInfo_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_KeyInfo */
 			case 112:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName) */
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
@@ -17947,10 +24753,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->KeyName.charactersLen >= 2) {
 								exiFrag->KeyName.charactersLen = (uint16_t)(exiFrag->KeyName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->KeyName.characters, CHARACTER_UNITS(exiFrag->KeyName.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->KeyName.charactersLen, exiFrag->KeyName.characters, iso1EXIFragment_KeyName_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->KeyName.charactersLen, exiFrag->KeyName.characters, iso1EXIFragment_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiFrag->KeyName.characters, exiFrag->KeyName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &exiFrag->KeyName.charactersLen, &exiFrag->KeyName.characters);
+#else
+								errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &exiFrag->KeyName.charactersLen, exiFrag->KeyName.characters, iso1EXIFragment_KeyName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->KeyName_isUsed = 1u;
@@ -17960,21 +24780,25 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_KeyValue == SUPPORT_YES
 			case 113:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue) */
 				errn = decode_iso1KeyValueType(stream, &exiFrag->KeyValue);
 				exiFrag->KeyValue_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_KeyValue */
 			case 114:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ListOfRootCertificateIDs) */
 				errn = decode_iso1ListOfRootCertificateIDsType(stream, &exiFrag->ListOfRootCertificateIDs);
 				exiFrag->ListOfRootCertificateIDs_isUsed = 1u;
 				break;
+#if ISO1_DEPLOY_Manifest == SUPPORT_YES
 			case 115:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest) */
 				errn = decode_iso1ManifestType(stream, &exiFrag->Manifest);
 				exiFrag->Manifest_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Manifest */
 			case 116:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MaxEntriesSAScheduleTuple) */
 				/* First(xsi:type)StartTag[CHARACTERS[UNSIGNED_INTEGER]] */
@@ -17999,10 +24823,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->MeterID.charactersLen >= 2) {
 								exiFrag->MeterID.charactersLen = (uint16_t)(exiFrag->MeterID.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->MeterID.characters, CHARACTER_UNITS(exiFrag->MeterID.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->MeterID.charactersLen, exiFrag->MeterID.characters, iso1EXIFragment_MeterID_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->MeterID.charactersLen, exiFrag->MeterID.characters, iso1EXIFragment_MeterID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 19 /* {urn:iso:15118:2:2013:MsgDataTypes}MeterID */, exiFrag->MeterID.characters, exiFrag->MeterID.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 19 /* {urn:iso:15118:2:2013:MsgDataTypes}MeterID */, &exiFrag->MeterID.charactersLen, &exiFrag->MeterID.characters);
+#else
+								errn = decodeStringValueHit(stream, 19 /* {urn:iso:15118:2:2013:MsgDataTypes}MeterID */, &exiFrag->MeterID.charactersLen, exiFrag->MeterID.characters, iso1EXIFragment_MeterID_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->MeterID_isUsed = 1u;
@@ -18045,16 +24883,20 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 			case 121:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptReq) */
 				errn = decode_iso1MeteringReceiptReqType(stream, &exiFrag->MeteringReceiptReq);
 				exiFrag->MeteringReceiptReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 			case 122:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptRes) */
 				errn = decode_iso1MeteringReceiptResType(stream, &exiFrag->MeteringReceiptRes);
 				exiFrag->MeteringReceiptRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
 			case 123:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData) */
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
@@ -18065,10 +24907,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->MgmtData.charactersLen >= 2) {
 								exiFrag->MgmtData.charactersLen = (uint16_t)(exiFrag->MgmtData.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->MgmtData.characters, CHARACTER_UNITS(exiFrag->MgmtData.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->MgmtData.charactersLen, exiFrag->MgmtData.characters, iso1EXIFragment_MgmtData_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->MgmtData.charactersLen, exiFrag->MgmtData.characters, iso1EXIFragment_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiFrag->MgmtData.characters, exiFrag->MgmtData.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &exiFrag->MgmtData.charactersLen, &exiFrag->MgmtData.characters);
+#else
+								errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &exiFrag->MgmtData.charactersLen, exiFrag->MgmtData.characters, iso1EXIFragment_MgmtData_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->MgmtData_isUsed = 1u;
@@ -18089,7 +24945,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->Modulus.bytesLen) <= iso1EXIFragment_Modulus_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->Modulus.bytes, exiFrag->Modulus.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->Modulus.bytesLen, exiFrag->Modulus.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->Modulus.bytesLen, exiFrag->Modulus.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->Modulus_isUsed = 1u;
 					} else {
@@ -18158,7 +25021,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->OEMProvisioningCert.bytesLen) <= iso1EXIFragment_OEMProvisioningCert_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->OEMProvisioningCert.bytes, exiFrag->OEMProvisioningCert.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->OEMProvisioningCert.bytesLen, exiFrag->OEMProvisioningCert.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->OEMProvisioningCert.bytesLen, exiFrag->OEMProvisioningCert.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->OEMProvisioningCert_isUsed = 1u;
 					} else {
@@ -18167,11 +25037,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_Object == SUPPORT_YES
 			case 130:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object) */
 				errn = decode_iso1ObjectType(stream, &exiFrag->Object);
 				exiFrag->Object_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Object */
 			case 131:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}P) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -18183,7 +25055,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->P.bytesLen) <= iso1EXIFragment_P_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->P.bytes, exiFrag->P.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->P.bytesLen, exiFrag->P.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->P.bytesLen, exiFrag->P.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->P_isUsed = 1u;
 					} else {
@@ -18192,11 +25071,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_PGPData == SUPPORT_YES
 			case 132:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData) */
 				errn = decode_iso1PGPDataType(stream, &exiFrag->PGPData);
 				exiFrag->PGPData_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PGPData */
 			case 133:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyID) */
 				/* First(xsi:type)StartTag[CHARACTERS[BINARY_BASE64]] */
@@ -18208,7 +25089,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->PGPKeyID.bytesLen) <= iso1EXIFragment_PGPKeyID_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->PGPKeyID.bytes, exiFrag->PGPKeyID.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->PGPKeyID.bytesLen, exiFrag->PGPKeyID.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->PGPKeyID.bytesLen, exiFrag->PGPKeyID.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->PGPKeyID_isUsed = 1u;
 					} else {
@@ -18228,7 +25116,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->PGPKeyPacket.bytesLen) <= iso1EXIFragment_PGPKeyPacket_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->PGPKeyPacket.bytes, exiFrag->PGPKeyPacket.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->PGPKeyPacket.bytesLen, exiFrag->PGPKeyPacket.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->PGPKeyPacket.bytesLen, exiFrag->PGPKeyPacket.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->PGPKeyPacket_isUsed = 1u;
 					} else {
@@ -18247,11 +25142,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = decode_iso1PMaxScheduleType(stream, &exiFrag->PMaxSchedule);
 				exiFrag->PMaxSchedule_isUsed = 1u;
 				break;
+#if ISO1_DEPLOY_PMaxScheduleEntry == SUPPORT_YES
 			case 137:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}PMaxScheduleEntry) */
 				errn = decode_iso1PMaxScheduleEntryType(stream, &exiFrag->PMaxScheduleEntry);
 				exiFrag->PMaxScheduleEntry_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PMaxScheduleEntry */
 			case 138:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Parameter) */
 				errn = decode_iso1ParameterType(stream, &exiFrag->Parameter);
@@ -18276,16 +25173,20 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 			case 141:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsReq) */
 				errn = decode_iso1PaymentDetailsReqType(stream, &exiFrag->PaymentDetailsReq);
 				exiFrag->PaymentDetailsReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 			case 142:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsRes) */
 				errn = decode_iso1PaymentDetailsResType(stream, &exiFrag->PaymentDetailsRes);
 				exiFrag->PaymentDetailsRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
 			case 143:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}PaymentOption) */
 				/* FirstStartTag[CHARACTERS[ENUMERATION]] */
@@ -18306,16 +25207,20 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = decode_iso1PaymentOptionListType(stream, &exiFrag->PaymentOptionList);
 				exiFrag->PaymentOptionList_isUsed = 1u;
 				break;
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 			case 145:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionReq) */
 				errn = decode_iso1PaymentServiceSelectionReqType(stream, &exiFrag->PaymentServiceSelectionReq);
 				exiFrag->PaymentServiceSelectionReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 			case 146:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionRes) */
 				errn = decode_iso1PaymentServiceSelectionResType(stream, &exiFrag->PaymentServiceSelectionRes);
 				exiFrag->PaymentServiceSelectionRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
 			case 147:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PgenCounter) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -18327,7 +25232,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->PgenCounter.bytesLen) <= iso1EXIFragment_PgenCounter_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->PgenCounter.bytes, exiFrag->PgenCounter.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->PgenCounter.bytesLen, exiFrag->PgenCounter.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->PgenCounter.bytesLen, exiFrag->PgenCounter.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->PgenCounter_isUsed = 1u;
 					} else {
@@ -18336,26 +25248,34 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 			case 148:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryReq) */
 				errn = decode_iso1PowerDeliveryReqType(stream, &exiFrag->PowerDeliveryReq);
 				exiFrag->PowerDeliveryReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 			case 149:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryRes) */
 				errn = decode_iso1PowerDeliveryResType(stream, &exiFrag->PowerDeliveryRes);
 				exiFrag->PowerDeliveryRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
 			case 150:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeReq) */
 				errn = decode_iso1PreChargeReqType(stream, &exiFrag->PreChargeReq);
 				exiFrag->PreChargeReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PreChargeReq */
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
 			case 151:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeRes) */
 				errn = decode_iso1PreChargeResType(stream, &exiFrag->PreChargeRes);
 				exiFrag->PreChargeRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_PreChargeRes */
 			case 152:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ProfileEntry) */
 				errn = decode_iso1ProfileEntryType(stream, &exiFrag->ProfileEntry);
@@ -18372,7 +25292,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->Q.bytesLen) <= iso1EXIFragment_Q_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->Q.bytes, exiFrag->Q.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->Q.bytesLen, exiFrag->Q.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->Q.bytesLen, exiFrag->Q.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->Q_isUsed = 1u;
 					} else {
@@ -18395,11 +25322,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_RSAKeyValue == SUPPORT_YES
 			case 155:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue) */
 				errn = decode_iso1RSAKeyValueType(stream, &exiFrag->RSAKeyValue);
 				exiFrag->RSAKeyValue_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_RSAKeyValue */
 			case 156:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ReceiptRequired) */
 				/* FirstStartTag[CHARACTERS[BOOLEAN]] */
@@ -18414,16 +25343,20 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_Reference == SUPPORT_YES
 			case 157:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference) */
 				errn = decode_iso1ReferenceType(stream, &exiFrag->Reference);
 				exiFrag->Reference_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Reference */
+#if ISO1_DEPLOY_RelativeTimeInterval == SUPPORT_YES
 			case 158:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}RelativeTimeInterval) */
 				errn = decode_iso1RelativeTimeIntervalType(stream, &exiFrag->RelativeTimeInterval);
 				exiFrag->RelativeTimeInterval_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_RelativeTimeInterval */
 			case 159:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}RemainingTimeToBulkSoC) */
 				errn = decode_iso1PhysicalValueType(stream, &exiFrag->RemainingTimeToBulkSoC);
@@ -18464,11 +25397,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_RetrievalMethod == SUPPORT_YES
 			case 163:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod) */
 				errn = decode_iso1RetrievalMethodType(stream, &exiFrag->RetrievalMethod);
 				exiFrag->RetrievalMethod_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_RetrievalMethod */
 			case 164:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}RetryCounter) */
 				/* First(xsi:type)StartTag[CHARACTERS[INTEGER]] */
@@ -18493,11 +25428,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = decode_iso1CertificateChainType(stream, &exiFrag->SAProvisioningCertificateChain);
 				exiFrag->SAProvisioningCertificateChain_isUsed = 1u;
 				break;
+#if ISO1_DEPLOY_SAScheduleList == SUPPORT_YES
 			case 167:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SAScheduleList) */
 				errn = decode_iso1SAScheduleListType(stream, &exiFrag->SAScheduleList);
 				exiFrag->SAScheduleList_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SAScheduleList */
 			case 168:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SAScheduleTuple) */
 				errn = decode_iso1SAScheduleTupleType(stream, &exiFrag->SAScheduleTuple);
@@ -18533,16 +25470,20 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_SASchedules == SUPPORT_YES
 			case 171:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SASchedules) */
 				errn = decode_iso1SASchedulesType(stream, &exiFrag->SASchedules);
 				exiFrag->SASchedules_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SASchedules */
+#if ISO1_DEPLOY_SPKIData == SUPPORT_YES
 			case 172:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData) */
 				errn = decode_iso1SPKIDataType(stream, &exiFrag->SPKIData);
 				exiFrag->SPKIData_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SPKIData */
 			case 173:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKISexp) */
 				/* First(xsi:type)StartTag[CHARACTERS[BINARY_BASE64]] */
@@ -18554,7 +25495,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->SPKISexp.bytesLen) <= iso1EXIFragment_SPKISexp_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->SPKISexp.bytes, exiFrag->SPKISexp.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->SPKISexp.bytesLen, exiFrag->SPKISexp.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->SPKISexp.bytesLen, exiFrag->SPKISexp.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->SPKISexp_isUsed = 1u;
 					} else {
@@ -18578,10 +25526,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->SalesTariffDescription.charactersLen >= 2) {
 								exiFrag->SalesTariffDescription.charactersLen = (uint16_t)(exiFrag->SalesTariffDescription.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->SalesTariffDescription.characters, CHARACTER_UNITS(exiFrag->SalesTariffDescription.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->SalesTariffDescription.charactersLen, exiFrag->SalesTariffDescription.characters, iso1EXIFragment_SalesTariffDescription_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->SalesTariffDescription.charactersLen, exiFrag->SalesTariffDescription.characters, iso1EXIFragment_SalesTariffDescription_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 21 /* {urn:iso:15118:2:2013:MsgDataTypes}SalesTariffDescription */, exiFrag->SalesTariffDescription.characters, exiFrag->SalesTariffDescription.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 21 /* {urn:iso:15118:2:2013:MsgDataTypes}SalesTariffDescription */, &exiFrag->SalesTariffDescription.charactersLen, &exiFrag->SalesTariffDescription.characters);
+#else
+								errn = decodeStringValueHit(stream, 21 /* {urn:iso:15118:2:2013:MsgDataTypes}SalesTariffDescription */, &exiFrag->SalesTariffDescription.charactersLen, exiFrag->SalesTariffDescription.characters, iso1EXIFragment_SalesTariffDescription_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->SalesTariffDescription_isUsed = 1u;
@@ -18591,11 +25553,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_SalesTariffEntry == SUPPORT_YES
 			case 176:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SalesTariffEntry) */
 				errn = decode_iso1SalesTariffEntryType(stream, &exiFrag->SalesTariffEntry);
 				exiFrag->SalesTariffEntry_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SalesTariffEntry */
 			case 177:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SalesTariffID) */
 				/* FirstStartTag[CHARACTERS[NBIT_UNSIGNED_INTEGER]] */
@@ -18622,7 +25586,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->Seed.bytesLen) <= iso1EXIFragment_Seed_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->Seed.bytes, exiFrag->Seed.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->Seed.bytesLen, exiFrag->Seed.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->Seed.bytesLen, exiFrag->Seed.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->Seed_isUsed = 1u;
 					} else {
@@ -18691,26 +25662,34 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
 			case 185:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailReq) */
 				errn = decode_iso1ServiceDetailReqType(stream, &exiFrag->ServiceDetailReq);
 				exiFrag->ServiceDetailReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
 			case 186:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailRes) */
 				errn = decode_iso1ServiceDetailResType(stream, &exiFrag->ServiceDetailRes);
 				exiFrag->ServiceDetailRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 			case 187:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryReq) */
 				errn = decode_iso1ServiceDiscoveryReqType(stream, &exiFrag->ServiceDiscoveryReq);
 				exiFrag->ServiceDiscoveryReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 			case 188:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryRes) */
 				errn = decode_iso1ServiceDiscoveryResType(stream, &exiFrag->ServiceDiscoveryRes);
 				exiFrag->ServiceDiscoveryRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
 			case 189:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceID) */
 				/* FirstStartTag[CHARACTERS[UNSIGNED_INTEGER]] */
@@ -18754,10 +25733,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->ServiceName.charactersLen >= 2) {
 								exiFrag->ServiceName.charactersLen = (uint16_t)(exiFrag->ServiceName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->ServiceName.characters, CHARACTER_UNITS(exiFrag->ServiceName.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->ServiceName.charactersLen, exiFrag->ServiceName.characters, iso1EXIFragment_ServiceName_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->ServiceName.charactersLen, exiFrag->ServiceName.characters, iso1EXIFragment_ServiceName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, exiFrag->ServiceName.characters, exiFrag->ServiceName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, &exiFrag->ServiceName.charactersLen, &exiFrag->ServiceName.characters);
+#else
+								errn = decodeStringValueHit(stream, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, &exiFrag->ServiceName.charactersLen, exiFrag->ServiceName.characters, iso1EXIFragment_ServiceName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->ServiceName_isUsed = 1u;
@@ -18782,10 +25775,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->ServiceScope.charactersLen >= 2) {
 								exiFrag->ServiceScope.charactersLen = (uint16_t)(exiFrag->ServiceScope.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->ServiceScope.characters, CHARACTER_UNITS(exiFrag->ServiceScope.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->ServiceScope.charactersLen, exiFrag->ServiceScope.characters, iso1EXIFragment_ServiceScope_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->ServiceScope.charactersLen, exiFrag->ServiceScope.characters, iso1EXIFragment_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 15 /* {urn:iso:15118:2:2013:MsgBody}ServiceScope */, exiFrag->ServiceScope.characters, exiFrag->ServiceScope.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 15 /* {urn:iso:15118:2:2013:MsgBody}ServiceScope */, &exiFrag->ServiceScope.charactersLen, &exiFrag->ServiceScope.characters);
+#else
+								errn = decodeStringValueHit(stream, 15 /* {urn:iso:15118:2:2013:MsgBody}ServiceScope */, &exiFrag->ServiceScope.charactersLen, exiFrag->ServiceScope.characters, iso1EXIFragment_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->ServiceScope_isUsed = 1u;
@@ -18805,10 +25812,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->ServiceScope.charactersLen >= 2) {
 								exiFrag->ServiceScope.charactersLen = (uint16_t)(exiFrag->ServiceScope.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->ServiceScope.characters, CHARACTER_UNITS(exiFrag->ServiceScope.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->ServiceScope.charactersLen, exiFrag->ServiceScope.characters, iso1EXIFragment_ServiceScope_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->ServiceScope.charactersLen, exiFrag->ServiceScope.characters, iso1EXIFragment_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, exiFrag->ServiceScope.characters, exiFrag->ServiceScope.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, &exiFrag->ServiceScope.charactersLen, &exiFrag->ServiceScope.characters);
+#else
+								errn = decodeStringValueHit(stream, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, &exiFrag->ServiceScope.charactersLen, exiFrag->ServiceScope.characters, iso1EXIFragment_ServiceScope_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->ServiceScope_isUsed = 1u;
@@ -18858,26 +25879,34 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
 			case 198:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupReq) */
 				errn = decode_iso1SessionSetupReqType(stream, &exiFrag->SessionSetupReq);
 				exiFrag->SessionSetupReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SessionSetupReq */
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
 			case 199:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupRes) */
 				errn = decode_iso1SessionSetupResType(stream, &exiFrag->SessionSetupRes);
 				exiFrag->SessionSetupRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SessionSetupRes */
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
 			case 200:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopReq) */
 				errn = decode_iso1SessionStopReqType(stream, &exiFrag->SessionStopReq);
 				exiFrag->SessionStopReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SessionStopReq */
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
 			case 201:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopRes) */
 				errn = decode_iso1SessionStopResType(stream, &exiFrag->SessionStopRes);
 				exiFrag->SessionStopRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SessionStopRes */
 			case 202:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SigMeterReading) */
 				/* FirstStartTag[CHARACTERS[BINARY_BASE64]] */
@@ -18898,36 +25927,48 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_Signature == SUPPORT_YES
 			case 203:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature) */
 				errn = decode_iso1SignatureType(stream, &exiFrag->Signature);
 				exiFrag->Signature_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Signature */
+#if ISO1_DEPLOY_SignatureMethod == SUPPORT_YES
 			case 204:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod) */
 				errn = decode_iso1SignatureMethodType(stream, &exiFrag->SignatureMethod);
 				exiFrag->SignatureMethod_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SignatureMethod */
+#if ISO1_DEPLOY_SignatureProperties == SUPPORT_YES
 			case 205:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties) */
 				errn = decode_iso1SignaturePropertiesType(stream, &exiFrag->SignatureProperties);
 				exiFrag->SignatureProperties_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SignatureProperties */
+#if ISO1_DEPLOY_SignatureProperty == SUPPORT_YES
 			case 206:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty) */
 				errn = decode_iso1SignaturePropertyType(stream, &exiFrag->SignatureProperty);
 				exiFrag->SignatureProperty_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SignatureProperty */
+#if ISO1_DEPLOY_SignatureValue == SUPPORT_YES
 			case 207:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue) */
 				errn = decode_iso1SignatureValueType(stream, &exiFrag->SignatureValue);
 				exiFrag->SignatureValue_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SignatureValue */
+#if ISO1_DEPLOY_SignedInfo == SUPPORT_YES
 			case 208:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo) */
 				errn = decode_iso1SignedInfoType(stream, &exiFrag->SignedInfo);
 				exiFrag->SignedInfo_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_SignedInfo */
 			case 209:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SubCertificates) */
 				errn = decode_iso1SubCertificatesType(stream, &exiFrag->SubCertificates);
@@ -18952,21 +25993,27 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_TimeInterval == SUPPORT_YES
 			case 212:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}TimeInterval) */
 				errn = decode_iso1IntervalType(stream, &exiFrag->TimeInterval);
 				exiFrag->TimeInterval_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_TimeInterval */
+#if ISO1_DEPLOY_Transform == SUPPORT_YES
 			case 213:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform) */
 				errn = decode_iso1TransformType(stream, &exiFrag->Transform);
 				exiFrag->Transform_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Transform */
+#if ISO1_DEPLOY_Transforms == SUPPORT_YES
 			case 214:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms) */
 				errn = decode_iso1TransformsType(stream, &exiFrag->Transforms);
 				exiFrag->Transforms_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_Transforms */
 			case 215:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Unit) */
 				/* FirstStartTag[CHARACTERS[ENUMERATION]] */
@@ -18982,11 +26029,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_V2G_Message == SUPPORT_YES
 			case 216:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDef}V2G_Message) */
 				errn = decode_iso1AnonType_V2G_Message(stream, &exiFrag->V2G_Message);
 				exiFrag->V2G_Message_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_V2G_Message */
 			case 217:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Value) */
 				/* First(xsi:type)StartTag[CHARACTERS[INTEGER]] */
@@ -19001,16 +26050,20 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 			case 218:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionReq) */
 				errn = decode_iso1WeldingDetectionReqType(stream, &exiFrag->WeldingDetectionReq);
 				exiFrag->WeldingDetectionReq_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 			case 219:
 				/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionRes) */
 				errn = decode_iso1WeldingDetectionResType(stream, &exiFrag->WeldingDetectionRes);
 				exiFrag->WeldingDetectionRes_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
 			case 220:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509CRL) */
 				/* First(xsi:type)StartTag[CHARACTERS[BINARY_BASE64]] */
@@ -19022,7 +26075,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->X509CRL.bytesLen) <= iso1EXIFragment_X509CRL_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->X509CRL.bytes, exiFrag->X509CRL.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->X509CRL.bytesLen, exiFrag->X509CRL.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->X509CRL.bytesLen, exiFrag->X509CRL.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->X509CRL_isUsed = 1u;
 					} else {
@@ -19042,7 +26102,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->X509Certificate.bytesLen) <= iso1EXIFragment_X509Certificate_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->X509Certificate.bytes, exiFrag->X509Certificate.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->X509Certificate.bytesLen, exiFrag->X509Certificate.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->X509Certificate.bytesLen, exiFrag->X509Certificate.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->X509Certificate_isUsed = 1u;
 					} else {
@@ -19051,11 +26118,13 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 					}
 				}
 				break;
+#if ISO1_DEPLOY_X509Data == SUPPORT_YES
 			case 222:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data) */
 				errn = decode_iso1X509DataType(stream, &exiFrag->X509Data);
 				exiFrag->X509Data_isUsed = 1u;
 				break;
+#endif /* ISO1_DEPLOY_X509Data */
 			case 223:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerName) */
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
@@ -19066,10 +26135,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->X509IssuerName.charactersLen >= 2) {
 								exiFrag->X509IssuerName.charactersLen = (uint16_t)(exiFrag->X509IssuerName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->X509IssuerName.characters, CHARACTER_UNITS(exiFrag->X509IssuerName.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->X509IssuerName.charactersLen, exiFrag->X509IssuerName.characters, iso1EXIFragment_X509IssuerName_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->X509IssuerName.charactersLen, exiFrag->X509IssuerName.characters, iso1EXIFragment_X509IssuerName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, exiFrag->X509IssuerName.characters, exiFrag->X509IssuerName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, &exiFrag->X509IssuerName.charactersLen, &exiFrag->X509IssuerName.characters);
+#else
+								errn = decodeStringValueHit(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, &exiFrag->X509IssuerName.charactersLen, exiFrag->X509IssuerName.characters, iso1EXIFragment_X509IssuerName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->X509IssuerName_isUsed = 1u;
@@ -19095,7 +26178,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->X509SKI.bytesLen) <= iso1EXIFragment_X509SKI_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->X509SKI.bytes, exiFrag->X509SKI.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->X509SKI.bytesLen, exiFrag->X509SKI.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->X509SKI.bytesLen, exiFrag->X509SKI.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->X509SKI_isUsed = 1u;
 					} else {
@@ -19128,10 +26218,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->X509SubjectName.charactersLen >= 2) {
 								exiFrag->X509SubjectName.charactersLen = (uint16_t)(exiFrag->X509SubjectName.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->X509SubjectName.characters, CHARACTER_UNITS(exiFrag->X509SubjectName.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->X509SubjectName.charactersLen, exiFrag->X509SubjectName.characters, iso1EXIFragment_X509SubjectName_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->X509SubjectName.charactersLen, exiFrag->X509SubjectName.characters, iso1EXIFragment_X509SubjectName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, exiFrag->X509SubjectName.characters, exiFrag->X509SubjectName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &exiFrag->X509SubjectName.charactersLen, &exiFrag->X509SubjectName.characters);
+#else
+								errn = decodeStringValueHit(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &exiFrag->X509SubjectName.charactersLen, exiFrag->X509SubjectName.characters, iso1EXIFragment_X509SubjectName_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->X509SubjectName_isUsed = 1u;
@@ -19151,10 +26255,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->XPath.charactersLen >= 2) {
 								exiFrag->XPath.charactersLen = (uint16_t)(exiFrag->XPath.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->XPath.characters, CHARACTER_UNITS(exiFrag->XPath.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->XPath.charactersLen, exiFrag->XPath.characters, iso1EXIFragment_XPath_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->XPath.charactersLen, exiFrag->XPath.characters, iso1EXIFragment_XPath_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, exiFrag->XPath.characters, exiFrag->XPath.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &exiFrag->XPath.charactersLen, &exiFrag->XPath.characters);
+#else
+								errn = decodeStringValueHit(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &exiFrag->XPath.charactersLen, exiFrag->XPath.characters, iso1EXIFragment_XPath_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->XPath_isUsed = 1u;
@@ -19175,7 +26293,14 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 							errn =  (exiFrag->Y.bytesLen) <= iso1EXIFragment_Y_BYTES_SIZE ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
 						}
 						if (errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+							errn = EXI_ARENA_ALLOCATE(stream, exiFrag->Y.bytes, exiFrag->Y.bytesLen);
+							if (errn == 0) {
+								errn = decodeBytes(stream, exiFrag->Y.bytesLen, exiFrag->Y.bytes);
+							}
+#else
 							errn = decodeBytes(stream, exiFrag->Y.bytesLen, exiFrag->Y.bytes);
+#endif /* DATABINDING_SLIM */
 						}
 						exiFrag->Y_isUsed = 1u;
 					} else {
@@ -19338,10 +26463,24 @@ int decode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 						if (errn == 0) {
 							if (exiFrag->stringValue.charactersLen >= 2) {
 								exiFrag->stringValue.charactersLen = (uint16_t)(exiFrag->stringValue.charactersLen - 2); /* string table miss */
+#if DATABINDING == DATABINDING_SLIM
+								errn = EXI_ARENA_ALLOCATE(stream, exiFrag->stringValue.characters, CHARACTER_UNITS(exiFrag->stringValue.charactersLen));
+								if (errn == 0) {
+									errn = decodeCharacters(stream, exiFrag->stringValue.charactersLen, exiFrag->stringValue.characters, iso1EXIFragment_stringValue_CHARACTERS_SIZE);
+								}
+#else
 								errn = decodeCharacters(stream, exiFrag->stringValue.charactersLen, exiFrag->stringValue.characters, iso1EXIFragment_stringValue_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
+								if (errn == 0) {
+									errn = addStringValue(stream, 24 /* {urn:iso:15118:2:2013:MsgDataTypes}stringValue */, exiFrag->stringValue.characters, exiFrag->stringValue.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+#if DATABINDING == DATABINDING_SLIM
+								errn = decodeStringValueHitArena(stream, 24 /* {urn:iso:15118:2:2013:MsgDataTypes}stringValue */, &exiFrag->stringValue.charactersLen, &exiFrag->stringValue.characters);
+#else
+								errn = decodeStringValueHit(stream, 24 /* {urn:iso:15118:2:2013:MsgDataTypes}stringValue */, &exiFrag->stringValue.charactersLen, exiFrag->stringValue.characters, iso1EXIFragment_stringValue_CHARACTERS_SIZE);
+#endif /* DATABINDING_SLIM */
 							}
 						}
 						exiFrag->stringValue_isUsed = 1u;
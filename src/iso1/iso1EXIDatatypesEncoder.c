@@ -34,6 +34,7 @@
 
 #include "EncoderChannel.h"
 #include "EXIHeaderEncoder.h"
+#include "Sha256.h"
 
 #include "iso1EXIDatatypes.h"
 #include "ErrorCodes.h"
@@ -43,38 +44,59 @@
 
 #if DEPLOY_ISO1_CODEC == SUPPORT_YES
 
-static int errn;
-
+/* Note: errn is a local of each encode function (reentrant encoding) */
 /* Forward Declarations */
 static int encode_iso1MessageHeaderType(bitstream_t* stream, struct iso1MessageHeaderType* iso1MessageHeaderType);
 static int encode_iso1SignatureType(bitstream_t* stream, struct iso1SignatureType* iso1SignatureType);
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 static int encode_iso1PowerDeliveryReqType(bitstream_t* stream, struct iso1PowerDeliveryReqType* iso1PowerDeliveryReqType);
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
 static int encode_iso1ParameterType(bitstream_t* stream, struct iso1ParameterType* iso1ParameterType);
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 static int encode_iso1CertificateInstallationReqType(bitstream_t* stream, struct iso1CertificateInstallationReqType* iso1CertificateInstallationReqType);
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
 static int encode_iso1SessionSetupResType(bitstream_t* stream, struct iso1SessionSetupResType* iso1SessionSetupResType);
+#endif /* ISO1_DEPLOY_SessionSetupRes */
 static int encode_iso1EVChargeParameterType(bitstream_t* stream, struct iso1EVChargeParameterType* iso1EVChargeParameterType);
 static int encode_iso1DiffieHellmanPublickeyType(bitstream_t* stream, struct iso1DiffieHellmanPublickeyType* iso1DiffieHellmanPublickeyType);
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 static int encode_iso1ServiceDiscoveryResType(bitstream_t* stream, struct iso1ServiceDiscoveryResType* iso1ServiceDiscoveryResType);
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
 static int encode_iso1ServiceParameterListType(bitstream_t* stream, struct iso1ServiceParameterListType* iso1ServiceParameterListType);
 static int encode_iso1CertificateChainType(bitstream_t* stream, struct iso1CertificateChainType* iso1CertificateChainType);
 static int encode_iso1SASchedulesType(bitstream_t* stream, struct iso1SASchedulesType* iso1SASchedulesType);
 static int encode_iso1DC_EVSEStatusType(bitstream_t* stream, struct iso1DC_EVSEStatusType* iso1DC_EVSEStatusType);
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
 static int encode_iso1PreChargeResType(bitstream_t* stream, struct iso1PreChargeResType* iso1PreChargeResType);
+#endif /* ISO1_DEPLOY_PreChargeRes */
 static int encode_iso1ParameterSetType(bitstream_t* stream, struct iso1ParameterSetType* iso1ParameterSetType);
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
 static int encode_iso1ServiceDetailReqType(bitstream_t* stream, struct iso1ServiceDetailReqType* iso1ServiceDetailReqType);
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
 static int encode_iso1RelativeTimeIntervalType(bitstream_t* stream, struct iso1RelativeTimeIntervalType* iso1RelativeTimeIntervalType);
 static int encode_iso1SignedInfoType(bitstream_t* stream, struct iso1SignedInfoType* iso1SignedInfoType);
 static int encode_iso1EMAIDType(bitstream_t* stream, struct iso1EMAIDType* iso1EMAIDType);
+#if ISO1_DEPLOY_EVStatus == SUPPORT_YES
 static int encode_iso1EVStatusType(bitstream_t* stream, struct iso1EVStatusType* iso1EVStatusType);
+#endif /* ISO1_DEPLOY_EVStatus */
 static int encode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceListType* iso1ServiceListType);
 static int encode_iso1EVSEChargeParameterType(bitstream_t* stream, struct iso1EVSEChargeParameterType* iso1EVSEChargeParameterType);
 static int encode_iso1EVPowerDeliveryParameterType(bitstream_t* stream, struct iso1EVPowerDeliveryParameterType* iso1EVPowerDeliveryParameterType);
 static int encode_iso1ProfileEntryType(bitstream_t* stream, struct iso1ProfileEntryType* iso1ProfileEntryType);
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
 static int encode_iso1AuthorizationReqType(bitstream_t* stream, struct iso1AuthorizationReqType* iso1AuthorizationReqType);
+#endif /* ISO1_DEPLOY_AuthorizationReq */
 static int encode_iso1MeterInfoType(bitstream_t* stream, struct iso1MeterInfoType* iso1MeterInfoType);
+#if ISO1_DEPLOY_Manifest == SUPPORT_YES
 static int encode_iso1ManifestType(bitstream_t* stream, struct iso1ManifestType* iso1ManifestType);
+#endif /* ISO1_DEPLOY_Manifest */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 static int encode_iso1ChargeParameterDiscoveryResType(bitstream_t* stream, struct iso1ChargeParameterDiscoveryResType* iso1ChargeParameterDiscoveryResType);
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 static int encode_iso1PowerDeliveryResType(bitstream_t* stream, struct iso1PowerDeliveryResType* iso1PowerDeliveryResType);
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
 static int encode_iso1DC_EVChargeParameterType(bitstream_t* stream, struct iso1DC_EVChargeParameterType* iso1DC_EVChargeParameterType);
 static int encode_iso1ConsumptionCostType(bitstream_t* stream, struct iso1ConsumptionCostType* iso1ConsumptionCostType);
 static int encode_iso1PMaxScheduleType(bitstream_t* stream, struct iso1PMaxScheduleType* iso1PMaxScheduleType);
@@ -82,28 +104,48 @@ static int encode_iso1PaymentOptionListType(bitstream_t* stream, struct iso1Paym
 static int encode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso1ObjectType);
 static int encode_iso1PhysicalValueType(bitstream_t* stream, struct iso1PhysicalValueType* iso1PhysicalValueType);
 static int encode_iso1RSAKeyValueType(bitstream_t* stream, struct iso1RSAKeyValueType* iso1RSAKeyValueType);
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
 static int encode_iso1SessionStopResType(bitstream_t* stream, struct iso1SessionStopResType* iso1SessionStopResType);
+#endif /* ISO1_DEPLOY_SessionStopRes */
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 static int encode_iso1CertificateUpdateReqType(bitstream_t* stream, struct iso1CertificateUpdateReqType* iso1CertificateUpdateReqType);
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
 static int encode_iso1SignatureValueType(bitstream_t* stream, struct iso1SignatureValueType* iso1SignatureValueType);
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 static int encode_iso1PaymentDetailsReqType(bitstream_t* stream, struct iso1PaymentDetailsReqType* iso1PaymentDetailsReqType);
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
 static int encode_iso1AuthorizationResType(bitstream_t* stream, struct iso1AuthorizationResType* iso1AuthorizationResType);
+#endif /* ISO1_DEPLOY_AuthorizationRes */
 static int encode_iso1DC_EVSEChargeParameterType(bitstream_t* stream, struct iso1DC_EVSEChargeParameterType* iso1DC_EVSEChargeParameterType);
 static int encode_iso1SubCertificatesType(bitstream_t* stream, struct iso1SubCertificatesType* iso1SubCertificatesType);
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
 static int encode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1ChargingStatusResType* iso1ChargingStatusResType);
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
 static int encode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValueType* iso1DSAKeyValueType);
 static int encode_iso1ListOfRootCertificateIDsType(bitstream_t* stream, struct iso1ListOfRootCertificateIDsType* iso1ListOfRootCertificateIDsType);
 static int encode_iso1ChargeServiceType(bitstream_t* stream, struct iso1ChargeServiceType* iso1ChargeServiceType);
 static int encode_iso1IntervalType(bitstream_t* stream, struct iso1IntervalType* iso1IntervalType);
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 static int encode_iso1MeteringReceiptReqType(bitstream_t* stream, struct iso1MeteringReceiptReqType* iso1MeteringReceiptReqType);
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
 static int encode_iso1ServiceDetailResType(bitstream_t* stream, struct iso1ServiceDetailResType* iso1ServiceDetailResType);
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
 static int encode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType* iso1KeyValueType);
 static int encode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1SelectedServiceListType* iso1SelectedServiceListType);
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
 static int encode_iso1CableCheckResType(bitstream_t* stream, struct iso1CableCheckResType* iso1CableCheckResType);
+#endif /* ISO1_DEPLOY_CableCheckRes */
 static int encode_iso1X509IssuerSerialType(bitstream_t* stream, struct iso1X509IssuerSerialType* iso1X509IssuerSerialType);
 static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* iso1KeyInfoType);
 static int encode_iso1TransformsType(bitstream_t* stream, struct iso1TransformsType* iso1TransformsType);
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 static int encode_iso1ChargeParameterDiscoveryReqType(bitstream_t* stream, struct iso1ChargeParameterDiscoveryReqType* iso1ChargeParameterDiscoveryReqType);
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
 static int encode_iso1PreChargeReqType(bitstream_t* stream, struct iso1PreChargeReqType* iso1PreChargeReqType);
+#endif /* ISO1_DEPLOY_PreChargeReq */
 static int encode_iso1EVSEStatusType(bitstream_t* stream, struct iso1EVSEStatusType* iso1EVSEStatusType);
 static int encode_iso1SignatureMethodType(bitstream_t* stream, struct iso1SignatureMethodType* iso1SignatureMethodType);
 static int encode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType* iso1X509DataType);
@@ -115,40 +157,76 @@ static int encode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 static int encode_iso1SAScheduleTupleType(bitstream_t* stream, struct iso1SAScheduleTupleType* iso1SAScheduleTupleType);
 static int encode_iso1AC_EVChargeParameterType(bitstream_t* stream, struct iso1AC_EVChargeParameterType* iso1AC_EVChargeParameterType);
 static int encode_iso1AnonType_V2G_Message(bitstream_t* stream, struct iso1AnonType_V2G_Message* iso1AnonType_V2G_Message);
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 static int encode_iso1PaymentDetailsResType(bitstream_t* stream, struct iso1PaymentDetailsResType* iso1PaymentDetailsResType);
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
 static int encode_iso1ContractSignatureEncryptedPrivateKeyType(bitstream_t* stream, struct iso1ContractSignatureEncryptedPrivateKeyType* iso1ContractSignatureEncryptedPrivateKeyType);
 static int encode_iso1PMaxScheduleEntryType(bitstream_t* stream, struct iso1PMaxScheduleEntryType* iso1PMaxScheduleEntryType);
 static int encode_iso1SPKIDataType(bitstream_t* stream, struct iso1SPKIDataType* iso1SPKIDataType);
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 static int encode_iso1MeteringReceiptResType(bitstream_t* stream, struct iso1MeteringReceiptResType* iso1MeteringReceiptResType);
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
 static int encode_iso1SessionStopReqType(bitstream_t* stream, struct iso1SessionStopReqType* iso1SessionStopReqType);
+#endif /* ISO1_DEPLOY_SessionStopReq */
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 static int encode_iso1WeldingDetectionResType(bitstream_t* stream, struct iso1WeldingDetectionResType* iso1WeldingDetectionResType);
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
 static int encode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceType* iso1ReferenceType);
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
 static int encode_iso1CurrentDemandReqType(bitstream_t* stream, struct iso1CurrentDemandReqType* iso1CurrentDemandReqType);
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
 static int encode_iso1SalesTariffEntryType(bitstream_t* stream, struct iso1SalesTariffEntryType* iso1SalesTariffEntryType);
+#if ISO1_DEPLOY_Entry == SUPPORT_YES
 static int encode_iso1EntryType(bitstream_t* stream, struct iso1EntryType* iso1EntryType);
+#endif /* ISO1_DEPLOY_Entry */
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
 static int encode_iso1SessionSetupReqType(bitstream_t* stream, struct iso1SessionSetupReqType* iso1SessionSetupReqType);
+#endif /* ISO1_DEPLOY_SessionSetupReq */
 static int encode_iso1CostType(bitstream_t* stream, struct iso1CostType* iso1CostType);
 static int encode_iso1DC_EVPowerDeliveryParameterType(bitstream_t* stream, struct iso1DC_EVPowerDeliveryParameterType* iso1DC_EVPowerDeliveryParameterType);
 static int encode_iso1RetrievalMethodType(bitstream_t* stream, struct iso1RetrievalMethodType* iso1RetrievalMethodType);
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 static int encode_iso1CertificateUpdateResType(bitstream_t* stream, struct iso1CertificateUpdateResType* iso1CertificateUpdateResType);
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 static int encode_iso1CertificateInstallationResType(bitstream_t* stream, struct iso1CertificateInstallationResType* iso1CertificateInstallationResType);
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
 static int encode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso1CanonicalizationMethodType* iso1CanonicalizationMethodType);
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 static int encode_iso1WeldingDetectionReqType(bitstream_t* stream, struct iso1WeldingDetectionReqType* iso1WeldingDetectionReqType);
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
 static int encode_iso1DC_EVStatusType(bitstream_t* stream, struct iso1DC_EVStatusType* iso1DC_EVStatusType);
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
 static int encode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1CurrentDemandResType* iso1CurrentDemandResType);
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
 static int encode_iso1ServiceType(bitstream_t* stream, struct iso1ServiceType* iso1ServiceType);
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 static int encode_iso1ServiceDiscoveryReqType(bitstream_t* stream, struct iso1ServiceDiscoveryReqType* iso1ServiceDiscoveryReqType);
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
 static int encode_iso1AC_EVSEChargeParameterType(bitstream_t* stream, struct iso1AC_EVSEChargeParameterType* iso1AC_EVSEChargeParameterType);
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
 static int encode_iso1CableCheckReqType(bitstream_t* stream, struct iso1CableCheckReqType* iso1CableCheckReqType);
+#endif /* ISO1_DEPLOY_CableCheckReq */
 static int encode_iso1SelectedServiceType(bitstream_t* stream, struct iso1SelectedServiceType* iso1SelectedServiceType);
 static int encode_iso1AC_EVSEStatusType(bitstream_t* stream, struct iso1AC_EVSEStatusType* iso1AC_EVSEStatusType);
 static int encode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTariffType* iso1SalesTariffType);
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 static int encode_iso1PaymentServiceSelectionReqType(bitstream_t* stream, struct iso1PaymentServiceSelectionReqType* iso1PaymentServiceSelectionReqType);
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
+#if ISO1_DEPLOY_SignatureProperties == SUPPORT_YES
 static int encode_iso1SignaturePropertiesType(bitstream_t* stream, struct iso1SignaturePropertiesType* iso1SignaturePropertiesType);
+#endif /* ISO1_DEPLOY_SignatureProperties */
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
 static int encode_iso1BodyBaseType(bitstream_t* stream, struct iso1BodyBaseType* iso1BodyBaseType);
+#endif /* ISO1_DEPLOY_BodyElement */
 static int encode_iso1SupportedEnergyTransferModeType(bitstream_t* stream, struct iso1SupportedEnergyTransferModeType* iso1SupportedEnergyTransferModeType);
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
 static int encode_iso1ChargingStatusReqType(bitstream_t* stream, struct iso1ChargingStatusReqType* iso1ChargingStatusReqType);
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 static int encode_iso1PaymentServiceSelectionResType(bitstream_t* stream, struct iso1PaymentServiceSelectionResType* iso1PaymentServiceSelectionResType);
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
 static int encode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMethodType* iso1DigestMethodType);
 static int encode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1SignaturePropertyType* iso1SignaturePropertyType);
 static int encode_iso1PGPDataType(bitstream_t* stream, struct iso1PGPDataType* iso1PGPDataType);
@@ -156,6 +234,7 @@ static int encode_iso1PGPDataType(bitstream_t* stream, struct iso1PGPDataType* i
 
 /* Complex type name='urn:iso:15118:2:2013:MsgHeader,MessageHeaderType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgHeader":SessionID,"urn:iso:15118:2:2013:MsgHeader":Notification{0-1},"http://www.w3.org/2000/09/xmldsig#":Signature{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1MessageHeaderType(bitstream_t* stream, struct iso1MessageHeaderType* iso1MessageHeaderType) {
+	int errn = 0;
 	int grammarID = 0;
 	int done = 0;
 	
@@ -194,7 +273,11 @@ static int encode_iso1MessageHeaderType(bitstream_t* stream, struct iso1MessageH
 			} else 			if ( iso1MessageHeaderType->Signature_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso1SignatureType(stream, iso1MessageHeaderType->Signature );
+#else
 					errn = encode_iso1SignatureType(stream, &iso1MessageHeaderType->Signature );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 3;
 			} else 			if (1==1) {
@@ -212,7 +295,11 @@ static int encode_iso1MessageHeaderType(bitstream_t* stream, struct iso1MessageH
 			if ( iso1MessageHeaderType->Signature_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso1SignatureType(stream, iso1MessageHeaderType->Signature );
+#else
 					errn = encode_iso1SignatureType(stream, &iso1MessageHeaderType->Signature );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 3;
 			} else 			if (1==1) {
@@ -250,6 +337,7 @@ static int encode_iso1MessageHeaderType(bitstream_t* stream, struct iso1MessageH
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignedInfo,"http://www.w3.org/2000/09/xmldsig#":SignatureValue,"http://www.w3.org/2000/09/xmldsig#":KeyInfo{0-1},"http://www.w3.org/2000/09/xmldsig#":Object{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1SignatureType(bitstream_t* stream, struct iso1SignatureType* iso1SignatureType) {
+	int errn = 0;
 	int grammarID = 5;
 	int done = 0;
 	
@@ -262,11 +350,8 @@ static int encode_iso1SignatureType(bitstream_t* stream, struct iso1SignatureTyp
 			if ( iso1SignatureType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignatureType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignatureType->Id.characters, iso1SignatureType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Id */, iso1SignatureType->Id.characters, iso1SignatureType->Id.charactersLen);
 				}
 				grammarID = 6;
 			} else 			if ( 1 == 1 ) {
@@ -308,7 +393,11 @@ static int encode_iso1SignatureType(bitstream_t* stream, struct iso1SignatureTyp
 			if ( iso1SignatureType->KeyInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso1KeyInfoType(stream, iso1SignatureType->KeyInfo );
+#else
 					errn = encode_iso1KeyInfoType(stream, &iso1SignatureType->KeyInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 9;
 			} else 			if (iso1SignatureType_Object_currArrayIndex < iso1SignatureType->Object.arrayLen ) {
@@ -357,7 +446,9 @@ static int encode_iso1SignatureType(bitstream_t* stream, struct iso1SignatureTyp
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PowerDeliveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ChargeProgress,"urn:iso:15118:2:2013:MsgBody":SAScheduleTupleID,"urn:iso:15118:2:2013:MsgBody":ChargingProfile{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVPowerDeliveryParameter{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 static int encode_iso1PowerDeliveryReqType(bitstream_t* stream, struct iso1PowerDeliveryReqType* iso1PowerDeliveryReqType) {
+	int errn = 0;
 	int grammarID = 10;
 	int done = 0;
 	
@@ -476,9 +567,11 @@ static int encode_iso1PowerDeliveryReqType(bitstream_t* stream, struct iso1Power
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ParameterType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":boolValue|"urn:iso:15118:2:2013:MsgDataTypes":byteValue|"urn:iso:15118:2:2013:MsgDataTypes":shortValue|"urn:iso:15118:2:2013:MsgDataTypes":intValue|"urn:iso:15118:2:2013:MsgDataTypes":physicalValue|"urn:iso:15118:2:2013:MsgDataTypes":stringValue)',  derivedBy='RESTRICTION'.  */
 static int encode_iso1ParameterType(bitstream_t* stream, struct iso1ParameterType* iso1ParameterType) {
+	int errn = 0;
 	int grammarID = 14;
 	int done = 0;
 	
@@ -490,11 +583,8 @@ static int encode_iso1ParameterType(bitstream_t* stream, struct iso1ParameterTyp
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ParameterType->Name.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ParameterType->Name.characters, iso1ParameterType->Name.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 20 /* {urn:iso:15118:2:2013:MsgDataTypes}Name */, iso1ParameterType->Name.characters, iso1ParameterType->Name.charactersLen);
 				}
 				grammarID = 15;
 			} else {
@@ -563,11 +653,8 @@ static int encode_iso1ParameterType(bitstream_t* stream, struct iso1ParameterTyp
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ParameterType->stringValue.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1ParameterType->stringValue.characters, iso1ParameterType->stringValue.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 24 /* {urn:iso:15118:2:2013:MsgDataTypes}stringValue */, iso1ParameterType->stringValue.characters, iso1ParameterType->stringValue.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -601,7 +688,9 @@ static int encode_iso1ParameterType(bitstream_t* stream, struct iso1ParameterTyp
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CertificateInstallationReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":OEMProvisioningCert,"urn:iso:15118:2:2013:MsgBody":ListOfRootCertificateIDs)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 static int encode_iso1CertificateInstallationReqType(bitstream_t* stream, struct iso1CertificateInstallationReqType* iso1CertificateInstallationReqType) {
+	int errn = 0;
 	int grammarID = 16;
 	int done = 0;
 	
@@ -613,11 +702,8 @@ static int encode_iso1CertificateInstallationReqType(bitstream_t* stream, struct
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1CertificateInstallationReqType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1CertificateInstallationReqType->Id.characters, iso1CertificateInstallationReqType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, iso1CertificateInstallationReqType->Id.characters, iso1CertificateInstallationReqType->Id.charactersLen);
 				}
 				grammarID = 17;
 			} else {
@@ -679,9 +765,12 @@ static int encode_iso1CertificateInstallationReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,SessionSetupResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":EVSEID,"urn:iso:15118:2:2013:MsgBody":EVSETimeStamp{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
 static int encode_iso1SessionSetupResType(bitstream_t* stream, struct iso1SessionSetupResType* iso1SessionSetupResType) {
+	int errn = 0;
 	int grammarID = 19;
 	int done = 0;
 	
@@ -714,11 +803,8 @@ static int encode_iso1SessionSetupResType(bitstream_t* stream, struct iso1Sessio
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SessionSetupResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1SessionSetupResType->EVSEID.characters, iso1SessionSetupResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, iso1SessionSetupResType->EVSEID.characters, iso1SessionSetupResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -774,9 +860,11 @@ static int encode_iso1SessionSetupResType(bitstream_t* stream, struct iso1Sessio
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_SessionSetupRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EVChargeParameterType',  base type name='anyType',  content type='ELEMENT',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":DepartureTime{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1EVChargeParameterType(bitstream_t* stream, struct iso1EVChargeParameterType* iso1EVChargeParameterType) {
+	int errn = 0;
 	int grammarID = 22;
 	int done = 0;
 	
@@ -832,6 +920,7 @@ static int encode_iso1EVChargeParameterType(bitstream_t* stream, struct iso1EVCh
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DiffieHellmanPublickeyType',  base type name='dHpublickeyType',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 static int encode_iso1DiffieHellmanPublickeyType(bitstream_t* stream, struct iso1DiffieHellmanPublickeyType* iso1DiffieHellmanPublickeyType) {
+	int errn = 0;
 	int grammarID = 23;
 	int done = 0;
 	
@@ -843,11 +932,8 @@ static int encode_iso1DiffieHellmanPublickeyType(bitstream_t* stream, struct iso
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1DiffieHellmanPublickeyType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1DiffieHellmanPublickeyType->Id.characters, iso1DiffieHellmanPublickeyType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, iso1DiffieHellmanPublickeyType->Id.characters, iso1DiffieHellmanPublickeyType->Id.charactersLen);
 				}
 				grammarID = 24;
 			} else {
@@ -893,7 +979,9 @@ static int encode_iso1DiffieHellmanPublickeyType(bitstream_t* stream, struct iso
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ServiceDiscoveryResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":PaymentOptionList,"urn:iso:15118:2:2013:MsgBody":ChargeService,"urn:iso:15118:2:2013:MsgBody":ServiceList{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 static int encode_iso1ServiceDiscoveryResType(bitstream_t* stream, struct iso1ServiceDiscoveryResType* iso1ServiceDiscoveryResType) {
+	int errn = 0;
 	int grammarID = 25;
 	int done = 0;
 	
@@ -982,9 +1070,11 @@ static int encode_iso1ServiceDiscoveryResType(bitstream_t* stream, struct iso1Se
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ServiceParameterListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ParameterSet{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1ServiceParameterListType(bitstream_t* stream, struct iso1ServiceParameterListType* iso1ServiceParameterListType) {
+	int errn = 0;
 	int grammarID = 29;
 	int done = 0;
 	
@@ -1035,6 +1125,7 @@ static int encode_iso1ServiceParameterListType(bitstream_t* stream, struct iso1S
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,CertificateChainType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":Certificate,"urn:iso:15118:2:2013:MsgDataTypes":SubCertificates{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1CertificateChainType(bitstream_t* stream, struct iso1CertificateChainType* iso1CertificateChainType) {
+	int errn = 0;
 	int grammarID = 31;
 	int done = 0;
 	
@@ -1046,11 +1137,8 @@ static int encode_iso1CertificateChainType(bitstream_t* stream, struct iso1Certi
 			if ( iso1CertificateChainType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1CertificateChainType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1CertificateChainType->Id.characters, iso1CertificateChainType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, iso1CertificateChainType->Id.characters, iso1CertificateChainType->Id.charactersLen);
 				}
 				grammarID = 32;
 			} else 			if ( 1 == 1 ) {
@@ -1136,6 +1224,7 @@ static int encode_iso1CertificateChainType(bitstream_t* stream, struct iso1Certi
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SASchedulesType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_iso1SASchedulesType(bitstream_t* stream, struct iso1SASchedulesType* iso1SASchedulesType) {
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -1167,6 +1256,7 @@ static int encode_iso1SASchedulesType(bitstream_t* stream, struct iso1SASchedule
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DC_EVSEStatusType',  base type name='EVSEStatusType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":NotificationMaxDelay,"urn:iso:15118:2:2013:MsgDataTypes":EVSENotification),("urn:iso:15118:2:2013:MsgDataTypes":EVSEIsolationStatus{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVSEStatusCode))',  derivedBy='EXTENSION'.  */
 static int encode_iso1DC_EVSEStatusType(bitstream_t* stream, struct iso1DC_EVSEStatusType* iso1DC_EVSEStatusType) {
+	int errn = 0;
 	int grammarID = 35;
 	int done = 0;
 	
@@ -1281,7 +1371,9 @@ static int encode_iso1DC_EVSEStatusType(bitstream_t* stream, struct iso1DC_EVSES
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PreChargeResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2013:MsgBody":EVSEPresentVoltage)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
 static int encode_iso1PreChargeResType(bitstream_t* stream, struct iso1PreChargeResType* iso1PreChargeResType) {
+	int errn = 0;
 	int grammarID = 39;
 	int done = 0;
 	
@@ -1352,9 +1444,11 @@ static int encode_iso1PreChargeResType(bitstream_t* stream, struct iso1PreCharge
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_PreChargeRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ParameterSetType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ParameterSetID,"urn:iso:15118:2:2013:MsgDataTypes":Parameter{1-16})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1ParameterSetType(bitstream_t* stream, struct iso1ParameterSetType* iso1ParameterSetType) {
+	int errn = 0;
 	int grammarID = 42;
 	int done = 0;
 	
@@ -1686,7 +1780,9 @@ static int encode_iso1ParameterSetType(bitstream_t* stream, struct iso1Parameter
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ServiceDetailReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ServiceID)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
 static int encode_iso1ServiceDetailReqType(bitstream_t* stream, struct iso1ServiceDetailReqType* iso1ServiceDetailReqType) {
+	int errn = 0;
 	int grammarID = 59;
 	int done = 0;
 	
@@ -1733,9 +1829,11 @@ static int encode_iso1ServiceDetailReqType(bitstream_t* stream, struct iso1Servi
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,RelativeTimeIntervalType',  base type name='IntervalType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":start,"urn:iso:15118:2:2013:MsgDataTypes":duration{0-1})',  derivedBy='EXTENSION'.  */
 static int encode_iso1RelativeTimeIntervalType(bitstream_t* stream, struct iso1RelativeTimeIntervalType* iso1RelativeTimeIntervalType) {
+	int errn = 0;
 	int grammarID = 60;
 	int done = 0;
 	
@@ -1809,6 +1907,7 @@ static int encode_iso1RelativeTimeIntervalType(bitstream_t* stream, struct iso1R
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignedInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":CanonicalizationMethod,"http://www.w3.org/2000/09/xmldsig#":SignatureMethod,"http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1SignedInfoType(bitstream_t* stream, struct iso1SignedInfoType* iso1SignedInfoType) {
+	int errn = 0;
 	int grammarID = 62;
 	int done = 0;
 	
@@ -1821,11 +1920,8 @@ static int encode_iso1SignedInfoType(bitstream_t* stream, struct iso1SignedInfoT
 			if ( iso1SignedInfoType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignedInfoType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignedInfoType->Id.characters, iso1SignedInfoType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Id */, iso1SignedInfoType->Id.characters, iso1SignedInfoType->Id.charactersLen);
 				}
 				grammarID = 63;
 			} else 			if ( 1 == 1 ) {
@@ -1905,6 +2001,7 @@ static int encode_iso1SignedInfoType(bitstream_t* stream, struct iso1SignedInfoT
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EMAIDType',  base type name='eMAIDType',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 static int encode_iso1EMAIDType(bitstream_t* stream, struct iso1EMAIDType* iso1EMAIDType) {
+	int errn = 0;
 	int grammarID = 67;
 	int done = 0;
 	
@@ -1916,11 +2013,8 @@ static int encode_iso1EMAIDType(bitstream_t* stream, struct iso1EMAIDType* iso1E
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1EMAIDType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1EMAIDType->Id.characters, iso1EMAIDType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, iso1EMAIDType->Id.characters, iso1EMAIDType->Id.charactersLen);
 				}
 				grammarID = 68;
 			} else {
@@ -1932,11 +2026,8 @@ static int encode_iso1EMAIDType(bitstream_t* stream, struct iso1EMAIDType* iso1E
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1EMAIDType->CONTENT.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1EMAIDType->CONTENT.characters, iso1EMAIDType->CONTENT.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, iso1EMAIDType->CONTENT.characters, iso1EMAIDType->CONTENT.charactersLen);
 				}
 				grammarID = 3;
 			} else {
@@ -1967,7 +2058,9 @@ static int encode_iso1EMAIDType(bitstream_t* stream, struct iso1EMAIDType* iso1E
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EVStatusType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if ISO1_DEPLOY_EVStatus == SUPPORT_YES
 static int encode_iso1EVStatusType(bitstream_t* stream, struct iso1EVStatusType* iso1EVStatusType) {
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -1996,9 +2089,11 @@ static int encode_iso1EVStatusType(bitstream_t* stream, struct iso1EVStatusType*
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_EVStatus */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ServiceListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":Service{1-8})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceListType* iso1ServiceListType) {
+	int errn = 0;
 	int grammarID = 69;
 	int done = 0;
 	
@@ -2169,6 +2264,7 @@ static int encode_iso1ServiceListType(bitstream_t* stream, struct iso1ServiceLis
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EVSEChargeParameterType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_iso1EVSEChargeParameterType(bitstream_t* stream, struct iso1EVSEChargeParameterType* iso1EVSEChargeParameterType) {
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -2200,6 +2296,7 @@ static int encode_iso1EVSEChargeParameterType(bitstream_t* stream, struct iso1EV
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EVPowerDeliveryParameterType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_iso1EVPowerDeliveryParameterType(bitstream_t* stream, struct iso1EVPowerDeliveryParameterType* iso1EVPowerDeliveryParameterType) {
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -2231,6 +2328,7 @@ static int encode_iso1EVPowerDeliveryParameterType(bitstream_t* stream, struct i
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ProfileEntryType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ChargingProfileEntryStart,"urn:iso:15118:2:2013:MsgDataTypes":ChargingProfileEntryMaxPower,"urn:iso:15118:2:2013:MsgDataTypes":ChargingProfileEntryMaxNumberOfPhasesInUse{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1ProfileEntryType(bitstream_t* stream, struct iso1ProfileEntryType* iso1ProfileEntryType) {
+	int errn = 0;
 	int grammarID = 77;
 	int done = 0;
 	
@@ -2315,7 +2413,9 @@ static int encode_iso1ProfileEntryType(bitstream_t* stream, struct iso1ProfileEn
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,AuthorizationReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":GenChallenge{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
 static int encode_iso1AuthorizationReqType(bitstream_t* stream, struct iso1AuthorizationReqType* iso1AuthorizationReqType) {
+	int errn = 0;
 	int grammarID = 80;
 	int done = 0;
 	
@@ -2327,11 +2427,8 @@ static int encode_iso1AuthorizationReqType(bitstream_t* stream, struct iso1Autho
 			if ( iso1AuthorizationReqType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1AuthorizationReqType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1AuthorizationReqType->Id.characters, iso1AuthorizationReqType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, iso1AuthorizationReqType->Id.characters, iso1AuthorizationReqType->Id.charactersLen);
 				}
 				grammarID = 81;
 			} else 			if ( iso1AuthorizationReqType->GenChallenge_isUsed == 1u ) {
@@ -2408,9 +2505,11 @@ static int encode_iso1AuthorizationReqType(bitstream_t* stream, struct iso1Autho
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_AuthorizationReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,MeterInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":MeterID,"urn:iso:15118:2:2013:MsgDataTypes":MeterReading{0-1},"urn:iso:15118:2:2013:MsgDataTypes":SigMeterReading{0-1},"urn:iso:15118:2:2013:MsgDataTypes":MeterStatus{0-1},"urn:iso:15118:2:2013:MsgDataTypes":TMeter{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1MeterInfoType(bitstream_t* stream, struct iso1MeterInfoType* iso1MeterInfoType) {
+	int errn = 0;
 	int grammarID = 82;
 	int done = 0;
 	
@@ -2425,11 +2524,8 @@ static int encode_iso1MeterInfoType(bitstream_t* stream, struct iso1MeterInfoTyp
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1MeterInfoType->MeterID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1MeterInfoType->MeterID.characters, iso1MeterInfoType->MeterID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 19 /* {urn:iso:15118:2:2013:MsgDataTypes}MeterID */, iso1MeterInfoType->MeterID.characters, iso1MeterInfoType->MeterID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -2637,7 +2733,9 @@ static int encode_iso1MeterInfoType(bitstream_t* stream, struct iso1MeterInfoTyp
 }
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ManifestType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if ISO1_DEPLOY_Manifest == SUPPORT_YES
 static int encode_iso1ManifestType(bitstream_t* stream, struct iso1ManifestType* iso1ManifestType) {
+	int errn = 0;
 	int grammarID = 87;
 	int done = 0;
 	
@@ -2650,11 +2748,8 @@ static int encode_iso1ManifestType(bitstream_t* stream, struct iso1ManifestType*
 			if ( iso1ManifestType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ManifestType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ManifestType->Id.characters, iso1ManifestType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Id */, iso1ManifestType->Id.characters, iso1ManifestType->Id.charactersLen);
 				}
 				grammarID = 88;
 			} else 			if (iso1ManifestType_Reference_currArrayIndex < iso1ManifestType->Reference.arrayLen ) {
@@ -2707,9 +2802,12 @@ static int encode_iso1ManifestType(bitstream_t* stream, struct iso1ManifestType*
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_Manifest */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ChargeParameterDiscoveryResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":EVSEProcessing,"urn:iso:15118:2:2013:MsgDataTypes":SASchedules{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVSEChargeParameter)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 static int encode_iso1ChargeParameterDiscoveryResType(bitstream_t* stream, struct iso1ChargeParameterDiscoveryResType* iso1ChargeParameterDiscoveryResType) {
+	int errn = 0;
 	int grammarID = 89;
 	int done = 0;
 	
@@ -2775,7 +2873,11 @@ static int encode_iso1ChargeParameterDiscoveryResType(bitstream_t* stream, struc
 			} else 			if ( iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso1DC_EVSEChargeParameterType(stream, iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter );
+#else
 					errn = encode_iso1DC_EVSEChargeParameterType(stream, &iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 3;
 			} else 			if ( iso1ChargeParameterDiscoveryResType->EVSEChargeParameter_isUsed == 1u ) {
@@ -2799,7 +2901,11 @@ static int encode_iso1ChargeParameterDiscoveryResType(bitstream_t* stream, struc
 			} else 			if ( iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso1DC_EVSEChargeParameterType(stream, iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter );
+#else
 					errn = encode_iso1DC_EVSEChargeParameterType(stream, &iso1ChargeParameterDiscoveryResType->DC_EVSEChargeParameter );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 3;
 			} else 			if ( iso1ChargeParameterDiscoveryResType->EVSEChargeParameter_isUsed == 1u ) {
@@ -2834,9 +2940,12 @@ static int encode_iso1ChargeParameterDiscoveryResType(bitstream_t* stream, struc
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PowerDeliveryResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgDataTypes":EVSEStatus)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 static int encode_iso1PowerDeliveryResType(bitstream_t* stream, struct iso1PowerDeliveryResType* iso1PowerDeliveryResType) {
+	int errn = 0;
 	int grammarID = 93;
 	int done = 0;
 	
@@ -2907,9 +3016,11 @@ static int encode_iso1PowerDeliveryResType(bitstream_t* stream, struct iso1Power
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DC_EVChargeParameterType',  base type name='EVChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":DepartureTime{0-1}),("urn:iso:15118:2:2013:MsgDataTypes":DC_EVStatus,"urn:iso:15118:2:2013:MsgDataTypes":EVMaximumCurrentLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVMaximumPowerLimit{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVMaximumVoltageLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVEnergyCapacity{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVEnergyRequest{0-1},"urn:iso:15118:2:2013:MsgDataTypes":FullSOC{0-1},"urn:iso:15118:2:2013:MsgDataTypes":BulkSOC{0-1}))',  derivedBy='EXTENSION'.  */
 static int encode_iso1DC_EVChargeParameterType(bitstream_t* stream, struct iso1DC_EVChargeParameterType* iso1DC_EVChargeParameterType) {
+	int errn = 0;
 	int grammarID = 95;
 	int done = 0;
 	
@@ -3169,6 +3280,7 @@ static int encode_iso1DC_EVChargeParameterType(bitstream_t* stream, struct iso1D
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ConsumptionCostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":startValue,"urn:iso:15118:2:2013:MsgDataTypes":Cost{1-3})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1ConsumptionCostType(bitstream_t* stream, struct iso1ConsumptionCostType* iso1ConsumptionCostType) {
+	int errn = 0;
 	int grammarID = 104;
 	int done = 0;
 	
@@ -3261,6 +3373,7 @@ static int encode_iso1ConsumptionCostType(bitstream_t* stream, struct iso1Consum
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,PMaxScheduleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":PMaxScheduleEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1PMaxScheduleType(bitstream_t* stream, struct iso1PMaxScheduleType* iso1PMaxScheduleType) {
+	int errn = 0;
 	int grammarID = 108;
 	int done = 0;
 	
@@ -3311,6 +3424,7 @@ static int encode_iso1PMaxScheduleType(bitstream_t* stream, struct iso1PMaxSched
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,PaymentOptionListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":PaymentOption{1-2})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1PaymentOptionListType(bitstream_t* stream, struct iso1PaymentOptionListType* iso1PaymentOptionListType) {
+	int errn = 0;
 	int grammarID = 110;
 	int done = 0;
 	
@@ -3385,6 +3499,7 @@ static int encode_iso1PaymentOptionListType(bitstream_t* stream, struct iso1Paym
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ObjectType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any])){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso1ObjectType) {
+	int errn = 0;
 	int grammarID = 112;
 	int done = 0;
 	int wcDone = 0;
@@ -3397,31 +3512,22 @@ static int encode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 			if ( iso1ObjectType->Encoding_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ObjectType->Encoding.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ObjectType->Encoding.characters, iso1ObjectType->Encoding.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 26 /* {}Encoding */, iso1ObjectType->Encoding.characters, iso1ObjectType->Encoding.charactersLen);
 				}
 				grammarID = 113;
 			} else 			if ( iso1ObjectType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ObjectType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ObjectType->Id.characters, iso1ObjectType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Id */, iso1ObjectType->Id.characters, iso1ObjectType->Id.charactersLen);
 				}
 				grammarID = 114;
 			} else 			if ( iso1ObjectType->MimeType_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ObjectType->MimeType.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ObjectType->MimeType.characters, iso1ObjectType->MimeType.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 28 /* {}MimeType */, iso1ObjectType->MimeType.characters, iso1ObjectType->MimeType.charactersLen);
 				}
 				grammarID = 115;
 			} else 			if (1==0) {
@@ -3436,11 +3542,8 @@ static int encode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 			} else 			if ( iso1ObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 5);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 116;
@@ -3453,21 +3556,15 @@ static int encode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 			if ( iso1ObjectType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ObjectType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ObjectType->Id.characters, iso1ObjectType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Id */, iso1ObjectType->Id.characters, iso1ObjectType->Id.charactersLen);
 				}
 				grammarID = 114;
 			} else 			if ( iso1ObjectType->MimeType_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ObjectType->MimeType.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ObjectType->MimeType.characters, iso1ObjectType->MimeType.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 28 /* {}MimeType */, iso1ObjectType->MimeType.characters, iso1ObjectType->MimeType.charactersLen);
 				}
 				grammarID = 115;
 			} else 			if (1==0) {
@@ -3482,11 +3579,8 @@ static int encode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 			} else 			if ( iso1ObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 4);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 116;
@@ -3499,11 +3593,8 @@ static int encode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 			if ( iso1ObjectType->MimeType_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ObjectType->MimeType.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ObjectType->MimeType.characters, iso1ObjectType->MimeType.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 28 /* {}MimeType */, iso1ObjectType->MimeType.characters, iso1ObjectType->MimeType.charactersLen);
 				}
 				grammarID = 115;
 			} else 			if (1==0) {
@@ -3518,11 +3609,8 @@ static int encode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 			} else 			if ( iso1ObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 116;
@@ -3544,11 +3632,8 @@ static int encode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 			} else 			if ( iso1ObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 116;
@@ -3570,11 +3655,8 @@ static int encode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 			} else 			if ( iso1ObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso1ObjectType->ANY.characters, iso1ObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 116;
@@ -3595,6 +3677,7 @@ static int encode_iso1ObjectType(bitstream_t* stream, struct iso1ObjectType* iso
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,PhysicalValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":Multiplier,"urn:iso:15118:2:2013:MsgDataTypes":Unit,"urn:iso:15118:2:2013:MsgDataTypes":Value)',  derivedBy='RESTRICTION'.  */
 static int encode_iso1PhysicalValueType(bitstream_t* stream, struct iso1PhysicalValueType* iso1PhysicalValueType) {
+	int errn = 0;
 	int grammarID = 117;
 	int done = 0;
 	
@@ -3680,6 +3763,7 @@ static int encode_iso1PhysicalValueType(bitstream_t* stream, struct iso1Physical
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Modulus,"http://www.w3.org/2000/09/xmldsig#":Exponent)',  derivedBy='RESTRICTION'.  */
 static int encode_iso1RSAKeyValueType(bitstream_t* stream, struct iso1RSAKeyValueType* iso1RSAKeyValueType) {
+	int errn = 0;
 	int grammarID = 120;
 	int done = 0;
 	
@@ -3752,7 +3836,9 @@ static int encode_iso1RSAKeyValueType(bitstream_t* stream, struct iso1RSAKeyValu
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,SessionStopResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
 static int encode_iso1SessionStopResType(bitstream_t* stream, struct iso1SessionStopResType* iso1SessionStopResType) {
+	int errn = 0;
 	int grammarID = 122;
 	int done = 0;
 	
@@ -3799,9 +3885,12 @@ static int encode_iso1SessionStopResType(bitstream_t* stream, struct iso1Session
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_SessionStopRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CertificateUpdateReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2013:MsgBody":eMAID,"urn:iso:15118:2:2013:MsgBody":ListOfRootCertificateIDs)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 static int encode_iso1CertificateUpdateReqType(bitstream_t* stream, struct iso1CertificateUpdateReqType* iso1CertificateUpdateReqType) {
+	int errn = 0;
 	int grammarID = 123;
 	int done = 0;
 	
@@ -3813,11 +3902,8 @@ static int encode_iso1CertificateUpdateReqType(bitstream_t* stream, struct iso1C
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1CertificateUpdateReqType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1CertificateUpdateReqType->Id.characters, iso1CertificateUpdateReqType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, iso1CertificateUpdateReqType->Id.characters, iso1CertificateUpdateReqType->Id.charactersLen);
 				}
 				grammarID = 124;
 			} else {
@@ -3844,11 +3930,8 @@ static int encode_iso1CertificateUpdateReqType(bitstream_t* stream, struct iso1C
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1CertificateUpdateReqType->eMAID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1CertificateUpdateReqType->eMAID.characters, iso1CertificateUpdateReqType->eMAID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, iso1CertificateUpdateReqType->eMAID.characters, iso1CertificateUpdateReqType->eMAID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -3892,9 +3975,11 @@ static int encode_iso1CertificateUpdateReqType(bitstream_t* stream, struct iso1C
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureValueType',  base type name='base64Binary',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 static int encode_iso1SignatureValueType(bitstream_t* stream, struct iso1SignatureValueType* iso1SignatureValueType) {
+	int errn = 0;
 	int grammarID = 126;
 	int done = 0;
 	
@@ -3906,11 +3991,8 @@ static int encode_iso1SignatureValueType(bitstream_t* stream, struct iso1Signatu
 			if ( iso1SignatureValueType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignatureValueType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignatureValueType->Id.characters, iso1SignatureValueType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Id */, iso1SignatureValueType->Id.characters, iso1SignatureValueType->Id.charactersLen);
 				}
 				grammarID = 24;
 			} else 			if (1==1) {
@@ -3965,7 +4047,9 @@ static int encode_iso1SignatureValueType(bitstream_t* stream, struct iso1Signatu
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PaymentDetailsReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":eMAID,"urn:iso:15118:2:2013:MsgBody":ContractSignatureCertChain)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 static int encode_iso1PaymentDetailsReqType(bitstream_t* stream, struct iso1PaymentDetailsReqType* iso1PaymentDetailsReqType) {
+	int errn = 0;
 	int grammarID = 127;
 	int done = 0;
 	
@@ -3980,11 +4064,8 @@ static int encode_iso1PaymentDetailsReqType(bitstream_t* stream, struct iso1Paym
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1PaymentDetailsReqType->eMAID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1PaymentDetailsReqType->eMAID.characters, iso1PaymentDetailsReqType->eMAID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, iso1PaymentDetailsReqType->eMAID.characters, iso1PaymentDetailsReqType->eMAID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -4028,9 +4109,12 @@ static int encode_iso1PaymentDetailsReqType(bitstream_t* stream, struct iso1Paym
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,AuthorizationResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":EVSEProcessing)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
 static int encode_iso1AuthorizationResType(bitstream_t* stream, struct iso1AuthorizationResType* iso1AuthorizationResType) {
+	int errn = 0;
 	int grammarID = 129;
 	int done = 0;
 	
@@ -4095,9 +4179,11 @@ static int encode_iso1AuthorizationResType(bitstream_t* stream, struct iso1Autho
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_AuthorizationRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DC_EVSEChargeParameterType',  base type name='EVSEChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":DC_EVSEStatus,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMaximumCurrentLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMaximumPowerLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMaximumVoltageLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMinimumCurrentLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMinimumVoltageLimit,"urn:iso:15118:2:2013:MsgDataTypes":EVSECurrentRegulationTolerance{0-1},"urn:iso:15118:2:2013:MsgDataTypes":EVSEPeakCurrentRipple,"urn:iso:15118:2:2013:MsgDataTypes":EVSEEnergyToBeDelivered{0-1})',  derivedBy='EXTENSION'.  */
 static int encode_iso1DC_EVSEChargeParameterType(bitstream_t* stream, struct iso1DC_EVSEChargeParameterType* iso1DC_EVSEChargeParameterType) {
+	int errn = 0;
 	int grammarID = 131;
 	int done = 0;
 	
@@ -4249,6 +4335,7 @@ static int encode_iso1DC_EVSEChargeParameterType(bitstream_t* stream, struct iso
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SubCertificatesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":Certificate{1-4})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1SubCertificatesType(bitstream_t* stream, struct iso1SubCertificatesType* iso1SubCertificatesType) {
+	int errn = 0;
 	int grammarID = 140;
 	int done = 0;
 	
@@ -4386,7 +4473,9 @@ static int encode_iso1SubCertificatesType(bitstream_t* stream, struct iso1SubCer
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ChargingStatusResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":EVSEID,"urn:iso:15118:2:2013:MsgBody":SAScheduleTupleID,"urn:iso:15118:2:2013:MsgBody":EVSEMaxCurrent{0-1},"urn:iso:15118:2:2013:MsgBody":MeterInfo{0-1},"urn:iso:15118:2:2013:MsgBody":ReceiptRequired{0-1},"urn:iso:15118:2:2013:MsgBody":AC_EVSEStatus)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
 static int encode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1ChargingStatusResType* iso1ChargingStatusResType) {
+	int errn = 0;
 	int grammarID = 144;
 	int done = 0;
 	
@@ -4419,11 +4508,8 @@ static int encode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1Char
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ChargingStatusResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1ChargingStatusResType->EVSEID.characters, iso1ChargingStatusResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, iso1ChargingStatusResType->EVSEID.characters, iso1ChargingStatusResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -4462,7 +4548,11 @@ static int encode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1Char
 			} else 			if ( iso1ChargingStatusResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso1MeterInfoType(stream, iso1ChargingStatusResType->MeterInfo );
+#else
 					errn = encode_iso1MeterInfoType(stream, &iso1ChargingStatusResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 149;
 			} else 			if ( iso1ChargingStatusResType->ReceiptRequired_isUsed == 1u ) {
@@ -4492,7 +4582,11 @@ static int encode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1Char
 			if ( iso1ChargingStatusResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso1MeterInfoType(stream, iso1ChargingStatusResType->MeterInfo );
+#else
 					errn = encode_iso1MeterInfoType(stream, &iso1ChargingStatusResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 149;
 			} else 			if ( iso1ChargingStatusResType->ReceiptRequired_isUsed == 1u ) {
@@ -4575,9 +4669,11 @@ static int encode_iso1ChargingStatusResType(bitstream_t* stream, struct iso1Char
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":P,"http://www.w3.org/2000/09/xmldsig#":Q){0-1},"http://www.w3.org/2000/09/xmldsig#":G{0-1},"http://www.w3.org/2000/09/xmldsig#":Y,"http://www.w3.org/2000/09/xmldsig#":J{0-1},("http://www.w3.org/2000/09/xmldsig#":Seed,"http://www.w3.org/2000/09/xmldsig#":PgenCounter){0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValueType* iso1DSAKeyValueType) {
+	int errn = 0;
 	int grammarID = 151;
 	int done = 0;
 	
@@ -4828,6 +4924,7 @@ static int encode_iso1DSAKeyValueType(bitstream_t* stream, struct iso1DSAKeyValu
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ListOfRootCertificateIDsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":RootCertificateID{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1ListOfRootCertificateIDsType(bitstream_t* stream, struct iso1ListOfRootCertificateIDsType* iso1ListOfRootCertificateIDsType) {
+	int errn = 0;
 	int grammarID = 158;
 	int done = 0;
 	
@@ -4878,6 +4975,7 @@ static int encode_iso1ListOfRootCertificateIDsType(bitstream_t* stream, struct i
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ChargeServiceType',  base type name='ServiceType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":ServiceID,"urn:iso:15118:2:2013:MsgDataTypes":ServiceName{0-1},"urn:iso:15118:2:2013:MsgDataTypes":ServiceCategory,"urn:iso:15118:2:2013:MsgDataTypes":ServiceScope{0-1},"urn:iso:15118:2:2013:MsgDataTypes":FreeService),("urn:iso:15118:2:2013:MsgDataTypes":SupportedEnergyTransferMode))',  derivedBy='EXTENSION'.  */
 static int encode_iso1ChargeServiceType(bitstream_t* stream, struct iso1ChargeServiceType* iso1ChargeServiceType) {
+	int errn = 0;
 	int grammarID = 160;
 	int done = 0;
 	
@@ -4910,11 +5008,8 @@ static int encode_iso1ChargeServiceType(bitstream_t* stream, struct iso1ChargeSe
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ChargeServiceType->ServiceName.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1ChargeServiceType->ServiceName.characters, iso1ChargeServiceType->ServiceName.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, iso1ChargeServiceType->ServiceName.characters, iso1ChargeServiceType->ServiceName.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -4962,11 +5057,8 @@ static int encode_iso1ChargeServiceType(bitstream_t* stream, struct iso1ChargeSe
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ChargeServiceType->ServiceScope.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1ChargeServiceType->ServiceScope.characters, iso1ChargeServiceType->ServiceScope.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, iso1ChargeServiceType->ServiceScope.characters, iso1ChargeServiceType->ServiceScope.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -5043,6 +5135,7 @@ static int encode_iso1ChargeServiceType(bitstream_t* stream, struct iso1ChargeSe
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,IntervalType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_iso1IntervalType(bitstream_t* stream, struct iso1IntervalType* iso1IntervalType) {
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -5073,7 +5166,9 @@ static int encode_iso1IntervalType(bitstream_t* stream, struct iso1IntervalType*
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,MeteringReceiptReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":SessionID,"urn:iso:15118:2:2013:MsgBody":SAScheduleTupleID{0-1},"urn:iso:15118:2:2013:MsgBody":MeterInfo)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 static int encode_iso1MeteringReceiptReqType(bitstream_t* stream, struct iso1MeteringReceiptReqType* iso1MeteringReceiptReqType) {
+	int errn = 0;
 	int grammarID = 166;
 	int done = 0;
 	
@@ -5085,11 +5180,8 @@ static int encode_iso1MeteringReceiptReqType(bitstream_t* stream, struct iso1Met
 			if ( iso1MeteringReceiptReqType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1MeteringReceiptReqType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1MeteringReceiptReqType->Id.characters, iso1MeteringReceiptReqType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 14 /* {urn:iso:15118:2:2013:MsgBody}Id */, iso1MeteringReceiptReqType->Id.characters, iso1MeteringReceiptReqType->Id.charactersLen);
 				}
 				grammarID = 167;
 			} else 			if ( 1 == 1 ) {
@@ -5190,9 +5282,12 @@ static int encode_iso1MeteringReceiptReqType(bitstream_t* stream, struct iso1Met
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ServiceDetailResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":ServiceID,"urn:iso:15118:2:2013:MsgBody":ServiceParameterList{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
 static int encode_iso1ServiceDetailResType(bitstream_t* stream, struct iso1ServiceDetailResType* iso1ServiceDetailResType) {
+	int errn = 0;
 	int grammarID = 170;
 	int done = 0;
 	
@@ -5275,9 +5370,11 @@ static int encode_iso1ServiceDetailResType(bitstream_t* stream, struct iso1Servi
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyValueType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":DSAKeyValue|"http://www.w3.org/2000/09/xmldsig#":RSAKeyValue|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))',  derivedBy='RESTRICTION'.  */
 static int encode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType* iso1KeyValueType) {
+	int errn = 0;
 	int grammarID = 173;
 	int done = 0;
 	int wcDone = 0;
@@ -5290,7 +5387,11 @@ static int encode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType*
 			if ( iso1KeyValueType->DSAKeyValue_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso1DSAKeyValueType(stream, iso1KeyValueType->DSAKeyValue );
+#else
 					errn = encode_iso1DSAKeyValueType(stream, &iso1KeyValueType->DSAKeyValue );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 174;
 			} else 			if ( iso1KeyValueType->RSAKeyValue_isUsed == 1u ) {
@@ -5305,11 +5406,8 @@ static int encode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType*
 			} else 			if ( iso1KeyValueType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyValueType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1KeyValueType->ANY.characters, iso1KeyValueType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, iso1KeyValueType->ANY.characters, iso1KeyValueType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 175;
@@ -5328,11 +5426,8 @@ static int encode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType*
 			} else 			if ( iso1KeyValueType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyValueType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1KeyValueType->ANY.characters, iso1KeyValueType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, iso1KeyValueType->ANY.characters, iso1KeyValueType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 174;
@@ -5345,7 +5440,11 @@ static int encode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType*
 			if ( iso1KeyValueType->DSAKeyValue_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso1DSAKeyValueType(stream, iso1KeyValueType->DSAKeyValue );
+#else
 					errn = encode_iso1DSAKeyValueType(stream, &iso1KeyValueType->DSAKeyValue );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 174;
 			} else 			if ( iso1KeyValueType->RSAKeyValue_isUsed == 1u ) {
@@ -5360,11 +5459,8 @@ static int encode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType*
 			} else 			if ( iso1KeyValueType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyValueType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1KeyValueType->ANY.characters, iso1KeyValueType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, iso1KeyValueType->ANY.characters, iso1KeyValueType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 175;
@@ -5385,6 +5481,7 @@ static int encode_iso1KeyValueType(bitstream_t* stream, struct iso1KeyValueType*
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SelectedServiceListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":SelectedService{1-16})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1SelectedServiceListType* iso1SelectedServiceListType) {
+	int errn = 0;
 	int grammarID = 176;
 	int done = 0;
 	
@@ -5698,7 +5795,9 @@ static int encode_iso1SelectedServiceListType(bitstream_t* stream, struct iso1Se
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CableCheckResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2013:MsgBody":EVSEProcessing)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
 static int encode_iso1CableCheckResType(bitstream_t* stream, struct iso1CableCheckResType* iso1CableCheckResType) {
+	int errn = 0;
 	int grammarID = 192;
 	int done = 0;
 	
@@ -5775,9 +5874,11 @@ static int encode_iso1CableCheckResType(bitstream_t* stream, struct iso1CableChe
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_CableCheckRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509IssuerSerialType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":X509IssuerName,"http://www.w3.org/2000/09/xmldsig#":X509SerialNumber)',  derivedBy='RESTRICTION'.  */
 static int encode_iso1X509IssuerSerialType(bitstream_t* stream, struct iso1X509IssuerSerialType* iso1X509IssuerSerialType) {
+	int errn = 0;
 	int grammarID = 194;
 	int done = 0;
 	
@@ -5792,11 +5893,8 @@ static int encode_iso1X509IssuerSerialType(bitstream_t* stream, struct iso1X509I
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1X509IssuerSerialType->X509IssuerName.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1X509IssuerSerialType->X509IssuerName.characters, iso1X509IssuerSerialType->X509IssuerName.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, iso1X509IssuerSerialType->X509IssuerName.characters, iso1X509IssuerSerialType->X509IssuerName.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -5850,6 +5948,7 @@ static int encode_iso1X509IssuerSerialType(bitstream_t* stream, struct iso1X509I
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyInfoType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":KeyName|"http://www.w3.org/2000/09/xmldsig#":KeyValue|"http://www.w3.org/2000/09/xmldsig#":RetrievalMethod|"http://www.w3.org/2000/09/xmldsig#":X509Data|"http://www.w3.org/2000/09/xmldsig#":PGPData|"http://www.w3.org/2000/09/xmldsig#":SPKIData|"http://www.w3.org/2000/09/xmldsig#":MgmtData|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* iso1KeyInfoType) {
+	int errn = 0;
 	int grammarID = 196;
 	int done = 0;
 	int wcDone = 0;
@@ -5869,11 +5968,8 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 			if ( iso1KeyInfoType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1KeyInfoType->Id.characters, iso1KeyInfoType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Id */, iso1KeyInfoType->Id.characters, iso1KeyInfoType->Id.charactersLen);
 				}
 				grammarID = 197;
 			} else 			if (iso1KeyInfoType_KeyName_currArrayIndex < iso1KeyInfoType->KeyName.arrayLen ) {
@@ -5882,10 +5978,9 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].characters, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].characters, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].charactersLen);
 							iso1KeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -5929,10 +6024,9 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].characters, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].characters, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							iso1KeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -5946,11 +6040,8 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 			} else 			if ( iso1KeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 9);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1KeyInfoType->ANY.characters, iso1KeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, iso1KeyInfoType->ANY.characters, iso1KeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 199;
@@ -5966,10 +6057,9 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].characters, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].characters, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].charactersLen);
 							iso1KeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -6013,10 +6103,9 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].characters, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].characters, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							iso1KeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -6030,11 +6119,8 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 			} else 			if ( iso1KeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 8);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1KeyInfoType->ANY.characters, iso1KeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, iso1KeyInfoType->ANY.characters, iso1KeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 199;
@@ -6050,10 +6136,9 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].characters, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].characters, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].charactersLen);
 							iso1KeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -6097,10 +6182,9 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].characters, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].characters, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							iso1KeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -6120,11 +6204,8 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 			} else 			if ( iso1KeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 9);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1KeyInfoType->ANY.characters, iso1KeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, iso1KeyInfoType->ANY.characters, iso1KeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 198;
@@ -6140,10 +6221,9 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].characters, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].characters, iso1KeyInfoType->KeyName.array[iso1KeyInfoType_KeyName_currArrayIndex].charactersLen);
 							iso1KeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -6187,10 +6267,9 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].characters, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].characters, iso1KeyInfoType->MgmtData.array[iso1KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							iso1KeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -6204,11 +6283,8 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 			} else 			if ( iso1KeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 8);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1KeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1KeyInfoType->ANY.characters, iso1KeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, iso1KeyInfoType->ANY.characters, iso1KeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 199;
@@ -6229,6 +6305,7 @@ static int encode_iso1KeyInfoType(bitstream_t* stream, struct iso1KeyInfoType* i
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transform{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1TransformsType(bitstream_t* stream, struct iso1TransformsType* iso1TransformsType) {
+	int errn = 0;
 	int grammarID = 200;
 	int done = 0;
 	
@@ -6278,7 +6355,9 @@ static int encode_iso1TransformsType(bitstream_t* stream, struct iso1TransformsT
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ChargeParameterDiscoveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":MaxEntriesSAScheduleTuple{0-1},"urn:iso:15118:2:2013:MsgBody":RequestedEnergyTransferMode,"urn:iso:15118:2:2013:MsgDataTypes":EVChargeParameter)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 static int encode_iso1ChargeParameterDiscoveryReqType(bitstream_t* stream, struct iso1ChargeParameterDiscoveryReqType* iso1ChargeParameterDiscoveryReqType) {
+	int errn = 0;
 	int grammarID = 202;
 	int done = 0;
 	
@@ -6379,9 +6458,12 @@ static int encode_iso1ChargeParameterDiscoveryReqType(bitstream_t* stream, struc
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PreChargeReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":DC_EVStatus,"urn:iso:15118:2:2013:MsgBody":EVTargetVoltage,"urn:iso:15118:2:2013:MsgBody":EVTargetCurrent)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
 static int encode_iso1PreChargeReqType(bitstream_t* stream, struct iso1PreChargeReqType* iso1PreChargeReqType) {
+	int errn = 0;
 	int grammarID = 205;
 	int done = 0;
 	
@@ -6446,9 +6528,11 @@ static int encode_iso1PreChargeReqType(bitstream_t* stream, struct iso1PreCharge
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_PreChargeReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EVSEStatusType',  base type name='anyType',  content type='ELEMENT',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":NotificationMaxDelay,"urn:iso:15118:2:2013:MsgDataTypes":EVSENotification)',  derivedBy='RESTRICTION'.  */
 static int encode_iso1EVSEStatusType(bitstream_t* stream, struct iso1EVSEStatusType* iso1EVSEStatusType) {
+	int errn = 0;
 	int grammarID = 208;
 	int done = 0;
 	
@@ -6516,6 +6600,7 @@ static int encode_iso1EVSEStatusType(bitstream_t* stream, struct iso1EVSEStatusT
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":HMACOutputLength{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1SignatureMethodType(bitstream_t* stream, struct iso1SignatureMethodType* iso1SignatureMethodType) {
+	int errn = 0;
 	int grammarID = 210;
 	int done = 0;
 	int wcDone = 0;
@@ -6528,11 +6613,8 @@ static int encode_iso1SignatureMethodType(bitstream_t* stream, struct iso1Signat
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignatureMethodType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignatureMethodType->Algorithm.characters, iso1SignatureMethodType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Algorithm */, iso1SignatureMethodType->Algorithm.characters, iso1SignatureMethodType->Algorithm.charactersLen);
 				}
 				grammarID = 211;
 			} else {
@@ -6565,11 +6647,8 @@ static int encode_iso1SignatureMethodType(bitstream_t* stream, struct iso1Signat
 			} else 			if ( iso1SignatureMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignatureMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 212;
@@ -6591,11 +6670,8 @@ static int encode_iso1SignatureMethodType(bitstream_t* stream, struct iso1Signat
 			} else 			if ( iso1SignatureMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignatureMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 116;
@@ -6629,11 +6705,8 @@ static int encode_iso1SignatureMethodType(bitstream_t* stream, struct iso1Signat
 			} else 			if ( iso1SignatureMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignatureMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, iso1SignatureMethodType->ANY.characters, iso1SignatureMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 212;
@@ -6654,6 +6727,7 @@ static int encode_iso1SignatureMethodType(bitstream_t* stream, struct iso1Signat
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509DataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":X509IssuerSerial|"http://www.w3.org/2000/09/xmldsig#":X509SKI|"http://www.w3.org/2000/09/xmldsig#":X509SubjectName|"http://www.w3.org/2000/09/xmldsig#":X509Certificate|"http://www.w3.org/2000/09/xmldsig#":X509CRL|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType* iso1X509DataType) {
+	int errn = 0;
 	int grammarID = 213;
 	int done = 0;
 	int wcDone = 0;
@@ -6696,10 +6770,9 @@ static int encode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType*
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1X509DataType->X509SubjectName.array[iso1X509DataType_X509SubjectName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, iso1X509DataType->X509SubjectName.array[iso1X509DataType_X509SubjectName_currArrayIndex].characters, iso1X509DataType->X509SubjectName.array[iso1X509DataType_X509SubjectName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1X509DataType->X509SubjectName.array[iso1X509DataType_X509SubjectName_currArrayIndex].characters, iso1X509DataType->X509SubjectName.array[iso1X509DataType_X509SubjectName_currArrayIndex].charactersLen);
 							iso1X509DataType_X509SubjectName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -6776,10 +6849,9 @@ static int encode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType*
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1X509DataType->X509SubjectName.array[iso1X509DataType_X509SubjectName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, iso1X509DataType->X509SubjectName.array[iso1X509DataType_X509SubjectName_currArrayIndex].characters, iso1X509DataType->X509SubjectName.array[iso1X509DataType_X509SubjectName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1X509DataType->X509SubjectName.array[iso1X509DataType_X509SubjectName_currArrayIndex].characters, iso1X509DataType->X509SubjectName.array[iso1X509DataType_X509SubjectName_currArrayIndex].charactersLen);
 							iso1X509DataType_X509SubjectName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -6845,6 +6917,7 @@ static int encode_iso1X509DataType(bitstream_t* stream, struct iso1X509DataType*
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,NotificationType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":FaultCode,"urn:iso:15118:2:2013:MsgDataTypes":FaultMsg{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1NotificationType(bitstream_t* stream, struct iso1NotificationType* iso1NotificationType) {
+	int errn = 0;
 	int grammarID = 215;
 	int done = 0;
 	
@@ -6877,11 +6950,8 @@ static int encode_iso1NotificationType(bitstream_t* stream, struct iso1Notificat
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1NotificationType->FaultMsg.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1NotificationType->FaultMsg.characters, iso1NotificationType->FaultMsg.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 17 /* {urn:iso:15118:2:2013:MsgDataTypes}FaultMsg */, iso1NotificationType->FaultMsg.characters, iso1NotificationType->FaultMsg.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -6922,6 +6992,7 @@ static int encode_iso1NotificationType(bitstream_t* stream, struct iso1Notificat
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SAScheduleListType',  base type name='SASchedulesType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":SAScheduleTuple{1-3})',  derivedBy='EXTENSION'.  */
 static int encode_iso1SAScheduleListType(bitstream_t* stream, struct iso1SAScheduleListType* iso1SAScheduleListType) {
+	int errn = 0;
 	int grammarID = 217;
 	int done = 0;
 	
@@ -7002,6 +7073,7 @@ static int encode_iso1SAScheduleListType(bitstream_t* stream, struct iso1SASched
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,BodyType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":BodyElement{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1BodyType(bitstream_t* stream, struct iso1BodyType* iso1BodyType) {
+	int errn = 0;
 	int grammarID = 220;
 	int done = 0;
 	
@@ -7011,215 +7083,355 @@ static int encode_iso1BodyType(bitstream_t* stream, struct iso1BodyType* iso1Bod
 		case 220:
 			/* FirstStartTag[START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}BodyElement), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionRes), END_ELEMENT] */
 			if ( iso1BodyType->AuthorizationReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 0);
 				if(errn == 0) {
 					errn = encode_iso1AuthorizationReqType(stream, &iso1BodyType->AuthorizationReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AuthorizationReq */
 			} else 			if ( iso1BodyType->AuthorizationRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 1);
 				if(errn == 0) {
 					errn = encode_iso1AuthorizationResType(stream, &iso1BodyType->AuthorizationRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AuthorizationRes */
 			} else 			if ( iso1BodyType->BodyElement_isUsed == 1u ) {
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 2);
 				if(errn == 0) {
 					errn = encode_iso1BodyBaseType(stream, &iso1BodyType->BodyElement );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_BodyElement */
 			} else 			if ( iso1BodyType->CableCheckReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 3);
 				if(errn == 0) {
 					errn = encode_iso1CableCheckReqType(stream, &iso1BodyType->CableCheckReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CableCheckReq */
 			} else 			if ( iso1BodyType->CableCheckRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 4);
 				if(errn == 0) {
 					errn = encode_iso1CableCheckResType(stream, &iso1BodyType->CableCheckRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CableCheckRes */
 			} else 			if ( iso1BodyType->CertificateInstallationReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 5);
 				if(errn == 0) {
 					errn = encode_iso1CertificateInstallationReqType(stream, &iso1BodyType->CertificateInstallationReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
 			} else 			if ( iso1BodyType->CertificateInstallationRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 6);
 				if(errn == 0) {
 					errn = encode_iso1CertificateInstallationResType(stream, &iso1BodyType->CertificateInstallationRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
 			} else 			if ( iso1BodyType->CertificateUpdateReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 7);
 				if(errn == 0) {
 					errn = encode_iso1CertificateUpdateReqType(stream, &iso1BodyType->CertificateUpdateReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
 			} else 			if ( iso1BodyType->CertificateUpdateRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 8);
 				if(errn == 0) {
 					errn = encode_iso1CertificateUpdateResType(stream, &iso1BodyType->CertificateUpdateRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
 			} else 			if ( iso1BodyType->ChargeParameterDiscoveryReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 9);
 				if(errn == 0) {
 					errn = encode_iso1ChargeParameterDiscoveryReqType(stream, &iso1BodyType->ChargeParameterDiscoveryReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
 			} else 			if ( iso1BodyType->ChargeParameterDiscoveryRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 10);
 				if(errn == 0) {
 					errn = encode_iso1ChargeParameterDiscoveryResType(stream, &iso1BodyType->ChargeParameterDiscoveryRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
 			} else 			if ( iso1BodyType->ChargingStatusReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 11);
 				if(errn == 0) {
 					errn = encode_iso1ChargingStatusReqType(stream, &iso1BodyType->ChargingStatusReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
 			} else 			if ( iso1BodyType->ChargingStatusRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 12);
 				if(errn == 0) {
 					errn = encode_iso1ChargingStatusResType(stream, &iso1BodyType->ChargingStatusRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
 			} else 			if ( iso1BodyType->CurrentDemandReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 13);
 				if(errn == 0) {
 					errn = encode_iso1CurrentDemandReqType(stream, &iso1BodyType->CurrentDemandReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
 			} else 			if ( iso1BodyType->CurrentDemandRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 14);
 				if(errn == 0) {
 					errn = encode_iso1CurrentDemandResType(stream, &iso1BodyType->CurrentDemandRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
 			} else 			if ( iso1BodyType->MeteringReceiptReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 15);
 				if(errn == 0) {
 					errn = encode_iso1MeteringReceiptReqType(stream, &iso1BodyType->MeteringReceiptReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
 			} else 			if ( iso1BodyType->MeteringReceiptRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 16);
 				if(errn == 0) {
 					errn = encode_iso1MeteringReceiptResType(stream, &iso1BodyType->MeteringReceiptRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
 			} else 			if ( iso1BodyType->PaymentDetailsReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 17);
 				if(errn == 0) {
 					errn = encode_iso1PaymentDetailsReqType(stream, &iso1BodyType->PaymentDetailsReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
 			} else 			if ( iso1BodyType->PaymentDetailsRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 18);
 				if(errn == 0) {
 					errn = encode_iso1PaymentDetailsResType(stream, &iso1BodyType->PaymentDetailsRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
 			} else 			if ( iso1BodyType->PaymentServiceSelectionReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 19);
 				if(errn == 0) {
 					errn = encode_iso1PaymentServiceSelectionReqType(stream, &iso1BodyType->PaymentServiceSelectionReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
 			} else 			if ( iso1BodyType->PaymentServiceSelectionRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 20);
 				if(errn == 0) {
 					errn = encode_iso1PaymentServiceSelectionResType(stream, &iso1BodyType->PaymentServiceSelectionRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
 			} else 			if ( iso1BodyType->PowerDeliveryReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 21);
 				if(errn == 0) {
 					errn = encode_iso1PowerDeliveryReqType(stream, &iso1BodyType->PowerDeliveryReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
 			} else 			if ( iso1BodyType->PowerDeliveryRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 22);
 				if(errn == 0) {
 					errn = encode_iso1PowerDeliveryResType(stream, &iso1BodyType->PowerDeliveryRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
 			} else 			if ( iso1BodyType->PreChargeReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 23);
 				if(errn == 0) {
 					errn = encode_iso1PreChargeReqType(stream, &iso1BodyType->PreChargeReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PreChargeReq */
 			} else 			if ( iso1BodyType->PreChargeRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 24);
 				if(errn == 0) {
 					errn = encode_iso1PreChargeResType(stream, &iso1BodyType->PreChargeRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PreChargeRes */
 			} else 			if ( iso1BodyType->ServiceDetailReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 25);
 				if(errn == 0) {
 					errn = encode_iso1ServiceDetailReqType(stream, &iso1BodyType->ServiceDetailReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
 			} else 			if ( iso1BodyType->ServiceDetailRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 26);
 				if(errn == 0) {
 					errn = encode_iso1ServiceDetailResType(stream, &iso1BodyType->ServiceDetailRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
 			} else 			if ( iso1BodyType->ServiceDiscoveryReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 27);
 				if(errn == 0) {
 					errn = encode_iso1ServiceDiscoveryReqType(stream, &iso1BodyType->ServiceDiscoveryReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
 			} else 			if ( iso1BodyType->ServiceDiscoveryRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 28);
 				if(errn == 0) {
 					errn = encode_iso1ServiceDiscoveryResType(stream, &iso1BodyType->ServiceDiscoveryRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
 			} else 			if ( iso1BodyType->SessionSetupReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 29);
 				if(errn == 0) {
 					errn = encode_iso1SessionSetupReqType(stream, &iso1BodyType->SessionSetupReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SessionSetupReq */
 			} else 			if ( iso1BodyType->SessionSetupRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 30);
 				if(errn == 0) {
 					errn = encode_iso1SessionSetupResType(stream, &iso1BodyType->SessionSetupRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SessionSetupRes */
 			} else 			if ( iso1BodyType->SessionStopReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 31);
 				if(errn == 0) {
 					errn = encode_iso1SessionStopReqType(stream, &iso1BodyType->SessionStopReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SessionStopReq */
 			} else 			if ( iso1BodyType->SessionStopRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 32);
 				if(errn == 0) {
 					errn = encode_iso1SessionStopResType(stream, &iso1BodyType->SessionStopRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SessionStopRes */
 			} else 			if ( iso1BodyType->WeldingDetectionReq_isUsed == 1u ) {
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 33);
 				if(errn == 0) {
 					errn = encode_iso1WeldingDetectionReqType(stream, &iso1BodyType->WeldingDetectionReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
 			} else 			if ( iso1BodyType->WeldingDetectionRes_isUsed == 1u ) {
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 34);
 				if(errn == 0) {
 					errn = encode_iso1WeldingDetectionResType(stream, &iso1BodyType->WeldingDetectionRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
 			} else 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 6, 35);
 				if(errn == 0) {
@@ -7255,6 +7467,7 @@ static int encode_iso1BodyType(bitstream_t* stream, struct iso1BodyType* iso1Bod
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ChargingProfileType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ProfileEntry{1-24})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1ChargingProfileType(bitstream_t* stream, struct iso1ChargingProfileType* iso1ChargingProfileType) {
+	int errn = 0;
 	int grammarID = 221;
 	int done = 0;
 	
@@ -7713,6 +7926,7 @@ static int encode_iso1ChargingProfileType(bitstream_t* stream, struct iso1Chargi
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])|"http://www.w3.org/2000/09/xmldsig#":XPath){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_iso1TransformType(bitstream_t* stream, struct iso1TransformType* iso1TransformType) {
+	int errn = 0;
 	int grammarID = 245;
 	int done = 0;
 	int wcDone = 0;
@@ -7726,11 +7940,8 @@ static int encode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1TransformType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1TransformType->Algorithm.characters, iso1TransformType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Algorithm */, iso1TransformType->Algorithm.characters, iso1TransformType->Algorithm.charactersLen);
 				}
 				grammarID = 246;
 			} else {
@@ -7745,10 +7956,9 @@ static int encode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1TransformType->XPath.array[iso1TransformType_XPath_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, iso1TransformType->XPath.array[iso1TransformType_XPath_currArrayIndex].characters, iso1TransformType->XPath.array[iso1TransformType_XPath_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1TransformType->XPath.array[iso1TransformType_XPath_currArrayIndex].characters, iso1TransformType->XPath.array[iso1TransformType_XPath_currArrayIndex].charactersLen);
 							iso1TransformType_XPath_currArrayIndex++;
 						}
 						/* valid EE */
@@ -7768,11 +7978,8 @@ static int encode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 			} else 			if ( iso1TransformType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1TransformType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1TransformType->ANY.characters, iso1TransformType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, iso1TransformType->ANY.characters, iso1TransformType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 247;
@@ -7788,10 +7995,9 @@ static int encode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1TransformType->XPath.array[iso1TransformType_XPath_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, iso1TransformType->XPath.array[iso1TransformType_XPath_currArrayIndex].characters, iso1TransformType->XPath.array[iso1TransformType_XPath_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1TransformType->XPath.array[iso1TransformType_XPath_currArrayIndex].characters, iso1TransformType->XPath.array[iso1TransformType_XPath_currArrayIndex].charactersLen);
 							iso1TransformType_XPath_currArrayIndex++;
 						}
 						/* valid EE */
@@ -7811,11 +8017,8 @@ static int encode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 			} else 			if ( iso1TransformType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1TransformType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1TransformType->ANY.characters, iso1TransformType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, iso1TransformType->ANY.characters, iso1TransformType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 247;
@@ -7836,6 +8039,7 @@ static int encode_iso1TransformType(bitstream_t* stream, struct iso1TransformTyp
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SAScheduleTupleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":SAScheduleTupleID,"urn:iso:15118:2:2013:MsgDataTypes":PMaxSchedule,"urn:iso:15118:2:2013:MsgDataTypes":SalesTariff{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1SAScheduleTupleType(bitstream_t* stream, struct iso1SAScheduleTupleType* iso1SAScheduleTupleType) {
+	int errn = 0;
 	int grammarID = 248;
 	int done = 0;
 	
@@ -7915,6 +8119,7 @@ static int encode_iso1SAScheduleTupleType(bitstream_t* stream, struct iso1SASche
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,AC_EVChargeParameterType',  base type name='EVChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":DepartureTime{0-1}),("urn:iso:15118:2:2013:MsgDataTypes":EAmount,"urn:iso:15118:2:2013:MsgDataTypes":EVMaxVoltage,"urn:iso:15118:2:2013:MsgDataTypes":EVMaxCurrent,"urn:iso:15118:2:2013:MsgDataTypes":EVMinCurrent))',  derivedBy='EXTENSION'.  */
 static int encode_iso1AC_EVChargeParameterType(bitstream_t* stream, struct iso1AC_EVChargeParameterType* iso1AC_EVChargeParameterType) {
+	int errn = 0;
 	int grammarID = 251;
 	int done = 0;
 	
@@ -8018,6 +8223,7 @@ static int encode_iso1AC_EVChargeParameterType(bitstream_t* stream, struct iso1A
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDef,#AnonType_V2G_Message',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDef":Header,"urn:iso:15118:2:2013:MsgDef":Body)',  derivedBy='RESTRICTION'.  */
 static int encode_iso1AnonType_V2G_Message(bitstream_t* stream, struct iso1AnonType_V2G_Message* iso1AnonType_V2G_Message) {
+	int errn = 0;
 	int grammarID = 256;
 	int done = 0;
 	
@@ -8072,7 +8278,9 @@ static int encode_iso1AnonType_V2G_Message(bitstream_t* stream, struct iso1AnonT
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PaymentDetailsResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":GenChallenge,"urn:iso:15118:2:2013:MsgBody":EVSETimeStamp)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 static int encode_iso1PaymentDetailsResType(bitstream_t* stream, struct iso1PaymentDetailsResType* iso1PaymentDetailsResType) {
+	int errn = 0;
 	int grammarID = 258;
 	int done = 0;
 	
@@ -8158,9 +8366,11 @@ static int encode_iso1PaymentDetailsResType(bitstream_t* stream, struct iso1Paym
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ContractSignatureEncryptedPrivateKeyType',  base type name='privateKeyType',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 static int encode_iso1ContractSignatureEncryptedPrivateKeyType(bitstream_t* stream, struct iso1ContractSignatureEncryptedPrivateKeyType* iso1ContractSignatureEncryptedPrivateKeyType) {
+	int errn = 0;
 	int grammarID = 23;
 	int done = 0;
 	
@@ -8172,11 +8382,8 @@ static int encode_iso1ContractSignatureEncryptedPrivateKeyType(bitstream_t* stre
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ContractSignatureEncryptedPrivateKeyType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ContractSignatureEncryptedPrivateKeyType->Id.characters, iso1ContractSignatureEncryptedPrivateKeyType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, iso1ContractSignatureEncryptedPrivateKeyType->Id.characters, iso1ContractSignatureEncryptedPrivateKeyType->Id.charactersLen);
 				}
 				grammarID = 24;
 			} else {
@@ -8223,6 +8430,7 @@ static int encode_iso1ContractSignatureEncryptedPrivateKeyType(bitstream_t* stre
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,PMaxScheduleEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":TimeInterval),("urn:iso:15118:2:2013:MsgDataTypes":PMax))',  derivedBy='EXTENSION'.  */
 static int encode_iso1PMaxScheduleEntryType(bitstream_t* stream, struct iso1PMaxScheduleEntryType* iso1PMaxScheduleEntryType) {
+	int errn = 0;
 	int grammarID = 261;
 	int done = 0;
 	
@@ -8284,6 +8492,7 @@ static int encode_iso1PMaxScheduleEntryType(bitstream_t* stream, struct iso1PMax
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SPKIDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SPKISexp,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-1}){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_iso1SPKIDataType(bitstream_t* stream, struct iso1SPKIDataType* iso1SPKIDataType) {
+	int errn = 0;
 	int grammarID = 263;
 	int done = 0;
 	int wcDone = 0;
@@ -8385,7 +8594,9 @@ static int encode_iso1SPKIDataType(bitstream_t* stream, struct iso1SPKIDataType*
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,MeteringReceiptResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgDataTypes":EVSEStatus)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 static int encode_iso1MeteringReceiptResType(bitstream_t* stream, struct iso1MeteringReceiptResType* iso1MeteringReceiptResType) {
+	int errn = 0;
 	int grammarID = 93;
 	int done = 0;
 	
@@ -8456,9 +8667,12 @@ static int encode_iso1MeteringReceiptResType(bitstream_t* stream, struct iso1Met
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,SessionStopReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ChargingSession)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
 static int encode_iso1SessionStopReqType(bitstream_t* stream, struct iso1SessionStopReqType* iso1SessionStopReqType) {
+	int errn = 0;
 	int grammarID = 266;
 	int done = 0;
 	
@@ -8505,9 +8719,12 @@ static int encode_iso1SessionStopReqType(bitstream_t* stream, struct iso1Session
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_SessionStopReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,WeldingDetectionResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2013:MsgBody":EVSEPresentVoltage)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 static int encode_iso1WeldingDetectionResType(bitstream_t* stream, struct iso1WeldingDetectionResType* iso1WeldingDetectionResType) {
+	int errn = 0;
 	int grammarID = 39;
 	int done = 0;
 	
@@ -8578,9 +8795,11 @@ static int encode_iso1WeldingDetectionResType(bitstream_t* stream, struct iso1We
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
 static int encode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceType* iso1ReferenceType) {
+	int errn = 0;
 	int grammarID = 267;
 	int done = 0;
 	
@@ -8592,31 +8811,22 @@ static int encode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceTyp
 			if ( iso1ReferenceType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ReferenceType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ReferenceType->Id.characters, iso1ReferenceType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Id */, iso1ReferenceType->Id.characters, iso1ReferenceType->Id.charactersLen);
 				}
 				grammarID = 268;
 			} else 			if ( iso1ReferenceType->Type_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ReferenceType->Type.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ReferenceType->Type.characters, iso1ReferenceType->Type.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 30 /* {}Type */, iso1ReferenceType->Type.characters, iso1ReferenceType->Type.charactersLen);
 				}
 				grammarID = 269;
 			} else 			if ( iso1ReferenceType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ReferenceType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ReferenceType->URI.characters, iso1ReferenceType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 31 /* {}URI */, iso1ReferenceType->URI.characters, iso1ReferenceType->URI.charactersLen);
 				}
 				grammarID = 270;
 			} else 			if ( iso1ReferenceType->Transforms_isUsed == 1u ) {
@@ -8640,21 +8850,15 @@ static int encode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceTyp
 			if ( iso1ReferenceType->Type_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ReferenceType->Type.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ReferenceType->Type.characters, iso1ReferenceType->Type.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 30 /* {}Type */, iso1ReferenceType->Type.characters, iso1ReferenceType->Type.charactersLen);
 				}
 				grammarID = 269;
 			} else 			if ( iso1ReferenceType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ReferenceType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ReferenceType->URI.characters, iso1ReferenceType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 31 /* {}URI */, iso1ReferenceType->URI.characters, iso1ReferenceType->URI.charactersLen);
 				}
 				grammarID = 270;
 			} else 			if ( iso1ReferenceType->Transforms_isUsed == 1u ) {
@@ -8678,11 +8882,8 @@ static int encode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceTyp
 			if ( iso1ReferenceType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ReferenceType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1ReferenceType->URI.characters, iso1ReferenceType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 31 /* {}URI */, iso1ReferenceType->URI.characters, iso1ReferenceType->URI.charactersLen);
 				}
 				grammarID = 270;
 			} else 			if ( iso1ReferenceType->Transforms_isUsed == 1u ) {
@@ -8776,7 +8977,9 @@ static int encode_iso1ReferenceType(bitstream_t* stream, struct iso1ReferenceTyp
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CurrentDemandReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":DC_EVStatus,"urn:iso:15118:2:2013:MsgBody":EVTargetCurrent,"urn:iso:15118:2:2013:MsgBody":EVMaximumVoltageLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVMaximumCurrentLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVMaximumPowerLimit{0-1},"urn:iso:15118:2:2013:MsgBody":BulkChargingComplete{0-1},"urn:iso:15118:2:2013:MsgBody":ChargingComplete,"urn:iso:15118:2:2013:MsgBody":RemainingTimeToFullSoC{0-1},"urn:iso:15118:2:2013:MsgBody":RemainingTimeToBulkSoC{0-1},"urn:iso:15118:2:2013:MsgBody":EVTargetVoltage)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
 static int encode_iso1CurrentDemandReqType(bitstream_t* stream, struct iso1CurrentDemandReqType* iso1CurrentDemandReqType) {
+	int errn = 0;
 	int grammarID = 273;
 	int done = 0;
 	
@@ -9057,9 +9260,11 @@ static int encode_iso1CurrentDemandReqType(bitstream_t* stream, struct iso1Curre
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SalesTariffEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":TimeInterval),("urn:iso:15118:2:2013:MsgDataTypes":EPriceLevel{0-1},"urn:iso:15118:2:2013:MsgDataTypes":ConsumptionCost{0-3}))',  derivedBy='EXTENSION'.  */
 static int encode_iso1SalesTariffEntryType(bitstream_t* stream, struct iso1SalesTariffEntryType* iso1SalesTariffEntryType) {
+	int errn = 0;
 	int grammarID = 283;
 	int done = 0;
 	
@@ -9193,7 +9398,9 @@ static int encode_iso1SalesTariffEntryType(bitstream_t* stream, struct iso1Sales
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,EntryType',  base type name='anyType',  content type='ELEMENT',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":TimeInterval)',  derivedBy='RESTRICTION'.  */
+#if ISO1_DEPLOY_Entry == SUPPORT_YES
 static int encode_iso1EntryType(bitstream_t* stream, struct iso1EntryType* iso1EntryType) {
+	int errn = 0;
 	int grammarID = 288;
 	int done = 0;
 	
@@ -9240,9 +9447,12 @@ static int encode_iso1EntryType(bitstream_t* stream, struct iso1EntryType* iso1E
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_Entry */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,SessionSetupReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":EVCCID)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
 static int encode_iso1SessionSetupReqType(bitstream_t* stream, struct iso1SessionSetupReqType* iso1SessionSetupReqType) {
+	int errn = 0;
 	int grammarID = 289;
 	int done = 0;
 	
@@ -9292,9 +9502,11 @@ static int encode_iso1SessionSetupReqType(bitstream_t* stream, struct iso1Sessio
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_SessionSetupReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,CostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":costKind,"urn:iso:15118:2:2013:MsgDataTypes":amount,"urn:iso:15118:2:2013:MsgDataTypes":amountMultiplier{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1CostType(bitstream_t* stream, struct iso1CostType* iso1CostType) {
+	int errn = 0;
 	int grammarID = 290;
 	int done = 0;
 	
@@ -9386,6 +9598,7 @@ static int encode_iso1CostType(bitstream_t* stream, struct iso1CostType* iso1Cos
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DC_EVPowerDeliveryParameterType',  base type name='EVPowerDeliveryParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":DC_EVStatus,"urn:iso:15118:2:2013:MsgDataTypes":BulkChargingComplete{0-1},"urn:iso:15118:2:2013:MsgDataTypes":ChargingComplete)',  derivedBy='EXTENSION'.  */
 static int encode_iso1DC_EVPowerDeliveryParameterType(bitstream_t* stream, struct iso1DC_EVPowerDeliveryParameterType* iso1DC_EVPowerDeliveryParameterType) {
+	int errn = 0;
 	int grammarID = 293;
 	int done = 0;
 	
@@ -9477,6 +9690,7 @@ static int encode_iso1DC_EVPowerDeliveryParameterType(bitstream_t* stream, struc
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RetrievalMethodType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1RetrievalMethodType(bitstream_t* stream, struct iso1RetrievalMethodType* iso1RetrievalMethodType) {
+	int errn = 0;
 	int grammarID = 296;
 	int done = 0;
 	
@@ -9488,21 +9702,15 @@ static int encode_iso1RetrievalMethodType(bitstream_t* stream, struct iso1Retrie
 			if ( iso1RetrievalMethodType->Type_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1RetrievalMethodType->Type.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1RetrievalMethodType->Type.characters, iso1RetrievalMethodType->Type.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 30 /* {}Type */, iso1RetrievalMethodType->Type.characters, iso1RetrievalMethodType->Type.charactersLen);
 				}
 				grammarID = 297;
 			} else 			if ( iso1RetrievalMethodType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1RetrievalMethodType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1RetrievalMethodType->URI.characters, iso1RetrievalMethodType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 31 /* {}URI */, iso1RetrievalMethodType->URI.characters, iso1RetrievalMethodType->URI.charactersLen);
 				}
 				grammarID = 298;
 			} else 			if ( iso1RetrievalMethodType->Transforms_isUsed == 1u ) {
@@ -9526,11 +9734,8 @@ static int encode_iso1RetrievalMethodType(bitstream_t* stream, struct iso1Retrie
 			if ( iso1RetrievalMethodType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1RetrievalMethodType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1RetrievalMethodType->URI.characters, iso1RetrievalMethodType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 31 /* {}URI */, iso1RetrievalMethodType->URI.characters, iso1RetrievalMethodType->URI.charactersLen);
 				}
 				grammarID = 298;
 			} else 			if ( iso1RetrievalMethodType->Transforms_isUsed == 1u ) {
@@ -9591,7 +9796,9 @@ static int encode_iso1RetrievalMethodType(bitstream_t* stream, struct iso1Retrie
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CertificateUpdateResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":SAProvisioningCertificateChain,"urn:iso:15118:2:2013:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2013:MsgBody":ContractSignatureEncryptedPrivateKey,"urn:iso:15118:2:2013:MsgBody":DHpublickey,"urn:iso:15118:2:2013:MsgBody":eMAID,"urn:iso:15118:2:2013:MsgBody":RetryCounter{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 static int encode_iso1CertificateUpdateResType(bitstream_t* stream, struct iso1CertificateUpdateResType* iso1CertificateUpdateResType) {
+	int errn = 0;
 	int grammarID = 299;
 	int done = 0;
 	
@@ -9722,9 +9929,12 @@ static int encode_iso1CertificateUpdateResType(bitstream_t* stream, struct iso1C
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CertificateInstallationResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":SAProvisioningCertificateChain,"urn:iso:15118:2:2013:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2013:MsgBody":ContractSignatureEncryptedPrivateKey,"urn:iso:15118:2:2013:MsgBody":DHpublickey,"urn:iso:15118:2:2013:MsgBody":eMAID)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 static int encode_iso1CertificateInstallationResType(bitstream_t* stream, struct iso1CertificateInstallationResType* iso1CertificateInstallationResType) {
+	int errn = 0;
 	int grammarID = 306;
 	int done = 0;
 	
@@ -9831,9 +10041,11 @@ static int encode_iso1CertificateInstallationResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,CanonicalizationMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso1CanonicalizationMethodType* iso1CanonicalizationMethodType) {
+	int errn = 0;
 	int grammarID = 312;
 	int done = 0;
 	int wcDone = 0;
@@ -9846,11 +10058,8 @@ static int encode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1CanonicalizationMethodType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1CanonicalizationMethodType->Algorithm.characters, iso1CanonicalizationMethodType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Algorithm */, iso1CanonicalizationMethodType->Algorithm.characters, iso1CanonicalizationMethodType->Algorithm.charactersLen);
 				}
 				grammarID = 115;
 			} else {
@@ -9871,11 +10080,8 @@ static int encode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso
 			} else 			if ( iso1CanonicalizationMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1CanonicalizationMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1CanonicalizationMethodType->ANY.characters, iso1CanonicalizationMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, iso1CanonicalizationMethodType->ANY.characters, iso1CanonicalizationMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 116;
@@ -9897,11 +10103,8 @@ static int encode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso
 			} else 			if ( iso1CanonicalizationMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1CanonicalizationMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1CanonicalizationMethodType->ANY.characters, iso1CanonicalizationMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, iso1CanonicalizationMethodType->ANY.characters, iso1CanonicalizationMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 116;
@@ -9921,7 +10124,9 @@ static int encode_iso1CanonicalizationMethodType(bitstream_t* stream, struct iso
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,WeldingDetectionReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":DC_EVStatus)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 static int encode_iso1WeldingDetectionReqType(bitstream_t* stream, struct iso1WeldingDetectionReqType* iso1WeldingDetectionReqType) {
+	int errn = 0;
 	int grammarID = 313;
 	int done = 0;
 	
@@ -9962,9 +10167,11 @@ static int encode_iso1WeldingDetectionReqType(bitstream_t* stream, struct iso1We
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,DC_EVStatusType',  base type name='EVStatusType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":EVReady,"urn:iso:15118:2:2013:MsgDataTypes":EVErrorCode,"urn:iso:15118:2:2013:MsgDataTypes":EVRESSSOC)',  derivedBy='EXTENSION'.  */
 static int encode_iso1DC_EVStatusType(bitstream_t* stream, struct iso1DC_EVStatusType* iso1DC_EVStatusType) {
+	int errn = 0;
 	int grammarID = 314;
 	int done = 0;
 	
@@ -10049,7 +10256,9 @@ static int encode_iso1DC_EVStatusType(bitstream_t* stream, struct iso1DC_EVStatu
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CurrentDemandResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode,"urn:iso:15118:2:2013:MsgBody":DC_EVSEStatus,"urn:iso:15118:2:2013:MsgBody":EVSEPresentVoltage,"urn:iso:15118:2:2013:MsgBody":EVSEPresentCurrent,"urn:iso:15118:2:2013:MsgBody":EVSECurrentLimitAchieved,"urn:iso:15118:2:2013:MsgBody":EVSEVoltageLimitAchieved,"urn:iso:15118:2:2013:MsgBody":EVSEPowerLimitAchieved,"urn:iso:15118:2:2013:MsgBody":EVSEMaximumVoltageLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVSEMaximumCurrentLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVSEMaximumPowerLimit{0-1},"urn:iso:15118:2:2013:MsgBody":EVSEID,"urn:iso:15118:2:2013:MsgBody":SAScheduleTupleID,"urn:iso:15118:2:2013:MsgBody":MeterInfo{0-1},"urn:iso:15118:2:2013:MsgBody":ReceiptRequired{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
 static int encode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1CurrentDemandResType* iso1CurrentDemandResType) {
+	int errn = 0;
 	int grammarID = 317;
 	int done = 0;
 	
@@ -10190,11 +10399,8 @@ static int encode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1Curre
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1CurrentDemandResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -10224,11 +10430,8 @@ static int encode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1Curre
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1CurrentDemandResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -10252,11 +10455,8 @@ static int encode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1Curre
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1CurrentDemandResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -10274,11 +10474,8 @@ static int encode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1Curre
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1CurrentDemandResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, iso1CurrentDemandResType->EVSEID.characters, iso1CurrentDemandResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -10311,7 +10508,11 @@ static int encode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1Curre
 			if ( iso1CurrentDemandResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso1MeterInfoType(stream, iso1CurrentDemandResType->MeterInfo );
+#else
 					errn = encode_iso1MeterInfoType(stream, &iso1CurrentDemandResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 330;
 			} else 			if ( iso1CurrentDemandResType->ReceiptRequired_isUsed == 1u ) {
@@ -10382,9 +10583,11 @@ static int encode_iso1CurrentDemandResType(bitstream_t* stream, struct iso1Curre
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,ServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ServiceID,"urn:iso:15118:2:2013:MsgDataTypes":ServiceName{0-1},"urn:iso:15118:2:2013:MsgDataTypes":ServiceCategory,"urn:iso:15118:2:2013:MsgDataTypes":ServiceScope{0-1},"urn:iso:15118:2:2013:MsgDataTypes":FreeService)',  derivedBy='RESTRICTION'.  */
 static int encode_iso1ServiceType(bitstream_t* stream, struct iso1ServiceType* iso1ServiceType) {
+	int errn = 0;
 	int grammarID = 331;
 	int done = 0;
 	
@@ -10417,11 +10620,8 @@ static int encode_iso1ServiceType(bitstream_t* stream, struct iso1ServiceType* i
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ServiceType->ServiceName.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1ServiceType->ServiceName.characters, iso1ServiceType->ServiceName.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, iso1ServiceType->ServiceName.characters, iso1ServiceType->ServiceName.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -10469,11 +10669,8 @@ static int encode_iso1ServiceType(bitstream_t* stream, struct iso1ServiceType* i
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ServiceType->ServiceScope.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1ServiceType->ServiceScope.characters, iso1ServiceType->ServiceScope.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, iso1ServiceType->ServiceScope.characters, iso1ServiceType->ServiceScope.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -10537,7 +10734,9 @@ static int encode_iso1ServiceType(bitstream_t* stream, struct iso1ServiceType* i
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ServiceDiscoveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ServiceScope{0-1},"urn:iso:15118:2:2013:MsgBody":ServiceCategory{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 static int encode_iso1ServiceDiscoveryReqType(bitstream_t* stream, struct iso1ServiceDiscoveryReqType* iso1ServiceDiscoveryReqType) {
+	int errn = 0;
 	int grammarID = 336;
 	int done = 0;
 	
@@ -10552,11 +10751,8 @@ static int encode_iso1ServiceDiscoveryReqType(bitstream_t* stream, struct iso1Se
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1ServiceDiscoveryReqType->ServiceScope.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1ServiceDiscoveryReqType->ServiceScope.characters, iso1ServiceDiscoveryReqType->ServiceScope.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 15 /* {urn:iso:15118:2:2013:MsgBody}ServiceScope */, iso1ServiceDiscoveryReqType->ServiceScope.characters, iso1ServiceDiscoveryReqType->ServiceScope.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -10630,9 +10826,11 @@ static int encode_iso1ServiceDiscoveryReqType(bitstream_t* stream, struct iso1Se
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,AC_EVSEChargeParameterType',  base type name='EVSEChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":AC_EVSEStatus,"urn:iso:15118:2:2013:MsgDataTypes":EVSENominalVoltage,"urn:iso:15118:2:2013:MsgDataTypes":EVSEMaxCurrent)',  derivedBy='EXTENSION'.  */
 static int encode_iso1AC_EVSEChargeParameterType(bitstream_t* stream, struct iso1AC_EVSEChargeParameterType* iso1AC_EVSEChargeParameterType) {
+	int errn = 0;
 	int grammarID = 338;
 	int done = 0;
 	
@@ -10699,7 +10897,9 @@ static int encode_iso1AC_EVSEChargeParameterType(bitstream_t* stream, struct iso
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,CableCheckReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":DC_EVStatus)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
 static int encode_iso1CableCheckReqType(bitstream_t* stream, struct iso1CableCheckReqType* iso1CableCheckReqType) {
+	int errn = 0;
 	int grammarID = 313;
 	int done = 0;
 	
@@ -10740,9 +10940,11 @@ static int encode_iso1CableCheckReqType(bitstream_t* stream, struct iso1CableChe
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_CableCheckReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SelectedServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":ServiceID,"urn:iso:15118:2:2013:MsgDataTypes":ParameterSetID{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1SelectedServiceType(bitstream_t* stream, struct iso1SelectedServiceType* iso1SelectedServiceType) {
+	int errn = 0;
 	int grammarID = 341;
 	int done = 0;
 	
@@ -10816,6 +11018,7 @@ static int encode_iso1SelectedServiceType(bitstream_t* stream, struct iso1Select
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,AC_EVSEStatusType',  base type name='EVSEStatusType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2013:MsgDataTypes":NotificationMaxDelay,"urn:iso:15118:2:2013:MsgDataTypes":EVSENotification),("urn:iso:15118:2:2013:MsgDataTypes":RCD))',  derivedBy='EXTENSION'.  */
 static int encode_iso1AC_EVSEStatusType(bitstream_t* stream, struct iso1AC_EVSEStatusType* iso1AC_EVSEStatusType) {
+	int errn = 0;
 	int grammarID = 343;
 	int done = 0;
 	
@@ -10901,6 +11104,7 @@ static int encode_iso1AC_EVSEStatusType(bitstream_t* stream, struct iso1AC_EVSES
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SalesTariffType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":SalesTariffID,"urn:iso:15118:2:2013:MsgDataTypes":SalesTariffDescription{0-1},"urn:iso:15118:2:2013:MsgDataTypes":NumEPriceLevels{0-1},"urn:iso:15118:2:2013:MsgDataTypes":SalesTariffEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTariffType* iso1SalesTariffType) {
+	int errn = 0;
 	int grammarID = 346;
 	int done = 0;
 	
@@ -10913,11 +11117,8 @@ static int encode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTarif
 			if ( iso1SalesTariffType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SalesTariffType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SalesTariffType->Id.characters, iso1SalesTariffType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, iso1SalesTariffType->Id.characters, iso1SalesTariffType->Id.charactersLen);
 				}
 				grammarID = 347;
 			} else 			if ( 1 == 1 ) {
@@ -10962,11 +11163,8 @@ static int encode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTarif
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SalesTariffType->SalesTariffDescription.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso1SalesTariffType->SalesTariffDescription.characters, iso1SalesTariffType->SalesTariffDescription.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 21 /* {urn:iso:15118:2:2013:MsgDataTypes}SalesTariffDescription */, iso1SalesTariffType->SalesTariffDescription.characters, iso1SalesTariffType->SalesTariffDescription.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -11060,7 +11258,9 @@ static int encode_iso1SalesTariffType(bitstream_t* stream, struct iso1SalesTarif
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PaymentServiceSelectionReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":SelectedPaymentOption,"urn:iso:15118:2:2013:MsgBody":SelectedServiceList)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 static int encode_iso1PaymentServiceSelectionReqType(bitstream_t* stream, struct iso1PaymentServiceSelectionReqType* iso1PaymentServiceSelectionReqType) {
+	int errn = 0;
 	int grammarID = 352;
 	int done = 0;
 	
@@ -11119,9 +11319,12 @@ static int encode_iso1PaymentServiceSelectionReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertiesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignatureProperty{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if ISO1_DEPLOY_SignatureProperties == SUPPORT_YES
 static int encode_iso1SignaturePropertiesType(bitstream_t* stream, struct iso1SignaturePropertiesType* iso1SignaturePropertiesType) {
+	int errn = 0;
 	int grammarID = 354;
 	int done = 0;
 	
@@ -11134,11 +11337,8 @@ static int encode_iso1SignaturePropertiesType(bitstream_t* stream, struct iso1Si
 			if ( iso1SignaturePropertiesType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignaturePropertiesType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignaturePropertiesType->Id.characters, iso1SignaturePropertiesType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Id */, iso1SignaturePropertiesType->Id.characters, iso1SignaturePropertiesType->Id.charactersLen);
 				}
 				grammarID = 355;
 			} else 			if (iso1SignaturePropertiesType_SignatureProperty_currArrayIndex < iso1SignaturePropertiesType->SignatureProperty.arrayLen ) {
@@ -11191,9 +11391,12 @@ static int encode_iso1SignaturePropertiesType(bitstream_t* stream, struct iso1Si
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_SignatureProperties */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,BodyBaseType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
 static int encode_iso1BodyBaseType(bitstream_t* stream, struct iso1BodyBaseType* iso1BodyBaseType) {
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -11222,9 +11425,11 @@ static int encode_iso1BodyBaseType(bitstream_t* stream, struct iso1BodyBaseType*
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_BodyElement */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgDataTypes,SupportedEnergyTransferModeType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgDataTypes":EnergyTransferMode{1-6})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1SupportedEnergyTransferModeType(bitstream_t* stream, struct iso1SupportedEnergyTransferModeType* iso1SupportedEnergyTransferModeType) {
+	int errn = 0;
 	int grammarID = 357;
 	int done = 0;
 	
@@ -11394,7 +11599,9 @@ static int encode_iso1SupportedEnergyTransferModeType(bitstream_t* stream, struc
 }
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,ChargingStatusReqType',  base type name='BodyBaseType',  content type='EMPTY',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
 static int encode_iso1ChargingStatusReqType(bitstream_t* stream, struct iso1ChargingStatusReqType* iso1ChargingStatusReqType) {
+	int errn = 0;
 	int grammarID = 34;
 	int done = 0;
 	
@@ -11423,9 +11630,12 @@ static int encode_iso1ChargingStatusReqType(bitstream_t* stream, struct iso1Char
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
 
 /* Complex type name='urn:iso:15118:2:2013:MsgBody,PaymentServiceSelectionResType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2013:MsgBody":ResponseCode)',  derivedBy='EXTENSION'.  */
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 static int encode_iso1PaymentServiceSelectionResType(bitstream_t* stream, struct iso1PaymentServiceSelectionResType* iso1PaymentServiceSelectionResType) {
+	int errn = 0;
 	int grammarID = 122;
 	int done = 0;
 	
@@ -11472,9 +11682,11 @@ static int encode_iso1PaymentServiceSelectionResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DigestMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMethodType* iso1DigestMethodType) {
+	int errn = 0;
 	int grammarID = 312;
 	int done = 0;
 	int wcDone = 0;
@@ -11487,11 +11699,8 @@ static int encode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMet
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1DigestMethodType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1DigestMethodType->Algorithm.characters, iso1DigestMethodType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}Algorithm */, iso1DigestMethodType->Algorithm.characters, iso1DigestMethodType->Algorithm.charactersLen);
 				}
 				grammarID = 115;
 			} else {
@@ -11512,11 +11721,8 @@ static int encode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMet
 			} else 			if ( iso1DigestMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1DigestMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1DigestMethodType->ANY.characters, iso1DigestMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, iso1DigestMethodType->ANY.characters, iso1DigestMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 116;
@@ -11538,11 +11744,8 @@ static int encode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMet
 			} else 			if ( iso1DigestMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1DigestMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1DigestMethodType->ANY.characters, iso1DigestMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, iso1DigestMethodType->ANY.characters, iso1DigestMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 116;
@@ -11563,6 +11766,7 @@ static int encode_iso1DigestMethodType(bitstream_t* stream, struct iso1DigestMet
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertyType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1SignaturePropertyType* iso1SignaturePropertyType) {
+	int errn = 0;
 	int grammarID = 363;
 	int done = 0;
 	int wcDone = 0;
@@ -11575,21 +11779,15 @@ static int encode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 			if ( iso1SignaturePropertyType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignaturePropertyType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignaturePropertyType->Id.characters, iso1SignaturePropertyType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Id */, iso1SignaturePropertyType->Id.characters, iso1SignaturePropertyType->Id.charactersLen);
 				}
 				grammarID = 364;
 			} else 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignaturePropertyType->Target.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignaturePropertyType->Target.characters, iso1SignaturePropertyType->Target.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 29 /* {}Target */, iso1SignaturePropertyType->Target.characters, iso1SignaturePropertyType->Target.charactersLen);
 				}
 				grammarID = 365;
 			} else {
@@ -11601,11 +11799,8 @@ static int encode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignaturePropertyType->Target.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignaturePropertyType->Target.characters, iso1SignaturePropertyType->Target.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 29 /* {}Target */, iso1SignaturePropertyType->Target.characters, iso1SignaturePropertyType->Target.charactersLen);
 				}
 				grammarID = 365;
 			} else {
@@ -11620,11 +11815,8 @@ static int encode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 			} else 			if ( iso1SignaturePropertyType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignaturePropertyType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 366;
@@ -11646,11 +11838,8 @@ static int encode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 			} else 			if ( iso1SignaturePropertyType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignaturePropertyType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 116;
@@ -11666,11 +11855,8 @@ static int encode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 			} else 			if ( iso1SignaturePropertyType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso1SignaturePropertyType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, iso1SignaturePropertyType->ANY.characters, iso1SignaturePropertyType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 366;
@@ -11691,6 +11877,7 @@ static int encode_iso1SignaturePropertyType(bitstream_t* stream, struct iso1Sign
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,PGPDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":PGPKeyID,"http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})|("http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED}))',  derivedBy='RESTRICTION'.  */
 static int encode_iso1PGPDataType(bitstream_t* stream, struct iso1PGPDataType* iso1PGPDataType) {
+	int errn = 0;
 	int grammarID = 367;
 	int done = 0;
 	int wcDone = 0;
@@ -11791,6 +11978,7 @@ static int encode_iso1PGPDataType(bitstream_t* stream, struct iso1PGPDataType* i
 }
 
 int encode_iso1EXISchemaInformedElementFragmentGrammar(bitstream_t* stream, struct iso1EXISchemaInformedElementFragmentGrammar* exiElementFrag) {
+	int errn = 0;
 	int grammarID = 370;
 	int done = 0;
 	
@@ -11802,11 +11990,8 @@ int encode_iso1EXISchemaInformedElementFragmentGrammar(bitstream_t* stream, stru
 				exiElementFrag->Id_isUsed = 0u; /* hack to indicate for next loop that this has been handled already */
 				errn = encodeNBitUnsignedInteger(stream, 9, 4);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiElementFrag->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiElementFrag->Id.characters, exiElementFrag->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 18 /* {urn:iso:15118:2:2013:MsgDataTypes}Id */, exiElementFrag->Id.characters, exiElementFrag->Id.charactersLen);
 				}
 				grammarID = 370;
 			} else 			if (1==0) {
@@ -11819,11 +12004,8 @@ int encode_iso1EXISchemaInformedElementFragmentGrammar(bitstream_t* stream, stru
 				exiElementFrag->CHARACTERS_GENERIC_isUsed = 0u; /* hack to indicate for next loop that this has been handled already */
 				errn = encodeNBitUnsignedInteger(stream, 9, 256);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiElementFrag->CHARACTERS_GENERIC.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiElementFrag->CHARACTERS_GENERIC.characters, exiElementFrag->CHARACTERS_GENERIC.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, exiElementFrag->CHARACTERS_GENERIC.characters, exiElementFrag->CHARACTERS_GENERIC.charactersLen);
 				}
 				grammarID = 371;
 			} else {
@@ -11843,11 +12025,8 @@ int encode_iso1EXISchemaInformedElementFragmentGrammar(bitstream_t* stream, stru
 				exiElementFrag->CHARACTERS_GENERIC_isUsed = 0u; /* hack to indicate for next loop that this has been handled already */
 				errn = encodeNBitUnsignedInteger(stream, 8, 245);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiElementFrag->CHARACTERS_GENERIC.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiElementFrag->CHARACTERS_GENERIC.characters, exiElementFrag->CHARACTERS_GENERIC.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 16 /* {urn:iso:15118:2:2013:MsgBody}eMAID */, exiElementFrag->CHARACTERS_GENERIC.characters, exiElementFrag->CHARACTERS_GENERIC.charactersLen);
 				}
 				grammarID = 371;
 			} else {
@@ -11869,166 +12048,271 @@ int encode_iso1EXISchemaInformedElementFragmentGrammar(bitstream_t* stream, stru
 
 
 int encode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc) {
+	int errn = 0;
 	errn = writeEXIHeader(stream);
 
 	if(errn == 0) {
 		/* DocContent[START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVSEStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}BodyElement), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandRes), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVPowerDeliveryParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVSEStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVStatus), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVPowerDeliveryParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Entry), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}PMaxScheduleEntry), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}RelativeTimeInterval), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SAScheduleList), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SASchedules), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SalesTariffEntry), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}TimeInterval), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms), START_ELEMENT({urn:iso:15118:2:2013:MsgDef}V2G_Message), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data), START_ELEMENT_GENERIC] */
 		if ( exiDoc->AC_EVChargeParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_AC_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 0);
 			if(errn == 0) {
 				errn = encode_iso1AC_EVChargeParameterType(stream, &exiDoc->AC_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AC_EVChargeParameter */
 		} else if ( exiDoc->AC_EVSEChargeParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_AC_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 1);
 			if(errn == 0) {
 				errn = encode_iso1AC_EVSEChargeParameterType(stream, &exiDoc->AC_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AC_EVSEChargeParameter */
 		} else if ( exiDoc->AC_EVSEStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_AC_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 2);
 			if(errn == 0) {
 				errn = encode_iso1AC_EVSEStatusType(stream, &exiDoc->AC_EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AC_EVSEStatus */
 		} else if ( exiDoc->AuthorizationReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 3);
 			if(errn == 0) {
 				errn = encode_iso1AuthorizationReqType(stream, &exiDoc->AuthorizationReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AuthorizationReq */
 		} else if ( exiDoc->AuthorizationRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 4);
 			if(errn == 0) {
 				errn = encode_iso1AuthorizationResType(stream, &exiDoc->AuthorizationRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AuthorizationRes */
 		} else if ( exiDoc->BodyElement_isUsed == 1u ) { 
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}BodyElement) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 5);
 			if(errn == 0) {
 				errn = encode_iso1BodyBaseType(stream, &exiDoc->BodyElement );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_BodyElement */
 		} else if ( exiDoc->CableCheckReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 6);
 			if(errn == 0) {
 				errn = encode_iso1CableCheckReqType(stream, &exiDoc->CableCheckReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CableCheckReq */
 		} else if ( exiDoc->CableCheckRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 7);
 			if(errn == 0) {
 				errn = encode_iso1CableCheckResType(stream, &exiDoc->CableCheckRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CableCheckRes */
 		} else if ( exiDoc->CanonicalizationMethod_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CanonicalizationMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 8);
 			if(errn == 0) {
 				errn = encode_iso1CanonicalizationMethodType(stream, &exiDoc->CanonicalizationMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CanonicalizationMethod */
 		} else if ( exiDoc->CertificateInstallationReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 9);
 			if(errn == 0) {
 				errn = encode_iso1CertificateInstallationReqType(stream, &exiDoc->CertificateInstallationReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
 		} else if ( exiDoc->CertificateInstallationRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 10);
 			if(errn == 0) {
 				errn = encode_iso1CertificateInstallationResType(stream, &exiDoc->CertificateInstallationRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
 		} else if ( exiDoc->CertificateUpdateReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 11);
 			if(errn == 0) {
 				errn = encode_iso1CertificateUpdateReqType(stream, &exiDoc->CertificateUpdateReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
 		} else if ( exiDoc->CertificateUpdateRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 12);
 			if(errn == 0) {
 				errn = encode_iso1CertificateUpdateResType(stream, &exiDoc->CertificateUpdateRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
 		} else if ( exiDoc->ChargeParameterDiscoveryReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 13);
 			if(errn == 0) {
 				errn = encode_iso1ChargeParameterDiscoveryReqType(stream, &exiDoc->ChargeParameterDiscoveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
 		} else if ( exiDoc->ChargeParameterDiscoveryRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 14);
 			if(errn == 0) {
 				errn = encode_iso1ChargeParameterDiscoveryResType(stream, &exiDoc->ChargeParameterDiscoveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
 		} else if ( exiDoc->ChargingStatusReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 15);
 			if(errn == 0) {
 				errn = encode_iso1ChargingStatusReqType(stream, &exiDoc->ChargingStatusReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
 		} else if ( exiDoc->ChargingStatusRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 16);
 			if(errn == 0) {
 				errn = encode_iso1ChargingStatusResType(stream, &exiDoc->ChargingStatusRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
 		} else if ( exiDoc->CurrentDemandReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 17);
 			if(errn == 0) {
 				errn = encode_iso1CurrentDemandReqType(stream, &exiDoc->CurrentDemandReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
 		} else if ( exiDoc->CurrentDemandRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 18);
 			if(errn == 0) {
 				errn = encode_iso1CurrentDemandResType(stream, &exiDoc->CurrentDemandRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
 		} else if ( exiDoc->DC_EVChargeParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DC_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 19);
 			if(errn == 0) {
 				errn = encode_iso1DC_EVChargeParameterType(stream, &exiDoc->DC_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DC_EVChargeParameter */
 		} else if ( exiDoc->DC_EVPowerDeliveryParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DC_EVPowerDeliveryParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVPowerDeliveryParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 20);
 			if(errn == 0) {
 				errn = encode_iso1DC_EVPowerDeliveryParameterType(stream, &exiDoc->DC_EVPowerDeliveryParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DC_EVPowerDeliveryParameter */
 		} else if ( exiDoc->DC_EVSEChargeParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DC_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 21);
 			if(errn == 0) {
 				errn = encode_iso1DC_EVSEChargeParameterType(stream, &exiDoc->DC_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DC_EVSEChargeParameter */
 		} else if ( exiDoc->DC_EVSEStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DC_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 22);
 			if(errn == 0) {
 				errn = encode_iso1DC_EVSEStatusType(stream, &exiDoc->DC_EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DC_EVSEStatus */
 		} else if ( exiDoc->DC_EVStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DC_EVStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 23);
 			if(errn == 0) {
 				errn = encode_iso1DC_EVStatusType(stream, &exiDoc->DC_EVStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DC_EVStatus */
 		} else if ( exiDoc->DSAKeyValue_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DSAKeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 24);
 			if(errn == 0) {
 				errn = encode_iso1DSAKeyValueType(stream, &exiDoc->DSAKeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DSAKeyValue */
 		} else if ( exiDoc->DigestMethod_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DigestMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 25);
 			if(errn == 0) {
 				errn = encode_iso1DigestMethodType(stream, &exiDoc->DigestMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DigestMethod */
 		} else if ( exiDoc->DigestValue_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 26);
@@ -12045,47 +12329,75 @@ int encode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc)
 				}
 			}
 		} else if ( exiDoc->EVChargeParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 27);
 			if(errn == 0) {
 				errn = encode_iso1EVChargeParameterType(stream, &exiDoc->EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_EVChargeParameter */
 		} else if ( exiDoc->EVPowerDeliveryParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_EVPowerDeliveryParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVPowerDeliveryParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 28);
 			if(errn == 0) {
 				errn = encode_iso1EVPowerDeliveryParameterType(stream, &exiDoc->EVPowerDeliveryParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_EVPowerDeliveryParameter */
 		} else if ( exiDoc->EVSEChargeParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 29);
 			if(errn == 0) {
 				errn = encode_iso1EVSEChargeParameterType(stream, &exiDoc->EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_EVSEChargeParameter */
 		} else if ( exiDoc->EVSEStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 30);
 			if(errn == 0) {
 				errn = encode_iso1EVSEStatusType(stream, &exiDoc->EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_EVSEStatus */
 		} else if ( exiDoc->EVStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_EVStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 31);
 			if(errn == 0) {
 				errn = encode_iso1EVStatusType(stream, &exiDoc->EVStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_EVStatus */
 		} else if ( exiDoc->Entry_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Entry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Entry) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 32);
 			if(errn == 0) {
 				errn = encode_iso1EntryType(stream, &exiDoc->Entry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Entry */
 		} else if ( exiDoc->KeyInfo_isUsed == 1u ) { 
+#if ISO1_DEPLOY_KeyInfo == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 33);
 			if(errn == 0) {
 				errn = encode_iso1KeyInfoType(stream, &exiDoc->KeyInfo );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_KeyInfo */
 		} else if ( exiDoc->KeyName_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 34);
@@ -12093,39 +12405,52 @@ int encode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiDoc->KeyName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiDoc->KeyName.characters, exiDoc->KeyName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiDoc->KeyName.characters, exiDoc->KeyName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiDoc->KeyValue_isUsed == 1u ) { 
+#if ISO1_DEPLOY_KeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 35);
 			if(errn == 0) {
 				errn = encode_iso1KeyValueType(stream, &exiDoc->KeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_KeyValue */
 		} else if ( exiDoc->Manifest_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Manifest == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 36);
 			if(errn == 0) {
 				errn = encode_iso1ManifestType(stream, &exiDoc->Manifest );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Manifest */
 		} else if ( exiDoc->MeteringReceiptReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 37);
 			if(errn == 0) {
 				errn = encode_iso1MeteringReceiptReqType(stream, &exiDoc->MeteringReceiptReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
 		} else if ( exiDoc->MeteringReceiptRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 38);
 			if(errn == 0) {
 				errn = encode_iso1MeteringReceiptResType(stream, &exiDoc->MeteringReceiptRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
 		} else if ( exiDoc->MgmtData_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 39);
@@ -12133,255 +12458,412 @@ int encode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiDoc->MgmtData.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiDoc->MgmtData.characters, exiDoc->MgmtData.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiDoc->MgmtData.characters, exiDoc->MgmtData.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiDoc->Object_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Object == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 40);
 			if(errn == 0) {
 				errn = encode_iso1ObjectType(stream, &exiDoc->Object );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Object */
 		} else if ( exiDoc->PGPData_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PGPData == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 41);
 			if(errn == 0) {
 				errn = encode_iso1PGPDataType(stream, &exiDoc->PGPData );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PGPData */
 		} else if ( exiDoc->PMaxScheduleEntry_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PMaxScheduleEntry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}PMaxScheduleEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 42);
 			if(errn == 0) {
 				errn = encode_iso1PMaxScheduleEntryType(stream, &exiDoc->PMaxScheduleEntry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PMaxScheduleEntry */
 		} else if ( exiDoc->PaymentDetailsReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 43);
 			if(errn == 0) {
 				errn = encode_iso1PaymentDetailsReqType(stream, &exiDoc->PaymentDetailsReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
 		} else if ( exiDoc->PaymentDetailsRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 44);
 			if(errn == 0) {
 				errn = encode_iso1PaymentDetailsResType(stream, &exiDoc->PaymentDetailsRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
 		} else if ( exiDoc->PaymentServiceSelectionReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 45);
 			if(errn == 0) {
 				errn = encode_iso1PaymentServiceSelectionReqType(stream, &exiDoc->PaymentServiceSelectionReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
 		} else if ( exiDoc->PaymentServiceSelectionRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 46);
 			if(errn == 0) {
 				errn = encode_iso1PaymentServiceSelectionResType(stream, &exiDoc->PaymentServiceSelectionRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
 		} else if ( exiDoc->PowerDeliveryReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 47);
 			if(errn == 0) {
 				errn = encode_iso1PowerDeliveryReqType(stream, &exiDoc->PowerDeliveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
 		} else if ( exiDoc->PowerDeliveryRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 48);
 			if(errn == 0) {
 				errn = encode_iso1PowerDeliveryResType(stream, &exiDoc->PowerDeliveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
 		} else if ( exiDoc->PreChargeReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 49);
 			if(errn == 0) {
 				errn = encode_iso1PreChargeReqType(stream, &exiDoc->PreChargeReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PreChargeReq */
 		} else if ( exiDoc->PreChargeRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 50);
 			if(errn == 0) {
 				errn = encode_iso1PreChargeResType(stream, &exiDoc->PreChargeRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PreChargeRes */
 		} else if ( exiDoc->RSAKeyValue_isUsed == 1u ) { 
+#if ISO1_DEPLOY_RSAKeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 51);
 			if(errn == 0) {
 				errn = encode_iso1RSAKeyValueType(stream, &exiDoc->RSAKeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_RSAKeyValue */
 		} else if ( exiDoc->Reference_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Reference == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 52);
 			if(errn == 0) {
 				errn = encode_iso1ReferenceType(stream, &exiDoc->Reference );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Reference */
 		} else if ( exiDoc->RelativeTimeInterval_isUsed == 1u ) { 
+#if ISO1_DEPLOY_RelativeTimeInterval == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}RelativeTimeInterval) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 53);
 			if(errn == 0) {
 				errn = encode_iso1RelativeTimeIntervalType(stream, &exiDoc->RelativeTimeInterval );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_RelativeTimeInterval */
 		} else if ( exiDoc->RetrievalMethod_isUsed == 1u ) { 
+#if ISO1_DEPLOY_RetrievalMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 54);
 			if(errn == 0) {
 				errn = encode_iso1RetrievalMethodType(stream, &exiDoc->RetrievalMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_RetrievalMethod */
 		} else if ( exiDoc->SAScheduleList_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SAScheduleList == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SAScheduleList) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 55);
 			if(errn == 0) {
 				errn = encode_iso1SAScheduleListType(stream, &exiDoc->SAScheduleList );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SAScheduleList */
 		} else if ( exiDoc->SASchedules_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SASchedules == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SASchedules) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 56);
 			if(errn == 0) {
 				errn = encode_iso1SASchedulesType(stream, &exiDoc->SASchedules );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SASchedules */
 		} else if ( exiDoc->SPKIData_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SPKIData == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 57);
 			if(errn == 0) {
 				errn = encode_iso1SPKIDataType(stream, &exiDoc->SPKIData );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SPKIData */
 		} else if ( exiDoc->SalesTariffEntry_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SalesTariffEntry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SalesTariffEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 58);
 			if(errn == 0) {
 				errn = encode_iso1SalesTariffEntryType(stream, &exiDoc->SalesTariffEntry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SalesTariffEntry */
 		} else if ( exiDoc->ServiceDetailReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 59);
 			if(errn == 0) {
 				errn = encode_iso1ServiceDetailReqType(stream, &exiDoc->ServiceDetailReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
 		} else if ( exiDoc->ServiceDetailRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 60);
 			if(errn == 0) {
 				errn = encode_iso1ServiceDetailResType(stream, &exiDoc->ServiceDetailRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
 		} else if ( exiDoc->ServiceDiscoveryReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 61);
 			if(errn == 0) {
 				errn = encode_iso1ServiceDiscoveryReqType(stream, &exiDoc->ServiceDiscoveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
 		} else if ( exiDoc->ServiceDiscoveryRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 62);
 			if(errn == 0) {
 				errn = encode_iso1ServiceDiscoveryResType(stream, &exiDoc->ServiceDiscoveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
 		} else if ( exiDoc->SessionSetupReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 63);
 			if(errn == 0) {
 				errn = encode_iso1SessionSetupReqType(stream, &exiDoc->SessionSetupReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SessionSetupReq */
 		} else if ( exiDoc->SessionSetupRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 64);
 			if(errn == 0) {
 				errn = encode_iso1SessionSetupResType(stream, &exiDoc->SessionSetupRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SessionSetupRes */
 		} else if ( exiDoc->SessionStopReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 65);
 			if(errn == 0) {
 				errn = encode_iso1SessionStopReqType(stream, &exiDoc->SessionStopReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SessionStopReq */
 		} else if ( exiDoc->SessionStopRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 66);
 			if(errn == 0) {
 				errn = encode_iso1SessionStopResType(stream, &exiDoc->SessionStopRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SessionStopRes */
 		} else if ( exiDoc->Signature_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Signature == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 67);
 			if(errn == 0) {
 				errn = encode_iso1SignatureType(stream, &exiDoc->Signature );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Signature */
 		} else if ( exiDoc->SignatureMethod_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SignatureMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 68);
 			if(errn == 0) {
 				errn = encode_iso1SignatureMethodType(stream, &exiDoc->SignatureMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SignatureMethod */
 		} else if ( exiDoc->SignatureProperties_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SignatureProperties == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 69);
 			if(errn == 0) {
 				errn = encode_iso1SignaturePropertiesType(stream, &exiDoc->SignatureProperties );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SignatureProperties */
 		} else if ( exiDoc->SignatureProperty_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SignatureProperty == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 70);
 			if(errn == 0) {
 				errn = encode_iso1SignaturePropertyType(stream, &exiDoc->SignatureProperty );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SignatureProperty */
 		} else if ( exiDoc->SignatureValue_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SignatureValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 71);
 			if(errn == 0) {
 				errn = encode_iso1SignatureValueType(stream, &exiDoc->SignatureValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SignatureValue */
 		} else if ( exiDoc->SignedInfo_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SignedInfo == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 72);
 			if(errn == 0) {
 				errn = encode_iso1SignedInfoType(stream, &exiDoc->SignedInfo );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SignedInfo */
 		} else if ( exiDoc->TimeInterval_isUsed == 1u ) { 
+#if ISO1_DEPLOY_TimeInterval == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}TimeInterval) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 73);
 			if(errn == 0) {
 				errn = encode_iso1IntervalType(stream, &exiDoc->TimeInterval );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_TimeInterval */
 		} else if ( exiDoc->Transform_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Transform == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 74);
 			if(errn == 0) {
 				errn = encode_iso1TransformType(stream, &exiDoc->Transform );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Transform */
 		} else if ( exiDoc->Transforms_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Transforms == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 75);
 			if(errn == 0) {
 				errn = encode_iso1TransformsType(stream, &exiDoc->Transforms );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Transforms */
 		} else if ( exiDoc->V2G_Message_isUsed == 1u ) { 
+#if ISO1_DEPLOY_V2G_Message == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDef}V2G_Message) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 76);
 			if(errn == 0) {
 				errn = encode_iso1AnonType_V2G_Message(stream, &exiDoc->V2G_Message );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_V2G_Message */
 		} else if ( exiDoc->WeldingDetectionReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 77);
 			if(errn == 0) {
 				errn = encode_iso1WeldingDetectionReqType(stream, &exiDoc->WeldingDetectionReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
 		} else if ( exiDoc->WeldingDetectionRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 78);
 			if(errn == 0) {
 				errn = encode_iso1WeldingDetectionResType(stream, &exiDoc->WeldingDetectionRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
 		} else if ( exiDoc->X509Data_isUsed == 1u ) { 
+#if ISO1_DEPLOY_X509Data == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 79);
 			if(errn == 0) {
 				errn = encode_iso1X509DataType(stream, &exiDoc->X509Data );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_X509Data */
 		} else {
 			errn = EXI_ERROR_UNKOWN_EVENT;
 		}
@@ -12397,47 +12879,71 @@ int encode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc)
 }
 
 #if DEPLOY_ISO1_CODEC_FRAGMENT == SUPPORT_YES
-int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag) {
-	errn = writeEXIHeader(stream);
+static int encode_iso1ExiFragmentContent(bitstream_t* stream, struct iso1EXIFragment* exiFrag) {
+	int errn = 0;
 
 	if(errn == 0) {
 		/* FragmentContent[START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AC_EVSEStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVSEStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationRes), START_ELEMENT({urn:iso:15118:2:2013:MsgDef}Body), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}BodyElement), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}BulkChargingComplete), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}BulkChargingComplete), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}BulkSOC), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Certificate), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeProgress), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeService), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingComplete), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ChargingComplete), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingProfile), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ChargingProfileEntryMaxNumberOfPhasesInUse), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ChargingProfileEntryMaxPower), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ChargingProfileEntryStart), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingSession), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusRes), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ConsumptionCost), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ContractSignatureCertChain), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ContractSignatureEncryptedPrivateKey), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Cost), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandRes), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVPowerDeliveryParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}DC_EVSEStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVSEStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}DC_EVStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}DHpublickey), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DepartureTime), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EAmount), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EPriceLevel), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVCCID), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVEnergyCapacity), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVEnergyRequest), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVErrorCode), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVMaxCurrent), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVMaxVoltage), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVMaximumCurrentLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVMaximumCurrentLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVMaximumPowerLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVMaximumPowerLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVMaximumVoltageLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVMaximumVoltageLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVMinCurrent), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVPowerDeliveryParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVRESSSOC), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVReady), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSECurrentLimitAchieved), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSECurrentRegulationTolerance), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEEnergyToBeDelivered), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSEID), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEIsolationStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSEMaxCurrent), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEMaxCurrent), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSEMaximumCurrentLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEMaximumCurrentLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSEMaximumPowerLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEMaximumPowerLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSEMaximumVoltageLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEMaximumVoltageLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEMinimumCurrentLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEMinimumVoltageLimit), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSENominalVoltage), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSENotification), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEPeakCurrentRipple), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSEPowerLimitAchieved), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSEPresentCurrent), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSEPresentVoltage), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSEProcessing), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEStatusCode), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSETimeStamp), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSEVoltageLimitAchieved), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVTargetCurrent), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVTargetVoltage), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EnergyTransferMode), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Entry), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Exponent), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}FaultCode), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}FaultMsg), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}FreeService), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}FullSOC), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}G), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}GenChallenge), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}HMACOutputLength), START_ELEMENT({urn:iso:15118:2:2013:MsgDef}Header), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}J), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ListOfRootCertificateIDs), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MaxEntriesSAScheduleTuple), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}MeterID), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeterInfo), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}MeterReading), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}MeterStatus), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Modulus), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Multiplier), START_ELEMENT({urn:iso:15118:2:2013:MsgHeader}Notification), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}NotificationMaxDelay), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}NumEPriceLevels), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}OEMProvisioningCert), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}P), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyID), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyPacket), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}PMax), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}PMaxSchedule), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}PMaxScheduleEntry), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Parameter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ParameterSet), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ParameterSetID), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsRes), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}PaymentOption), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentOptionList), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PgenCounter), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeRes), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ProfileEntry), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Q), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}RCD), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ReceiptRequired), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}RelativeTimeInterval), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}RemainingTimeToBulkSoC), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}RemainingTimeToFullSoC), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}RequestedEnergyTransferMode), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ResponseCode), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}RetryCounter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}RootCertificateID), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SAProvisioningCertificateChain), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SAScheduleList), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SAScheduleTuple), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SAScheduleTupleID), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SAScheduleTupleID), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SASchedules), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKISexp), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SalesTariff), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SalesTariffDescription), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SalesTariffEntry), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SalesTariffID), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Seed), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SelectedPaymentOption), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SelectedService), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SelectedServiceList), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Service), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceCategory), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ServiceCategory), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceID), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ServiceID), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceList), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ServiceName), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceParameterList), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceScope), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ServiceScope), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionID), START_ELEMENT({urn:iso:15118:2:2013:MsgHeader}SessionID), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupRes), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopRes), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SigMeterReading), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SubCertificates), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SupportedEnergyTransferMode), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}TMeter), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}TimeInterval), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Unit), START_ELEMENT({urn:iso:15118:2:2013:MsgDef}V2G_Message), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Value), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionReq), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509CRL), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Certificate), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerSerial), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509SKI), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509SerialNumber), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509SubjectName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}XPath), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Y), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}amount), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}amountMultiplier), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}boolValue), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}byteValue), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}costKind), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}duration), START_ELEMENT({urn:iso:15118:2:2013:MsgBody}eMAID), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}intValue), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}physicalValue), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}shortValue), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}start), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}startValue), START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}stringValue), START_ELEMENT_GENERIC, END_DOCUMENT] */
 		if ( exiFrag->AC_EVChargeParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_AC_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 0);
 			if(errn == 0) {
 				errn = encode_iso1AC_EVChargeParameterType(stream, &exiFrag->AC_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AC_EVChargeParameter */
 		} else if ( exiFrag->AC_EVSEChargeParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_AC_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 1);
 			if(errn == 0) {
 				errn = encode_iso1AC_EVSEChargeParameterType(stream, &exiFrag->AC_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AC_EVSEChargeParameter */
 		} else if ( exiFrag->AC_EVSEStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_AC_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AC_EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 2);
 			if(errn == 0) {
 				errn = encode_iso1AC_EVSEStatusType(stream, &exiFrag->AC_EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AC_EVSEStatus */
 		} else if ( exiFrag->AC_EVSEStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_AC_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}AC_EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 3);
 			if(errn == 0) {
 				errn = encode_iso1AC_EVSEStatusType(stream, &exiFrag->AC_EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AC_EVSEStatus */
 		} else if ( exiFrag->AuthorizationReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_AuthorizationReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 4);
 			if(errn == 0) {
 				errn = encode_iso1AuthorizationReqType(stream, &exiFrag->AuthorizationReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AuthorizationReq */
 		} else if ( exiFrag->AuthorizationRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_AuthorizationRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}AuthorizationRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 5);
 			if(errn == 0) {
 				errn = encode_iso1AuthorizationResType(stream, &exiFrag->AuthorizationRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_AuthorizationRes */
 		} else if ( exiFrag->Body_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDef}Body) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 6);
@@ -12445,11 +12951,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = encode_iso1BodyType(stream, &exiFrag->Body );
 			}
 		} else if ( exiFrag->BodyElement_isUsed == 1u ) { 
+#if ISO1_DEPLOY_BodyElement == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}BodyElement) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 7);
 			if(errn == 0) {
 				errn = encode_iso1BodyBaseType(stream, &exiFrag->BodyElement );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_BodyElement */
 		} else if ( exiFrag->BulkChargingComplete_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}BulkChargingComplete) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 8);
@@ -12487,23 +12997,35 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->CableCheckReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CableCheckReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 11);
 			if(errn == 0) {
 				errn = encode_iso1CableCheckReqType(stream, &exiFrag->CableCheckReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CableCheckReq */
 		} else if ( exiFrag->CableCheckRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CableCheckRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CableCheckRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 12);
 			if(errn == 0) {
 				errn = encode_iso1CableCheckResType(stream, &exiFrag->CableCheckRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CableCheckRes */
 		} else if ( exiFrag->CanonicalizationMethod_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CanonicalizationMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 13);
 			if(errn == 0) {
 				errn = encode_iso1CanonicalizationMethodType(stream, &exiFrag->CanonicalizationMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CanonicalizationMethod */
 		} else if ( exiFrag->Certificate_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Certificate) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 14);
@@ -12520,41 +13042,65 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->CertificateInstallationReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 15);
 			if(errn == 0) {
 				errn = encode_iso1CertificateInstallationReqType(stream, &exiFrag->CertificateInstallationReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CertificateInstallationReq */
 		} else if ( exiFrag->CertificateInstallationRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateInstallationRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 16);
 			if(errn == 0) {
 				errn = encode_iso1CertificateInstallationResType(stream, &exiFrag->CertificateInstallationRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CertificateInstallationRes */
 		} else if ( exiFrag->CertificateUpdateReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 17);
 			if(errn == 0) {
 				errn = encode_iso1CertificateUpdateReqType(stream, &exiFrag->CertificateUpdateReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CertificateUpdateReq */
 		} else if ( exiFrag->CertificateUpdateRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CertificateUpdateRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 18);
 			if(errn == 0) {
 				errn = encode_iso1CertificateUpdateResType(stream, &exiFrag->CertificateUpdateRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CertificateUpdateRes */
 		} else if ( exiFrag->ChargeParameterDiscoveryReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 19);
 			if(errn == 0) {
 				errn = encode_iso1ChargeParameterDiscoveryReqType(stream, &exiFrag->ChargeParameterDiscoveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryReq */
 		} else if ( exiFrag->ChargeParameterDiscoveryRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeParameterDiscoveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 20);
 			if(errn == 0) {
 				errn = encode_iso1ChargeParameterDiscoveryResType(stream, &exiFrag->ChargeParameterDiscoveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ChargeParameterDiscoveryRes */
 		} else if ( exiFrag->ChargeProgress_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargeProgress) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 21);
@@ -12646,17 +13192,25 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->ChargingStatusReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ChargingStatusReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 30);
 			if(errn == 0) {
 				errn = encode_iso1ChargingStatusReqType(stream, &exiFrag->ChargingStatusReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ChargingStatusReq */
 		} else if ( exiFrag->ChargingStatusRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ChargingStatusRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ChargingStatusRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 31);
 			if(errn == 0) {
 				errn = encode_iso1ChargingStatusResType(stream, &exiFrag->ChargingStatusRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ChargingStatusRes */
 		} else if ( exiFrag->ConsumptionCost_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ConsumptionCost) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 32);
@@ -12682,59 +13236,95 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = encode_iso1CostType(stream, &exiFrag->Cost );
 			}
 		} else if ( exiFrag->CurrentDemandReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CurrentDemandReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 36);
 			if(errn == 0) {
 				errn = encode_iso1CurrentDemandReqType(stream, &exiFrag->CurrentDemandReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CurrentDemandReq */
 		} else if ( exiFrag->CurrentDemandRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_CurrentDemandRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}CurrentDemandRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 37);
 			if(errn == 0) {
 				errn = encode_iso1CurrentDemandResType(stream, &exiFrag->CurrentDemandRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_CurrentDemandRes */
 		} else if ( exiFrag->DC_EVChargeParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DC_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 38);
 			if(errn == 0) {
 				errn = encode_iso1DC_EVChargeParameterType(stream, &exiFrag->DC_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DC_EVChargeParameter */
 		} else if ( exiFrag->DC_EVPowerDeliveryParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DC_EVPowerDeliveryParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVPowerDeliveryParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 39);
 			if(errn == 0) {
 				errn = encode_iso1DC_EVPowerDeliveryParameterType(stream, &exiFrag->DC_EVPowerDeliveryParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DC_EVPowerDeliveryParameter */
 		} else if ( exiFrag->DC_EVSEChargeParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DC_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 40);
 			if(errn == 0) {
 				errn = encode_iso1DC_EVSEChargeParameterType(stream, &exiFrag->DC_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DC_EVSEChargeParameter */
 		} else if ( exiFrag->DC_EVSEStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DC_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}DC_EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 41);
 			if(errn == 0) {
 				errn = encode_iso1DC_EVSEStatusType(stream, &exiFrag->DC_EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DC_EVSEStatus */
 		} else if ( exiFrag->DC_EVSEStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DC_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 42);
 			if(errn == 0) {
 				errn = encode_iso1DC_EVSEStatusType(stream, &exiFrag->DC_EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DC_EVSEStatus */
 		} else if ( exiFrag->DC_EVStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DC_EVStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}DC_EVStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 43);
 			if(errn == 0) {
 				errn = encode_iso1DC_EVStatusType(stream, &exiFrag->DC_EVStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DC_EVStatus */
 		} else if ( exiFrag->DC_EVStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DC_EVStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DC_EVStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 44);
 			if(errn == 0) {
 				errn = encode_iso1DC_EVStatusType(stream, &exiFrag->DC_EVStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DC_EVStatus */
 		} else if ( exiFrag->DHpublickey_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}DHpublickey) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 45);
@@ -12742,11 +13332,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = encode_iso1DiffieHellmanPublickeyType(stream, &exiFrag->DHpublickey );
 			}
 		} else if ( exiFrag->DSAKeyValue_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DSAKeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 46);
 			if(errn == 0) {
 				errn = encode_iso1DSAKeyValueType(stream, &exiFrag->DSAKeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DSAKeyValue */
 		} else if ( exiFrag->DepartureTime_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}DepartureTime) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 47);
@@ -12760,11 +13354,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->DigestMethod_isUsed == 1u ) { 
+#if ISO1_DEPLOY_DigestMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 48);
 			if(errn == 0) {
 				errn = encode_iso1DigestMethodType(stream, &exiFrag->DigestMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_DigestMethod */
 		} else if ( exiFrag->DigestValue_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 49);
@@ -12814,11 +13412,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->EVChargeParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 53);
 			if(errn == 0) {
 				errn = encode_iso1EVChargeParameterType(stream, &exiFrag->EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_EVChargeParameter */
 		} else if ( exiFrag->EVEnergyCapacity_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVEnergyCapacity) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 54);
@@ -12898,11 +13500,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = encode_iso1PhysicalValueType(stream, &exiFrag->EVMinCurrent );
 			}
 		} else if ( exiFrag->EVPowerDeliveryParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_EVPowerDeliveryParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVPowerDeliveryParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 66);
 			if(errn == 0) {
 				errn = encode_iso1EVPowerDeliveryParameterType(stream, &exiFrag->EVPowerDeliveryParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_EVPowerDeliveryParameter */
 		} else if ( exiFrag->EVRESSSOC_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVRESSSOC) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 67);
@@ -12928,11 +13534,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->EVSEChargeParameter_isUsed == 1u ) { 
+#if ISO1_DEPLOY_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 69);
 			if(errn == 0) {
 				errn = encode_iso1EVSEChargeParameterType(stream, &exiFrag->EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_EVSEChargeParameter */
 		} else if ( exiFrag->EVSECurrentLimitAchieved_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVSECurrentLimitAchieved) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 70);
@@ -12964,11 +13574,8 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->EVSEID.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->EVSEID.characters, exiFrag->EVSEID.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2013:MsgBody}EVSEID */, exiFrag->EVSEID.characters, exiFrag->EVSEID.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -13106,11 +13713,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->EVSEStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_EVSEStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 92);
 			if(errn == 0) {
 				errn = encode_iso1EVSEStatusType(stream, &exiFrag->EVSEStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_EVSEStatus */
 		} else if ( exiFrag->EVSEStatusCode_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVSEStatusCode) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 93);
@@ -13148,11 +13759,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->EVStatus_isUsed == 1u ) { 
+#if ISO1_DEPLOY_EVStatus == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}EVStatus) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 96);
 			if(errn == 0) {
 				errn = encode_iso1EVStatusType(stream, &exiFrag->EVStatus );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_EVStatus */
 		} else if ( exiFrag->EVTargetCurrent_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}EVTargetCurrent) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 97);
@@ -13178,11 +13793,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->Entry_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Entry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Entry) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 100);
 			if(errn == 0) {
 				errn = encode_iso1EntryType(stream, &exiFrag->Entry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Entry */
 		} else if ( exiFrag->Exponent_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Exponent) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 101);
@@ -13217,11 +13836,8 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->FaultMsg.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->FaultMsg.characters, exiFrag->FaultMsg.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 17 /* {urn:iso:15118:2:2013:MsgDataTypes}FaultMsg */, exiFrag->FaultMsg.characters, exiFrag->FaultMsg.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -13314,11 +13930,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->KeyInfo_isUsed == 1u ) { 
+#if ISO1_DEPLOY_KeyInfo == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 111);
 			if(errn == 0) {
 				errn = encode_iso1KeyInfoType(stream, &exiFrag->KeyInfo );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_KeyInfo */
 		} else if ( exiFrag->KeyName_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 112);
@@ -13326,21 +13946,22 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->KeyName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->KeyName.characters, exiFrag->KeyName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiFrag->KeyName.characters, exiFrag->KeyName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiFrag->KeyValue_isUsed == 1u ) { 
+#if ISO1_DEPLOY_KeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 113);
 			if(errn == 0) {
 				errn = encode_iso1KeyValueType(stream, &exiFrag->KeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_KeyValue */
 		} else if ( exiFrag->ListOfRootCertificateIDs_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ListOfRootCertificateIDs) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 114);
@@ -13348,11 +13969,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = encode_iso1ListOfRootCertificateIDsType(stream, &exiFrag->ListOfRootCertificateIDs );
 			}
 		} else if ( exiFrag->Manifest_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Manifest == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 115);
 			if(errn == 0) {
 				errn = encode_iso1ManifestType(stream, &exiFrag->Manifest );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Manifest */
 		} else if ( exiFrag->MaxEntriesSAScheduleTuple_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MaxEntriesSAScheduleTuple) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 116);
@@ -13372,11 +13997,8 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->MeterID.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->MeterID.characters, exiFrag->MeterID.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 19 /* {urn:iso:15118:2:2013:MsgDataTypes}MeterID */, exiFrag->MeterID.characters, exiFrag->MeterID.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -13412,17 +14034,25 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->MeteringReceiptReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 121);
 			if(errn == 0) {
 				errn = encode_iso1MeteringReceiptReqType(stream, &exiFrag->MeteringReceiptReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_MeteringReceiptReq */
 		} else if ( exiFrag->MeteringReceiptRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}MeteringReceiptRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 122);
 			if(errn == 0) {
 				errn = encode_iso1MeteringReceiptResType(stream, &exiFrag->MeteringReceiptRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_MeteringReceiptRes */
 		} else if ( exiFrag->MgmtData_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 123);
@@ -13430,11 +14060,8 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->MgmtData.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->MgmtData.characters, exiFrag->MgmtData.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiFrag->MgmtData.characters, exiFrag->MgmtData.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -13512,11 +14139,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->Object_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Object == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 130);
 			if(errn == 0) {
 				errn = encode_iso1ObjectType(stream, &exiFrag->Object );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Object */
 		} else if ( exiFrag->P_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}P) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 131);
@@ -13533,11 +14164,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->PGPData_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PGPData == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 132);
 			if(errn == 0) {
 				errn = encode_iso1PGPDataType(stream, &exiFrag->PGPData );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PGPData */
 		} else if ( exiFrag->PGPKeyID_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyID) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 133);
@@ -13581,11 +14216,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = encode_iso1PMaxScheduleType(stream, &exiFrag->PMaxSchedule );
 			}
 		} else if ( exiFrag->PMaxScheduleEntry_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PMaxScheduleEntry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}PMaxScheduleEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 137);
 			if(errn == 0) {
 				errn = encode_iso1PMaxScheduleEntryType(stream, &exiFrag->PMaxScheduleEntry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PMaxScheduleEntry */
 		} else if ( exiFrag->Parameter_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Parameter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 138);
@@ -13611,17 +14250,25 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->PaymentDetailsReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 141);
 			if(errn == 0) {
 				errn = encode_iso1PaymentDetailsReqType(stream, &exiFrag->PaymentDetailsReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PaymentDetailsReq */
 		} else if ( exiFrag->PaymentDetailsRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentDetailsRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 142);
 			if(errn == 0) {
 				errn = encode_iso1PaymentDetailsResType(stream, &exiFrag->PaymentDetailsRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PaymentDetailsRes */
 		} else if ( exiFrag->PaymentOption_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}PaymentOption) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 143);
@@ -13641,17 +14288,25 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = encode_iso1PaymentOptionListType(stream, &exiFrag->PaymentOptionList );
 			}
 		} else if ( exiFrag->PaymentServiceSelectionReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 145);
 			if(errn == 0) {
 				errn = encode_iso1PaymentServiceSelectionReqType(stream, &exiFrag->PaymentServiceSelectionReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionReq */
 		} else if ( exiFrag->PaymentServiceSelectionRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PaymentServiceSelectionRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 146);
 			if(errn == 0) {
 				errn = encode_iso1PaymentServiceSelectionResType(stream, &exiFrag->PaymentServiceSelectionRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PaymentServiceSelectionRes */
 		} else if ( exiFrag->PgenCounter_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PgenCounter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 147);
@@ -13668,29 +14323,45 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->PowerDeliveryReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 148);
 			if(errn == 0) {
 				errn = encode_iso1PowerDeliveryReqType(stream, &exiFrag->PowerDeliveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PowerDeliveryReq */
 		} else if ( exiFrag->PowerDeliveryRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PowerDeliveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 149);
 			if(errn == 0) {
 				errn = encode_iso1PowerDeliveryResType(stream, &exiFrag->PowerDeliveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PowerDeliveryRes */
 		} else if ( exiFrag->PreChargeReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PreChargeReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 150);
 			if(errn == 0) {
 				errn = encode_iso1PreChargeReqType(stream, &exiFrag->PreChargeReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PreChargeReq */
 		} else if ( exiFrag->PreChargeRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_PreChargeRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}PreChargeRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 151);
 			if(errn == 0) {
 				errn = encode_iso1PreChargeResType(stream, &exiFrag->PreChargeRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_PreChargeRes */
 		} else if ( exiFrag->ProfileEntry_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}ProfileEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 152);
@@ -13725,11 +14396,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->RSAKeyValue_isUsed == 1u ) { 
+#if ISO1_DEPLOY_RSAKeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 155);
 			if(errn == 0) {
 				errn = encode_iso1RSAKeyValueType(stream, &exiFrag->RSAKeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_RSAKeyValue */
 		} else if ( exiFrag->ReceiptRequired_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ReceiptRequired) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 156);
@@ -13743,17 +14418,25 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->Reference_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Reference == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 157);
 			if(errn == 0) {
 				errn = encode_iso1ReferenceType(stream, &exiFrag->Reference );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Reference */
 		} else if ( exiFrag->RelativeTimeInterval_isUsed == 1u ) { 
+#if ISO1_DEPLOY_RelativeTimeInterval == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}RelativeTimeInterval) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 158);
 			if(errn == 0) {
 				errn = encode_iso1RelativeTimeIntervalType(stream, &exiFrag->RelativeTimeInterval );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_RelativeTimeInterval */
 		} else if ( exiFrag->RemainingTimeToBulkSoC_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}RemainingTimeToBulkSoC) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 159);
@@ -13791,11 +14474,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->RetrievalMethod_isUsed == 1u ) { 
+#if ISO1_DEPLOY_RetrievalMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 163);
 			if(errn == 0) {
 				errn = encode_iso1RetrievalMethodType(stream, &exiFrag->RetrievalMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_RetrievalMethod */
 		} else if ( exiFrag->RetryCounter_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}RetryCounter) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 164);
@@ -13821,11 +14508,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				errn = encode_iso1CertificateChainType(stream, &exiFrag->SAProvisioningCertificateChain );
 			}
 		} else if ( exiFrag->SAScheduleList_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SAScheduleList == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SAScheduleList) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 167);
 			if(errn == 0) {
 				errn = encode_iso1SAScheduleListType(stream, &exiFrag->SAScheduleList );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SAScheduleList */
 		} else if ( exiFrag->SAScheduleTuple_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SAScheduleTuple) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 168);
@@ -13857,17 +14548,25 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->SASchedules_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SASchedules == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SASchedules) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 171);
 			if(errn == 0) {
 				errn = encode_iso1SASchedulesType(stream, &exiFrag->SASchedules );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SASchedules */
 		} else if ( exiFrag->SPKIData_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SPKIData == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 172);
 			if(errn == 0) {
 				errn = encode_iso1SPKIDataType(stream, &exiFrag->SPKIData );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SPKIData */
 		} else if ( exiFrag->SPKISexp_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKISexp) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 173);
@@ -13896,21 +14595,22 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->SalesTariffDescription.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->SalesTariffDescription.characters, exiFrag->SalesTariffDescription.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 21 /* {urn:iso:15118:2:2013:MsgDataTypes}SalesTariffDescription */, exiFrag->SalesTariffDescription.characters, exiFrag->SalesTariffDescription.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiFrag->SalesTariffEntry_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SalesTariffEntry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SalesTariffEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 176);
 			if(errn == 0) {
 				errn = encode_iso1SalesTariffEntryType(stream, &exiFrag->SalesTariffEntry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SalesTariffEntry */
 		} else if ( exiFrag->SalesTariffID_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SalesTariffID) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 177);
@@ -13993,29 +14693,45 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->ServiceDetailReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ServiceDetailReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 185);
 			if(errn == 0) {
 				errn = encode_iso1ServiceDetailReqType(stream, &exiFrag->ServiceDetailReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ServiceDetailReq */
 		} else if ( exiFrag->ServiceDetailRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ServiceDetailRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDetailRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 186);
 			if(errn == 0) {
 				errn = encode_iso1ServiceDetailResType(stream, &exiFrag->ServiceDetailRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ServiceDetailRes */
 		} else if ( exiFrag->ServiceDiscoveryReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 187);
 			if(errn == 0) {
 				errn = encode_iso1ServiceDiscoveryReqType(stream, &exiFrag->ServiceDiscoveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ServiceDiscoveryReq */
 		} else if ( exiFrag->ServiceDiscoveryRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceDiscoveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 188);
 			if(errn == 0) {
 				errn = encode_iso1ServiceDiscoveryResType(stream, &exiFrag->ServiceDiscoveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_ServiceDiscoveryRes */
 		} else if ( exiFrag->ServiceID_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}ServiceID) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 189);
@@ -14053,11 +14769,8 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->ServiceName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->ServiceName.characters, exiFrag->ServiceName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 22 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceName */, exiFrag->ServiceName.characters, exiFrag->ServiceName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -14075,11 +14788,8 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->ServiceScope.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->ServiceScope.characters, exiFrag->ServiceScope.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {urn:iso:15118:2:2013:MsgBody}ServiceScope */, exiFrag->ServiceScope.characters, exiFrag->ServiceScope.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -14091,11 +14801,8 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->ServiceScope.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->ServiceScope.characters, exiFrag->ServiceScope.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 23 /* {urn:iso:15118:2:2013:MsgDataTypes}ServiceScope */, exiFrag->ServiceScope.characters, exiFrag->ServiceScope.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -14131,29 +14838,45 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->SessionSetupReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SessionSetupReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 198);
 			if(errn == 0) {
 				errn = encode_iso1SessionSetupReqType(stream, &exiFrag->SessionSetupReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SessionSetupReq */
 		} else if ( exiFrag->SessionSetupRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SessionSetupRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionSetupRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 199);
 			if(errn == 0) {
 				errn = encode_iso1SessionSetupResType(stream, &exiFrag->SessionSetupRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SessionSetupRes */
 		} else if ( exiFrag->SessionStopReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SessionStopReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 200);
 			if(errn == 0) {
 				errn = encode_iso1SessionStopReqType(stream, &exiFrag->SessionStopReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SessionStopReq */
 		} else if ( exiFrag->SessionStopRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SessionStopRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}SessionStopRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 201);
 			if(errn == 0) {
 				errn = encode_iso1SessionStopResType(stream, &exiFrag->SessionStopRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SessionStopRes */
 		} else if ( exiFrag->SigMeterReading_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SigMeterReading) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 202);
@@ -14170,41 +14893,65 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->Signature_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Signature == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 203);
 			if(errn == 0) {
 				errn = encode_iso1SignatureType(stream, &exiFrag->Signature );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Signature */
 		} else if ( exiFrag->SignatureMethod_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SignatureMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 204);
 			if(errn == 0) {
 				errn = encode_iso1SignatureMethodType(stream, &exiFrag->SignatureMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SignatureMethod */
 		} else if ( exiFrag->SignatureProperties_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SignatureProperties == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 205);
 			if(errn == 0) {
 				errn = encode_iso1SignaturePropertiesType(stream, &exiFrag->SignatureProperties );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SignatureProperties */
 		} else if ( exiFrag->SignatureProperty_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SignatureProperty == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 206);
 			if(errn == 0) {
 				errn = encode_iso1SignaturePropertyType(stream, &exiFrag->SignatureProperty );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SignatureProperty */
 		} else if ( exiFrag->SignatureValue_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SignatureValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 207);
 			if(errn == 0) {
 				errn = encode_iso1SignatureValueType(stream, &exiFrag->SignatureValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SignatureValue */
 		} else if ( exiFrag->SignedInfo_isUsed == 1u ) { 
+#if ISO1_DEPLOY_SignedInfo == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 208);
 			if(errn == 0) {
 				errn = encode_iso1SignedInfoType(stream, &exiFrag->SignedInfo );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_SignedInfo */
 		} else if ( exiFrag->SubCertificates_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}SubCertificates) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 209);
@@ -14230,23 +14977,35 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->TimeInterval_isUsed == 1u ) { 
+#if ISO1_DEPLOY_TimeInterval == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}TimeInterval) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 212);
 			if(errn == 0) {
 				errn = encode_iso1IntervalType(stream, &exiFrag->TimeInterval );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_TimeInterval */
 		} else if ( exiFrag->Transform_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Transform == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 213);
 			if(errn == 0) {
 				errn = encode_iso1TransformType(stream, &exiFrag->Transform );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Transform */
 		} else if ( exiFrag->Transforms_isUsed == 1u ) { 
+#if ISO1_DEPLOY_Transforms == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 214);
 			if(errn == 0) {
 				errn = encode_iso1TransformsType(stream, &exiFrag->Transforms );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_Transforms */
 		} else if ( exiFrag->Unit_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Unit) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 215);
@@ -14260,11 +15019,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->V2G_Message_isUsed == 1u ) { 
+#if ISO1_DEPLOY_V2G_Message == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDef}V2G_Message) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 216);
 			if(errn == 0) {
 				errn = encode_iso1AnonType_V2G_Message(stream, &exiFrag->V2G_Message );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_V2G_Message */
 		} else if ( exiFrag->Value_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgDataTypes}Value) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 217);
@@ -14278,17 +15041,25 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->WeldingDetectionReq_isUsed == 1u ) { 
+#if ISO1_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionReq) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 218);
 			if(errn == 0) {
 				errn = encode_iso1WeldingDetectionReqType(stream, &exiFrag->WeldingDetectionReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_WeldingDetectionReq */
 		} else if ( exiFrag->WeldingDetectionRes_isUsed == 1u ) { 
+#if ISO1_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2013:MsgBody}WeldingDetectionRes) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 219);
 			if(errn == 0) {
 				errn = encode_iso1WeldingDetectionResType(stream, &exiFrag->WeldingDetectionRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_WeldingDetectionRes */
 		} else if ( exiFrag->X509CRL_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509CRL) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 220);
@@ -14320,11 +15091,15 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->X509Data_isUsed == 1u ) { 
+#if ISO1_DEPLOY_X509Data == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 222);
 			if(errn == 0) {
 				errn = encode_iso1X509DataType(stream, &exiFrag->X509Data );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO1_DEPLOY_X509Data */
 		} else if ( exiFrag->X509IssuerName_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerName) */
 			errn = encodeNBitUnsignedInteger(stream, 8, 223);
@@ -14332,11 +15107,8 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->X509IssuerName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->X509IssuerName.characters, exiFrag->X509IssuerName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, exiFrag->X509IssuerName.characters, exiFrag->X509IssuerName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -14381,11 +15153,8 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->X509SubjectName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->X509SubjectName.characters, exiFrag->X509SubjectName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, exiFrag->X509SubjectName.characters, exiFrag->X509SubjectName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -14397,11 +15166,8 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->XPath.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->XPath.characters, exiFrag->XPath.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, exiFrag->XPath.characters, exiFrag->XPath.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -14554,11 +15320,8 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->stringValue.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->stringValue.characters, exiFrag->stringValue.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 24 /* {urn:iso:15118:2:2013:MsgDataTypes}stringValue */, exiFrag->stringValue.characters, exiFrag->stringValue.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -14580,6 +15343,37 @@ int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag)
 
 	return errn;
 }
+int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag) {
+	int errn = writeEXIHeader(stream);
+
+	if(errn == 0) {
+		errn = encode_iso1ExiFragmentContent(stream, exiFrag);
+	}
+
+	return errn;
+}
+
+#if EXI_STREAM == BYTE_ARRAY && ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+int encode_iso1ExiFragmentDigest(bitstream_t* stream, struct iso1EXIFragment* exiFrag, uint8_t* digest) {
+	exi_sha256_t sha256;
+	int errn;
+
+	/* the bytes are hashed while they are written, no second pass over the stream */
+	exiSha256Init(&sha256);
+	errn = writeEXIHeaderDigest(stream, &sha256);
+
+	if(errn == 0) {
+		errn = encode_iso1ExiFragmentContent(stream, exiFrag);
+	}
+	stream->digest = NULL;
+
+	if(errn == 0) {
+		exiSha256Final(&sha256, digest);
+	}
+
+	return errn;
+}
+#endif /* ENCODER_DIGEST_SHA256 */
 #endif /* DEPLOY_ISO1_CODEC_FRAGMENT */
 
 
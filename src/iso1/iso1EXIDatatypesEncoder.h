@@ -56,6 +56,11 @@ int encode_iso1ExiDocument(bitstream_t* stream, struct iso1EXIDocument* exiDoc);
 
 #if DEPLOY_ISO1_CODEC_FRAGMENT == SUPPORT_YES
 int encode_iso1ExiFragment(bitstream_t* stream, struct iso1EXIFragment* exiFrag);
+#if EXI_STREAM == BYTE_ARRAY && ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+/* Encodes the fragment and returns the SHA-256 of the encoded bytes in digest (EXI_SHA256_DIGEST_SIZE bytes).
+ * With stream->data == NULL only the digest is computed, *stream->pos is the length of the fragment. */
+int encode_iso1ExiFragmentDigest(bitstream_t* stream, struct iso1EXIFragment* exiFrag, uint8_t* digest);
+#endif /* ENCODER_DIGEST_SHA256 */
 #endif /* DEPLOY_ISO1_CODEC_FRAGMENT */
 
 
@@ -0,0 +1,264 @@
+/*******************************************************************
+ * Per message deployment of the iso1 codec, generated by tools/deploy_messages.py
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+/**
+ * \file 	iso1EXIDeploy.h
+ * \brief 	Switches for the root elements (messages) of the iso1 codec
+ *
+ * 			A disabled element is not decoded or encoded (unknown event code) and
+ * 			its type functions are not compiled. A build for a charge controller
+ * 			with few messages sets ISO1_DEPLOY_DEFAULT to SUPPORT_NO and
+ * 			enables V2G_Message and the messages it needs, e.g. with
+ * 			-DISO1_DEPLOY_DEFAULT=SUPPORT_NO -DISO1_DEPLOY_V2G_Message=SUPPORT_YES ...
+ *
+ */
+
+#ifndef EXI_iso1_DEPLOY_H
+#define EXI_iso1_DEPLOY_H
+
+/** Default of all switches below */
+#ifndef ISO1_DEPLOY_DEFAULT
+#define ISO1_DEPLOY_DEFAULT SUPPORT_YES
+#endif
+
+/* Messages (V2G_Message Body) */
+#ifndef ISO1_DEPLOY_AuthorizationReq
+#define ISO1_DEPLOY_AuthorizationReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_AuthorizationRes
+#define ISO1_DEPLOY_AuthorizationRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_BodyElement
+#define ISO1_DEPLOY_BodyElement ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_CableCheckReq
+#define ISO1_DEPLOY_CableCheckReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_CableCheckRes
+#define ISO1_DEPLOY_CableCheckRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_CertificateInstallationReq
+#define ISO1_DEPLOY_CertificateInstallationReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_CertificateInstallationRes
+#define ISO1_DEPLOY_CertificateInstallationRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_CertificateUpdateReq
+#define ISO1_DEPLOY_CertificateUpdateReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_CertificateUpdateRes
+#define ISO1_DEPLOY_CertificateUpdateRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_ChargeParameterDiscoveryReq
+#define ISO1_DEPLOY_ChargeParameterDiscoveryReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_ChargeParameterDiscoveryRes
+#define ISO1_DEPLOY_ChargeParameterDiscoveryRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_ChargingStatusReq
+#define ISO1_DEPLOY_ChargingStatusReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_ChargingStatusRes
+#define ISO1_DEPLOY_ChargingStatusRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_CurrentDemandReq
+#define ISO1_DEPLOY_CurrentDemandReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_CurrentDemandRes
+#define ISO1_DEPLOY_CurrentDemandRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_MeteringReceiptReq
+#define ISO1_DEPLOY_MeteringReceiptReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_MeteringReceiptRes
+#define ISO1_DEPLOY_MeteringReceiptRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_PaymentDetailsReq
+#define ISO1_DEPLOY_PaymentDetailsReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_PaymentDetailsRes
+#define ISO1_DEPLOY_PaymentDetailsRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_PaymentServiceSelectionReq
+#define ISO1_DEPLOY_PaymentServiceSelectionReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_PaymentServiceSelectionRes
+#define ISO1_DEPLOY_PaymentServiceSelectionRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_PowerDeliveryReq
+#define ISO1_DEPLOY_PowerDeliveryReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_PowerDeliveryRes
+#define ISO1_DEPLOY_PowerDeliveryRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_PreChargeReq
+#define ISO1_DEPLOY_PreChargeReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_PreChargeRes
+#define ISO1_DEPLOY_PreChargeRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_ServiceDetailReq
+#define ISO1_DEPLOY_ServiceDetailReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_ServiceDetailRes
+#define ISO1_DEPLOY_ServiceDetailRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_ServiceDiscoveryReq
+#define ISO1_DEPLOY_ServiceDiscoveryReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_ServiceDiscoveryRes
+#define ISO1_DEPLOY_ServiceDiscoveryRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SessionSetupReq
+#define ISO1_DEPLOY_SessionSetupReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SessionSetupRes
+#define ISO1_DEPLOY_SessionSetupRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SessionStopReq
+#define ISO1_DEPLOY_SessionStopReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SessionStopRes
+#define ISO1_DEPLOY_SessionStopRes ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_WeldingDetectionReq
+#define ISO1_DEPLOY_WeldingDetectionReq ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_WeldingDetectionRes
+#define ISO1_DEPLOY_WeldingDetectionRes ISO1_DEPLOY_DEFAULT
+#endif
+
+/* Other root elements (V2G_Message, fragments and signatures) */
+#ifndef ISO1_DEPLOY_AC_EVChargeParameter
+#define ISO1_DEPLOY_AC_EVChargeParameter ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_AC_EVSEChargeParameter
+#define ISO1_DEPLOY_AC_EVSEChargeParameter ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_AC_EVSEStatus
+#define ISO1_DEPLOY_AC_EVSEStatus ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_CanonicalizationMethod
+#define ISO1_DEPLOY_CanonicalizationMethod ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_DC_EVChargeParameter
+#define ISO1_DEPLOY_DC_EVChargeParameter ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_DC_EVPowerDeliveryParameter
+#define ISO1_DEPLOY_DC_EVPowerDeliveryParameter ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_DC_EVSEChargeParameter
+#define ISO1_DEPLOY_DC_EVSEChargeParameter ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_DC_EVSEStatus
+#define ISO1_DEPLOY_DC_EVSEStatus ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_DC_EVStatus
+#define ISO1_DEPLOY_DC_EVStatus ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_DSAKeyValue
+#define ISO1_DEPLOY_DSAKeyValue ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_DigestMethod
+#define ISO1_DEPLOY_DigestMethod ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_EVChargeParameter
+#define ISO1_DEPLOY_EVChargeParameter ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_EVPowerDeliveryParameter
+#define ISO1_DEPLOY_EVPowerDeliveryParameter ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_EVSEChargeParameter
+#define ISO1_DEPLOY_EVSEChargeParameter ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_EVSEStatus
+#define ISO1_DEPLOY_EVSEStatus ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_EVStatus
+#define ISO1_DEPLOY_EVStatus ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_Entry
+#define ISO1_DEPLOY_Entry ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_KeyInfo
+#define ISO1_DEPLOY_KeyInfo ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_KeyValue
+#define ISO1_DEPLOY_KeyValue ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_Manifest
+#define ISO1_DEPLOY_Manifest ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_Object
+#define ISO1_DEPLOY_Object ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_PGPData
+#define ISO1_DEPLOY_PGPData ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_PMaxScheduleEntry
+#define ISO1_DEPLOY_PMaxScheduleEntry ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_RSAKeyValue
+#define ISO1_DEPLOY_RSAKeyValue ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_Reference
+#define ISO1_DEPLOY_Reference ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_RelativeTimeInterval
+#define ISO1_DEPLOY_RelativeTimeInterval ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_RetrievalMethod
+#define ISO1_DEPLOY_RetrievalMethod ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SAScheduleList
+#define ISO1_DEPLOY_SAScheduleList ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SASchedules
+#define ISO1_DEPLOY_SASchedules ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SPKIData
+#define ISO1_DEPLOY_SPKIData ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SalesTariffEntry
+#define ISO1_DEPLOY_SalesTariffEntry ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_Signature
+#define ISO1_DEPLOY_Signature ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SignatureMethod
+#define ISO1_DEPLOY_SignatureMethod ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SignatureProperties
+#define ISO1_DEPLOY_SignatureProperties ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SignatureProperty
+#define ISO1_DEPLOY_SignatureProperty ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SignatureValue
+#define ISO1_DEPLOY_SignatureValue ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_SignedInfo
+#define ISO1_DEPLOY_SignedInfo ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_TimeInterval
+#define ISO1_DEPLOY_TimeInterval ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_Transform
+#define ISO1_DEPLOY_Transform ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_Transforms
+#define ISO1_DEPLOY_Transforms ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_V2G_Message
+#define ISO1_DEPLOY_V2G_Message ISO1_DEPLOY_DEFAULT
+#endif
+#ifndef ISO1_DEPLOY_X509Data
+#define ISO1_DEPLOY_X509Data ISO1_DEPLOY_DEFAULT
+#endif
+
+#endif /* EXI_iso1_DEPLOY_H */
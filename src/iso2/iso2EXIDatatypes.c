@@ -637,9 +637,11 @@ void init_iso2RetrievalMethodType(struct iso2RetrievalMethodType* iso2RetrievalM
 	iso2RetrievalMethodType->Transforms_isUsed = 0u;
 }
 
+#if ISO2_DEPLOY_AuthorizationRes == SUPPORT_YES
 void init_iso2AuthorizationResType(struct iso2AuthorizationResType* iso2AuthorizationResType) {
 	iso2AuthorizationResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_AuthorizationRes */
 
 void init_iso2MV_EVSEFinePositioningSetupParametersType(struct iso2MV_EVSEFinePositioningSetupParametersType* iso2MV_EVSEFinePositioningSetupParametersType) {
 	iso2MV_EVSEFinePositioningSetupParametersType->FrequencyChannel_isUsed = 0u;
@@ -659,6 +661,7 @@ void init_iso2RSAKeyValueType(struct iso2RSAKeyValueType* iso2RSAKeyValueType) {
 	(void)iso2RSAKeyValueType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_DC_BidirectionalControlRes == SUPPORT_YES
 void init_iso2DC_BidirectionalControlResType(struct iso2DC_BidirectionalControlResType* iso2DC_BidirectionalControlResType) {
 	iso2DC_BidirectionalControlResType->EVSEStatus_isUsed = 0u;
 	iso2DC_BidirectionalControlResType->EVSEMaximumChargePower_isUsed = 0u;
@@ -671,11 +674,13 @@ void init_iso2DC_BidirectionalControlResType(struct iso2DC_BidirectionalControlR
 	iso2DC_BidirectionalControlResType->MeterInfo_isUsed = 0u;
 	iso2DC_BidirectionalControlResType->ReceiptRequired_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlRes */
 
 void init_iso2CostType(struct iso2CostType* iso2CostType) {
 	(void)iso2CostType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_ChargingStatusRes == SUPPORT_YES
 void init_iso2ChargingStatusResType(struct iso2ChargingStatusResType* iso2ChargingStatusResType) {
 	iso2ChargingStatusResType->EVSEStatus_isUsed = 0u;
 	iso2ChargingStatusResType->SAScheduleTupleID_isUsed = 0u;
@@ -683,6 +688,7 @@ void init_iso2ChargingStatusResType(struct iso2ChargingStatusResType* iso2Chargi
 	iso2ChargingStatusResType->ReceiptRequired_isUsed = 0u;
 	iso2ChargingStatusResType->EVSETargetPower_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_ChargingStatusRes */
 
 void init_iso2MeterInfoType(struct iso2MeterInfoType* iso2MeterInfoType) {
 	iso2MeterInfoType->MeterReadingCharged_isUsed = 0u;
@@ -702,21 +708,27 @@ void init_iso2AC_EVSEBidirectionalParameterType(struct iso2AC_EVSEBidirectionalP
 	(void)iso2AC_EVSEBidirectionalParameterType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_VehicleCheckOutRes == SUPPORT_YES
 void init_iso2VehicleCheckOutResType(struct iso2VehicleCheckOutResType* iso2VehicleCheckOutResType) {
 	iso2VehicleCheckOutResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_VehicleCheckOutRes */
 
 void init_iso2MagneticVectorListType(struct iso2MagneticVectorListType* iso2MagneticVectorListType) {
 	iso2MagneticVectorListType->MagneticVector.arrayLen = 0u;
 }
 
+#if ISO2_DEPLOY_CableCheckRes == SUPPORT_YES
 void init_iso2CableCheckResType(struct iso2CableCheckResType* iso2CableCheckResType) {
 	iso2CableCheckResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_CableCheckRes */
 
+#if ISO2_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 void init_iso2ServiceDiscoveryReqType(struct iso2ServiceDiscoveryReqType* iso2ServiceDiscoveryReqType) {
 	iso2ServiceDiscoveryReqType->SupportedServiceIDs_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_ServiceDiscoveryReq */
 
 void init_iso2ServiceType(struct iso2ServiceType* iso2ServiceType) {
 	(void)iso2ServiceType; /* avoid unused warning */
@@ -730,10 +742,12 @@ void init_iso2PMaxScheduleType(struct iso2PMaxScheduleType* iso2PMaxScheduleType
 	iso2PMaxScheduleType->PMaxScheduleEntry.arrayLen = 0u;
 }
 
+#if ISO2_DEPLOY_SignatureProperties == SUPPORT_YES
 void init_iso2SignaturePropertiesType(struct iso2SignaturePropertiesType* iso2SignaturePropertiesType) {
 	iso2SignaturePropertiesType->Id_isUsed = 0u;
 	iso2SignaturePropertiesType->SignatureProperty.arrayLen = 0u;
 }
+#endif /* ISO2_DEPLOY_SignatureProperties */
 
 void init_iso2PMaxScheduleEntryType(struct iso2PMaxScheduleEntryType* iso2PMaxScheduleEntryType) {
 	iso2PMaxScheduleEntryType->PMax.arrayLen = 0u;
@@ -745,42 +759,56 @@ void init_iso2SignatureType(struct iso2SignatureType* iso2SignatureType) {
 	iso2SignatureType->Object.arrayLen = 0u;
 }
 
+#if ISO2_DEPLOY_VehicleCheckInReq == SUPPORT_YES
 void init_iso2VehicleCheckInReqType(struct iso2VehicleCheckInReqType* iso2VehicleCheckInReqType) {
 	iso2VehicleCheckInReqType->ParkingMethod_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_VehicleCheckInReq */
 
+#if ISO2_DEPLOY_ConnectChargingDeviceRes == SUPPORT_YES
 void init_iso2ConnectChargingDeviceResType(struct iso2ConnectChargingDeviceResType* iso2ConnectChargingDeviceResType) {
 	iso2ConnectChargingDeviceResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceRes */
 
+#if ISO2_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 void init_iso2WeldingDetectionResType(struct iso2WeldingDetectionResType* iso2WeldingDetectionResType) {
 	iso2WeldingDetectionResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_WeldingDetectionRes */
 
+#if ISO2_DEPLOY_SessionStopRes == SUPPORT_YES
 void init_iso2SessionStopResType(struct iso2SessionStopResType* iso2SessionStopResType) {
 	iso2SessionStopResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_SessionStopRes */
 
+#if ISO2_DEPLOY_VehicleCheckInRes == SUPPORT_YES
 void init_iso2VehicleCheckInResType(struct iso2VehicleCheckInResType* iso2VehicleCheckInResType) {
 	iso2VehicleCheckInResType->EVSEStatus_isUsed = 0u;
 	iso2VehicleCheckInResType->TargetOffset_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_VehicleCheckInRes */
 
 void init_iso2ServiceListType(struct iso2ServiceListType* iso2ServiceListType) {
 	iso2ServiceListType->Service.arrayLen = 0u;
 }
 
+#if ISO2_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 void init_iso2CertificateUpdateResType(struct iso2CertificateUpdateResType* iso2CertificateUpdateResType) {
 	iso2CertificateUpdateResType->EVSEStatus_isUsed = 0u;
 	iso2CertificateUpdateResType->RetryCounter_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_CertificateUpdateRes */
 
+#if ISO2_DEPLOY_FinePositioningSetupRes == SUPPORT_YES
 void init_iso2FinePositioningSetupResType(struct iso2FinePositioningSetupResType* iso2FinePositioningSetupResType) {
 	iso2FinePositioningSetupResType->EVSEStatus_isUsed = 0u;
 	iso2FinePositioningSetupResType->EVSEFinePositioningSetupParameters_isUsed = 0u;
 	iso2FinePositioningSetupResType->LFA_EVSEFinePositioningSetupParameters_isUsed = 0u;
 	iso2FinePositioningSetupResType->MV_EVSEFinePositioningSetupParameters_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_FinePositioningSetupRes */
 
 void init_iso2AC_EVBidirectionalParameterType(struct iso2AC_EVBidirectionalParameterType* iso2AC_EVBidirectionalParameterType) {
 	iso2AC_EVBidirectionalParameterType->EVTargetEnergyRequest_isUsed = 0u;
@@ -788,6 +816,7 @@ void init_iso2AC_EVBidirectionalParameterType(struct iso2AC_EVBidirectionalParam
 	iso2AC_EVBidirectionalParameterType->EVMinimumEnergyRequest_isUsed = 0u;
 }
 
+#if ISO2_DEPLOY_DC_BidirectionalControlReq == SUPPORT_YES
 void init_iso2DC_BidirectionalControlReqType(struct iso2DC_BidirectionalControlReqType* iso2DC_BidirectionalControlReqType) {
 	iso2DC_BidirectionalControlReqType->EVMaximumEnergyRequest_isUsed = 0u;
 	iso2DC_BidirectionalControlReqType->EVMinimumEnergyRequest_isUsed = 0u;
@@ -796,10 +825,13 @@ void init_iso2DC_BidirectionalControlReqType(struct iso2DC_BidirectionalControlR
 	iso2DC_BidirectionalControlReqType->EVMaximumChargePower_isUsed = 0u;
 	iso2DC_BidirectionalControlReqType->EVMaximumDischargePower_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlReq */
 
+#if ISO2_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 void init_iso2CertificateUpdateReqType(struct iso2CertificateUpdateReqType* iso2CertificateUpdateReqType) {
 	(void)iso2CertificateUpdateReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_CertificateUpdateReq */
 
 void init_iso2ConsumptionCostType(struct iso2ConsumptionCostType* iso2ConsumptionCostType) {
 	iso2ConsumptionCostType->Cost.arrayLen = 0u;
@@ -833,13 +865,17 @@ void init_iso2EVFinePositioningParametersType(struct iso2EVFinePositioningParame
 	(void)iso2EVFinePositioningParametersType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_AlignmentCheckReq == SUPPORT_YES
 void init_iso2AlignmentCheckReqType(struct iso2AlignmentCheckReqType* iso2AlignmentCheckReqType) {
 	iso2AlignmentCheckReqType->AlignmentCheckParameters_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_AlignmentCheckReq */
 
+#if ISO2_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 void init_iso2CertificateInstallationReqType(struct iso2CertificateInstallationReqType* iso2CertificateInstallationReqType) {
 	(void)iso2CertificateInstallationReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_CertificateInstallationReq */
 
 void init_iso2TransformsType(struct iso2TransformsType* iso2TransformsType) {
 	iso2TransformsType->Transform.arrayLen = 0u;
@@ -856,6 +892,7 @@ void init_iso2SensorOrderListType(struct iso2SensorOrderListType* iso2SensorOrde
 	iso2SensorOrderListType->SensorPosition.arrayLen = 0u;
 }
 
+#if ISO2_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 void init_iso2ChargeParameterDiscoveryReqType(struct iso2ChargeParameterDiscoveryReqType* iso2ChargeParameterDiscoveryReqType) {
 	iso2ChargeParameterDiscoveryReqType->MaxSupportingPoints_isUsed = 0u;
 	iso2ChargeParameterDiscoveryReqType->EVEnergyTransferParameter_isUsed = 0u;
@@ -866,6 +903,7 @@ void init_iso2ChargeParameterDiscoveryReqType(struct iso2ChargeParameterDiscover
 	iso2ChargeParameterDiscoveryReqType->WPT_EVChargeParameter_isUsed = 0u;
 	iso2ChargeParameterDiscoveryReqType->MinimumPMaxRequest_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryReq */
 
 void init_iso2ParameterType(struct iso2ParameterType* iso2ParameterType) {
 	iso2ParameterType->boolValue_isUsed = 0u;
@@ -876,9 +914,11 @@ void init_iso2ParameterType(struct iso2ParameterType* iso2ParameterType) {
 	iso2ParameterType->stringValue_isUsed = 0u;
 }
 
+#if ISO2_DEPLOY_SessionStopReq == SUPPORT_YES
 void init_iso2SessionStopReqType(struct iso2SessionStopReqType* iso2SessionStopReqType) {
 	(void)iso2SessionStopReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_SessionStopReq */
 
 void init_iso2SensorMeasurementsType(struct iso2SensorMeasurementsType* iso2SensorMeasurementsType) {
 	(void)iso2SensorMeasurementsType; /* avoid unused warning */
@@ -939,9 +979,11 @@ void init_iso2WPT_EVChargeParameterType(struct iso2WPT_EVChargeParameterType* is
 	iso2WPT_EVChargeParameterType->EVMinimumEnergyRequest_isUsed = 0u;
 }
 
+#if ISO2_DEPLOY_DisconnectChargingDeviceReq == SUPPORT_YES
 void init_iso2DisconnectChargingDeviceReqType(struct iso2DisconnectChargingDeviceReqType* iso2DisconnectChargingDeviceReqType) {
 	(void)iso2DisconnectChargingDeviceReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceReq */
 
 void init_iso2ChargeLoopReqType(struct iso2ChargeLoopReqType* iso2ChargeLoopReqType) {
 	iso2ChargeLoopReqType->EVMaximumEnergyRequest_isUsed = 0u;
@@ -953,15 +995,20 @@ void init_iso2V2GRequestType(struct iso2V2GRequestType* iso2V2GRequestType) {
 	(void)iso2V2GRequestType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 void init_iso2MeteringReceiptResType(struct iso2MeteringReceiptResType* iso2MeteringReceiptResType) {
 	iso2MeteringReceiptResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_MeteringReceiptRes */
 
+#if ISO2_DEPLOY_SessionSetupRes == SUPPORT_YES
 void init_iso2SessionSetupResType(struct iso2SessionSetupResType* iso2SessionSetupResType) {
 	iso2SessionSetupResType->EVSEStatus_isUsed = 0u;
 	iso2SessionSetupResType->EVSETimeStamp_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_SessionSetupRes */
 
+#if ISO2_DEPLOY_AC_BidirectionalControlReq == SUPPORT_YES
 void init_iso2AC_BidirectionalControlReqType(struct iso2AC_BidirectionalControlReqType* iso2AC_BidirectionalControlReqType) {
 	iso2AC_BidirectionalControlReqType->EVMaximumEnergyRequest_isUsed = 0u;
 	iso2AC_BidirectionalControlReqType->EVMinimumEnergyRequest_isUsed = 0u;
@@ -971,6 +1018,7 @@ void init_iso2AC_BidirectionalControlReqType(struct iso2AC_BidirectionalControlR
 	iso2AC_BidirectionalControlReqType->EVMaximumDischargeCurrent_isUsed = 0u;
 	iso2AC_BidirectionalControlReqType->EVMinimumDischargeCurrent_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlReq */
 
 void init_iso2MV_EVSEFinePositioningParametersType(struct iso2MV_EVSEFinePositioningParametersType* iso2MV_EVSEFinePositioningParametersType) {
 	(void)iso2MV_EVSEFinePositioningParametersType; /* avoid unused warning */
@@ -987,9 +1035,11 @@ void init_iso2EVSEEnergyTransferParameterType(struct iso2EVSEEnergyTransferParam
 	(void)iso2EVSEEnergyTransferParameterType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 void init_iso2MeteringReceiptReqType(struct iso2MeteringReceiptReqType* iso2MeteringReceiptReqType) {
 	iso2MeteringReceiptReqType->SAScheduleTupleID_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_MeteringReceiptReq */
 
 void init_iso2KeyValueType(struct iso2KeyValueType* iso2KeyValueType) {
 	iso2KeyValueType->DSAKeyValue_isUsed = 0u;
@@ -1001,6 +1051,7 @@ void init_iso2SensorListType(struct iso2SensorListType* iso2SensorListType) {
 	iso2SensorListType->Sensor.arrayLen = 0u;
 }
 
+#if ISO2_DEPLOY_CurrentDemandReq == SUPPORT_YES
 void init_iso2CurrentDemandReqType(struct iso2CurrentDemandReqType* iso2CurrentDemandReqType) {
 	iso2CurrentDemandReqType->EVMaximumEnergyRequest_isUsed = 0u;
 	iso2CurrentDemandReqType->EVMinimumEnergyRequest_isUsed = 0u;
@@ -1009,11 +1060,14 @@ void init_iso2CurrentDemandReqType(struct iso2CurrentDemandReqType* iso2CurrentD
 	iso2CurrentDemandReqType->EVMaximumPower_isUsed = 0u;
 	iso2CurrentDemandReqType->EVMaximumVoltage_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_CurrentDemandReq */
 
+#if ISO2_DEPLOY_FinePositioningSetupReq == SUPPORT_YES
 void init_iso2FinePositioningSetupReqType(struct iso2FinePositioningSetupReqType* iso2FinePositioningSetupReqType) {
 	iso2FinePositioningSetupReqType->EVFinePositioningSetupParameters_isUsed = 0u;
 	iso2FinePositioningSetupReqType->LFA_EVFinePositioningSetupParameters_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_FinePositioningSetupReq */
 
 void init_iso2LFA_EVFinePositioningSetupParametersType(struct iso2LFA_EVFinePositioningSetupParametersType* iso2LFA_EVFinePositioningSetupParametersType) {
 	(void)iso2LFA_EVFinePositioningSetupParametersType; /* avoid unused warning */
@@ -1029,6 +1083,7 @@ void init_iso2WPT_EVSEChargeParameterType(struct iso2WPT_EVSEChargeParameterType
 	(void)iso2WPT_EVSEChargeParameterType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_FinePositioningRes == SUPPORT_YES
 void init_iso2FinePositioningResType(struct iso2FinePositioningResType* iso2FinePositioningResType) {
 	iso2FinePositioningResType->EVSEStatus_isUsed = 0u;
 	iso2FinePositioningResType->EVSEFinePositioningParameters_isUsed = 0u;
@@ -1036,31 +1091,40 @@ void init_iso2FinePositioningResType(struct iso2FinePositioningResType* iso2Fine
 	iso2FinePositioningResType->LFA_EVSEFinePositioningParameters_isUsed = 0u;
 	iso2FinePositioningResType->MV_EVSEFinePositioningParameters_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_FinePositioningRes */
 
 void init_iso2BodyBaseType(struct iso2BodyBaseType* iso2BodyBaseType) {
 	(void)iso2BodyBaseType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_ServiceDetailRes == SUPPORT_YES
 void init_iso2ServiceDetailResType(struct iso2ServiceDetailResType* iso2ServiceDetailResType) {
 	iso2ServiceDetailResType->EVSEStatus_isUsed = 0u;
 	iso2ServiceDetailResType->ServiceParameterList_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_ServiceDetailRes */
 
+#if ISO2_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 void init_iso2PowerDeliveryReqType(struct iso2PowerDeliveryReqType* iso2PowerDeliveryReqType) {
 	iso2PowerDeliveryReqType->EVOperation_isUsed = 0u;
 	iso2PowerDeliveryReqType->SAScheduleTupleID_isUsed = 0u;
 	iso2PowerDeliveryReqType->ChargingProfile_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_PowerDeliveryReq */
 
+#if ISO2_DEPLOY_PairingRes == SUPPORT_YES
 void init_iso2PairingResType(struct iso2PairingResType* iso2PairingResType) {
 	iso2PairingResType->EVSEStatus_isUsed = 0u;
 	iso2PairingResType->PairingParameters_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_PairingRes */
 
+#if ISO2_DEPLOY_AuthorizationReq == SUPPORT_YES
 void init_iso2AuthorizationReqType(struct iso2AuthorizationReqType* iso2AuthorizationReqType) {
 	iso2AuthorizationReqType->Id_isUsed = 0u;
 	iso2AuthorizationReqType->GenChallenge_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_AuthorizationReq */
 
 void init_iso2ParameterSetType(struct iso2ParameterSetType* iso2ParameterSetType) {
 	iso2ParameterSetType->Parameter.arrayLen = 0u;
@@ -1071,65 +1135,85 @@ void init_iso2SPKIDataType(struct iso2SPKIDataType* iso2SPKIDataType) {
 	iso2SPKIDataType->ANY_isUsed = 0u;
 }
 
+#if ISO2_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 void init_iso2PaymentDetailsResType(struct iso2PaymentDetailsResType* iso2PaymentDetailsResType) {
 	iso2PaymentDetailsResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_PaymentDetailsRes */
 
 void init_iso2SignatureMethodType(struct iso2SignatureMethodType* iso2SignatureMethodType) {
 	iso2SignatureMethodType->HMACOutputLength_isUsed = 0u;
 	iso2SignatureMethodType->ANY_isUsed = 0u;
 }
 
+#if ISO2_DEPLOY_AC_BidirectionalControlRes == SUPPORT_YES
 void init_iso2AC_BidirectionalControlResType(struct iso2AC_BidirectionalControlResType* iso2AC_BidirectionalControlResType) {
 	iso2AC_BidirectionalControlResType->EVSEStatus_isUsed = 0u;
 	iso2AC_BidirectionalControlResType->SAScheduleTupleID_isUsed = 0u;
 	iso2AC_BidirectionalControlResType->MeterInfo_isUsed = 0u;
 	iso2AC_BidirectionalControlResType->ReceiptRequired_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlRes */
 
+#if ISO2_DEPLOY_VehicleCheckOutReq == SUPPORT_YES
 void init_iso2VehicleCheckOutReqType(struct iso2VehicleCheckOutReqType* iso2VehicleCheckOutReqType) {
 	(void)iso2VehicleCheckOutReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_VehicleCheckOutReq */
 
+#if ISO2_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 void init_iso2WeldingDetectionReqType(struct iso2WeldingDetectionReqType* iso2WeldingDetectionReqType) {
 	(void)iso2WeldingDetectionReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_WeldingDetectionReq */
 
+#if ISO2_DEPLOY_AlignmentCheckRes == SUPPORT_YES
 void init_iso2AlignmentCheckResType(struct iso2AlignmentCheckResType* iso2AlignmentCheckResType) {
 	iso2AlignmentCheckResType->EVSEStatus_isUsed = 0u;
 	iso2AlignmentCheckResType->AlignmentCheckParameters_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_AlignmentCheckRes */
 
+#if ISO2_DEPLOY_PowerDemandReq == SUPPORT_YES
 void init_iso2PowerDemandReqType(struct iso2PowerDemandReqType* iso2PowerDemandReqType) {
 	iso2PowerDemandReqType->EVMaximumEnergyRequest_isUsed = 0u;
 	iso2PowerDemandReqType->EVMinimumEnergyRequest_isUsed = 0u;
 	iso2PowerDemandReqType->DisplayParameters_isUsed = 0u;
 	iso2PowerDemandReqType->PowerDemandParameters_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_PowerDemandReq */
 
 void init_iso2MinimumPMaxRequestType(struct iso2MinimumPMaxRequestType* iso2MinimumPMaxRequestType) {
 	iso2MinimumPMaxRequestType->MinimumPMaxScheduleEntry.arrayLen = 0u;
 }
 
+#if ISO2_DEPLOY_DisconnectChargingDeviceRes == SUPPORT_YES
 void init_iso2DisconnectChargingDeviceResType(struct iso2DisconnectChargingDeviceResType* iso2DisconnectChargingDeviceResType) {
 	iso2DisconnectChargingDeviceResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceRes */
 
+#if ISO2_DEPLOY_SessionSetupReq == SUPPORT_YES
 void init_iso2SessionSetupReqType(struct iso2SessionSetupReqType* iso2SessionSetupReqType) {
 	(void)iso2SessionSetupReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_SessionSetupReq */
 
+#if ISO2_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 void init_iso2PaymentDetailsReqType(struct iso2PaymentDetailsReqType* iso2PaymentDetailsReqType) {
 	(void)iso2PaymentDetailsReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_PaymentDetailsReq */
 
 void init_iso2Generic_EVFinePositioningParametersType(struct iso2Generic_EVFinePositioningParametersType* iso2Generic_EVFinePositioningParametersType) {
 	(void)iso2Generic_EVFinePositioningParametersType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_ConnectChargingDeviceReq == SUPPORT_YES
 void init_iso2ConnectChargingDeviceReqType(struct iso2ConnectChargingDeviceReqType* iso2ConnectChargingDeviceReqType) {
 	(void)iso2ConnectChargingDeviceReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceReq */
 
 void init_iso2AC_EVSEChargeParameterType(struct iso2AC_EVSEChargeParameterType* iso2AC_EVSEChargeParameterType) {
 	(void)iso2AC_EVSEChargeParameterType; /* avoid unused warning */
@@ -1178,9 +1262,11 @@ void init_iso2DC_EVBidirectionalParameterType(struct iso2DC_EVBidirectionalParam
 	iso2DC_EVBidirectionalParameterType->MinimumSOC_isUsed = 0u;
 }
 
+#if ISO2_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 void init_iso2PaymentServiceSelectionReqType(struct iso2PaymentServiceSelectionReqType* iso2PaymentServiceSelectionReqType) {
 	iso2PaymentServiceSelectionReqType->SelectedVASList_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionReq */
 
 void init_iso2MagneticVectorType(struct iso2MagneticVectorType* iso2MagneticVectorType) {
 	(void)iso2MagneticVectorType; /* avoid unused warning */
@@ -1190,21 +1276,27 @@ void init_iso2PhysicalValueType(struct iso2PhysicalValueType* iso2PhysicalValueT
 	(void)iso2PhysicalValueType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_SystemStatusReq == SUPPORT_YES
 void init_iso2SystemStatusReqType(struct iso2SystemStatusReqType* iso2SystemStatusReqType) {
 	(void)iso2SystemStatusReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_SystemStatusReq */
 
+#if ISO2_DEPLOY_SystemStatusRes == SUPPORT_YES
 void init_iso2SystemStatusResType(struct iso2SystemStatusResType* iso2SystemStatusResType) {
 	iso2SystemStatusResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_SystemStatusRes */
 
 void init_iso2EVSEFinePositioningSetupParametersType(struct iso2EVSEFinePositioningSetupParametersType* iso2EVSEFinePositioningSetupParametersType) {
 	(void)iso2EVSEFinePositioningSetupParametersType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_V2GResponse == SUPPORT_YES
 void init_iso2V2GResponseType(struct iso2V2GResponseType* iso2V2GResponseType) {
 	iso2V2GResponseType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_V2GResponse */
 
 void init_iso2BodyType(struct iso2BodyType* iso2BodyType) {
 	iso2BodyType->BodyElement_isUsed = 0u;
@@ -1270,17 +1362,21 @@ void init_iso2BodyType(struct iso2BodyType* iso2BodyType) {
 	iso2BodyType->SessionSetupRes_isUsed = 0u;
 }
 
+#if ISO2_DEPLOY_PreChargeRes == SUPPORT_YES
 void init_iso2PreChargeResType(struct iso2PreChargeResType* iso2PreChargeResType) {
 	iso2PreChargeResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_PreChargeRes */
 
 void init_iso2EVSEFinePositioningParametersType(struct iso2EVSEFinePositioningParametersType* iso2EVSEFinePositioningParametersType) {
 	(void)iso2EVSEFinePositioningParametersType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 void init_iso2PaymentServiceSelectionResType(struct iso2PaymentServiceSelectionResType* iso2PaymentServiceSelectionResType) {
 	iso2PaymentServiceSelectionResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionRes */
 
 void init_iso2DigestMethodType(struct iso2DigestMethodType* iso2DigestMethodType) {
 	iso2DigestMethodType->ANY_isUsed = 0u;
@@ -1305,18 +1401,24 @@ void init_iso2DC_EVChargeParameterType(struct iso2DC_EVChargeParameterType* iso2
 	iso2DC_EVChargeParameterType->BulkSOC_isUsed = 0u;
 }
 
+#if ISO2_DEPLOY_ServiceDetailReq == SUPPORT_YES
 void init_iso2ServiceDetailReqType(struct iso2ServiceDetailReqType* iso2ServiceDetailReqType) {
 	(void)iso2ServiceDetailReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_ServiceDetailReq */
 
+#if ISO2_DEPLOY_PreChargeReq == SUPPORT_YES
 void init_iso2PreChargeReqType(struct iso2PreChargeReqType* iso2PreChargeReqType) {
 	(void)iso2PreChargeReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_PreChargeReq */
 
+#if ISO2_DEPLOY_Manifest == SUPPORT_YES
 void init_iso2ManifestType(struct iso2ManifestType* iso2ManifestType) {
 	iso2ManifestType->Id_isUsed = 0u;
 	iso2ManifestType->Reference.arrayLen = 0u;
 }
+#endif /* ISO2_DEPLOY_Manifest */
 
 void init_iso2AnonType_V2G_Message(struct iso2AnonType_V2G_Message* iso2AnonType_V2G_Message) {
 	(void)iso2AnonType_V2G_Message; /* avoid unused warning */
@@ -1366,10 +1468,13 @@ void init_iso2MagneticVectorSetupListType(struct iso2MagneticVectorSetupListType
 	iso2MagneticVectorSetupListType->MagneticVectorSetup.arrayLen = 0u;
 }
 
+#if ISO2_DEPLOY_PairingReq == SUPPORT_YES
 void init_iso2PairingReqType(struct iso2PairingReqType* iso2PairingReqType) {
 	iso2PairingReqType->PairingParameters_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_PairingReq */
 
+#if ISO2_DEPLOY_CurrentDemandRes == SUPPORT_YES
 void init_iso2CurrentDemandResType(struct iso2CurrentDemandResType* iso2CurrentDemandResType) {
 	iso2CurrentDemandResType->EVSEStatus_isUsed = 0u;
 	iso2CurrentDemandResType->EVSEMaximumPower_isUsed = 0u;
@@ -1379,11 +1484,13 @@ void init_iso2CurrentDemandResType(struct iso2CurrentDemandResType* iso2CurrentD
 	iso2CurrentDemandResType->MeterInfo_isUsed = 0u;
 	iso2CurrentDemandResType->ReceiptRequired_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_CurrentDemandRes */
 
 void init_iso2X509IssuerSerialType(struct iso2X509IssuerSerialType* iso2X509IssuerSerialType) {
 	(void)iso2X509IssuerSerialType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_ChargingStatusReq == SUPPORT_YES
 void init_iso2ChargingStatusReqType(struct iso2ChargingStatusReqType* iso2ChargingStatusReqType) {
 	iso2ChargingStatusReqType->EVMaximumEnergyRequest_isUsed = 0u;
 	iso2ChargingStatusReqType->EVMinimumEnergyRequest_isUsed = 0u;
@@ -1392,10 +1499,13 @@ void init_iso2ChargingStatusReqType(struct iso2ChargingStatusReqType* iso2Chargi
 	iso2ChargingStatusReqType->EVMaximumChargeCurrent_isUsed = 0u;
 	iso2ChargingStatusReqType->EVMinimumChargeCurrent_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_ChargingStatusReq */
 
+#if ISO2_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 void init_iso2CertificateInstallationResType(struct iso2CertificateInstallationResType* iso2CertificateInstallationResType) {
 	iso2CertificateInstallationResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_CertificateInstallationRes */
 
 void init_iso2SensorPackageType(struct iso2SensorPackageType* iso2SensorPackageType) {
 	iso2SensorPackageType->SensorMeasurements.arrayLen = 0u;
@@ -1407,10 +1517,12 @@ void init_iso2PGPDataType(struct iso2PGPDataType* iso2PGPDataType) {
 	iso2PGPDataType->ANY_isUsed = 0u;
 }
 
+#if ISO2_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 void init_iso2ServiceDiscoveryResType(struct iso2ServiceDiscoveryResType* iso2ServiceDiscoveryResType) {
 	iso2ServiceDiscoveryResType->EVSEStatus_isUsed = 0u;
 	iso2ServiceDiscoveryResType->VASList_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_ServiceDiscoveryRes */
 
 void init_iso2ServiceIDListType(struct iso2ServiceIDListType* iso2ServiceIDListType) {
 	iso2ServiceIDListType->ServiceID.arrayLen = 0u;
@@ -1420,6 +1532,7 @@ void init_iso2EVFinePositioningSetupParametersType(struct iso2EVFinePositioningS
 	(void)iso2EVFinePositioningSetupParametersType; /* avoid unused warning */
 }
 
+#if ISO2_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 void init_iso2ChargeParameterDiscoveryResType(struct iso2ChargeParameterDiscoveryResType* iso2ChargeParameterDiscoveryResType) {
 	iso2ChargeParameterDiscoveryResType->EVSEStatus_isUsed = 0u;
 	iso2ChargeParameterDiscoveryResType->SAScheduleList_isUsed = 0u;
@@ -1430,7 +1543,9 @@ void init_iso2ChargeParameterDiscoveryResType(struct iso2ChargeParameterDiscover
 	iso2ChargeParameterDiscoveryResType->DC_EVSEBidirectionalParameter_isUsed = 0u;
 	iso2ChargeParameterDiscoveryResType->WPT_EVSEChargeParameter_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryRes */
 
+#if ISO2_DEPLOY_PowerDemandRes == SUPPORT_YES
 void init_iso2PowerDemandResType(struct iso2PowerDemandResType* iso2PowerDemandResType) {
 	iso2PowerDemandResType->EVSEStatus_isUsed = 0u;
 	iso2PowerDemandResType->SAScheduleTupleID_isUsed = 0u;
@@ -1438,16 +1553,19 @@ void init_iso2PowerDemandResType(struct iso2PowerDemandResType* iso2PowerDemandR
 	iso2PowerDemandResType->ReceiptRequired_isUsed = 0u;
 	iso2PowerDemandResType->PowerDemandParameters_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_PowerDemandRes */
 
 void init_iso2ChargingProfileType(struct iso2ChargingProfileType* iso2ChargingProfileType) {
 	iso2ChargingProfileType->ProfileEntry.arrayLen = 0u;
 }
 
+#if ISO2_DEPLOY_FinePositioningReq == SUPPORT_YES
 void init_iso2FinePositioningReqType(struct iso2FinePositioningReqType* iso2FinePositioningReqType) {
 	iso2FinePositioningReqType->EVFinePositioningParameters_isUsed = 0u;
 	iso2FinePositioningReqType->Generic_EVFinePositioningParameters_isUsed = 0u;
 	iso2FinePositioningReqType->LFA_EVFinePositioningParameters_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_FinePositioningReq */
 
 void init_iso2SalesTariffType(struct iso2SalesTariffType* iso2SalesTariffType) {
 	iso2SalesTariffType->SalesTariffDescription_isUsed = 0u;
@@ -1468,13 +1586,17 @@ void init_iso2SignedInfoType(struct iso2SignedInfoType* iso2SignedInfoType) {
 	iso2SignedInfoType->Reference.arrayLen = 0u;
 }
 
+#if ISO2_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 void init_iso2PowerDeliveryResType(struct iso2PowerDeliveryResType* iso2PowerDeliveryResType) {
 	iso2PowerDeliveryResType->EVSEStatus_isUsed = 0u;
 }
+#endif /* ISO2_DEPLOY_PowerDeliveryRes */
 
+#if ISO2_DEPLOY_CableCheckReq == SUPPORT_YES
 void init_iso2CableCheckReqType(struct iso2CableCheckReqType* iso2CableCheckReqType) {
 	(void)iso2CableCheckReqType; /* avoid unused warning */
 }
+#endif /* ISO2_DEPLOY_CableCheckReq */
 
 void init_iso2SelectedServiceType(struct iso2SelectedServiceType* iso2SelectedServiceType) {
 	(void)iso2SelectedServiceType; /* avoid unused warning */
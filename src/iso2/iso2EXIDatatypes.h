@@ -53,6 +53,8 @@ extern "C" {
 
 #include "EXITypes.h"
 
+#include "iso2EXIDeploy.h"
+
 
 /* Datatype definitions and structs for given XML Schema definitions */
 
@@ -99,12 +101,20 @@ extern "C" {
 struct iso2RSAKeyValueType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Modulus, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2RSAKeyValueType_Modulus_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Modulus ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Exponent, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2RSAKeyValueType_Exponent_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Exponent ;
 };
@@ -115,7 +125,11 @@ struct iso2RSAKeyValueType {
 struct iso2MeterInfoType {
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":MeterID, urn:iso:15118:2:2016:MsgDataTypes,meterIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2MeterInfoType_MeterID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MeterID ;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":MeterReadingCharged, http://www.w3.org/2001/XMLSchema,unsignedLong */
@@ -172,7 +186,11 @@ typedef enum {
 struct iso2MagneticVectorSetupType {
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":GAID, http://www.w3.org/2001/XMLSchema,ID */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2MagneticVectorSetupType_GAID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  GAID ;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":FrequencyChannel, http://www.w3.org/2001/XMLSchema,unsignedInt */
@@ -201,25 +219,41 @@ struct iso2EVFinePositioningParametersType {
 struct iso2ObjectType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2ObjectType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* attribute: MimeType {http://www.w3.org/2001/XMLSchema,string} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2ObjectType_MimeType_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MimeType ;
 	unsigned int MimeType_isUsed:1;
 	/* attribute: Encoding {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2ObjectType_Encoding_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Encoding ;
 	unsigned int Encoding_isUsed:1;
 	/* element: WC[##any] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2ObjectType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -252,18 +286,30 @@ struct iso2MeasurementDataListType {
 struct iso2SignaturePropertyType {
 	/* attribute: Target {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SignaturePropertyType_Target_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Target ;
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SignaturePropertyType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SignaturePropertyType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -277,19 +323,31 @@ struct iso2SignaturePropertyType {
 struct iso2TransformType {
 	/* attribute: Algorithm {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2TransformType_Algorithm_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Algorithm ;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2TransformType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":XPath, http://www.w3.org/2001/XMLSchema,string */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[iso2TransformType_XPath_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[iso2TransformType_XPath_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -307,12 +365,20 @@ typedef enum {
 struct iso2EMAIDType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EMAIDType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* simple content: urn:iso:15118:2:2016:MsgDataTypes,eMAIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EMAIDType_CONTENT_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  CONTENT ;
 };
@@ -328,42 +394,70 @@ struct iso2EMAIDType {
 struct iso2DSAKeyValueType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":P, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2DSAKeyValueType_P_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  P ;
 	unsigned int P_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Q, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2DSAKeyValueType_Q_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Q ;
 	unsigned int Q_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":G, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2DSAKeyValueType_G_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  G ;
 	unsigned int G_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Y, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2DSAKeyValueType_Y_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Y ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":J, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2DSAKeyValueType_J_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  J ;
 	unsigned int J_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Seed, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2DSAKeyValueType_Seed_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Seed ;
 	unsigned int Seed_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":PgenCounter, http://www.w3.org/2000/09/xmldsig#,CryptoBinary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2DSAKeyValueType_PgenCounter_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PgenCounter ;
 	unsigned int PgenCounter_isUsed:1;
@@ -400,7 +494,11 @@ struct iso2EVSEEnergyTransferParameterType {
 struct iso2MeteringReceiptReqType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2MeteringReceiptReqType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":SessionID, urn:iso:15118:2:2016:MsgDataTypes,sessionIDType */
@@ -419,14 +517,22 @@ struct iso2MeteringReceiptReqType {
 #define iso2KeyValueType_ANY_CHARACTERS_SIZE 50 + EXTRA_CHAR 
 struct iso2KeyValueType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":DSAKeyValue, Complex type name='http://www.w3.org/2000/09/xmldsig#,DSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":P,"http://www.w3.org/2000/09/xmldsig#":Q){0-1},"http://www.w3.org/2000/09/xmldsig#":G{0-1},"http://www.w3.org/2000/09/xmldsig#":Y,"http://www.w3.org/2000/09/xmldsig#":J{0-1},("http://www.w3.org/2000/09/xmldsig#":Seed,"http://www.w3.org/2000/09/xmldsig#":PgenCounter){0-1})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso2DSAKeyValueType* DSAKeyValue ;
+#else
 	struct iso2DSAKeyValueType DSAKeyValue ;
+#endif /* DATABINDING_SLIM */
 	unsigned int DSAKeyValue_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":RSAKeyValue, Complex type name='http://www.w3.org/2000/09/xmldsig#,RSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Modulus,"http://www.w3.org/2000/09/xmldsig#":Exponent)',  derivedBy='RESTRICTION'.  */
 	struct iso2RSAKeyValueType RSAKeyValue ;
 	unsigned int RSAKeyValue_isUsed:1;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2KeyValueType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -455,7 +561,11 @@ struct iso2BodyBaseType {
 struct iso2AuthorizationReqType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2AuthorizationReqType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -475,14 +585,22 @@ struct iso2SPKIDataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":SPKISexp, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[iso2SPKIDataType_SPKISexp_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[iso2SPKIDataType_SPKISexp_ARRAY_SIZE];
 		uint16_t arrayLen;
 	} SPKISexp;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SPKIDataType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -494,7 +612,11 @@ struct iso2SPKIDataType {
 struct iso2SignatureMethodType {
 	/* attribute: Algorithm {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SignatureMethodType_Algorithm_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Algorithm ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":HMACOutputLength, http://www.w3.org/2000/09/xmldsig#,HMACOutputLengthType */
@@ -502,7 +624,11 @@ struct iso2SignatureMethodType {
 	unsigned int HMACOutputLength_isUsed:1;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SignatureMethodType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -535,12 +661,20 @@ typedef enum {
 struct iso2CanonicalizationMethodType {
 	/* attribute: Algorithm {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2CanonicalizationMethodType_Algorithm_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Algorithm ;
 	/* element: WC[##any] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2CanonicalizationMethodType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -590,12 +724,20 @@ typedef enum {
 struct iso2DigestMethodType {
 	/* attribute: Algorithm {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2DigestMethodType_Algorithm_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Algorithm ;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2DigestMethodType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -688,7 +830,11 @@ struct iso2SubCertificatesType {
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":Certificate, urn:iso:15118:2:2016:MsgDataTypes,certificateType */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2SubCertificatesType_Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  array[iso2SubCertificatesType_Certificate_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -713,12 +859,20 @@ struct iso2EVEnergyTransferParameterType {
 struct iso2ContractSignatureEncryptedPrivateKeyType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2ContractSignatureEncryptedPrivateKeyType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* simple content: urn:iso:15118:2:2016:MsgDataTypes,encryptedPrivateKeyType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2ContractSignatureEncryptedPrivateKeyType_CONTENT_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  CONTENT ;
 };
@@ -728,7 +882,11 @@ struct iso2ContractSignatureEncryptedPrivateKeyType {
 struct iso2MagneticVectorSetupListType {
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":MagneticVectorSetup, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MagneticVectorSetupType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":GAID,"urn:iso:15118:2:2016:MsgDataTypes":FrequencyChannel)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2MagneticVectorSetupType* array;
+#else
 		struct iso2MagneticVectorSetupType array[iso2MagneticVectorSetupListType_MagneticVectorSetup_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} MagneticVectorSetup;
 };
@@ -771,7 +929,11 @@ typedef enum {
 struct iso2X509IssuerSerialType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509IssuerName, http://www.w3.org/2001/XMLSchema,string */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2X509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  X509IssuerName ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509SerialNumber, http://www.w3.org/2001/XMLSchema,integer */
@@ -806,19 +968,31 @@ typedef enum {
 struct iso2PGPDataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":PGPKeyID, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2PGPDataType_PGPKeyID_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PGPKeyID ;
 	unsigned int PGPKeyID_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2PGPDataType_PGPKeyPacket_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PGPKeyPacket ;
 	unsigned int PGPKeyPacket_isUsed:1;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2PGPDataType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -861,13 +1035,21 @@ struct iso2SensorType {
 struct iso2SignatureValueType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SignatureValueType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* simple content: http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2SignatureValueType_CONTENT_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  CONTENT ;
 };
@@ -907,12 +1089,20 @@ typedef enum {
 struct iso2DiffieHellmanPublickeyType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2DiffieHellmanPublickeyType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* simple content: urn:iso:15118:2:2016:MsgDataTypes,dHpublickeyType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2DiffieHellmanPublickeyType_CONTENT_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  CONTENT ;
 };
@@ -979,7 +1169,11 @@ struct iso2X509DataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509SKI, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[iso2X509DataType_X509SKI_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[iso2X509DataType_X509SKI_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -987,7 +1181,11 @@ struct iso2X509DataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509SubjectName, http://www.w3.org/2001/XMLSchema,string */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[iso2X509DataType_X509SubjectName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[iso2X509DataType_X509SubjectName_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -995,7 +1193,11 @@ struct iso2X509DataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509Certificate, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[iso2X509DataType_X509Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[iso2X509DataType_X509Certificate_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -1003,14 +1205,22 @@ struct iso2X509DataType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509CRL, http://www.w3.org/2001/XMLSchema,base64Binary */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			uint8_t* bytes;
+#else
 			uint8_t bytes[iso2X509DataType_X509CRL_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t bytesLen;
 		}  array[iso2X509DataType_X509CRL_ARRAY_SIZE];
 		uint16_t arrayLen;
 	} X509CRL;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2X509DataType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -1054,14 +1264,22 @@ struct iso2DC_BidirectionalControlResType {
 	unsigned int EVSEMinimumVoltage_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":EVSEID, urn:iso:15118:2:2016:MsgDataTypes,evseIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2DC_BidirectionalControlResType_EVSEID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  EVSEID ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":SAScheduleTupleID, urn:iso:15118:2:2016:MsgDataTypes,SAIDType */
 	uint8_t SAScheduleTupleID ;
 	unsigned int SAScheduleTupleID_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":MeterInfo, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MeterInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":MeterID,"urn:iso:15118:2:2016:MsgDataTypes":MeterReadingCharged{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MeterReadingDischarged{0-1},"urn:iso:15118:2:2016:MsgDataTypes":SigMeterReading{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MeterStatus{0-1},"urn:iso:15118:2:2016:MsgDataTypes":TMeter{0-1})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso2MeterInfoType* MeterInfo ;
+#else
 	struct iso2MeterInfoType MeterInfo ;
+#endif /* DATABINDING_SLIM */
 	unsigned int MeterInfo_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":ReceiptRequired, http://www.w3.org/2001/XMLSchema,boolean */
 	int ReceiptRequired ;
@@ -1086,14 +1304,22 @@ struct iso2ChargingStatusResType {
 	unsigned int EVSEStatus_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":EVSEID, urn:iso:15118:2:2016:MsgDataTypes,evseIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2ChargingStatusResType_EVSEID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  EVSEID ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":SAScheduleTupleID, urn:iso:15118:2:2016:MsgDataTypes,SAIDType */
 	uint8_t SAScheduleTupleID ;
 	unsigned int SAScheduleTupleID_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":MeterInfo, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MeterInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":MeterID,"urn:iso:15118:2:2016:MsgDataTypes":MeterReadingCharged{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MeterReadingDischarged{0-1},"urn:iso:15118:2:2016:MsgDataTypes":SigMeterReading{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MeterStatus{0-1},"urn:iso:15118:2:2016:MsgDataTypes":TMeter{0-1})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso2MeterInfoType* MeterInfo ;
+#else
 	struct iso2MeterInfoType MeterInfo ;
+#endif /* DATABINDING_SLIM */
 	unsigned int MeterInfo_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":ReceiptRequired, http://www.w3.org/2001/XMLSchema,boolean */
 	int ReceiptRequired ;
@@ -1173,7 +1399,11 @@ struct iso2ServiceDiscoveryReqType {
 struct iso2SignaturePropertiesType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SignaturePropertiesType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -1321,7 +1551,11 @@ struct iso2TransformsType {
 struct iso2ParameterType {
 	/* attribute: Name {http://www.w3.org/2001/XMLSchema,string} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2ParameterType_Name_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Name ;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":boolValue, http://www.w3.org/2001/XMLSchema,boolean */
@@ -1341,7 +1575,11 @@ struct iso2ParameterType {
 	unsigned int physicalValue_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":stringValue, http://www.w3.org/2001/XMLSchema,string */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2ParameterType_stringValue_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  stringValue ;
 	unsigned int stringValue_isUsed:1;
@@ -1391,13 +1629,21 @@ struct iso2DC_EVSEChargeParameterType {
 struct iso2CertificateChainType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2CertificateChainType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":Certificate, urn:iso:15118:2:2016:MsgDataTypes,certificateType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2CertificateChainType_Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Certificate ;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":SubCertificates, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SubCertificatesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":Certificate{1-4})',  derivedBy='RESTRICTION'.  */
@@ -1451,7 +1697,11 @@ struct iso2SessionSetupResType {
 	unsigned int EVSEStatus_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":EVSEID, urn:iso:15118:2:2016:MsgDataTypes,evseIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SessionSetupResType_EVSEID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  EVSEID ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":EVSETimeStamp, http://www.w3.org/2001/XMLSchema,long */
@@ -1467,19 +1717,31 @@ struct iso2SessionSetupResType {
 struct iso2ReferenceType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2ReferenceType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* attribute: URI {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2ReferenceType_URI_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  URI ;
 	unsigned int URI_isUsed:1;
 	/* attribute: Type {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2ReferenceType_Type_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Type ;
 	unsigned int Type_isUsed:1;
@@ -1490,7 +1752,11 @@ struct iso2ReferenceType {
 	struct iso2DigestMethodType DigestMethod ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":DigestValue, http://www.w3.org/2000/09/xmldsig#,DigestValueType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2ReferenceType_DigestValue_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DigestValue ;
 };
@@ -1500,7 +1766,11 @@ struct iso2ReferenceType {
 struct iso2SensorListType {
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":Sensor, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SensorType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":SensorID,"urn:iso:15118:2:2016:MsgDataTypes":SensorPosition,"urn:iso:15118:2:2016:MsgDataTypes":SensorOrientation)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2SensorType* array;
+#else
 		struct iso2SensorType array[iso2SensorListType_Sensor_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} Sensor;
 };
@@ -1538,7 +1808,11 @@ struct iso2ParameterSetType {
 	uint16_t ParameterSetID ;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":Parameter, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ParameterType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":boolValue|"urn:iso:15118:2:2016:MsgDataTypes":byteValue|"urn:iso:15118:2:2016:MsgDataTypes":shortValue|"urn:iso:15118:2:2016:MsgDataTypes":intValue|"urn:iso:15118:2:2016:MsgDataTypes":physicalValue|"urn:iso:15118:2:2016:MsgDataTypes":stringValue)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2ParameterType* array;
+#else
 		struct iso2ParameterType array[iso2ParameterSetType_Parameter_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} Parameter;
 };
@@ -1576,14 +1850,22 @@ struct iso2AC_BidirectionalControlResType {
 	struct iso2PhysicalValueType EVSETargetReactivePower ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":EVSEID, urn:iso:15118:2:2016:MsgDataTypes,evseIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2AC_BidirectionalControlResType_EVSEID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  EVSEID ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":SAScheduleTupleID, urn:iso:15118:2:2016:MsgDataTypes,SAIDType */
 	uint8_t SAScheduleTupleID ;
 	unsigned int SAScheduleTupleID_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":MeterInfo, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MeterInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":MeterID,"urn:iso:15118:2:2016:MsgDataTypes":MeterReadingCharged{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MeterReadingDischarged{0-1},"urn:iso:15118:2:2016:MsgDataTypes":SigMeterReading{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MeterStatus{0-1},"urn:iso:15118:2:2016:MsgDataTypes":TMeter{0-1})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso2MeterInfoType* MeterInfo ;
+#else
 	struct iso2MeterInfoType MeterInfo ;
+#endif /* DATABINDING_SLIM */
 	unsigned int MeterInfo_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":ReceiptRequired, http://www.w3.org/2001/XMLSchema,boolean */
 	int ReceiptRequired ;
@@ -1683,7 +1965,11 @@ struct iso2SalesTariffEntryType {
 	unsigned int EPriceLevel_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":ConsumptionCost, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ConsumptionCostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":startValue,"urn:iso:15118:2:2016:MsgDataTypes":Cost{1-3})',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2ConsumptionCostType* array;
+#else
 		struct iso2ConsumptionCostType array[iso2SalesTariffEntryType_ConsumptionCost_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} ConsumptionCost;
 };
@@ -1812,7 +2098,11 @@ struct iso2DC_EVBidirectionalParameterType {
 struct iso2MagneticVectorType {
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":GAID, http://www.w3.org/2001/XMLSchema,ID */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2MagneticVectorType_GAID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  GAID ;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":Distance, http://www.w3.org/2001/XMLSchema,unsignedShort */
@@ -1873,13 +2163,21 @@ struct iso2PaymentServiceSelectionResType {
 struct iso2ManifestType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2ManifestType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Reference, Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2ReferenceType* array;
+#else
 		struct iso2ReferenceType array[iso2ManifestType_Reference_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} Reference;
 };
@@ -1905,7 +2203,11 @@ struct iso2Generic_EVSEFinePositioningParametersType {
 struct iso2ListOfRootCertificateIDsType {
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":RootCertificateID, Complex type name='http://www.w3.org/2000/09/xmldsig#,X509IssuerSerialType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":X509IssuerName,"http://www.w3.org/2000/09/xmldsig#":X509SerialNumber)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2X509IssuerSerialType* array;
+#else
 		struct iso2X509IssuerSerialType array[iso2ListOfRootCertificateIDsType_RootCertificateID_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} RootCertificateID;
 };
@@ -1948,14 +2250,22 @@ struct iso2CurrentDemandResType {
 	unsigned int EVSEMaximumVoltage_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":EVSEID, urn:iso:15118:2:2016:MsgDataTypes,evseIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2CurrentDemandResType_EVSEID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  EVSEID ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":SAScheduleTupleID, urn:iso:15118:2:2016:MsgDataTypes,SAIDType */
 	uint8_t SAScheduleTupleID ;
 	unsigned int SAScheduleTupleID_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":MeterInfo, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MeterInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":MeterID,"urn:iso:15118:2:2016:MsgDataTypes":MeterReadingCharged{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MeterReadingDischarged{0-1},"urn:iso:15118:2:2016:MsgDataTypes":SigMeterReading{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MeterStatus{0-1},"urn:iso:15118:2:2016:MsgDataTypes":TMeter{0-1})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso2MeterInfoType* MeterInfo ;
+#else
 	struct iso2MeterInfoType MeterInfo ;
+#endif /* DATABINDING_SLIM */
 	unsigned int MeterInfo_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":ReceiptRequired, http://www.w3.org/2001/XMLSchema,boolean */
 	int ReceiptRequired ;
@@ -2012,7 +2322,11 @@ struct iso2SensorPackageType {
 	uint32_t PackageIndex ;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":SensorMeasurements, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SensorMeasurementsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":SensorID,"urn:iso:15118:2:2016:MsgDataTypes":EffectiveRadiatedPower,"urn:iso:15118:2:2016:MsgDataTypes":MeasurementDataList)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2SensorMeasurementsType* array;
+#else
 		struct iso2SensorMeasurementsType array[iso2SensorPackageType_SensorMeasurements_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} SensorMeasurements;
 };
@@ -2045,14 +2359,22 @@ struct iso2PowerDemandResType {
 	struct iso2PhysicalValueType EVSEOutputPower ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":EVSEID, urn:iso:15118:2:2016:MsgDataTypes,evseIDType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2PowerDemandResType_EVSEID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  EVSEID ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":SAScheduleTupleID, urn:iso:15118:2:2016:MsgDataTypes,SAIDType */
 	uint8_t SAScheduleTupleID ;
 	unsigned int SAScheduleTupleID_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":MeterInfo, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MeterInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":MeterID,"urn:iso:15118:2:2016:MsgDataTypes":MeterReadingCharged{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MeterReadingDischarged{0-1},"urn:iso:15118:2:2016:MsgDataTypes":SigMeterReading{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MeterStatus{0-1},"urn:iso:15118:2:2016:MsgDataTypes":TMeter{0-1})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso2MeterInfoType* MeterInfo ;
+#else
 	struct iso2MeterInfoType MeterInfo ;
+#endif /* DATABINDING_SLIM */
 	unsigned int MeterInfo_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgBody":ReceiptRequired, http://www.w3.org/2001/XMLSchema,boolean */
 	int ReceiptRequired ;
@@ -2067,7 +2389,11 @@ struct iso2PowerDemandResType {
 struct iso2ChargingProfileType {
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":ProfileEntry, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,PMaxScheduleEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgDataTypes":RelativeTimeInterval),("urn:iso:15118:2:2016:MsgDataTypes":PMax{1-3}))',  derivedBy='EXTENSION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2PMaxScheduleEntryType* array;
+#else
 		struct iso2PMaxScheduleEntryType array[iso2ChargingProfileType_ProfileEntry_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} ProfileEntry;
 };
@@ -2079,14 +2405,22 @@ struct iso2ChargingProfileType {
 struct iso2SalesTariffType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SalesTariffType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":SalesTariffID, urn:iso:15118:2:2016:MsgDataTypes,SAIDType */
 	uint8_t SalesTariffID ;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":SalesTariffDescription, urn:iso:15118:2:2016:MsgDataTypes,tariffDescriptionType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SalesTariffType_SalesTariffDescription_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  SalesTariffDescription ;
 	unsigned int SalesTariffDescription_isUsed:1;
@@ -2095,7 +2429,11 @@ struct iso2SalesTariffType {
 	unsigned int NumEPriceLevels_isUsed:1;
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":SalesTariffEntry, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SalesTariffEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgDataTypes":RelativeTimeInterval),("urn:iso:15118:2:2016:MsgDataTypes":EPriceLevel{0-1},"urn:iso:15118:2:2016:MsgDataTypes":ConsumptionCost{0-3}))',  derivedBy='EXTENSION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2SalesTariffEntryType* array;
+#else
 		struct iso2SalesTariffEntryType array[iso2SalesTariffType_SalesTariffEntry_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} SalesTariffEntry;
 };
@@ -2106,7 +2444,11 @@ struct iso2SalesTariffType {
 struct iso2SignedInfoType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SignedInfoType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -2116,7 +2458,11 @@ struct iso2SignedInfoType {
 	struct iso2SignatureMethodType SignatureMethod ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Reference, Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2ReferenceType* array;
+#else
 		struct iso2ReferenceType array[iso2SignedInfoType_Reference_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} Reference;
 };
@@ -2138,13 +2484,21 @@ struct iso2PowerDeliveryResType {
 struct iso2RetrievalMethodType {
 	/* attribute: URI {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2RetrievalMethodType_URI_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  URI ;
 	unsigned int URI_isUsed:1;
 	/* attribute: Type {http://www.w3.org/2001/XMLSchema,anyURI} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2RetrievalMethodType_Type_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Type ;
 	unsigned int Type_isUsed:1;
@@ -2158,7 +2512,11 @@ struct iso2RetrievalMethodType {
 struct iso2MagneticVectorListType {
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":MagneticVector, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MagneticVectorType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":GAID,"urn:iso:15118:2:2016:MsgDataTypes":Distance,"urn:iso:15118:2:2016:MsgDataTypes":AngleGAtoVA,"urn:iso:15118:2:2016:MsgDataTypes":RotationVAtoGA,"urn:iso:15118:2:2016:MsgDataTypes":FODStatus)',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2MagneticVectorType* array;
+#else
 		struct iso2MagneticVectorType array[iso2MagneticVectorListType_MagneticVector_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} MagneticVector;
 };
@@ -2178,7 +2536,11 @@ struct iso2ServiceParameterListType {
 struct iso2PMaxScheduleType {
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":PMaxScheduleEntry, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,PMaxScheduleEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgDataTypes":RelativeTimeInterval),("urn:iso:15118:2:2016:MsgDataTypes":PMax{1-3}))',  derivedBy='EXTENSION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2PMaxScheduleEntryType* array;
+#else
 		struct iso2PMaxScheduleEntryType array[iso2PMaxScheduleType_PMaxScheduleEntry_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} PMaxScheduleEntry;
 };
@@ -2245,7 +2607,11 @@ struct iso2DC_BidirectionalControlReqType {
 struct iso2CertificateUpdateReqType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2CertificateUpdateReqType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":ContractSignatureCertChain, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,CertificateChainType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":Certificate,"urn:iso:15118:2:2016:MsgDataTypes":SubCertificates{0-1})',  derivedBy='RESTRICTION'.  */
@@ -2294,12 +2660,20 @@ struct iso2AlignmentCheckReqType {
 struct iso2CertificateInstallationReqType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2CertificateInstallationReqType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":OEMProvisioningCert, urn:iso:15118:2:2016:MsgDataTypes,certificateType */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2CertificateInstallationReqType_OEMProvisioningCert_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  OEMProvisioningCert ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":ListOfRootCertificateIDs, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ListOfRootCertificateIDsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":RootCertificateID{1-20})',  derivedBy='RESTRICTION'.  */
@@ -2339,7 +2713,11 @@ struct iso2ChargeParameterDiscoveryReqType {
 struct iso2SensorPackageListType {
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":SensorPackage, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SensorPackageType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":PackageIndex,"urn:iso:15118:2:2016:MsgDataTypes":SensorMeasurements{1-255})',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2SensorPackageType* array;
+#else
 		struct iso2SensorPackageType array[iso2SensorPackageListType_SensorPackage_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} SensorPackage;
 };
@@ -2536,7 +2914,11 @@ struct iso2PaymentServiceSelectionReqType {
 	/* element: "urn:iso:15118:2:2016:MsgBody":SelectedEnergyTransferService, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SelectedServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":ServiceID,"urn:iso:15118:2:2016:MsgDataTypes":ParameterSetID)',  derivedBy='RESTRICTION'.  */
 	struct iso2SelectedServiceType SelectedEnergyTransferService ;
 	/* element: "urn:iso:15118:2:2016:MsgBody":SelectedVASList, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SelectedServiceListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":SelectedService{1-16})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso2SelectedServiceListType* SelectedVASList ;
+#else
 	struct iso2SelectedServiceListType SelectedVASList ;
+#endif /* DATABINDING_SLIM */
 	unsigned int SelectedVASList_isUsed:1;
 };
 
@@ -2563,14 +2945,22 @@ struct iso2LFA_EVFinePositioningParametersType {
 struct iso2KeyInfoType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2KeyInfoType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":KeyName, http://www.w3.org/2001/XMLSchema,string */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[iso2KeyInfoType_KeyName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[iso2KeyInfoType_KeyName_ARRAY_SIZE];
 		uint16_t arrayLen;
@@ -2587,7 +2977,11 @@ struct iso2KeyInfoType {
 	} RetrievalMethod;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":X509Data, Complex type name='http://www.w3.org/2000/09/xmldsig#,X509DataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":X509IssuerSerial|"http://www.w3.org/2000/09/xmldsig#":X509SKI|"http://www.w3.org/2000/09/xmldsig#":X509SubjectName|"http://www.w3.org/2000/09/xmldsig#":X509Certificate|"http://www.w3.org/2000/09/xmldsig#":X509CRL|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2X509DataType* array;
+#else
 		struct iso2X509DataType array[iso2KeyInfoType_X509Data_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} X509Data;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":PGPData, Complex type name='http://www.w3.org/2000/09/xmldsig#,PGPDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":PGPKeyID,"http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})|("http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED}))',  derivedBy='RESTRICTION'.  */
@@ -2603,14 +2997,22 @@ struct iso2KeyInfoType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":MgmtData, http://www.w3.org/2001/XMLSchema,string */
 	struct {
 		struct {
+#if DATABINDING == DATABINDING_SLIM
+			exi_string_character_t* characters;
+#else
 			exi_string_character_t characters[iso2KeyInfoType_MgmtData_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 			uint16_t charactersLen;
 		}  array[iso2KeyInfoType_MgmtData_ARRAY_SIZE];
 		uint16_t arrayLen;
 	} MgmtData;
 	/* element: WC[##other:"http://www.w3.org/2000/09/xmldsig#"] */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2KeyInfoType_ANY_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  ANY ;
 	unsigned int ANY_isUsed:1;
@@ -2637,7 +3039,11 @@ struct iso2FinePositioningReqType {
 struct iso2SignatureType {
 	/* attribute: Id {http://www.w3.org/2001/XMLSchema,ID} */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2SignatureType_Id_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  Id ;
 	unsigned int Id_isUsed:1;
@@ -2646,7 +3052,11 @@ struct iso2SignatureType {
 	/* element: "http://www.w3.org/2000/09/xmldsig#":SignatureValue, Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureValueType',  base type name='base64Binary',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 	struct iso2SignatureValueType SignatureValue ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":KeyInfo, Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyInfoType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":KeyName|"http://www.w3.org/2000/09/xmldsig#":KeyValue|"http://www.w3.org/2000/09/xmldsig#":RetrievalMethod|"http://www.w3.org/2000/09/xmldsig#":X509Data|"http://www.w3.org/2000/09/xmldsig#":PGPData|"http://www.w3.org/2000/09/xmldsig#":SPKIData|"http://www.w3.org/2000/09/xmldsig#":MgmtData|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso2KeyInfoType* KeyInfo ;
+#else
 	struct iso2KeyInfoType KeyInfo ;
+#endif /* DATABINDING_SLIM */
 	unsigned int KeyInfo_isUsed:1;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Object, Complex type name='http://www.w3.org/2000/09/xmldsig#,ObjectType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any])){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 	struct {
@@ -2678,7 +3088,11 @@ struct iso2FinePositioningSetupResType {
 struct iso2SAScheduleListType {
 	/* element: "urn:iso:15118:2:2016:MsgDataTypes":SAScheduleTuple, Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SAScheduleTupleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":SAScheduleTupleID,"urn:iso:15118:2:2016:MsgDataTypes":PMaxSchedule,"urn:iso:15118:2:2016:MsgDataTypes":PMaxDischargeSchedule{0-1},"urn:iso:15118:2:2016:MsgDataTypes":SalesTariff{0-1},"urn:iso:15118:2:2016:MsgDataTypes":BuyBackTariff{0-1})',  derivedBy='RESTRICTION'.  */
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		struct iso2SAScheduleTupleType* array;
+#else
 		struct iso2SAScheduleTupleType array[iso2SAScheduleListType_SAScheduleTuple_ARRAY_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t arrayLen;
 	} SAScheduleTuple;
 };
@@ -2700,7 +3114,11 @@ struct iso2MessageHeaderType {
 		uint16_t bytesLen;
 	}  SessionID ;
 	/* element: "http://www.w3.org/2000/09/xmldsig#":Signature, Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignedInfo,"http://www.w3.org/2000/09/xmldsig#":SignatureValue,"http://www.w3.org/2000/09/xmldsig#":KeyInfo{0-1},"http://www.w3.org/2000/09/xmldsig#":Object{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if DATABINDING == DATABINDING_SLIM
+	struct iso2SignatureType* Signature ;
+#else
 	struct iso2SignatureType Signature ;
+#endif /* DATABINDING_SLIM */
 	unsigned int Signature_isUsed:1;
 };
 
@@ -3110,7 +3528,11 @@ struct iso2EXIDocument {
 	struct iso2TransformType Transform ;
 	struct iso2PGPDataType PGPData ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EXIDocument_MgmtData_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MgmtData ;
 	struct iso2SignatureMethodType SignatureMethod ;
@@ -3119,11 +3541,19 @@ struct iso2EXIDocument {
 	struct iso2X509DataType X509Data ;
 	struct iso2SignatureValueType SignatureValue ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EXIDocument_KeyName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  KeyName ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIDocument_DigestValue_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DigestValue ;
 	struct iso2SignedInfoType SignedInfo ;
@@ -3283,7 +3713,11 @@ struct iso2EXIFragment {
 	int16_t XCoordinate ;
 	iso2EVCheckOutStatusType EVSECheckOutStatus ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EXIFragment_stringValue_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  stringValue ;
 	int16_t RetryCounter ;
@@ -3299,11 +3733,19 @@ struct iso2EXIFragment {
 	struct iso2SAScheduleTupleType SAScheduleTuple ;
 	uint16_t ServiceID ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_PgenCounter_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PgenCounter ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EXIFragment_SalesTariffDescription_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  SalesTariffDescription ;
 	struct iso2PhysicalValueType AngleGAtoVA ;
@@ -3324,7 +3766,11 @@ struct iso2EXIFragment {
 	struct iso2PhysicalValueType EVSENominalVoltage ;
 	struct iso2MagneticVectorType MagneticVector ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EXIFragment_XPath_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  XPath ;
 	struct iso2SignatureType Signature ;
@@ -3341,7 +3787,11 @@ struct iso2EXIFragment {
 	struct iso2FinePositioningSetupResType FinePositioningSetupRes ;
 	struct iso2PMaxScheduleEntryType ProfileEntry ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EXIFragment_MgmtData_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MgmtData ;
 	struct iso2CertificateChainType SAProvisioningCertificateChain ;
@@ -3355,29 +3805,53 @@ struct iso2EXIFragment {
 	struct iso2PhysicalValueType amount ;
 	struct iso2PreChargeReqType PreChargeReq ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_OEMProvisioningCert_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  OEMProvisioningCert ;
 	uint32_t PackageIndex ;
 	struct iso2PreChargeResType PreChargeRes ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_P_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  P ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_Q_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Q ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EXIFragment_X509SubjectName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  X509SubjectName ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_G_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  G ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_J_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  J ;
 	struct iso2CertificateChainType ContractSignatureCertChain ;
@@ -3386,12 +3860,20 @@ struct iso2EXIFragment {
 	struct iso2PhysicalValueType EVMaximumChargeCurrent ;
 	uint16_t AlignmentOffset ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_Y_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Y ;
 	int8_t RemainingTimeToTargetSOC ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_DigestValue_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  DigestValue ;
 	struct iso2SensorMeasurementsType SensorMeasurements ;
@@ -3404,7 +3886,11 @@ struct iso2EXIFragment {
 	struct iso2TargetPositionType TargetOffset ;
 	struct iso2ParameterSetType PowerDemandParameters ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_PGPKeyID_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PGPKeyID ;
 	struct iso2DisconnectChargingDeviceReqType DisconnectChargingDeviceReq ;
@@ -3452,7 +3938,11 @@ struct iso2EXIFragment {
 	struct iso2MV_EVSEFinePositioningParametersType MV_EVSEFinePositioningParameters ;
 	iso2chargeProgressType ChargeProgress ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EXIFragment_KeyName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  KeyName ;
 	struct iso2PMaxScheduleType PMaxSchedule ;
@@ -3465,14 +3955,22 @@ struct iso2EXIFragment {
 	struct iso2PMaxScheduleEntryType PMaxScheduleEntry ;
 	struct iso2SAScheduleListType SAScheduleList ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_X509SKI_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  X509SKI ;
 	struct iso2PaymentOptionListType PaymentOptionList ;
 	struct iso2ContractSignatureEncryptedPrivateKeyType ContractSignatureEncryptedPrivateKey ;
 	struct iso2VehicleCheckInReqType VehicleCheckInReq ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Certificate ;
 	uint64_t CheckOutTime ;
@@ -3492,7 +3990,11 @@ struct iso2EXIFragment {
 	struct iso2CurrentDemandResType CurrentDemandRes ;
 	struct iso2AC_EVBidirectionalParameterType AC_EVBidirectionalParameter ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_Modulus_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Modulus ;
 	struct iso2SelectedServiceType SelectedEnergyTransferService ;
@@ -3516,7 +4018,11 @@ struct iso2EXIFragment {
 	struct iso2EVSEFinePositioningSetupParametersType EVSEFinePositioningSetupParameters ;
 	uint8_t EPriceLevel ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_Exponent_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Exponent ;
 	struct iso2X509IssuerSerialType X509IssuerSerial ;
@@ -3538,11 +4044,19 @@ struct iso2EXIFragment {
 	struct iso2ServiceType Service ;
 	struct iso2SignaturePropertyType SignatureProperty ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_PGPKeyPacket_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  PGPKeyPacket ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_Seed_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  Seed ;
 	struct iso2LFA_EVFinePositioningSetupParametersType LFA_EVFinePositioningSetupParameters ;
@@ -3563,7 +4077,11 @@ struct iso2EXIFragment {
 	struct iso2DC_EVSEChargeParameterType DC_EVSEChargeParameter ;
 	struct iso2MeteringReceiptReqType MeteringReceiptReq ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EXIFragment_MeterID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  MeterID ;
 	struct iso2MeteringReceiptResType MeteringReceiptRes ;
@@ -3571,13 +4089,21 @@ struct iso2EXIFragment {
 	uint8_t SalesTariffID ;
 	struct iso2ServiceDiscoveryResType ServiceDiscoveryRes ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_X509CRL_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  X509CRL ;
 	struct iso2MagneticVectorSetupType MagneticVectorSetup ;
 	struct iso2DigestMethodType DigestMethod ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_SPKISexp_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  SPKISexp ;
 	uint64_t MeterReadingDischarged ;
@@ -3589,7 +4115,11 @@ struct iso2EXIFragment {
 	struct iso2SensorPackageType SensorPackage ;
 	iso2EVCheckOutStatusType EVCheckOutStatus ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		uint8_t* bytes;
+#else
 		uint8_t bytes[iso2EXIFragment_X509Certificate_BYTES_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t bytesLen;
 	}  X509Certificate ;
 	struct iso2X509IssuerSerialType RootCertificateID ;
@@ -3630,7 +4160,11 @@ struct iso2EXIFragment {
 	iso2paymentOptionType SelectedPaymentOption ;
 	struct iso2AnonType_V2G_Message V2G_Message ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EXIFragment_EVSEID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  EVSEID ;
 	int64_t TMeter ;
@@ -3648,7 +4182,11 @@ struct iso2EXIFragment {
 	struct iso2ParameterType Parameter ;
 	struct iso2WeldingDetectionResType WeldingDetectionRes ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EXIFragment_GAID_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  GAID ;
 	uint16_t SignalFrequency ;
@@ -3664,7 +4202,11 @@ struct iso2EXIFragment {
 	uint16_t CurrentRange ;
 	struct iso2PhysicalValueType EVPresentReactivePower ;
 	struct {
+#if DATABINDING == DATABINDING_SLIM
+		exi_string_character_t* characters;
+#else
 		exi_string_character_t characters[iso2EXIFragment_X509IssuerName_CHARACTERS_SIZE];
+#endif /* DATABINDING_SLIM */
 		uint16_t charactersLen;
 	}  X509IssuerName ;
 	struct iso2BodyBaseType V2GRequest ;
@@ -4024,37 +4566,69 @@ void init_iso2EXIDocument(struct iso2EXIDocument* exiDoc);
 void init_iso2EXIFragment(struct iso2EXIFragment* exiFrag);
 #endif /* DEPLOY_ISO2_CODEC_FRAGMENT */
 void init_iso2RetrievalMethodType(struct iso2RetrievalMethodType* iso2RetrievalMethodType);
+#if ISO2_DEPLOY_AuthorizationRes == SUPPORT_YES
 void init_iso2AuthorizationResType(struct iso2AuthorizationResType* iso2AuthorizationResType);
+#endif /* ISO2_DEPLOY_AuthorizationRes */
 void init_iso2MV_EVSEFinePositioningSetupParametersType(struct iso2MV_EVSEFinePositioningSetupParametersType* iso2MV_EVSEFinePositioningSetupParametersType);
 void init_iso2X509DataType(struct iso2X509DataType* iso2X509DataType);
 void init_iso2RSAKeyValueType(struct iso2RSAKeyValueType* iso2RSAKeyValueType);
+#if ISO2_DEPLOY_DC_BidirectionalControlRes == SUPPORT_YES
 void init_iso2DC_BidirectionalControlResType(struct iso2DC_BidirectionalControlResType* iso2DC_BidirectionalControlResType);
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlRes */
 void init_iso2CostType(struct iso2CostType* iso2CostType);
+#if ISO2_DEPLOY_ChargingStatusRes == SUPPORT_YES
 void init_iso2ChargingStatusResType(struct iso2ChargingStatusResType* iso2ChargingStatusResType);
+#endif /* ISO2_DEPLOY_ChargingStatusRes */
 void init_iso2MeterInfoType(struct iso2MeterInfoType* iso2MeterInfoType);
 void init_iso2AC_EVChargeParameterType(struct iso2AC_EVChargeParameterType* iso2AC_EVChargeParameterType);
 void init_iso2AC_EVSEBidirectionalParameterType(struct iso2AC_EVSEBidirectionalParameterType* iso2AC_EVSEBidirectionalParameterType);
+#if ISO2_DEPLOY_VehicleCheckOutRes == SUPPORT_YES
 void init_iso2VehicleCheckOutResType(struct iso2VehicleCheckOutResType* iso2VehicleCheckOutResType);
+#endif /* ISO2_DEPLOY_VehicleCheckOutRes */
 void init_iso2MagneticVectorListType(struct iso2MagneticVectorListType* iso2MagneticVectorListType);
+#if ISO2_DEPLOY_CableCheckRes == SUPPORT_YES
 void init_iso2CableCheckResType(struct iso2CableCheckResType* iso2CableCheckResType);
+#endif /* ISO2_DEPLOY_CableCheckRes */
+#if ISO2_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 void init_iso2ServiceDiscoveryReqType(struct iso2ServiceDiscoveryReqType* iso2ServiceDiscoveryReqType);
+#endif /* ISO2_DEPLOY_ServiceDiscoveryReq */
 void init_iso2ServiceType(struct iso2ServiceType* iso2ServiceType);
 void init_iso2ServiceParameterListType(struct iso2ServiceParameterListType* iso2ServiceParameterListType);
 void init_iso2PMaxScheduleType(struct iso2PMaxScheduleType* iso2PMaxScheduleType);
+#if ISO2_DEPLOY_SignatureProperties == SUPPORT_YES
 void init_iso2SignaturePropertiesType(struct iso2SignaturePropertiesType* iso2SignaturePropertiesType);
+#endif /* ISO2_DEPLOY_SignatureProperties */
 void init_iso2PMaxScheduleEntryType(struct iso2PMaxScheduleEntryType* iso2PMaxScheduleEntryType);
 void init_iso2SignatureType(struct iso2SignatureType* iso2SignatureType);
+#if ISO2_DEPLOY_VehicleCheckInReq == SUPPORT_YES
 void init_iso2VehicleCheckInReqType(struct iso2VehicleCheckInReqType* iso2VehicleCheckInReqType);
+#endif /* ISO2_DEPLOY_VehicleCheckInReq */
+#if ISO2_DEPLOY_ConnectChargingDeviceRes == SUPPORT_YES
 void init_iso2ConnectChargingDeviceResType(struct iso2ConnectChargingDeviceResType* iso2ConnectChargingDeviceResType);
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceRes */
+#if ISO2_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 void init_iso2WeldingDetectionResType(struct iso2WeldingDetectionResType* iso2WeldingDetectionResType);
+#endif /* ISO2_DEPLOY_WeldingDetectionRes */
+#if ISO2_DEPLOY_SessionStopRes == SUPPORT_YES
 void init_iso2SessionStopResType(struct iso2SessionStopResType* iso2SessionStopResType);
+#endif /* ISO2_DEPLOY_SessionStopRes */
+#if ISO2_DEPLOY_VehicleCheckInRes == SUPPORT_YES
 void init_iso2VehicleCheckInResType(struct iso2VehicleCheckInResType* iso2VehicleCheckInResType);
+#endif /* ISO2_DEPLOY_VehicleCheckInRes */
 void init_iso2ServiceListType(struct iso2ServiceListType* iso2ServiceListType);
+#if ISO2_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 void init_iso2CertificateUpdateResType(struct iso2CertificateUpdateResType* iso2CertificateUpdateResType);
+#endif /* ISO2_DEPLOY_CertificateUpdateRes */
+#if ISO2_DEPLOY_FinePositioningSetupRes == SUPPORT_YES
 void init_iso2FinePositioningSetupResType(struct iso2FinePositioningSetupResType* iso2FinePositioningSetupResType);
+#endif /* ISO2_DEPLOY_FinePositioningSetupRes */
 void init_iso2AC_EVBidirectionalParameterType(struct iso2AC_EVBidirectionalParameterType* iso2AC_EVBidirectionalParameterType);
+#if ISO2_DEPLOY_DC_BidirectionalControlReq == SUPPORT_YES
 void init_iso2DC_BidirectionalControlReqType(struct iso2DC_BidirectionalControlReqType* iso2DC_BidirectionalControlReqType);
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlReq */
+#if ISO2_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 void init_iso2CertificateUpdateReqType(struct iso2CertificateUpdateReqType* iso2CertificateUpdateReqType);
+#endif /* ISO2_DEPLOY_CertificateUpdateReq */
 void init_iso2ConsumptionCostType(struct iso2ConsumptionCostType* iso2ConsumptionCostType);
 void init_iso2SAScheduleListType(struct iso2SAScheduleListType* iso2SAScheduleListType);
 void init_iso2MagneticVectorSetupType(struct iso2MagneticVectorSetupType* iso2MagneticVectorSetupType);
@@ -4063,14 +4637,22 @@ void init_iso2PaymentOptionListType(struct iso2PaymentOptionListType* iso2Paymen
 void init_iso2LFA_EVSEFinePositioningParametersType(struct iso2LFA_EVSEFinePositioningParametersType* iso2LFA_EVSEFinePositioningParametersType);
 void init_iso2RelativeTimeIntervalType(struct iso2RelativeTimeIntervalType* iso2RelativeTimeIntervalType);
 void init_iso2EVFinePositioningParametersType(struct iso2EVFinePositioningParametersType* iso2EVFinePositioningParametersType);
+#if ISO2_DEPLOY_AlignmentCheckReq == SUPPORT_YES
 void init_iso2AlignmentCheckReqType(struct iso2AlignmentCheckReqType* iso2AlignmentCheckReqType);
+#endif /* ISO2_DEPLOY_AlignmentCheckReq */
+#if ISO2_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 void init_iso2CertificateInstallationReqType(struct iso2CertificateInstallationReqType* iso2CertificateInstallationReqType);
+#endif /* ISO2_DEPLOY_CertificateInstallationReq */
 void init_iso2TransformsType(struct iso2TransformsType* iso2TransformsType);
 void init_iso2ObjectType(struct iso2ObjectType* iso2ObjectType);
 void init_iso2SensorOrderListType(struct iso2SensorOrderListType* iso2SensorOrderListType);
+#if ISO2_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 void init_iso2ChargeParameterDiscoveryReqType(struct iso2ChargeParameterDiscoveryReqType* iso2ChargeParameterDiscoveryReqType);
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryReq */
 void init_iso2ParameterType(struct iso2ParameterType* iso2ParameterType);
+#if ISO2_DEPLOY_SessionStopReq == SUPPORT_YES
 void init_iso2SessionStopReqType(struct iso2SessionStopReqType* iso2SessionStopReqType);
+#endif /* ISO2_DEPLOY_SessionStopReq */
 void init_iso2SensorMeasurementsType(struct iso2SensorMeasurementsType* iso2SensorMeasurementsType);
 void init_iso2DC_EVSEChargeParameterType(struct iso2DC_EVSEChargeParameterType* iso2DC_EVSEChargeParameterType);
 void init_iso2SensorPackageListType(struct iso2SensorPackageListType* iso2SensorPackageListType);
@@ -4083,68 +4665,130 @@ void init_iso2DSAKeyValueType(struct iso2DSAKeyValueType* iso2DSAKeyValueType);
 void init_iso2EntryType(struct iso2EntryType* iso2EntryType);
 void init_iso2MessageHeaderType(struct iso2MessageHeaderType* iso2MessageHeaderType);
 void init_iso2WPT_EVChargeParameterType(struct iso2WPT_EVChargeParameterType* iso2WPT_EVChargeParameterType);
+#if ISO2_DEPLOY_DisconnectChargingDeviceReq == SUPPORT_YES
 void init_iso2DisconnectChargingDeviceReqType(struct iso2DisconnectChargingDeviceReqType* iso2DisconnectChargingDeviceReqType);
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceReq */
 void init_iso2ChargeLoopReqType(struct iso2ChargeLoopReqType* iso2ChargeLoopReqType);
 void init_iso2V2GRequestType(struct iso2V2GRequestType* iso2V2GRequestType);
+#if ISO2_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 void init_iso2MeteringReceiptResType(struct iso2MeteringReceiptResType* iso2MeteringReceiptResType);
+#endif /* ISO2_DEPLOY_MeteringReceiptRes */
+#if ISO2_DEPLOY_SessionSetupRes == SUPPORT_YES
 void init_iso2SessionSetupResType(struct iso2SessionSetupResType* iso2SessionSetupResType);
+#endif /* ISO2_DEPLOY_SessionSetupRes */
+#if ISO2_DEPLOY_AC_BidirectionalControlReq == SUPPORT_YES
 void init_iso2AC_BidirectionalControlReqType(struct iso2AC_BidirectionalControlReqType* iso2AC_BidirectionalControlReqType);
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlReq */
 void init_iso2MV_EVSEFinePositioningParametersType(struct iso2MV_EVSEFinePositioningParametersType* iso2MV_EVSEFinePositioningParametersType);
 void init_iso2ReferenceType(struct iso2ReferenceType* iso2ReferenceType);
 void init_iso2EVSEEnergyTransferParameterType(struct iso2EVSEEnergyTransferParameterType* iso2EVSEEnergyTransferParameterType);
+#if ISO2_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 void init_iso2MeteringReceiptReqType(struct iso2MeteringReceiptReqType* iso2MeteringReceiptReqType);
+#endif /* ISO2_DEPLOY_MeteringReceiptReq */
 void init_iso2KeyValueType(struct iso2KeyValueType* iso2KeyValueType);
 void init_iso2SensorListType(struct iso2SensorListType* iso2SensorListType);
+#if ISO2_DEPLOY_CurrentDemandReq == SUPPORT_YES
 void init_iso2CurrentDemandReqType(struct iso2CurrentDemandReqType* iso2CurrentDemandReqType);
+#endif /* ISO2_DEPLOY_CurrentDemandReq */
+#if ISO2_DEPLOY_FinePositioningSetupReq == SUPPORT_YES
 void init_iso2FinePositioningSetupReqType(struct iso2FinePositioningSetupReqType* iso2FinePositioningSetupReqType);
+#endif /* ISO2_DEPLOY_FinePositioningSetupReq */
 void init_iso2LFA_EVFinePositioningSetupParametersType(struct iso2LFA_EVFinePositioningSetupParametersType* iso2LFA_EVFinePositioningSetupParametersType);
 void init_iso2SAScheduleTupleType(struct iso2SAScheduleTupleType* iso2SAScheduleTupleType);
 void init_iso2WPT_EVSEChargeParameterType(struct iso2WPT_EVSEChargeParameterType* iso2WPT_EVSEChargeParameterType);
+#if ISO2_DEPLOY_FinePositioningRes == SUPPORT_YES
 void init_iso2FinePositioningResType(struct iso2FinePositioningResType* iso2FinePositioningResType);
+#endif /* ISO2_DEPLOY_FinePositioningRes */
 void init_iso2BodyBaseType(struct iso2BodyBaseType* iso2BodyBaseType);
+#if ISO2_DEPLOY_ServiceDetailRes == SUPPORT_YES
 void init_iso2ServiceDetailResType(struct iso2ServiceDetailResType* iso2ServiceDetailResType);
+#endif /* ISO2_DEPLOY_ServiceDetailRes */
+#if ISO2_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 void init_iso2PowerDeliveryReqType(struct iso2PowerDeliveryReqType* iso2PowerDeliveryReqType);
+#endif /* ISO2_DEPLOY_PowerDeliveryReq */
+#if ISO2_DEPLOY_PairingRes == SUPPORT_YES
 void init_iso2PairingResType(struct iso2PairingResType* iso2PairingResType);
+#endif /* ISO2_DEPLOY_PairingRes */
+#if ISO2_DEPLOY_AuthorizationReq == SUPPORT_YES
 void init_iso2AuthorizationReqType(struct iso2AuthorizationReqType* iso2AuthorizationReqType);
+#endif /* ISO2_DEPLOY_AuthorizationReq */
 void init_iso2ParameterSetType(struct iso2ParameterSetType* iso2ParameterSetType);
 void init_iso2SPKIDataType(struct iso2SPKIDataType* iso2SPKIDataType);
+#if ISO2_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 void init_iso2PaymentDetailsResType(struct iso2PaymentDetailsResType* iso2PaymentDetailsResType);
+#endif /* ISO2_DEPLOY_PaymentDetailsRes */
 void init_iso2SignatureMethodType(struct iso2SignatureMethodType* iso2SignatureMethodType);
+#if ISO2_DEPLOY_AC_BidirectionalControlRes == SUPPORT_YES
 void init_iso2AC_BidirectionalControlResType(struct iso2AC_BidirectionalControlResType* iso2AC_BidirectionalControlResType);
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlRes */
+#if ISO2_DEPLOY_VehicleCheckOutReq == SUPPORT_YES
 void init_iso2VehicleCheckOutReqType(struct iso2VehicleCheckOutReqType* iso2VehicleCheckOutReqType);
+#endif /* ISO2_DEPLOY_VehicleCheckOutReq */
+#if ISO2_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 void init_iso2WeldingDetectionReqType(struct iso2WeldingDetectionReqType* iso2WeldingDetectionReqType);
+#endif /* ISO2_DEPLOY_WeldingDetectionReq */
+#if ISO2_DEPLOY_AlignmentCheckRes == SUPPORT_YES
 void init_iso2AlignmentCheckResType(struct iso2AlignmentCheckResType* iso2AlignmentCheckResType);
+#endif /* ISO2_DEPLOY_AlignmentCheckRes */
+#if ISO2_DEPLOY_PowerDemandReq == SUPPORT_YES
 void init_iso2PowerDemandReqType(struct iso2PowerDemandReqType* iso2PowerDemandReqType);
+#endif /* ISO2_DEPLOY_PowerDemandReq */
 void init_iso2MinimumPMaxRequestType(struct iso2MinimumPMaxRequestType* iso2MinimumPMaxRequestType);
+#if ISO2_DEPLOY_DisconnectChargingDeviceRes == SUPPORT_YES
 void init_iso2DisconnectChargingDeviceResType(struct iso2DisconnectChargingDeviceResType* iso2DisconnectChargingDeviceResType);
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceRes */
+#if ISO2_DEPLOY_SessionSetupReq == SUPPORT_YES
 void init_iso2SessionSetupReqType(struct iso2SessionSetupReqType* iso2SessionSetupReqType);
+#endif /* ISO2_DEPLOY_SessionSetupReq */
+#if ISO2_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 void init_iso2PaymentDetailsReqType(struct iso2PaymentDetailsReqType* iso2PaymentDetailsReqType);
+#endif /* ISO2_DEPLOY_PaymentDetailsReq */
 void init_iso2Generic_EVFinePositioningParametersType(struct iso2Generic_EVFinePositioningParametersType* iso2Generic_EVFinePositioningParametersType);
+#if ISO2_DEPLOY_ConnectChargingDeviceReq == SUPPORT_YES
 void init_iso2ConnectChargingDeviceReqType(struct iso2ConnectChargingDeviceReqType* iso2ConnectChargingDeviceReqType);
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceReq */
 void init_iso2AC_EVSEChargeParameterType(struct iso2AC_EVSEChargeParameterType* iso2AC_EVSEChargeParameterType);
 void init_iso2SalesTariffEntryType(struct iso2SalesTariffEntryType* iso2SalesTariffEntryType);
 void init_iso2DC_EVSEBidirectionalParameterType(struct iso2DC_EVSEBidirectionalParameterType* iso2DC_EVSEBidirectionalParameterType);
 void init_iso2CanonicalizationMethodType(struct iso2CanonicalizationMethodType* iso2CanonicalizationMethodType);
 void init_iso2DisplayParametersType(struct iso2DisplayParametersType* iso2DisplayParametersType);
 void init_iso2DC_EVBidirectionalParameterType(struct iso2DC_EVBidirectionalParameterType* iso2DC_EVBidirectionalParameterType);
+#if ISO2_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 void init_iso2PaymentServiceSelectionReqType(struct iso2PaymentServiceSelectionReqType* iso2PaymentServiceSelectionReqType);
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionReq */
 void init_iso2MagneticVectorType(struct iso2MagneticVectorType* iso2MagneticVectorType);
 void init_iso2PhysicalValueType(struct iso2PhysicalValueType* iso2PhysicalValueType);
+#if ISO2_DEPLOY_SystemStatusReq == SUPPORT_YES
 void init_iso2SystemStatusReqType(struct iso2SystemStatusReqType* iso2SystemStatusReqType);
+#endif /* ISO2_DEPLOY_SystemStatusReq */
+#if ISO2_DEPLOY_SystemStatusRes == SUPPORT_YES
 void init_iso2SystemStatusResType(struct iso2SystemStatusResType* iso2SystemStatusResType);
+#endif /* ISO2_DEPLOY_SystemStatusRes */
 void init_iso2EVSEFinePositioningSetupParametersType(struct iso2EVSEFinePositioningSetupParametersType* iso2EVSEFinePositioningSetupParametersType);
+#if ISO2_DEPLOY_V2GResponse == SUPPORT_YES
 void init_iso2V2GResponseType(struct iso2V2GResponseType* iso2V2GResponseType);
+#endif /* ISO2_DEPLOY_V2GResponse */
 void init_iso2BodyType(struct iso2BodyType* iso2BodyType);
+#if ISO2_DEPLOY_PreChargeRes == SUPPORT_YES
 void init_iso2PreChargeResType(struct iso2PreChargeResType* iso2PreChargeResType);
+#endif /* ISO2_DEPLOY_PreChargeRes */
 void init_iso2EVSEFinePositioningParametersType(struct iso2EVSEFinePositioningParametersType* iso2EVSEFinePositioningParametersType);
+#if ISO2_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 void init_iso2PaymentServiceSelectionResType(struct iso2PaymentServiceSelectionResType* iso2PaymentServiceSelectionResType);
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionRes */
 void init_iso2DigestMethodType(struct iso2DigestMethodType* iso2DigestMethodType);
 void init_iso2TargetPositionType(struct iso2TargetPositionType* iso2TargetPositionType);
 void init_iso2LFA_EVFinePositioningParametersType(struct iso2LFA_EVFinePositioningParametersType* iso2LFA_EVFinePositioningParametersType);
 void init_iso2DC_EVChargeParameterType(struct iso2DC_EVChargeParameterType* iso2DC_EVChargeParameterType);
+#if ISO2_DEPLOY_ServiceDetailReq == SUPPORT_YES
 void init_iso2ServiceDetailReqType(struct iso2ServiceDetailReqType* iso2ServiceDetailReqType);
+#endif /* ISO2_DEPLOY_ServiceDetailReq */
+#if ISO2_DEPLOY_PreChargeReq == SUPPORT_YES
 void init_iso2PreChargeReqType(struct iso2PreChargeReqType* iso2PreChargeReqType);
+#endif /* ISO2_DEPLOY_PreChargeReq */
+#if ISO2_DEPLOY_Manifest == SUPPORT_YES
 void init_iso2ManifestType(struct iso2ManifestType* iso2ManifestType);
+#endif /* ISO2_DEPLOY_Manifest */
 void init_iso2AnonType_V2G_Message(struct iso2AnonType_V2G_Message* iso2AnonType_V2G_Message);
 void init_iso2SelectedServiceListType(struct iso2SelectedServiceListType* iso2SelectedServiceListType);
 void init_iso2Generic_EVSEFinePositioningParametersType(struct iso2Generic_EVSEFinePositioningParametersType* iso2Generic_EVSEFinePositioningParametersType);
@@ -4155,26 +4799,46 @@ void init_iso2ListOfRootCertificateIDsType(struct iso2ListOfRootCertificateIDsTy
 void init_iso2EVEnergyTransferParameterType(struct iso2EVEnergyTransferParameterType* iso2EVEnergyTransferParameterType);
 void init_iso2ContractSignatureEncryptedPrivateKeyType(struct iso2ContractSignatureEncryptedPrivateKeyType* iso2ContractSignatureEncryptedPrivateKeyType);
 void init_iso2MagneticVectorSetupListType(struct iso2MagneticVectorSetupListType* iso2MagneticVectorSetupListType);
+#if ISO2_DEPLOY_PairingReq == SUPPORT_YES
 void init_iso2PairingReqType(struct iso2PairingReqType* iso2PairingReqType);
+#endif /* ISO2_DEPLOY_PairingReq */
+#if ISO2_DEPLOY_CurrentDemandRes == SUPPORT_YES
 void init_iso2CurrentDemandResType(struct iso2CurrentDemandResType* iso2CurrentDemandResType);
+#endif /* ISO2_DEPLOY_CurrentDemandRes */
 void init_iso2X509IssuerSerialType(struct iso2X509IssuerSerialType* iso2X509IssuerSerialType);
+#if ISO2_DEPLOY_ChargingStatusReq == SUPPORT_YES
 void init_iso2ChargingStatusReqType(struct iso2ChargingStatusReqType* iso2ChargingStatusReqType);
+#endif /* ISO2_DEPLOY_ChargingStatusReq */
+#if ISO2_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 void init_iso2CertificateInstallationResType(struct iso2CertificateInstallationResType* iso2CertificateInstallationResType);
+#endif /* ISO2_DEPLOY_CertificateInstallationRes */
 void init_iso2SensorPackageType(struct iso2SensorPackageType* iso2SensorPackageType);
 void init_iso2PGPDataType(struct iso2PGPDataType* iso2PGPDataType);
+#if ISO2_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 void init_iso2ServiceDiscoveryResType(struct iso2ServiceDiscoveryResType* iso2ServiceDiscoveryResType);
+#endif /* ISO2_DEPLOY_ServiceDiscoveryRes */
 void init_iso2ServiceIDListType(struct iso2ServiceIDListType* iso2ServiceIDListType);
 void init_iso2EVFinePositioningSetupParametersType(struct iso2EVFinePositioningSetupParametersType* iso2EVFinePositioningSetupParametersType);
+#if ISO2_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 void init_iso2ChargeParameterDiscoveryResType(struct iso2ChargeParameterDiscoveryResType* iso2ChargeParameterDiscoveryResType);
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryRes */
+#if ISO2_DEPLOY_PowerDemandRes == SUPPORT_YES
 void init_iso2PowerDemandResType(struct iso2PowerDemandResType* iso2PowerDemandResType);
+#endif /* ISO2_DEPLOY_PowerDemandRes */
 void init_iso2ChargingProfileType(struct iso2ChargingProfileType* iso2ChargingProfileType);
+#if ISO2_DEPLOY_FinePositioningReq == SUPPORT_YES
 void init_iso2FinePositioningReqType(struct iso2FinePositioningReqType* iso2FinePositioningReqType);
+#endif /* ISO2_DEPLOY_FinePositioningReq */
 void init_iso2SalesTariffType(struct iso2SalesTariffType* iso2SalesTariffType);
 void init_iso2SensorType(struct iso2SensorType* iso2SensorType);
 void init_iso2SignatureValueType(struct iso2SignatureValueType* iso2SignatureValueType);
 void init_iso2SignedInfoType(struct iso2SignedInfoType* iso2SignedInfoType);
+#if ISO2_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 void init_iso2PowerDeliveryResType(struct iso2PowerDeliveryResType* iso2PowerDeliveryResType);
+#endif /* ISO2_DEPLOY_PowerDeliveryRes */
+#if ISO2_DEPLOY_CableCheckReq == SUPPORT_YES
 void init_iso2CableCheckReqType(struct iso2CableCheckReqType* iso2CableCheckReqType);
+#endif /* ISO2_DEPLOY_CableCheckReq */
 void init_iso2SelectedServiceType(struct iso2SelectedServiceType* iso2SelectedServiceType);
 void init_iso2DiffieHellmanPublickeyType(struct iso2DiffieHellmanPublickeyType* iso2DiffieHellmanPublickeyType);
 void init_iso2EVSEStatusType(struct iso2EVSEStatusType* iso2EVSEStatusType);
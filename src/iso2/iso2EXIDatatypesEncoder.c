@@ -34,6 +34,7 @@
 
 #include "EncoderChannel.h"
 #include "EXIHeaderEncoder.h"
+#include "Sha256.h"
 
 #include "iso2EXIDatatypes.h"
 #include "ErrorCodes.h"
@@ -43,41 +44,72 @@
 
 #if DEPLOY_ISO2_CODEC == SUPPORT_YES
 
-static int errn;
-
+/* Note: errn is a local of each encode function (reentrant encoding) */
 /* Forward Declarations */
 static int encode_iso2RetrievalMethodType(bitstream_t* stream, struct iso2RetrievalMethodType* iso2RetrievalMethodType);
+#if ISO2_DEPLOY_AuthorizationRes == SUPPORT_YES
 static int encode_iso2AuthorizationResType(bitstream_t* stream, struct iso2AuthorizationResType* iso2AuthorizationResType);
+#endif /* ISO2_DEPLOY_AuthorizationRes */
 static int encode_iso2MV_EVSEFinePositioningSetupParametersType(bitstream_t* stream, struct iso2MV_EVSEFinePositioningSetupParametersType* iso2MV_EVSEFinePositioningSetupParametersType);
 static int encode_iso2X509DataType(bitstream_t* stream, struct iso2X509DataType* iso2X509DataType);
 static int encode_iso2RSAKeyValueType(bitstream_t* stream, struct iso2RSAKeyValueType* iso2RSAKeyValueType);
+#if ISO2_DEPLOY_DC_BidirectionalControlRes == SUPPORT_YES
 static int encode_iso2DC_BidirectionalControlResType(bitstream_t* stream, struct iso2DC_BidirectionalControlResType* iso2DC_BidirectionalControlResType);
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlRes */
 static int encode_iso2CostType(bitstream_t* stream, struct iso2CostType* iso2CostType);
+#if ISO2_DEPLOY_ChargingStatusRes == SUPPORT_YES
 static int encode_iso2ChargingStatusResType(bitstream_t* stream, struct iso2ChargingStatusResType* iso2ChargingStatusResType);
+#endif /* ISO2_DEPLOY_ChargingStatusRes */
 static int encode_iso2MeterInfoType(bitstream_t* stream, struct iso2MeterInfoType* iso2MeterInfoType);
 static int encode_iso2AC_EVChargeParameterType(bitstream_t* stream, struct iso2AC_EVChargeParameterType* iso2AC_EVChargeParameterType);
 static int encode_iso2AC_EVSEBidirectionalParameterType(bitstream_t* stream, struct iso2AC_EVSEBidirectionalParameterType* iso2AC_EVSEBidirectionalParameterType);
+#if ISO2_DEPLOY_VehicleCheckOutRes == SUPPORT_YES
 static int encode_iso2VehicleCheckOutResType(bitstream_t* stream, struct iso2VehicleCheckOutResType* iso2VehicleCheckOutResType);
+#endif /* ISO2_DEPLOY_VehicleCheckOutRes */
 static int encode_iso2MagneticVectorListType(bitstream_t* stream, struct iso2MagneticVectorListType* iso2MagneticVectorListType);
+#if ISO2_DEPLOY_CableCheckRes == SUPPORT_YES
 static int encode_iso2CableCheckResType(bitstream_t* stream, struct iso2CableCheckResType* iso2CableCheckResType);
+#endif /* ISO2_DEPLOY_CableCheckRes */
+#if ISO2_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 static int encode_iso2ServiceDiscoveryReqType(bitstream_t* stream, struct iso2ServiceDiscoveryReqType* iso2ServiceDiscoveryReqType);
+#endif /* ISO2_DEPLOY_ServiceDiscoveryReq */
 static int encode_iso2ServiceType(bitstream_t* stream, struct iso2ServiceType* iso2ServiceType);
 static int encode_iso2ServiceParameterListType(bitstream_t* stream, struct iso2ServiceParameterListType* iso2ServiceParameterListType);
 static int encode_iso2PMaxScheduleType(bitstream_t* stream, struct iso2PMaxScheduleType* iso2PMaxScheduleType);
+#if ISO2_DEPLOY_SignatureProperties == SUPPORT_YES
 static int encode_iso2SignaturePropertiesType(bitstream_t* stream, struct iso2SignaturePropertiesType* iso2SignaturePropertiesType);
+#endif /* ISO2_DEPLOY_SignatureProperties */
 static int encode_iso2PMaxScheduleEntryType(bitstream_t* stream, struct iso2PMaxScheduleEntryType* iso2PMaxScheduleEntryType);
 static int encode_iso2SignatureType(bitstream_t* stream, struct iso2SignatureType* iso2SignatureType);
+#if ISO2_DEPLOY_VehicleCheckInReq == SUPPORT_YES
 static int encode_iso2VehicleCheckInReqType(bitstream_t* stream, struct iso2VehicleCheckInReqType* iso2VehicleCheckInReqType);
+#endif /* ISO2_DEPLOY_VehicleCheckInReq */
+#if ISO2_DEPLOY_ConnectChargingDeviceRes == SUPPORT_YES
 static int encode_iso2ConnectChargingDeviceResType(bitstream_t* stream, struct iso2ConnectChargingDeviceResType* iso2ConnectChargingDeviceResType);
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceRes */
+#if ISO2_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 static int encode_iso2WeldingDetectionResType(bitstream_t* stream, struct iso2WeldingDetectionResType* iso2WeldingDetectionResType);
+#endif /* ISO2_DEPLOY_WeldingDetectionRes */
+#if ISO2_DEPLOY_SessionStopRes == SUPPORT_YES
 static int encode_iso2SessionStopResType(bitstream_t* stream, struct iso2SessionStopResType* iso2SessionStopResType);
+#endif /* ISO2_DEPLOY_SessionStopRes */
+#if ISO2_DEPLOY_VehicleCheckInRes == SUPPORT_YES
 static int encode_iso2VehicleCheckInResType(bitstream_t* stream, struct iso2VehicleCheckInResType* iso2VehicleCheckInResType);
+#endif /* ISO2_DEPLOY_VehicleCheckInRes */
 static int encode_iso2ServiceListType(bitstream_t* stream, struct iso2ServiceListType* iso2ServiceListType);
+#if ISO2_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 static int encode_iso2CertificateUpdateResType(bitstream_t* stream, struct iso2CertificateUpdateResType* iso2CertificateUpdateResType);
+#endif /* ISO2_DEPLOY_CertificateUpdateRes */
+#if ISO2_DEPLOY_FinePositioningSetupRes == SUPPORT_YES
 static int encode_iso2FinePositioningSetupResType(bitstream_t* stream, struct iso2FinePositioningSetupResType* iso2FinePositioningSetupResType);
+#endif /* ISO2_DEPLOY_FinePositioningSetupRes */
 static int encode_iso2AC_EVBidirectionalParameterType(bitstream_t* stream, struct iso2AC_EVBidirectionalParameterType* iso2AC_EVBidirectionalParameterType);
+#if ISO2_DEPLOY_DC_BidirectionalControlReq == SUPPORT_YES
 static int encode_iso2DC_BidirectionalControlReqType(bitstream_t* stream, struct iso2DC_BidirectionalControlReqType* iso2DC_BidirectionalControlReqType);
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlReq */
+#if ISO2_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 static int encode_iso2CertificateUpdateReqType(bitstream_t* stream, struct iso2CertificateUpdateReqType* iso2CertificateUpdateReqType);
+#endif /* ISO2_DEPLOY_CertificateUpdateReq */
 static int encode_iso2ConsumptionCostType(bitstream_t* stream, struct iso2ConsumptionCostType* iso2ConsumptionCostType);
 static int encode_iso2SAScheduleListType(bitstream_t* stream, struct iso2SAScheduleListType* iso2SAScheduleListType);
 static int encode_iso2MagneticVectorSetupType(bitstream_t* stream, struct iso2MagneticVectorSetupType* iso2MagneticVectorSetupType);
@@ -86,14 +118,22 @@ static int encode_iso2PaymentOptionListType(bitstream_t* stream, struct iso2Paym
 static int encode_iso2LFA_EVSEFinePositioningParametersType(bitstream_t* stream, struct iso2LFA_EVSEFinePositioningParametersType* iso2LFA_EVSEFinePositioningParametersType);
 static int encode_iso2RelativeTimeIntervalType(bitstream_t* stream, struct iso2RelativeTimeIntervalType* iso2RelativeTimeIntervalType);
 static int encode_iso2EVFinePositioningParametersType(bitstream_t* stream, struct iso2EVFinePositioningParametersType* iso2EVFinePositioningParametersType);
+#if ISO2_DEPLOY_AlignmentCheckReq == SUPPORT_YES
 static int encode_iso2AlignmentCheckReqType(bitstream_t* stream, struct iso2AlignmentCheckReqType* iso2AlignmentCheckReqType);
+#endif /* ISO2_DEPLOY_AlignmentCheckReq */
+#if ISO2_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 static int encode_iso2CertificateInstallationReqType(bitstream_t* stream, struct iso2CertificateInstallationReqType* iso2CertificateInstallationReqType);
+#endif /* ISO2_DEPLOY_CertificateInstallationReq */
 static int encode_iso2TransformsType(bitstream_t* stream, struct iso2TransformsType* iso2TransformsType);
 static int encode_iso2ObjectType(bitstream_t* stream, struct iso2ObjectType* iso2ObjectType);
 static int encode_iso2SensorOrderListType(bitstream_t* stream, struct iso2SensorOrderListType* iso2SensorOrderListType);
+#if ISO2_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 static int encode_iso2ChargeParameterDiscoveryReqType(bitstream_t* stream, struct iso2ChargeParameterDiscoveryReqType* iso2ChargeParameterDiscoveryReqType);
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryReq */
 static int encode_iso2ParameterType(bitstream_t* stream, struct iso2ParameterType* iso2ParameterType);
+#if ISO2_DEPLOY_SessionStopReq == SUPPORT_YES
 static int encode_iso2SessionStopReqType(bitstream_t* stream, struct iso2SessionStopReqType* iso2SessionStopReqType);
+#endif /* ISO2_DEPLOY_SessionStopReq */
 static int encode_iso2SensorMeasurementsType(bitstream_t* stream, struct iso2SensorMeasurementsType* iso2SensorMeasurementsType);
 static int encode_iso2DC_EVSEChargeParameterType(bitstream_t* stream, struct iso2DC_EVSEChargeParameterType* iso2DC_EVSEChargeParameterType);
 static int encode_iso2SensorPackageListType(bitstream_t* stream, struct iso2SensorPackageListType* iso2SensorPackageListType);
@@ -106,68 +146,130 @@ static int encode_iso2DSAKeyValueType(bitstream_t* stream, struct iso2DSAKeyValu
 static int encode_iso2EntryType(bitstream_t* stream, struct iso2EntryType* iso2EntryType);
 static int encode_iso2MessageHeaderType(bitstream_t* stream, struct iso2MessageHeaderType* iso2MessageHeaderType);
 static int encode_iso2WPT_EVChargeParameterType(bitstream_t* stream, struct iso2WPT_EVChargeParameterType* iso2WPT_EVChargeParameterType);
+#if ISO2_DEPLOY_DisconnectChargingDeviceReq == SUPPORT_YES
 static int encode_iso2DisconnectChargingDeviceReqType(bitstream_t* stream, struct iso2DisconnectChargingDeviceReqType* iso2DisconnectChargingDeviceReqType);
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceReq */
 static int encode_iso2ChargeLoopReqType(bitstream_t* stream, struct iso2ChargeLoopReqType* iso2ChargeLoopReqType);
 static int encode_iso2V2GRequestType(bitstream_t* stream, struct iso2V2GRequestType* iso2V2GRequestType);
+#if ISO2_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 static int encode_iso2MeteringReceiptResType(bitstream_t* stream, struct iso2MeteringReceiptResType* iso2MeteringReceiptResType);
+#endif /* ISO2_DEPLOY_MeteringReceiptRes */
+#if ISO2_DEPLOY_SessionSetupRes == SUPPORT_YES
 static int encode_iso2SessionSetupResType(bitstream_t* stream, struct iso2SessionSetupResType* iso2SessionSetupResType);
+#endif /* ISO2_DEPLOY_SessionSetupRes */
+#if ISO2_DEPLOY_AC_BidirectionalControlReq == SUPPORT_YES
 static int encode_iso2AC_BidirectionalControlReqType(bitstream_t* stream, struct iso2AC_BidirectionalControlReqType* iso2AC_BidirectionalControlReqType);
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlReq */
 static int encode_iso2MV_EVSEFinePositioningParametersType(bitstream_t* stream, struct iso2MV_EVSEFinePositioningParametersType* iso2MV_EVSEFinePositioningParametersType);
 static int encode_iso2ReferenceType(bitstream_t* stream, struct iso2ReferenceType* iso2ReferenceType);
 static int encode_iso2EVSEEnergyTransferParameterType(bitstream_t* stream, struct iso2EVSEEnergyTransferParameterType* iso2EVSEEnergyTransferParameterType);
+#if ISO2_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 static int encode_iso2MeteringReceiptReqType(bitstream_t* stream, struct iso2MeteringReceiptReqType* iso2MeteringReceiptReqType);
+#endif /* ISO2_DEPLOY_MeteringReceiptReq */
 static int encode_iso2KeyValueType(bitstream_t* stream, struct iso2KeyValueType* iso2KeyValueType);
 static int encode_iso2SensorListType(bitstream_t* stream, struct iso2SensorListType* iso2SensorListType);
+#if ISO2_DEPLOY_CurrentDemandReq == SUPPORT_YES
 static int encode_iso2CurrentDemandReqType(bitstream_t* stream, struct iso2CurrentDemandReqType* iso2CurrentDemandReqType);
+#endif /* ISO2_DEPLOY_CurrentDemandReq */
+#if ISO2_DEPLOY_FinePositioningSetupReq == SUPPORT_YES
 static int encode_iso2FinePositioningSetupReqType(bitstream_t* stream, struct iso2FinePositioningSetupReqType* iso2FinePositioningSetupReqType);
+#endif /* ISO2_DEPLOY_FinePositioningSetupReq */
 static int encode_iso2LFA_EVFinePositioningSetupParametersType(bitstream_t* stream, struct iso2LFA_EVFinePositioningSetupParametersType* iso2LFA_EVFinePositioningSetupParametersType);
 static int encode_iso2SAScheduleTupleType(bitstream_t* stream, struct iso2SAScheduleTupleType* iso2SAScheduleTupleType);
 static int encode_iso2WPT_EVSEChargeParameterType(bitstream_t* stream, struct iso2WPT_EVSEChargeParameterType* iso2WPT_EVSEChargeParameterType);
+#if ISO2_DEPLOY_FinePositioningRes == SUPPORT_YES
 static int encode_iso2FinePositioningResType(bitstream_t* stream, struct iso2FinePositioningResType* iso2FinePositioningResType);
+#endif /* ISO2_DEPLOY_FinePositioningRes */
 static int encode_iso2BodyBaseType(bitstream_t* stream, struct iso2BodyBaseType* iso2BodyBaseType);
+#if ISO2_DEPLOY_ServiceDetailRes == SUPPORT_YES
 static int encode_iso2ServiceDetailResType(bitstream_t* stream, struct iso2ServiceDetailResType* iso2ServiceDetailResType);
+#endif /* ISO2_DEPLOY_ServiceDetailRes */
+#if ISO2_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 static int encode_iso2PowerDeliveryReqType(bitstream_t* stream, struct iso2PowerDeliveryReqType* iso2PowerDeliveryReqType);
+#endif /* ISO2_DEPLOY_PowerDeliveryReq */
+#if ISO2_DEPLOY_PairingRes == SUPPORT_YES
 static int encode_iso2PairingResType(bitstream_t* stream, struct iso2PairingResType* iso2PairingResType);
+#endif /* ISO2_DEPLOY_PairingRes */
+#if ISO2_DEPLOY_AuthorizationReq == SUPPORT_YES
 static int encode_iso2AuthorizationReqType(bitstream_t* stream, struct iso2AuthorizationReqType* iso2AuthorizationReqType);
+#endif /* ISO2_DEPLOY_AuthorizationReq */
 static int encode_iso2ParameterSetType(bitstream_t* stream, struct iso2ParameterSetType* iso2ParameterSetType);
 static int encode_iso2SPKIDataType(bitstream_t* stream, struct iso2SPKIDataType* iso2SPKIDataType);
+#if ISO2_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 static int encode_iso2PaymentDetailsResType(bitstream_t* stream, struct iso2PaymentDetailsResType* iso2PaymentDetailsResType);
+#endif /* ISO2_DEPLOY_PaymentDetailsRes */
 static int encode_iso2SignatureMethodType(bitstream_t* stream, struct iso2SignatureMethodType* iso2SignatureMethodType);
+#if ISO2_DEPLOY_AC_BidirectionalControlRes == SUPPORT_YES
 static int encode_iso2AC_BidirectionalControlResType(bitstream_t* stream, struct iso2AC_BidirectionalControlResType* iso2AC_BidirectionalControlResType);
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlRes */
+#if ISO2_DEPLOY_VehicleCheckOutReq == SUPPORT_YES
 static int encode_iso2VehicleCheckOutReqType(bitstream_t* stream, struct iso2VehicleCheckOutReqType* iso2VehicleCheckOutReqType);
+#endif /* ISO2_DEPLOY_VehicleCheckOutReq */
+#if ISO2_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 static int encode_iso2WeldingDetectionReqType(bitstream_t* stream, struct iso2WeldingDetectionReqType* iso2WeldingDetectionReqType);
+#endif /* ISO2_DEPLOY_WeldingDetectionReq */
+#if ISO2_DEPLOY_AlignmentCheckRes == SUPPORT_YES
 static int encode_iso2AlignmentCheckResType(bitstream_t* stream, struct iso2AlignmentCheckResType* iso2AlignmentCheckResType);
+#endif /* ISO2_DEPLOY_AlignmentCheckRes */
+#if ISO2_DEPLOY_PowerDemandReq == SUPPORT_YES
 static int encode_iso2PowerDemandReqType(bitstream_t* stream, struct iso2PowerDemandReqType* iso2PowerDemandReqType);
+#endif /* ISO2_DEPLOY_PowerDemandReq */
 static int encode_iso2MinimumPMaxRequestType(bitstream_t* stream, struct iso2MinimumPMaxRequestType* iso2MinimumPMaxRequestType);
+#if ISO2_DEPLOY_DisconnectChargingDeviceRes == SUPPORT_YES
 static int encode_iso2DisconnectChargingDeviceResType(bitstream_t* stream, struct iso2DisconnectChargingDeviceResType* iso2DisconnectChargingDeviceResType);
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceRes */
+#if ISO2_DEPLOY_SessionSetupReq == SUPPORT_YES
 static int encode_iso2SessionSetupReqType(bitstream_t* stream, struct iso2SessionSetupReqType* iso2SessionSetupReqType);
+#endif /* ISO2_DEPLOY_SessionSetupReq */
+#if ISO2_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 static int encode_iso2PaymentDetailsReqType(bitstream_t* stream, struct iso2PaymentDetailsReqType* iso2PaymentDetailsReqType);
+#endif /* ISO2_DEPLOY_PaymentDetailsReq */
 static int encode_iso2Generic_EVFinePositioningParametersType(bitstream_t* stream, struct iso2Generic_EVFinePositioningParametersType* iso2Generic_EVFinePositioningParametersType);
+#if ISO2_DEPLOY_ConnectChargingDeviceReq == SUPPORT_YES
 static int encode_iso2ConnectChargingDeviceReqType(bitstream_t* stream, struct iso2ConnectChargingDeviceReqType* iso2ConnectChargingDeviceReqType);
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceReq */
 static int encode_iso2AC_EVSEChargeParameterType(bitstream_t* stream, struct iso2AC_EVSEChargeParameterType* iso2AC_EVSEChargeParameterType);
 static int encode_iso2SalesTariffEntryType(bitstream_t* stream, struct iso2SalesTariffEntryType* iso2SalesTariffEntryType);
 static int encode_iso2DC_EVSEBidirectionalParameterType(bitstream_t* stream, struct iso2DC_EVSEBidirectionalParameterType* iso2DC_EVSEBidirectionalParameterType);
 static int encode_iso2CanonicalizationMethodType(bitstream_t* stream, struct iso2CanonicalizationMethodType* iso2CanonicalizationMethodType);
 static int encode_iso2DisplayParametersType(bitstream_t* stream, struct iso2DisplayParametersType* iso2DisplayParametersType);
 static int encode_iso2DC_EVBidirectionalParameterType(bitstream_t* stream, struct iso2DC_EVBidirectionalParameterType* iso2DC_EVBidirectionalParameterType);
+#if ISO2_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 static int encode_iso2PaymentServiceSelectionReqType(bitstream_t* stream, struct iso2PaymentServiceSelectionReqType* iso2PaymentServiceSelectionReqType);
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionReq */
 static int encode_iso2MagneticVectorType(bitstream_t* stream, struct iso2MagneticVectorType* iso2MagneticVectorType);
 static int encode_iso2PhysicalValueType(bitstream_t* stream, struct iso2PhysicalValueType* iso2PhysicalValueType);
+#if ISO2_DEPLOY_SystemStatusReq == SUPPORT_YES
 static int encode_iso2SystemStatusReqType(bitstream_t* stream, struct iso2SystemStatusReqType* iso2SystemStatusReqType);
+#endif /* ISO2_DEPLOY_SystemStatusReq */
+#if ISO2_DEPLOY_SystemStatusRes == SUPPORT_YES
 static int encode_iso2SystemStatusResType(bitstream_t* stream, struct iso2SystemStatusResType* iso2SystemStatusResType);
+#endif /* ISO2_DEPLOY_SystemStatusRes */
 static int encode_iso2EVSEFinePositioningSetupParametersType(bitstream_t* stream, struct iso2EVSEFinePositioningSetupParametersType* iso2EVSEFinePositioningSetupParametersType);
+#if ISO2_DEPLOY_V2GResponse == SUPPORT_YES
 static int encode_iso2V2GResponseType(bitstream_t* stream, struct iso2V2GResponseType* iso2V2GResponseType);
+#endif /* ISO2_DEPLOY_V2GResponse */
 static int encode_iso2BodyType(bitstream_t* stream, struct iso2BodyType* iso2BodyType);
+#if ISO2_DEPLOY_PreChargeRes == SUPPORT_YES
 static int encode_iso2PreChargeResType(bitstream_t* stream, struct iso2PreChargeResType* iso2PreChargeResType);
+#endif /* ISO2_DEPLOY_PreChargeRes */
 static int encode_iso2EVSEFinePositioningParametersType(bitstream_t* stream, struct iso2EVSEFinePositioningParametersType* iso2EVSEFinePositioningParametersType);
+#if ISO2_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 static int encode_iso2PaymentServiceSelectionResType(bitstream_t* stream, struct iso2PaymentServiceSelectionResType* iso2PaymentServiceSelectionResType);
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionRes */
 static int encode_iso2DigestMethodType(bitstream_t* stream, struct iso2DigestMethodType* iso2DigestMethodType);
 static int encode_iso2TargetPositionType(bitstream_t* stream, struct iso2TargetPositionType* iso2TargetPositionType);
 static int encode_iso2LFA_EVFinePositioningParametersType(bitstream_t* stream, struct iso2LFA_EVFinePositioningParametersType* iso2LFA_EVFinePositioningParametersType);
 static int encode_iso2DC_EVChargeParameterType(bitstream_t* stream, struct iso2DC_EVChargeParameterType* iso2DC_EVChargeParameterType);
+#if ISO2_DEPLOY_ServiceDetailReq == SUPPORT_YES
 static int encode_iso2ServiceDetailReqType(bitstream_t* stream, struct iso2ServiceDetailReqType* iso2ServiceDetailReqType);
+#endif /* ISO2_DEPLOY_ServiceDetailReq */
+#if ISO2_DEPLOY_PreChargeReq == SUPPORT_YES
 static int encode_iso2PreChargeReqType(bitstream_t* stream, struct iso2PreChargeReqType* iso2PreChargeReqType);
+#endif /* ISO2_DEPLOY_PreChargeReq */
+#if ISO2_DEPLOY_Manifest == SUPPORT_YES
 static int encode_iso2ManifestType(bitstream_t* stream, struct iso2ManifestType* iso2ManifestType);
+#endif /* ISO2_DEPLOY_Manifest */
 static int encode_iso2AnonType_V2G_Message(bitstream_t* stream, struct iso2AnonType_V2G_Message* iso2AnonType_V2G_Message);
 static int encode_iso2SelectedServiceListType(bitstream_t* stream, struct iso2SelectedServiceListType* iso2SelectedServiceListType);
 static int encode_iso2Generic_EVSEFinePositioningParametersType(bitstream_t* stream, struct iso2Generic_EVSEFinePositioningParametersType* iso2Generic_EVSEFinePositioningParametersType);
@@ -178,26 +280,46 @@ static int encode_iso2ListOfRootCertificateIDsType(bitstream_t* stream, struct i
 static int encode_iso2EVEnergyTransferParameterType(bitstream_t* stream, struct iso2EVEnergyTransferParameterType* iso2EVEnergyTransferParameterType);
 static int encode_iso2ContractSignatureEncryptedPrivateKeyType(bitstream_t* stream, struct iso2ContractSignatureEncryptedPrivateKeyType* iso2ContractSignatureEncryptedPrivateKeyType);
 static int encode_iso2MagneticVectorSetupListType(bitstream_t* stream, struct iso2MagneticVectorSetupListType* iso2MagneticVectorSetupListType);
+#if ISO2_DEPLOY_PairingReq == SUPPORT_YES
 static int encode_iso2PairingReqType(bitstream_t* stream, struct iso2PairingReqType* iso2PairingReqType);
+#endif /* ISO2_DEPLOY_PairingReq */
+#if ISO2_DEPLOY_CurrentDemandRes == SUPPORT_YES
 static int encode_iso2CurrentDemandResType(bitstream_t* stream, struct iso2CurrentDemandResType* iso2CurrentDemandResType);
+#endif /* ISO2_DEPLOY_CurrentDemandRes */
 static int encode_iso2X509IssuerSerialType(bitstream_t* stream, struct iso2X509IssuerSerialType* iso2X509IssuerSerialType);
+#if ISO2_DEPLOY_ChargingStatusReq == SUPPORT_YES
 static int encode_iso2ChargingStatusReqType(bitstream_t* stream, struct iso2ChargingStatusReqType* iso2ChargingStatusReqType);
+#endif /* ISO2_DEPLOY_ChargingStatusReq */
+#if ISO2_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 static int encode_iso2CertificateInstallationResType(bitstream_t* stream, struct iso2CertificateInstallationResType* iso2CertificateInstallationResType);
+#endif /* ISO2_DEPLOY_CertificateInstallationRes */
 static int encode_iso2SensorPackageType(bitstream_t* stream, struct iso2SensorPackageType* iso2SensorPackageType);
 static int encode_iso2PGPDataType(bitstream_t* stream, struct iso2PGPDataType* iso2PGPDataType);
+#if ISO2_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 static int encode_iso2ServiceDiscoveryResType(bitstream_t* stream, struct iso2ServiceDiscoveryResType* iso2ServiceDiscoveryResType);
+#endif /* ISO2_DEPLOY_ServiceDiscoveryRes */
 static int encode_iso2ServiceIDListType(bitstream_t* stream, struct iso2ServiceIDListType* iso2ServiceIDListType);
 static int encode_iso2EVFinePositioningSetupParametersType(bitstream_t* stream, struct iso2EVFinePositioningSetupParametersType* iso2EVFinePositioningSetupParametersType);
+#if ISO2_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 static int encode_iso2ChargeParameterDiscoveryResType(bitstream_t* stream, struct iso2ChargeParameterDiscoveryResType* iso2ChargeParameterDiscoveryResType);
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryRes */
+#if ISO2_DEPLOY_PowerDemandRes == SUPPORT_YES
 static int encode_iso2PowerDemandResType(bitstream_t* stream, struct iso2PowerDemandResType* iso2PowerDemandResType);
+#endif /* ISO2_DEPLOY_PowerDemandRes */
 static int encode_iso2ChargingProfileType(bitstream_t* stream, struct iso2ChargingProfileType* iso2ChargingProfileType);
+#if ISO2_DEPLOY_FinePositioningReq == SUPPORT_YES
 static int encode_iso2FinePositioningReqType(bitstream_t* stream, struct iso2FinePositioningReqType* iso2FinePositioningReqType);
+#endif /* ISO2_DEPLOY_FinePositioningReq */
 static int encode_iso2SalesTariffType(bitstream_t* stream, struct iso2SalesTariffType* iso2SalesTariffType);
 static int encode_iso2SensorType(bitstream_t* stream, struct iso2SensorType* iso2SensorType);
 static int encode_iso2SignatureValueType(bitstream_t* stream, struct iso2SignatureValueType* iso2SignatureValueType);
 static int encode_iso2SignedInfoType(bitstream_t* stream, struct iso2SignedInfoType* iso2SignedInfoType);
+#if ISO2_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 static int encode_iso2PowerDeliveryResType(bitstream_t* stream, struct iso2PowerDeliveryResType* iso2PowerDeliveryResType);
+#endif /* ISO2_DEPLOY_PowerDeliveryRes */
+#if ISO2_DEPLOY_CableCheckReq == SUPPORT_YES
 static int encode_iso2CableCheckReqType(bitstream_t* stream, struct iso2CableCheckReqType* iso2CableCheckReqType);
+#endif /* ISO2_DEPLOY_CableCheckReq */
 static int encode_iso2SelectedServiceType(bitstream_t* stream, struct iso2SelectedServiceType* iso2SelectedServiceType);
 static int encode_iso2DiffieHellmanPublickeyType(bitstream_t* stream, struct iso2DiffieHellmanPublickeyType* iso2DiffieHellmanPublickeyType);
 static int encode_iso2EVSEStatusType(bitstream_t* stream, struct iso2EVSEStatusType* iso2EVSEStatusType);
@@ -205,6 +327,7 @@ static int encode_iso2EVSEStatusType(bitstream_t* stream, struct iso2EVSEStatusT
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RetrievalMethodType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2RetrievalMethodType(bitstream_t* stream, struct iso2RetrievalMethodType* iso2RetrievalMethodType) {
+	int errn = 0;
 	int grammarID = 0;
 	int done = 0;
 	
@@ -216,21 +339,15 @@ static int encode_iso2RetrievalMethodType(bitstream_t* stream, struct iso2Retrie
 			if ( iso2RetrievalMethodType->Type_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2RetrievalMethodType->Type.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2RetrievalMethodType->Type.characters, iso2RetrievalMethodType->Type.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Type */, iso2RetrievalMethodType->Type.characters, iso2RetrievalMethodType->Type.charactersLen);
 				}
 				grammarID = 1;
 			} else 			if ( iso2RetrievalMethodType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2RetrievalMethodType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2RetrievalMethodType->URI.characters, iso2RetrievalMethodType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 28 /* {}URI */, iso2RetrievalMethodType->URI.characters, iso2RetrievalMethodType->URI.charactersLen);
 				}
 				grammarID = 2;
 			} else 			if ( iso2RetrievalMethodType->Transforms_isUsed == 1u ) {
@@ -254,11 +371,8 @@ static int encode_iso2RetrievalMethodType(bitstream_t* stream, struct iso2Retrie
 			if ( iso2RetrievalMethodType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2RetrievalMethodType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2RetrievalMethodType->URI.characters, iso2RetrievalMethodType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 28 /* {}URI */, iso2RetrievalMethodType->URI.characters, iso2RetrievalMethodType->URI.charactersLen);
 				}
 				grammarID = 2;
 			} else 			if ( iso2RetrievalMethodType->Transforms_isUsed == 1u ) {
@@ -319,7 +433,9 @@ static int encode_iso2RetrievalMethodType(bitstream_t* stream, struct iso2Retrie
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,AuthorizationResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEProcessing))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_AuthorizationRes == SUPPORT_YES
 static int encode_iso2AuthorizationResType(bitstream_t* stream, struct iso2AuthorizationResType* iso2AuthorizationResType) {
+	int errn = 0;
 	int grammarID = 5;
 	int done = 0;
 	
@@ -408,9 +524,11 @@ static int encode_iso2AuthorizationResType(bitstream_t* stream, struct iso2Autho
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_AuthorizationRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MV_EVSEFinePositioningSetupParametersType',  base type name='EVSEFinePositioningSetupParametersType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":FrequencyChannel{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MagneticVectorSetupList{0-1})',  derivedBy='EXTENSION'.  */
 static int encode_iso2MV_EVSEFinePositioningSetupParametersType(bitstream_t* stream, struct iso2MV_EVSEFinePositioningSetupParametersType* iso2MV_EVSEFinePositioningSetupParametersType) {
+	int errn = 0;
 	int grammarID = 8;
 	int done = 0;
 	
@@ -490,6 +608,7 @@ static int encode_iso2MV_EVSEFinePositioningSetupParametersType(bitstream_t* str
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509DataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":X509IssuerSerial|"http://www.w3.org/2000/09/xmldsig#":X509SKI|"http://www.w3.org/2000/09/xmldsig#":X509SubjectName|"http://www.w3.org/2000/09/xmldsig#":X509Certificate|"http://www.w3.org/2000/09/xmldsig#":X509CRL|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_iso2X509DataType(bitstream_t* stream, struct iso2X509DataType* iso2X509DataType) {
+	int errn = 0;
 	int grammarID = 10;
 	int done = 0;
 	int wcDone = 0;
@@ -532,10 +651,9 @@ static int encode_iso2X509DataType(bitstream_t* stream, struct iso2X509DataType*
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2X509DataType->X509SubjectName.array[iso2X509DataType_X509SubjectName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, iso2X509DataType->X509SubjectName.array[iso2X509DataType_X509SubjectName_currArrayIndex].characters, iso2X509DataType->X509SubjectName.array[iso2X509DataType_X509SubjectName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2X509DataType->X509SubjectName.array[iso2X509DataType_X509SubjectName_currArrayIndex].characters, iso2X509DataType->X509SubjectName.array[iso2X509DataType_X509SubjectName_currArrayIndex].charactersLen);
 							iso2X509DataType_X509SubjectName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -612,10 +730,9 @@ static int encode_iso2X509DataType(bitstream_t* stream, struct iso2X509DataType*
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2X509DataType->X509SubjectName.array[iso2X509DataType_X509SubjectName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, iso2X509DataType->X509SubjectName.array[iso2X509DataType_X509SubjectName_currArrayIndex].characters, iso2X509DataType->X509SubjectName.array[iso2X509DataType_X509SubjectName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2X509DataType->X509SubjectName.array[iso2X509DataType_X509SubjectName_currArrayIndex].characters, iso2X509DataType->X509SubjectName.array[iso2X509DataType_X509SubjectName_currArrayIndex].charactersLen);
 							iso2X509DataType_X509SubjectName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -681,6 +798,7 @@ static int encode_iso2X509DataType(bitstream_t* stream, struct iso2X509DataType*
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Modulus,"http://www.w3.org/2000/09/xmldsig#":Exponent)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2RSAKeyValueType(bitstream_t* stream, struct iso2RSAKeyValueType* iso2RSAKeyValueType) {
+	int errn = 0;
 	int grammarID = 12;
 	int done = 0;
 	
@@ -753,7 +871,9 @@ static int encode_iso2RSAKeyValueType(bitstream_t* stream, struct iso2RSAKeyValu
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,DC_BidirectionalControlResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEPresentCurrent,"urn:iso:15118:2:2016:MsgBody":EVSEPresentVoltage,"urn:iso:15118:2:2016:MsgBody":EVSEPowerLimitAchieved,"urn:iso:15118:2:2016:MsgBody":EVSECurrentLimitAchieved,"urn:iso:15118:2:2016:MsgBody":EVSEVoltageLimitAchieved,"urn:iso:15118:2:2016:MsgBody":EVSEMaximumChargePower{0-1},"urn:iso:15118:2:2016:MsgBody":EVSEMaximumDischargePower{0-1},"urn:iso:15118:2:2016:MsgBody":EVSEMaximumChargeCurrent{0-1},"urn:iso:15118:2:2016:MsgBody":EVSEMaximumDischargeCurrent{0-1},"urn:iso:15118:2:2016:MsgBody":EVSEMaximumVoltage{0-1},"urn:iso:15118:2:2016:MsgBody":EVSEMinimumVoltage{0-1},"urn:iso:15118:2:2016:MsgBody":EVSEID,"urn:iso:15118:2:2016:MsgBody":SAScheduleTupleID{0-1},"urn:iso:15118:2:2016:MsgBody":MeterInfo{0-1},"urn:iso:15118:2:2016:MsgBody":ReceiptRequired{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_DC_BidirectionalControlRes == SUPPORT_YES
 static int encode_iso2DC_BidirectionalControlResType(bitstream_t* stream, struct iso2DC_BidirectionalControlResType* iso2DC_BidirectionalControlResType) {
+	int errn = 0;
 	int grammarID = 14;
 	int done = 0;
 	
@@ -918,11 +1038,8 @@ static int encode_iso2DC_BidirectionalControlResType(bitstream_t* stream, struct
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2DC_BidirectionalControlResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -970,11 +1087,8 @@ static int encode_iso2DC_BidirectionalControlResType(bitstream_t* stream, struct
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2DC_BidirectionalControlResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -1016,11 +1130,8 @@ static int encode_iso2DC_BidirectionalControlResType(bitstream_t* stream, struct
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2DC_BidirectionalControlResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -1056,11 +1167,8 @@ static int encode_iso2DC_BidirectionalControlResType(bitstream_t* stream, struct
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2DC_BidirectionalControlResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -1090,11 +1198,8 @@ static int encode_iso2DC_BidirectionalControlResType(bitstream_t* stream, struct
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2DC_BidirectionalControlResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -1118,11 +1223,8 @@ static int encode_iso2DC_BidirectionalControlResType(bitstream_t* stream, struct
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2DC_BidirectionalControlResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -1140,11 +1242,8 @@ static int encode_iso2DC_BidirectionalControlResType(bitstream_t* stream, struct
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2DC_BidirectionalControlResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2DC_BidirectionalControlResType->EVSEID.characters, iso2DC_BidirectionalControlResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -1171,7 +1270,11 @@ static int encode_iso2DC_BidirectionalControlResType(bitstream_t* stream, struct
 			} else 			if ( iso2DC_BidirectionalControlResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2MeterInfoType(stream, iso2DC_BidirectionalControlResType->MeterInfo );
+#else
 					errn = encode_iso2MeterInfoType(stream, &iso2DC_BidirectionalControlResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 30;
 			} else 			if ( iso2DC_BidirectionalControlResType->ReceiptRequired_isUsed == 1u ) {
@@ -1201,7 +1304,11 @@ static int encode_iso2DC_BidirectionalControlResType(bitstream_t* stream, struct
 			if ( iso2DC_BidirectionalControlResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2MeterInfoType(stream, iso2DC_BidirectionalControlResType->MeterInfo );
+#else
 					errn = encode_iso2MeterInfoType(stream, &iso2DC_BidirectionalControlResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 30;
 			} else 			if ( iso2DC_BidirectionalControlResType->ReceiptRequired_isUsed == 1u ) {
@@ -1272,9 +1379,11 @@ static int encode_iso2DC_BidirectionalControlResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,CostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":costKind,"urn:iso:15118:2:2016:MsgDataTypes":amount)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2CostType(bitstream_t* stream, struct iso2CostType* iso2CostType) {
+	int errn = 0;
 	int grammarID = 31;
 	int done = 0;
 	
@@ -1335,7 +1444,9 @@ static int encode_iso2CostType(bitstream_t* stream, struct iso2CostType* iso2Cos
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,ChargingStatusResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEID,"urn:iso:15118:2:2016:MsgBody":SAScheduleTupleID{0-1},"urn:iso:15118:2:2016:MsgBody":MeterInfo{0-1},"urn:iso:15118:2:2016:MsgBody":ReceiptRequired{0-1},"urn:iso:15118:2:2016:MsgBody":EVSETargetPower{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_ChargingStatusRes == SUPPORT_YES
 static int encode_iso2ChargingStatusResType(bitstream_t* stream, struct iso2ChargingStatusResType* iso2ChargingStatusResType) {
+	int errn = 0;
 	int grammarID = 33;
 	int done = 0;
 	
@@ -1374,11 +1485,8 @@ static int encode_iso2ChargingStatusResType(bitstream_t* stream, struct iso2Char
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ChargingStatusResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2ChargingStatusResType->EVSEID.characters, iso2ChargingStatusResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2ChargingStatusResType->EVSEID.characters, iso2ChargingStatusResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -1396,11 +1504,8 @@ static int encode_iso2ChargingStatusResType(bitstream_t* stream, struct iso2Char
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ChargingStatusResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2ChargingStatusResType->EVSEID.characters, iso2ChargingStatusResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2ChargingStatusResType->EVSEID.characters, iso2ChargingStatusResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -1427,7 +1532,11 @@ static int encode_iso2ChargingStatusResType(bitstream_t* stream, struct iso2Char
 			} else 			if ( iso2ChargingStatusResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2MeterInfoType(stream, iso2ChargingStatusResType->MeterInfo );
+#else
 					errn = encode_iso2MeterInfoType(stream, &iso2ChargingStatusResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 38;
 			} else 			if ( iso2ChargingStatusResType->ReceiptRequired_isUsed == 1u ) {
@@ -1463,7 +1572,11 @@ static int encode_iso2ChargingStatusResType(bitstream_t* stream, struct iso2Char
 			if ( iso2ChargingStatusResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2MeterInfoType(stream, iso2ChargingStatusResType->MeterInfo );
+#else
 					errn = encode_iso2MeterInfoType(stream, &iso2ChargingStatusResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 38;
 			} else 			if ( iso2ChargingStatusResType->ReceiptRequired_isUsed == 1u ) {
@@ -1564,9 +1677,11 @@ static int encode_iso2ChargingStatusResType(bitstream_t* stream, struct iso2Char
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_ChargingStatusRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MeterInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":MeterID,"urn:iso:15118:2:2016:MsgDataTypes":MeterReadingCharged{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MeterReadingDischarged{0-1},"urn:iso:15118:2:2016:MsgDataTypes":SigMeterReading{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MeterStatus{0-1},"urn:iso:15118:2:2016:MsgDataTypes":TMeter{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2MeterInfoType(bitstream_t* stream, struct iso2MeterInfoType* iso2MeterInfoType) {
+	int errn = 0;
 	int grammarID = 40;
 	int done = 0;
 	
@@ -1581,11 +1696,8 @@ static int encode_iso2MeterInfoType(bitstream_t* stream, struct iso2MeterInfoTyp
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2MeterInfoType->MeterID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2MeterInfoType->MeterID.characters, iso2MeterInfoType->MeterID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 18 /* {urn:iso:15118:2:2016:MsgDataTypes}MeterID */, iso2MeterInfoType->MeterID.characters, iso2MeterInfoType->MeterID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -1869,6 +1981,7 @@ static int encode_iso2MeterInfoType(bitstream_t* stream, struct iso2MeterInfoTyp
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,AC_EVChargeParameterType',  base type name='EVEnergyTransferParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgDataTypes":DepartureTime),("urn:iso:15118:2:2016:MsgDataTypes":EVMaximumChargePower,"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVTargetEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumVoltage))',  derivedBy='EXTENSION'.  */
 static int encode_iso2AC_EVChargeParameterType(bitstream_t* stream, struct iso2AC_EVChargeParameterType* iso2AC_EVChargeParameterType) {
+	int errn = 0;
 	int grammarID = 46;
 	int done = 0;
 	
@@ -2038,6 +2151,7 @@ static int encode_iso2AC_EVChargeParameterType(bitstream_t* stream, struct iso2A
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,AC_EVSEBidirectionalParameterType',  base type name='AC_EVSEChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgDataTypes":EVSEMaximumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVSENominalVoltage,"urn:iso:15118:2:2016:MsgDataTypes":EVSENominalFrequency),("urn:iso:15118:2:2016:MsgDataTypes":EVSEMaximumDischargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVSENominalFrequency))',  derivedBy='EXTENSION'.  */
 static int encode_iso2AC_EVSEBidirectionalParameterType(bitstream_t* stream, struct iso2AC_EVSEBidirectionalParameterType* iso2AC_EVSEBidirectionalParameterType) {
+	int errn = 0;
 	int grammarID = 54;
 	int done = 0;
 	
@@ -2128,7 +2242,9 @@ static int encode_iso2AC_EVSEBidirectionalParameterType(bitstream_t* stream, str
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,VehicleCheckOutResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSECheckOutStatus))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_VehicleCheckOutRes == SUPPORT_YES
 static int encode_iso2VehicleCheckOutResType(bitstream_t* stream, struct iso2VehicleCheckOutResType* iso2VehicleCheckOutResType) {
+	int errn = 0;
 	int grammarID = 59;
 	int done = 0;
 	
@@ -2217,9 +2333,11 @@ static int encode_iso2VehicleCheckOutResType(bitstream_t* stream, struct iso2Veh
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_VehicleCheckOutRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MagneticVectorListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":MagneticVector{1-255})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2MagneticVectorListType(bitstream_t* stream, struct iso2MagneticVectorListType* iso2MagneticVectorListType) {
+	int errn = 0;
 	int grammarID = 62;
 	int done = 0;
 	
@@ -6835,7 +6953,9 @@ static int encode_iso2MagneticVectorListType(bitstream_t* stream, struct iso2Mag
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,CableCheckResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEProcessing))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_CableCheckRes == SUPPORT_YES
 static int encode_iso2CableCheckResType(bitstream_t* stream, struct iso2CableCheckResType* iso2CableCheckResType) {
+	int errn = 0;
 	int grammarID = 5;
 	int done = 0;
 	
@@ -6924,9 +7044,12 @@ static int encode_iso2CableCheckResType(bitstream_t* stream, struct iso2CableChe
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_CableCheckRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,ServiceDiscoveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":SupportedServiceIDs{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 static int encode_iso2ServiceDiscoveryReqType(bitstream_t* stream, struct iso2ServiceDiscoveryReqType* iso2ServiceDiscoveryReqType) {
+	int errn = 0;
 	int grammarID = 317;
 	int done = 0;
 	
@@ -6973,9 +7096,11 @@ static int encode_iso2ServiceDiscoveryReqType(bitstream_t* stream, struct iso2Se
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_ServiceDiscoveryReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":ServiceID,"urn:iso:15118:2:2016:MsgDataTypes":FreeService)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2ServiceType(bitstream_t* stream, struct iso2ServiceType* iso2ServiceType) {
+	int errn = 0;
 	int grammarID = 318;
 	int done = 0;
 	
@@ -7043,6 +7168,7 @@ static int encode_iso2ServiceType(bitstream_t* stream, struct iso2ServiceType* i
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ServiceParameterListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":ParameterSet{1-255})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2ServiceParameterListType(bitstream_t* stream, struct iso2ServiceParameterListType* iso2ServiceParameterListType) {
+	int errn = 0;
 	int grammarID = 320;
 	int done = 0;
 	
@@ -11659,6 +11785,7 @@ static int encode_iso2ServiceParameterListType(bitstream_t* stream, struct iso2S
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,PMaxScheduleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":PMaxScheduleEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2PMaxScheduleType(bitstream_t* stream, struct iso2PMaxScheduleType* iso2PMaxScheduleType) {
+	int errn = 0;
 	int grammarID = 575;
 	int done = 0;
 	
@@ -11708,7 +11835,9 @@ static int encode_iso2PMaxScheduleType(bitstream_t* stream, struct iso2PMaxSched
 }
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertiesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignatureProperty{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if ISO2_DEPLOY_SignatureProperties == SUPPORT_YES
 static int encode_iso2SignaturePropertiesType(bitstream_t* stream, struct iso2SignaturePropertiesType* iso2SignaturePropertiesType) {
+	int errn = 0;
 	int grammarID = 577;
 	int done = 0;
 	
@@ -11721,11 +11850,8 @@ static int encode_iso2SignaturePropertiesType(bitstream_t* stream, struct iso2Si
 			if ( iso2SignaturePropertiesType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignaturePropertiesType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignaturePropertiesType->Id.characters, iso2SignaturePropertiesType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 24 /* {}Id */, iso2SignaturePropertiesType->Id.characters, iso2SignaturePropertiesType->Id.charactersLen);
 				}
 				grammarID = 578;
 			} else 			if (iso2SignaturePropertiesType_SignatureProperty_currArrayIndex < iso2SignaturePropertiesType->SignatureProperty.arrayLen ) {
@@ -11778,9 +11904,11 @@ static int encode_iso2SignaturePropertiesType(bitstream_t* stream, struct iso2Si
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_SignatureProperties */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,PMaxScheduleEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgDataTypes":RelativeTimeInterval),("urn:iso:15118:2:2016:MsgDataTypes":PMax{1-3}))',  derivedBy='EXTENSION'.  */
 static int encode_iso2PMaxScheduleEntryType(bitstream_t* stream, struct iso2PMaxScheduleEntryType* iso2PMaxScheduleEntryType) {
+	int errn = 0;
 	int grammarID = 580;
 	int done = 0;
 	
@@ -11873,6 +12001,7 @@ static int encode_iso2PMaxScheduleEntryType(bitstream_t* stream, struct iso2PMax
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignedInfo,"http://www.w3.org/2000/09/xmldsig#":SignatureValue,"http://www.w3.org/2000/09/xmldsig#":KeyInfo{0-1},"http://www.w3.org/2000/09/xmldsig#":Object{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SignatureType(bitstream_t* stream, struct iso2SignatureType* iso2SignatureType) {
+	int errn = 0;
 	int grammarID = 584;
 	int done = 0;
 	
@@ -11885,11 +12014,8 @@ static int encode_iso2SignatureType(bitstream_t* stream, struct iso2SignatureTyp
 			if ( iso2SignatureType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignatureType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignatureType->Id.characters, iso2SignatureType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 24 /* {}Id */, iso2SignatureType->Id.characters, iso2SignatureType->Id.charactersLen);
 				}
 				grammarID = 585;
 			} else 			if ( 1 == 1 ) {
@@ -11931,7 +12057,11 @@ static int encode_iso2SignatureType(bitstream_t* stream, struct iso2SignatureTyp
 			if ( iso2SignatureType->KeyInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2KeyInfoType(stream, iso2SignatureType->KeyInfo );
+#else
 					errn = encode_iso2KeyInfoType(stream, &iso2SignatureType->KeyInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 588;
 			} else 			if (iso2SignatureType_Object_currArrayIndex < iso2SignatureType->Object.arrayLen ) {
@@ -11980,7 +12110,9 @@ static int encode_iso2SignatureType(bitstream_t* stream, struct iso2SignatureTyp
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,VehicleCheckInReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":EVCheckInStatus,"urn:iso:15118:2:2016:MsgBody":ParkingMethod{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_VehicleCheckInReq == SUPPORT_YES
 static int encode_iso2VehicleCheckInReqType(bitstream_t* stream, struct iso2VehicleCheckInReqType* iso2VehicleCheckInReqType) {
+	int errn = 0;
 	int grammarID = 589;
 	int done = 0;
 	
@@ -12051,9 +12183,12 @@ static int encode_iso2VehicleCheckInReqType(bitstream_t* stream, struct iso2Vehi
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_VehicleCheckInReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,ConnectChargingDeviceResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEProcessing,"urn:iso:15118:2:2016:MsgBody":EVSEElectricalChargingDeviceStatus,"urn:iso:15118:2:2016:MsgBody":EVSEMechanicalChargingDeviceStatus))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_ConnectChargingDeviceRes == SUPPORT_YES
 static int encode_iso2ConnectChargingDeviceResType(bitstream_t* stream, struct iso2ConnectChargingDeviceResType* iso2ConnectChargingDeviceResType) {
+	int errn = 0;
 	int grammarID = 591;
 	int done = 0;
 	
@@ -12178,9 +12313,12 @@ static int encode_iso2ConnectChargingDeviceResType(bitstream_t* stream, struct i
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,WeldingDetectionResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEPresentVoltage))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 static int encode_iso2WeldingDetectionResType(bitstream_t* stream, struct iso2WeldingDetectionResType* iso2WeldingDetectionResType) {
+	int errn = 0;
 	int grammarID = 596;
 	int done = 0;
 	
@@ -12257,9 +12395,12 @@ static int encode_iso2WeldingDetectionResType(bitstream_t* stream, struct iso2We
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_WeldingDetectionRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,SessionStopResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_SessionStopRes == SUPPORT_YES
 static int encode_iso2SessionStopResType(bitstream_t* stream, struct iso2SessionStopResType* iso2SessionStopResType) {
+	int errn = 0;
 	int grammarID = 599;
 	int done = 0;
 	
@@ -12324,9 +12465,12 @@ static int encode_iso2SessionStopResType(bitstream_t* stream, struct iso2Session
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_SessionStopRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,VehicleCheckInResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":VehicleSpace,"urn:iso:15118:2:2016:MsgBody":TargetOffset{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_VehicleCheckInRes == SUPPORT_YES
 static int encode_iso2VehicleCheckInResType(bitstream_t* stream, struct iso2VehicleCheckInResType* iso2VehicleCheckInResType) {
+	int errn = 0;
 	int grammarID = 601;
 	int done = 0;
 	
@@ -12433,9 +12577,11 @@ static int encode_iso2VehicleCheckInResType(bitstream_t* stream, struct iso2Vehi
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_VehicleCheckInRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ServiceListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":Service{1-8})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2ServiceListType(bitstream_t* stream, struct iso2ServiceListType* iso2ServiceListType) {
+	int errn = 0;
 	int grammarID = 605;
 	int done = 0;
 	
@@ -12605,7 +12751,9 @@ static int encode_iso2ServiceListType(bitstream_t* stream, struct iso2ServiceLis
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,CertificateUpdateResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":SAProvisioningCertificateChain,"urn:iso:15118:2:2016:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2016:MsgBody":ContractSignatureEncryptedPrivateKey,"urn:iso:15118:2:2016:MsgBody":DHpublickey,"urn:iso:15118:2:2016:MsgBody":eMAID,"urn:iso:15118:2:2016:MsgBody":RetryCounter{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 static int encode_iso2CertificateUpdateResType(bitstream_t* stream, struct iso2CertificateUpdateResType* iso2CertificateUpdateResType) {
+	int errn = 0;
 	int grammarID = 613;
 	int done = 0;
 	
@@ -12754,9 +12902,12 @@ static int encode_iso2CertificateUpdateResType(bitstream_t* stream, struct iso2C
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_CertificateUpdateRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,FinePositioningSetupResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgDataTypes":EVSEFinePositioningSetupParameters{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_FinePositioningSetupRes == SUPPORT_YES
 static int encode_iso2FinePositioningSetupResType(bitstream_t* stream, struct iso2FinePositioningSetupResType* iso2FinePositioningSetupResType) {
+	int errn = 0;
 	int grammarID = 621;
 	int done = 0;
 	
@@ -12869,9 +13020,11 @@ static int encode_iso2FinePositioningSetupResType(bitstream_t* stream, struct is
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_FinePositioningSetupRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,AC_EVBidirectionalParameterType',  base type name='AC_EVChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((("urn:iso:15118:2:2016:MsgDataTypes":DepartureTime),("urn:iso:15118:2:2016:MsgDataTypes":EVMaximumChargePower,"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVTargetEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumVoltage)),("urn:iso:15118:2:2016:MsgDataTypes":EVMaximumDischargePower,"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumDischargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumDischargeCurrent))',  derivedBy='EXTENSION'.  */
 static int encode_iso2AC_EVBidirectionalParameterType(bitstream_t* stream, struct iso2AC_EVBidirectionalParameterType* iso2AC_EVBidirectionalParameterType) {
+	int errn = 0;
 	int grammarID = 624;
 	int done = 0;
 	
@@ -13076,7 +13229,9 @@ static int encode_iso2AC_EVBidirectionalParameterType(bitstream_t* stream, struc
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,DC_BidirectionalControlReqType',  base type name='ChargeLoopReqType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":EVTargetEnergyRequest,"urn:iso:15118:2:2016:MsgBody":EVMaximumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgBody":EVMinimumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgBody":DisplayParameters{0-1}),("urn:iso:15118:2:2016:MsgBody":EVTargetCurrent,"urn:iso:15118:2:2016:MsgBody":EVTargetVoltage,"urn:iso:15118:2:2016:MsgBody":EVMaximumVoltage,"urn:iso:15118:2:2016:MsgBody":EVMinimumVoltage,"urn:iso:15118:2:2016:MsgBody":EVMaximumChargeCurrent,"urn:iso:15118:2:2016:MsgBody":EVMaximumDischargeCurrent{0-1},"urn:iso:15118:2:2016:MsgBody":EVMaximumChargePower{0-1},"urn:iso:15118:2:2016:MsgBody":EVMaximumDischargePower{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_DC_BidirectionalControlReq == SUPPORT_YES
 static int encode_iso2DC_BidirectionalControlReqType(bitstream_t* stream, struct iso2DC_BidirectionalControlReqType* iso2DC_BidirectionalControlReqType) {
+	int errn = 0;
 	int grammarID = 635;
 	int done = 0;
 	
@@ -13321,9 +13476,12 @@ static int encode_iso2DC_BidirectionalControlReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,CertificateUpdateReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2016:MsgBody":eMAID,"urn:iso:15118:2:2016:MsgBody":ListOfRootCertificateIDs)',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 static int encode_iso2CertificateUpdateReqType(bitstream_t* stream, struct iso2CertificateUpdateReqType* iso2CertificateUpdateReqType) {
+	int errn = 0;
 	int grammarID = 647;
 	int done = 0;
 	
@@ -13335,11 +13493,8 @@ static int encode_iso2CertificateUpdateReqType(bitstream_t* stream, struct iso2C
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2CertificateUpdateReqType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2CertificateUpdateReqType->Id.characters, iso2CertificateUpdateReqType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 14 /* {urn:iso:15118:2:2016:MsgBody}Id */, iso2CertificateUpdateReqType->Id.characters, iso2CertificateUpdateReqType->Id.charactersLen);
 				}
 				grammarID = 648;
 			} else {
@@ -13366,11 +13521,8 @@ static int encode_iso2CertificateUpdateReqType(bitstream_t* stream, struct iso2C
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2CertificateUpdateReqType->eMAID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2CertificateUpdateReqType->eMAID.characters, iso2CertificateUpdateReqType->eMAID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 15 /* {urn:iso:15118:2:2016:MsgBody}eMAID */, iso2CertificateUpdateReqType->eMAID.characters, iso2CertificateUpdateReqType->eMAID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -13414,9 +13566,11 @@ static int encode_iso2CertificateUpdateReqType(bitstream_t* stream, struct iso2C
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_CertificateUpdateReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ConsumptionCostType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":startValue,"urn:iso:15118:2:2016:MsgDataTypes":Cost{1-3})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2ConsumptionCostType(bitstream_t* stream, struct iso2ConsumptionCostType* iso2ConsumptionCostType) {
+	int errn = 0;
 	int grammarID = 651;
 	int done = 0;
 	
@@ -13509,6 +13663,7 @@ static int encode_iso2ConsumptionCostType(bitstream_t* stream, struct iso2Consum
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SAScheduleListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":SAScheduleTuple{1-3})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SAScheduleListType(bitstream_t* stream, struct iso2SAScheduleListType* iso2SAScheduleListType) {
+	int errn = 0;
 	int grammarID = 655;
 	int done = 0;
 	
@@ -13589,6 +13744,7 @@ static int encode_iso2SAScheduleListType(bitstream_t* stream, struct iso2SASched
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MagneticVectorSetupType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":GAID,"urn:iso:15118:2:2016:MsgDataTypes":FrequencyChannel)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2MagneticVectorSetupType(bitstream_t* stream, struct iso2MagneticVectorSetupType* iso2MagneticVectorSetupType) {
+	int errn = 0;
 	int grammarID = 658;
 	int done = 0;
 	
@@ -13603,11 +13759,8 @@ static int encode_iso2MagneticVectorSetupType(bitstream_t* stream, struct iso2Ma
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2MagneticVectorSetupType->GAID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2MagneticVectorSetupType->GAID.characters, iso2MagneticVectorSetupType->GAID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 16 /* {urn:iso:15118:2:2016:MsgDataTypes}GAID */, iso2MagneticVectorSetupType->GAID.characters, iso2MagneticVectorSetupType->GAID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -13660,6 +13813,7 @@ static int encode_iso2MagneticVectorSetupType(bitstream_t* stream, struct iso2Ma
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,LFA_EVSEFinePositioningSetupParametersType',  base type name='EVSEFinePositioningSetupParametersType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":NumberOfSensors,"urn:iso:15118:2:2016:MsgDataTypes":SensorList,"urn:iso:15118:2:2016:MsgDataTypes":SensorOrder,"urn:iso:15118:2:2016:MsgDataTypes":SignalPulseDuration,"urn:iso:15118:2:2016:MsgDataTypes":SignalSeparationTime,"urn:iso:15118:2:2016:MsgDataTypes":PackageSeparationTime,"urn:iso:15118:2:2016:MsgDataTypes":AlignmentOffset,"urn:iso:15118:2:2016:MsgDataTypes":SignalFrequency)',  derivedBy='EXTENSION'.  */
 static int encode_iso2LFA_EVSEFinePositioningSetupParametersType(bitstream_t* stream, struct iso2LFA_EVSEFinePositioningSetupParametersType* iso2LFA_EVSEFinePositioningSetupParametersType) {
+	int errn = 0;
 	int grammarID = 660;
 	int done = 0;
 	
@@ -13823,6 +13977,7 @@ static int encode_iso2LFA_EVSEFinePositioningSetupParametersType(bitstream_t* st
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,PaymentOptionListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":PaymentOption{1-2})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2PaymentOptionListType(bitstream_t* stream, struct iso2PaymentOptionListType* iso2PaymentOptionListType) {
+	int errn = 0;
 	int grammarID = 668;
 	int done = 0;
 	
@@ -13897,6 +14052,7 @@ static int encode_iso2PaymentOptionListType(bitstream_t* stream, struct iso2Paym
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,LFA_EVSEFinePositioningParametersType',  base type name='EVSEFinePositioningParametersType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":NumberOfSignalPackages,"urn:iso:15118:2:2016:MsgDataTypes":SensorPackageList)',  derivedBy='EXTENSION'.  */
 static int encode_iso2LFA_EVSEFinePositioningParametersType(bitstream_t* stream, struct iso2LFA_EVSEFinePositioningParametersType* iso2LFA_EVSEFinePositioningParametersType) {
+	int errn = 0;
 	int grammarID = 670;
 	int done = 0;
 	
@@ -13958,6 +14114,7 @@ static int encode_iso2LFA_EVSEFinePositioningParametersType(bitstream_t* stream,
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,RelativeTimeIntervalType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":start,"urn:iso:15118:2:2016:MsgDataTypes":duration{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2RelativeTimeIntervalType(bitstream_t* stream, struct iso2RelativeTimeIntervalType* iso2RelativeTimeIntervalType) {
+	int errn = 0;
 	int grammarID = 672;
 	int done = 0;
 	
@@ -14031,6 +14188,7 @@ static int encode_iso2RelativeTimeIntervalType(bitstream_t* stream, struct iso2R
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,EVFinePositioningParametersType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_iso2EVFinePositioningParametersType(bitstream_t* stream, struct iso2EVFinePositioningParametersType* iso2EVFinePositioningParametersType) {
+	int errn = 0;
 	int grammarID = 674;
 	int done = 0;
 	
@@ -14061,7 +14219,9 @@ static int encode_iso2EVFinePositioningParametersType(bitstream_t* stream, struc
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,AlignmentCheckReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":EVProcessing,"urn:iso:15118:2:2016:MsgBody":AlignmentCheckParameters{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_AlignmentCheckReq == SUPPORT_YES
 static int encode_iso2AlignmentCheckReqType(bitstream_t* stream, struct iso2AlignmentCheckReqType* iso2AlignmentCheckReqType) {
+	int errn = 0;
 	int grammarID = 675;
 	int done = 0;
 	
@@ -14126,9 +14286,12 @@ static int encode_iso2AlignmentCheckReqType(bitstream_t* stream, struct iso2Alig
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_AlignmentCheckReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,CertificateInstallationReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":OEMProvisioningCert,"urn:iso:15118:2:2016:MsgBody":ListOfRootCertificateIDs)',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 static int encode_iso2CertificateInstallationReqType(bitstream_t* stream, struct iso2CertificateInstallationReqType* iso2CertificateInstallationReqType) {
+	int errn = 0;
 	int grammarID = 677;
 	int done = 0;
 	
@@ -14140,11 +14303,8 @@ static int encode_iso2CertificateInstallationReqType(bitstream_t* stream, struct
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2CertificateInstallationReqType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2CertificateInstallationReqType->Id.characters, iso2CertificateInstallationReqType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 14 /* {urn:iso:15118:2:2016:MsgBody}Id */, iso2CertificateInstallationReqType->Id.characters, iso2CertificateInstallationReqType->Id.charactersLen);
 				}
 				grammarID = 678;
 			} else {
@@ -14206,9 +14366,11 @@ static int encode_iso2CertificateInstallationReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_CertificateInstallationReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transform{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2TransformsType(bitstream_t* stream, struct iso2TransformsType* iso2TransformsType) {
+	int errn = 0;
 	int grammarID = 679;
 	int done = 0;
 	
@@ -14259,6 +14421,7 @@ static int encode_iso2TransformsType(bitstream_t* stream, struct iso2TransformsT
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ObjectType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any])){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_iso2ObjectType(bitstream_t* stream, struct iso2ObjectType* iso2ObjectType) {
+	int errn = 0;
 	int grammarID = 681;
 	int done = 0;
 	int wcDone = 0;
@@ -14271,31 +14434,22 @@ static int encode_iso2ObjectType(bitstream_t* stream, struct iso2ObjectType* iso
 			if ( iso2ObjectType->Encoding_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ObjectType->Encoding.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ObjectType->Encoding.characters, iso2ObjectType->Encoding.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 23 /* {}Encoding */, iso2ObjectType->Encoding.characters, iso2ObjectType->Encoding.charactersLen);
 				}
 				grammarID = 682;
 			} else 			if ( iso2ObjectType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ObjectType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ObjectType->Id.characters, iso2ObjectType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 24 /* {}Id */, iso2ObjectType->Id.characters, iso2ObjectType->Id.charactersLen);
 				}
 				grammarID = 683;
 			} else 			if ( iso2ObjectType->MimeType_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ObjectType->MimeType.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ObjectType->MimeType.characters, iso2ObjectType->MimeType.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}MimeType */, iso2ObjectType->MimeType.characters, iso2ObjectType->MimeType.charactersLen);
 				}
 				grammarID = 684;
 			} else 			if (1==0) {
@@ -14310,11 +14464,8 @@ static int encode_iso2ObjectType(bitstream_t* stream, struct iso2ObjectType* iso
 			} else 			if ( iso2ObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 5);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ObjectType->ANY.characters, iso2ObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso2ObjectType->ANY.characters, iso2ObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 685;
@@ -14327,21 +14478,15 @@ static int encode_iso2ObjectType(bitstream_t* stream, struct iso2ObjectType* iso
 			if ( iso2ObjectType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ObjectType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ObjectType->Id.characters, iso2ObjectType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 24 /* {}Id */, iso2ObjectType->Id.characters, iso2ObjectType->Id.charactersLen);
 				}
 				grammarID = 683;
 			} else 			if ( iso2ObjectType->MimeType_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ObjectType->MimeType.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ObjectType->MimeType.characters, iso2ObjectType->MimeType.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}MimeType */, iso2ObjectType->MimeType.characters, iso2ObjectType->MimeType.charactersLen);
 				}
 				grammarID = 684;
 			} else 			if (1==0) {
@@ -14356,11 +14501,8 @@ static int encode_iso2ObjectType(bitstream_t* stream, struct iso2ObjectType* iso
 			} else 			if ( iso2ObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 4);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ObjectType->ANY.characters, iso2ObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso2ObjectType->ANY.characters, iso2ObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 685;
@@ -14373,11 +14515,8 @@ static int encode_iso2ObjectType(bitstream_t* stream, struct iso2ObjectType* iso
 			if ( iso2ObjectType->MimeType_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ObjectType->MimeType.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ObjectType->MimeType.characters, iso2ObjectType->MimeType.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 25 /* {}MimeType */, iso2ObjectType->MimeType.characters, iso2ObjectType->MimeType.charactersLen);
 				}
 				grammarID = 684;
 			} else 			if (1==0) {
@@ -14392,11 +14531,8 @@ static int encode_iso2ObjectType(bitstream_t* stream, struct iso2ObjectType* iso
 			} else 			if ( iso2ObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ObjectType->ANY.characters, iso2ObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso2ObjectType->ANY.characters, iso2ObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 685;
@@ -14418,11 +14554,8 @@ static int encode_iso2ObjectType(bitstream_t* stream, struct iso2ObjectType* iso
 			} else 			if ( iso2ObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ObjectType->ANY.characters, iso2ObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso2ObjectType->ANY.characters, iso2ObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 685;
@@ -14444,11 +14577,8 @@ static int encode_iso2ObjectType(bitstream_t* stream, struct iso2ObjectType* iso
 			} else 			if ( iso2ObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ObjectType->ANY.characters, iso2ObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, iso2ObjectType->ANY.characters, iso2ObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 685;
@@ -14469,6 +14599,7 @@ static int encode_iso2ObjectType(bitstream_t* stream, struct iso2ObjectType* iso
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SensorOrderListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":SensorPosition{1-255})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SensorOrderListType(bitstream_t* stream, struct iso2SensorOrderListType* iso2SensorOrderListType) {
+	int errn = 0;
 	int grammarID = 686;
 	int done = 0;
 	
@@ -20614,7 +20745,9 @@ static int encode_iso2SensorOrderListType(bitstream_t* stream, struct iso2Sensor
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,ChargeParameterDiscoveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":MaxSupportingPoints{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVEnergyTransferParameter,"urn:iso:15118:2:2016:MsgBody":MinimumPMaxRequest{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 static int encode_iso2ChargeParameterDiscoveryReqType(bitstream_t* stream, struct iso2ChargeParameterDiscoveryReqType* iso2ChargeParameterDiscoveryReqType) {
+	int errn = 0;
 	int grammarID = 941;
 	int done = 0;
 	
@@ -20757,9 +20890,11 @@ static int encode_iso2ChargeParameterDiscoveryReqType(bitstream_t* stream, struc
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ParameterType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":boolValue|"urn:iso:15118:2:2016:MsgDataTypes":byteValue|"urn:iso:15118:2:2016:MsgDataTypes":shortValue|"urn:iso:15118:2:2016:MsgDataTypes":intValue|"urn:iso:15118:2:2016:MsgDataTypes":physicalValue|"urn:iso:15118:2:2016:MsgDataTypes":stringValue)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2ParameterType(bitstream_t* stream, struct iso2ParameterType* iso2ParameterType) {
+	int errn = 0;
 	int grammarID = 944;
 	int done = 0;
 	
@@ -20771,11 +20906,8 @@ static int encode_iso2ParameterType(bitstream_t* stream, struct iso2ParameterTyp
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ParameterType->Name.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ParameterType->Name.characters, iso2ParameterType->Name.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 19 /* {urn:iso:15118:2:2016:MsgDataTypes}Name */, iso2ParameterType->Name.characters, iso2ParameterType->Name.charactersLen);
 				}
 				grammarID = 945;
 			} else {
@@ -20844,11 +20976,8 @@ static int encode_iso2ParameterType(bitstream_t* stream, struct iso2ParameterTyp
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ParameterType->stringValue.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2ParameterType->stringValue.characters, iso2ParameterType->stringValue.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 21 /* {urn:iso:15118:2:2016:MsgDataTypes}stringValue */, iso2ParameterType->stringValue.characters, iso2ParameterType->stringValue.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -20882,7 +21011,9 @@ static int encode_iso2ParameterType(bitstream_t* stream, struct iso2ParameterTyp
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,SessionStopReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":ChargingSession)',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_SessionStopReq == SUPPORT_YES
 static int encode_iso2SessionStopReqType(bitstream_t* stream, struct iso2SessionStopReqType* iso2SessionStopReqType) {
+	int errn = 0;
 	int grammarID = 946;
 	int done = 0;
 	
@@ -20929,9 +21060,11 @@ static int encode_iso2SessionStopReqType(bitstream_t* stream, struct iso2Session
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_SessionStopReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SensorMeasurementsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":SensorID,"urn:iso:15118:2:2016:MsgDataTypes":EffectiveRadiatedPower,"urn:iso:15118:2:2016:MsgDataTypes":MeasurementDataList)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SensorMeasurementsType(bitstream_t* stream, struct iso2SensorMeasurementsType* iso2SensorMeasurementsType) {
+	int errn = 0;
 	int grammarID = 947;
 	int done = 0;
 	
@@ -21011,6 +21144,7 @@ static int encode_iso2SensorMeasurementsType(bitstream_t* stream, struct iso2Sen
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,DC_EVSEChargeParameterType',  base type name='EVSEEnergyTransferParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":EVSEMaximumChargePower,"urn:iso:15118:2:2016:MsgDataTypes":EVSEMaximumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVSEMinimumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVSEMaximumVoltage,"urn:iso:15118:2:2016:MsgDataTypes":EVSEMinimumVoltage,"urn:iso:15118:2:2016:MsgDataTypes":EVSECurrentRegulationTolerance{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVSEPeakCurrentRipple,"urn:iso:15118:2:2016:MsgDataTypes":EVSEEnergyToBeDelivered{0-1})',  derivedBy='EXTENSION'.  */
 static int encode_iso2DC_EVSEChargeParameterType(bitstream_t* stream, struct iso2DC_EVSEChargeParameterType* iso2DC_EVSEChargeParameterType) {
+	int errn = 0;
 	int grammarID = 950;
 	int done = 0;
 	
@@ -21150,6 +21284,7 @@ static int encode_iso2DC_EVSEChargeParameterType(bitstream_t* stream, struct iso
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SensorPackageListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":SensorPackage{1-255})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SensorPackageListType(bitstream_t* stream, struct iso2SensorPackageListType* iso2SensorPackageListType) {
+	int errn = 0;
 	int grammarID = 958;
 	int done = 0;
 	
@@ -25766,6 +25901,7 @@ static int encode_iso2SensorPackageListType(bitstream_t* stream, struct iso2Sens
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MeasurementDataListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":MeasurementData{1-255})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2MeasurementDataListType(bitstream_t* stream, struct iso2MeasurementDataListType* iso2MeasurementDataListType) {
+	int errn = 0;
 	int grammarID = 1213;
 	int done = 0;
 	
@@ -31912,6 +32048,7 @@ static int encode_iso2MeasurementDataListType(bitstream_t* stream, struct iso2Me
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,CertificateChainType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":Certificate,"urn:iso:15118:2:2016:MsgDataTypes":SubCertificates{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2CertificateChainType(bitstream_t* stream, struct iso2CertificateChainType* iso2CertificateChainType) {
+	int errn = 0;
 	int grammarID = 1468;
 	int done = 0;
 	
@@ -31923,11 +32060,8 @@ static int encode_iso2CertificateChainType(bitstream_t* stream, struct iso2Certi
 			if ( iso2CertificateChainType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2CertificateChainType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2CertificateChainType->Id.characters, iso2CertificateChainType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 17 /* {urn:iso:15118:2:2016:MsgDataTypes}Id */, iso2CertificateChainType->Id.characters, iso2CertificateChainType->Id.charactersLen);
 				}
 				grammarID = 1469;
 			} else 			if ( 1 == 1 ) {
@@ -32013,6 +32147,7 @@ static int encode_iso2CertificateChainType(bitstream_t* stream, struct iso2Certi
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertyType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SignaturePropertyType(bitstream_t* stream, struct iso2SignaturePropertyType* iso2SignaturePropertyType) {
+	int errn = 0;
 	int grammarID = 1471;
 	int done = 0;
 	int wcDone = 0;
@@ -32025,21 +32160,15 @@ static int encode_iso2SignaturePropertyType(bitstream_t* stream, struct iso2Sign
 			if ( iso2SignaturePropertyType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignaturePropertyType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignaturePropertyType->Id.characters, iso2SignaturePropertyType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 24 /* {}Id */, iso2SignaturePropertyType->Id.characters, iso2SignaturePropertyType->Id.charactersLen);
 				}
 				grammarID = 1472;
 			} else 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignaturePropertyType->Target.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignaturePropertyType->Target.characters, iso2SignaturePropertyType->Target.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 26 /* {}Target */, iso2SignaturePropertyType->Target.characters, iso2SignaturePropertyType->Target.charactersLen);
 				}
 				grammarID = 1473;
 			} else {
@@ -32051,11 +32180,8 @@ static int encode_iso2SignaturePropertyType(bitstream_t* stream, struct iso2Sign
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignaturePropertyType->Target.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignaturePropertyType->Target.characters, iso2SignaturePropertyType->Target.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 26 /* {}Target */, iso2SignaturePropertyType->Target.characters, iso2SignaturePropertyType->Target.charactersLen);
 				}
 				grammarID = 1473;
 			} else {
@@ -32070,11 +32196,8 @@ static int encode_iso2SignaturePropertyType(bitstream_t* stream, struct iso2Sign
 			} else 			if ( iso2SignaturePropertyType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignaturePropertyType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignaturePropertyType->ANY.characters, iso2SignaturePropertyType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, iso2SignaturePropertyType->ANY.characters, iso2SignaturePropertyType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1474;
@@ -32096,11 +32219,8 @@ static int encode_iso2SignaturePropertyType(bitstream_t* stream, struct iso2Sign
 			} else 			if ( iso2SignaturePropertyType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignaturePropertyType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignaturePropertyType->ANY.characters, iso2SignaturePropertyType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, iso2SignaturePropertyType->ANY.characters, iso2SignaturePropertyType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 685;
@@ -32116,11 +32236,8 @@ static int encode_iso2SignaturePropertyType(bitstream_t* stream, struct iso2Sign
 			} else 			if ( iso2SignaturePropertyType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignaturePropertyType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignaturePropertyType->ANY.characters, iso2SignaturePropertyType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, iso2SignaturePropertyType->ANY.characters, iso2SignaturePropertyType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1474;
@@ -32141,6 +32258,7 @@ static int encode_iso2SignaturePropertyType(bitstream_t* stream, struct iso2Sign
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])|"http://www.w3.org/2000/09/xmldsig#":XPath){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_iso2TransformType(bitstream_t* stream, struct iso2TransformType* iso2TransformType) {
+	int errn = 0;
 	int grammarID = 1475;
 	int done = 0;
 	int wcDone = 0;
@@ -32154,11 +32272,8 @@ static int encode_iso2TransformType(bitstream_t* stream, struct iso2TransformTyp
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2TransformType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2TransformType->Algorithm.characters, iso2TransformType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 22 /* {}Algorithm */, iso2TransformType->Algorithm.characters, iso2TransformType->Algorithm.charactersLen);
 				}
 				grammarID = 1476;
 			} else {
@@ -32173,10 +32288,9 @@ static int encode_iso2TransformType(bitstream_t* stream, struct iso2TransformTyp
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2TransformType->XPath.array[iso2TransformType_XPath_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, iso2TransformType->XPath.array[iso2TransformType_XPath_currArrayIndex].characters, iso2TransformType->XPath.array[iso2TransformType_XPath_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2TransformType->XPath.array[iso2TransformType_XPath_currArrayIndex].characters, iso2TransformType->XPath.array[iso2TransformType_XPath_currArrayIndex].charactersLen);
 							iso2TransformType_XPath_currArrayIndex++;
 						}
 						/* valid EE */
@@ -32196,11 +32310,8 @@ static int encode_iso2TransformType(bitstream_t* stream, struct iso2TransformTyp
 			} else 			if ( iso2TransformType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2TransformType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2TransformType->ANY.characters, iso2TransformType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, iso2TransformType->ANY.characters, iso2TransformType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1477;
@@ -32216,10 +32327,9 @@ static int encode_iso2TransformType(bitstream_t* stream, struct iso2TransformTyp
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2TransformType->XPath.array[iso2TransformType_XPath_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, iso2TransformType->XPath.array[iso2TransformType_XPath_currArrayIndex].characters, iso2TransformType->XPath.array[iso2TransformType_XPath_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2TransformType->XPath.array[iso2TransformType_XPath_currArrayIndex].characters, iso2TransformType->XPath.array[iso2TransformType_XPath_currArrayIndex].charactersLen);
 							iso2TransformType_XPath_currArrayIndex++;
 						}
 						/* valid EE */
@@ -32239,11 +32349,8 @@ static int encode_iso2TransformType(bitstream_t* stream, struct iso2TransformTyp
 			} else 			if ( iso2TransformType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2TransformType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2TransformType->ANY.characters, iso2TransformType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, iso2TransformType->ANY.characters, iso2TransformType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1477;
@@ -32264,6 +32371,7 @@ static int encode_iso2TransformType(bitstream_t* stream, struct iso2TransformTyp
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,EMAIDType',  base type name='eMAIDType',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 static int encode_iso2EMAIDType(bitstream_t* stream, struct iso2EMAIDType* iso2EMAIDType) {
+	int errn = 0;
 	int grammarID = 1478;
 	int done = 0;
 	
@@ -32275,11 +32383,8 @@ static int encode_iso2EMAIDType(bitstream_t* stream, struct iso2EMAIDType* iso2E
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2EMAIDType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2EMAIDType->Id.characters, iso2EMAIDType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 17 /* {urn:iso:15118:2:2016:MsgDataTypes}Id */, iso2EMAIDType->Id.characters, iso2EMAIDType->Id.charactersLen);
 				}
 				grammarID = 1479;
 			} else {
@@ -32291,11 +32396,8 @@ static int encode_iso2EMAIDType(bitstream_t* stream, struct iso2EMAIDType* iso2E
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2EMAIDType->CONTENT.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2EMAIDType->CONTENT.characters, iso2EMAIDType->CONTENT.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {urn:iso:15118:2:2016:MsgBody}eMAID */, iso2EMAIDType->CONTENT.characters, iso2EMAIDType->CONTENT.charactersLen);
 				}
 				grammarID = 3;
 			} else {
@@ -32327,6 +32429,7 @@ static int encode_iso2EMAIDType(bitstream_t* stream, struct iso2EMAIDType* iso2E
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":P,"http://www.w3.org/2000/09/xmldsig#":Q){0-1},"http://www.w3.org/2000/09/xmldsig#":G{0-1},"http://www.w3.org/2000/09/xmldsig#":Y,"http://www.w3.org/2000/09/xmldsig#":J{0-1},("http://www.w3.org/2000/09/xmldsig#":Seed,"http://www.w3.org/2000/09/xmldsig#":PgenCounter){0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2DSAKeyValueType(bitstream_t* stream, struct iso2DSAKeyValueType* iso2DSAKeyValueType) {
+	int errn = 0;
 	int grammarID = 1480;
 	int done = 0;
 	
@@ -32577,6 +32680,7 @@ static int encode_iso2DSAKeyValueType(bitstream_t* stream, struct iso2DSAKeyValu
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,EntryType',  base type name='anyType',  content type='ELEMENT',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":RelativeTimeInterval)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2EntryType(bitstream_t* stream, struct iso2EntryType* iso2EntryType) {
+	int errn = 0;
 	int grammarID = 1487;
 	int done = 0;
 	
@@ -32620,6 +32724,7 @@ static int encode_iso2EntryType(bitstream_t* stream, struct iso2EntryType* iso2E
 
 /* Complex type name='urn:iso:15118:2:2016:MsgHeader,MessageHeaderType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgHeader":SessionID,"http://www.w3.org/2000/09/xmldsig#":Signature{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2MessageHeaderType(bitstream_t* stream, struct iso2MessageHeaderType* iso2MessageHeaderType) {
+	int errn = 0;
 	int grammarID = 1488;
 	int done = 0;
 	
@@ -32652,7 +32757,11 @@ static int encode_iso2MessageHeaderType(bitstream_t* stream, struct iso2MessageH
 			if ( iso2MessageHeaderType->Signature_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2SignatureType(stream, iso2MessageHeaderType->Signature );
+#else
 					errn = encode_iso2SignatureType(stream, &iso2MessageHeaderType->Signature );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 3;
 			} else 			if (1==1) {
@@ -32690,6 +32799,7 @@ static int encode_iso2MessageHeaderType(bitstream_t* stream, struct iso2MessageH
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,WPT_EVChargeParameterType',  base type name='EVEnergyTransferParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgDataTypes":DepartureTime),("urn:iso:15118:2:2016:MsgDataTypes":EVMaximumPower,"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumPower,"urn:iso:15118:2:2016:MsgDataTypes":EVTargetEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumEnergyRequest{0-1}))',  derivedBy='EXTENSION'.  */
 static int encode_iso2WPT_EVChargeParameterType(bitstream_t* stream, struct iso2WPT_EVChargeParameterType* iso2WPT_EVChargeParameterType) {
+	int errn = 0;
 	int grammarID = 1490;
 	int done = 0;
 	
@@ -32834,7 +32944,9 @@ static int encode_iso2WPT_EVChargeParameterType(bitstream_t* stream, struct iso2
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,DisconnectChargingDeviceReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":EVElectricalChargingDeviceStatus,"urn:iso:15118:2:2016:MsgBody":EVMechanicalChargingDeviceStatus)',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_DisconnectChargingDeviceReq == SUPPORT_YES
 static int encode_iso2DisconnectChargingDeviceReqType(bitstream_t* stream, struct iso2DisconnectChargingDeviceReqType* iso2DisconnectChargingDeviceReqType) {
+	int errn = 0;
 	int grammarID = 1496;
 	int done = 0;
 	
@@ -32899,9 +33011,11 @@ static int encode_iso2DisconnectChargingDeviceReqType(bitstream_t* stream, struc
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,ChargeLoopReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":EVTargetEnergyRequest,"urn:iso:15118:2:2016:MsgBody":EVMaximumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgBody":EVMinimumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgBody":DisplayParameters{0-1})',  derivedBy='EXTENSION'.  */
 static int encode_iso2ChargeLoopReqType(bitstream_t* stream, struct iso2ChargeLoopReqType* iso2ChargeLoopReqType) {
+	int errn = 0;
 	int grammarID = 1498;
 	int done = 0;
 	
@@ -33017,6 +33131,7 @@ static int encode_iso2ChargeLoopReqType(bitstream_t* stream, struct iso2ChargeLo
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,V2GRequestType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_iso2V2GRequestType(bitstream_t* stream, struct iso2V2GRequestType* iso2V2GRequestType) {
+	int errn = 0;
 	int grammarID = 674;
 	int done = 0;
 	
@@ -33047,7 +33162,9 @@ static int encode_iso2V2GRequestType(bitstream_t* stream, struct iso2V2GRequestT
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,MeteringReceiptResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 static int encode_iso2MeteringReceiptResType(bitstream_t* stream, struct iso2MeteringReceiptResType* iso2MeteringReceiptResType) {
+	int errn = 0;
 	int grammarID = 599;
 	int done = 0;
 	
@@ -33112,9 +33229,12 @@ static int encode_iso2MeteringReceiptResType(bitstream_t* stream, struct iso2Met
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_MeteringReceiptRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,SessionSetupResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEID,"urn:iso:15118:2:2016:MsgBody":EVSETimeStamp{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_SessionSetupRes == SUPPORT_YES
 static int encode_iso2SessionSetupResType(bitstream_t* stream, struct iso2SessionSetupResType* iso2SessionSetupResType) {
+	int errn = 0;
 	int grammarID = 1502;
 	int done = 0;
 	
@@ -33153,11 +33273,8 @@ static int encode_iso2SessionSetupResType(bitstream_t* stream, struct iso2Sessio
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SessionSetupResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2SessionSetupResType->EVSEID.characters, iso2SessionSetupResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2SessionSetupResType->EVSEID.characters, iso2SessionSetupResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -33175,11 +33292,8 @@ static int encode_iso2SessionSetupResType(bitstream_t* stream, struct iso2Sessio
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SessionSetupResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2SessionSetupResType->EVSEID.characters, iso2SessionSetupResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2SessionSetupResType->EVSEID.characters, iso2SessionSetupResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -33235,9 +33349,12 @@ static int encode_iso2SessionSetupResType(bitstream_t* stream, struct iso2Sessio
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_SessionSetupRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,AC_BidirectionalControlReqType',  base type name='ChargeLoopReqType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":EVTargetEnergyRequest,"urn:iso:15118:2:2016:MsgBody":EVMaximumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgBody":EVMinimumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgBody":DisplayParameters{0-1}),("urn:iso:15118:2:2016:MsgBody":EVOperation{0-1},"urn:iso:15118:2:2016:MsgBody":EVMaximumChargePower,"urn:iso:15118:2:2016:MsgBody":EVMaximumDischargePower{0-1},"urn:iso:15118:2:2016:MsgBody":EVMaximumChargeCurrent,"urn:iso:15118:2:2016:MsgBody":EVMaximumDischargeCurrent{0-1},"urn:iso:15118:2:2016:MsgBody":EVMinimumChargeCurrent,"urn:iso:15118:2:2016:MsgBody":EVMinimumDischargeCurrent{0-1},"urn:iso:15118:2:2016:MsgBody":EVPresentActivePower,"urn:iso:15118:2:2016:MsgBody":EVPresentReactivePower))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_AC_BidirectionalControlReq == SUPPORT_YES
 static int encode_iso2AC_BidirectionalControlReqType(bitstream_t* stream, struct iso2AC_BidirectionalControlReqType* iso2AC_BidirectionalControlReqType) {
+	int errn = 0;
 	int grammarID = 1506;
 	int done = 0;
 	
@@ -33524,9 +33641,11 @@ static int encode_iso2AC_BidirectionalControlReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MV_EVSEFinePositioningParametersType',  base type name='EVSEFinePositioningParametersType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":MagneticVectorList)',  derivedBy='EXTENSION'.  */
 static int encode_iso2MV_EVSEFinePositioningParametersType(bitstream_t* stream, struct iso2MV_EVSEFinePositioningParametersType* iso2MV_EVSEFinePositioningParametersType) {
+	int errn = 0;
 	int grammarID = 1519;
 	int done = 0;
 	
@@ -33570,6 +33689,7 @@ static int encode_iso2MV_EVSEFinePositioningParametersType(bitstream_t* stream,
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2ReferenceType(bitstream_t* stream, struct iso2ReferenceType* iso2ReferenceType) {
+	int errn = 0;
 	int grammarID = 1520;
 	int done = 0;
 	
@@ -33581,31 +33701,22 @@ static int encode_iso2ReferenceType(bitstream_t* stream, struct iso2ReferenceTyp
 			if ( iso2ReferenceType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ReferenceType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ReferenceType->Id.characters, iso2ReferenceType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 24 /* {}Id */, iso2ReferenceType->Id.characters, iso2ReferenceType->Id.charactersLen);
 				}
 				grammarID = 1521;
 			} else 			if ( iso2ReferenceType->Type_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ReferenceType->Type.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ReferenceType->Type.characters, iso2ReferenceType->Type.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Type */, iso2ReferenceType->Type.characters, iso2ReferenceType->Type.charactersLen);
 				}
 				grammarID = 1522;
 			} else 			if ( iso2ReferenceType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ReferenceType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ReferenceType->URI.characters, iso2ReferenceType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 28 /* {}URI */, iso2ReferenceType->URI.characters, iso2ReferenceType->URI.charactersLen);
 				}
 				grammarID = 1523;
 			} else 			if ( iso2ReferenceType->Transforms_isUsed == 1u ) {
@@ -33629,21 +33740,15 @@ static int encode_iso2ReferenceType(bitstream_t* stream, struct iso2ReferenceTyp
 			if ( iso2ReferenceType->Type_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ReferenceType->Type.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ReferenceType->Type.characters, iso2ReferenceType->Type.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 27 /* {}Type */, iso2ReferenceType->Type.characters, iso2ReferenceType->Type.charactersLen);
 				}
 				grammarID = 1522;
 			} else 			if ( iso2ReferenceType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ReferenceType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ReferenceType->URI.characters, iso2ReferenceType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 28 /* {}URI */, iso2ReferenceType->URI.characters, iso2ReferenceType->URI.charactersLen);
 				}
 				grammarID = 1523;
 			} else 			if ( iso2ReferenceType->Transforms_isUsed == 1u ) {
@@ -33667,11 +33772,8 @@ static int encode_iso2ReferenceType(bitstream_t* stream, struct iso2ReferenceTyp
 			if ( iso2ReferenceType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ReferenceType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ReferenceType->URI.characters, iso2ReferenceType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 28 /* {}URI */, iso2ReferenceType->URI.characters, iso2ReferenceType->URI.charactersLen);
 				}
 				grammarID = 1523;
 			} else 			if ( iso2ReferenceType->Transforms_isUsed == 1u ) {
@@ -33766,6 +33868,7 @@ static int encode_iso2ReferenceType(bitstream_t* stream, struct iso2ReferenceTyp
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,EVSEEnergyTransferParameterType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_iso2EVSEEnergyTransferParameterType(bitstream_t* stream, struct iso2EVSEEnergyTransferParameterType* iso2EVSEEnergyTransferParameterType) {
+	int errn = 0;
 	int grammarID = 674;
 	int done = 0;
 	
@@ -33796,7 +33899,9 @@ static int encode_iso2EVSEEnergyTransferParameterType(bitstream_t* stream, struc
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,MeteringReceiptReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":SessionID,"urn:iso:15118:2:2016:MsgBody":SAScheduleTupleID{0-1},"urn:iso:15118:2:2016:MsgBody":MeterInfo)',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 static int encode_iso2MeteringReceiptReqType(bitstream_t* stream, struct iso2MeteringReceiptReqType* iso2MeteringReceiptReqType) {
+	int errn = 0;
 	int grammarID = 1526;
 	int done = 0;
 	
@@ -33808,11 +33913,8 @@ static int encode_iso2MeteringReceiptReqType(bitstream_t* stream, struct iso2Met
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2MeteringReceiptReqType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2MeteringReceiptReqType->Id.characters, iso2MeteringReceiptReqType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 14 /* {urn:iso:15118:2:2016:MsgBody}Id */, iso2MeteringReceiptReqType->Id.characters, iso2MeteringReceiptReqType->Id.charactersLen);
 				}
 				grammarID = 1527;
 			} else {
@@ -33898,9 +34000,11 @@ static int encode_iso2MeteringReceiptReqType(bitstream_t* stream, struct iso2Met
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_MeteringReceiptReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyValueType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":DSAKeyValue|"http://www.w3.org/2000/09/xmldsig#":RSAKeyValue|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))',  derivedBy='RESTRICTION'.  */
 static int encode_iso2KeyValueType(bitstream_t* stream, struct iso2KeyValueType* iso2KeyValueType) {
+	int errn = 0;
 	int grammarID = 1530;
 	int done = 0;
 	int wcDone = 0;
@@ -33913,7 +34017,11 @@ static int encode_iso2KeyValueType(bitstream_t* stream, struct iso2KeyValueType*
 			if ( iso2KeyValueType->DSAKeyValue_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2DSAKeyValueType(stream, iso2KeyValueType->DSAKeyValue );
+#else
 					errn = encode_iso2DSAKeyValueType(stream, &iso2KeyValueType->DSAKeyValue );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 1531;
 			} else 			if ( iso2KeyValueType->RSAKeyValue_isUsed == 1u ) {
@@ -33928,11 +34036,8 @@ static int encode_iso2KeyValueType(bitstream_t* stream, struct iso2KeyValueType*
 			} else 			if ( iso2KeyValueType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyValueType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2KeyValueType->ANY.characters, iso2KeyValueType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, iso2KeyValueType->ANY.characters, iso2KeyValueType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1532;
@@ -33951,11 +34056,8 @@ static int encode_iso2KeyValueType(bitstream_t* stream, struct iso2KeyValueType*
 			} else 			if ( iso2KeyValueType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyValueType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2KeyValueType->ANY.characters, iso2KeyValueType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, iso2KeyValueType->ANY.characters, iso2KeyValueType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1531;
@@ -33968,7 +34070,11 @@ static int encode_iso2KeyValueType(bitstream_t* stream, struct iso2KeyValueType*
 			if ( iso2KeyValueType->DSAKeyValue_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2DSAKeyValueType(stream, iso2KeyValueType->DSAKeyValue );
+#else
 					errn = encode_iso2DSAKeyValueType(stream, &iso2KeyValueType->DSAKeyValue );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 1531;
 			} else 			if ( iso2KeyValueType->RSAKeyValue_isUsed == 1u ) {
@@ -33983,11 +34089,8 @@ static int encode_iso2KeyValueType(bitstream_t* stream, struct iso2KeyValueType*
 			} else 			if ( iso2KeyValueType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyValueType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2KeyValueType->ANY.characters, iso2KeyValueType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, iso2KeyValueType->ANY.characters, iso2KeyValueType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1532;
@@ -34008,6 +34111,7 @@ static int encode_iso2KeyValueType(bitstream_t* stream, struct iso2KeyValueType*
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SensorListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":Sensor{1-255})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SensorListType(bitstream_t* stream, struct iso2SensorListType* iso2SensorListType) {
+	int errn = 0;
 	int grammarID = 1533;
 	int done = 0;
 	
@@ -38623,7 +38727,9 @@ static int encode_iso2SensorListType(bitstream_t* stream, struct iso2SensorListT
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,CurrentDemandReqType',  base type name='ChargeLoopReqType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":EVTargetEnergyRequest,"urn:iso:15118:2:2016:MsgBody":EVMaximumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgBody":EVMinimumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgBody":DisplayParameters{0-1}),("urn:iso:15118:2:2016:MsgBody":EVTargetCurrent,"urn:iso:15118:2:2016:MsgBody":EVTargetVoltage,"urn:iso:15118:2:2016:MsgBody":EVMaximumCurrent{0-1},"urn:iso:15118:2:2016:MsgBody":EVMaximumPower{0-1},"urn:iso:15118:2:2016:MsgBody":EVMaximumVoltage{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_CurrentDemandReq == SUPPORT_YES
 static int encode_iso2CurrentDemandReqType(bitstream_t* stream, struct iso2CurrentDemandReqType* iso2CurrentDemandReqType) {
+	int errn = 0;
 	int grammarID = 1788;
 	int done = 0;
 	
@@ -38832,9 +38938,12 @@ static int encode_iso2CurrentDemandReqType(bitstream_t* stream, struct iso2Curre
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_CurrentDemandReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,FinePositioningSetupReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":EVFinePositioningSetupParameters{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_FinePositioningSetupReq == SUPPORT_YES
 static int encode_iso2FinePositioningSetupReqType(bitstream_t* stream, struct iso2FinePositioningSetupReqType* iso2FinePositioningSetupReqType) {
+	int errn = 0;
 	int grammarID = 1797;
 	int done = 0;
 	
@@ -38887,9 +38996,11 @@ static int encode_iso2FinePositioningSetupReqType(bitstream_t* stream, struct is
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_FinePositioningSetupReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,LFA_EVFinePositioningSetupParametersType',  base type name='EVFinePositioningSetupParametersType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":NumberOfSensors,"urn:iso:15118:2:2016:MsgDataTypes":SensorList,"urn:iso:15118:2:2016:MsgDataTypes":SensorOrder,"urn:iso:15118:2:2016:MsgDataTypes":SignalPulseDuration,"urn:iso:15118:2:2016:MsgDataTypes":SignalSeparationTime,"urn:iso:15118:2:2016:MsgDataTypes":PackageSeparationTime,"urn:iso:15118:2:2016:MsgDataTypes":AlignmentOffset)',  derivedBy='EXTENSION'.  */
 static int encode_iso2LFA_EVFinePositioningSetupParametersType(bitstream_t* stream, struct iso2LFA_EVFinePositioningSetupParametersType* iso2LFA_EVFinePositioningSetupParametersType) {
+	int errn = 0;
 	int grammarID = 1798;
 	int done = 0;
 	
@@ -39035,6 +39146,7 @@ static int encode_iso2LFA_EVFinePositioningSetupParametersType(bitstream_t* stre
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SAScheduleTupleType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":SAScheduleTupleID,"urn:iso:15118:2:2016:MsgDataTypes":PMaxSchedule,"urn:iso:15118:2:2016:MsgDataTypes":PMaxDischargeSchedule{0-1},"urn:iso:15118:2:2016:MsgDataTypes":SalesTariff{0-1},"urn:iso:15118:2:2016:MsgDataTypes":BuyBackTariff{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SAScheduleTupleType(bitstream_t* stream, struct iso2SAScheduleTupleType* iso2SAScheduleTupleType) {
+	int errn = 0;
 	int grammarID = 1805;
 	int done = 0;
 	
@@ -39168,6 +39280,7 @@ static int encode_iso2SAScheduleTupleType(bitstream_t* stream, struct iso2SASche
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,WPT_EVSEChargeParameterType',  base type name='EVSEEnergyTransferParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":EVSEMaximumPower,"urn:iso:15118:2:2016:MsgDataTypes":EVSEMinimumPower)',  derivedBy='EXTENSION'.  */
 static int encode_iso2WPT_EVSEChargeParameterType(bitstream_t* stream, struct iso2WPT_EVSEChargeParameterType* iso2WPT_EVSEChargeParameterType) {
+	int errn = 0;
 	int grammarID = 1810;
 	int done = 0;
 	
@@ -39222,7 +39335,9 @@ static int encode_iso2WPT_EVSEChargeParameterType(bitstream_t* stream, struct is
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,FinePositioningResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEProcessing,"urn:iso:15118:2:2016:MsgDataTypes":EVSEFinePositioningParameters{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_FinePositioningRes == SUPPORT_YES
 static int encode_iso2FinePositioningResType(bitstream_t* stream, struct iso2FinePositioningResType* iso2FinePositioningResType) {
+	int errn = 0;
 	int grammarID = 1812;
 	int done = 0;
 	
@@ -39347,9 +39462,11 @@ static int encode_iso2FinePositioningResType(bitstream_t* stream, struct iso2Fin
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_FinePositioningRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,BodyBaseType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_iso2BodyBaseType(bitstream_t* stream, struct iso2BodyBaseType* iso2BodyBaseType) {
+	int errn = 0;
 	int grammarID = 674;
 	int done = 0;
 	
@@ -39380,7 +39497,9 @@ static int encode_iso2BodyBaseType(bitstream_t* stream, struct iso2BodyBaseType*
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,ServiceDetailResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":ServiceID,"urn:iso:15118:2:2016:MsgBody":ServiceParameterList{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_ServiceDetailRes == SUPPORT_YES
 static int encode_iso2ServiceDetailResType(bitstream_t* stream, struct iso2ServiceDetailResType* iso2ServiceDetailResType) {
+	int errn = 0;
 	int grammarID = 1816;
 	int done = 0;
 	
@@ -39487,9 +39606,12 @@ static int encode_iso2ServiceDetailResType(bitstream_t* stream, struct iso2Servi
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_ServiceDetailRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,PowerDeliveryReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":ChargeProgress,"urn:iso:15118:2:2016:MsgBody":EVOperation{0-1},"urn:iso:15118:2:2016:MsgBody":SAScheduleTupleID{0-1},"urn:iso:15118:2:2016:MsgBody":ChargingProfile{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 static int encode_iso2PowerDeliveryReqType(bitstream_t* stream, struct iso2PowerDeliveryReqType* iso2PowerDeliveryReqType) {
+	int errn = 0;
 	int grammarID = 1820;
 	int done = 0;
 	
@@ -39626,9 +39748,12 @@ static int encode_iso2PowerDeliveryReqType(bitstream_t* stream, struct iso2Power
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_PowerDeliveryReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,PairingResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEProcessing,"urn:iso:15118:2:2016:MsgBody":PairingParameters{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_PairingRes == SUPPORT_YES
 static int encode_iso2PairingResType(bitstream_t* stream, struct iso2PairingResType* iso2PairingResType) {
+	int errn = 0;
 	int grammarID = 1824;
 	int done = 0;
 	
@@ -39735,9 +39860,12 @@ static int encode_iso2PairingResType(bitstream_t* stream, struct iso2PairingResT
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_PairingRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,AuthorizationReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":GenChallenge{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_AuthorizationReq == SUPPORT_YES
 static int encode_iso2AuthorizationReqType(bitstream_t* stream, struct iso2AuthorizationReqType* iso2AuthorizationReqType) {
+	int errn = 0;
 	int grammarID = 1828;
 	int done = 0;
 	
@@ -39749,11 +39877,8 @@ static int encode_iso2AuthorizationReqType(bitstream_t* stream, struct iso2Autho
 			if ( iso2AuthorizationReqType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2AuthorizationReqType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2AuthorizationReqType->Id.characters, iso2AuthorizationReqType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 14 /* {urn:iso:15118:2:2016:MsgBody}Id */, iso2AuthorizationReqType->Id.characters, iso2AuthorizationReqType->Id.charactersLen);
 				}
 				grammarID = 1829;
 			} else 			if ( iso2AuthorizationReqType->GenChallenge_isUsed == 1u ) {
@@ -39830,9 +39955,11 @@ static int encode_iso2AuthorizationReqType(bitstream_t* stream, struct iso2Autho
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_AuthorizationReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ParameterSetType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":ParameterSetID,"urn:iso:15118:2:2016:MsgDataTypes":Parameter{1-16})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2ParameterSetType(bitstream_t* stream, struct iso2ParameterSetType* iso2ParameterSetType) {
+	int errn = 0;
 	int grammarID = 1830;
 	int done = 0;
 	
@@ -40165,6 +40292,7 @@ static int encode_iso2ParameterSetType(bitstream_t* stream, struct iso2Parameter
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SPKIDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SPKISexp,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-1}){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SPKIDataType(bitstream_t* stream, struct iso2SPKIDataType* iso2SPKIDataType) {
+	int errn = 0;
 	int grammarID = 1847;
 	int done = 0;
 	int wcDone = 0;
@@ -40266,7 +40394,9 @@ static int encode_iso2SPKIDataType(bitstream_t* stream, struct iso2SPKIDataType*
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,PaymentDetailsResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":GenChallenge,"urn:iso:15118:2:2016:MsgBody":EVSETimeStamp))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 static int encode_iso2PaymentDetailsResType(bitstream_t* stream, struct iso2PaymentDetailsResType* iso2PaymentDetailsResType) {
+	int errn = 0;
 	int grammarID = 1850;
 	int done = 0;
 	
@@ -40379,9 +40509,11 @@ static int encode_iso2PaymentDetailsResType(bitstream_t* stream, struct iso2Paym
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_PaymentDetailsRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":HMACOutputLength{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SignatureMethodType(bitstream_t* stream, struct iso2SignatureMethodType* iso2SignatureMethodType) {
+	int errn = 0;
 	int grammarID = 1854;
 	int done = 0;
 	int wcDone = 0;
@@ -40394,11 +40526,8 @@ static int encode_iso2SignatureMethodType(bitstream_t* stream, struct iso2Signat
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignatureMethodType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignatureMethodType->Algorithm.characters, iso2SignatureMethodType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 22 /* {}Algorithm */, iso2SignatureMethodType->Algorithm.characters, iso2SignatureMethodType->Algorithm.charactersLen);
 				}
 				grammarID = 1855;
 			} else {
@@ -40431,11 +40560,8 @@ static int encode_iso2SignatureMethodType(bitstream_t* stream, struct iso2Signat
 			} else 			if ( iso2SignatureMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignatureMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignatureMethodType->ANY.characters, iso2SignatureMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, iso2SignatureMethodType->ANY.characters, iso2SignatureMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1856;
@@ -40457,11 +40583,8 @@ static int encode_iso2SignatureMethodType(bitstream_t* stream, struct iso2Signat
 			} else 			if ( iso2SignatureMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignatureMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignatureMethodType->ANY.characters, iso2SignatureMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, iso2SignatureMethodType->ANY.characters, iso2SignatureMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 685;
@@ -40495,11 +40618,8 @@ static int encode_iso2SignatureMethodType(bitstream_t* stream, struct iso2Signat
 			} else 			if ( iso2SignatureMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignatureMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignatureMethodType->ANY.characters, iso2SignatureMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, iso2SignatureMethodType->ANY.characters, iso2SignatureMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1856;
@@ -40519,7 +40639,9 @@ static int encode_iso2SignatureMethodType(bitstream_t* stream, struct iso2Signat
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,AC_BidirectionalControlResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEProcessing,"urn:iso:15118:2:2016:MsgBody":EVSETargetPower,"urn:iso:15118:2:2016:MsgBody":EVSETargetReactivePower,"urn:iso:15118:2:2016:MsgBody":EVSEID,"urn:iso:15118:2:2016:MsgBody":SAScheduleTupleID{0-1},"urn:iso:15118:2:2016:MsgBody":MeterInfo{0-1},"urn:iso:15118:2:2016:MsgBody":ReceiptRequired{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_AC_BidirectionalControlRes == SUPPORT_YES
 static int encode_iso2AC_BidirectionalControlResType(bitstream_t* stream, struct iso2AC_BidirectionalControlResType* iso2AC_BidirectionalControlResType) {
+	int errn = 0;
 	int grammarID = 1857;
 	int done = 0;
 	
@@ -40618,11 +40740,8 @@ static int encode_iso2AC_BidirectionalControlResType(bitstream_t* stream, struct
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2AC_BidirectionalControlResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2AC_BidirectionalControlResType->EVSEID.characters, iso2AC_BidirectionalControlResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2AC_BidirectionalControlResType->EVSEID.characters, iso2AC_BidirectionalControlResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -40649,7 +40768,11 @@ static int encode_iso2AC_BidirectionalControlResType(bitstream_t* stream, struct
 			} else 			if ( iso2AC_BidirectionalControlResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2MeterInfoType(stream, iso2AC_BidirectionalControlResType->MeterInfo );
+#else
 					errn = encode_iso2MeterInfoType(stream, &iso2AC_BidirectionalControlResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 30;
 			} else 			if ( iso2AC_BidirectionalControlResType->ReceiptRequired_isUsed == 1u ) {
@@ -40679,7 +40802,11 @@ static int encode_iso2AC_BidirectionalControlResType(bitstream_t* stream, struct
 			if ( iso2AC_BidirectionalControlResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2MeterInfoType(stream, iso2AC_BidirectionalControlResType->MeterInfo );
+#else
 					errn = encode_iso2MeterInfoType(stream, &iso2AC_BidirectionalControlResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 30;
 			} else 			if ( iso2AC_BidirectionalControlResType->ReceiptRequired_isUsed == 1u ) {
@@ -40750,9 +40877,12 @@ static int encode_iso2AC_BidirectionalControlResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,VehicleCheckOutReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":EVCheckOutStatus,"urn:iso:15118:2:2016:MsgBody":CheckOutTime)',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_VehicleCheckOutReq == SUPPORT_YES
 static int encode_iso2VehicleCheckOutReqType(bitstream_t* stream, struct iso2VehicleCheckOutReqType* iso2VehicleCheckOutReqType) {
+	int errn = 0;
 	int grammarID = 1862;
 	int done = 0;
 	
@@ -40817,9 +40947,12 @@ static int encode_iso2VehicleCheckOutReqType(bitstream_t* stream, struct iso2Veh
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_VehicleCheckOutReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,WeldingDetectionReqType',  base type name='BodyBaseType',  content type='EMPTY',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 static int encode_iso2WeldingDetectionReqType(bitstream_t* stream, struct iso2WeldingDetectionReqType* iso2WeldingDetectionReqType) {
+	int errn = 0;
 	int grammarID = 674;
 	int done = 0;
 	
@@ -40848,9 +40981,12 @@ static int encode_iso2WeldingDetectionReqType(bitstream_t* stream, struct iso2We
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_WeldingDetectionReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,AlignmentCheckResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEProcessing,"urn:iso:15118:2:2016:MsgBody":AlignmentCheckParameters{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_AlignmentCheckRes == SUPPORT_YES
 static int encode_iso2AlignmentCheckResType(bitstream_t* stream, struct iso2AlignmentCheckResType* iso2AlignmentCheckResType) {
+	int errn = 0;
 	int grammarID = 1864;
 	int done = 0;
 	
@@ -40957,9 +41093,12 @@ static int encode_iso2AlignmentCheckResType(bitstream_t* stream, struct iso2Alig
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_AlignmentCheckRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,PowerDemandReqType',  base type name='ChargeLoopReqType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":EVTargetEnergyRequest,"urn:iso:15118:2:2016:MsgBody":EVMaximumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgBody":EVMinimumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgBody":DisplayParameters{0-1}),("urn:iso:15118:2:2016:MsgBody":EVTargetPower,"urn:iso:15118:2:2016:MsgBody":EVInputPower,"urn:iso:15118:2:2016:MsgBody":PowerDemandParameters{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_PowerDemandReq == SUPPORT_YES
 static int encode_iso2PowerDemandReqType(bitstream_t* stream, struct iso2PowerDemandReqType* iso2PowerDemandReqType) {
+	int errn = 0;
 	int grammarID = 1867;
 	int done = 0;
 	
@@ -41114,9 +41253,11 @@ static int encode_iso2PowerDemandReqType(bitstream_t* stream, struct iso2PowerDe
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_PowerDemandReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MinimumPMaxRequestType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":MinimumPMaxScheduleEntry{1-3})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2MinimumPMaxRequestType(bitstream_t* stream, struct iso2MinimumPMaxRequestType* iso2MinimumPMaxRequestType) {
+	int errn = 0;
 	int grammarID = 1874;
 	int done = 0;
 	
@@ -41196,7 +41337,9 @@ static int encode_iso2MinimumPMaxRequestType(bitstream_t* stream, struct iso2Min
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,DisconnectChargingDeviceResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEProcessing,"urn:iso:15118:2:2016:MsgBody":EVSEElectricalChargingDeviceStatus,"urn:iso:15118:2:2016:MsgBody":EVSEMechanicalChargingDeviceStatus))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_DisconnectChargingDeviceRes == SUPPORT_YES
 static int encode_iso2DisconnectChargingDeviceResType(bitstream_t* stream, struct iso2DisconnectChargingDeviceResType* iso2DisconnectChargingDeviceResType) {
+	int errn = 0;
 	int grammarID = 591;
 	int done = 0;
 	
@@ -41321,9 +41464,12 @@ static int encode_iso2DisconnectChargingDeviceResType(bitstream_t* stream, struc
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,SessionSetupReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":EVCCID)',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_SessionSetupReq == SUPPORT_YES
 static int encode_iso2SessionSetupReqType(bitstream_t* stream, struct iso2SessionSetupReqType* iso2SessionSetupReqType) {
+	int errn = 0;
 	int grammarID = 1877;
 	int done = 0;
 	
@@ -41373,9 +41519,12 @@ static int encode_iso2SessionSetupReqType(bitstream_t* stream, struct iso2Sessio
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_SessionSetupReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,PaymentDetailsReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":eMAID,"urn:iso:15118:2:2016:MsgBody":ContractSignatureCertChain)',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 static int encode_iso2PaymentDetailsReqType(bitstream_t* stream, struct iso2PaymentDetailsReqType* iso2PaymentDetailsReqType) {
+	int errn = 0;
 	int grammarID = 1878;
 	int done = 0;
 	
@@ -41390,11 +41539,8 @@ static int encode_iso2PaymentDetailsReqType(bitstream_t* stream, struct iso2Paym
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2PaymentDetailsReqType->eMAID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2PaymentDetailsReqType->eMAID.characters, iso2PaymentDetailsReqType->eMAID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 15 /* {urn:iso:15118:2:2016:MsgBody}eMAID */, iso2PaymentDetailsReqType->eMAID.characters, iso2PaymentDetailsReqType->eMAID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -41438,9 +41584,11 @@ static int encode_iso2PaymentDetailsReqType(bitstream_t* stream, struct iso2Paym
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_PaymentDetailsReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,Generic_EVFinePositioningParametersType',  base type name='EVFinePositioningParametersType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":GenericParameters)',  derivedBy='EXTENSION'.  */
 static int encode_iso2Generic_EVFinePositioningParametersType(bitstream_t* stream, struct iso2Generic_EVFinePositioningParametersType* iso2Generic_EVFinePositioningParametersType) {
+	int errn = 0;
 	int grammarID = 1880;
 	int done = 0;
 	
@@ -41483,7 +41631,9 @@ static int encode_iso2Generic_EVFinePositioningParametersType(bitstream_t* strea
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,ConnectChargingDeviceReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":EVElectricalChargingDeviceStatus,"urn:iso:15118:2:2016:MsgBody":EVMechanicalChargingDeviceStatus)',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_ConnectChargingDeviceReq == SUPPORT_YES
 static int encode_iso2ConnectChargingDeviceReqType(bitstream_t* stream, struct iso2ConnectChargingDeviceReqType* iso2ConnectChargingDeviceReqType) {
+	int errn = 0;
 	int grammarID = 1496;
 	int done = 0;
 	
@@ -41548,9 +41698,11 @@ static int encode_iso2ConnectChargingDeviceReqType(bitstream_t* stream, struct i
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,AC_EVSEChargeParameterType',  base type name='EVSEEnergyTransferParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":EVSEMaximumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVSENominalVoltage,"urn:iso:15118:2:2016:MsgDataTypes":EVSENominalFrequency)',  derivedBy='EXTENSION'.  */
 static int encode_iso2AC_EVSEChargeParameterType(bitstream_t* stream, struct iso2AC_EVSEChargeParameterType* iso2AC_EVSEChargeParameterType) {
+	int errn = 0;
 	int grammarID = 1881;
 	int done = 0;
 	
@@ -41618,6 +41770,7 @@ static int encode_iso2AC_EVSEChargeParameterType(bitstream_t* stream, struct iso
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SalesTariffEntryType',  base type name='EntryType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgDataTypes":RelativeTimeInterval),("urn:iso:15118:2:2016:MsgDataTypes":EPriceLevel{0-1},"urn:iso:15118:2:2016:MsgDataTypes":ConsumptionCost{0-3}))',  derivedBy='EXTENSION'.  */
 static int encode_iso2SalesTariffEntryType(bitstream_t* stream, struct iso2SalesTariffEntryType* iso2SalesTariffEntryType) {
+	int errn = 0;
 	int grammarID = 1883;
 	int done = 0;
 	
@@ -41746,6 +41899,7 @@ static int encode_iso2SalesTariffEntryType(bitstream_t* stream, struct iso2Sales
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,DC_EVSEBidirectionalParameterType',  base type name='DC_EVSEChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgDataTypes":EVSEMaximumChargePower,"urn:iso:15118:2:2016:MsgDataTypes":EVSEMaximumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVSEMinimumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVSEMaximumVoltage,"urn:iso:15118:2:2016:MsgDataTypes":EVSEMinimumVoltage,"urn:iso:15118:2:2016:MsgDataTypes":EVSECurrentRegulationTolerance{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVSEPeakCurrentRipple,"urn:iso:15118:2:2016:MsgDataTypes":EVSEEnergyToBeDelivered{0-1}),("urn:iso:15118:2:2016:MsgDataTypes":EVSEMaximumDischargePower,"urn:iso:15118:2:2016:MsgDataTypes":EVSEMaximumDischargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVSEMinimumDischargeCurrent))',  derivedBy='EXTENSION'.  */
 static int encode_iso2DC_EVSEBidirectionalParameterType(bitstream_t* stream, struct iso2DC_EVSEBidirectionalParameterType* iso2DC_EVSEBidirectionalParameterType) {
+	int errn = 0;
 	int grammarID = 1888;
 	int done = 0;
 	
@@ -41921,6 +42075,7 @@ static int encode_iso2DC_EVSEBidirectionalParameterType(bitstream_t* stream, str
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,CanonicalizationMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2CanonicalizationMethodType(bitstream_t* stream, struct iso2CanonicalizationMethodType* iso2CanonicalizationMethodType) {
+	int errn = 0;
 	int grammarID = 1899;
 	int done = 0;
 	int wcDone = 0;
@@ -41933,11 +42088,8 @@ static int encode_iso2CanonicalizationMethodType(bitstream_t* stream, struct iso
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2CanonicalizationMethodType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2CanonicalizationMethodType->Algorithm.characters, iso2CanonicalizationMethodType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 22 /* {}Algorithm */, iso2CanonicalizationMethodType->Algorithm.characters, iso2CanonicalizationMethodType->Algorithm.charactersLen);
 				}
 				grammarID = 684;
 			} else {
@@ -41958,11 +42110,8 @@ static int encode_iso2CanonicalizationMethodType(bitstream_t* stream, struct iso
 			} else 			if ( iso2CanonicalizationMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2CanonicalizationMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2CanonicalizationMethodType->ANY.characters, iso2CanonicalizationMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, iso2CanonicalizationMethodType->ANY.characters, iso2CanonicalizationMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 685;
@@ -41984,11 +42133,8 @@ static int encode_iso2CanonicalizationMethodType(bitstream_t* stream, struct iso
 			} else 			if ( iso2CanonicalizationMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2CanonicalizationMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2CanonicalizationMethodType->ANY.characters, iso2CanonicalizationMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, iso2CanonicalizationMethodType->ANY.characters, iso2CanonicalizationMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 685;
@@ -42009,6 +42155,7 @@ static int encode_iso2CanonicalizationMethodType(bitstream_t* stream, struct iso
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,DisplayParametersType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":CurrentRange{0-1},"urn:iso:15118:2:2016:MsgDataTypes":CurrentSOC{0-1},"urn:iso:15118:2:2016:MsgDataTypes":TargetSOC{0-1},"urn:iso:15118:2:2016:MsgDataTypes":BulkSOC{0-1},"urn:iso:15118:2:2016:MsgDataTypes":MinimumSOC{0-1},"urn:iso:15118:2:2016:MsgDataTypes":ChargingPerformance{0-1},"urn:iso:15118:2:2016:MsgDataTypes":RemainingTimeToTargetSOC{0-1},"urn:iso:15118:2:2016:MsgDataTypes":RemainingTimeToBulkSOC{0-1},"urn:iso:15118:2:2016:MsgDataTypes":RemainingTimeToMinimumSOC{0-1},"urn:iso:15118:2:2016:MsgDataTypes":ChargingComplete{0-1},"urn:iso:15118:2:2016:MsgDataTypes":BulkChargingComplete{0-1},"urn:iso:15118:2:2016:MsgDataTypes":InletHot{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2DisplayParametersType(bitstream_t* stream, struct iso2DisplayParametersType* iso2DisplayParametersType) {
+	int errn = 0;
 	int grammarID = 1900;
 	int done = 0;
 	
@@ -43084,6 +43231,7 @@ static int encode_iso2DisplayParametersType(bitstream_t* stream, struct iso2Disp
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,DC_EVBidirectionalParameterType',  base type name='DC_EVChargeParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((("urn:iso:15118:2:2016:MsgDataTypes":DepartureTime),("urn:iso:15118:2:2016:MsgDataTypes":EVMaximumChargePower{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumChargePower{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumVoltage,"urn:iso:15118:2:2016:MsgDataTypes":EVTargetEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":CurrentSOC{0-1},"urn:iso:15118:2:2016:MsgDataTypes":TargetSOC{0-1},"urn:iso:15118:2:2016:MsgDataTypes":BulkSOC{0-1})),("urn:iso:15118:2:2016:MsgDataTypes":EVMaximumDischargePower{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumDischargePower{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumDischargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumDischargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumVoltage,"urn:iso:15118:2:2016:MsgDataTypes":MinimumSOC{0-1}))',  derivedBy='EXTENSION'.  */
 static int encode_iso2DC_EVBidirectionalParameterType(bitstream_t* stream, struct iso2DC_EVBidirectionalParameterType* iso2DC_EVBidirectionalParameterType) {
+	int errn = 0;
 	int grammarID = 1912;
 	int done = 0;
 	
@@ -43672,7 +43820,9 @@ static int encode_iso2DC_EVBidirectionalParameterType(bitstream_t* stream, struc
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,PaymentServiceSelectionReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":SelectedPaymentOption,"urn:iso:15118:2:2016:MsgBody":SelectedEnergyTransferService,"urn:iso:15118:2:2016:MsgBody":SelectedVASList{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 static int encode_iso2PaymentServiceSelectionReqType(bitstream_t* stream, struct iso2PaymentServiceSelectionReqType* iso2PaymentServiceSelectionReqType) {
+	int errn = 0;
 	int grammarID = 1930;
 	int done = 0;
 	
@@ -43714,7 +43864,11 @@ static int encode_iso2PaymentServiceSelectionReqType(bitstream_t* stream, struct
 			if ( iso2PaymentServiceSelectionReqType->SelectedVASList_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2SelectedServiceListType(stream, iso2PaymentServiceSelectionReqType->SelectedVASList );
+#else
 					errn = encode_iso2SelectedServiceListType(stream, &iso2PaymentServiceSelectionReqType->SelectedVASList );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 3;
 			} else 			if (1==1) {
@@ -43749,9 +43903,11 @@ static int encode_iso2PaymentServiceSelectionReqType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MagneticVectorType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":GAID,"urn:iso:15118:2:2016:MsgDataTypes":Distance,"urn:iso:15118:2:2016:MsgDataTypes":AngleGAtoVA,"urn:iso:15118:2:2016:MsgDataTypes":RotationVAtoGA,"urn:iso:15118:2:2016:MsgDataTypes":FODStatus)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2MagneticVectorType(bitstream_t* stream, struct iso2MagneticVectorType* iso2MagneticVectorType) {
+	int errn = 0;
 	int grammarID = 1933;
 	int done = 0;
 	
@@ -43766,11 +43922,8 @@ static int encode_iso2MagneticVectorType(bitstream_t* stream, struct iso2Magneti
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2MagneticVectorType->GAID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2MagneticVectorType->GAID.characters, iso2MagneticVectorType->GAID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 16 /* {urn:iso:15118:2:2016:MsgDataTypes}GAID */, iso2MagneticVectorType->GAID.characters, iso2MagneticVectorType->GAID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -43865,6 +44018,7 @@ static int encode_iso2MagneticVectorType(bitstream_t* stream, struct iso2Magneti
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,PhysicalValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":Exponent,"urn:iso:15118:2:2016:MsgDataTypes":Value)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2PhysicalValueType(bitstream_t* stream, struct iso2PhysicalValueType* iso2PhysicalValueType) {
+	int errn = 0;
 	int grammarID = 1938;
 	int done = 0;
 	
@@ -43931,7 +44085,9 @@ static int encode_iso2PhysicalValueType(bitstream_t* stream, struct iso2Physical
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,SystemStatusReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":OperationMode,"urn:iso:15118:2:2016:MsgBody":EVMechanicalChargingDeviceStatus)',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_SystemStatusReq == SUPPORT_YES
 static int encode_iso2SystemStatusReqType(bitstream_t* stream, struct iso2SystemStatusReqType* iso2SystemStatusReqType) {
+	int errn = 0;
 	int grammarID = 1940;
 	int done = 0;
 	
@@ -43996,9 +44152,12 @@ static int encode_iso2SystemStatusReqType(bitstream_t* stream, struct iso2System
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_SystemStatusReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,SystemStatusResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":OperationMode,"urn:iso:15118:2:2016:MsgBody":EVSEMechanicalChargingDeviceStatus))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_SystemStatusRes == SUPPORT_YES
 static int encode_iso2SystemStatusResType(bitstream_t* stream, struct iso2SystemStatusResType* iso2SystemStatusResType) {
+	int errn = 0;
 	int grammarID = 1941;
 	int done = 0;
 	
@@ -44105,9 +44264,11 @@ static int encode_iso2SystemStatusResType(bitstream_t* stream, struct iso2System
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_SystemStatusRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,EVSEFinePositioningSetupParametersType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_iso2EVSEFinePositioningSetupParametersType(bitstream_t* stream, struct iso2EVSEFinePositioningSetupParametersType* iso2EVSEFinePositioningSetupParametersType) {
+	int errn = 0;
 	int grammarID = 674;
 	int done = 0;
 	
@@ -44138,7 +44299,9 @@ static int encode_iso2EVSEFinePositioningSetupParametersType(bitstream_t* stream
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,V2GResponseType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_V2GResponse == SUPPORT_YES
 static int encode_iso2V2GResponseType(bitstream_t* stream, struct iso2V2GResponseType* iso2V2GResponseType) {
+	int errn = 0;
 	int grammarID = 599;
 	int done = 0;
 	
@@ -44203,9 +44366,11 @@ static int encode_iso2V2GResponseType(bitstream_t* stream, struct iso2V2GRespons
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_V2GResponse */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,BodyType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":BodyElement)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2BodyType(bitstream_t* stream, struct iso2BodyType* iso2BodyType) {
+	int errn = 0;
 	int grammarID = 1944;
 	int done = 0;
 	
@@ -44215,371 +44380,615 @@ static int encode_iso2BodyType(bitstream_t* stream, struct iso2BodyType* iso2Bod
 		case 1944:
 			/* FirstStartTag[START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AC_BidirectionalControlReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AC_BidirectionalControlRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AlignmentCheckReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AlignmentCheckRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AuthorizationReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AuthorizationRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}BodyElement), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CableCheckReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CableCheckRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateInstallationReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateInstallationRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateUpdateReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateUpdateRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargeParameterDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargeParameterDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargingStatusReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargingStatusRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ConnectChargingDeviceReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ConnectChargingDeviceRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CurrentDemandReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CurrentDemandRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DC_BidirectionalControlReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DC_BidirectionalControlRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DisconnectChargingDeviceReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DisconnectChargingDeviceRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningSetupReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningSetupRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MeteringReceiptReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MeteringReceiptRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PairingReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PairingRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentDetailsReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentDetailsRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentServiceSelectionReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentServiceSelectionRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDeliveryReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDeliveryRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDemandReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDemandRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PreChargeReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PreChargeRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDetailReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDetailRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionSetupReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionSetupRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionStopReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionStopRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SystemStatusReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SystemStatusRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}V2GRequest), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}V2GResponse), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckInReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckInRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckOutReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckOutRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}WeldingDetectionReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}WeldingDetectionRes)] */
 			if ( iso2BodyType->AC_BidirectionalControlReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_AC_BidirectionalControlReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 0);
 				if(errn == 0) {
 					errn = encode_iso2AC_BidirectionalControlReqType(stream, &iso2BodyType->AC_BidirectionalControlReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlReq */
 			} else 			if ( iso2BodyType->AC_BidirectionalControlRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_AC_BidirectionalControlRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 1);
 				if(errn == 0) {
 					errn = encode_iso2AC_BidirectionalControlResType(stream, &iso2BodyType->AC_BidirectionalControlRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlRes */
 			} else 			if ( iso2BodyType->AlignmentCheckReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_AlignmentCheckReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 2);
 				if(errn == 0) {
 					errn = encode_iso2AlignmentCheckReqType(stream, &iso2BodyType->AlignmentCheckReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AlignmentCheckReq */
 			} else 			if ( iso2BodyType->AlignmentCheckRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_AlignmentCheckRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 3);
 				if(errn == 0) {
 					errn = encode_iso2AlignmentCheckResType(stream, &iso2BodyType->AlignmentCheckRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AlignmentCheckRes */
 			} else 			if ( iso2BodyType->AuthorizationReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_AuthorizationReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 4);
 				if(errn == 0) {
 					errn = encode_iso2AuthorizationReqType(stream, &iso2BodyType->AuthorizationReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AuthorizationReq */
 			} else 			if ( iso2BodyType->AuthorizationRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_AuthorizationRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 5);
 				if(errn == 0) {
 					errn = encode_iso2AuthorizationResType(stream, &iso2BodyType->AuthorizationRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AuthorizationRes */
 			} else 			if ( iso2BodyType->BodyElement_isUsed == 1u ) {
+#if ISO2_DEPLOY_BodyElement == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 6);
 				if(errn == 0) {
 					errn = encode_iso2BodyBaseType(stream, &iso2BodyType->BodyElement );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_BodyElement */
 			} else 			if ( iso2BodyType->CableCheckReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_CableCheckReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 7);
 				if(errn == 0) {
 					errn = encode_iso2CableCheckReqType(stream, &iso2BodyType->CableCheckReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CableCheckReq */
 			} else 			if ( iso2BodyType->CableCheckRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_CableCheckRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 8);
 				if(errn == 0) {
 					errn = encode_iso2CableCheckResType(stream, &iso2BodyType->CableCheckRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CableCheckRes */
 			} else 			if ( iso2BodyType->CertificateInstallationReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 9);
 				if(errn == 0) {
 					errn = encode_iso2CertificateInstallationReqType(stream, &iso2BodyType->CertificateInstallationReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CertificateInstallationReq */
 			} else 			if ( iso2BodyType->CertificateInstallationRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 10);
 				if(errn == 0) {
 					errn = encode_iso2CertificateInstallationResType(stream, &iso2BodyType->CertificateInstallationRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CertificateInstallationRes */
 			} else 			if ( iso2BodyType->CertificateUpdateReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 11);
 				if(errn == 0) {
 					errn = encode_iso2CertificateUpdateReqType(stream, &iso2BodyType->CertificateUpdateReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CertificateUpdateReq */
 			} else 			if ( iso2BodyType->CertificateUpdateRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 12);
 				if(errn == 0) {
 					errn = encode_iso2CertificateUpdateResType(stream, &iso2BodyType->CertificateUpdateRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CertificateUpdateRes */
 			} else 			if ( iso2BodyType->ChargeParameterDiscoveryReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 13);
 				if(errn == 0) {
 					errn = encode_iso2ChargeParameterDiscoveryReqType(stream, &iso2BodyType->ChargeParameterDiscoveryReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryReq */
 			} else 			if ( iso2BodyType->ChargeParameterDiscoveryRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 14);
 				if(errn == 0) {
 					errn = encode_iso2ChargeParameterDiscoveryResType(stream, &iso2BodyType->ChargeParameterDiscoveryRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryRes */
 			} else 			if ( iso2BodyType->ChargingStatusReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_ChargingStatusReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 15);
 				if(errn == 0) {
 					errn = encode_iso2ChargingStatusReqType(stream, &iso2BodyType->ChargingStatusReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ChargingStatusReq */
 			} else 			if ( iso2BodyType->ChargingStatusRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_ChargingStatusRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 16);
 				if(errn == 0) {
 					errn = encode_iso2ChargingStatusResType(stream, &iso2BodyType->ChargingStatusRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ChargingStatusRes */
 			} else 			if ( iso2BodyType->ConnectChargingDeviceReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_ConnectChargingDeviceReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 17);
 				if(errn == 0) {
 					errn = encode_iso2ConnectChargingDeviceReqType(stream, &iso2BodyType->ConnectChargingDeviceReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceReq */
 			} else 			if ( iso2BodyType->ConnectChargingDeviceRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_ConnectChargingDeviceRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 18);
 				if(errn == 0) {
 					errn = encode_iso2ConnectChargingDeviceResType(stream, &iso2BodyType->ConnectChargingDeviceRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceRes */
 			} else 			if ( iso2BodyType->CurrentDemandReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_CurrentDemandReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 19);
 				if(errn == 0) {
 					errn = encode_iso2CurrentDemandReqType(stream, &iso2BodyType->CurrentDemandReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CurrentDemandReq */
 			} else 			if ( iso2BodyType->CurrentDemandRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_CurrentDemandRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 20);
 				if(errn == 0) {
 					errn = encode_iso2CurrentDemandResType(stream, &iso2BodyType->CurrentDemandRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CurrentDemandRes */
 			} else 			if ( iso2BodyType->DC_BidirectionalControlReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_DC_BidirectionalControlReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 21);
 				if(errn == 0) {
 					errn = encode_iso2DC_BidirectionalControlReqType(stream, &iso2BodyType->DC_BidirectionalControlReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlReq */
 			} else 			if ( iso2BodyType->DC_BidirectionalControlRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_DC_BidirectionalControlRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 22);
 				if(errn == 0) {
 					errn = encode_iso2DC_BidirectionalControlResType(stream, &iso2BodyType->DC_BidirectionalControlRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlRes */
 			} else 			if ( iso2BodyType->DisconnectChargingDeviceReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_DisconnectChargingDeviceReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 23);
 				if(errn == 0) {
 					errn = encode_iso2DisconnectChargingDeviceReqType(stream, &iso2BodyType->DisconnectChargingDeviceReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceReq */
 			} else 			if ( iso2BodyType->DisconnectChargingDeviceRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_DisconnectChargingDeviceRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 24);
 				if(errn == 0) {
 					errn = encode_iso2DisconnectChargingDeviceResType(stream, &iso2BodyType->DisconnectChargingDeviceRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceRes */
 			} else 			if ( iso2BodyType->FinePositioningReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_FinePositioningReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 25);
 				if(errn == 0) {
 					errn = encode_iso2FinePositioningReqType(stream, &iso2BodyType->FinePositioningReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_FinePositioningReq */
 			} else 			if ( iso2BodyType->FinePositioningRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_FinePositioningRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 26);
 				if(errn == 0) {
 					errn = encode_iso2FinePositioningResType(stream, &iso2BodyType->FinePositioningRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_FinePositioningRes */
 			} else 			if ( iso2BodyType->FinePositioningSetupReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_FinePositioningSetupReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 27);
 				if(errn == 0) {
 					errn = encode_iso2FinePositioningSetupReqType(stream, &iso2BodyType->FinePositioningSetupReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_FinePositioningSetupReq */
 			} else 			if ( iso2BodyType->FinePositioningSetupRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_FinePositioningSetupRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 28);
 				if(errn == 0) {
 					errn = encode_iso2FinePositioningSetupResType(stream, &iso2BodyType->FinePositioningSetupRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_FinePositioningSetupRes */
 			} else 			if ( iso2BodyType->MeteringReceiptReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 29);
 				if(errn == 0) {
 					errn = encode_iso2MeteringReceiptReqType(stream, &iso2BodyType->MeteringReceiptReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_MeteringReceiptReq */
 			} else 			if ( iso2BodyType->MeteringReceiptRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 30);
 				if(errn == 0) {
 					errn = encode_iso2MeteringReceiptResType(stream, &iso2BodyType->MeteringReceiptRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_MeteringReceiptRes */
 			} else 			if ( iso2BodyType->PairingReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_PairingReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 31);
 				if(errn == 0) {
 					errn = encode_iso2PairingReqType(stream, &iso2BodyType->PairingReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PairingReq */
 			} else 			if ( iso2BodyType->PairingRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_PairingRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 32);
 				if(errn == 0) {
 					errn = encode_iso2PairingResType(stream, &iso2BodyType->PairingRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PairingRes */
 			} else 			if ( iso2BodyType->PaymentDetailsReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 33);
 				if(errn == 0) {
 					errn = encode_iso2PaymentDetailsReqType(stream, &iso2BodyType->PaymentDetailsReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PaymentDetailsReq */
 			} else 			if ( iso2BodyType->PaymentDetailsRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 34);
 				if(errn == 0) {
 					errn = encode_iso2PaymentDetailsResType(stream, &iso2BodyType->PaymentDetailsRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PaymentDetailsRes */
 			} else 			if ( iso2BodyType->PaymentServiceSelectionReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 35);
 				if(errn == 0) {
 					errn = encode_iso2PaymentServiceSelectionReqType(stream, &iso2BodyType->PaymentServiceSelectionReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionReq */
 			} else 			if ( iso2BodyType->PaymentServiceSelectionRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 36);
 				if(errn == 0) {
 					errn = encode_iso2PaymentServiceSelectionResType(stream, &iso2BodyType->PaymentServiceSelectionRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionRes */
 			} else 			if ( iso2BodyType->PowerDeliveryReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 37);
 				if(errn == 0) {
 					errn = encode_iso2PowerDeliveryReqType(stream, &iso2BodyType->PowerDeliveryReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PowerDeliveryReq */
 			} else 			if ( iso2BodyType->PowerDeliveryRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 38);
 				if(errn == 0) {
 					errn = encode_iso2PowerDeliveryResType(stream, &iso2BodyType->PowerDeliveryRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PowerDeliveryRes */
 			} else 			if ( iso2BodyType->PowerDemandReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_PowerDemandReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 39);
 				if(errn == 0) {
 					errn = encode_iso2PowerDemandReqType(stream, &iso2BodyType->PowerDemandReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PowerDemandReq */
 			} else 			if ( iso2BodyType->PowerDemandRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_PowerDemandRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 40);
 				if(errn == 0) {
 					errn = encode_iso2PowerDemandResType(stream, &iso2BodyType->PowerDemandRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PowerDemandRes */
 			} else 			if ( iso2BodyType->PreChargeReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_PreChargeReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 41);
 				if(errn == 0) {
 					errn = encode_iso2PreChargeReqType(stream, &iso2BodyType->PreChargeReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PreChargeReq */
 			} else 			if ( iso2BodyType->PreChargeRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_PreChargeRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 42);
 				if(errn == 0) {
 					errn = encode_iso2PreChargeResType(stream, &iso2BodyType->PreChargeRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PreChargeRes */
 			} else 			if ( iso2BodyType->ServiceDetailReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_ServiceDetailReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 43);
 				if(errn == 0) {
 					errn = encode_iso2ServiceDetailReqType(stream, &iso2BodyType->ServiceDetailReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ServiceDetailReq */
 			} else 			if ( iso2BodyType->ServiceDetailRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_ServiceDetailRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 44);
 				if(errn == 0) {
 					errn = encode_iso2ServiceDetailResType(stream, &iso2BodyType->ServiceDetailRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ServiceDetailRes */
 			} else 			if ( iso2BodyType->ServiceDiscoveryReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 45);
 				if(errn == 0) {
 					errn = encode_iso2ServiceDiscoveryReqType(stream, &iso2BodyType->ServiceDiscoveryReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ServiceDiscoveryReq */
 			} else 			if ( iso2BodyType->ServiceDiscoveryRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 46);
 				if(errn == 0) {
 					errn = encode_iso2ServiceDiscoveryResType(stream, &iso2BodyType->ServiceDiscoveryRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ServiceDiscoveryRes */
 			} else 			if ( iso2BodyType->SessionSetupReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_SessionSetupReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 47);
 				if(errn == 0) {
 					errn = encode_iso2SessionSetupReqType(stream, &iso2BodyType->SessionSetupReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SessionSetupReq */
 			} else 			if ( iso2BodyType->SessionSetupRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_SessionSetupRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 48);
 				if(errn == 0) {
 					errn = encode_iso2SessionSetupResType(stream, &iso2BodyType->SessionSetupRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SessionSetupRes */
 			} else 			if ( iso2BodyType->SessionStopReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_SessionStopReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 49);
 				if(errn == 0) {
 					errn = encode_iso2SessionStopReqType(stream, &iso2BodyType->SessionStopReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SessionStopReq */
 			} else 			if ( iso2BodyType->SessionStopRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_SessionStopRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 50);
 				if(errn == 0) {
 					errn = encode_iso2SessionStopResType(stream, &iso2BodyType->SessionStopRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SessionStopRes */
 			} else 			if ( iso2BodyType->SystemStatusReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_SystemStatusReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 51);
 				if(errn == 0) {
 					errn = encode_iso2SystemStatusReqType(stream, &iso2BodyType->SystemStatusReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SystemStatusReq */
 			} else 			if ( iso2BodyType->SystemStatusRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_SystemStatusRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 52);
 				if(errn == 0) {
 					errn = encode_iso2SystemStatusResType(stream, &iso2BodyType->SystemStatusRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SystemStatusRes */
 			} else 			if ( iso2BodyType->V2GRequest_isUsed == 1u ) {
+#if ISO2_DEPLOY_V2GRequest == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 53);
 				if(errn == 0) {
 					errn = encode_iso2BodyBaseType(stream, &iso2BodyType->V2GRequest );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_V2GRequest */
 			} else 			if ( iso2BodyType->V2GResponse_isUsed == 1u ) {
+#if ISO2_DEPLOY_V2GResponse == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 54);
 				if(errn == 0) {
 					errn = encode_iso2V2GResponseType(stream, &iso2BodyType->V2GResponse );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_V2GResponse */
 			} else 			if ( iso2BodyType->VehicleCheckInReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_VehicleCheckInReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 55);
 				if(errn == 0) {
 					errn = encode_iso2VehicleCheckInReqType(stream, &iso2BodyType->VehicleCheckInReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_VehicleCheckInReq */
 			} else 			if ( iso2BodyType->VehicleCheckInRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_VehicleCheckInRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 56);
 				if(errn == 0) {
 					errn = encode_iso2VehicleCheckInResType(stream, &iso2BodyType->VehicleCheckInRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_VehicleCheckInRes */
 			} else 			if ( iso2BodyType->VehicleCheckOutReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_VehicleCheckOutReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 57);
 				if(errn == 0) {
 					errn = encode_iso2VehicleCheckOutReqType(stream, &iso2BodyType->VehicleCheckOutReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_VehicleCheckOutReq */
 			} else 			if ( iso2BodyType->VehicleCheckOutRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_VehicleCheckOutRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 58);
 				if(errn == 0) {
 					errn = encode_iso2VehicleCheckOutResType(stream, &iso2BodyType->VehicleCheckOutRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_VehicleCheckOutRes */
 			} else 			if ( iso2BodyType->WeldingDetectionReq_isUsed == 1u ) {
+#if ISO2_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 59);
 				if(errn == 0) {
 					errn = encode_iso2WeldingDetectionReqType(stream, &iso2BodyType->WeldingDetectionReq );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_WeldingDetectionReq */
 			} else 			if ( iso2BodyType->WeldingDetectionRes_isUsed == 1u ) {
+#if ISO2_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 				errn = encodeNBitUnsignedInteger(stream, 6, 60);
 				if(errn == 0) {
 					errn = encode_iso2WeldingDetectionResType(stream, &iso2BodyType->WeldingDetectionRes );
 				}
 				grammarID = 3;
+#else
+				errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_WeldingDetectionRes */
 			} else {
 				errn = EXI_ERROR_UNKOWN_EVENT;
 			}
@@ -44608,7 +45017,9 @@ static int encode_iso2BodyType(bitstream_t* stream, struct iso2BodyType* iso2Bod
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,PreChargeResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEPresentVoltage))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_PreChargeRes == SUPPORT_YES
 static int encode_iso2PreChargeResType(bitstream_t* stream, struct iso2PreChargeResType* iso2PreChargeResType) {
+	int errn = 0;
 	int grammarID = 596;
 	int done = 0;
 	
@@ -44685,9 +45096,11 @@ static int encode_iso2PreChargeResType(bitstream_t* stream, struct iso2PreCharge
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_PreChargeRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,EVSEFinePositioningParametersType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_iso2EVSEFinePositioningParametersType(bitstream_t* stream, struct iso2EVSEFinePositioningParametersType* iso2EVSEFinePositioningParametersType) {
+	int errn = 0;
 	int grammarID = 674;
 	int done = 0;
 	
@@ -44718,7 +45131,9 @@ static int encode_iso2EVSEFinePositioningParametersType(bitstream_t* stream, str
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,PaymentServiceSelectionResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 static int encode_iso2PaymentServiceSelectionResType(bitstream_t* stream, struct iso2PaymentServiceSelectionResType* iso2PaymentServiceSelectionResType) {
+	int errn = 0;
 	int grammarID = 599;
 	int done = 0;
 	
@@ -44783,9 +45198,11 @@ static int encode_iso2PaymentServiceSelectionResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DigestMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2DigestMethodType(bitstream_t* stream, struct iso2DigestMethodType* iso2DigestMethodType) {
+	int errn = 0;
 	int grammarID = 1899;
 	int done = 0;
 	int wcDone = 0;
@@ -44798,11 +45215,8 @@ static int encode_iso2DigestMethodType(bitstream_t* stream, struct iso2DigestMet
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2DigestMethodType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2DigestMethodType->Algorithm.characters, iso2DigestMethodType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 22 /* {}Algorithm */, iso2DigestMethodType->Algorithm.characters, iso2DigestMethodType->Algorithm.charactersLen);
 				}
 				grammarID = 684;
 			} else {
@@ -44823,11 +45237,8 @@ static int encode_iso2DigestMethodType(bitstream_t* stream, struct iso2DigestMet
 			} else 			if ( iso2DigestMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2DigestMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2DigestMethodType->ANY.characters, iso2DigestMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, iso2DigestMethodType->ANY.characters, iso2DigestMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 685;
@@ -44849,11 +45260,8 @@ static int encode_iso2DigestMethodType(bitstream_t* stream, struct iso2DigestMet
 			} else 			if ( iso2DigestMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2DigestMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2DigestMethodType->ANY.characters, iso2DigestMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, iso2DigestMethodType->ANY.characters, iso2DigestMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 685;
@@ -44874,6 +45282,7 @@ static int encode_iso2DigestMethodType(bitstream_t* stream, struct iso2DigestMet
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,TargetPositionType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":TargetOffsetX,"urn:iso:15118:2:2016:MsgDataTypes":TargetOffsetY)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2TargetPositionType(bitstream_t* stream, struct iso2TargetPositionType* iso2TargetPositionType) {
+	int errn = 0;
 	int grammarID = 1945;
 	int done = 0;
 	
@@ -44941,6 +45350,7 @@ static int encode_iso2TargetPositionType(bitstream_t* stream, struct iso2TargetP
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,LFA_EVFinePositioningParametersType',  base type name='EVFinePositioningParametersType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":NumberOfSignalPackages,"urn:iso:15118:2:2016:MsgDataTypes":SensorPackageList)',  derivedBy='EXTENSION'.  */
 static int encode_iso2LFA_EVFinePositioningParametersType(bitstream_t* stream, struct iso2LFA_EVFinePositioningParametersType* iso2LFA_EVFinePositioningParametersType) {
+	int errn = 0;
 	int grammarID = 670;
 	int done = 0;
 	
@@ -45002,6 +45412,7 @@ static int encode_iso2LFA_EVFinePositioningParametersType(bitstream_t* stream, s
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,DC_EVChargeParameterType',  base type name='EVEnergyTransferParameterType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgDataTypes":DepartureTime),("urn:iso:15118:2:2016:MsgDataTypes":EVMaximumChargePower{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumChargePower{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumChargeCurrent,"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumVoltage,"urn:iso:15118:2:2016:MsgDataTypes":EVTargetEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMaximumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVMinimumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgDataTypes":CurrentSOC{0-1},"urn:iso:15118:2:2016:MsgDataTypes":TargetSOC{0-1},"urn:iso:15118:2:2016:MsgDataTypes":BulkSOC{0-1}))',  derivedBy='EXTENSION'.  */
 static int encode_iso2DC_EVChargeParameterType(bitstream_t* stream, struct iso2DC_EVChargeParameterType* iso2DC_EVChargeParameterType) {
+	int errn = 0;
 	int grammarID = 1947;
 	int done = 0;
 	
@@ -45416,7 +45827,9 @@ static int encode_iso2DC_EVChargeParameterType(bitstream_t* stream, struct iso2D
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,ServiceDetailReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":ServiceID)',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_ServiceDetailReq == SUPPORT_YES
 static int encode_iso2ServiceDetailReqType(bitstream_t* stream, struct iso2ServiceDetailReqType* iso2ServiceDetailReqType) {
+	int errn = 0;
 	int grammarID = 1959;
 	int done = 0;
 	
@@ -45463,9 +45876,12 @@ static int encode_iso2ServiceDetailReqType(bitstream_t* stream, struct iso2Servi
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_ServiceDetailReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,PreChargeReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":EVTargetVoltage,"urn:iso:15118:2:2016:MsgBody":EVTargetCurrent)',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_PreChargeReq == SUPPORT_YES
 static int encode_iso2PreChargeReqType(bitstream_t* stream, struct iso2PreChargeReqType* iso2PreChargeReqType) {
+	int errn = 0;
 	int grammarID = 1960;
 	int done = 0;
 	
@@ -45518,9 +45934,12 @@ static int encode_iso2PreChargeReqType(bitstream_t* stream, struct iso2PreCharge
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_PreChargeReq */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ManifestType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if ISO2_DEPLOY_Manifest == SUPPORT_YES
 static int encode_iso2ManifestType(bitstream_t* stream, struct iso2ManifestType* iso2ManifestType) {
+	int errn = 0;
 	int grammarID = 1962;
 	int done = 0;
 	
@@ -45533,11 +45952,8 @@ static int encode_iso2ManifestType(bitstream_t* stream, struct iso2ManifestType*
 			if ( iso2ManifestType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ManifestType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ManifestType->Id.characters, iso2ManifestType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 24 /* {}Id */, iso2ManifestType->Id.characters, iso2ManifestType->Id.charactersLen);
 				}
 				grammarID = 1963;
 			} else 			if (iso2ManifestType_Reference_currArrayIndex < iso2ManifestType->Reference.arrayLen ) {
@@ -45590,9 +46006,11 @@ static int encode_iso2ManifestType(bitstream_t* stream, struct iso2ManifestType*
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_Manifest */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDef,#AnonType_V2G_Message',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDef":Header,"urn:iso:15118:2:2016:MsgDef":Body)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2AnonType_V2G_Message(bitstream_t* stream, struct iso2AnonType_V2G_Message* iso2AnonType_V2G_Message) {
+	int errn = 0;
 	int grammarID = 1965;
 	int done = 0;
 	
@@ -45648,6 +46066,7 @@ static int encode_iso2AnonType_V2G_Message(bitstream_t* stream, struct iso2AnonT
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SelectedServiceListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":SelectedService{1-16})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SelectedServiceListType(bitstream_t* stream, struct iso2SelectedServiceListType* iso2SelectedServiceListType) {
+	int errn = 0;
 	int grammarID = 1967;
 	int done = 0;
 	
@@ -45962,6 +46381,7 @@ static int encode_iso2SelectedServiceListType(bitstream_t* stream, struct iso2Se
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,Generic_EVSEFinePositioningParametersType',  base type name='EVSEFinePositioningParametersType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":GenericParameters)',  derivedBy='EXTENSION'.  */
 static int encode_iso2Generic_EVSEFinePositioningParametersType(bitstream_t* stream, struct iso2Generic_EVSEFinePositioningParametersType* iso2Generic_EVSEFinePositioningParametersType) {
+	int errn = 0;
 	int grammarID = 1880;
 	int done = 0;
 	
@@ -46005,6 +46425,7 @@ static int encode_iso2Generic_EVSEFinePositioningParametersType(bitstream_t* str
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,CartesianCoordinatesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":XCoordinate,"urn:iso:15118:2:2016:MsgDataTypes":YCoordinate,"urn:iso:15118:2:2016:MsgDataTypes":ZCoordinate)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2CartesianCoordinatesType(bitstream_t* stream, struct iso2CartesianCoordinatesType* iso2CartesianCoordinatesType) {
+	int errn = 0;
 	int grammarID = 1983;
 	int done = 0;
 	
@@ -46090,6 +46511,7 @@ static int encode_iso2CartesianCoordinatesType(bitstream_t* stream, struct iso2C
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyInfoType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":KeyName|"http://www.w3.org/2000/09/xmldsig#":KeyValue|"http://www.w3.org/2000/09/xmldsig#":RetrievalMethod|"http://www.w3.org/2000/09/xmldsig#":X509Data|"http://www.w3.org/2000/09/xmldsig#":PGPData|"http://www.w3.org/2000/09/xmldsig#":SPKIData|"http://www.w3.org/2000/09/xmldsig#":MgmtData|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* iso2KeyInfoType) {
+	int errn = 0;
 	int grammarID = 1986;
 	int done = 0;
 	int wcDone = 0;
@@ -46109,11 +46531,8 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 			if ( iso2KeyInfoType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2KeyInfoType->Id.characters, iso2KeyInfoType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 24 /* {}Id */, iso2KeyInfoType->Id.characters, iso2KeyInfoType->Id.charactersLen);
 				}
 				grammarID = 1987;
 			} else 			if (iso2KeyInfoType_KeyName_currArrayIndex < iso2KeyInfoType->KeyName.arrayLen ) {
@@ -46122,10 +46541,9 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].characters, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].characters, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].charactersLen);
 							iso2KeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -46169,10 +46587,9 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].characters, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].characters, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							iso2KeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -46186,11 +46603,8 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 			} else 			if ( iso2KeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 9);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2KeyInfoType->ANY.characters, iso2KeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, iso2KeyInfoType->ANY.characters, iso2KeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1989;
@@ -46206,10 +46620,9 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].characters, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].characters, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].charactersLen);
 							iso2KeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -46253,10 +46666,9 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].characters, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].characters, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							iso2KeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -46270,11 +46682,8 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 			} else 			if ( iso2KeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 8);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2KeyInfoType->ANY.characters, iso2KeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, iso2KeyInfoType->ANY.characters, iso2KeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1989;
@@ -46290,10 +46699,9 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].characters, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].characters, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].charactersLen);
 							iso2KeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -46337,10 +46745,9 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].characters, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].characters, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							iso2KeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -46360,11 +46767,8 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 			} else 			if ( iso2KeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 9);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2KeyInfoType->ANY.characters, iso2KeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, iso2KeyInfoType->ANY.characters, iso2KeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1988;
@@ -46380,10 +46784,9 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].characters, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].characters, iso2KeyInfoType->KeyName.array[iso2KeyInfoType_KeyName_currArrayIndex].charactersLen);
 							iso2KeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -46427,10 +46830,9 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].characters, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].characters, iso2KeyInfoType->MgmtData.array[iso2KeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							iso2KeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -46444,11 +46846,8 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 			} else 			if ( iso2KeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 8);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2KeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2KeyInfoType->ANY.characters, iso2KeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, iso2KeyInfoType->ANY.characters, iso2KeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 1989;
@@ -46469,6 +46868,7 @@ static int encode_iso2KeyInfoType(bitstream_t* stream, struct iso2KeyInfoType* i
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SubCertificatesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":Certificate{1-4})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SubCertificatesType(bitstream_t* stream, struct iso2SubCertificatesType* iso2SubCertificatesType) {
+	int errn = 0;
 	int grammarID = 1990;
 	int done = 0;
 	
@@ -46607,6 +47007,7 @@ static int encode_iso2SubCertificatesType(bitstream_t* stream, struct iso2SubCer
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ListOfRootCertificateIDsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":RootCertificateID{1-20})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2ListOfRootCertificateIDsType(bitstream_t* stream, struct iso2ListOfRootCertificateIDsType* iso2ListOfRootCertificateIDsType) {
+	int errn = 0;
 	int grammarID = 1994;
 	int done = 0;
 	
@@ -46993,6 +47394,7 @@ static int encode_iso2ListOfRootCertificateIDsType(bitstream_t* stream, struct i
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,EVEnergyTransferParameterType',  base type name='anyType',  content type='ELEMENT',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":DepartureTime)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2EVEnergyTransferParameterType(bitstream_t* stream, struct iso2EVEnergyTransferParameterType* iso2EVEnergyTransferParameterType) {
+	int errn = 0;
 	int grammarID = 2014;
 	int done = 0;
 	
@@ -47042,6 +47444,7 @@ static int encode_iso2EVEnergyTransferParameterType(bitstream_t* stream, struct
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ContractSignatureEncryptedPrivateKeyType',  base type name='encryptedPrivateKeyType',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 static int encode_iso2ContractSignatureEncryptedPrivateKeyType(bitstream_t* stream, struct iso2ContractSignatureEncryptedPrivateKeyType* iso2ContractSignatureEncryptedPrivateKeyType) {
+	int errn = 0;
 	int grammarID = 2015;
 	int done = 0;
 	
@@ -47053,11 +47456,8 @@ static int encode_iso2ContractSignatureEncryptedPrivateKeyType(bitstream_t* stre
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2ContractSignatureEncryptedPrivateKeyType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2ContractSignatureEncryptedPrivateKeyType->Id.characters, iso2ContractSignatureEncryptedPrivateKeyType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 17 /* {urn:iso:15118:2:2016:MsgDataTypes}Id */, iso2ContractSignatureEncryptedPrivateKeyType->Id.characters, iso2ContractSignatureEncryptedPrivateKeyType->Id.charactersLen);
 				}
 				grammarID = 2016;
 			} else {
@@ -47104,6 +47504,7 @@ static int encode_iso2ContractSignatureEncryptedPrivateKeyType(bitstream_t* stre
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,MagneticVectorSetupListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":MagneticVectorSetup{1-255})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2MagneticVectorSetupListType(bitstream_t* stream, struct iso2MagneticVectorSetupListType* iso2MagneticVectorSetupListType) {
+	int errn = 0;
 	int grammarID = 2017;
 	int done = 0;
 	
@@ -51719,7 +52120,9 @@ static int encode_iso2MagneticVectorSetupListType(bitstream_t* stream, struct is
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,PairingReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":EVProcessing,"urn:iso:15118:2:2016:MsgBody":PairingParameters{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_PairingReq == SUPPORT_YES
 static int encode_iso2PairingReqType(bitstream_t* stream, struct iso2PairingReqType* iso2PairingReqType) {
+	int errn = 0;
 	int grammarID = 2272;
 	int done = 0;
 	
@@ -51784,9 +52187,12 @@ static int encode_iso2PairingReqType(bitstream_t* stream, struct iso2PairingReqT
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_PairingReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,CurrentDemandResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEPresentCurrent,"urn:iso:15118:2:2016:MsgBody":EVSEPresentVoltage,"urn:iso:15118:2:2016:MsgBody":EVSEPowerLimitAchieved,"urn:iso:15118:2:2016:MsgBody":EVSECurrentLimitAchieved,"urn:iso:15118:2:2016:MsgBody":EVSEVoltageLimitAchieved,"urn:iso:15118:2:2016:MsgBody":EVSEMaximumPower{0-1},"urn:iso:15118:2:2016:MsgBody":EVSEMaximumCurrent{0-1},"urn:iso:15118:2:2016:MsgBody":EVSEMaximumVoltage{0-1},"urn:iso:15118:2:2016:MsgBody":EVSEID,"urn:iso:15118:2:2016:MsgBody":SAScheduleTupleID{0-1},"urn:iso:15118:2:2016:MsgBody":MeterInfo{0-1},"urn:iso:15118:2:2016:MsgBody":ReceiptRequired{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_CurrentDemandRes == SUPPORT_YES
 static int encode_iso2CurrentDemandResType(bitstream_t* stream, struct iso2CurrentDemandResType* iso2CurrentDemandResType) {
+	int errn = 0;
 	int grammarID = 2273;
 	int done = 0;
 	
@@ -51933,11 +52339,8 @@ static int encode_iso2CurrentDemandResType(bitstream_t* stream, struct iso2Curre
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2CurrentDemandResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2CurrentDemandResType->EVSEID.characters, iso2CurrentDemandResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2CurrentDemandResType->EVSEID.characters, iso2CurrentDemandResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -51967,11 +52370,8 @@ static int encode_iso2CurrentDemandResType(bitstream_t* stream, struct iso2Curre
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2CurrentDemandResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2CurrentDemandResType->EVSEID.characters, iso2CurrentDemandResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2CurrentDemandResType->EVSEID.characters, iso2CurrentDemandResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -51995,11 +52395,8 @@ static int encode_iso2CurrentDemandResType(bitstream_t* stream, struct iso2Curre
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2CurrentDemandResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2CurrentDemandResType->EVSEID.characters, iso2CurrentDemandResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2CurrentDemandResType->EVSEID.characters, iso2CurrentDemandResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -52017,11 +52414,8 @@ static int encode_iso2CurrentDemandResType(bitstream_t* stream, struct iso2Curre
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2CurrentDemandResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2CurrentDemandResType->EVSEID.characters, iso2CurrentDemandResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2CurrentDemandResType->EVSEID.characters, iso2CurrentDemandResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -52048,7 +52442,11 @@ static int encode_iso2CurrentDemandResType(bitstream_t* stream, struct iso2Curre
 			} else 			if ( iso2CurrentDemandResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2MeterInfoType(stream, iso2CurrentDemandResType->MeterInfo );
+#else
 					errn = encode_iso2MeterInfoType(stream, &iso2CurrentDemandResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 30;
 			} else 			if ( iso2CurrentDemandResType->ReceiptRequired_isUsed == 1u ) {
@@ -52078,7 +52476,11 @@ static int encode_iso2CurrentDemandResType(bitstream_t* stream, struct iso2Curre
 			if ( iso2CurrentDemandResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2MeterInfoType(stream, iso2CurrentDemandResType->MeterInfo );
+#else
 					errn = encode_iso2MeterInfoType(stream, &iso2CurrentDemandResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 30;
 			} else 			if ( iso2CurrentDemandResType->ReceiptRequired_isUsed == 1u ) {
@@ -52149,9 +52551,11 @@ static int encode_iso2CurrentDemandResType(bitstream_t* stream, struct iso2Curre
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_CurrentDemandRes */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509IssuerSerialType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":X509IssuerName,"http://www.w3.org/2000/09/xmldsig#":X509SerialNumber)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2X509IssuerSerialType(bitstream_t* stream, struct iso2X509IssuerSerialType* iso2X509IssuerSerialType) {
+	int errn = 0;
 	int grammarID = 2283;
 	int done = 0;
 	
@@ -52166,11 +52570,8 @@ static int encode_iso2X509IssuerSerialType(bitstream_t* stream, struct iso2X509I
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2X509IssuerSerialType->X509IssuerName.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2X509IssuerSerialType->X509IssuerName.characters, iso2X509IssuerSerialType->X509IssuerName.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, iso2X509IssuerSerialType->X509IssuerName.characters, iso2X509IssuerSerialType->X509IssuerName.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -52222,7 +52623,9 @@ static int encode_iso2X509IssuerSerialType(bitstream_t* stream, struct iso2X509I
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,ChargingStatusReqType',  base type name='ChargeLoopReqType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":EVTargetEnergyRequest,"urn:iso:15118:2:2016:MsgBody":EVMaximumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgBody":EVMinimumEnergyRequest{0-1},"urn:iso:15118:2:2016:MsgBody":DisplayParameters{0-1}),("urn:iso:15118:2:2016:MsgBody":EVMaximumChargePower{0-1},"urn:iso:15118:2:2016:MsgBody":EVMaximumChargeCurrent{0-1},"urn:iso:15118:2:2016:MsgBody":EVMinimumChargeCurrent{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_ChargingStatusReq == SUPPORT_YES
 static int encode_iso2ChargingStatusReqType(bitstream_t* stream, struct iso2ChargingStatusReqType* iso2ChargingStatusReqType) {
+	int errn = 0;
 	int grammarID = 2285;
 	int done = 0;
 	
@@ -52461,9 +52864,12 @@ static int encode_iso2ChargingStatusReqType(bitstream_t* stream, struct iso2Char
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_ChargingStatusReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,CertificateInstallationResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":SAProvisioningCertificateChain,"urn:iso:15118:2:2016:MsgBody":ContractSignatureCertChain,"urn:iso:15118:2:2016:MsgBody":ContractSignatureEncryptedPrivateKey,"urn:iso:15118:2:2016:MsgBody":DHpublickey,"urn:iso:15118:2:2016:MsgBody":eMAID))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 static int encode_iso2CertificateInstallationResType(bitstream_t* stream, struct iso2CertificateInstallationResType* iso2CertificateInstallationResType) {
+	int errn = 0;
 	int grammarID = 2292;
 	int done = 0;
 	
@@ -52588,9 +52994,11 @@ static int encode_iso2CertificateInstallationResType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_CertificateInstallationRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SensorPackageType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":PackageIndex,"urn:iso:15118:2:2016:MsgDataTypes":SensorMeasurements{1-255})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SensorPackageType(bitstream_t* stream, struct iso2SensorPackageType* iso2SensorPackageType) {
+	int errn = 0;
 	int grammarID = 2299;
 	int done = 0;
 	
@@ -57225,6 +57633,7 @@ static int encode_iso2SensorPackageType(bitstream_t* stream, struct iso2SensorPa
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,PGPDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":PGPKeyID,"http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})|("http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED}))',  derivedBy='RESTRICTION'.  */
 static int encode_iso2PGPDataType(bitstream_t* stream, struct iso2PGPDataType* iso2PGPDataType) {
+	int errn = 0;
 	int grammarID = 2555;
 	int done = 0;
 	int wcDone = 0;
@@ -57325,7 +57734,9 @@ static int encode_iso2PGPDataType(bitstream_t* stream, struct iso2PGPDataType* i
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,ServiceDiscoveryResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":PaymentOptionList,"urn:iso:15118:2:2016:MsgBody":EnergyTransferServiceList,"urn:iso:15118:2:2016:MsgBody":VASList{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 static int encode_iso2ServiceDiscoveryResType(bitstream_t* stream, struct iso2ServiceDiscoveryResType* iso2ServiceDiscoveryResType) {
+	int errn = 0;
 	int grammarID = 2558;
 	int done = 0;
 	
@@ -57432,9 +57843,11 @@ static int encode_iso2ServiceDiscoveryResType(bitstream_t* stream, struct iso2Se
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_ServiceDiscoveryRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ServiceIDListType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":ServiceID{1-10})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2ServiceIDListType(bitstream_t* stream, struct iso2ServiceIDListType* iso2ServiceIDListType) {
+	int errn = 0;
 	int grammarID = 2563;
 	int done = 0;
 	
@@ -57701,6 +58114,7 @@ static int encode_iso2ServiceIDListType(bitstream_t* stream, struct iso2ServiceI
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,EVFinePositioningSetupParametersType',  base type name='anyType',  content type='EMPTY',  isAbstract='true',  hasTypeId='false',  final='0',  block='0',  derivedBy='RESTRICTION'.  */
 static int encode_iso2EVFinePositioningSetupParametersType(bitstream_t* stream, struct iso2EVFinePositioningSetupParametersType* iso2EVFinePositioningSetupParametersType) {
+	int errn = 0;
 	int grammarID = 674;
 	int done = 0;
 	
@@ -57731,7 +58145,9 @@ static int encode_iso2EVFinePositioningSetupParametersType(bitstream_t* stream,
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,ChargeParameterDiscoveryResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEProcessing,"urn:iso:15118:2:2016:MsgBody":SAScheduleList{0-1},"urn:iso:15118:2:2016:MsgDataTypes":EVSEEnergyTransferParameter))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 static int encode_iso2ChargeParameterDiscoveryResType(bitstream_t* stream, struct iso2ChargeParameterDiscoveryResType* iso2ChargeParameterDiscoveryResType) {
+	int errn = 0;
 	int grammarID = 2573;
 	int done = 0;
 	
@@ -57910,9 +58326,12 @@ static int encode_iso2ChargeParameterDiscoveryResType(bitstream_t* stream, struc
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,PowerDemandResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEOutputPower,"urn:iso:15118:2:2016:MsgBody":EVSEID,"urn:iso:15118:2:2016:MsgBody":SAScheduleTupleID{0-1},"urn:iso:15118:2:2016:MsgBody":MeterInfo{0-1},"urn:iso:15118:2:2016:MsgBody":ReceiptRequired{0-1},"urn:iso:15118:2:2016:MsgBody":PowerDemandParameters{0-1}))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_PowerDemandRes == SUPPORT_YES
 static int encode_iso2PowerDemandResType(bitstream_t* stream, struct iso2PowerDemandResType* iso2PowerDemandResType) {
+	int errn = 0;
 	int grammarID = 2578;
 	int done = 0;
 	
@@ -57975,11 +58394,8 @@ static int encode_iso2PowerDemandResType(bitstream_t* stream, struct iso2PowerDe
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2PowerDemandResType->EVSEID.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2PowerDemandResType->EVSEID.characters, iso2PowerDemandResType->EVSEID.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, iso2PowerDemandResType->EVSEID.characters, iso2PowerDemandResType->EVSEID.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -58006,7 +58422,11 @@ static int encode_iso2PowerDemandResType(bitstream_t* stream, struct iso2PowerDe
 			} else 			if ( iso2PowerDemandResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2MeterInfoType(stream, iso2PowerDemandResType->MeterInfo );
+#else
 					errn = encode_iso2MeterInfoType(stream, &iso2PowerDemandResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 2584;
 			} else 			if ( iso2PowerDemandResType->ReceiptRequired_isUsed == 1u ) {
@@ -58042,7 +58462,11 @@ static int encode_iso2PowerDemandResType(bitstream_t* stream, struct iso2PowerDe
 			if ( iso2PowerDemandResType->MeterInfo_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
+#if DATABINDING == DATABINDING_SLIM
+					errn = encode_iso2MeterInfoType(stream, iso2PowerDemandResType->MeterInfo );
+#else
 					errn = encode_iso2MeterInfoType(stream, &iso2PowerDemandResType->MeterInfo );
+#endif /* DATABINDING_SLIM */
 				}
 				grammarID = 2584;
 			} else 			if ( iso2PowerDemandResType->ReceiptRequired_isUsed == 1u ) {
@@ -58143,9 +58567,11 @@ static int encode_iso2PowerDemandResType(bitstream_t* stream, struct iso2PowerDe
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_PowerDemandRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,ChargingProfileType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":ProfileEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2ChargingProfileType(bitstream_t* stream, struct iso2ChargingProfileType* iso2ChargingProfileType) {
+	int errn = 0;
 	int grammarID = 2585;
 	int done = 0;
 	
@@ -58195,7 +58621,9 @@ static int encode_iso2ChargingProfileType(bitstream_t* stream, struct iso2Chargi
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,FinePositioningReqType',  base type name='BodyBaseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgBody":EVProcessing,"urn:iso:15118:2:2016:MsgDataTypes":EVFinePositioningParameters{0-1})',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_FinePositioningReq == SUPPORT_YES
 static int encode_iso2FinePositioningReqType(bitstream_t* stream, struct iso2FinePositioningReqType* iso2FinePositioningReqType) {
+	int errn = 0;
 	int grammarID = 2587;
 	int done = 0;
 	
@@ -58272,9 +58700,11 @@ static int encode_iso2FinePositioningReqType(bitstream_t* stream, struct iso2Fin
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_FinePositioningReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SalesTariffType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":SalesTariffID,"urn:iso:15118:2:2016:MsgDataTypes":SalesTariffDescription{0-1},"urn:iso:15118:2:2016:MsgDataTypes":NumEPriceLevels{0-1},"urn:iso:15118:2:2016:MsgDataTypes":SalesTariffEntry{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SalesTariffType(bitstream_t* stream, struct iso2SalesTariffType* iso2SalesTariffType) {
+	int errn = 0;
 	int grammarID = 2589;
 	int done = 0;
 	
@@ -58287,11 +58717,8 @@ static int encode_iso2SalesTariffType(bitstream_t* stream, struct iso2SalesTarif
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SalesTariffType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SalesTariffType->Id.characters, iso2SalesTariffType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 17 /* {urn:iso:15118:2:2016:MsgDataTypes}Id */, iso2SalesTariffType->Id.characters, iso2SalesTariffType->Id.charactersLen);
 				}
 				grammarID = 2590;
 			} else {
@@ -58324,11 +58751,8 @@ static int encode_iso2SalesTariffType(bitstream_t* stream, struct iso2SalesTarif
 					/* FirstStartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SalesTariffType->SalesTariffDescription.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, iso2SalesTariffType->SalesTariffDescription.characters, iso2SalesTariffType->SalesTariffDescription.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 20 /* {urn:iso:15118:2:2016:MsgDataTypes}SalesTariffDescription */, iso2SalesTariffType->SalesTariffDescription.characters, iso2SalesTariffType->SalesTariffDescription.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -58423,6 +58847,7 @@ static int encode_iso2SalesTariffType(bitstream_t* stream, struct iso2SalesTarif
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SensorType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":SensorID,"urn:iso:15118:2:2016:MsgDataTypes":SensorPosition,"urn:iso:15118:2:2016:MsgDataTypes":SensorOrientation)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SensorType(bitstream_t* stream, struct iso2SensorType* iso2SensorType) {
+	int errn = 0;
 	int grammarID = 2595;
 	int done = 0;
 	
@@ -58496,6 +58921,7 @@ static int encode_iso2SensorType(bitstream_t* stream, struct iso2SensorType* iso
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureValueType',  base type name='base64Binary',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 static int encode_iso2SignatureValueType(bitstream_t* stream, struct iso2SignatureValueType* iso2SignatureValueType) {
+	int errn = 0;
 	int grammarID = 2598;
 	int done = 0;
 	
@@ -58507,11 +58933,8 @@ static int encode_iso2SignatureValueType(bitstream_t* stream, struct iso2Signatu
 			if ( iso2SignatureValueType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignatureValueType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignatureValueType->Id.characters, iso2SignatureValueType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 24 /* {}Id */, iso2SignatureValueType->Id.characters, iso2SignatureValueType->Id.charactersLen);
 				}
 				grammarID = 2016;
 			} else 			if (1==1) {
@@ -58567,6 +58990,7 @@ static int encode_iso2SignatureValueType(bitstream_t* stream, struct iso2Signatu
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignedInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":CanonicalizationMethod,"http://www.w3.org/2000/09/xmldsig#":SignatureMethod,"http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SignedInfoType(bitstream_t* stream, struct iso2SignedInfoType* iso2SignedInfoType) {
+	int errn = 0;
 	int grammarID = 2599;
 	int done = 0;
 	
@@ -58579,11 +59003,8 @@ static int encode_iso2SignedInfoType(bitstream_t* stream, struct iso2SignedInfoT
 			if ( iso2SignedInfoType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2SignedInfoType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2SignedInfoType->Id.characters, iso2SignedInfoType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 24 /* {}Id */, iso2SignedInfoType->Id.characters, iso2SignedInfoType->Id.charactersLen);
 				}
 				grammarID = 2600;
 			} else 			if ( 1 == 1 ) {
@@ -58662,7 +59083,9 @@ static int encode_iso2SignedInfoType(bitstream_t* stream, struct iso2SignedInfoT
 }
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,PowerDeliveryResType',  base type name='V2GResponseType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("urn:iso:15118:2:2016:MsgBody":ResponseCode,"urn:iso:15118:2:2016:MsgBody":EVSEStatus{0-1}),("urn:iso:15118:2:2016:MsgBody":EVSEProcessing))',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 static int encode_iso2PowerDeliveryResType(bitstream_t* stream, struct iso2PowerDeliveryResType* iso2PowerDeliveryResType) {
+	int errn = 0;
 	int grammarID = 5;
 	int done = 0;
 	
@@ -58751,9 +59174,12 @@ static int encode_iso2PowerDeliveryResType(bitstream_t* stream, struct iso2Power
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_PowerDeliveryRes */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgBody,CableCheckReqType',  base type name='BodyBaseType',  content type='EMPTY',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if ISO2_DEPLOY_CableCheckReq == SUPPORT_YES
 static int encode_iso2CableCheckReqType(bitstream_t* stream, struct iso2CableCheckReqType* iso2CableCheckReqType) {
+	int errn = 0;
 	int grammarID = 674;
 	int done = 0;
 	
@@ -58782,9 +59208,11 @@ static int encode_iso2CableCheckReqType(bitstream_t* stream, struct iso2CableChe
 	}
 	return errn;
 }
+#endif /* ISO2_DEPLOY_CableCheckReq */
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,SelectedServiceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":ServiceID,"urn:iso:15118:2:2016:MsgDataTypes":ParameterSetID)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2SelectedServiceType(bitstream_t* stream, struct iso2SelectedServiceType* iso2SelectedServiceType) {
+	int errn = 0;
 	int grammarID = 2603;
 	int done = 0;
 	
@@ -58852,6 +59280,7 @@ static int encode_iso2SelectedServiceType(bitstream_t* stream, struct iso2Select
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,DiffieHellmanPublickeyType',  base type name='dHpublickeyType',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 static int encode_iso2DiffieHellmanPublickeyType(bitstream_t* stream, struct iso2DiffieHellmanPublickeyType* iso2DiffieHellmanPublickeyType) {
+	int errn = 0;
 	int grammarID = 2015;
 	int done = 0;
 	
@@ -58863,11 +59292,8 @@ static int encode_iso2DiffieHellmanPublickeyType(bitstream_t* stream, struct iso
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(iso2DiffieHellmanPublickeyType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, iso2DiffieHellmanPublickeyType->Id.characters, iso2DiffieHellmanPublickeyType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 17 /* {urn:iso:15118:2:2016:MsgDataTypes}Id */, iso2DiffieHellmanPublickeyType->Id.characters, iso2DiffieHellmanPublickeyType->Id.charactersLen);
 				}
 				grammarID = 2016;
 			} else {
@@ -58914,6 +59340,7 @@ static int encode_iso2DiffieHellmanPublickeyType(bitstream_t* stream, struct iso
 
 /* Complex type name='urn:iso:15118:2:2016:MsgDataTypes,EVSEStatusType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("urn:iso:15118:2:2016:MsgDataTypes":NotificationMaxDelay,"urn:iso:15118:2:2016:MsgDataTypes":EVSENotification)',  derivedBy='RESTRICTION'.  */
 static int encode_iso2EVSEStatusType(bitstream_t* stream, struct iso2EVSEStatusType* iso2EVSEStatusType) {
+	int errn = 0;
 	int grammarID = 2605;
 	int done = 0;
 	
@@ -58982,214 +59409,351 @@ static int encode_iso2EVSEStatusType(bitstream_t* stream, struct iso2EVSEStatusT
 
 
 int encode_iso2ExiDocument(bitstream_t* stream, struct iso2EXIDocument* exiDoc) {
+	int errn = 0;
 	errn = writeEXIHeader(stream);
 
 	if(errn == 0) {
 		/* DocContent[START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AC_BidirectionalControlReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AC_BidirectionalControlRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVBidirectionalParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVSEBidirectionalParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AlignmentCheckReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AlignmentCheckRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AuthorizationReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AuthorizationRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}BodyElement), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CableCheckReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CableCheckRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateInstallationReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateInstallationRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateUpdateReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateUpdateRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargeParameterDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargeParameterDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargingStatusReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargingStatusRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ConnectChargingDeviceReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ConnectChargingDeviceRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CurrentDemandReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CurrentDemandRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DC_BidirectionalControlReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DC_BidirectionalControlRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVBidirectionalParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVSEBidirectionalParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVSEChargeParameter), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DisconnectChargingDeviceReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DisconnectChargingDeviceRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVEnergyTransferParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVFinePositioningParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVFinePositioningSetupParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEEnergyTransferParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEFinePositioningParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEFinePositioningSetupParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningSetupReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningSetupRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Generic_EVFinePositioningParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Generic_EVSEFinePositioningParameters), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVFinePositioningParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVFinePositioningSetupParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVSEFinePositioningParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVSEFinePositioningSetupParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MV_EVSEFinePositioningParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MV_EVSEFinePositioningSetupParameters), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MeteringReceiptReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MeteringReceiptRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}PMaxScheduleEntry), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PairingReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PairingRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentDetailsReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentDetailsRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentServiceSelectionReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentServiceSelectionRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDeliveryReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDeliveryRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDemandReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDemandRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PreChargeReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PreChargeRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}RelativeTimeInterval), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SAScheduleList), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SalesTariffEntry), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDetailReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDetailRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionSetupReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionSetupRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionStopReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionStopRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SystemStatusReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SystemStatusRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}V2GRequest), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}V2GResponse), START_ELEMENT({urn:iso:15118:2:2016:MsgDef}V2G_Message), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckInReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckInRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckOutReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckOutRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}WPT_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}WPT_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}WeldingDetectionReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}WeldingDetectionRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data), START_ELEMENT_GENERIC] */
 		if ( exiDoc->AC_BidirectionalControlReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AC_BidirectionalControlReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AC_BidirectionalControlReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 0);
 			if(errn == 0) {
 				errn = encode_iso2AC_BidirectionalControlReqType(stream, &exiDoc->AC_BidirectionalControlReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlReq */
 		} else if ( exiDoc->AC_BidirectionalControlRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AC_BidirectionalControlRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AC_BidirectionalControlRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 1);
 			if(errn == 0) {
 				errn = encode_iso2AC_BidirectionalControlResType(stream, &exiDoc->AC_BidirectionalControlRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlRes */
 		} else if ( exiDoc->AC_EVBidirectionalParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AC_EVBidirectionalParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVBidirectionalParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 2);
 			if(errn == 0) {
 				errn = encode_iso2AC_EVBidirectionalParameterType(stream, &exiDoc->AC_EVBidirectionalParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_EVBidirectionalParameter */
 		} else if ( exiDoc->AC_EVChargeParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AC_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 3);
 			if(errn == 0) {
 				errn = encode_iso2AC_EVChargeParameterType(stream, &exiDoc->AC_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_EVChargeParameter */
 		} else if ( exiDoc->AC_EVSEBidirectionalParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AC_EVSEBidirectionalParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVSEBidirectionalParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 4);
 			if(errn == 0) {
 				errn = encode_iso2AC_EVSEBidirectionalParameterType(stream, &exiDoc->AC_EVSEBidirectionalParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_EVSEBidirectionalParameter */
 		} else if ( exiDoc->AC_EVSEChargeParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AC_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 5);
 			if(errn == 0) {
 				errn = encode_iso2AC_EVSEChargeParameterType(stream, &exiDoc->AC_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_EVSEChargeParameter */
 		} else if ( exiDoc->AlignmentCheckReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AlignmentCheckReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AlignmentCheckReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 6);
 			if(errn == 0) {
 				errn = encode_iso2AlignmentCheckReqType(stream, &exiDoc->AlignmentCheckReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AlignmentCheckReq */
 		} else if ( exiDoc->AlignmentCheckRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AlignmentCheckRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AlignmentCheckRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 7);
 			if(errn == 0) {
 				errn = encode_iso2AlignmentCheckResType(stream, &exiDoc->AlignmentCheckRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AlignmentCheckRes */
 		} else if ( exiDoc->AuthorizationReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AuthorizationReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AuthorizationReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 8);
 			if(errn == 0) {
 				errn = encode_iso2AuthorizationReqType(stream, &exiDoc->AuthorizationReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AuthorizationReq */
 		} else if ( exiDoc->AuthorizationRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AuthorizationRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AuthorizationRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 9);
 			if(errn == 0) {
 				errn = encode_iso2AuthorizationResType(stream, &exiDoc->AuthorizationRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AuthorizationRes */
 		} else if ( exiDoc->BodyElement_isUsed == 1u ) { 
+#if ISO2_DEPLOY_BodyElement == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}BodyElement) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 10);
 			if(errn == 0) {
 				errn = encode_iso2BodyBaseType(stream, &exiDoc->BodyElement );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_BodyElement */
 		} else if ( exiDoc->CableCheckReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CableCheckReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CableCheckReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 11);
 			if(errn == 0) {
 				errn = encode_iso2CableCheckReqType(stream, &exiDoc->CableCheckReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CableCheckReq */
 		} else if ( exiDoc->CableCheckRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CableCheckRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CableCheckRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 12);
 			if(errn == 0) {
 				errn = encode_iso2CableCheckResType(stream, &exiDoc->CableCheckRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CableCheckRes */
 		} else if ( exiDoc->CanonicalizationMethod_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CanonicalizationMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 13);
 			if(errn == 0) {
 				errn = encode_iso2CanonicalizationMethodType(stream, &exiDoc->CanonicalizationMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CanonicalizationMethod */
 		} else if ( exiDoc->CertificateInstallationReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateInstallationReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 14);
 			if(errn == 0) {
 				errn = encode_iso2CertificateInstallationReqType(stream, &exiDoc->CertificateInstallationReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CertificateInstallationReq */
 		} else if ( exiDoc->CertificateInstallationRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateInstallationRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 15);
 			if(errn == 0) {
 				errn = encode_iso2CertificateInstallationResType(stream, &exiDoc->CertificateInstallationRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CertificateInstallationRes */
 		} else if ( exiDoc->CertificateUpdateReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateUpdateReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 16);
 			if(errn == 0) {
 				errn = encode_iso2CertificateUpdateReqType(stream, &exiDoc->CertificateUpdateReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CertificateUpdateReq */
 		} else if ( exiDoc->CertificateUpdateRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateUpdateRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 17);
 			if(errn == 0) {
 				errn = encode_iso2CertificateUpdateResType(stream, &exiDoc->CertificateUpdateRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CertificateUpdateRes */
 		} else if ( exiDoc->ChargeParameterDiscoveryReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargeParameterDiscoveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 18);
 			if(errn == 0) {
 				errn = encode_iso2ChargeParameterDiscoveryReqType(stream, &exiDoc->ChargeParameterDiscoveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryReq */
 		} else if ( exiDoc->ChargeParameterDiscoveryRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargeParameterDiscoveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 19);
 			if(errn == 0) {
 				errn = encode_iso2ChargeParameterDiscoveryResType(stream, &exiDoc->ChargeParameterDiscoveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryRes */
 		} else if ( exiDoc->ChargingStatusReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ChargingStatusReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargingStatusReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 20);
 			if(errn == 0) {
 				errn = encode_iso2ChargingStatusReqType(stream, &exiDoc->ChargingStatusReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ChargingStatusReq */
 		} else if ( exiDoc->ChargingStatusRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ChargingStatusRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargingStatusRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 21);
 			if(errn == 0) {
 				errn = encode_iso2ChargingStatusResType(stream, &exiDoc->ChargingStatusRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ChargingStatusRes */
 		} else if ( exiDoc->ConnectChargingDeviceReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ConnectChargingDeviceReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ConnectChargingDeviceReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 22);
 			if(errn == 0) {
 				errn = encode_iso2ConnectChargingDeviceReqType(stream, &exiDoc->ConnectChargingDeviceReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceReq */
 		} else if ( exiDoc->ConnectChargingDeviceRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ConnectChargingDeviceRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ConnectChargingDeviceRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 23);
 			if(errn == 0) {
 				errn = encode_iso2ConnectChargingDeviceResType(stream, &exiDoc->ConnectChargingDeviceRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceRes */
 		} else if ( exiDoc->CurrentDemandReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CurrentDemandReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CurrentDemandReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 24);
 			if(errn == 0) {
 				errn = encode_iso2CurrentDemandReqType(stream, &exiDoc->CurrentDemandReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CurrentDemandReq */
 		} else if ( exiDoc->CurrentDemandRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CurrentDemandRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CurrentDemandRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 25);
 			if(errn == 0) {
 				errn = encode_iso2CurrentDemandResType(stream, &exiDoc->CurrentDemandRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CurrentDemandRes */
 		} else if ( exiDoc->DC_BidirectionalControlReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DC_BidirectionalControlReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DC_BidirectionalControlReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 26);
 			if(errn == 0) {
 				errn = encode_iso2DC_BidirectionalControlReqType(stream, &exiDoc->DC_BidirectionalControlReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlReq */
 		} else if ( exiDoc->DC_BidirectionalControlRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DC_BidirectionalControlRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DC_BidirectionalControlRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 27);
 			if(errn == 0) {
 				errn = encode_iso2DC_BidirectionalControlResType(stream, &exiDoc->DC_BidirectionalControlRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlRes */
 		} else if ( exiDoc->DC_EVBidirectionalParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DC_EVBidirectionalParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVBidirectionalParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 28);
 			if(errn == 0) {
 				errn = encode_iso2DC_EVBidirectionalParameterType(stream, &exiDoc->DC_EVBidirectionalParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_EVBidirectionalParameter */
 		} else if ( exiDoc->DC_EVChargeParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DC_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 29);
 			if(errn == 0) {
 				errn = encode_iso2DC_EVChargeParameterType(stream, &exiDoc->DC_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_EVChargeParameter */
 		} else if ( exiDoc->DC_EVSEBidirectionalParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DC_EVSEBidirectionalParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVSEBidirectionalParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 30);
 			if(errn == 0) {
 				errn = encode_iso2DC_EVSEBidirectionalParameterType(stream, &exiDoc->DC_EVSEBidirectionalParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_EVSEBidirectionalParameter */
 		} else if ( exiDoc->DC_EVSEChargeParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DC_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 31);
 			if(errn == 0) {
 				errn = encode_iso2DC_EVSEChargeParameterType(stream, &exiDoc->DC_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_EVSEChargeParameter */
 		} else if ( exiDoc->DSAKeyValue_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DSAKeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 32);
 			if(errn == 0) {
 				errn = encode_iso2DSAKeyValueType(stream, &exiDoc->DSAKeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DSAKeyValue */
 		} else if ( exiDoc->DigestMethod_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DigestMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 33);
 			if(errn == 0) {
 				errn = encode_iso2DigestMethodType(stream, &exiDoc->DigestMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DigestMethod */
 		} else if ( exiDoc->DigestValue_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 34);
@@ -59206,95 +59770,155 @@ int encode_iso2ExiDocument(bitstream_t* stream, struct iso2EXIDocument* exiDoc)
 				}
 			}
 		} else if ( exiDoc->DisconnectChargingDeviceReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DisconnectChargingDeviceReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DisconnectChargingDeviceReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 35);
 			if(errn == 0) {
 				errn = encode_iso2DisconnectChargingDeviceReqType(stream, &exiDoc->DisconnectChargingDeviceReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceReq */
 		} else if ( exiDoc->DisconnectChargingDeviceRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DisconnectChargingDeviceRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DisconnectChargingDeviceRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 36);
 			if(errn == 0) {
 				errn = encode_iso2DisconnectChargingDeviceResType(stream, &exiDoc->DisconnectChargingDeviceRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceRes */
 		} else if ( exiDoc->EVEnergyTransferParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_EVEnergyTransferParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVEnergyTransferParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 37);
 			if(errn == 0) {
 				errn = encode_iso2EVEnergyTransferParameterType(stream, &exiDoc->EVEnergyTransferParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_EVEnergyTransferParameter */
 		} else if ( exiDoc->EVFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_EVFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 38);
 			if(errn == 0) {
 				errn = encode_iso2EVFinePositioningParametersType(stream, &exiDoc->EVFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_EVFinePositioningParameters */
 		} else if ( exiDoc->EVFinePositioningSetupParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_EVFinePositioningSetupParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVFinePositioningSetupParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 39);
 			if(errn == 0) {
 				errn = encode_iso2EVFinePositioningSetupParametersType(stream, &exiDoc->EVFinePositioningSetupParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_EVFinePositioningSetupParameters */
 		} else if ( exiDoc->EVSEEnergyTransferParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_EVSEEnergyTransferParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEEnergyTransferParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 40);
 			if(errn == 0) {
 				errn = encode_iso2EVSEEnergyTransferParameterType(stream, &exiDoc->EVSEEnergyTransferParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_EVSEEnergyTransferParameter */
 		} else if ( exiDoc->EVSEFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_EVSEFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 41);
 			if(errn == 0) {
 				errn = encode_iso2EVSEFinePositioningParametersType(stream, &exiDoc->EVSEFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_EVSEFinePositioningParameters */
 		} else if ( exiDoc->EVSEFinePositioningSetupParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_EVSEFinePositioningSetupParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEFinePositioningSetupParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 42);
 			if(errn == 0) {
 				errn = encode_iso2EVSEFinePositioningSetupParametersType(stream, &exiDoc->EVSEFinePositioningSetupParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_EVSEFinePositioningSetupParameters */
 		} else if ( exiDoc->FinePositioningReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_FinePositioningReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 43);
 			if(errn == 0) {
 				errn = encode_iso2FinePositioningReqType(stream, &exiDoc->FinePositioningReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_FinePositioningReq */
 		} else if ( exiDoc->FinePositioningRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_FinePositioningRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 44);
 			if(errn == 0) {
 				errn = encode_iso2FinePositioningResType(stream, &exiDoc->FinePositioningRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_FinePositioningRes */
 		} else if ( exiDoc->FinePositioningSetupReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_FinePositioningSetupReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningSetupReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 45);
 			if(errn == 0) {
 				errn = encode_iso2FinePositioningSetupReqType(stream, &exiDoc->FinePositioningSetupReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_FinePositioningSetupReq */
 		} else if ( exiDoc->FinePositioningSetupRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_FinePositioningSetupRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningSetupRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 46);
 			if(errn == 0) {
 				errn = encode_iso2FinePositioningSetupResType(stream, &exiDoc->FinePositioningSetupRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_FinePositioningSetupRes */
 		} else if ( exiDoc->Generic_EVFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Generic_EVFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Generic_EVFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 47);
 			if(errn == 0) {
 				errn = encode_iso2Generic_EVFinePositioningParametersType(stream, &exiDoc->Generic_EVFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Generic_EVFinePositioningParameters */
 		} else if ( exiDoc->Generic_EVSEFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Generic_EVSEFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Generic_EVSEFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 48);
 			if(errn == 0) {
 				errn = encode_iso2Generic_EVSEFinePositioningParametersType(stream, &exiDoc->Generic_EVSEFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Generic_EVSEFinePositioningParameters */
 		} else if ( exiDoc->KeyInfo_isUsed == 1u ) { 
+#if ISO2_DEPLOY_KeyInfo == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 49);
 			if(errn == 0) {
 				errn = encode_iso2KeyInfoType(stream, &exiDoc->KeyInfo );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_KeyInfo */
 		} else if ( exiDoc->KeyName_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 50);
@@ -59302,75 +59926,112 @@ int encode_iso2ExiDocument(bitstream_t* stream, struct iso2EXIDocument* exiDoc)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiDoc->KeyName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiDoc->KeyName.characters, exiDoc->KeyName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiDoc->KeyName.characters, exiDoc->KeyName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiDoc->KeyValue_isUsed == 1u ) { 
+#if ISO2_DEPLOY_KeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 51);
 			if(errn == 0) {
 				errn = encode_iso2KeyValueType(stream, &exiDoc->KeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_KeyValue */
 		} else if ( exiDoc->LFA_EVFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_LFA_EVFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 52);
 			if(errn == 0) {
 				errn = encode_iso2LFA_EVFinePositioningParametersType(stream, &exiDoc->LFA_EVFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_LFA_EVFinePositioningParameters */
 		} else if ( exiDoc->LFA_EVFinePositioningSetupParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_LFA_EVFinePositioningSetupParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVFinePositioningSetupParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 53);
 			if(errn == 0) {
 				errn = encode_iso2LFA_EVFinePositioningSetupParametersType(stream, &exiDoc->LFA_EVFinePositioningSetupParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_LFA_EVFinePositioningSetupParameters */
 		} else if ( exiDoc->LFA_EVSEFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_LFA_EVSEFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVSEFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 54);
 			if(errn == 0) {
 				errn = encode_iso2LFA_EVSEFinePositioningParametersType(stream, &exiDoc->LFA_EVSEFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_LFA_EVSEFinePositioningParameters */
 		} else if ( exiDoc->LFA_EVSEFinePositioningSetupParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_LFA_EVSEFinePositioningSetupParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVSEFinePositioningSetupParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 55);
 			if(errn == 0) {
 				errn = encode_iso2LFA_EVSEFinePositioningSetupParametersType(stream, &exiDoc->LFA_EVSEFinePositioningSetupParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_LFA_EVSEFinePositioningSetupParameters */
 		} else if ( exiDoc->MV_EVSEFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_MV_EVSEFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MV_EVSEFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 56);
 			if(errn == 0) {
 				errn = encode_iso2MV_EVSEFinePositioningParametersType(stream, &exiDoc->MV_EVSEFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_MV_EVSEFinePositioningParameters */
 		} else if ( exiDoc->MV_EVSEFinePositioningSetupParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_MV_EVSEFinePositioningSetupParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MV_EVSEFinePositioningSetupParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 57);
 			if(errn == 0) {
 				errn = encode_iso2MV_EVSEFinePositioningSetupParametersType(stream, &exiDoc->MV_EVSEFinePositioningSetupParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_MV_EVSEFinePositioningSetupParameters */
 		} else if ( exiDoc->Manifest_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Manifest == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 58);
 			if(errn == 0) {
 				errn = encode_iso2ManifestType(stream, &exiDoc->Manifest );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Manifest */
 		} else if ( exiDoc->MeteringReceiptReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MeteringReceiptReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 59);
 			if(errn == 0) {
 				errn = encode_iso2MeteringReceiptReqType(stream, &exiDoc->MeteringReceiptReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_MeteringReceiptReq */
 		} else if ( exiDoc->MeteringReceiptRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MeteringReceiptRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 60);
 			if(errn == 0) {
 				errn = encode_iso2MeteringReceiptResType(stream, &exiDoc->MeteringReceiptRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_MeteringReceiptRes */
 		} else if ( exiDoc->MgmtData_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 61);
@@ -59378,327 +60039,532 @@ int encode_iso2ExiDocument(bitstream_t* stream, struct iso2EXIDocument* exiDoc)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiDoc->MgmtData.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiDoc->MgmtData.characters, exiDoc->MgmtData.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiDoc->MgmtData.characters, exiDoc->MgmtData.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiDoc->Object_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Object == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 62);
 			if(errn == 0) {
 				errn = encode_iso2ObjectType(stream, &exiDoc->Object );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Object */
 		} else if ( exiDoc->PGPData_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PGPData == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 63);
 			if(errn == 0) {
 				errn = encode_iso2PGPDataType(stream, &exiDoc->PGPData );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PGPData */
 		} else if ( exiDoc->PMaxScheduleEntry_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PMaxScheduleEntry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}PMaxScheduleEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 64);
 			if(errn == 0) {
 				errn = encode_iso2PMaxScheduleEntryType(stream, &exiDoc->PMaxScheduleEntry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PMaxScheduleEntry */
 		} else if ( exiDoc->PairingReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PairingReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PairingReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 65);
 			if(errn == 0) {
 				errn = encode_iso2PairingReqType(stream, &exiDoc->PairingReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PairingReq */
 		} else if ( exiDoc->PairingRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PairingRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PairingRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 66);
 			if(errn == 0) {
 				errn = encode_iso2PairingResType(stream, &exiDoc->PairingRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PairingRes */
 		} else if ( exiDoc->PaymentDetailsReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentDetailsReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 67);
 			if(errn == 0) {
 				errn = encode_iso2PaymentDetailsReqType(stream, &exiDoc->PaymentDetailsReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PaymentDetailsReq */
 		} else if ( exiDoc->PaymentDetailsRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentDetailsRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 68);
 			if(errn == 0) {
 				errn = encode_iso2PaymentDetailsResType(stream, &exiDoc->PaymentDetailsRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PaymentDetailsRes */
 		} else if ( exiDoc->PaymentServiceSelectionReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentServiceSelectionReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 69);
 			if(errn == 0) {
 				errn = encode_iso2PaymentServiceSelectionReqType(stream, &exiDoc->PaymentServiceSelectionReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionReq */
 		} else if ( exiDoc->PaymentServiceSelectionRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentServiceSelectionRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 70);
 			if(errn == 0) {
 				errn = encode_iso2PaymentServiceSelectionResType(stream, &exiDoc->PaymentServiceSelectionRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionRes */
 		} else if ( exiDoc->PowerDeliveryReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDeliveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 71);
 			if(errn == 0) {
 				errn = encode_iso2PowerDeliveryReqType(stream, &exiDoc->PowerDeliveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PowerDeliveryReq */
 		} else if ( exiDoc->PowerDeliveryRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDeliveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 72);
 			if(errn == 0) {
 				errn = encode_iso2PowerDeliveryResType(stream, &exiDoc->PowerDeliveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PowerDeliveryRes */
 		} else if ( exiDoc->PowerDemandReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PowerDemandReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDemandReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 73);
 			if(errn == 0) {
 				errn = encode_iso2PowerDemandReqType(stream, &exiDoc->PowerDemandReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PowerDemandReq */
 		} else if ( exiDoc->PowerDemandRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PowerDemandRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDemandRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 74);
 			if(errn == 0) {
 				errn = encode_iso2PowerDemandResType(stream, &exiDoc->PowerDemandRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PowerDemandRes */
 		} else if ( exiDoc->PreChargeReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PreChargeReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PreChargeReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 75);
 			if(errn == 0) {
 				errn = encode_iso2PreChargeReqType(stream, &exiDoc->PreChargeReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PreChargeReq */
 		} else if ( exiDoc->PreChargeRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PreChargeRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PreChargeRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 76);
 			if(errn == 0) {
 				errn = encode_iso2PreChargeResType(stream, &exiDoc->PreChargeRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PreChargeRes */
 		} else if ( exiDoc->RSAKeyValue_isUsed == 1u ) { 
+#if ISO2_DEPLOY_RSAKeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 77);
 			if(errn == 0) {
 				errn = encode_iso2RSAKeyValueType(stream, &exiDoc->RSAKeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_RSAKeyValue */
 		} else if ( exiDoc->Reference_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Reference == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 78);
 			if(errn == 0) {
 				errn = encode_iso2ReferenceType(stream, &exiDoc->Reference );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Reference */
 		} else if ( exiDoc->RelativeTimeInterval_isUsed == 1u ) { 
+#if ISO2_DEPLOY_RelativeTimeInterval == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}RelativeTimeInterval) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 79);
 			if(errn == 0) {
 				errn = encode_iso2RelativeTimeIntervalType(stream, &exiDoc->RelativeTimeInterval );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_RelativeTimeInterval */
 		} else if ( exiDoc->RetrievalMethod_isUsed == 1u ) { 
+#if ISO2_DEPLOY_RetrievalMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 80);
 			if(errn == 0) {
 				errn = encode_iso2RetrievalMethodType(stream, &exiDoc->RetrievalMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_RetrievalMethod */
 		} else if ( exiDoc->SAScheduleList_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SAScheduleList == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SAScheduleList) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 81);
 			if(errn == 0) {
 				errn = encode_iso2SAScheduleListType(stream, &exiDoc->SAScheduleList );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SAScheduleList */
 		} else if ( exiDoc->SPKIData_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SPKIData == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 82);
 			if(errn == 0) {
 				errn = encode_iso2SPKIDataType(stream, &exiDoc->SPKIData );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SPKIData */
 		} else if ( exiDoc->SalesTariffEntry_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SalesTariffEntry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SalesTariffEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 83);
 			if(errn == 0) {
 				errn = encode_iso2SalesTariffEntryType(stream, &exiDoc->SalesTariffEntry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SalesTariffEntry */
 		} else if ( exiDoc->ServiceDetailReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ServiceDetailReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDetailReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 84);
 			if(errn == 0) {
 				errn = encode_iso2ServiceDetailReqType(stream, &exiDoc->ServiceDetailReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ServiceDetailReq */
 		} else if ( exiDoc->ServiceDetailRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ServiceDetailRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDetailRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 85);
 			if(errn == 0) {
 				errn = encode_iso2ServiceDetailResType(stream, &exiDoc->ServiceDetailRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ServiceDetailRes */
 		} else if ( exiDoc->ServiceDiscoveryReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDiscoveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 86);
 			if(errn == 0) {
 				errn = encode_iso2ServiceDiscoveryReqType(stream, &exiDoc->ServiceDiscoveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ServiceDiscoveryReq */
 		} else if ( exiDoc->ServiceDiscoveryRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDiscoveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 87);
 			if(errn == 0) {
 				errn = encode_iso2ServiceDiscoveryResType(stream, &exiDoc->ServiceDiscoveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ServiceDiscoveryRes */
 		} else if ( exiDoc->SessionSetupReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SessionSetupReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionSetupReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 88);
 			if(errn == 0) {
 				errn = encode_iso2SessionSetupReqType(stream, &exiDoc->SessionSetupReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SessionSetupReq */
 		} else if ( exiDoc->SessionSetupRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SessionSetupRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionSetupRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 89);
 			if(errn == 0) {
 				errn = encode_iso2SessionSetupResType(stream, &exiDoc->SessionSetupRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SessionSetupRes */
 		} else if ( exiDoc->SessionStopReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SessionStopReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionStopReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 90);
 			if(errn == 0) {
 				errn = encode_iso2SessionStopReqType(stream, &exiDoc->SessionStopReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SessionStopReq */
 		} else if ( exiDoc->SessionStopRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SessionStopRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionStopRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 91);
 			if(errn == 0) {
 				errn = encode_iso2SessionStopResType(stream, &exiDoc->SessionStopRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SessionStopRes */
 		} else if ( exiDoc->Signature_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Signature == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 92);
 			if(errn == 0) {
 				errn = encode_iso2SignatureType(stream, &exiDoc->Signature );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Signature */
 		} else if ( exiDoc->SignatureMethod_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SignatureMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 93);
 			if(errn == 0) {
 				errn = encode_iso2SignatureMethodType(stream, &exiDoc->SignatureMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SignatureMethod */
 		} else if ( exiDoc->SignatureProperties_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SignatureProperties == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 94);
 			if(errn == 0) {
 				errn = encode_iso2SignaturePropertiesType(stream, &exiDoc->SignatureProperties );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SignatureProperties */
 		} else if ( exiDoc->SignatureProperty_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SignatureProperty == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 95);
 			if(errn == 0) {
 				errn = encode_iso2SignaturePropertyType(stream, &exiDoc->SignatureProperty );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SignatureProperty */
 		} else if ( exiDoc->SignatureValue_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SignatureValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 96);
 			if(errn == 0) {
 				errn = encode_iso2SignatureValueType(stream, &exiDoc->SignatureValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SignatureValue */
 		} else if ( exiDoc->SignedInfo_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SignedInfo == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 97);
 			if(errn == 0) {
 				errn = encode_iso2SignedInfoType(stream, &exiDoc->SignedInfo );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SignedInfo */
 		} else if ( exiDoc->SystemStatusReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SystemStatusReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SystemStatusReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 98);
 			if(errn == 0) {
 				errn = encode_iso2SystemStatusReqType(stream, &exiDoc->SystemStatusReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SystemStatusReq */
 		} else if ( exiDoc->SystemStatusRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SystemStatusRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SystemStatusRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 99);
 			if(errn == 0) {
 				errn = encode_iso2SystemStatusResType(stream, &exiDoc->SystemStatusRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SystemStatusRes */
 		} else if ( exiDoc->Transform_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Transform == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 100);
 			if(errn == 0) {
 				errn = encode_iso2TransformType(stream, &exiDoc->Transform );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Transform */
 		} else if ( exiDoc->Transforms_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Transforms == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 101);
 			if(errn == 0) {
 				errn = encode_iso2TransformsType(stream, &exiDoc->Transforms );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Transforms */
 		} else if ( exiDoc->V2GRequest_isUsed == 1u ) { 
+#if ISO2_DEPLOY_V2GRequest == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}V2GRequest) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 102);
 			if(errn == 0) {
 				errn = encode_iso2BodyBaseType(stream, &exiDoc->V2GRequest );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_V2GRequest */
 		} else if ( exiDoc->V2GResponse_isUsed == 1u ) { 
+#if ISO2_DEPLOY_V2GResponse == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}V2GResponse) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 103);
 			if(errn == 0) {
 				errn = encode_iso2V2GResponseType(stream, &exiDoc->V2GResponse );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_V2GResponse */
 		} else if ( exiDoc->V2G_Message_isUsed == 1u ) { 
+#if ISO2_DEPLOY_V2G_Message == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDef}V2G_Message) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 104);
 			if(errn == 0) {
 				errn = encode_iso2AnonType_V2G_Message(stream, &exiDoc->V2G_Message );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_V2G_Message */
 		} else if ( exiDoc->VehicleCheckInReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_VehicleCheckInReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckInReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 105);
 			if(errn == 0) {
 				errn = encode_iso2VehicleCheckInReqType(stream, &exiDoc->VehicleCheckInReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_VehicleCheckInReq */
 		} else if ( exiDoc->VehicleCheckInRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_VehicleCheckInRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckInRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 106);
 			if(errn == 0) {
 				errn = encode_iso2VehicleCheckInResType(stream, &exiDoc->VehicleCheckInRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_VehicleCheckInRes */
 		} else if ( exiDoc->VehicleCheckOutReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_VehicleCheckOutReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckOutReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 107);
 			if(errn == 0) {
 				errn = encode_iso2VehicleCheckOutReqType(stream, &exiDoc->VehicleCheckOutReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_VehicleCheckOutReq */
 		} else if ( exiDoc->VehicleCheckOutRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_VehicleCheckOutRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckOutRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 108);
 			if(errn == 0) {
 				errn = encode_iso2VehicleCheckOutResType(stream, &exiDoc->VehicleCheckOutRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_VehicleCheckOutRes */
 		} else if ( exiDoc->WPT_EVChargeParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_WPT_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}WPT_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 109);
 			if(errn == 0) {
 				errn = encode_iso2WPT_EVChargeParameterType(stream, &exiDoc->WPT_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_WPT_EVChargeParameter */
 		} else if ( exiDoc->WPT_EVSEChargeParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_WPT_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}WPT_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 110);
 			if(errn == 0) {
 				errn = encode_iso2WPT_EVSEChargeParameterType(stream, &exiDoc->WPT_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_WPT_EVSEChargeParameter */
 		} else if ( exiDoc->WeldingDetectionReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}WeldingDetectionReq) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 111);
 			if(errn == 0) {
 				errn = encode_iso2WeldingDetectionReqType(stream, &exiDoc->WeldingDetectionReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_WeldingDetectionReq */
 		} else if ( exiDoc->WeldingDetectionRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}WeldingDetectionRes) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 112);
 			if(errn == 0) {
 				errn = encode_iso2WeldingDetectionResType(stream, &exiDoc->WeldingDetectionRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_WeldingDetectionRes */
 		} else if ( exiDoc->X509Data_isUsed == 1u ) { 
+#if ISO2_DEPLOY_X509Data == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data) */
 			errn = encodeNBitUnsignedInteger(stream, 7, 113);
 			if(errn == 0) {
 				errn = encode_iso2X509DataType(stream, &exiDoc->X509Data );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_X509Data */
 		} else {
 			errn = EXI_ERROR_UNKOWN_EVENT;
 		}
@@ -59714,47 +60580,71 @@ int encode_iso2ExiDocument(bitstream_t* stream, struct iso2EXIDocument* exiDoc)
 }
 
 #if DEPLOY_ISO2_CODEC_FRAGMENT == SUPPORT_YES
-int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag) {
-	errn = writeEXIHeader(stream);
+static int encode_iso2ExiFragmentContent(bitstream_t* stream, struct iso2EXIFragment* exiFrag) {
+	int errn = 0;
 
 	if(errn == 0) {
 		/* FragmentContent[START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AC_BidirectionalControlReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AC_BidirectionalControlRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVBidirectionalParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVSEBidirectionalParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AlignmentCheckParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AlignmentCheckReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AlignmentCheckRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AlignmentOffset), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AngleGAtoVA), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AuthorizationReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AuthorizationRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDef}Body), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}BodyElement), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}BulkChargingComplete), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}BulkSOC), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}BuyBackTariff), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CableCheckReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CableCheckRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Certificate), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateInstallationReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateInstallationRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateUpdateReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateUpdateRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargeParameterDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargeParameterDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargeProgress), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}ChargingComplete), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}ChargingPerformance), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargingProfile), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargingSession), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargingStatusReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargingStatusRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CheckOutTime), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ConnectChargingDeviceReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ConnectChargingDeviceRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}ConsumptionCost), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ContractSignatureCertChain), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ContractSignatureEncryptedPrivateKey), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Cost), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CurrentDemandReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CurrentDemandRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}CurrentRange), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}CurrentSOC), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DC_BidirectionalControlReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DC_BidirectionalControlRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVBidirectionalParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVSEBidirectionalParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DHpublickey), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DepartureTime), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DisconnectChargingDeviceReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DisconnectChargingDeviceRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DisplayParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Distance), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EPriceLevel), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVCCID), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVCheckInStatus), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVCheckOutStatus), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVElectricalChargingDeviceStatus), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVEnergyTransferParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVFinePositioningParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVFinePositioningSetupParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVInputPower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMaximumChargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMaximumChargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMaximumChargePower), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMaximumChargePower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMaximumCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMaximumDischargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMaximumDischargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMaximumDischargePower), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMaximumDischargePower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMaximumEnergyRequest), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMaximumEnergyRequest), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMaximumPower), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMaximumPower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMaximumVoltage), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMaximumVoltage), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMechanicalChargingDeviceStatus), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMinimumChargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMinimumChargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMinimumChargePower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMinimumDischargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMinimumDischargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMinimumDischargePower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMinimumEnergyRequest), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMinimumEnergyRequest), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMinimumPower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVMinimumVoltage), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVMinimumVoltage), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVOperation), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVPresentActivePower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVPresentReactivePower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVProcessing), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSECheckOutStatus), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSECurrentLimitAchieved), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSECurrentRegulationTolerance), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEElectricalChargingDeviceStatus), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEEnergyToBeDelivered), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEEnergyTransferParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEFinePositioningParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEFinePositioningSetupParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEID), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEMaximumChargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEMaximumChargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEMaximumChargePower), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEMaximumChargePower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEMaximumCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEMaximumDischargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEMaximumDischargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEMaximumDischargePower), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEMaximumDischargePower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEMaximumPower), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEMaximumPower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEMaximumVoltage), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEMaximumVoltage), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEMechanicalChargingDeviceStatus), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEMinimumChargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEMinimumDischargeCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEMinimumPower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEMinimumVoltage), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEMinimumVoltage), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSENominalFrequency), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSENominalVoltage), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSENotification), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEOutputPower), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEPeakCurrentRipple), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEPowerLimitAchieved), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEPresentCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEPresentVoltage), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEProcessing), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEStatus), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSETargetPower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSETargetReactivePower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSETimeStamp), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEVoltageLimitAchieved), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVTargetCurrent), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVTargetEnergyRequest), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVTargetEnergyRequest), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVTargetPower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVTargetVoltage), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EffectiveRadiatedPower), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EnergyTransferServiceList), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Exponent), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Exponent), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}FODStatus), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningSetupReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningSetupRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}FreeService), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}FrequencyChannel), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}G), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}GAID), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}GenChallenge), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}GenericParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Generic_EVFinePositioningParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Generic_EVSEFinePositioningParameters), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}HMACOutputLength), START_ELEMENT({urn:iso:15118:2:2016:MsgDef}Header), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}InletHot), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}J), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVFinePositioningParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVFinePositioningSetupParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVSEFinePositioningParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVSEFinePositioningSetupParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ListOfRootCertificateIDs), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MV_EVSEFinePositioningParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MV_EVSEFinePositioningSetupParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MagneticVector), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MagneticVectorList), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MagneticVectorSetup), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MagneticVectorSetupList), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MaxSupportingPoints), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MeasurementData), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MeasurementDataList), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MeterID), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MeterInfo), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MeterReadingCharged), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MeterReadingDischarged), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MeterStatus), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MeteringReceiptReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MeteringReceiptRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MinimumPMaxRequest), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MinimumPMaxScheduleEntry), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MinimumSOC), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Modulus), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}NotificationMaxDelay), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}NumEPriceLevels), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}NumberOfSensors), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}NumberOfSignalPackages), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}OEMProvisioningCert), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}OperationMode), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}P), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyID), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyPacket), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}PMax), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}PMaxDischargeSchedule), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}PMaxSchedule), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}PMaxScheduleEntry), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}PackageIndex), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}PackageSeparationTime), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PairingParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PairingReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PairingRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Parameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}ParameterSet), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}ParameterSetID), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ParkingMethod), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentDetailsReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentDetailsRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}PaymentOption), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentOptionList), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentServiceSelectionReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentServiceSelectionRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PgenCounter), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDeliveryReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDeliveryRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDemandParameters), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDemandReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDemandRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PreChargeReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PreChargeRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}ProfileEntry), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Q), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ReceiptRequired), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}RelativeTimeInterval), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}RemainingTimeToBulkSOC), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}RemainingTimeToMinimumSOC), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}RemainingTimeToTargetSOC), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ResponseCode), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}RetryCounter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}RootCertificateID), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}RotationVAtoGA), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SAProvisioningCertificateChain), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SAScheduleList), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SAScheduleList), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SAScheduleTuple), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SAScheduleTupleID), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SAScheduleTupleID), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKISexp), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SalesTariff), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SalesTariffDescription), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SalesTariffEntry), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SalesTariffID), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Seed), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SelectedEnergyTransferService), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SelectedPaymentOption), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SelectedService), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SelectedVASList), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Sensor), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SensorID), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SensorList), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SensorMeasurements), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SensorOrder), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SensorOrientation), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SensorPackage), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SensorPackageList), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SensorPosition), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Service), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDetailReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDetailRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDiscoveryReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDiscoveryRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceID), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}ServiceID), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceParameterList), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionID), START_ELEMENT({urn:iso:15118:2:2016:MsgHeader}SessionID), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionSetupReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionSetupRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionStopReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionStopRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SigMeterReading), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SignalFrequency), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SignalPulseDuration), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SignalSeparationTime), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SubCertificates), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SupportedServiceIDs), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SystemStatusReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SystemStatusRes), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}TMeter), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}TargetOffset), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}TargetOffsetX), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}TargetOffsetY), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}TargetSOC), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}V2GRequest), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}V2GResponse), START_ELEMENT({urn:iso:15118:2:2016:MsgDef}V2G_Message), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VASList), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Value), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckInReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckInRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckOutReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckOutRes), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleSpace), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}WPT_EVChargeParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}WPT_EVSEChargeParameter), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}WeldingDetectionReq), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}WeldingDetectionRes), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509CRL), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Certificate), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerSerial), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509SKI), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509SerialNumber), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509SubjectName), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}XCoordinate), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}XPath), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Y), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}YCoordinate), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}ZCoordinate), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}amount), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}boolValue), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}byteValue), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}costKind), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}duration), START_ELEMENT({urn:iso:15118:2:2016:MsgBody}eMAID), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}intValue), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}physicalValue), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}shortValue), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}start), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}startValue), START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}stringValue), START_ELEMENT_GENERIC, END_DOCUMENT] */
 		if ( exiFrag->AC_BidirectionalControlReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AC_BidirectionalControlReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AC_BidirectionalControlReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 0);
 			if(errn == 0) {
 				errn = encode_iso2AC_BidirectionalControlReqType(stream, &exiFrag->AC_BidirectionalControlReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlReq */
 		} else if ( exiFrag->AC_BidirectionalControlRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AC_BidirectionalControlRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AC_BidirectionalControlRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 1);
 			if(errn == 0) {
 				errn = encode_iso2AC_BidirectionalControlResType(stream, &exiFrag->AC_BidirectionalControlRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_BidirectionalControlRes */
 		} else if ( exiFrag->AC_EVBidirectionalParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AC_EVBidirectionalParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVBidirectionalParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 2);
 			if(errn == 0) {
 				errn = encode_iso2AC_EVBidirectionalParameterType(stream, &exiFrag->AC_EVBidirectionalParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_EVBidirectionalParameter */
 		} else if ( exiFrag->AC_EVChargeParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AC_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 3);
 			if(errn == 0) {
 				errn = encode_iso2AC_EVChargeParameterType(stream, &exiFrag->AC_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_EVChargeParameter */
 		} else if ( exiFrag->AC_EVSEBidirectionalParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AC_EVSEBidirectionalParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVSEBidirectionalParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 4);
 			if(errn == 0) {
 				errn = encode_iso2AC_EVSEBidirectionalParameterType(stream, &exiFrag->AC_EVSEBidirectionalParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_EVSEBidirectionalParameter */
 		} else if ( exiFrag->AC_EVSEChargeParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AC_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AC_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 5);
 			if(errn == 0) {
 				errn = encode_iso2AC_EVSEChargeParameterType(stream, &exiFrag->AC_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AC_EVSEChargeParameter */
 		} else if ( exiFrag->AlignmentCheckParameters_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AlignmentCheckParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 6);
@@ -59762,17 +60652,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2ParameterSetType(stream, &exiFrag->AlignmentCheckParameters );
 			}
 		} else if ( exiFrag->AlignmentCheckReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AlignmentCheckReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AlignmentCheckReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 7);
 			if(errn == 0) {
 				errn = encode_iso2AlignmentCheckReqType(stream, &exiFrag->AlignmentCheckReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AlignmentCheckReq */
 		} else if ( exiFrag->AlignmentCheckRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AlignmentCheckRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AlignmentCheckRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 8);
 			if(errn == 0) {
 				errn = encode_iso2AlignmentCheckResType(stream, &exiFrag->AlignmentCheckRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AlignmentCheckRes */
 		} else if ( exiFrag->AlignmentOffset_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}AlignmentOffset) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 9);
@@ -59792,17 +60690,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2PhysicalValueType(stream, &exiFrag->AngleGAtoVA );
 			}
 		} else if ( exiFrag->AuthorizationReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AuthorizationReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AuthorizationReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 11);
 			if(errn == 0) {
 				errn = encode_iso2AuthorizationReqType(stream, &exiFrag->AuthorizationReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AuthorizationReq */
 		} else if ( exiFrag->AuthorizationRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_AuthorizationRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}AuthorizationRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 12);
 			if(errn == 0) {
 				errn = encode_iso2AuthorizationResType(stream, &exiFrag->AuthorizationRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_AuthorizationRes */
 		} else if ( exiFrag->Body_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDef}Body) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 13);
@@ -59810,11 +60716,15 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2BodyType(stream, &exiFrag->Body );
 			}
 		} else if ( exiFrag->BodyElement_isUsed == 1u ) { 
+#if ISO2_DEPLOY_BodyElement == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}BodyElement) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 14);
 			if(errn == 0) {
 				errn = encode_iso2BodyBaseType(stream, &exiFrag->BodyElement );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_BodyElement */
 		} else if ( exiFrag->BulkChargingComplete_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}BulkChargingComplete) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 15);
@@ -59846,23 +60756,35 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2SalesTariffType(stream, &exiFrag->BuyBackTariff );
 			}
 		} else if ( exiFrag->CableCheckReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CableCheckReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CableCheckReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 18);
 			if(errn == 0) {
 				errn = encode_iso2CableCheckReqType(stream, &exiFrag->CableCheckReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CableCheckReq */
 		} else if ( exiFrag->CableCheckRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CableCheckRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CableCheckRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 19);
 			if(errn == 0) {
 				errn = encode_iso2CableCheckResType(stream, &exiFrag->CableCheckRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CableCheckRes */
 		} else if ( exiFrag->CanonicalizationMethod_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CanonicalizationMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 20);
 			if(errn == 0) {
 				errn = encode_iso2CanonicalizationMethodType(stream, &exiFrag->CanonicalizationMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CanonicalizationMethod */
 		} else if ( exiFrag->Certificate_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Certificate) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 21);
@@ -59879,41 +60801,65 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->CertificateInstallationReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CertificateInstallationReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateInstallationReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 22);
 			if(errn == 0) {
 				errn = encode_iso2CertificateInstallationReqType(stream, &exiFrag->CertificateInstallationReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CertificateInstallationReq */
 		} else if ( exiFrag->CertificateInstallationRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CertificateInstallationRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateInstallationRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 23);
 			if(errn == 0) {
 				errn = encode_iso2CertificateInstallationResType(stream, &exiFrag->CertificateInstallationRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CertificateInstallationRes */
 		} else if ( exiFrag->CertificateUpdateReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CertificateUpdateReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateUpdateReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 24);
 			if(errn == 0) {
 				errn = encode_iso2CertificateUpdateReqType(stream, &exiFrag->CertificateUpdateReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CertificateUpdateReq */
 		} else if ( exiFrag->CertificateUpdateRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CertificateUpdateRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CertificateUpdateRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 25);
 			if(errn == 0) {
 				errn = encode_iso2CertificateUpdateResType(stream, &exiFrag->CertificateUpdateRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CertificateUpdateRes */
 		} else if ( exiFrag->ChargeParameterDiscoveryReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ChargeParameterDiscoveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargeParameterDiscoveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 26);
 			if(errn == 0) {
 				errn = encode_iso2ChargeParameterDiscoveryReqType(stream, &exiFrag->ChargeParameterDiscoveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryReq */
 		} else if ( exiFrag->ChargeParameterDiscoveryRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ChargeParameterDiscoveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargeParameterDiscoveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 27);
 			if(errn == 0) {
 				errn = encode_iso2ChargeParameterDiscoveryResType(stream, &exiFrag->ChargeParameterDiscoveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ChargeParameterDiscoveryRes */
 		} else if ( exiFrag->ChargeProgress_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargeProgress) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 28);
@@ -59963,17 +60909,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->ChargingStatusReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ChargingStatusReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargingStatusReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 33);
 			if(errn == 0) {
 				errn = encode_iso2ChargingStatusReqType(stream, &exiFrag->ChargingStatusReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ChargingStatusReq */
 		} else if ( exiFrag->ChargingStatusRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ChargingStatusRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ChargingStatusRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 34);
 			if(errn == 0) {
 				errn = encode_iso2ChargingStatusResType(stream, &exiFrag->ChargingStatusRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ChargingStatusRes */
 		} else if ( exiFrag->CheckOutTime_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CheckOutTime) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 35);
@@ -59987,17 +60941,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->ConnectChargingDeviceReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ConnectChargingDeviceReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ConnectChargingDeviceReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 36);
 			if(errn == 0) {
 				errn = encode_iso2ConnectChargingDeviceReqType(stream, &exiFrag->ConnectChargingDeviceReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceReq */
 		} else if ( exiFrag->ConnectChargingDeviceRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ConnectChargingDeviceRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ConnectChargingDeviceRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 37);
 			if(errn == 0) {
 				errn = encode_iso2ConnectChargingDeviceResType(stream, &exiFrag->ConnectChargingDeviceRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ConnectChargingDeviceRes */
 		} else if ( exiFrag->ConsumptionCost_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}ConsumptionCost) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 38);
@@ -60023,17 +60985,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2CostType(stream, &exiFrag->Cost );
 			}
 		} else if ( exiFrag->CurrentDemandReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CurrentDemandReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CurrentDemandReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 42);
 			if(errn == 0) {
 				errn = encode_iso2CurrentDemandReqType(stream, &exiFrag->CurrentDemandReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CurrentDemandReq */
 		} else if ( exiFrag->CurrentDemandRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_CurrentDemandRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}CurrentDemandRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 43);
 			if(errn == 0) {
 				errn = encode_iso2CurrentDemandResType(stream, &exiFrag->CurrentDemandRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_CurrentDemandRes */
 		} else if ( exiFrag->CurrentRange_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}CurrentRange) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 44);
@@ -60059,41 +61029,65 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->DC_BidirectionalControlReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DC_BidirectionalControlReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DC_BidirectionalControlReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 46);
 			if(errn == 0) {
 				errn = encode_iso2DC_BidirectionalControlReqType(stream, &exiFrag->DC_BidirectionalControlReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlReq */
 		} else if ( exiFrag->DC_BidirectionalControlRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DC_BidirectionalControlRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DC_BidirectionalControlRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 47);
 			if(errn == 0) {
 				errn = encode_iso2DC_BidirectionalControlResType(stream, &exiFrag->DC_BidirectionalControlRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_BidirectionalControlRes */
 		} else if ( exiFrag->DC_EVBidirectionalParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DC_EVBidirectionalParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVBidirectionalParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 48);
 			if(errn == 0) {
 				errn = encode_iso2DC_EVBidirectionalParameterType(stream, &exiFrag->DC_EVBidirectionalParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_EVBidirectionalParameter */
 		} else if ( exiFrag->DC_EVChargeParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DC_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 49);
 			if(errn == 0) {
 				errn = encode_iso2DC_EVChargeParameterType(stream, &exiFrag->DC_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_EVChargeParameter */
 		} else if ( exiFrag->DC_EVSEBidirectionalParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DC_EVSEBidirectionalParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVSEBidirectionalParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 50);
 			if(errn == 0) {
 				errn = encode_iso2DC_EVSEBidirectionalParameterType(stream, &exiFrag->DC_EVSEBidirectionalParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_EVSEBidirectionalParameter */
 		} else if ( exiFrag->DC_EVSEChargeParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DC_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DC_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 51);
 			if(errn == 0) {
 				errn = encode_iso2DC_EVSEChargeParameterType(stream, &exiFrag->DC_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DC_EVSEChargeParameter */
 		} else if ( exiFrag->DHpublickey_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DHpublickey) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 52);
@@ -60101,11 +61095,15 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2DiffieHellmanPublickeyType(stream, &exiFrag->DHpublickey );
 			}
 		} else if ( exiFrag->DSAKeyValue_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DSAKeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 53);
 			if(errn == 0) {
 				errn = encode_iso2DSAKeyValueType(stream, &exiFrag->DSAKeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DSAKeyValue */
 		} else if ( exiFrag->DepartureTime_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}DepartureTime) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 54);
@@ -60119,11 +61117,15 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->DigestMethod_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DigestMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 55);
 			if(errn == 0) {
 				errn = encode_iso2DigestMethodType(stream, &exiFrag->DigestMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DigestMethod */
 		} else if ( exiFrag->DigestValue_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 56);
@@ -60140,17 +61142,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->DisconnectChargingDeviceReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DisconnectChargingDeviceReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DisconnectChargingDeviceReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 57);
 			if(errn == 0) {
 				errn = encode_iso2DisconnectChargingDeviceReqType(stream, &exiFrag->DisconnectChargingDeviceReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceReq */
 		} else if ( exiFrag->DisconnectChargingDeviceRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_DisconnectChargingDeviceRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DisconnectChargingDeviceRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 58);
 			if(errn == 0) {
 				errn = encode_iso2DisconnectChargingDeviceResType(stream, &exiFrag->DisconnectChargingDeviceRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_DisconnectChargingDeviceRes */
 		} else if ( exiFrag->DisplayParameters_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}DisplayParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 59);
@@ -60233,23 +61243,35 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->EVEnergyTransferParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_EVEnergyTransferParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVEnergyTransferParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 66);
 			if(errn == 0) {
 				errn = encode_iso2EVEnergyTransferParameterType(stream, &exiFrag->EVEnergyTransferParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_EVEnergyTransferParameter */
 		} else if ( exiFrag->EVFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_EVFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 67);
 			if(errn == 0) {
 				errn = encode_iso2EVFinePositioningParametersType(stream, &exiFrag->EVFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_EVFinePositioningParameters */
 		} else if ( exiFrag->EVFinePositioningSetupParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_EVFinePositioningSetupParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVFinePositioningSetupParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 68);
 			if(errn == 0) {
 				errn = encode_iso2EVFinePositioningSetupParametersType(stream, &exiFrag->EVFinePositioningSetupParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_EVFinePositioningSetupParameters */
 		} else if ( exiFrag->EVInputPower_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVInputPower) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 69);
@@ -60509,23 +61531,35 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2PhysicalValueType(stream, &exiFrag->EVSEEnergyToBeDelivered );
 			}
 		} else if ( exiFrag->EVSEEnergyTransferParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_EVSEEnergyTransferParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEEnergyTransferParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 106);
 			if(errn == 0) {
 				errn = encode_iso2EVSEEnergyTransferParameterType(stream, &exiFrag->EVSEEnergyTransferParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_EVSEEnergyTransferParameter */
 		} else if ( exiFrag->EVSEFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_EVSEFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 107);
 			if(errn == 0) {
 				errn = encode_iso2EVSEFinePositioningParametersType(stream, &exiFrag->EVSEFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_EVSEFinePositioningParameters */
 		} else if ( exiFrag->EVSEFinePositioningSetupParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_EVSEFinePositioningSetupParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}EVSEFinePositioningSetupParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 108);
 			if(errn == 0) {
 				errn = encode_iso2EVSEFinePositioningSetupParametersType(stream, &exiFrag->EVSEFinePositioningSetupParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_EVSEFinePositioningSetupParameters */
 		} else if ( exiFrag->EVSEID_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}EVSEID) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 109);
@@ -60533,11 +61567,8 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->EVSEID.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->EVSEID.characters, exiFrag->EVSEID.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 13 /* {urn:iso:15118:2:2016:MsgBody}EVSEID */, exiFrag->EVSEID.characters, exiFrag->EVSEID.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -60843,29 +61874,45 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->FinePositioningReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_FinePositioningReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 153);
 			if(errn == 0) {
 				errn = encode_iso2FinePositioningReqType(stream, &exiFrag->FinePositioningReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_FinePositioningReq */
 		} else if ( exiFrag->FinePositioningRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_FinePositioningRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 154);
 			if(errn == 0) {
 				errn = encode_iso2FinePositioningResType(stream, &exiFrag->FinePositioningRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_FinePositioningRes */
 		} else if ( exiFrag->FinePositioningSetupReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_FinePositioningSetupReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningSetupReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 155);
 			if(errn == 0) {
 				errn = encode_iso2FinePositioningSetupReqType(stream, &exiFrag->FinePositioningSetupReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_FinePositioningSetupReq */
 		} else if ( exiFrag->FinePositioningSetupRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_FinePositioningSetupRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}FinePositioningSetupRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 156);
 			if(errn == 0) {
 				errn = encode_iso2FinePositioningSetupResType(stream, &exiFrag->FinePositioningSetupRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_FinePositioningSetupRes */
 		} else if ( exiFrag->FreeService_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}FreeService) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 157);
@@ -60912,11 +61959,8 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->GAID.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->GAID.characters, exiFrag->GAID.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 16 /* {urn:iso:15118:2:2016:MsgDataTypes}GAID */, exiFrag->GAID.characters, exiFrag->GAID.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -60943,17 +61987,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2ParameterSetType(stream, &exiFrag->GenericParameters );
 			}
 		} else if ( exiFrag->Generic_EVFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Generic_EVFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Generic_EVFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 163);
 			if(errn == 0) {
 				errn = encode_iso2Generic_EVFinePositioningParametersType(stream, &exiFrag->Generic_EVFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Generic_EVFinePositioningParameters */
 		} else if ( exiFrag->Generic_EVSEFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Generic_EVSEFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Generic_EVSEFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 164);
 			if(errn == 0) {
 				errn = encode_iso2Generic_EVSEFinePositioningParametersType(stream, &exiFrag->Generic_EVSEFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Generic_EVSEFinePositioningParameters */
 		} else if ( exiFrag->HMACOutputLength_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}HMACOutputLength) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 165);
@@ -61000,11 +62052,15 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->KeyInfo_isUsed == 1u ) { 
+#if ISO2_DEPLOY_KeyInfo == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 169);
 			if(errn == 0) {
 				errn = encode_iso2KeyInfoType(stream, &exiFrag->KeyInfo );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_KeyInfo */
 		} else if ( exiFrag->KeyName_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 170);
@@ -61012,45 +62068,62 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->KeyName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->KeyName.characters, exiFrag->KeyName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiFrag->KeyName.characters, exiFrag->KeyName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiFrag->KeyValue_isUsed == 1u ) { 
+#if ISO2_DEPLOY_KeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 171);
 			if(errn == 0) {
 				errn = encode_iso2KeyValueType(stream, &exiFrag->KeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_KeyValue */
 		} else if ( exiFrag->LFA_EVFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_LFA_EVFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 172);
 			if(errn == 0) {
 				errn = encode_iso2LFA_EVFinePositioningParametersType(stream, &exiFrag->LFA_EVFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_LFA_EVFinePositioningParameters */
 		} else if ( exiFrag->LFA_EVFinePositioningSetupParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_LFA_EVFinePositioningSetupParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVFinePositioningSetupParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 173);
 			if(errn == 0) {
 				errn = encode_iso2LFA_EVFinePositioningSetupParametersType(stream, &exiFrag->LFA_EVFinePositioningSetupParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_LFA_EVFinePositioningSetupParameters */
 		} else if ( exiFrag->LFA_EVSEFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_LFA_EVSEFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVSEFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 174);
 			if(errn == 0) {
 				errn = encode_iso2LFA_EVSEFinePositioningParametersType(stream, &exiFrag->LFA_EVSEFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_LFA_EVSEFinePositioningParameters */
 		} else if ( exiFrag->LFA_EVSEFinePositioningSetupParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_LFA_EVSEFinePositioningSetupParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}LFA_EVSEFinePositioningSetupParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 175);
 			if(errn == 0) {
 				errn = encode_iso2LFA_EVSEFinePositioningSetupParametersType(stream, &exiFrag->LFA_EVSEFinePositioningSetupParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_LFA_EVSEFinePositioningSetupParameters */
 		} else if ( exiFrag->ListOfRootCertificateIDs_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ListOfRootCertificateIDs) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 176);
@@ -61058,17 +62131,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2ListOfRootCertificateIDsType(stream, &exiFrag->ListOfRootCertificateIDs );
 			}
 		} else if ( exiFrag->MV_EVSEFinePositioningParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_MV_EVSEFinePositioningParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MV_EVSEFinePositioningParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 177);
 			if(errn == 0) {
 				errn = encode_iso2MV_EVSEFinePositioningParametersType(stream, &exiFrag->MV_EVSEFinePositioningParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_MV_EVSEFinePositioningParameters */
 		} else if ( exiFrag->MV_EVSEFinePositioningSetupParameters_isUsed == 1u ) { 
+#if ISO2_DEPLOY_MV_EVSEFinePositioningSetupParameters == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MV_EVSEFinePositioningSetupParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 178);
 			if(errn == 0) {
 				errn = encode_iso2MV_EVSEFinePositioningSetupParametersType(stream, &exiFrag->MV_EVSEFinePositioningSetupParameters );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_MV_EVSEFinePositioningSetupParameters */
 		} else if ( exiFrag->MagneticVector_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}MagneticVector) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 179);
@@ -61094,11 +62175,15 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2MagneticVectorSetupListType(stream, &exiFrag->MagneticVectorSetupList );
 			}
 		} else if ( exiFrag->Manifest_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Manifest == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 183);
 			if(errn == 0) {
 				errn = encode_iso2ManifestType(stream, &exiFrag->Manifest );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Manifest */
 		} else if ( exiFrag->MaxSupportingPoints_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MaxSupportingPoints) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 184);
@@ -61136,11 +62221,8 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->MeterID.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->MeterID.characters, exiFrag->MeterID.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 18 /* {urn:iso:15118:2:2016:MsgDataTypes}MeterID */, exiFrag->MeterID.characters, exiFrag->MeterID.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -61188,17 +62270,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->MeteringReceiptReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_MeteringReceiptReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MeteringReceiptReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 192);
 			if(errn == 0) {
 				errn = encode_iso2MeteringReceiptReqType(stream, &exiFrag->MeteringReceiptReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_MeteringReceiptReq */
 		} else if ( exiFrag->MeteringReceiptRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_MeteringReceiptRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}MeteringReceiptRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 193);
 			if(errn == 0) {
 				errn = encode_iso2MeteringReceiptResType(stream, &exiFrag->MeteringReceiptRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_MeteringReceiptRes */
 		} else if ( exiFrag->MgmtData_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 194);
@@ -61206,11 +62296,8 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->MgmtData.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->MgmtData.characters, exiFrag->MgmtData.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiFrag->MgmtData.characters, exiFrag->MgmtData.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -61318,11 +62405,15 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->Object_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Object == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 204);
 			if(errn == 0) {
 				errn = encode_iso2ObjectType(stream, &exiFrag->Object );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Object */
 		} else if ( exiFrag->OperationMode_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}OperationMode) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 205);
@@ -61351,11 +62442,15 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->PGPData_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PGPData == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 207);
 			if(errn == 0) {
 				errn = encode_iso2PGPDataType(stream, &exiFrag->PGPData );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PGPData */
 		} else if ( exiFrag->PGPKeyID_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyID) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 208);
@@ -61405,11 +62500,15 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2PMaxScheduleType(stream, &exiFrag->PMaxSchedule );
 			}
 		} else if ( exiFrag->PMaxScheduleEntry_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PMaxScheduleEntry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}PMaxScheduleEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 213);
 			if(errn == 0) {
 				errn = encode_iso2PMaxScheduleEntryType(stream, &exiFrag->PMaxScheduleEntry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PMaxScheduleEntry */
 		} else if ( exiFrag->PackageIndex_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}PackageIndex) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 214);
@@ -61441,17 +62540,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2ParameterSetType(stream, &exiFrag->PairingParameters );
 			}
 		} else if ( exiFrag->PairingReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PairingReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PairingReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 217);
 			if(errn == 0) {
 				errn = encode_iso2PairingReqType(stream, &exiFrag->PairingReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PairingReq */
 		} else if ( exiFrag->PairingRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PairingRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PairingRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 218);
 			if(errn == 0) {
 				errn = encode_iso2PairingResType(stream, &exiFrag->PairingRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PairingRes */
 		} else if ( exiFrag->Parameter_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}Parameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 219);
@@ -61489,17 +62596,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->PaymentDetailsReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PaymentDetailsReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentDetailsReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 223);
 			if(errn == 0) {
 				errn = encode_iso2PaymentDetailsReqType(stream, &exiFrag->PaymentDetailsReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PaymentDetailsReq */
 		} else if ( exiFrag->PaymentDetailsRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PaymentDetailsRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentDetailsRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 224);
 			if(errn == 0) {
 				errn = encode_iso2PaymentDetailsResType(stream, &exiFrag->PaymentDetailsRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PaymentDetailsRes */
 		} else if ( exiFrag->PaymentOption_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}PaymentOption) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 225);
@@ -61519,17 +62634,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2PaymentOptionListType(stream, &exiFrag->PaymentOptionList );
 			}
 		} else if ( exiFrag->PaymentServiceSelectionReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PaymentServiceSelectionReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentServiceSelectionReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 227);
 			if(errn == 0) {
 				errn = encode_iso2PaymentServiceSelectionReqType(stream, &exiFrag->PaymentServiceSelectionReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionReq */
 		} else if ( exiFrag->PaymentServiceSelectionRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PaymentServiceSelectionRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PaymentServiceSelectionRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 228);
 			if(errn == 0) {
 				errn = encode_iso2PaymentServiceSelectionResType(stream, &exiFrag->PaymentServiceSelectionRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PaymentServiceSelectionRes */
 		} else if ( exiFrag->PgenCounter_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PgenCounter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 229);
@@ -61546,17 +62669,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->PowerDeliveryReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PowerDeliveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDeliveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 230);
 			if(errn == 0) {
 				errn = encode_iso2PowerDeliveryReqType(stream, &exiFrag->PowerDeliveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PowerDeliveryReq */
 		} else if ( exiFrag->PowerDeliveryRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PowerDeliveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDeliveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 231);
 			if(errn == 0) {
 				errn = encode_iso2PowerDeliveryResType(stream, &exiFrag->PowerDeliveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PowerDeliveryRes */
 		} else if ( exiFrag->PowerDemandParameters_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDemandParameters) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 232);
@@ -61564,29 +62695,45 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2ParameterSetType(stream, &exiFrag->PowerDemandParameters );
 			}
 		} else if ( exiFrag->PowerDemandReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PowerDemandReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDemandReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 233);
 			if(errn == 0) {
 				errn = encode_iso2PowerDemandReqType(stream, &exiFrag->PowerDemandReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PowerDemandReq */
 		} else if ( exiFrag->PowerDemandRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PowerDemandRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PowerDemandRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 234);
 			if(errn == 0) {
 				errn = encode_iso2PowerDemandResType(stream, &exiFrag->PowerDemandRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PowerDemandRes */
 		} else if ( exiFrag->PreChargeReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PreChargeReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PreChargeReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 235);
 			if(errn == 0) {
 				errn = encode_iso2PreChargeReqType(stream, &exiFrag->PreChargeReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PreChargeReq */
 		} else if ( exiFrag->PreChargeRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_PreChargeRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}PreChargeRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 236);
 			if(errn == 0) {
 				errn = encode_iso2PreChargeResType(stream, &exiFrag->PreChargeRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_PreChargeRes */
 		} else if ( exiFrag->ProfileEntry_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}ProfileEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 237);
@@ -61609,11 +62756,15 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->RSAKeyValue_isUsed == 1u ) { 
+#if ISO2_DEPLOY_RSAKeyValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 239);
 			if(errn == 0) {
 				errn = encode_iso2RSAKeyValueType(stream, &exiFrag->RSAKeyValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_RSAKeyValue */
 		} else if ( exiFrag->ReceiptRequired_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ReceiptRequired) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 240);
@@ -61627,17 +62778,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->Reference_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Reference == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 241);
 			if(errn == 0) {
 				errn = encode_iso2ReferenceType(stream, &exiFrag->Reference );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Reference */
 		} else if ( exiFrag->RelativeTimeInterval_isUsed == 1u ) { 
+#if ISO2_DEPLOY_RelativeTimeInterval == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}RelativeTimeInterval) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 242);
 			if(errn == 0) {
 				errn = encode_iso2RelativeTimeIntervalType(stream, &exiFrag->RelativeTimeInterval );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_RelativeTimeInterval */
 		} else if ( exiFrag->RemainingTimeToBulkSOC_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}RemainingTimeToBulkSOC) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 243);
@@ -61687,11 +62846,15 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->RetrievalMethod_isUsed == 1u ) { 
+#if ISO2_DEPLOY_RetrievalMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 247);
 			if(errn == 0) {
 				errn = encode_iso2RetrievalMethodType(stream, &exiFrag->RetrievalMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_RetrievalMethod */
 		} else if ( exiFrag->RetryCounter_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}RetryCounter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 248);
@@ -61723,17 +62886,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2CertificateChainType(stream, &exiFrag->SAProvisioningCertificateChain );
 			}
 		} else if ( exiFrag->SAScheduleList_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SAScheduleList == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SAScheduleList) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 252);
 			if(errn == 0) {
 				errn = encode_iso2SAScheduleListType(stream, &exiFrag->SAScheduleList );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SAScheduleList */
 		} else if ( exiFrag->SAScheduleList_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SAScheduleList == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SAScheduleList) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 253);
 			if(errn == 0) {
 				errn = encode_iso2SAScheduleListType(stream, &exiFrag->SAScheduleList );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SAScheduleList */
 		} else if ( exiFrag->SAScheduleTuple_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SAScheduleTuple) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 254);
@@ -61765,11 +62936,15 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->SPKIData_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SPKIData == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 257);
 			if(errn == 0) {
 				errn = encode_iso2SPKIDataType(stream, &exiFrag->SPKIData );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SPKIData */
 		} else if ( exiFrag->SPKISexp_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKISexp) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 258);
@@ -61798,21 +62973,22 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				/* FirstStartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->SalesTariffDescription.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->SalesTariffDescription.characters, exiFrag->SalesTariffDescription.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 20 /* {urn:iso:15118:2:2016:MsgDataTypes}SalesTariffDescription */, exiFrag->SalesTariffDescription.characters, exiFrag->SalesTariffDescription.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
 			}
 		} else if ( exiFrag->SalesTariffEntry_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SalesTariffEntry == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SalesTariffEntry) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 261);
 			if(errn == 0) {
 				errn = encode_iso2SalesTariffEntryType(stream, &exiFrag->SalesTariffEntry );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SalesTariffEntry */
 		} else if ( exiFrag->SalesTariffID_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SalesTariffID) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 262);
@@ -61934,29 +63110,45 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2ServiceType(stream, &exiFrag->Service );
 			}
 		} else if ( exiFrag->ServiceDetailReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ServiceDetailReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDetailReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 278);
 			if(errn == 0) {
 				errn = encode_iso2ServiceDetailReqType(stream, &exiFrag->ServiceDetailReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ServiceDetailReq */
 		} else if ( exiFrag->ServiceDetailRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ServiceDetailRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDetailRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 279);
 			if(errn == 0) {
 				errn = encode_iso2ServiceDetailResType(stream, &exiFrag->ServiceDetailRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ServiceDetailRes */
 		} else if ( exiFrag->ServiceDiscoveryReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ServiceDiscoveryReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDiscoveryReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 280);
 			if(errn == 0) {
 				errn = encode_iso2ServiceDiscoveryReqType(stream, &exiFrag->ServiceDiscoveryReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ServiceDiscoveryReq */
 		} else if ( exiFrag->ServiceDiscoveryRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_ServiceDiscoveryRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceDiscoveryRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 281);
 			if(errn == 0) {
 				errn = encode_iso2ServiceDiscoveryResType(stream, &exiFrag->ServiceDiscoveryRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_ServiceDiscoveryRes */
 		} else if ( exiFrag->ServiceID_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}ServiceID) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 282);
@@ -62018,29 +63210,45 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->SessionSetupReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SessionSetupReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionSetupReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 287);
 			if(errn == 0) {
 				errn = encode_iso2SessionSetupReqType(stream, &exiFrag->SessionSetupReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SessionSetupReq */
 		} else if ( exiFrag->SessionSetupRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SessionSetupRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionSetupRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 288);
 			if(errn == 0) {
 				errn = encode_iso2SessionSetupResType(stream, &exiFrag->SessionSetupRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SessionSetupRes */
 		} else if ( exiFrag->SessionStopReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SessionStopReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionStopReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 289);
 			if(errn == 0) {
 				errn = encode_iso2SessionStopReqType(stream, &exiFrag->SessionStopReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SessionStopReq */
 		} else if ( exiFrag->SessionStopRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SessionStopRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SessionStopRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 290);
 			if(errn == 0) {
 				errn = encode_iso2SessionStopResType(stream, &exiFrag->SessionStopRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SessionStopRes */
 		} else if ( exiFrag->SigMeterReading_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SigMeterReading) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 291);
@@ -62093,41 +63301,65 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->Signature_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Signature == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 295);
 			if(errn == 0) {
 				errn = encode_iso2SignatureType(stream, &exiFrag->Signature );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Signature */
 		} else if ( exiFrag->SignatureMethod_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SignatureMethod == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 296);
 			if(errn == 0) {
 				errn = encode_iso2SignatureMethodType(stream, &exiFrag->SignatureMethod );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SignatureMethod */
 		} else if ( exiFrag->SignatureProperties_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SignatureProperties == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 297);
 			if(errn == 0) {
 				errn = encode_iso2SignaturePropertiesType(stream, &exiFrag->SignatureProperties );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SignatureProperties */
 		} else if ( exiFrag->SignatureProperty_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SignatureProperty == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 298);
 			if(errn == 0) {
 				errn = encode_iso2SignaturePropertyType(stream, &exiFrag->SignatureProperty );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SignatureProperty */
 		} else if ( exiFrag->SignatureValue_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SignatureValue == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 299);
 			if(errn == 0) {
 				errn = encode_iso2SignatureValueType(stream, &exiFrag->SignatureValue );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SignatureValue */
 		} else if ( exiFrag->SignedInfo_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SignedInfo == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 300);
 			if(errn == 0) {
 				errn = encode_iso2SignedInfoType(stream, &exiFrag->SignedInfo );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SignedInfo */
 		} else if ( exiFrag->SubCertificates_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}SubCertificates) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 301);
@@ -62141,17 +63373,25 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				errn = encode_iso2ServiceIDListType(stream, &exiFrag->SupportedServiceIDs );
 			}
 		} else if ( exiFrag->SystemStatusReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SystemStatusReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SystemStatusReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 303);
 			if(errn == 0) {
 				errn = encode_iso2SystemStatusReqType(stream, &exiFrag->SystemStatusReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SystemStatusReq */
 		} else if ( exiFrag->SystemStatusRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_SystemStatusRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}SystemStatusRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 304);
 			if(errn == 0) {
 				errn = encode_iso2SystemStatusResType(stream, &exiFrag->SystemStatusRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_SystemStatusRes */
 		} else if ( exiFrag->TMeter_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}TMeter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 305);
@@ -62207,35 +63447,55 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->Transform_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Transform == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 310);
 			if(errn == 0) {
 				errn = encode_iso2TransformType(stream, &exiFrag->Transform );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Transform */
 		} else if ( exiFrag->Transforms_isUsed == 1u ) { 
+#if ISO2_DEPLOY_Transforms == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 311);
 			if(errn == 0) {
 				errn = encode_iso2TransformsType(stream, &exiFrag->Transforms );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_Transforms */
 		} else if ( exiFrag->V2GRequest_isUsed == 1u ) { 
+#if ISO2_DEPLOY_V2GRequest == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}V2GRequest) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 312);
 			if(errn == 0) {
 				errn = encode_iso2BodyBaseType(stream, &exiFrag->V2GRequest );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_V2GRequest */
 		} else if ( exiFrag->V2GResponse_isUsed == 1u ) { 
+#if ISO2_DEPLOY_V2GResponse == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}V2GResponse) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 313);
 			if(errn == 0) {
 				errn = encode_iso2V2GResponseType(stream, &exiFrag->V2GResponse );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_V2GResponse */
 		} else if ( exiFrag->V2G_Message_isUsed == 1u ) { 
+#if ISO2_DEPLOY_V2G_Message == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDef}V2G_Message) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 314);
 			if(errn == 0) {
 				errn = encode_iso2AnonType_V2G_Message(stream, &exiFrag->V2G_Message );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_V2G_Message */
 		} else if ( exiFrag->VASList_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VASList) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 315);
@@ -62255,29 +63515,45 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->VehicleCheckInReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_VehicleCheckInReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckInReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 317);
 			if(errn == 0) {
 				errn = encode_iso2VehicleCheckInReqType(stream, &exiFrag->VehicleCheckInReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_VehicleCheckInReq */
 		} else if ( exiFrag->VehicleCheckInRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_VehicleCheckInRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckInRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 318);
 			if(errn == 0) {
 				errn = encode_iso2VehicleCheckInResType(stream, &exiFrag->VehicleCheckInRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_VehicleCheckInRes */
 		} else if ( exiFrag->VehicleCheckOutReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_VehicleCheckOutReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckOutReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 319);
 			if(errn == 0) {
 				errn = encode_iso2VehicleCheckOutReqType(stream, &exiFrag->VehicleCheckOutReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_VehicleCheckOutReq */
 		} else if ( exiFrag->VehicleCheckOutRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_VehicleCheckOutRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleCheckOutRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 320);
 			if(errn == 0) {
 				errn = encode_iso2VehicleCheckOutResType(stream, &exiFrag->VehicleCheckOutRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_VehicleCheckOutRes */
 		} else if ( exiFrag->VehicleSpace_isUsed == 1u ) { 
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}VehicleSpace) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 321);
@@ -62291,29 +63567,45 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->WPT_EVChargeParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_WPT_EVChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}WPT_EVChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 322);
 			if(errn == 0) {
 				errn = encode_iso2WPT_EVChargeParameterType(stream, &exiFrag->WPT_EVChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_WPT_EVChargeParameter */
 		} else if ( exiFrag->WPT_EVSEChargeParameter_isUsed == 1u ) { 
+#if ISO2_DEPLOY_WPT_EVSEChargeParameter == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgDataTypes}WPT_EVSEChargeParameter) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 323);
 			if(errn == 0) {
 				errn = encode_iso2WPT_EVSEChargeParameterType(stream, &exiFrag->WPT_EVSEChargeParameter );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_WPT_EVSEChargeParameter */
 		} else if ( exiFrag->WeldingDetectionReq_isUsed == 1u ) { 
+#if ISO2_DEPLOY_WeldingDetectionReq == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}WeldingDetectionReq) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 324);
 			if(errn == 0) {
 				errn = encode_iso2WeldingDetectionReqType(stream, &exiFrag->WeldingDetectionReq );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_WeldingDetectionReq */
 		} else if ( exiFrag->WeldingDetectionRes_isUsed == 1u ) { 
+#if ISO2_DEPLOY_WeldingDetectionRes == SUPPORT_YES
 			/* START_ELEMENT({urn:iso:15118:2:2016:MsgBody}WeldingDetectionRes) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 325);
 			if(errn == 0) {
 				errn = encode_iso2WeldingDetectionResType(stream, &exiFrag->WeldingDetectionRes );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_WeldingDetectionRes */
 		} else if ( exiFrag->X509CRL_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509CRL) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 326);
@@ -62345,11 +63637,15 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				}
 			}
 		} else if ( exiFrag->X509Data_isUsed == 1u ) { 
+#if ISO2_DEPLOY_X509Data == SUPPORT_YES
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 328);
 			if(errn == 0) {
 				errn = encode_iso2X509DataType(stream, &exiFrag->X509Data );
 			}
+#else
+			errn = EXI_ERROR_UNKOWN_EVENT;
+#endif /* ISO2_DEPLOY_X509Data */
 		} else if ( exiFrag->X509IssuerName_isUsed == 1u ) { 
 			/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerName) */
 			errn = encodeNBitUnsignedInteger(stream, 9, 329);
@@ -62357,11 +63653,8 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->X509IssuerName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->X509IssuerName.characters, exiFrag->X509IssuerName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, exiFrag->X509IssuerName.characters, exiFrag->X509IssuerName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -62406,11 +63699,8 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->X509SubjectName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->X509SubjectName.characters, exiFrag->X509SubjectName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, exiFrag->X509SubjectName.characters, exiFrag->X509SubjectName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -62434,11 +63724,8 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->XPath.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->XPath.characters, exiFrag->XPath.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, exiFrag->XPath.characters, exiFrag->XPath.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -62597,11 +63884,8 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->stringValue.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->stringValue.characters, exiFrag->stringValue.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 21 /* {urn:iso:15118:2:2016:MsgDataTypes}stringValue */, exiFrag->stringValue.characters, exiFrag->stringValue.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -62623,6 +63907,37 @@ int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag)
 
 	return errn;
 }
+int encode_iso2ExiFragment(bitstream_t* stream, struct iso2EXIFragment* exiFrag) {
+	int errn = writeEXIHeader(stream);
+
+	if(errn == 0) {
+		errn = encode_iso2ExiFragmentContent(stream, exiFrag);
+	}
+
+	return errn;
+}
+
+#if EXI_STREAM == BYTE_ARRAY && ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+int encode_iso2ExiFragmentDigest(bitstream_t* stream, struct iso2EXIFragment* exiFrag, uint8_t* digest) {
+	exi_sha256_t sha256;
+	int errn;
+
+	/* the bytes are hashed while they are written, no second pass over the stream */
+	exiSha256Init(&sha256);
+	errn = writeEXIHeaderDigest(stream, &sha256);
+
+	if(errn == 0) {
+		errn = encode_iso2ExiFragmentContent(stream, exiFrag);
+	}
+	stream->digest = NULL;
+
+	if(errn == 0) {
+		exiSha256Final(&sha256, digest);
+	}
+
+	return errn;
+}
+#endif /* ENCODER_DIGEST_SHA256 */
 #endif /* DEPLOY_ISO2_CODEC_FRAGMENT */
 
 
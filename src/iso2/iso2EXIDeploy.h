@@ -0,0 +1,366 @@
+/*******************************************************************
+ * Per message deployment of the iso2 codec, generated by tools/deploy_messages.py
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+
+
+/**
+ * \file 	iso2EXIDeploy.h
+ * \brief 	Switches for the root elements (messages) of the iso2 codec
+ *
+ * 			A disabled element is not decoded or encoded (unknown event code) and
+ * 			its type functions are not compiled. A build for a charge controller
+ * 			with few messages sets ISO2_DEPLOY_DEFAULT to SUPPORT_NO and
+ * 			enables V2G_Message and the messages it needs, e.g. with
+ * 			-DISO2_DEPLOY_DEFAULT=SUPPORT_NO -DISO2_DEPLOY_V2G_Message=SUPPORT_YES ...
+ *
+ */
+
+#ifndef EXI_iso2_DEPLOY_H
+#define EXI_iso2_DEPLOY_H
+
+/** Default of all switches below */
+#ifndef ISO2_DEPLOY_DEFAULT
+#define ISO2_DEPLOY_DEFAULT SUPPORT_YES
+#endif
+
+/* Messages (V2G_Message Body) */
+#ifndef ISO2_DEPLOY_AC_BidirectionalControlReq
+#define ISO2_DEPLOY_AC_BidirectionalControlReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_AC_BidirectionalControlRes
+#define ISO2_DEPLOY_AC_BidirectionalControlRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_AlignmentCheckReq
+#define ISO2_DEPLOY_AlignmentCheckReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_AlignmentCheckRes
+#define ISO2_DEPLOY_AlignmentCheckRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_AuthorizationReq
+#define ISO2_DEPLOY_AuthorizationReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_AuthorizationRes
+#define ISO2_DEPLOY_AuthorizationRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_BodyElement
+#define ISO2_DEPLOY_BodyElement ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_CableCheckReq
+#define ISO2_DEPLOY_CableCheckReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_CableCheckRes
+#define ISO2_DEPLOY_CableCheckRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_CertificateInstallationReq
+#define ISO2_DEPLOY_CertificateInstallationReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_CertificateInstallationRes
+#define ISO2_DEPLOY_CertificateInstallationRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_CertificateUpdateReq
+#define ISO2_DEPLOY_CertificateUpdateReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_CertificateUpdateRes
+#define ISO2_DEPLOY_CertificateUpdateRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_ChargeParameterDiscoveryReq
+#define ISO2_DEPLOY_ChargeParameterDiscoveryReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_ChargeParameterDiscoveryRes
+#define ISO2_DEPLOY_ChargeParameterDiscoveryRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_ChargingStatusReq
+#define ISO2_DEPLOY_ChargingStatusReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_ChargingStatusRes
+#define ISO2_DEPLOY_ChargingStatusRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_ConnectChargingDeviceReq
+#define ISO2_DEPLOY_ConnectChargingDeviceReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_ConnectChargingDeviceRes
+#define ISO2_DEPLOY_ConnectChargingDeviceRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_CurrentDemandReq
+#define ISO2_DEPLOY_CurrentDemandReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_CurrentDemandRes
+#define ISO2_DEPLOY_CurrentDemandRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_DC_BidirectionalControlReq
+#define ISO2_DEPLOY_DC_BidirectionalControlReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_DC_BidirectionalControlRes
+#define ISO2_DEPLOY_DC_BidirectionalControlRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_DisconnectChargingDeviceReq
+#define ISO2_DEPLOY_DisconnectChargingDeviceReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_DisconnectChargingDeviceRes
+#define ISO2_DEPLOY_DisconnectChargingDeviceRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_FinePositioningReq
+#define ISO2_DEPLOY_FinePositioningReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_FinePositioningRes
+#define ISO2_DEPLOY_FinePositioningRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_FinePositioningSetupReq
+#define ISO2_DEPLOY_FinePositioningSetupReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_FinePositioningSetupRes
+#define ISO2_DEPLOY_FinePositioningSetupRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_MeteringReceiptReq
+#define ISO2_DEPLOY_MeteringReceiptReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_MeteringReceiptRes
+#define ISO2_DEPLOY_MeteringReceiptRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PairingReq
+#define ISO2_DEPLOY_PairingReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PairingRes
+#define ISO2_DEPLOY_PairingRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PaymentDetailsReq
+#define ISO2_DEPLOY_PaymentDetailsReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PaymentDetailsRes
+#define ISO2_DEPLOY_PaymentDetailsRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PaymentServiceSelectionReq
+#define ISO2_DEPLOY_PaymentServiceSelectionReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PaymentServiceSelectionRes
+#define ISO2_DEPLOY_PaymentServiceSelectionRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PowerDeliveryReq
+#define ISO2_DEPLOY_PowerDeliveryReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PowerDeliveryRes
+#define ISO2_DEPLOY_PowerDeliveryRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PowerDemandReq
+#define ISO2_DEPLOY_PowerDemandReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PowerDemandRes
+#define ISO2_DEPLOY_PowerDemandRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PreChargeReq
+#define ISO2_DEPLOY_PreChargeReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PreChargeRes
+#define ISO2_DEPLOY_PreChargeRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_ServiceDetailReq
+#define ISO2_DEPLOY_ServiceDetailReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_ServiceDetailRes
+#define ISO2_DEPLOY_ServiceDetailRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_ServiceDiscoveryReq
+#define ISO2_DEPLOY_ServiceDiscoveryReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_ServiceDiscoveryRes
+#define ISO2_DEPLOY_ServiceDiscoveryRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SessionSetupReq
+#define ISO2_DEPLOY_SessionSetupReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SessionSetupRes
+#define ISO2_DEPLOY_SessionSetupRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SessionStopReq
+#define ISO2_DEPLOY_SessionStopReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SessionStopRes
+#define ISO2_DEPLOY_SessionStopRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SystemStatusReq
+#define ISO2_DEPLOY_SystemStatusReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SystemStatusRes
+#define ISO2_DEPLOY_SystemStatusRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_V2GRequest
+#define ISO2_DEPLOY_V2GRequest ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_V2GResponse
+#define ISO2_DEPLOY_V2GResponse ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_VehicleCheckInReq
+#define ISO2_DEPLOY_VehicleCheckInReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_VehicleCheckInRes
+#define ISO2_DEPLOY_VehicleCheckInRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_VehicleCheckOutReq
+#define ISO2_DEPLOY_VehicleCheckOutReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_VehicleCheckOutRes
+#define ISO2_DEPLOY_VehicleCheckOutRes ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_WeldingDetectionReq
+#define ISO2_DEPLOY_WeldingDetectionReq ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_WeldingDetectionRes
+#define ISO2_DEPLOY_WeldingDetectionRes ISO2_DEPLOY_DEFAULT
+#endif
+
+/* Other root elements (V2G_Message, fragments and signatures) */
+#ifndef ISO2_DEPLOY_AC_EVBidirectionalParameter
+#define ISO2_DEPLOY_AC_EVBidirectionalParameter ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_AC_EVChargeParameter
+#define ISO2_DEPLOY_AC_EVChargeParameter ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_AC_EVSEBidirectionalParameter
+#define ISO2_DEPLOY_AC_EVSEBidirectionalParameter ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_AC_EVSEChargeParameter
+#define ISO2_DEPLOY_AC_EVSEChargeParameter ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_CanonicalizationMethod
+#define ISO2_DEPLOY_CanonicalizationMethod ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_DC_EVBidirectionalParameter
+#define ISO2_DEPLOY_DC_EVBidirectionalParameter ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_DC_EVChargeParameter
+#define ISO2_DEPLOY_DC_EVChargeParameter ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_DC_EVSEBidirectionalParameter
+#define ISO2_DEPLOY_DC_EVSEBidirectionalParameter ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_DC_EVSEChargeParameter
+#define ISO2_DEPLOY_DC_EVSEChargeParameter ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_DSAKeyValue
+#define ISO2_DEPLOY_DSAKeyValue ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_DigestMethod
+#define ISO2_DEPLOY_DigestMethod ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_EVEnergyTransferParameter
+#define ISO2_DEPLOY_EVEnergyTransferParameter ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_EVFinePositioningParameters
+#define ISO2_DEPLOY_EVFinePositioningParameters ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_EVFinePositioningSetupParameters
+#define ISO2_DEPLOY_EVFinePositioningSetupParameters ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_EVSEEnergyTransferParameter
+#define ISO2_DEPLOY_EVSEEnergyTransferParameter ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_EVSEFinePositioningParameters
+#define ISO2_DEPLOY_EVSEFinePositioningParameters ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_EVSEFinePositioningSetupParameters
+#define ISO2_DEPLOY_EVSEFinePositioningSetupParameters ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_Generic_EVFinePositioningParameters
+#define ISO2_DEPLOY_Generic_EVFinePositioningParameters ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_Generic_EVSEFinePositioningParameters
+#define ISO2_DEPLOY_Generic_EVSEFinePositioningParameters ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_KeyInfo
+#define ISO2_DEPLOY_KeyInfo ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_KeyValue
+#define ISO2_DEPLOY_KeyValue ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_LFA_EVFinePositioningParameters
+#define ISO2_DEPLOY_LFA_EVFinePositioningParameters ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_LFA_EVFinePositioningSetupParameters
+#define ISO2_DEPLOY_LFA_EVFinePositioningSetupParameters ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_LFA_EVSEFinePositioningParameters
+#define ISO2_DEPLOY_LFA_EVSEFinePositioningParameters ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_LFA_EVSEFinePositioningSetupParameters
+#define ISO2_DEPLOY_LFA_EVSEFinePositioningSetupParameters ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_MV_EVSEFinePositioningParameters
+#define ISO2_DEPLOY_MV_EVSEFinePositioningParameters ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_MV_EVSEFinePositioningSetupParameters
+#define ISO2_DEPLOY_MV_EVSEFinePositioningSetupParameters ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_Manifest
+#define ISO2_DEPLOY_Manifest ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_Object
+#define ISO2_DEPLOY_Object ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PGPData
+#define ISO2_DEPLOY_PGPData ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_PMaxScheduleEntry
+#define ISO2_DEPLOY_PMaxScheduleEntry ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_RSAKeyValue
+#define ISO2_DEPLOY_RSAKeyValue ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_Reference
+#define ISO2_DEPLOY_Reference ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_RelativeTimeInterval
+#define ISO2_DEPLOY_RelativeTimeInterval ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_RetrievalMethod
+#define ISO2_DEPLOY_RetrievalMethod ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SAScheduleList
+#define ISO2_DEPLOY_SAScheduleList ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SPKIData
+#define ISO2_DEPLOY_SPKIData ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SalesTariffEntry
+#define ISO2_DEPLOY_SalesTariffEntry ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_Signature
+#define ISO2_DEPLOY_Signature ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SignatureMethod
+#define ISO2_DEPLOY_SignatureMethod ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SignatureProperties
+#define ISO2_DEPLOY_SignatureProperties ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SignatureProperty
+#define ISO2_DEPLOY_SignatureProperty ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SignatureValue
+#define ISO2_DEPLOY_SignatureValue ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_SignedInfo
+#define ISO2_DEPLOY_SignedInfo ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_Transform
+#define ISO2_DEPLOY_Transform ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_Transforms
+#define ISO2_DEPLOY_Transforms ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_V2G_Message
+#define ISO2_DEPLOY_V2G_Message ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_WPT_EVChargeParameter
+#define ISO2_DEPLOY_WPT_EVChargeParameter ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_WPT_EVSEChargeParameter
+#define ISO2_DEPLOY_WPT_EVSEChargeParameter ISO2_DEPLOY_DEFAULT
+#endif
+#ifndef ISO2_DEPLOY_X509Data
+#define ISO2_DEPLOY_X509Data ISO2_DEPLOY_DEFAULT
+#endif
+
+#endif /* EXI_iso2_DEPLOY_H */
@@ -6,19 +6,11 @@
 *********************************************************************************************************/
 
 void translateIso1HeaderToJson(void) {
-    char sTmp[40], s2[30];
-    int i, n;
     #define h iso1Doc.V2G_Message.Header
-    n = h.SessionID.bytesLen;
-    //sprintf(sTmp, "%d", n); addProperty("header.SessionID.byteLen", sTmp);
-    strcpy(sTmp,"");
-    for (i=0; (i<n)&&(i<30); i++) {
-            sprintf(s2, "%02x", h.SessionID.bytes[i]);
-            strcat(sTmp, s2);
-    }
-    addProperty("header.SessionID", sTmp);
-    sprintf(sTmp, "%d", h.Notification_isUsed); addProperty("header.Notification_isUsed", sTmp);
-    sprintf(sTmp, "%d", h.Signature_isUsed); addProperty("header.Signature_isUsed", sTmp);
+    //addIntProperty("header.SessionID.byteLen", h.SessionID.bytesLen);
+    addHexProperty("header.SessionID", h.SessionID.bytes, h.SessionID.bytesLen);
+    addIntProperty("header.Notification_isUsed", h.Notification_isUsed);
+    addIntProperty("header.Signature_isUsed", h.Signature_isUsed);
     #undef h
 }
 
@@ -113,38 +105,30 @@ void translateiso1DC_EVErrorCodeTypeToJson(iso1DC_EVErrorCodeType e) {
 /* translate the struct iso1Doc into JSON, to have it ready to give it over stdout to the caller application. */
 void translateDocIso1ToJson(void) {
     char sTmp[30];
-    char s2[30];
+    uint8_t bytes[iso1SessionSetupResType_EVSEID_CHARACTERS_SIZE];
     int i,n;
     initProperties();
     addProperty("schema", "ISO1");
-    sprintf(sTmp, "%d", g_errn);
-    addProperty("g_errn", sTmp);
+    addIntProperty("g_errn", g_errn);
     
     translateIso1HeaderToJson();
     if (iso1Doc.V2G_Message.Body.SessionSetupReq_isUsed) {
         addMessageName("SessionSetupReq");
         n=iso1Doc.V2G_Message.Body.SessionSetupReq.EVCCID.bytesLen;
-        sprintf(sTmp, "%d", n); addProperty("EVCCID.bytesLen", sTmp);
-        strcpy(sTmp,"");
-        for (i=0; (i<n)&&(i<20); i++) {
-            /* this is no ASCII, at least not at the Ioniq. Show just Hex. */
-            sprintf(s2, "%02x", iso1Doc.V2G_Message.Body.SessionSetupReq.EVCCID.bytes[i]);
-            strcat(sTmp, s2);
-        }
-        addProperty("EVCCID", sTmp);
+        addIntProperty("EVCCID.bytesLen", n);
+        /* this is no ASCII, at least not at the Ioniq. Show just Hex. */
+        addHexProperty("EVCCID", iso1Doc.V2G_Message.Body.SessionSetupReq.EVCCID.bytes, n);
     }
     if (iso1Doc.V2G_Message.Body.SessionSetupRes_isUsed) {
         addMessageName("SessionSetupRes");
         translateIso1ResponseCodeToJson(iso1Doc.V2G_Message.Body.SessionSetupRes.ResponseCode);
         n=iso1Doc.V2G_Message.Body.SessionSetupRes.EVSEID.charactersLen;
-        sprintf(sTmp, "%d", n); addProperty("EVSEID.charactersLen", sTmp);
-        strcpy(sTmp,"");
-        for (i=0; (i<n)&&(i<20); i++) {
-            /* this is no ASCII, at least not at the Ioniq. Show just Hex. */
-            sprintf(s2, "%02x", iso1Doc.V2G_Message.Body.SessionSetupRes.EVSEID.characters[i]);
-            strcat(sTmp, s2);
+        addIntProperty("EVSEID.charactersLen", n);
+        /* this is no ASCII, at least not at the Ioniq. Show just Hex. */
+        for (i=0; i<n; i++) {
+            bytes[i] = (uint8_t)iso1Doc.V2G_Message.Body.SessionSetupRes.EVSEID.characters[i];
         }
-        addProperty("EVSEID", sTmp);
+        addHexProperty("EVSEID", bytes, n);
         
     }
     if (iso1Doc.V2G_Message.Body.ServiceDiscoveryReq_isUsed) {
@@ -153,7 +137,7 @@ void translateDocIso1ToJson(void) {
         if (m.ServiceScope_isUsed) {
             addProperty("ServiceScope_isUsed", "True");
             n = m.ServiceScope.charactersLen;
-            sprintf(sTmp, "%d", n); addProperty("ServiceScope.charactersLen", sTmp);
+            addIntProperty("ServiceScope.charactersLen", n);
         }
         if (m.ServiceCategory_isUsed) {
             addProperty("ServiceCategory_isUsed", "True");
@@ -172,7 +156,7 @@ void translateDocIso1ToJson(void) {
         if (m.SelectedPaymentOption==iso1paymentOptionType_ExternalPayment) { addProperty("SelectedPaymentOption", "ExternalPayment"); }
         
         n = m.SelectedServiceList.SelectedService.arrayLen;
-        sprintf(sTmp, "%d", n); addProperty("SelectedService.arrayLen", sTmp);
+        addIntProperty("SelectedService.arrayLen", n);
         for (i=0; i<n; i++) {
             sprintf(sTmp, "%d:%d", i, m.SelectedServiceList.SelectedService.array[i].ServiceID); addProperty("SelectedService.array", sTmp);
         }
@@ -203,48 +187,48 @@ void translateDocIso1ToJson(void) {
     if (iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryReq_isUsed) {
         addMessageName("ChargeParameterDiscoveryReq");
         #define m iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryReq
-        sprintf(sTmp, "%d", m.RequestedEnergyTransferMode); addProperty("RequestedEnergyTransferMode", sTmp);
+        addIntProperty("RequestedEnergyTransferMode", m.RequestedEnergyTransferMode);
         
-        sprintf(sTmp, "%d", m.EVChargeParameter_isUsed); addProperty("EVChargeParameter_isUsed", sTmp);
+        addIntProperty("EVChargeParameter_isUsed", m.EVChargeParameter_isUsed);
         if (m.EVChargeParameter_isUsed) {
             /* no content */
         }
-        sprintf(sTmp, "%d", m.DC_EVChargeParameter_isUsed); addProperty("DC_EVChargeParameter_isUsed", sTmp);
+        addIntProperty("DC_EVChargeParameter_isUsed", m.DC_EVChargeParameter_isUsed);
         if (m.DC_EVChargeParameter_isUsed) {
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.DC_EVStatus.EVRESSSOC); addProperty("DC_EVStatus.EVRESSSOC", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.DC_EVStatus.EVReady); addProperty("DC_EVStatus.EVReady", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.DC_EVStatus.EVErrorCode); addProperty("EVErrorCode", sTmp);
+            addIntProperty("DC_EVStatus.EVRESSSOC", m.DC_EVChargeParameter.DC_EVStatus.EVRESSSOC);
+            addIntProperty("DC_EVStatus.EVReady", m.DC_EVChargeParameter.DC_EVStatus.EVReady);
+            addIntProperty("EVErrorCode", m.DC_EVChargeParameter.DC_EVStatus.EVErrorCode);
             translateiso1DC_EVErrorCodeTypeToJson(m.DC_EVChargeParameter.DC_EVStatus.EVErrorCode);
 
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Value); addProperty("EVMaximumCurrentLimit.Value", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Multiplier); addProperty("EVMaximumCurrentLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Unit); addProperty("EVMaximumCurrentLimit.Unit", sTmp);
+            addIntProperty("EVMaximumCurrentLimit.Value", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Value);
+            addIntProperty("EVMaximumCurrentLimit.Multiplier", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Multiplier);
+            addIntProperty("EVMaximumCurrentLimit.Unit", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Unit);
             
             
             
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumPowerLimit_isUsed); addProperty("EVMaximumPowerLimit_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumPowerLimit.Value); addProperty("EVMaximumPowerLimit.Value", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumPowerLimit.Multiplier); addProperty("EVMaximumPowerLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumPowerLimit.Unit); addProperty("EVMaximumPowerLimit.Unit", sTmp);
+            addIntProperty("EVMaximumPowerLimit_isUsed", m.DC_EVChargeParameter.EVMaximumPowerLimit_isUsed);
+            addIntProperty("EVMaximumPowerLimit.Value", m.DC_EVChargeParameter.EVMaximumPowerLimit.Value);
+            addIntProperty("EVMaximumPowerLimit.Multiplier", m.DC_EVChargeParameter.EVMaximumPowerLimit.Multiplier);
+            addIntProperty("EVMaximumPowerLimit.Unit", m.DC_EVChargeParameter.EVMaximumPowerLimit.Unit);
             
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Value); addProperty("EVMaximumVoltageLimit.Value", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Multiplier); addProperty("EVMaximumVoltageLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Unit); addProperty("EVMaximumVoltageLimit.Unit", sTmp);
+            addIntProperty("EVMaximumVoltageLimit.Value", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Value);
+            addIntProperty("EVMaximumVoltageLimit.Multiplier", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Multiplier);
+            addIntProperty("EVMaximumVoltageLimit.Unit", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Unit);
             
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyCapacity_isUsed); addProperty("EVEnergyCapacity_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyCapacity.Value); addProperty("EVEnergyCapacity.Value", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyCapacity.Multiplier); addProperty("EVEnergyCapacity.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyCapacity.Unit); addProperty("EVEnergyCapacity.Unit", sTmp);
+            addIntProperty("EVEnergyCapacity_isUsed", m.DC_EVChargeParameter.EVEnergyCapacity_isUsed);
+            addIntProperty("EVEnergyCapacity.Value", m.DC_EVChargeParameter.EVEnergyCapacity.Value);
+            addIntProperty("EVEnergyCapacity.Multiplier", m.DC_EVChargeParameter.EVEnergyCapacity.Multiplier);
+            addIntProperty("EVEnergyCapacity.Unit", m.DC_EVChargeParameter.EVEnergyCapacity.Unit);
             
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyRequest_isUsed); addProperty("EVEnergyRequest_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyRequest.Value); addProperty("EVEnergyRequest.Value", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyRequest.Multiplier); addProperty("EVEnergyRequest.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyRequest.Unit); addProperty("EVEnergyRequest.Unit", sTmp);
-
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.FullSOC_isUsed); addProperty("FullSOC_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.FullSOC); addProperty("FullSOC", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.BulkSOC_isUsed); addProperty("BulkSOC_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.BulkSOC); addProperty("BulkSOC", sTmp);
+            addIntProperty("EVEnergyRequest_isUsed", m.DC_EVChargeParameter.EVEnergyRequest_isUsed);
+            addIntProperty("EVEnergyRequest.Value", m.DC_EVChargeParameter.EVEnergyRequest.Value);
+            addIntProperty("EVEnergyRequest.Multiplier", m.DC_EVChargeParameter.EVEnergyRequest.Multiplier);
+            addIntProperty("EVEnergyRequest.Unit", m.DC_EVChargeParameter.EVEnergyRequest.Unit);
+
+            addIntProperty("FullSOC_isUsed", m.DC_EVChargeParameter.FullSOC_isUsed);
+            addIntProperty("FullSOC", m.DC_EVChargeParameter.FullSOC);
+            addIntProperty("BulkSOC_isUsed", m.DC_EVChargeParameter.BulkSOC_isUsed);
+            addIntProperty("BulkSOC", m.DC_EVChargeParameter.BulkSOC);
         }
         #undef m
     }
@@ -262,23 +246,23 @@ void translateDocIso1ToJson(void) {
         // todo maybe: EVSEChargeParameter_isUsed
         // todo for AC: AC_EVSEChargeParameter_isUsed
         #define res iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryRes
-        sprintf(sTmp, "%d", res.SAScheduleList_isUsed); addProperty("SAScheduleList_isUsed", sTmp);
+        addIntProperty("SAScheduleList_isUsed", res.SAScheduleList_isUsed);
         if (res.SAScheduleList_isUsed) {
-            sprintf(sTmp, "%d", res.SAScheduleList.SAScheduleTuple.arrayLen); addProperty("SAScheduleList.SAScheduleTuple.arrayLen", sTmp);
+            addIntProperty("SAScheduleList.SAScheduleTuple.arrayLen", res.SAScheduleList.SAScheduleTuple.arrayLen);
             if (res.SAScheduleList.SAScheduleTuple.arrayLen>0) {
                 #define SchedTuple0 res.SAScheduleList.SAScheduleTuple.array[0]
-                sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.arrayLen); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.arrayLen", sTmp);
+                addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.arrayLen", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.arrayLen);
                 if (SchedTuple0.PMaxSchedule.PMaxScheduleEntry.arrayLen>0) {
-                    sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].TimeInterval_isUsed); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].TimeInterval_isUsed", sTmp);
-                    sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed", sTmp);
+                    addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].TimeInterval_isUsed", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].TimeInterval_isUsed);
+                    addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed);
                     if (SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed) {
-                        sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.start); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.start", sTmp);
-                        sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration_isUsed); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration_isUsed", sTmp);
+                        addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.start", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.start);
+                        addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration_isUsed", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration_isUsed);
                         if (SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration_isUsed) {
-                            sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration", sTmp);
+                            addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration);
                         }
                     }
-                    sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].PMax.Value); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].PMax", sTmp);
+                    addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].PMax", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].PMax.Value);
                     /* todo: show the complete content of the schedule */
                 }
                 #undef SchedTuple0
@@ -288,44 +272,48 @@ void translateDocIso1ToJson(void) {
         if (iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryRes.DC_EVSEChargeParameter_isUsed) {
             //DC_EVSEChargeParameter
             //  DC_EVSEStatus
+            #if DATABINDING == DATABINDING_SLIM
+            #define cp (*iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryRes.DC_EVSEChargeParameter)
+            #else
             #define cp iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryRes.DC_EVSEChargeParameter
+            #endif
             #define v1 cp.DC_EVSEStatus.EVSEIsolationStatus
             #define v2 cp.DC_EVSEStatus.EVSEIsolationStatus_isUsed
             #define v3 cp.DC_EVSEStatus.EVSEStatusCode
             #define v4 cp.DC_EVSEStatus.NotificationMaxDelay /* expected time until the PEV reacts on the below mentioned notification. Not relevant. */
             #define v5 cp.DC_EVSEStatus.EVSENotification
-            sprintf(sTmp, "%d", v1); addProperty("DC_EVSEStatus.EVSEIsolationStatus", sTmp);
-            sprintf(sTmp, "%d", v2); addProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", sTmp);
-            sprintf(sTmp, "%d", v3); addProperty("DC_EVSEStatus.EVSEStatusCode", sTmp);
+            addIntProperty("DC_EVSEStatus.EVSEIsolationStatus", v1);
+            addIntProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", v2);
+            addIntProperty("DC_EVSEStatus.EVSEStatusCode", v3);
             translateiso1DC_EVSEStatusCodeTypeToJson(v3);
-            sprintf(sTmp, "%d", v4); addProperty("DC_EVSEStatus.NotificationMaxDelay", sTmp);
-            sprintf(sTmp, "%d", v5); addProperty("DC_EVSEStatus.EVSENotification", sTmp);
+            addIntProperty("DC_EVSEStatus.NotificationMaxDelay", v4);
+            addIntProperty("DC_EVSEStatus.EVSENotification", v5);
             #undef v1
             #undef v2
             #undef v3
             #undef v4
             #undef v5
             //  EVSEMaximumCurrentLimit
-            sprintf(sTmp, "%d", cp.EVSEMaximumCurrentLimit.Multiplier); addProperty("EVSEMaximumCurrentLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", cp.EVSEMaximumCurrentLimit.Value); addProperty("EVSEMaximumCurrentLimit.Value", sTmp);            
+            addIntProperty("EVSEMaximumCurrentLimit.Multiplier", cp.EVSEMaximumCurrentLimit.Multiplier);
+            addIntProperty("EVSEMaximumCurrentLimit.Value", cp.EVSEMaximumCurrentLimit.Value);            
             translateIso1UnitToJson("EVSEMaximumCurrentLimit.Unit", cp.EVSEMaximumCurrentLimit.Unit);
             
             //  EVSEMaximumPowerLimit
-            sprintf(sTmp, "%d", cp.EVSEMaximumPowerLimit.Multiplier); addProperty("EVSEMaximumPowerLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", cp.EVSEMaximumPowerLimit.Value); addProperty("EVSEMaximumPowerLimit.Value", sTmp);
+            addIntProperty("EVSEMaximumPowerLimit.Multiplier", cp.EVSEMaximumPowerLimit.Multiplier);
+            addIntProperty("EVSEMaximumPowerLimit.Value", cp.EVSEMaximumPowerLimit.Value);
             translateIso1UnitToJson("EVSEMaximumPowerLimit.Unit", cp.EVSEMaximumPowerLimit.Unit);
 
             //  EVSEMaximumVoltageLimit
-            sprintf(sTmp, "%d", cp.EVSEMaximumVoltageLimit.Multiplier); addProperty("EVSEMaximumVoltageLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", cp.EVSEMaximumVoltageLimit.Value); addProperty("EVSEMaximumVoltageLimit.Value", sTmp);
+            addIntProperty("EVSEMaximumVoltageLimit.Multiplier", cp.EVSEMaximumVoltageLimit.Multiplier);
+            addIntProperty("EVSEMaximumVoltageLimit.Value", cp.EVSEMaximumVoltageLimit.Value);
             translateIso1UnitToJson("EVSEMaximumVoltageLimit.Unit", cp.EVSEMaximumVoltageLimit.Unit);
             //  EVSEMinimumCurrentLimit
-            sprintf(sTmp, "%d", cp.EVSEMinimumCurrentLimit.Multiplier); addProperty("EVSEMinimumCurrentLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", cp.EVSEMinimumCurrentLimit.Value); addProperty("EVSEMinimumCurrentLimit.Value", sTmp);
+            addIntProperty("EVSEMinimumCurrentLimit.Multiplier", cp.EVSEMinimumCurrentLimit.Multiplier);
+            addIntProperty("EVSEMinimumCurrentLimit.Value", cp.EVSEMinimumCurrentLimit.Value);
             translateIso1UnitToJson("EVSEMinimumCurrentLimit.Unit", cp.EVSEMinimumCurrentLimit.Unit);
             //  EVSEMinimumVoltageLimit
-            sprintf(sTmp, "%d", cp.EVSEMinimumVoltageLimit.Multiplier); addProperty("EVSEMinimumVoltageLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", cp.EVSEMinimumVoltageLimit.Value); addProperty("EVSEMinimumVoltageLimit.Value", sTmp);
+            addIntProperty("EVSEMinimumVoltageLimit.Multiplier", cp.EVSEMinimumVoltageLimit.Multiplier);
+            addIntProperty("EVSEMinimumVoltageLimit.Value", cp.EVSEMinimumVoltageLimit.Value);
             translateIso1UnitToJson("EVSEMinimumVoltageLimit.Unit", cp.EVSEMinimumVoltageLimit.Unit);
             //  EVSECurrentRegulationTolerance
             //  EVSECurrentRegulationTolerance_isUsed
@@ -340,8 +328,8 @@ void translateDocIso1ToJson(void) {
     if (iso1Doc.V2G_Message.Body.CableCheckReq_isUsed) {
         addMessageName("CableCheckReq");
         #define m iso1Doc.V2G_Message.Body.CableCheckReq
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVRESSSOC); addProperty("DC_EVStatus.EVRESSSOC", sTmp);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVReady); addProperty("DC_EVStatus.EVReady", sTmp);
+        addIntProperty("DC_EVStatus.EVRESSSOC", m.DC_EVStatus.EVRESSSOC);
+        addIntProperty("DC_EVStatus.EVReady", m.DC_EVStatus.EVReady);
         #undef m
     }
     if (iso1Doc.V2G_Message.Body.CableCheckRes_isUsed) {
@@ -353,12 +341,12 @@ void translateDocIso1ToJson(void) {
         #define v3 m.DC_EVSEStatus.EVSEStatusCode
         #define v4 m.DC_EVSEStatus.NotificationMaxDelay /* expected time until the PEV reacts on the below mentioned notification. Not relevant. */
         #define v5 m.DC_EVSEStatus.EVSENotification
-        sprintf(sTmp, "%d", v1); addProperty("DC_EVSEStatus.EVSEIsolationStatus", sTmp);
-        sprintf(sTmp, "%d", v2); addProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", sTmp);
-        sprintf(sTmp, "%d", v3); addProperty("DC_EVSEStatus.EVSEStatusCode", sTmp);
+        addIntProperty("DC_EVSEStatus.EVSEIsolationStatus", v1);
+        addIntProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", v2);
+        addIntProperty("DC_EVSEStatus.EVSEStatusCode", v3);
         translateiso1DC_EVSEStatusCodeTypeToJson(v3);
-        sprintf(sTmp, "%d", v4); addProperty("DC_EVSEStatus.NotificationMaxDelay", sTmp);
-        sprintf(sTmp, "%d", v5); addProperty("DC_EVSEStatus.EVSENotification", sTmp);
+        addIntProperty("DC_EVSEStatus.NotificationMaxDelay", v4);
+        addIntProperty("DC_EVSEStatus.EVSENotification", v5);
         #undef v1
         #undef v2
         #undef v3
@@ -376,17 +364,17 @@ void translateDocIso1ToJson(void) {
     if (iso1Doc.V2G_Message.Body.PreChargeReq_isUsed) {
         addMessageName("PreChargeReq");
         #define m iso1Doc.V2G_Message.Body.PreChargeReq
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVReady); addProperty("DC_EVStatus.EVReady", sTmp);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVErrorCode); addProperty("DC_EVStatus.EVErrorCode", sTmp);
+        addIntProperty("DC_EVStatus.EVReady", m.DC_EVStatus.EVReady);
+        addIntProperty("DC_EVStatus.EVErrorCode", m.DC_EVStatus.EVErrorCode);
         translateiso1DC_EVErrorCodeTypeToJson(m.DC_EVStatus.EVErrorCode);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVRESSSOC); addProperty("DC_EVStatus.EVRESSSOC", sTmp);
+        addIntProperty("DC_EVStatus.EVRESSSOC", m.DC_EVStatus.EVRESSSOC);
 
-        sprintf(sTmp, "%d", m.EVTargetVoltage.Multiplier); addProperty("EVTargetVoltage.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVTargetVoltage.Value); addProperty("EVTargetVoltage.Value", sTmp);
+        addIntProperty("EVTargetVoltage.Multiplier", m.EVTargetVoltage.Multiplier);
+        addIntProperty("EVTargetVoltage.Value", m.EVTargetVoltage.Value);
         translateIso1UnitToJson("EVTargetVoltage.Unit", m.EVTargetVoltage.Unit);
                         
-        sprintf(sTmp, "%d", m.EVTargetCurrent.Multiplier); addProperty("EVTargetCurrent.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVTargetCurrent.Value); addProperty("EVTargetCurrent.Value", sTmp);
+        addIntProperty("EVTargetCurrent.Multiplier", m.EVTargetCurrent.Multiplier);
+        addIntProperty("EVTargetCurrent.Value", m.EVTargetCurrent.Value);
         translateIso1UnitToJson("EVTargetCurrent.Unit", m.EVTargetCurrent.Unit);
 
         #undef m
@@ -400,15 +388,15 @@ void translateDocIso1ToJson(void) {
         #define v3 m.DC_EVSEStatus.EVSEStatusCode
         #define v4 m.DC_EVSEStatus.NotificationMaxDelay /* expected time until the PEV reacts on the below mentioned notification. Not relevant. */
         #define v5 m.DC_EVSEStatus.EVSENotification
-        sprintf(sTmp, "%d", v1); addProperty("DC_EVSEStatus.EVSEIsolationStatus", sTmp);
-        sprintf(sTmp, "%d", v2); addProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", sTmp);
-        sprintf(sTmp, "%d", v3); addProperty("DC_EVSEStatus.EVSEStatusCode", sTmp);
+        addIntProperty("DC_EVSEStatus.EVSEIsolationStatus", v1);
+        addIntProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", v2);
+        addIntProperty("DC_EVSEStatus.EVSEStatusCode", v3);
         translateiso1DC_EVSEStatusCodeTypeToJson(v3);
-        sprintf(sTmp, "%d", v4); addProperty("DC_EVSEStatus.NotificationMaxDelay", sTmp);
-        sprintf(sTmp, "%d", v5); addProperty("DC_EVSEStatus.EVSENotification", sTmp);
+        addIntProperty("DC_EVSEStatus.NotificationMaxDelay", v4);
+        addIntProperty("DC_EVSEStatus.EVSENotification", v5);
         
-        sprintf(sTmp, "%d", m.EVSEPresentVoltage.Multiplier); addProperty("EVSEPresentVoltage.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVSEPresentVoltage.Value); addProperty("EVSEPresentVoltage.Value", sTmp);
+        addIntProperty("EVSEPresentVoltage.Multiplier", m.EVSEPresentVoltage.Multiplier);
+        addIntProperty("EVSEPresentVoltage.Value", m.EVSEPresentVoltage.Value);
         translateIso1UnitToJson("EVSEPresentVoltage.Unit", m.EVSEPresentVoltage.Unit); /* why is this shown as 0? Because unit is optional, see question2. */
 
         #undef v1
@@ -420,15 +408,15 @@ void translateDocIso1ToJson(void) {
     }
     if (iso1Doc.V2G_Message.Body.PowerDeliveryReq_isUsed) {
         addMessageName("PowerDeliveryReq");
-        sprintf(sTmp, "%d", iso1Doc.V2G_Message.Body.PowerDeliveryReq.ChargeProgress); addProperty("ChargeProgress", sTmp);
+        addIntProperty("ChargeProgress", iso1Doc.V2G_Message.Body.PowerDeliveryReq.ChargeProgress);
 
         if (iso1Doc.V2G_Message.Body.PowerDeliveryReq.ChargeProgress==0) { addProperty("ChargeProgress_Text", "0"); }
         if (iso1Doc.V2G_Message.Body.PowerDeliveryReq.ChargeProgress==1) { addProperty("ChargeProgress_Text", "1"); }
         /*if (iso1Doc.V2G_Message.Body.PowerDeliveryReq.ChargeProgress==2) { addProperty("ChargeProgress", "2"); } */
         
-        sprintf(sTmp, "%d", iso1Doc.V2G_Message.Body.PowerDeliveryReq.ChargingProfile_isUsed); addProperty("ChargingProfile_isUsed", sTmp);
-        sprintf(sTmp, "%d", iso1Doc.V2G_Message.Body.PowerDeliveryReq.EVPowerDeliveryParameter_isUsed); addProperty("EVPowerDeliveryParameter_isUsed", sTmp);
-        sprintf(sTmp, "%d", iso1Doc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter_isUsed); addProperty("DC_EVPowerDeliveryParameter_isUsed", sTmp);
+        addIntProperty("ChargingProfile_isUsed", iso1Doc.V2G_Message.Body.PowerDeliveryReq.ChargingProfile_isUsed);
+        addIntProperty("EVPowerDeliveryParameter_isUsed", iso1Doc.V2G_Message.Body.PowerDeliveryReq.EVPowerDeliveryParameter_isUsed);
+        addIntProperty("DC_EVPowerDeliveryParameter_isUsed", iso1Doc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter_isUsed);
         if (iso1Doc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter_isUsed) {
             #define v1 iso1Doc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.DC_EVStatus.EVReady
             #define v2 iso1Doc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.DC_EVStatus.EVErrorCode
@@ -437,16 +425,16 @@ void translateDocIso1ToJson(void) {
             #define v4used iso1Doc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.BulkChargingComplete_isUsed
             #define v5 iso1Doc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.ChargingComplete
 
-            sprintf(sTmp, "%d", v1); addProperty("EVReady", sTmp);
-            sprintf(sTmp, "%d", v2); addProperty("EVErrorCode", sTmp);
+            addIntProperty("EVReady", v1);
+            addIntProperty("EVErrorCode", v2);
             translateiso1DC_EVErrorCodeTypeToJson(v2);
             
-            sprintf(sTmp, "%d", v3); addProperty("EVRESSSOC", sTmp);
-            sprintf(sTmp, "%d", v4used); addProperty("BulkChargingComplete_isUsed", sTmp);
+            addIntProperty("EVRESSSOC", v3);
+            addIntProperty("BulkChargingComplete_isUsed", v4used);
             if (v4used) {
-              sprintf(sTmp, "%d", v4); addProperty("BulkChargingComplete", sTmp);
+              addIntProperty("BulkChargingComplete", v4);
             }
-            sprintf(sTmp, "%d", v5); addProperty("ChargingComplete", sTmp);
+            addIntProperty("ChargingComplete", v5);
 
             #undef v1
             #undef v2
@@ -468,12 +456,12 @@ void translateDocIso1ToJson(void) {
             #define v3 m.DC_EVSEStatus.EVSEStatusCode
             #define v4 m.DC_EVSEStatus.NotificationMaxDelay /* expected time until the PEV reacts on the below mentioned notification. Not relevant. */
             #define v5 m.DC_EVSEStatus.EVSENotification
-            sprintf(sTmp, "%d", v1); addProperty("DC_EVSEStatus.EVSEIsolationStatus", sTmp);
-            sprintf(sTmp, "%d", v2); addProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", sTmp);
-            sprintf(sTmp, "%d", v3); addProperty("DC_EVSEStatus.EVSEStatusCode", sTmp);
+            addIntProperty("DC_EVSEStatus.EVSEIsolationStatus", v1);
+            addIntProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", v2);
+            addIntProperty("DC_EVSEStatus.EVSEStatusCode", v3);
             translateiso1DC_EVSEStatusCodeTypeToJson(v3);
-            sprintf(sTmp, "%d", v4); addProperty("DC_EVSEStatus.NotificationMaxDelay", sTmp);
-            sprintf(sTmp, "%d", v5); addProperty("DC_EVSEStatus.EVSENotification", sTmp);
+            addIntProperty("DC_EVSEStatus.NotificationMaxDelay", v4);
+            addIntProperty("DC_EVSEStatus.EVSENotification", v5);
             #undef m
             #undef v1
             #undef v2
@@ -486,42 +474,42 @@ void translateDocIso1ToJson(void) {
     if (iso1Doc.V2G_Message.Body.CurrentDemandReq_isUsed) {
         addMessageName("CurrentDemandReq");
         #define m iso1Doc.V2G_Message.Body.CurrentDemandReq
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVReady); addProperty("DC_EVStatus.EVReady", sTmp);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVErrorCode); addProperty("DC_EVStatus.EVErrorCode", sTmp);
+        addIntProperty("DC_EVStatus.EVReady", m.DC_EVStatus.EVReady);
+        addIntProperty("DC_EVStatus.EVErrorCode", m.DC_EVStatus.EVErrorCode);
         translateiso1DC_EVErrorCodeTypeToJson(m.DC_EVStatus.EVErrorCode);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVRESSSOC); addProperty("DC_EVStatus.EVRESSSOC", sTmp);
+        addIntProperty("DC_EVStatus.EVRESSSOC", m.DC_EVStatus.EVRESSSOC);
 
-        sprintf(sTmp, "%d", m.EVTargetCurrent.Multiplier); addProperty("EVTargetCurrent.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVTargetCurrent.Value); addProperty("EVTargetCurrent.Value", sTmp);
+        addIntProperty("EVTargetCurrent.Multiplier", m.EVTargetCurrent.Multiplier);
+        addIntProperty("EVTargetCurrent.Value", m.EVTargetCurrent.Value);
         translateIso1UnitToJson("EVTargetCurrent.Unit", m.EVTargetCurrent.Unit);
 
-        sprintf(sTmp, "%d", m.EVMaximumVoltageLimit_isUsed); addProperty("EVMaximumVoltageLimit_isUsed", sTmp);
+        addIntProperty("EVMaximumVoltageLimit_isUsed", m.EVMaximumVoltageLimit_isUsed);
         if (m.EVMaximumVoltageLimit_isUsed) {
-          sprintf(sTmp, "%d", m.EVMaximumVoltageLimit.Multiplier); addProperty("EVMaximumVoltageLimit.Multiplier", sTmp);
-          sprintf(sTmp, "%d", m.EVMaximumVoltageLimit.Value); addProperty("EVMaximumVoltageLimit.Value", sTmp);
+          addIntProperty("EVMaximumVoltageLimit.Multiplier", m.EVMaximumVoltageLimit.Multiplier);
+          addIntProperty("EVMaximumVoltageLimit.Value", m.EVMaximumVoltageLimit.Value);
           translateIso1UnitToJson("EVMaximumVoltageLimit.Unit", m.EVMaximumVoltageLimit.Unit);
         }
 
-        sprintf(sTmp, "%d", m.EVMaximumCurrentLimit_isUsed); addProperty("EVMaximumCurrentLimit_isUsed", sTmp);
+        addIntProperty("EVMaximumCurrentLimit_isUsed", m.EVMaximumCurrentLimit_isUsed);
         if (m.EVMaximumCurrentLimit_isUsed) {
-          sprintf(sTmp, "%d", m.EVMaximumCurrentLimit.Multiplier); addProperty("EVMaximumCurrentLimit.Multiplier", sTmp);
-          sprintf(sTmp, "%d", m.EVMaximumCurrentLimit.Value); addProperty("EVMaximumCurrentLimit.Value", sTmp);
+          addIntProperty("EVMaximumCurrentLimit.Multiplier", m.EVMaximumCurrentLimit.Multiplier);
+          addIntProperty("EVMaximumCurrentLimit.Value", m.EVMaximumCurrentLimit.Value);
           translateIso1UnitToJson("EVMaximumCurrentLimit.Unit", m.EVMaximumCurrentLimit.Unit);
         }
         
-        sprintf(sTmp, "%d", m.EVMaximumPowerLimit_isUsed); addProperty("EVMaximumPowerLimit_isUsed", sTmp);
+        addIntProperty("EVMaximumPowerLimit_isUsed", m.EVMaximumPowerLimit_isUsed);
         if (m.EVMaximumPowerLimit_isUsed) {
-          sprintf(sTmp, "%d", m.EVMaximumPowerLimit.Multiplier); addProperty("EVMaximumPowerLimit.Multiplier", sTmp);
-          sprintf(sTmp, "%d", m.EVMaximumPowerLimit.Value); addProperty("EVMaximumPowerLimit.Value", sTmp);
+          addIntProperty("EVMaximumPowerLimit.Multiplier", m.EVMaximumPowerLimit.Multiplier);
+          addIntProperty("EVMaximumPowerLimit.Value", m.EVMaximumPowerLimit.Value);
           translateIso1UnitToJson("EVMaximumPowerLimit.Unit", m.EVMaximumPowerLimit.Unit); 
         }
         
         //m.BulkChargingComplete_isUsed
         //m.BulkChargingComplete
-        sprintf(sTmp, "%d", m.ChargingComplete); addProperty("ChargingComplete", sTmp);
+        addIntProperty("ChargingComplete", m.ChargingComplete);
 
-        sprintf(sTmp, "%d", m.EVTargetVoltage.Multiplier); addProperty("EVTargetVoltage.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVTargetVoltage.Value); addProperty("EVTargetVoltage.Value", sTmp);
+        addIntProperty("EVTargetVoltage.Multiplier", m.EVTargetVoltage.Multiplier);
+        addIntProperty("EVTargetVoltage.Value", m.EVTargetVoltage.Value);
         translateIso1UnitToJson("EVTargetVoltage.Unit", m.EVTargetVoltage.Unit); 
         #undef m
     }
@@ -535,41 +523,41 @@ void translateDocIso1ToJson(void) {
             #define v3 m.DC_EVSEStatus.EVSEStatusCode
             #define v4 m.DC_EVSEStatus.NotificationMaxDelay /* expected time until the PEV reacts on the below mentioned notification. Not relevant. */
             #define v5 m.DC_EVSEStatus.EVSENotification
-            sprintf(sTmp, "%d", v1); addProperty("DC_EVSEStatus.EVSEIsolationStatus", sTmp);
-            sprintf(sTmp, "%d", v2); addProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", sTmp);
-            sprintf(sTmp, "%d", v3); addProperty("DC_EVSEStatus.EVSEStatusCode", sTmp);
+            addIntProperty("DC_EVSEStatus.EVSEIsolationStatus", v1);
+            addIntProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", v2);
+            addIntProperty("DC_EVSEStatus.EVSEStatusCode", v3);
             translateiso1DC_EVSEStatusCodeTypeToJson(v3);
-            sprintf(sTmp, "%d", v4); addProperty("DC_EVSEStatus.NotificationMaxDelay", sTmp);
-            sprintf(sTmp, "%d", v5); addProperty("DC_EVSEStatus.EVSENotification", sTmp);
+            addIntProperty("DC_EVSEStatus.NotificationMaxDelay", v4);
+            addIntProperty("DC_EVSEStatus.EVSENotification", v5);
             #undef v1
             #undef v2
             #undef v3
             #undef v4
             #undef v5
-        sprintf(sTmp, "%d", m.EVSEPresentVoltage.Multiplier); addProperty("EVSEPresentVoltage.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVSEPresentVoltage.Value); addProperty("EVSEPresentVoltage.Value", sTmp);
+        addIntProperty("EVSEPresentVoltage.Multiplier", m.EVSEPresentVoltage.Multiplier);
+        addIntProperty("EVSEPresentVoltage.Value", m.EVSEPresentVoltage.Value);
         translateIso1UnitToJson("EVSEPresentVoltage.Unit", m.EVSEPresentVoltage.Unit); 
 
-        sprintf(sTmp, "%d", m.EVSEPresentCurrent.Multiplier); addProperty("EVSEPresentCurrent.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVSEPresentCurrent.Value); addProperty("EVSEPresentCurrent.Value", sTmp);
+        addIntProperty("EVSEPresentCurrent.Multiplier", m.EVSEPresentCurrent.Multiplier);
+        addIntProperty("EVSEPresentCurrent.Value", m.EVSEPresentCurrent.Value);
         translateIso1UnitToJson("EVSEPresentCurrent.Unit", m.EVSEPresentCurrent.Unit); 
 
-        sprintf(sTmp, "%d", m.EVSECurrentLimitAchieved); addProperty("EVSECurrentLimitAchieved", sTmp);
-        sprintf(sTmp, "%d", m.EVSEVoltageLimitAchieved); addProperty("EVSEVoltageLimitAchieved", sTmp);
-        sprintf(sTmp, "%d", m.EVSEPowerLimitAchieved); addProperty("EVSEPowerLimitAchieved", sTmp);
+        addIntProperty("EVSECurrentLimitAchieved", m.EVSECurrentLimitAchieved);
+        addIntProperty("EVSEVoltageLimitAchieved", m.EVSEVoltageLimitAchieved);
+        addIntProperty("EVSEPowerLimitAchieved", m.EVSEPowerLimitAchieved);
 
-        sprintf(sTmp, "%d", m.EVSEMaximumVoltageLimit.Multiplier); addProperty("EVSEMaximumVoltageLimit.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVSEMaximumVoltageLimit.Value); addProperty("EVSEMaximumVoltageLimit.Value", sTmp);
+        addIntProperty("EVSEMaximumVoltageLimit.Multiplier", m.EVSEMaximumVoltageLimit.Multiplier);
+        addIntProperty("EVSEMaximumVoltageLimit.Value", m.EVSEMaximumVoltageLimit.Value);
         translateIso1UnitToJson("EVSEMaximumVoltageLimit.Unit", m.EVSEMaximumVoltageLimit.Unit); 
 
         if (m.EVSEMaximumCurrentLimit_isUsed) {
-            sprintf(sTmp, "%d", m.EVSEMaximumCurrentLimit.Multiplier); addProperty("EVSEMaximumCurrentLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.EVSEMaximumCurrentLimit.Value); addProperty("EVSEMaximumCurrentLimit.Value", sTmp);
+            addIntProperty("EVSEMaximumCurrentLimit.Multiplier", m.EVSEMaximumCurrentLimit.Multiplier);
+            addIntProperty("EVSEMaximumCurrentLimit.Value", m.EVSEMaximumCurrentLimit.Value);
             translateIso1UnitToJson("EVSEMaximumCurrentLimit.Unit", m.EVSEMaximumCurrentLimit.Unit); 
         }
         if (m.EVSEMaximumPowerLimit_isUsed) {
-            sprintf(sTmp, "%d", m.EVSEMaximumPowerLimit.Multiplier); addProperty("EVSEMaximumPowerLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.EVSEMaximumPowerLimit.Value); addProperty("EVSEMaximumPowerLimit.Value", sTmp);
+            addIntProperty("EVSEMaximumPowerLimit.Multiplier", m.EVSEMaximumPowerLimit.Multiplier);
+            addIntProperty("EVSEMaximumPowerLimit.Value", m.EVSEMaximumPowerLimit.Value);
             translateIso1UnitToJson("EVSEMaximumPowerLimit.Unit", m.EVSEMaximumPowerLimit.Unit); 
         }
         #undef m
@@ -586,10 +574,10 @@ void translateDocIso1ToJson(void) {
     if (iso1Doc.V2G_Message.Body.WeldingDetectionReq_isUsed) {
         addMessageName("WeldingDetectionReq");
         #define m iso1Doc.V2G_Message.Body.WeldingDetectionReq
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVReady); addProperty("DC_EVStatus.EVReady", sTmp);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVErrorCode); addProperty("DC_EVStatus.EVErrorCode", sTmp);
+        addIntProperty("DC_EVStatus.EVReady", m.DC_EVStatus.EVReady);
+        addIntProperty("DC_EVStatus.EVErrorCode", m.DC_EVStatus.EVErrorCode);
         translateiso1DC_EVErrorCodeTypeToJson(m.DC_EVStatus.EVErrorCode);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVRESSSOC); addProperty("DC_EVStatus.EVRESSSOC", sTmp);    
+        addIntProperty("DC_EVStatus.EVRESSSOC", m.DC_EVStatus.EVRESSSOC);    
         #undef m
     }
     if (iso1Doc.V2G_Message.Body.WeldingDetectionRes_isUsed) {
@@ -601,14 +589,14 @@ void translateDocIso1ToJson(void) {
         #define v3 m.DC_EVSEStatus.EVSEStatusCode
         #define v4 m.DC_EVSEStatus.NotificationMaxDelay /* expected time until the PEV reacts on the below mentioned notification. Not relevant. */
         #define v5 m.DC_EVSEStatus.EVSENotification
-        sprintf(sTmp, "%d", v1); addProperty("DC_EVSEStatus.EVSEIsolationStatus", sTmp);
-        sprintf(sTmp, "%d", v2); addProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", sTmp);
-        sprintf(sTmp, "%d", v3); addProperty("DC_EVSEStatus.EVSEStatusCode", sTmp);
+        addIntProperty("DC_EVSEStatus.EVSEIsolationStatus", v1);
+        addIntProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", v2);
+        addIntProperty("DC_EVSEStatus.EVSEStatusCode", v3);
         translateiso1DC_EVSEStatusCodeTypeToJson(v3);
-        sprintf(sTmp, "%d", v4); addProperty("DC_EVSEStatus.NotificationMaxDelay", sTmp);
-        sprintf(sTmp, "%d", v5); addProperty("DC_EVSEStatus.EVSENotification", sTmp);
-        sprintf(sTmp, "%d", m.EVSEPresentVoltage.Multiplier); addProperty("EVSEPresentVoltage.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVSEPresentVoltage.Value); addProperty("EVSEPresentVoltage.Value", sTmp);
+        addIntProperty("DC_EVSEStatus.NotificationMaxDelay", v4);
+        addIntProperty("DC_EVSEStatus.EVSENotification", v5);
+        addIntProperty("EVSEPresentVoltage.Multiplier", m.EVSEPresentVoltage.Multiplier);
+        addIntProperty("EVSEPresentVoltage.Value", m.EVSEPresentVoltage.Value);
         translateIso1UnitToJson("EVSEPresentVoltage.Unit", m.EVSEPresentVoltage.Unit); 
         #undef v1
         #undef v2
@@ -664,6 +652,7 @@ void encodeIso1SessionSetupResponse(void) {
     */
     iso1Doc.V2G_Message.Body.SessionSetupRes.ResponseCode = dinresponseCodeType_OK_NewSessionEstablished;
     /* EVSEID has min length 7, max length 37 for ISO. In DIN decoder we find maxsize 32. */
+    allocateValue(iso1Doc.V2G_Message.Body.SessionSetupRes.EVSEID.characters, 7);
     iso1Doc.V2G_Message.Body.SessionSetupRes.EVSEID.characters[0] = 'Z';
     iso1Doc.V2G_Message.Body.SessionSetupRes.EVSEID.characters[1] = 'Z';
     iso1Doc.V2G_Message.Body.SessionSetupRes.EVSEID.characters[2] = '0';
@@ -754,8 +743,10 @@ void encodeIso1ChargeParameterDiscoveryResponse(void) {
        So we set it here. */
     iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryRes.SAScheduleList_isUsed = 1u;
     iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryRes.SAScheduleList.SAScheduleTuple.arrayLen = 1;
+    allocateValue(iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryRes.SAScheduleList.SAScheduleTuple.array, 1);
     #define SchedTuple0 iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryRes.SAScheduleList.SAScheduleTuple.array[0]
     SchedTuple0.SAScheduleTupleID = 0;
+    allocateValue(SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array, 1);
     SchedTuple0.PMaxSchedule.PMaxScheduleEntry.arrayLen = 1;
     SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].TimeInterval_isUsed = 0;
     SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed = 1; /* at least one of TimeInterval and RelativeTimeInterval is
@@ -770,7 +761,11 @@ void encodeIso1ChargeParameterDiscoveryResponse(void) {
     cp->noContent = 0;
     iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryRes.EVSEChargeParameter_isUsed=0;
     
+#if DATABINDING == DATABINDING_SLIM
+    cpdc = allocateValue(iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryRes.DC_EVSEChargeParameter, 1);
+#else
     cpdc = &iso1Doc.V2G_Message.Body.ChargeParameterDiscoveryRes.DC_EVSEChargeParameter;
+#endif
     
     /* https://github.com/SmartEVSE/SmartEVSE-3/issues/25#issuecomment-1666231234
        Public chargers are reporting "invalid", which means, the isolation check has not
@@ -30,19 +30,61 @@
 #define CODE_VERSION_SAMPLE 2
 #define CODE_VERSION_COMMANDLINE 3
 
+/* may also be given on the compiler command line, e.g. -DCODE_VERSION=CODE_VERSION_SAMPLE for OpenV2G_example.exe */
+#ifndef CODE_VERSION
 //#define CODE_VERSION CODE_VERSION_SAMPLE
 //#define CODE_VERSION CODE_VERSION_EXI
 #define CODE_VERSION CODE_VERSION_COMMANDLINE
+#endif
+
+/** Server and batch mode - Option not available */
+#define CODE_SERVER_NO 0
+/** Server and batch mode - Option worker pool daemon "OpenV2G.exe S", parallel batch decoder "OpenV2G.exe B" and capture analyzer "OpenV2G.exe P" (POSIX threads, Unix sockets) */
+#define CODE_SERVER_YES 1
+
+#ifdef _WIN32
+#define CODE_SERVER CODE_SERVER_NO
+#else
+#define CODE_SERVER CODE_SERVER_YES
+#endif
 
 #ifndef MAIN_H_
 #define MAIN_H_
 
+#include <stdint.h>
+
 #if CODE_VERSION == CODE_VERSION_EXI
 int main_databinder(int argc, char *argv[]);
 #elif CODE_VERSION == CODE_VERSION_SAMPLE
 int main_example(int argc, char *argv[]);
 #elif CODE_VERSION == CODE_VERSION_COMMANDLINE
 int main_commandline(int argc, char *argv[]);
+int commandline_processCommand(char* command, char* json, int jsonSize);
+int commandline_processExi(char schema, uint8_t* exi, int exiLength, char* json, int jsonSize);
+int commandline_getEncodedStream(uint8_t** exi, int* exiLength);
+void commandline_releaseThread(void);
+#if CODE_SERVER == CODE_SERVER_YES
+#include <stdio.h>
+#include <stddef.h>
+
+/* input formats of the batch pipeline (main_batch.c) */
+#define BATCH_FORMAT_LINES 'B'
+#define BATCH_FORMAT_RECORDS 'R'
+#define BATCH_FORMAT_TAGGED_RECORDS 'T'
+/* input bytes per job, more if a message is longer */
+#define BATCH_READ_SIZE 16384
+
+/* Appends the next input to *input (grown with batch_reserve), about BATCH_READ_SIZE bytes or more. The input may end
+   in the middle of a message. Returns 1, 0 at the end of the input, or -1 for an error. */
+typedef int (*batchFill_t)(void* context, char** input, size_t* inputLength, size_t* inputSize);
+
+int main_server(int argc, char *argv[]);
+int main_batch(int argc, char *argv[]);
+int main_pcap(int argc, char *argv[]);
+int batch_run(char format, int nWorkers, batchFill_t fill, void* context, FILE* out);
+int batch_workers(const char* count);
+void batch_reserve(char** buffer, size_t* size, size_t needed);
+#endif
 #endif
 
 #endif
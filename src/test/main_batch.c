@@ -0,0 +1,429 @@
+/*******************************************************************
+ * Batch mode for OpenV2G: decodes a file of EXI messages on several
+ * worker threads, and writes the results in the order of the input.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+/* Usage:
+     OpenV2G.exe B[<workers>] <inputFile> [<outputFile>]    one message per line: schema and hex, e.g. "D809a0011..."
+     OpenV2G.exe R[<workers>] <inputFile> [<outputFile>]    binary records: schema, 4 byte length (big endian), EXI message
+   e.g. "OpenV2G.exe B8 messages.txt results.jsonl" decodes with 8 worker threads. Without the number, there is one
+   worker per CPU. The input file "-" is stdin, and without the output file the results go to stdout.
+
+   The schema is H (applicationHandshake), D (DIN), 1 (ISO1) or 2 (ISO2). Each message gives one JSON object in one
+   line (JSON Lines), the same as the streaming mode prints for the command "D<schema><hex>". Empty lines are skipped.
+
+   The reader cuts the input into jobs of complete messages, and puts them into a ring of job slots. The workers take
+   the jobs in the order of the input, each worker with its own documents (see CLI_THREAD_LOCAL in
+   main_commandlineinterface.c). The reader writes the results of the oldest job as soon as it is done, so the output
+   is in the order of the input, and the memory stays bounded by the number of slots, whatever the size of the input.
+
+   The capture analyzer (main_pcap.c) feeds the same pipeline with tagged records (BATCH_FORMAT_TAGGED_RECORDS):
+   schema, 4 byte EXI length, 2 byte tag length (big endian), the tag and the EXI message. The tag holds JSON members,
+   e.g. "time": "...", which are put in front of the members of the decoded message.
+*/
+
+#include "main.h"
+
+#if CODE_VERSION == CODE_VERSION_COMMANDLINE && CODE_SERVER == CODE_SERVER_YES
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#define BATCH_MAX_WORKERS 64
+#define BATCH_SLOTS_PER_WORKER 4
+#define BATCH_MAX_MESSAGE_LENGTH (1024*1024) /* longest accepted line or record */
+#define BATCH_JSON_SIZE 50000
+#define BATCH_RECORD_HEADER_LENGTH 5 /* schema and length */
+#define BATCH_TAGGED_RECORD_HEADER_LENGTH 7 /* schema, length and tag length */
+
+struct batchJob {
+    char* input; /* complete messages */
+    size_t inputLength;
+    size_t inputSize;
+    char* output; /* one JSON object per line */
+    size_t outputLength;
+    size_t outputSize;
+    int done;
+};
+
+struct batchWorker {
+    pthread_t thread;
+    char* command; /* "D<schema><hex>" of the current line */
+    size_t commandSize;
+    char json[BATCH_JSON_SIZE];
+};
+
+static char format; /* BATCH_FORMAT_LINES, _RECORDS or _TAGGED_RECORDS */
+static struct batchJob* jobs;
+static int nSlots;
+/* jobs filled by the reader, taken by the workers, and written by the reader, counted since the start */
+static unsigned long nFilled, nTaken, nWritten;
+static int stopping;
+static pthread_mutex_t batchLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t workCond = PTHREAD_COND_INITIALIZER; /* a job was filled, or stopping */
+static pthread_cond_t doneCond = PTHREAD_COND_INITIALIZER; /* a job is done */
+
+static uint32_t readUint32(const uint8_t* p) {
+    return ((uint32_t)p[0]<<24) | ((uint32_t)p[1]<<16) | ((uint32_t)p[2]<<8) | p[3];
+}
+
+/* grow a buffer to at least needed bytes */
+void batch_reserve(char** buffer, size_t* size, size_t needed) {
+    size_t n = (*size>0) ? *size : 1024;
+    char* p;
+    if (needed<=*size) {
+        return;
+    }
+    while (n<needed) {
+        n *= 2;
+    }
+    p = realloc(*buffer, n);
+    if (p==NULL) {
+        fprintf(stderr, "OpenV2G batch: out of memory\n");
+        exit(1);
+    }
+    *buffer = p;
+    *size = n;
+}
+
+/* length of the complete messages at the start of data. At the end of the input, a last line without line feed
+   is complete as well. */
+static size_t completeLength(const char* data, size_t length, int eof) {
+    size_t pos = 0;
+    size_t header = (format==BATCH_FORMAT_RECORDS) ? BATCH_RECORD_HEADER_LENGTH : BATCH_TAGGED_RECORD_HEADER_LENGTH;
+    uint32_t n;
+    if (format==BATCH_FORMAT_LINES) {
+        if (eof) {
+            return length;
+        }
+        while (length>0 && data[length-1]!='\n') {
+            length--;
+        }
+        return length;
+    }
+    while (length-pos>=header) {
+        n = readUint32((const uint8_t*)&data[pos+1]);
+        if (format==BATCH_FORMAT_TAGGED_RECORDS) {
+            n += ((uint8_t)data[pos+5]<<8) | (uint8_t)data[pos+6];
+        }
+        if (n>length-pos-header) {
+            break;
+        }
+        pos += header+n;
+    }
+    return pos;
+}
+
+/* append the JSON as one line, without the line breaks of the pretty printed JSON. The tag members come first. */
+static void appendJsonLine(struct batchJob* job, const char* tag, int tagLength, const char* json, int n) {
+    int i = 0;
+    char* out;
+    batch_reserve(&job->output, &job->outputSize, job->outputLength+tagLength+n+3);
+    out = &job->output[job->outputLength];
+    if (tagLength>0) {
+        *out++ = '{';
+        memcpy(out, tag, tagLength);
+        out += tagLength;
+        *out++ = ',';
+        i = 1; /* the opening brace of the JSON */
+    }
+    for (; i<n; i++) {
+        if (json[i]!='\n' && json[i]!='\r') {
+            *out++ = json[i];
+        }
+    }
+    *out++ = '\n';
+    job->outputLength = out-job->output;
+}
+
+static void decodeJob(struct batchWorker* w, struct batchJob* job) {
+    char* p = job->input;
+    char* end = job->input+job->inputLength;
+    char* lineEnd;
+    size_t len;
+    uint32_t exiLength;
+    uint16_t tagLength;
+    int n;
+
+    job->outputLength = 0;
+    while (p<end) {
+        if (format==BATCH_FORMAT_LINES) {
+            lineEnd = memchr(p, '\n', end-p);
+            if (lineEnd==NULL) {
+                lineEnd = end;
+            }
+            len = lineEnd-p;
+            if (len>0 && p[len-1]=='\r') {
+                len--;
+            }
+            if (len>0) {
+                batch_reserve(&w->command, &w->commandSize, len+2);
+                w->command[0] = 'D';
+                memcpy(&w->command[1], p, len);
+                w->command[len+1] = 0;
+                n = commandline_processCommand(w->command, w->json, BATCH_JSON_SIZE);
+                appendJsonLine(job, NULL, 0, w->json, (n<0) ? (int)strlen(w->json) : n);
+            }
+            p = lineEnd+1;
+        } else if (format==BATCH_FORMAT_RECORDS) {
+            /* the reader hands out complete records only, still a record must not run past the job */
+            if ((size_t)(end-p)<BATCH_RECORD_HEADER_LENGTH) {
+                break;
+            }
+            exiLength = readUint32((const uint8_t*)&p[1]);
+            if (exiLength>(size_t)(end-p)-BATCH_RECORD_HEADER_LENGTH) {
+                break;
+            }
+            n = commandline_processExi(p[0], (uint8_t*)&p[BATCH_RECORD_HEADER_LENGTH], exiLength, w->json, BATCH_JSON_SIZE);
+            appendJsonLine(job, NULL, 0, w->json, (n<0) ? (int)strlen(w->json) : n);
+            p += BATCH_RECORD_HEADER_LENGTH+exiLength;
+        } else {
+            if ((size_t)(end-p)<BATCH_TAGGED_RECORD_HEADER_LENGTH) {
+                break;
+            }
+            exiLength = readUint32((const uint8_t*)&p[1]);
+            tagLength = (uint16_t)(((uint8_t)p[5]<<8) | (uint8_t)p[6]);
+            if (tagLength>(size_t)(end-p)-BATCH_TAGGED_RECORD_HEADER_LENGTH
+                || exiLength>(size_t)(end-p)-BATCH_TAGGED_RECORD_HEADER_LENGTH-tagLength) {
+                break;
+            }
+            n = commandline_processExi(p[0], (uint8_t*)&p[BATCH_TAGGED_RECORD_HEADER_LENGTH+tagLength], exiLength, w->json, BATCH_JSON_SIZE);
+            appendJsonLine(job, &p[BATCH_TAGGED_RECORD_HEADER_LENGTH], tagLength, w->json, (n<0) ? (int)strlen(w->json) : n);
+            p += BATCH_TAGGED_RECORD_HEADER_LENGTH+tagLength+exiLength;
+        }
+    }
+}
+
+static void* workerMain(void* arg) {
+    struct batchWorker* w = arg;
+    struct batchJob* job;
+    pthread_mutex_lock(&batchLock);
+    for (;;) {
+        while (nTaken==nFilled && !stopping) {
+            pthread_cond_wait(&workCond, &batchLock);
+        }
+        if (nTaken==nFilled) {
+            break; /* stopping and no job left */
+        }
+        job = &jobs[nTaken % nSlots];
+        nTaken++;
+        pthread_mutex_unlock(&batchLock);
+
+        decodeJob(w, job);
+
+        pthread_mutex_lock(&batchLock);
+        job->done = 1;
+        pthread_cond_signal(&doneCond);
+    }
+    pthread_mutex_unlock(&batchLock);
+    commandline_releaseThread();
+    return NULL;
+}
+
+/* The input file of the B and R modes */
+struct batchFile {
+    FILE* in;
+};
+
+static int fillFromFile(void* context, char** input, size_t* inputLength, size_t* inputSize) {
+    struct batchFile* f = context;
+    size_t n;
+    batch_reserve(input, inputSize, *inputLength+BATCH_READ_SIZE);
+    n = fread(&(*input)[*inputLength], 1, BATCH_READ_SIZE, f->in);
+    *inputLength += n;
+    if (n<BATCH_READ_SIZE) {
+        if (ferror(f->in)) {
+            perror("OpenV2G batch: read");
+            return -1;
+        }
+        if (feof(f->in)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Fill the job with the incomplete message of the previous job (carry) and the next complete messages of the
+   input. Returns 0, or -1 for an input error. After an error, the job holds only the complete messages in front of
+   an incomplete one at the end of the input, or none at all. */
+static int fillJob(struct batchJob* job, batchFill_t fill, void* context, char** carry, size_t* carryLength, size_t* carrySize, int* eof) {
+    size_t complete = 0;
+    int result;
+    batch_reserve(&job->input, &job->inputSize, *carryLength+BATCH_READ_SIZE);
+    if (*carryLength>0) {
+        memcpy(job->input, *carry, *carryLength);
+    }
+    job->inputLength = *carryLength;
+    for (;;) {
+        result = fill(context, &job->input, &job->inputLength, &job->inputSize);
+        if (result<0) {
+            job->inputLength = 0;
+            return -1;
+        }
+        *eof = (result==0);
+        complete = completeLength(job->input, job->inputLength, *eof);
+        if (complete>0 || *eof) {
+            break;
+        }
+        if (job->inputLength>BATCH_MAX_MESSAGE_LENGTH+BATCH_TAGGED_RECORD_HEADER_LENGTH+65535) {
+            fprintf(stderr, "OpenV2G batch: message longer than %d bytes\n", BATCH_MAX_MESSAGE_LENGTH);
+            job->inputLength = 0;
+            return -1;
+        }
+    }
+    /* keep the incomplete message for the next job */
+    *carryLength = job->inputLength-complete;
+    batch_reserve(carry, carrySize, *carryLength);
+    if (*carryLength>0) {
+        memcpy(*carry, &job->input[complete], *carryLength);
+    }
+    job->inputLength = complete;
+    if (*eof && *carryLength>0) {
+        fprintf(stderr, "OpenV2G batch: incomplete record at the end of the input\n");
+        return -1;
+    }
+    return 0;
+}
+
+/* read the input into the job slots, and write the results of the jobs in order */
+static int runBatch(batchFill_t fill, void* context, FILE* out) {
+    struct batchJob* job;
+    char* carry = NULL;
+    size_t carryLength = 0;
+    size_t carrySize = 0;
+    int eof = 0;
+    int result = 0;
+
+    pthread_mutex_lock(&batchLock);
+    for (;;) {
+        while (!eof && result==0 && nFilled-nWritten<(unsigned long)nSlots) {
+            /* the slot is free, only the reader uses it until it is counted as filled */
+            job = &jobs[nFilled % nSlots];
+            pthread_mutex_unlock(&batchLock);
+            result = fillJob(job, fill, context, &carry, &carryLength, &carrySize, &eof);
+            job->done = 0;
+            pthread_mutex_lock(&batchLock);
+            if (job->inputLength>0) {
+                nFilled++;
+                pthread_cond_signal(&workCond);
+            }
+        }
+        if (nWritten==nFilled) {
+            break; /* end of the input and all jobs written */
+        }
+        job = &jobs[nWritten % nSlots];
+        while (!job->done) {
+            pthread_cond_wait(&doneCond, &batchLock);
+        }
+        pthread_mutex_unlock(&batchLock);
+        if (fwrite(job->output, 1, job->outputLength, out)!=job->outputLength) {
+            perror("OpenV2G batch: write");
+            result = -1;
+            eof = 1; /* stop reading, the started jobs are finished */
+        }
+        pthread_mutex_lock(&batchLock);
+        nWritten++;
+    }
+    pthread_mutex_unlock(&batchLock);
+    free(carry);
+    return result;
+}
+
+/* The number of workers of e.g. "8" in "B8", one per CPU without a number */
+int batch_workers(const char* count) {
+    int n = atoi(count);
+    if (n<=0) {
+        n = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (n<=0) {
+        n = 1;
+    }
+    if (n>BATCH_MAX_WORKERS) {
+        n = BATCH_MAX_WORKERS;
+    }
+    return n;
+}
+
+/* Decode the input of fill with n workers, and write the results to out. Returns 0, or -1 for an error. */
+int batch_run(char inputFormat, int n, batchFill_t fill, void* context, FILE* out) {
+    struct batchWorker* workers;
+    int nWorkers, i;
+    int result;
+
+    format = inputFormat;
+    nFilled = nTaken = nWritten = 0;
+    stopping = 0;
+    nSlots = n*BATCH_SLOTS_PER_WORKER;
+    jobs = calloc(nSlots, sizeof(struct batchJob));
+    workers = calloc(n, sizeof(struct batchWorker));
+    if (jobs==NULL || workers==NULL) {
+        fprintf(stderr, "OpenV2G batch: out of memory\n");
+        return -1;
+    }
+    for (nWorkers=0; nWorkers<n; nWorkers++) {
+        if (pthread_create(&workers[nWorkers].thread, NULL, workerMain, &workers[nWorkers])!=0) {
+            break;
+        }
+    }
+    result = (nWorkers>0) ? runBatch(fill, context, out) : -1;
+
+    pthread_mutex_lock(&batchLock);
+    stopping = 1;
+    pthread_cond_broadcast(&workCond);
+    pthread_mutex_unlock(&batchLock);
+    for (i=0; i<nWorkers; i++) {
+        pthread_join(workers[i].thread, NULL);
+        free(workers[i].command);
+    }
+    for (i=0; i<nSlots; i++) {
+        free(jobs[i].input);
+        free(jobs[i].output);
+    }
+    free(jobs);
+    free(workers);
+    return result;
+}
+
+/* The entry point of the batch mode, argv[1] is e.g. "B8" or "R", argv[2] the input file and argv[3] the output file */
+int main_batch(int argc, char *argv[]) {
+    struct batchFile file;
+    FILE* out = stdout;
+    int result;
+
+    if (argc<3) {
+        fprintf(stderr, "OpenV2G batch: usage: OpenV2G.exe %c[<workers>] <inputFile> [<outputFile>]\n", argv[1][0]);
+        return 1;
+    }
+    file.in = (strcmp(argv[2], "-")==0) ? stdin : fopen(argv[2], "rb");
+    if (file.in==NULL) {
+        perror(argv[2]);
+        return 1;
+    }
+    if (argc>=4) {
+        out = fopen(argv[3], "wb");
+        if (out==NULL) {
+            perror(argv[3]);
+            return 1;
+        }
+    }
+    /* stdout is unbuffered (see main.c). The jobs are written in large blocks anyway. */
+    setvbuf(out, NULL, _IOFBF, 1<<16);
+
+    result = batch_run(argv[1][0], batch_workers(&argv[1][1]), fillFromFile, &file, out);
+
+    if (file.in!=stdin) {
+        fclose(file.in);
+    }
+    if (fflush(out)!=0 || (out!=stdout && fclose(out)!=0)) {
+        perror("OpenV2G batch: write");
+        result = -1;
+    }
+    return (result==0) ? 0 : 1;
+}
+
+#endif /* CODE_VERSION_COMMANDLINE && CODE_SERVER_YES */
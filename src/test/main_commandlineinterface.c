@@ -76,34 +76,63 @@
 #endif /* DEPLOY_ISO2_CODEC == SUPPORT_YES */
 
 #include "v2gtp.h"
-
-struct appHandEXIDocument aphsDoc;
-struct dinEXIDocument dinDoc;
-struct iso1EXIDocument iso1Doc;
-struct iso2EXIDocument iso2Doc;
+#include "MemoryArena.h"
+#include "ByteStream.h"
+
+#include "main.h"
+
+/* In server mode every worker thread runs the command line interface on its own
+   documents, stream buffer and result strings. */
+#if CODE_SERVER == CODE_SERVER_YES
+#define CLI_THREAD_LOCAL __thread
+#else
+#define CLI_THREAD_LOCAL
+#endif
+
+CLI_THREAD_LOCAL struct appHandEXIDocument aphsDoc;
+CLI_THREAD_LOCAL struct dinEXIDocument dinDoc;
+CLI_THREAD_LOCAL struct iso1EXIDocument iso1Doc;
+CLI_THREAD_LOCAL struct iso2EXIDocument iso2Doc;
+/* cached CurrentDemandRes, only the changed values are patched from cycle to cycle */
+CLI_THREAD_LOCAL struct dinCurrentDemandResTemplate dinCurrentDemandResTmpl;
 
 #define BUFFER_SIZE 256
-uint8_t mybuffer[BUFFER_SIZE];
-bitstream_t global_stream1;
-size_t global_pos1;
-int g_errn;
-char gMessageName[200];
-char gResultString[4096];
-char gInfoString[4096];
-char gErrorString[4096];
-char gPropertiesString[10000];
-char gDebugString[20000];
-char s[1000];
-char gAdditionalParamList[1000];
+CLI_THREAD_LOCAL uint8_t mybuffer[BUFFER_SIZE];
+/* The hex payload of a decode command is converted into this buffer. It grows to the longest
+   payload so far, so long messages (e.g. with certificates) fit, and the commands of the line
+   and server mode do not allocate again. */
+CLI_THREAD_LOCAL uint8_t* gDecodeBuffer;
+CLI_THREAD_LOCAL int gDecodeBufferSize;
+CLI_THREAD_LOCAL bitstream_t global_stream1;
+CLI_THREAD_LOCAL size_t global_pos1;
+#if DATABINDING == DATABINDING_SLIM
+/* The decoders put the large values of the documents here (about 50 KB inline) */
+#define CLI_ARENA_SIZE 65536
+CLI_THREAD_LOCAL uint8_t gArenaBuffer[CLI_ARENA_SIZE];
+CLI_THREAD_LOCAL exi_arena_t gArena;
+/* The encoders point a large value of the document to n cleared elements in the arena */
+#define allocateValue(member, n) ((member) = exiArenaAllocateCleared(&gArena, (n)*sizeof(*(member))))
+#else
+#define allocateValue(member, n)
+#endif
+CLI_THREAD_LOCAL int g_errn;
+CLI_THREAD_LOCAL char gMessageName[200];
+CLI_THREAD_LOCAL char gResultString[4096];
+CLI_THREAD_LOCAL char gInfoString[4096];
+CLI_THREAD_LOCAL char gErrorString[4096];
+CLI_THREAD_LOCAL char gPropertiesString[10000];
+CLI_THREAD_LOCAL char gDebugString[20000];
+CLI_THREAD_LOCAL char s[1000];
+CLI_THREAD_LOCAL char gAdditionalParamList[1000];
 #define NUM_OF_ADDITIONAL_PARAMS 5
-char gAdditionalParam[NUM_OF_ADDITIONAL_PARAMS][100];
-uint8_t nNumberOfFoundAdditionalParameters;
+CLI_THREAD_LOCAL char gAdditionalParam[NUM_OF_ADDITIONAL_PARAMS][100];
+CLI_THREAD_LOCAL uint8_t nNumberOfFoundAdditionalParameters;
 #define MAX_LEN_OF_SESSION_ID 8 /* session ID has 8 bytes (may be longer, but the Ioniq uses 8 bytes) */
-uint8_t gLenOfSessionId=8; /* The dynamic length of the session ID. E.g. superChargerV3 use 4 bytes (8 hex characters), other chargers use 8 bytes (16 hex characters) */
-uint8_t gSessionID[MAX_LEN_OF_SESSION_ID]={1, 2, 3, 4, 5, 6, 7, 8}; /* default value in case we are the charger. May be overwritten by command line. */
+CLI_THREAD_LOCAL uint8_t gLenOfSessionId=8; /* The dynamic length of the session ID. E.g. superChargerV3 use 4 bytes (8 hex characters), other chargers use 8 bytes (16 hex characters) */
+CLI_THREAD_LOCAL uint8_t gSessionID[MAX_LEN_OF_SESSION_ID]={1, 2, 3, 4, 5, 6, 7, 8}; /* default value in case we are the charger. May be overwritten by command line. */
 
 #define LEN_OF_EVCCID 6 /* The EVCCID is the MAC according to spec. Ioniq uses exactly these 6 byte. */
-uint8_t EVCCID[LEN_OF_EVCCID];
+CLI_THREAD_LOCAL uint8_t EVCCID[LEN_OF_EVCCID];
 
 #define ERROR_UNEXPECTED_REQUEST_MESSAGE -601
 #define ERROR_UNEXPECTED_SESSION_SETUP_RESP_MESSAGE -602
@@ -122,13 +151,173 @@ uint8_t EVCCID[LEN_OF_EVCCID];
 #define ERROR_UNEXPECTED_CURRENT_DEMAND_RESP_MESSAGE -613
 #define ERROR_UNEXPECTED_WELDING_DETECTION_RESP_MESSAGE -614
 
+/* The result, the properties and the debug string are built by a JSON writer: It appends at its
+   write position into a buffer of fixed size, instead of searching the end of the string for each
+   piece like strcat. So building a result takes time linear in its length. What does not fit into
+   the buffer is dropped, and the writer remembers the truncation. */
+typedef struct {
+    char* buffer;
+    int size;
+    int pos;
+    int truncated;
+} jsonWriter_t;
+
+CLI_THREAD_LOCAL jsonWriter_t gResult;
+CLI_THREAD_LOCAL jsonWriter_t gProperties;
+CLI_THREAD_LOCAL jsonWriter_t gDebug;
+
+static const char hexDigits[] = "0123456789abcdef";
+static const char decimalDigitPairs[] =
+    "00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839"
+    "40414243444546474849" "50515253545556575859" "60616263646566676869" "70717273747576777879"
+    "80818283848586878889" "90919293949596979899";
+
+static void jsonInit(jsonWriter_t* w, char* buffer, int size) {
+    w->buffer = buffer;
+    w->size = size;
+    w->pos = 0;
+    w->truncated = 0;
+    buffer[0] = 0;
+}
+
+/* append len characters, the buffer stays null terminated. A writer without buffer drops everything: the
+   decoders call debugAddStringAndInt() also from the sample programs, which never set up gDebug. */
+static void jsonAppendChars(jsonWriter_t* w, const char* chars, int len) {
+    if ((w->buffer == NULL) || (w->size == 0)) {
+        return;
+    }
+    if (len > w->size-1-w->pos) {
+        len = w->size-1-w->pos;
+        w->truncated = 1;
+    }
+    memcpy(&w->buffer[w->pos], chars, len);
+    w->pos += len;
+    w->buffer[w->pos] = 0;
+}
+
+static void jsonAppend(jsonWriter_t* w, const char* str) {
+    jsonAppendChars(w, str, strlen(str));
+}
+
+/* append the content of a JSON string: quotation mark, backslash and control characters are escaped,
+   everything else is copied in runs */
+static void jsonAppendEscaped(jsonWriter_t* w, const char* str) {
+    const char* run = str;
+    char esc[6];
+    unsigned char c;
+    for (; *str!=0; str++) {
+        c = (unsigned char)*str;
+        if ((c>=0x20) && (c!='"') && (c!='\\')) {
+            continue;
+        }
+        jsonAppendChars(w, run, str-run);
+        run = str+1;
+        esc[0] = '\\';
+        switch (c) {
+            case '"': esc[1] = '"'; break;
+            case '\\': esc[1] = '\\'; break;
+            case '\n': esc[1] = 'n'; break;
+            case '\r': esc[1] = 'r'; break;
+            case '\t': esc[1] = 't'; break;
+            default:
+                /* other control characters as \u00xx */
+                esc[1] = 'u';
+                esc[2] = '0';
+                esc[3] = '0';
+                esc[4] = hexDigits[c>>4];
+                esc[5] = hexDigits[c&0x0f];
+                jsonAppendChars(w, esc, 6);
+                continue;
+        }
+        jsonAppendChars(w, esc, 2);
+    }
+    jsonAppendChars(w, run, str-run);
+}
 
+/* append a decimal number, two digits at a time out of the digit pair table */
+static void jsonAppendInt(jsonWriter_t* w, int value) {
+    char digits[12];
+    int i = sizeof(digits);
+    unsigned int u = (value<0) ? 0u-(unsigned int)value : (unsigned int)value;
+    while (u>=100) {
+        i -= 2;
+        memcpy(&digits[i], &decimalDigitPairs[2*(u%100)], 2);
+        u /= 100;
+    }
+    if (u>=10) {
+        i -= 2;
+        memcpy(&digits[i], &decimalDigitPairs[2*u], 2);
+    } else {
+        digits[--i] = (char)('0'+u);
+    }
+    if (value<0) {
+        digits[--i] = '-';
+    }
+    jsonAppendChars(w, &digits[i], sizeof(digits)-i);
+}
+
+/* value of each character as hex digit, 0xff for the characters which are no hex digit */
+static const uint8_t hexDigitValues[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+/* write two lower case hex characters per byte */
+static void bytesToHex(const uint8_t* bytes, int len, char* hex) {
+    int i;
+    for (i=0; i<len; i++) {
+        hex[2*i] = hexDigits[bytes[i]>>4];
+        hex[2*i+1] = hexDigits[bytes[i]&0x0f];
+    }
+}
+
+/* convert 2*numBytes hex characters (upper or lower case) into numBytes bytes. Stops at the first
+   pair with a character which is no hex digit, and returns the number of converted bytes. */
+static int hexToBytes(const char* hex, uint8_t* bytes, int numBytes) {
+    int i;
+    uint8_t high, low;
+    for (i=0; i<numBytes; i++) {
+        high = hexDigitValues[(uint8_t)hex[2*i]];
+        low = hexDigitValues[(uint8_t)hex[2*i+1]];
+        if ((high|low)&0xf0) {
+            break; /* one of both is 0xff */
+        }
+        bytes[i] = (uint8_t)((high<<4)|low);
+    }
+    return i;
+}
 
+/* append two lower case hex characters per byte */
+static void jsonAppendHex(jsonWriter_t* w, const uint8_t* bytes, int len) {
+    if ((w->buffer == NULL) || (w->size == 0)) {
+        return;
+    }
+    if (len > (w->size-1-w->pos)/2) {
+        len = (w->size-1-w->pos)/2;
+        w->truncated = 1;
+    }
+    bytesToHex(bytes, len, &w->buffer[w->pos]);
+    w->pos += 2*len;
+    w->buffer[w->pos] = 0;
+}
 
 void debugAddStringAndInt(char *s, int i) {
-    char sTmp[1000];
-    sprintf(sTmp, "%s%d", s, i);
-    strcat(gDebugString, sTmp);
+    jsonAppend(&gDebug, s);
+    jsonAppendInt(&gDebug, i);
 }
 
 /*
@@ -145,12 +334,10 @@ static int writeStringToEXIString(char* string, exi_string_character_t* exiStrin
 
 static void printASCIIString(exi_string_character_t* string, uint16_t len) {
     unsigned int i;
-    char strShort[10];
-    strcpy(s, "");
-    for(i=0; i<len; i++) {
-        sprintf(strShort, "%c",(char)string[i]);
-        strcat(s, strShort);
+    for(i=0; (i<len) && (i<sizeof(s)-1); i++) {
+        s[i] = (char)string[i];
     }
+    s[i] = 0;
     //printf(s);
     //printf("\n");
 }
@@ -186,41 +373,57 @@ static void copyBytes(uint8_t* from, uint16_t len, uint8_t* to) {
 
 /* prepare an empty stream */
 static void prepareGlobalStream(void) {
-    global_stream1.size = BUFFER_SIZE;
-    global_stream1.data = mybuffer;
-    global_stream1.pos = &global_pos1;    
+    init_bitstream(&global_stream1, mybuffer, BUFFER_SIZE, &global_pos1);
     *(global_stream1.pos) = 0; /* start adding data at position 0 */    
 }
 
 /* print the global stream into the result string */
 void printGlobalStream(void) {
-    int i;
-    char strTmp[10];    
     if (g_errn!=0) {
         sprintf(gErrorString, "encoding failed %d", g_errn);
     } else {
-        strcpy(gResultString, "");
         /* byte per byte, write a two-character-hex value into the result string */
-        for (i=0; i<*global_stream1.pos; i++) {
-            sprintf(strTmp, "%02x", global_stream1.data[i]);
-            strcat(gResultString, strTmp);
-        }
+        jsonInit(&gResult, gResultString, sizeof(gResultString));
+        jsonAppendHex(&gResult, global_stream1.data, *global_stream1.pos);
     }    
 }
 
 void initProperties(void) {
-    strcpy(gPropertiesString, "");
+    jsonInit(&gProperties, gPropertiesString, sizeof(gPropertiesString));
+}
+
+/* start a new line of the JSON properties string, up to the opening quote of the value */
+static void beginProperty(char *strPropertyName) {
+    jsonAppendChars(&gProperties, ",\n\"", 3);
+    jsonAppendEscaped(&gProperties, strPropertyName);
+    jsonAppendChars(&gProperties, "\": \"", 4);
 }
 
 /* add to the JSON properties string a new line with name and value, e.g.
     , "responseCode": "ok"
 */    
 void addProperty(char *strPropertyName, char *strPropertyValue) {
-    strcat(gPropertiesString, ",\n\"");
-    strcat(gPropertiesString, strPropertyName);
-    strcat(gPropertiesString, "\": \"");
-    strcat(gPropertiesString, strPropertyValue);
-    strcat(gPropertiesString, "\"");    
+    beginProperty(strPropertyName);
+    jsonAppendEscaped(&gProperties, strPropertyValue);
+    jsonAppendChars(&gProperties, "\"", 1);
+}
+
+/* same with a decimal number as value, e.g.
+    , "EVRESSSOC": "42"
+*/
+void addIntProperty(char *strPropertyName, int value) {
+    beginProperty(strPropertyName);
+    jsonAppendInt(&gProperties, value);
+    jsonAppendChars(&gProperties, "\"", 1);
+}
+
+/* same with bytes in hex as value, e.g.
+    , "EVCCID": "0a0b0c0d0e0f"
+*/
+void addHexProperty(char *strPropertyName, uint8_t* bytes, int len) {
+    beginProperty(strPropertyName);
+    jsonAppendHex(&gProperties, bytes, len);
+    jsonAppendChars(&gProperties, "\"", 1);
 }
 
 void addMessageName(char *messagename) {
@@ -379,47 +582,45 @@ void translateDocAppHandToJson(void) {
     int i;
     char sLoc[40];
     char sPropertyName[40];
-    char sAppProtocolName[100];
     initProperties();
     addProperty("schema", "appHandshake");
     if (aphsDoc.supportedAppProtocolReq_isUsed) {
             /* it is a request */
             /* EVSE side: List of application handshake protocols of the EV */
             addMessageName("supportedAppProtocolReq");
-            sprintf(s, "Vehicle supports %d protocols. ", aphsDoc.supportedAppProtocolReq.AppProtocol.arrayLen);
-            strcat(gResultString, s);
-            sprintf(sLoc, "%d", aphsDoc.supportedAppProtocolReq.AppProtocol.arrayLen);
-            addProperty("AppProtocol_arrayLen", sLoc);
+            jsonAppend(&gResult, "Vehicle supports ");
+            jsonAppendInt(&gResult, aphsDoc.supportedAppProtocolReq.AppProtocol.arrayLen);
+            jsonAppend(&gResult, " protocols. ");
+            addIntProperty("AppProtocol_arrayLen", aphsDoc.supportedAppProtocolReq.AppProtocol.arrayLen);
 
             for(i=0;i<aphsDoc.supportedAppProtocolReq.AppProtocol.arrayLen;i++) {
-                sprintf(s, "ProtocolEntry#%d ",(i+1));
-                strcat(gResultString, s);
-                sprintf(s, "ProtocolNamespace=");
-                strcat(gResultString, s);
                 printASCIIString(aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].ProtocolNamespace.characters, aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].ProtocolNamespace.charactersLen);
-                strcat(gResultString, s);
-                strcpy(sAppProtocolName, s);
-                sprintf(s, " Version=%d.%d ", aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].VersionNumberMajor, aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].VersionNumberMinor);
-                strcat(gResultString, s);
-                sprintf(s, "SchemaID=%d ", aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].SchemaID);
-                strcat(gResultString, s);
-                sprintf(s, "Priority=%d ", aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].Priority);
-                strcat(gResultString, s);
+                jsonAppend(&gResult, "ProtocolEntry#");
+                jsonAppendInt(&gResult, i+1);
+                jsonAppend(&gResult, " ProtocolNamespace=");
+                jsonAppend(&gResult, s);
+                jsonAppend(&gResult, " Version=");
+                jsonAppendInt(&gResult, aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].VersionNumberMajor);
+                jsonAppend(&gResult, ".");
+                jsonAppendInt(&gResult, aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].VersionNumberMinor);
+                jsonAppend(&gResult, " SchemaID=");
+                jsonAppendInt(&gResult, aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].SchemaID);
+                jsonAppend(&gResult, " Priority=");
+                jsonAppendInt(&gResult, aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].Priority);
+                jsonAppend(&gResult, " ");
                 /* new style json format */
                 sprintf(sPropertyName, "NameSpace_%d", i);
-                addProperty(sPropertyName, sAppProtocolName); /* e.g. "urn:din:70121:2012:MsgDef" */
+                addProperty(sPropertyName, s); /* e.g. "urn:din:70121:2012:MsgDef" */
 
                 sprintf(sPropertyName, "Version_%d", i);
                 sprintf(sLoc, "%d.%d", aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].VersionNumberMajor, aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].VersionNumberMinor);
                 addProperty(sPropertyName, sLoc);
 
                 sprintf(sPropertyName, "SchemaID_%d", i);
-                sprintf(sLoc, "%d", aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].SchemaID);
-                addProperty(sPropertyName, sLoc); /* e.g. 0 or 1 or more */
+                addIntProperty(sPropertyName, aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].SchemaID); /* e.g. 0 or 1 or more */
                 
                 sprintf(sPropertyName, "Priority_%d", i);
-                sprintf(sLoc, "%d", aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].Priority);
-                addProperty(sPropertyName, sLoc);
+                addIntProperty(sPropertyName, aphsDoc.supportedAppProtocolReq.AppProtocol.array[i].Priority);
 
 
             }
@@ -427,10 +628,13 @@ void translateDocAppHandToJson(void) {
     if (aphsDoc.supportedAppProtocolRes_isUsed) {
             /* it is a response */
             addMessageName("supportedAppProtocolRes");
-            sprintf(gResultString, "ResponseCode %d, SchemaID_isUsed %d, SchemaID %d",
-                aphsDoc.supportedAppProtocolRes.ResponseCode,
-                aphsDoc.supportedAppProtocolRes.SchemaID_isUsed,
-                aphsDoc.supportedAppProtocolRes.SchemaID);
+            jsonInit(&gResult, gResultString, sizeof(gResultString));
+            jsonAppend(&gResult, "ResponseCode ");
+            jsonAppendInt(&gResult, aphsDoc.supportedAppProtocolRes.ResponseCode);
+            jsonAppend(&gResult, ", SchemaID_isUsed ");
+            jsonAppendInt(&gResult, aphsDoc.supportedAppProtocolRes.SchemaID_isUsed);
+            jsonAppend(&gResult, ", SchemaID ");
+            jsonAppendInt(&gResult, aphsDoc.supportedAppProtocolRes.SchemaID);
             //if (aphsDoc.supportedAppProtocolRes.SchemaID_isUsed) {
             //    SchemaID
             //}    
@@ -440,19 +644,11 @@ void translateDocAppHandToJson(void) {
 #include "iso1_commandlineinterface.h" /* including a code file is bad style, but due the lot of dependencies it saves a lot of interface definitions. */
 
 void translateDinHeaderToJson(void) {
-    char sTmp[40], s2[30];
-    int i, n;
     #define h dinDoc.V2G_Message.Header
-    n = h.SessionID.bytesLen;
-    //sprintf(sTmp, "%d", n); addProperty("header.SessionID.byteLen", sTmp);
-    strcpy(sTmp,"");
-    for (i=0; (i<n)&&(i<30); i++) {
-            sprintf(s2, "%02x", h.SessionID.bytes[i]);
-            strcat(sTmp, s2);
-    }
-    addProperty("header.SessionID", sTmp);
-    sprintf(sTmp, "%d", h.Notification_isUsed); addProperty("header.Notification_isUsed", sTmp);
-    sprintf(sTmp, "%d", h.Signature_isUsed); addProperty("header.Signature_isUsed", sTmp);    
+    //addIntProperty("header.SessionID.byteLen", h.SessionID.bytesLen);
+    addHexProperty("header.SessionID", h.SessionID.bytes, h.SessionID.bytesLen);
+    addIntProperty("header.Notification_isUsed", h.Notification_isUsed);
+    addIntProperty("header.Signature_isUsed", h.Signature_isUsed);    
 }
 
 void translateUnitToJson(char *property, int unit) {
@@ -547,12 +743,10 @@ void translatedinDC_EVErrorCodeTypeToJson(dinDC_EVErrorCodeType e) {
 /* translate the struct dinDoc into JSON, to have it ready to give it over stdout to the caller application. */
 void translateDocDinToJson(void) {
     char sTmp[30];
-    char s2[30];
     int i,n;
     initProperties();
     addProperty("schema", "DIN");
-    sprintf(sTmp, "%d", g_errn);
-    addProperty("g_errn", sTmp);
+    addIntProperty("g_errn", g_errn);
     
     /* unclear, which is the correct flag:
        dinDoc.SessionSetupReq_isUsed or
@@ -562,27 +756,17 @@ void translateDocDinToJson(void) {
     if (dinDoc.V2G_Message.Body.SessionSetupReq_isUsed) {
         addMessageName("SessionSetupReq");
         n=dinDoc.V2G_Message.Body.SessionSetupReq.EVCCID.bytesLen;
-        sprintf(sTmp, "%d", n); addProperty("EVCCID.bytesLen", sTmp);
-        strcpy(sTmp,"");
-        for (i=0; (i<n)&&(i<20); i++) {
-            /* this is no ASCII, at least not at the Ioniq. Show just Hex. */
-            sprintf(s2, "%02x", dinDoc.V2G_Message.Body.SessionSetupReq.EVCCID.bytes[i]);
-            strcat(sTmp, s2);
-        }
-        addProperty("EVCCID", sTmp);
+        addIntProperty("EVCCID.bytesLen", n);
+        /* this is no ASCII, at least not at the Ioniq. Show just Hex. */
+        addHexProperty("EVCCID", dinDoc.V2G_Message.Body.SessionSetupReq.EVCCID.bytes, n);
     }
     if (dinDoc.V2G_Message.Body.SessionSetupRes_isUsed) {
         addMessageName("SessionSetupRes");
         translateDinResponseCodeToJson(dinDoc.V2G_Message.Body.SessionSetupRes.ResponseCode);
         n=dinDoc.V2G_Message.Body.SessionSetupRes.EVSEID.bytesLen;
-        sprintf(sTmp, "%d", n); addProperty("EVSEID.bytesLen", sTmp);
-        strcpy(sTmp,"");
-        for (i=0; (i<n)&&(i<20); i++) {
-            /* this is no ASCII, at least not at the Ioniq. Show just Hex. */
-            sprintf(s2, "%02x", dinDoc.V2G_Message.Body.SessionSetupRes.EVSEID.bytes[i]);
-            strcat(sTmp, s2);
-        }
-        addProperty("EVSEID", sTmp);
+        addIntProperty("EVSEID.bytesLen", n);
+        /* this is no ASCII, at least not at the Ioniq. Show just Hex. */
+        addHexProperty("EVSEID", dinDoc.V2G_Message.Body.SessionSetupRes.EVSEID.bytes, n);
         
     }
     if (dinDoc.V2G_Message.Body.ServiceDiscoveryReq_isUsed) {
@@ -591,7 +775,7 @@ void translateDocDinToJson(void) {
         if (m.ServiceScope_isUsed) {
             addProperty("ServiceScope_isUsed", "True");
             n = m.ServiceScope.charactersLen;
-            sprintf(sTmp, "%d", n); addProperty("ServiceScope.charactersLen", sTmp);
+            addIntProperty("ServiceScope.charactersLen", n);
         }
         if (m.ServiceCategory_isUsed) {
             addProperty("ServiceCategory_isUsed", "True");
@@ -610,7 +794,7 @@ void translateDocDinToJson(void) {
         if (m.SelectedPaymentOption==dinpaymentOptionType_ExternalPayment) { addProperty("SelectedPaymentOption", "ExternalPayment"); }
         
         n = m.SelectedServiceList.SelectedService.arrayLen;
-        sprintf(sTmp, "%d", n); addProperty("SelectedService.arrayLen", sTmp);
+        addIntProperty("SelectedService.arrayLen", n);
         for (i=0; i<n; i++) {
             sprintf(sTmp, "%d:%d", i, m.SelectedServiceList.SelectedService.array[i].ServiceID); addProperty("SelectedService.array", sTmp);
         }
@@ -649,55 +833,55 @@ void translateDocDinToJson(void) {
     if (dinDoc.V2G_Message.Body.ChargeParameterDiscoveryReq_isUsed) {
         addMessageName("ChargeParameterDiscoveryReq");
         #define m dinDoc.V2G_Message.Body.ChargeParameterDiscoveryReq
-        sprintf(sTmp, "%d", m.EVRequestedEnergyTransferType); addProperty("EVRequestedEnergyTransferType", sTmp);
+        addIntProperty("EVRequestedEnergyTransferType", m.EVRequestedEnergyTransferType);
         
-        sprintf(sTmp, "%d", m.EVChargeParameter_isUsed); addProperty("EVChargeParameter_isUsed", sTmp);
+        addIntProperty("EVChargeParameter_isUsed", m.EVChargeParameter_isUsed);
         if (m.EVChargeParameter_isUsed) {
             /* no content */
         }
-        sprintf(sTmp, "%d", m.DC_EVChargeParameter_isUsed); addProperty("DC_EVChargeParameter_isUsed", sTmp);
+        addIntProperty("DC_EVChargeParameter_isUsed", m.DC_EVChargeParameter_isUsed);
         if (m.DC_EVChargeParameter_isUsed) {
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.DC_EVStatus.EVRESSSOC); addProperty("DC_EVStatus.EVRESSSOC", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.DC_EVStatus.EVReady); addProperty("DC_EVStatus.EVReady", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.DC_EVStatus.EVCabinConditioning_isUsed); addProperty("EVCabinConditioning_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.DC_EVStatus.EVRESSConditioning_isUsed); addProperty("EVRESSConditioning_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.DC_EVStatus.EVErrorCode); addProperty("EVErrorCode", sTmp);
+            addIntProperty("DC_EVStatus.EVRESSSOC", m.DC_EVChargeParameter.DC_EVStatus.EVRESSSOC);
+            addIntProperty("DC_EVStatus.EVReady", m.DC_EVChargeParameter.DC_EVStatus.EVReady);
+            addIntProperty("EVCabinConditioning_isUsed", m.DC_EVChargeParameter.DC_EVStatus.EVCabinConditioning_isUsed);
+            addIntProperty("EVRESSConditioning_isUsed", m.DC_EVChargeParameter.DC_EVStatus.EVRESSConditioning_isUsed);
+            addIntProperty("EVErrorCode", m.DC_EVChargeParameter.DC_EVStatus.EVErrorCode);
             translatedinDC_EVErrorCodeTypeToJson(m.DC_EVChargeParameter.DC_EVStatus.EVErrorCode);
 
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Value); addProperty("EVMaximumCurrentLimit.Value", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Multiplier); addProperty("EVMaximumCurrentLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Unit_isUsed); addProperty("EVMaximumCurrentLimit.Unit_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Unit); addProperty("EVMaximumCurrentLimit.Unit", sTmp);
+            addIntProperty("EVMaximumCurrentLimit.Value", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Value);
+            addIntProperty("EVMaximumCurrentLimit.Multiplier", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Multiplier);
+            addIntProperty("EVMaximumCurrentLimit.Unit_isUsed", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Unit_isUsed);
+            addIntProperty("EVMaximumCurrentLimit.Unit", m.DC_EVChargeParameter.EVMaximumCurrentLimit.Unit);
             
             
             
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumPowerLimit_isUsed); addProperty("EVMaximumPowerLimit_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumPowerLimit.Value); addProperty("EVMaximumPowerLimit.Value", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumPowerLimit.Multiplier); addProperty("EVMaximumPowerLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumPowerLimit.Unit_isUsed); addProperty("EVMaximumPowerLimit.Unit_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumPowerLimit.Unit); addProperty("EVMaximumPowerLimit.Unit", sTmp);
+            addIntProperty("EVMaximumPowerLimit_isUsed", m.DC_EVChargeParameter.EVMaximumPowerLimit_isUsed);
+            addIntProperty("EVMaximumPowerLimit.Value", m.DC_EVChargeParameter.EVMaximumPowerLimit.Value);
+            addIntProperty("EVMaximumPowerLimit.Multiplier", m.DC_EVChargeParameter.EVMaximumPowerLimit.Multiplier);
+            addIntProperty("EVMaximumPowerLimit.Unit_isUsed", m.DC_EVChargeParameter.EVMaximumPowerLimit.Unit_isUsed);
+            addIntProperty("EVMaximumPowerLimit.Unit", m.DC_EVChargeParameter.EVMaximumPowerLimit.Unit);
             
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Value); addProperty("EVMaximumVoltageLimit.Value", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Multiplier); addProperty("EVMaximumVoltageLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Unit_isUsed); addProperty("EVMaximumVoltageLimit.Unit_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Unit); addProperty("EVMaximumVoltageLimit.Unit", sTmp);
+            addIntProperty("EVMaximumVoltageLimit.Value", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Value);
+            addIntProperty("EVMaximumVoltageLimit.Multiplier", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Multiplier);
+            addIntProperty("EVMaximumVoltageLimit.Unit_isUsed", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Unit_isUsed);
+            addIntProperty("EVMaximumVoltageLimit.Unit", m.DC_EVChargeParameter.EVMaximumVoltageLimit.Unit);
             
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyCapacity_isUsed); addProperty("EVEnergyCapacity_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyCapacity.Value); addProperty("EVEnergyCapacity.Value", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyCapacity.Multiplier); addProperty("EVEnergyCapacity.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyCapacity.Unit_isUsed); addProperty("EVEnergyCapacity.Unit_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyCapacity.Unit); addProperty("EVEnergyCapacity.Unit", sTmp);
+            addIntProperty("EVEnergyCapacity_isUsed", m.DC_EVChargeParameter.EVEnergyCapacity_isUsed);
+            addIntProperty("EVEnergyCapacity.Value", m.DC_EVChargeParameter.EVEnergyCapacity.Value);
+            addIntProperty("EVEnergyCapacity.Multiplier", m.DC_EVChargeParameter.EVEnergyCapacity.Multiplier);
+            addIntProperty("EVEnergyCapacity.Unit_isUsed", m.DC_EVChargeParameter.EVEnergyCapacity.Unit_isUsed);
+            addIntProperty("EVEnergyCapacity.Unit", m.DC_EVChargeParameter.EVEnergyCapacity.Unit);
             
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyRequest_isUsed); addProperty("EVEnergyRequest_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyRequest.Value); addProperty("EVEnergyRequest.Value", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyRequest.Multiplier); addProperty("EVEnergyRequest.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyRequest.Unit_isUsed); addProperty("EVEnergyRequest.Unit_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.EVEnergyRequest.Unit); addProperty("EVEnergyRequest.Unit", sTmp);
-
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.FullSOC_isUsed); addProperty("FullSOC_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.FullSOC); addProperty("FullSOC", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.BulkSOC_isUsed); addProperty("BulkSOC_isUsed", sTmp);
-            sprintf(sTmp, "%d", m.DC_EVChargeParameter.BulkSOC); addProperty("BulkSOC", sTmp);
+            addIntProperty("EVEnergyRequest_isUsed", m.DC_EVChargeParameter.EVEnergyRequest_isUsed);
+            addIntProperty("EVEnergyRequest.Value", m.DC_EVChargeParameter.EVEnergyRequest.Value);
+            addIntProperty("EVEnergyRequest.Multiplier", m.DC_EVChargeParameter.EVEnergyRequest.Multiplier);
+            addIntProperty("EVEnergyRequest.Unit_isUsed", m.DC_EVChargeParameter.EVEnergyRequest.Unit_isUsed);
+            addIntProperty("EVEnergyRequest.Unit", m.DC_EVChargeParameter.EVEnergyRequest.Unit);
+
+            addIntProperty("FullSOC_isUsed", m.DC_EVChargeParameter.FullSOC_isUsed);
+            addIntProperty("FullSOC", m.DC_EVChargeParameter.FullSOC);
+            addIntProperty("BulkSOC_isUsed", m.DC_EVChargeParameter.BulkSOC_isUsed);
+            addIntProperty("BulkSOC", m.DC_EVChargeParameter.BulkSOC);
         }
         #undef m
     }
@@ -715,23 +899,23 @@ void translateDocDinToJson(void) {
         // todo maybe: EVSEChargeParameter_isUsed
         // todo for AC: AC_EVSEChargeParameter_isUsed
         #define res dinDoc.V2G_Message.Body.ChargeParameterDiscoveryRes
-        sprintf(sTmp, "%d", res.SAScheduleList_isUsed); addProperty("SAScheduleList_isUsed", sTmp);
+        addIntProperty("SAScheduleList_isUsed", res.SAScheduleList_isUsed);
         if (res.SAScheduleList_isUsed) {
-            sprintf(sTmp, "%d", res.SAScheduleList.SAScheduleTuple.arrayLen); addProperty("SAScheduleList.SAScheduleTuple.arrayLen", sTmp);
+            addIntProperty("SAScheduleList.SAScheduleTuple.arrayLen", res.SAScheduleList.SAScheduleTuple.arrayLen);
             if (res.SAScheduleList.SAScheduleTuple.arrayLen>0) {
                 #define SchedTuple0 res.SAScheduleList.SAScheduleTuple.array[0]
-                sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.arrayLen); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.arrayLen", sTmp);
+                addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.arrayLen", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.arrayLen);
                 if (SchedTuple0.PMaxSchedule.PMaxScheduleEntry.arrayLen>0) {
-                    sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].TimeInterval_isUsed); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].TimeInterval_isUsed", sTmp);
-                    sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed", sTmp);
+                    addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].TimeInterval_isUsed", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].TimeInterval_isUsed);
+                    addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed);
                     if (SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed) {
-                        sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.start); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.start", sTmp);
-                        sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration_isUsed); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration_isUsed", sTmp);
+                        addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.start", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.start);
+                        addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration_isUsed", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration_isUsed);
                         if (SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration_isUsed) {
-                            sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration", sTmp);
+                            addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration);
                         }
                     }
-                    sprintf(sTmp, "%d", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].PMax); addProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].PMax", sTmp);
+                    addIntProperty("SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].PMax", SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].PMax);
                     /* todo: show the complete content of the schedule */
                 }
                 #undef SchedTuple0
@@ -741,46 +925,50 @@ void translateDocDinToJson(void) {
         if (dinDoc.V2G_Message.Body.ChargeParameterDiscoveryRes.DC_EVSEChargeParameter_isUsed) {
             //DC_EVSEChargeParameter
             //  DC_EVSEStatus
+            #if DATABINDING == DATABINDING_SLIM
+            #define cp (*dinDoc.V2G_Message.Body.ChargeParameterDiscoveryRes.DC_EVSEChargeParameter)
+            #else
             #define cp dinDoc.V2G_Message.Body.ChargeParameterDiscoveryRes.DC_EVSEChargeParameter
+            #endif
             #define v1 cp.DC_EVSEStatus.EVSEIsolationStatus
             #define v2 cp.DC_EVSEStatus.EVSEIsolationStatus_isUsed
             #define v3 cp.DC_EVSEStatus.EVSEStatusCode
             #define v4 cp.DC_EVSEStatus.NotificationMaxDelay /* expected time until the PEV reacts on the below mentioned notification. Not relevant. */
             #define v5 cp.DC_EVSEStatus.EVSENotification
-            sprintf(sTmp, "%d", v1); addProperty("DC_EVSEStatus.EVSEIsolationStatus", sTmp);
-            sprintf(sTmp, "%d", v2); addProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", sTmp);
-            sprintf(sTmp, "%d", v3); addProperty("DC_EVSEStatus.EVSEStatusCode", sTmp);
+            addIntProperty("DC_EVSEStatus.EVSEIsolationStatus", v1);
+            addIntProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", v2);
+            addIntProperty("DC_EVSEStatus.EVSEStatusCode", v3);
             translatedinDC_EVSEStatusCodeTypeToJson(v3);
-            sprintf(sTmp, "%d", v4); addProperty("DC_EVSEStatus.NotificationMaxDelay", sTmp);
-            sprintf(sTmp, "%d", v5); addProperty("DC_EVSEStatus.EVSENotification", sTmp);
+            addIntProperty("DC_EVSEStatus.NotificationMaxDelay", v4);
+            addIntProperty("DC_EVSEStatus.EVSENotification", v5);
             #undef v1
             #undef v2
             #undef v3
             #undef v4
             #undef v5
             //  EVSEMaximumCurrentLimit
-            sprintf(sTmp, "%d", cp.EVSEMaximumCurrentLimit.Multiplier); addProperty("EVSEMaximumCurrentLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", cp.EVSEMaximumCurrentLimit.Value); addProperty("EVSEMaximumCurrentLimit.Value", sTmp);            
+            addIntProperty("EVSEMaximumCurrentLimit.Multiplier", cp.EVSEMaximumCurrentLimit.Multiplier);
+            addIntProperty("EVSEMaximumCurrentLimit.Value", cp.EVSEMaximumCurrentLimit.Value);            
             translateUnitToJson("EVSEMaximumCurrentLimit.Unit", cp.EVSEMaximumCurrentLimit.Unit);
             
             //  EVSEMaximumPowerLimit
             //  EVSEMaximumPowerLimit_isUsed
-            sprintf(sTmp, "%d", cp.EVSEMaximumPowerLimit_isUsed); addProperty("EVSEMaximumPowerLimit_isUsed", sTmp);
-            sprintf(sTmp, "%d", cp.EVSEMaximumPowerLimit.Multiplier); addProperty("EVSEMaximumPowerLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", cp.EVSEMaximumPowerLimit.Value); addProperty("EVSEMaximumPowerLimit.Value", sTmp);
+            addIntProperty("EVSEMaximumPowerLimit_isUsed", cp.EVSEMaximumPowerLimit_isUsed);
+            addIntProperty("EVSEMaximumPowerLimit.Multiplier", cp.EVSEMaximumPowerLimit.Multiplier);
+            addIntProperty("EVSEMaximumPowerLimit.Value", cp.EVSEMaximumPowerLimit.Value);
             translateUnitToJson("EVSEMaximumPowerLimit.Unit", cp.EVSEMaximumPowerLimit.Unit);
 
             //  EVSEMaximumVoltageLimit
-            sprintf(sTmp, "%d", cp.EVSEMaximumVoltageLimit.Multiplier); addProperty("EVSEMaximumVoltageLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", cp.EVSEMaximumVoltageLimit.Value); addProperty("EVSEMaximumVoltageLimit.Value", sTmp);
+            addIntProperty("EVSEMaximumVoltageLimit.Multiplier", cp.EVSEMaximumVoltageLimit.Multiplier);
+            addIntProperty("EVSEMaximumVoltageLimit.Value", cp.EVSEMaximumVoltageLimit.Value);
             translateUnitToJson("EVSEMaximumVoltageLimit.Unit", cp.EVSEMaximumVoltageLimit.Unit);
             //  EVSEMinimumCurrentLimit
-            sprintf(sTmp, "%d", cp.EVSEMinimumCurrentLimit.Multiplier); addProperty("EVSEMinimumCurrentLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", cp.EVSEMinimumCurrentLimit.Value); addProperty("EVSEMinimumCurrentLimit.Value", sTmp);
+            addIntProperty("EVSEMinimumCurrentLimit.Multiplier", cp.EVSEMinimumCurrentLimit.Multiplier);
+            addIntProperty("EVSEMinimumCurrentLimit.Value", cp.EVSEMinimumCurrentLimit.Value);
             translateUnitToJson("EVSEMinimumCurrentLimit.Unit", cp.EVSEMinimumCurrentLimit.Unit);
             //  EVSEMinimumVoltageLimit
-            sprintf(sTmp, "%d", cp.EVSEMinimumVoltageLimit.Multiplier); addProperty("EVSEMinimumVoltageLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", cp.EVSEMinimumVoltageLimit.Value); addProperty("EVSEMinimumVoltageLimit.Value", sTmp);
+            addIntProperty("EVSEMinimumVoltageLimit.Multiplier", cp.EVSEMinimumVoltageLimit.Multiplier);
+            addIntProperty("EVSEMinimumVoltageLimit.Value", cp.EVSEMinimumVoltageLimit.Value);
             translateUnitToJson("EVSEMinimumVoltageLimit.Unit", cp.EVSEMinimumVoltageLimit.Unit);
             //  EVSECurrentRegulationTolerance
             //  EVSECurrentRegulationTolerance_isUsed
@@ -795,8 +983,8 @@ void translateDocDinToJson(void) {
     if (dinDoc.V2G_Message.Body.CableCheckReq_isUsed) {
         addMessageName("CableCheckReq");
         #define m dinDoc.V2G_Message.Body.CableCheckReq
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVRESSSOC); addProperty("DC_EVStatus.EVRESSSOC", sTmp);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVReady); addProperty("DC_EVStatus.EVReady", sTmp);
+        addIntProperty("DC_EVStatus.EVRESSSOC", m.DC_EVStatus.EVRESSSOC);
+        addIntProperty("DC_EVStatus.EVReady", m.DC_EVStatus.EVReady);
         #undef m
     }
     if (dinDoc.V2G_Message.Body.CableCheckRes_isUsed) {
@@ -808,12 +996,12 @@ void translateDocDinToJson(void) {
         #define v3 m.DC_EVSEStatus.EVSEStatusCode
         #define v4 m.DC_EVSEStatus.NotificationMaxDelay /* expected time until the PEV reacts on the below mentioned notification. Not relevant. */
         #define v5 m.DC_EVSEStatus.EVSENotification
-        sprintf(sTmp, "%d", v1); addProperty("DC_EVSEStatus.EVSEIsolationStatus", sTmp);
-        sprintf(sTmp, "%d", v2); addProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", sTmp);
-        sprintf(sTmp, "%d", v3); addProperty("DC_EVSEStatus.EVSEStatusCode", sTmp);
+        addIntProperty("DC_EVSEStatus.EVSEIsolationStatus", v1);
+        addIntProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", v2);
+        addIntProperty("DC_EVSEStatus.EVSEStatusCode", v3);
         translatedinDC_EVSEStatusCodeTypeToJson(v3);
-        sprintf(sTmp, "%d", v4); addProperty("DC_EVSEStatus.NotificationMaxDelay", sTmp);
-        sprintf(sTmp, "%d", v5); addProperty("DC_EVSEStatus.EVSENotification", sTmp);
+        addIntProperty("DC_EVSEStatus.NotificationMaxDelay", v4);
+        addIntProperty("DC_EVSEStatus.EVSENotification", v5);
         #undef v1
         #undef v2
         #undef v3
@@ -831,17 +1019,17 @@ void translateDocDinToJson(void) {
     if (dinDoc.V2G_Message.Body.PreChargeReq_isUsed) {
         addMessageName("PreChargeReq");
         #define m dinDoc.V2G_Message.Body.PreChargeReq
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVReady); addProperty("DC_EVStatus.EVReady", sTmp);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVErrorCode); addProperty("DC_EVStatus.EVErrorCode", sTmp);
+        addIntProperty("DC_EVStatus.EVReady", m.DC_EVStatus.EVReady);
+        addIntProperty("DC_EVStatus.EVErrorCode", m.DC_EVStatus.EVErrorCode);
         translatedinDC_EVErrorCodeTypeToJson(m.DC_EVStatus.EVErrorCode);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVRESSSOC); addProperty("DC_EVStatus.EVRESSSOC", sTmp);
+        addIntProperty("DC_EVStatus.EVRESSSOC", m.DC_EVStatus.EVRESSSOC);
 
-        sprintf(sTmp, "%d", m.EVTargetVoltage.Multiplier); addProperty("EVTargetVoltage.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVTargetVoltage.Value); addProperty("EVTargetVoltage.Value", sTmp);
+        addIntProperty("EVTargetVoltage.Multiplier", m.EVTargetVoltage.Multiplier);
+        addIntProperty("EVTargetVoltage.Value", m.EVTargetVoltage.Value);
         translateUnitToJson("EVTargetVoltage.Unit", m.EVTargetVoltage.Unit);
                         
-        sprintf(sTmp, "%d", m.EVTargetCurrent.Multiplier); addProperty("EVTargetCurrent.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVTargetCurrent.Value); addProperty("EVTargetCurrent.Value", sTmp);
+        addIntProperty("EVTargetCurrent.Multiplier", m.EVTargetCurrent.Multiplier);
+        addIntProperty("EVTargetCurrent.Value", m.EVTargetCurrent.Value);
         translateUnitToJson("EVTargetCurrent.Unit", m.EVTargetCurrent.Unit);
 
         #undef m
@@ -855,15 +1043,15 @@ void translateDocDinToJson(void) {
         #define v3 m.DC_EVSEStatus.EVSEStatusCode
         #define v4 m.DC_EVSEStatus.NotificationMaxDelay /* expected time until the PEV reacts on the below mentioned notification. Not relevant. */
         #define v5 m.DC_EVSEStatus.EVSENotification
-        sprintf(sTmp, "%d", v1); addProperty("DC_EVSEStatus.EVSEIsolationStatus", sTmp);
-        sprintf(sTmp, "%d", v2); addProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", sTmp);
-        sprintf(sTmp, "%d", v3); addProperty("DC_EVSEStatus.EVSEStatusCode", sTmp);
+        addIntProperty("DC_EVSEStatus.EVSEIsolationStatus", v1);
+        addIntProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", v2);
+        addIntProperty("DC_EVSEStatus.EVSEStatusCode", v3);
         translatedinDC_EVSEStatusCodeTypeToJson(v3);
-        sprintf(sTmp, "%d", v4); addProperty("DC_EVSEStatus.NotificationMaxDelay", sTmp);
-        sprintf(sTmp, "%d", v5); addProperty("DC_EVSEStatus.EVSENotification", sTmp);
+        addIntProperty("DC_EVSEStatus.NotificationMaxDelay", v4);
+        addIntProperty("DC_EVSEStatus.EVSENotification", v5);
         
-        sprintf(sTmp, "%d", m.EVSEPresentVoltage.Multiplier); addProperty("EVSEPresentVoltage.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVSEPresentVoltage.Value); addProperty("EVSEPresentVoltage.Value", sTmp);
+        addIntProperty("EVSEPresentVoltage.Multiplier", m.EVSEPresentVoltage.Multiplier);
+        addIntProperty("EVSEPresentVoltage.Value", m.EVSEPresentVoltage.Value);
         translateUnitToJson("EVSEPresentVoltage.Unit", m.EVSEPresentVoltage.Unit); /* why is this shown as 0? Because unit is optional, see question2. */
 
         #undef v1
@@ -875,15 +1063,15 @@ void translateDocDinToJson(void) {
     }
     if (dinDoc.V2G_Message.Body.PowerDeliveryReq_isUsed) {
         addMessageName("PowerDeliveryReq");
-        sprintf(sTmp, "%d", dinDoc.V2G_Message.Body.PowerDeliveryReq.ReadyToChargeState); addProperty("ReadyToChargeState", sTmp);
+        addIntProperty("ReadyToChargeState", dinDoc.V2G_Message.Body.PowerDeliveryReq.ReadyToChargeState);
 
         if (dinDoc.V2G_Message.Body.PowerDeliveryReq.ReadyToChargeState==0) { addProperty("ReadyToChargeState_Text", "false"); }
         if (dinDoc.V2G_Message.Body.PowerDeliveryReq.ReadyToChargeState==1) { addProperty("ReadyToChargeState_Text", "true"); }
         /*if (dinDoc.V2G_Message.Body.PowerDeliveryReq.ReadyToChargeState==2) { addProperty("ReadyToChargeState_Text", "Renegotiate"); } */
         
-        sprintf(sTmp, "%d", dinDoc.V2G_Message.Body.PowerDeliveryReq.ChargingProfile_isUsed); addProperty("ChargingProfile_isUsed", sTmp);
-        sprintf(sTmp, "%d", dinDoc.V2G_Message.Body.PowerDeliveryReq.EVPowerDeliveryParameter_isUsed); addProperty("EVPowerDeliveryParameter_isUsed", sTmp);
-        sprintf(sTmp, "%d", dinDoc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter_isUsed); addProperty("DC_EVPowerDeliveryParameter_isUsed", sTmp);
+        addIntProperty("ChargingProfile_isUsed", dinDoc.V2G_Message.Body.PowerDeliveryReq.ChargingProfile_isUsed);
+        addIntProperty("EVPowerDeliveryParameter_isUsed", dinDoc.V2G_Message.Body.PowerDeliveryReq.EVPowerDeliveryParameter_isUsed);
+        addIntProperty("DC_EVPowerDeliveryParameter_isUsed", dinDoc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter_isUsed);
         if (dinDoc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter_isUsed) {
             #define v1 dinDoc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.DC_EVStatus.EVReady
             #define v2 dinDoc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.DC_EVStatus.EVErrorCode
@@ -892,28 +1080,28 @@ void translateDocDinToJson(void) {
             #define v4used dinDoc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.BulkChargingComplete_isUsed
             #define v5 dinDoc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.ChargingComplete
 
-            sprintf(sTmp, "%d", v1); addProperty("EVReady", sTmp);
-            sprintf(sTmp, "%d", v2); addProperty("EVErrorCode", sTmp);
+            addIntProperty("EVReady", v1);
+            addIntProperty("EVErrorCode", v2);
             translatedinDC_EVErrorCodeTypeToJson(v2);
             
-            sprintf(sTmp, "%d", v3); addProperty("EVRESSSOC", sTmp);
-            sprintf(sTmp, "%d", v4used); addProperty("BulkChargingComplete_isUsed", sTmp);
+            addIntProperty("EVRESSSOC", v3);
+            addIntProperty("BulkChargingComplete_isUsed", v4used);
             if (v4used) {
-              sprintf(sTmp, "%d", v4); addProperty("BulkChargingComplete", sTmp);
+              addIntProperty("BulkChargingComplete", v4);
             }
-            sprintf(sTmp, "%d", v5); addProperty("ChargingComplete", sTmp);
+            addIntProperty("ChargingComplete", v5);
 
             #define v6 dinDoc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.DC_EVStatus.EVCabinConditioning_isUsed
             #define v7 dinDoc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.DC_EVStatus.EVCabinConditioning
             #define v8 dinDoc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.DC_EVStatus.EVRESSConditioning_isUsed
             #define v9 dinDoc.V2G_Message.Body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.DC_EVStatus.EVRESSConditioning
-            sprintf(sTmp, "%d", v6); addProperty("EVCabinConditioning_isUsed", sTmp);
+            addIntProperty("EVCabinConditioning_isUsed", v6);
             if (v6) {
-                sprintf(sTmp, "%d", v7); addProperty("EVCabinConditioning", sTmp);
+                addIntProperty("EVCabinConditioning", v7);
             }
-            sprintf(sTmp, "%d", v8); addProperty("EVRESSConditioning_isUsed", sTmp);
+            addIntProperty("EVRESSConditioning_isUsed", v8);
             if (v8) {
-                sprintf(sTmp, "%d", v9); addProperty("EVRESSConditioning", sTmp);
+                addIntProperty("EVRESSConditioning", v9);
             }
             
             #undef v1
@@ -940,12 +1128,12 @@ void translateDocDinToJson(void) {
             #define v3 m.DC_EVSEStatus.EVSEStatusCode
             #define v4 m.DC_EVSEStatus.NotificationMaxDelay /* expected time until the PEV reacts on the below mentioned notification. Not relevant. */
             #define v5 m.DC_EVSEStatus.EVSENotification
-            sprintf(sTmp, "%d", v1); addProperty("DC_EVSEStatus.EVSEIsolationStatus", sTmp);
-            sprintf(sTmp, "%d", v2); addProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", sTmp);
-            sprintf(sTmp, "%d", v3); addProperty("DC_EVSEStatus.EVSEStatusCode", sTmp);
+            addIntProperty("DC_EVSEStatus.EVSEIsolationStatus", v1);
+            addIntProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", v2);
+            addIntProperty("DC_EVSEStatus.EVSEStatusCode", v3);
             translatedinDC_EVSEStatusCodeTypeToJson(v3);
-            sprintf(sTmp, "%d", v4); addProperty("DC_EVSEStatus.NotificationMaxDelay", sTmp);
-            sprintf(sTmp, "%d", v5); addProperty("DC_EVSEStatus.EVSENotification", sTmp);
+            addIntProperty("DC_EVSEStatus.NotificationMaxDelay", v4);
+            addIntProperty("DC_EVSEStatus.EVSENotification", v5);
             #undef m
             #undef v1
             #undef v2
@@ -958,42 +1146,42 @@ void translateDocDinToJson(void) {
     if (dinDoc.V2G_Message.Body.CurrentDemandReq_isUsed) {
         addMessageName("CurrentDemandReq");
         #define m dinDoc.V2G_Message.Body.CurrentDemandReq
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVReady); addProperty("DC_EVStatus.EVReady", sTmp);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVErrorCode); addProperty("DC_EVStatus.EVErrorCode", sTmp);
+        addIntProperty("DC_EVStatus.EVReady", m.DC_EVStatus.EVReady);
+        addIntProperty("DC_EVStatus.EVErrorCode", m.DC_EVStatus.EVErrorCode);
         translatedinDC_EVErrorCodeTypeToJson(m.DC_EVStatus.EVErrorCode);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVRESSSOC); addProperty("DC_EVStatus.EVRESSSOC", sTmp);
+        addIntProperty("DC_EVStatus.EVRESSSOC", m.DC_EVStatus.EVRESSSOC);
 
-        sprintf(sTmp, "%d", m.EVTargetCurrent.Multiplier); addProperty("EVTargetCurrent.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVTargetCurrent.Value); addProperty("EVTargetCurrent.Value", sTmp);
+        addIntProperty("EVTargetCurrent.Multiplier", m.EVTargetCurrent.Multiplier);
+        addIntProperty("EVTargetCurrent.Value", m.EVTargetCurrent.Value);
         translateUnitToJson("EVTargetCurrent.Unit", m.EVTargetCurrent.Unit);
 
-        sprintf(sTmp, "%d", m.EVMaximumVoltageLimit_isUsed); addProperty("EVMaximumVoltageLimit_isUsed", sTmp);
+        addIntProperty("EVMaximumVoltageLimit_isUsed", m.EVMaximumVoltageLimit_isUsed);
         if (m.EVMaximumVoltageLimit_isUsed) {
-          sprintf(sTmp, "%d", m.EVMaximumVoltageLimit.Multiplier); addProperty("EVMaximumVoltageLimit.Multiplier", sTmp);
-          sprintf(sTmp, "%d", m.EVMaximumVoltageLimit.Value); addProperty("EVMaximumVoltageLimit.Value", sTmp);
+          addIntProperty("EVMaximumVoltageLimit.Multiplier", m.EVMaximumVoltageLimit.Multiplier);
+          addIntProperty("EVMaximumVoltageLimit.Value", m.EVMaximumVoltageLimit.Value);
           translateUnitToJson("EVMaximumVoltageLimit.Unit", m.EVMaximumVoltageLimit.Unit);
         }
 
-        sprintf(sTmp, "%d", m.EVMaximumCurrentLimit_isUsed); addProperty("EVMaximumCurrentLimit_isUsed", sTmp);
+        addIntProperty("EVMaximumCurrentLimit_isUsed", m.EVMaximumCurrentLimit_isUsed);
         if (m.EVMaximumCurrentLimit_isUsed) {
-          sprintf(sTmp, "%d", m.EVMaximumCurrentLimit.Multiplier); addProperty("EVMaximumCurrentLimit.Multiplier", sTmp);
-          sprintf(sTmp, "%d", m.EVMaximumCurrentLimit.Value); addProperty("EVMaximumCurrentLimit.Value", sTmp);
+          addIntProperty("EVMaximumCurrentLimit.Multiplier", m.EVMaximumCurrentLimit.Multiplier);
+          addIntProperty("EVMaximumCurrentLimit.Value", m.EVMaximumCurrentLimit.Value);
           translateUnitToJson("EVMaximumCurrentLimit.Unit", m.EVMaximumCurrentLimit.Unit);
         }
         
-        sprintf(sTmp, "%d", m.EVMaximumPowerLimit_isUsed); addProperty("EVMaximumPowerLimit_isUsed", sTmp);
+        addIntProperty("EVMaximumPowerLimit_isUsed", m.EVMaximumPowerLimit_isUsed);
         if (m.EVMaximumPowerLimit_isUsed) {
-          sprintf(sTmp, "%d", m.EVMaximumPowerLimit.Multiplier); addProperty("EVMaximumPowerLimit.Multiplier", sTmp);
-          sprintf(sTmp, "%d", m.EVMaximumPowerLimit.Value); addProperty("EVMaximumPowerLimit.Value", sTmp);
+          addIntProperty("EVMaximumPowerLimit.Multiplier", m.EVMaximumPowerLimit.Multiplier);
+          addIntProperty("EVMaximumPowerLimit.Value", m.EVMaximumPowerLimit.Value);
           translateUnitToJson("EVMaximumPowerLimit.Unit", m.EVMaximumPowerLimit.Unit); 
         }
         
         //m.BulkChargingComplete_isUsed
         //m.BulkChargingComplete
-        sprintf(sTmp, "%d", m.ChargingComplete); addProperty("ChargingComplete", sTmp);
+        addIntProperty("ChargingComplete", m.ChargingComplete);
 
-        sprintf(sTmp, "%d", m.EVTargetVoltage.Multiplier); addProperty("EVTargetVoltage.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVTargetVoltage.Value); addProperty("EVTargetVoltage.Value", sTmp);
+        addIntProperty("EVTargetVoltage.Multiplier", m.EVTargetVoltage.Multiplier);
+        addIntProperty("EVTargetVoltage.Value", m.EVTargetVoltage.Value);
         translateUnitToJson("EVTargetVoltage.Unit", m.EVTargetVoltage.Unit); 
         #undef m
     }
@@ -1007,41 +1195,41 @@ void translateDocDinToJson(void) {
             #define v3 m.DC_EVSEStatus.EVSEStatusCode
             #define v4 m.DC_EVSEStatus.NotificationMaxDelay /* expected time until the PEV reacts on the below mentioned notification. Not relevant. */
             #define v5 m.DC_EVSEStatus.EVSENotification
-            sprintf(sTmp, "%d", v1); addProperty("DC_EVSEStatus.EVSEIsolationStatus", sTmp);
-            sprintf(sTmp, "%d", v2); addProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", sTmp);
-            sprintf(sTmp, "%d", v3); addProperty("DC_EVSEStatus.EVSEStatusCode", sTmp);
+            addIntProperty("DC_EVSEStatus.EVSEIsolationStatus", v1);
+            addIntProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", v2);
+            addIntProperty("DC_EVSEStatus.EVSEStatusCode", v3);
             translatedinDC_EVSEStatusCodeTypeToJson(v3);
-            sprintf(sTmp, "%d", v4); addProperty("DC_EVSEStatus.NotificationMaxDelay", sTmp);
-            sprintf(sTmp, "%d", v5); addProperty("DC_EVSEStatus.EVSENotification", sTmp);
+            addIntProperty("DC_EVSEStatus.NotificationMaxDelay", v4);
+            addIntProperty("DC_EVSEStatus.EVSENotification", v5);
             #undef v1
             #undef v2
             #undef v3
             #undef v4
             #undef v5
-        sprintf(sTmp, "%d", m.EVSEPresentVoltage.Multiplier); addProperty("EVSEPresentVoltage.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVSEPresentVoltage.Value); addProperty("EVSEPresentVoltage.Value", sTmp);
+        addIntProperty("EVSEPresentVoltage.Multiplier", m.EVSEPresentVoltage.Multiplier);
+        addIntProperty("EVSEPresentVoltage.Value", m.EVSEPresentVoltage.Value);
         translateUnitToJson("EVSEPresentVoltage.Unit", m.EVSEPresentVoltage.Unit); 
 
-        sprintf(sTmp, "%d", m.EVSEPresentCurrent.Multiplier); addProperty("EVSEPresentCurrent.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVSEPresentCurrent.Value); addProperty("EVSEPresentCurrent.Value", sTmp);
+        addIntProperty("EVSEPresentCurrent.Multiplier", m.EVSEPresentCurrent.Multiplier);
+        addIntProperty("EVSEPresentCurrent.Value", m.EVSEPresentCurrent.Value);
         translateUnitToJson("EVSEPresentCurrent.Unit", m.EVSEPresentCurrent.Unit); 
 
-        sprintf(sTmp, "%d", m.EVSECurrentLimitAchieved); addProperty("EVSECurrentLimitAchieved", sTmp);
-        sprintf(sTmp, "%d", m.EVSEVoltageLimitAchieved); addProperty("EVSEVoltageLimitAchieved", sTmp);
-        sprintf(sTmp, "%d", m.EVSEPowerLimitAchieved); addProperty("EVSEPowerLimitAchieved", sTmp);
+        addIntProperty("EVSECurrentLimitAchieved", m.EVSECurrentLimitAchieved);
+        addIntProperty("EVSEVoltageLimitAchieved", m.EVSEVoltageLimitAchieved);
+        addIntProperty("EVSEPowerLimitAchieved", m.EVSEPowerLimitAchieved);
 
-        sprintf(sTmp, "%d", m.EVSEMaximumVoltageLimit.Multiplier); addProperty("EVSEMaximumVoltageLimit.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVSEMaximumVoltageLimit.Value); addProperty("EVSEMaximumVoltageLimit.Value", sTmp);
+        addIntProperty("EVSEMaximumVoltageLimit.Multiplier", m.EVSEMaximumVoltageLimit.Multiplier);
+        addIntProperty("EVSEMaximumVoltageLimit.Value", m.EVSEMaximumVoltageLimit.Value);
         translateUnitToJson("EVSEMaximumVoltageLimit.Unit", m.EVSEMaximumVoltageLimit.Unit); 
 
         if (m.EVSEMaximumCurrentLimit_isUsed) {
-            sprintf(sTmp, "%d", m.EVSEMaximumCurrentLimit.Multiplier); addProperty("EVSEMaximumCurrentLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.EVSEMaximumCurrentLimit.Value); addProperty("EVSEMaximumCurrentLimit.Value", sTmp);
+            addIntProperty("EVSEMaximumCurrentLimit.Multiplier", m.EVSEMaximumCurrentLimit.Multiplier);
+            addIntProperty("EVSEMaximumCurrentLimit.Value", m.EVSEMaximumCurrentLimit.Value);
             translateUnitToJson("EVSEMaximumCurrentLimit.Unit", m.EVSEMaximumCurrentLimit.Unit); 
         }
         if (m.EVSEMaximumPowerLimit_isUsed) {
-            sprintf(sTmp, "%d", m.EVSEMaximumPowerLimit.Multiplier); addProperty("EVSEMaximumPowerLimit.Multiplier", sTmp);
-            sprintf(sTmp, "%d", m.EVSEMaximumPowerLimit.Value); addProperty("EVSEMaximumPowerLimit.Value", sTmp);
+            addIntProperty("EVSEMaximumPowerLimit.Multiplier", m.EVSEMaximumPowerLimit.Multiplier);
+            addIntProperty("EVSEMaximumPowerLimit.Value", m.EVSEMaximumPowerLimit.Value);
             translateUnitToJson("EVSEMaximumPowerLimit.Unit", m.EVSEMaximumPowerLimit.Unit); 
         }
         #undef m
@@ -1058,10 +1246,10 @@ void translateDocDinToJson(void) {
     if (dinDoc.V2G_Message.Body.WeldingDetectionReq_isUsed) {
         addMessageName("WeldingDetectionReq");
         #define m dinDoc.V2G_Message.Body.WeldingDetectionReq
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVReady); addProperty("DC_EVStatus.EVReady", sTmp);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVErrorCode); addProperty("DC_EVStatus.EVErrorCode", sTmp);
+        addIntProperty("DC_EVStatus.EVReady", m.DC_EVStatus.EVReady);
+        addIntProperty("DC_EVStatus.EVErrorCode", m.DC_EVStatus.EVErrorCode);
         translatedinDC_EVErrorCodeTypeToJson(m.DC_EVStatus.EVErrorCode);
-        sprintf(sTmp, "%d", m.DC_EVStatus.EVRESSSOC); addProperty("DC_EVStatus.EVRESSSOC", sTmp);    
+        addIntProperty("DC_EVStatus.EVRESSSOC", m.DC_EVStatus.EVRESSSOC);    
         #undef m
     }
     if (dinDoc.V2G_Message.Body.WeldingDetectionRes_isUsed) {
@@ -1073,14 +1261,14 @@ void translateDocDinToJson(void) {
         #define v3 m.DC_EVSEStatus.EVSEStatusCode
         #define v4 m.DC_EVSEStatus.NotificationMaxDelay /* expected time until the PEV reacts on the below mentioned notification. Not relevant. */
         #define v5 m.DC_EVSEStatus.EVSENotification
-        sprintf(sTmp, "%d", v1); addProperty("DC_EVSEStatus.EVSEIsolationStatus", sTmp);
-        sprintf(sTmp, "%d", v2); addProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", sTmp);
-        sprintf(sTmp, "%d", v3); addProperty("DC_EVSEStatus.EVSEStatusCode", sTmp);
+        addIntProperty("DC_EVSEStatus.EVSEIsolationStatus", v1);
+        addIntProperty("DC_EVSEStatus.EVSEIsolationStatus_isUsed", v2);
+        addIntProperty("DC_EVSEStatus.EVSEStatusCode", v3);
         translatedinDC_EVSEStatusCodeTypeToJson(v3);
-        sprintf(sTmp, "%d", v4); addProperty("DC_EVSEStatus.NotificationMaxDelay", sTmp);
-        sprintf(sTmp, "%d", v5); addProperty("DC_EVSEStatus.EVSENotification", sTmp);
-        sprintf(sTmp, "%d", m.EVSEPresentVoltage.Multiplier); addProperty("EVSEPresentVoltage.Multiplier", sTmp);
-        sprintf(sTmp, "%d", m.EVSEPresentVoltage.Value); addProperty("EVSEPresentVoltage.Value", sTmp);
+        addIntProperty("DC_EVSEStatus.NotificationMaxDelay", v4);
+        addIntProperty("DC_EVSEStatus.EVSENotification", v5);
+        addIntProperty("EVSEPresentVoltage.Multiplier", m.EVSEPresentVoltage.Multiplier);
+        addIntProperty("EVSEPresentVoltage.Value", m.EVSEPresentVoltage.Value);
         translateUnitToJson("EVSEPresentVoltage.Unit", m.EVSEPresentVoltage.Unit); 
         #undef v1
         #undef v2
@@ -1338,6 +1526,7 @@ static void encodeServicePaymentSelectionRequest(void) {
     init_dinServicePaymentSelectionReqType(&dinDoc.V2G_Message.Body.ServicePaymentSelectionReq);
     /* the mandatory fields in ISO are SelectedPaymentOption and SelectedServiceList. Same in DIN. */
     dinDoc.V2G_Message.Body.ServicePaymentSelectionReq.SelectedPaymentOption = dinpaymentOptionType_ExternalPayment; /* not paying per car */
+    allocateValue(dinDoc.V2G_Message.Body.ServicePaymentSelectionReq.SelectedServiceList.SelectedService.array, 1);
     dinDoc.V2G_Message.Body.ServicePaymentSelectionReq.SelectedServiceList.SelectedService.array[0].ServiceID = 1; /* todo: what ever this means. The Ioniq uses 1. */
     dinDoc.V2G_Message.Body.ServicePaymentSelectionReq.SelectedServiceList.SelectedService.arrayLen = 1; /* just one element in the array */ 
     prepareGlobalStream();
@@ -1438,9 +1627,11 @@ void encodeChargeParameterDiscoveryResponse(void) {
        So we set it here. */
     dinDoc.V2G_Message.Body.ChargeParameterDiscoveryRes.SAScheduleList_isUsed = 1u;
     dinDoc.V2G_Message.Body.ChargeParameterDiscoveryRes.SAScheduleList.SAScheduleTuple.arrayLen = 1;
+    allocateValue(dinDoc.V2G_Message.Body.ChargeParameterDiscoveryRes.SAScheduleList.SAScheduleTuple.array, 1);
     #define SchedTuple0 dinDoc.V2G_Message.Body.ChargeParameterDiscoveryRes.SAScheduleList.SAScheduleTuple.array[0]
     SchedTuple0.SAScheduleTupleID = 0;
     SchedTuple0.PMaxSchedule.PMaxScheduleID = 0;
+    allocateValue(SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array, 1);
     SchedTuple0.PMaxSchedule.PMaxScheduleEntry.arrayLen = 1;
     SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].TimeInterval_isUsed = 0;
     SchedTuple0.PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed = 1; /* at least one of TimeInterval and RelativeTimeInterval is
@@ -1455,7 +1646,11 @@ void encodeChargeParameterDiscoveryResponse(void) {
     
     //dinDoc.V2G_Message.Body.ChargeParameterDiscoveryRes.AC_EVSEChargeParameter
     //dinDoc.V2G_Message.Body.ChargeParameterDiscoveryRes.AC_EVSEChargeParameter_isUsed
+#if DATABINDING == DATABINDING_SLIM
+    cpdc = allocateValue(dinDoc.V2G_Message.Body.ChargeParameterDiscoveryRes.DC_EVSEChargeParameter, 1);
+#else
     cpdc = &dinDoc.V2G_Message.Body.ChargeParameterDiscoveryRes.DC_EVSEChargeParameter;
+#endif
     
     /* https://github.com/SmartEVSE/SmartEVSE-3/issues/25#issuecomment-1666231234
        Public chargers are reporting "invalid", which means, the isolation check has not
@@ -1750,7 +1945,8 @@ void encodeCurrentDemandResponse(void) {
     //m.EVSEMaximumPowerLimit
     #undef m
     prepareGlobalStream();
-    g_errn = encode_dinExiDocument(&global_stream1, &dinDoc);
+    g_errn = encode_dinCurrentDemandResTemplate(&global_stream1, &dinCurrentDemandResTmpl,
+        &dinDoc.V2G_Message.Header, &dinDoc.V2G_Message.Body.CurrentDemandRes);
     printGlobalStream();
     sprintf(gInfoString, "encodeCurrentDemandResponse finished");
 }
@@ -2046,31 +2242,42 @@ static void runTheEncoder(char* parameterStream) {
   }
 }
 
+static void decodeGlobalStream(char schema);
+
 /** Converting EXI stream to parameters  */
 static void runTheDecoder(char* parameterStream) {
-    int i;
-    int numBytes;
-    char strOneByteHex[3];
+    int len, numBytes, n;
+    uint8_t* buffer;
 
-    if (strlen(parameterStream)<4) {
+    len = strlen(parameterStream);
+    if (len<4) {
         /* minimum is 4 characters, e.g. DH01 */
         sprintf(gErrorString, "parameter too short");
         return;
     }
+    if (len%2!=0) {
+        sprintf(gErrorString, "odd number of hex characters");
+        return;
+    }
     /*** step 1: convert the hex string into an array of bytes ***/
-    global_stream1.size = BUFFER_SIZE;
-    global_stream1.data = mybuffer;
-    global_stream1.pos = &global_pos1;
-    numBytes=strlen(parameterStream)/2; /* contains one "virtual byte e.g. DH" at the beginning, which does not belong to the payload. */
-    global_pos1 = 0;
-    strOneByteHex[2]=0;
-    /* convert the hex stream into array of bytes: */
-    for (i=1; i<numBytes; i++) { /* starting at 1, means the first two characters (the direction-and-schema-selectors) are jumped-over. */
-        strOneByteHex[0] = parameterStream[2*i];
-        strOneByteHex[1] = parameterStream[2*i+1];
-        mybuffer[global_pos1++] = strtol(strOneByteHex, NULL, 16); /* convert the hex representation into a byte value */
-    }
-    sprintf(gInfoString, "%d bytes to convert", global_pos1);
+    numBytes = len/2-1; /* the first two characters (the direction-and-schema-selectors) do not belong to the payload. */
+    if (numBytes>gDecodeBufferSize) {
+        buffer = realloc(gDecodeBuffer, numBytes);
+        if (buffer==NULL) {
+            sprintf(gErrorString, "out of memory for %d bytes", numBytes);
+            return;
+        }
+        gDecodeBuffer = buffer;
+        gDecodeBufferSize = numBytes;
+    }
+    n = hexToBytes(&parameterStream[2], gDecodeBuffer, numBytes);
+    if (n<numBytes) {
+        sprintf(gErrorString, "no hex digit at position %d", 2+2*n+(hexDigitValues[(uint8_t)parameterStream[2+2*n]]!=0xff));
+        return;
+    }
+    init_bitstream(&global_stream1, gDecodeBuffer, numBytes, &global_pos1);
+    global_pos1 = numBytes;
+    sprintf(gInfoString, "%d bytes to convert", numBytes);
     /*
     printf("size = %d\n", global_stream1.size);
     printf("pos  = %d\n", *(global_stream1.pos));
@@ -2079,10 +2286,19 @@ static void runTheDecoder(char* parameterStream) {
     }
     printf("\n");
     */
-    *(global_stream1.pos) = 0; /* the decoder shall start at the byte 0 */    
-    
     /*** step 2: decide about which schema to use, and call the related decoder ***/
     /* The second character selects the schema. */
+    decodeGlobalStream(parameterStream[1]);
+}
+
+/* Decode the EXI data of global_stream1 (global_pos1 bytes) with the given schema:
+   H or h=applicationHandshake, D=DIN, 1=ISO1, 2=ISO2 */
+static void decodeGlobalStream(char schema) {
+    *(global_stream1.pos) = 0; /* the decoder shall start at the byte 0 */    
+#if DATABINDING == DATABINDING_SLIM
+    global_stream1.arena = &gArena;
+#endif
+    
     /* The OpenV2G supports 4 different decoders:
         decode_appHandExiDocument
         decode_iso1ExiDocument
@@ -2092,7 +2308,7 @@ static void runTheDecoder(char* parameterStream) {
         The first step in a session is always to use the decode_appHandExiDocument for finding out, which specification/decoder
         is used in the next steps. */
     g_errn = 0;
-    switch (parameterStream[1]) {
+    switch (schema) {
         case 'H': /* for the decoder, it does not matter whether it is a handshake request (H) or handshake response (h).
                      The same decoder schema is used. */
         case 'h':
@@ -2122,36 +2338,190 @@ static void runTheDecoder(char* parameterStream) {
     }        
 }
 
-/* The entry point */
-int main_commandline(int argc, char *argv[]) {
+/* A long running process (server mode) handles many commands. Bring the state which a command
+   depends on back to the state after program start, so that each command gives the same result
+   as a separate OpenV2G.exe call. Only the document of the selected schema is cleared. */
+static void resetState(char schema) {
+    static const uint8_t defaultSessionID[MAX_LEN_OF_SESSION_ID]={1, 2, 3, 4, 5, 6, 7, 8};
+    switch (schema) {
+        case 'H':
+        case 'h':
+            memset(&aphsDoc, 0, sizeof(aphsDoc));
+            break;
+        case 'D':
+            memset(&dinDoc, 0, sizeof(dinDoc));
+            break;
+        case '1':
+            memset(&iso1Doc, 0, sizeof(iso1Doc));
+            break;
+        case '2':
+            memset(&iso2Doc, 0, sizeof(iso2Doc));
+            break;
+    }
+    memset(mybuffer, 0, sizeof(mybuffer));
+    memset(&global_stream1, 0, sizeof(global_stream1));
+    global_pos1 = 0;
+#if DATABINDING == DATABINDING_SLIM
+    exiArenaInit(&gArena, gArenaBuffer, CLI_ARENA_SIZE);
+#endif
+    nNumberOfFoundAdditionalParameters = 0;
+    memset(gAdditionalParam, 0, sizeof(gAdditionalParam));
+    gLenOfSessionId = MAX_LEN_OF_SESSION_ID;
+    memcpy(gSessionID, defaultSessionID, sizeof(gSessionID));
+    memset(EVCCID, 0, sizeof(EVCCID));
+}
+
+/* clear the results of the previous command */
+static void resetResults(void) {
+    g_errn = 0;
     strcpy(gInfoString, "");
     strcpy(gErrorString, "");
-    strcpy(gResultString, "");
-    strcpy(gPropertiesString, "");
-    strcpy(gDebugString, "");
+    jsonInit(&gResult, gResultString, sizeof(gResultString));
+    jsonInit(&gProperties, gPropertiesString, sizeof(gPropertiesString));
+    jsonInit(&gDebug, gDebugString, sizeof(gDebugString));
     strcpy(gMessageName, "");
+}
+
+/* compose a JSON string out of all the elements */
+static int composeJson(char* json, int jsonSize) {
+    jsonWriter_t w;
+    addProperty("debug", gDebugString);
+    jsonInit(&w, json, jsonSize);
+    jsonAppend(&w, "{\n\"msgName\": \"");
+    jsonAppendEscaped(&w, gMessageName);
+    jsonAppend(&w, "\",\n\"info\": \"");
+    jsonAppendEscaped(&w, gInfoString);
+    jsonAppend(&w, "\", \n\"error\": \"");
+    jsonAppendEscaped(&w, gErrorString);
+    jsonAppend(&w, "\",\n\"result\": \"");
+    jsonAppendEscaped(&w, gResultString);
+    jsonAppend(&w, "\"");
+    jsonAppendChars(&w, gPropertiesString, gProperties.pos);
+    jsonAppend(&w, "\n}");
+    if (w.truncated || gResult.truncated || gProperties.truncated) {
+        return -1; /* the JSON string was truncated */
+    }
+    return w.pos;
+}
+
+/* Process one command, e.g. "DD809a0011..." or "EDi_380_20", and write the JSON result into json.
+   Returns the length of the JSON string, or -1 if it does not fit into jsonSize. */
+int commandline_processCommand(char* command, char* json, int jsonSize) {
+    resetState(command[0] ? command[1] : 0);
+    resetResults();
+    /* The first char of the parameter decides over Encoding or Decoding. */
+    if (command[0]=='E') {
+        runTheEncoder(command);
+    } else if (command[0]=='D') {
+        runTheDecoder(command);
+    } else {
+        sprintf(gErrorString, "The first character of the parameter must be D for decoding or E for encoding.");
+    }
+    return composeJson(json, jsonSize);
+}
+
+/* Decode a binary EXI message with the given schema (H, D, 1 or 2), and write the JSON result into json.
+   The message is decoded in place, it is not modified. */
+int commandline_processExi(char schema, uint8_t* exi, int exiLength, char* json, int jsonSize) {
+    resetState(schema);
+    resetResults();
+    init_bitstream(&global_stream1, exi, exiLength, &global_pos1);
+    global_pos1 = exiLength;
+    sprintf(gInfoString, "%d bytes to convert", exiLength);
+    decodeGlobalStream(schema);
+    return composeJson(json, jsonSize);
+}
+
+/* Get the EXI data of the last successful encode command. Returns -1 if there is none. */
+int commandline_getEncodedStream(uint8_t** exi, int* exiLength) {
+    if ((g_errn!=0) || (gErrorString[0]!=0) || (gResultString[0]==0)) {
+        return -1;
+    }
+    *exi = mybuffer;
+    *exiLength = *global_stream1.pos;
+    return 0;
+}
+
+/* Free the buffers of the calling thread. The worker threads call this before they end. */
+void commandline_releaseThread(void) {
+    free(gDecodeBuffer);
+    gDecodeBuffer = NULL;
+    gDecodeBufferSize = 0;
+}
+
+#define LINE_MODE_MAX_COMMAND_LENGTH 4096
+
+/* Streaming mode, "OpenV2G.exe L": read one command per line from stdin, and write for each
+   command one JSON object in one line to stdout, until the end of the input. This allows the caller
+   to keep one process for the whole charging session. Empty lines are ignored. */
+static int runTheLineMode(char* json, int jsonSize) {
+    static char line[LINE_MODE_MAX_COMMAND_LENGTH+2];
+    int len, n, i, k;
+    /* stdout is unbuffered (see main.c). Collect each answer and flush it at the end of the line. */
+    setvbuf(stdout, NULL, _IOFBF, jsonSize);
+    while (fgets(line, sizeof(line), stdin)!=NULL) {
+        len = strlen(line);
+        if ((len>0) && (line[len-1]!='\n') && !feof(stdin)) {
+            /* command too long. Skip the rest of the line. */
+            while ((k=getchar())!=EOF && k!='\n') {
+            }
+            resetResults();
+            sprintf(gErrorString, "command too long (maximum %d characters)", LINE_MODE_MAX_COMMAND_LENGTH);
+            n = composeJson(json, jsonSize);
+        } else {
+            while ((len>0) && (line[len-1]=='\n' || line[len-1]=='\r')) {
+                line[--len] = 0;
+            }
+            if (len==0) {
+                continue;
+            }
+            n = commandline_processCommand(line, json, jsonSize);
+        }
+        if (n<0) {
+            n = strlen(json); /* truncated */
+        }
+        /* one JSON object per line: drop the line breaks of the pretty printed JSON */
+        for (i=0, k=0; i<n; i++) {
+            if (json[i]!='\n' && json[i]!='\r') {
+                json[k++] = json[i];
+            }
+        }
+        json[k++] = '\n';
+        fwrite(json, 1, k, stdout);
+        fflush(stdout);
+    }
+    return 0;
+}
+
+/* The entry point */
+int main_commandline(int argc, char *argv[]) {
+    static char json[50000];
     if (argc>=2) {
         //printf("OpenV2G will process %s\n", argv[1]);
-        /* The first char of the parameter decides over Encoding or Decoding. */
-        if (argv[1][0]=='E') {
-            runTheEncoder(argv[1]);
-        } else if (argv[1][0]=='D') {
-            runTheDecoder(argv[1]);
-        } else {
-            sprintf(gErrorString, "The first character of the parameter must be D for decoding or E for encoding.");
+        if (argv[1][0]=='L') {
+            /* Streaming mode, one command per line on stdin */
+            return runTheLineMode(json, sizeof(json));
+        }
+#if CODE_VERSION == CODE_VERSION_COMMANDLINE && CODE_SERVER == CODE_SERVER_YES
+        if (argv[1][0]=='S') {
+            /* Server mode, e.g. "OpenV2G.exe S4 /tmp/openv2g.sock" */
+            return main_server(argc, argv);
+        }
+        if (argv[1][0]=='B' || argv[1][0]=='R') {
+            /* Batch mode, e.g. "OpenV2G.exe B8 messages.txt results.jsonl" */
+            return main_batch(argc, argv);
+        }
+        if (argv[1][0]=='P') {
+            /* Capture analyzer, e.g. "OpenV2G.exe P4 charging.pcapng results.jsonl" */
+            return main_pcap(argc, argv);
         }
+#endif
+        commandline_processCommand(argv[1], json, sizeof(json));
     } else {
+        resetResults();
         sprintf(gErrorString, "OpenV2G: Error: To few parameters.");
+        composeJson(json, sizeof(json));
     }
-    addProperty("debug", gDebugString);
-    /* compose a JSON string out of all the elements: */
-    printf("{\n\"msgName\": \"%s\",\n\"info\": \"%s\", \n\"error\": \"%s\",\n\"result\": \"%s\"%s\n}",
-        gMessageName,
-        gInfoString,
-        gErrorString,
-        gResultString,
-        gPropertiesString);
+    printf("%s", json);
     return 0;
 }
-
-
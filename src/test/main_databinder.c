@@ -54,14 +54,21 @@
 #endif /* DEPLOY_ISO2_CODEC == SUPPORT_YES */
 
 #include "ByteStream.h"
+#include "MemoryArena.h"
 
 /** EXI Debug mode */
 #define EXI_DEBUG 0
 
 #define BUFFER_SIZE 4096
-uint8_t bufferIn[BUFFER_SIZE];
 uint8_t bufferOut[BUFFER_SIZE];
 
+#if DATABINDING == DATABINDING_SLIM
+/* the large values of the decoded document */
+#define ARENA_SIZE 65536
+static uint8_t arenaBuffer[ARENA_SIZE];
+static exi_arena_t arena;
+#endif /* DATABINDING_SLIM */
+
 
 #if EXI_DEBUG == 1
 # define DEBUG_PRINTF(x) printf x
@@ -83,6 +90,8 @@ int main_databinder(int argc, char *argv[]) {
 	bitstream_t iStream, oStream;
 
 #if EXI_STREAM == BYTE_ARRAY
+	uint8_t* bufferIn;
+	size_t sizeIn;
 	size_t posDecode;
 	size_t posEncode;
 #endif /* EXI_STREAM == BYTE_ARRAY */
@@ -102,24 +111,22 @@ int main_databinder(int argc, char *argv[]) {
 #if EXI_STREAM == BYTE_ARRAY
 	/* input pos */
 	posDecode = 0;
-	/* parse EXI stream to internal byte structures  */
-	errn = readBytesFromFile(argv[1], bufferIn, BUFFER_SIZE, &posDecode);
+	/* map the EXI stream, the decoder reads the file pages without a copy */
+	errn = mapBytesFromFile(argv[1], &bufferIn, &sizeIn);
 	if (errn != 0) {
-		printf("Problems while reading file into buffer, err==%d\n", errn);
+		printf("Problems while mapping file, err==%d\n", errn);
 		return errn;
 	}
-	posDecode = 0; /* reset position */
 #endif /* EXI_STREAM == BYTE_ARRAY */
 
 	/* setup input stream */
 #if EXI_STREAM == BYTE_ARRAY
-	iStream.size = BUFFER_SIZE;
-	iStream.data = bufferIn;
-	iStream.pos = &posDecode;
+	init_bitstream(&iStream, bufferIn, sizeIn, &posDecode);
 #endif /* EXI_STREAM == BYTE_ARRAY */
-
-	iStream.buffer = 0;
-	iStream.capacity = 0;
+#if DATABINDING == DATABINDING_SLIM
+	exiArenaInit(&arena, arenaBuffer, ARENA_SIZE);
+	iStream.arena = &arena;
+#endif /* DATABINDING_SLIM */
 
 
 	printf("Start decoding EXI stream to databinding layer \n");
@@ -129,6 +136,9 @@ int main_databinder(int argc, char *argv[]) {
 #if DEPLOY_ISO2_CODEC == SUPPORT_YES
 	errn = decode_iso2ExiDocument(&iStream, &exi2Doc);
 #endif /* DEPLOY_ISO2_CODEC == SUPPORT_YES */
+#if EXI_STREAM == BYTE_ARRAY
+	unmapBytesFromFile(bufferIn, sizeIn);
+#endif /* EXI_STREAM == BYTE_ARRAY */
 	if (errn != 0) {
 		printf("Problems while decoding EXI stream, err==%d\n", errn);
 		return errn;
@@ -137,14 +147,9 @@ int main_databinder(int argc, char *argv[]) {
 #if EXI_STREAM == BYTE_ARRAY
 	/* setup output stream */
 	posEncode = 0;
-	oStream.size = BUFFER_SIZE;
-	oStream.data = bufferOut;
-	oStream.pos = &posEncode;
+	init_bitstream(&oStream, bufferOut, BUFFER_SIZE, &posEncode);
 #endif
 
-	oStream.buffer = 0;
-	oStream.capacity = 8;
-
 	printf("Start encoding databinding layer to EXI \n");
 #if DEPLOY_ISO1_CODEC == SUPPORT_YES
 	errn = encode_iso1ExiDocument(&oStream, &exi1Doc);
@@ -68,11 +68,26 @@
 #endif /* DEPLOY_ISO2_CODEC == SUPPORT_YES */
 
 #include "v2gtp.h"
+#include "ByteStream.h"
+#include "Sha256.h"
+#include "MemoryArena.h"
 
 #define BUFFER_SIZE 256
 uint8_t buffer1[BUFFER_SIZE];
 uint8_t buffer2[BUFFER_SIZE];
 
+#if DATABINDING == DATABINDING_SLIM
+/* The large values of the documents. The decoders take them from the arena, and so do the
+   examples where they fill a document (allocateValue). Each decoded message starts the arena
+   over, the documents filled before are encoded by then. */
+#define ARENA_SIZE 65536
+static uint8_t arenaBuffer[ARENA_SIZE];
+static exi_arena_t arena;
+#define allocateValue(member, n) ((member) = exiArenaAllocateCleared(&arena, (n)*sizeof(*(member))))
+#else
+#define allocateValue(member, n)
+#endif
+
 #define ERROR_UNEXPECTED_REQUEST_MESSAGE -601
 #define ERROR_UNEXPECTED_SESSION_SETUP_RESP_MESSAGE -602
 #define ERROR_UNEXPECTED_SERVICE_DISCOVERY_RESP_MESSAGE -602
@@ -126,6 +141,16 @@ static void copyBytes(uint8_t* from, uint16_t len, uint8_t* to) {
 	}
 }
 
+/* the decoder of the stream takes the large values from the arena, starting it over */
+static void useArena(bitstream_t* stream) {
+#if DATABINDING == DATABINDING_SLIM
+	exiArenaInit(&arena, arenaBuffer, ARENA_SIZE);
+	stream->arena = &arena;
+#else
+	(void)stream;
+#endif
+}
+
 
 /** Example implementation of the app handshake protocol for the EVSE side  */
 static int appHandshakeHandler(bitstream_t* iStream, bitstream_t* oStream) {
@@ -195,13 +220,9 @@ static int appHandshake()
 	char* ns0 = "urn:iso:15118:2:2010:MsgDef";
 	char* ns1 = "urn:din:70121:2012:MsgDef";
 
-	stream1.size = BUFFER_SIZE;
-	stream1.data = buffer1;
-	stream1.pos = &pos1;
+	init_bitstream(&stream1, buffer1, BUFFER_SIZE, &pos1);
 
-	stream2.size = BUFFER_SIZE;
-	stream2.data = buffer2;
-	stream2.pos = &pos2;
+	init_bitstream(&stream2, buffer2, BUFFER_SIZE, &pos2);
 
 	init_appHandEXIDocument(&handshake);
 
@@ -280,7 +301,7 @@ static int serialize2EXI2Stream(struct iso2EXIDocument* exiIn, bitstream_t* stre
 	int errn;
 	*stream->pos = V2GTP_HEADER_LENGTH;  /* v2gtp header */
 	if( (errn = encode_iso2ExiDocument(stream, exiIn)) == 0) {
-		errn = write_v2gtpHeader(stream->data, (*stream->pos)-V2GTP_HEADER_LENGTH, V2GTP_EXI_TYPE);
+		errn = write_v2gtpFrameHeader(stream, V2GTP_EXI_TYPE);
 	}
 	return errn;
 }
@@ -289,13 +310,20 @@ static int serialize2EXI2Stream(struct iso2EXIDocument* exiIn, bitstream_t* stre
 /* deserializes V2G TP header and decodes right away EXI stream */
 static int deserialize2Stream2EXI(bitstream_t* streamIn, struct iso2EXIDocument* exi) {
 	int errn;
-	uint32_t payloadLength;
-
-	*streamIn->pos = 0;
-	if ( (errn = read_v2gtpHeader(streamIn->data, &payloadLength)) == 0) {
-		*streamIn->pos += V2GTP_HEADER_LENGTH;
-
-		errn = decode_iso2ExiDocument(streamIn, exi);
+	struct v2gtpReceiveBuffer rb;
+	struct v2gtpFrame frame;
+	bitstream_t payload;
+	size_t payloadPos;
+
+	/* the frame is decoded in place, no copy of the payload */
+	init_v2gtpReceiveBuffer(&rb, streamIn->data, (uint32_t)streamIn->size, 0);
+	commit_v2gtpReceiveBuffer(&rb, (uint32_t)streamIn->size);
+	if ( read_v2gtpFrame(&rb, &frame) == 1 && frame.payloadType == V2GTP_EXI_TYPE) {
+		init_v2gtpPayloadStream(&frame, &payload, &payloadPos);
+		useArena(&payload);
+		errn = decode_iso2ExiDocument(&payload, exi);
+	} else {
+		errn = -1;
 	}
 	return errn;
 }
@@ -328,6 +356,7 @@ static int sessionSetup2(struct iso2EXIDocument* exiIn, struct iso2EXIDocument*
 	init_iso2SessionSetupResType(&exiOut->V2G_Message.Body.SessionSetupRes);
 
 	exiOut->V2G_Message.Body.SessionSetupRes.ResponseCode = iso2responseCodeType_OK;
+	allocateValue(exiOut->V2G_Message.Body.SessionSetupRes.EVSEID.characters, 2);
 	exiOut->V2G_Message.Body.SessionSetupRes.EVSEID.characters[0] = 0;
 	exiOut->V2G_Message.Body.SessionSetupRes.EVSEID.characters[1] = 20;
 	exiOut->V2G_Message.Body.SessionSetupRes.EVSEID.charactersLen = 2;
@@ -399,7 +428,9 @@ static int serviceDetail2(struct iso2EXIDocument* exiIn, struct iso2EXIDocument*
 	/* Parameter Set 1*/
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].ParameterSetID = 1;
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.arrayLen = 2;
+	allocateValue(exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array, 2);
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[0].Name.charactersLen = 8;
+	allocateValue(exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[0].Name.characters, 8);
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[0].Name.characters[0] = 'P';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[0].Name.characters[1] = 'r';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[0].Name.characters[2] = 'o';
@@ -412,6 +443,7 @@ static int serviceDetail2(struct iso2EXIDocument* exiIn, struct iso2EXIDocument*
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[0].intValue_isUsed = 1u;
 
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].Name.charactersLen = 4;
+	allocateValue(exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].Name.characters, 4);
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].Name.characters[0] = 'N';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].Name.characters[1] = 'a';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].Name.characters[2] = 'm';
@@ -419,6 +451,7 @@ static int serviceDetail2(struct iso2EXIDocument* exiIn, struct iso2EXIDocument*
 
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].stringValue_isUsed = 1u;
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].stringValue.charactersLen = 3;
+	allocateValue(exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].stringValue.characters, 3);
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].stringValue.characters[0] = 'V';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].stringValue.characters[1] = '2';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].stringValue.characters[2] = 'G';
@@ -426,7 +459,9 @@ static int serviceDetail2(struct iso2EXIDocument* exiIn, struct iso2EXIDocument*
 	/* Parameter Set 2 */
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].ParameterSetID = 2;
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.arrayLen = 1;
+	allocateValue(exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.array, 1);
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.array[0].Name.charactersLen = 7;
+	allocateValue(exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.array[0].Name.characters, 7);
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.array[0].Name.characters[0] = 'C';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.array[0].Name.characters[1] = 'h';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.array[0].Name.characters[2] = 'a';
@@ -448,6 +483,7 @@ static int serviceDetail2(struct iso2EXIDocument* exiIn, struct iso2EXIDocument*
 
 static int paymentServiceSelection2(struct iso2EXIDocument* exiIn, struct iso2EXIDocument* exiOut) {
 	int i;
+	struct iso2SelectedServiceListType* vasList;
 
 	printf("EVSE side: paymentServiceSelection called\n"  );
 	printf("\tReceived data:\n");
@@ -459,10 +495,15 @@ static int paymentServiceSelection2(struct iso2EXIDocument* exiIn, struct iso2EX
 	}
 
 	if(exiIn->V2G_Message.Body.PaymentServiceSelectionReq.SelectedVASList_isUsed) {
-		for(i=0; i<exiIn->V2G_Message.Body.PaymentServiceSelectionReq.SelectedVASList.SelectedService.arrayLen;i++)
+#if DATABINDING == DATABINDING_SLIM
+		vasList = exiIn->V2G_Message.Body.PaymentServiceSelectionReq.SelectedVASList;
+#else
+		vasList = &exiIn->V2G_Message.Body.PaymentServiceSelectionReq.SelectedVASList;
+#endif
+		for(i=0; i<vasList->SelectedService.arrayLen;i++)
 		{
-			printf("\t\t ServiceID=%d\n", exiIn->V2G_Message.Body.PaymentServiceSelectionReq.SelectedVASList.SelectedService.array[i].ServiceID);
-			printf("\t\t ParameterSetID=%d\n", exiIn->V2G_Message.Body.PaymentServiceSelectionReq.SelectedVASList.SelectedService.array[i].ParameterSetID);
+			printf("\t\t ServiceID=%d\n", vasList->SelectedService.array[i].ServiceID);
+			printf("\t\t ParameterSetID=%d\n", vasList->SelectedService.array[i].ParameterSetID);
 		}
 	}
 
@@ -597,6 +638,7 @@ static int chargingStatus2(struct iso2EXIDocument* exiIn, struct iso2EXIDocument
 
 
 	exiOut->V2G_Message.Body.ChargingStatusRes.ResponseCode = iso2responseCodeType_OK;
+	allocateValue(exiOut->V2G_Message.Body.ChargingStatusRes.EVSEID.characters, 1);
 	exiOut->V2G_Message.Body.ChargingStatusRes.EVSEID.characters[0]= 'A';
 	exiOut->V2G_Message.Body.ChargingStatusRes.EVSEID.charactersLen =1;
 
@@ -750,13 +792,9 @@ static int request_response2(struct iso2EXIDocument* exiIn, struct iso2EXIDocume
 	size_t pos1;
 	size_t pos2;
 
-	stream1.size = BUFFER_SIZE;
-	stream1.data = buffer1;
-	stream1.pos = &pos1;
+	init_bitstream(&stream1, buffer1, BUFFER_SIZE, &pos1);
 
-	stream2.size = BUFFER_SIZE;
-	stream2.data = buffer2;
-	stream2.pos = &pos2;
+	init_bitstream(&stream2, buffer2, BUFFER_SIZE, &pos2);
 
 	/* EV side */
 	errn = serialize2EXI2Stream(exiIn, &stream1);
@@ -1023,13 +1061,16 @@ static int charging2()
 	exiIn.V2G_Message.Body.PaymentDetailsReq.eMAID.characters[1] = 123;
 	exiIn.V2G_Message.Body.PaymentDetailsReq.eMAID.charactersLen =2;
 
+	allocateValue(exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.Certificate.bytes, 2);
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.Certificate.bytes[0] = 'C';
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.Certificate.bytes[1] = 'e';
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.Certificate.bytesLen = 2;
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.SubCertificates_isUsed = 1u;
+	allocateValue(exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.SubCertificates.Certificate.array[0].bytes, 2);
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.SubCertificates.Certificate.array[0].bytes[0] = 'S';
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.SubCertificates.Certificate.array[0].bytes[1] = 'u';
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.SubCertificates.Certificate.array[0].bytesLen = 2;
+	allocateValue(exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.SubCertificates.Certificate.array[1].bytes, 3);
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.SubCertificates.Certificate.array[1].bytes[0] = 'S';
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.SubCertificates.Certificate.array[1].bytes[1] = 'u';
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.SubCertificates.Certificate.array[1].bytes[2] = '2';
@@ -1037,6 +1078,7 @@ static int charging2()
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.SubCertificates.Certificate.arrayLen =2;
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.Id_isUsed = 1u;
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.Id.charactersLen = 2;
+	allocateValue(exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.Id.characters, 2);
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.Id.characters[0] = 'I';
 	exiIn.V2G_Message.Body.PaymentDetailsReq.ContractSignatureCertChain.Id.characters[0] = 'd';
 
@@ -1082,6 +1124,7 @@ static int charging2()
 	exiIn.V2G_Message.Body.AuthorizationReq.GenChallenge_isUsed = 1u; /* no challenge needed here*/
 	exiIn.V2G_Message.Body.AuthorizationReq.Id_isUsed = 1u; /* no signature needed here */
 	exiIn.V2G_Message.Body.AuthorizationReq.Id.charactersLen = 3;
+	allocateValue(exiIn.V2G_Message.Body.AuthorizationReq.Id.characters, 3);
 	exiIn.V2G_Message.Body.AuthorizationReq.Id.characters[0] = 'I';
 	exiIn.V2G_Message.Body.AuthorizationReq.Id.characters[1] = 'd';
 	exiIn.V2G_Message.Body.AuthorizationReq.Id.characters[2] = '2';
@@ -1270,7 +1313,8 @@ static int charging2()
 
 	exiIn.V2G_Message.Body.PowerDeliveryReq.ChargeProgress = iso2chargeProgressType_Start;
 	exiIn.V2G_Message.Body.PowerDeliveryReq.SAScheduleTupleID_isUsed = 1u;
-	exiIn.V2G_Message.Body.PowerDeliveryReq.SAScheduleTupleID = exiOut.V2G_Message.Body.ChargeParameterDiscoveryRes.SAScheduleList.SAScheduleTuple.array[0].SAScheduleTupleID;
+	/* the ChargeParameterDiscoveryRes of this EVSE carries no SAScheduleList, take the first tuple */
+	exiIn.V2G_Message.Body.PowerDeliveryReq.SAScheduleTupleID = 1;
 
 	printf("EV side: call EVSE powerDelivery \n");
 
@@ -1355,6 +1399,7 @@ static int charging2()
 	init_iso2MeteringReceiptReqType(&exiIn.V2G_Message.Body.MeteringReceiptReq);
 
 
+	allocateValue(exiIn.V2G_Message.Body.MeteringReceiptReq.Id.characters, 3);
 	exiIn.V2G_Message.Body.MeteringReceiptReq.Id.characters[0]='I';
 	exiIn.V2G_Message.Body.MeteringReceiptReq.Id.characters[1]='d';
 	exiIn.V2G_Message.Body.MeteringReceiptReq.Id.characters[2]='3';
@@ -1364,6 +1409,7 @@ static int charging2()
 	exiIn.V2G_Message.Body.MeteringReceiptReq.SessionID.bytesLen = 1;
 
 	init_iso2MeterInfoType(&exiIn.V2G_Message.Body.MeteringReceiptReq.MeterInfo);
+	allocateValue(exiIn.V2G_Message.Body.MeteringReceiptReq.MeterInfo.MeterID.characters, 3);
 	exiIn.V2G_Message.Body.MeteringReceiptReq.MeterInfo.MeterID.characters[0] = 'M';
 	exiIn.V2G_Message.Body.MeteringReceiptReq.MeterInfo.MeterID.characters[1] = 'i';
 	exiIn.V2G_Message.Body.MeteringReceiptReq.MeterInfo.MeterID.characters[2] = 'd';
@@ -1453,7 +1499,7 @@ static int serialize1EXI2Stream(struct iso1EXIDocument* exiIn, bitstream_t* stre
 	int errn;
 	*stream->pos = V2GTP_HEADER_LENGTH;  /* v2gtp header */
 	if( (errn = encode_iso1ExiDocument(stream, exiIn)) == 0) {
-		errn = write_v2gtpHeader(stream->data, (*stream->pos)-V2GTP_HEADER_LENGTH, V2GTP_EXI_TYPE);
+		errn = write_v2gtpFrameHeader(stream, V2GTP_EXI_TYPE);
 	}
 	return errn;
 }
@@ -1463,13 +1509,20 @@ static int serialize1EXI2Stream(struct iso1EXIDocument* exiIn, bitstream_t* stre
 /* deserializes V2G TP header and decodes right away EXI stream */
 static int deserialize1Stream2EXI(bitstream_t* streamIn, struct iso1EXIDocument* exi) {
 	int errn;
-	uint32_t payloadLength;
-
-	*streamIn->pos = 0;
-	if ( (errn = read_v2gtpHeader(streamIn->data, &payloadLength)) == 0) {
-		*streamIn->pos += V2GTP_HEADER_LENGTH;
-
-		errn = decode_iso1ExiDocument(streamIn, exi);
+	struct v2gtpReceiveBuffer rb;
+	struct v2gtpFrame frame;
+	bitstream_t payload;
+	size_t payloadPos;
+
+	/* the frame is decoded in place, no copy of the payload */
+	init_v2gtpReceiveBuffer(&rb, streamIn->data, (uint32_t)streamIn->size, 0);
+	commit_v2gtpReceiveBuffer(&rb, (uint32_t)streamIn->size);
+	if ( read_v2gtpFrame(&rb, &frame) == 1 && frame.payloadType == V2GTP_EXI_TYPE) {
+		init_v2gtpPayloadStream(&frame, &payload, &payloadPos);
+		useArena(&payload);
+		errn = decode_iso1ExiDocument(&payload, exi);
+	} else {
+		errn = -1;
 	}
 	return errn;
 }
@@ -1504,6 +1557,7 @@ static int sessionSetup1(struct iso1EXIDocument* exiIn, struct iso1EXIDocument*
 	init_iso1SessionSetupResType(&exiOut->V2G_Message.Body.SessionSetupRes);
 
 	exiOut->V2G_Message.Body.SessionSetupRes.ResponseCode = iso1responseCodeType_OK;
+	allocateValue(exiOut->V2G_Message.Body.SessionSetupRes.EVSEID.characters, 2);
 	exiOut->V2G_Message.Body.SessionSetupRes.EVSEID.characters[0] = 0;
 	exiOut->V2G_Message.Body.SessionSetupRes.EVSEID.characters[1] = 20;
 	exiOut->V2G_Message.Body.SessionSetupRes.EVSEID.charactersLen = 2;
@@ -1539,7 +1593,9 @@ static int serviceDetail1(struct iso1EXIDocument* exiIn, struct iso1EXIDocument*
 	/* Parameter Set 1*/
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].ParameterSetID = 1;
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.arrayLen = 2;
+	allocateValue(exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array, 2);
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[0].Name.charactersLen = 8;
+	allocateValue(exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[0].Name.characters, 8);
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[0].Name.characters[0] = 'P';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[0].Name.characters[1] = 'r';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[0].Name.characters[2] = 'o';
@@ -1552,6 +1608,7 @@ static int serviceDetail1(struct iso1EXIDocument* exiIn, struct iso1EXIDocument*
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[0].intValue_isUsed = 1u;
 
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].Name.charactersLen = 4;
+	allocateValue(exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].Name.characters, 4);
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].Name.characters[0] = 'N';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].Name.characters[1] = 'a';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].Name.characters[2] = 'm';
@@ -1559,6 +1616,7 @@ static int serviceDetail1(struct iso1EXIDocument* exiIn, struct iso1EXIDocument*
 
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].stringValue_isUsed = 1u;
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].stringValue.charactersLen = 3;
+	allocateValue(exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].stringValue.characters, 3);
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].stringValue.characters[0] = 'V';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].stringValue.characters[1] = '2';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[0].Parameter.array[1].stringValue.characters[2] = 'G';
@@ -1566,7 +1624,9 @@ static int serviceDetail1(struct iso1EXIDocument* exiIn, struct iso1EXIDocument*
 	/* Parameter Set 2 */
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].ParameterSetID = 2;
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.arrayLen = 1;
+	allocateValue(exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.array, 1);
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.array[0].Name.charactersLen = 7;
+	allocateValue(exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.array[0].Name.characters, 7);
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.array[0].Name.characters[0] = 'C';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.array[0].Name.characters[1] = 'h';
 	exiOut->V2G_Message.Body.ServiceDetailRes.ServiceParameterList.ParameterSet.array[1].Parameter.array[0].Name.characters[2] = 'a';
@@ -1651,6 +1711,7 @@ static int chargingStatus1(struct iso1EXIDocument* exiIn, struct iso1EXIDocument
 
 
 	exiOut->V2G_Message.Body.ChargingStatusRes.ResponseCode = iso1responseCodeType_OK;
+	allocateValue(exiOut->V2G_Message.Body.ChargingStatusRes.EVSEID.characters, 1);
 	exiOut->V2G_Message.Body.ChargingStatusRes.EVSEID.characters[0]= 'A';
 	exiOut->V2G_Message.Body.ChargingStatusRes.EVSEID.charactersLen =1;
 
@@ -1799,13 +1860,9 @@ static int request_response1(struct iso1EXIDocument* exiIn, struct iso1EXIDocume
 	size_t pos1;
 	size_t pos2;
 
-	stream1.size = BUFFER_SIZE;
-	stream1.data = buffer1;
-	stream1.pos = &pos1;
+	init_bitstream(&stream1, buffer1, BUFFER_SIZE, &pos1);
 
-	stream2.size = BUFFER_SIZE;
-	stream2.data = buffer2;
-	stream2.pos = &pos2;
+	init_bitstream(&stream2, buffer2, BUFFER_SIZE, &pos2);
 
 	/* EV side */
 	errn = serialize1EXI2Stream(exiIn, &stream1);
@@ -1844,7 +1901,6 @@ static int charging1()
 	struct iso1EXIDocument exiOut;
 
 	struct iso1ServiceDetailResType serviceDetailRes;
-	struct iso1PaymentDetailsResType paymentDetailsRes;
 
 	/* setup header information */
 	init_iso1EXIDocument(&exiIn);
@@ -1965,11 +2021,10 @@ static int charging1()
 
 	init_iso1AuthorizationReqType(&exiIn.V2G_Message.Body.AuthorizationReq);
 
-	copyBytes(paymentDetailsRes.GenChallenge.bytes, paymentDetailsRes.GenChallenge.bytesLen, exiIn.V2G_Message.Body.AuthorizationReq.GenChallenge.bytes);
-	exiIn.V2G_Message.Body.AuthorizationReq.GenChallenge.bytesLen = paymentDetailsRes.GenChallenge.bytesLen;
-	exiIn.V2G_Message.Body.AuthorizationReq.GenChallenge_isUsed = 1u; /* no challenge needed here*/
+	exiIn.V2G_Message.Body.AuthorizationReq.GenChallenge_isUsed = 0u; /* no challenge needed here, this session skips PaymentDetails */
 	exiIn.V2G_Message.Body.AuthorizationReq.Id_isUsed = 1u; /* no signature needed here */
 	exiIn.V2G_Message.Body.AuthorizationReq.Id.charactersLen = 3;
+	allocateValue(exiIn.V2G_Message.Body.AuthorizationReq.Id.characters, 3);
 	exiIn.V2G_Message.Body.AuthorizationReq.Id.characters[0] = 'I';
 	exiIn.V2G_Message.Body.AuthorizationReq.Id.characters[1] = 'd';
 	exiIn.V2G_Message.Body.AuthorizationReq.Id.characters[2] = '2';
@@ -2092,7 +2147,8 @@ static int charging1()
 	init_iso1PowerDeliveryReqType(&exiIn.V2G_Message.Body.PowerDeliveryReq);
 
 	exiIn.V2G_Message.Body.PowerDeliveryReq.ChargeProgress = iso1chargeProgressType_Start;
-	exiIn.V2G_Message.Body.PowerDeliveryReq.SAScheduleTupleID = exiOut.V2G_Message.Body.ChargeParameterDiscoveryRes.SAScheduleList.SAScheduleTuple.array[0].SAScheduleTupleID;
+	/* this session skips ChargeParameterDiscovery, take the first tuple */
+	exiIn.V2G_Message.Body.PowerDeliveryReq.SAScheduleTupleID = 1;
 
 	printf("EV side: call EVSE powerDelivery \n");
 
@@ -2218,13 +2274,9 @@ static int din_test() {
 	size_t pos1 = 0;
 	size_t pos2 = 0;
 
-	stream1.size = BUFFER_SIZE;
-	stream1.data = buffer1;
-	stream1.pos = &pos1;
+	init_bitstream(&stream1, buffer1, BUFFER_SIZE, &pos1);
 
-	stream2.size = BUFFER_SIZE;
-	stream2.data = buffer2;
-	stream2.pos = &pos2;
+	init_bitstream(&stream2, buffer2, BUFFER_SIZE, &pos2);
 
 	/* SetupSessionReq  */
 	/* BMW: 80 9A 00 11 D0 20 00 03 C1 FC 30 00 43 F8 00 */
@@ -2244,6 +2296,7 @@ static int din_test() {
 	buffer1[13] = 0xF8;
 	buffer1[14] = 0x00;
 
+	useArena(&stream1);
 	errn =  decode_dinExiDocument(&stream1, &exiDin1);
 
 	if(errn != 0) {
@@ -2280,6 +2333,7 @@ static int din_test() {
 	buffer2[19] = 0x94;
 	buffer2[20] = 0x00;
 
+	useArena(&stream2);
 	errn =  decode_dinExiDocument(&stream2, &exiDin2);
 
 	if(errn != 0) {
@@ -2310,6 +2364,7 @@ static int din_test() {
 	buffer2[11] = 0x91;
 	buffer2[12] = 0xf0;
 
+	useArena(&stream2);
 	errn =  decode_dinExiDocument(&stream2, &exiDin2);
 
 	if(errn != 0) {
@@ -2345,15 +2400,11 @@ static int xmldsig_test() {
 
 	bitstream_t stream1;
 	size_t pos1 = 0;
-	stream1.size = BUFFER_SIZE;
-	stream1.data = buffer1;
-	stream1.pos = &pos1;
+	init_bitstream(&stream1, buffer1, BUFFER_SIZE, &pos1);
 
 	bitstream_t stream2;
 	size_t pos2 = 0;
-	stream2.size = BUFFER_SIZE;
-	stream2.data = buffer2;
-	stream2.pos = &pos2;
+	init_bitstream(&stream2, buffer2, BUFFER_SIZE, &pos2);
 
 	struct iso2EXIFragment exiV2G_AR;
 	struct xmldsigEXIFragment exiXMLDSIG_SI;
@@ -2379,6 +2430,7 @@ static int xmldsig_test() {
 	init_iso2AuthorizationReqType(&exiV2G_AR.AuthorizationReq);
 	exiV2G_AR.AuthorizationReq.Id_isUsed = 1;
 	exiV2G_AR.AuthorizationReq.Id.charactersLen = 3;
+	allocateValue(exiV2G_AR.AuthorizationReq.Id.characters, 3);
 	exiV2G_AR.AuthorizationReq.Id.characters[0] = 'I';
 	exiV2G_AR.AuthorizationReq.Id.characters[1] = 'D';
 	exiV2G_AR.AuthorizationReq.Id.characters[2] = '1';
@@ -2419,8 +2471,23 @@ static int xmldsig_test() {
 		}
 	}
 
-	/* TODO Create Hash for stream 1 etc ... */
 	/* SHA-256 is "0bXgPQBlvuVrMXmERTBR61TKGPwOCRYXT4s8d6mPSqk=" */
+#if ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+	{
+		/* the digest is computed while encoding, the bytes are not needed for it */
+		uint8_t digest[EXI_SHA256_DIGEST_SIZE];
+		bitstream_t digestStream;
+		size_t digestPos = 0;
+		init_bitstream(&digestStream, NULL, 0, &digestPos);
+
+		errn = encode_iso2ExiFragmentDigest(&digestStream, &exiV2G_AR, digest);
+		if(errn != 0 || digestPos != sizeIsoStream1 || memcmp(digest, digestValue, EXI_SHA256_DIGEST_SIZE) != 0) {
+			errn = -1;
+			printf("EXI1 digest does not match !\n");
+			return errn;
+		}
+	}
+#endif /* ENCODER_DIGEST_SHA256 */
 
 	/*
 	<xmlsig:SignedInfo xmlns:xmlsig="http://www.w3.org/2000/09/xmldsig#" >
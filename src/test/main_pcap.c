@@ -0,0 +1,946 @@
+/*******************************************************************
+ * Capture analyzer for OpenV2G: decodes the V2G messages of a pcap or
+ * pcapng file, using the batch pipeline of main_batch.c.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+/* Usage:
+     OpenV2G.exe P[<workers>] <captureFile> [<outputFile>]
+   e.g. "OpenV2G.exe P4 charging.pcapng results.jsonl". The capture file "-" is stdin, and without the output file the
+   results go to stdout. Without the number, there is one worker per CPU.
+
+   The capture may be a pcap file (microsecond or nanosecond time stamps, both byte orders) or a pcapng file, with the
+   link types Ethernet (also with VLAN tags), Linux cooked (SLL, SLL2), raw IP and BSD loopback. The TCP connections
+   over IPv4 and IPv6 are reassembled in the order of the sequence numbers: retransmissions and overlaps are cut off,
+   segments which come too early wait until the gap is filled. Each V2GTP frame with an EXI message gives one JSON
+   object in one line, in the order of the capture, e.g.
+     {"time": "1700000000.123456", "connection": 1, "from": "[fe80::2]:50321", "to": "[fe80::1]:15118", "info": ...}
+   followed by the members which the streaming mode prints for the message.
+
+   The schema of a connection is found like the EVSE does it: the messages start with the application handshake.
+   The supportedAppProtocolReq tells the namespaces and SchemaIDs of the car, the SchemaID of the
+   supportedAppProtocolRes selects DIN, ISO1 or ISO2 for the following messages of the connection.
+
+   The reader thread parses the capture and reassembles the streams, the workers of the batch pipeline decode the
+   messages. The file is read block by block, so the memory does not depend on the size of the capture, only on the
+   number of open connections with an incomplete frame. Connections without V2GTP, e.g. TLS, are reported on stderr
+   and skipped. UDP (e.g. SDP) is not analyzed.
+*/
+
+#include "main.h"
+
+#if CODE_VERSION == CODE_VERSION_COMMANDLINE && CODE_SERVER == CODE_SERVER_YES
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+
+#include "EXITypes.h"
+#include "appHandEXIDatatypes.h"
+#include "appHandEXIDatatypesDecoder.h"
+#include "v2gtp.h"
+
+#define PCAP_MAGIC 0xA1B2C3D4 /* microsecond time stamps */
+#define PCAP_MAGIC_NANO 0xA1B23C4D /* nanosecond time stamps */
+#define PCAPNG_SECTION_HEADER 0x0A0D0D0A
+#define PCAPNG_BYTE_ORDER_MAGIC 0x1A2B3C4D
+#define PCAPNG_INTERFACE_DESCRIPTION 1
+#define PCAPNG_PACKET 2 /* obsolete packet block */
+#define PCAPNG_SIMPLE_PACKET 3
+#define PCAPNG_ENHANCED_PACKET 6
+#define PCAPNG_OPTION_TSRESOL 9
+
+#define LINKTYPE_NULL 0
+#define LINKTYPE_ETHERNET 1
+#define LINKTYPE_RAW_BSD 12
+#define LINKTYPE_RAW 101
+#define LINKTYPE_LINUX_SLL 113
+#define LINKTYPE_IPV4 228
+#define LINKTYPE_IPV6 229
+#define LINKTYPE_LINUX_SLL2 276
+
+#define PCAP_MAX_BLOCK_LENGTH (16*1024*1024) /* longer packets or blocks are taken as a broken file */
+#define PCAP_CONNECTION_BUCKETS 4096
+#define PCAP_MAX_PENDING (1024*1024) /* out of order bytes per direction, more are taken as a lost segment */
+#define PCAP_RECEIVE_BUFFER_SIZE (V2GTP_HEADER_LENGTH+65536) /* longer frames are reported */
+#define PCAP_TAG_SIZE 256
+#define PCAP_ADDRESS_SIZE (INET6_ADDRSTRLEN+8) /* "[address]:port" */
+
+#define TCP_FIN 0x01
+#define TCP_SYN 0x02
+#define TCP_RST 0x04
+#define TCP_ACK 0x10
+
+struct pcapTime {
+    unsigned long sec;
+    unsigned long frac;
+    int digits; /* of frac */
+};
+
+struct pcapInterface {
+    uint16_t linkType;
+    uint64_t unitsPerSecond;
+    int digits; /* of the fraction, 0 for a resolution which is not a power of 10 */
+};
+
+/* a segment which came before the bytes in front of it */
+struct pcapSegment {
+    struct pcapSegment* next;
+    uint32_t seq;
+    uint32_t length;
+    uint8_t data[];
+};
+
+/* one direction of a TCP connection, named by its sender */
+struct pcapDirection {
+    uint8_t addr[16];
+    uint16_t port;
+    char name[PCAP_ADDRESS_SIZE];
+    int seqKnown;
+    uint32_t nextSeq;
+    int finished;
+    int failed;
+    unsigned long frames;
+    uint8_t* data; /* receive buffer, only while a frame is incomplete */
+    struct v2gtpReceiveBuffer rb;
+    struct pcapSegment* pending; /* sorted by seq */
+    size_t pendingLength;
+};
+
+struct pcapConnection {
+    struct pcapConnection* next;
+    unsigned long id;
+    int family;
+    struct pcapDirection side[2]; /* side[0] sent the first packet */
+    char schema; /* of the next EXI message */
+    /* SchemaIDs of the supportedAppProtocolReq, and their schemas */
+    int nProtocols;
+    uint8_t schemaIDs[appHandAnonType_supportedAppProtocolReq_AppProtocol_ARRAY_SIZE];
+    char schemas[appHandAnonType_supportedAppProtocolReq_AppProtocol_ARRAY_SIZE];
+};
+
+struct pcapReader {
+    FILE* in;
+    int ng;
+    int bigEndian;
+    int pendingMagic; /* the first 4 bytes of the header were read to find the format */
+    uint8_t header[24];
+    uint8_t* block;
+    size_t blockSize;
+    struct pcapInterface* interfaces;
+    int nInterfaces;
+    int interfacesSize;
+    unsigned long unsupportedLinkType;
+    struct pcapConnection* buckets[PCAP_CONNECTION_BUCKETS];
+    unsigned long nConnections;
+    unsigned long nPackets;
+    unsigned long nFragments;
+    unsigned long nMessages;
+    struct pcapTime time; /* of the current packet */
+    /* the job input of the current fillFromCapture() call */
+    char** input;
+    size_t* inputLength;
+    size_t* inputSize;
+    struct appHandEXIDocument handshake;
+};
+
+/* the protocol namespaces of the supportedAppProtocolReq, and the schema of commandline_processExi() */
+static const struct {
+    const char* ns;
+    char schema;
+} pcapNamespaces[] = {
+    { "urn:din:70121:2012:MsgDef", 'D' },
+    { "urn:iso:15118:2:2013:MsgDef", '1' },
+    { "urn:iso:15118:2:2016:MsgDef", '2' }
+};
+
+static uint16_t getBE16(const uint8_t* p) {
+    return (uint16_t)((p[0]<<8) | p[1]);
+}
+
+static uint32_t getBE32(const uint8_t* p) {
+    return ((uint32_t)p[0]<<24) | ((uint32_t)p[1]<<16) | ((uint32_t)p[2]<<8) | p[3];
+}
+
+/* fields of the capture file, in the byte order of the writer */
+static uint16_t get16(struct pcapReader* r, const uint8_t* p) {
+    return r->bigEndian ? getBE16(p) : (uint16_t)((p[1]<<8) | p[0]);
+}
+
+static uint32_t get32(struct pcapReader* r, const uint8_t* p) {
+    return r->bigEndian ? getBE32(p) : ((uint32_t)p[3]<<24) | ((uint32_t)p[2]<<16) | ((uint32_t)p[1]<<8) | p[0];
+}
+
+/* Returns 1, 0 at the end of the file, or -1 for a read error. A capture which was cut off ends with the last complete
+   packet. */
+static int readFully(struct pcapReader* r, uint8_t* p, size_t n) {
+    size_t got = fread(p, 1, n, r->in);
+    if (got==n) {
+        return 1;
+    }
+    if (ferror(r->in)) {
+        perror("OpenV2G pcap: read");
+        return -1;
+    }
+    if (got==0) {
+        return 0;
+    }
+    fprintf(stderr, "OpenV2G pcap: the capture file is truncated, the last packet is skipped\n");
+    return 0;
+}
+
+/* read n bytes into the block buffer */
+static int readBlock(struct pcapReader* r, size_t n) {
+    if (n>PCAP_MAX_BLOCK_LENGTH) {
+        fprintf(stderr, "OpenV2G pcap: block of %lu bytes, the capture file is broken\n", (unsigned long)n);
+        return -1;
+    }
+    batch_reserve((char**)&r->block, &r->blockSize, n+1);
+    return (n>0) ? readFully(r, r->block, n) : 1;
+}
+
+/* ----- TCP reassembly and V2GTP frames ----- */
+
+static unsigned int hashDirection(const uint8_t* addr, uint16_t port) {
+    unsigned int h = port;
+    int i;
+    for (i=0; i<16; i++) {
+        h = h*31+addr[i];
+    }
+    return h;
+}
+
+static void formatAddress(struct pcapDirection* d, int family) {
+    char text[INET6_ADDRSTRLEN];
+    if (inet_ntop(family, d->addr, text, sizeof(text))==NULL) {
+        strcpy(text, "?");
+    }
+    if (family==AF_INET6) {
+        snprintf(d->name, sizeof(d->name), "[%s]:%u", text, d->port);
+    } else {
+        snprintf(d->name, sizeof(d->name), "%s:%u", text, d->port);
+    }
+}
+
+/* the connection of the packet, and the side which sent it. Returns NULL if there is none and create is 0. */
+static struct pcapConnection* findConnection(struct pcapReader* r, int family, const uint8_t* src, uint16_t srcPort,
+        const uint8_t* dst, uint16_t dstPort, int create, int* side) {
+    uint8_t a[16], b[16];
+    unsigned int bucket;
+    struct pcapConnection* c;
+    size_t addrLength = (family==AF_INET6) ? 16 : 4;
+
+    memset(a, 0, sizeof(a));
+    memset(b, 0, sizeof(b));
+    memcpy(a, src, addrLength);
+    memcpy(b, dst, addrLength);
+    bucket = (hashDirection(a, srcPort)^hashDirection(b, dstPort)) % PCAP_CONNECTION_BUCKETS;
+    for (c=r->buckets[bucket]; c!=NULL; c=c->next) {
+        if (c->family!=family) {
+            continue;
+        }
+        if (c->side[0].port==srcPort && c->side[1].port==dstPort && memcmp(c->side[0].addr, a, 16)==0 && memcmp(c->side[1].addr, b, 16)==0) {
+            *side = 0;
+            return c;
+        }
+        if (c->side[1].port==srcPort && c->side[0].port==dstPort && memcmp(c->side[1].addr, a, 16)==0 && memcmp(c->side[0].addr, b, 16)==0) {
+            *side = 1;
+            return c;
+        }
+    }
+    if (!create) {
+        return NULL;
+    }
+    c = calloc(1, sizeof(struct pcapConnection));
+    if (c==NULL) {
+        fprintf(stderr, "OpenV2G pcap: out of memory\n");
+        exit(1);
+    }
+    c->id = ++r->nConnections;
+    c->family = family;
+    c->schema = 'H'; /* each connection starts with the application handshake */
+    memcpy(c->side[0].addr, a, 16);
+    c->side[0].port = srcPort;
+    memcpy(c->side[1].addr, b, 16);
+    c->side[1].port = dstPort;
+    formatAddress(&c->side[0], family);
+    formatAddress(&c->side[1], family);
+    c->next = r->buckets[bucket];
+    r->buckets[bucket] = c;
+    *side = 0;
+    return c;
+}
+
+static void releaseDirection(struct pcapDirection* d) {
+    struct pcapSegment* s;
+    while (d->pending!=NULL) {
+        s = d->pending;
+        d->pending = s->next;
+        free(s);
+    }
+    d->pendingLength = 0;
+    free(d->data);
+    d->data = NULL;
+}
+
+static void removeConnection(struct pcapReader* r, struct pcapConnection* conn) {
+    struct pcapConnection** p;
+    int i;
+    for (i=0; i<2; i++) {
+        if (!conn->side[i].failed && conn->side[i].data!=NULL && pending_v2gtpReceiveBuffer(&conn->side[i].rb)>0) {
+            fprintf(stderr, "OpenV2G pcap: connection %lu: incomplete frame from %s\n", conn->id, conn->side[i].name);
+        }
+        releaseDirection(&conn->side[i]);
+    }
+    p = &r->buckets[(hashDirection(conn->side[0].addr, conn->side[0].port)^hashDirection(conn->side[1].addr, conn->side[1].port)) % PCAP_CONNECTION_BUCKETS];
+    while (*p!=conn) {
+        p = &(*p)->next;
+    }
+    *p = conn->next;
+    free(conn);
+}
+
+static void failDirection(struct pcapConnection* conn, struct pcapDirection* d, const char* reason) {
+    fprintf(stderr, "OpenV2G pcap: connection %lu: %s from %s, skipped\n", conn->id, reason, d->name);
+    d->failed = 1;
+    releaseDirection(d);
+}
+
+/* learn the schema of the connection from the application handshake */
+static void detectSchema(struct pcapReader* r, struct pcapConnection* conn, struct v2gtpFrame* frame) {
+    struct appHandEXIDocument* doc = &r->handshake;
+    struct appHandAppProtocolType* protocol;
+    bitstream_t stream;
+    size_t pos;
+    int i, k;
+    size_t j;
+
+    init_v2gtpPayloadStream(frame, &stream, &pos);
+    memset(doc, 0, sizeof(*doc));
+    if (decode_appHandExiDocument(&stream, doc)!=0) {
+        return;
+    }
+    if (doc->supportedAppProtocolReq_isUsed) {
+        conn->nProtocols = 0;
+        for (i=0; i<doc->supportedAppProtocolReq.AppProtocol.arrayLen; i++) {
+            protocol = &doc->supportedAppProtocolReq.AppProtocol.array[i];
+            for (k=0; k<(int)(sizeof(pcapNamespaces)/sizeof(pcapNamespaces[0])); k++) {
+                for (j=0; j<protocol->ProtocolNamespace.charactersLen; j++) {
+                    if (protocol->ProtocolNamespace.characters[j]!=(exi_string_character_t)pcapNamespaces[k].ns[j]) {
+                        break;
+                    }
+                }
+                if (j==protocol->ProtocolNamespace.charactersLen && pcapNamespaces[k].ns[j]==0) {
+                    conn->schemaIDs[conn->nProtocols] = protocol->SchemaID;
+                    conn->schemas[conn->nProtocols] = pcapNamespaces[k].schema;
+                    conn->nProtocols++;
+                    break;
+                }
+            }
+        }
+    } else if (doc->supportedAppProtocolRes_isUsed && doc->supportedAppProtocolRes.SchemaID_isUsed
+            && doc->supportedAppProtocolRes.ResponseCode!=appHandresponseCodeType_Failed_NoNegotiation) {
+        for (i=0; i<conn->nProtocols; i++) {
+            if (conn->schemaIDs[i]==doc->supportedAppProtocolRes.SchemaID) {
+                conn->schema = conn->schemas[i];
+            }
+        }
+        if (conn->schema=='H') {
+            fprintf(stderr, "OpenV2G pcap: connection %lu: SchemaID %u of an unknown namespace\n", conn->id,
+                doc->supportedAppProtocolRes.SchemaID);
+        }
+    }
+}
+
+/* append the EXI message as a tagged record for the workers */
+static void emitFrame(struct pcapReader* r, struct pcapConnection* conn, int side, struct v2gtpFrame* frame) {
+    char tag[PCAP_TAG_SIZE];
+    char schema = conn->schema;
+    uint8_t* p;
+    int tagLength;
+
+    conn->side[side].frames++;
+    if (frame->payloadType!=V2GTP_EXI_TYPE) {
+        return;
+    }
+    if (schema=='H') {
+        detectSchema(r, conn, frame);
+    }
+    tagLength = snprintf(tag, sizeof(tag), "\"time\": \"%lu.%0*lu\", \"connection\": %lu, \"from\": \"%s\", \"to\": \"%s\"",
+        r->time.sec, r->time.digits, r->time.frac, conn->id, conn->side[side].name, conn->side[1-side].name);
+    batch_reserve(r->input, r->inputSize, *r->inputLength+7+tagLength+frame->payloadLength);
+    p = (uint8_t*)&(*r->input)[*r->inputLength];
+    p[0] = (uint8_t)schema;
+    p[1] = (uint8_t)(frame->payloadLength>>24);
+    p[2] = (uint8_t)(frame->payloadLength>>16);
+    p[3] = (uint8_t)(frame->payloadLength>>8);
+    p[4] = (uint8_t)frame->payloadLength;
+    p[5] = (uint8_t)(tagLength>>8);
+    p[6] = (uint8_t)tagLength;
+    memcpy(&p[7], tag, tagLength);
+    memcpy(&p[7+tagLength], frame->payload, frame->payloadLength);
+    *r->inputLength += 7+tagLength+frame->payloadLength;
+    r->nMessages++;
+}
+
+/* add the next bytes of the stream, and hand out the complete frames */
+static void deliverBytes(struct pcapReader* r, struct pcapConnection* conn, int side, const uint8_t* data, uint32_t length) {
+    struct pcapDirection* d = &conn->side[side];
+    struct v2gtpFrame frame;
+    uint8_t* space;
+    uint32_t spaceLength;
+    uint32_t n;
+    int result;
+
+    while (length>0 && !d->failed) {
+        if (d->data==NULL) {
+            d->data = malloc(PCAP_RECEIVE_BUFFER_SIZE);
+            if (d->data==NULL) {
+                fprintf(stderr, "OpenV2G pcap: out of memory\n");
+                exit(1);
+            }
+            init_v2gtpReceiveBuffer(&d->rb, d->data, PCAP_RECEIVE_BUFFER_SIZE, 0);
+        }
+        space = reserve_v2gtpReceiveBuffer(&d->rb, &spaceLength);
+        n = (length<spaceLength) ? length : spaceLength;
+        memcpy(space, data, n);
+        commit_v2gtpReceiveBuffer(&d->rb, n);
+        data += n;
+        length -= n;
+        while ((result = read_v2gtpFrame(&d->rb, &frame))==1) {
+            emitFrame(r, conn, side, &frame);
+        }
+        if (result==-1) {
+            /* a TLS record starts with the content type 0x16 (handshake) */
+            failDirection(conn, d, (d->frames==0 && d->data[d->rb.start]==0x16) ? "TLS, not decoded" : "invalid V2GTP header");
+        } else if (result==-2) {
+            failDirection(conn, d, "V2GTP frame too long");
+        }
+    }
+    /* the buffer is only kept for an incomplete frame */
+    if (d->data!=NULL && pending_v2gtpReceiveBuffer(&d->rb)==0) {
+        free(d->data);
+        d->data = NULL;
+    }
+}
+
+/* deliver the bytes of a segment which starts at or before nextSeq, without those which were received before */
+static void deliverSegment(struct pcapReader* r, struct pcapConnection* conn, int side, uint32_t seq, const uint8_t* data, uint32_t length) {
+    struct pcapDirection* d = &conn->side[side];
+    uint32_t skip = d->nextSeq-seq;
+    if (skip<length) {
+        d->nextSeq += length-skip;
+        deliverBytes(r, conn, side, data+skip, length-skip);
+    }
+}
+
+/* put the segment in the order of the stream, early segments wait for the gap */
+static void addSegment(struct pcapReader* r, struct pcapConnection* conn, int side, uint32_t seq, const uint8_t* data, uint32_t length) {
+    struct pcapDirection* d = &conn->side[side];
+    struct pcapSegment* s;
+    struct pcapSegment** p;
+
+    if (!d->seqKnown) {
+        /* the capture started within the connection */
+        d->nextSeq = seq;
+        d->seqKnown = 1;
+    }
+    if ((int32_t)(seq-d->nextSeq)>0) {
+        if (d->pendingLength+length>PCAP_MAX_PENDING) {
+            failDirection(conn, d, "lost segment");
+            return;
+        }
+        s = malloc(sizeof(struct pcapSegment)+length);
+        if (s==NULL) {
+            fprintf(stderr, "OpenV2G pcap: out of memory\n");
+            exit(1);
+        }
+        s->seq = seq;
+        s->length = length;
+        memcpy(s->data, data, length);
+        p = &d->pending;
+        while (*p!=NULL && (int32_t)((*p)->seq-seq)<=0) {
+            p = &(*p)->next;
+        }
+        s->next = *p;
+        *p = s;
+        d->pendingLength += length;
+        return;
+    }
+    deliverSegment(r, conn, side, seq, data, length);
+    /* the waiting segments which fit now */
+    while (!d->failed && (s = d->pending)!=NULL && (int32_t)(s->seq-d->nextSeq)<=0) {
+        d->pending = s->next;
+        d->pendingLength -= s->length;
+        deliverSegment(r, conn, side, s->seq, s->data, s->length);
+        free(s);
+    }
+}
+
+static void handleTcp(struct pcapReader* r, int family, const uint8_t* src, const uint8_t* dst, const uint8_t* p, size_t length) {
+    struct pcapConnection* conn;
+    struct pcapDirection* d;
+    size_t headerLength;
+    uint16_t srcPort, dstPort;
+    uint32_t seq;
+    uint8_t flags;
+    int side;
+
+    if (length<20) {
+        return;
+    }
+    headerLength = (p[12]>>4)*4;
+    if (headerLength<20 || headerLength>length) {
+        return;
+    }
+    srcPort = getBE16(p);
+    dstPort = getBE16(p+2);
+    seq = getBE32(p+4);
+    flags = p[13];
+    p += headerLength;
+    length -= headerLength;
+
+    conn = findConnection(r, family, src, srcPort, dst, dstPort, 0, &side);
+    if (conn!=NULL && (flags & (TCP_SYN|TCP_ACK))==TCP_SYN && (conn->side[0].frames+conn->side[1].frames>0 || conn->side[side].finished)) {
+        /* the ports are used for a new connection */
+        removeConnection(r, conn);
+        conn = NULL;
+    }
+    if (conn==NULL) {
+        if (!(flags & TCP_SYN) && length==0) {
+            return;
+        }
+        conn = findConnection(r, family, src, srcPort, dst, dstPort, 1, &side);
+    }
+    if (flags & TCP_RST) {
+        removeConnection(r, conn);
+        return;
+    }
+    d = &conn->side[side];
+    if (flags & TCP_SYN) {
+        d->nextSeq = seq+1;
+        d->seqKnown = 1;
+        seq++;
+    }
+    if (length>0 && !d->failed) {
+        addSegment(r, conn, side, seq, p, (uint32_t)length);
+    }
+    if (flags & TCP_FIN) {
+        d->finished = 1;
+        if (conn->side[1-side].finished) {
+            removeConnection(r, conn);
+        }
+    }
+}
+
+/* ----- IP and link layers ----- */
+
+static void handleIp(struct pcapReader* r, const uint8_t* p, size_t length) {
+    size_t headerLength, totalLength, extensionLength;
+    uint8_t next;
+
+    if (length<1) {
+        return;
+    }
+    if ((p[0]>>4)==4) {
+        if (length<20) {
+            return;
+        }
+        headerLength = (p[0] & 0x0f)*4;
+        totalLength = getBE16(p+2);
+        if (totalLength<length) {
+            length = totalLength; /* without the padding of the link layer */
+        }
+        if (headerLength<20 || headerLength>length) {
+            return;
+        }
+        if ((p[6] & 0x3f) || p[7]) {
+            r->nFragments++; /* more fragments, or a fragment offset */
+            return;
+        }
+        if (p[9]==6) {
+            handleTcp(r, AF_INET, p+12, p+16, p+headerLength, length-headerLength);
+        }
+    } else if ((p[0]>>4)==6) {
+        if (length<40) {
+            return;
+        }
+        totalLength = 40+getBE16(p+4);
+        if (totalLength<length) {
+            length = totalLength;
+        }
+        next = p[6];
+        headerLength = 40;
+        /* extension headers: hop-by-hop options, routing, destination options, authentication */
+        while (next==0 || next==43 || next==60 || next==51 || next==44) {
+            if (next==44) {
+                r->nFragments++;
+                return;
+            }
+            if (headerLength+8>length) {
+                return;
+            }
+            extensionLength = (next==51) ? (p[headerLength+1]+2)*4 : (p[headerLength+1]+1)*8;
+            next = p[headerLength];
+            headerLength += extensionLength;
+        }
+        if (headerLength>length) {
+            return;
+        }
+        if (next==6) {
+            handleTcp(r, AF_INET6, p+8, p+24, p+headerLength, length-headerLength);
+        }
+    }
+}
+
+/* the IP packet of a link layer frame */
+static void handleFrame(struct pcapReader* r, uint16_t linkType, const uint8_t* p, size_t length) {
+    size_t offset;
+    uint16_t etherType;
+
+    r->nPackets++;
+    switch (linkType) {
+        case LINKTYPE_ETHERNET:
+            if (length<14) {
+                return;
+            }
+            offset = 14;
+            etherType = getBE16(p+12);
+            /* VLAN tags (802.1Q, 802.1ad) */
+            while ((etherType==0x8100 || etherType==0x88a8 || etherType==0x9100) && offset+4<=length) {
+                etherType = getBE16(p+offset+2);
+                offset += 4;
+            }
+            if (etherType!=0x0800 && etherType!=0x86dd) {
+                return;
+            }
+            break;
+        case LINKTYPE_LINUX_SLL:
+            if (length<16) {
+                return;
+            }
+            offset = 16;
+            etherType = getBE16(p+14);
+            if (etherType!=0x0800 && etherType!=0x86dd) {
+                return;
+            }
+            break;
+        case LINKTYPE_LINUX_SLL2:
+            if (length<20) {
+                return;
+            }
+            offset = 20;
+            etherType = getBE16(p);
+            if (etherType!=0x0800 && etherType!=0x86dd) {
+                return;
+            }
+            break;
+        case LINKTYPE_NULL: /* the address family in the byte order of the capturing host, the IP version tells more */
+            offset = 4;
+            break;
+        case LINKTYPE_RAW:
+        case LINKTYPE_RAW_BSD:
+        case LINKTYPE_IPV4:
+        case LINKTYPE_IPV6:
+            offset = 0;
+            break;
+        default:
+            if (r->unsupportedLinkType++==0) {
+                fprintf(stderr, "OpenV2G pcap: link type %u is not supported, its packets are skipped\n", linkType);
+            }
+            return;
+    }
+    if (offset<length) {
+        handleIp(r, p+offset, length-offset);
+    }
+}
+
+/* ----- capture files ----- */
+
+static void setTime(struct pcapReader* r, struct pcapInterface* interface, uint64_t timestamp) {
+    uint64_t frac = timestamp % interface->unitsPerSecond;
+    r->time.sec = (unsigned long)(timestamp / interface->unitsPerSecond);
+    if (interface->digits>0 && interface->digits<=9) {
+        r->time.frac = (unsigned long)frac;
+        r->time.digits = interface->digits;
+    } else {
+        /* nanoseconds of a binary or very fine resolution */
+        r->time.frac = (unsigned long)((double)frac*1e9/(double)interface->unitsPerSecond);
+        r->time.digits = 9;
+    }
+}
+
+/* Handles the next packet of a pcap file. Returns 1, 0 at the end of the file, or -1 for an error. */
+static int readPcapPacket(struct pcapReader* r) {
+    uint8_t header[16];
+    uint32_t capturedLength;
+    int result = readFully(r, header, sizeof(header));
+    if (result<=0) {
+        return result;
+    }
+    capturedLength = get32(r, header+8);
+    result = readBlock(r, capturedLength);
+    if (result<=0) {
+        return result;
+    }
+    r->time.sec = get32(r, header);
+    r->time.frac = get32(r, header+4);
+    r->time.digits = r->interfaces[0].digits;
+    handleFrame(r, r->interfaces[0].linkType, r->block, capturedLength);
+    return 1;
+}
+
+static int addInterface(struct pcapReader* r, uint16_t linkType) {
+    struct pcapInterface* interfaces;
+    if (r->nInterfaces==r->interfacesSize) {
+        r->interfacesSize = (r->interfacesSize>0) ? 2*r->interfacesSize : 4;
+        interfaces = realloc(r->interfaces, r->interfacesSize*sizeof(struct pcapInterface));
+        if (interfaces==NULL) {
+            fprintf(stderr, "OpenV2G pcap: out of memory\n");
+            return -1;
+        }
+        r->interfaces = interfaces;
+    }
+    r->interfaces[r->nInterfaces].linkType = linkType;
+    r->interfaces[r->nInterfaces].unitsPerSecond = 1000000;
+    r->interfaces[r->nInterfaces].digits = 6;
+    r->nInterfaces++;
+    return 0;
+}
+
+/* the if_tsresol option of an interface description block body */
+static void readInterfaceOptions(struct pcapReader* r, struct pcapInterface* interface, const uint8_t* p, size_t length) {
+    size_t pos = 8;
+    uint16_t code, optionLength;
+    uint8_t resolution;
+    int i;
+    while (pos+4<=length) {
+        code = get16(r, p+pos);
+        optionLength = get16(r, p+pos+2);
+        pos += 4;
+        if (code==0 || pos+optionLength>length) {
+            break;
+        }
+        if (code==PCAPNG_OPTION_TSRESOL && optionLength>=1) {
+            resolution = p[pos];
+            if (resolution & 0x80) {
+                interface->unitsPerSecond = (uint64_t)1<<((resolution & 0x7f)<64 ? (resolution & 0x7f) : 63);
+                interface->digits = 0;
+            } else {
+                interface->unitsPerSecond = 1;
+                for (i=0; i<resolution && i<19; i++) {
+                    interface->unitsPerSecond *= 10;
+                }
+                interface->digits = i;
+            }
+        }
+        pos += (optionLength+3) & ~3u;
+    }
+}
+
+/* Handles the next block of a pcapng file. Returns 1, 0 at the end of the file, or -1 for an error. */
+static int readPcapngBlock(struct pcapReader* r) {
+    uint8_t header[12];
+    uint32_t type, blockLength, interfaceId, capturedLength;
+    size_t bodyLength;
+    int have = 0;
+    int result;
+
+    if (r->pendingMagic) {
+        memcpy(header, r->header, 4);
+        have = 4;
+        r->pendingMagic = 0;
+    }
+    result = readFully(r, header+have, 8-have);
+    if (result<=0) {
+        return result;
+    }
+    type = getBE32(header); /* only compared with the section header type, which is the same in both byte orders */
+    if (type==PCAPNG_SECTION_HEADER) {
+        result = readFully(r, header+8, 4);
+        if (result<=0) {
+            return result;
+        }
+        if (getBE32(header+8)==PCAPNG_BYTE_ORDER_MAGIC) {
+            r->bigEndian = 1;
+        } else if (getBE32(header+8)==0x4D3C2B1A) {
+            r->bigEndian = 0;
+        } else {
+            fprintf(stderr, "OpenV2G pcap: invalid pcapng section header\n");
+            return -1;
+        }
+        blockLength = get32(r, header+4);
+        if (blockLength<28) {
+            fprintf(stderr, "OpenV2G pcap: invalid pcapng section header\n");
+            return -1;
+        }
+        r->nInterfaces = 0; /* the interfaces are numbered per section */
+        return readBlock(r, blockLength-12);
+    }
+    type = get32(r, header);
+    blockLength = get32(r, header+4);
+    if (blockLength<12 || (blockLength & 3)) {
+        fprintf(stderr, "OpenV2G pcap: invalid pcapng block length %u\n", blockLength);
+        return -1;
+    }
+    result = readBlock(r, blockLength-8);
+    if (result<=0) {
+        return result;
+    }
+    bodyLength = blockLength-12; /* without the trailing block length */
+    switch (type) {
+        case PCAPNG_INTERFACE_DESCRIPTION:
+            if (bodyLength<8 || addInterface(r, get16(r, r->block))<0) {
+                return -1;
+            }
+            readInterfaceOptions(r, &r->interfaces[r->nInterfaces-1], r->block, bodyLength);
+            break;
+        case PCAPNG_ENHANCED_PACKET:
+        case PCAPNG_PACKET:
+            if (bodyLength<20) {
+                return 1;
+            }
+            interfaceId = (type==PCAPNG_ENHANCED_PACKET) ? get32(r, r->block) : get16(r, r->block);
+            capturedLength = get32(r, r->block+12);
+            if (interfaceId>=(uint32_t)r->nInterfaces || capturedLength>bodyLength-20) {
+                fprintf(stderr, "OpenV2G pcap: invalid pcapng packet block\n");
+                return -1;
+            }
+            setTime(r, &r->interfaces[interfaceId], ((uint64_t)get32(r, r->block+4)<<32) | get32(r, r->block+8));
+            handleFrame(r, r->interfaces[interfaceId].linkType, r->block+20, capturedLength);
+            break;
+        case PCAPNG_SIMPLE_PACKET: /* no time stamp, the interface is the first one */
+            if (bodyLength<4 || r->nInterfaces==0) {
+                return 1;
+            }
+            capturedLength = get32(r, r->block);
+            if (capturedLength>bodyLength-4) {
+                capturedLength = (uint32_t)(bodyLength-4);
+            }
+            r->time.sec = 0;
+            r->time.frac = 0;
+            r->time.digits = r->interfaces[0].digits;
+            handleFrame(r, r->interfaces[0].linkType, r->block+4, capturedLength);
+            break;
+        default:
+            break; /* statistics, name resolution, custom and other blocks */
+    }
+    return 1;
+}
+
+/* forget all connections, and report their incomplete frames */
+static void closeConnections(struct pcapReader* r) {
+    unsigned int i;
+    for (i=0; i<PCAP_CONNECTION_BUCKETS; i++) {
+        while (r->buckets[i]!=NULL) {
+            removeConnection(r, r->buckets[i]);
+        }
+    }
+}
+
+/* the fill function of the batch pipeline: the EXI messages of the next packets as tagged records */
+static int fillFromCapture(void* context, char** input, size_t* inputLength, size_t* inputSize) {
+    struct pcapReader* r = context;
+    size_t start = *inputLength;
+    int result = 1;
+
+    r->input = input;
+    r->inputLength = inputLength;
+    r->inputSize = inputSize;
+    while (result>0 && *inputLength-start<BATCH_READ_SIZE) {
+        result = r->ng ? readPcapngBlock(r) : readPcapPacket(r);
+    }
+    if (result==0) {
+        closeConnections(r); /* end of the capture */
+    }
+    return result;
+}
+
+/* read the file header, and find out the format */
+static int openCapture(struct pcapReader* r) {
+    uint32_t magic;
+    if (readFully(r, r->header, 4)<=0) {
+        fprintf(stderr, "OpenV2G pcap: empty capture file\n");
+        return -1;
+    }
+    magic = getBE32(r->header);
+    if (magic==PCAPNG_SECTION_HEADER) {
+        r->ng = 1;
+        r->pendingMagic = 1;
+        return 0;
+    }
+    if (magic==PCAP_MAGIC || magic==PCAP_MAGIC_NANO) {
+        r->bigEndian = 1;
+    } else if (magic==0xD4C3B2A1 || magic==0x4D3CB2A1) {
+        r->bigEndian = 0;
+    } else {
+        fprintf(stderr, "OpenV2G pcap: neither a pcap nor a pcapng file\n");
+        return -1;
+    }
+    if (readFully(r, r->header+4, 20)<=0 || addInterface(r, (uint16_t)get32(r, r->header+20))<0) {
+        fprintf(stderr, "OpenV2G pcap: invalid pcap file header\n");
+        return -1;
+    }
+    if (get32(r, r->header)==PCAP_MAGIC_NANO) {
+        r->interfaces[0].unitsPerSecond = 1000000000;
+        r->interfaces[0].digits = 9;
+    }
+    return 0;
+}
+
+/* The entry point of the capture analyzer, argv[1] is e.g. "P4", argv[2] the capture file and argv[3] the output file */
+int main_pcap(int argc, char *argv[]) {
+    struct pcapReader* r;
+    FILE* out = stdout;
+    int result;
+
+    if (argc<3) {
+        fprintf(stderr, "OpenV2G pcap: usage: OpenV2G.exe P[<workers>] <captureFile> [<outputFile>]\n");
+        return 1;
+    }
+    r = calloc(1, sizeof(struct pcapReader));
+    if (r==NULL) {
+        fprintf(stderr, "OpenV2G pcap: out of memory\n");
+        return 1;
+    }
+    r->in = (strcmp(argv[2], "-")==0) ? stdin : fopen(argv[2], "rb");
+    if (r->in==NULL) {
+        perror(argv[2]);
+        free(r);
+        return 1;
+    }
+    result = openCapture(r);
+    if (result==0 && argc>=4) {
+        out = fopen(argv[3], "wb");
+        if (out==NULL) {
+            perror(argv[3]);
+            result = -1;
+        }
+    }
+    if (result==0) {
+        /* stdout is unbuffered (see main.c). The jobs are written in large blocks anyway. */
+        setvbuf(out, NULL, _IOFBF, 1<<16);
+        result = batch_run(BATCH_FORMAT_TAGGED_RECORDS, batch_workers(&argv[1][1]), fillFromCapture, r, out);
+        closeConnections(r);
+        if (fflush(out)!=0 || (out!=stdout && fclose(out)!=0)) {
+            perror("OpenV2G pcap: write");
+            result = -1;
+        }
+        fprintf(stderr, "OpenV2G pcap: %lu packets, %lu TCP connections, %lu EXI messages\n", r->nPackets, r->nConnections, r->nMessages);
+        if (r->nFragments>0) {
+            fprintf(stderr, "OpenV2G pcap: %lu IP fragments skipped\n", r->nFragments);
+        }
+    }
+    if (r->in!=stdin) {
+        fclose(r->in);
+    }
+    free(r->block);
+    free(r->interfaces);
+    free(r);
+    return (result==0) ? 0 : 1;
+}
+
+#endif /* CODE_VERSION_COMMANDLINE && CODE_SERVER_YES */
@@ -0,0 +1,450 @@
+/*******************************************************************
+ * Server mode for OpenV2G: a long running worker pool daemon around
+ * the command line interface, to avoid one process launch per message.
+ * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G
+ *
+ ********************************************************************/
+
+/* Usage:
+     OpenV2G.exe S[<workers>]                 frames on stdin, responses on stdout
+     OpenV2G.exe S[<workers>] <socketPath>    frames over a Unix domain socket, any number of clients
+   e.g. "OpenV2G.exe S4 /tmp/openv2g.sock" starts 4 worker threads.
+
+   Each request is a 4 byte session number (big endian), followed by a V2GTP frame (8 byte header and payload):
+     payload type 0x8001 (EXI): EXI message, decoded with the schema of the last command of this session
+                                (initially H = applicationHandshake). The answer is the JSON.
+     payload type 0xA001: command as on the command line, e.g. "DD809a0011..." or "EDi_380_20". The answer is the JSON.
+     payload type 0xA003: encode command, e.g. "EDi_380_20". The answer is the encoded EXI message (0x8001),
+                          or the JSON in case of an error.
+   Each response consists of the same session number, followed by a V2GTP frame with payload type
+   0x8001 (EXI) or 0xA002 (JSON, as printed by the command line interface).
+
+   The sessions are distributed over the workers. All frames of one session are handled by the same worker,
+   so the responses of a session come in the order of the requests. Each worker has its own
+   documents, stream buffer and result strings (see CLI_THREAD_LOCAL in main_commandlineinterface.c).
+*/
+
+#include "main.h"
+
+#if CODE_VERSION == CODE_VERSION_COMMANDLINE && CODE_SERVER == CODE_SERVER_YES
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "v2gtp.h"
+
+/* manufacturer specific V2GTP payload types used by the server */
+#define V2GTP_SERVER_COMMAND_TYPE 0xA001
+#define V2GTP_SERVER_JSON_TYPE 0xA002
+#define V2GTP_SERVER_ENCODE_TYPE 0xA003
+
+#define SERVER_DEFAULT_WORKERS 4
+#define SERVER_MAX_WORKERS 64
+#define SERVER_MAX_PAYLOAD 4096 /* longest accepted request payload */
+#define SERVER_JSON_SIZE 50000
+#define SERVER_SESSIONS_PER_WORKER 64 /* remembered schemas per worker, the oldest entry is reused */
+#define SERVER_SESSION_NUMBER_LENGTH 4
+#define SERVER_RECEIVE_BUFFER_SIZE (SERVER_SESSION_NUMBER_LENGTH+V2GTP_HEADER_LENGTH+SERVER_MAX_PAYLOAD) /* longer frames are rejected */
+
+struct serverConnection {
+    uint32_t id;
+    int fdIn;
+    int fdOut;
+    int ownsFds; /* close the file descriptors when the last reference is released */
+    int refs; /* the reader and each queued job hold a reference */
+    pthread_mutex_t lock; /* protects refs and serializes the responses */
+};
+
+struct serverJob {
+    struct serverJob* next;
+    struct serverConnection* conn;
+    uint32_t sessionNumber;
+    uint16_t payloadType;
+    uint32_t payloadLength;
+    uint8_t payload[];
+};
+
+struct serverSession {
+    uint32_t connId; /* 0 = unused */
+    uint32_t sessionNumber;
+    char schema;
+};
+
+struct serverWorker {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    struct serverJob* first;
+    struct serverJob* last;
+    int stop;
+    struct serverSession sessions[SERVER_SESSIONS_PER_WORKER];
+    int nextSession;
+    char command[SERVER_MAX_PAYLOAD+1];
+    /* session number, V2GTP header and payload. The JSON is composed in place behind the header. */
+    uint8_t frame[SERVER_SESSION_NUMBER_LENGTH+V2GTP_HEADER_LENGTH+SERVER_JSON_SIZE];
+};
+
+static struct serverWorker* workers;
+static int nWorkers;
+static pthread_mutex_t connIdLock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t lastConnId;
+
+static int writeFull(int fd, const uint8_t* buf, size_t len) {
+    size_t done = 0;
+    ssize_t n;
+    while (done<len) {
+        n = write(fd, buf+done, len-done);
+        if (n<0 && errno==EINTR) {
+            continue;
+        }
+        if (n<=0) {
+            return -1;
+        }
+        done += n;
+    }
+    return 0;
+}
+
+static uint32_t readUint32(const uint8_t* p) {
+    return ((uint32_t)p[0]<<24) | ((uint32_t)p[1]<<16) | ((uint32_t)p[2]<<8) | p[3];
+}
+
+static struct serverConnection* createConnection(int fdIn, int fdOut, int ownsFds) {
+    struct serverConnection* conn = malloc(sizeof(struct serverConnection));
+    if (conn==NULL) {
+        return NULL;
+    }
+    pthread_mutex_lock(&connIdLock);
+    conn->id = ++lastConnId;
+    if (conn->id==0) {
+        conn->id = ++lastConnId; /* 0 marks an unused session entry */
+    }
+    pthread_mutex_unlock(&connIdLock);
+    conn->fdIn = fdIn;
+    conn->fdOut = fdOut;
+    conn->ownsFds = ownsFds;
+    conn->refs = 1;
+    pthread_mutex_init(&conn->lock, NULL);
+    return conn;
+}
+
+static void releaseConnection(struct serverConnection* conn) {
+    int refs;
+    pthread_mutex_lock(&conn->lock);
+    refs = --conn->refs;
+    pthread_mutex_unlock(&conn->lock);
+    if (refs==0) {
+        if (conn->ownsFds) {
+            close(conn->fdIn);
+            if (conn->fdOut!=conn->fdIn) {
+                close(conn->fdOut);
+            }
+        }
+        pthread_mutex_destroy(&conn->lock);
+        free(conn);
+    }
+}
+
+/* find the schema entry of a session, or take over the oldest entry */
+static struct serverSession* findSession(struct serverWorker* w, uint32_t connId, uint32_t sessionNumber) {
+    int i;
+    struct serverSession* session;
+    for (i=0; i<SERVER_SESSIONS_PER_WORKER; i++) {
+        if (w->sessions[i].connId==connId && w->sessions[i].sessionNumber==sessionNumber) {
+            return &w->sessions[i];
+        }
+    }
+    session = &w->sessions[w->nextSession];
+    w->nextSession = (w->nextSession+1) % SERVER_SESSIONS_PER_WORKER;
+    session->connId = connId;
+    session->sessionNumber = sessionNumber;
+    session->schema = 'H'; /* each session starts with the application handshake */
+    return session;
+}
+
+static void sendResponse(struct serverWorker* w, struct serverJob* job, uint16_t payloadType, const uint8_t* payload, int payloadLength) {
+    uint8_t* frame = w->frame;
+    frame[0] = (uint8_t)(job->sessionNumber>>24);
+    frame[1] = (uint8_t)(job->sessionNumber>>16);
+    frame[2] = (uint8_t)(job->sessionNumber>>8);
+    frame[3] = (uint8_t)(job->sessionNumber);
+    write_v2gtpHeader(&frame[SERVER_SESSION_NUMBER_LENGTH], payloadLength, payloadType);
+    if (payload!=&frame[SERVER_SESSION_NUMBER_LENGTH+V2GTP_HEADER_LENGTH]) {
+        memcpy(&frame[SERVER_SESSION_NUMBER_LENGTH+V2GTP_HEADER_LENGTH], payload, payloadLength);
+    }
+    pthread_mutex_lock(&job->conn->lock);
+    /* a failing write means the client is gone. The reader will notice it as well. */
+    writeFull(job->conn->fdOut, frame, SERVER_SESSION_NUMBER_LENGTH+V2GTP_HEADER_LENGTH+payloadLength);
+    pthread_mutex_unlock(&job->conn->lock);
+}
+
+static void handleJob(struct serverWorker* w, struct serverJob* job) {
+    struct serverSession* session = findSession(w, job->conn->id, job->sessionNumber);
+    char* json = (char*)&w->frame[SERVER_SESSION_NUMBER_LENGTH+V2GTP_HEADER_LENGTH];
+    uint8_t* exi;
+    int exiLength;
+    int n;
+
+    switch (job->payloadType) {
+        case V2GTP_EXI_TYPE:
+            n = commandline_processExi(session->schema, job->payload, job->payloadLength, json, SERVER_JSON_SIZE);
+            break;
+        case V2GTP_SERVER_COMMAND_TYPE:
+        case V2GTP_SERVER_ENCODE_TYPE:
+            memcpy(w->command, job->payload, job->payloadLength);
+            w->command[job->payloadLength] = 0;
+            /* the schema of the command is used for the following EXI frames of this session */
+            if ((job->payloadLength>=2) && (w->command[0]=='D' || w->command[0]=='E')) {
+                if (w->command[1]=='H' || w->command[1]=='h') {
+                    session->schema = 'H';
+                } else if (w->command[1]=='D' || w->command[1]=='1' || w->command[1]=='2') {
+                    session->schema = w->command[1];
+                }
+            }
+            n = commandline_processCommand(w->command, json, SERVER_JSON_SIZE);
+            if ((job->payloadType==V2GTP_SERVER_ENCODE_TYPE) && (w->command[0]=='E')
+                && (commandline_getEncodedStream(&exi, &exiLength)==0)) {
+                sendResponse(w, job, V2GTP_EXI_TYPE, exi, exiLength);
+                return;
+            }
+            break;
+        default:
+            n = snprintf(json, SERVER_JSON_SIZE, "{\n\"error\": \"unsupported payload type 0x%04x\"\n}", job->payloadType);
+    }
+    if (n<0) {
+        n = strlen(json); /* truncated */
+    }
+    sendResponse(w, job, V2GTP_SERVER_JSON_TYPE, (uint8_t*)json, n);
+}
+
+static void* workerMain(void* arg) {
+    struct serverWorker* w = arg;
+    struct serverJob* job;
+    for (;;) {
+        pthread_mutex_lock(&w->lock);
+        while (w->first==NULL && !w->stop) {
+            pthread_cond_wait(&w->cond, &w->lock);
+        }
+        job = w->first;
+        if (job==NULL) {
+            /* stopped and all jobs done */
+            pthread_mutex_unlock(&w->lock);
+            break;
+        }
+        w->first = job->next;
+        if (w->first==NULL) {
+            w->last = NULL;
+        }
+        pthread_mutex_unlock(&w->lock);
+
+        handleJob(w, job);
+        releaseConnection(job->conn);
+        free(job);
+    }
+    commandline_releaseThread();
+    return NULL;
+}
+
+static void enqueueJob(struct serverJob* job) {
+    /* all frames of a session go to the same worker */
+    uint32_t h = (job->conn->id * 2654435761u) ^ job->sessionNumber;
+    struct serverWorker* w = &workers[h % nWorkers];
+    job->next = NULL;
+    pthread_mutex_lock(&w->lock);
+    if (w->last==NULL) {
+        w->first = job;
+    } else {
+        w->last->next = job;
+    }
+    w->last = job;
+    pthread_cond_signal(&w->cond);
+    pthread_mutex_unlock(&w->lock);
+}
+
+/* read the requests of one connection until the end of the stream, and hand them over to the workers.
+   Each read takes as many bytes as there is space, all complete frames in it are handled right away. */
+static void serveConnection(struct serverConnection* conn) {
+    uint8_t data[SERVER_RECEIVE_BUFFER_SIZE];
+    struct v2gtpReceiveBuffer rb;
+    struct v2gtpFrame frame;
+    struct serverJob* job;
+    uint8_t* space;
+    uint32_t spaceLength;
+    ssize_t n;
+    int r;
+
+    init_v2gtpReceiveBuffer(&rb, data, sizeof(data), SERVER_SESSION_NUMBER_LENGTH);
+    for (;;) {
+        while ((r = read_v2gtpFrame(&rb, &frame))==1) {
+            /* the payload is copied once, because the buffer is reused before the worker is done */
+            job = malloc(sizeof(struct serverJob)+frame.payloadLength);
+            if (job==NULL) {
+                fprintf(stderr, "OpenV2G server: out of memory\n");
+                return;
+            }
+            memcpy(job->payload, frame.payload, frame.payloadLength);
+            job->conn = conn;
+            job->sessionNumber = readUint32(frame.prefix);
+            job->payloadType = frame.payloadType;
+            job->payloadLength = frame.payloadLength;
+            pthread_mutex_lock(&conn->lock);
+            conn->refs++;
+            pthread_mutex_unlock(&conn->lock);
+            enqueueJob(job);
+        }
+        if (r==-1) {
+            fprintf(stderr, "OpenV2G server: connection %u: invalid V2GTP header\n", conn->id);
+            break;
+        }
+        if (r==-2) {
+            fprintf(stderr, "OpenV2G server: connection %u: payload too long (%u bytes)\n", conn->id, frame.payloadLength);
+            break;
+        }
+        space = reserve_v2gtpReceiveBuffer(&rb, &spaceLength);
+        n = read(conn->fdIn, space, spaceLength);
+        if (n<0 && errno==EINTR) {
+            continue;
+        }
+        if (n<=0) {
+            if (n<0 || pending_v2gtpReceiveBuffer(&rb)>0) {
+                fprintf(stderr, "OpenV2G server: connection %u: incomplete frame\n", conn->id);
+            }
+            break; /* regular end of the stream */
+        }
+        commit_v2gtpReceiveBuffer(&rb, (uint32_t)n);
+    }
+}
+
+static void* connectionMain(void* arg) {
+    struct serverConnection* conn = arg;
+    serveConnection(conn);
+    releaseConnection(conn);
+    return NULL;
+}
+
+static int startWorkers(int n) {
+    int i;
+    workers = calloc(n, sizeof(struct serverWorker));
+    if (workers==NULL) {
+        return -1;
+    }
+    for (i=0; i<n; i++) {
+        pthread_mutex_init(&workers[i].lock, NULL);
+        pthread_cond_init(&workers[i].cond, NULL);
+        if (pthread_create(&workers[i].thread, NULL, workerMain, &workers[i])!=0) {
+            break;
+        }
+    }
+    nWorkers = i;
+    return (nWorkers==n) ? 0 : -1;
+}
+
+/* let the workers finish the queued jobs, then terminate them */
+static void stopWorkers(void) {
+    int i;
+    for (i=0; i<nWorkers; i++) {
+        pthread_mutex_lock(&workers[i].lock);
+        workers[i].stop = 1;
+        pthread_cond_signal(&workers[i].cond);
+        pthread_mutex_unlock(&workers[i].lock);
+    }
+    for (i=0; i<nWorkers; i++) {
+        pthread_join(workers[i].thread, NULL);
+        pthread_mutex_destroy(&workers[i].lock);
+        pthread_cond_destroy(&workers[i].cond);
+    }
+    free(workers);
+    workers = NULL;
+    nWorkers = 0;
+}
+
+static int serveUnixSocket(const char* path) {
+    struct sockaddr_un addr;
+    struct serverConnection* conn;
+    pthread_t thread;
+    int listenFd, fd;
+
+    if (strlen(path)>=sizeof(addr.sun_path)) {
+        fprintf(stderr, "OpenV2G server: socket path too long\n");
+        return -1;
+    }
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd<0) {
+        perror("OpenV2G server: socket");
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path); /* remove the socket of a previous run */
+    if (bind(listenFd, (struct sockaddr*)&addr, sizeof(addr))<0 || listen(listenFd, 16)<0) {
+        perror("OpenV2G server: bind");
+        close(listenFd);
+        return -1;
+    }
+    for (;;) {
+        fd = accept(listenFd, NULL, NULL);
+        if (fd<0) {
+            if (errno==EINTR || errno==ECONNABORTED) {
+                continue;
+            }
+            perror("OpenV2G server: accept");
+            break;
+        }
+        conn = createConnection(fd, fd, 1);
+        if (conn==NULL) {
+            close(fd);
+            continue;
+        }
+        if (pthread_create(&thread, NULL, connectionMain, conn)!=0) {
+            releaseConnection(conn);
+            continue;
+        }
+        pthread_detach(thread);
+    }
+    close(listenFd);
+    return -1;
+}
+
+/* The entry point of the server mode, argv[1] is "S" or e.g. "S4" for the number of workers */
+int main_server(int argc, char *argv[]) {
+    struct serverConnection* conn;
+    int n = atoi(&argv[1][1]);
+    int result = 0;
+
+    if (n<=0) {
+        n = SERVER_DEFAULT_WORKERS;
+    }
+    if (n>SERVER_MAX_WORKERS) {
+        n = SERVER_MAX_WORKERS;
+    }
+    /* a client which disconnects shall not terminate the server */
+    signal(SIGPIPE, SIG_IGN);
+    if (startWorkers(n)!=0) {
+        fprintf(stderr, "OpenV2G server: could not start the workers\n");
+        stopWorkers();
+        return 1;
+    }
+    if (argc>=3) {
+        result = serveUnixSocket(argv[2]);
+    } else {
+        conn = createConnection(STDIN_FILENO, STDOUT_FILENO, 0);
+        if (conn==NULL) {
+            result = -1;
+        } else {
+            serveConnection(conn);
+            releaseConnection(conn);
+        }
+    }
+    stopWorkers();
+    return (result==0) ? 0 : 1;
+}
+
+#endif /* CODE_VERSION_COMMANDLINE && CODE_SERVER_YES */
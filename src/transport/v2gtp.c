@@ -38,6 +38,7 @@
 #include <string.h>
 
 #include "v2gtp.h"
+#include "ByteStream.h"
 
 
 int write_v2gtpHeader(uint8_t* outStream, uint32_t outStreamLength, uint16_t payloadType)
@@ -90,3 +91,89 @@ int read_v2gtpHeader(uint8_t* inStream, uint32_t* payloadLength)
 	return 0;
 }
 
+
+void init_v2gtpReceiveBuffer(struct v2gtpReceiveBuffer* buffer, uint8_t* data, uint32_t size, uint32_t prefixLength)
+{
+	buffer->data = data;
+	buffer->size = size;
+	buffer->prefixLength = prefixLength;
+	buffer->start = 0;
+	buffer->end = 0;
+}
+
+uint8_t* reserve_v2gtpReceiveBuffer(struct v2gtpReceiveBuffer* buffer, uint32_t* spaceLength)
+{
+	if(buffer->start == buffer->end) {
+		/* everything handed out */
+		buffer->start = 0;
+		buffer->end = 0;
+	} else if(buffer->start > 0 && buffer->end == buffer->size) {
+		/* only the partial frame is moved, complete frames never are */
+		memmove(buffer->data, &buffer->data[buffer->start], buffer->end - buffer->start);
+		buffer->end -= buffer->start;
+		buffer->start = 0;
+	}
+	*spaceLength = buffer->size - buffer->end;
+	return &buffer->data[buffer->end];
+}
+
+void commit_v2gtpReceiveBuffer(struct v2gtpReceiveBuffer* buffer, uint32_t length)
+{
+	buffer->end += length;
+}
+
+int read_v2gtpFrame(struct v2gtpReceiveBuffer* buffer, struct v2gtpFrame* frame)
+{
+	uint8_t* header;
+	uint32_t available = buffer->end - buffer->start;
+	uint32_t headerLength = buffer->prefixLength + V2GTP_HEADER_LENGTH;
+
+	if(available < headerLength) {
+		return 0;
+	}
+	header = &buffer->data[buffer->start + buffer->prefixLength];
+	if(header[0] != V2GTP_VERSION || header[1] != V2GTP_VERSION_INV) {
+		return -1;
+	}
+	frame->payloadType = (uint16_t)(header[2] << 8 | header[3]);
+	frame->payloadLength = (uint32_t)header[4] << 24 | (uint32_t)header[5] << 16 | (uint32_t)header[6] << 8 | header[7];
+	if(frame->payloadLength > buffer->size - headerLength) {
+		/* would never fit */
+		return -2;
+	}
+	if(available - headerLength < frame->payloadLength) {
+		return 0;
+	}
+	frame->prefix = &buffer->data[buffer->start];
+	frame->payload = &header[V2GTP_HEADER_LENGTH];
+	buffer->start += headerLength + frame->payloadLength;
+	return 1;
+}
+
+uint32_t pending_v2gtpReceiveBuffer(struct v2gtpReceiveBuffer* buffer)
+{
+	return buffer->end - buffer->start;
+}
+
+#if EXI_STREAM == BYTE_ARRAY
+void init_v2gtpPayloadStream(struct v2gtpFrame* frame, bitstream_t* stream, size_t* pos)
+{
+	init_bitstream(stream, frame->payload, frame->payloadLength, pos);
+	*pos = 0;
+}
+
+void init_v2gtpFrameStream(uint8_t* data, size_t size, bitstream_t* stream, size_t* pos)
+{
+	init_bitstream(stream, data, size, pos);
+	*pos = V2GTP_HEADER_LENGTH;
+}
+
+int write_v2gtpFrameHeader(bitstream_t* stream, uint16_t payloadType)
+{
+	if(*stream->pos < V2GTP_HEADER_LENGTH) {
+		return -1;
+	}
+	return write_v2gtpHeader(stream->data, (uint32_t)(*stream->pos - V2GTP_HEADER_LENGTH), payloadType);
+}
+#endif /* EXI_STREAM == BYTE_ARRAY */
+
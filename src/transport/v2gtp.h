@@ -33,6 +33,9 @@ extern "C" {
 #define V2GTP_H_
 
 #include <stdint.h>
+#include <stddef.h>
+
+#include "EXITypes.h"
 
 /* generic V2GTP header length */
 #define V2GTP_HEADER_LENGTH 8
@@ -48,6 +51,57 @@ int write_v2gtpHeader(uint8_t* outStream, uint32_t outStreamLength, uint16_t pay
 
 int read_v2gtpHeader(uint8_t* inStream, uint32_t* payloadLength);
 
+/* Receive buffer for a byte stream of V2GTP frames, e.g. from a TCP socket. Complete frames are
+ * handed out as views into the buffer, the payloads are not copied. Instead of wrapping around like
+ * a ring, the buffer moves a partially received frame to its beginning when it runs out of space,
+ * so every payload stays contiguous for the decoder. */
+struct v2gtpReceiveBuffer {
+	uint8_t* data;
+	uint32_t size;
+	/* number of bytes in front of each V2GTP header, e.g. a session number (usually 0) */
+	uint32_t prefixLength;
+	/* first byte which was not handed out yet */
+	uint32_t start;
+	/* end of the received bytes */
+	uint32_t end;
+};
+
+/* View of a received frame, valid until the next call of reserve_v2gtpReceiveBuffer */
+struct v2gtpFrame {
+	uint8_t* prefix;
+	uint16_t payloadType;
+	uint8_t* payload;
+	uint32_t payloadLength;
+};
+
+void init_v2gtpReceiveBuffer(struct v2gtpReceiveBuffer* buffer, uint8_t* data, uint32_t size, uint32_t prefixLength);
+
+/* Space for the next receive call (e.g. recv(fd, space, *spaceLength, 0)) */
+uint8_t* reserve_v2gtpReceiveBuffer(struct v2gtpReceiveBuffer* buffer, uint32_t* spaceLength);
+
+/* Adds the number of bytes received into the reserved space */
+void commit_v2gtpReceiveBuffer(struct v2gtpReceiveBuffer* buffer, uint32_t length);
+
+/* Returns 1 and the next complete frame, 0 if more bytes are needed, -1 for an invalid header,
+ * or -2 for a frame which does not fit into the buffer (frame->payloadLength is set) */
+int read_v2gtpFrame(struct v2gtpReceiveBuffer* buffer, struct v2gtpFrame* frame);
+
+/* Number of received bytes which do not belong to a complete frame yet */
+uint32_t pending_v2gtpReceiveBuffer(struct v2gtpReceiveBuffer* buffer);
+
+#if EXI_STREAM == BYTE_ARRAY
+/* Decoder stream on the payload of a received frame. The other members of the stream are cleared
+ * (init_bitstream), a digest, arena or value table has to be set afterwards. */
+void init_v2gtpPayloadStream(struct v2gtpFrame* frame, bitstream_t* stream, size_t* pos);
+
+/* Encoder stream on an output buffer, the V2GTP header space in front of the payload is reserved.
+ * The other members of the stream are cleared as for init_v2gtpPayloadStream. */
+void init_v2gtpFrameStream(uint8_t* data, size_t size, bitstream_t* stream, size_t* pos);
+
+/* Writes the header in front of the encoded payload. The frame length is *stream->pos afterwards. */
+int write_v2gtpFrameHeader(bitstream_t* stream, uint16_t payloadType);
+#endif /* EXI_STREAM == BYTE_ARRAY */
+
 #endif /* V2GTP_H_ */
 
 #ifdef __cplusplus
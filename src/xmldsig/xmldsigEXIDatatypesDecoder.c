@@ -34,6 +34,7 @@
 
 #include "DecoderChannel.h"
 #include "EXIHeaderDecoder.h"
+#include "GrammarDecoder.h"
 
 #include "xmldsigEXIDatatypes.h"
 #include "ErrorCodes.h"
@@ -43,10 +44,7 @@
 
 #if DEPLOY_XMLDSIG_CODEC == SUPPORT_YES
 
-/** event-code */
-static uint32_t eventCode;
-static int errn;
-static uint32_t uint32;
+/* Note: eventCode, errn and uint32 are locals of each decode function (reentrant decoding) */
 
 /* Forward Declarations */
 static int decode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct xmldsigCanonicalizationMethodType* xmldsigCanonicalizationMethodType);
@@ -72,11 +70,102 @@ static int decode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigRefere
 static int decode_xmldsigSPKIDataType(bitstream_t* stream, struct xmldsigSPKIDataType* xmldsigSPKIDataType);
 static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoType* xmldsigKeyInfoType);
 
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+/* type independent signatures for the grammar tables */
+static int decode_xmldsigCanonicalizationMethodTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigCanonicalizationMethodType(stream, (struct xmldsigCanonicalizationMethodType*)value);
+}
+static int decode_xmldsigDSAKeyValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigDSAKeyValueType(stream, (struct xmldsigDSAKeyValueType*)value);
+}
+static int decode_xmldsigDigestMethodTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigDigestMethodType(stream, (struct xmldsigDigestMethodType*)value);
+}
+static int decode_xmldsigKeyInfoTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigKeyInfoType(stream, (struct xmldsigKeyInfoType*)value);
+}
+static int decode_xmldsigKeyValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigKeyValueType(stream, (struct xmldsigKeyValueType*)value);
+}
+static int decode_xmldsigObjectTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigObjectType(stream, (struct xmldsigObjectType*)value);
+}
+static int decode_xmldsigPGPDataTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigPGPDataType(stream, (struct xmldsigPGPDataType*)value);
+}
+static int decode_xmldsigRSAKeyValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigRSAKeyValueType(stream, (struct xmldsigRSAKeyValueType*)value);
+}
+static int decode_xmldsigReferenceTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigReferenceType(stream, (struct xmldsigReferenceType*)value);
+}
+static int decode_xmldsigRetrievalMethodTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigRetrievalMethodType(stream, (struct xmldsigRetrievalMethodType*)value);
+}
+static int decode_xmldsigSPKIDataTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigSPKIDataType(stream, (struct xmldsigSPKIDataType*)value);
+}
+static int decode_xmldsigSignatureMethodTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigSignatureMethodType(stream, (struct xmldsigSignatureMethodType*)value);
+}
+static int decode_xmldsigSignaturePropertyTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigSignaturePropertyType(stream, (struct xmldsigSignaturePropertyType*)value);
+}
+static int decode_xmldsigSignatureValueTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigSignatureValueType(stream, (struct xmldsigSignatureValueType*)value);
+}
+static int decode_xmldsigSignedInfoTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigSignedInfoType(stream, (struct xmldsigSignedInfoType*)value);
+}
+static int decode_xmldsigTransformTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigTransformType(stream, (struct xmldsigTransformType*)value);
+}
+static int decode_xmldsigTransformsTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigTransformsType(stream, (struct xmldsigTransformsType*)value);
+}
+static int decode_xmldsigX509DataTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigX509DataType(stream, (struct xmldsigX509DataType*)value);
+}
+static int decode_xmldsigX509IssuerSerialTypeGeneric(bitstream_t* stream, void* value) {
+	return decode_xmldsigX509IssuerSerialType(stream, (struct xmldsigX509IssuerSerialType*)value);
+}
+#endif /* GRAMMAR_DECODER_TABLE */
+
 /* Deviant data decoding (skip functions) */
 
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,CanonicalizationMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigCanonicalizationMethodTypeProductions[4] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigCanonicalizationMethodType, Algorithm.characters), offsetof(struct xmldsigCanonicalizationMethodType, Algorithm.charactersLen), xmldsigCanonicalizationMethodType_Algorithm_CHARACTERS_SIZE, 13 /* {}Algorithm */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigCanonicalizationMethodType, ANY.characters), offsetof(struct xmldsigCanonicalizationMethodType, ANY.charactersLen), xmldsigCanonicalizationMethodType_ANY_CHARACTERS_SIZE, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, NULL }
+};
+static const exi_grammar_transition_t xmldsigCanonicalizationMethodTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 2, 3 }, { 2, 1 }, { 0, 2 }, { 2, 3 }
+};
+static const exi_grammar_state_t xmldsigCanonicalizationMethodTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 2, 3 }
+};
+static void xmldsigCanonicalizationMethodTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigCanonicalizationMethodType* xmldsigCanonicalizationMethodType = (struct xmldsigCanonicalizationMethodType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigCanonicalizationMethodType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigCanonicalizationMethodTypeGrammar = { xmldsigCanonicalizationMethodTypeStates, xmldsigCanonicalizationMethodTypeTransitions, xmldsigCanonicalizationMethodTypeProductions, xmldsigCanonicalizationMethodTypeUsed };
+
+static int decode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct xmldsigCanonicalizationMethodType* xmldsigCanonicalizationMethodType) {
+	init_xmldsigCanonicalizationMethodType(xmldsigCanonicalizationMethodType);
+	return decodeGrammar(stream, &xmldsigCanonicalizationMethodTypeGrammar, xmldsigCanonicalizationMethodType);
+}
+#else
 static int decode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct xmldsigCanonicalizationMethodType* xmldsigCanonicalizationMethodType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 0;
 	int done = 0;
 	
@@ -95,9 +184,12 @@ static int decode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct
 						if (xmldsigCanonicalizationMethodType->Algorithm.charactersLen >= 2) {
 							xmldsigCanonicalizationMethodType->Algorithm.charactersLen = (uint16_t)(xmldsigCanonicalizationMethodType->Algorithm.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigCanonicalizationMethodType->Algorithm.charactersLen, xmldsigCanonicalizationMethodType->Algorithm.characters, xmldsigCanonicalizationMethodType_Algorithm_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 13 /* {}Algorithm */, xmldsigCanonicalizationMethodType->Algorithm.characters, xmldsigCanonicalizationMethodType->Algorithm.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 13 /* {}Algorithm */, &xmldsigCanonicalizationMethodType->Algorithm.charactersLen, xmldsigCanonicalizationMethodType->Algorithm.characters, xmldsigCanonicalizationMethodType_Algorithm_CHARACTERS_SIZE);
 						}
 					}
 					grammarID = 1;
@@ -128,9 +220,12 @@ static int decode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct
 						if (xmldsigCanonicalizationMethodType->ANY.charactersLen >= 2) {
 							xmldsigCanonicalizationMethodType->ANY.charactersLen = (uint16_t)(xmldsigCanonicalizationMethodType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigCanonicalizationMethodType->ANY.charactersLen, xmldsigCanonicalizationMethodType->ANY.characters, xmldsigCanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, xmldsigCanonicalizationMethodType->ANY.characters, xmldsigCanonicalizationMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, &xmldsigCanonicalizationMethodType->ANY.charactersLen, xmldsigCanonicalizationMethodType->ANY.characters, xmldsigCanonicalizationMethodType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigCanonicalizationMethodType->ANY_isUsed = 1u;
@@ -162,9 +257,12 @@ static int decode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct
 						if (xmldsigCanonicalizationMethodType->ANY.charactersLen >= 2) {
 							xmldsigCanonicalizationMethodType->ANY.charactersLen = (uint16_t)(xmldsigCanonicalizationMethodType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigCanonicalizationMethodType->ANY.charactersLen, xmldsigCanonicalizationMethodType->ANY.characters, xmldsigCanonicalizationMethodType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, xmldsigCanonicalizationMethodType->ANY.characters, xmldsigCanonicalizationMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, &xmldsigCanonicalizationMethodType->ANY.charactersLen, xmldsigCanonicalizationMethodType->ANY.characters, xmldsigCanonicalizationMethodType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigCanonicalizationMethodType->ANY_isUsed = 1u;
@@ -186,9 +284,39 @@ static int decode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ManifestType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigManifestTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigManifestType, Id.characters), offsetof(struct xmldsigManifestType, Id.charactersLen), xmldsigManifestType_Id_CHARACTERS_SIZE, 15 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigManifestType_Reference_ARRAY_SIZE, offsetof(struct xmldsigManifestType, Reference.array), offsetof(struct xmldsigManifestType, Reference.arrayLen), sizeof(((struct xmldsigManifestType*)0)->Reference.array[0]), 0, 0, 0, 0, decode_xmldsigReferenceTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigManifestTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t xmldsigManifestTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }
+};
+static void xmldsigManifestTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigManifestType* xmldsigManifestType = (struct xmldsigManifestType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigManifestType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigManifestTypeGrammar = { xmldsigManifestTypeStates, xmldsigManifestTypeTransitions, xmldsigManifestTypeProductions, xmldsigManifestTypeUsed };
+
+static int decode_xmldsigManifestType(bitstream_t* stream, struct xmldsigManifestType* xmldsigManifestType) {
+	init_xmldsigManifestType(xmldsigManifestType);
+	return decodeGrammar(stream, &xmldsigManifestTypeGrammar, xmldsigManifestType);
+}
+#else
 static int decode_xmldsigManifestType(bitstream_t* stream, struct xmldsigManifestType* xmldsigManifestType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 4;
 	int done = 0;
 	
@@ -207,9 +335,12 @@ static int decode_xmldsigManifestType(bitstream_t* stream, struct xmldsigManifes
 						if (xmldsigManifestType->Id.charactersLen >= 2) {
 							xmldsigManifestType->Id.charactersLen = (uint16_t)(xmldsigManifestType->Id.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigManifestType->Id.charactersLen, xmldsigManifestType->Id.characters, xmldsigManifestType_Id_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 15 /* {}Id */, xmldsigManifestType->Id.characters, xmldsigManifestType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 15 /* {}Id */, &xmldsigManifestType->Id.charactersLen, xmldsigManifestType->Id.characters, xmldsigManifestType_Id_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigManifestType->Id_isUsed = 1u;
@@ -281,9 +412,53 @@ static int decode_xmldsigManifestType(bitstream_t* stream, struct xmldsigManifes
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ObjectType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any])){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigObjectTypeProductions[6] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigObjectType, Encoding.characters), offsetof(struct xmldsigObjectType, Encoding.charactersLen), xmldsigObjectType_Encoding_CHARACTERS_SIZE, 14 /* {}Encoding */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct xmldsigObjectType, Id.characters), offsetof(struct xmldsigObjectType, Id.charactersLen), xmldsigObjectType_Id_CHARACTERS_SIZE, 15 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct xmldsigObjectType, MimeType.characters), offsetof(struct xmldsigObjectType, MimeType.charactersLen), xmldsigObjectType_MimeType_CHARACTERS_SIZE, 16 /* {}MimeType */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct xmldsigObjectType, ANY.characters), offsetof(struct xmldsigObjectType, ANY.charactersLen), xmldsigObjectType_ANY_CHARACTERS_SIZE, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, NULL }
+};
+static const exi_grammar_transition_t xmldsigObjectTypeTransitions[21] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 0, 4 }, { 4, 5 }, { 2, 1 }, { 3, 2 },
+	{ 4, 3 }, { 0, 4 }, { 4, 5 }, { 3, 2 }, { 4, 3 }, { 0, 4 }, { 4, 5 }, { 4, 3 },
+	{ 0, 4 }, { 4, 5 }, { 4, 3 }, { 0, 4 }, { 4, 5 }
+};
+static const exi_grammar_state_t xmldsigObjectTypeStates[5] = {
+	{ 0, 3, 6 }, { 6, 3, 5 }, { 11, 3, 4 }, { 15, 2, 3 }, { 18, 2, 3 }
+};
+static void xmldsigObjectTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigObjectType* xmldsigObjectType = (struct xmldsigObjectType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigObjectType->Encoding_isUsed = 1u;
+		break;
+	case 1:
+		xmldsigObjectType->Id_isUsed = 1u;
+		break;
+	case 2:
+		xmldsigObjectType->MimeType_isUsed = 1u;
+		break;
+	case 3:
+		xmldsigObjectType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigObjectTypeGrammar = { xmldsigObjectTypeStates, xmldsigObjectTypeTransitions, xmldsigObjectTypeProductions, xmldsigObjectTypeUsed };
+
+static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectType* xmldsigObjectType) {
+	init_xmldsigObjectType(xmldsigObjectType);
+	return decodeGrammar(stream, &xmldsigObjectTypeGrammar, xmldsigObjectType);
+}
+#else
 static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectType* xmldsigObjectType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 7;
 	int done = 0;
 	
@@ -302,9 +477,12 @@ static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 						if (xmldsigObjectType->Encoding.charactersLen >= 2) {
 							xmldsigObjectType->Encoding.charactersLen = (uint16_t)(xmldsigObjectType->Encoding.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigObjectType->Encoding.charactersLen, xmldsigObjectType->Encoding.characters, xmldsigObjectType_Encoding_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 14 /* {}Encoding */, xmldsigObjectType->Encoding.characters, xmldsigObjectType->Encoding.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 14 /* {}Encoding */, &xmldsigObjectType->Encoding.charactersLen, xmldsigObjectType->Encoding.characters, xmldsigObjectType_Encoding_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigObjectType->Encoding_isUsed = 1u;
@@ -316,9 +494,12 @@ static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 						if (xmldsigObjectType->Id.charactersLen >= 2) {
 							xmldsigObjectType->Id.charactersLen = (uint16_t)(xmldsigObjectType->Id.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigObjectType->Id.charactersLen, xmldsigObjectType->Id.characters, xmldsigObjectType_Id_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 15 /* {}Id */, xmldsigObjectType->Id.characters, xmldsigObjectType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 15 /* {}Id */, &xmldsigObjectType->Id.charactersLen, xmldsigObjectType->Id.characters, xmldsigObjectType_Id_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigObjectType->Id_isUsed = 1u;
@@ -330,9 +511,12 @@ static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 						if (xmldsigObjectType->MimeType.charactersLen >= 2) {
 							xmldsigObjectType->MimeType.charactersLen = (uint16_t)(xmldsigObjectType->MimeType.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigObjectType->MimeType.charactersLen, xmldsigObjectType->MimeType.characters, xmldsigObjectType_MimeType_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 16 /* {}MimeType */, xmldsigObjectType->MimeType.characters, xmldsigObjectType->MimeType.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 16 /* {}MimeType */, &xmldsigObjectType->MimeType.charactersLen, xmldsigObjectType->MimeType.characters, xmldsigObjectType_MimeType_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigObjectType->MimeType_isUsed = 1u;
@@ -353,9 +537,12 @@ static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 						if (xmldsigObjectType->ANY.charactersLen >= 2) {
 							xmldsigObjectType->ANY.charactersLen = (uint16_t)(xmldsigObjectType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigObjectType->ANY.charactersLen, xmldsigObjectType->ANY.characters, xmldsigObjectType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &xmldsigObjectType->ANY.charactersLen, xmldsigObjectType->ANY.characters, xmldsigObjectType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigObjectType->ANY_isUsed = 1u;
@@ -378,9 +565,12 @@ static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 						if (xmldsigObjectType->Id.charactersLen >= 2) {
 							xmldsigObjectType->Id.charactersLen = (uint16_t)(xmldsigObjectType->Id.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigObjectType->Id.charactersLen, xmldsigObjectType->Id.characters, xmldsigObjectType_Id_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 15 /* {}Id */, xmldsigObjectType->Id.characters, xmldsigObjectType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 15 /* {}Id */, &xmldsigObjectType->Id.charactersLen, xmldsigObjectType->Id.characters, xmldsigObjectType_Id_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigObjectType->Id_isUsed = 1u;
@@ -392,9 +582,12 @@ static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 						if (xmldsigObjectType->MimeType.charactersLen >= 2) {
 							xmldsigObjectType->MimeType.charactersLen = (uint16_t)(xmldsigObjectType->MimeType.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigObjectType->MimeType.charactersLen, xmldsigObjectType->MimeType.characters, xmldsigObjectType_MimeType_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 16 /* {}MimeType */, xmldsigObjectType->MimeType.characters, xmldsigObjectType->MimeType.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 16 /* {}MimeType */, &xmldsigObjectType->MimeType.charactersLen, xmldsigObjectType->MimeType.characters, xmldsigObjectType_MimeType_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigObjectType->MimeType_isUsed = 1u;
@@ -415,9 +608,12 @@ static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 						if (xmldsigObjectType->ANY.charactersLen >= 2) {
 							xmldsigObjectType->ANY.charactersLen = (uint16_t)(xmldsigObjectType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigObjectType->ANY.charactersLen, xmldsigObjectType->ANY.characters, xmldsigObjectType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &xmldsigObjectType->ANY.charactersLen, xmldsigObjectType->ANY.characters, xmldsigObjectType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigObjectType->ANY_isUsed = 1u;
@@ -440,9 +636,12 @@ static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 						if (xmldsigObjectType->MimeType.charactersLen >= 2) {
 							xmldsigObjectType->MimeType.charactersLen = (uint16_t)(xmldsigObjectType->MimeType.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigObjectType->MimeType.charactersLen, xmldsigObjectType->MimeType.characters, xmldsigObjectType_MimeType_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 16 /* {}MimeType */, xmldsigObjectType->MimeType.characters, xmldsigObjectType->MimeType.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 16 /* {}MimeType */, &xmldsigObjectType->MimeType.charactersLen, xmldsigObjectType->MimeType.characters, xmldsigObjectType_MimeType_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigObjectType->MimeType_isUsed = 1u;
@@ -463,9 +662,12 @@ static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 						if (xmldsigObjectType->ANY.charactersLen >= 2) {
 							xmldsigObjectType->ANY.charactersLen = (uint16_t)(xmldsigObjectType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigObjectType->ANY.charactersLen, xmldsigObjectType->ANY.characters, xmldsigObjectType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &xmldsigObjectType->ANY.charactersLen, xmldsigObjectType->ANY.characters, xmldsigObjectType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigObjectType->ANY_isUsed = 1u;
@@ -497,9 +699,12 @@ static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 						if (xmldsigObjectType->ANY.charactersLen >= 2) {
 							xmldsigObjectType->ANY.charactersLen = (uint16_t)(xmldsigObjectType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigObjectType->ANY.charactersLen, xmldsigObjectType->ANY.characters, xmldsigObjectType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &xmldsigObjectType->ANY.charactersLen, xmldsigObjectType->ANY.characters, xmldsigObjectType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigObjectType->ANY_isUsed = 1u;
@@ -531,9 +736,12 @@ static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 						if (xmldsigObjectType->ANY.charactersLen >= 2) {
 							xmldsigObjectType->ANY.charactersLen = (uint16_t)(xmldsigObjectType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigObjectType->ANY.charactersLen, xmldsigObjectType->ANY.characters, xmldsigObjectType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, &xmldsigObjectType->ANY.charactersLen, xmldsigObjectType->ANY.characters, xmldsigObjectType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigObjectType->ANY_isUsed = 1u;
@@ -555,9 +763,42 @@ static int decode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])|"http://www.w3.org/2000/09/xmldsig#":XPath){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigTransformTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigTransformType, Algorithm.characters), offsetof(struct xmldsigTransformType, Algorithm.charactersLen), xmldsigTransformType_Algorithm_CHARACTERS_SIZE, 13 /* {}Algorithm */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigTransformType_XPath_ARRAY_SIZE, offsetof(struct xmldsigTransformType, XPath.array), offsetof(struct xmldsigTransformType, XPath.arrayLen), sizeof(((struct xmldsigTransformType*)0)->XPath.array[0]), (offsetof(struct xmldsigTransformType, XPath.array[0].characters) - offsetof(struct xmldsigTransformType, XPath.array)), (offsetof(struct xmldsigTransformType, XPath.array[0].charactersLen) - offsetof(struct xmldsigTransformType, XPath.array)), xmldsigTransformType_XPath_CHARACTERS_SIZE, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigTransformType, ANY.characters), offsetof(struct xmldsigTransformType, ANY.charactersLen), xmldsigTransformType_ANY_CHARACTERS_SIZE, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, NULL }
+};
+static const exi_grammar_transition_t xmldsigTransformTypeTransitions[9] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 0, 3 }, { 2, 4 }, { 2, 1 }, { 2, 2 }, { 0, 3 },
+	{ 2, 4 }
+};
+static const exi_grammar_state_t xmldsigTransformTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 3, 4 }, { 5, 3, 4 }
+};
+static void xmldsigTransformTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigTransformType* xmldsigTransformType = (struct xmldsigTransformType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigTransformType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigTransformTypeGrammar = { xmldsigTransformTypeStates, xmldsigTransformTypeTransitions, xmldsigTransformTypeProductions, xmldsigTransformTypeUsed };
+
 static int decode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransformType* xmldsigTransformType) {
+	init_xmldsigTransformType(xmldsigTransformType);
+	return decodeGrammar(stream, &xmldsigTransformTypeGrammar, xmldsigTransformType);
+}
+#else
+static int decode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransformType* xmldsigTransformType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 10;
 	int done = 0;
 	
@@ -576,9 +817,12 @@ static int decode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransf
 						if (xmldsigTransformType->Algorithm.charactersLen >= 2) {
 							xmldsigTransformType->Algorithm.charactersLen = (uint16_t)(xmldsigTransformType->Algorithm.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigTransformType->Algorithm.charactersLen, xmldsigTransformType->Algorithm.characters, xmldsigTransformType_Algorithm_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 13 /* {}Algorithm */, xmldsigTransformType->Algorithm.characters, xmldsigTransformType->Algorithm.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 13 /* {}Algorithm */, &xmldsigTransformType->Algorithm.charactersLen, xmldsigTransformType->Algorithm.characters, xmldsigTransformType_Algorithm_CHARACTERS_SIZE);
 						}
 					}
 					grammarID = 11;
@@ -605,9 +849,12 @@ static int decode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransf
 									if (xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].charactersLen >= 2) {
 										xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].charactersLen = (uint16_t)(xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].charactersLen - 2); /* string table miss */
 										errn = decodeCharacters(stream, xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].charactersLen, xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].characters, xmldsigTransformType_XPath_CHARACTERS_SIZE);
+										if (errn == 0) {
+											errn = addStringValue(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].characters, xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+										errn = decodeStringValueHit(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].charactersLen, xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].characters, xmldsigTransformType_XPath_CHARACTERS_SIZE);
 									}
 								}
 								xmldsigTransformType->XPath.arrayLen++;
@@ -644,9 +891,12 @@ static int decode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransf
 						if (xmldsigTransformType->ANY.charactersLen >= 2) {
 							xmldsigTransformType->ANY.charactersLen = (uint16_t)(xmldsigTransformType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigTransformType->ANY.charactersLen, xmldsigTransformType->ANY.characters, xmldsigTransformType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, xmldsigTransformType->ANY.characters, xmldsigTransformType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, &xmldsigTransformType->ANY.charactersLen, xmldsigTransformType->ANY.characters, xmldsigTransformType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigTransformType->ANY_isUsed = 1u;
@@ -674,9 +924,12 @@ static int decode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransf
 									if (xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].charactersLen >= 2) {
 										xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].charactersLen = (uint16_t)(xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].charactersLen - 2); /* string table miss */
 										errn = decodeCharacters(stream, xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].charactersLen, xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].characters, xmldsigTransformType_XPath_CHARACTERS_SIZE);
+										if (errn == 0) {
+											errn = addStringValue(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].characters, xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+										errn = decodeStringValueHit(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].charactersLen, xmldsigTransformType->XPath.array[xmldsigTransformType->XPath.arrayLen].characters, xmldsigTransformType_XPath_CHARACTERS_SIZE);
 									}
 								}
 								xmldsigTransformType->XPath.arrayLen++;
@@ -713,9 +966,12 @@ static int decode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransf
 						if (xmldsigTransformType->ANY.charactersLen >= 2) {
 							xmldsigTransformType->ANY.charactersLen = (uint16_t)(xmldsigTransformType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigTransformType->ANY.charactersLen, xmldsigTransformType->ANY.characters, xmldsigTransformType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, xmldsigTransformType->ANY.characters, xmldsigTransformType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, &xmldsigTransformType->ANY.charactersLen, xmldsigTransformType->ANY.characters, xmldsigTransformType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigTransformType->ANY_isUsed = 1u;
@@ -737,9 +993,45 @@ static int decode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransf
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":HMACOutputLength{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigSignatureMethodTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignatureMethodType, Algorithm.characters), offsetof(struct xmldsigSignatureMethodType, Algorithm.charactersLen), xmldsigSignatureMethodType_Algorithm_CHARACTERS_SIZE, 13 /* {}Algorithm */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER64, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignatureMethodType, HMACOutputLength), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignatureMethodType, ANY.characters), offsetof(struct xmldsigSignatureMethodType, ANY.charactersLen), xmldsigSignatureMethodType_ANY_CHARACTERS_SIZE, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, NULL }
+};
+static const exi_grammar_transition_t xmldsigSignatureMethodTypeTransitions[12] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 0, 3 }, { 3, 4 }, { 2, 2 }, { 0, 3 }, { 2, 4 },
+	{ 2, 1 }, { 2, 2 }, { 0, 3 }, { 3, 4 }
+};
+static const exi_grammar_state_t xmldsigSignatureMethodTypeStates[4] = {
+	{ 0, 1, 1 }, { 1, 3, 4 }, { 5, 2, 3 }, { 8, 3, 4 }
+};
+static void xmldsigSignatureMethodTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigSignatureMethodType* xmldsigSignatureMethodType = (struct xmldsigSignatureMethodType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigSignatureMethodType->HMACOutputLength_isUsed = 1u;
+		break;
+	case 1:
+		xmldsigSignatureMethodType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigSignatureMethodTypeGrammar = { xmldsigSignatureMethodTypeStates, xmldsigSignatureMethodTypeTransitions, xmldsigSignatureMethodTypeProductions, xmldsigSignatureMethodTypeUsed };
+
 static int decode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsigSignatureMethodType* xmldsigSignatureMethodType) {
+	init_xmldsigSignatureMethodType(xmldsigSignatureMethodType);
+	return decodeGrammar(stream, &xmldsigSignatureMethodTypeGrammar, xmldsigSignatureMethodType);
+}
+#else
+static int decode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsigSignatureMethodType* xmldsigSignatureMethodType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 13;
 	int done = 0;
 	
@@ -758,9 +1050,12 @@ static int decode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsig
 						if (xmldsigSignatureMethodType->Algorithm.charactersLen >= 2) {
 							xmldsigSignatureMethodType->Algorithm.charactersLen = (uint16_t)(xmldsigSignatureMethodType->Algorithm.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignatureMethodType->Algorithm.charactersLen, xmldsigSignatureMethodType->Algorithm.characters, xmldsigSignatureMethodType_Algorithm_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 13 /* {}Algorithm */, xmldsigSignatureMethodType->Algorithm.characters, xmldsigSignatureMethodType->Algorithm.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 13 /* {}Algorithm */, &xmldsigSignatureMethodType->Algorithm.charactersLen, xmldsigSignatureMethodType->Algorithm.characters, xmldsigSignatureMethodType_Algorithm_CHARACTERS_SIZE);
 						}
 					}
 					grammarID = 14;
@@ -813,9 +1108,12 @@ static int decode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsig
 						if (xmldsigSignatureMethodType->ANY.charactersLen >= 2) {
 							xmldsigSignatureMethodType->ANY.charactersLen = (uint16_t)(xmldsigSignatureMethodType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignatureMethodType->ANY.charactersLen, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &xmldsigSignatureMethodType->ANY.charactersLen, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigSignatureMethodType->ANY_isUsed = 1u;
@@ -847,9 +1145,12 @@ static int decode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsig
 						if (xmldsigSignatureMethodType->ANY.charactersLen >= 2) {
 							xmldsigSignatureMethodType->ANY.charactersLen = (uint16_t)(xmldsigSignatureMethodType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignatureMethodType->ANY.charactersLen, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &xmldsigSignatureMethodType->ANY.charactersLen, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigSignatureMethodType->ANY_isUsed = 1u;
@@ -903,9 +1204,12 @@ static int decode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsig
 						if (xmldsigSignatureMethodType->ANY.charactersLen >= 2) {
 							xmldsigSignatureMethodType->ANY.charactersLen = (uint16_t)(xmldsigSignatureMethodType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignatureMethodType->ANY.charactersLen, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, &xmldsigSignatureMethodType->ANY.charactersLen, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigSignatureMethodType->ANY_isUsed = 1u;
@@ -927,9 +1231,40 @@ static int decode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsig
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DigestMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigDigestMethodTypeProductions[4] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigDigestMethodType, Algorithm.characters), offsetof(struct xmldsigDigestMethodType, Algorithm.charactersLen), xmldsigDigestMethodType_Algorithm_CHARACTERS_SIZE, 13 /* {}Algorithm */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigDigestMethodType, ANY.characters), offsetof(struct xmldsigDigestMethodType, ANY.charactersLen), xmldsigDigestMethodType_ANY_CHARACTERS_SIZE, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, NULL }
+};
+static const exi_grammar_transition_t xmldsigDigestMethodTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }, { 2, 3 }, { 2, 1 }, { 0, 2 }, { 2, 3 }
+};
+static const exi_grammar_state_t xmldsigDigestMethodTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 2, 3 }
+};
+static void xmldsigDigestMethodTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigDigestMethodType* xmldsigDigestMethodType = (struct xmldsigDigestMethodType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigDigestMethodType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigDigestMethodTypeGrammar = { xmldsigDigestMethodTypeStates, xmldsigDigestMethodTypeTransitions, xmldsigDigestMethodTypeProductions, xmldsigDigestMethodTypeUsed };
+
 static int decode_xmldsigDigestMethodType(bitstream_t* stream, struct xmldsigDigestMethodType* xmldsigDigestMethodType) {
+	init_xmldsigDigestMethodType(xmldsigDigestMethodType);
+	return decodeGrammar(stream, &xmldsigDigestMethodTypeGrammar, xmldsigDigestMethodType);
+}
+#else
+static int decode_xmldsigDigestMethodType(bitstream_t* stream, struct xmldsigDigestMethodType* xmldsigDigestMethodType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 0;
 	int done = 0;
 	
@@ -948,9 +1283,12 @@ static int decode_xmldsigDigestMethodType(bitstream_t* stream, struct xmldsigDig
 						if (xmldsigDigestMethodType->Algorithm.charactersLen >= 2) {
 							xmldsigDigestMethodType->Algorithm.charactersLen = (uint16_t)(xmldsigDigestMethodType->Algorithm.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigDigestMethodType->Algorithm.charactersLen, xmldsigDigestMethodType->Algorithm.characters, xmldsigDigestMethodType_Algorithm_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 13 /* {}Algorithm */, xmldsigDigestMethodType->Algorithm.characters, xmldsigDigestMethodType->Algorithm.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 13 /* {}Algorithm */, &xmldsigDigestMethodType->Algorithm.charactersLen, xmldsigDigestMethodType->Algorithm.characters, xmldsigDigestMethodType_Algorithm_CHARACTERS_SIZE);
 						}
 					}
 					grammarID = 1;
@@ -981,9 +1319,12 @@ static int decode_xmldsigDigestMethodType(bitstream_t* stream, struct xmldsigDig
 						if (xmldsigDigestMethodType->ANY.charactersLen >= 2) {
 							xmldsigDigestMethodType->ANY.charactersLen = (uint16_t)(xmldsigDigestMethodType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigDigestMethodType->ANY.charactersLen, xmldsigDigestMethodType->ANY.characters, xmldsigDigestMethodType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, xmldsigDigestMethodType->ANY.characters, xmldsigDigestMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, &xmldsigDigestMethodType->ANY.charactersLen, xmldsigDigestMethodType->ANY.characters, xmldsigDigestMethodType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigDigestMethodType->ANY_isUsed = 1u;
@@ -1015,9 +1356,12 @@ static int decode_xmldsigDigestMethodType(bitstream_t* stream, struct xmldsigDig
 						if (xmldsigDigestMethodType->ANY.charactersLen >= 2) {
 							xmldsigDigestMethodType->ANY.charactersLen = (uint16_t)(xmldsigDigestMethodType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigDigestMethodType->ANY.charactersLen, xmldsigDigestMethodType->ANY.characters, xmldsigDigestMethodType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, xmldsigDigestMethodType->ANY.characters, xmldsigDigestMethodType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, &xmldsigDigestMethodType->ANY.charactersLen, xmldsigDigestMethodType->ANY.characters, xmldsigDigestMethodType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigDigestMethodType->ANY_isUsed = 1u;
@@ -1039,9 +1383,47 @@ static int decode_xmldsigDigestMethodType(bitstream_t* stream, struct xmldsigDig
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RetrievalMethodType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigRetrievalMethodTypeProductions[4] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigRetrievalMethodType, Type.characters), offsetof(struct xmldsigRetrievalMethodType, Type.charactersLen), xmldsigRetrievalMethodType_Type_CHARACTERS_SIZE, 18 /* {}Type */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct xmldsigRetrievalMethodType, URI.characters), offsetof(struct xmldsigRetrievalMethodType, URI.charactersLen), xmldsigRetrievalMethodType_URI_CHARACTERS_SIZE, 19 /* {}URI */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct xmldsigRetrievalMethodType, Transforms), 0, 0, 0, decode_xmldsigTransformsTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigRetrievalMethodTypeTransitions[10] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 2, 1 }, { 3, 2 }, { 0, 3 }, { 3, 2 },
+	{ 0, 3 }, { 0, 3 }
+};
+static const exi_grammar_state_t xmldsigRetrievalMethodTypeStates[4] = {
+	{ 0, 3, 4 }, { 4, 2, 3 }, { 7, 2, 2 }, { 9, 1, 1 }
+};
+static void xmldsigRetrievalMethodTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigRetrievalMethodType* xmldsigRetrievalMethodType = (struct xmldsigRetrievalMethodType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigRetrievalMethodType->Type_isUsed = 1u;
+		break;
+	case 1:
+		xmldsigRetrievalMethodType->URI_isUsed = 1u;
+		break;
+	case 2:
+		xmldsigRetrievalMethodType->Transforms_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigRetrievalMethodTypeGrammar = { xmldsigRetrievalMethodTypeStates, xmldsigRetrievalMethodTypeTransitions, xmldsigRetrievalMethodTypeProductions, xmldsigRetrievalMethodTypeUsed };
+
+static int decode_xmldsigRetrievalMethodType(bitstream_t* stream, struct xmldsigRetrievalMethodType* xmldsigRetrievalMethodType) {
+	init_xmldsigRetrievalMethodType(xmldsigRetrievalMethodType);
+	return decodeGrammar(stream, &xmldsigRetrievalMethodTypeGrammar, xmldsigRetrievalMethodType);
+}
+#else
 static int decode_xmldsigRetrievalMethodType(bitstream_t* stream, struct xmldsigRetrievalMethodType* xmldsigRetrievalMethodType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 16;
 	int done = 0;
 	
@@ -1060,9 +1442,12 @@ static int decode_xmldsigRetrievalMethodType(bitstream_t* stream, struct xmldsig
 						if (xmldsigRetrievalMethodType->Type.charactersLen >= 2) {
 							xmldsigRetrievalMethodType->Type.charactersLen = (uint16_t)(xmldsigRetrievalMethodType->Type.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigRetrievalMethodType->Type.charactersLen, xmldsigRetrievalMethodType->Type.characters, xmldsigRetrievalMethodType_Type_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 18 /* {}Type */, xmldsigRetrievalMethodType->Type.characters, xmldsigRetrievalMethodType->Type.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 18 /* {}Type */, &xmldsigRetrievalMethodType->Type.charactersLen, xmldsigRetrievalMethodType->Type.characters, xmldsigRetrievalMethodType_Type_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigRetrievalMethodType->Type_isUsed = 1u;
@@ -1074,9 +1459,12 @@ static int decode_xmldsigRetrievalMethodType(bitstream_t* stream, struct xmldsig
 						if (xmldsigRetrievalMethodType->URI.charactersLen >= 2) {
 							xmldsigRetrievalMethodType->URI.charactersLen = (uint16_t)(xmldsigRetrievalMethodType->URI.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigRetrievalMethodType->URI.charactersLen, xmldsigRetrievalMethodType->URI.characters, xmldsigRetrievalMethodType_URI_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 19 /* {}URI */, xmldsigRetrievalMethodType->URI.characters, xmldsigRetrievalMethodType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 19 /* {}URI */, &xmldsigRetrievalMethodType->URI.charactersLen, xmldsigRetrievalMethodType->URI.characters, xmldsigRetrievalMethodType_URI_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigRetrievalMethodType->URI_isUsed = 1u;
@@ -1108,9 +1496,12 @@ static int decode_xmldsigRetrievalMethodType(bitstream_t* stream, struct xmldsig
 						if (xmldsigRetrievalMethodType->URI.charactersLen >= 2) {
 							xmldsigRetrievalMethodType->URI.charactersLen = (uint16_t)(xmldsigRetrievalMethodType->URI.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigRetrievalMethodType->URI.charactersLen, xmldsigRetrievalMethodType->URI.characters, xmldsigRetrievalMethodType_URI_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 19 /* {}URI */, xmldsigRetrievalMethodType->URI.characters, xmldsigRetrievalMethodType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 19 /* {}URI */, &xmldsigRetrievalMethodType->URI.charactersLen, xmldsigRetrievalMethodType->URI.characters, xmldsigRetrievalMethodType_URI_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigRetrievalMethodType->URI_isUsed = 1u;
@@ -1176,9 +1567,39 @@ static int decode_xmldsigRetrievalMethodType(bitstream_t* stream, struct xmldsig
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureValueType',  base type name='base64Binary',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigSignatureValueTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignatureValueType, Id.characters), offsetof(struct xmldsigSignatureValueType, Id.charactersLen), xmldsigSignatureValueType_Id_CHARACTERS_SIZE, 15 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignatureValueType, CONTENT.bytes), offsetof(struct xmldsigSignatureValueType, CONTENT.bytesLen), xmldsigSignatureValueType_CONTENT_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigSignatureValueTypeTransitions[4] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t xmldsigSignatureValueTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }
+};
+static void xmldsigSignatureValueTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigSignatureValueType* xmldsigSignatureValueType = (struct xmldsigSignatureValueType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigSignatureValueType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigSignatureValueTypeGrammar = { xmldsigSignatureValueTypeStates, xmldsigSignatureValueTypeTransitions, xmldsigSignatureValueTypeProductions, xmldsigSignatureValueTypeUsed };
+
+static int decode_xmldsigSignatureValueType(bitstream_t* stream, struct xmldsigSignatureValueType* xmldsigSignatureValueType) {
+	init_xmldsigSignatureValueType(xmldsigSignatureValueType);
+	return decodeGrammar(stream, &xmldsigSignatureValueTypeGrammar, xmldsigSignatureValueType);
+}
+#else
 static int decode_xmldsigSignatureValueType(bitstream_t* stream, struct xmldsigSignatureValueType* xmldsigSignatureValueType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 20;
 	int done = 0;
 	
@@ -1197,9 +1618,12 @@ static int decode_xmldsigSignatureValueType(bitstream_t* stream, struct xmldsigS
 						if (xmldsigSignatureValueType->Id.charactersLen >= 2) {
 							xmldsigSignatureValueType->Id.charactersLen = (uint16_t)(xmldsigSignatureValueType->Id.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignatureValueType->Id.charactersLen, xmldsigSignatureValueType->Id.characters, xmldsigSignatureValueType_Id_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 15 /* {}Id */, xmldsigSignatureValueType->Id.characters, xmldsigSignatureValueType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 15 /* {}Id */, &xmldsigSignatureValueType->Id.charactersLen, xmldsigSignatureValueType->Id.characters, xmldsigSignatureValueType_Id_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigSignatureValueType->Id_isUsed = 1u;
@@ -1267,9 +1691,31 @@ static int decode_xmldsigSignatureValueType(bitstream_t* stream, struct xmldsigS
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509IssuerSerialType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":X509IssuerName,"http://www.w3.org/2000/09/xmldsig#":X509SerialNumber)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigX509IssuerSerialTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigX509IssuerSerialType, X509IssuerName.characters), offsetof(struct xmldsigX509IssuerSerialType, X509IssuerName.charactersLen), xmldsigX509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_INTEGER64, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigX509IssuerSerialType, X509SerialNumber), 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigX509IssuerSerialTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t xmldsigX509IssuerSerialTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t xmldsigX509IssuerSerialTypeGrammar = { xmldsigX509IssuerSerialTypeStates, xmldsigX509IssuerSerialTypeTransitions, xmldsigX509IssuerSerialTypeProductions, NULL };
+
 static int decode_xmldsigX509IssuerSerialType(bitstream_t* stream, struct xmldsigX509IssuerSerialType* xmldsigX509IssuerSerialType) {
+	init_xmldsigX509IssuerSerialType(xmldsigX509IssuerSerialType);
+	return decodeGrammar(stream, &xmldsigX509IssuerSerialTypeGrammar, xmldsigX509IssuerSerialType);
+}
+#else
+static int decode_xmldsigX509IssuerSerialType(bitstream_t* stream, struct xmldsigX509IssuerSerialType* xmldsigX509IssuerSerialType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 22;
 	int done = 0;
 	
@@ -1292,9 +1738,12 @@ static int decode_xmldsigX509IssuerSerialType(bitstream_t* stream, struct xmldsi
 								if (xmldsigX509IssuerSerialType->X509IssuerName.charactersLen >= 2) {
 									xmldsigX509IssuerSerialType->X509IssuerName.charactersLen = (uint16_t)(xmldsigX509IssuerSerialType->X509IssuerName.charactersLen - 2); /* string table miss */
 									errn = decodeCharacters(stream, xmldsigX509IssuerSerialType->X509IssuerName.charactersLen, xmldsigX509IssuerSerialType->X509IssuerName.characters, xmldsigX509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE);
+									if (errn == 0) {
+										errn = addStringValue(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, xmldsigX509IssuerSerialType->X509IssuerName.characters, xmldsigX509IssuerSerialType->X509IssuerName.charactersLen);
+									}
 								} else {
 									/* string table hit */
-									errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+									errn = decodeStringValueHit(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, &xmldsigX509IssuerSerialType->X509IssuerName.charactersLen, xmldsigX509IssuerSerialType->X509IssuerName.characters, xmldsigX509IssuerSerialType_X509IssuerName_CHARACTERS_SIZE);
 								}
 							}
 						} else {
@@ -1375,9 +1824,41 @@ static int decode_xmldsigX509IssuerSerialType(bitstream_t* stream, struct xmldsi
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignedInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":CanonicalizationMethod,"http://www.w3.org/2000/09/xmldsig#":SignatureMethod,"http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigSignedInfoTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignedInfoType, Id.characters), offsetof(struct xmldsigSignedInfoType, Id.charactersLen), xmldsigSignedInfoType_Id_CHARACTERS_SIZE, 15 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignedInfoType, CanonicalizationMethod), 0, 0, 0, decode_xmldsigCanonicalizationMethodTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignedInfoType, SignatureMethod), 0, 0, 0, decode_xmldsigSignatureMethodTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigSignedInfoType_Reference_ARRAY_SIZE, offsetof(struct xmldsigSignedInfoType, Reference.array), offsetof(struct xmldsigSignedInfoType, Reference.arrayLen), sizeof(((struct xmldsigSignedInfoType*)0)->Reference.array[0]), 0, 0, 0, 0, decode_xmldsigReferenceTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigSignedInfoTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 3 }, { 0, 4 }
+};
+static const exi_grammar_state_t xmldsigSignedInfoTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 1, 1 }, { 5, 2, 2 }
+};
+static void xmldsigSignedInfoTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigSignedInfoType* xmldsigSignedInfoType = (struct xmldsigSignedInfoType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigSignedInfoType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigSignedInfoTypeGrammar = { xmldsigSignedInfoTypeStates, xmldsigSignedInfoTypeTransitions, xmldsigSignedInfoTypeProductions, xmldsigSignedInfoTypeUsed };
+
 static int decode_xmldsigSignedInfoType(bitstream_t* stream, struct xmldsigSignedInfoType* xmldsigSignedInfoType) {
+	init_xmldsigSignedInfoType(xmldsigSignedInfoType);
+	return decodeGrammar(stream, &xmldsigSignedInfoTypeGrammar, xmldsigSignedInfoType);
+}
+#else
+static int decode_xmldsigSignedInfoType(bitstream_t* stream, struct xmldsigSignedInfoType* xmldsigSignedInfoType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 24;
 	int done = 0;
 	
@@ -1396,9 +1877,12 @@ static int decode_xmldsigSignedInfoType(bitstream_t* stream, struct xmldsigSigne
 						if (xmldsigSignedInfoType->Id.charactersLen >= 2) {
 							xmldsigSignedInfoType->Id.charactersLen = (uint16_t)(xmldsigSignedInfoType->Id.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignedInfoType->Id.charactersLen, xmldsigSignedInfoType->Id.characters, xmldsigSignedInfoType_Id_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 15 /* {}Id */, xmldsigSignedInfoType->Id.characters, xmldsigSignedInfoType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 15 /* {}Id */, &xmldsigSignedInfoType->Id.charactersLen, xmldsigSignedInfoType->Id.characters, xmldsigSignedInfoType_Id_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigSignedInfoType->Id_isUsed = 1u;
@@ -1496,9 +1980,39 @@ static int decode_xmldsigSignedInfoType(bitstream_t* stream, struct xmldsigSigne
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertiesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignatureProperty{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigSignaturePropertiesTypeProductions[3] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignaturePropertiesType, Id.characters), offsetof(struct xmldsigSignaturePropertiesType, Id.charactersLen), xmldsigSignaturePropertiesType_Id_CHARACTERS_SIZE, 15 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigSignaturePropertiesType_SignatureProperty_ARRAY_SIZE, offsetof(struct xmldsigSignaturePropertiesType, SignatureProperty.array), offsetof(struct xmldsigSignaturePropertiesType, SignatureProperty.arrayLen), sizeof(((struct xmldsigSignaturePropertiesType*)0)->SignatureProperty.array[0]), 0, 0, 0, 0, decode_xmldsigSignaturePropertyTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigSignaturePropertiesTypeTransitions[5] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t xmldsigSignaturePropertiesTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }
+};
+static void xmldsigSignaturePropertiesTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigSignaturePropertiesType* xmldsigSignaturePropertiesType = (struct xmldsigSignaturePropertiesType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigSignaturePropertiesType->Id_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigSignaturePropertiesTypeGrammar = { xmldsigSignaturePropertiesTypeStates, xmldsigSignaturePropertiesTypeTransitions, xmldsigSignaturePropertiesTypeProductions, xmldsigSignaturePropertiesTypeUsed };
+
+static int decode_xmldsigSignaturePropertiesType(bitstream_t* stream, struct xmldsigSignaturePropertiesType* xmldsigSignaturePropertiesType) {
+	init_xmldsigSignaturePropertiesType(xmldsigSignaturePropertiesType);
+	return decodeGrammar(stream, &xmldsigSignaturePropertiesTypeGrammar, xmldsigSignaturePropertiesType);
+}
+#else
 static int decode_xmldsigSignaturePropertiesType(bitstream_t* stream, struct xmldsigSignaturePropertiesType* xmldsigSignaturePropertiesType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 28;
 	int done = 0;
 	
@@ -1517,9 +2031,12 @@ static int decode_xmldsigSignaturePropertiesType(bitstream_t* stream, struct xml
 						if (xmldsigSignaturePropertiesType->Id.charactersLen >= 2) {
 							xmldsigSignaturePropertiesType->Id.charactersLen = (uint16_t)(xmldsigSignaturePropertiesType->Id.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignaturePropertiesType->Id.charactersLen, xmldsigSignaturePropertiesType->Id.characters, xmldsigSignaturePropertiesType_Id_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 15 /* {}Id */, xmldsigSignaturePropertiesType->Id.characters, xmldsigSignaturePropertiesType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 15 /* {}Id */, &xmldsigSignaturePropertiesType->Id.charactersLen, xmldsigSignaturePropertiesType->Id.characters, xmldsigSignaturePropertiesType_Id_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigSignaturePropertiesType->Id_isUsed = 1u;
@@ -1591,9 +2108,45 @@ static int decode_xmldsigSignaturePropertiesType(bitstream_t* stream, struct xml
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertyType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigSignaturePropertyTypeProductions[5] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignaturePropertyType, Id.characters), offsetof(struct xmldsigSignaturePropertyType, Id.charactersLen), xmldsigSignaturePropertyType_Id_CHARACTERS_SIZE, 15 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignaturePropertyType, Target.characters), offsetof(struct xmldsigSignaturePropertyType, Target.charactersLen), xmldsigSignaturePropertyType_Target_CHARACTERS_SIZE, 17 /* {}Target */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignaturePropertyType, ANY.characters), offsetof(struct xmldsigSignaturePropertyType, ANY.charactersLen), xmldsigSignaturePropertyType_ANY_CHARACTERS_SIZE, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigSignaturePropertyTypeTransitions[10] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 3, 2 }, { 0, 4 }, { 3, 3 },
+	{ 3, 2 }, { 4, 3 }
+};
+static const exi_grammar_state_t xmldsigSignaturePropertyTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 2, 2 }, { 5, 2, 3 }, { 8, 2, 2 }
+};
+static void xmldsigSignaturePropertyTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigSignaturePropertyType* xmldsigSignaturePropertyType = (struct xmldsigSignaturePropertyType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigSignaturePropertyType->Id_isUsed = 1u;
+		break;
+	case 1:
+		xmldsigSignaturePropertyType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigSignaturePropertyTypeGrammar = { xmldsigSignaturePropertyTypeStates, xmldsigSignaturePropertyTypeTransitions, xmldsigSignaturePropertyTypeProductions, xmldsigSignaturePropertyTypeUsed };
+
+static int decode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmldsigSignaturePropertyType* xmldsigSignaturePropertyType) {
+	init_xmldsigSignaturePropertyType(xmldsigSignaturePropertyType);
+	return decodeGrammar(stream, &xmldsigSignaturePropertyTypeGrammar, xmldsigSignaturePropertyType);
+}
+#else
 static int decode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmldsigSignaturePropertyType* xmldsigSignaturePropertyType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 31;
 	int done = 0;
 	
@@ -1612,9 +2165,12 @@ static int decode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 						if (xmldsigSignaturePropertyType->Id.charactersLen >= 2) {
 							xmldsigSignaturePropertyType->Id.charactersLen = (uint16_t)(xmldsigSignaturePropertyType->Id.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignaturePropertyType->Id.charactersLen, xmldsigSignaturePropertyType->Id.characters, xmldsigSignaturePropertyType_Id_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 15 /* {}Id */, xmldsigSignaturePropertyType->Id.characters, xmldsigSignaturePropertyType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 15 /* {}Id */, &xmldsigSignaturePropertyType->Id.charactersLen, xmldsigSignaturePropertyType->Id.characters, xmldsigSignaturePropertyType_Id_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigSignaturePropertyType->Id_isUsed = 1u;
@@ -1626,9 +2182,12 @@ static int decode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 						if (xmldsigSignaturePropertyType->Target.charactersLen >= 2) {
 							xmldsigSignaturePropertyType->Target.charactersLen = (uint16_t)(xmldsigSignaturePropertyType->Target.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignaturePropertyType->Target.charactersLen, xmldsigSignaturePropertyType->Target.characters, xmldsigSignaturePropertyType_Target_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 17 /* {}Target */, xmldsigSignaturePropertyType->Target.characters, xmldsigSignaturePropertyType->Target.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 17 /* {}Target */, &xmldsigSignaturePropertyType->Target.charactersLen, xmldsigSignaturePropertyType->Target.characters, xmldsigSignaturePropertyType_Target_CHARACTERS_SIZE);
 						}
 					}
 					grammarID = 33;
@@ -1650,9 +2209,12 @@ static int decode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 						if (xmldsigSignaturePropertyType->Target.charactersLen >= 2) {
 							xmldsigSignaturePropertyType->Target.charactersLen = (uint16_t)(xmldsigSignaturePropertyType->Target.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignaturePropertyType->Target.charactersLen, xmldsigSignaturePropertyType->Target.characters, xmldsigSignaturePropertyType_Target_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 17 /* {}Target */, xmldsigSignaturePropertyType->Target.characters, xmldsigSignaturePropertyType->Target.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 17 /* {}Target */, &xmldsigSignaturePropertyType->Target.charactersLen, xmldsigSignaturePropertyType->Target.characters, xmldsigSignaturePropertyType_Target_CHARACTERS_SIZE);
 						}
 					}
 					grammarID = 33;
@@ -1679,9 +2241,12 @@ static int decode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 						if (xmldsigSignaturePropertyType->ANY.charactersLen >= 2) {
 							xmldsigSignaturePropertyType->ANY.charactersLen = (uint16_t)(xmldsigSignaturePropertyType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignaturePropertyType->ANY.charactersLen, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &xmldsigSignaturePropertyType->ANY.charactersLen, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigSignaturePropertyType->ANY_isUsed = 1u;
@@ -1713,9 +2278,12 @@ static int decode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 						if (xmldsigSignaturePropertyType->ANY.charactersLen >= 2) {
 							xmldsigSignaturePropertyType->ANY.charactersLen = (uint16_t)(xmldsigSignaturePropertyType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignaturePropertyType->ANY.charactersLen, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &xmldsigSignaturePropertyType->ANY.charactersLen, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigSignaturePropertyType->ANY_isUsed = 1u;
@@ -1743,9 +2311,12 @@ static int decode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 						if (xmldsigSignaturePropertyType->ANY.charactersLen >= 2) {
 							xmldsigSignaturePropertyType->ANY.charactersLen = (uint16_t)(xmldsigSignaturePropertyType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignaturePropertyType->ANY.charactersLen, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, &xmldsigSignaturePropertyType->ANY.charactersLen, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigSignaturePropertyType->ANY_isUsed = 1u;
@@ -1767,9 +2338,48 @@ static int decode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyValueType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":DSAKeyValue|"http://www.w3.org/2000/09/xmldsig#":RSAKeyValue|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigKeyValueTypeProductions[5] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigKeyValueType, DSAKeyValue), 0, 0, 0, decode_xmldsigDSAKeyValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct xmldsigKeyValueType, RSAKeyValue), 0, 0, 0, decode_xmldsigRSAKeyValueTypeGeneric },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct xmldsigKeyValueType, ANY.characters), offsetof(struct xmldsigKeyValueType, ANY.charactersLen), xmldsigKeyValueType_ANY_CHARACTERS_SIZE, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigKeyValueTypeTransitions[10] = {
+	{ 1, 0 }, { 1, 1 }, { 1, 2 }, { 2, 3 }, { 0, 4 }, { 1, 3 }, { 1, 0 }, { 1, 1 },
+	{ 1, 2 }, { 2, 3 }
+};
+static const exi_grammar_state_t xmldsigKeyValueTypeStates[3] = {
+	{ 0, 3, 4 }, { 4, 2, 2 }, { 6, 3, 4 }
+};
+static void xmldsigKeyValueTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigKeyValueType* xmldsigKeyValueType = (struct xmldsigKeyValueType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigKeyValueType->DSAKeyValue_isUsed = 1u;
+		break;
+	case 1:
+		xmldsigKeyValueType->RSAKeyValue_isUsed = 1u;
+		break;
+	case 2:
+		xmldsigKeyValueType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigKeyValueTypeGrammar = { xmldsigKeyValueTypeStates, xmldsigKeyValueTypeTransitions, xmldsigKeyValueTypeProductions, xmldsigKeyValueTypeUsed };
+
 static int decode_xmldsigKeyValueType(bitstream_t* stream, struct xmldsigKeyValueType* xmldsigKeyValueType) {
+	init_xmldsigKeyValueType(xmldsigKeyValueType);
+	return decodeGrammar(stream, &xmldsigKeyValueTypeGrammar, xmldsigKeyValueType);
+}
+#else
+static int decode_xmldsigKeyValueType(bitstream_t* stream, struct xmldsigKeyValueType* xmldsigKeyValueType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 35;
 	int done = 0;
 	
@@ -1803,9 +2413,12 @@ static int decode_xmldsigKeyValueType(bitstream_t* stream, struct xmldsigKeyValu
 						if (xmldsigKeyValueType->ANY.charactersLen >= 2) {
 							xmldsigKeyValueType->ANY.charactersLen = (uint16_t)(xmldsigKeyValueType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigKeyValueType->ANY.charactersLen, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &xmldsigKeyValueType->ANY.charactersLen, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigKeyValueType->ANY_isUsed = 1u;
@@ -1832,9 +2445,12 @@ static int decode_xmldsigKeyValueType(bitstream_t* stream, struct xmldsigKeyValu
 						if (xmldsigKeyValueType->ANY.charactersLen >= 2) {
 							xmldsigKeyValueType->ANY.charactersLen = (uint16_t)(xmldsigKeyValueType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigKeyValueType->ANY.charactersLen, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &xmldsigKeyValueType->ANY.charactersLen, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigKeyValueType->ANY_isUsed = 1u;
@@ -1872,9 +2488,12 @@ static int decode_xmldsigKeyValueType(bitstream_t* stream, struct xmldsigKeyValu
 						if (xmldsigKeyValueType->ANY.charactersLen >= 2) {
 							xmldsigKeyValueType->ANY.charactersLen = (uint16_t)(xmldsigKeyValueType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigKeyValueType->ANY.charactersLen, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, &xmldsigKeyValueType->ANY.charactersLen, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigKeyValueType->ANY_isUsed = 1u;
@@ -1896,9 +2515,31 @@ static int decode_xmldsigKeyValueType(bitstream_t* stream, struct xmldsigKeyValu
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Modulus,"http://www.w3.org/2000/09/xmldsig#":Exponent)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigRSAKeyValueTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigRSAKeyValueType, Modulus.bytes), offsetof(struct xmldsigRSAKeyValueType, Modulus.bytesLen), xmldsigRSAKeyValueType_Modulus_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigRSAKeyValueType, Exponent.bytes), offsetof(struct xmldsigRSAKeyValueType, Exponent.bytesLen), xmldsigRSAKeyValueType_Exponent_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigRSAKeyValueTypeTransitions[3] = {
+	{ 1, 0 }, { 2, 1 }, { 0, 2 }
+};
+static const exi_grammar_state_t xmldsigRSAKeyValueTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 1, 1 }, { 2, 1, 1 }
+};
+static const exi_grammar_t xmldsigRSAKeyValueTypeGrammar = { xmldsigRSAKeyValueTypeStates, xmldsigRSAKeyValueTypeTransitions, xmldsigRSAKeyValueTypeProductions, NULL };
+
+static int decode_xmldsigRSAKeyValueType(bitstream_t* stream, struct xmldsigRSAKeyValueType* xmldsigRSAKeyValueType) {
+	init_xmldsigRSAKeyValueType(xmldsigRSAKeyValueType);
+	return decodeGrammar(stream, &xmldsigRSAKeyValueTypeGrammar, xmldsigRSAKeyValueType);
+}
+#else
 static int decode_xmldsigRSAKeyValueType(bitstream_t* stream, struct xmldsigRSAKeyValueType* xmldsigRSAKeyValueType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 38;
 	int done = 0;
 	
@@ -2007,9 +2648,43 @@ static int decode_xmldsigRSAKeyValueType(bitstream_t* stream, struct xmldsigRSAK
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,PGPDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":PGPKeyID,"http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})|("http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED}))',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigPGPDataTypeProductions[4] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigPGPDataType, PGPKeyID.bytes), offsetof(struct xmldsigPGPDataType, PGPKeyID.bytesLen), xmldsigPGPDataType_PGPKeyID_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct xmldsigPGPDataType, PGPKeyPacket.bytes), offsetof(struct xmldsigPGPDataType, PGPKeyPacket.bytesLen), xmldsigPGPDataType_PGPKeyPacket_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigPGPDataTypeTransitions[7] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 2, 2 }, { 0, 3 }, { 2, 2 }, { 0, 3 }
+};
+static const exi_grammar_state_t xmldsigPGPDataTypeStates[3] = {
+	{ 0, 2, 2 }, { 2, 2, 3 }, { 5, 2, 2 }
+};
+static void xmldsigPGPDataTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigPGPDataType* xmldsigPGPDataType = (struct xmldsigPGPDataType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigPGPDataType->PGPKeyID_isUsed = 1u;
+		break;
+	case 1:
+		xmldsigPGPDataType->PGPKeyPacket_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigPGPDataTypeGrammar = { xmldsigPGPDataTypeStates, xmldsigPGPDataTypeTransitions, xmldsigPGPDataTypeProductions, xmldsigPGPDataTypeUsed };
+
 static int decode_xmldsigPGPDataType(bitstream_t* stream, struct xmldsigPGPDataType* xmldsigPGPDataType) {
+	init_xmldsigPGPDataType(xmldsigPGPDataType);
+	return decodeGrammar(stream, &xmldsigPGPDataTypeGrammar, xmldsigPGPDataType);
+}
+#else
+static int decode_xmldsigPGPDataType(bitstream_t* stream, struct xmldsigPGPDataType* xmldsigPGPDataType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 40;
 	int done = 0;
 	
@@ -2162,9 +2837,30 @@ static int decode_xmldsigPGPDataType(bitstream_t* stream, struct xmldsigPGPDataT
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transform{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigTransformsTypeProductions[2] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigTransformsType_Transform_ARRAY_SIZE, offsetof(struct xmldsigTransformsType, Transform.array), offsetof(struct xmldsigTransformsType, Transform.arrayLen), sizeof(((struct xmldsigTransformsType*)0)->Transform.array[0]), 0, 0, 0, 0, decode_xmldsigTransformTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigTransformsTypeTransitions[3] = {
+	{ 1, 0 }, { 1, 0 }, { 0, 1 }
+};
+static const exi_grammar_state_t xmldsigTransformsTypeStates[2] = {
+	{ 0, 1, 1 }, { 1, 2, 2 }
+};
+static const exi_grammar_t xmldsigTransformsTypeGrammar = { xmldsigTransformsTypeStates, xmldsigTransformsTypeTransitions, xmldsigTransformsTypeProductions, NULL };
+
 static int decode_xmldsigTransformsType(bitstream_t* stream, struct xmldsigTransformsType* xmldsigTransformsType) {
+	init_xmldsigTransformsType(xmldsigTransformsType);
+	return decodeGrammar(stream, &xmldsigTransformsTypeGrammar, xmldsigTransformsType);
+}
+#else
+static int decode_xmldsigTransformsType(bitstream_t* stream, struct xmldsigTransformsType* xmldsigTransformsType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 43;
 	int done = 0;
 	
@@ -2224,9 +2920,36 @@ static int decode_xmldsigTransformsType(bitstream_t* stream, struct xmldsigTrans
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509DataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":X509IssuerSerial|"http://www.w3.org/2000/09/xmldsig#":X509SKI|"http://www.w3.org/2000/09/xmldsig#":X509SubjectName|"http://www.w3.org/2000/09/xmldsig#":X509Certificate|"http://www.w3.org/2000/09/xmldsig#":X509CRL|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigX509DataTypeProductions[7] = {
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigX509DataType_X509IssuerSerial_ARRAY_SIZE, offsetof(struct xmldsigX509DataType, X509IssuerSerial.array), offsetof(struct xmldsigX509DataType, X509IssuerSerial.arrayLen), sizeof(((struct xmldsigX509DataType*)0)->X509IssuerSerial.array[0]), 0, 0, 0, 0, decode_xmldsigX509IssuerSerialTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigX509DataType_X509SKI_ARRAY_SIZE, offsetof(struct xmldsigX509DataType, X509SKI.array), offsetof(struct xmldsigX509DataType, X509SKI.arrayLen), sizeof(((struct xmldsigX509DataType*)0)->X509SKI.array[0]), (offsetof(struct xmldsigX509DataType, X509SKI.array[0].bytes) - offsetof(struct xmldsigX509DataType, X509SKI.array)), (offsetof(struct xmldsigX509DataType, X509SKI.array[0].bytesLen) - offsetof(struct xmldsigX509DataType, X509SKI.array)), xmldsigX509DataType_X509SKI_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigX509DataType_X509SubjectName_ARRAY_SIZE, offsetof(struct xmldsigX509DataType, X509SubjectName.array), offsetof(struct xmldsigX509DataType, X509SubjectName.arrayLen), sizeof(((struct xmldsigX509DataType*)0)->X509SubjectName.array[0]), (offsetof(struct xmldsigX509DataType, X509SubjectName.array[0].characters) - offsetof(struct xmldsigX509DataType, X509SubjectName.array)), (offsetof(struct xmldsigX509DataType, X509SubjectName.array[0].charactersLen) - offsetof(struct xmldsigX509DataType, X509SubjectName.array)), xmldsigX509DataType_X509SubjectName_CHARACTERS_SIZE, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigX509DataType_X509Certificate_ARRAY_SIZE, offsetof(struct xmldsigX509DataType, X509Certificate.array), offsetof(struct xmldsigX509DataType, X509Certificate.arrayLen), sizeof(((struct xmldsigX509DataType*)0)->X509Certificate.array[0]), (offsetof(struct xmldsigX509DataType, X509Certificate.array[0].bytes) - offsetof(struct xmldsigX509DataType, X509Certificate.array)), (offsetof(struct xmldsigX509DataType, X509Certificate.array[0].bytesLen) - offsetof(struct xmldsigX509DataType, X509Certificate.array)), xmldsigX509DataType_X509Certificate_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigX509DataType_X509CRL_ARRAY_SIZE, offsetof(struct xmldsigX509DataType, X509CRL.array), offsetof(struct xmldsigX509DataType, X509CRL.arrayLen), sizeof(((struct xmldsigX509DataType*)0)->X509CRL.array[0]), (offsetof(struct xmldsigX509DataType, X509CRL.array[0].bytes) - offsetof(struct xmldsigX509DataType, X509CRL.array)), (offsetof(struct xmldsigX509DataType, X509CRL.array[0].bytesLen) - offsetof(struct xmldsigX509DataType, X509CRL.array)), xmldsigX509DataType_X509CRL_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigX509DataTypeTransitions[13] = {
+	{ 1, 0 }, { 1, 1 }, { 1, 2 }, { 1, 3 }, { 1, 4 }, { 1, 5 }, { 1, 0 }, { 1, 1 },
+	{ 1, 2 }, { 1, 3 }, { 1, 4 }, { 1, 5 }, { 0, 6 }
+};
+static const exi_grammar_state_t xmldsigX509DataTypeStates[2] = {
+	{ 0, 3, 6 }, { 6, 3, 7 }
+};
+static const exi_grammar_t xmldsigX509DataTypeGrammar = { xmldsigX509DataTypeStates, xmldsigX509DataTypeTransitions, xmldsigX509DataTypeProductions, NULL };
+
 static int decode_xmldsigX509DataType(bitstream_t* stream, struct xmldsigX509DataType* xmldsigX509DataType) {
+	init_xmldsigX509DataType(xmldsigX509DataType);
+	return decodeGrammar(stream, &xmldsigX509DataTypeGrammar, xmldsigX509DataType);
+}
+#else
+static int decode_xmldsigX509DataType(bitstream_t* stream, struct xmldsigX509DataType* xmldsigX509DataType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 45;
 	int done = 0;
 	
@@ -2290,9 +3013,12 @@ static int decode_xmldsigX509DataType(bitstream_t* stream, struct xmldsigX509Dat
 									if (xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].charactersLen >= 2) {
 										xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].charactersLen = (uint16_t)(xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].charactersLen - 2); /* string table miss */
 										errn = decodeCharacters(stream, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].charactersLen, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].characters, xmldsigX509DataType_X509SubjectName_CHARACTERS_SIZE);
+										if (errn == 0) {
+											errn = addStringValue(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].characters, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+										errn = decodeStringValueHit(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].charactersLen, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].characters, xmldsigX509DataType_X509SubjectName_CHARACTERS_SIZE);
 									}
 								}
 								xmldsigX509DataType->X509SubjectName.arrayLen++;
@@ -2445,9 +3171,12 @@ static int decode_xmldsigX509DataType(bitstream_t* stream, struct xmldsigX509Dat
 									if (xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].charactersLen >= 2) {
 										xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].charactersLen = (uint16_t)(xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].charactersLen - 2); /* string table miss */
 										errn = decodeCharacters(stream, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].charactersLen, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].characters, xmldsigX509DataType_X509SubjectName_CHARACTERS_SIZE);
+										if (errn == 0) {
+											errn = addStringValue(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].characters, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+										errn = decodeStringValueHit(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].charactersLen, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType->X509SubjectName.arrayLen].characters, xmldsigX509DataType_X509SubjectName_CHARACTERS_SIZE);
 									}
 								}
 								xmldsigX509DataType->X509SubjectName.arrayLen++;
@@ -2558,9 +3287,46 @@ static int decode_xmldsigX509DataType(bitstream_t* stream, struct xmldsigX509Dat
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignedInfo,"http://www.w3.org/2000/09/xmldsig#":SignatureValue,"http://www.w3.org/2000/09/xmldsig#":KeyInfo{0-1},"http://www.w3.org/2000/09/xmldsig#":Object{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigSignatureTypeProductions[6] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignatureType, Id.characters), offsetof(struct xmldsigSignatureType, Id.charactersLen), xmldsigSignatureType_Id_CHARACTERS_SIZE, 15 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignatureType, SignedInfo), 0, 0, 0, decode_xmldsigSignedInfoTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignatureType, SignatureValue), 0, 0, 0, decode_xmldsigSignatureValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct xmldsigSignatureType, KeyInfo), 0, 0, 0, decode_xmldsigKeyInfoTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigSignatureType_Object_ARRAY_SIZE, offsetof(struct xmldsigSignatureType, Object.array), offsetof(struct xmldsigSignatureType, Object.arrayLen), sizeof(((struct xmldsigSignatureType*)0)->Object.array[0]), 0, 0, 0, 0, decode_xmldsigObjectTypeGeneric },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigSignatureTypeTransitions[9] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 4, 4 }, { 0, 5 }, { 4, 4 },
+	{ 0, 5 }
+};
+static const exi_grammar_state_t xmldsigSignatureTypeStates[5] = {
+	{ 0, 2, 2 }, { 2, 1, 1 }, { 3, 1, 1 }, { 4, 2, 3 }, { 7, 2, 2 }
+};
+static void xmldsigSignatureTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigSignatureType* xmldsigSignatureType = (struct xmldsigSignatureType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigSignatureType->Id_isUsed = 1u;
+		break;
+	case 1:
+		xmldsigSignatureType->KeyInfo_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigSignatureTypeGrammar = { xmldsigSignatureTypeStates, xmldsigSignatureTypeTransitions, xmldsigSignatureTypeProductions, xmldsigSignatureTypeUsed };
+
+static int decode_xmldsigSignatureType(bitstream_t* stream, struct xmldsigSignatureType* xmldsigSignatureType) {
+	init_xmldsigSignatureType(xmldsigSignatureType);
+	return decodeGrammar(stream, &xmldsigSignatureTypeGrammar, xmldsigSignatureType);
+}
+#else
 static int decode_xmldsigSignatureType(bitstream_t* stream, struct xmldsigSignatureType* xmldsigSignatureType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 47;
 	int done = 0;
 	
@@ -2579,9 +3345,12 @@ static int decode_xmldsigSignatureType(bitstream_t* stream, struct xmldsigSignat
 						if (xmldsigSignatureType->Id.charactersLen >= 2) {
 							xmldsigSignatureType->Id.charactersLen = (uint16_t)(xmldsigSignatureType->Id.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigSignatureType->Id.charactersLen, xmldsigSignatureType->Id.characters, xmldsigSignatureType_Id_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 15 /* {}Id */, xmldsigSignatureType->Id.characters, xmldsigSignatureType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 15 /* {}Id */, &xmldsigSignatureType->Id.charactersLen, xmldsigSignatureType->Id.characters, xmldsigSignatureType_Id_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigSignatureType->Id_isUsed = 1u;
@@ -2688,9 +3457,60 @@ static int decode_xmldsigSignatureType(bitstream_t* stream, struct xmldsigSignat
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":P,"http://www.w3.org/2000/09/xmldsig#":Q){0-1},"http://www.w3.org/2000/09/xmldsig#":G{0-1},"http://www.w3.org/2000/09/xmldsig#":Y,"http://www.w3.org/2000/09/xmldsig#":J{0-1},("http://www.w3.org/2000/09/xmldsig#":Seed,"http://www.w3.org/2000/09/xmldsig#":PgenCounter){0-1})',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigDSAKeyValueTypeProductions[8] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigDSAKeyValueType, P.bytes), offsetof(struct xmldsigDSAKeyValueType, P.bytesLen), xmldsigDSAKeyValueType_P_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct xmldsigDSAKeyValueType, G.bytes), offsetof(struct xmldsigDSAKeyValueType, G.bytesLen), xmldsigDSAKeyValueType_G_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigDSAKeyValueType, Y.bytes), offsetof(struct xmldsigDSAKeyValueType, Y.bytesLen), xmldsigDSAKeyValueType_Y_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct xmldsigDSAKeyValueType, Q.bytes), offsetof(struct xmldsigDSAKeyValueType, Q.bytesLen), xmldsigDSAKeyValueType_Q_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct xmldsigDSAKeyValueType, J.bytes), offsetof(struct xmldsigDSAKeyValueType, J.bytesLen), xmldsigDSAKeyValueType_J_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 4, 0, 0, 0, 0, 0, offsetof(struct xmldsigDSAKeyValueType, Seed.bytes), offsetof(struct xmldsigDSAKeyValueType, Seed.bytesLen), xmldsigDSAKeyValueType_Seed_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, 5, 0, 0, 0, 0, 0, offsetof(struct xmldsigDSAKeyValueType, PgenCounter.bytes), offsetof(struct xmldsigDSAKeyValueType, PgenCounter.bytesLen), xmldsigDSAKeyValueType_PgenCounter_BYTES_SIZE, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigDSAKeyValueTypeTransitions[14] = {
+	{ 1, 0 }, { 3, 1 }, { 4, 2 }, { 2, 3 }, { 3, 1 }, { 4, 2 }, { 4, 2 }, { 5, 4 },
+	{ 6, 5 }, { 0, 6 }, { 6, 5 }, { 0, 6 }, { 7, 7 }, { 0, 6 }
+};
+static const exi_grammar_state_t xmldsigDSAKeyValueTypeStates[8] = {
+	{ 0, 2, 3 }, { 3, 1, 1 }, { 4, 2, 2 }, { 6, 1, 1 }, { 7, 2, 3 }, { 10, 2, 2 }, { 12, 1, 1 }, { 13, 1, 1 }
+};
+static void xmldsigDSAKeyValueTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigDSAKeyValueType* xmldsigDSAKeyValueType = (struct xmldsigDSAKeyValueType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigDSAKeyValueType->P_isUsed = 1u;
+		break;
+	case 1:
+		xmldsigDSAKeyValueType->G_isUsed = 1u;
+		break;
+	case 2:
+		xmldsigDSAKeyValueType->Q_isUsed = 1u;
+		break;
+	case 3:
+		xmldsigDSAKeyValueType->J_isUsed = 1u;
+		break;
+	case 4:
+		xmldsigDSAKeyValueType->Seed_isUsed = 1u;
+		break;
+	case 5:
+		xmldsigDSAKeyValueType->PgenCounter_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigDSAKeyValueTypeGrammar = { xmldsigDSAKeyValueTypeStates, xmldsigDSAKeyValueTypeTransitions, xmldsigDSAKeyValueTypeProductions, xmldsigDSAKeyValueTypeUsed };
+
+static int decode_xmldsigDSAKeyValueType(bitstream_t* stream, struct xmldsigDSAKeyValueType* xmldsigDSAKeyValueType) {
+	init_xmldsigDSAKeyValueType(xmldsigDSAKeyValueType);
+	return decodeGrammar(stream, &xmldsigDSAKeyValueTypeGrammar, xmldsigDSAKeyValueType);
+}
+#else
 static int decode_xmldsigDSAKeyValueType(bitstream_t* stream, struct xmldsigDSAKeyValueType* xmldsigDSAKeyValueType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 52;
 	int done = 0;
 	
@@ -3113,9 +3933,54 @@ static int decode_xmldsigDSAKeyValueType(bitstream_t* stream, struct xmldsigDSAK
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigReferenceTypeProductions[7] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigReferenceType, Id.characters), offsetof(struct xmldsigReferenceType, Id.charactersLen), xmldsigReferenceType_Id_CHARACTERS_SIZE, 15 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct xmldsigReferenceType, Type.characters), offsetof(struct xmldsigReferenceType, Type.charactersLen), xmldsigReferenceType_Type_CHARACTERS_SIZE, 18 /* {}Type */, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 2, 0, 0, 0, 0, 0, offsetof(struct xmldsigReferenceType, URI.characters), offsetof(struct xmldsigReferenceType, URI.charactersLen), xmldsigReferenceType_URI_CHARACTERS_SIZE, 19 /* {}URI */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, offsetof(struct xmldsigReferenceType, Transforms), 0, 0, 0, decode_xmldsigTransformsTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigReferenceType, DigestMethod), 0, 0, 0, decode_xmldsigDigestMethodTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, offsetof(struct xmldsigReferenceType, DigestValue.bytes), offsetof(struct xmldsigReferenceType, DigestValue.bytesLen), xmldsigReferenceType_DigestValue_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigReferenceTypeTransitions[17] = {
+	{ 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 2, 1 }, { 3, 2 }, { 4, 3 },
+	{ 5, 4 }, { 3, 2 }, { 4, 3 }, { 5, 4 }, { 4, 3 }, { 5, 4 }, { 5, 4 }, { 6, 5 },
+	{ 0, 6 }
+};
+static const exi_grammar_state_t xmldsigReferenceTypeStates[7] = {
+	{ 0, 3, 5 }, { 5, 3, 4 }, { 9, 2, 3 }, { 12, 2, 2 }, { 14, 1, 1 }, { 15, 1, 1 }, { 16, 1, 1 }
+};
+static void xmldsigReferenceTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigReferenceType* xmldsigReferenceType = (struct xmldsigReferenceType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigReferenceType->Id_isUsed = 1u;
+		break;
+	case 1:
+		xmldsigReferenceType->Type_isUsed = 1u;
+		break;
+	case 2:
+		xmldsigReferenceType->URI_isUsed = 1u;
+		break;
+	case 3:
+		xmldsigReferenceType->Transforms_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigReferenceTypeGrammar = { xmldsigReferenceTypeStates, xmldsigReferenceTypeTransitions, xmldsigReferenceTypeProductions, xmldsigReferenceTypeUsed };
+
 static int decode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigReferenceType* xmldsigReferenceType) {
+	init_xmldsigReferenceType(xmldsigReferenceType);
+	return decodeGrammar(stream, &xmldsigReferenceTypeGrammar, xmldsigReferenceType);
+}
+#else
+static int decode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigReferenceType* xmldsigReferenceType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 59;
 	int done = 0;
 	
@@ -3134,9 +3999,12 @@ static int decode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigRefere
 						if (xmldsigReferenceType->Id.charactersLen >= 2) {
 							xmldsigReferenceType->Id.charactersLen = (uint16_t)(xmldsigReferenceType->Id.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigReferenceType->Id.charactersLen, xmldsigReferenceType->Id.characters, xmldsigReferenceType_Id_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 15 /* {}Id */, xmldsigReferenceType->Id.characters, xmldsigReferenceType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 15 /* {}Id */, &xmldsigReferenceType->Id.charactersLen, xmldsigReferenceType->Id.characters, xmldsigReferenceType_Id_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigReferenceType->Id_isUsed = 1u;
@@ -3148,9 +4016,12 @@ static int decode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigRefere
 						if (xmldsigReferenceType->Type.charactersLen >= 2) {
 							xmldsigReferenceType->Type.charactersLen = (uint16_t)(xmldsigReferenceType->Type.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigReferenceType->Type.charactersLen, xmldsigReferenceType->Type.characters, xmldsigReferenceType_Type_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 18 /* {}Type */, xmldsigReferenceType->Type.characters, xmldsigReferenceType->Type.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 18 /* {}Type */, &xmldsigReferenceType->Type.charactersLen, xmldsigReferenceType->Type.characters, xmldsigReferenceType_Type_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigReferenceType->Type_isUsed = 1u;
@@ -3162,9 +4033,12 @@ static int decode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigRefere
 						if (xmldsigReferenceType->URI.charactersLen >= 2) {
 							xmldsigReferenceType->URI.charactersLen = (uint16_t)(xmldsigReferenceType->URI.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigReferenceType->URI.charactersLen, xmldsigReferenceType->URI.characters, xmldsigReferenceType_URI_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 19 /* {}URI */, xmldsigReferenceType->URI.characters, xmldsigReferenceType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 19 /* {}URI */, &xmldsigReferenceType->URI.charactersLen, xmldsigReferenceType->URI.characters, xmldsigReferenceType_URI_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigReferenceType->URI_isUsed = 1u;
@@ -3196,9 +4070,12 @@ static int decode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigRefere
 						if (xmldsigReferenceType->Type.charactersLen >= 2) {
 							xmldsigReferenceType->Type.charactersLen = (uint16_t)(xmldsigReferenceType->Type.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigReferenceType->Type.charactersLen, xmldsigReferenceType->Type.characters, xmldsigReferenceType_Type_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 18 /* {}Type */, xmldsigReferenceType->Type.characters, xmldsigReferenceType->Type.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 18 /* {}Type */, &xmldsigReferenceType->Type.charactersLen, xmldsigReferenceType->Type.characters, xmldsigReferenceType_Type_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigReferenceType->Type_isUsed = 1u;
@@ -3210,9 +4087,12 @@ static int decode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigRefere
 						if (xmldsigReferenceType->URI.charactersLen >= 2) {
 							xmldsigReferenceType->URI.charactersLen = (uint16_t)(xmldsigReferenceType->URI.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigReferenceType->URI.charactersLen, xmldsigReferenceType->URI.characters, xmldsigReferenceType_URI_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 19 /* {}URI */, xmldsigReferenceType->URI.characters, xmldsigReferenceType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 19 /* {}URI */, &xmldsigReferenceType->URI.charactersLen, xmldsigReferenceType->URI.characters, xmldsigReferenceType_URI_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigReferenceType->URI_isUsed = 1u;
@@ -3244,9 +4124,12 @@ static int decode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigRefere
 						if (xmldsigReferenceType->URI.charactersLen >= 2) {
 							xmldsigReferenceType->URI.charactersLen = (uint16_t)(xmldsigReferenceType->URI.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigReferenceType->URI.charactersLen, xmldsigReferenceType->URI.characters, xmldsigReferenceType_URI_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 19 /* {}URI */, xmldsigReferenceType->URI.characters, xmldsigReferenceType->URI.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 19 /* {}URI */, &xmldsigReferenceType->URI.charactersLen, xmldsigReferenceType->URI.characters, xmldsigReferenceType_URI_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigReferenceType->URI_isUsed = 1u;
@@ -3365,9 +4248,31 @@ static int decode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigRefere
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SPKIDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SPKISexp,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-1}){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigSPKIDataTypeProductions[3] = {
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_BYTES, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigSPKIDataType_SPKISexp_ARRAY_SIZE, offsetof(struct xmldsigSPKIDataType, SPKISexp.array), offsetof(struct xmldsigSPKIDataType, SPKISexp.arrayLen), sizeof(((struct xmldsigSPKIDataType*)0)->SPKISexp.array[0]), (offsetof(struct xmldsigSPKIDataType, SPKISexp.array[0].bytes) - offsetof(struct xmldsigSPKIDataType, SPKISexp.array)), (offsetof(struct xmldsigSPKIDataType, SPKISexp.array[0].bytesLen) - offsetof(struct xmldsigSPKIDataType, SPKISexp.array)), xmldsigSPKIDataType_SPKISexp_BYTES_SIZE, 0, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigSPKIDataTypeTransitions[6] = {
+	{ 1, 0 }, { 1, 0 }, { 2, 1 }, { 0, 2 }, { 1, 0 }, { 0, 2 }
+};
+static const exi_grammar_state_t xmldsigSPKIDataTypeStates[3] = {
+	{ 0, 1, 1 }, { 1, 2, 3 }, { 4, 2, 2 }
+};
+static const exi_grammar_t xmldsigSPKIDataTypeGrammar = { xmldsigSPKIDataTypeStates, xmldsigSPKIDataTypeTransitions, xmldsigSPKIDataTypeProductions, NULL };
+
 static int decode_xmldsigSPKIDataType(bitstream_t* stream, struct xmldsigSPKIDataType* xmldsigSPKIDataType) {
+	init_xmldsigSPKIDataType(xmldsigSPKIDataType);
+	return decodeGrammar(stream, &xmldsigSPKIDataTypeGrammar, xmldsigSPKIDataType);
+}
+#else
+static int decode_xmldsigSPKIDataType(bitstream_t* stream, struct xmldsigSPKIDataType* xmldsigSPKIDataType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 65;
 	int done = 0;
 	
@@ -3527,9 +4432,54 @@ static int decode_xmldsigSPKIDataType(bitstream_t* stream, struct xmldsigSPKIDat
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyInfoType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":KeyName|"http://www.w3.org/2000/09/xmldsig#":KeyValue|"http://www.w3.org/2000/09/xmldsig#":RetrievalMethod|"http://www.w3.org/2000/09/xmldsig#":X509Data|"http://www.w3.org/2000/09/xmldsig#":PGPData|"http://www.w3.org/2000/09/xmldsig#":SPKIData|"http://www.w3.org/2000/09/xmldsig#":MgmtData|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
+#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE
+static const exi_grammar_production_t xmldsigKeyInfoTypeProductions[11] = {
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 0, 0, 0, 0, 0, 0, offsetof(struct xmldsigKeyInfoType, Id.characters), offsetof(struct xmldsigKeyInfoType, Id.charactersLen), xmldsigKeyInfoType_Id_CHARACTERS_SIZE, 15 /* {}Id */, NULL },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigKeyInfoType_KeyName_ARRAY_SIZE, offsetof(struct xmldsigKeyInfoType, KeyName.array), offsetof(struct xmldsigKeyInfoType, KeyName.arrayLen), sizeof(((struct xmldsigKeyInfoType*)0)->KeyName.array[0]), (offsetof(struct xmldsigKeyInfoType, KeyName.array[0].characters) - offsetof(struct xmldsigKeyInfoType, KeyName.array)), (offsetof(struct xmldsigKeyInfoType, KeyName.array[0].charactersLen) - offsetof(struct xmldsigKeyInfoType, KeyName.array)), xmldsigKeyInfoType_KeyName_CHARACTERS_SIZE, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, NULL },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigKeyInfoType_KeyValue_ARRAY_SIZE, offsetof(struct xmldsigKeyInfoType, KeyValue.array), offsetof(struct xmldsigKeyInfoType, KeyValue.arrayLen), sizeof(((struct xmldsigKeyInfoType*)0)->KeyValue.array[0]), 0, 0, 0, 0, decode_xmldsigKeyValueTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigKeyInfoType_RetrievalMethod_ARRAY_SIZE, offsetof(struct xmldsigKeyInfoType, RetrievalMethod.array), offsetof(struct xmldsigKeyInfoType, RetrievalMethod.arrayLen), sizeof(((struct xmldsigKeyInfoType*)0)->RetrievalMethod.array[0]), 0, 0, 0, 0, decode_xmldsigRetrievalMethodTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigKeyInfoType_X509Data_ARRAY_SIZE, offsetof(struct xmldsigKeyInfoType, X509Data.array), offsetof(struct xmldsigKeyInfoType, X509Data.arrayLen), sizeof(((struct xmldsigKeyInfoType*)0)->X509Data.array[0]), 0, 0, 0, 0, decode_xmldsigX509DataTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigKeyInfoType_PGPData_ARRAY_SIZE, offsetof(struct xmldsigKeyInfoType, PGPData.array), offsetof(struct xmldsigKeyInfoType, PGPData.arrayLen), sizeof(((struct xmldsigKeyInfoType*)0)->PGPData.array[0]), 0, 0, 0, 0, decode_xmldsigPGPDataTypeGeneric },
+	{ EXI_GRAMMAR_COMPLEX, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigKeyInfoType_SPKIData_ARRAY_SIZE, offsetof(struct xmldsigKeyInfoType, SPKIData.array), offsetof(struct xmldsigKeyInfoType, SPKIData.arrayLen), sizeof(((struct xmldsigKeyInfoType*)0)->SPKIData.array[0]), 0, 0, 0, 0, decode_xmldsigSPKIDataTypeGeneric },
+	{ EXI_GRAMMAR_ELEMENT, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, xmldsigKeyInfoType_MgmtData_ARRAY_SIZE, offsetof(struct xmldsigKeyInfoType, MgmtData.array), offsetof(struct xmldsigKeyInfoType, MgmtData.arrayLen), sizeof(((struct xmldsigKeyInfoType*)0)->MgmtData.array[0]), (offsetof(struct xmldsigKeyInfoType, MgmtData.array[0].characters) - offsetof(struct xmldsigKeyInfoType, MgmtData.array)), (offsetof(struct xmldsigKeyInfoType, MgmtData.array[0].charactersLen) - offsetof(struct xmldsigKeyInfoType, MgmtData.array)), xmldsigKeyInfoType_MgmtData_CHARACTERS_SIZE, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, NULL },
+	{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS, 0, 0, 0, 0, 0, 0, 0, 0, NULL },
+	{ EXI_GRAMMAR_ATTRIBUTE, EXI_GRAMMAR_VALUE_STRING, 0, 0, 0, 1, 0, 0, 0, 0, 0, offsetof(struct xmldsigKeyInfoType, ANY.characters), offsetof(struct xmldsigKeyInfoType, ANY.charactersLen), xmldsigKeyInfoType_ANY_CHARACTERS_SIZE, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, NULL },
+	{ EXI_GRAMMAR_END_ELEMENT, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL }
+};
+static const exi_grammar_transition_t xmldsigKeyInfoTypeTransitions[38] = {
+	{ 1, 0 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 2, 4 }, { 2, 5 }, { 2, 6 }, { 2, 7 },
+	{ 2, 8 }, { 3, 9 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 2, 4 }, { 2, 5 }, { 2, 6 },
+	{ 2, 7 }, { 2, 8 }, { 3, 9 }, { 2, 1 }, { 2, 2 }, { 2, 3 }, { 2, 4 }, { 2, 5 },
+	{ 2, 6 }, { 2, 7 }, { 2, 8 }, { 0, 10 }, { 2, 9 }, { 2, 1 }, { 2, 2 }, { 2, 3 },
+	{ 2, 4 }, { 2, 5 }, { 2, 6 }, { 2, 7 }, { 2, 8 }, { 3, 9 }
+};
+static const exi_grammar_state_t xmldsigKeyInfoTypeStates[4] = {
+	{ 0, 4, 10 }, { 10, 4, 9 }, { 19, 4, 10 }, { 29, 4, 9 }
+};
+static void xmldsigKeyInfoTypeUsed(void* value, uint8_t flag) {
+	struct xmldsigKeyInfoType* xmldsigKeyInfoType = (struct xmldsigKeyInfoType*)value;
+	switch(flag) {
+	case 0:
+		xmldsigKeyInfoType->Id_isUsed = 1u;
+		break;
+	case 1:
+		xmldsigKeyInfoType->ANY_isUsed = 1u;
+		break;
+	}
+}
+static const exi_grammar_t xmldsigKeyInfoTypeGrammar = { xmldsigKeyInfoTypeStates, xmldsigKeyInfoTypeTransitions, xmldsigKeyInfoTypeProductions, xmldsigKeyInfoTypeUsed };
+
+static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoType* xmldsigKeyInfoType) {
+	init_xmldsigKeyInfoType(xmldsigKeyInfoType);
+	return decodeGrammar(stream, &xmldsigKeyInfoTypeGrammar, xmldsigKeyInfoType);
+}
+#else
 static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoType* xmldsigKeyInfoType) {
+	uint32_t eventCode;
+	int errn = 0;
 	int grammarID = 68;
 	int done = 0;
 	
@@ -3548,9 +4498,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 						if (xmldsigKeyInfoType->Id.charactersLen >= 2) {
 							xmldsigKeyInfoType->Id.charactersLen = (uint16_t)(xmldsigKeyInfoType->Id.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigKeyInfoType->Id.charactersLen, xmldsigKeyInfoType->Id.characters, xmldsigKeyInfoType_Id_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 15 /* {}Id */, xmldsigKeyInfoType->Id.characters, xmldsigKeyInfoType->Id.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 15 /* {}Id */, &xmldsigKeyInfoType->Id.charactersLen, xmldsigKeyInfoType->Id.characters, xmldsigKeyInfoType_Id_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigKeyInfoType->Id_isUsed = 1u;
@@ -3567,9 +4520,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 									if (xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen >= 2) {
 										xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen = (uint16_t)(xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen - 2); /* string table miss */
 										errn = decodeCharacters(stream, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].characters, xmldsigKeyInfoType_KeyName_CHARACTERS_SIZE);
+										if (errn == 0) {
+											errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].characters, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+										errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].characters, xmldsigKeyInfoType_KeyName_CHARACTERS_SIZE);
 									}
 								}
 								xmldsigKeyInfoType->KeyName.arrayLen++;
@@ -3642,9 +4598,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 									if (xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen >= 2) {
 										xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen = (uint16_t)(xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen - 2); /* string table miss */
 										errn = decodeCharacters(stream, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].characters, xmldsigKeyInfoType_MgmtData_CHARACTERS_SIZE);
+										if (errn == 0) {
+											errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].characters, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+										errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].characters, xmldsigKeyInfoType_MgmtData_CHARACTERS_SIZE);
 									}
 								}
 								xmldsigKeyInfoType->MgmtData.arrayLen++;
@@ -3677,9 +4636,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 						if (xmldsigKeyInfoType->ANY.charactersLen >= 2) {
 							xmldsigKeyInfoType->ANY.charactersLen = (uint16_t)(xmldsigKeyInfoType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigKeyInfoType->ANY.charactersLen, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &xmldsigKeyInfoType->ANY.charactersLen, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigKeyInfoType->ANY_isUsed = 1u;
@@ -3707,9 +4669,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 									if (xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen >= 2) {
 										xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen = (uint16_t)(xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen - 2); /* string table miss */
 										errn = decodeCharacters(stream, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].characters, xmldsigKeyInfoType_KeyName_CHARACTERS_SIZE);
+										if (errn == 0) {
+											errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].characters, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+										errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].characters, xmldsigKeyInfoType_KeyName_CHARACTERS_SIZE);
 									}
 								}
 								xmldsigKeyInfoType->KeyName.arrayLen++;
@@ -3782,9 +4747,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 									if (xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen >= 2) {
 										xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen = (uint16_t)(xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen - 2); /* string table miss */
 										errn = decodeCharacters(stream, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].characters, xmldsigKeyInfoType_MgmtData_CHARACTERS_SIZE);
+										if (errn == 0) {
+											errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].characters, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+										errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].characters, xmldsigKeyInfoType_MgmtData_CHARACTERS_SIZE);
 									}
 								}
 								xmldsigKeyInfoType->MgmtData.arrayLen++;
@@ -3817,9 +4785,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 						if (xmldsigKeyInfoType->ANY.charactersLen >= 2) {
 							xmldsigKeyInfoType->ANY.charactersLen = (uint16_t)(xmldsigKeyInfoType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigKeyInfoType->ANY.charactersLen, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &xmldsigKeyInfoType->ANY.charactersLen, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigKeyInfoType->ANY_isUsed = 1u;
@@ -3847,9 +4818,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 									if (xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen >= 2) {
 										xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen = (uint16_t)(xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen - 2); /* string table miss */
 										errn = decodeCharacters(stream, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].characters, xmldsigKeyInfoType_KeyName_CHARACTERS_SIZE);
+										if (errn == 0) {
+											errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].characters, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+										errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].characters, xmldsigKeyInfoType_KeyName_CHARACTERS_SIZE);
 									}
 								}
 								xmldsigKeyInfoType->KeyName.arrayLen++;
@@ -3922,9 +4896,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 									if (xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen >= 2) {
 										xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen = (uint16_t)(xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen - 2); /* string table miss */
 										errn = decodeCharacters(stream, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].characters, xmldsigKeyInfoType_MgmtData_CHARACTERS_SIZE);
+										if (errn == 0) {
+											errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].characters, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+										errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].characters, xmldsigKeyInfoType_MgmtData_CHARACTERS_SIZE);
 									}
 								}
 								xmldsigKeyInfoType->MgmtData.arrayLen++;
@@ -3961,9 +4938,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 						if (xmldsigKeyInfoType->ANY.charactersLen >= 2) {
 							xmldsigKeyInfoType->ANY.charactersLen = (uint16_t)(xmldsigKeyInfoType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigKeyInfoType->ANY.charactersLen, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &xmldsigKeyInfoType->ANY.charactersLen, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigKeyInfoType->ANY_isUsed = 1u;
@@ -3991,9 +4971,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 									if (xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen >= 2) {
 										xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen = (uint16_t)(xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen - 2); /* string table miss */
 										errn = decodeCharacters(stream, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].characters, xmldsigKeyInfoType_KeyName_CHARACTERS_SIZE);
+										if (errn == 0) {
+											errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].characters, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+										errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].charactersLen, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType->KeyName.arrayLen].characters, xmldsigKeyInfoType_KeyName_CHARACTERS_SIZE);
 									}
 								}
 								xmldsigKeyInfoType->KeyName.arrayLen++;
@@ -4066,9 +5049,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 									if (xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen >= 2) {
 										xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen = (uint16_t)(xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen - 2); /* string table miss */
 										errn = decodeCharacters(stream, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].characters, xmldsigKeyInfoType_MgmtData_CHARACTERS_SIZE);
+										if (errn == 0) {
+											errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].characters, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen);
+										}
 									} else {
 										/* string table hit */
-										errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+										errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].charactersLen, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType->MgmtData.arrayLen].characters, xmldsigKeyInfoType_MgmtData_CHARACTERS_SIZE);
 									}
 								}
 								xmldsigKeyInfoType->MgmtData.arrayLen++;
@@ -4101,9 +5087,12 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 						if (xmldsigKeyInfoType->ANY.charactersLen >= 2) {
 							xmldsigKeyInfoType->ANY.charactersLen = (uint16_t)(xmldsigKeyInfoType->ANY.charactersLen - 2); /* string table miss */
 							errn = decodeCharacters(stream, xmldsigKeyInfoType->ANY.charactersLen, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType_ANY_CHARACTERS_SIZE);
+							if (errn == 0) {
+								errn = addStringValue(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType->ANY.charactersLen);
+							}
 						} else {
 							/* string table hit */
-							errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							errn = decodeStringValueHit(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, &xmldsigKeyInfoType->ANY.charactersLen, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType_ANY_CHARACTERS_SIZE);
 						}
 					}
 					xmldsigKeyInfoType->ANY_isUsed = 1u;
@@ -4125,11 +5114,15 @@ static int decode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 	}
 	return errn;
 }
+#endif /* GRAMMAR_DECODER_TABLE */
 
 
 
 
 int decode_xmldsigExiDocument(bitstream_t* stream, struct xmldsigEXIDocument* exiDoc) {
+	uint32_t eventCode;
+	int errn = 0;
+	uint32_t uint32;
 	errn = readEXIHeader(stream);
 
 	if(errn == 0) {
@@ -4189,9 +5182,12 @@ int decode_xmldsigExiDocument(bitstream_t* stream, struct xmldsigEXIDocument* ex
 							if (exiDoc->KeyName.charactersLen >= 2) {
 								exiDoc->KeyName.charactersLen = (uint16_t)(exiDoc->KeyName.charactersLen - 2); /* string table miss */
 								errn = decodeCharacters(stream, exiDoc->KeyName.charactersLen, exiDoc->KeyName.characters, EXIDocument_KeyName_CHARACTERS_SIZE);
+								if (errn == 0) {
+									errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiDoc->KeyName.characters, exiDoc->KeyName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+								errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &exiDoc->KeyName.charactersLen, exiDoc->KeyName.characters, EXIDocument_KeyName_CHARACTERS_SIZE);
 							}
 						}
 						exiDoc->KeyName_isUsed = 1u;
@@ -4222,9 +5218,12 @@ int decode_xmldsigExiDocument(bitstream_t* stream, struct xmldsigEXIDocument* ex
 							if (exiDoc->MgmtData.charactersLen >= 2) {
 								exiDoc->MgmtData.charactersLen = (uint16_t)(exiDoc->MgmtData.charactersLen - 2); /* string table miss */
 								errn = decodeCharacters(stream, exiDoc->MgmtData.charactersLen, exiDoc->MgmtData.characters, EXIDocument_MgmtData_CHARACTERS_SIZE);
+								if (errn == 0) {
+									errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiDoc->MgmtData.characters, exiDoc->MgmtData.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+								errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &exiDoc->MgmtData.charactersLen, exiDoc->MgmtData.characters, EXIDocument_MgmtData_CHARACTERS_SIZE);
 							}
 						}
 						exiDoc->MgmtData_isUsed = 1u;
@@ -4326,6 +5325,8 @@ int decode_xmldsigExiDocument(bitstream_t* stream, struct xmldsigEXIDocument* ex
 
 #if DEPLOY_XMLDSIG_CODEC_FRAGMENT == SUPPORT_YES
 int decode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* exiFrag) {
+	uint32_t eventCode;
+	int errn = 0;
 	errn = readEXIHeader(stream);
 
 	if(errn == 0) {
@@ -4459,9 +5460,12 @@ int decode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* ex
 							if (exiFrag->KeyName.charactersLen >= 2) {
 								exiFrag->KeyName.charactersLen = (uint16_t)(exiFrag->KeyName.charactersLen - 2); /* string table miss */
 								errn = decodeCharacters(stream, exiFrag->KeyName.charactersLen, exiFrag->KeyName.characters, EXIFragment_KeyName_CHARACTERS_SIZE);
+								if (errn == 0) {
+									errn = addStringValue(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiFrag->KeyName.characters, exiFrag->KeyName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+								errn = decodeStringValueHit(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, &exiFrag->KeyName.charactersLen, exiFrag->KeyName.characters, EXIFragment_KeyName_CHARACTERS_SIZE);
 							}
 						}
 						exiFrag->KeyName_isUsed = 1u;
@@ -4492,9 +5496,12 @@ int decode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* ex
 							if (exiFrag->MgmtData.charactersLen >= 2) {
 								exiFrag->MgmtData.charactersLen = (uint16_t)(exiFrag->MgmtData.charactersLen - 2); /* string table miss */
 								errn = decodeCharacters(stream, exiFrag->MgmtData.charactersLen, exiFrag->MgmtData.characters, EXIFragment_MgmtData_CHARACTERS_SIZE);
+								if (errn == 0) {
+									errn = addStringValue(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiFrag->MgmtData.characters, exiFrag->MgmtData.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+								errn = decodeStringValueHit(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, &exiFrag->MgmtData.charactersLen, exiFrag->MgmtData.characters, EXIFragment_MgmtData_CHARACTERS_SIZE);
 							}
 						}
 						exiFrag->MgmtData_isUsed = 1u;
@@ -4774,9 +5781,12 @@ int decode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* ex
 							if (exiFrag->X509IssuerName.charactersLen >= 2) {
 								exiFrag->X509IssuerName.charactersLen = (uint16_t)(exiFrag->X509IssuerName.charactersLen - 2); /* string table miss */
 								errn = decodeCharacters(stream, exiFrag->X509IssuerName.charactersLen, exiFrag->X509IssuerName.characters, EXIFragment_X509IssuerName_CHARACTERS_SIZE);
+								if (errn == 0) {
+									errn = addStringValue(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, exiFrag->X509IssuerName.characters, exiFrag->X509IssuerName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+								errn = decodeStringValueHit(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, &exiFrag->X509IssuerName.charactersLen, exiFrag->X509IssuerName.characters, EXIFragment_X509IssuerName_CHARACTERS_SIZE);
 							}
 						}
 						exiFrag->X509IssuerName_isUsed = 1u;
@@ -4836,9 +5846,12 @@ int decode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* ex
 							if (exiFrag->X509SubjectName.charactersLen >= 2) {
 								exiFrag->X509SubjectName.charactersLen = (uint16_t)(exiFrag->X509SubjectName.charactersLen - 2); /* string table miss */
 								errn = decodeCharacters(stream, exiFrag->X509SubjectName.charactersLen, exiFrag->X509SubjectName.characters, EXIFragment_X509SubjectName_CHARACTERS_SIZE);
+								if (errn == 0) {
+									errn = addStringValue(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, exiFrag->X509SubjectName.characters, exiFrag->X509SubjectName.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+								errn = decodeStringValueHit(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, &exiFrag->X509SubjectName.charactersLen, exiFrag->X509SubjectName.characters, EXIFragment_X509SubjectName_CHARACTERS_SIZE);
 							}
 						}
 						exiFrag->X509SubjectName_isUsed = 1u;
@@ -4859,9 +5872,12 @@ int decode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* ex
 							if (exiFrag->XPath.charactersLen >= 2) {
 								exiFrag->XPath.charactersLen = (uint16_t)(exiFrag->XPath.charactersLen - 2); /* string table miss */
 								errn = decodeCharacters(stream, exiFrag->XPath.charactersLen, exiFrag->XPath.characters, EXIFragment_XPath_CHARACTERS_SIZE);
+								if (errn == 0) {
+									errn = addStringValue(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, exiFrag->XPath.characters, exiFrag->XPath.charactersLen);
+								}
 							} else {
 								/* string table hit */
-								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+								errn = decodeStringValueHit(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, &exiFrag->XPath.charactersLen, exiFrag->XPath.characters, EXIFragment_XPath_CHARACTERS_SIZE);
 							}
 						}
 						exiFrag->XPath_isUsed = 1u;
@@ -34,6 +34,7 @@
 
 #include "EncoderChannel.h"
 #include "EXIHeaderEncoder.h"
+#include "Sha256.h"
 
 #include "xmldsigEXIDatatypes.h"
 #include "ErrorCodes.h"
@@ -43,8 +44,7 @@
 
 #if DEPLOY_XMLDSIG_CODEC == SUPPORT_YES
 
-static int errn;
-
+/* Note: errn is a local of each encode function (reentrant encoding) */
 /* Forward Declarations */
 static int encode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct xmldsigCanonicalizationMethodType* xmldsigCanonicalizationMethodType);
 static int encode_xmldsigManifestType(bitstream_t* stream, struct xmldsigManifestType* xmldsigManifestType);
@@ -72,6 +72,7 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,CanonicalizationMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct xmldsigCanonicalizationMethodType* xmldsigCanonicalizationMethodType) {
+	int errn = 0;
 	int grammarID = 0;
 	int done = 0;
 	int wcDone = 0;
@@ -84,11 +85,8 @@ static int encode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigCanonicalizationMethodType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigCanonicalizationMethodType->Algorithm.characters, xmldsigCanonicalizationMethodType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 13 /* {}Algorithm */, xmldsigCanonicalizationMethodType->Algorithm.characters, xmldsigCanonicalizationMethodType->Algorithm.charactersLen);
 				}
 				grammarID = 1;
 			} else {
@@ -109,11 +107,8 @@ static int encode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct
 			} else 			if ( xmldsigCanonicalizationMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigCanonicalizationMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigCanonicalizationMethodType->ANY.characters, xmldsigCanonicalizationMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, xmldsigCanonicalizationMethodType->ANY.characters, xmldsigCanonicalizationMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 2;
@@ -135,11 +130,8 @@ static int encode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct
 			} else 			if ( xmldsigCanonicalizationMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigCanonicalizationMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigCanonicalizationMethodType->ANY.characters, xmldsigCanonicalizationMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 0 /* {http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod */, xmldsigCanonicalizationMethodType->ANY.characters, xmldsigCanonicalizationMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 2;
@@ -160,6 +152,7 @@ static int encode_xmldsigCanonicalizationMethodType(bitstream_t* stream, struct
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ManifestType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigManifestType(bitstream_t* stream, struct xmldsigManifestType* xmldsigManifestType) {
+	int errn = 0;
 	int grammarID = 4;
 	int done = 0;
 	
@@ -172,11 +165,8 @@ static int encode_xmldsigManifestType(bitstream_t* stream, struct xmldsigManifes
 			if ( xmldsigManifestType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigManifestType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigManifestType->Id.characters, xmldsigManifestType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {}Id */, xmldsigManifestType->Id.characters, xmldsigManifestType->Id.charactersLen);
 				}
 				grammarID = 5;
 			} else 			if (xmldsigManifestType_Reference_currArrayIndex < xmldsigManifestType->Reference.arrayLen ) {
@@ -232,6 +222,7 @@ static int encode_xmldsigManifestType(bitstream_t* stream, struct xmldsigManifes
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ObjectType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##any])){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectType* xmldsigObjectType) {
+	int errn = 0;
 	int grammarID = 7;
 	int done = 0;
 	int wcDone = 0;
@@ -244,31 +235,22 @@ static int encode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 			if ( xmldsigObjectType->Encoding_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigObjectType->Encoding.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigObjectType->Encoding.characters, xmldsigObjectType->Encoding.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 14 /* {}Encoding */, xmldsigObjectType->Encoding.characters, xmldsigObjectType->Encoding.charactersLen);
 				}
 				grammarID = 8;
 			} else 			if ( xmldsigObjectType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigObjectType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigObjectType->Id.characters, xmldsigObjectType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {}Id */, xmldsigObjectType->Id.characters, xmldsigObjectType->Id.charactersLen);
 				}
 				grammarID = 9;
 			} else 			if ( xmldsigObjectType->MimeType_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigObjectType->MimeType.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigObjectType->MimeType.characters, xmldsigObjectType->MimeType.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 16 /* {}MimeType */, xmldsigObjectType->MimeType.characters, xmldsigObjectType->MimeType.charactersLen);
 				}
 				grammarID = 1;
 			} else 			if (1==0) {
@@ -283,11 +265,8 @@ static int encode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 			} else 			if ( xmldsigObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 5);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 2;
@@ -300,21 +279,15 @@ static int encode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 			if ( xmldsigObjectType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigObjectType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigObjectType->Id.characters, xmldsigObjectType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {}Id */, xmldsigObjectType->Id.characters, xmldsigObjectType->Id.charactersLen);
 				}
 				grammarID = 9;
 			} else 			if ( xmldsigObjectType->MimeType_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigObjectType->MimeType.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigObjectType->MimeType.characters, xmldsigObjectType->MimeType.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 16 /* {}MimeType */, xmldsigObjectType->MimeType.characters, xmldsigObjectType->MimeType.charactersLen);
 				}
 				grammarID = 1;
 			} else 			if (1==0) {
@@ -329,11 +302,8 @@ static int encode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 			} else 			if ( xmldsigObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 4);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 2;
@@ -346,11 +316,8 @@ static int encode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 			if ( xmldsigObjectType->MimeType_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigObjectType->MimeType.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigObjectType->MimeType.characters, xmldsigObjectType->MimeType.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 16 /* {}MimeType */, xmldsigObjectType->MimeType.characters, xmldsigObjectType->MimeType.charactersLen);
 				}
 				grammarID = 1;
 			} else 			if (1==0) {
@@ -365,11 +332,8 @@ static int encode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 			} else 			if ( xmldsigObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 2;
@@ -391,11 +355,8 @@ static int encode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 			} else 			if ( xmldsigObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 2;
@@ -417,11 +378,8 @@ static int encode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 			} else 			if ( xmldsigObjectType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigObjectType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 6 /* {http://www.w3.org/2000/09/xmldsig#}Object */, xmldsigObjectType->ANY.characters, xmldsigObjectType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 2;
@@ -442,6 +400,7 @@ static int encode_xmldsigObjectType(bitstream_t* stream, struct xmldsigObjectTyp
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])|"http://www.w3.org/2000/09/xmldsig#":XPath){0-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransformType* xmldsigTransformType) {
+	int errn = 0;
 	int grammarID = 10;
 	int done = 0;
 	int wcDone = 0;
@@ -455,11 +414,8 @@ static int encode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransf
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigTransformType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigTransformType->Algorithm.characters, xmldsigTransformType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 13 /* {}Algorithm */, xmldsigTransformType->Algorithm.characters, xmldsigTransformType->Algorithm.charactersLen);
 				}
 				grammarID = 11;
 			} else {
@@ -474,10 +430,9 @@ static int encode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransf
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigTransformType->XPath.array[xmldsigTransformType_XPath_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, xmldsigTransformType->XPath.array[xmldsigTransformType_XPath_currArrayIndex].characters, xmldsigTransformType->XPath.array[xmldsigTransformType_XPath_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigTransformType->XPath.array[xmldsigTransformType_XPath_currArrayIndex].characters, xmldsigTransformType->XPath.array[xmldsigTransformType_XPath_currArrayIndex].charactersLen);
 							xmldsigTransformType_XPath_currArrayIndex++;
 						}
 						/* valid EE */
@@ -497,11 +452,8 @@ static int encode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransf
 			} else 			if ( xmldsigTransformType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigTransformType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigTransformType->ANY.characters, xmldsigTransformType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, xmldsigTransformType->ANY.characters, xmldsigTransformType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 12;
@@ -517,10 +469,9 @@ static int encode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransf
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigTransformType->XPath.array[xmldsigTransformType_XPath_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, xmldsigTransformType->XPath.array[xmldsigTransformType_XPath_currArrayIndex].characters, xmldsigTransformType->XPath.array[xmldsigTransformType_XPath_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigTransformType->XPath.array[xmldsigTransformType_XPath_currArrayIndex].characters, xmldsigTransformType->XPath.array[xmldsigTransformType_XPath_currArrayIndex].charactersLen);
 							xmldsigTransformType_XPath_currArrayIndex++;
 						}
 						/* valid EE */
@@ -540,11 +491,8 @@ static int encode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransf
 			} else 			if ( xmldsigTransformType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigTransformType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigTransformType->ANY.characters, xmldsigTransformType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 9 /* {http://www.w3.org/2000/09/xmldsig#}Transform */, xmldsigTransformType->ANY.characters, xmldsigTransformType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 12;
@@ -565,6 +513,7 @@ static int encode_xmldsigTransformType(bitstream_t* stream, struct xmldsigTransf
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":HMACOutputLength{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsigSignatureMethodType* xmldsigSignatureMethodType) {
+	int errn = 0;
 	int grammarID = 13;
 	int done = 0;
 	int wcDone = 0;
@@ -577,11 +526,8 @@ static int encode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsig
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignatureMethodType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignatureMethodType->Algorithm.characters, xmldsigSignatureMethodType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 13 /* {}Algorithm */, xmldsigSignatureMethodType->Algorithm.characters, xmldsigSignatureMethodType->Algorithm.charactersLen);
 				}
 				grammarID = 14;
 			} else {
@@ -614,11 +560,8 @@ static int encode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsig
 			} else 			if ( xmldsigSignatureMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignatureMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 15;
@@ -640,11 +583,8 @@ static int encode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsig
 			} else 			if ( xmldsigSignatureMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignatureMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 2;
@@ -678,11 +618,8 @@ static int encode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsig
 			} else 			if ( xmldsigSignatureMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignatureMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 7 /* {http://www.w3.org/2000/09/xmldsig#}SignatureMethod */, xmldsigSignatureMethodType->ANY.characters, xmldsigSignatureMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 15;
@@ -703,6 +640,7 @@ static int encode_xmldsigSignatureMethodType(bitstream_t* stream, struct xmldsig
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DigestMethodType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigDigestMethodType(bitstream_t* stream, struct xmldsigDigestMethodType* xmldsigDigestMethodType) {
+	int errn = 0;
 	int grammarID = 0;
 	int done = 0;
 	int wcDone = 0;
@@ -715,11 +653,8 @@ static int encode_xmldsigDigestMethodType(bitstream_t* stream, struct xmldsigDig
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigDigestMethodType->Algorithm.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigDigestMethodType->Algorithm.characters, xmldsigDigestMethodType->Algorithm.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 13 /* {}Algorithm */, xmldsigDigestMethodType->Algorithm.characters, xmldsigDigestMethodType->Algorithm.charactersLen);
 				}
 				grammarID = 1;
 			} else {
@@ -740,11 +675,8 @@ static int encode_xmldsigDigestMethodType(bitstream_t* stream, struct xmldsigDig
 			} else 			if ( xmldsigDigestMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigDigestMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigDigestMethodType->ANY.characters, xmldsigDigestMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, xmldsigDigestMethodType->ANY.characters, xmldsigDigestMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 2;
@@ -766,11 +698,8 @@ static int encode_xmldsigDigestMethodType(bitstream_t* stream, struct xmldsigDig
 			} else 			if ( xmldsigDigestMethodType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigDigestMethodType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigDigestMethodType->ANY.characters, xmldsigDigestMethodType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 1 /* {http://www.w3.org/2000/09/xmldsig#}DigestMethod */, xmldsigDigestMethodType->ANY.characters, xmldsigDigestMethodType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 2;
@@ -791,6 +720,7 @@ static int encode_xmldsigDigestMethodType(bitstream_t* stream, struct xmldsigDig
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RetrievalMethodType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigRetrievalMethodType(bitstream_t* stream, struct xmldsigRetrievalMethodType* xmldsigRetrievalMethodType) {
+	int errn = 0;
 	int grammarID = 16;
 	int done = 0;
 	
@@ -802,21 +732,15 @@ static int encode_xmldsigRetrievalMethodType(bitstream_t* stream, struct xmldsig
 			if ( xmldsigRetrievalMethodType->Type_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigRetrievalMethodType->Type.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigRetrievalMethodType->Type.characters, xmldsigRetrievalMethodType->Type.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 18 /* {}Type */, xmldsigRetrievalMethodType->Type.characters, xmldsigRetrievalMethodType->Type.charactersLen);
 				}
 				grammarID = 17;
 			} else 			if ( xmldsigRetrievalMethodType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigRetrievalMethodType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigRetrievalMethodType->URI.characters, xmldsigRetrievalMethodType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 19 /* {}URI */, xmldsigRetrievalMethodType->URI.characters, xmldsigRetrievalMethodType->URI.charactersLen);
 				}
 				grammarID = 18;
 			} else 			if ( xmldsigRetrievalMethodType->Transforms_isUsed == 1u ) {
@@ -840,11 +764,8 @@ static int encode_xmldsigRetrievalMethodType(bitstream_t* stream, struct xmldsig
 			if ( xmldsigRetrievalMethodType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigRetrievalMethodType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigRetrievalMethodType->URI.characters, xmldsigRetrievalMethodType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 19 /* {}URI */, xmldsigRetrievalMethodType->URI.characters, xmldsigRetrievalMethodType->URI.charactersLen);
 				}
 				grammarID = 18;
 			} else 			if ( xmldsigRetrievalMethodType->Transforms_isUsed == 1u ) {
@@ -906,6 +827,7 @@ static int encode_xmldsigRetrievalMethodType(bitstream_t* stream, struct xmldsig
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureValueType',  base type name='base64Binary',  content type='SIMPLE',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  derivedBy='EXTENSION'.  */
 static int encode_xmldsigSignatureValueType(bitstream_t* stream, struct xmldsigSignatureValueType* xmldsigSignatureValueType) {
+	int errn = 0;
 	int grammarID = 20;
 	int done = 0;
 	
@@ -917,11 +839,8 @@ static int encode_xmldsigSignatureValueType(bitstream_t* stream, struct xmldsigS
 			if ( xmldsigSignatureValueType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignatureValueType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignatureValueType->Id.characters, xmldsigSignatureValueType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {}Id */, xmldsigSignatureValueType->Id.characters, xmldsigSignatureValueType->Id.charactersLen);
 				}
 				grammarID = 21;
 			} else 			if (1==1) {
@@ -977,6 +896,7 @@ static int encode_xmldsigSignatureValueType(bitstream_t* stream, struct xmldsigS
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509IssuerSerialType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":X509IssuerName,"http://www.w3.org/2000/09/xmldsig#":X509SerialNumber)',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigX509IssuerSerialType(bitstream_t* stream, struct xmldsigX509IssuerSerialType* xmldsigX509IssuerSerialType) {
+	int errn = 0;
 	int grammarID = 22;
 	int done = 0;
 	
@@ -991,11 +911,8 @@ static int encode_xmldsigX509IssuerSerialType(bitstream_t* stream, struct xmldsi
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigX509IssuerSerialType->X509IssuerName.charactersLen + 2));
-						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigX509IssuerSerialType->X509IssuerName.characters, xmldsigX509IssuerSerialType->X509IssuerName.charactersLen);
-						}
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, xmldsigX509IssuerSerialType->X509IssuerName.characters, xmldsigX509IssuerSerialType->X509IssuerName.charactersLen);
 						/* valid EE */
 						errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					}
@@ -1048,6 +965,7 @@ static int encode_xmldsigX509IssuerSerialType(bitstream_t* stream, struct xmldsi
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignedInfoType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":CanonicalizationMethod,"http://www.w3.org/2000/09/xmldsig#":SignatureMethod,"http://www.w3.org/2000/09/xmldsig#":Reference{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigSignedInfoType(bitstream_t* stream, struct xmldsigSignedInfoType* xmldsigSignedInfoType) {
+	int errn = 0;
 	int grammarID = 24;
 	int done = 0;
 	
@@ -1060,11 +978,8 @@ static int encode_xmldsigSignedInfoType(bitstream_t* stream, struct xmldsigSigne
 			if ( xmldsigSignedInfoType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignedInfoType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignedInfoType->Id.characters, xmldsigSignedInfoType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {}Id */, xmldsigSignedInfoType->Id.characters, xmldsigSignedInfoType->Id.charactersLen);
 				}
 				grammarID = 25;
 			} else 			if ( 1 == 1 ) {
@@ -1144,6 +1059,7 @@ static int encode_xmldsigSignedInfoType(bitstream_t* stream, struct xmldsigSigne
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertiesType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignatureProperty{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigSignaturePropertiesType(bitstream_t* stream, struct xmldsigSignaturePropertiesType* xmldsigSignaturePropertiesType) {
+	int errn = 0;
 	int grammarID = 28;
 	int done = 0;
 	
@@ -1156,11 +1072,8 @@ static int encode_xmldsigSignaturePropertiesType(bitstream_t* stream, struct xml
 			if ( xmldsigSignaturePropertiesType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignaturePropertiesType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignaturePropertiesType->Id.characters, xmldsigSignaturePropertiesType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {}Id */, xmldsigSignaturePropertiesType->Id.characters, xmldsigSignaturePropertiesType->Id.charactersLen);
 				}
 				grammarID = 29;
 			} else 			if (xmldsigSignaturePropertiesType_SignatureProperty_currArrayIndex < xmldsigSignaturePropertiesType->SignatureProperty.arrayLen ) {
@@ -1216,6 +1129,7 @@ static int encode_xmldsigSignaturePropertiesType(bitstream_t* stream, struct xml
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignaturePropertyType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='((WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmldsigSignaturePropertyType* xmldsigSignaturePropertyType) {
+	int errn = 0;
 	int grammarID = 31;
 	int done = 0;
 	int wcDone = 0;
@@ -1228,21 +1142,15 @@ static int encode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 			if ( xmldsigSignaturePropertyType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignaturePropertyType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignaturePropertyType->Id.characters, xmldsigSignaturePropertyType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {}Id */, xmldsigSignaturePropertyType->Id.characters, xmldsigSignaturePropertyType->Id.charactersLen);
 				}
 				grammarID = 32;
 			} else 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignaturePropertyType->Target.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignaturePropertyType->Target.characters, xmldsigSignaturePropertyType->Target.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 17 /* {}Target */, xmldsigSignaturePropertyType->Target.characters, xmldsigSignaturePropertyType->Target.charactersLen);
 				}
 				grammarID = 33;
 			} else {
@@ -1254,11 +1162,8 @@ static int encode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 			if (1==1) {
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignaturePropertyType->Target.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignaturePropertyType->Target.characters, xmldsigSignaturePropertyType->Target.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 17 /* {}Target */, xmldsigSignaturePropertyType->Target.characters, xmldsigSignaturePropertyType->Target.charactersLen);
 				}
 				grammarID = 33;
 			} else {
@@ -1273,11 +1178,8 @@ static int encode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 			} else 			if ( xmldsigSignaturePropertyType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignaturePropertyType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 34;
@@ -1299,11 +1201,8 @@ static int encode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 			} else 			if ( xmldsigSignaturePropertyType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignaturePropertyType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 2;
@@ -1319,11 +1218,8 @@ static int encode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 			} else 			if ( xmldsigSignaturePropertyType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignaturePropertyType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 8 /* {http://www.w3.org/2000/09/xmldsig#}SignatureProperty */, xmldsigSignaturePropertyType->ANY.characters, xmldsigSignaturePropertyType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 34;
@@ -1344,6 +1240,7 @@ static int encode_xmldsigSignaturePropertyType(bitstream_t* stream, struct xmlds
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyValueType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":DSAKeyValue|"http://www.w3.org/2000/09/xmldsig#":RSAKeyValue|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigKeyValueType(bitstream_t* stream, struct xmldsigKeyValueType* xmldsigKeyValueType) {
+	int errn = 0;
 	int grammarID = 35;
 	int done = 0;
 	int wcDone = 0;
@@ -1371,11 +1268,8 @@ static int encode_xmldsigKeyValueType(bitstream_t* stream, struct xmldsigKeyValu
 			} else 			if ( xmldsigKeyValueType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyValueType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 37;
@@ -1394,11 +1288,8 @@ static int encode_xmldsigKeyValueType(bitstream_t* stream, struct xmldsigKeyValu
 			} else 			if ( xmldsigKeyValueType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyValueType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 36;
@@ -1426,11 +1317,8 @@ static int encode_xmldsigKeyValueType(bitstream_t* stream, struct xmldsigKeyValu
 			} else 			if ( xmldsigKeyValueType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 3);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyValueType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 4 /* {http://www.w3.org/2000/09/xmldsig#}KeyValue */, xmldsigKeyValueType->ANY.characters, xmldsigKeyValueType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 37;
@@ -1451,6 +1339,7 @@ static int encode_xmldsigKeyValueType(bitstream_t* stream, struct xmldsigKeyValu
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,RSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Modulus,"http://www.w3.org/2000/09/xmldsig#":Exponent)',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigRSAKeyValueType(bitstream_t* stream, struct xmldsigRSAKeyValueType* xmldsigRSAKeyValueType) {
+	int errn = 0;
 	int grammarID = 38;
 	int done = 0;
 	
@@ -1524,6 +1413,7 @@ static int encode_xmldsigRSAKeyValueType(bitstream_t* stream, struct xmldsigRSAK
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,PGPDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":PGPKeyID,"http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket{0-1},(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED})|("http://www.w3.org/2000/09/xmldsig#":PGPKeyPacket,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-UNBOUNDED}))',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigPGPDataType(bitstream_t* stream, struct xmldsigPGPDataType* xmldsigPGPDataType) {
+	int errn = 0;
 	int grammarID = 40;
 	int done = 0;
 	int wcDone = 0;
@@ -1625,6 +1515,7 @@ static int encode_xmldsigPGPDataType(bitstream_t* stream, struct xmldsigPGPDataT
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,TransformsType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transform{1-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigTransformsType(bitstream_t* stream, struct xmldsigTransformsType* xmldsigTransformsType) {
+	int errn = 0;
 	int grammarID = 43;
 	int done = 0;
 	
@@ -1675,6 +1566,7 @@ static int encode_xmldsigTransformsType(bitstream_t* stream, struct xmldsigTrans
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,X509DataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":X509IssuerSerial|"http://www.w3.org/2000/09/xmldsig#":X509SKI|"http://www.w3.org/2000/09/xmldsig#":X509SubjectName|"http://www.w3.org/2000/09/xmldsig#":X509Certificate|"http://www.w3.org/2000/09/xmldsig#":X509CRL|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]))){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigX509DataType(bitstream_t* stream, struct xmldsigX509DataType* xmldsigX509DataType) {
+	int errn = 0;
 	int grammarID = 45;
 	int done = 0;
 	int wcDone = 0;
@@ -1717,10 +1609,9 @@ static int encode_xmldsigX509DataType(bitstream_t* stream, struct xmldsigX509Dat
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType_X509SubjectName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType_X509SubjectName_currArrayIndex].characters, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType_X509SubjectName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType_X509SubjectName_currArrayIndex].characters, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType_X509SubjectName_currArrayIndex].charactersLen);
 							xmldsigX509DataType_X509SubjectName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -1797,10 +1688,9 @@ static int encode_xmldsigX509DataType(bitstream_t* stream, struct xmldsigX509Dat
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType_X509SubjectName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType_X509SubjectName_currArrayIndex].characters, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType_X509SubjectName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType_X509SubjectName_currArrayIndex].characters, xmldsigX509DataType->X509SubjectName.array[xmldsigX509DataType_X509SubjectName_currArrayIndex].charactersLen);
 							xmldsigX509DataType_X509SubjectName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -1866,6 +1756,7 @@ static int encode_xmldsigX509DataType(bitstream_t* stream, struct xmldsigX509Dat
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SignatureType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SignedInfo,"http://www.w3.org/2000/09/xmldsig#":SignatureValue,"http://www.w3.org/2000/09/xmldsig#":KeyInfo{0-1},"http://www.w3.org/2000/09/xmldsig#":Object{0-UNBOUNDED})',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigSignatureType(bitstream_t* stream, struct xmldsigSignatureType* xmldsigSignatureType) {
+	int errn = 0;
 	int grammarID = 47;
 	int done = 0;
 	
@@ -1878,11 +1769,8 @@ static int encode_xmldsigSignatureType(bitstream_t* stream, struct xmldsigSignat
 			if ( xmldsigSignatureType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigSignatureType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigSignatureType->Id.characters, xmldsigSignatureType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {}Id */, xmldsigSignatureType->Id.characters, xmldsigSignatureType->Id.charactersLen);
 				}
 				grammarID = 48;
 			} else 			if ( 1 == 1 ) {
@@ -1974,6 +1862,7 @@ static int encode_xmldsigSignatureType(bitstream_t* stream, struct xmldsigSignat
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,DSAKeyValueType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='(("http://www.w3.org/2000/09/xmldsig#":P,"http://www.w3.org/2000/09/xmldsig#":Q){0-1},"http://www.w3.org/2000/09/xmldsig#":G{0-1},"http://www.w3.org/2000/09/xmldsig#":Y,"http://www.w3.org/2000/09/xmldsig#":J{0-1},("http://www.w3.org/2000/09/xmldsig#":Seed,"http://www.w3.org/2000/09/xmldsig#":PgenCounter){0-1})',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigDSAKeyValueType(bitstream_t* stream, struct xmldsigDSAKeyValueType* xmldsigDSAKeyValueType) {
+	int errn = 0;
 	int grammarID = 52;
 	int done = 0;
 	
@@ -2224,6 +2113,7 @@ static int encode_xmldsigDSAKeyValueType(bitstream_t* stream, struct xmldsigDSAK
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,ReferenceType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":Transforms{0-1},"http://www.w3.org/2000/09/xmldsig#":DigestMethod,"http://www.w3.org/2000/09/xmldsig#":DigestValue)',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigReferenceType* xmldsigReferenceType) {
+	int errn = 0;
 	int grammarID = 59;
 	int done = 0;
 	
@@ -2235,31 +2125,22 @@ static int encode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigRefere
 			if ( xmldsigReferenceType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigReferenceType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigReferenceType->Id.characters, xmldsigReferenceType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {}Id */, xmldsigReferenceType->Id.characters, xmldsigReferenceType->Id.charactersLen);
 				}
 				grammarID = 60;
 			} else 			if ( xmldsigReferenceType->Type_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigReferenceType->Type.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigReferenceType->Type.characters, xmldsigReferenceType->Type.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 18 /* {}Type */, xmldsigReferenceType->Type.characters, xmldsigReferenceType->Type.charactersLen);
 				}
 				grammarID = 61;
 			} else 			if ( xmldsigReferenceType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 2);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigReferenceType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigReferenceType->URI.characters, xmldsigReferenceType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 19 /* {}URI */, xmldsigReferenceType->URI.characters, xmldsigReferenceType->URI.charactersLen);
 				}
 				grammarID = 62;
 			} else 			if ( xmldsigReferenceType->Transforms_isUsed == 1u ) {
@@ -2283,21 +2164,15 @@ static int encode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigRefere
 			if ( xmldsigReferenceType->Type_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigReferenceType->Type.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigReferenceType->Type.characters, xmldsigReferenceType->Type.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 18 /* {}Type */, xmldsigReferenceType->Type.characters, xmldsigReferenceType->Type.charactersLen);
 				}
 				grammarID = 61;
 			} else 			if ( xmldsigReferenceType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 3, 1);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigReferenceType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigReferenceType->URI.characters, xmldsigReferenceType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 19 /* {}URI */, xmldsigReferenceType->URI.characters, xmldsigReferenceType->URI.charactersLen);
 				}
 				grammarID = 62;
 			} else 			if ( xmldsigReferenceType->Transforms_isUsed == 1u ) {
@@ -2321,11 +2196,8 @@ static int encode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigRefere
 			if ( xmldsigReferenceType->URI_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 2, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigReferenceType->URI.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigReferenceType->URI.characters, xmldsigReferenceType->URI.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 19 /* {}URI */, xmldsigReferenceType->URI.characters, xmldsigReferenceType->URI.charactersLen);
 				}
 				grammarID = 62;
 			} else 			if ( xmldsigReferenceType->Transforms_isUsed == 1u ) {
@@ -2420,6 +2292,7 @@ static int encode_xmldsigReferenceType(bitstream_t* stream, struct xmldsigRefere
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,SPKIDataType',  base type name='anyType',  content type='ELEMENT',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":SPKISexp,(WC[##other:"http://www.w3.org/2000/09/xmldsig#"]){0-1}){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigSPKIDataType(bitstream_t* stream, struct xmldsigSPKIDataType* xmldsigSPKIDataType) {
+	int errn = 0;
 	int grammarID = 65;
 	int done = 0;
 	int wcDone = 0;
@@ -2522,6 +2395,7 @@ static int encode_xmldsigSPKIDataType(bitstream_t* stream, struct xmldsigSPKIDat
 
 /* Complex type name='http://www.w3.org/2000/09/xmldsig#,KeyInfoType',  base type name='anyType',  content type='MIXED',  isAbstract='false',  hasTypeId='false',  final='0',  block='0',  particle='("http://www.w3.org/2000/09/xmldsig#":KeyName|"http://www.w3.org/2000/09/xmldsig#":KeyValue|"http://www.w3.org/2000/09/xmldsig#":RetrievalMethod|"http://www.w3.org/2000/09/xmldsig#":X509Data|"http://www.w3.org/2000/09/xmldsig#":PGPData|"http://www.w3.org/2000/09/xmldsig#":SPKIData|"http://www.w3.org/2000/09/xmldsig#":MgmtData|(WC[##other:"http://www.w3.org/2000/09/xmldsig#"])){1-UNBOUNDED}',  derivedBy='RESTRICTION'.  */
 static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoType* xmldsigKeyInfoType) {
+	int errn = 0;
 	int grammarID = 68;
 	int done = 0;
 	int wcDone = 0;
@@ -2541,11 +2415,8 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 			if ( xmldsigKeyInfoType->Id_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->Id.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigKeyInfoType->Id.characters, xmldsigKeyInfoType->Id.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 15 /* {}Id */, xmldsigKeyInfoType->Id.characters, xmldsigKeyInfoType->Id.charactersLen);
 				}
 				grammarID = 69;
 			} else 			if (xmldsigKeyInfoType_KeyName_currArrayIndex < xmldsigKeyInfoType->KeyName.arrayLen ) {
@@ -2554,10 +2425,9 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].characters, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].characters, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].charactersLen);
 							xmldsigKeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -2601,10 +2471,9 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].characters, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].characters, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							xmldsigKeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -2618,11 +2487,8 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 			} else 			if ( xmldsigKeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 9);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 71;
@@ -2638,10 +2504,9 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].characters, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].characters, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].charactersLen);
 							xmldsigKeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -2685,10 +2550,9 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].characters, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].characters, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							xmldsigKeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -2702,11 +2566,8 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 			} else 			if ( xmldsigKeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 8);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 71;
@@ -2722,10 +2583,9 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].characters, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].characters, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].charactersLen);
 							xmldsigKeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -2769,10 +2629,9 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].characters, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].characters, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							xmldsigKeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -2792,11 +2651,8 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 			} else 			if ( xmldsigKeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 9);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 70;
@@ -2812,10 +2668,9 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].characters, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].characters, xmldsigKeyInfoType->KeyName.array[xmldsigKeyInfoType_KeyName_currArrayIndex].charactersLen);
 							xmldsigKeyInfoType_KeyName_currArrayIndex++;
 						}
 						/* valid EE */
@@ -2859,10 +2714,9 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 					/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 					if(errn == 0) {
-						/* encode string as string table miss (+2 len)*/
-						errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].charactersLen + 2));
+						/* encode string as string table hit or miss (+2 len) */
+						errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].characters, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 						if (errn == 0) {
-							errn = encodeCharacters(stream, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].characters, xmldsigKeyInfoType->MgmtData.array[xmldsigKeyInfoType_MgmtData_currArrayIndex].charactersLen);
 							xmldsigKeyInfoType_MgmtData_currArrayIndex++;
 						}
 						/* valid EE */
@@ -2876,11 +2730,8 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 			} else 			if ( xmldsigKeyInfoType->ANY_isUsed == 1u ) {
 				errn = encodeNBitUnsignedInteger(stream, 4, 8);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(xmldsigKeyInfoType->ANY.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType->ANY.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 2 /* {http://www.w3.org/2000/09/xmldsig#}KeyInfo */, xmldsigKeyInfoType->ANY.characters, xmldsigKeyInfoType->ANY.charactersLen);
 				}
 				wcDone = 1;
 				grammarID = 71;
@@ -2902,6 +2753,7 @@ static int encode_xmldsigKeyInfoType(bitstream_t* stream, struct xmldsigKeyInfoT
 
 
 int encode_xmldsigExiDocument(bitstream_t* stream, struct xmldsigEXIDocument* exiDoc) {
+	int errn = 0;
 	errn = writeEXIHeader(stream);
 
 	if(errn == 0) {
@@ -2952,11 +2804,8 @@ int encode_xmldsigExiDocument(bitstream_t* stream, struct xmldsigEXIDocument* ex
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiDoc->KeyName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiDoc->KeyName.characters, exiDoc->KeyName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiDoc->KeyName.characters, exiDoc->KeyName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -2980,11 +2829,8 @@ int encode_xmldsigExiDocument(bitstream_t* stream, struct xmldsigEXIDocument* ex
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiDoc->MgmtData.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiDoc->MgmtData.characters, exiDoc->MgmtData.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiDoc->MgmtData.characters, exiDoc->MgmtData.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -3094,8 +2940,8 @@ int encode_xmldsigExiDocument(bitstream_t* stream, struct xmldsigEXIDocument* ex
 }
 
 #if DEPLOY_XMLDSIG_CODEC_FRAGMENT == SUPPORT_YES
-int encode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* exiFrag) {
-	errn = writeEXIHeader(stream);
+static int encode_xmldsigExiFragmentContent(bitstream_t* stream, struct xmldsigEXIFragment* exiFrag) {
+	int errn = 0;
 
 	if(errn == 0) {
 		/* FragmentContent[START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Exponent), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}G), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}HMACOutputLength), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}J), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Modulus), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}P), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyID), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPKeyPacket), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PgenCounter), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Q), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKISexp), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Seed), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509CRL), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Certificate), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509IssuerSerial), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509SKI), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509SerialNumber), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509SubjectName), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}XPath), START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Y), START_ELEMENT_GENERIC, END_DOCUMENT] */
@@ -3202,11 +3048,8 @@ int encode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* ex
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->KeyName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->KeyName.characters, exiFrag->KeyName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 3 /* {http://www.w3.org/2000/09/xmldsig#}KeyName */, exiFrag->KeyName.characters, exiFrag->KeyName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -3230,11 +3073,8 @@ int encode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* ex
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->MgmtData.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->MgmtData.characters, exiFrag->MgmtData.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 5 /* {http://www.w3.org/2000/09/xmldsig#}MgmtData */, exiFrag->MgmtData.characters, exiFrag->MgmtData.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -3474,11 +3314,8 @@ int encode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* ex
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->X509IssuerName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->X509IssuerName.characters, exiFrag->X509IssuerName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 10 /* {http://www.w3.org/2000/09/xmldsig#}X509IssuerName */, exiFrag->X509IssuerName.characters, exiFrag->X509IssuerName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -3523,11 +3360,8 @@ int encode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* ex
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->X509SubjectName.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->X509SubjectName.characters, exiFrag->X509SubjectName.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 11 /* {http://www.w3.org/2000/09/xmldsig#}X509SubjectName */, exiFrag->X509SubjectName.characters, exiFrag->X509SubjectName.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -3539,11 +3373,8 @@ int encode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* ex
 				/* First(xsi:type)StartTag[CHARACTERS[STRING]] */
 				errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				if(errn == 0) {
-					/* encode string as string table miss (+2 len)*/
-					errn = encodeUnsignedInteger16(stream, (uint16_t)(exiFrag->XPath.charactersLen + 2));
-					if (errn == 0) {
-						errn = encodeCharacters(stream, exiFrag->XPath.characters, exiFrag->XPath.charactersLen);
-					}
+					/* encode string as string table hit or miss (+2 len) */
+					errn = encodeStringValueCharacters(stream, 12 /* {http://www.w3.org/2000/09/xmldsig#}XPath */, exiFrag->XPath.characters, exiFrag->XPath.charactersLen);
 					/* valid EE */
 					errn = encodeNBitUnsignedInteger(stream, 1, 0);
 				}
@@ -3580,6 +3411,37 @@ int encode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* ex
 
 	return errn;
 }
+int encode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* exiFrag) {
+	int errn = writeEXIHeader(stream);
+
+	if(errn == 0) {
+		errn = encode_xmldsigExiFragmentContent(stream, exiFrag);
+	}
+
+	return errn;
+}
+
+#if EXI_STREAM == BYTE_ARRAY && ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+int encode_xmldsigExiFragmentDigest(bitstream_t* stream, struct xmldsigEXIFragment* exiFrag, uint8_t* digest) {
+	exi_sha256_t sha256;
+	int errn;
+
+	/* the bytes are hashed while they are written, no second pass over the stream */
+	exiSha256Init(&sha256);
+	errn = writeEXIHeaderDigest(stream, &sha256);
+
+	if(errn == 0) {
+		errn = encode_xmldsigExiFragmentContent(stream, exiFrag);
+	}
+	stream->digest = NULL;
+
+	if(errn == 0) {
+		exiSha256Final(&sha256, digest);
+	}
+
+	return errn;
+}
+#endif /* ENCODER_DIGEST_SHA256 */
 #endif /* DEPLOY_XMLDSIG_CODEC_FRAGMENT */
 
 
@@ -54,6 +54,11 @@ int encode_xmldsigExiDocument(bitstream_t* stream, struct xmldsigEXIDocument* ex
 
 #if DEPLOY_XMLDSIG_CODEC_FRAGMENT == SUPPORT_YES
 int encode_xmldsigExiFragment(bitstream_t* stream, struct xmldsigEXIFragment* exiFrag);
+#if EXI_STREAM == BYTE_ARRAY && ENCODER_DIGEST == ENCODER_DIGEST_SHA256
+/* Encodes the fragment and returns the SHA-256 of the encoded bytes in digest (EXI_SHA256_DIGEST_SIZE bytes).
+ * With stream->data == NULL only the digest is computed, *stream->pos is the length of the fragment. */
+int encode_xmldsigExiFragmentDigest(bitstream_t* stream, struct xmldsigEXIFragment* exiFrag, uint8_t* digest);
+#endif /* ENCODER_DIGEST_SHA256 */
 #endif /* DEPLOY_XMLDSIG_CODEC_FRAGMENT */
 
 
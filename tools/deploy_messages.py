@@ -0,0 +1,319 @@
+#!/usr/bin/env python3
+"""
+Adds per message switches to a generated codec (din, iso1, iso2).
+
+Writes <prefix>EXIDeploy.h with one <PREFIX>_DEPLOY_<Element> switch for every
+root element of the schema (the messages of the V2G_Message body first) and
+guards the code of each element with it:
+
+- the element branches of the document, fragment and body decoders/encoders
+  (a disabled element decodes as unknown event code, encodes as unknown event)
+- the body grammar table rows (GRAMMAR_DECODER_TABLE)
+- decode_/encode_/init_ of the element type, if nothing else uses the type
+
+Types below the element types are static and dropped by the compiler once
+no deployed element references them.
+
+Run it after tools/grammar_tables.py:
+
+    python3 tools/deploy_messages.py src/iso2 iso2
+"""
+
+import os
+import re
+import sys
+
+
+class Source:
+    def __init__(self, path):
+        self.path = path
+        with open(path, newline="") as f:
+            self.lines = f.read().splitlines(True)
+
+    def write(self):
+        with open(self.path, "w", newline="") as f:
+            f.write("".join(self.lines))
+
+
+def text(line):
+    return line.rstrip("\r\n")
+
+
+def newline(line):
+    return "\r\n" if line.endswith("\r\n") else "\n"
+
+
+class Deploy:
+    def __init__(self, directory, prefix):
+        self.p = prefix
+        self.P = prefix.upper()
+        self.directory = directory
+        self.decoder = Source(os.path.join(directory, prefix + "EXIDatatypesDecoder.c"))
+        self.encoder = Source(os.path.join(directory, prefix + "EXIDatatypesEncoder.c"))
+        self.datatypes = Source(os.path.join(directory, prefix + "EXIDatatypes.c"))
+        self.datatypesHeader = Source(os.path.join(directory, prefix + "EXIDatatypes.h"))
+        if any("EXIDeploy.h" in l for l in self.datatypesHeader.lines):
+            sys.exit("%s: message switches exist already" % directory)
+        # guards: list of (source, start, end, element, else lines), applied at the end
+        self.guards = []
+
+    def switch(self, element):
+        return "%s_DEPLOY_%s" % (self.P, element)
+
+    def elements(self):
+        """root elements with their types in document order, and the messages of the body"""
+        p = self.p
+        src = "".join(self.decoder.lines)
+        start = src.index("\nint decode_%sExiDocument(" % p)
+        end = src.index("\n}", start)
+        self.roots = re.findall(r"errn = decode_(%s\w+)\(stream, &exiDoc->(\w+)\);" % p, src[start:end])
+        body = set(re.findall(r"errn = decode_%s\w+\(stream, &%sBodyType->(\w+)\);" % (p, p), src))
+        self.messages = [e for t, e in self.roots if e in body]
+        self.types = {}
+        for t, e in self.roots:
+            self.types.setdefault(t, []).append(e)
+        self.elementType = dict((e, t) for t, e in self.roots)
+
+    def header(self):
+        nl = "\n"
+        p, P = self.p, self.P
+        out = []
+        out.append("/*******************************************************************")
+        out.append(" * Per message deployment of the %s codec, generated by tools/deploy_messages.py" % p)
+        out.append(" * Maintained in http://github.com/uhi22/OpenV2Gx, a fork of https://github.com/Martin-P/OpenV2G")
+        out.append(" *")
+        out.append(" ********************************************************************/")
+        out.append("")
+        out.append("")
+        out.append("")
+        out.append("/**")
+        out.append(" * \\file 	%sEXIDeploy.h" % p)
+        out.append(" * \\brief 	Switches for the root elements (messages) of the %s codec" % p)
+        out.append(" *")
+        out.append(" * 			A disabled element is not decoded or encoded (unknown event code) and")
+        out.append(" * 			its type functions are not compiled. A build for a charge controller")
+        out.append(" * 			with few messages sets %s_DEPLOY_DEFAULT to SUPPORT_NO and" % P)
+        out.append(" * 			enables V2G_Message and the messages it needs, e.g. with")
+        out.append(" * 			-D%s_DEPLOY_DEFAULT=SUPPORT_NO -D%s_DEPLOY_V2G_Message=SUPPORT_YES ..." % (P, P))
+        out.append(" *")
+        out.append(" */")
+        out.append("")
+        out.append("#ifndef EXI_%s_DEPLOY_H" % p)
+        out.append("#define EXI_%s_DEPLOY_H" % p)
+        out.append("")
+        out.append("/** Default of all switches below */")
+        out.append("#ifndef %s_DEPLOY_DEFAULT" % P)
+        out.append("#define %s_DEPLOY_DEFAULT SUPPORT_YES" % P)
+        out.append("#endif")
+        out.append("")
+        out.append("/* Messages (V2G_Message Body) */")
+        for e in self.messages:
+            out.extend(self.define(e))
+        out.append("")
+        out.append("/* Other root elements (V2G_Message, fragments and signatures) */")
+        for t, e in self.roots:
+            if e not in self.messages:
+                out.extend(self.define(e))
+        out.append("")
+        out.append("#endif /* EXI_%s_DEPLOY_H */" % p)
+        with open(os.path.join(self.directory, p + "EXIDeploy.h"), "w", newline="") as f:
+            f.write(nl.join(out) + nl)
+
+    def define(self, e):
+        s = self.switch(e)
+        return ["#ifndef %s" % s, "#define %s %s_DEPLOY_DEFAULT" % (s, self.P), "#endif"]
+
+    def include(self):
+        lines = self.datatypesHeader.lines
+        for i, l in enumerate(lines):
+            if text(l) == '#include "EXITypes.h"':
+                nl = newline(l)
+                lines[i + 1:i + 1] = [nl, '#include "%sEXIDeploy.h"%s' % (self.p, nl)]
+                return
+        sys.exit("no EXITypes.h include")
+
+    def guard(self, source, start, end, element, otherwise=None):
+        self.guards.append((source, start, end, element, otherwise))
+
+    def branches(self):
+        """element branches of the decoders (switch cases) and encoders (if chains)"""
+        p = self.p
+        holders = "(?:exiDoc|exiFrag|body|%sBodyType)" % p
+        lines = self.decoder.lines
+        for i, l in enumerate(lines):
+            m = re.match(r"^(\t+)case \d+:$", text(l))
+            if not m:
+                continue
+            end = i + 1
+            while text(lines[end]) != m.group(1) + "\tbreak;":
+                if re.match(r"^\t*case \d+:$", text(lines[end])):
+                    break
+                end += 1
+            block = "".join(lines[i:end + 1])
+            calls = re.findall(r"errn = decode_(%s\w+)\(stream, &%s->(\w+)\);" % (p, holders), block)
+            if len(calls) == 1 and calls[0] in self.roots and text(lines[end]).endswith("break;"):
+                self.guard(self.decoder, i, end, calls[0][1])
+
+        lines = self.encoder.lines
+        for i, l in enumerate(lines):
+            m = re.match(r"^(\t+)(?:\} else\s*)?if \( %s->(\w+)_isUsed == 1u \) \{ ?$" % holders, text(l))
+            if not m:
+                continue
+            end = i + 1
+            while not text(lines[end]).startswith(m.group(1) + "}"):
+                end += 1
+            block = "".join(lines[i + 1:end])
+            calls = re.findall(r"errn = encode_(%s\w+)\(stream, &%s->(\w+) \);" % (p, holders), block)
+            if len(calls) == 1 and calls[0] in self.roots and calls[0][1] == m.group(2):
+                nl = newline(lines[i])
+                error = [m.group(1) + "\terrn = EXI_ERROR_UNKOWN_EVENT;" + nl]
+                self.guard(self.encoder, i + 1, end - 1, calls[0][1], error)
+
+    def tables(self):
+        """rows of the body grammar table"""
+        p = self.p
+        lines = self.decoder.lines
+        inside = False
+        for i, l in enumerate(lines):
+            if text(l).startswith("static const exi_grammar_production_t %sBodyTypeProductions[" % p):
+                inside = True
+            elif inside and text(l) == "};":
+                inside = False
+            elif inside:
+                m = re.search(r"offsetof\(struct %sBodyType, (\w+)\)" % p, l)
+                if m and m.group(1) in self.elementType:
+                    nl = newline(l)
+                    comma = "," if text(l).endswith(",") else ""
+                    error = ["\t{ EXI_GRAMMAR_ERROR, 0, 0, 0, 0, EXI_GRAMMAR_NO_FLAG, EXI_ERROR_UNKOWN_EVENT_CODE, "
+                             "0, 0, 0, 0, 0, 0, 0, NULL }" + comma + nl]
+                    self.guard(self.decoder, i, i, m.group(1), error)
+
+    def active(self, source):
+        """for every line the set of deploy switches which must be enabled to compile it"""
+        result = []
+        stack = []
+        for l in source.lines:
+            t = text(l)
+            m = re.match(r"^#if (%s_DEPLOY_\w+) == SUPPORT_YES$" % self.P, t)
+            if m:
+                stack.append(m.group(1))
+            elif t.startswith("#if"):
+                stack.append(None)
+            elif t.startswith("#else") or t.startswith("#elif"):
+                stack[-1] = None
+            elif t.startswith("#endif"):
+                stack.pop()
+            result.append(set(s for s in stack if s))
+        return result
+
+    def uses(self, source):
+        """lines which use the functions of a type"""
+        result = {}
+        for i, l in enumerate(source.lines):
+            for t in re.findall(r"\b(?:decode|encode|init)_(%s\w+?)(?:Generic)?\b" % self.p, l):
+                result.setdefault(t, []).append(i)
+        return result
+
+    def definition(self, source, pattern):
+        """start and end line of a function definition (including its grammar tables)"""
+        lines = source.lines
+        for i, l in enumerate(lines):
+            if re.match(pattern, text(l)):
+                end = i
+                while text(lines[end]) != "}":
+                    end += 1
+                return i, end
+        return None
+
+    def functions(self):
+        """definitions of element types which are used by one element only"""
+        p = self.p
+        self.apply()
+        sources = (self.decoder, self.encoder, self.datatypes)
+        active = dict((s.path, self.active(s)) for s in sources)
+        uses = dict((s.path, self.uses(s)) for s in sources)
+        for t, es in sorted(self.types.items()):
+            if len(es) != 1:
+                continue
+            e = es[0]
+            s = self.switch(e)
+            regions = []
+            declared = []
+            # decoder: tables, switch code, generic signature, prototype
+            lines = self.decoder.lines
+            d = self.definition(self.decoder, r"^static int decode_%s\(bitstream_t\* stream, struct %s\* \w+\) \{$" % (t, t))
+            if d is None:
+                continue
+            start, end = d
+            tables = [i for i, l in enumerate(lines) if text(l).startswith("static const exi_grammar_production_t %sProductions[" % t)]
+            if tables:
+                start = tables[0] - 1
+                while text(lines[end]) != "#endif /* GRAMMAR_DECODER_TABLE */":
+                    end += 1
+            regions.append((self.decoder, start, end))
+            generic = self.definition(self.decoder, r"^static int decode_%sGeneric\(bitstream_t\* stream, void\* value\) \{$" % t)
+            if generic:
+                regions.append((self.decoder, generic[0], generic[1]))
+            e1 = self.definition(self.encoder, r"^static int encode_%s\(bitstream_t\* stream, struct %s\* \w+\) \{$" % (t, t))
+            if e1 is None:
+                continue
+            regions.append((self.encoder, e1[0], e1[1]))
+            i1 = self.definition(self.datatypes, r"^void init_%s\(struct %s\* \w+\) \{$" % (t, t))
+            if i1 is None:
+                continue
+            regions.append((self.datatypes, i1[0], i1[1]))
+            for source, kind in ((self.decoder, "decode"), (self.encoder, "encode")):
+                for i, l in enumerate(source.lines):
+                    if re.match(r"^static int %s_%s\(bitstream_t\* stream, struct %s\* \w+\);$" % (kind, t, t), text(l)):
+                        declared.append((source, i, i))
+            for i, l in enumerate(self.datatypesHeader.lines):
+                if text(l) == "void init_%s(struct %s* %s);" % (t, t, t):
+                    declared.append((self.datatypesHeader, i, i))
+
+            # every other use must be guarded by the switch
+            used = True
+            for source in sources:
+                inside = [(a, b) for src, a, b in regions + declared if src is source]
+                for i in uses[source.path].get(t, []):
+                    if any(a <= i <= b for a, b in inside):
+                        continue
+                    if s not in active[source.path][i]:
+                        used = False
+            if not used:
+                continue
+            for source, a, b in regions + declared:
+                self.guard(source, a, b, e)
+        self.apply()
+
+    def apply(self):
+        for source in (self.decoder, self.encoder, self.datatypes, self.datatypesHeader):
+            guards = sorted([g for g in self.guards if g[0] is source], key=lambda g: -g[1])
+            for _, start, end, element, otherwise in guards:
+                lines = source.lines
+                nl = newline(lines[start])
+                s = self.switch(element)
+                after = []
+                if otherwise:
+                    after.append("#else" + nl)
+                    after.extend(otherwise)
+                after.append("#endif /* %s */%s" % (s, nl))
+                lines[end + 1:end + 1] = after
+                lines[start:start] = ["#if %s == SUPPORT_YES%s" % (s, nl)]
+        self.guards = []
+
+    def run(self):
+        self.elements()
+        self.header()
+        self.include()
+        self.branches()
+        self.tables()
+        self.functions()
+        for source in (self.decoder, self.encoder, self.datatypes, self.datatypesHeader):
+            source.write()
+        print("%s: %d messages, %d other root elements" % (self.p, len(self.messages), len(self.roots) - len(self.messages)))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    Deploy(sys.argv[1], sys.argv[2]).run()
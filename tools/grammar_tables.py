@@ -0,0 +1,414 @@
+#!/usr/bin/env python3
+"""
+Adds grammar tables (GRAMMAR_DECODER_TABLE, see src/codec/GrammarDecoder.h)
+to the generated *EXIDatatypesDecoder.c files.
+
+Every static decode_<Type> function is parsed. If all of its events have a
+shape the interpreter knows, the state/transition/production tables are
+written in front of it and the switch code is kept in the #else branch.
+Functions with other code (e.g. debug hooks) stay as they are.
+
+Run it again after the codec has been regenerated:
+
+    python3 tools/grammar_tables.py src/iso2/iso2EXIDatatypesDecoder.c ...
+"""
+
+import re
+import sys
+
+GUARD = "#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE"
+GUARD_END = "#endif /* GRAMMAR_DECODER_TABLE */"
+
+HEADER = re.compile(r"^static int (decode_\w+)\(bitstream_t\* stream, struct (\w+)\* (\w+)\) \{$")
+PROTOTYPE = re.compile(r"^static int decode_\w+\(bitstream_t\* stream, struct \w+\* \w+\);$")
+
+VALUE_FUNCTIONS = {
+    "Boolean": "EXI_GRAMMAR_VALUE_BOOLEAN",
+    "Integer16": "EXI_GRAMMAR_VALUE_INTEGER16",
+    "Integer32": "EXI_GRAMMAR_VALUE_INTEGER32",
+    "Integer64": "EXI_GRAMMAR_VALUE_INTEGER64",
+    "UnsignedInteger16": "EXI_GRAMMAR_VALUE_UNSIGNED16",
+    "UnsignedInteger32": "EXI_GRAMMAR_VALUE_UNSIGNED32",
+    "UnsignedInteger64": "EXI_GRAMMAR_VALUE_UNSIGNED64",
+}
+
+
+class Unsupported(Exception):
+    pass
+
+
+def normalize(code):
+    code = re.sub(r"/\*.*?\*/", " ", code, flags=re.S)
+    return " ".join(code.split())
+
+
+class Production:
+    """one row of the productions table, the fields of exi_grammar_production_t"""
+
+    def __init__(self, kind):
+        self.kind = kind
+        self.valueType = "0"
+        self.codingLength = "0"
+        self.valueSize = "0"
+        self.valueOffset = "0"
+        self.flag = "EXI_GRAMMAR_NO_FLAG"
+        self.error = "0"
+        self.arraySize = "0"
+        self.arrayOffset = "0"
+        self.arrayLenOffset = "0"
+        self.elementSize = "0"
+        self.offset = "0"
+        self.lengthOffset = "0"
+        self.size = "0"
+        self.qnameID = "0"
+        self.decode = "NULL"
+
+    def row(self):
+        return "{ " + ", ".join([self.kind, self.valueType, self.codingLength, self.valueSize,
+                                 self.valueOffset, self.flag, self.error, self.arraySize,
+                                 self.arrayOffset, self.arrayLenOffset, self.elementSize,
+                                 self.offset, self.lengthOffset, self.size, self.qnameID, self.decode]) + " }"
+
+
+class TypeParser:
+    def __init__(self, struct, var):
+        self.struct = struct
+        self.var = var
+        self.v = re.escape(var)
+        self.flags = []
+        self.children = set()
+
+    def flag(self, p, name):
+        if name is None:
+            return
+        if not name.endswith("_isUsed"):
+            raise Unsupported(name)
+        if name not in self.flags:
+            self.flags.append(name)
+        p.flag = str(self.flags.index(name))
+
+    def array(self, p, name, size):
+        s = "struct " + self.struct
+        p.arraySize = size
+        p.arrayOffset = "offsetof(%s, %s.array)" % (s, name)
+        p.arrayLenOffset = "offsetof(%s, %s.arrayLen)" % (s, name)
+        p.elementSize = "sizeof(((%s*)0)->%s.array[0])" % (s, name)
+
+    def member(self, array, path):
+        """offset of a field, relative to the array element for arrays"""
+        s = "struct " + self.struct
+        if array is None:
+            return "offsetof(%s, %s)" % (s, path)
+        if path == "":
+            return "0"
+        return "(offsetof(%s, %s.array[0].%s) - offsetof(%s, %s.array))" % (s, array, path, s, array)
+
+    def lvalue(self, text, array):
+        """field path of an assigned value (relative to the array element for arrays)"""
+        v = self.v
+        if array is not None:
+            m = re.match(r"^%s->%s\.array\[%s->%s\.arrayLen\](?:\.([\w.]+))?$" % (v, array, v, array), text)
+            if not m:
+                raise Unsupported(text)
+            return m.group(1) or ""
+        m = re.match(r"^%s->([\w.]+)$" % v, text)
+        if not m:
+            raise Unsupported(text)
+        return m.group(1)
+
+    def value(self, p, code, array):
+        lv = r"([\w>.\[\]-]+?)"
+        m = re.match(r"^errn = decodeNBitUnsignedInteger\(stream, (\d+), &\(?uint32\)?\); " + lv
+                     + r" = \((\w+)\)\(uint32 ?([+-]) ?(\d+)\);$", code)
+        if m:
+            p.valueType = "EXI_GRAMMAR_VALUE_NBIT"
+            p.codingLength = m.group(1)
+            p.valueSize = "sizeof(%s)" % m.group(3)
+            p.valueOffset = ("-" if m.group(4) == "-" else "") + m.group(5)
+            p.offset = self.member(array, self.lvalue(m.group(2), array))
+            return
+        m = re.match(r"^errn = decodeNBitUnsignedInteger\(stream, (\d+), &\(?uint32\)?\); " + lv
+                     + r" = \((\w+)\) uint32;$", code)
+        if m:
+            p.valueType = "EXI_GRAMMAR_VALUE_NBIT"
+            p.codingLength = m.group(1)
+            p.valueSize = "sizeof(%s)" % m.group(3)
+            p.offset = self.member(array, self.lvalue(m.group(2), array))
+            return
+        m = re.match(r"^errn = decode(\w+)\(stream, &" + lv + r"\);$", code)
+        if m and m.group(1) in VALUE_FUNCTIONS:
+            p.valueType = VALUE_FUNCTIONS[m.group(1)]
+            p.offset = self.member(array, self.lvalue(m.group(2), array))
+            return
+        m = re.match(r"^errn = decodeUnsignedInteger16\(stream, &" + lv + r"Len\); "
+                     r"if \(errn == 0\) \{ if \(\1Len >= 2\) \{ \1Len = \(uint16_t\)\(\1Len - 2\); "
+                     r"errn = decodeCharacters\(stream, \1Len, \1, (\w+)\); \} "
+                     r"else \{ errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED; \} \}$", code)
+        if m:
+            path = self.lvalue(m.group(1), array)
+            p.valueType = "EXI_GRAMMAR_VALUE_STRING"
+            p.offset = self.member(array, path)
+            p.lengthOffset = self.member(array, path + "Len")
+            p.size = m.group(2)
+            return
+        m = re.match(r"^errn = decodeUnsignedInteger16\(stream, &" + lv + r"Len\); "
+                     r"if \(errn == 0\) \{ errn = \(\1Len\) <= (\w+) \? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER; \} "
+                     r"if \(errn == 0\) \{ errn = decodeBytes\(stream, \1Len, \1\); \}$", code)
+        if m:
+            path = self.lvalue(m.group(1), array)
+            p.valueType = "EXI_GRAMMAR_VALUE_BYTES"
+            p.offset = self.member(array, path)
+            p.lengthOffset = self.member(array, path + "Len")
+            p.size = m.group(2)
+            return
+        raise Unsupported(code)
+
+    def event(self, code):
+        """returns (production, next grammarID)"""
+        v = self.v
+        m = re.match(r"^done = 1; grammarID = (\d+); break;$", code)
+        if m:
+            return Production("EXI_GRAMMAR_END_ELEMENT"), None
+        m = re.match(r"^errn = (EXI_\w+); grammarID = (\d+); break;$", code)
+        if m:
+            p = Production("EXI_GRAMMAR_ERROR")
+            p.error = m.group(1)
+            return p, m.group(2)
+        m = re.match(r"^errn = decode_(\w+)\(stream, &%s->([\w.]+)\);(?: %s->(\w+) = 1u;)? grammarID = (\d+); break;$"
+                     % (v, v), code)
+        if m:
+            p = Production("EXI_GRAMMAR_COMPLEX")
+            p.decode = "decode_%sGeneric" % m.group(1)
+            p.offset = self.member(None, m.group(2))
+            self.children.add(m.group(1))
+            self.flag(p, m.group(3))
+            return p, m.group(4)
+        m = re.match(r"^if \(%s->(\w+)\.arrayLen < (\w+)\) \{ errn = decode_(\w+)\(stream, &%s->\1\.array\[%s->\1\.arrayLen\+\+\]\); \} "
+                     r"else \{ errn = EXI_ERROR_OUT_OF_BOUNDS; \} grammarID = (\d+); break;$" % (v, v, v), code)
+        if m:
+            p = Production("EXI_GRAMMAR_COMPLEX")
+            self.array(p, m.group(1), m.group(2))
+            p.decode = "decode_%sGeneric" % m.group(3)
+            self.children.add(m.group(3))
+            return p, m.group(4)
+
+        ee = (r" if\(errn == 0\) \{ errn = decodeNBitUnsignedInteger\(stream, 1, &eventCode\); "
+              r"if\(eventCode == 0\) \{ grammarID = (\d+); \} else \{ errn = EXI_DEVIANT_SUPPORT_NOT_DEPLOYED; \} \} break;$")
+        characters = (r"errn = decodeNBitUnsignedInteger\(stream, 1, &eventCode\); if\(errn == 0\) \{ if\(eventCode == 0\) \{ (.*) \} "
+                      r"else \{ errn = EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS; \} \}")
+        m = re.match(r"^" + characters + ee, code)
+        if m:
+            p = Production("EXI_GRAMMAR_ELEMENT")
+            self.simple(p, m.group(1), None)
+            return p, m.group(2)
+        m = re.match(r"^if \(%s->(\w+)\.arrayLen < (\w+)\) \{ " % v + characters
+                     + r" \} else \{ errn = EXI_ERROR_OUT_OF_BOUNDS; \}" + ee, code)
+        if m:
+            p = Production("EXI_GRAMMAR_ELEMENT")
+            self.array(p, m.group(1), m.group(2))
+            self.simple(p, m.group(3), m.group(1))
+            return p, m.group(4)
+        m = re.match(r"^(errn = decodeUnsignedInteger16\(stream, .*) grammarID = (\d+); break;$", code)
+        if m:
+            p = Production("EXI_GRAMMAR_ATTRIBUTE")
+            self.simple(p, m.group(1), None)
+            return p, m.group(2)
+        raise Unsupported(code)
+
+    def simple(self, p, code, array):
+        """value, optionally followed by the _isUsed flag and the array length increment"""
+        v = self.v
+        if array is not None:
+            suffix = " %s->%s.arrayLen++;" % (self.var, array)
+            if not code.endswith(suffix):
+                raise Unsupported(code)
+            code = code[:-len(suffix)]
+        m = re.match(r"^(.*) %s->(\w+) = 1u;$" % v, code)
+        if m:
+            code = m.group(1)
+            self.flag(p, m.group(2))
+        self.value(p, code, array)
+
+
+def parse_function(name, struct, var, body):
+    """body: lines of the function without header and closing brace"""
+    code = "\n".join(body)
+    m = re.search(r"\n\tint grammarID = (\d+);\n", "\n" + code)
+    if not m:
+        raise Unsupported("grammarID")
+    start = m.group(1)
+    head, sep, states = code.partition("\twhile(!done) {\n\t\tswitch(grammarID) {\n")
+    if not sep:
+        raise Unsupported("loop")
+    if normalize(head) != normalize("uint32_t eventCode; int errn = 0; %s int grammarID = %s; int done = 0; init_%s(%s);"
+                                    % ("uint32_t uint32;" if "uint32_t uint32;" in head else "", start, struct, var)):
+        raise Unsupported(head)
+    tail = "\n\t\tdefault:\n\t\t\terrn = EXI_ERROR_UNKOWN_GRAMMAR_ID;\n\t\t\tbreak;\n\t\t}\n\t\tif(errn) {\n\t\t\tdone = 1;\n\t\t}\n\t}\n\treturn errn;"
+    if not states.endswith(tail):
+        raise Unsupported("tail")
+    states = states[:-len(tail)]
+
+    parser = TypeParser(struct, var)
+    parts = re.split(r"(?:^|\n)\t\tcase (\d+):\n", states)
+    if parts[0].strip():
+        raise Unsupported(parts[0])
+    order = []
+    events = {}
+    for k in range(1, len(parts), 2):
+        grammar, text = parts[k], parts[k + 1]
+        m = re.match(r"^errn = decodeNBitUnsignedInteger\(stream, (\d+), &eventCode\); if \(errn == 0\) \{ switch\(eventCode\) \{ (.*) "
+                     r"default: errn = EXI_ERROR_UNKOWN_EVENT_CODE; break; \} \} break;$", normalize(text))
+        if not m:
+            raise Unsupported(text)
+        cases = re.split(r"\n\t\t\t\tcase (\d+):\n", "\n" + text.split("\n\t\t\t\tdefault:\n")[0])
+        evs = []
+        for j in range(1, len(cases), 2):
+            if int(cases[j]) != len(evs):
+                raise Unsupported("event order")
+            evs.append(parser.event(normalize(cases[j + 1])))
+        if len(evs) > 255 or len(evs) == 0:
+            raise Unsupported("event count")
+        order.append(grammar)
+        events[grammar] = (m.group(1), evs)
+
+    if start not in events:
+        raise Unsupported("start")
+    order.remove(start)
+    order.insert(0, start)
+    index = dict((g, i) for i, g in enumerate(order))
+
+    productions = []
+    transitions = []
+    states_rows = []
+    for g in order:
+        bits, evs = events[g]
+        states_rows.append((len(transitions), bits, len(evs)))
+        for p, nxt in evs:
+            if nxt is None:
+                nxt_index = 0
+            elif nxt in index:
+                nxt_index = index[nxt]
+            else:
+                raise Unsupported("next state %s" % nxt)
+            row = p.row()
+            if row not in productions:
+                productions.append(row)
+            transitions.append((nxt_index, productions.index(row)))
+    if len(transitions) > 65535:
+        raise Unsupported("size")
+    return productions, transitions, states_rows, parser
+
+
+def emit_tables(name, struct, var, productions, transitions, states, parser, nl):
+    t = struct
+    out = []
+    out.append("static const exi_grammar_production_t %sProductions[%d] = {" % (t, len(productions)))
+    for i, row in enumerate(productions):
+        out.append("\t%s%s" % (row, "," if i + 1 < len(productions) else ""))
+    out.append("};")
+    out.append("static const exi_grammar_transition_t %sTransitions[%d] = {" % (t, len(transitions)))
+    rows = ["{ %d, %d }" % tr for tr in transitions]
+    for i in range(0, len(rows), 8):
+        last = i + 8 >= len(rows)
+        out.append("\t" + ", ".join(rows[i:i + 8]) + ("" if last else ","))
+    out.append("};")
+    out.append("static const exi_grammar_state_t %sStates[%d] = {" % (t, len(states)))
+    rows = ["{ %d, %s, %d }" % s for s in states]
+    for i in range(0, len(rows), 8):
+        last = i + 8 >= len(rows)
+        out.append("\t" + ", ".join(rows[i:i + 8]) + ("" if last else ","))
+    out.append("};")
+    used = "NULL"
+    if parser.flags:
+        used = "%sUsed" % t
+        out.append("static void %s(void* value, uint8_t flag) {" % used)
+        out.append("\tstruct %s* %s = (struct %s*)value;" % (t, var, t))
+        out.append("\tswitch(flag) {")
+        for i, f in enumerate(parser.flags):
+            out.append("\tcase %d:" % i)
+            out.append("\t\t%s->%s = 1u;" % (var, f))
+            out.append("\t\tbreak;")
+        out.append("\t}")
+        out.append("}")
+    out.append("static const exi_grammar_t %sGrammar = { %sStates, %sTransitions, %sProductions, %s };"
+               % (t, t, t, t, used))
+    out.append("")
+    out.append("static int %s(bitstream_t* stream, struct %s* %s) {" % (name, struct, var))
+    out.append("\tinit_%s(%s);" % (struct, var))
+    out.append("\treturn decodeGrammar(stream, &%sGrammar, %s);" % (t, var))
+    out.append("}")
+    return [l + nl for l in out]
+
+
+def newline(line):
+    if line.endswith("\r\n"):
+        return "\r\n"
+    return "\n"
+
+
+def convert(path):
+    with open(path, newline="") as f:
+        lines = f.read().splitlines(True)
+    if any("GrammarDecoder.h" in l for l in lines):
+        sys.exit("%s: grammar tables exist already" % path)
+
+    out = []
+    children = set()
+    converted = 0
+    kept = []
+    i = 0
+    while i < len(lines):
+        m = HEADER.match(lines[i].rstrip("\r\n"))
+        if not m:
+            out.append(lines[i])
+            i += 1
+            continue
+        end = i + 1
+        while lines[end].rstrip("\r\n") != "}":
+            end += 1
+        name, struct, var = m.groups()
+        body = [l.rstrip("\r\n") for l in lines[i + 1:end]]
+        nl = newline(lines[i])
+        try:
+            productions, transitions, states, parser = parse_function(name, struct, var, body)
+        except Unsupported:
+            kept.append(name)
+            out.extend(lines[i:end + 1])
+        else:
+            converted += 1
+            children |= parser.children
+            out.append(GUARD + nl)
+            out.extend(emit_tables(name, struct, var, productions, transitions, states, parser, nl))
+            out.append("#else" + nl)
+            out.extend(lines[i:end + 1])
+            out.append(GUARD_END + nl)
+        i = end + 1
+
+    # include and the generic decoders of the child types
+    result = []
+    last_prototype = max(k for k, l in enumerate(out) if PROTOTYPE.match(l.rstrip("\r\n")))
+    for k, l in enumerate(out):
+        result.append(l)
+        nl = newline(l)
+        if l.rstrip("\r\n") == '#include "EXIHeaderDecoder.h"':
+            result.append('#include "GrammarDecoder.h"' + nl)
+        if k == last_prototype and children:
+            result.append(nl)
+            result.append(GUARD + nl)
+            result.append("/* type independent signatures for the grammar tables */" + nl)
+            for c in sorted(children):
+                result.append("static int decode_%sGeneric(bitstream_t* stream, void* value) {%s" % (c, nl))
+                result.append("\treturn decode_%s(stream, (struct %s*)value);%s" % (c, c, nl))
+                result.append("}" + nl)
+            result.append(GUARD_END + nl)
+
+    with open(path, "w", newline="") as f:
+        f.write("".join(result))
+    print("%s: %d grammar tables, kept %d switch decoders %s" % (path, converted, len(kept), " ".join(kept)))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    for arg in sys.argv[1:]:
+        convert(arg)
@@ -0,0 +1,308 @@
+#!/usr/bin/env python3
+"""
+Adds the DATABINDING_SLIM variant to a generated codec (din, iso1, iso2).
+
+Every declaration of <prefix>EXIDatatypes.h gets an estimated size (UCS
+characters, no padding). The large ones turn into pointers under
+DATABINDING == DATABINDING_SLIM:
+
+- bytes/characters buffers, allocated with their decoded length (characters
+  with CHARACTER_UNITS, the UTF-8 worst case under STRING_REPRESENTATION_UTF8)
+- arrays, allocated with their full ARRAY_SIZE on the first element
+- optional struct members (with _isUsed), outside of unions
+
+The decoders allocate them from stream->arena before decoding into them, the
+encoders only change where a member struct is passed by address. Types with
+out-of-line members keep their switch decoder under GRAMMAR_DECODER_TABLE,
+the tables address members by offset.
+
+Run it after tools/deploy_messages.py:
+
+    python3 tools/slim_databinding.py src/iso2 iso2 [threshold in bytes, default 64]
+"""
+
+import os
+import re
+import sys
+
+
+class Source:
+    def __init__(self, path):
+        self.path = path
+        with open(path, newline="") as f:
+            self.lines = f.read().splitlines(True)
+
+    def write(self):
+        with open(self.path, "w", newline="") as f:
+            f.write("".join(self.lines))
+
+
+def text(line):
+    return line.rstrip("\r\n")
+
+
+def newline(line):
+    return "\r\n" if line.endswith("\r\n") else "\n"
+
+
+SLIM_IF = "#if DATABINDING == DATABINDING_SLIM"
+SLIM_ELSE = "#else"
+SLIM_ENDIF = "#endif /* DATABINDING_SLIM */"
+
+POINTER_SIZE = 8
+
+PRIMITIVE_SIZES = {
+    "int": 4, "int8_t": 1, "uint8_t": 1, "int16_t": 2, "uint16_t": 2,
+    "int32_t": 4, "uint32_t": 4, "int64_t": 8, "uint64_t": 8,
+    "size_t": 8, "exi_string_character_t": 4,
+}
+
+STRUCT_START = re.compile(r"^struct (\w+) \{")
+ANON_START = re.compile(r"^\s*struct \{\s*$")
+ANON_END = re.compile(r"^(\s*)\}(\s*)(\w+)\s*(?:\[(\w+)\])?\s*;")
+UNION_START = re.compile(r"^\s*union \{\s*$")
+UNION_END = re.compile(r"^\s+\};")
+BITFIELD = re.compile(r"^\s*unsigned int (\w+):\d+;")
+POINTER = re.compile(r"^\s*(?:const )?(?:struct )?\w+\* (\w+);")
+DECL = re.compile(r"^(\s*)(struct \w+|\w+) (\w+)\s*(?:\[(\w+)\])?\s*;")
+
+
+class Member:
+    def __init__(self, name, ctype, dim, line, union):
+        self.name = name
+        self.ctype = ctype
+        self.dim = dim
+        self.line = line
+        self.union = union
+        self.children = None
+        self.slim = False
+
+
+class Slim:
+    def __init__(self, directory, prefix, threshold):
+        self.p = prefix
+        self.threshold = threshold
+        self.header = Source(os.path.join(directory, prefix + "EXIDatatypes.h"))
+        self.decoder = Source(os.path.join(directory, prefix + "EXIDatatypesDecoder.c"))
+        self.encoder = Source(os.path.join(directory, prefix + "EXIDatatypesEncoder.c"))
+        if any("DATABINDING_SLIM" in l for l in self.header.lines):
+            sys.exit("%s: slim databinding exists already" % directory)
+        self.defines = {}
+        self.enums = set()
+        self.structs = {}
+        self.sizes = {}
+        # (struct name, member path) -> "bytes" | "characters" | "array" | "struct"
+        self.paths = {}
+
+    # header
+
+    def parse(self):
+        lines = [text(l) for l in self.header.lines]
+        for l in lines:
+            m = re.match(r"^#define (\w+) (\d+)", l)
+            if m:
+                self.defines[m.group(1)] = int(m.group(2))
+            m = re.match(r"^\} (\w+);", l)
+            if m:
+                self.enums.add(m.group(1))
+        i = 0
+        while i < len(lines):
+            m = STRUCT_START.match(lines[i])
+            if not m:
+                i += 1
+                continue
+            name = m.group(1)
+            stack = [[]]
+            union = 0
+            comment = False
+            i += 1
+            while lines[i] != "};":
+                l = lines[i]
+                if comment or l.strip().startswith("/*"):
+                    comment = "*/" not in l
+                elif l.startswith("#") or not l.strip():
+                    pass
+                elif UNION_START.match(l):
+                    union += 1
+                elif ANON_START.match(l):
+                    stack.append([])
+                elif ANON_END.match(l):
+                    e = ANON_END.match(l)
+                    member = Member(e.group(3), None, e.group(4), i, union > 0 and len(stack) == 2)
+                    member.children = stack.pop()
+                    stack[-1].append(member)
+                elif UNION_END.match(l):
+                    union -= 1
+                elif BITFIELD.match(l):
+                    stack[-1].append(Member(BITFIELD.match(l).group(1), "bitfield", None, i, False))
+                elif POINTER.match(l):
+                    stack[-1].append(Member(POINTER.match(l).group(1), "pointer", None, i, False))
+                elif DECL.match(l):
+                    d = DECL.match(l)
+                    stack[-1].append(Member(d.group(3), d.group(2), d.group(4), i, union > 0 and len(stack) == 1))
+                else:
+                    sys.exit("%s:%d: cannot parse %r" % (self.header.path, i + 1, l))
+                i += 1
+            self.structs[name] = stack[0]
+            self.sizes[name] = self.size(name, stack[0], "")
+
+    def elementSize(self, member, owner, path):
+        if member.children is not None:
+            return self.size(owner, member.children, path + "[]." if member.dim else path + ".")
+        if member.ctype == "bitfield":
+            return 0.125
+        if member.ctype == "pointer":
+            return POINTER_SIZE
+        if member.ctype.startswith("struct "):
+            return self.sizes[member.ctype[len("struct "):]]
+        if member.ctype in self.enums:
+            return 4
+        return PRIMITIVE_SIZES[member.ctype]
+
+    def size(self, owner, members, prefix):
+        """size of a member list with the slim decisions applied, records the decisions"""
+        names = set(m.name for m in members)
+        total = 0
+        unionSize = 0
+        for m in members:
+            path = prefix + m.name
+            size = self.elementSize(m, owner, path)
+            if m.dim:
+                size *= self.defines[m.dim]
+                if size > self.threshold:
+                    m.slim = True
+                    self.paths[(owner, path)] = m.name if m.name in ("bytes", "characters") else "array"
+            elif (m.ctype or "").startswith("struct ") and not m.union and m.name + "_isUsed" in names:
+                if size > self.threshold:
+                    m.slim = True
+                    self.paths[(owner, path)] = "struct"
+            if m.slim:
+                size = POINTER_SIZE
+            if m.union:
+                unionSize = max(unionSize, size)
+            else:
+                total += size
+        return total + unionSize
+
+    def rewriteHeader(self):
+        slimmed = []
+        for members in self.structs.values():
+            stack = list(members)
+            while stack:
+                m = stack.pop()
+                if m.children:
+                    stack.extend(m.children)
+                if m.slim:
+                    slimmed.append(m)
+        for m in sorted(slimmed, key=lambda m: -m.line):
+            line = self.header.lines[m.line]
+            nl = newline(line)
+            l = text(line)
+            if m.children is not None:
+                e = ANON_END.match(l)
+                pointer = "%s}* %s;" % (e.group(1), m.name)
+            elif m.dim:
+                d = DECL.match(l)
+                pointer = "%s%s* %s;" % (d.group(1), d.group(2), m.name)
+            else:
+                pointer = l.replace(" %s ;" % m.name, "* %s ;" % m.name)
+                assert pointer != l, l
+            self.header.lines[m.line:m.line + 1] = [SLIM_IF + nl, pointer + nl, SLIM_ELSE + nl, line, SLIM_ENDIF + nl]
+
+    # decoder, encoder
+
+    def owner(self, variable):
+        if variable == "exiDoc":
+            return self.p + "EXIDocument"
+        if variable == "exiFrag":
+            return self.p + "EXIFragment"
+        return variable
+
+    def kind(self, variable, expression):
+        path = re.sub(r"\.array\[[^\]]*\]", ".array[]", expression)
+        return self.paths.get((self.owner(variable), path))
+
+    def guard(self, source, i, slim):
+        """replaces line i by SLIM_IF slim SLIM_ELSE line SLIM_ENDIF"""
+        line = source.lines[i]
+        nl = newline(line)
+        source.lines[i:i + 1] = [SLIM_IF + nl] + [s + nl for s in slim] + [SLIM_ELSE + nl, line, SLIM_ENDIF + nl]
+
+    def rewriteDecoder(self):
+        lines = self.decoder.lines
+        owners = set(owner for owner, path in self.paths)
+        value = re.compile(r"^(\s*)errn = decode(Bytes|Characters)\(stream, (.+?), (\w+)->([\w.\[\]>-]+)\.(bytes|characters)(, \w+)?\);$")
+        array = re.compile(r"^(\s*)if \((\w+)->([\w.\[\]>-]+)\.arrayLen < (\w+)\) \{$")
+        member = re.compile(r"^(\s*)errn = decode_(\w+)\(stream, &(\w+)->(\w+)\);$")
+        function = re.compile(r"^static int decode_(\w+)\(bitstream_t\* stream, struct (\w+)\* \w+\) \{$")
+        table = "#if GRAMMAR_DECODER == GRAMMAR_DECODER_TABLE"
+        i = len(lines) - 1
+        tableFunction = None
+        while i >= 0:
+            l = text(lines[i])
+            m = value.match(l)
+            if m and self.kind(m.group(4), m.group(5) + "." + m.group(6)):
+                ind, length, target = m.group(1), m.group(3), "%s->%s.%s" % (m.group(4), m.group(5), m.group(6))
+                if m.group(6) == "characters":
+                    length = "CHARACTER_UNITS(%s)" % length
+                self.guard(self.decoder, i, [
+                    "%serrn = EXI_ARENA_ALLOCATE(stream, %s, %s);" % (ind, target, length),
+                    "%sif (errn == 0) {" % ind,
+                    "\t" + l,
+                    "%s}" % ind])
+            m = array.match(l)
+            if m and self.kind(m.group(2), m.group(3) + ".array") == "array":
+                ind, field = m.group(1), "%s->%s" % (m.group(2), m.group(3))
+                self.guard(self.decoder, i, [
+                    "%sif (%s.arrayLen == 0u) {" % (ind, field),
+                    "%s\terrn = EXI_ARENA_ALLOCATE(stream, %s.array, %s);" % (ind, field, m.group(4)),
+                    "%s}" % ind,
+                    "%sif (errn != 0) {" % ind,
+                    "%s\t/* out of arena memory */" % ind,
+                    "%s} else if (%s.arrayLen < %s) {" % (ind, field, m.group(4))])
+            m = member.match(l)
+            if m and self.kind(m.group(3), m.group(4)) == "struct":
+                ind, field = m.group(1), "%s->%s" % (m.group(3), m.group(4))
+                self.guard(self.decoder, i, [
+                    "%serrn = EXI_ARENA_ALLOCATE(stream, %s, 1);" % (ind, field),
+                    "%sif (errn == 0) {" % ind,
+                    "%s\terrn = decode_%s(stream, %s);" % (ind, m.group(2), field),
+                    "%s}" % ind])
+            m = function.match(l)
+            if m:
+                tableFunction = m.group(2) if m.group(2) in owners else None
+            if l == table and tableFunction:
+                lines[i] = table + " && DATABINDING != DATABINDING_SLIM" + newline(lines[i])
+                tableFunction = None
+            i -= 1
+        for i, l in enumerate(lines):
+            if text(l) == '#include "GrammarDecoder.h"':
+                lines.insert(i + 1, '#include "MemoryArena.h"' + newline(l))
+                break
+
+    def rewriteEncoder(self):
+        lines = self.encoder.lines
+        member = re.compile(r"^(\s*)errn = encode_(\w+)\(stream, &(\w+)->(\w+) \);$")
+        for i in range(len(lines) - 1, -1, -1):
+            l = text(lines[i])
+            m = member.match(l)
+            if m and self.kind(m.group(3), m.group(4)) == "struct":
+                self.guard(self.encoder, i, [l.replace("&", "", 1)])
+
+    def run(self):
+        self.parse()
+        self.rewriteHeader()
+        self.rewriteDecoder()
+        self.rewriteEncoder()
+        for source in (self.header, self.decoder, self.encoder):
+            source.write()
+        for name in (self.p + "EXIDocument", self.p + "EXIFragment"):
+            if name in self.sizes:
+                print("%s: %d bytes estimated" % (name, self.sizes[name]))
+        print("%d out-of-line values" % len(self.paths))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) not in (3, 4):
+        sys.exit(__doc__)
+    Slim(sys.argv[1], sys.argv[2], int(sys.argv[3]) if len(sys.argv) == 4 else 64).run()
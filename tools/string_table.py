@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+"""
+Lets a generated codec use the value partitions of the string table
+(EXI_OPTION_VALUE_PARTITION_CAPACITY != 0, see src/codec/StringTable.h).
+
+Every attribute and simple element with a string value gets a qname number,
+its local value partition. The qnames are taken from the grammar comments of
+the decoder, a CHARACTERS event of a simple type belongs to the element that
+uses the type. The numbers are sorted by qname and only have to agree
+between the decoder and the encoder of the codec, they never appear in a
+stream.
+
+- decoder: a string table hit is decoded with decodeStringValueHit (or
+  decodeStringValueHitArena for DATABINDING_SLIM values) instead of the
+  EXI_ERROR_STRINGVALUES_NOT_SUPPORTED error, a miss is added with
+  addStringValue
+- grammar tables: the string productions get the qname in .qnameID
+- encoder: the string table miss is encoded with encodeStringValueCharacters,
+  which finds hits
+
+Run it after tools/slim_databinding.py (tools/grammar_tables.py leaves
+.qnameID 0), for every codec including xmldsig and appHandshake:
+
+    python3 tools/string_table.py src/iso2 iso2
+"""
+
+import os
+import re
+import sys
+
+
+class Source:
+    def __init__(self, path):
+        self.path = path
+        with open(path, newline="") as f:
+            self.lines = f.read().splitlines(True)
+
+    def write(self):
+        with open(self.path, "w", newline="") as f:
+            f.write("".join(self.lines))
+
+
+def text(line):
+    return line.rstrip("\r\n")
+
+
+def newline(line):
+    return "\r\n" if line.endswith("\r\n") else "\n"
+
+
+def indent(line):
+    return len(line) - len(line.lstrip("\t"))
+
+
+HIT = "errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;"
+MISS = "/* encode string as string table miss (+2 len)*/"
+FUNCTION = re.compile(r"^(?:static )?int (?:decode|encode)_\w+\(bitstream_t\* stream, struct (\w+)\*")
+CASE = re.compile(r"^\t*case (\d+):$")
+LENGTH = re.compile(r"^\t*errn = decodeUnsignedInteger16\(stream, &(.+)\.charactersLen\);$")
+SLIM_IF = "#if DATABINDING == DATABINDING_SLIM"
+SLIM_ELSE = "#else"
+SLIM_ENDIF = "#endif /* DATABINDING_SLIM */"
+
+
+def events(comment):
+    """top level events of a grammar comment, e.g. StartTag[ATTRIBUTE[STRING](Id), END_ELEMENT]"""
+    body = comment[comment.index("[") + 1:comment.rindex("]")]
+    out = []
+    depth = 0
+    cur = ""
+    for ch in body:
+        if ch in "[(":
+            depth += 1
+        if ch in "])":
+            depth -= 1
+        if ch == "," and depth == 0:
+            out.append(cur.strip())
+            cur = ""
+        else:
+            cur += ch
+    out.append(cur.strip())
+    return out
+
+
+def key(struct, lvalue):
+    """value of a site, the array index differs between decoder and encoder"""
+    return struct, re.sub(r"\.array\[[^\]]*\]", ".array[]", lvalue)
+
+
+class Codec:
+    def __init__(self, directory, prefix):
+        self.decoder = Source(os.path.join(directory, prefix + "EXIDatatypesDecoder.c"))
+        self.encoder = Source(os.path.join(directory, prefix + "EXIDatatypesEncoder.c"))
+        if any("decodeStringValueHit" in l for l in self.decoder.lines):
+            sys.exit("%s: string table support exists already" % directory)
+        self.lines = [text(l) for l in self.decoder.lines]
+        # (function, value) -> qnames, fragments have values of several qnames
+        self.qnames = {}
+        self.ids = {}
+
+    def function(self, i):
+        while not FUNCTION.match(self.lines[i]):
+            i -= 1
+        return FUNCTION.match(self.lines[i]).group(1)
+
+    def event(self, i):
+        """qname of the event (kind "element", "attribute") or the event (kind "characters") of line i"""
+        L = self.lines
+        j = i
+        while not CASE.match(L[j]):
+            j -= 1
+        k = int(CASE.match(L[j]).group(1))
+        m = re.match(r"^\t*/\* START_ELEMENT\((.*)\) \*/$", L[j + 1])
+        if m:
+            return m.group(1), "element"
+        c = j
+        while not (indent(L[c]) == indent(L[j]) - 1 and L[c].lstrip("\t").startswith("/*") and "[" in L[c]):
+            c -= 1
+        ev = events(L[c].strip()[3:-3])[k]
+        m = re.match(r"^START_ELEMENT\((.*)\)$", ev)
+        if m:
+            return m.group(1), "element"
+        m = re.match(r"^ATTRIBUTE\[\w+\]\((.*)\)$", ev)
+        if m:
+            q = m.group(1)
+            return (q if q.startswith("{") else "{}" + q), "attribute"
+        if not ev.startswith("CHARACTERS"):
+            raise ValueError("line %d: %s" % (i + 1, ev))
+        return ev, "characters"
+
+    def users(self, function):
+        """element qnames decoded with decode_<function>"""
+        call = re.compile(r"^\t*errn = decode_%s\(stream," % function)
+        return set(self.event(i)[0] for i, l in enumerate(self.lines) if call.match(l))
+
+    def sites(self):
+        """(line of the length, line of the hit, function, lvalue) of every string value"""
+        out = []
+        for i, l in enumerate(self.lines):
+            if l.strip() == HIT and self.lines[i - 1].strip() == "/* string table hit */":
+                j = i
+                while not LENGTH.match(self.lines[j]):
+                    j -= 1
+                out.append((j, i, self.function(i), LENGTH.match(self.lines[j]).group(1)))
+        return out
+
+    def resolve(self):
+        for j, i, function, lvalue in self.sites():
+            q, kind = self.event(j)
+            if kind == "characters":
+                users = self.users(function)
+                if len(users) != 1:
+                    sys.exit("%s: %s is used by %s" % (self.decoder.path, function, sorted(users)))
+                q = users.pop()
+            self.qnames.setdefault(key(function, lvalue), set()).add(q)
+        self.ids = dict((q, n) for n, q in enumerate(sorted(set.union(*self.qnames.values()))))
+
+    def qname(self, function, lvalue, lines=None, i=None):
+        """qname number of a value, the nearest START_ELEMENT of lines before i decides between several"""
+        qs = self.qnames[key(function, lvalue)]
+        if len(qs) == 1:
+            q = min(qs)
+        else:
+            while i >= 0:
+                m = re.match(r"^\t*/\* START_ELEMENT\((.*)\) \*/$", text(lines[i]))
+                if m and m.group(1) in qs:
+                    break
+                i -= 1
+            if i < 0:
+                sys.exit("%s: %s is one of %s" % (self.encoder.path, lvalue, sorted(qs)))
+            q = m.group(1)
+        return "%d /* %s */" % (self.ids[q], q)
+
+    def rewriteDecoder(self):
+        lines = self.decoder.lines
+        for j, i, function, lvalue in reversed(self.sites()):
+            q = self.qname(function, lvalue, lines, j)
+            ind = "\t" * indent(lines[i])
+            nl = newline(lines[i])
+            size = None
+            for l in lines[j:i]:
+                m = re.search(r"decodeCharacters\(stream, .*, (\w+)\);", l)
+                if m:
+                    size = m.group(1)
+            slim = any(text(l) == SLIM_IF for l in lines[j:i])
+            hit = "%serrn = decodeStringValueHit(stream, %s, &%s.charactersLen, %s.characters, %s);" % (ind, q, lvalue, lvalue, size)
+            if slim:
+                hit = [SLIM_IF,
+                       "%serrn = decodeStringValueHitArena(stream, %s, &%s.charactersLen, &%s.characters);" % (ind, q, lvalue, lvalue),
+                       SLIM_ELSE, hit, SLIM_ENDIF]
+            else:
+                hit = [hit]
+            lines[i:i + 1] = [l + nl for l in hit]
+            # the miss ends with "} else {" before the hit comment
+            e = i - 2
+            ind = "\t" * (indent(lines[e]) + 1)
+            lines[e:e] = [l + nl for l in [
+                "%sif (errn == 0) {" % ind,
+                "%s\terrn = addStringValue(stream, %s, %s.characters, %s.charactersLen);" % (ind, q, lvalue, lvalue),
+                "%s}" % ind]]
+
+    def rewriteTables(self):
+        lines = self.decoder.lines
+        table = re.compile(r"^static const exi_grammar_production_t (\w+)Productions\[\d+\] = \{$")
+        string = re.compile(r"EXI_GRAMMAR_VALUE_STRING, .*?offsetof\(struct \w+, ([\w.\[\]]+)\.characters\)")
+        rows = 0
+        struct = None
+        for i, l in enumerate(lines):
+            m = table.match(text(l))
+            if m:
+                struct = m.group(1)
+                continue
+            if struct is None:
+                continue
+            if text(l) == "};":
+                struct = None
+                continue
+            if text(l).startswith("#"):
+                continue
+            m = re.match(r"^(\t\{ .*), (\w+) \}(,?)$", text(l))
+            if not m:
+                sys.exit("%s: production %s" % (self.decoder.path, text(l)))
+            qnameID = "0"
+            s = string.search(l)
+            if s:
+                path = s.group(1).replace(".array[0]", ".array[]")
+                if len(self.qnames[key(struct, "%s->%s" % (struct, path))]) != 1:
+                    sys.exit("%s: %s of several qnames" % (self.decoder.path, path))
+                qnameID = self.qname(struct, "%s->%s" % (struct, path))
+            lines[i] = "%s, %s, %s }%s%s" % (m.group(1), qnameID, m.group(2), m.group(3), newline(l))
+            rows += 1
+        return rows
+
+    def rewriteEncoder(self):
+        lines = self.encoder.lines
+        count = 0
+        for i in range(len(lines) - 1, -1, -1):
+            if text(lines[i]).strip() != MISS:
+                continue
+            ind = "\t" * indent(lines[i])
+            nl = newline(lines[i])
+            m = re.match(r"^\t*errn = encodeUnsignedInteger16\(stream, \(uint16_t\)\((.+)\.charactersLen \+ 2\)\);$", text(lines[i + 1]))
+            lvalue = m.group(1)
+            if text(lines[i + 2]).strip() != "if (errn == 0) {" or \
+                    text(lines[i + 3]).strip() != "errn = encodeCharacters(stream, %s.characters, %s.charactersLen);" % (lvalue, lvalue):
+                sys.exit("%s: line %d" % (self.encoder.path, i + 1))
+            end = i + 4
+            while text(lines[end]) != ind + "}":
+                end += 1
+            q = self.qname(FUNCTION.match(text(lines[self.findFunction(i)])).group(1), lvalue, lines, i)
+            call = [ind + "/* encode string as string table hit or miss (+2 len) */",
+                    "%serrn = encodeStringValueCharacters(stream, %s, %s.characters, %s.charactersLen);" % (ind, q, lvalue, lvalue)]
+            if end == i + 4:
+                lines[i:end + 1] = [l + nl for l in call]
+            else:
+                # keep the array index increment after a successful value
+                lines[i:i + 4] = [l + nl for l in call + [ind + "if (errn == 0) {"]]
+            count += 1
+        return count
+
+    def findFunction(self, i):
+        while not FUNCTION.match(text(self.encoder.lines[i])):
+            i -= 1
+        return i
+
+    def run(self):
+        self.resolve()
+        sites = len(self.sites())
+        rows = self.rewriteTables()
+        self.rewriteDecoder()
+        encoded = self.rewriteEncoder()
+        self.decoder.write()
+        self.encoder.write()
+        print("%s: %d qnames, %d decoder and %d encoder string values, %d productions"
+              % (self.decoder.path, len(self.ids), sites, encoded, rows))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    Codec(sys.argv[1], sys.argv[2]).run()